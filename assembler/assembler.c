@@ -3,88 +3,584 @@
 #include "stdio.h"
 #include "../data_structure/tree.h"
 #include "../data_structure/list.h"
+#include "../data_structure/memStats.h"
 #include "../preAssembly/preAssembler.h"
 #include "stdlib.h"
 #include "string.h"
 #include "../output/output.h"
-#include "firstPass.h"
-#include "secondPass.h"
 #include "commonFunctions.h"
 #include "../structs/code.h"
-#include "../structs/missingSymbol.h"
+#include "parallel.h"
+#include "buildCache.h"
+#include "server.h"
+#include "watch.h"
+#include "pipeline.h"
+#include "../libasm/asmSession.h"
+
+/* Where a file is between the steps of handleFileInto */
+enum FileStep
+{
+    FILE_FAILED,
+    FILE_READ,
+    FILE_ASSEMBLED,
+    FILE_RESTORED
+};
+
+/* The file a context is working on, from readFileStep to writeFileStep */
+struct FileInFlight
+{
+    const char *fileName;
+    const char *outputName;
+    enum FileStep step;
+    FileStats *stats;
+    FileStats traceStats;
+    FileTrace fileTrace;
+    const FileTrace *trace;
+    char key[CACHE_KEY_SIZE];
+    FILE *capture;
+    SourceFile source;
+    AsmResult result;
+    double start;
+    int outputs;
+};
+
+struct AssemblyContext
+{
+    AsmAssembler *assembler;
+    FILE *diagnostics;
+    FileStats *stats;
+    TraceLog *trace;
+    int traceThread;
+    BuildCache *cache;
+    const AssemblerOptions *options;
+    struct FileInFlight file;
+};
 
 /**
- * This function processes an assembly file by performing a two-pass assembly.
- * It preprocesses the file, runs the first and second passes, and then generates
- * output files if the assembly was successful.
+ * Creates the state for assembling any number of files one after another.
+ * Diagnostics go to stderr until setAssemblyContextDiagnostics says otherwise.
+ *
+ * @param options The command line options, they must outlive the context.
+ *
+ * @return The new context, or NULL if it could not be allocated.
+ */
+
+AssemblyContext *createAssemblyContext(const AssemblerOptions *options)
+{
+    AssemblyContext *context = calloc(1, sizeof(AssemblyContext));
+    if (context == NULL)
+        return NULL;
+    context->assembler = asmCreate();
+    context->diagnostics = stderr;
+    context->options = options;
+    if (!context->assembler)
+    {
+        destroyAssemblyContext(context);
+        return NULL;
+    }
+    return context;
+}
+
+void setAssemblyContextDiagnostics(AssemblyContext *context, FILE *diagnostics)
+{
+    context->diagnostics = diagnostics;
+}
+
+/*Where the next file's timings and counters go, NULL when nobody asked for them*/
+void setAssemblyContextStats(AssemblyContext *context, FileStats *stats)
+{
+    context->stats = stats;
+}
+
+/*The trace every file's spans are written to, on the track of the given thread*/
+void setAssemblyContextTrace(AssemblyContext *context, TraceLog *trace, int thread)
+{
+    context->trace = trace;
+    context->traceThread = thread;
+}
+
+/*The build cache files are looked up in and stored to, NULL to always assemble*/
+void setAssemblyContextCache(AssemblyContext *context, BuildCache *cache)
+{
+    context->cache = cache;
+}
+
+void destroyAssemblyContext(AssemblyContext *context)
+{
+    if (context != NULL)
+    {
+        asmDestroy(context->assembler);
+        free(context);
+    }
+}
+
+/* Copies everything written to a capture stream on to the real diagnostics */
+
+static void replayDiagnostics(FILE *capture, FILE *diagnostics)
+{
+    char buffer[4096];
+    size_t length;
+
+    rewind(capture);
+    while ((length = fread(buffer, 1, sizeof(buffer), capture)) > 0)
+        fwrite(buffer, 1, length, diagnostics);
+}
+
+/**
+ * First step of handleFileInto. Reads the source into the context's library
+ * handle, then restores the file's outputs from the build cache when the
+ * context has one and the same text was assembled before. The key is hashed
+ * from the text that was read, so a file saved while it is being assembled
+ * is stored under the key of what was assembled. On a cache miss the
+ * diagnostics are captured from here on, so the entry can replay them on
+ * later hits.
  *
  * @param filename The name of the input assembly file.
- * @param missingSymbolTable List for storing symbols referenced in the
- *   assembly code that haven't been resolved during the first pass.
+ * @param outputName The name the output files are given, with their extensions.
+ * @param context The context the file is assembled in, holding no other file.
  *
- * @return Returns 0 if the file was successfully handled, and -1 otherwise.
+ * @return Returns 0 if the file was read or restored, and -1 otherwise.
  */
 
-int handleFile(const char *filename, List missingSymbolTable)
+int readFileStep(const char *filename, const char *outputName, AssemblyContext *context)
 {
-    const char *amName;
-    FILE *amFile;
-    CodeFile *currObj;
-    int firstPassResult, secondPassResult;
+    struct FileInFlight *file = &context->file;
+    unsigned long restored;
+    double phaseStart;
+    Arena arena;
+    char *text;
+    size_t size;
+
+    file->fileName = filename;
+    file->outputName = outputName;
+    file->stats = context->stats;
+    file->trace = NULL;
+    file->capture = NULL;
+    file->source = NULL;
+    file->outputs = 0;
 
-    amName = preprocess(filename);
-    if (!amName)
+    /*The trace tags its spans with the line count, which the stats keep*/
+    if (context->trace)
     {
-        return -1;
+        file->fileTrace.log = context->trace;
+        file->fileTrace.thread = context->traceThread;
+        file->fileTrace.fileName = filename;
+        file->trace = &file->fileTrace;
+        if (!file->stats)
+        {
+            memset(&file->traceStats, 0, sizeof(file->traceStats));
+            file->stats = &file->traceStats;
+        }
     }
+    file->start = traceStart(file->trace);
 
-    amFile = fopen(amName, "r");
-    if (!amFile)
+    arena = asmBeginAssembly(context->assembler);
+    phaseStart = traceStart(file->trace);
+    statsEnter(file->stats, PHASE_PREPROCESS);
+    text = readSourceText(filename, arena, &size);
+    statsLeave(file->stats);
+    traceSpan(file->trace, "read", phaseStart, "bytes", text ? size : 0);
+    if (!text)
     {
-        free((void *)amName);
+        file->step = FILE_FAILED;
         return -1;
     }
 
-    currObj = newCodeFile();
-    firstPassResult = firstPass(amFile, currObj, amName, missingSymbolTable);
-    if (firstPassResult == 1)
+    if (context->cache)
     {
-        fseek(amFile, 0, SEEK_SET);
-        secondPassResult = secondPass(amFile, currObj, amName, missingSymbolTable);
-        if (secondPassResult == 1)
+        buildCacheKeyFromText(text, size, context->options->writeAm, file->key);
+        phaseStart = traceStart(file->trace);
+        if (buildCacheRestore(context->cache, file->key, outputName, context->diagnostics, &restored))
         {
-            output(filename, currObj);
+            statsCount(file->stats, COUNT_CACHE_HITS, 1);
+            statsCount(file->stats, COUNT_BYTES, restored);
+            traceSpan(file->trace, "cacheRestore", phaseStart, "bytes", restored);
+            file->step = FILE_RESTORED;
+            return 0;
         }
+        statsCount(file->stats, COUNT_CACHE_MISSES, 1);
+        file->capture = tmpfile();
     }
 
-    deallocCodeFile(currObj);
+    statsEnter(file->stats, PHASE_PREPROCESS);
+    file->source = sourceFileFromBuffer(text, size, arena);
+    statsLeave(file->stats);
+    file->step = file->source ? FILE_READ : FILE_FAILED;
+    return file->source ? 0 : -1;
+}
+
+/**
+ * Second step of handleFileInto: assembles the source read by readFileStep
+ * in the context's library handle. A file with a line too long to assemble
+ * gets no output. The handle's arena keeps the file until the next one is
+ * read, so the next file reuses its blocks and nothing of this file
+ * survives into it.
+ *
+ * @param context The context readFileStep read the file into.
+ *
+ * @return Returns 0 if the file was assembled or restored, and -1 otherwise.
+ */
 
-    fclose(amFile);
-    free((void *)amName);
+int assembleFileStep(AssemblyContext *context)
+{
+    struct FileInFlight *file = &context->file;
+    FILE *diagnostics = file->capture ? file->capture : context->diagnostics;
+    AsmSession session;
 
+    if (file->step != FILE_READ)
+    {
+        return file->step == FILE_FAILED ? -1 : 0;
+    }
+    session.diagnostics = diagnostics;
+    session.expandedFile = NULL;
+    session.stats = file->stats;
+    session.trace = file->trace;
+    if (context->options->writeAm)
+    {
+        session.expandedFile = openExpandedFile(file->outputName);
+        if (!session.expandedFile)
+        {
+            file->step = FILE_FAILED;
+            return -1;
+        }
+        file->outputs |= CACHE_AM;
+    }
+    file->step = asmAssembleSource(context->assembler, file->source, &session, &file->result) == 0 ? FILE_ASSEMBLED : FILE_FAILED;
+    if (session.expandedFile)
+    {
+        fclose(session.expandedFile);
+    }
+    if (file->step == FILE_FAILED)
+    {
+        fprintf(diagnostics, "Memory allocation error\n");
+        return -1;
+    }
     return 0;
 }
+
 /**
- * The main function of the assembler. It initializes the missingSymbolTable list,
- * and iterates through all input files, processing each with handleFile.
+ * Last step of handleFileInto: writes the output files if the assembly was
+ * successful, then hands captured diagnostics on and stores the file in
+ * the build cache.
  *
- * @param fileCount The number of input files.
- * @param fileName An array of strings containing the names of the input files.
+ * @param context The context assembleFileStep assembled the file in.
+ *
+ * @return Returns 0 if the file was successfully handled, and -1 otherwise.
+ */
+
+int writeFileStep(AssemblyContext *context)
+{
+    struct FileInFlight *file = &context->file;
+    FileStats *stats = file->stats;
+    double phaseStart;
+
+    if (file->step == FILE_ASSEMBLED && file->result.assembled)
+    {
+        phaseStart = traceStart(file->trace);
+        statsEnter(stats, PHASE_OUTPUT);
+        statsCount(stats, COUNT_BYTES, output(file->outputName, &file->result, file->trace));
+        statsLeave(stats);
+        traceSpan(file->trace, "output", phaseStart, "bytes", stats ? stats->counters[COUNT_BYTES] : 0);
+        file->outputs |= CACHE_OB;
+        if (file->result.entryCount >= 1)
+            file->outputs |= CACHE_ENT;
+        if (file->result.externCount >= 1)
+            file->outputs |= CACHE_EXT;
+    }
+    if (file->capture)
+    {
+        replayDiagnostics(file->capture, context->diagnostics);
+        if (file->step == FILE_ASSEMBLED)
+            buildCacheStore(context->cache, file->key, file->outputName, file->outputs, file->capture);
+        fclose(file->capture);
+        file->capture = NULL;
+    }
+    traceSpan(file->trace, "handleFile", file->start, "lines",
+              file->step == FILE_RESTORED || !stats ? 0 : stats->counters[COUNT_LINES]);
+    return file->step == FILE_FAILED ? -1 : 0;
+}
+
+/**
+ * Assembles one file, or restores its outputs from the build cache, in
+ * the three steps the pipeline runs on separate threads.
+ *
+ * @param filename The name of the input assembly file.
+ * @param outputName The name the output files are given, with their extensions.
+ * @param context The context the file is assembled in.
+ *
+ * @return Returns 0 if the file was successfully handled, and -1 otherwise.
+ */
+
+int handleFileInto(const char *filename, const char *outputName, AssemblyContext *context)
+{
+    readFileStep(filename, outputName, context);
+    assembleFileStep(context);
+    return writeFileStep(context);
+}
+
+/*Assembles a file with its outputs next to it*/
+int handleFile(const char *filename, AssemblyContext *context)
+{
+    return handleFileInto(filename, filename, context);
+}
+
+/**
+ * Reads the worker count of a "-j N" or "-jN" option. A bare "-j" means one
+ * worker per online processor, and takes the next argument as its count only
+ * when that is a positive number and is not the last argument, so "-j 2" in
+ * front of a file named 2 still leaves the file alone. An invalid "-jN" is
+ * reported and assembles with one worker.
+ *
+ * @param option The argument starting with "-j".
+ * @param next The argument following it when more arguments follow that one, or NULL.
+ * @param consumedNext Set to 1 when next held the count.
+ *
+ * @return The number of workers to run.
+ */
+
+static int parseWorkerCount(const char *option, const char *next, int *consumedNext)
+{
+    const char *count = option[2] ? option + 2 : next;
+    char *end;
+    long workers = 0;
+
+    *consumedNext = 0;
+    if (count)
+    {
+        workers = strtol(count, &end, 10);
+        if (*end != '\0' || end == count)
+            workers = 0;
+    }
+    if (workers > 0)
+    {
+        *consumedNext = (count == next);
+        return (int)workers;
+    }
+    if (option[2])
+    {
+        fprintf(stderr, "invalid worker count '%s', using one worker\n", option + 2);
+        return 1;
+    }
+    return defaultWorkerCount();
+}
+
+/**
+ * Reads a "--cache-size" value: a byte count with an optional K, M or G suffix.
+ *
+ * @return The size in bytes, or 0 if it is not a valid size.
+ */
+
+static unsigned long parseByteSize(const char *size)
+{
+    char *end;
+    unsigned long bytes = strtoul(size, &end, 10);
+
+    if (end == size)
+        return 0;
+    switch (*end)
+    {
+    case 'G':
+        bytes *= 1024;
+        /* falls through */
+    case 'M':
+        bytes *= 1024;
+        /* falls through */
+    case 'K':
+        bytes *= 1024;
+        end++;
+        break;
+    }
+    return *end == '\0' ? bytes : 0;
+}
+
+/**
+ * Prints the stats the options ask for once every file is done.
+ *
+ * @param options The command line options.
+ * @param files The names of the input files.
+ * @param stats The stats of each input file.
+ * @param filesNumber The number of input files.
+ */
+
+static void reportStats(const AssemblerOptions *options, char **files, const FileStats *stats, int filesNumber)
+{
+    FILE *jsonFile;
+
+    if (options->printStats)
+    {
+        printStatsTable(stdout, files, stats, filesNumber);
+#ifdef MEMSTATS
+        printMemStats(stdout);
+#endif
+    }
+    if (options->statsJsonFile)
+    {
+        jsonFile = strcmp(options->statsJsonFile, "-") == 0 ? stdout : fopen(options->statsJsonFile, "w");
+        if (!jsonFile)
+        {
+            fprintf(stderr, "cannot write stats to '%s'\n", options->statsJsonFile);
+            return;
+        }
+        printStatsJson(jsonFile, files, stats, filesNumber);
+        if (jsonFile != stdout)
+            fclose(jsonFile);
+    }
+}
+
+/**
+ * The main function of the assembler. It reads the options ("-j N",
+ * "--am", which keeps the macro-expanded source as <name>.am, "--stats",
+ * "--stats-json FILE", "--trace FILE", "--cache DIR", "--cache-size SIZE",
+ * "--serve SOCKET", "--watch" and "--pipeline"), then either assembles the
+ * input files one after another in a single context, hands them to a pool of
+ * workers when "-j" asks for more than one, overlaps reading, assembling and
+ * writing consecutive files with "--pipeline", runs the batch server of
+ * server.h, or keeps reassembling the files as they change.
+ *
+ * @param fileCount The number of arguments.
+ * @param fileName An array of strings containing the options and the names of the input files.
  *
  * @return Returns 0 upon successful completion.
  */
 
 int assembler(int fileCount, char **fileName)
 {
-    List missingSymbolTable;
+    AssemblyContext *context;
+    AssemblerOptions options = {0};
+    FileStats *stats = NULL;
+    TraceLog *trace = NULL;
+    BuildCache *cache = NULL;
+    char **files;
+    int filesNumber = 0;
+    int workers = 0; /* 0 until "-j" sets it: serial, and a server on every core */
+    int consumedNext;
     int i;
 
-    missingSymbolTable = createDynamicList(missingSymbolConstructor, missingSymbolDestructor);
-
+    files = malloc((fileCount + 1) * sizeof(char *));
+    if (!files)
+    {
+        fprintf(stderr, "Memory allocation error\n");
+        return 1;
+    }
     for (i = 0; i < fileCount; i++)
     {
-        handleFile(fileName[i], missingSymbolTable);
+        if (strncmp(fileName[i], "-j", 2) == 0)
+        {
+            workers = parseWorkerCount(fileName[i], i + 2 < fileCount ? fileName[i + 1] : NULL, &consumedNext);
+            i += consumedNext;
+        }
+        else if (strcmp(fileName[i], "--am") == 0)
+        {
+            options.writeAm = 1;
+        }
+        else if (strcmp(fileName[i], "--stats") == 0)
+        {
+            options.printStats = 1;
+        }
+        else if (strcmp(fileName[i], "--stats-json") == 0)
+        {
+            options.statsJsonFile = i + 1 < fileCount ? fileName[++i] : "-";
+        }
+        else if (strcmp(fileName[i], "--trace") == 0)
+        {
+            options.traceFile = i + 1 < fileCount ? fileName[++i] : "-";
+        }
+        else if (strcmp(fileName[i], "--cache") == 0 && i + 1 < fileCount)
+        {
+            options.cacheDirectory = fileName[++i];
+        }
+        else if (strcmp(fileName[i], "--watch") == 0)
+        {
+            options.watch = 1;
+        }
+        else if (strcmp(fileName[i], "--pipeline") == 0)
+        {
+            options.pipeline = 1;
+        }
+        else if (strcmp(fileName[i], "--serve") == 0)
+        {
+            options.serveSocket = i + 1 < fileCount ? fileName[++i] : "-";
+        }
+        else if (strcmp(fileName[i], "--cache-size") == 0 && i + 1 < fileCount)
+        {
+            options.cacheMaxBytes = parseByteSize(fileName[++i]);
+            if (options.cacheMaxBytes == 0)
+                fprintf(stderr, "invalid cache size '%s', using the default\n", fileName[i]);
+        }
+        else
+        {
+            files[filesNumber++] = fileName[i];
+        }
+    }
+
+    if (options.printStats || options.statsJsonFile)
+    {
+        stats = calloc(filesNumber ? filesNumber : 1, sizeof(FileStats));
+        if (!stats)
+        {
+            fprintf(stderr, "Memory allocation error\n");
+            free(files);
+            return 1;
+        }
+    }
+
+    if (options.cacheDirectory)
+    {
+        cache = openBuildCache(options.cacheDirectory, options.cacheMaxBytes ? options.cacheMaxBytes : CACHE_DEFAULT_MAX_BYTES);
+        if (!cache)
+            fprintf(stderr, "cannot use '%s' as the build cache, assembling without it\n", options.cacheDirectory);
+    }
+    if (options.traceFile)
+    {
+        trace = openTraceLog(options.traceFile);
+        if (!trace)
+            fprintf(stderr, "cannot write the trace to '%s'\n", options.traceFile);
+    }
+
+    if (options.serveSocket)
+    {
+        serve(options.serveSocket, workers ? workers : defaultWorkerCount(), &options, trace, cache);
+    }
+    else if (options.watch)
+    {
+        watchFiles(files, filesNumber, &options, trace, cache);
     }
+    else if ((workers < 2 || filesNumber < 2 ||
+              assembleParallel(files, filesNumber, workers, &options, stats, trace, cache) != 0) &&
+             (workers > 1 || !options.pipeline || filesNumber < 2 ||
+              assemblePipelined(files, filesNumber, &options, stats, trace, cache, options.printStats ? stdout : NULL) != 0))
+    {
+        /*Serially, which is also where a pool or a pipeline that could not start ends up*/
+        context = createAssemblyContext(&options);
+        if (!context)
+        {
+            fprintf(stderr, "Memory allocation error\n");
+            closeTraceLog(trace);
+            closeBuildCache(cache);
+            free(stats);
+            free(files);
+            return 1;
+        }
+
+        setAssemblyContextTrace(context, trace, 0);
+        setAssemblyContextCache(context, cache);
+        for (i = 0; i < filesNumber; i++)
+        {
+            setAssemblyContextStats(context, stats ? &stats[i] : NULL);
+            handleFile(files[i], context);
+        }
 
+        destroyAssemblyContext(context);
+    }
+
+    closeBuildCache(cache);
+    if (closeTraceLog(trace) != 0)
+        fprintf(stderr, "cannot write the trace to '%s'\n", options.traceFile);
+    if (stats)
+    {
+        reportStats(&options, files, stats, filesNumber);
+    }
+    free(stats);
+    free(files);
     return 0;
-}
\ No newline at end of file
+}
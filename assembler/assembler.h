@@ -1,6 +1,49 @@
 #ifndef _ASSEMBLER_H
 #define _ASSEMBLER_H
 
+#include "stdio.h"
+#include "../data_structure/arena.h"
+#include "stats.h"
+#include "trace.h"
+#include "buildCache.h"
+
+/* Bump whenever the same source may assemble to different output, cached results are keyed on it */
+#define ASSEMBLER_VERSION "1.1"
+
+/* Command line options, shared by every input file */
+typedef struct AssemblerOptions
+{
+    int writeAm;                /* also write the macro-expanded source to <name>.am */
+    int printStats;             /* print the per-phase stats table to stdout */
+    const char *statsJsonFile;  /* write the stats as JSON to this file, "-" for stdout */
+    const char *traceFile;      /* write a Chrome trace of every file's phases here */
+    const char *cacheDirectory; /* reuse the outputs of unchanged sources kept here */
+    unsigned long cacheMaxBytes; /* evict cache entries beyond this size */
+    const char *serveSocket;    /* serve jobs on this Unix socket, "-" for a manifest on stdin */
+    int watch;                  /* reassemble the files whenever their sources change */
+    int pipeline;               /* overlap reading, assembling and writing across files */
+} AssemblerOptions;
+
+/* Everything one worker keeps between files: the library handle every
+ * file is assembled in, where diagnostics, stats and trace go, and the options. */
+typedef struct AssemblyContext AssemblyContext;
+
+AssemblyContext *createAssemblyContext(const AssemblerOptions *options);
+void setAssemblyContextDiagnostics(AssemblyContext *context, FILE *diagnostics);
+void setAssemblyContextStats(AssemblyContext *context, FileStats *stats);
+void setAssemblyContextTrace(AssemblyContext *context, TraceLog *trace, int thread);
+void setAssemblyContextCache(AssemblyContext *context, BuildCache *cache);
+void destroyAssemblyContext(AssemblyContext *context);
+
+int handleFile(const char *filename, AssemblyContext *context);
+int handleFileInto(const char *filename, const char *outputName, AssemblyContext *context);
+
+/* handleFileInto in its three steps, read, assemble and write. A context
+ * holds one file from its readFileStep to its writeFileStep, and the steps
+ * may run on different threads as long as they run in order. */
+int readFileStep(const char *filename, const char *outputName, AssemblyContext *context);
+int assembleFileStep(AssemblyContext *context);
+int writeFileStep(AssemblyContext *context);
 int assembler(int filesNumber, char **fileNames);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,466 @@
+#define _POSIX_C_SOURCE 200809L
+#include "buildCache.h"
+#include "assembler.h"
+#include "stdlib.h"
+#include "string.h"
+#include <dirent.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+
+#define CACHE_MAGIC "asmcache 1\n"
+#define ENTRY_SUFFIX ".entry"
+#define HASH_LANES 4
+#define PATH_CAPACITY 4096
+
+/* Section tags of an entry, in the order they are written. Each section is
+ * "<tag> <length>\n" followed by length bytes, "end\n" closes the entry. */
+static const char *const sectionTags[] = {"diagnostics", ".ob", ".ent", ".ext", ".am"};
+static const int sectionOutputs[] = {0, CACHE_OB, CACHE_ENT, CACHE_EXT, CACHE_AM};
+
+#define SECTION_COUNT (sizeof(sectionTags) / sizeof(sectionTags[0]))
+
+struct BuildCache
+{
+    char *directory;
+    unsigned long maxBytes;
+    unsigned long usedBytes;
+    unsigned long tempCount;
+    pthread_mutex_t lock;
+};
+
+struct CachedEntry
+{
+    char *path;
+    unsigned long size;
+    time_t used;
+};
+
+/* Reads a whole file into a NUL-terminated heap buffer.
+ * Returns NULL if it cannot be read. */
+
+static char *readWhole(const char *path, unsigned long *length)
+{
+    FILE *file = fopen(path, "rb");
+    char *contents = NULL;
+    size_t capacity = 0, used = 0, got;
+    char *temp;
+
+    if (!file)
+        return NULL;
+    do
+    {
+        if (capacity - used < 4096)
+        {
+            capacity = capacity ? capacity * 2 : 8192;
+            temp = realloc(contents, capacity + 1);
+            if (!temp)
+            {
+                free(contents);
+                fclose(file);
+                return NULL;
+            }
+            contents = temp;
+        }
+        got = fread(contents + used, 1, capacity - used, file);
+        used += got;
+    } while (got > 0);
+    if (ferror(file))
+    {
+        free(contents);
+        contents = NULL;
+    }
+    else
+    {
+        contents[used] = '\0';
+        *length = (unsigned long)used;
+    }
+    fclose(file);
+    return contents;
+}
+
+static void entryPath(char *path, const BuildCache *cache, const char *name)
+{
+    sprintf(path, "%s/%s", cache->directory, name);
+}
+
+static int isEntryName(const char *name)
+{
+    size_t length = strlen(name);
+    return length > strlen(ENTRY_SUFFIX) && strcmp(name + length - strlen(ENTRY_SUFFIX), ENTRY_SUFFIX) == 0;
+}
+
+/* Lists the entries of the cache directory with their sizes and last use.
+ * Returns the number of entries, or -1 if the directory cannot be read. */
+
+static int listEntries(const BuildCache *cache, struct CachedEntry **entries, unsigned long *totalBytes)
+{
+    DIR *dir = opendir(cache->directory);
+    struct dirent *item;
+    struct stat info;
+    struct CachedEntry *temp;
+    char path[PATH_CAPACITY];
+    int count = 0, capacity = 0;
+
+    *entries = NULL;
+    *totalBytes = 0;
+    if (!dir)
+        return -1;
+    while ((item = readdir(dir)) != NULL)
+    {
+        if (!isEntryName(item->d_name) || strlen(cache->directory) + strlen(item->d_name) + 2 > PATH_CAPACITY)
+            continue;
+        entryPath(path, cache, item->d_name);
+        if (stat(path, &info) != 0)
+            continue;
+        if (count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 64;
+            temp = realloc(*entries, capacity * sizeof(struct CachedEntry));
+            if (!temp)
+                break;
+            *entries = temp;
+        }
+        (*entries)[count].path = malloc(strlen(path) + 1);
+        if (!(*entries)[count].path)
+            break;
+        strcpy((*entries)[count].path, path);
+        (*entries)[count].size = (unsigned long)info.st_size;
+        (*entries)[count].used = info.st_mtime;
+        *totalBytes += (unsigned long)info.st_size;
+        count++;
+    }
+    closedir(dir);
+    return count;
+}
+
+static void freeEntries(struct CachedEntry *entries, int count)
+{
+    int i;
+    for (i = 0; i < count; i++)
+        free(entries[i].path);
+    free(entries);
+}
+
+static int compareLastUse(const void *first, const void *second)
+{
+    const struct CachedEntry *a = first;
+    const struct CachedEntry *b = second;
+    return a->used < b->used ? -1 : a->used > b->used;
+}
+
+/*Removes the least recently used entries until the cache is down to three quarters of its limit*/
+static void evict(BuildCache *cache)
+{
+    struct CachedEntry *entries;
+    unsigned long totalBytes;
+    int count = listEntries(cache, &entries, &totalBytes);
+    int i;
+
+    if (count < 0)
+        return;
+    qsort(entries, count, sizeof(struct CachedEntry), compareLastUse);
+    for (i = 0; i < count && totalBytes > cache->maxBytes / 4 * 3; i++)
+    {
+        if (unlink(entries[i].path) == 0)
+            totalBytes -= entries[i].size;
+    }
+    cache->usedBytes = totalBytes;
+    freeEntries(entries, count);
+}
+
+/**
+ * Opens a cache directory, creating it if needed.
+ *
+ * @param directory Where the entries are kept.
+ * @param maxBytes The size the entries may take before the least recently used ones are evicted.
+ *
+ * @return The cache, or NULL if the directory cannot be used.
+ */
+
+BuildCache *openBuildCache(const char *directory, unsigned long maxBytes)
+{
+    BuildCache *cache;
+    struct CachedEntry *entries;
+    int count;
+
+    if (strlen(directory) > PATH_CAPACITY - CACHE_KEY_SIZE - 64)
+        return NULL;
+    mkdir(directory, 0777);
+    cache = calloc(1, sizeof(BuildCache));
+    if (!cache)
+        return NULL;
+    cache->directory = malloc(strlen(directory) + 1);
+    if (!cache->directory)
+    {
+        free(cache);
+        return NULL;
+    }
+    strcpy(cache->directory, directory);
+    cache->maxBytes = maxBytes;
+    count = listEntries(cache, &entries, &cache->usedBytes);
+    if (count < 0)
+    {
+        free(cache->directory);
+        free(cache);
+        return NULL;
+    }
+    freeEntries(entries, count);
+    pthread_mutex_init(&cache->lock, NULL);
+    return cache;
+}
+
+void closeBuildCache(BuildCache *cache)
+{
+    if (cache != NULL)
+    {
+        pthread_mutex_destroy(&cache->lock);
+        free(cache->directory);
+        free(cache);
+    }
+}
+
+/**
+ * Hashes a source together with the assembler version and the options
+ * that change its outputs. The hash is four independent 32-bit
+ * multiply-xorshift lanes and the source length, which is plenty to tell
+ * sources apart but is not meant to resist deliberate collisions. The
+ * text must be the bytes that get assembled, so outputs are never stored
+ * under the key of a different version of the file.
+ *
+ * @param text The source as read.
+ * @param length The number of bytes of text.
+ * @param writeAm Whether the .am file is produced too.
+ * @param key Receives the key as CACHE_KEY_LENGTH hex digits.
+ */
+
+void buildCacheKeyFromText(const char *text, unsigned long length, int writeAm, char key[CACHE_KEY_SIZE])
+{
+    static const unsigned long seeds[HASH_LANES] = {0x811c9dc5UL, 0x9e3779b9UL, 0x85ebca6bUL, 0xc2b2ae35UL};
+    static const char version[] = ASSEMBLER_VERSION;
+    unsigned long lanes[HASH_LANES];
+    unsigned long i;
+    int lane;
+
+    for (lane = 0; lane < HASH_LANES; lane++)
+    {
+        unsigned long h = seeds[lane] ^ (unsigned long)writeAm;
+        for (i = 0; i < sizeof(version); i++)
+            h = ((h ^ (unsigned char)version[i]) * 0x01000193UL) & 0xffffffffUL;
+        for (i = 0; i < length; i++)
+        {
+            h = ((h ^ (unsigned char)text[i]) * (0x01000193UL + 2 * lane)) & 0xffffffffUL;
+            h ^= h >> (13 + lane);
+        }
+        lanes[lane] = h;
+    }
+    sprintf(key, "%08lx%08lx%08lx%08lx%08lx", lanes[0], lanes[1], lanes[2], lanes[3], length & 0xffffffffUL);
+}
+
+/**
+ * Reads <name>.as and hashes it like buildCacheKeyFromText, for callers
+ * that do not read the source themselves.
+ *
+ * @return 0 on success, -1 if the source cannot be read.
+ */
+
+int buildCacheKey(const char *fileBaseName, int writeAm, char key[CACHE_KEY_SIZE])
+{
+    unsigned long length;
+    char path[PATH_CAPACITY];
+    char *source;
+
+    if (strlen(fileBaseName) + 4 > PATH_CAPACITY)
+        return -1;
+    sprintf(path, "%s.as", fileBaseName);
+    source = readWhole(path, &length);
+    if (!source)
+        return -1;
+    buildCacheKeyFromText(source, length, writeAm, key);
+    free(source);
+    return 0;
+}
+
+/*Writes length bytes to the file named after the base name, returns 0 on success*/
+static int writeOutput(const char *fileBaseName, const char *extension, const char *bytes, unsigned long length)
+{
+    char path[PATH_CAPACITY];
+    FILE *file;
+    int failed;
+
+    sprintf(path, "%s%s", fileBaseName, extension);
+    file = fopen(path, "w");
+    if (!file)
+        return -1;
+    failed = fwrite(bytes, 1, length, file) != length;
+    failed |= fclose(file) != 0;
+    return failed ? -1 : 0;
+}
+
+/**
+ * Looks the key up and, on a hit, recreates the file's outputs and replays
+ * its diagnostics as if it had been assembled.
+ *
+ * @param bytes Receives the number of output bytes written on a hit.
+ *
+ * @return 1 on a hit, 0 on a miss.
+ */
+
+int buildCacheRestore(BuildCache *cache, const char *key, const char *fileBaseName, FILE *diagnostics, unsigned long *bytes)
+{
+    const char *sections[SECTION_COUNT];
+    unsigned long lengths[SECTION_COUNT];
+    char path[PATH_CAPACITY];
+    char tag[16];
+    unsigned long length, sectionLength;
+    char *entry, *cursor;
+    size_t s;
+    int consumed;
+
+    if (strlen(fileBaseName) + 8 > PATH_CAPACITY)
+        return 0;
+    sprintf(path, "%s/%s%s", cache->directory, key, ENTRY_SUFFIX);
+    entry = readWhole(path, &length);
+    if (!entry)
+        return 0;
+
+    /*The entry must be complete before anything is written*/
+    for (s = 0; s < SECTION_COUNT; s++)
+        sections[s] = NULL;
+    cursor = entry + strlen(CACHE_MAGIC);
+    if (length < strlen(CACHE_MAGIC) || strncmp(entry, CACHE_MAGIC, strlen(CACHE_MAGIC)) != 0)
+        cursor = NULL;
+    while (cursor && strncmp(cursor, "end\n", 4) != 0)
+    {
+        /*Not "\n" in the format, it would also skip whitespace the payload starts with*/
+        if (sscanf(cursor, "%15s %lu%n", tag, &sectionLength, &consumed) != 2 || cursor[consumed] != '\n' ||
+            sectionLength > length - (unsigned long)(cursor + consumed + 1 - entry))
+        {
+            cursor = NULL;
+            break;
+        }
+        consumed++;
+        for (s = 0; s < SECTION_COUNT && strcmp(tag, sectionTags[s]) != 0; s++)
+            ;
+        if (s < SECTION_COUNT)
+        {
+            sections[s] = cursor + consumed;
+            lengths[s] = sectionLength;
+        }
+        cursor += consumed + sectionLength;
+    }
+    if (!cursor)
+    {
+        free(entry);
+        return 0;
+    }
+
+    *bytes = 0;
+    for (s = 1; s < SECTION_COUNT; s++)
+    {
+        if (sections[s] && writeOutput(fileBaseName, sectionTags[s], sections[s], lengths[s]) != 0)
+        {
+            free(entry);
+            return 0;
+        }
+        if (sections[s] && sectionOutputs[s] != CACHE_AM)
+            *bytes += lengths[s];
+    }
+    if (sections[0])
+        fwrite(sections[0], 1, lengths[0], diagnostics);
+    free(entry);
+
+    /*A hit makes the entry the most recently used one*/
+    utime(path, NULL);
+    return 1;
+}
+
+/*Appends the whole stream, after a section header holding its length*/
+static int copySection(FILE *from, FILE *to, const char *tag)
+{
+    char buffer[4096];
+    size_t got;
+    long length;
+
+    if (fseek(from, 0, SEEK_END) != 0 || (length = ftell(from)) < 0)
+        return -1;
+    rewind(from);
+    fprintf(to, "%s %lu\n", tag, (unsigned long)length);
+    while ((got = fread(buffer, 1, sizeof(buffer), from)) > 0)
+    {
+        if (fwrite(buffer, 1, got, to) != got)
+            return -1;
+    }
+    return ferror(from) ? -1 : 0;
+}
+
+/**
+ * Stores a file's outputs and diagnostics under the key. The entry is
+ * written to a temporary name and renamed, so a concurrent reader sees
+ * either the whole entry or none. Nothing is stored if an output is missing.
+ * Storing past the size limit evicts the least recently used entries.
+ *
+ * @param outputs The CacheOutput flags of the outputs the file produced.
+ * @param diagnostics A stream holding everything the file reported.
+ */
+
+void buildCacheStore(BuildCache *cache, const char *key, const char *fileBaseName, int outputs, FILE *diagnostics)
+{
+    char temporary[PATH_CAPACITY];
+    char path[PATH_CAPACITY];
+    char outputPath[PATH_CAPACITY];
+    char *contents;
+    unsigned long length, tempId;
+    long entrySize = 0;
+    FILE *entry;
+    size_t s;
+    int failed;
+
+    if (strlen(fileBaseName) + 8 > PATH_CAPACITY)
+        return;
+    pthread_mutex_lock(&cache->lock);
+    tempId = cache->tempCount++;
+    pthread_mutex_unlock(&cache->lock);
+    sprintf(temporary, "%s/%s.%ld.%lu.tmp", cache->directory, key, (long)getpid(), tempId);
+    sprintf(path, "%s/%s%s", cache->directory, key, ENTRY_SUFFIX);
+
+    entry = fopen(temporary, "wb");
+    if (!entry)
+        return;
+    fputs(CACHE_MAGIC, entry);
+    failed = copySection(diagnostics, entry, sectionTags[0]) != 0;
+    for (s = 1; s < SECTION_COUNT && !failed; s++)
+    {
+        if (!(outputs & sectionOutputs[s]))
+            continue;
+        sprintf(outputPath, "%s%s", fileBaseName, sectionTags[s]);
+        contents = readWhole(outputPath, &length);
+        if (!contents)
+        {
+            failed = 1;
+            break;
+        }
+        fprintf(entry, "%s %lu\n", sectionTags[s], length);
+        failed = fwrite(contents, 1, length, entry) != length;
+        free(contents);
+    }
+    fputs("end\n", entry);
+    entrySize = ftell(entry);
+    failed |= ferror(entry) != 0;
+    failed |= fclose(entry) != 0;
+    if (!failed)
+        failed = rename(temporary, path) != 0;
+    if (failed)
+    {
+        remove(temporary);
+        return;
+    }
+
+    pthread_mutex_lock(&cache->lock);
+    cache->usedBytes += (unsigned long)entrySize;
+    if (cache->usedBytes > cache->maxBytes)
+        evict(cache);
+    pthread_mutex_unlock(&cache->lock);
+}
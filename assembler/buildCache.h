@@ -0,0 +1,33 @@
+#ifndef _BUILD_CACHE_H
+#define _BUILD_CACHE_H
+#include "stdio.h"
+
+/* Hex digits of a cache key, and the buffer that holds one */
+#define CACHE_KEY_LENGTH 40
+#define CACHE_KEY_SIZE (CACHE_KEY_LENGTH + 1)
+
+/* Size limit of a cache directory when none is given */
+#define CACHE_DEFAULT_MAX_BYTES (64UL * 1024 * 1024)
+
+/* The outputs of one file, as stored in an entry */
+enum CacheOutput
+{
+    CACHE_OB = 1,
+    CACHE_ENT = 2,
+    CACHE_EXT = 4,
+    CACHE_AM = 8
+};
+
+/* An on-disk cache of assembled files keyed by the hash of their source.
+ * One directory may be shared by the workers of a run and by several runs. */
+typedef struct BuildCache BuildCache;
+
+BuildCache *openBuildCache(const char *directory, unsigned long maxBytes);
+void closeBuildCache(BuildCache *cache);
+
+void buildCacheKeyFromText(const char *text, unsigned long length, int writeAm, char key[CACHE_KEY_SIZE]);
+int buildCacheKey(const char *fileBaseName, int writeAm, char key[CACHE_KEY_SIZE]);
+int buildCacheRestore(BuildCache *cache, const char *key, const char *fileBaseName, FILE *diagnostics, unsigned long *bytes);
+void buildCacheStore(BuildCache *cache, const char *key, const char *fileBaseName, int outputs, FILE *diagnostics);
+
+#endif
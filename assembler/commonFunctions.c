@@ -11,67 +11,20 @@
 #include "err.h"
 #include "firstPass.h"
 #include "secondPass.h"
-void *wordConstructor(const void *copy)
-{
-
-    return memcpy(malloc(sizeof(unsigned int)), copy, sizeof(unsigned int));
-}
-
-void wordDestructor(void *item)
-{
-    free(item);
-}
-
 /**
- * Adds an external reference to the list of external references.
- * If the external reference with the same name already exists, the new call
- * address is added to the existing list of call addresses for that reference.
- * If the external reference does not exist, a new external reference is created,
- * and the call address is added to it.
+ * Adds an external reference to the extern table.
+ * The symbol found by the caller's hashed lookup identifies the extern, so
+ * recording a reference never scans the externs seen so far. References
+ * are grouped by extern only when the .ext file is written.
  *
- * @param externsVec The list of external references.
- * @param externName The name of the external reference.
+ * @param externs The extern table of the file being assembled.
+ * @param externSymbol The extern's entry in the symbol table.
  * @param callAddress The address where the external reference is called.
  */
-void addExtern(List externsVec, const char *externName, const unsigned int callAddress)
+void addExtern(ExternTable externs, struct symbol *externSymbol, const unsigned int callAddress)
 {
-    void *const *externStart;
-    void *const *externEnd;
-    struct ExternalInvocation *extern1 = (struct ExternalInvocation *)malloc(sizeOfExtern());
-    List callAddressList = createDynamicList(wordConstructor, wordDestructor);
-
-    if (!extern1)
-    {
-        fprintf(stderr, "Memory allocation error\n");
-        return;
-    }
-
-    setCallAddressesses(extern1, NULL);
-    setExternName(extern1, externName);
-
-    for (externStart = listGetBegin(externsVec), externEnd = listGetEnd(externsVec); externStart <= externEnd; externStart++)
-    {
-        if (*externStart)
-        {
-            struct ExternalInvocation *eInvocation = (struct ExternalInvocation *)(*externStart);
-            if (strcmp(externName, getExternName(eInvocation)) == 0)
-            {
-                List callAddresses = getCallAddressesses(eInvocation);
-                listInsertItem(callAddresses, &callAddress);
-                free(extern1);
-                return;
-            }
-        }
-    }
-
-    if (!callAddressList)
+    if (externTableAdd(externs, externSymbol, callAddress) != 0)
     {
         fprintf(stderr, "Memory allocation error\n");
-        free(extern1);
-        return;
     }
-    listInsertItem(callAddressList, &callAddress);
-    setCallAddressesses(extern1, callAddressList);
-
-    listInsertItem(externsVec, extern1);
 }
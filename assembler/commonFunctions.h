@@ -4,8 +4,6 @@
 #include "../data_structure/list.h"
 #include "../structs/external.h"
 
-void addExtern(List externsVec, const char *externName, const unsigned int callAddress);
-void *wordConstructor(const void *copy);
-void wordDestructor(void *item);
+void addExtern(ExternTable externs, struct symbol *externSymbol, const unsigned int callAddress);
 
 #endif
\ No newline at end of file
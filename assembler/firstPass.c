@@ -1,23 +1,20 @@
 #include "assembler.h"
+#include "stats.h"
 #include "../lexicalAnalysis/lexicalAnalysis.h"
 #include "stdio.h"
 #include "../data_structure/tree.h"
 #include "../data_structure/list.h"
 #include "../preAssembly/preAssembler.h"
 #include "stdlib.h"
-#define maxLineCapacity 81
 #include "string.h"
 #define baseAddress 100
 #include "../structs/external.h"
-#include "../structs/missingSymbol.h"
+#include "../structs/fixup.h"
 #include "../structs/symbol.h"
 #include "../structs/code.h"
 #include "firstPass.h"
 #include "commonFunctions.h"
 #include "../output/output.h"
-#define RED "\x1B[31m"
-#define RESET "\x1B[0m"
-#define MAG "\x1B[35m"
 
 /* handleInstructionLabel:
  * Handles a label associated with an instruction.
@@ -37,21 +34,21 @@ static void handleInstructionLabel(const char *label, struct symbol *scopeSym, s
     {
         if (getSymbolType(find) != getSymEntryType())
         {
-            fprintf(stderr, RED "ERROR: label '%s' was already defined in line '%d'\n" RESET, getSymbolName(find), lineCounter);
+            diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_ERROR_LINE, "label '%s' was already defined in line '%d'", getSymbolName(find), lineCounter);
             *errorCode = 0;
         }
         else
         {
             setSymbolType(find, getSymEntryCodeType());
-            setSymbolAdr(find, (unsigned int)listGetItemCount(getCodeFileCode(o)) + baseAddress);
+            setSymbolAdr(find, (unsigned int)wordBufferGetCount(getCodeFileCode(o)) + baseAddress);
         }
     }
     else
     {
         setSymbolType(scopeSym, getSymCodeType());
-        setSymbolAdr(scopeSym, (unsigned int)listGetItemCount(getCodeFileCode(o)) + baseAddress);
+        setSymbolAdr(scopeSym, (unsigned int)wordBufferGetCount(getCodeFileCode(o)) + baseAddress);
         setSymbolDeclaredLine(scopeSym, lineCounter);
-        insertWord(getCodeFileSymbolCheck(o), getSymbolName(scopeSym), listInsertItem(getCodeFileSymbolTable(o), scopeSym));
+        hashInsert(getCodeFileSymbolCheck(o), getSymbolName(scopeSym), listInsertItem(getCodeFileSymbolTable(o), scopeSym));
     }
 }
 /* handleDirectiveLabel:
@@ -71,7 +68,7 @@ static void handleDirectiveLabel(const char *label, TokenTree *myTree, struct sy
 {
     if (getTokenTreeDirectiveOptions(myTree) <= getDirectiveEntry())
     {
-        fprintf(stderr, MAG "WARNING: neglecting label for line '%d' " RESET, lineCounter);
+        diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_WARNING_RUN_ON, "neglecting label for line '%d'", lineCounter);
     }
     else
     {
@@ -81,13 +78,13 @@ static void handleDirectiveLabel(const char *label, TokenTree *myTree, struct sy
             {
                 if (getSymbolType(find) != getSymEntryType())
                 {
-                    fprintf(stderr, RED "ERROR: label: '%s' - was already defined in line '%d'" RESET, getSymbolName(find), lineCounter);
+                    diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_ERROR_RUN_ON, "label: '%s' - was already defined in line '%d'", getSymbolName(find), lineCounter);
                     *errorCode = 0;
                 }
                 else
                 {
                     setSymbolType(find, getSymEntryDataType());
-                    setSymbolAdr(find, listGetItemCount(getCodeFileData(o)));
+                    setSymbolAdr(find, wordBufferGetCount(getCodeFileData(o)));
                     setSymbolDeclaredLine(find, lineCounter);
                 }
             }
@@ -97,14 +94,14 @@ static void handleDirectiveLabel(const char *label, TokenTree *myTree, struct sy
             if (getTokenTreeDirectiveOptions(myTree) >= getDirectiveString())
             {
                 setSymbolType(scopeSym, getSymDataType());
-                setSymbolAdr(scopeSym, (unsigned int)listGetItemCount(getCodeFileData(o)));
+                setSymbolAdr(scopeSym, (unsigned int)wordBufferGetCount(getCodeFileData(o)));
                 setSymbolDeclaredLine(scopeSym, lineCounter);
 
-                insertWord(getCodeFileSymbolCheck(o), getSymbolName(scopeSym), listInsertItem(getCodeFileSymbolTable(o), scopeSym));
+                hashInsert(getCodeFileSymbolCheck(o), getSymbolName(scopeSym), listInsertItem(getCodeFileSymbolTable(o), scopeSym));
             }
             else
             {
-                fprintf(stderr, MAG "WARNING: unused label at line '%d' " RESET, lineCounter);
+                diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_WARNING_RUN_ON, "unused label at line '%d'", lineCounter);
             }
         }
     }
@@ -128,7 +125,7 @@ static void handleLabelProcessing(const char *label, TokenTree *myTree, unsigned
     if (label[0] != '\0')
     {
         setSymbolName(scopeSym, label);
-        find = checkIfExists(getCodeFileSymbolCheck(o), label);
+        find = hashLookup(getCodeFileSymbolCheck(o), label);
 
         if (getTokenTreeOptions(myTree) == getInstruction())
         {
@@ -146,23 +143,21 @@ static void handleLabelProcessing(const char *label, TokenTree *myTree, unsigned
  * Args:
  * - myTree: The token tree representing the parsed line of assembly code.
  * - o: CodeFile struct containing the generated code, data, and symbol tables.
- * - lineCounter: The current line number in the input file.
- * - missingSymbol: Struct for missing symbols that cannot be resolved in the first pass.
- * - missingSymbolTable: List of missing symbols.
+ *   Labels that are not defined yet get a fixup in its fixup table.
  * - word: Pointer to the generated code for the instruction.
  * - find: Symbol struct for the found symbol in the symbol table.
  * - externAddress: Pointer to the address for the extern symbol.
  */
 
-static void handleInstructionProcessing(TokenTree *myTree, struct CodeFile *o, unsigned int lineCounter, missingSym *missingSymbol, List missingSymbolTable, unsigned int *word, struct symbol *find, unsigned int *externAddress)
+static void handleInstructionProcessing(TokenTree *myTree, struct CodeFile *o, unsigned int *word, struct symbol *find, unsigned int *externAddress)
 {
     int i;
-    unsigned int *insertedWord;
+    size_t insertedWordIndex;
 
     *word = getTokenTreeInstructionsOperandsOptions(myTree, 1) << 2;
     *word |= getTokenTreeInstructionsOperandsOptions(myTree, 0) << 9;
     *word |= getTokenTreeInstructionType(myTree) << 5;
-    listInsertItem(getCodeFileCode(o), word);
+    wordBufferAppend(getCodeFileCode(o), *word);
 
     if (getTokenTreeInstructionType(myTree) >= getTypeRts())
     {
@@ -174,7 +169,7 @@ static void handleInstructionProcessing(TokenTree *myTree, struct CodeFile *o, u
         {
             *word = getTokenTreeInstructionsOperandsReg(myTree, 1) << 2;
             *word |= getTokenTreeInstructionsOperandsReg(myTree, 0) << 7;
-            listInsertItem(getCodeFileCode(o), word);
+            wordBufferAppend(getCodeFileCode(o), *word);
         }
         else
         {
@@ -184,39 +179,36 @@ static void handleInstructionProcessing(TokenTree *myTree, struct CodeFile *o, u
                 if (operandOptions == getOperandRegisterNumber())
                 {
                     *word = getTokenTreeInstructionsOperandsReg(myTree, i) << (7 - (i * 5));
-                    listInsertItem(getCodeFileCode(o), word);
+                    wordBufferAppend(getCodeFileCode(o), *word);
                 }
                 else if (operandOptions == getOperandLabel())
                 {
-                    find = checkIfExists(getCodeFileSymbolCheck(o), getTokenTreeInstructionsOperandsLabelName(myTree, i));
+                    find = hashLookup(getCodeFileSymbolCheck(o), getTokenTreeInstructionsOperandsLabelName(myTree, i));
                     if (find && getSymbolType(find) != getSymEntryType())
                     {
                         *word = getSymbolAdr(find) << 2;
                         if (getSymbolType(find) == getSymExternType())
                         {
                             *word |= 1;
-                            *externAddress = listGetItemCount(getCodeFileCode(o)) + baseAddress;
-                            addExtern(getCodeFileExternsVec(o), getSymbolName(find), *externAddress);
+                            *externAddress = wordBufferGetCount(getCodeFileCode(o)) + baseAddress;
+                            addExtern(getCodeFileExterns(o), find, *externAddress);
                         }
                         else
                         {
                             *word |= 2;
                         }
                     }
-                    insertedWord = listInsertItem(getCodeFileCode(o), word);
+                    insertedWordIndex = wordBufferGetCount(getCodeFileCode(o));
+                    wordBufferAppend(getCodeFileCode(o), *word);
                     if (!find || (find && getSymbolType(find) == getSymEntryType()))
                     {
-                        missingSymSetSymbolName(missingSymbol, getTokenTreeInstructionsOperandsLabelName(myTree, i));
-                        missingSymSetWord(missingSymbol, insertedWord);
-                        missingSymSetCurrLine(missingSymbol, lineCounter);
-                        missingSymSetCallAddressess(missingSymbol, *externAddress = listGetItemCount(getCodeFileCode(o)) + baseAddress - 1);
-                        listInsertItem(missingSymbolTable, missingSymbol);
+                        fixupTableAdd(getCodeFileFixups(o), getTokenTreeInstructionsOperandsLabelName(myTree, i), insertedWordIndex);
                     }
                 }
                 else if (operandOptions == getOperandNumber())
                 {
                     *word = getTokenTreeInstructionsOperandsNum(myTree, i) << 2;
-                    listInsertItem(getCodeFileCode(o), word);
+                    wordBufferAppend(getCodeFileCode(o), *word);
                 }
                 else if (operandOptions == getOperandNull())
                 {
@@ -242,13 +234,14 @@ static void handleDirective(TokenTree *myTree, struct CodeFile *o, int lineCount
 {
     int i;
     const char *datmyTreering;
+    const char *dataValues;
     unsigned int word = 0;
 
     int directiveOptions = getTokenTreeDirectiveOptions(myTree);
     const char *label = getTokenTreeLabel(myTree);
     if (directiveOptions <= getDirectiveData() && directiveOptions >= getDirectiveString() && label[0] == '\0')
     {
-        fprintf(stderr, MAG "WARNING: neglecting %s because it has no label\n" RESET, directiveOptions == getDirectiveData() ? ".data" : ".string");
+        diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_WARNING_LINE, "neglecting %s because it has no label", directiveOptions == getDirectiveData() ? ".data" : ".string");
     }
     else
     {
@@ -257,33 +250,33 @@ static void handleDirective(TokenTree *myTree, struct CodeFile *o, int lineCount
             for (i = 0, datmyTreering = getTokenTreeDirectiveOperandsString(myTree); *datmyTreering; datmyTreering++)
             {
                 word = *datmyTreering;
-                listInsertItem(getCodeFileData(o), &word);
+                wordBufferAppend(getCodeFileData(o), word);
             }
             word = 0;
-            listInsertItem(getCodeFileData(o), &word);
+            wordBufferAppend(getCodeFileData(o), word);
         }
         else if (directiveOptions == getDirectiveData())
         {
-            for (i = 0; i < getTokenTreeDirectiveOperandsDataCount(myTree); i++)
+            for (i = 0, dataValues = getTokenTreeDirectiveOperandsData(myTree); i < getTokenTreeDirectiveOperandsDataCount(myTree); i++)
             {
-                unsigned int dataItem = getTokenTreeDirectiveOperandsDataData(myTree, i);
-                listInsertItem(getCodeFileData(o), &dataItem);
+                unsigned int dataItem = nextTokenTreeDataValue(&dataValues);
+                wordBufferAppend(getCodeFileData(o), dataItem);
             }
         }
         else if (directiveOptions == getDirectiveExtern() || directiveOptions == getDirectiveEntry())
         {
-            find = checkIfExists(getCodeFileSymbolCheck(o), getTokenTreeDirectiveOperandsLabel(myTree));
+            find = hashLookup(getCodeFileSymbolCheck(o), getTokenTreeDirectiveOperandsLabel(myTree));
             if (find)
             {
                 if (directiveOptions == getDirectiveEntry())
                 {
                     if (getSymbolType(find) == getSymEntryType() || getSymbolType(find) >= getSymEntryCodeType() || getSymbolType(find) >= getSymEntryDataType())
                     {
-                        fprintf(stderr, MAG "WARNING: label '%s' was already defined in another line\n" RESET, getSymbolName(find));
+                        diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_WARNING_LINE, "label '%s' was already defined in another line", getSymbolName(find));
                     }
                     else if (getSymbolType(find) == getSymExternType())
                     {
-                        fprintf(stderr, RED "ERROR: label '%s' was already defined in another line\n" RESET, getSymbolName(find));
+                        diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_ERROR_LINE, "label '%s' was already defined in another line", getSymbolName(find));
                         errorCode = 0;
                     }
                     else
@@ -295,11 +288,11 @@ static void handleDirective(TokenTree *myTree, struct CodeFile *o, int lineCount
                 {
                     if (getSymbolType(find) == getSymExternType())
                     {
-                        fprintf(stderr, MAG "WARNING: label '%s' was already defined in another line\n" RESET, getSymbolName(find));
+                        diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_WARNING_LINE, "label '%s' was already defined in another line", getSymbolName(find));
                     }
                     else
                     {
-                        fprintf(stderr, RED "ERROR: label '%s' was already defined in another line\n" RESET, getSymbolName(find));
+                        diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_ERROR_LINE, "label '%s' was already defined in another line", getSymbolName(find));
                         errorCode = 0;
                     }
                 }
@@ -310,74 +303,145 @@ static void handleDirective(TokenTree *myTree, struct CodeFile *o, int lineCount
                 setSymbolType(scopeSym, directiveOptions);
                 setSymbolAdr(scopeSym, 0);
                 setSymbolDeclaredLine(scopeSym, lineCounter);
-                insertWord(getCodeFileSymbolCheck(o), getSymbolName(scopeSym), listInsertItem(getCodeFileSymbolTable(o), scopeSym));
+                hashInsert(getCodeFileSymbolCheck(o), getSymbolName(scopeSym), listInsertItem(getCodeFileSymbolTable(o), scopeSym));
             }
         }
     }
 }
 
+/* State of a first pass between lines. The preprocessor drives it one
+ * expanded line at a time through firstPassLine. The token and the scratch
+ * symbols are kept from one file to the next.
+ */
+struct FirstPass
+{
+    struct CodeFile *o;
+    TokenTree *myTree;
+    struct symbol *scopeSym;
+    struct symbol *find;
+    unsigned int externAddress;
+    unsigned int lineCounter;
+    unsigned int word;
+    int errorCode;
+};
+
+/*New first pass state intitialization and destroyer*/
+FirstPass *createFirstPass(void)
+{
+    FirstPass *pass = calloc(1, sizeof(FirstPass));
+    if (pass == NULL)
+        return NULL;
+    pass->myTree = createTokenTree();
+    pass->scopeSym = symbolCreate();
+    pass->find = symbolCreate();
+    if (!pass->myTree || !pass->scopeSym || !pass->find)
+    {
+        destroyFirstPass(pass);
+        return NULL;
+    }
+    return pass;
+}
+
+void destroyFirstPass(FirstPass *pass)
+{
+    if (pass != NULL)
+    {
+        symbolDestroy(pass->find);
+        symbolDestroy(pass->scopeSym);
+        destoryTokenTree(pass->myTree);
+        free(pass);
+    }
+}
+
 /**
- * This function performs the first pass over the assembly source file to
- * tokenize the input, create an initial symbol table, and generate
- * code and data segments. It also identifies and stores unresolved symbols
- * for processing in the second pass.
+ * Starts the first pass over one source file. The state then receives
+ * the expanded lines through firstPassLine until firstPassEnd.
  *
- * @param file Pointer to the input assembly file being processed.
+ * @param pass State made by createFirstPass, possibly used for earlier files.
  * @param o Pointer to a structure holding the generated code and data,
- *   as well as symbol and extern tables.
- * @param amName Assembly file name (not used in the function).
- * @param missingSymbolTable List for storing symbols referenced in the
- *   assembly code that haven't been resolved during the first pass.
+ *   as well as symbol, extern and fixup tables.
+ */
+
+void firstPassBegin(FirstPass *pass, struct CodeFile *o)
+{
+    pass->o = o;
+    pass->externAddress = 0;
+    pass->lineCounter = 1;
+    pass->word = 0;
+    pass->errorCode = 1;
+}
+
+/**
+ * Adds one lexed line to the symbol table and the code and data segments.
+ * Uses of labels that are not defined yet are chained in the fixup table
+ * and patched by secondPass. The token is only read, so the preprocessor
+ * can hand the same cached macro body tokens over on every expansion.
  *
- * @return Returns 1 if the first pass was successful, and 0 if errors were found.
+ * @param pass The FirstPass state started by firstPassBegin.
+ * @param token The lexed line.
  */
 
-int firstPass(FILE *file, struct CodeFile *o, const char *amName, List missingSymbolTable)
+void firstPassToken(void *pass, TokenTree *token)
 {
-    char lineContainer[maxLineCapacity] = {0};
-    TokenTree *myTree = NULL;
-    struct symbol *scopeSym = symbolCreate();
-    struct symbol *find = symbolCreate();
-    unsigned int externAddress = 0;
-    missingSym *missingSymbol = missingSymCreate();
-    unsigned int lineCounter = 1;
-    unsigned int word = 0;
-    int errorCode = 1;
+    FirstPass *state = pass;
+    struct CodeFile *o = state->o;
     const char *label;
-    const char *errorMessage;
+    char errorMessage[MAXERROR];
     int options;
-    while (fgets(lineContainer, sizeof(lineContainer), file))
+
+    if (formatTokenTreeError(token, errorMessage, sizeof(errorMessage)))
     {
-        myTree = getTree(lineContainer);
-        errorMessage = getTokenTreeErrorMessage(myTree);
-        if (errorMessage[0] != '\0')
-        {
-            fprintf(stderr, RED "ERROR : %s\n" RESET, errorMessage);
+        diagnose(getCodeFileDiagnostics(o), DIAGNOSTIC_LEXER_ERROR, "%s", errorMessage);
 
-            errorCode = 1;
-            lineCounter++;
-            continue;
-        }
-        label = getTokenTreeLabel(myTree);
-        handleLabelProcessing(label, myTree, lineCounter, scopeSym, find, o, &errorCode);
+        state->errorCode = 1;
+        state->lineCounter++;
+        return;
+    }
+    statsEnter(getCodeFileStats(o), PHASE_FIRST_PASS);
+    label = getTokenTreeLabel(token);
+    handleLabelProcessing(label, token, state->lineCounter, state->scopeSym, state->find, o, &state->errorCode);
 
-        options = getTokenTreeOptions(myTree);
+    options = getTokenTreeOptions(token);
 
-        if (options == getInstruction())
-        {
-            handleInstructionProcessing(myTree, o, lineCounter, missingSymbol, missingSymbolTable, &word, find, &externAddress);
-        }
-        else if (options == getDirective())
-        {
-            handleDirective(myTree, o, lineCounter, scopeSym, find, &errorCode);
-        }
+    if (options == getInstruction())
+    {
+        handleInstructionProcessing(token, o, &state->word, state->find, &state->externAddress);
     }
-    missingSymDestroy(missingSymbol);
-    symbolDestroy(find);
-    symbolDestroy(scopeSym);
-    treeDestroy(myTree);
-    myTree = NULL;
-    lineCounter++;
+    else if (options == getDirective())
+    {
+        handleDirective(token, o, state->lineCounter, state->scopeSym, state->find, &state->errorCode);
+    }
+    statsLeave(getCodeFileStats(o));
+}
+
+/**
+ * Tokenizes one expanded line into the pass's token and processes it
+ * like firstPassToken does.
+ *
+ * @param pass The FirstPass state started by firstPassBegin.
+ * @param line The line, tokenized in place.
+ */
 
-    return errorCode;
-}
\ No newline at end of file
+void firstPassLine(void *pass, char *line)
+{
+    FirstPass *state = pass;
+
+    statsEnter(getCodeFileStats(state->o), PHASE_LEX);
+    fillTokenTree(state->myTree, line);
+    statsLeave(getCodeFileStats(state->o));
+    firstPassToken(pass, state->myTree);
+}
+
+/**
+ * Finishes the first pass. The state can begin another file afterwards.
+ *
+ * @param pass The FirstPass state started by firstPassBegin.
+ *
+ * @return Returns 1 if the first pass was successful, and 0 if errors were found.
+ */
+
+int firstPassEnd(FirstPass *pass)
+{
+    pass->o = NULL;
+    return pass->errorCode;
+}
@@ -5,12 +5,19 @@
 #include "../data_structure/list.h"
 #include "../structs/code.h"
 #include "../structs/external.h"
-#include "../structs/missingSymbol.h"
+#include "../structs/fixup.h"
 #include "../structs/symbol.h"
 #include "../structs/code.h"
 #include "firstPass.h"
 #include "commonFunctions.h"
 #include "../output/output.h"
-int firstPass(FILE *file, struct CodeFile *o, const char *amName, List missingSymbolTable);
+typedef struct FirstPass FirstPass;
+
+FirstPass *createFirstPass(void);
+void destroyFirstPass(FirstPass *pass);
+void firstPassBegin(FirstPass *pass, struct CodeFile *o);
+void firstPassLine(void *pass, char *line);
+void firstPassToken(void *pass, TokenTree *token);
+int firstPassEnd(FirstPass *pass);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,208 @@
+#define _POSIX_C_SOURCE 200112L
+#include "parallel.h"
+#include "assembler.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <pthread.h>
+#include <unistd.h>
+
+/* How many files past the oldest unflushed one each worker may claim. A
+ * finished file holds its stream until every file before it is flushed, so
+ * this bounds the open streams no matter how many files there are. */
+#define JOBS_AHEAD_PER_WORKER 2
+
+/* One input file. Its diagnostics go to a private temporary stream, opened
+ * when a worker claims the file, so that the main thread can replay them in
+ * input order once the file is done.
+ */
+struct FileJob
+{
+    const char *fileName;
+    FILE *diagnostics;
+    FileStats *stats;
+    int done;
+};
+
+struct WorkQueue
+{
+    struct FileJob *jobs;
+    const AssemblerOptions *options;
+    TraceLog *trace;
+    BuildCache *cache;
+    int workersStarted;
+    int jobCount;
+    int nextJob;
+    int flushedJobs;
+    int jobsAhead;
+    pthread_mutex_t lock;
+    pthread_cond_t jobDone;
+    pthread_cond_t jobFlushed;
+};
+
+int defaultWorkerCount(void)
+{
+    long processors = sysconf(_SC_NPROCESSORS_ONLN);
+    return processors > 0 ? (int)processors : 1;
+}
+
+/* Worker loop: claims the next unassembled file until none is left.
+ * Each worker keeps one assembly context of its own for all files it handles.
+ */
+
+static void *worker(void *arg)
+{
+    struct WorkQueue *queue = arg;
+    AssemblyContext *context = createAssemblyContext(queue->options);
+    struct FileJob *job;
+    int jobIndex;
+
+    /*Each worker gets a trace track of its own, the serial path uses track 0*/
+    pthread_mutex_lock(&queue->lock);
+    if (context)
+    {
+        setAssemblyContextTrace(context, queue->trace, ++queue->workersStarted);
+        setAssemblyContextCache(context, queue->cache);
+    }
+    pthread_mutex_unlock(&queue->lock);
+
+    while (1)
+    {
+        pthread_mutex_lock(&queue->lock);
+        while (queue->nextJob < queue->jobCount && queue->nextJob >= queue->flushedJobs + queue->jobsAhead)
+            pthread_cond_wait(&queue->jobFlushed, &queue->lock);
+        jobIndex = queue->nextJob < queue->jobCount ? queue->nextJob++ : -1;
+        pthread_mutex_unlock(&queue->lock);
+        if (jobIndex < 0)
+            break;
+
+        job = &queue->jobs[jobIndex];
+        /*A file that cannot report in order is left for the main thread to report*/
+        job->diagnostics = tmpfile();
+        if (context && job->diagnostics)
+        {
+            setAssemblyContextDiagnostics(context, job->diagnostics);
+            setAssemblyContextStats(context, job->stats);
+            handleFile(job->fileName, context);
+        }
+        else if (job->diagnostics)
+            fprintf(job->diagnostics, "Memory allocation error\n");
+
+        pthread_mutex_lock(&queue->lock);
+        job->done = 1;
+        pthread_cond_broadcast(&queue->jobDone);
+        pthread_mutex_unlock(&queue->lock);
+    }
+    destroyAssemblyContext(context);
+    return NULL;
+}
+
+/* Copies a finished job's diagnostics to stderr and closes its stream */
+
+static void flushDiagnostics(struct FileJob *job)
+{
+    char buffer[4096];
+    size_t length;
+
+    if (!job->diagnostics)
+    {
+        fprintf(stderr, "cannot open a stream for the diagnostics of '%s', it was not assembled\n", job->fileName);
+        return;
+    }
+    rewind(job->diagnostics);
+    while ((length = fread(buffer, 1, sizeof(buffer), job->diagnostics)) > 0)
+    {
+        fwrite(buffer, 1, length, stderr);
+    }
+    fclose(job->diagnostics);
+    job->diagnostics = NULL;
+}
+
+/**
+ * Assembles the files on workerCount threads. The main thread waits for the
+ * files in input order and writes each one's diagnostics as soon as it and
+ * every file before it are done. Workers stay at most JOBS_AHEAD_PER_WORKER
+ * files each ahead of that, so the diagnostics streams open at once stay
+ * proportional to workerCount.
+ *
+ * @param fileNames The base names of the input files.
+ * @param fileCount The number of input files.
+ * @param workerCount The number of worker threads to start.
+ * @param options The command line options, passed on to every file.
+ * @param stats One entry per file receiving its stats, or NULL.
+ * @param trace The trace the workers write their spans to, or NULL.
+ * @param cache The build cache the workers share, or NULL.
+ *
+ * @return Returns 0 when all files were handled, and -1 if no worker could be started.
+ */
+
+int assembleParallel(char **fileNames, int fileCount, int workerCount, const AssemblerOptions *options, FileStats *stats, TraceLog *trace, BuildCache *cache)
+{
+    struct WorkQueue queue;
+    pthread_t *threads;
+    int started = 0;
+    int i;
+
+    if (workerCount > fileCount)
+        workerCount = fileCount;
+
+    queue.jobs = calloc(fileCount, sizeof(struct FileJob));
+    threads = malloc(workerCount * sizeof(pthread_t));
+    if (!queue.jobs || !threads)
+    {
+        fprintf(stderr, "Memory allocation error\n");
+        free(queue.jobs);
+        free(threads);
+        return -1;
+    }
+    for (i = 0; i < fileCount; i++)
+    {
+        queue.jobs[i].fileName = fileNames[i];
+        queue.jobs[i].stats = stats ? &stats[i] : NULL;
+    }
+    queue.options = options;
+    queue.trace = trace;
+    queue.cache = cache;
+    queue.workersStarted = 0;
+    queue.jobCount = fileCount;
+    queue.nextJob = 0;
+    queue.flushedJobs = 0;
+    queue.jobsAhead = workerCount * JOBS_AHEAD_PER_WORKER;
+    pthread_mutex_init(&queue.lock, NULL);
+    pthread_cond_init(&queue.jobDone, NULL);
+    pthread_cond_init(&queue.jobFlushed, NULL);
+
+    for (i = 0; i < workerCount; i++)
+    {
+        if (pthread_create(&threads[started], NULL, worker, &queue) == 0)
+            started++;
+    }
+    /*The main thread has to flush, so without a worker the caller assembles serially*/
+    if (started == 0)
+        queue.jobCount = 0;
+
+    for (i = 0; i < queue.jobCount; i++)
+    {
+        pthread_mutex_lock(&queue.lock);
+        while (!queue.jobs[i].done)
+            pthread_cond_wait(&queue.jobDone, &queue.lock);
+        pthread_mutex_unlock(&queue.lock);
+        flushDiagnostics(&queue.jobs[i]);
+
+        pthread_mutex_lock(&queue.lock);
+        queue.flushedJobs = i + 1;
+        pthread_cond_broadcast(&queue.jobFlushed);
+        pthread_mutex_unlock(&queue.lock);
+    }
+
+    for (i = 0; i < started; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+    pthread_cond_destroy(&queue.jobFlushed);
+    pthread_cond_destroy(&queue.jobDone);
+    pthread_mutex_destroy(&queue.lock);
+    free(threads);
+    free(queue.jobs);
+    return started > 0 ? 0 : -1;
+}
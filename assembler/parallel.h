@@ -0,0 +1,12 @@
+#ifndef _PARALLEL_H
+#define _PARALLEL_H
+
+struct AssemblerOptions;
+struct FileStats;
+struct TraceLog;
+struct BuildCache;
+
+int defaultWorkerCount(void);
+int assembleParallel(char **fileNames, int fileCount, int workerCount, const struct AssemblerOptions *options, struct FileStats *stats, struct TraceLog *trace, struct BuildCache *cache);
+
+#endif
@@ -0,0 +1,304 @@
+#define _POSIX_C_SOURCE 200112L
+#include "pipeline.h"
+#include "assembler.h"
+#include "stats.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <pthread.h>
+
+/* Room for every slot and the NULL that ends the files */
+#define QUEUE_CAPACITY (PIPELINE_SLOTS + 1)
+
+enum PipelineStage
+{
+    STAGE_READ,
+    STAGE_ASSEMBLE,
+    STAGE_WRITE,
+    STAGE_COUNT
+};
+
+static const char *const stageNames[STAGE_COUNT] = {"read", "assemble", "write"};
+
+/* One file's place in the pipeline. Each slot has a context of its own, so
+ * a file's source, tables and result stay put while the files after it are
+ * read and assembled in the other slots. */
+struct Slot
+{
+    AssemblyContext *context;
+    FILE *diagnostics;
+    const char *fileName;
+    int deferred; /* no stream for the diagnostics, the write stage does the whole file */
+};
+
+/* A bounded FIFO of slots between two stages */
+struct StageQueue
+{
+    struct Slot *items[QUEUE_CAPACITY];
+    int head;
+    int count;
+    pthread_mutex_t lock;
+    pthread_cond_t notEmpty;
+    pthread_cond_t notFull;
+};
+
+/* Time a stage spent working on files, and waiting for one to work on */
+struct StageTime
+{
+    double busy;
+    double waiting;
+};
+
+struct Pipeline
+{
+    char **fileNames;
+    int fileCount;
+    FileStats *stats;
+    struct StageQueue freeSlots;
+    struct StageQueue toAssemble;
+    struct StageQueue toWrite;
+    struct StageTime stages[STAGE_COUNT];
+};
+
+static void queueInit(struct StageQueue *queue)
+{
+    queue->head = 0;
+    queue->count = 0;
+    pthread_mutex_init(&queue->lock, NULL);
+    pthread_cond_init(&queue->notEmpty, NULL);
+    pthread_cond_init(&queue->notFull, NULL);
+}
+
+static void queueDestroy(struct StageQueue *queue)
+{
+    pthread_cond_destroy(&queue->notFull);
+    pthread_cond_destroy(&queue->notEmpty);
+    pthread_mutex_destroy(&queue->lock);
+}
+
+/*Adds a slot, NULL when no more files follow, waiting while the queue is full*/
+static void queuePush(struct StageQueue *queue, struct Slot *slot)
+{
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == QUEUE_CAPACITY)
+        pthread_cond_wait(&queue->notFull, &queue->lock);
+    queue->items[(queue->head + queue->count) % QUEUE_CAPACITY] = slot;
+    queue->count++;
+    pthread_cond_signal(&queue->notEmpty);
+    pthread_mutex_unlock(&queue->lock);
+}
+
+/*Takes the oldest slot, waiting while the queue is empty, and charges the wait to the stage*/
+static struct Slot *queuePop(struct StageQueue *queue, struct StageTime *time)
+{
+    double start = statsClock();
+    struct Slot *slot;
+
+    pthread_mutex_lock(&queue->lock);
+    while (queue->count == 0)
+        pthread_cond_wait(&queue->notEmpty, &queue->lock);
+    slot = queue->items[queue->head];
+    queue->head = (queue->head + 1) % QUEUE_CAPACITY;
+    queue->count--;
+    pthread_cond_signal(&queue->notFull);
+    pthread_mutex_unlock(&queue->lock);
+    time->waiting += statsClock() - start;
+    return slot;
+}
+
+/* Read stage: takes a free slot for every file in input order and reads
+ * the source into it, or restores the file from the build cache. A file
+ * whose diagnostics stream cannot be opened is passed on unread.
+ */
+
+static void *readStage(void *arg)
+{
+    struct Pipeline *pipeline = arg;
+    struct StageTime *time = &pipeline->stages[STAGE_READ];
+    struct Slot *slot;
+    double start;
+    int i;
+
+    for (i = 0; i < pipeline->fileCount; i++)
+    {
+        slot = queuePop(&pipeline->freeSlots, time);
+        start = statsClock();
+        slot->diagnostics = tmpfile();
+        slot->fileName = pipeline->fileNames[i];
+        slot->deferred = slot->diagnostics == NULL;
+        setAssemblyContextStats(slot->context, pipeline->stats ? &pipeline->stats[i] : NULL);
+        if (!slot->deferred)
+        {
+            setAssemblyContextDiagnostics(slot->context, slot->diagnostics);
+            readFileStep(slot->fileName, slot->fileName, slot->context);
+        }
+        time->busy += statsClock() - start;
+        queuePush(&pipeline->toAssemble, slot);
+    }
+    queuePush(&pipeline->toAssemble, NULL);
+    return NULL;
+}
+
+/*Assemble stage: macro-expands and assembles each source that was read*/
+static void *assembleStage(void *arg)
+{
+    struct Pipeline *pipeline = arg;
+    struct StageTime *time = &pipeline->stages[STAGE_ASSEMBLE];
+    struct Slot *slot;
+    double start;
+
+    while ((slot = queuePop(&pipeline->toAssemble, time)) != NULL)
+    {
+        start = statsClock();
+        if (!slot->deferred)
+            assembleFileStep(slot->context);
+        time->busy += statsClock() - start;
+        queuePush(&pipeline->toWrite, slot);
+    }
+    queuePush(&pipeline->toWrite, NULL);
+    return NULL;
+}
+
+/* Copies a written file's diagnostics to stderr and closes its stream */
+
+static void flushDiagnostics(struct Slot *slot)
+{
+    char buffer[4096];
+    size_t length;
+
+    if (!slot->diagnostics)
+        return;
+    rewind(slot->diagnostics);
+    while ((length = fread(buffer, 1, sizeof(buffer), slot->diagnostics)) > 0)
+    {
+        fwrite(buffer, 1, length, stderr);
+    }
+    fclose(slot->diagnostics);
+    slot->diagnostics = NULL;
+}
+
+/* Write stage, on the calling thread: writes each file's outputs and
+ * diagnostics in input order, then frees its slot for the next file. A
+ * deferred file is read and assembled here too, reporting to stderr, which
+ * is in order once the files before it are written.
+ */
+
+static void writeStage(struct Pipeline *pipeline)
+{
+    struct StageTime *time = &pipeline->stages[STAGE_WRITE];
+    struct Slot *slot;
+    double start;
+
+    while ((slot = queuePop(&pipeline->toWrite, time)) != NULL)
+    {
+        start = statsClock();
+        if (slot->deferred)
+        {
+            setAssemblyContextDiagnostics(slot->context, stderr);
+            readFileStep(slot->fileName, slot->fileName, slot->context);
+            assembleFileStep(slot->context);
+        }
+        writeFileStep(slot->context);
+        flushDiagnostics(slot);
+        time->busy += statsClock() - start;
+        queuePush(&pipeline->freeSlots, slot);
+    }
+}
+
+/*Prints how much of the run each stage was busy, the busiest one holds the others back*/
+static void printOccupancy(FILE *report, const struct Pipeline *pipeline, double seconds)
+{
+    int busiest = STAGE_READ;
+    int stage;
+
+    fprintf(report, "%-10s %12s %12s %10s\n", "stage", "busy_ms", "waiting_ms", "occupancy");
+    for (stage = 0; stage < STAGE_COUNT; stage++)
+    {
+        fprintf(report, "%-10s %12.3f %12.3f %9.1f%%\n", stageNames[stage],
+                pipeline->stages[stage].busy * 1000.0, pipeline->stages[stage].waiting * 1000.0,
+                seconds > 0 ? 100.0 * pipeline->stages[stage].busy / seconds : 0.0);
+        if (pipeline->stages[stage].busy > pipeline->stages[busiest].busy)
+            busiest = stage;
+    }
+    fprintf(report, "%d files in %.3f ms, bottleneck: %s\n", pipeline->fileCount, seconds * 1000.0, stageNames[busiest]);
+}
+
+/**
+ * Assembles the files in a three stage pipeline: a thread reads sources,
+ * a thread assembles them, and the calling thread writes the outputs. The
+ * stages pass files through bounded queues, so reading file N+1 overlaps
+ * with assembling file N and writing the outputs of file N-1. Every file
+ * goes through every stage in input order, so diagnostics keep the order
+ * the serial path prints them in.
+ *
+ * @param fileNames The base names of the input files.
+ * @param fileCount The number of input files.
+ * @param options The command line options, passed on to every file.
+ * @param stats One entry per file receiving its stats, or NULL.
+ * @param trace The trace the slots write their spans to, or NULL.
+ * @param cache The build cache, or NULL.
+ * @param report Where the stage occupancy is printed, or NULL.
+ *
+ * @return Returns 0 when all files were handled, and -1 if the pipeline
+ *   could not be started and no file was touched.
+ */
+
+int assemblePipelined(char **fileNames, int fileCount, const AssemblerOptions *options, FileStats *stats, TraceLog *trace, BuildCache *cache, FILE *report)
+{
+    struct Pipeline pipeline;
+    struct Slot slots[PIPELINE_SLOTS];
+    pthread_t reader, assembler;
+    double start;
+    int created = 0;
+    int result = 0;
+    int i;
+
+    memset(&pipeline, 0, sizeof(pipeline));
+    pipeline.fileNames = fileNames;
+    pipeline.fileCount = fileCount;
+    pipeline.stats = stats;
+    queueInit(&pipeline.freeSlots);
+    queueInit(&pipeline.toAssemble);
+    queueInit(&pipeline.toWrite);
+
+    /*Each slot gets a trace track of its own, the serial path uses track 0*/
+    for (created = 0; created < PIPELINE_SLOTS; created++)
+    {
+        slots[created].context = createAssemblyContext(options);
+        slots[created].diagnostics = NULL;
+        slots[created].fileName = NULL;
+        slots[created].deferred = 0;
+        if (!slots[created].context)
+            break;
+        setAssemblyContextTrace(slots[created].context, trace, created + 1);
+        setAssemblyContextCache(slots[created].context, cache);
+        queuePush(&pipeline.freeSlots, &slots[created]);
+    }
+
+    start = statsClock();
+    if (created < PIPELINE_SLOTS || pthread_create(&assembler, NULL, assembleStage, &pipeline) != 0)
+    {
+        result = -1;
+    }
+    else if (pthread_create(&reader, NULL, readStage, &pipeline) != 0)
+    {
+        queuePush(&pipeline.toAssemble, NULL);
+        pthread_join(assembler, NULL);
+        result = -1;
+    }
+    else
+    {
+        writeStage(&pipeline);
+        pthread_join(reader, NULL);
+        pthread_join(assembler, NULL);
+        if (report)
+            printOccupancy(report, &pipeline, statsClock() - start);
+    }
+
+    for (i = 0; i < created; i++)
+        destroyAssemblyContext(slots[i].context);
+    queueDestroy(&pipeline.toWrite);
+    queueDestroy(&pipeline.toAssemble);
+    queueDestroy(&pipeline.freeSlots);
+    return result;
+}
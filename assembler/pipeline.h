@@ -0,0 +1,15 @@
+#ifndef _PIPELINE_H
+#define _PIPELINE_H
+#include "stdio.h"
+
+struct AssemblerOptions;
+struct FileStats;
+struct TraceLog;
+struct BuildCache;
+
+/* Files in flight at once, one per stage plus one waiting between stages */
+#define PIPELINE_SLOTS 4
+
+int assemblePipelined(char **fileNames, int fileCount, const struct AssemblerOptions *options, struct FileStats *stats, struct TraceLog *trace, struct BuildCache *cache, FILE *report);
+
+#endif
@@ -5,13 +5,12 @@
 #include "../data_structure/list.h"
 #include "../preAssembly/preAssembler.h"
 #include "stdlib.h"
-#define maxLineCapacity 81
 #include "string.h"
 #define baseAddress 100
 #include "../output/output.h"
 #include "commonFunctions.h"
 #include "../structs/code.h"
-#include "../structs/missingSymbol.h"
+#include "../structs/fixup.h"
 #include "../structs/symbol.h"
 
 #define RED "\x1B[31m"
@@ -19,26 +18,58 @@
 #define MAG "\x1B[35m"
 
 /**
- * This function performs a second pass over the assembly source file to
- * resolve missing symbols and finalize the code and data address values.
+ * Patches every use of one symbol that was not defined when it was used.
+ * The symbol is looked up once, then its whole fixup chain is swept.
+ *
+ * @param o Pointer to a structure holding the generated code and the tables.
+ * @param pending The unresolved symbol.
+ *
+ * @return Returns 1 if the symbol is defined now, and 0 otherwise.
+ */
+static int resolvePendingSymbol(struct CodeFile *o, const PendingSymbol *pending)
+{
+    FixupTable fixups = getCodeFileFixups(o);
+    struct symbol *find = hashLookup(getCodeFileSymbolCheck(o), pendingSymbolGetName(pending));
+    unsigned int word;
+    size_t fixup;
+    size_t wordIndex;
+
+    if (!find || getSymbolType(find) == getSymEntryType())
+    {
+        return 0;
+    }
+    word = getSymbolAdr(find) << 2;
+    word |= getSymbolType(find) == getSymExternType() ? 1 : 2;
+    for (fixup = pendingSymbolGetFirstFixup(pending); fixup != 0; fixup = fixupTableGetNext(fixups, fixup))
+    {
+        wordIndex = fixupTableGetWordIndex(fixups, fixup);
+        if (getSymbolType(find) == getSymExternType())
+        {
+            addExtern(getCodeFileExterns(o), find, (unsigned int)wordIndex + baseAddress);
+        }
+        wordBufferSetWord(getCodeFileCode(o), wordIndex, word);
+    }
+    return 1;
+}
+
+/**
+ * This function performs a second pass over the tables built by the first
+ * pass: it finalizes the data addresses, then resolves the forward
+ * references one symbol at a time through their fixup chains.
  *
- * @param file Pointer to the input assembly file being processed.
  * @param o Pointer to a structure holding the generated code and data,
- *   as well as symbol and extern tables.
- * @param amName Assembly file name (not used in the function).
- * @param missingSymbolTable List of symbols referenced in the assembly code
- *   that haven't been resolved in the first pass.
+ *   as well as symbol, extern and fixup tables.
  *
  * @return Returns 1 if the second pass was successful, and 0 if errors were found.
  */
-int secondPass(FILE *file, struct CodeFile *o, const char *amName, List missingSymbolTable)
+int secondPass(struct CodeFile *o)
 {
     void *const *begin;
     void *const *end;
-    struct symbol *find = NULL;
+    const PendingSymbol *pending;
     int errorCode = 1;
 
-    for (begin = listGetBegin(getCodeFileSymbolTable(o)), end = listGetEnd(getCodeFileSymbolTable(o)); begin <= end; begin++)
+    for (begin = listGetBegin(getCodeFileSymbolTable(o)), end = listGetItemsEnd(getCodeFileSymbolTable(o)); begin < end; begin++)
     {
         if (*begin)
         {
@@ -54,39 +85,19 @@ int secondPass(FILE *file, struct CodeFile *o, const char *amName, List missingS
             }
             if (getSymbolType(symVar) == getSymDataType() || getSymbolType(symVar) == getSymEntryDataType())
             {
-                unsigned int newAdr = getSymbolAdr(symVar) + listGetItemCount(getCodeFileCode(o)) + baseAddress;
+                unsigned int newAdr = getSymbolAdr(symVar) + wordBufferGetCount(getCodeFileCode(o)) + baseAddress;
                 setSymbolAdr(symVar, newAdr);
             }
         }
     }
 
-    for (begin = listGetBegin(missingSymbolTable), end = listGetEnd(missingSymbolTable); begin <= end; begin++)
+    for (pending = fixupTableGetSymbols(getCodeFileFixups(o)); pending; pending = pendingSymbolGetNext(pending))
     {
-        if (*begin)
+        if (!resolvePendingSymbol(o, pending))
         {
-            struct missingSym *missingSymVar = (struct missingSym *)(*begin);
-            find = checkIfExists(getCodeFileSymbolCheck(o), missingSymGetSymbolName(missingSymVar));
-            if (find && getSymbolType(find) != getSymEntryType())
-            {
-                unsigned int *wordPtr = missingSymGetWord(missingSymVar);
-                *wordPtr = getSymbolAdr(find) << 2;
-                if (getSymbolType(find) == getSymExternType())
-                {
-                    *wordPtr |= 1;
-                    addExtern(getCodeFileExternsVec(o), getSymbolName(find), missingSymGetCallAddressess(missingSymVar));
-                }
-                else
-                {
-                    *wordPtr |= 2;
-                }
-            }
-            else
-            {
-                errorCode = 0;
-            }
+            errorCode = 0;
         }
     }
 
-    listDealloc(&missingSymbolTable);
     return errorCode;
 }
@@ -3,6 +3,6 @@
 #include "stdio.h"
 #include "../data_structure/list.h"
 #include "../structs/code.h"
-int secondPass(FILE *file, struct CodeFile *o, const char *amName, List missingSymbolTable);
+int secondPass(struct CodeFile *o);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,449 @@
+#define _POSIX_C_SOURCE 200809L
+#include "server.h"
+#include "assembler.h"
+#include "stats.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <errno.h>
+#include <pthread.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+
+#define LISTEN_BACKLOG 16
+#define REPLY_HEADER_CAPACITY 64
+
+static volatile sig_atomic_t stopRequested;
+
+static void requestStop(int signalNumber)
+{
+    (void)signalNumber;
+    stopRequested = 1;
+}
+
+/* Latency totals of one server run, printed when it stops */
+typedef struct
+{
+    unsigned long jobs;
+    unsigned long failed;
+    double seconds;
+    double slowest;
+} ServerTotals;
+
+/**
+ * Splits a job line in place into the source name and the output name:
+ * the output directory joined with the source's last path component, or
+ * the source itself when the line names no directory.
+ *
+ * @return 0, or -1 for an empty line or an output name that does not fit.
+ */
+
+static int parseJob(char *line, char **source, char *outputName, size_t capacity)
+{
+    char *directory, *baseName;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    if (*line == '\0')
+        return -1;
+    directory = strchr(line, '\t');
+    if (directory)
+        *directory++ = '\0';
+    *source = line;
+    if (!directory || *directory == '\0')
+    {
+        if (strlen(line) >= capacity)
+            return -1;
+        strcpy(outputName, line);
+        return 0;
+    }
+    baseName = strrchr(line, '/');
+    baseName = baseName ? baseName + 1 : line;
+    if (strlen(directory) + strlen(baseName) + 2 > capacity)
+        return -1;
+    sprintf(outputName, "%s/%s", directory, baseName);
+    return 0;
+}
+
+/*Runs one job in the warm context, returns what handleFileInto did and how long it took*/
+static int runJob(AssemblyContext *context, const char *source, const char *outputName, FILE *diagnostics, double *seconds)
+{
+    double start = statsClock();
+    int result;
+
+    setAssemblyContextDiagnostics(context, diagnostics);
+    result = handleFileInto(source, outputName, context);
+    *seconds = statsClock() - start;
+    return result;
+}
+
+static void logJob(ServerTotals *totals, const char *source, int result, double seconds)
+{
+    totals->jobs++;
+    totals->failed += result != 0;
+    totals->seconds += seconds;
+    if (seconds > totals->slowest)
+        totals->slowest = seconds;
+    printf("%s\t%s\t%.3f ms\n", source, result == 0 ? "ok" : "failed", seconds * 1000.0);
+    fflush(stdout);
+}
+
+static void printTotals(const ServerTotals *totals)
+{
+    printf("served %lu jobs, %lu failed, mean %.3f ms, slowest %.3f ms\n", totals->jobs, totals->failed,
+           totals->jobs ? totals->seconds * 1000.0 / totals->jobs : 0.0, totals->slowest * 1000.0);
+}
+
+int serverWriteAll(int fd, const char *bytes, size_t length)
+{
+    ssize_t written;
+
+    while (length > 0)
+    {
+        written = write(fd, bytes, length);
+        if (written < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            return -1;
+        }
+        bytes += written;
+        length -= (size_t)written;
+    }
+    return 0;
+}
+
+static void serveManifest(AssemblyContext *context, ServerTotals *totals)
+{
+    char line[SERVER_LINE_CAPACITY];
+    char outputName[SERVER_LINE_CAPACITY];
+    char *source;
+    double seconds;
+    int result;
+
+    while (!stopRequested && fgets(line, sizeof(line), stdin))
+    {
+        if (parseJob(line, &source, outputName, sizeof(outputName)) != 0)
+            continue;
+        result = runJob(context, source, outputName, stderr, &seconds);
+        logJob(totals, source, result, seconds);
+    }
+}
+
+/**
+ * Answers the jobs of one connection until the client closes it. Each
+ * job's diagnostics are collected in memory and sent after its status.
+ * Jobs are logged to totals while holding lock.
+ *
+ * @return 1 when the client asked the server to shut down, 0 otherwise.
+ */
+
+static int serveConnection(AssemblyContext *context, FILE *requests, int connection, ServerTotals *totals, pthread_mutex_t *lock)
+{
+    char line[SERVER_LINE_CAPACITY];
+    char outputName[SERVER_LINE_CAPACITY];
+    char header[REPLY_HEADER_CAPACITY];
+    char *diagnosticsText;
+    size_t diagnosticsLength;
+    FILE *diagnostics;
+    char *source;
+    double seconds;
+    int result, parsed, failed;
+
+    while (!stopRequested && fgets(line, sizeof(line), requests))
+    {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (strcmp(line, SERVER_SHUTDOWN) == 0)
+            return 1;
+        diagnosticsText = NULL;
+        diagnosticsLength = 0;
+        seconds = 0;
+        result = -1;
+        diagnostics = open_memstream(&diagnosticsText, &diagnosticsLength);
+        parsed = parseJob(line, &source, outputName, sizeof(outputName)) == 0;
+        if (diagnostics && parsed)
+            result = runJob(context, source, outputName, diagnostics, &seconds);
+        if (diagnostics)
+            fclose(diagnostics);
+
+        sprintf(header, "%d %lu %lu\n", result == 0 ? 0 : 1, (unsigned long)(seconds * 1e6), (unsigned long)diagnosticsLength);
+        failed = serverWriteAll(connection, header, strlen(header)) != 0 ||
+                 serverWriteAll(connection, diagnosticsText ? diagnosticsText : "", diagnosticsLength) != 0;
+        free(diagnosticsText);
+        if (parsed)
+        {
+            pthread_mutex_lock(lock);
+            logJob(totals, source, result, seconds);
+            pthread_mutex_unlock(lock);
+        }
+        if (failed)
+            break;
+    }
+    return 0;
+}
+
+/* Binds the listening socket. A socket file nobody answers on is left over
+ * from a server that did not exit cleanly and is replaced, a live one is not. */
+
+static int openServerSocket(const char *path)
+{
+    struct sockaddr_un address;
+    struct stat status;
+    int fd;
+
+    if (strlen(path) >= sizeof(address.sun_path))
+        return -1;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+
+    if (stat(path, &status) == 0 && S_ISSOCK(status.st_mode))
+    {
+        fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (fd < 0 || connect(fd, (struct sockaddr *)&address, sizeof(address)) == 0)
+        {
+            if (fd >= 0)
+                close(fd);
+            return -1;
+        }
+        close(fd);
+        unlink(path);
+    }
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return -1;
+    if (bind(fd, (struct sockaddr *)&address, sizeof(address)) != 0 || listen(fd, LISTEN_BACKLOG) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/* What the socket server's workers share. Every worker accepts on the
+ * listener itself and answers its connections on a context of its own, so
+ * clients are served side by side, up to one per worker. */
+struct ServerPool
+{
+    const AssemblerOptions *options;
+    TraceLog *trace;
+    BuildCache *cache;
+    ServerTotals totals;
+    pthread_t mainThread;
+    int listener;
+    int running;
+    int stopping;
+    int workersStarted;
+    pthread_mutex_t lock;
+};
+
+struct ServerWorker
+{
+    struct ServerPool *pool;
+    pthread_t thread;
+    int connection; /* the connection being answered, -1 between connections */
+};
+
+/* Worker loop: accepts and answers connections until the server stops.
+ * A client's "shutdown", or the last worker giving up, wakes the main
+ * thread the way a signal does. */
+
+static void *serverWorker(void *arg)
+{
+    struct ServerWorker *self = arg;
+    struct ServerPool *pool = self->pool;
+    AssemblyContext *context = createAssemblyContext(pool->options);
+    FILE *requests;
+    int connection;
+    int stopServer = 0;
+
+    pthread_mutex_lock(&pool->lock);
+    if (context)
+    {
+        setAssemblyContextTrace(context, pool->trace, ++pool->workersStarted);
+        setAssemblyContextCache(context, pool->cache);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    if (!context)
+        fprintf(stderr, "Memory allocation error\n");
+
+    while (context && !stopServer)
+    {
+        connection = accept(pool->listener, NULL, NULL);
+        if (connection < 0 && errno == EINTR)
+            continue;
+        pthread_mutex_lock(&pool->lock);
+        if (pool->stopping || connection < 0)
+        {
+            pthread_mutex_unlock(&pool->lock);
+            if (connection >= 0)
+                close(connection);
+            break;
+        }
+        self->connection = connection;
+        pthread_mutex_unlock(&pool->lock);
+
+        requests = fdopen(connection, "r");
+        if (requests)
+            stopServer = serveConnection(context, requests, connection, &pool->totals, &pool->lock);
+
+        /*Closed under the lock, so the main thread never shuts down a reused descriptor*/
+        pthread_mutex_lock(&pool->lock);
+        self->connection = -1;
+        if (requests)
+            fclose(requests);
+        else
+            close(connection);
+        pthread_mutex_unlock(&pool->lock);
+    }
+
+    pthread_mutex_lock(&pool->lock);
+    if (--pool->running == 0 || stopServer)
+        pthread_kill(pool->mainThread, SIGTERM);
+    pthread_mutex_unlock(&pool->lock);
+    destroyAssemblyContext(context);
+    return NULL;
+}
+
+/**
+ * Serves the socket on workerCount threads until SIGINT or SIGTERM arrives
+ * or a client sends "shutdown". Both signals stay blocked in every thread
+ * and the main thread waits for them, then shuts down the listener and the
+ * open connections, so each worker ends after the job it is running.
+ *
+ * @return 0, or -1 if no worker could be started.
+ */
+
+static int serveSocket(int listener, int workerCount, const AssemblerOptions *options, TraceLog *trace, BuildCache *cache, ServerTotals *totals)
+{
+    struct ServerPool pool;
+    struct ServerWorker *workers = calloc(workerCount, sizeof(struct ServerWorker));
+    sigset_t signals;
+    int signalNumber;
+    int started = 0;
+    int i;
+
+    if (!workers)
+    {
+        fprintf(stderr, "Memory allocation error\n");
+        return -1;
+    }
+    memset(&pool, 0, sizeof(pool));
+    pool.options = options;
+    pool.trace = trace;
+    pool.cache = cache;
+    pool.mainThread = pthread_self();
+    pool.listener = listener;
+    pool.running = workerCount;
+    pthread_mutex_init(&pool.lock, NULL);
+
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, NULL);
+
+    pthread_mutex_lock(&pool.lock);
+    for (i = 0; i < workerCount; i++)
+    {
+        workers[started].pool = &pool;
+        workers[started].connection = -1;
+        if (pthread_create(&workers[started].thread, NULL, serverWorker, &workers[started]) == 0)
+            started++;
+    }
+    pool.running = started;
+    pthread_mutex_unlock(&pool.lock);
+
+    if (started > 0)
+        sigwait(&signals, &signalNumber);
+    stopRequested = 1;
+
+    pthread_mutex_lock(&pool.lock);
+    pool.stopping = 1;
+    shutdown(listener, SHUT_RDWR);
+    for (i = 0; i < started; i++)
+    {
+        if (workers[i].connection >= 0)
+            shutdown(workers[i].connection, SHUT_RD);
+    }
+    pthread_mutex_unlock(&pool.lock);
+
+    for (i = 0; i < started; i++)
+    {
+        pthread_join(workers[i].thread, NULL);
+    }
+    *totals = pool.totals;
+    pthread_mutex_destroy(&pool.lock);
+    free(workers);
+    return started > 0 ? 0 : -1;
+}
+
+/**
+ * Runs the batch server until stdin ends, a client sends "shutdown", or
+ * SIGINT or SIGTERM arrives. A manifest is served in order on one context,
+ * a socket on one context per worker, and the arena blocks and the first
+ * pass state of a context stay warm from one job to the next.
+ *
+ * @param socketPath The Unix socket to listen on, or "-" for a manifest on stdin.
+ * @param workerCount The number of connections the socket answers at once.
+ * @param options The command line options, applied to every job.
+ * @param trace The trace every job's spans go to, or NULL.
+ * @param cache The build cache, or NULL.
+ *
+ * @return 0, or 1 if the server could not start.
+ */
+
+int serve(const char *socketPath, int workerCount, const AssemblerOptions *options, TraceLog *trace, BuildCache *cache)
+{
+    AssemblyContext *context;
+    ServerTotals totals = {0};
+    struct sigaction action;
+    int listener, result;
+
+    memset(&action, 0, sizeof(action));
+    sigemptyset(&action.sa_mask);
+    action.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &action, NULL);
+
+    if (strcmp(socketPath, "-") != 0)
+    {
+        listener = openServerSocket(socketPath);
+        if (listener < 0)
+        {
+            fprintf(stderr, "cannot listen on '%s'\n", socketPath);
+            return 1;
+        }
+        printf("listening on %s\n", socketPath);
+        fflush(stdout);
+        result = serveSocket(listener, workerCount > 0 ? workerCount : 1, options, trace, cache, &totals);
+        close(listener);
+        unlink(socketPath);
+        if (result != 0)
+        {
+            fprintf(stderr, "cannot start the server's workers\n");
+            return 1;
+        }
+        printTotals(&totals);
+        return 0;
+    }
+
+    context = createAssemblyContext(options);
+    if (!context)
+    {
+        fprintf(stderr, "Memory allocation error\n");
+        return 1;
+    }
+    setAssemblyContextTrace(context, trace, 0);
+    setAssemblyContextCache(context, cache);
+
+    /*No SA_RESTART, so a signal interrupts the blocking read*/
+    action.sa_handler = requestStop;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    serveManifest(context, &totals);
+    printTotals(&totals);
+    destroyAssemblyContext(context);
+    return 0;
+}
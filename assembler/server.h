@@ -0,0 +1,36 @@
+#ifndef _SERVER_H
+#define _SERVER_H
+
+#include "stddef.h"
+
+struct AssemblerOptions;
+struct TraceLog;
+struct BuildCache;
+
+/* The client finds the server's socket here, and assembles in-process when it is unset */
+#define SERVER_SOCKET_ENV "ASM_SERVER_SOCKET"
+
+/* Longest job line: a source name and an output directory */
+#define SERVER_LINE_CAPACITY 8192
+
+/* A line asking a socket server to exit. Other open connections are cut
+ * after their running job, and their clients assemble the rest themselves. */
+#define SERVER_SHUTDOWN "shutdown"
+
+/* Batch server. Each job is one line, the source's name without ".as",
+ * then optionally a tab and the directory its outputs go to, by default
+ * next to the source. With socket "-" the jobs are read from stdin and
+ * their diagnostics go to stderr. Otherwise they come over connections to
+ * a Unix socket at that path, and every job is answered with the line
+ * "<status> <microseconds> <length>" followed by length bytes of
+ * diagnostics, status being 0 when the file was handled. Up to
+ * workerCount connections are answered at once, each on a context of its
+ * own, and further clients wait to be accepted. Every job is logged to
+ * stdout with its latency. */
+int serve(const char *socketPath, int workerCount, const struct AssemblerOptions *options, struct TraceLog *trace, struct BuildCache *cache);
+
+/* Writes all length bytes to fd, retrying short and interrupted writes.
+ * Returns 0, or -1 on an error. Shared by the server and its client. */
+int serverWriteAll(int fd, const char *bytes, size_t length);
+
+#endif
@@ -0,0 +1,166 @@
+#define _POSIX_C_SOURCE 200112L
+#include "stats.h"
+#include "string.h"
+#include <time.h>
+
+static const char *const phaseNames[PHASE_COUNT] = {
+    "preprocess", "lex", "first_pass", "second_pass", "output"};
+
+static const char *const counterNames[COUNTER_COUNT] = {
+    "lines", "macro_expansions", "symbols", "forward_references", "lookups", "words", "bytes", "cache_hits", "cache_misses"};
+
+/*Seconds on the monotonic clock, the time base of the stats and the trace*/
+double statsClock(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/*Charges the time since the last mark to the innermost phase and starts phase*/
+void statsEnter(FileStats *stats, enum StatsPhase phase)
+{
+    double time;
+
+    if (stats == NULL)
+        return;
+    time = statsClock();
+    if (stats->depth > 0)
+        stats->seconds[stats->phases[stats->depth - 1]] += time - stats->mark;
+    if (stats->depth < STATS_MAX_DEPTH)
+        stats->phases[stats->depth] = phase;
+    stats->depth++;
+    stats->mark = time;
+}
+
+/*Charges the time since the last mark to the innermost phase and ends it*/
+void statsLeave(FileStats *stats)
+{
+    double time;
+
+    if (stats == NULL || stats->depth == 0)
+        return;
+    time = statsClock();
+    if (stats->depth <= STATS_MAX_DEPTH)
+        stats->seconds[stats->phases[stats->depth - 1]] += time - stats->mark;
+    stats->depth--;
+    stats->mark = time;
+}
+
+void statsCount(FileStats *stats, enum StatsCounter counter, unsigned long amount)
+{
+    if (stats != NULL)
+        stats->counters[counter] += amount;
+}
+
+/*Sums the stats of every file*/
+static FileStats totalStats(const FileStats *stats, int fileCount)
+{
+    FileStats total;
+    int i, j;
+
+    memset(&total, 0, sizeof(total));
+    for (i = 0; i < fileCount; i++)
+    {
+        for (j = 0; j < PHASE_COUNT; j++)
+            total.seconds[j] += stats[i].seconds[j];
+        for (j = 0; j < COUNTER_COUNT; j++)
+            total.counters[j] += stats[i].counters[j];
+    }
+    return total;
+}
+
+#define TIME_COLUMN_WIDTH 11
+#define COUNTER_COLUMN_WIDTH 10
+
+/*A column is wide enough for its values and for its whole name*/
+static int columnWidth(const char *name, int minimum)
+{
+    int length = (int)strlen(name);
+    return length > minimum ? length : minimum;
+}
+
+static void printTableRow(FILE *file, const char *name, const FileStats *stats)
+{
+    double sum = 0;
+    int i;
+
+    fprintf(file, "%-20.20s", name);
+    for (i = 0; i < PHASE_COUNT; i++)
+    {
+        fprintf(file, " %*.3f", columnWidth(phaseNames[i], TIME_COLUMN_WIDTH), stats->seconds[i] * 1e3);
+        sum += stats->seconds[i];
+    }
+    fprintf(file, " %*.3f", TIME_COLUMN_WIDTH, sum * 1e3);
+    for (i = 0; i < COUNTER_COUNT; i++)
+        fprintf(file, " %*lu", columnWidth(counterNames[i], COUNTER_COLUMN_WIDTH), stats->counters[i]);
+    fputc('\n', file);
+}
+
+/* Prints one row per file and a total row. Times are in milliseconds,
+ * columns are named like the JSON fields. */
+void printStatsTable(FILE *file, char **fileNames, const FileStats *stats, int fileCount)
+{
+    FileStats total = totalStats(stats, fileCount);
+    int i;
+
+    fprintf(file, "%-20s", "file");
+    for (i = 0; i < PHASE_COUNT; i++)
+        fprintf(file, " %*s", columnWidth(phaseNames[i], TIME_COLUMN_WIDTH), phaseNames[i]);
+    fprintf(file, " %*s", TIME_COLUMN_WIDTH, "total_ms");
+    for (i = 0; i < COUNTER_COUNT; i++)
+        fprintf(file, " %*s", columnWidth(counterNames[i], COUNTER_COLUMN_WIDTH), counterNames[i]);
+    fputc('\n', file);
+
+    for (i = 0; i < fileCount; i++)
+        printTableRow(file, fileNames[i], &stats[i]);
+    printTableRow(file, "(total)", &total);
+}
+
+void printJsonString(FILE *file, const char *string)
+{
+    fputc('"', file);
+    for (; *string; string++)
+    {
+        if (*string == '"' || *string == '\\')
+            fprintf(file, "\\%c", *string);
+        else if ((unsigned char)*string < 0x20)
+            fprintf(file, "\\u%04x", (unsigned char)*string);
+        else
+            fputc(*string, file);
+    }
+    fputc('"', file);
+}
+
+static void printJsonStats(FILE *file, const FileStats *stats)
+{
+    int i;
+
+    fprintf(file, "\"seconds\": {");
+    for (i = 0; i < PHASE_COUNT; i++)
+        fprintf(file, "%s\"%s\": %.9f", i ? ", " : "", phaseNames[i], stats->seconds[i]);
+    fprintf(file, "}, \"counters\": {");
+    for (i = 0; i < COUNTER_COUNT; i++)
+        fprintf(file, "%s\"%s\": %lu", i ? ", " : "", counterNames[i], stats->counters[i]);
+    fprintf(file, "}");
+}
+
+/*Prints {"files": [{"name", "seconds", "counters"}...], "total": {"seconds", "counters"}}*/
+void printStatsJson(FILE *file, char **fileNames, const FileStats *stats, int fileCount)
+{
+    FileStats total = totalStats(stats, fileCount);
+    int i;
+
+    fprintf(file, "{\"files\": [");
+    for (i = 0; i < fileCount; i++)
+    {
+        fprintf(file, "%s\n  {\"name\": ", i ? "," : "");
+        printJsonString(file, fileNames[i]);
+        fprintf(file, ", ");
+        printJsonStats(file, &stats[i]);
+        fprintf(file, "}");
+    }
+    fprintf(file, "],\n \"total\": {");
+    printJsonStats(file, &total);
+    fprintf(file, "}}\n");
+}
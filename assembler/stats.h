@@ -0,0 +1,53 @@
+#ifndef _STATS_H
+#define _STATS_H
+#include "stdio.h"
+
+/* Phases of a file's assembly. Phases nest, the preprocessor calls into the
+ * lexer and the first pass, and each one is charged only its own time. */
+enum StatsPhase
+{
+    PHASE_PREPROCESS,
+    PHASE_LEX,
+    PHASE_FIRST_PASS,
+    PHASE_SECOND_PASS,
+    PHASE_OUTPUT,
+    PHASE_COUNT
+};
+
+enum StatsCounter
+{
+    COUNT_LINES,
+    COUNT_MACRO_EXPANSIONS,
+    COUNT_SYMBOLS,
+    COUNT_FORWARD_REFERENCES,
+    COUNT_LOOKUPS,
+    COUNT_WORDS,
+    COUNT_BYTES,
+    COUNT_CACHE_HITS,
+    COUNT_CACHE_MISSES,
+    COUNTER_COUNT
+};
+
+#define STATS_MAX_DEPTH 8
+
+/* Timings and counters of one file. Every stats function accepts NULL
+ * and then does nothing, so the phases can be marked unconditionally. */
+typedef struct FileStats
+{
+    double seconds[PHASE_COUNT];
+    unsigned long counters[COUNTER_COUNT];
+    int phases[STATS_MAX_DEPTH];
+    int depth;
+    double mark;
+} FileStats;
+
+double statsClock(void);
+void statsEnter(FileStats *stats, enum StatsPhase phase);
+void statsLeave(FileStats *stats);
+void statsCount(FileStats *stats, enum StatsCounter counter, unsigned long amount);
+
+void printStatsTable(FILE *file, char **fileNames, const FileStats *stats, int fileCount);
+void printStatsJson(FILE *file, char **fileNames, const FileStats *stats, int fileCount);
+void printJsonString(FILE *file, const char *string);
+
+#endif
@@ -0,0 +1,85 @@
+#define _POSIX_C_SOURCE 200112L
+#include "trace.h"
+#include "stats.h"
+#include "stdlib.h"
+#include "string.h"
+#include <pthread.h>
+
+struct TraceLog
+{
+    FILE *file;
+    pthread_mutex_t lock;
+    double origin;
+    int events;
+};
+
+/**
+ * Opens a trace file and writes the start of its event array.
+ *
+ * @param path The file to write, "-" for stdout.
+ *
+ * @return The trace, or NULL if the file could not be opened.
+ */
+
+TraceLog *openTraceLog(const char *path)
+{
+    TraceLog *log = calloc(1, sizeof(TraceLog));
+    if (log == NULL)
+        return NULL;
+    log->file = strcmp(path, "-") == 0 ? stdout : fopen(path, "w");
+    if (log->file == NULL)
+    {
+        free(log);
+        return NULL;
+    }
+    pthread_mutex_init(&log->lock, NULL);
+    log->origin = statsClock();
+    fprintf(log->file, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [");
+    return log;
+}
+
+/*Ends the event array and closes the file, returns nonzero if it could not be written*/
+int closeTraceLog(TraceLog *log)
+{
+    int failed;
+
+    if (log == NULL)
+        return 0;
+    fprintf(log->file, "\n]}\n");
+    failed = ferror(log->file);
+    if (log->file != stdout)
+        failed |= fclose(log->file);
+    pthread_mutex_destroy(&log->lock);
+    free(log);
+    return failed;
+}
+
+double traceStart(const FileTrace *trace)
+{
+    return trace ? statsClock() : 0.0;
+}
+
+/**
+ * Writes a span from start until now on the trace's track, with the file
+ * name and, unless argName is NULL, one numeric argument.
+ */
+
+void traceSpan(const FileTrace *trace, const char *name, double start, const char *argName, unsigned long argValue)
+{
+    TraceLog *log;
+    double end;
+
+    if (trace == NULL)
+        return;
+    end = statsClock();
+    log = trace->log;
+    pthread_mutex_lock(&log->lock);
+    fprintf(log->file, "%s\n{\"name\": \"%s\", \"cat\": \"assembler\", \"ph\": \"X\", \"pid\": 1, \"tid\": %d, "
+                       "\"ts\": %.3f, \"dur\": %.3f, \"args\": {\"file\": ",
+            log->events++ ? "," : "", name, trace->thread, (start - log->origin) * 1e6, (end - start) * 1e6);
+    printJsonString(log->file, trace->fileName);
+    if (argName)
+        fprintf(log->file, ", \"%s\": %lu", argName, argValue);
+    fprintf(log->file, "}}");
+    pthread_mutex_unlock(&log->lock);
+}
@@ -0,0 +1,24 @@
+#ifndef _TRACE_H
+#define _TRACE_H
+#include "stdio.h"
+
+/* A Chrome trace-event file (chrome://tracing, ui.perfetto.dev) shared by
+ * every worker. Spans are written as complete events when they end. */
+typedef struct TraceLog TraceLog;
+
+/* The file being traced and the track its spans go on. Every trace
+ * function accepts NULL and then does nothing, like the stats. */
+typedef struct FileTrace
+{
+    TraceLog *log;
+    int thread;
+    const char *fileName;
+} FileTrace;
+
+TraceLog *openTraceLog(const char *path);
+int closeTraceLog(TraceLog *log);
+
+double traceStart(const FileTrace *trace);
+void traceSpan(const FileTrace *trace, const char *name, double start, const char *argName, unsigned long argValue);
+
+#endif
@@ -0,0 +1,176 @@
+#define _POSIX_C_SOURCE 200809L
+#include "watch.h"
+#include "assembler.h"
+#include "stats.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <sys/inotify.h>
+
+/* Room for many events per read, kept in longs so the events are aligned */
+#define EVENT_BUFFER_LONGS 1024
+
+/* Editors save by writing in place or by renaming a new file over the old
+ * one, which a watch on the file itself would lose, so the directories are
+ * watched and their events matched by name. */
+#define WATCH_EVENTS (IN_CLOSE_WRITE | IN_MOVED_TO)
+
+struct WatchedFile
+{
+    const char *fileName;
+    char *sourceName; /* the .as name, without the directory */
+    int descriptor;
+    int changed;
+};
+
+static volatile sig_atomic_t stopRequested;
+
+static void requestStop(int signalNumber)
+{
+    (void)signalNumber;
+    stopRequested = 1;
+}
+
+/**
+ * Adds a watch on the directory of one file and records the name its
+ * events carry. Files of one directory share its watch descriptor.
+ *
+ * @return 0, or -1 if the directory could not be watched.
+ */
+
+static int watchFile(int notify, struct WatchedFile *file)
+{
+    const char *slash = strrchr(file->fileName, '/');
+    const char *baseName = slash ? slash + 1 : file->fileName;
+    size_t directoryLength = slash ? (size_t)(slash - file->fileName) : 0;
+    char *directory = malloc(directoryLength + 2);
+
+    file->sourceName = malloc(strlen(baseName) + 4);
+    if (!directory || !file->sourceName)
+    {
+        free(directory);
+        return -1;
+    }
+    sprintf(file->sourceName, "%s.as", baseName);
+    if (!slash)
+        strcpy(directory, ".");
+    else if (directoryLength == 0)
+        strcpy(directory, "/");
+    else
+        sprintf(directory, "%.*s", (int)directoryLength, file->fileName);
+    file->descriptor = inotify_add_watch(notify, directory, WATCH_EVENTS);
+    free(directory);
+    return file->descriptor < 0 ? -1 : 0;
+}
+
+/*Marks the files an event batch touched, every file at most once however many events it got*/
+static void markChanged(const char *events, size_t length, struct WatchedFile *files, int fileCount)
+{
+    const struct inotify_event *event;
+    size_t offset;
+    int i;
+
+    for (offset = 0; offset < length; offset += sizeof(struct inotify_event) + event->len)
+    {
+        event = (const struct inotify_event *)(events + offset);
+        if (event->len == 0)
+            continue;
+        for (i = 0; i < fileCount; i++)
+        {
+            if (files[i].descriptor == event->wd && strcmp(files[i].sourceName, event->name) == 0)
+                files[i].changed = 1;
+        }
+    }
+}
+
+int watchFiles(char **fileNames, int fileCount, const AssemblerOptions *options, TraceLog *trace, BuildCache *cache)
+{
+    long events[EVENT_BUFFER_LONGS];
+    struct WatchedFile *files = calloc(fileCount ? fileCount : 1, sizeof(struct WatchedFile));
+    AssemblyContext *context = createAssemblyContext(options);
+    struct sigaction action;
+    unsigned long rebuilds = 0;
+    double seen, latency, totalLatency = 0, slowest = 0;
+    ssize_t length;
+    int notify = -1;
+    int failed = 0;
+    int i;
+
+    if (!files || !context)
+    {
+        fprintf(stderr, "Memory allocation error\n");
+        failed = 1;
+    }
+    else if ((notify = inotify_init()) < 0)
+    {
+        fprintf(stderr, "cannot watch the sources, inotify is not available\n");
+        failed = 1;
+    }
+    for (i = 0; !failed && i < fileCount; i++)
+    {
+        files[i].fileName = fileNames[i];
+        if (watchFile(notify, &files[i]) != 0)
+        {
+            fprintf(stderr, "cannot watch '%s.as'\n", fileNames[i]);
+            failed = 1;
+        }
+    }
+
+    if (!failed)
+    {
+        setAssemblyContextTrace(context, trace, 0);
+        setAssemblyContextCache(context, cache);
+
+        /*No SA_RESTART, so a signal interrupts the blocking read*/
+        memset(&action, 0, sizeof(action));
+        sigemptyset(&action.sa_mask);
+        action.sa_handler = requestStop;
+        sigaction(SIGINT, &action, NULL);
+        sigaction(SIGTERM, &action, NULL);
+
+        for (i = 0; i < fileCount; i++)
+            handleFile(fileNames[i], context);
+        printf("watching %d files\n", fileCount);
+        fflush(stdout);
+
+        while (!stopRequested)
+        {
+            length = read(notify, events, sizeof(events));
+            if (length < 0)
+            {
+                if (errno == EINTR)
+                    continue;
+                break;
+            }
+            seen = statsClock();
+            markChanged((const char *)events, (size_t)length, files, fileCount);
+            for (i = 0; i < fileCount; i++)
+            {
+                if (!files[i].changed)
+                    continue;
+                files[i].changed = 0;
+                handleFile(files[i].fileName, context);
+                latency = statsClock() - seen;
+                rebuilds++;
+                totalLatency += latency;
+                if (latency > slowest)
+                    slowest = latency;
+                printf("%s reassembled in %.3f ms\n", files[i].fileName, latency * 1000.0);
+                fflush(stdout);
+            }
+        }
+        printf("reassembled %lu times, mean %.3f ms, slowest %.3f ms\n", rebuilds,
+               rebuilds ? totalLatency * 1000.0 / rebuilds : 0.0, slowest * 1000.0);
+    }
+
+    if (notify >= 0)
+        close(notify);
+    for (i = 0; files && i < fileCount; i++)
+        free(files[i].sourceName);
+    free(files);
+    destroyAssemblyContext(context);
+    return failed;
+}
@@ -0,0 +1,14 @@
+#ifndef _WATCH_H
+#define _WATCH_H
+
+struct AssemblerOptions;
+struct TraceLog;
+struct BuildCache;
+
+/* Assembles the files once, then again each time one of their .as files
+ * is written or replaced, until SIGINT or SIGTERM. Each reassembly is
+ * reported with the time from the change being seen to its outputs being
+ * written. Returns 0, or 1 if the files could not be watched. */
+int watchFiles(char **fileNames, int fileCount, const struct AssemblerOptions *options, struct TraceLog *trace, struct BuildCache *cache);
+
+#endif
@@ -0,0 +1,16 @@
+#define _POSIX_C_SOURCE 200112L
+#include "benchUtil.h"
+
+/*Operations per second of processor time, 0 when the clock did not advance*/
+double perSecond(unsigned long operations, clock_t elapsed)
+{
+    return elapsed ? (double)operations * CLOCKS_PER_SEC / elapsed : 0.0;
+}
+
+/*Wall seconds since start, which was taken with clock_gettime(CLOCK_MONOTONIC)*/
+double elapsedSeconds(const struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double)(now.tv_sec - start->tv_sec) + (now.tv_nsec - start->tv_nsec) / 1e9;
+}
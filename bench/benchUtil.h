@@ -0,0 +1,11 @@
+#ifndef _BENCH_UTIL_H
+#define _BENCH_UTIL_H
+#include "time.h"
+
+struct timespec;
+
+/* Timing helpers shared by the benchmarks */
+double perSecond(unsigned long operations, clock_t elapsed);
+double elapsedSeconds(const struct timespec *start);
+
+#endif
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r2
+    prn 56
+endmcro
+mcro m1
+    sub @r4, @r4
+    prn 25
+endmcro
+mcro m2
+    sub @r2, @r6
+    prn 4
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 38
+endmcro
+mcro m4
+    sub @r2, @r1
+    prn 32
+endmcro
+jsr @r3
+dec L46
+prn 142
+bne L0
+not L0
+jmp @r5
+clr @r1
+cmp 354, 393
+cmp D0, @r7
+add L0, @r6
+m4
+jmp L0
+rts
+mov -510, @r4
+lea L0, L0
+add L0, L0
+inc L0
+cmp @r4, L0
+L0: add -221, L14
+clr @r2
+L1: mov 475, @r7
+L2: not L1
+prn L2
+bne @r3
+m2
+bne L2
+clr @r5
+cmp L1, L1
+m1
+m1
+jmp @r7
+L3: lea L2, L3
+L4: prn 358
+red S5
+add @r3, L1
+jmp L1
+add -110, L1
+inc L1
+jsr @r4
+L5: cmp L5, L0
+not L5
+bne L3
+not L5
+jsr L3
+bne @r4
+inc @r5
+lea L4, @r1
+L6: add @r2, L2
+prn L2
+add -296, L6
+dec L5
+red @r6
+rts
+sub 413, @r4
+L7: rts
+L8: cmp @r3, -77
+L9: mov 328, @r0
+clr @r2
+L10: clr @r7
+inc @r4
+rts
+add @r6, @r0
+mov @r1, L0
+jmp @r1
+jmp L9
+L11: mov @r1, @r2
+L12: cmp 337, 267
+not L9
+red L6
+bne L57
+not @r3
+L13: jmp @r1
+dec L10
+m1
+add L5, @r6
+bne L15
+sub L12, L2
+mov -409, X0
+L14: not @r2
+red L8
+cmp @r3, L9
+m3
+L15: jmp @r4
+jmp S8
+add @r0, L11
+mov L22, @r3
+sub @r5, @r2
+rts
+jmp L14
+cmp 245, @r2
+dec @r0
+sub L10, L13
+sub L15, @r5
+sub -474, @r5
+jsr L8
+sub 436, @r1
+mov 406, S5
+lea L1, L8
+not D0
+red L14
+jsr @r5
+dec @r3
+lea L5, L7
+L16: add @r7, @r3
+L17: bne @r6
+mov L3, L26
+add L38, @r0
+red @r1
+sub @r1, L5
+sub 25, @r4
+dec L1
+red L5
+sub @r6, @r0
+lea L2, L17
+cmp @r1, 301
+sub -294, @r5
+bne L4
+inc L13
+sub @r7, L13
+rts
+L18: red @r5
+prn -173
+add @r7, @r6
+sub @r4, L17
+rts
+dec L5
+jmp @r2
+bne @r2
+inc L31
+red @r2
+cmp L6, L3
+m3
+inc @r2
+bne @r1
+not @r4
+bne L5
+m0
+rts
+red @r0
+rts
+dec L55
+lea L5, @r5
+bne L8
+rts
+lea S6, @r0
+L19: sub L4, @r6
+m0
+cmp @r2, L12
+m2
+clr @r0
+jsr L12
+rts
+not L19
+jmp L9
+dec S0
+dec @r4
+dec @r3
+sub L1, @r6
+inc L19
+m3
+red @r3
+dec @r5
+jmp @r5
+m3
+add @r4, L6
+dec @r7
+sub 325, @r7
+red @r7
+cmp -158, @r1
+mov 391, L1
+not L6
+dec @r1
+sub -457, D0
+L20: mov L37, L4
+L21: lea L6, @r3
+mov -177, L15
+rts
+bne L10
+m0
+lea L27, @r0
+m3
+bne @r1
+L22: cmp @r1, 254
+not @r2
+red L1
+not @r0
+m0
+rts
+sub @r4, L9
+sub L17, @r3
+inc @r0
+dec @r0
+sub @r7, @r4
+L23: cmp @r4, 383
+L24: rts
+red L3
+prn -226
+sub 275, @r5
+bne @r1
+not @r4
+clr X1
+inc @r7
+bne @r7
+sub L22, L17
+dec @r5
+m2
+not L1
+cmp L2, -265
+dec @r3
+m2
+jmp @r4
+m3
+clr @r2
+jmp @r5
+prn -283
+L25: prn 15
+m2
+sub 29, @r4
+red @r0
+lea L15, @r7
+add @r4, @r4
+not L0
+lea L18, @r1
+m2
+jsr L10
+dec @r7
+add 496, @r1
+inc @r3
+red L15
+L26: prn @r0
+inc L18
+jmp @r4
+sub L7, @r0
+jmp L19
+not @r4
+not @r6
+jsr L26
+jmp @r5
+jsr L18
+bne L12
+clr @r3
+jmp @r7
+rts
+bne @r4
+mov @r7, @r5
+jsr L9
+jsr @r0
+not L15
+jsr L9
+red @r5
+prn -323
+rts
+mov @r3, L8
+not D0
+L27: jsr @r5
+jmp L11
+clr L23
+L28: red L17
+sub -359, L4
+mov L24, L19
+m3
+not @r2
+prn @r5
+jmp @r0
+bne @r5
+sub 474, L18
+lea L19, @r4
+sub @r5, @r7
+prn L8
+L29: jsr @r2
+bne @r2
+L30: jmp D0
+m4
+clr @r0
+sub 406, S8
+m3
+L31: bne @r1
+clr L25
+dec L30
+add @r6, @r1
+L32: add @r3, @r5
+jsr @r2
+m3
+m2
+m3
+jmp L8
+clr @r3
+inc L8
+clr L5
+not L18
+dec L29
+m3
+prn 451
+add 149, L3
+lea L12, @r3
+inc @r3
+L33: sub L29, L11
+m3
+L34: add L15, L23
+prn L3
+lea L14, @r0
+L35: lea S2, @r5
+lea L24, @r1
+m4
+inc @r2
+L36: mov -420, @r7
+clr L9
+L37: inc @r3
+jsr @r3
+add @r4, L6
+bne @r6
+L38: cmp 273, L52
+bne @r7
+bne @r6
+sub L1, @r6
+jmp @r4
+jmp @r2
+m0
+rts
+rts
+prn @r5
+jsr @r6
+m2
+inc @r4
+lea L17, @r1
+inc @r4
+lea L38, L33
+lea L23, L34
+m1
+add L5, @r2
+bne @r0
+clr @r3
+jmp L10
+lea L7, L31
+lea L25, @r2
+L39: cmp 462, -479
+red @r0
+m3
+jsr L7
+red L31
+m2
+cmp 36, 108
+m1
+red L15
+sub L11, @r4
+sub D0, @r3
+L40: bne @r4
+jsr @r3
+sub X2, L21
+add L4, @r1
+mov -351, @r4
+mov -116, L27
+lea L3, @r4
+mov 66, @r5
+cmp @r5, -325
+jsr @r4
+lea L16, @r1
+L41: sub @r0, @r7
+rts
+mov 92, L37
+jsr @r5
+L42: jsr @r3
+prn L12
+inc @r2
+red L42
+jsr L21
+sub 479, L3
+L43: not @r0
+L44: prn 222
+inc @r6
+L45: add @r3, @r5
+lea L33, L11
+rts
+bne @r6
+add 104, @r1
+lea L36, L13
+L46: bne L38
+rts
+mov @r7, L43
+bne L23
+lea L28, L29
+L47: sub L31, @r3
+clr L49
+lea L51, X3
+jmp @r6
+jmp @r0
+prn 164
+rts
+not @r4
+red @r0
+red L54
+m2
+bne @r6
+rts
+cmp -325, 278
+lea L8, L29
+lea L30, L35
+cmp L27, @r0
+add @r1, @r3
+jsr @r5
+m1
+L48: sub @r7, L55
+cmp 273, @r2
+jsr L35
+L49: jmp D0
+inc S3
+jsr @r7
+jsr @r0
+sub -241, @r5
+lea L58, @r5
+cmp @r4, L16
+m1
+L50: prn 119
+jmp @r2
+red L5
+L51: rts
+clr @r2
+m3
+not L48
+rts
+L52: not D0
+clr @r3
+L53: rts
+not S9
+clr L55
+L54: sub -261, L28
+inc L31
+not X4
+L55: sub L56, S6
+bne L56
+red @r5
+not @r6
+L56: jmp @r5
+L57: add 84, L24
+L58: add @r0, @r0
+lea L13, L22
+L59: inc @r7
+red @r2
+prn S0
+m4
+stop
+D0: .data 149,391,230,204,-218,252,-70,-50,-125,-387
+D1: .data 59,-182,-268,116,-51,-203,8,-22,437,418
+D2: .data 377,-352,-72,184,338,180,491,238,425,-450
+D3: .data 408,398,-221,-377,-244,-295,-345,-312,-226,439
+D4: .data 356,-78,261,-120,-126,363,292,161,364,-159
+D5: .data -381,471,482,-500,-104,276,-92,413,-67,-23
+D6: .data -284,-5,-15,-426,84,-159,122,-421,423,189
+D7: .data 24,-456,-343,-306,-310,-168,199,363,7,347
+D8: .data -470,219,350,107,-489,432,297,-16,181,23
+D9: .data 394,362,-22,-272,363,153,265,-119,342,-123
+S0: .string "rqbefjcxgrvismb"
+S1: .string "ficdlfjciiej"
+S2: .string "caggapuvck"
+S3: .string "agtqid"
+S4: .string "rld"
+S5: .string "cwwarypa"
+S6: .string "wusvsba"
+S7: .string "qhsskpyvrpnboiefkoet"
+S8: .string "leh"
+S9: .string "jqlwmdfiptgiz"
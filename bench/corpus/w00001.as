@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r5
+    prn 94
+endmcro
+mcro m1
+    sub @r0, @r5
+    prn 24
+endmcro
+mcro m2
+    sub @r4, @r4
+    prn 1
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 15
+endmcro
+mcro m4
+    sub @r4, @r7
+    prn 57
+endmcro
+lea L0, @r2
+L0: add L0, L0
+sub @r1, @r6
+m1
+cmp L0, L0
+jmp @r1
+not @r7
+add @r3, L0
+mov 131, @r7
+lea L0, L0
+L1: sub L1, @r4
+add @r7, @r2
+prn 194
+m2
+m4
+dec @r1
+sub L0, @r7
+jmp @r2
+L2: add @r7, @r5
+mov L1, L2
+not L1
+not L1
+m0
+clr @r6
+bne L16
+clr @r6
+jmp @r2
+mov -363, @r5
+lea L1, L2
+dec L2
+L3: jmp @r4
+cmp 33, L2
+inc L0
+add 382, @r2
+jmp @r1
+L4: mov @r5, L3
+mov -274, L16
+not @r2
+L5: bne @r0
+cmp @r4, -492
+inc @r4
+cmp @r6, -83
+cmp 417, -126
+cmp @r7, L5
+L6: clr @r2
+L7: sub S3, L3
+L8: rts
+cmp 184, L7
+m3
+m2
+L9: red L0
+inc @r0
+add L7, L7
+jsr @r4
+sub -198, L1
+not L6
+add L39, L8
+bne L0
+inc @r3
+add @r7, L0
+rts
+add 26, @r3
+prn 277
+rts
+cmp @r6, -446
+L10: sub 261, L4
+jsr @r6
+add L0, @r6
+lea L9, L4
+not L10
+lea L5, @r2
+cmp @r4, L0
+prn @r4
+lea X0, L1
+clr L9
+cmp -450, @r1
+jmp L10
+prn @r1
+m1
+bne @r3
+add -272, @r5
+clr @r6
+bne @r4
+bne @r0
+prn L18
+inc L7
+lea L2, @r3
+clr S8
+dec L5
+bne @r2
+add @r3, L6
+mov 94, @r2
+not @r1
+mov @r3, L10
+not @r4
+not @r0
+inc L7
+m3
+not @r5
+red @r3
+rts
+red @r6
+L11: bne @r6
+bne L8
+rts
+cmp -89, @r4
+add 94, L11
+cmp @r1, -378
+add L6, @r2
+jsr @r2
+bne @r6
+cmp 24, L10
+cmp L10, @r4
+red @r5
+sub L6, @r3
+L12: lea L9, @r7
+add @r1, L0
+bne L2
+red @r1
+m3
+red @r0
+red @r4
+jmp @r2
+rts
+clr @r0
+L13: red @r3
+prn L9
+sub @r0, @r1
+red L1
+cmp L4, @r1
+inc L4
+not @r6
+mov L5, D0
+L14: dec L14
+L15: sub L0, L12
+mov L14, @r2
+m4
+not @r0
+L16: bne @r1
+add L5, L15
+not L5
+jmp @r3
+m2
+L17: cmp -132, @r5
+clr L7
+prn L0
+bne L13
+clr L6
+L18: lea L13, L17
+dec L17
+clr @r1
+sub 48, @r3
+lea L10, L32
+inc L14
+not L7
+not L12
+jmp @r5
+red S5
+sub @r6, @r3
+dec L16
+rts
+dec @r2
+sub -174, @r6
+L19: jsr @r3
+inc L13
+mov @r6, D0
+L20: jsr @r4
+m3
+m1
+cmp -356, @r2
+rts
+jmp @r0
+clr L6
+bne @r1
+L21: jmp L3
+dec D0
+inc L14
+rts
+L22: jsr @r1
+clr L51
+not @r7
+cmp 308, D0
+jsr L1
+m1
+clr L42
+inc L18
+lea L14, L1
+not @r3
+not L3
+mov L6, @r4
+add @r1, L5
+L23: clr L9
+jsr L1
+cmp @r5, L15
+mov @r7, L5
+jsr @r7
+L24: bne L12
+cmp 147, L4
+clr L13
+sub 444, @r6
+prn @r5
+prn @r5
+rts
+mov @r4, L7
+jsr L9
+dec L5
+clr @r7
+cmp L6, @r5
+dec @r1
+L25: rts
+cmp L17, L21
+L26: not @r4
+rts
+bne @r4
+not @r2
+L27: red L13
+L28: red L20
+rts
+sub L9, L11
+mov L0, L8
+not @r4
+not @r4
+sub -252, L16
+mov 175, @r6
+L29: jsr @r0
+dec @r5
+not L25
+cmp @r5, L10
+dec L18
+m4
+L30: jsr L19
+bne @r3
+cmp -127, @r1
+m1
+jsr L25
+rts
+mov @r1, @r7
+bne L0
+prn -220
+mov L24, L8
+add @r4, L0
+L31: lea X1, L9
+clr L18
+L32: red L20
+m0
+m0
+m1
+clr @r0
+L33: prn L13
+m4
+add -160, L12
+rts
+bne L6
+L34: add L4, @r6
+jmp @r4
+cmp @r1, @r6
+lea L14, L32
+not L22
+red L9
+clr @r1
+L35: lea L33, L6
+red @r0
+m4
+m0
+m2
+jsr L26
+lea L6, L41
+inc L25
+add @r2, L2
+jsr @r3
+m4
+red L51
+red L1
+rts
+bne L9
+inc @r4
+lea L32, L31
+prn @r7
+jmp L31
+prn @r7
+jmp L30
+L36: rts
+add L2, @r1
+L37: mov -119, L7
+m3
+inc @r6
+clr @r6
+lea L3, @r1
+add @r4, L10
+jsr L9
+sub 9, @r7
+sub @r6, L37
+dec L14
+bne @r1
+cmp @r0, @r4
+L38: cmp @r7, L8
+inc L37
+inc @r3
+clr L20
+prn D0
+m0
+m3
+sub @r6, @r3
+jsr L33
+prn @r5
+jsr @r0
+mov 113, @r3
+sub 280, L16
+not L17
+m4
+mov L37, @r3
+jmp @r2
+mov @r2, L36
+lea L30, L54
+jmp @r3
+L39: lea L34, L11
+bne @r7
+lea D0, L2
+add @r1, L24
+rts
+prn @r5
+prn L35
+prn L8
+lea L21, @r1
+clr S8
+lea L59, L15
+cmp -138, L26
+clr @r4
+sub @r6, L27
+m2
+not @r6
+L40: not @r4
+lea L6, L25
+clr @r1
+add L21, L38
+m0
+clr @r7
+add 149, L0
+L41: jmp L37
+prn D0
+add @r6, L19
+sub L33, @r3
+rts
+jsr @r7
+L42: clr L16
+cmp @r7, @r4
+lea D0, L30
+dec @r7
+jmp @r0
+m2
+m4
+m4
+clr L41
+m3
+mov -310, L9
+sub X2, @r0
+clr @r7
+jsr L20
+m2
+not @r2
+lea L55, L26
+mov L16, @r3
+cmp 69, -124
+clr @r0
+L43: rts
+L44: clr L8
+lea L22, L26
+L45: clr @r3
+rts
+sub L34, L23
+jmp @r0
+L46: rts
+prn 173
+jmp L12
+lea L31, @r0
+bne L23
+jmp L26
+cmp L4, L16
+rts
+L47: mov @r7, L28
+mov -234, L34
+L48: red L15
+L49: inc L33
+not @r4
+not @r3
+rts
+L50: not L1
+add 115, L4
+prn 194
+L51: prn 254
+bne @r0
+bne @r7
+L52: clr @r5
+lea L51, L34
+dec L49
+m0
+jsr D0
+rts
+bne @r7
+lea D0, @r5
+L53: jmp L27
+m1
+jsr L37
+rts
+sub L44, L57
+sub L51, S6
+L54: rts
+bne L56
+cmp 10, 380
+dec @r3
+bne @r7
+prn @r2
+L55: bne @r5
+cmp L57, X3
+jsr @r0
+L56: not @r0
+bne L11
+m2
+inc L27
+dec L59
+m0
+not @r6
+L57: dec L49
+red @r2
+prn @r0
+not S8
+inc L57
+rts
+L58: red @r1
+clr D0
+inc L45
+lea L59, @r3
+L59: jsr S4
+dec @r6
+lea S2, @r5
+add S0, @r6
+red X4
+rts
+add S5, S3
+m0
+stop
+D0: .data -193,-310,-134,258,117,218,-109,-275,-156,426
+D1: .data 290,70,139,-190,423,-321,124,45,141,230
+D2: .data -370,139,-353,-90,-288,156,-149,-45,13,-247
+D3: .data -343,-338,394,143,291,-357,-13,68,-74,-26
+D4: .data -208,175,-263,-242,230,-294,-72,-488,-447,-480
+D5: .data 145,-359,-32,339,404,451,83,-104,195,-311
+D6: .data -237,461,0,263,275,331,-209,-84,-487,-160
+D7: .data -329,330,8,12,255,11,172,-354,-127,-94
+D8: .data -188,347,-104,188,307,441,-275,-138,324,-496
+D9: .data 438,-417,-431,-403,279,-268,-232,298,200,73
+S0: .string "fuehddzcnjkudryy"
+S1: .string "osabjewgezmh"
+S2: .string "gkfumtrveqwzrjvhpoe"
+S3: .string "fqimzqzgojxhidjrafl"
+S4: .string "nyohs"
+S5: .string "ftg"
+S6: .string "ylytfceodirssfropoqg"
+S7: .string "vgiq"
+S8: .string "tzmefoplyvzj"
+S9: .string "zsmgecivtlrd"
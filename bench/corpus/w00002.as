@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r7
+    prn 64
+endmcro
+mcro m1
+    sub @r5, @r6
+    prn 22
+endmcro
+mcro m2
+    sub @r6, @r2
+    prn 67
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 91
+endmcro
+mcro m4
+    sub @r6, @r6
+    prn 81
+endmcro
+jmp @r5
+mov @r5, L0
+mov -53, L0
+jsr @r2
+L0: lea L0, @r0
+rts
+prn 334
+jmp L0
+jsr @r2
+m3
+sub @r6, L0
+inc L0
+add L0, L0
+mov L0, L0
+sub @r1, @r3
+L1: not @r7
+mov L0, L0
+clr @r5
+L2: rts
+L3: sub @r3, @r4
+clr @r0
+L4: clr @r0
+dec L2
+jsr @r2
+L5: cmp @r1, -140
+dec L2
+rts
+red @r2
+m4
+L6: add -97, L0
+dec L2
+L7: prn @r3
+rts
+mov -102, @r4
+jmp L6
+red @r0
+red @r0
+L8: prn L1
+clr @r2
+mov 479, L6
+L9: dec L4
+jmp D0
+jsr @r0
+dec @r4
+prn @r6
+prn @r4
+mov @r3, @r5
+sub @r4, @r4
+red @r5
+cmp @r5, L5
+add L6, L6
+jmp L6
+lea L5, @r3
+mov @r2, @r1
+m3
+prn L2
+m2
+clr @r0
+lea L8, @r1
+dec L5
+dec @r2
+cmp 249, @r4
+rts
+m1
+mov -344, D0
+dec L5
+sub @r7, L6
+bne S7
+red @r3
+m2
+prn @r5
+sub -425, @r6
+lea S9, L9
+red L6
+bne @r2
+mov 176, L4
+clr L8
+prn 332
+cmp L7, @r3
+m0
+prn L9
+L10: lea L6, @r6
+add @r0, L0
+red L2
+not @r4
+red @r3
+m0
+bne L9
+L11: bne L10
+clr L24
+prn S1
+add L0, @r6
+rts
+L12: red @r0
+jsr L3
+inc L6
+L13: lea L1, X0
+L14: jsr @r7
+jsr L0
+lea L3, L13
+add 475, @r4
+bne @r5
+jmp L8
+m1
+m2
+rts
+rts
+sub L1, L13
+not @r1
+clr L8
+lea L12, @r2
+jsr L5
+dec L1
+L15: add 197, L10
+lea L5, @r7
+m2
+L16: not @r5
+dec @r2
+m2
+L17: cmp L10, L57
+not @r6
+mov L11, L6
+rts
+mov L3, @r0
+clr L51
+lea L12, @r7
+dec @r1
+inc @r7
+prn @r2
+mov 68, L9
+red L3
+rts
+clr L34
+m3
+red @r3
+clr L26
+inc @r4
+dec @r5
+L18: sub L6, @r7
+rts
+lea L7, L0
+lea L2, X1
+jmp L10
+jsr @r7
+bne @r2
+dec @r6
+cmp L4, 461
+sub L15, @r2
+bne @r0
+clr @r3
+sub L1, @r2
+jmp L7
+L19: sub L3, @r7
+m3
+m3
+red @r2
+cmp @r3, L57
+add L4, L9
+rts
+m3
+lea L5, @r3
+m3
+inc @r6
+inc @r3
+red @r0
+jsr L4
+prn 218
+inc L2
+red L16
+jsr L11
+rts
+jsr L16
+not D0
+clr @r6
+clr L8
+add D0, L2
+mov 228, @r4
+prn 94
+red @r6
+lea L1, L13
+jmp L13
+dec @r3
+m1
+prn @r5
+bne @r7
+L20: red L9
+cmp L9, -53
+dec @r3
+m0
+bne L1
+not @r6
+L21: rts
+red S8
+inc L8
+inc L16
+L22: inc @r2
+rts
+m0
+L23: jsr L16
+L24: mov -393, @r0
+clr @r5
+inc L23
+sub 348, @r5
+inc @r6
+mov @r5, L3
+L25: sub L10, @r6
+lea L17, L1
+L26: jmp @r4
+cmp L40, @r0
+bne L0
+clr @r5
+not L6
+not L4
+dec @r3
+bne @r4
+add @r4, @r3
+sub -71, L12
+add 227, L16
+L27: jsr @r3
+mov L3, L19
+not L17
+sub L5, L22
+inc L16
+lea L4, @r7
+clr L16
+inc L22
+cmp @r7, -113
+cmp -279, 302
+red L27
+red L12
+jsr @r1
+dec D0
+mov L16, L12
+rts
+dec L16
+m2
+m4
+not @r2
+rts
+bne @r7
+cmp L22, L30
+add L25, L8
+clr @r5
+m4
+m0
+not D0
+not @r1
+L28: bne @r1
+m3
+not L28
+clr L5
+jsr @r6
+m0
+rts
+red L20
+L29: jmp @r6
+prn L19
+jsr @r7
+rts
+add -323, S0
+add -268, L22
+lea L19, @r4
+cmp -219, @r6
+sub -131, @r2
+add L24, @r6
+jsr @r7
+not @r5
+mov @r0, L15
+m2
+sub -7, L2
+dec L16
+cmp 470, S1
+red @r5
+bne @r7
+sub @r4, L29
+L30: rts
+prn L13
+red L18
+L31: cmp L27, -19
+jsr L15
+not @r7
+jmp L28
+red @r7
+clr @r7
+cmp @r7, @r0
+clr L6
+red L6
+m0
+add L30, L29
+add 451, L30
+not @r0
+m1
+bne @r7
+rts
+dec @r0
+m0
+dec @r3
+L32: red @r2
+L33: lea L7, L10
+sub L8, @r7
+clr L14
+m2
+jsr L24
+jsr L25
+bne @r7
+cmp -395, L16
+lea L12, L29
+L34: mov 43, L22
+mov @r5, L42
+L35: red L33
+L36: prn L7
+prn 441
+prn 284
+L37: cmp @r5, L1
+not L5
+inc @r5
+dec @r3
+lea L15, L43
+jsr L27
+clr @r1
+L38: inc L16
+jmp L31
+L39: add -470, X2
+add L28, L3
+clr @r5
+lea L28, @r7
+not @r0
+mov -134, @r3
+lea S8, @r4
+sub @r2, L18
+L40: sub 158, L9
+jmp @r5
+jsr @r1
+add @r3, L29
+clr L36
+prn L33
+not @r5
+L41: dec L22
+dec @r7
+mov @r0, @r5
+red L33
+not @r1
+m0
+m0
+clr @r4
+m1
+jmp @r6
+dec @r5
+L42: not L9
+rts
+m3
+jmp @r6
+prn @r0
+not L45
+jsr @r1
+not L49
+prn @r7
+jmp L35
+L43: cmp @r7, @r1
+prn 158
+not S4
+L44: bne L1
+cmp @r0, -134
+rts
+bne @r4
+bne L30
+add @r4, L36
+L45: sub @r5, L26
+m2
+inc @r1
+not @r4
+jmp L50
+rts
+lea L40, L38
+inc @r4
+jsr @r3
+red L59
+jmp S9
+L46: inc @r0
+inc @r5
+sub L23, D0
+cmp @r7, @r0
+rts
+L47: prn @r5
+inc @r7
+clr L17
+red @r7
+add @r3, L30
+L48: add @r1, L14
+L49: prn L6
+mov -186, @r5
+mov L2, @r6
+jmp @r7
+red @r7
+L50: inc @r3
+m3
+cmp @r3, L25
+m3
+mov 434, @r2
+L51: lea L38, @r7
+red @r0
+L52: lea L46, L52
+jmp L33
+L53: jmp @r7
+L54: mov L6, L30
+cmp @r5, @r3
+L55: bne L1
+L56: lea L13, D0
+jsr @r5
+L57: sub @r2, D0
+dec @r4
+L58: not @r6
+dec X3
+jsr @r0
+clr L47
+add @r6, @r1
+red L25
+rts
+not @r6
+bne L29
+lea D0, @r1
+jsr S0
+not L27
+jmp @r2
+dec @r7
+mov 460, L30
+cmp L23, -402
+L59: add S7, @r4
+bne S6
+m3
+bne L38
+prn L37
+cmp 436, L33
+inc S7
+rts
+cmp @r3, @r2
+clr X4
+add S5, S2
+m3
+clr S2
+stop
+D0: .data 214,191,-154,334,-153,434,22,73,288,28
+D1: .data -484,372,455,-321,399,-236,-156,-413,-48,-62
+D2: .data -447,-463,-363,-192,312,114,249,-341,-244,351
+D3: .data 475,382,-121,233,177,338,157,110,-116,20
+D4: .data -237,97,-381,395,423,-305,-342,314,203,28
+D5: .data 500,-438,301,217,319,195,12,160,-116,84
+D6: .data -65,-72,-224,192,188,-426,-7,16,-16,-271
+D7: .data 268,-152,-47,82,59,187,163,-243,-171,-472
+D8: .data -25,439,-315,380,38,-300,-423,338,489,-116
+D9: .data -10,36,319,87,3,1,275,-90,310,-209
+S0: .string "kctvppznrxddxwkmopea"
+S1: .string "rysamglwzne"
+S2: .string "uq"
+S3: .string "frvpgjpfvwnpdh"
+S4: .string "bdmsdufuoi"
+S5: .string "bovjqxneds"
+S6: .string "vaqnywecpdo"
+S7: .string "szocxzignldeu"
+S8: .string "fbdxwnsum"
+S9: .string "mjfjfqbgarvkpssmlh"
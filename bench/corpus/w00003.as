@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r2
+    prn 3
+endmcro
+mcro m1
+    sub @r1, @r0
+    prn 21
+endmcro
+mcro m2
+    sub @r0, @r0
+    prn 32
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 35
+endmcro
+mcro m4
+    sub @r0, @r4
+    prn 38
+endmcro
+mov -373, @r7
+red @r3
+prn -455
+m0
+dec @r5
+jmp L0
+L0: jsr L0
+L1: prn 212
+jsr L1
+m2
+m0
+lea L0, @r5
+L2: clr S7
+m4
+dec L0
+jmp @r0
+not L2
+dec @r6
+m2
+mov 378, @r7
+bne L0
+add L0, L15
+red L58
+rts
+rts
+rts
+bne @r2
+dec L0
+clr D0
+bne L2
+cmp L1, L1
+jsr L2
+cmp 505, L0
+lea L1, @r6
+clr S1
+jsr @r2
+sub L0, L0
+rts
+jsr L1
+cmp L1, @r7
+lea L2, @r4
+clr @r5
+red D0
+inc L0
+add @r7, @r2
+L3: prn -69
+bne @r3
+add -47, L1
+L4: clr L2
+not S6
+cmp @r4, L45
+prn @r0
+rts
+add @r5, L4
+prn @r3
+m0
+inc @r7
+m2
+prn L3
+clr L2
+sub @r4, L3
+rts
+jmp L2
+not L2
+L5: not L3
+bne L0
+clr L3
+not @r5
+bne L1
+jsr L5
+L6: sub -507, L4
+jmp L11
+m1
+m3
+L7: cmp L2, 411
+L8: cmp 490, @r2
+add @r7, @r4
+jmp @r2
+m3
+inc @r7
+not @r2
+clr L4
+cmp @r7, D0
+jmp L0
+bne L4
+red L1
+lea L8, @r3
+not @r7
+L9: red @r2
+m4
+red @r1
+red @r1
+lea L0, @r5
+red L8
+rts
+jmp L2
+red @r7
+prn L7
+prn @r0
+m2
+m1
+red @r7
+red @r3
+L10: cmp @r4, D0
+jmp L8
+add @r0, @r3
+sub L0, L3
+add 493, L10
+bne L10
+cmp L6, -290
+L11: dec @r7
+L12: jsr @r4
+jsr L2
+m3
+add L4, L11
+mov L0, @r2
+mov @r5, L0
+dec L12
+red @r2
+not @r6
+clr L5
+bne L8
+prn L11
+prn -31
+m2
+L13: lea L10, @r3
+L14: lea L9, @r6
+sub L2, @r2
+L15: add @r3, @r5
+L16: red D0
+m4
+inc L1
+lea L15, @r6
+bne @r3
+dec @r2
+add @r2, @r0
+bne L7
+clr @r1
+bne @r6
+m3
+L17: rts
+L18: mov S1, L7
+lea L13, @r6
+jmp L7
+inc @r5
+add 109, @r1
+add L6, L13
+rts
+mov @r3, L1
+clr @r5
+L19: add L2, L16
+m0
+cmp @r2, L14
+clr @r5
+add -508, @r5
+L20: red @r7
+rts
+inc L7
+m2
+dec @r1
+jsr @r4
+prn L1
+inc L17
+clr L55
+clr L1
+mov L8, @r1
+cmp L19, -37
+clr L11
+rts
+red L0
+m1
+dec L14
+jmp @r0
+rts
+dec @r7
+L21: jmp L12
+clr L14
+mov 288, L13
+sub L3, L1
+jsr @r0
+jmp @r2
+add 162, @r5
+dec @r4
+L22: red @r3
+cmp @r3, @r2
+not @r7
+sub -34, @r3
+clr @r7
+cmp @r0, 448
+rts
+jsr @r4
+sub 61, @r7
+L23: cmp @r5, L21
+add -74, @r3
+clr @r3
+L24: rts
+cmp L17, L5
+clr @r5
+jmp L9
+inc @r3
+prn L14
+rts
+rts
+jmp @r7
+L25: inc L11
+jmp @r5
+not L24
+add @r0, S2
+dec @r1
+m0
+lea L25, @r3
+dec @r0
+dec @r2
+bne @r0
+not L5
+not @r1
+lea L49, @r2
+not L20
+bne @r0
+dec L23
+cmp @r0, -69
+sub L18, @r7
+prn @r5
+clr L6
+red @r6
+jsr L20
+m1
+bne L11
+clr L27
+rts
+add @r7, L7
+mov @r7, @r4
+lea X0, L3
+jsr @r2
+dec @r7
+jmp @r7
+inc @r1
+dec @r6
+mov 147, L1
+prn L25
+bne @r0
+clr @r3
+jsr @r1
+lea L8, @r6
+rts
+dec L37
+m4
+inc L1
+jmp L19
+m0
+clr L1
+jsr L24
+dec L16
+dec @r7
+L26: inc @r4
+sub L18, @r1
+jsr L21
+prn L28
+sub 15, @r4
+dec @r0
+inc S1
+red @r6
+inc S9
+mov @r3, @r1
+rts
+sub D0, @r1
+red @r2
+cmp @r1, 6
+L27: lea L23, @r7
+prn -285
+L28: lea L16, @r1
+mov -155, L22
+red @r7
+rts
+mov L6, L25
+prn -63
+add L25, @r3
+rts
+add -105, D0
+mov L14, @r0
+lea L11, @r6
+add L1, @r4
+L29: rts
+cmp L3, -36
+rts
+L30: mov @r4, L6
+m4
+jmp L21
+red L25
+mov L14, L24
+lea L10, @r5
+not @r0
+cmp L22, L9
+m0
+m1
+inc @r7
+add L17, L15
+sub 48, L8
+L31: dec S8
+bne @r1
+inc @r0
+dec @r5
+m2
+m1
+cmp L26, L31
+L32: red @r7
+L33: rts
+rts
+add 2, @r6
+m0
+clr @r1
+L34: jsr @r6
+L35: prn L1
+red L15
+sub @r2, L2
+clr @r5
+not @r7
+not @r6
+L36: clr L9
+m0
+jsr L11
+L37: cmp @r2, -435
+inc L27
+sub 57, L34
+prn @r1
+red @r4
+m0
+rts
+mov L2, L29
+sub L16, L15
+L38: sub L19, L21
+L39: jsr L17
+mov 4, L22
+sub L7, L2
+m3
+rts
+dec @r7
+jsr L28
+bne L19
+bne @r1
+m4
+not @r2
+L40: not L32
+L41: jsr L38
+jmp @r4
+not @r1
+dec L40
+dec L14
+inc @r6
+L42: clr L28
+sub 271, L34
+cmp -23, -66
+L43: jsr L24
+clr L18
+inc L0
+L44: bne L51
+prn D0
+jsr @r7
+prn @r6
+rts
+prn @r0
+L45: clr @r7
+inc L44
+mov 69, @r3
+rts
+jmp L59
+L46: inc L4
+L47: jsr L10
+sub 152, L35
+prn @r6
+lea L13, @r0
+sub -23, L30
+red @r0
+mov @r7, L24
+bne @r3
+bne @r4
+red L28
+red @r2
+L48: dec L41
+L49: jmp L40
+L50: clr @r0
+red L8
+red L23
+m2
+m4
+add L16, @r7
+prn -361
+dec L25
+bne L48
+not @r5
+add @r1, @r5
+red L27
+cmp L7, -456
+L51: mov L53, L10
+L52: rts
+rts
+bne @r3
+m4
+jmp L21
+sub -294, @r4
+sub @r6, S0
+bne @r2
+sub -275, @r0
+add @r2, L18
+clr L54
+L53: rts
+sub L45, @r1
+jmp X1
+m3
+L54: clr L55
+red @r5
+prn 148
+m4
+mov L6, @r0
+jmp L24
+lea L47, @r7
+rts
+m2
+prn 485
+L55: mov 146, L18
+L56: jsr @r3
+jmp L59
+red @r6
+jmp @r4
+bne X2
+not @r7
+not S5
+not @r2
+L57: not L6
+clr @r0
+not S3
+L58: rts
+red L59
+inc L27
+bne X3
+L59: clr S8
+inc S9
+dec D0
+inc X4
+bne D0
+stop
+D0: .data 259,-393,-47,494,-324,48,-400,-318,-454,-224
+D1: .data 74,200,-417,302,298,-154,-94,138,-386,-392
+D2: .data 203,73,159,-146,443,-317,87,-459,-405,260
+D3: .data -462,339,189,-434,83,-51,-302,-15,-33,-190
+D4: .data 291,-355,154,347,414,-75,447,140,-413,-360
+D5: .data 410,-28,408,-365,-255,-260,353,-363,419,-431
+D6: .data 271,486,-486,-191,-162,389,-255,98,-187,-464
+D7: .data 311,113,207,-371,-188,331,-369,89,351,262
+D8: .data -215,401,46,53,-49,-215,-124,-373,-137,450
+D9: .data 27,-135,427,-25,54,-156,292,-369,-284,-392
+S0: .string "watu"
+S1: .string "gyjutslnb"
+S2: .string "sxozdxpxcyasmahtlg"
+S3: .string "erfvbrrvmonmifsuyo"
+S4: .string "qwflasacoer"
+S5: .string "vguotjpewqp"
+S6: .string "fpvulurffprgfj"
+S7: .string "vnqyjtwcnimamafk"
+S8: .string "hmlqa"
+S9: .string "tht"
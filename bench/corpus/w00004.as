@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r4
+    prn 73
+endmcro
+mcro m1
+    sub @r5, @r1
+    prn 19
+endmcro
+mcro m2
+    sub @r2, @r6
+    prn 97
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 12
+endmcro
+mcro m4
+    sub @r2, @r2
+    prn 62
+endmcro
+jsr L0
+sub @r7, L0
+sub 152, @r7
+jsr @r3
+m2
+L0: lea L0, @r6
+clr L0
+jmp @r2
+clr @r0
+rts
+sub @r5, L0
+inc L0
+rts
+bne L0
+sub @r1, @r2
+bne @r7
+prn -285
+mov @r3, @r5
+jsr @r3
+add -385, @r3
+rts
+red L0
+rts
+sub -328, L0
+jmp @r2
+prn @r6
+mov L0, @r1
+clr L0
+cmp L0, 176
+red @r3
+red @r7
+dec @r1
+L1: inc @r4
+cmp -186, L0
+inc @r3
+cmp -344, @r4
+mov @r4, @r4
+m3
+L2: jsr @r3
+prn -446
+L3: inc L1
+L4: red @r6
+mov L2, @r7
+rts
+lea L3, L4
+mov L1, @r3
+dec D0
+not @r5
+L5: bne L5
+L6: jmp L0
+add 292, L3
+not @r0
+L7: jsr @r3
+add @r4, L7
+mov -440, L7
+clr L1
+bne @r7
+jsr S7
+lea L2, @r0
+red @r4
+rts
+red @r2
+red @r2
+L8: rts
+mov L0, L8
+not L51
+mov -233, @r0
+add -313, L4
+clr L7
+cmp -251, @r1
+clr L6
+bne L4
+jmp @r5
+clr L4
+m3
+bne @r1
+not @r7
+m4
+jmp S7
+add @r5, @r3
+L9: prn @r5
+jmp @r0
+jsr L7
+L10: prn 3
+bne @r1
+bne L3
+jmp @r6
+not L6
+m3
+dec L6
+jmp L9
+m1
+sub -253, S2
+m3
+clr @r4
+jsr L5
+dec L7
+mov -68, L8
+m1
+clr @r3
+m3
+m2
+m3
+L11: dec @r7
+sub @r4, @r2
+L12: red L0
+m4
+red L10
+not L11
+lea L1, @r0
+mov @r0, L10
+jsr @r6
+L13: sub L11, @r2
+lea L10, L12
+clr L2
+m0
+mov @r7, L7
+add @r4, L0
+jsr L4
+m2
+rts
+red @r7
+sub 287, @r2
+bne L10
+m3
+bne L1
+lea L4, L6
+jmp L8
+cmp L13, -135
+red @r1
+not @r6
+cmp -182, L3
+m4
+mov @r4, L11
+jmp @r3
+rts
+inc @r4
+cmp 62, L6
+clr L9
+m0
+bne @r2
+L14: prn @r3
+sub L2, @r7
+m1
+inc @r0
+lea D0, L5
+L15: jsr L13
+not @r4
+m3
+m3
+not X0
+prn @r1
+prn L11
+red @r0
+not L2
+L16: inc @r7
+mov @r6, L16
+L17: add L12, @r6
+L18: red L12
+not L12
+L19: dec @r2
+inc L7
+add @r4, @r2
+rts
+rts
+m4
+red @r0
+rts
+bne L2
+L20: dec @r6
+lea L11, @r5
+add L8, @r6
+sub L2, @r4
+m4
+m0
+clr L13
+add -68, @r2
+L21: inc L7
+dec @r1
+lea L8, L16
+inc L0
+not @r5
+bne L2
+sub @r7, @r0
+add @r6, L0
+add @r6, @r2
+mov @r4, @r2
+prn @r3
+L22: add -168, L9
+cmp 2, L9
+add L8, L18
+dec @r2
+prn L36
+jmp L1
+clr @r4
+add @r2, @r0
+bne @r1
+lea L11, S8
+red L14
+bne @r7
+red @r6
+red @r7
+clr L20
+L23: prn @r5
+L24: clr @r7
+prn @r7
+lea L23, L16
+jsr @r2
+jmp @r6
+jsr @r6
+red @r7
+dec @r2
+add L20, @r0
+rts
+jsr L22
+jsr @r0
+cmp 52, L12
+rts
+bne @r1
+lea L18, L5
+not @r1
+inc @r6
+dec L8
+jsr @r2
+lea L1, @r6
+mov @r1, @r5
+jsr L10
+L25: jmp @r0
+dec L18
+mov @r6, @r7
+m3
+sub -221, @r0
+dec L2
+dec L3
+lea L21, @r4
+clr @r0
+dec @r0
+not L21
+L26: red L21
+L27: clr @r4
+rts
+red @r6
+bne @r2
+sub -394, @r1
+jsr L45
+bne L16
+dec @r7
+m4
+jmp L17
+clr @r6
+dec @r3
+lea L11, @r6
+add L6, L13
+m0
+prn L15
+L28: not L1
+bne L18
+prn 397
+prn -329
+jmp L9
+add L6, @r7
+mov -269, L20
+jsr @r1
+jsr L16
+L29: jsr @r7
+dec L10
+clr L14
+jmp @r7
+L30: prn -485
+jmp L18
+add L19, L23
+dec L19
+jsr L24
+lea L25, D0
+dec L9
+jsr @r1
+mov L19, @r0
+L31: clr @r2
+not L18
+clr L3
+m1
+dec @r1
+clr L21
+cmp L26, L20
+jsr L10
+red @r4
+bne @r0
+rts
+dec L40
+jmp L22
+not @r2
+L32: bne L45
+not @r1
+rts
+lea L31, L23
+dec L23
+dec L24
+bne @r4
+not L51
+sub L27, @r7
+bne @r4
+clr @r4
+L33: lea L5, L20
+L34: red D0
+jsr @r3
+prn @r6
+not L22
+m1
+dec L27
+jsr L13
+clr @r5
+cmp -151, @r4
+jmp L22
+red @r4
+inc @r2
+sub @r7, @r0
+rts
+clr L36
+sub L51, L4
+L35: clr L21
+L36: lea L14, D0
+L37: bne L38
+cmp @r1, @r2
+mov -70, L4
+red @r1
+add 50, L33
+L38: prn 45
+mov @r0, L42
+cmp 467, L22
+add L22, X1
+prn 284
+m2
+jmp @r2
+not L29
+lea L16, L33
+m0
+L39: rts
+clr L58
+dec L42
+inc L46
+add @r6, @r7
+m2
+clr @r4
+prn S5
+jmp @r1
+not L24
+red @r5
+lea L17, @r5
+cmp L39, @r0
+L40: jsr L35
+lea D0, D0
+L41: prn L7
+jmp @r4
+L42: jsr D0
+inc L1
+L43: lea S1, @r6
+rts
+L44: red L11
+bne @r4
+rts
+cmp 466, @r0
+lea L36, L47
+clr @r7
+clr L23
+clr L11
+clr @r6
+cmp @r2, L17
+not L0
+dec L0
+add L39, @r6
+jmp @r0
+clr @r0
+m2
+L45: clr @r3
+L46: prn @r0
+m0
+lea L4, @r5
+bne @r3
+inc @r4
+lea L18, X2
+red @r5
+lea L18, L27
+L47: bne X3
+L48: red @r6
+L49: sub L56, L28
+red @r2
+L50: cmp @r3, -15
+clr @r2
+clr @r5
+cmp @r1, @r6
+m4
+L51: jmp L21
+add 430, L5
+inc L59
+jsr @r0
+lea L21, L47
+L52: jsr S5
+rts
+jmp L2
+not L4
+m0
+mov L19, @r7
+prn -129
+L53: jsr L12
+jmp @r4
+m3
+clr L59
+sub L39, L25
+prn L5
+m4
+m2
+not D0
+jsr S4
+not @r0
+not S1
+add L5, @r4
+inc L40
+inc @r3
+add 26, @r0
+jsr L18
+jsr @r1
+dec @r3
+L54: lea L2, @r6
+inc L19
+dec D0
+not L58
+not L35
+L55: red @r0
+sub -358, L36
+L56: prn L40
+L57: jsr @r7
+clr L7
+L58: cmp L43, @r0
+not @r1
+cmp 214, -289
+m3
+L59: clr X4
+m4
+mov D0, D0
+rts
+stop
+D0: .data -107,474,58,-385,410,-230,-233,433,323,-442
+D1: .data 75,199,233,-142,57,-218,343,117,-68,-347
+D2: .data -206,-152,-433,155,263,-170,-33,-137,11,5
+D3: .data -221,4,-225,-472,128,-80,337,-368,-254,71
+D4: .data 247,-156,173,37,-17,-482,-49,367,-66,-282
+D5: .data 88,356,-258,-383,-131,26,352,338,108,145
+D6: .data -447,-17,118,44,39,312,357,372,-187,478
+D7: .data 245,70,6,42,-259,-495,-174,-367,-191,102
+D8: .data 58,-223,-56,-300,456,121,407,160,-212,61
+D9: .data 334,-231,270,-362,-182,470,-16,279,-488,302
+S0: .string "kmfqoqywspkrflda"
+S1: .string "nofn"
+S2: .string "kpj"
+S3: .string "cgkti"
+S4: .string "dxrehzfggdmkrky"
+S5: .string "bi"
+S6: .string "rlishjffhlskltkc"
+S7: .string "fdcrvzamayv"
+S8: .string "ofcpaszpwnnglhrp"
+S9: .string "xnxesrroapfrnj"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r7
+    prn 11
+endmcro
+mcro m1
+    sub @r2, @r2
+    prn 86
+endmcro
+mcro m2
+    sub @r4, @r4
+    prn 63
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 88
+endmcro
+mcro m4
+    sub @r4, @r0
+    prn 87
+endmcro
+lea L0, L0
+sub X0, @r4
+bne L0
+not @r0
+not @r6
+L0: mov D0, @r5
+inc L45
+m0
+mov @r0, @r4
+L1: prn 157
+lea L1, L1
+lea L1, @r5
+lea L1, L1
+lea L0, @r0
+add @r1, @r7
+prn @r4
+m0
+mov @r4, L0
+prn D0
+sub -99, L1
+L2: clr L1
+L3: jsr L2
+L4: lea L1, L2
+rts
+m2
+m4
+sub -82, L3
+L5: inc @r7
+cmp D0, @r1
+prn L3
+m4
+jmp L0
+m4
+red @r2
+jmp L2
+m3
+sub 361, @r0
+prn L3
+jmp L1
+prn @r2
+L6: rts
+rts
+not L1
+prn @r1
+dec L0
+bne @r6
+rts
+clr @r4
+red L0
+jmp L5
+m3
+sub 410, @r3
+cmp @r7, 432
+jsr @r2
+cmp @r4, L2
+m2
+m0
+red @r0
+inc L2
+m4
+jmp @r3
+dec @r4
+rts
+rts
+jsr @r5
+cmp -42, @r0
+L7: red @r1
+jmp @r5
+add @r7, L7
+jsr @r4
+L8: dec @r3
+lea L4, @r6
+red L0
+dec @r1
+lea L3, @r1
+red @r7
+red L3
+L9: jmp @r2
+inc @r7
+jmp L3
+add 326, L1
+m0
+L10: prn L7
+L11: bne L7
+m4
+not @r1
+clr @r4
+rts
+dec @r0
+not L6
+L12: inc @r4
+dec @r5
+mov @r0, @r6
+m4
+L13: lea L11, @r7
+m0
+mov @r3, @r1
+L14: inc L5
+not L14
+sub -363, L13
+mov L4, @r5
+red @r6
+jmp @r3
+jsr L9
+L15: red L5
+add @r1, @r3
+rts
+clr @r5
+mov @r0, @r3
+m3
+clr L9
+m2
+L16: sub -389, L32
+dec @r1
+m3
+red L5
+add @r5, @r6
+m0
+add @r2, @r0
+dec L7
+L17: bne @r4
+m3
+cmp 260, @r7
+lea L15, @r0
+cmp L1, 211
+not L13
+add L24, L11
+bne @r0
+jmp L16
+dec L10
+m2
+red L4
+add 465, L7
+inc @r1
+m3
+bne @r2
+jsr L9
+bne @r3
+mov @r7, @r6
+inc @r5
+L18: not @r2
+jsr @r5
+m2
+bne @r5
+L19: rts
+clr @r3
+bne @r5
+prn L3
+mov L13, @r4
+rts
+inc L7
+dec L0
+inc @r2
+rts
+dec L9
+bne @r4
+L20: rts
+m0
+inc L10
+prn @r0
+m3
+clr L8
+mov L47, L19
+L21: bne @r3
+L22: jsr L6
+clr L13
+dec @r0
+mov 127, @r4
+mov -219, @r2
+add L12, L12
+mov 348, @r0
+L23: bne L19
+inc L36
+not L7
+mov @r7, @r5
+lea L20, @r7
+jmp @r5
+L24: mov -64, @r6
+L25: rts
+jsr L8
+bne L16
+rts
+lea L16, @r1
+L26: mov @r3, @r2
+inc L12
+mov L0, @r0
+jmp L26
+red @r2
+clr @r7
+lea L15, @r3
+clr L6
+not L11
+m2
+bne @r0
+rts
+L27: jmp L2
+prn @r1
+jmp @r4
+L28: jmp @r7
+L29: rts
+cmp L8, @r4
+cmp L24, L3
+sub L14, @r5
+L30: prn @r4
+rts
+clr L2
+rts
+jsr @r0
+red @r1
+jmp L3
+L31: red @r7
+clr L31
+prn S3
+L32: mov @r7, @r6
+clr L21
+mov @r3, @r5
+add S5, @r2
+lea L1, @r7
+not @r0
+jsr @r7
+m2
+jmp L31
+prn L17
+m2
+clr @r7
+prn 47
+mov @r6, @r7
+jsr L14
+red L26
+lea L4, L27
+add @r6, @r2
+rts
+not L14
+red L22
+jmp L11
+cmp @r0, @r7
+clr @r7
+L33: mov L20, L15
+mov L14, @r7
+prn -321
+lea L10, L22
+L34: add @r5, L26
+L35: bne L10
+add @r6, D0
+rts
+m0
+m1
+not L7
+inc L18
+lea L29, L25
+mov -264, @r4
+jsr @r2
+prn 7
+not @r4
+prn 362
+add L26, L36
+cmp L18, S2
+inc L18
+cmp 492, @r2
+m4
+inc @r4
+bne L24
+L36: cmp L24, L16
+add 317, D0
+m3
+sub 37, L36
+add @r3, @r5
+inc L33
+L37: mov -244, @r3
+L38: jsr @r1
+L39: bne L17
+bne @r0
+clr @r0
+L40: rts
+sub -454, L8
+rts
+m2
+cmp 511, @r2
+jsr L54
+inc L6
+rts
+sub @r4, @r3
+L41: lea L48, @r0
+rts
+jmp L15
+sub @r5, @r1
+red L34
+not @r2
+clr @r4
+bne L8
+jmp L20
+add @r0, @r3
+clr @r0
+dec D0
+jmp @r6
+m0
+inc L5
+cmp 343, L8
+rts
+dec S9
+not @r5
+inc @r6
+jmp @r3
+jmp L37
+L42: sub 393, L37
+red @r7
+jsr L52
+clr @r7
+cmp @r3, L20
+dec L33
+m3
+prn 321
+prn 452
+L43: dec L7
+inc L43
+prn -177
+add L2, @r0
+not @r0
+sub @r6, L8
+not L38
+L44: jmp L11
+mov 488, L14
+mov L11, @r6
+jmp L19
+red L41
+jmp @r1
+rts
+not @r7
+rts
+add L5, L50
+dec L39
+rts
+L45: cmp 310, @r2
+m3
+red @r3
+cmp @r0, -115
+jsr @r4
+not @r1
+sub L45, @r0
+lea L10, @r2
+prn D0
+prn L15
+L46: sub L28, L44
+inc @r7
+m3
+not @r1
+bne @r1
+not L10
+sub -359, S4
+add -402, @r4
+L47: jsr @r2
+add @r1, S3
+L48: add L48, X1
+sub L30, L20
+red @r0
+sub -216, X2
+add 443, @r7
+L49: mov @r2, @r5
+jmp @r1
+cmp @r6, L36
+inc @r2
+sub 229, L0
+red L57
+mov L24, @r5
+clr L11
+bne @r0
+red @r6
+m1
+L50: inc L43
+m1
+cmp -46, -181
+inc @r0
+sub 351, @r2
+cmp 104, 493
+L51: rts
+bne L48
+mov 83, @r4
+rts
+sub 280, @r1
+rts
+clr L57
+rts
+cmp L41, @r7
+sub L56, L38
+add L36, @r2
+dec L4
+inc L21
+inc @r2
+mov -390, @r3
+jsr L30
+rts
+L52: add @r1, L16
+mov -191, @r5
+prn L45
+jmp @r7
+clr L43
+sub 397, @r5
+mov @r5, L8
+add D0, L20
+L53: sub @r6, L47
+cmp -170, L55
+m1
+not L1
+sub 5, @r0
+cmp L18, S1
+cmp L2, L59
+L54: rts
+sub @r1, @r0
+L55: mov 506, @r5
+jsr L43
+lea L52, S7
+jsr @r4
+L56: dec @r3
+L57: add @r7, D0
+clr L59
+L58: lea L25, @r4
+clr L20
+mov @r0, @r1
+jsr X3
+clr @r3
+sub X4, @r5
+inc @r6
+add L14, L43
+rts
+sub L56, @r6
+add @r6, D0
+inc @r2
+not L59
+jsr D0
+bne @r7
+cmp @r3, 500
+dec @r3
+jmp @r4
+L59: cmp 108, 42
+lea D0, @r2
+not D0
+jmp @r7
+lea D0, L43
+red S1
+clr @r4
+stop
+D0: .data 318,378,330,-119,-263,-196,-486,-472,-169,-349
+D1: .data 293,235,-32,-136,200,-263,227,-145,377,155
+D2: .data -406,403,118,231,98,233,-428,-409,77,-337
+D3: .data -471,419,378,-131,-68,-403,54,304,-208,25
+D4: .data 362,-418,457,-121,-378,-24,68,-210,-310,-124
+D5: .data 434,-446,-128,-175,-415,400,194,121,-61,198
+D6: .data -23,-439,-243,-208,10,443,-71,-59,495,-489
+D7: .data -66,-94,128,-136,88,-253,-148,-168,-399,-458
+D8: .data -88,-255,206,-26,209,49,212,-139,-331,-403
+D9: .data 53,143,427,-441,409,185,-16,-50,-51,-9
+S0: .string "aqklhfgtjybwxbms"
+S1: .string "gfpyb"
+S2: .string "tloth"
+S3: .string "erisvrxzwe"
+S4: .string "ttyfblav"
+S5: .string "fobqktybshlr"
+S6: .string "gmixcuwjsqrsqglw"
+S7: .string "nlcfxxeeyj"
+S8: .string "iyldiwdzwoiye"
+S9: .string "tgjvmbwabhwzt"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r2
+    prn 82
+endmcro
+mcro m1
+    sub @r6, @r3
+    prn 84
+endmcro
+mcro m2
+    sub @r6, @r2
+    prn 60
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 64
+endmcro
+mcro m4
+    sub @r6, @r7
+    prn 11
+endmcro
+jmp D0
+add 272, @r7
+m2
+rts
+inc @r1
+cmp @r0, @r1
+L0: dec L0
+jsr L0
+red L0
+jsr @r2
+jsr @r7
+inc @r3
+m1
+m3
+m0
+L1: cmp L0, @r2
+clr L1
+rts
+m4
+clr @r1
+bne @r7
+red @r7
+clr @r5
+m0
+L2: lea S5, @r1
+lea L2, @r0
+dec L52
+not @r6
+jmp @r7
+clr L0
+m3
+L3: red @r3
+L4: inc L1
+dec @r7
+L5: mov L40, L0
+rts
+L6: lea S6, L0
+m3
+m3
+m4
+red L43
+mov L6, L3
+L7: inc @r3
+L8: add -129, @r7
+sub -500, @r4
+L9: sub @r3, L0
+rts
+bne L7
+lea L9, @r3
+cmp -165, @r4
+cmp 45, 354
+inc L6
+add L4, L9
+m1
+L10: mov X0, @r0
+prn L1
+L11: jmp L2
+not @r1
+m0
+jsr L6
+prn L0
+m3
+jmp @r7
+not @r3
+red @r6
+sub L8, L3
+inc D0
+cmp -211, 146
+m1
+cmp @r0, 154
+prn -214
+m1
+sub -365, @r7
+dec L1
+L12: clr @r2
+inc @r6
+dec L41
+bne L1
+dec @r6
+bne L11
+L13: inc L13
+L14: cmp @r7, L6
+cmp @r2, L2
+m0
+L15: sub @r6, L8
+clr L6
+lea L6, @r5
+not L10
+m2
+sub L8, @r0
+clr L9
+mov @r4, @r6
+L16: jmp S7
+bne L11
+rts
+rts
+clr @r2
+lea L11, L5
+add @r2, L2
+not @r6
+jsr @r0
+jmp L1
+inc @r7
+sub L1, @r4
+prn L7
+m3
+L17: sub -506, L13
+L18: jsr @r7
+L19: clr L13
+bne @r2
+bne L4
+rts
+bne @r5
+rts
+m1
+sub @r7, @r3
+prn L13
+prn L16
+jmp @r7
+clr L16
+add L42, L37
+cmp L13, 434
+mov L18, L10
+L20: cmp L6, L1
+m1
+cmp @r4, @r3
+dec L12
+bne @r5
+add -395, @r6
+rts
+rts
+rts
+clr @r1
+add 368, L14
+red @r6
+m2
+rts
+jsr L9
+prn L9
+jsr L19
+not L4
+prn @r1
+rts
+add L5, L3
+clr D0
+add @r5, @r3
+add -263, L20
+bne X1
+bne L5
+L21: bne @r5
+cmp 270, L6
+m1
+dec L55
+add @r6, @r0
+lea L18, @r1
+jsr @r6
+sub @r1, @r1
+bne L1
+mov -172, L5
+lea L12, L9
+sub @r2, @r0
+inc L1
+prn @r5
+lea L7, L18
+rts
+jsr @r3
+lea L16, @r1
+prn @r6
+bne L16
+bne D0
+not L12
+dec @r3
+L22: lea L21, @r1
+rts
+jmp S0
+prn L22
+cmp L2, L16
+L23: jmp L15
+lea L11, L16
+clr L58
+inc D0
+jsr @r4
+cmp 507, L9
+L24: dec @r1
+mov 143, @r2
+bne @r4
+jmp @r6
+bne @r1
+L25: red L0
+bne L5
+bne L8
+dec @r0
+dec @r6
+m3
+m2
+lea L7, L23
+jsr @r5
+jsr L39
+lea L20, L4
+m3
+inc L3
+jsr L15
+inc L20
+rts
+mov @r0, @r6
+L26: not @r4
+L27: prn 160
+bne @r2
+red L4
+red @r2
+clr @r2
+L28: jmp L12
+mov @r5, @r3
+mov 154, L51
+mov 360, @r7
+mov @r0, L24
+dec @r2
+add @r5, @r3
+bne @r7
+prn @r3
+L29: sub 251, L18
+dec @r3
+mov @r7, L0
+red L15
+prn L9
+clr L22
+lea L16, @r0
+L30: jmp L14
+m1
+red @r6
+jsr L25
+cmp L0, @r0
+add -156, L9
+jmp L14
+rts
+jsr L13
+clr L23
+red L32
+dec @r3
+sub L21, L9
+cmp -153, @r4
+mov @r0, L6
+rts
+L31: mov L4, @r6
+clr L3
+red L18
+clr L27
+rts
+not @r0
+prn -386
+dec L27
+L32: clr @r1
+L33: inc @r0
+inc @r4
+m1
+red @r3
+rts
+red L30
+prn @r2
+red @r7
+clr @r1
+red @r2
+lea L12, L19
+clr @r0
+clr L14
+not @r0
+L34: prn @r6
+lea L16, @r4
+prn L22
+red L19
+cmp 191, D0
+cmp -235, L27
+inc L4
+inc @r4
+L35: cmp L1, @r2
+bne @r3
+L36: red @r6
+prn -324
+rts
+sub @r2, L22
+red @r7
+L37: prn L25
+dec @r5
+prn L6
+L38: inc @r4
+add @r5, @r6
+L39: red L9
+red @r0
+clr L3
+L40: jmp @r2
+m0
+red @r2
+L41: lea L26, L39
+bne @r2
+add -47, @r7
+lea L27, S8
+jmp L8
+prn 234
+red @r6
+cmp 285, L38
+prn @r7
+prn @r7
+m4
+L42: prn @r7
+red L16
+dec @r2
+lea L12, @r0
+not L29
+L43: sub @r6, L9
+add @r7, L16
+prn D0
+m1
+bne @r5
+lea L28, @r3
+cmp 309, -66
+cmp -91, @r6
+bne @r7
+L44: clr @r6
+jsr @r2
+jsr L2
+prn -413
+jsr @r0
+m4
+red @r4
+dec @r1
+jsr D0
+jmp L29
+bne @r4
+lea L14, L18
+red @r4
+prn -80
+cmp @r6, @r5
+m0
+rts
+clr L26
+jsr @r5
+clr L20
+bne L21
+red @r7
+not @r0
+inc L26
+L45: clr L25
+inc @r3
+bne L5
+jmp @r4
+prn @r3
+L46: dec @r0
+red @r5
+m2
+inc @r7
+sub 153, @r6
+bne @r3
+clr @r1
+cmp @r4, @r5
+prn 2
+lea L58, S3
+clr @r7
+mov -337, S0
+add @r5, @r5
+cmp L27, -441
+bne S9
+rts
+L47: rts
+add L18, @r0
+m1
+rts
+lea L2, @r4
+jmp L3
+jmp @r2
+jmp D0
+jsr @r6
+cmp 241, L15
+sub 318, L48
+jsr @r6
+inc @r3
+dec L44
+m2
+add -332, L38
+L48: rts
+jsr L17
+not @r4
+dec @r4
+m3
+sub L7, L29
+bne L43
+jsr L39
+L49: cmp L48, L38
+lea L41, @r3
+sub @r6, @r7
+bne @r1
+sub -51, L15
+red @r3
+rts
+jsr @r0
+inc @r2
+L50: rts
+m1
+lea L37, @r4
+L51: cmp 191, L16
+prn L8
+mov @r3, L11
+bne L19
+dec L27
+L52: dec @r4
+not L2
+add -489, L47
+jsr @r6
+not L27
+m4
+mov @r1, X2
+bne @r0
+clr @r1
+rts
+inc @r4
+rts
+m4
+rts
+L53: sub @r4, @r0
+lea L15, @r4
+bne @r0
+not S4
+L54: bne D0
+cmp @r0, 2
+mov @r1, L23
+m0
+not S7
+L55: lea X3, @r2
+inc L30
+jmp L30
+add L10, D0
+L56: clr @r6
+jsr @r5
+bne @r3
+sub S9, @r7
+L57: jmp X4
+inc L59
+L58: red L59
+dec S5
+L59: red S3
+lea D0, @r6
+stop
+D0: .data 316,137,340,-170,34,129,-238,461,-56,173
+D1: .data -304,419,-169,156,310,416,-208,-159,474,-73
+D2: .data -458,226,-47,-237,335,-7,317,22,103,480
+D3: .data 495,140,-292,290,-451,397,-130,54,-357,-439
+D4: .data 333,25,482,-464,328,-445,390,-383,475,182
+D5: .data 339,132,-216,317,-385,-104,-172,341,275,-394
+D6: .data 92,216,283,407,161,22,231,-391,-38,76
+D7: .data -192,-181,-23,409,438,-377,-30,-498,-349,-29
+D8: .data -288,35,38,-255,-53,45,388,450,215,-204
+D9: .data 49,-365,-196,-97,439,121,-245,394,-52,-411
+S0: .string "nuvvq"
+S1: .string "zexitskekhtty"
+S2: .string "dcfqdwcuqlsoctbjiqlx"
+S3: .string "lstynaddzdcdvbxzewef"
+S4: .string "thsjlehvrkwvr"
+S5: .string "jnotgkplvhteaaazgqde"
+S6: .string "doupkpreigdrbxxxwvvm"
+S7: .string "qpouahetzfehdeyy"
+S8: .string "fbiji"
+S9: .string "lkpijqczgptxe"
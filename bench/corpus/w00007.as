@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r4
+    prn 20
+endmcro
+mcro m1
+    sub @r2, @r5
+    prn 83
+endmcro
+mcro m2
+    sub @r0, @r0
+    prn 25
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 41
+endmcro
+mcro m4
+    sub @r0, @r5
+    prn 35
+endmcro
+L0: mov -499, @r2
+L1: clr @r6
+rts
+inc L1
+lea L1, L1
+lea L0, L1
+L2: dec @r7
+dec L2
+L3: jmp @r2
+jsr L1
+bne @r1
+mov L2, @r4
+inc L3
+jsr @r4
+clr L1
+rts
+L4: prn @r5
+jsr L0
+L5: dec L3
+cmp L4, @r6
+inc @r2
+sub @r0, L0
+not @r2
+rts
+red @r1
+m2
+cmp 211, @r0
+inc @r4
+dec @r1
+add L5, L4
+not L1
+prn -5
+dec L0
+dec @r4
+dec L5
+m1
+prn L31
+lea L0, L0
+add L5, @r3
+lea L3, @r1
+mov L3, L0
+sub 17, L3
+lea L5, L4
+L6: red L6
+prn @r2
+L7: bne @r4
+not L1
+m0
+cmp @r7, 329
+bne L6
+jmp @r1
+not L6
+dec @r6
+m2
+L8: prn @r4
+mov L7, L0
+prn -165
+L9: inc L1
+dec L8
+m0
+add L3, L9
+lea L6, L7
+dec @r1
+dec L3
+L10: cmp L9, L8
+add @r4, @r5
+m2
+prn -232
+lea L2, L6
+inc L5
+m3
+sub L9, S3
+red @r1
+mov S9, L5
+L11: lea L7, @r1
+red L3
+dec D0
+add L9, L2
+clr L6
+mov L4, @r7
+cmp L8, @r0
+jsr L3
+not @r6
+m0
+m3
+L12: rts
+m1
+jmp L12
+L13: jmp L1
+jsr @r3
+not @r5
+red L4
+cmp @r1, -66
+prn @r2
+rts
+add L7, L6
+cmp 297, L11
+mov @r4, @r6
+not @r1
+bne L11
+cmp -91, -230
+add L6, L0
+bne L11
+mov @r0, L7
+cmp @r1, L9
+L14: add -356, @r6
+m3
+bne @r3
+not @r1
+dec L2
+L15: cmp @r3, 461
+jsr @r0
+clr L14
+jsr @r1
+clr L15
+not L11
+lea L4, @r6
+cmp L1, -146
+m4
+cmp L9, @r5
+mov 375, @r5
+L16: prn L1
+jsr L11
+jmp @r7
+dec @r7
+jsr L4
+bne L11
+m1
+cmp 377, @r7
+rts
+m1
+L17: sub 505, L0
+bne L2
+m3
+cmp -102, 400
+lea L3, @r4
+m0
+rts
+dec @r6
+cmp @r5, -447
+jsr L7
+prn 189
+jmp @r7
+add -405, L19
+rts
+jsr @r2
+not @r6
+inc @r5
+not L7
+jsr L16
+not L11
+mov @r1, L15
+dec @r2
+clr @r7
+inc @r5
+jmp @r3
+L18: inc @r3
+L19: jsr @r3
+mov @r2, @r2
+clr L16
+L20: prn @r4
+L21: dec S5
+L22: rts
+mov -472, L3
+m2
+inc @r5
+jsr L1
+sub 511, @r2
+m2
+sub @r7, L13
+L23: rts
+L24: jsr L2
+prn 270
+inc @r2
+red L24
+m2
+clr L16
+prn L9
+mov L23, L2
+bne L14
+jmp L23
+cmp -66, 277
+mov 477, @r3
+L25: rts
+m0
+inc @r5
+prn L16
+red @r7
+m1
+jsr L24
+dec L11
+bne @r1
+mov 229, L5
+mov L24, L43
+L26: clr L17
+jsr @r4
+rts
+mov @r1, @r5
+jsr @r7
+red L26
+m1
+sub @r2, L22
+add @r5, L9
+L27: add 408, @r6
+rts
+L28: inc @r1
+not @r2
+sub L59, @r4
+not L0
+m3
+dec L20
+prn @r6
+mov @r3, L16
+lea L24, @r0
+L29: sub L17, L3
+add @r1, D0
+L30: rts
+inc @r5
+not @r4
+not @r6
+L31: sub @r1, L55
+rts
+jmp @r4
+prn -178
+prn @r5
+jmp L26
+bne L29
+inc L9
+prn L28
+clr L23
+prn -449
+clr L41
+m1
+not L12
+add L31, @r7
+jsr @r3
+red L29
+rts
+cmp 123, -283
+not L3
+L32: mov L7, @r4
+sub L30, S3
+L33: lea L9, @r0
+L34: add L53, @r5
+jsr @r0
+not X0
+jsr L9
+mov -334, @r7
+clr L32
+cmp L15, @r7
+m3
+lea L30, @r4
+jmp @r4
+rts
+lea L1, @r3
+prn L22
+dec L19
+not L24
+jsr @r7
+rts
+jsr @r2
+cmp 135, L12
+jsr @r6
+m2
+sub @r7, @r7
+not @r2
+add L5, L2
+lea L28, @r0
+jsr @r2
+rts
+m0
+jsr L27
+not L16
+bne L10
+L35: lea L1, L17
+dec L34
+inc @r3
+L36: inc @r3
+L37: inc L8
+rts
+dec L21
+lea L16, @r4
+L38: jsr @r3
+lea L25, @r5
+cmp -193, @r4
+m0
+L39: red @r3
+clr @r3
+m2
+prn S5
+clr L24
+inc @r1
+L40: red @r7
+rts
+L41: mov L18, @r4
+clr @r1
+mov @r4, @r2
+L42: sub @r7, D0
+jsr L23
+sub @r7, L2
+not L21
+dec L38
+rts
+sub L36, @r2
+sub L39, L16
+clr S1
+L43: not @r2
+lea L30, @r7
+inc @r4
+inc @r7
+dec L43
+bne L2
+inc @r0
+clr L41
+prn -93
+bne L0
+clr L37
+add 39, L25
+L44: jsr @r5
+sub 471, @r3
+L45: clr @r2
+cmp @r2, 389
+m1
+m0
+add @r1, @r6
+mov L33, L10
+jmp L4
+cmp -479, @r4
+not L20
+add S6, L29
+cmp L54, 77
+L46: red @r4
+add L29, S4
+add @r5, @r3
+not @r1
+clr L45
+bne L25
+inc @r6
+jsr L52
+jmp L16
+prn 342
+jsr @r2
+jsr @r6
+add @r2, L9
+L47: jsr @r0
+dec @r5
+prn -478
+red L10
+rts
+jsr @r7
+not D0
+dec L8
+not @r5
+L48: sub @r3, L20
+L49: inc L38
+red S5
+jmp L42
+clr L1
+dec L49
+clr L45
+bne @r6
+sub @r3, L41
+inc S7
+jsr L0
+rts
+sub L35, @r2
+L50: inc @r2
+mov @r2, @r1
+m2
+not L44
+lea L31, @r6
+L51: cmp @r1, -64
+L52: red L16
+red @r2
+mov @r6, L30
+jsr @r6
+mov @r0, L41
+sub @r0, L26
+prn -263
+red @r4
+prn @r1
+mov L5, L33
+red L40
+not @r5
+sub @r2, @r4
+jmp @r1
+lea L59, L8
+m2
+lea L49, L29
+red X1
+cmp @r3, -425
+L53: jsr L12
+clr @r6
+inc @r3
+L54: add @r4, @r4
+dec L44
+bne L48
+cmp @r3, L55
+m4
+L55: sub 485, @r7
+prn -115
+L56: not @r6
+m0
+bne L59
+not @r1
+m4
+jsr @r1
+clr @r0
+add L22, L32
+m3
+mov -225, S5
+sub -172, L30
+cmp 444, L51
+clr @r0
+mov -266, @r1
+L57: clr L22
+dec X2
+m1
+m1
+mov @r3, L51
+red @r4
+jmp X3
+prn S6
+prn L16
+bne L59
+bne @r7
+L58: add @r7, L59
+cmp 480, 262
+prn @r2
+jmp D0
+cmp S3, -174
+jsr X4
+m2
+prn S0
+lea S2, L59
+lea L59, @r4
+bne L59
+not D0
+clr S8
+L59: not S0
+stop
+D0: .data 246,83,-442,157,-201,-155,264,-161,-139,-254
+D1: .data -68,-233,-8,416,-318,450,147,92,101,57
+D2: .data 26,-459,-490,44,-440,485,13,325,489,-173
+D3: .data 425,9,436,-108,37,136,-374,101,-75,-216
+D4: .data -149,338,-253,115,430,-291,-347,-119,-414,386
+D5: .data -434,-109,-309,-32,-54,136,13,144,-155,-38
+D6: .data -238,-319,176,345,395,-426,-354,254,160,-263
+D7: .data -352,0,-138,41,-161,478,-443,-87,24,276
+D8: .data -323,168,440,-493,-476,-39,182,111,403,478
+D9: .data -217,-187,336,85,-431,-316,127,-470,-316,185
+S0: .string "hblzfzbtnmhmxrigmk"
+S1: .string "ut"
+S2: .string "cmsytmcmyi"
+S3: .string "rrdz"
+S4: .string "lapacfka"
+S5: .string "nrheqnswlsw"
+S6: .string "pljafehdrtzdikbawxx"
+S7: .string "h"
+S8: .string "kqzwgtseyyyyb"
+S9: .string "regnutngydb"
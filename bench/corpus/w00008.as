@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r7
+    prn 90
+endmcro
+mcro m1
+    sub @r7, @r6
+    prn 81
+endmcro
+mcro m2
+    sub @r2, @r5
+    prn 91
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 17
+endmcro
+mcro m4
+    sub @r2, @r3
+    prn 60
+endmcro
+not @r2
+sub -180, @r1
+red @r0
+inc L0
+jmp @r5
+dec @r6
+jmp L0
+L0: jsr L0
+mov 95, @r2
+prn 129
+jmp @r4
+sub @r4, @r0
+bne @r6
+jmp L0
+mov @r7, L0
+bne @r1
+add 459, @r4
+cmp @r1, @r4
+lea L0, @r5
+inc @r3
+mov -174, @r0
+m4
+prn L46
+rts
+jsr @r3
+rts
+cmp @r6, @r1
+sub @r7, L0
+inc L0
+red @r0
+jmp @r1
+L1: inc L0
+dec L1
+L2: prn @r0
+m4
+jsr @r0
+jsr L1
+cmp @r5, -365
+m3
+dec @r7
+L3: cmp 92, @r6
+sub 198, L2
+L4: cmp @r6, 297
+m1
+L5: jmp @r6
+rts
+L6: inc L3
+jmp @r6
+lea D0, @r4
+bne @r3
+bne L4
+red @r3
+jsr L3
+clr L6
+jmp @r7
+dec L4
+red @r7
+lea L5, L3
+jmp L1
+rts
+rts
+cmp 196, @r0
+dec L3
+m0
+red @r4
+red @r6
+add L6, L5
+inc @r2
+lea L3, @r3
+bne L2
+mov L6, L2
+m3
+rts
+L7: cmp -253, @r3
+L8: inc @r3
+red L8
+lea L0, L3
+dec L5
+L9: red L5
+L10: jsr L1
+sub @r0, @r5
+L11: not L4
+dec L11
+jmp @r4
+sub 225, @r5
+dec L43
+not L5
+jsr L1
+L12: rts
+lea L6, L5
+jsr L2
+mov @r1, @r7
+add L5, @r3
+bne L0
+cmp -389, @r1
+m3
+L13: clr L10
+L14: dec L1
+L15: not L4
+rts
+sub S6, L15
+inc @r6
+L16: jsr L14
+jsr @r0
+sub L6, @r0
+m2
+bne @r3
+bne @r5
+cmp @r2, @r3
+not @r7
+clr @r7
+jsr L2
+mov @r6, @r0
+rts
+not @r3
+prn @r2
+sub 351, L7
+m0
+clr @r5
+lea L16, @r6
+m2
+m1
+m0
+not L5
+clr L4
+cmp -493, L5
+not L12
+bne @r5
+not @r5
+jmp @r1
+lea L1, @r6
+clr L2
+rts
+lea L7, @r1
+dec L6
+L17: bne @r1
+mov L17, X0
+m2
+lea D0, L8
+m4
+lea L16, @r0
+inc L6
+L18: not @r1
+prn @r2
+bne @r6
+lea L18, L12
+dec L0
+inc @r6
+L19: inc L3
+L20: jmp @r4
+L21: not @r5
+not L21
+sub 133, @r3
+m4
+L22: jmp @r2
+not @r5
+L23: sub @r6, @r2
+cmp @r3, L12
+inc L22
+add @r2, L23
+clr @r1
+rts
+rts
+L24: mov @r4, @r3
+add @r3, L47
+not @r6
+rts
+cmp -136, @r4
+inc @r3
+prn @r7
+L25: jmp @r1
+cmp L13, @r7
+sub @r0, @r0
+sub 436, L16
+inc L7
+cmp @r0, L0
+dec @r6
+inc L9
+add X1, L10
+prn @r0
+bne L7
+mov 123, @r1
+prn -26
+sub -378, L2
+L26: jsr L23
+not @r0
+jsr @r6
+dec @r0
+m2
+rts
+bne L1
+clr D0
+jsr @r5
+add @r7, @r0
+not L7
+dec L3
+L27: sub @r2, L5
+bne @r7
+inc L4
+clr @r3
+cmp 448, L27
+m0
+cmp -350, 457
+dec D0
+clr L40
+lea L20, @r3
+jsr L0
+red @r0
+jmp @r6
+prn @r0
+L28: mov L22, @r1
+mov 287, @r1
+m2
+mov @r6, @r1
+L29: add 307, L29
+red L8
+sub 145, L44
+L30: rts
+inc @r0
+clr @r6
+clr @r4
+dec @r5
+L31: not @r2
+m1
+mov 280, L0
+bne L11
+L32: mov @r5, L33
+clr @r1
+inc @r3
+not @r0
+add -418, L25
+add @r4, @r3
+inc L3
+cmp @r3, 174
+cmp L19, L8
+inc L34
+cmp @r6, -398
+dec @r3
+m3
+add L12, L7
+dec @r3
+inc @r4
+cmp L25, L3
+cmp 226, @r3
+L33: clr @r6
+inc L1
+bne L20
+prn @r6
+not L2
+add L20, @r7
+jsr L13
+add 48, @r5
+jmp @r0
+prn L9
+L34: not @r5
+red L30
+jsr @r7
+inc L6
+clr L9
+L35: add L1, @r7
+rts
+mov @r0, @r7
+m2
+rts
+L36: rts
+L37: lea L37, @r3
+dec L27
+jsr L34
+sub @r2, @r0
+m3
+lea L24, L3
+add D0, @r3
+dec @r7
+inc @r6
+rts
+dec @r6
+sub -11, @r1
+red L7
+prn L1
+lea L9, @r0
+dec @r3
+bne @r4
+add -69, D0
+jsr L19
+add @r7, L7
+prn @r6
+sub @r0, L35
+lea L25, @r3
+mov @r0, @r3
+dec @r4
+inc @r3
+m1
+jmp L37
+L38: jmp @r7
+add -213, L10
+jsr @r3
+jsr @r6
+bne @r0
+cmp 52, L11
+inc L33
+L39: lea L38, @r7
+sub @r4, @r6
+cmp L26, L17
+add 15, L14
+sub 250, D0
+prn L17
+bne @r6
+lea L37, @r3
+red @r0
+not @r2
+inc @r0
+jmp L51
+mov L0, L14
+L40: mov L34, @r0
+sub @r2, L21
+m0
+jmp @r1
+L41: cmp @r1, @r0
+inc @r1
+clr @r3
+inc @r7
+mov L17, @r5
+prn @r6
+L42: lea X2, L43
+clr S3
+m3
+L43: not L52
+L44: inc L55
+m2
+dec L17
+red L3
+cmp @r1, L18
+L45: dec L34
+L46: mov 76, L54
+cmp @r0, @r1
+inc L11
+dec @r5
+sub L26, @r7
+jmp @r3
+red @r1
+m2
+inc @r7
+L47: lea X3, L16
+cmp L20, L21
+bne @r6
+jmp L19
+clr L29
+sub @r6, @r3
+red L2
+red @r6
+lea L24, @r0
+m3
+red L14
+prn L29
+add S1, L43
+m0
+prn @r0
+mov -406, L14
+jmp L34
+m0
+cmp @r4, L44
+inc @r1
+cmp L25, L43
+cmp -337, 414
+m4
+red @r1
+sub -9, L10
+lea L42, @r5
+jmp L34
+cmp @r5, -43
+m4
+jsr L3
+red @r6
+cmp @r3, L48
+L48: jmp L14
+prn L25
+L49: red L34
+cmp @r5, @r2
+inc L43
+L50: jsr @r4
+m1
+red L5
+dec L21
+cmp 131, S2
+lea L25, L38
+cmp L55, @r0
+L51: bne @r2
+cmp @r3, @r4
+mov L35, @r1
+lea L23, @r4
+add L44, @r2
+L52: bne @r7
+L53: red L58
+not L48
+jmp L0
+lea L58, @r4
+sub L56, @r0
+add 85, L49
+clr L9
+m4
+jmp @r4
+L54: rts
+L55: jmp L27
+L56: add @r2, L21
+prn L48
+lea L1, L35
+red @r7
+jsr @r2
+m1
+sub L58, L59
+cmp -242, 83
+not @r0
+not @r3
+lea D0, L40
+cmp -332, @r7
+jmp @r2
+sub 5, @r1
+jmp @r1
+dec L52
+red L24
+clr @r5
+sub -15, @r7
+m0
+m2
+jmp @r6
+red L27
+lea L57, @r4
+m0
+m4
+L57: add -289, @r3
+cmp -119, S8
+bne D0
+rts
+not S2
+m1
+cmp X4, S2
+L58: sub L59, D0
+red @r0
+add L59, L59
+L59: mov L0, @r7
+stop
+D0: .data 318,-474,382,214,-40,164,-184,-481,451,-130
+D1: .data -376,376,496,-457,-424,110,407,371,221,-266
+D2: .data 192,-198,-286,301,-190,-350,-27,495,154,439
+D3: .data 265,-359,153,338,-156,165,446,-429,-104,194
+D4: .data -291,344,308,186,48,230,327,449,189,167
+D5: .data -500,205,-357,-16,113,2,210,-275,129,319
+D6: .data -340,460,500,408,352,-260,168,-161,341,314
+D7: .data 86,193,328,323,52,-388,-406,-432,19,-319
+D8: .data -349,31,462,-125,-106,342,153,-447,148,-51
+D9: .data -410,-150,-57,115,323,-127,119,-500,278,-44
+S0: .string "evycjzqxpnayztih"
+S1: .string "upywuwyqpssidyzff"
+S2: .string "iet"
+S3: .string "pyxtj"
+S4: .string "rdjiyddae"
+S5: .string "yqjmzjser"
+S6: .string "mrdzvxyxztmdxmhiykvg"
+S7: .string "wa"
+S8: .string "umtc"
+S9: .string "ioasfomaxkadjaytqikk"
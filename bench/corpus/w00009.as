@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r1
+    prn 28
+endmcro
+mcro m1
+    sub @r3, @r7
+    prn 80
+endmcro
+mcro m2
+    sub @r4, @r3
+    prn 56
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 94
+endmcro
+mcro m4
+    sub @r4, @r1
+    prn 84
+endmcro
+m0
+L0: cmp @r0, 457
+L1: inc @r1
+bne L1
+lea L1, L1
+lea L0, L0
+clr L0
+mov @r7, L1
+prn @r2
+sub D0, @r5
+clr @r7
+not @r2
+inc @r6
+cmp L0, 454
+m0
+dec @r1
+L2: not L0
+mov @r6, L0
+L3: mov L3, @r3
+L4: jsr @r3
+rts
+jmp L1
+not @r2
+rts
+sub @r6, D0
+L5: mov 149, @r4
+bne @r6
+m2
+bne @r1
+not @r7
+lea L4, @r1
+add @r7, D0
+m3
+jmp @r6
+mov 108, L3
+lea L1, @r6
+mov L0, @r7
+mov -347, @r5
+lea L5, L0
+mov @r4, @r2
+not @r6
+prn @r5
+add 162, @r7
+inc S5
+L6: bne @r1
+rts
+lea L3, L4
+dec @r6
+sub L3, L2
+rts
+red @r1
+mov L3, L6
+m4
+red @r0
+cmp @r5, -314
+jmp @r1
+L7: jmp L1
+mov @r3, L6
+rts
+dec L5
+m0
+prn @r0
+clr L1
+jsr L0
+L8: rts
+mov 378, @r1
+dec L7
+bne @r5
+m4
+bne @r4
+sub 121, @r6
+jmp L2
+not @r5
+prn 186
+rts
+m1
+inc @r0
+cmp 133, 243
+m1
+sub @r5, @r3
+add 443, L4
+clr L5
+lea L8, L4
+clr L5
+mov -270, L7
+sub @r1, L7
+red @r0
+inc @r7
+dec @r5
+L9: dec L8
+rts
+red L8
+add 113, L22
+cmp L1, L3
+L10: rts
+m1
+prn L7
+dec S7
+red @r6
+clr @r3
+inc @r6
+not @r1
+inc @r3
+clr L0
+m1
+cmp -77, L1
+sub L3, L10
+add L4, L8
+L11: mov 154, L4
+L12: dec @r0
+sub L5, D0
+clr @r1
+sub -35, @r3
+not @r2
+dec L9
+m2
+m0
+sub @r5, L10
+add @r7, L10
+L13: red @r5
+red @r2
+prn L6
+clr @r5
+sub @r0, L7
+L14: lea L0, @r5
+sub @r0, L39
+rts
+not L1
+L15: lea D0, L7
+red L9
+jsr @r2
+jsr L14
+L16: red @r5
+L17: cmp -429, L0
+lea L2, L11
+bne L4
+prn @r1
+bne @r1
+prn @r5
+m0
+add @r4, @r5
+L18: dec L2
+L19: clr L14
+jmp L14
+add -12, L5
+rts
+prn L16
+m2
+bne L6
+m3
+clr @r2
+L20: prn @r1
+clr L20
+cmp @r2, @r1
+prn @r5
+sub @r5, @r0
+rts
+add -77, @r1
+add L1, @r2
+jsr L9
+rts
+m0
+red @r5
+prn @r4
+red S9
+L21: jsr @r2
+inc L3
+sub -484, L12
+cmp 101, L8
+bne L16
+add L10, L6
+add 132, L15
+L22: jmp L16
+clr L0
+red @r1
+inc L14
+clr L16
+add L21, L18
+L23: clr @r3
+rts
+prn @r1
+m1
+sub 506, @r5
+lea L22, @r2
+L24: sub @r6, L9
+prn -316
+lea L23, X0
+red @r5
+clr L19
+bne @r5
+mov -157, L1
+L25: bne @r1
+lea L15, @r3
+not @r4
+bne @r1
+cmp @r1, L18
+rts
+inc L18
+jsr L4
+clr L8
+prn -280
+clr L12
+bne L21
+lea L21, L40
+bne @r0
+clr L23
+not @r6
+prn @r3
+not @r0
+m0
+bne L8
+rts
+sub @r1, @r4
+red @r3
+bne @r1
+m0
+cmp @r2, -123
+L26: lea L12, L24
+cmp -333, @r3
+jmp @r0
+L27: red L21
+dec @r2
+rts
+rts
+jsr L10
+m1
+not L4
+rts
+cmp 343, @r3
+jsr L11
+L28: prn L9
+prn @r7
+dec L5
+sub @r5, @r7
+sub @r3, @r2
+L29: clr L5
+sub 381, L19
+bne @r6
+sub @r5, @r7
+inc D0
+sub -228, L11
+L30: dec @r7
+add @r3, L26
+bne L14
+jsr @r7
+cmp @r2, @r1
+rts
+cmp @r1, L22
+not D0
+L31: jmp @r7
+L32: sub @r3, L16
+jmp @r0
+add L13, L22
+dec L1
+m0
+prn L23
+clr X1
+rts
+not L38
+jsr @r3
+inc L6
+bne @r3
+rts
+m0
+lea L13, L29
+jmp L21
+not @r7
+m2
+add 476, L19
+jmp X2
+prn 150
+not @r3
+lea L50, @r6
+mov @r6, L30
+not L4
+jmp @r3
+L33: sub @r2, L20
+clr L1
+add -282, L13
+prn L29
+mov @r1, @r3
+lea L27, L32
+inc L30
+L34: lea L25, L2
+m2
+not @r5
+jmp L36
+inc @r3
+red L31
+L35: inc @r0
+red @r6
+bne L32
+clr @r4
+clr L17
+L36: mov L4, @r6
+L37: add L32, @r6
+m1
+mov 108, L15
+L38: dec L8
+add @r5, L34
+cmp L3, -209
+red D0
+jmp @r2
+cmp -430, 63
+L39: clr @r0
+not @r4
+m0
+add @r2, @r2
+jmp @r0
+sub 23, L30
+jmp L33
+dec L28
+L40: not @r3
+L41: rts
+rts
+L42: rts
+red L35
+L43: jsr @r6
+cmp @r1, -312
+mov L23, L39
+rts
+lea L35, @r0
+L44: red @r3
+sub @r3, @r0
+L45: jsr L41
+rts
+jsr L21
+jmp @r2
+m0
+rts
+rts
+L46: rts
+prn @r7
+clr @r7
+jsr L22
+dec @r0
+mov 32, L9
+sub @r6, @r4
+L47: rts
+red @r7
+jsr @r4
+add 224, L29
+jmp @r3
+add L33, L44
+red L26
+add @r4, L23
+m0
+bne @r2
+dec L7
+jmp @r6
+m3
+dec @r2
+bne L58
+m0
+prn @r1
+dec @r4
+L48: prn @r7
+add L18, @r6
+jsr L27
+m1
+red L55
+mov S4, @r2
+jmp L0
+m3
+inc @r7
+red @r2
+L49: bne L17
+jmp L58
+m1
+sub @r0, @r6
+rts
+L50: not L55
+red X3
+dec L46
+sub @r7, L38
+add 201, L13
+add @r2, @r7
+clr L58
+inc @r7
+inc @r4
+m1
+rts
+jmp D0
+jmp L40
+jsr L0
+jsr D0
+clr L57
+bne L25
+dec @r2
+m2
+L51: lea D0, @r5
+red L11
+prn @r5
+inc L33
+clr L29
+mov 169, @r4
+L52: add L1, @r4
+inc @r5
+sub 189, @r1
+cmp 482, L41
+L53: inc L15
+prn @r2
+prn @r5
+lea L54, L13
+rts
+L54: clr @r5
+L55: sub @r2, @r4
+jmp S4
+red L58
+L56: sub L22, L12
+m0
+sub @r2, L2
+m2
+prn -328
+cmp 165, L14
+inc @r0
+bne @r7
+jsr @r7
+clr @r0
+mov @r1, @r0
+dec @r5
+mov L57, @r1
+rts
+lea L33, L3
+m2
+bne @r6
+inc D0
+add 191, @r2
+add L42, @r3
+clr D0
+L57: sub @r7, S1
+jmp @r5
+L58: add 392, X4
+cmp D0, 32
+sub @r4, @r0
+sub L59, @r4
+jmp S3
+lea L59, @r1
+sub L59, D0
+m2
+L59: stop
+D0: .data -374,154,-466,438,-33,123,-20,-273,-178,86
+D1: .data 248,46,70,472,96,-472,148,244,51,294
+D2: .data -52,410,-178,-238,136,277,141,282,-436,399
+D3: .data -268,377,225,-123,-471,-19,-9,493,109,-311
+D4: .data 464,-153,213,-194,222,-93,-256,357,-415,111
+D5: .data -182,-188,-159,70,-73,-80,208,-405,205,-455
+D6: .data -257,-52,405,-146,43,-204,-429,124,-270,438
+D7: .data -82,249,-351,147,-180,-153,317,44,-362,-171
+D8: .data -67,-212,-54,86,289,25,-406,-22,-292,165
+D9: .data 486,-498,116,-113,-8,-431,21,-187,-16,-295
+S0: .string "oaslxqfxvgrtwezddp"
+S1: .string "esq"
+S2: .string "nusffgmoevgvoxaod"
+S3: .string "sdvmhgcotvtmhdcjx"
+S4: .string "htfobpl"
+S5: .string "smnjrjswwmadrbzu"
+S6: .string "h"
+S7: .string "cvpqntkkukixd"
+S8: .string "tjwrdqkgyguwechbyk"
+S9: .string "zcnuflqsty"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r4
+    prn 99
+endmcro
+mcro m1
+    sub @r7, @r1
+    prn 78
+endmcro
+mcro m2
+    sub @r6, @r1
+    prn 21
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 70
+endmcro
+mcro m4
+    sub @r6, @r0
+    prn 9
+endmcro
+jmp @r4
+sub @r1, L0
+not L0
+red @r6
+cmp L0, -469
+inc L0
+rts
+jsr L0
+bne @r5
+m1
+inc L0
+jsr L0
+mov @r7, @r1
+bne L12
+add @r4, L24
+L0: inc @r1
+rts
+clr L0
+rts
+jsr @r6
+not @r0
+m1
+m1
+add L0, L0
+rts
+m3
+prn 350
+inc @r0
+add @r4, L0
+lea L0, @r1
+not L0
+m3
+dec L6
+jsr L0
+m1
+sub L0, L0
+not @r3
+jsr @r0
+jsr @r4
+rts
+jsr S0
+jsr L0
+bne @r4
+rts
+m3
+m2
+add @r6, L7
+clr L0
+L1: red L1
+jmp L1
+clr @r7
+inc L1
+not L1
+L2: bne @r2
+clr L0
+bne L0
+sub @r4, L1
+bne L2
+L3: cmp @r1, @r0
+sub -30, @r2
+lea L1, L0
+add 232, L1
+lea L0, L0
+not L0
+prn L2
+red @r0
+red L47
+m0
+m4
+m2
+m1
+clr L3
+dec @r4
+cmp L0, @r3
+jmp @r0
+jmp L59
+m3
+L4: prn L2
+sub 21, L2
+not L2
+L5: clr L1
+jmp L1
+L6: inc @r6
+L7: rts
+lea L4, L3
+inc L7
+bne @r5
+sub 117, @r5
+clr L2
+bne L0
+mov L5, @r5
+red L4
+dec L7
+cmp @r4, L1
+m0
+L8: jmp @r5
+inc L6
+red @r2
+rts
+add @r5, @r5
+prn @r1
+L9: bne L6
+not @r6
+dec L42
+add @r0, L0
+jmp @r3
+jsr @r1
+clr @r7
+inc @r3
+jmp L59
+L10: add -58, L2
+cmp @r2, 31
+not L7
+jmp @r4
+m3
+cmp @r2, L4
+L11: lea L9, L7
+cmp L7, @r5
+m0
+m3
+cmp @r2, L7
+inc @r2
+m2
+mov S3, @r1
+bne L6
+cmp L0, L8
+bne D0
+mov 237, L1
+bne @r4
+jmp @r4
+not L1
+not D0
+prn L9
+add -245, @r7
+jsr @r5
+not @r0
+prn -43
+m0
+prn S1
+jsr L5
+sub @r6, @r1
+jmp @r3
+jmp @r1
+clr S6
+jmp L7
+lea L3, @r6
+m1
+jsr @r1
+L12: mov L4, L0
+cmp L10, @r2
+not D0
+L13: inc @r0
+lea D0, @r4
+bne L2
+m0
+cmp 443, L13
+mov @r4, @r6
+m4
+L14: dec @r5
+dec L4
+rts
+bne @r3
+dec @r4
+jsr @r7
+clr L14
+jmp @r3
+L15: sub 306, L11
+clr @r2
+not L3
+cmp @r1, 169
+bne L5
+L16: jmp @r6
+jsr @r5
+L17: dec @r4
+not L9
+dec @r2
+jmp L3
+red @r0
+jmp @r6
+jmp @r5
+clr L13
+L18: dec L13
+add L7, @r2
+clr L0
+cmp 210, 198
+m1
+L19: rts
+sub L7, L0
+m4
+L20: bne @r2
+lea L19, @r0
+prn @r0
+lea L11, @r0
+inc @r6
+jsr L1
+inc @r3
+add @r3, L13
+L21: clr L6
+add @r1, L5
+L22: cmp @r7, 384
+cmp @r3, @r7
+jmp @r5
+dec @r1
+rts
+sub @r6, @r0
+not L7
+mov L17, L6
+jmp L21
+clr @r5
+not @r5
+jsr @r2
+rts
+inc L11
+prn -116
+dec @r0
+jsr @r6
+jmp L20
+jsr L47
+rts
+m0
+add @r4, L20
+prn -354
+cmp -77, @r5
+bne @r2
+L23: add D0, L17
+dec @r7
+add @r4, L14
+L24: cmp L1, -316
+not @r1
+jmp @r7
+sub @r5, L5
+lea L17, @r2
+L25: mov -480, L11
+jmp @r7
+dec @r0
+dec L0
+mov L24, @r2
+m1
+m0
+sub L1, @r6
+inc L0
+L26: bne @r2
+inc L1
+rts
+red @r2
+L27: jsr @r4
+sub L21, L56
+add @r3, L42
+clr @r1
+bne L14
+rts
+bne L21
+jmp L2
+rts
+sub @r7, @r1
+jsr L12
+dec L27
+mov 78, L7
+inc @r6
+clr @r2
+jsr @r0
+dec L2
+inc L3
+rts
+add 222, L2
+dec @r5
+bne L20
+clr @r3
+L28: sub -261, L57
+lea L11, @r1
+inc @r0
+L29: prn @r4
+m2
+inc L21
+L30: not @r5
+jsr L2
+rts
+cmp L13, @r5
+rts
+prn @r3
+m1
+L31: jsr L41
+rts
+prn @r4
+m3
+sub L21, D0
+L32: red @r1
+bne @r2
+add -38, L20
+prn @r0
+add @r6, @r5
+L33: add @r1, @r0
+prn -82
+clr @r7
+jmp @r0
+prn @r5
+inc L16
+jmp @r0
+mov -299, @r4
+rts
+lea L11, @r1
+mov 44, @r6
+L34: jmp L24
+jmp @r7
+L35: lea L33, L12
+jsr L8
+lea L29, L17
+clr @r2
+clr @r4
+sub L35, L2
+L36: dec L25
+L37: mov @r3, @r2
+jmp L34
+mov -207, L9
+red L10
+clr @r0
+sub @r5, @r7
+prn @r7
+clr @r4
+red @r6
+rts
+L38: prn L17
+clr @r0
+jsr L14
+jsr @r5
+L39: cmp @r1, -462
+lea L16, X0
+prn @r0
+bne D0
+clr L41
+bne @r5
+prn @r5
+lea L59, L28
+bne @r6
+L40: jsr L9
+clr @r1
+sub -385, @r0
+not L20
+m1
+jmp L35
+not @r7
+red @r0
+rts
+rts
+prn 252
+mov @r0, L12
+bne @r1
+rts
+L41: jsr S2
+not @r4
+dec @r0
+clr @r1
+add -319, @r4
+L42: sub L3, L11
+L43: dec L21
+m2
+red L19
+mov L5, L0
+lea S8, L2
+prn L19
+sub L10, @r5
+red L33
+L44: lea L44, @r0
+prn L4
+L45: rts
+jsr L26
+dec L24
+bne L20
+L46: prn L10
+prn L52
+jmp D0
+bne L14
+prn 229
+cmp 260, @r5
+m2
+jsr L40
+L47: bne L43
+jmp L14
+red @r6
+mov L11, X1
+L48: not @r4
+lea L32, @r0
+mov L38, L4
+rts
+lea L33, @r5
+inc @r3
+mov L45, L22
+red X2
+sub @r6, L44
+add 174, @r6
+lea L31, L16
+jsr L26
+jmp L23
+rts
+lea S5, L12
+L49: inc @r0
+clr L30
+m3
+prn L56
+L50: rts
+jmp @r2
+L51: dec L3
+rts
+prn @r7
+inc L20
+cmp D0, -195
+m0
+jsr L1
+m3
+L52: red L8
+L53: red L15
+add @r0, @r4
+inc @r5
+L54: cmp 341, L14
+clr L30
+add S2, @r0
+inc @r4
+m3
+lea S3, L4
+lea L15, @r7
+m2
+red L57
+prn -234
+m0
+inc L51
+m4
+jmp @r6
+clr L18
+jmp @r4
+dec L55
+cmp @r1, @r4
+L55: red @r0
+L56: rts
+L57: inc S3
+red @r5
+L58: lea L55, @r4
+dec X3
+clr S0
+jmp L41
+L59: red X4
+stop
+D0: .data -491,-192,-161,-375,-317,-174,384,-203,388,323
+D1: .data -255,-439,-434,-68,240,-69,423,296,-303,-365
+D2: .data -485,-53,419,232,229,445,-208,-207,-221,-312
+D3: .data -78,392,-75,132,170,-119,-423,-112,-320,-157
+D4: .data -459,468,286,-355,-28,-367,193,-332,-152,-325
+D5: .data -191,260,-478,348,228,-304,432,-48,-499,402
+D6: .data 184,108,484,-236,-186,-347,-332,-250,179,-356
+D7: .data -37,-113,75,496,326,-335,313,478,389,280
+D8: .data -2,235,-2,302,-137,-3,-137,139,-437,-256
+D9: .data 170,45,-29,-325,-102,-316,-84,-492,-103,437
+S0: .string "orumynloorjhthbb"
+S1: .string "nlquhiygaqtt"
+S2: .string "ysh"
+S3: .string "aylmwhaouceldz"
+S4: .string "uigypfprc"
+S5: .string "yszuaubnmqjq"
+S6: .string "igbxlezyhp"
+S7: .string "xejnyorrynjsz"
+S8: .string "ffpmnvdcucvxcoejrkw"
+S9: .string "ojxdvbocftydi"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r7
+    prn 37
+endmcro
+mcro m1
+    sub @r4, @r2
+    prn 77
+endmcro
+mcro m2
+    sub @r0, @r7
+    prn 19
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 14
+endmcro
+mcro m4
+    sub @r0, @r6
+    prn 33
+endmcro
+mov L43, @r7
+dec L0
+L0: sub L9, @r4
+L1: lea L0, L0
+not S5
+sub @r1, @r1
+lea L0, L0
+bne L0
+bne L0
+sub L0, L34
+sub -37, @r3
+cmp L0, L1
+jsr L1
+prn L1
+jmp D0
+sub @r0, @r5
+L2: cmp -230, @r4
+m3
+L3: add -509, L1
+not @r6
+lea L3, @r6
+L4: jsr L4
+jsr @r2
+mov 22, L1
+m3
+cmp @r5, L0
+not @r5
+sub -168, L3
+inc L3
+add L3, @r3
+add @r1, @r4
+L5: lea L1, @r7
+m0
+jmp @r3
+red @r6
+cmp @r3, @r0
+sub @r4, L0
+not L0
+sub @r5, @r4
+clr @r2
+sub L1, @r0
+mov L0, L5
+sub -464, L5
+prn L5
+inc L4
+bne @r1
+m0
+bne @r6
+sub @r5, @r6
+red L3
+inc L4
+clr L38
+red @r6
+m0
+L6: lea L5, L4
+jmp L53
+prn L4
+dec @r4
+inc L1
+add -463, @r0
+bne L6
+jsr L37
+bne @r2
+not @r2
+dec @r1
+m0
+jsr L4
+mov @r3, L1
+dec L3
+prn @r3
+jmp L0
+red @r6
+L7: bne @r3
+mov @r6, @r0
+L8: lea L2, L0
+red @r7
+jsr @r4
+prn @r6
+prn 131
+jsr @r5
+m0
+L9: jsr @r1
+inc L6
+prn @r1
+clr @r7
+m1
+cmp @r1, @r1
+L10: add @r2, L48
+m0
+red L2
+L11: prn @r4
+mov -151, L9
+L12: red L10
+sub @r6, L0
+prn 30
+clr L3
+rts
+sub @r1, @r0
+L13: bne L4
+m2
+lea L4, L3
+L14: jmp L7
+sub @r3, L14
+mov @r3, @r3
+bne L1
+L15: lea L5, L0
+not @r1
+clr @r0
+m3
+clr L15
+prn L11
+cmp D0, @r2
+L16: prn -225
+m0
+rts
+L17: cmp L8, @r4
+jmp L16
+clr @r5
+red L9
+lea L8, @r1
+bne D0
+mov @r4, @r0
+lea L5, L2
+L18: clr @r5
+cmp @r2, -354
+clr L16
+inc @r2
+jmp @r5
+L19: lea L16, L13
+clr L16
+dec L0
+L20: prn @r7
+m0
+inc @r7
+L21: rts
+dec D0
+not @r6
+inc @r4
+add L3, @r1
+lea L54, L21
+L22: rts
+inc @r3
+L23: dec L0
+L24: lea L14, L23
+jmp @r5
+m1
+jsr @r5
+red @r7
+red L3
+dec L11
+bne L7
+clr L9
+rts
+bne L11
+not @r3
+not @r0
+cmp @r6, @r6
+inc @r7
+lea L19, L13
+red @r0
+not L4
+inc L17
+jsr @r3
+sub @r6, @r3
+mov @r7, @r1
+jmp L13
+mov @r1, @r1
+clr @r0
+red @r5
+jmp L6
+red L15
+L25: clr L24
+dec @r3
+cmp L24, @r3
+L26: prn -134
+clr @r3
+mov @r0, @r5
+mov 13, L8
+add L16, @r4
+add 46, L9
+rts
+m2
+sub -451, S8
+m0
+L27: prn @r2
+cmp L24, @r4
+jsr @r6
+add 165, L20
+sub -80, L13
+L28: add L12, L4
+prn @r4
+lea L29, @r5
+clr @r1
+L29: mov L18, L21
+sub @r6, @r7
+dec @r0
+lea L10, @r3
+bne @r0
+lea X0, @r5
+add L2, @r4
+rts
+mov -119, @r2
+not @r4
+clr @r4
+cmp @r3, 501
+L30: inc @r7
+clr @r6
+add @r7, @r6
+inc @r6
+dec L7
+not L5
+dec @r1
+rts
+clr @r2
+not L10
+jmp @r5
+jsr @r5
+L31: inc D0
+cmp @r1, 106
+L32: jmp @r6
+L33: cmp @r7, 341
+L34: add 400, @r6
+rts
+lea L29, L5
+rts
+inc L24
+sub -348, L28
+clr L14
+jmp L24
+L35: clr L25
+m2
+jsr L11
+dec L20
+dec L27
+L36: add L22, L18
+jsr @r5
+red L25
+sub -374, L29
+L37: inc @r2
+jmp @r6
+lea L33, L28
+bne @r1
+prn L8
+bne L2
+lea L30, @r3
+L38: add 398, L9
+m1
+L39: red L7
+m0
+add @r4, L27
+red L12
+m2
+L40: jsr @r5
+L41: jmp @r2
+not @r5
+add L21, L35
+cmp @r1, 78
+red L36
+jmp L14
+cmp L37, @r1
+rts
+inc @r6
+L42: red L27
+lea L12, L8
+add L9, L42
+bne @r2
+mov L42, L7
+sub @r0, L30
+L43: red L16
+not @r2
+jmp @r3
+jmp @r7
+L44: sub L26, L22
+rts
+prn @r4
+L45: jmp @r4
+rts
+sub @r0, L4
+jmp L37
+m1
+clr @r3
+red @r0
+m0
+rts
+m1
+jsr L13
+m2
+lea L33, @r1
+add @r5, @r0
+clr @r5
+red @r4
+sub L20, L31
+jmp L16
+mov L20, @r2
+rts
+jsr L23
+jmp L42
+jsr @r7
+bne L19
+mov @r3, D0
+m0
+m0
+rts
+add L20, @r4
+m3
+inc @r3
+bne @r7
+L46: cmp 288, @r2
+m4
+not L4
+jmp @r1
+red L15
+lea L21, L49
+prn @r7
+jsr @r0
+m0
+jsr @r0
+red @r4
+mov L16, L14
+mov L50, L4
+clr L44
+bne @r3
+clr L21
+rts
+jsr @r4
+mov X1, @r6
+add -57, @r1
+jmp L15
+sub 503, L56
+cmp @r7, L29
+L47: prn L33
+rts
+not L54
+L48: lea S9, @r5
+jmp L18
+mov @r5, @r1
+red @r0
+cmp L4, 409
+rts
+L49: bne L29
+add L32, @r6
+not L24
+mov L43, L22
+rts
+jsr @r1
+lea L48, @r7
+sub @r3, @r7
+add -126, L7
+add -281, L45
+m0
+m3
+bne @r5
+inc @r5
+rts
+sub @r5, @r7
+jmp @r2
+sub L59, @r4
+inc L44
+add @r6, L2
+mov @r5, @r1
+m1
+cmp @r3, @r2
+rts
+prn -359
+red L38
+bne @r7
+add @r2, @r2
+L50: jmp @r0
+add @r6, @r5
+mov L9, L10
+inc L29
+add @r5, L28
+mov 294, @r7
+m0
+L51: add @r3, @r6
+m1
+bne @r5
+sub -400, L48
+L52: red @r7
+bne L23
+sub @r1, @r5
+m0
+add L54, @r6
+not @r6
+add S6, L39
+rts
+jsr L11
+jsr L10
+clr L43
+not @r4
+dec L12
+m4
+sub -186, @r3
+dec @r1
+jmp D0
+m3
+inc @r0
+jsr @r3
+not L34
+jsr L25
+inc @r1
+lea L56, @r1
+inc @r1
+rts
+sub L11, @r6
+L53: add L5, L28
+inc L53
+bne @r7
+lea L58, L2
+clr L23
+cmp X2, L3
+mov 247, L54
+jmp L26
+prn S4
+bne @r6
+sub L59, D0
+L54: clr L16
+L55: jmp L14
+jsr L58
+m3
+L56: bne L59
+sub -57, D0
+m2
+jsr @r5
+not @r5
+mov S4, X3
+sub L20, @r0
+lea D0, @r7
+add @r6, @r5
+L57: dec @r1
+rts
+clr @r6
+lea L34, D0
+cmp L22, -423
+rts
+L58: not X4
+m4
+L59: not @r3
+bne S0
+lea S7, @r1
+stop
+D0: .data 177,197,-466,-421,49,1,-295,-463,-248,-135
+D1: .data 387,74,-397,263,335,377,-252,204,-103,-123
+D2: .data 158,152,-445,-211,-37,312,-43,116,172,237
+D3: .data 23,-389,-348,316,-470,-393,371,462,264,-377
+D4: .data 32,-217,-47,-49,-88,-499,-44,-261,372,-76
+D5: .data -126,-440,-382,255,108,-91,105,290,314,308
+D6: .data -304,224,156,-405,416,-142,416,-310,-419,-32
+D7: .data -313,428,-39,-458,265,-500,-388,-319,415,-444
+D8: .data -463,-437,-425,-455,494,-329,-73,126,-444,249
+D9: .data 267,130,111,224,416,179,65,10,-362,387
+S0: .string "fyfmrwoy"
+S1: .string "qgxbgdzmzjnivgno"
+S2: .string "lmvexou"
+S3: .string "gukgkaopberck"
+S4: .string "dofavkouk"
+S5: .string "umfkpsn"
+S6: .string "oobrlnamwpflzioa"
+S7: .string "sbqpr"
+S8: .string "idjwotfacirtpcglb"
+S9: .string "kleokxlyayvmaiudz"
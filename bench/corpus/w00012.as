@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r1
+    prn 7
+endmcro
+mcro m1
+    sub @r0, @r3
+    prn 43
+endmcro
+mcro m2
+    sub @r2, @r5
+    prn 84
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 91
+endmcro
+mcro m4
+    sub @r2, @r4
+    prn 90
+endmcro
+not @r6
+jmp @r6
+jsr @r6
+mov L0, L0
+L0: not L0
+clr L0
+jsr L0
+mov L0, L0
+prn @r7
+L1: jmp L1
+jsr @r4
+m1
+L2: cmp S3, @r4
+bne L2
+jmp @r1
+lea L1, @r2
+lea X0, L0
+L3: bne L0
+add @r7, L1
+red L2
+cmp @r6, L1
+mov -478, @r6
+L4: mov @r3, @r7
+inc L0
+cmp L52, L2
+not L2
+jsr D0
+L5: lea L5, @r3
+lea L0, L4
+rts
+m4
+mov L2, @r6
+bne L1
+lea L3, L0
+prn L4
+lea L5, @r1
+not L5
+red L2
+mov @r3, @r5
+sub X1, L2
+prn L5
+L6: inc L3
+jmp @r0
+m2
+sub 50, L6
+L7: rts
+add @r4, L4
+add 121, L0
+dec L6
+L8: lea L1, @r6
+lea L8, @r7
+inc @r5
+bne L4
+add S5, L4
+cmp @r2, @r1
+jsr @r2
+jmp L8
+L9: prn @r0
+not @r1
+lea L2, L4
+L10: jmp L3
+prn L4
+add @r7, @r5
+cmp @r2, L10
+cmp L3, -299
+inc L10
+mov L10, @r4
+cmp 166, @r6
+rts
+red L0
+m4
+jsr D0
+inc @r4
+jsr @r1
+not @r4
+jsr @r0
+prn L0
+L11: mov L2, L8
+m0
+jmp @r6
+cmp L2, @r1
+inc @r4
+lea L2, @r6
+bne @r1
+sub @r5, L4
+jsr @r4
+not L3
+L12: rts
+bne L8
+m2
+lea L2, L2
+L13: lea L1, @r1
+L14: red @r6
+inc @r2
+mov 60, @r7
+jmp @r0
+jsr L9
+m3
+jsr @r0
+m4
+dec @r0
+mov @r0, L2
+prn @r1
+L15: jsr L14
+clr @r5
+m2
+jsr L2
+prn L10
+rts
+not L13
+L16: lea L3, L13
+m4
+mov -110, @r3
+red L12
+clr L15
+bne L3
+prn @r5
+not @r6
+prn @r7
+mov -501, @r2
+lea L1, L2
+add @r7, @r7
+red @r0
+mov -349, @r2
+dec @r0
+add -472, L11
+bne L12
+rts
+not @r0
+jsr @r6
+red @r3
+jmp @r5
+jmp @r6
+clr @r6
+m4
+bne L15
+dec L13
+lea L6, L7
+L17: clr @r1
+cmp -417, L5
+cmp -90, @r1
+red @r4
+m4
+bne @r0
+lea L0, @r6
+dec L17
+m4
+clr L17
+add L17, @r6
+jmp L4
+prn 17
+dec X2
+jsr L16
+prn 42
+mov L0, @r7
+lea L10, @r4
+L18: clr @r6
+prn L7
+dec @r1
+bne L15
+L19: sub -258, L15
+add @r3, D0
+sub @r2, @r1
+L20: mov L16, @r0
+jsr @r2
+prn L20
+L21: not @r6
+m4
+rts
+m3
+L22: prn -8
+cmp -471, D0
+m3
+prn L11
+jsr L17
+m0
+jsr @r7
+clr L17
+mov -264, @r5
+inc L17
+sub -33, @r3
+L23: inc @r6
+sub @r0, @r1
+mov @r2, @r3
+jsr @r1
+L24: prn L4
+not L56
+cmp L21, @r1
+lea L8, L6
+L25: rts
+m4
+jsr L3
+lea S5, L19
+L26: rts
+prn @r4
+prn 356
+red @r0
+bne @r3
+L27: lea L5, @r1
+L28: bne @r6
+L29: not L6
+inc L21
+jsr @r7
+bne @r2
+jsr L8
+red @r6
+m3
+red @r6
+bne @r5
+L30: bne L6
+clr L6
+L31: clr @r4
+lea L18, @r7
+jmp L11
+not L25
+cmp L27, L56
+jmp L31
+lea L15, @r2
+add -402, L28
+lea L0, L12
+red @r5
+prn 147
+m0
+m4
+clr L22
+add 292, @r5
+mov @r2, @r2
+m1
+red S1
+red S5
+red L16
+sub -389, @r3
+jsr @r2
+bne @r0
+lea L5, @r6
+lea L17, @r1
+prn @r5
+m4
+not @r6
+bne @r5
+jmp L26
+mov L23, L16
+clr @r6
+lea S1, @r4
+sub L12, @r7
+clr L9
+L32: lea L11, @r6
+clr @r6
+sub 259, L30
+prn L18
+jsr @r5
+mov 456, L23
+inc L6
+rts
+not @r5
+dec L28
+mov @r5, @r4
+not L21
+bne @r1
+rts
+red @r0
+L33: dec L12
+prn L33
+L34: not @r2
+L35: mov L11, L29
+lea L31, L33
+cmp 460, 452
+jmp @r3
+rts
+jmp @r4
+bne @r4
+m0
+sub L21, @r4
+jsr L7
+add L18, @r5
+inc @r0
+L36: cmp @r4, @r4
+sub @r4, L16
+clr @r4
+rts
+mov @r1, L53
+add @r1, @r2
+m3
+m0
+jmp @r7
+red @r1
+m3
+jsr L34
+rts
+jmp @r2
+L37: jmp @r2
+m0
+red L4
+red @r4
+jsr @r5
+m1
+m0
+mov L22, @r7
+rts
+add L29, @r1
+m2
+bne L36
+clr @r1
+bne L28
+lea L0, @r0
+dec L20
+rts
+jsr L59
+inc @r6
+sub @r3, @r7
+not @r5
+lea D0, L36
+inc S0
+dec L10
+L38: add L32, L22
+mov L24, @r6
+sub 92, L38
+clr L1
+dec X3
+m4
+sub 491, L24
+L39: lea L17, L22
+rts
+cmp @r2, -252
+dec L15
+sub L5, @r4
+lea L21, @r5
+L40: mov -501, D0
+add S9, @r7
+not @r5
+bne @r7
+m0
+mov L45, @r3
+m4
+clr L0
+sub L14, L10
+red @r5
+sub @r6, L38
+dec @r3
+add -22, @r7
+cmp 446, -279
+L41: bne @r2
+inc L34
+clr L49
+lea L21, L45
+rts
+L42: bne @r6
+cmp L18, @r5
+L43: rts
+prn S7
+jsr L3
+m1
+lea L8, D0
+rts
+rts
+L44: dec L25
+L45: lea L48, @r5
+prn L47
+sub @r3, @r5
+add @r0, @r5
+dec @r2
+red L42
+not @r4
+L46: red L33
+prn @r5
+add @r7, @r6
+m4
+red L52
+L47: red @r1
+L48: not @r4
+jmp @r3
+not L13
+red L46
+clr L9
+m2
+dec @r2
+L49: add L25, L15
+m1
+jsr @r0
+lea L49, @r2
+add L18, L22
+L50: bne L47
+rts
+m3
+prn -402
+rts
+jsr L4
+dec L54
+jsr L15
+add L49, L28
+mov 179, @r3
+dec @r3
+add L35, L38
+mov L58, L29
+not L32
+jsr L41
+add @r0, L24
+cmp @r6, -219
+not L20
+red @r6
+add 388, L11
+dec @r5
+mov L13, L12
+L51: jmp L29
+L52: jsr L56
+inc L10
+inc @r5
+bne @r0
+prn -186
+mov L35, L46
+inc L36
+bne L56
+inc L3
+L53: jsr @r7
+not L53
+sub L40, L41
+mov @r4, @r6
+add 501, L55
+lea L41, @r2
+L54: clr L55
+prn @r5
+jmp L29
+L55: jsr X4
+jsr @r7
+dec L45
+sub L47, @r7
+jmp L31
+jsr @r6
+L56: prn -408
+m4
+add @r7, @r4
+L57: prn -472
+L58: cmp @r5, 502
+add L59, D0
+cmp 414, @r6
+jsr L59
+clr S3
+sub S6, L2
+prn D0
+L59: rts
+stop
+D0: .data -435,383,-20,249,487,-266,9,-497,-129,223
+D1: .data -458,-199,-151,55,-480,-476,85,16,443,455
+D2: .data 231,229,-36,-65,-64,-143,299,345,330,-373
+D3: .data -408,-183,-16,-53,492,118,-93,337,-18,310
+D4: .data -256,-251,303,-11,408,497,-59,157,252,-147
+D5: .data 114,-414,300,-257,361,389,-265,63,290,-230
+D6: .data 45,-436,252,209,-213,-191,203,-174,-12,358
+D7: .data -52,-182,128,0,-334,298,403,278,317,-263
+D8: .data 261,-222,38,65,413,-100,-55,299,-416,183
+D9: .data -266,-72,172,421,-212,-10,-402,464,357,-29
+S0: .string "nzlbhyihdy"
+S1: .string "zkwwxqlcocttjmuot"
+S2: .string "agdsnbrogqc"
+S3: .string "hlcz"
+S4: .string "wihsgrtnbctsnfzvb"
+S5: .string "aikepcmkfzpujhpqdnxb"
+S6: .string "wuqok"
+S7: .string "fi"
+S8: .string "brqqabwgmez"
+S9: .string "hxjbcysjtdpotfm"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r4
+    prn 46
+endmcro
+mcro m1
+    sub @r4, @r4
+    prn 42
+endmcro
+mcro m2
+    sub @r5, @r3
+    prn 49
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 67
+endmcro
+mcro m4
+    sub @r4, @r2
+    prn 14
+endmcro
+red L0
+cmp L0, 21
+jsr L2
+red @r1
+lea L0, @r5
+clr @r2
+clr @r4
+L0: lea L58, @r1
+not L0
+sub -195, L0
+red @r7
+L1: bne @r7
+lea L1, @r4
+m0
+red L1
+clr L0
+L2: not @r4
+not L0
+rts
+sub L2, L2
+inc L2
+clr L1
+jsr L1
+prn 380
+rts
+not L1
+L3: jmp L3
+L4: sub 98, @r0
+not @r3
+mov @r0, L3
+dec @r0
+bne @r1
+inc L4
+dec @r0
+jmp L4
+L5: inc @r4
+red @r0
+prn L3
+cmp -294, L47
+inc @r1
+red L3
+red @r5
+L6: prn 85
+L7: sub L40, @r2
+prn L1
+prn D0
+add @r4, @r6
+m2
+not @r5
+sub @r1, @r4
+add L1, L1
+inc @r2
+m4
+L8: prn L6
+m4
+jmp @r0
+L9: red @r5
+inc L6
+L10: rts
+add @r7, @r0
+cmp 243, -98
+jmp @r4
+clr L5
+mov L8, @r3
+L11: rts
+L12: rts
+cmp @r1, D0
+m4
+dec L0
+m3
+rts
+mov @r5, L3
+cmp @r2, L7
+inc L5
+cmp @r4, L11
+jmp @r1
+bne @r0
+lea L0, L6
+cmp L1, @r1
+inc @r5
+jmp @r6
+lea L11, L9
+cmp @r0, L9
+bne L4
+dec L4
+dec L10
+m3
+not @r1
+bne @r3
+lea L9, L1
+bne @r4
+L13: clr @r6
+add -359, @r7
+L14: bne L7
+add L4, L7
+cmp 169, S1
+prn -423
+L15: not L8
+m3
+rts
+jsr L12
+m1
+m3
+red @r7
+rts
+lea L12, @r5
+jsr L17
+L16: rts
+L17: sub @r4, @r6
+L18: dec @r6
+red @r4
+dec @r5
+m3
+sub @r1, D0
+prn L17
+bne @r5
+rts
+prn -187
+not @r1
+prn D0
+not @r4
+inc L1
+rts
+dec L0
+inc @r7
+mov @r1, @r2
+L19: bne L18
+inc L8
+rts
+m0
+bne @r1
+dec @r1
+inc @r2
+mov 315, @r4
+mov 381, @r7
+red L9
+add @r4, L11
+inc @r4
+add @r7, L7
+jsr L15
+lea L5, @r6
+clr L9
+lea L2, @r7
+bne @r7
+cmp L5, L30
+lea L55, @r6
+jsr S3
+not L11
+jsr @r3
+lea L19, L2
+lea L7, @r2
+mov -212, L7
+jsr L19
+L20: jmp S8
+L21: dec L12
+not @r0
+red @r3
+prn -339
+dec L26
+add L20, L1
+dec L10
+prn -425
+cmp @r5, 291
+inc L6
+not @r6
+jsr L16
+jmp @r0
+lea L5, L51
+red L16
+prn @r7
+clr @r2
+rts
+prn @r6
+sub L1, @r6
+jsr S1
+mov L10, @r4
+sub S7, @r2
+mov 73, @r4
+jmp @r6
+m4
+sub @r5, L10
+jmp L7
+L22: inc @r7
+rts
+jsr @r1
+rts
+jsr L11
+cmp L2, L0
+add -285, @r3
+L23: mov @r3, @r7
+lea S1, @r5
+mov L1, L18
+red L9
+not L19
+inc @r5
+jsr @r0
+inc @r0
+m4
+jmp @r1
+jsr @r3
+bne @r4
+red L41
+not X0
+add 356, @r4
+inc @r0
+m3
+jmp @r2
+add 187, L14
+dec L23
+jmp @r3
+add @r2, @r7
+bne @r4
+L24: mov 416, @r2
+jsr @r2
+dec @r0
+inc L2
+cmp L13, L4
+L25: prn L4
+inc L25
+jsr @r2
+mov S5, @r7
+clr L20
+red L8
+inc @r2
+jsr @r5
+sub 137, L0
+m1
+cmp L22, @r7
+jsr L18
+jsr L4
+bne L14
+not @r3
+not X1
+L26: red L0
+prn @r7
+m0
+rts
+dec @r5
+red @r3
+L27: rts
+cmp L3, @r5
+rts
+not L58
+L28: prn 425
+mov 133, @r6
+not L5
+m3
+cmp 445, -402
+m4
+cmp L41, @r6
+rts
+jmp @r1
+m0
+L29: sub L22, L19
+lea L21, L0
+jmp @r4
+lea L23, L12
+lea L4, @r1
+bne @r5
+bne L21
+L30: not L34
+m3
+rts
+add L30, L22
+dec @r4
+jsr @r6
+add @r6, @r4
+m0
+m0
+L31: rts
+add L22, @r6
+m2
+m2
+L32: prn @r5
+mov 298, @r6
+inc L22
+cmp @r3, -131
+inc L4
+cmp L1, @r7
+cmp L31, L14
+bne L28
+inc L2
+L33: lea L33, @r1
+rts
+lea L30, @r4
+L34: clr L20
+jmp @r4
+prn 217
+sub @r1, @r1
+mov -21, @r4
+cmp -273, L13
+bne L4
+L35: prn -16
+L36: not @r2
+rts
+dec @r6
+lea L9, @r1
+L37: inc @r6
+dec L47
+not @r3
+mov -125, @r5
+not @r1
+m0
+L38: clr @r2
+mov @r3, @r7
+clr L13
+m2
+sub 316, @r5
+lea L21, @r2
+bne L17
+prn -427
+mov 291, @r3
+jmp @r2
+dec L28
+jsr L57
+L39: mov 466, S1
+cmp @r5, @r4
+prn L57
+rts
+red L11
+red L48
+L40: red @r4
+jsr @r7
+bne @r7
+m3
+add L37, @r7
+lea L3, @r5
+rts
+bne @r3
+m2
+mov L24, L47
+lea L32, L11
+m2
+mov L24, L33
+red L4
+jsr @r3
+mov L12, L56
+lea L9, L31
+L41: add @r5, @r0
+sub @r7, @r5
+m0
+bne L2
+m2
+prn @r7
+L42: prn @r0
+sub 10, @r1
+red L5
+L43: sub @r5, @r3
+jmp @r3
+inc L13
+cmp @r7, L25
+m4
+L44: inc @r3
+not @r7
+clr @r1
+not L17
+L45: dec L36
+L46: not @r2
+jmp @r4
+cmp @r6, @r1
+red L46
+mov L25, L32
+red @r3
+add @r7, L13
+sub @r6, @r0
+clr @r6
+jsr @r7
+inc X2
+red L5
+L47: jmp @r0
+L48: cmp 390, -290
+m2
+L49: clr @r1
+add -77, L7
+jmp L39
+rts
+L50: sub @r2, L47
+add -450, L24
+red L22
+mov L4, @r0
+add -420, @r3
+rts
+clr @r3
+dec L36
+L51: rts
+lea L38, @r6
+clr @r1
+m4
+cmp L8, -236
+not @r1
+add -308, L57
+not X3
+bne L28
+L52: mov @r7, L6
+m3
+add @r5, @r6
+sub @r0, @r0
+lea L16, @r4
+sub @r1, L6
+sub 123, @r2
+jmp D0
+sub @r3, L45
+jsr @r5
+sub L41, L9
+dec X4
+rts
+m2
+L53: add -460, L18
+L54: bne @r4
+red @r6
+sub 386, @r1
+jmp L8
+sub 509, @r3
+bne S3
+add -159, L12
+jsr @r2
+rts
+L55: inc @r7
+bne @r7
+bne D0
+L56: cmp 462, 10
+m2
+jsr L48
+m3
+red D0
+lea L49, L18
+inc @r6
+jsr L3
+add -88, L50
+mov 424, L1
+sub -97, L54
+L57: sub @r5, @r4
+inc @r5
+sub L43, @r0
+add @r3, @r4
+rts
+L58: lea L59, @r5
+L59: prn D0
+dec D0
+m0
+stop
+D0: .data -44,229,309,113,60,449,243,-450,391,279
+D1: .data 354,392,324,-38,-94,-84,170,80,-148,-152
+D2: .data -51,-64,-264,-468,-336,-303,-414,162,54,-102
+D3: .data 463,-286,415,388,125,361,238,500,414,233
+D4: .data -188,188,-270,-95,272,357,-109,-411,417,-458
+D5: .data -412,84,461,-91,-425,-442,393,235,6,-291
+D6: .data -259,400,-283,5,176,453,449,118,325,282
+D7: .data -232,44,194,182,291,98,-178,-307,-494,351
+D8: .data 349,293,-120,293,-178,209,163,-340,84,-103
+D9: .data 161,358,176,-74,-170,163,-112,-161,-180,-26
+S0: .string "fwqojthvcsahlojj"
+S1: .string "smibibxrnen"
+S2: .string "jymoohgfawesrbai"
+S3: .string "hbfmsdgvpyhfx"
+S4: .string "hukppsqmjlwkfjsua"
+S5: .string "ujkfyat"
+S6: .string "u"
+S7: .string "jdoajpiuqiyae"
+S8: .string "chhydmyeggx"
+S9: .string "nrlgwmrlpvvw"
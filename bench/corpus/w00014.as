@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r6
+    prn 16
+endmcro
+mcro m1
+    sub @r1, @r6
+    prn 40
+endmcro
+mcro m2
+    sub @r7, @r1
+    prn 15
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 43
+endmcro
+mcro m4
+    sub @r7, @r0
+    prn 39
+endmcro
+cmp L0, S1
+not L0
+m4
+sub @r1, @r5
+jmp L0
+jsr @r4
+lea L0, @r3
+add -355, L0
+dec @r6
+jmp @r3
+inc L0
+lea L0, L0
+rts
+lea L47, @r0
+mov -160, @r3
+m1
+L0: prn @r3
+dec L0
+cmp @r3, @r2
+m4
+cmp @r6, @r5
+jmp @r2
+prn @r2
+clr L0
+rts
+not L0
+jsr @r4
+L1: jsr @r1
+m1
+red L0
+cmp @r1, 206
+jsr L0
+rts
+jmp @r0
+lea L0, @r3
+mov L0, L48
+m3
+sub 489, L1
+inc @r0
+add L1, @r4
+m3
+red L1
+not @r2
+L2: mov X0, L0
+bne L13
+prn 26
+lea L2, L2
+bne L0
+m0
+red L0
+m0
+L3: not L2
+red @r7
+jmp @r6
+inc L3
+clr @r0
+m3
+inc @r0
+sub @r4, @r0
+cmp @r1, @r4
+L4: rts
+mov L20, @r5
+jmp @r0
+prn 352
+cmp L0, L4
+cmp @r1, L0
+dec @r5
+dec L1
+lea L3, @r1
+cmp L0, L3
+jmp @r2
+red @r1
+rts
+add @r1, @r0
+not L1
+m0
+not @r2
+clr L4
+bne L2
+dec @r2
+L5: not @r3
+prn @r7
+cmp 478, @r4
+L6: jmp L5
+jsr L1
+dec @r6
+L7: inc @r0
+bne L1
+not @r3
+m1
+bne L6
+L8: jmp L2
+bne L5
+bne L7
+bne @r4
+rts
+cmp 331, @r3
+m4
+clr @r4
+red L8
+add L3, @r6
+lea L7, L5
+L9: rts
+L10: jsr @r5
+mov 486, @r1
+mov L6, @r6
+cmp L24, -40
+L11: sub L4, L1
+jsr @r0
+jmp @r5
+inc @r7
+sub @r2, L8
+dec L3
+add -76, @r0
+L12: clr @r4
+add @r3, @r0
+L13: add L13, L3
+add -367, @r4
+jsr L1
+jmp L13
+jsr L0
+inc @r2
+rts
+m2
+m1
+red @r4
+jsr L1
+jsr L12
+sub L11, D0
+inc @r6
+jmp @r7
+jsr @r1
+mov @r1, @r7
+mov @r3, L8
+jmp L4
+L14: clr L13
+inc @r5
+cmp @r1, 476
+add @r3, @r7
+L15: jmp @r2
+clr L4
+red @r2
+dec L7
+m0
+m4
+dec @r5
+jsr @r1
+m3
+m0
+jsr L39
+clr L13
+add L1, @r2
+red @r6
+add -88, @r0
+jmp @r0
+clr @r0
+L16: sub @r1, L4
+rts
+sub L13, L6
+red S3
+clr @r0
+sub @r1, L3
+jsr L0
+inc @r5
+prn @r2
+sub -329, @r5
+L17: sub @r1, L5
+red L12
+dec L14
+cmp L12, L6
+m2
+L18: bne L9
+jmp L38
+red @r2
+rts
+prn L17
+jmp @r5
+add @r4, @r2
+L19: jmp @r1
+prn @r2
+L20: dec @r2
+lea L16, @r5
+L21: dec L7
+cmp @r1, 229
+m0
+lea L2, L50
+mov @r6, L2
+m0
+inc L15
+rts
+lea L10, S5
+L22: add L12, @r0
+cmp 2, L19
+sub -189, S4
+inc @r5
+L23: lea L18, @r5
+bne @r0
+prn -67
+L24: mov @r2, @r3
+L25: not L6
+red L10
+red @r1
+m1
+L26: add L2, L26
+L27: jsr @r2
+L28: lea L22, L5
+inc @r3
+jmp @r1
+cmp @r3, @r4
+mov S0, S7
+dec L11
+lea L2, L6
+sub -136, @r1
+red L24
+sub L4, @r6
+not @r2
+L29: red L0
+clr L54
+dec @r5
+bne L22
+clr @r1
+m1
+L30: clr @r2
+red L19
+dec L26
+m3
+L31: bne L6
+mov L30, @r4
+prn -182
+add L8, L24
+dec @r0
+L32: red @r5
+clr @r2
+add 164, L23
+add -10, @r5
+red D0
+bne L11
+rts
+jsr @r3
+L33: clr L25
+L34: add @r7, @r3
+lea L12, @r6
+L35: red @r1
+clr @r1
+jsr @r6
+lea L8, @r2
+m2
+inc @r5
+clr @r3
+jmp @r7
+L36: dec @r2
+add @r4, @r3
+prn L16
+L37: jmp L36
+L38: dec L17
+prn @r2
+L39: bne @r4
+L40: sub -98, @r5
+jmp @r5
+cmp @r0, -275
+clr @r6
+jmp S6
+L41: rts
+lea L29, L14
+red L20
+bne @r5
+not @r5
+mov S7, @r4
+add -280, @r1
+bne @r7
+sub -23, L15
+lea L24, @r0
+lea L19, L41
+bne L23
+jsr @r6
+bne @r0
+not L0
+prn L31
+mov -38, @r1
+m0
+dec @r5
+jsr @r0
+inc L6
+inc L28
+add @r4, @r7
+prn -12
+m1
+sub 390, L7
+add @r1, L29
+not @r0
+not L31
+jmp @r5
+m1
+L42: lea L2, L9
+cmp 499, -299
+prn -161
+bne @r3
+red @r1
+not L19
+m4
+clr @r6
+mov 217, @r5
+prn 100
+prn -392
+jsr @r6
+L43: not L45
+dec @r4
+L44: inc @r4
+not D0
+mov @r5, L37
+mov L19, @r7
+not @r6
+rts
+m1
+red L29
+cmp -258, -51
+mov -123, @r6
+m2
+inc L21
+add L23, L16
+lea L23, L35
+jsr @r6
+m0
+lea L20, @r4
+m0
+bne @r1
+lea L37, @r2
+red @r6
+m4
+jsr @r7
+L45: clr L44
+add @r4, L28
+clr L14
+lea L0, L14
+lea L39, @r1
+dec S2
+jmp @r6
+cmp @r3, S8
+L46: jmp @r7
+dec L59
+red @r1
+inc @r1
+L47: jmp L16
+prn @r5
+L48: rts
+cmp L3, @r7
+lea L2, L38
+clr L53
+bne @r1
+jsr @r3
+m4
+clr @r4
+dec @r1
+L49: red L39
+L50: add @r4, L38
+mov L49, @r5
+L51: bne @r4
+L52: red L11
+red @r1
+red L31
+inc L30
+jsr L54
+prn @r5
+jsr @r5
+L53: not L25
+sub @r6, @r2
+clr L39
+m3
+m0
+L54: jmp @r3
+sub @r0, @r7
+lea L19, @r6
+jsr @r7
+jmp @r7
+mov L1, @r0
+dec L53
+add -215, @r7
+L55: lea L57, L28
+jmp @r7
+jsr L23
+red @r6
+bne @r0
+cmp @r3, @r3
+not @r2
+lea L28, S0
+not L55
+rts
+red @r2
+add L0, L18
+prn @r0
+rts
+dec L56
+jsr L16
+add 501, @r4
+dec L49
+jmp @r3
+rts
+not L10
+jmp @r5
+sub @r6, L6
+sub L5, @r4
+jmp L41
+clr @r1
+prn D0
+inc @r4
+L56: jsr @r3
+not L48
+not L49
+not @r3
+add -446, L9
+dec L52
+add -411, D0
+jmp @r3
+L57: sub L29, L58
+m4
+not @r0
+dec L49
+jmp @r0
+m3
+L58: jsr L8
+prn L28
+L59: jsr @r1
+jmp @r0
+add D0, @r2
+bne @r4
+jmp @r2
+not L39
+m0
+prn -365
+lea S7, D0
+inc L14
+dec S6
+red S8
+not X1
+add X2, @r1
+add S9, S2
+bne S1
+jmp X3
+mov @r6, @r5
+cmp X4, L30
+stop
+D0: .data -191,-177,-246,-84,-223,-110,186,282,-87,60
+D1: .data 284,-471,-58,263,45,-447,-433,315,-63,-215
+D2: .data 108,272,303,179,-388,-314,151,256,411,49
+D3: .data 439,311,61,-174,-6,404,-499,-96,-466,434
+D4: .data -103,255,-58,-73,-4,-188,238,-441,355,5
+D5: .data 338,-167,114,386,-424,-109,472,141,-221,-394
+D6: .data -57,175,-260,247,-225,96,-334,359,165,-130
+D7: .data -497,-403,66,-463,11,-305,-138,473,293,46
+D8: .data 448,-416,453,337,273,115,-366,179,-281,-166
+D9: .data 361,-7,473,-340,-169,328,-159,-425,68,-41
+S0: .string "tmrlwstpvvsqiphlan"
+S1: .string "v"
+S2: .string "knstzaklcftbu"
+S3: .string "tk"
+S4: .string "n"
+S5: .string "bxedesctbbkmjn"
+S6: .string "xhgzeuziz"
+S7: .string "h"
+S8: .string "fz"
+S9: .string "yfqrbyhkxdbsaq"
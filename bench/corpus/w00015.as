@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r1
+    prn 54
+endmcro
+mcro m1
+    sub @r5, @r7
+    prn 39
+endmcro
+mcro m2
+    sub @r1, @r7
+    prn 80
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 20
+endmcro
+mcro m4
+    sub @r1, @r7
+    prn 63
+endmcro
+inc @r0
+red @r1
+not @r5
+sub @r5, @r7
+clr L0
+add @r3, L0
+red L0
+red @r3
+red @r1
+m1
+red L28
+L0: sub @r6, L0
+lea L0, L0
+mov -403, @r2
+jmp @r0
+inc @r2
+dec L0
+m3
+jsr L0
+clr @r6
+L1: prn L1
+cmp L1, @r7
+not @r0
+lea L54, L0
+bne L0
+L2: clr @r6
+clr L1
+jmp L2
+red @r4
+m2
+m1
+L3: mov @r0, @r2
+m1
+m2
+L4: cmp 32, L0
+not L4
+dec @r0
+jmp L1
+add L1, @r5
+mov 422, @r4
+L5: mov @r6, L5
+not @r3
+jmp D0
+not L5
+L6: inc @r5
+mov -435, L1
+jmp @r1
+jmp @r7
+bne @r1
+m2
+jmp L6
+m0
+L7: sub L0, @r1
+inc @r2
+L8: add 455, @r5
+prn -43
+sub 475, S0
+red L5
+L9: rts
+rts
+jsr @r3
+L10: jmp L5
+add @r5, @r0
+red @r0
+add L1, @r4
+rts
+cmp L2, 476
+add @r2, L5
+m2
+sub -345, L0
+L11: red @r5
+m1
+sub L8, @r5
+sub @r1, @r1
+rts
+add -155, @r2
+L12: jmp @r0
+m1
+jmp @r3
+bne L2
+m4
+L13: dec L12
+red @r6
+mov @r2, @r0
+jsr @r2
+inc @r3
+L14: mov 301, @r6
+mov L5, @r5
+bne L8
+mov 338, L12
+m2
+dec L8
+jmp @r6
+rts
+bne @r1
+lea L13, L7
+m2
+L15: inc L9
+sub L1, @r1
+red @r6
+clr @r4
+inc L8
+lea L11, @r4
+cmp 44, L1
+clr @r4
+lea L5, @r2
+jmp L0
+sub 11, D0
+m3
+L16: mov @r7, @r2
+add @r0, @r7
+m1
+jsr @r6
+jmp L8
+mov 156, D0
+sub -198, @r3
+dec @r2
+L17: jmp L7
+cmp L4, X0
+jmp @r6
+clr L11
+inc L6
+jsr L10
+bne @r7
+inc @r0
+m0
+mov L15, L12
+cmp @r3, -40
+prn 188
+clr @r3
+L18: cmp L13, @r1
+dec @r5
+inc @r0
+bne @r1
+L19: lea L58, @r5
+dec @r5
+prn @r2
+L20: rts
+m3
+m3
+jsr @r2
+cmp L11, L9
+lea L9, @r1
+red L17
+L21: cmp @r3, @r0
+bne L10
+rts
+add S7, @r5
+m1
+cmp -395, -147
+red @r1
+L22: mov @r2, L16
+rts
+bne L17
+dec L8
+rts
+jsr L21
+add -29, L12
+m1
+jmp @r1
+dec @r2
+sub 446, @r3
+bne @r5
+add L50, L12
+dec @r5
+not L15
+jmp @r7
+L23: add -381, @r2
+prn 59
+L24: clr L55
+jmp @r0
+m4
+not @r0
+not L17
+bne @r7
+cmp -279, 74
+jsr L23
+not L11
+inc L20
+L25: prn @r4
+L26: add L13, @r4
+bne L0
+L27: bne L7
+prn L27
+cmp -243, @r3
+cmp @r0, @r3
+L28: bne @r1
+jsr L17
+cmp L13, 462
+prn 97
+clr L3
+add @r1, @r5
+jmp L5
+inc L15
+cmp -349, L7
+L29: red L9
+sub L1, L5
+prn @r1
+m3
+rts
+dec @r6
+L30: jmp @r7
+dec @r7
+lea D0, L22
+lea L4, @r6
+inc L18
+m2
+prn S2
+clr L32
+not L20
+L31: clr L30
+jsr @r1
+clr @r2
+inc L58
+not L26
+sub 475, L6
+inc L17
+dec @r4
+mov @r0, L4
+L32: not L32
+inc @r0
+red L11
+not L52
+dec @r6
+lea L23, L8
+red @r1
+clr D0
+prn @r7
+dec L19
+mov 190, L19
+add 100, @r2
+not @r7
+bne @r1
+not L2
+dec @r3
+m1
+inc L8
+add 397, @r0
+jsr L10
+mov L16, L28
+dec L5
+not L28
+red L22
+rts
+rts
+rts
+dec @r5
+dec @r0
+lea L3, @r0
+m4
+prn L10
+L33: bne @r1
+bne S1
+L34: jsr L33
+jsr @r0
+jmp @r7
+sub -401, @r2
+sub 374, L10
+rts
+L35: prn -13
+rts
+jsr L15
+L36: inc @r7
+clr L42
+m4
+bne L13
+cmp L8, @r7
+prn -227
+inc @r6
+bne S8
+m3
+bne @r4
+L37: prn 73
+jsr @r6
+cmp 136, -49
+red L20
+L38: bne L30
+not @r2
+add @r0, @r1
+prn @r6
+L39: red @r6
+L40: red @r6
+red @r5
+jsr D0
+lea L24, X1
+jsr L33
+dec L20
+lea L6, L9
+L41: jsr L16
+lea L8, @r4
+inc L0
+red @r6
+m0
+lea L12, L38
+inc L54
+mov D0, @r0
+jmp @r0
+prn @r1
+dec @r0
+L42: prn -139
+inc @r6
+prn L5
+cmp -233, L1
+bne L9
+prn -112
+m4
+not L5
+add -99, @r4
+prn @r3
+lea L7, L15
+not L52
+lea L10, L32
+m0
+inc L41
+bne L20
+prn -393
+inc L9
+jmp @r7
+prn @r2
+jmp L15
+jsr L0
+rts
+sub @r4, L22
+L43: cmp L18, L42
+bne @r7
+L44: jmp @r1
+bne L32
+cmp @r2, L47
+not @r0
+mov 9, L12
+m0
+clr @r3
+mov @r6, S8
+clr @r6
+dec @r2
+L45: not @r6
+red L9
+L46: lea L25, @r6
+red @r0
+dec @r4
+prn L58
+mov L46, @r0
+jmp L57
+rts
+mov @r6, L24
+L47: prn L9
+prn @r3
+lea L46, @r7
+L48: mov 238, L7
+red L35
+red L8
+add -449, @r4
+m1
+rts
+bne @r3
+cmp @r3, @r4
+L49: not L23
+L50: rts
+not @r2
+red @r7
+mov -289, @r6
+jmp @r7
+sub @r3, L36
+add @r0, @r7
+jsr X2
+prn L49
+m3
+inc @r0
+inc @r3
+sub L3, @r3
+cmp L16, L30
+bne @r2
+L51: prn L45
+lea L12, @r0
+clr @r7
+cmp D0, @r0
+sub L1, @r1
+cmp L9, L49
+prn -35
+jmp @r0
+L52: mov @r7, L7
+prn L3
+dec L20
+dec @r1
+mov D0, L28
+L53: dec @r0
+rts
+add S2, @r2
+L54: jmp L35
+mov @r4, L42
+prn L5
+inc L23
+clr @r4
+add @r2, S0
+clr @r5
+mov @r2, L58
+lea X3, D0
+clr L56
+dec L45
+add @r0, X4
+m2
+add 21, L14
+bne @r7
+prn L11
+rts
+bne L35
+bne @r7
+L55: prn -120
+bne @r2
+m0
+clr L3
+inc @r5
+m1
+red L36
+clr L4
+mov L5, @r2
+lea L25, @r4
+bne @r1
+m2
+inc L23
+rts
+bne @r2
+lea L4, @r6
+L56: prn @r0
+sub L5, @r5
+L57: jmp L58
+m4
+cmp @r3, @r4
+prn -376
+L58: add @r4, L51
+not @r5
+rts
+m1
+clr L21
+bne L59
+mov @r7, L53
+jsr L59
+clr S3
+lea S7, L48
+L59: sub S6, L14
+stop
+D0: .data -6,-452,-472,-209,-447,-397,-489,-67,47,380
+D1: .data -417,-166,178,-485,-205,133,-499,145,229,-22
+D2: .data -296,-245,98,-305,-345,-315,489,105,374,-186
+D3: .data 234,200,-176,458,-341,203,-426,-315,-387,183
+D4: .data 96,102,382,11,-194,401,262,-281,205,-239
+D5: .data -446,-316,258,125,-362,-312,-309,-127,368,459
+D6: .data 167,243,146,-359,-260,-172,-168,186,-109,0
+D7: .data 145,-379,-54,-352,364,31,-173,-55,-301,-152
+D8: .data -237,135,389,-448,-179,380,-70,-327,447,-117
+D9: .data 11,272,-99,89,49,-37,486,466,-413,-277
+S0: .string "m"
+S1: .string "gpestvuksdhfrf"
+S2: .string "hjqdpyvyldjkzszi"
+S3: .string "wcmgnfnuyxp"
+S4: .string "irwqu"
+S5: .string "xvaxiyynjdrbjd"
+S6: .string "ggra"
+S7: .string "mzjqpmwsuohcr"
+S8: .string "yuoeuqvalrd"
+S9: .string "uwbmenjcigsq"
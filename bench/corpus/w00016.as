@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r4
+    prn 25
+endmcro
+mcro m1
+    sub @r1, @r0
+    prn 37
+endmcro
+mcro m2
+    sub @r3, @r4
+    prn 77
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 96
+endmcro
+mcro m4
+    sub @r3, @r5
+    prn 87
+endmcro
+L0: jsr L0
+m0
+sub @r6, @r3
+bne L0
+L1: jmp L14
+bne L0
+red L1
+L2: sub @r6, @r5
+mov @r5, S0
+lea L1, L1
+jsr L0
+m3
+dec L1
+dec L1
+L3: prn 269
+prn L0
+clr @r2
+jsr L3
+L4: sub L2, L2
+dec @r3
+jsr L1
+rts
+red @r0
+m3
+m0
+clr L4
+inc @r0
+add L4, L1
+not @r1
+sub 496, @r2
+red L44
+sub @r7, @r0
+inc @r5
+clr L2
+clr @r1
+jmp L2
+m3
+clr L0
+clr L3
+not @r2
+L5: not L4
+bne @r3
+prn @r3
+bne L0
+sub @r7, X0
+m0
+add @r2, S5
+bne L1
+rts
+L6: add @r2, L1
+bne @r1
+not @r2
+add L0, @r7
+not @r0
+dec L6
+m1
+jsr @r7
+jsr @r5
+jsr @r1
+add -86, @r2
+m0
+m3
+clr L0
+jmp L5
+bne L1
+red @r0
+m2
+jmp @r3
+add 427, L3
+add @r5, L6
+red @r0
+jmp L3
+prn L5
+jsr @r2
+add @r2, @r3
+L7: rts
+red L2
+lea L1, @r0
+bne L2
+m1
+cmp L5, L3
+jsr @r3
+dec L7
+red L7
+lea L4, @r5
+inc L1
+bne @r7
+L8: jsr @r2
+lea L7, @r5
+clr L4
+add L1, D0
+jmp L6
+L9: inc L6
+L10: bne L1
+m4
+add @r5, L4
+red @r5
+bne L3
+L11: inc @r3
+add L11, @r2
+L12: prn @r6
+cmp @r4, -468
+bne @r3
+m3
+jsr @r6
+sub @r5, @r6
+m2
+prn @r5
+clr @r1
+rts
+lea D0, L4
+dec @r5
+prn @r7
+L13: cmp L11, @r0
+clr L8
+m4
+add @r6, L8
+red S9
+mov L7, @r4
+L14: jmp @r4
+red @r1
+clr L9
+add L5, @r3
+inc @r6
+L15: not L7
+sub @r7, L2
+bne @r2
+cmp @r7, L13
+rts
+not L5
+dec @r6
+L16: lea L15, @r0
+not @r3
+lea L14, L8
+prn L2
+prn @r3
+mov -51, L7
+m3
+add -87, L25
+inc @r1
+jsr L12
+lea L0, @r7
+jmp @r5
+L17: clr L9
+jmp @r5
+prn @r5
+m3
+bne L4
+sub 88, L17
+m3
+clr @r0
+clr L8
+jsr L12
+clr @r1
+bne @r1
+rts
+lea L6, @r5
+clr L15
+dec L30
+clr @r1
+inc @r3
+mov @r6, @r1
+jsr @r6
+lea L16, D0
+not L17
+L18: jmp @r6
+bne @r2
+jsr @r0
+inc @r4
+cmp @r2, 491
+add 326, L2
+m2
+m3
+not S9
+not L14
+jmp @r3
+L19: jmp L8
+red L5
+sub @r2, L5
+prn @r0
+L20: jsr S7
+lea L10, @r3
+m4
+cmp @r3, @r0
+jmp L4
+lea L12, @r0
+prn -283
+add @r1, L4
+mov L12, @r2
+red @r2
+rts
+add L1, @r7
+rts
+jsr L3
+jmp @r1
+add S2, @r3
+dec X1
+dec L0
+L21: jsr L17
+clr @r3
+mov @r0, L20
+lea L17, @r3
+L22: sub L1, L13
+inc @r0
+L23: rts
+m4
+not L2
+red L14
+L24: not @r4
+dec @r7
+bne @r7
+bne @r7
+lea L2, @r2
+inc L2
+dec L27
+add L14, @r4
+bne L2
+jmp L15
+sub L24, @r3
+cmp -427, L8
+inc @r4
+L25: jmp L3
+lea L5, L9
+cmp -363, @r4
+rts
+add 87, L7
+sub L6, L4
+L26: inc @r2
+not L15
+red @r2
+rts
+red @r7
+cmp @r2, L0
+inc L25
+red @r2
+bne @r6
+rts
+prn L11
+m1
+jsr L3
+red L1
+m3
+red L7
+jsr @r1
+sub 120, L21
+sub 509, L21
+sub @r5, L23
+jmp @r7
+red @r2
+add @r0, @r5
+not L0
+dec L11
+L27: jsr @r7
+prn 268
+dec L44
+L28: add @r0, L22
+add @r4, X2
+inc L48
+clr S0
+inc L22
+inc @r0
+L29: red @r1
+lea L1, L19
+bne @r5
+dec @r3
+m4
+rts
+add D0, @r3
+m2
+L30: dec L20
+not @r5
+L31: not @r5
+prn -44
+lea L5, @r2
+L32: not @r6
+red @r5
+sub @r1, L45
+prn L18
+dec L19
+m1
+L33: bne @r3
+mov L7, L24
+clr L26
+jsr @r6
+L34: jmp L27
+bne L41
+L35: dec L5
+clr @r1
+red L1
+m2
+L36: jmp L16
+add @r7, @r6
+rts
+red L2
+m3
+prn -417
+cmp -440, @r0
+inc L28
+rts
+jmp L27
+not L49
+not @r4
+dec @r3
+jmp @r2
+m2
+mov L35, L5
+L37: jsr @r5
+cmp @r2, L20
+L38: red @r7
+jmp @r1
+prn @r3
+not L9
+clr L11
+red D0
+L39: dec L44
+red @r2
+dec L24
+L40: jsr @r3
+inc L28
+cmp -213, L9
+mov @r0, L2
+dec L1
+sub -372, L10
+add @r0, @r1
+bne L37
+m1
+L41: add L34, @r5
+red D0
+prn L14
+jmp L17
+cmp L23, @r3
+sub L33, L12
+jmp L38
+red L34
+bne @r0
+dec L15
+jmp @r7
+L42: jmp @r3
+add L20, L15
+dec L40
+bne @r7
+bne @r4
+L43: clr L27
+red @r4
+inc L4
+prn 233
+red @r2
+L44: jsr @r5
+add L15, L4
+red L31
+sub 353, @r2
+inc @r6
+rts
+rts
+L45: sub @r6, @r7
+lea L4, L41
+L46: jsr @r1
+dec L37
+dec L41
+m3
+prn @r2
+dec @r6
+m1
+prn @r7
+jsr @r2
+bne @r6
+m2
+red L46
+rts
+sub L15, L12
+lea L41, @r4
+bne @r4
+m2
+m4
+bne @r7
+lea S9, @r3
+inc L4
+clr L27
+prn 456
+red @r2
+L47: clr @r5
+rts
+clr @r1
+jsr L9
+mov 205, @r0
+L48: clr @r2
+L49: cmp @r0, 237
+add @r2, @r4
+L50: inc L20
+rts
+add 346, S7
+jmp L57
+jsr @r2
+dec @r5
+jsr @r2
+red L31
+L51: sub -59, @r3
+L52: jmp @r5
+L53: jmp @r7
+m0
+cmp 224, @r0
+L54: jmp @r1
+L55: bne @r1
+jmp L57
+rts
+cmp @r1, 502
+clr D0
+m4
+red @r1
+L56: jsr @r3
+jmp L8
+jsr L39
+inc L45
+dec @r7
+prn -27
+cmp 141, @r3
+dec L54
+add @r3, L38
+L57: rts
+jmp L59
+dec L58
+rts
+prn 446
+inc X3
+m2
+bne @r3
+not @r5
+rts
+clr @r7
+L58: add 61, @r7
+clr D0
+clr S5
+prn L59
+L59: rts
+inc D0
+bne X4
+m4
+mov D0, S8
+bne D0
+sub D0, D0
+stop
+D0: .data -282,-205,91,-258,-404,304,-452,260,248,-93
+D1: .data -137,97,-150,-491,197,150,78,-139,-344,239
+D2: .data -124,460,346,248,-241,352,25,-19,-290,173
+D3: .data 479,255,-392,71,-234,-351,4,223,-263,155
+D4: .data -359,207,-275,89,384,9,-72,364,-477,-140
+D5: .data 373,-207,87,210,-396,258,-421,154,-34,-10
+D6: .data 463,393,36,130,33,-64,140,-207,362,171
+D7: .data -36,18,365,179,416,163,-10,-458,-145,-472
+D8: .data 41,-446,-122,348,107,-261,411,-110,277,117
+D9: .data -94,-140,109,389,-300,-339,-476,-356,459,-464
+S0: .string "onkavtsqgx"
+S1: .string "xhj"
+S2: .string "medulkcqtj"
+S3: .string "hrrefpledhn"
+S4: .string "eatjkaxrvwlboywcy"
+S5: .string "lhlrnvvdqbr"
+S6: .string "jqgwjcdrhvi"
+S7: .string "nbbwuc"
+S8: .string "vy"
+S9: .string "ektbbvx"
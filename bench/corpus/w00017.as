@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r6
+    prn 95
+endmcro
+mcro m1
+    sub @r6, @r1
+    prn 36
+endmcro
+mcro m2
+    sub @r5, @r2
+    prn 42
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 73
+endmcro
+mcro m4
+    sub @r5, @r3
+    prn 12
+endmcro
+red @r2
+add @r6, @r1
+red @r7
+rts
+sub -198, @r2
+L0: jmp @r0
+cmp @r5, L0
+L1: sub @r4, @r5
+clr @r2
+L2: add @r1, L0
+sub L2, @r7
+m3
+m3
+inc L1
+mov @r1, @r6
+L3: prn L1
+inc X0
+bne @r0
+L4: rts
+jsr L2
+L5: clr @r0
+bne @r1
+L6: rts
+prn L1
+prn -280
+lea L1, L4
+jsr @r2
+sub L6, L5
+bne @r0
+red @r6
+not L2
+red S9
+rts
+m1
+not L0
+add -208, @r3
+m3
+L7: sub @r2, L1
+bne L7
+jsr L0
+lea L4, @r3
+m3
+m2
+prn @r5
+bne @r6
+red D0
+m3
+jsr @r1
+prn L3
+rts
+jsr @r0
+sub L7, L7
+red L6
+cmp @r4, L6
+inc @r3
+add 446, L0
+rts
+m2
+rts
+m1
+dec @r5
+m2
+L8: add 380, @r1
+clr @r5
+prn L3
+L9: sub L1, @r5
+lea D0, @r6
+inc @r6
+sub L18, L2
+L10: dec L8
+m4
+lea L5, S6
+jsr L0
+rts
+bne S1
+jsr @r5
+jmp L2
+inc @r3
+not @r2
+sub 235, @r7
+L11: red @r5
+L12: bne @r2
+jsr @r3
+clr L11
+mov -163, L4
+red @r6
+jsr L11
+clr L10
+inc @r7
+L13: sub L11, L4
+dec S9
+m2
+mov @r5, @r0
+add L3, L11
+m2
+L14: bne L12
+prn @r1
+red @r3
+jmp @r4
+inc L14
+L15: red L15
+lea L4, L4
+bne X1
+m4
+jsr @r2
+dec @r6
+red L5
+rts
+not @r2
+clr @r0
+clr L15
+m3
+jmp L3
+dec L3
+L16: red L9
+bne @r7
+bne L7
+cmp @r6, @r2
+L17: dec L5
+m2
+mov @r3, L4
+mov L16, L12
+jsr @r3
+clr @r7
+jmp @r4
+bne L13
+L18: mov -483, @r6
+L19: mov @r5, @r3
+sub L7, @r5
+add L4, @r2
+L20: lea L0, @r3
+mov -233, @r6
+cmp @r1, @r2
+prn L3
+cmp @r2, -59
+mov L2, L9
+cmp @r1, L34
+L21: inc L2
+L22: jmp L13
+add L1, @r1
+rts
+add -242, @r0
+jsr L7
+L23: clr L23
+cmp @r2, @r7
+rts
+bne L21
+jmp @r1
+m2
+L24: add 458, @r4
+inc @r7
+mov -245, @r5
+inc L14
+sub @r6, L16
+prn @r7
+inc @r4
+sub @r0, S8
+bne L22
+jmp D0
+bne @r6
+L25: clr L20
+m1
+sub -370, L6
+jsr @r4
+rts
+bne S1
+bne @r4
+not @r0
+lea L24, @r5
+add @r0, L3
+cmp L47, L11
+red L8
+prn L18
+lea L18, L11
+jsr L6
+lea L7, L3
+bne @r1
+m1
+bne @r2
+dec S2
+add 208, L15
+not L4
+mov 16, @r2
+m1
+m2
+add L15, L4
+add @r6, L12
+bne @r0
+cmp -493, @r4
+L26: sub -459, @r5
+lea L14, L7
+cmp 159, @r6
+bne @r2
+L27: add @r0, @r1
+bne L22
+jmp L25
+red L26
+add @r5, L3
+dec @r5
+sub L52, L5
+m0
+prn L50
+sub L27, X2
+lea L8, @r0
+m2
+bne L41
+red @r6
+sub L5, @r4
+inc @r0
+L28: red L4
+L29: dec @r7
+cmp @r0, -378
+L30: inc @r7
+L31: cmp 382, -165
+mov -77, @r5
+clr D0
+L32: cmp L9, @r7
+L33: sub @r3, L5
+rts
+jsr L30
+L34: cmp 34, -237
+L35: jmp @r4
+dec L6
+mov L12, L9
+cmp L3, -111
+L36: dec L17
+m1
+sub @r7, L29
+L37: not L11
+sub @r5, @r1
+jsr L18
+add @r5, L10
+jmp @r0
+sub -490, @r0
+mov -375, L23
+bne L1
+L38: red @r3
+dec @r2
+rts
+clr D0
+prn 138
+rts
+L39: clr @r0
+prn L21
+red L18
+dec @r0
+not @r6
+bne L23
+m3
+cmp 374, @r6
+prn S4
+L40: not L6
+mov L14, @r2
+prn @r6
+cmp @r0, L22
+jsr L30
+red L26
+m2
+jsr @r2
+lea L7, @r7
+add @r1, L9
+lea L5, @r5
+dec @r5
+not @r5
+lea L24, D0
+jsr L7
+clr L1
+cmp L9, -220
+prn L6
+L41: add @r7, L31
+mov 36, L30
+mov L0, @r3
+mov @r4, L33
+rts
+m2
+not L14
+rts
+sub -504, @r2
+rts
+L42: jsr @r4
+bne L38
+lea S2, @r2
+L43: lea L42, L32
+rts
+add L8, L29
+mov L29, L9
+not L11
+jmp L7
+lea L9, @r1
+cmp L36, L47
+clr L6
+prn -55
+sub L19, L55
+cmp L38, L24
+add 306, L35
+add 177, L32
+dec L28
+rts
+m1
+clr L38
+cmp L43, L28
+not @r7
+bne @r1
+jsr @r7
+red @r7
+bne @r1
+inc L35
+not L43
+clr L28
+jsr L32
+add -159, @r6
+rts
+cmp 471, @r0
+jmp L12
+bne L47
+jsr @r0
+inc L28
+jmp @r1
+clr @r0
+cmp L42, @r4
+jsr L1
+not L28
+bne @r4
+lea L14, L32
+L44: inc L16
+m2
+rts
+cmp L29, @r2
+clr @r7
+m2
+L45: lea L25, @r2
+rts
+lea L28, L28
+m1
+m2
+m1
+sub @r1, L52
+cmp @r5, -89
+inc @r5
+clr L49
+L46: not @r4
+mov @r4, S5
+L47: add @r5, @r1
+L48: red @r7
+clr D0
+not L59
+lea L18, L0
+jsr L36
+prn L42
+not @r3
+lea L35, @r4
+jsr @r7
+m3
+add L21, L54
+clr @r4
+prn -278
+bne L37
+m0
+bne @r6
+cmp -200, L14
+red @r2
+red @r2
+cmp -146, -302
+clr @r5
+lea L37, @r3
+red @r1
+prn 90
+dec L11
+bne L23
+not @r0
+jmp L39
+lea X3, L48
+lea L49, @r4
+jsr L13
+red @r3
+red L0
+rts
+sub L47, L14
+mov @r0, @r5
+inc @r6
+lea L44, @r1
+add 334, @r1
+bne @r1
+rts
+L49: rts
+cmp -453, -58
+prn @r2
+mov L48, @r0
+jmp @r4
+L50: not L13
+not L22
+jsr @r7
+clr @r1
+lea L8, @r1
+lea X4, @r6
+add L32, L33
+red L41
+L51: jsr @r3
+not @r3
+L52: red @r4
+add 4, L47
+m3
+sub @r4, @r6
+prn 68
+rts
+lea L3, @r5
+dec @r7
+sub @r7, D0
+jsr @r0
+m0
+jsr @r4
+jsr L50
+L53: jmp @r0
+bne L14
+cmp 50, 152
+lea D0, S2
+jmp @r3
+dec @r5
+cmp -370, @r7
+L54: lea L8, D0
+not @r2
+inc @r5
+L55: inc @r1
+prn @r5
+red @r4
+m1
+lea S6, L56
+L56: dec L15
+L57: bne L8
+L58: mov -50, @r4
+jmp @r4
+dec @r5
+m2
+L59: bne @r3
+add S0, L19
+red S0
+m1
+mov @r3, S2
+jsr @r1
+inc L21
+stop
+D0: .data -163,425,-377,-59,-486,285,-428,4,257,-52
+D1: .data 368,-393,-453,-424,-140,-169,16,-41,18,461
+D2: .data -292,373,-401,440,-159,-466,-246,28,-269,-284
+D3: .data 53,72,-442,-405,-382,-16,281,-328,-432,-469
+D4: .data 5,344,283,138,-152,-292,-104,-496,-139,172
+D5: .data -179,-441,-447,33,154,259,-415,116,-445,-29
+D6: .data 121,385,-301,-425,4,-97,113,40,87,389
+D7: .data -239,-63,-86,226,298,382,-54,-427,-460,-455
+D8: .data -302,-190,287,-67,23,-70,-344,-145,418,-24
+D9: .data 313,301,-91,153,-198,-393,360,-423,-167,-106
+S0: .string "jpvsatnduixxqlepvo"
+S1: .string "hqaro"
+S2: .string "nuxrqgjjutqxbixjnxdy"
+S3: .string "sodwyd"
+S4: .string "jjcpcjzwslt"
+S5: .string "sqtnkrpeewtsczca"
+S6: .string "mftgsgwq"
+S7: .string "nehzimdxwgwhshc"
+S8: .string "embriiygzp"
+S9: .string "jekdfczhzgjzhaajt"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r1
+    prn 33
+endmcro
+mcro m1
+    sub @r2, @r3
+    prn 34
+endmcro
+mcro m2
+    sub @r7, @r0
+    prn 8
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 17
+endmcro
+mcro m4
+    sub @r7, @r1
+    prn 36
+endmcro
+m2
+rts
+L0: prn D0
+bne @r6
+sub -291, L0
+inc @r4
+prn @r0
+not L0
+not @r5
+cmp @r7, @r6
+prn @r3
+dec @r4
+L1: cmp L1, L1
+L2: jsr L0
+m3
+L3: sub L1, @r1
+jsr @r0
+L4: sub L4, @r7
+inc L3
+rts
+L5: inc @r1
+mov 325, D0
+prn @r2
+prn 331
+L6: inc L2
+L7: rts
+jsr @r5
+L8: red L25
+red @r6
+add L5, L49
+dec @r4
+dec @r0
+m1
+lea L3, @r6
+prn L8
+L9: prn -153
+red @r6
+rts
+dec @r5
+L10: prn -437
+inc @r6
+jsr @r1
+jsr @r7
+red @r6
+red D0
+clr @r6
+dec @r0
+mov L7, @r7
+cmp 73, @r0
+lea L4, L6
+mov @r5, L9
+cmp L0, 407
+inc L9
+jsr L8
+sub 463, @r1
+sub @r4, @r0
+lea L5, @r4
+jsr @r4
+inc L9
+bne @r6
+prn 471
+add L10, @r5
+clr @r3
+cmp L4, -330
+jmp @r5
+inc L0
+inc L0
+m0
+m1
+red @r5
+red L0
+L11: add @r6, L5
+L12: sub L5, L7
+rts
+mov @r1, @r6
+L13: lea L11, L6
+inc @r6
+jsr @r3
+clr @r1
+add L0, @r6
+jsr @r5
+prn -18
+m4
+inc L13
+prn 288
+L14: mov L10, @r5
+red @r1
+lea L12, @r0
+L15: jsr @r7
+inc L14
+m4
+not @r4
+add @r3, @r7
+bne L9
+lea L8, @r7
+sub 312, @r2
+rts
+L16: sub 84, L10
+red @r4
+L17: jsr L16
+bne @r1
+cmp 508, 160
+red L9
+cmp L10, -443
+rts
+m1
+inc @r0
+dec L14
+not @r4
+cmp @r7, 75
+sub @r6, L11
+jsr @r6
+L18: lea L1, L11
+red L6
+jsr @r6
+sub @r6, @r7
+L19: lea L2, L14
+cmp @r2, @r5
+L20: lea S7, L9
+dec L12
+jsr D0
+prn L12
+jmp @r0
+inc L11
+not @r0
+L21: red L18
+L22: mov 332, L12
+sub -165, L17
+sub @r2, @r7
+L23: sub -95, L14
+not L17
+m1
+jmp L7
+add @r4, @r4
+L24: cmp @r1, @r1
+m4
+jmp @r2
+prn -288
+prn 12
+mov 119, @r7
+not L14
+prn 216
+jmp @r3
+prn @r7
+red D0
+clr L9
+jsr @r1
+lea X0, L4
+L25: inc L10
+mov L5, S4
+L26: prn @r5
+add L11, L8
+mov -425, L21
+red L38
+clr @r5
+cmp 429, 127
+cmp @r2, L15
+jsr L9
+jsr @r3
+add @r6, @r7
+rts
+jmp @r7
+bne @r4
+not L3
+m4
+mov D0, @r6
+mov L17, @r3
+jsr L19
+inc L17
+dec @r7
+m0
+lea L36, @r7
+mov L18, X1
+m1
+bne L11
+lea L20, L32
+L27: inc @r3
+clr @r7
+clr L25
+bne L25
+m4
+L28: mov L25, @r3
+clr L21
+m2
+not @r0
+m2
+L29: mov @r5, @r4
+jsr L52
+m0
+cmp @r5, @r4
+mov -279, @r2
+m4
+inc @r0
+rts
+not L8
+not @r0
+lea L16, L20
+m2
+jmp @r5
+prn -173
+L30: add L8, @r0
+prn -183
+lea L13, L3
+m2
+sub L20, L57
+lea L28, @r7
+clr @r0
+add @r1, L6
+clr @r1
+cmp L10, @r7
+L31: prn @r0
+clr L10
+sub @r7, L29
+add 95, L26
+red @r1
+lea L30, L13
+L32: clr @r5
+m4
+add L24, L29
+prn -230
+not L8
+red @r6
+add @r5, L3
+m2
+clr L19
+dec @r0
+red @r6
+clr L30
+L33: rts
+cmp L16, 385
+jmp @r2
+mov @r1, L15
+L34: red L12
+add @r5, @r7
+rts
+L35: jmp L16
+jsr L35
+not @r0
+m2
+sub @r0, @r6
+add L31, L5
+jsr @r6
+dec L4
+mov L26, @r1
+not L33
+red L6
+jmp @r2
+not D0
+prn L31
+rts
+lea L26, @r5
+cmp @r7, 137
+sub L19, @r1
+red @r1
+add -480, @r5
+rts
+red L33
+red L2
+not S0
+bne @r1
+add L31, @r3
+not @r3
+jsr L4
+sub L11, S0
+prn L33
+inc L11
+jsr L25
+prn L7
+lea L1, L27
+add 171, @r4
+dec @r0
+L36: bne L5
+sub -487, L16
+prn L15
+L37: rts
+rts
+m2
+lea L14, @r2
+add @r1, @r3
+add @r0, L21
+inc @r4
+clr L17
+sub L13, @r7
+L38: rts
+bne @r2
+prn L27
+inc @r7
+L39: not L24
+inc L25
+cmp @r6, L37
+rts
+clr L25
+clr L8
+m0
+lea L17, L10
+dec L29
+add 200, L58
+sub @r0, @r4
+m0
+red @r7
+lea L0, L28
+rts
+L40: inc L40
+jmp @r3
+sub @r5, @r5
+m3
+clr @r6
+rts
+mov @r3, @r0
+jsr X2
+m2
+red X3
+L41: inc L27
+dec L4
+clr @r0
+rts
+dec L25
+L42: red @r2
+bne L11
+rts
+sub 129, @r5
+rts
+not @r4
+clr L24
+L43: mov @r0, @r3
+m4
+m2
+mov L18, @r2
+clr @r6
+sub @r4, L7
+jmp @r1
+red @r2
+prn @r6
+cmp @r3, -116
+clr L33
+inc L41
+sub L40, @r5
+dec @r5
+m2
+m0
+red L21
+dec L28
+bne L42
+L44: add @r1, @r2
+inc L8
+rts
+m1
+L45: add @r2, D0
+cmp D0, 277
+lea L52, @r5
+L46: dec @r6
+dec @r1
+prn L31
+prn L16
+mov @r5, @r3
+sub @r1, L15
+add L32, @r1
+m2
+add -37, L21
+dec L43
+not @r5
+sub @r0, L39
+sub @r5, @r1
+m0
+lea L22, L7
+bne L41
+jsr @r2
+m2
+inc @r7
+sub 470, D0
+clr L28
+bne @r7
+red @r3
+cmp L39, 378
+cmp 62, @r7
+prn -138
+L47: inc L45
+cmp @r4, -315
+jmp D0
+L48: lea L8, L17
+m2
+cmp -350, @r4
+sub L35, @r5
+lea L20, @r2
+rts
+L49: prn X4
+add 115, S4
+not L27
+m1
+m3
+sub 101, @r1
+mov L28, @r2
+prn @r7
+L50: rts
+clr L14
+inc L6
+L51: red @r5
+cmp @r1, -153
+L52: red L26
+dec @r5
+clr L11
+L53: cmp -247, 254
+clr L8
+lea L28, @r2
+L54: red @r0
+prn @r0
+inc @r7
+prn L58
+inc L33
+bne S8
+jsr L55
+lea L56, L18
+sub -171, @r3
+L55: jmp @r0
+inc D0
+lea L7, @r0
+mov 311, @r0
+not L47
+red L17
+cmp @r0, L13
+L56: lea L13, L5
+rts
+sub L59, @r4
+jsr L30
+jmp S0
+L57: prn S2
+sub D0, @r3
+add L56, @r1
+L58: jmp @r1
+cmp L59, D0
+cmp @r0, D0
+L59: jsr L25
+lea D0, L33
+bne L34
+sub -448, @r0
+inc L6
+lea L7, L30
+m1
+jmp S4
+mov S9, @r4
+stop
+D0: .data 454,68,313,263,479,20,-14,-362,98,-188
+D1: .data -69,353,-410,176,369,-366,-319,460,21,264
+D2: .data 213,-407,-492,-181,320,206,329,-114,487,38
+D3: .data 3,-161,5,459,-168,454,292,-388,9,67
+D4: .data 257,-489,13,222,-55,-25,-90,194,476,-13
+D5: .data 397,-225,110,-389,149,263,152,57,261,-359
+D6: .data -16,-129,187,407,355,-305,318,-32,298,377
+D7: .data 266,-101,231,-481,-29,342,-427,-448,-196,445
+D8: .data -16,330,226,481,-321,384,241,48,40,227
+D9: .data -118,-453,173,226,95,118,-474,240,-271,-423
+S0: .string "vcgdxndpf"
+S1: .string "gglanskqcmgjx"
+S2: .string "gdkzzoeyupgduxmphlde"
+S3: .string "hdoueouqhttla"
+S4: .string "ifvdagprjgzidnk"
+S5: .string "nhvuhibvprwpv"
+S6: .string "vyxayw"
+S7: .string "hxxziqpysrjk"
+S8: .string "efvdanudwtiueu"
+S9: .string "rgmcpdrgfyuouqcx"
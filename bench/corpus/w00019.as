@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r4
+    prn 4
+endmcro
+mcro m1
+    sub @r6, @r4
+    prn 1
+endmcro
+mcro m2
+    sub @r1, @r6
+    prn 73
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 93
+endmcro
+mcro m4
+    sub @r1, @r0
+    prn 61
+endmcro
+inc @r4
+dec L0
+clr @r0
+jsr L0
+L0: sub L0, @r0
+lea D0, L0
+clr L0
+lea L0, @r5
+prn 342
+bne @r5
+L1: inc @r6
+m0
+bne @r4
+rts
+clr D0
+jsr @r3
+clr L1
+sub L0, @r3
+rts
+cmp @r4, -417
+clr L1
+add 337, @r1
+add -384, L0
+bne @r2
+lea L1, @r1
+L2: cmp L1, @r1
+jmp L2
+red L1
+mov 400, L2
+jsr L2
+m4
+sub L58, L1
+prn @r2
+jmp @r4
+add L2, L2
+L3: inc @r7
+cmp @r2, -375
+m2
+clr @r6
+clr @r0
+sub -104, L1
+L4: not @r7
+sub @r6, L2
+sub 444, @r0
+not L2
+L5: not L5
+m1
+inc @r0
+L6: not L1
+sub S3, @r3
+inc S5
+bne L3
+jmp @r7
+inc @r4
+jmp @r2
+lea L5, L5
+bne L6
+inc L6
+cmp -441, @r4
+clr @r4
+jsr L2
+prn @r3
+jsr L2
+m2
+bne @r3
+L7: jmp @r3
+rts
+lea L1, L1
+m0
+inc L7
+L8: dec L5
+red L1
+cmp @r4, -391
+L9: jsr L9
+m4
+L10: cmp 121, @r1
+dec @r4
+dec S6
+add @r7, @r7
+red @r5
+inc L6
+L11: clr @r2
+rts
+rts
+clr @r6
+jmp @r6
+L12: dec @r3
+dec L2
+rts
+rts
+L13: jmp L13
+L14: sub @r4, L3
+add L3, @r6
+jsr L12
+not L11
+not @r1
+mov 246, L3
+rts
+cmp -194, @r0
+prn @r7
+cmp @r5, L5
+dec L11
+prn L14
+cmp -297, 82
+rts
+bne @r5
+dec L5
+cmp 452, -23
+red L14
+L15: cmp L15, L0
+clr @r0
+L16: add 176, L4
+lea L6, @r3
+L17: red L15
+add L11, @r3
+sub 506, @r2
+inc L4
+prn L1
+red @r7
+m2
+dec @r5
+jsr @r4
+jmp L8
+lea L1, @r6
+bne L15
+dec L1
+not @r4
+clr @r4
+not @r3
+prn L20
+L18: red @r2
+m2
+add @r1, @r7
+sub -227, L18
+bne L15
+m2
+jsr L12
+prn 463
+lea L12, @r3
+inc L13
+m4
+cmp L18, L12
+inc L18
+inc @r7
+jsr @r7
+bne @r1
+not L3
+inc L5
+L19: lea L18, L5
+jsr L5
+sub @r7, L16
+m1
+mov L0, L3
+rts
+prn 241
+mov @r7, @r7
+not L4
+inc L8
+m1
+L20: dec L9
+sub -151, @r5
+m1
+prn -200
+prn L12
+lea L0, @r1
+mov L6, @r2
+m1
+sub -39, @r0
+cmp L6, L20
+cmp 208, @r5
+L21: jmp @r6
+cmp L14, 484
+not L0
+clr L14
+rts
+clr @r3
+not @r1
+sub -19, @r7
+m2
+L22: cmp L5, -199
+clr @r1
+not @r6
+mov -365, L3
+cmp -189, -114
+lea L11, @r4
+L23: lea S0, @r7
+dec L4
+add L4, L11
+rts
+cmp @r2, @r5
+dec @r4
+cmp @r1, -89
+add -91, @r1
+dec @r1
+rts
+m3
+L24: rts
+jsr L19
+red L15
+dec @r0
+bne L11
+add 284, L14
+m4
+dec L43
+dec L10
+clr L18
+L25: prn L14
+bne @r6
+lea L4, @r3
+clr @r2
+jsr X0
+mov 265, @r6
+not L0
+prn @r2
+m1
+lea L14, @r4
+clr @r2
+inc @r3
+clr @r0
+add L2, @r7
+bne @r0
+m1
+m2
+jsr L11
+clr L23
+not L20
+rts
+bne @r3
+dec @r3
+rts
+cmp @r1, 29
+L26: clr @r6
+cmp @r6, 280
+L27: dec @r5
+L28: dec @r7
+mov 212, L20
+prn -250
+lea L4, L21
+red @r3
+m2
+jmp L28
+bne @r5
+sub @r3, @r7
+L29: lea L26, L26
+L30: bne L22
+cmp -293, L3
+lea L17, L0
+inc @r1
+bne @r4
+add @r2, @r6
+add @r3, L17
+rts
+bne @r6
+lea L22, @r5
+mov 412, @r5
+add L9, @r4
+add L22, L19
+L31: sub X1, @r2
+lea L5, L16
+bne L18
+L32: dec L8
+m4
+lea L47, @r1
+red L32
+red @r7
+bne L2
+red L23
+not @r2
+add -396, @r0
+sub 126, L27
+prn L7
+cmp -368, X2
+lea L23, @r6
+sub -131, @r2
+jsr @r2
+L33: cmp @r2, @r5
+L34: red L12
+m0
+bne L9
+jsr @r7
+m4
+jsr @r7
+not L14
+L35: mov -158, X3
+m2
+m0
+lea L22, D0
+jmp @r2
+not L6
+prn -344
+not S1
+L36: rts
+inc L16
+cmp -356, @r3
+cmp L33, @r6
+clr @r4
+clr @r6
+rts
+cmp L2, @r6
+inc @r2
+add L4, L20
+cmp L11, @r6
+mov @r2, L18
+prn -367
+prn @r3
+add S4, L28
+m3
+dec @r2
+red L22
+sub L30, L31
+lea L27, @r6
+L37: jsr @r0
+rts
+lea L33, @r1
+jsr @r4
+L38: clr L21
+dec @r0
+mov L4, @r0
+lea L23, L12
+L39: prn -363
+inc @r7
+red @r2
+m3
+m0
+red L35
+inc L8
+add @r5, L36
+mov @r3, @r1
+L40: clr @r7
+lea L15, L30
+dec @r1
+bne @r3
+cmp L38, @r6
+L41: lea L18, @r4
+L42: not L19
+L43: add -266, L16
+clr @r6
+clr @r2
+jmp @r6
+lea L9, D0
+m1
+bne @r2
+inc L25
+add -124, @r3
+m1
+red @r0
+lea L40, L55
+add 130, @r0
+mov L39, L39
+L44: rts
+not L50
+inc S2
+bne @r7
+L45: jmp L32
+L46: bne @r2
+rts
+jsr L51
+rts
+dec L8
+add @r2, S4
+inc L49
+L47: not @r6
+L48: mov L37, @r4
+clr L41
+prn @r5
+bne L18
+rts
+m1
+rts
+L49: inc L52
+not @r5
+prn L53
+rts
+jmp L30
+inc @r4
+rts
+dec L56
+add 55, L29
+lea L39, @r1
+L50: inc L28
+bne L35
+mov D0, L8
+cmp L19, L45
+not @r1
+jmp L17
+cmp -103, @r6
+L51: red @r0
+cmp 195, 304
+L52: not L17
+add @r3, L46
+m4
+m1
+cmp @r2, @r6
+L53: cmp L18, L16
+bne @r4
+prn L18
+L54: not @r3
+prn L49
+m2
+mov 441, @r1
+not L58
+rts
+rts
+L55: add @r4, L11
+m2
+jmp L41
+rts
+rts
+bne L36
+clr L4
+rts
+L56: sub @r5, L4
+prn L10
+dec @r1
+m4
+clr @r2
+jsr L12
+L57: cmp @r5, @r6
+rts
+clr @r6
+not @r4
+lea L35, L52
+red L25
+jmp @r2
+clr D0
+m4
+red L58
+jmp D0
+L58: red L59
+jmp L59
+bne L59
+jsr D0
+m2
+L59: inc D0
+jmp D0
+clr X4
+rts
+jsr S9
+jsr D0
+prn S0
+stop
+D0: .data 286,-492,266,-334,-248,254,-55,-384,-143,-223
+D1: .data 405,368,244,-366,325,-345,70,184,257,-486
+D2: .data 57,-216,-1,276,-371,310,52,445,-107,279
+D3: .data -145,300,283,-428,-153,-166,-204,-174,-144,83
+D4: .data 335,-163,145,-125,-58,-446,-263,-105,-377,-200
+D5: .data 216,-212,-285,-478,424,239,3,422,63,-452
+D6: .data 323,95,8,364,453,119,-446,270,-170,471
+D7: .data -218,350,381,283,417,221,-500,-182,-233,434
+D8: .data -39,-32,444,230,-198,-263,296,174,-159,-191
+D9: .data 101,-158,-238,354,-113,-143,27,-63,25,219
+S0: .string "hrpahfgbkureqcou"
+S1: .string "hqiepbftmykb"
+S2: .string "sdlqklskpzhq"
+S3: .string "yhvx"
+S4: .string "lnydcxwhfchg"
+S5: .string "pdibrttztfpazbn"
+S6: .string "gibev"
+S7: .string "p"
+S8: .string "urzrs"
+S9: .string "zodbgtedxxsgh"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r6
+    prn 42
+endmcro
+mcro m1
+    sub @r3, @r5
+    prn 99
+endmcro
+mcro m2
+    sub @r3, @r4
+    prn 70
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 70
+endmcro
+mcro m4
+    sub @r3, @r6
+    prn 85
+endmcro
+jsr @r5
+lea L0, L0
+jsr @r7
+lea L0, L0
+red L0
+lea L0, @r4
+inc L0
+inc L0
+add @r3, @r4
+sub L0, L0
+not @r7
+sub L0, @r1
+add @r6, @r0
+L0: not L0
+dec @r1
+inc L0
+sub 297, L5
+jsr @r0
+dec L0
+not L0
+not @r4
+clr L0
+sub @r5, @r5
+L1: clr L0
+mov L0, L13
+L2: prn @r3
+L3: prn 142
+L4: lea L2, @r2
+red @r6
+add L1, L4
+jmp L3
+rts
+not L3
+sub S5, L4
+jmp L17
+sub @r0, L2
+rts
+not L2
+L5: clr @r2
+L6: prn @r5
+sub L6, @r3
+not L6
+add @r4, L4
+jmp @r6
+m0
+m0
+rts
+add @r1, L2
+clr @r0
+not @r7
+lea L5, L4
+add @r4, @r1
+L7: jsr @r2
+not @r3
+L8: not L5
+add S1, L8
+inc L8
+L9: inc @r6
+inc L1
+m1
+rts
+dec L4
+m1
+L10: prn D0
+clr L2
+prn L5
+cmp @r0, 467
+m1
+clr L7
+cmp -40, 472
+sub @r6, L7
+jsr L4
+jsr @r2
+prn L3
+mov -247, L25
+sub L7, @r4
+jmp L2
+lea L4, @r7
+lea L4, L7
+L11: cmp @r5, -419
+m0
+L12: not L7
+red L9
+L13: prn @r1
+cmp L2, 188
+dec L8
+rts
+mov S7, @r1
+jmp L11
+bne L5
+lea L7, L9
+add @r3, @r0
+sub 275, @r3
+rts
+not @r6
+L14: red L5
+red L13
+jmp @r2
+not L9
+L15: add 454, @r0
+lea L26, @r7
+mov L13, L10
+lea L45, L12
+mov L3, L42
+sub @r4, @r1
+clr L2
+mov L2, @r7
+L16: clr L13
+m2
+not @r7
+not L15
+rts
+red @r2
+not @r0
+jsr @r2
+L17: not @r5
+jmp @r5
+lea L0, @r5
+cmp @r2, -77
+add @r5, @r4
+not @r2
+inc @r1
+add -9, @r3
+L18: add @r0, @r5
+L19: sub L11, L18
+jsr @r4
+dec L9
+bne L50
+L20: rts
+cmp @r7, @r3
+jsr L17
+mov -192, L3
+L21: bne @r5
+jmp L15
+red L7
+L22: cmp -99, L5
+jmp L49
+lea L17, @r5
+inc @r1
+jmp L20
+m2
+L23: cmp 243, -310
+clr L3
+add @r2, @r0
+add -101, @r1
+inc L0
+inc L12
+add 408, @r7
+lea L12, L11
+clr L17
+mov L7, @r7
+mov @r2, L19
+red L18
+inc @r6
+inc L13
+dec L5
+not @r7
+jsr L19
+jmp L5
+rts
+m2
+sub 267, L2
+m2
+add L22, @r3
+rts
+m0
+add 34, L11
+m1
+lea L4, L8
+add @r7, @r0
+prn L13
+m1
+clr @r2
+not L0
+bne @r2
+sub L21, @r0
+prn L15
+add -157, @r2
+jmp L7
+jsr @r4
+L24: sub 264, @r1
+cmp L0, -162
+prn L21
+mov @r6, @r0
+mov @r1, L22
+inc L11
+prn @r7
+clr @r4
+add @r4, L33
+m3
+rts
+red @r6
+cmp @r4, 288
+red @r0
+m3
+bne L33
+clr L22
+not @r0
+add L10, @r3
+cmp L24, L10
+jmp @r5
+jsr L14
+L25: mov L7, L22
+sub L18, @r6
+dec L6
+not @r5
+L26: red @r6
+dec L13
+m2
+lea L7, @r7
+L27: mov 194, @r7
+jmp @r5
+L28: jsr @r1
+mov -382, @r3
+jmp L12
+m1
+lea L12, S6
+L29: mov -127, L0
+inc @r1
+inc @r5
+mov 12, L4
+L30: add L6, @r2
+rts
+inc L2
+L31: inc L34
+sub -91, L26
+m1
+red L6
+L32: sub 92, @r0
+bne @r7
+m4
+mov L30, D0
+m4
+clr L6
+cmp -82, X0
+jsr D0
+bne @r4
+inc L3
+lea L3, L6
+dec @r1
+rts
+prn D0
+add @r5, @r7
+inc @r0
+red @r0
+rts
+L33: jsr @r0
+prn X1
+red L23
+clr L30
+dec L24
+inc L28
+m0
+cmp L6, L14
+m2
+mov L24, @r6
+dec L30
+mov @r4, L22
+rts
+mov @r5, @r7
+inc L15
+inc L27
+prn -208
+jsr @r4
+jmp L48
+not L0
+m3
+L34: clr @r6
+red L28
+L35: cmp -268, L18
+m3
+red @r3
+red @r0
+jsr @r2
+red @r3
+L36: dec @r6
+m1
+m2
+jsr L7
+add L10, @r5
+clr L3
+sub L3, X2
+not L2
+jmp L32
+jmp @r3
+mov @r1, @r5
+jmp L9
+prn L34
+bne D0
+m3
+rts
+dec L28
+jmp L15
+not @r2
+jmp L0
+m2
+prn L6
+sub 61, L6
+clr @r6
+rts
+red @r4
+inc L18
+clr @r6
+mov @r6, @r4
+inc L27
+lea L31, L31
+red @r1
+red @r1
+add @r5, L2
+mov -485, @r0
+bne @r4
+prn @r1
+bne S3
+dec @r0
+mov 6, L4
+not D0
+dec @r4
+jmp @r3
+L37: prn 368
+jsr L6
+m1
+sub L4, L24
+clr S7
+cmp 173, -134
+bne L35
+jmp L34
+sub 35, L16
+rts
+L38: jmp L22
+jsr L9
+dec L12
+mov @r7, @r4
+not @r5
+rts
+jmp @r6
+m1
+add @r2, @r3
+inc @r6
+mov @r0, @r6
+prn @r0
+jmp L5
+red @r4
+L39: inc @r6
+add @r5, L16
+cmp -244, @r0
+jmp L45
+bne L2
+jsr L22
+bne L20
+sub L34, @r1
+m3
+cmp L27, @r0
+not @r1
+prn -79
+lea L10, L17
+not @r6
+dec @r2
+bne @r3
+m2
+m4
+add L15, L22
+not @r0
+red @r3
+sub L11, L33
+mov -109, L16
+not L31
+not L35
+L40: inc @r5
+mov L1, @r1
+dec @r4
+L41: rts
+mov L31, @r1
+mov 481, L10
+jsr L37
+inc @r2
+prn 304
+red L42
+m4
+sub L36, @r3
+dec S2
+L42: rts
+clr @r1
+sub -22, L39
+clr @r6
+jmp @r0
+m3
+rts
+L43: cmp L36, @r6
+lea L28, @r0
+L44: sub L51, @r1
+add L44, L26
+L45: prn @r1
+not @r3
+bne L1
+lea L23, @r3
+mov -222, @r1
+L46: lea L3, @r2
+L47: rts
+L48: dec @r0
+m3
+m3
+L49: mov @r6, L48
+red @r5
+not L21
+m4
+jmp S4
+sub -366, L19
+L50: inc L26
+red @r1
+L51: not L26
+dec L50
+red L59
+prn L49
+add -211, @r1
+L52: inc @r0
+rts
+cmp @r3, @r2
+L53: inc @r7
+m2
+L54: dec S6
+L55: prn @r5
+not @r5
+dec @r4
+lea L38, S4
+inc @r2
+L56: inc L43
+L57: not @r5
+mov -152, @r3
+L58: jmp @r7
+jmp S4
+not D0
+jsr L23
+L59: cmp L48, @r4
+m3
+inc S9
+jsr X3
+prn S8
+bne X4
+bne D0
+jsr D0
+stop
+D0: .data 1,-277,116,-105,435,-147,-237,-354,-15,-382
+D1: .data -275,-149,-365,358,189,-131,127,160,-8,-226
+D2: .data -62,-265,403,344,-167,-128,477,497,-54,112
+D3: .data -10,-58,474,-259,-398,-478,-25,-181,-348,263
+D4: .data -81,-345,-384,366,-101,249,-121,471,-66,-465
+D5: .data 223,-428,-127,51,-16,-170,-1,272,-110,147
+D6: .data -474,128,-142,-311,-426,-10,125,-143,-23,68
+D7: .data -115,-228,481,-192,300,271,101,-323,121,-28
+D8: .data -83,-201,-373,-385,-168,153,-174,-275,187,-57
+D9: .data -459,304,-220,458,312,-167,-468,-147,-195,-66
+S0: .string "cetplmaniufxkhxvji"
+S1: .string "ogleffumx"
+S2: .string "r"
+S3: .string "cwfmnebkq"
+S4: .string "xtv"
+S5: .string "cmodp"
+S6: .string "gw"
+S7: .string "xqyywcovhffjjwb"
+S8: .string "uqrdawsfpfqxa"
+S9: .string "yciy"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r1
+    prn 12
+endmcro
+mcro m1
+    sub @r7, @r7
+    prn 98
+endmcro
+mcro m2
+    sub @r5, @r2
+    prn 36
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 46
+endmcro
+mcro m4
+    sub @r5, @r4
+    prn 10
+endmcro
+sub -410, @r1
+cmp -494, @r1
+prn L0
+prn @r7
+jsr @r1
+L0: inc D0
+red @r6
+sub @r6, L0
+add L0, L0
+L1: rts
+not @r7
+m4
+bne @r4
+prn 345
+cmp L1, @r0
+jsr L0
+add @r0, @r2
+L2: add -284, L1
+jmp @r5
+L3: jsr @r5
+inc L3
+bne L0
+m3
+m4
+L4: inc @r3
+mov L4, L36
+not L4
+lea L0, @r2
+jsr @r2
+cmp L1, @r4
+dec @r3
+L5: red @r5
+dec L1
+jmp L0
+inc L2
+bne L0
+add L4, L2
+L6: mov -479, @r5
+cmp @r1, @r1
+dec L6
+add 305, @r3
+prn 165
+jmp @r5
+add L1, @r3
+L7: bne @r3
+red L3
+add -215, @r0
+rts
+add @r6, L7
+jmp @r2
+red L2
+mov @r1, L7
+dec @r3
+not @r5
+add 66, @r5
+not @r0
+not L9
+jmp L2
+not @r4
+m1
+m0
+bne @r2
+m0
+not @r2
+red L7
+m1
+lea L5, @r1
+L8: inc L1
+lea L2, X0
+add L3, @r2
+bne @r5
+m1
+L9: jsr @r1
+add -228, @r3
+lea L7, @r5
+not @r4
+L10: dec @r2
+mov L4, L3
+m3
+red L8
+L11: cmp -31, L6
+mov @r1, L0
+cmp 69, 452
+sub @r6, @r3
+L12: jmp @r2
+red L9
+prn @r3
+bne L8
+mov L12, @r4
+L13: rts
+clr L3
+m3
+L14: not L7
+red L2
+prn -343
+L15: mov @r6, L1
+m4
+jsr @r4
+add -134, L11
+jsr L3
+sub -231, @r0
+red @r6
+L16: bne @r3
+bne L1
+jsr L13
+cmp @r0, @r2
+L17: inc X1
+cmp @r7, L7
+L18: lea L8, @r3
+lea L10, L13
+mov @r0, @r2
+dec @r6
+rts
+cmp @r4, 85
+not @r7
+prn @r3
+L19: sub @r1, @r5
+rts
+L20: bne @r1
+m2
+jsr L1
+rts
+m3
+sub -289, @r6
+L21: bne L0
+jsr L21
+L22: prn L12
+m4
+cmp L8, -320
+jsr L12
+inc @r3
+red @r2
+lea L23, L14
+lea L5, @r5
+L23: jmp L12
+add @r1, @r5
+sub @r2, L7
+L24: red @r4
+not @r3
+dec L16
+m3
+inc L18
+dec @r6
+bne L18
+not @r6
+m2
+dec @r3
+dec L8
+lea L22, L2
+prn -218
+jsr @r1
+m0
+jsr L13
+cmp L20, @r3
+jsr L16
+m3
+bne L3
+L25: cmp L28, @r0
+bne @r3
+L26: dec @r6
+dec @r6
+prn 60
+cmp @r3, L6
+red @r2
+red @r0
+mov 321, @r6
+rts
+rts
+L27: mov @r5, @r4
+bne L5
+L28: cmp L24, L22
+not @r7
+L29: inc @r7
+jsr @r5
+bne @r1
+mov @r1, @r3
+jsr L6
+not L3
+m3
+jsr @r2
+not @r5
+lea L11, @r3
+sub @r1, @r1
+m3
+jmp @r7
+clr @r1
+bne @r2
+mov L0, @r7
+jmp @r0
+bne L6
+L30: cmp L25, 272
+clr @r4
+L31: prn L15
+mov 157, @r6
+lea L0, @r6
+jsr L10
+red L26
+clr L5
+jsr L14
+jmp L35
+prn L21
+red L26
+mov 484, @r5
+rts
+add L10, L21
+jmp L44
+lea L31, D0
+mov @r2, @r7
+bne L13
+L32: not L8
+rts
+sub -400, @r0
+bne L6
+mov 420, L30
+not @r2
+add L9, L19
+not @r2
+dec L22
+not @r5
+red @r7
+add L5, L4
+sub 458, L26
+clr L57
+lea L24, L28
+jmp L3
+red @r2
+add @r1, @r3
+L33: bne @r2
+jmp L27
+rts
+not @r3
+mov -223, @r3
+red @r6
+jmp @r7
+bne L9
+cmp L1, L3
+L34: cmp L2, @r0
+clr @r3
+mov -63, L32
+m1
+sub L20, L18
+prn L24
+add @r7, @r1
+inc L20
+rts
+cmp -476, -414
+m2
+mov -380, @r7
+jmp L9
+jmp @r2
+rts
+rts
+add 180, L20
+dec L27
+bne @r6
+cmp -466, -46
+cmp @r6, 228
+sub @r3, L26
+sub @r6, L17
+m0
+red @r2
+jmp @r0
+add 267, @r3
+jmp L6
+lea L22, @r7
+rts
+L35: red @r7
+add @r0, @r4
+bne L21
+jsr @r3
+L36: sub -221, @r4
+add 4, L5
+L37: mov L24, L13
+not @r5
+lea S2, @r2
+bne @r6
+bne @r7
+not L8
+prn L1
+jsr @r3
+sub D0, S5
+L38: rts
+add @r2, X2
+sub S1, @r2
+sub 382, D0
+not L19
+L39: lea L25, @r5
+jsr @r6
+mov L26, @r3
+L40: bne @r6
+dec @r0
+lea L59, @r4
+sub L36, @r7
+jmp @r7
+L41: inc L4
+red @r0
+dec L32
+L42: mov -243, @r5
+lea L35, @r7
+bne @r6
+red L16
+red L18
+sub @r3, @r6
+rts
+rts
+bne @r1
+red @r3
+bne L29
+mov -337, @r5
+rts
+cmp -381, @r7
+mov L45, @r1
+mov @r7, L31
+mov 494, @r3
+rts
+jmp @r0
+L43: red L56
+not L43
+m1
+jsr @r0
+prn @r4
+dec @r0
+bne L15
+not L41
+red @r2
+m1
+m1
+lea L54, D0
+lea L3, L21
+not L27
+bne L10
+mov L33, L44
+prn L5
+clr @r7
+add -378, @r3
+L44: prn L38
+red L22
+mov -220, L19
+rts
+lea L39, @r2
+lea L1, @r1
+m2
+bne @r4
+sub 107, @r6
+L45: inc @r0
+m3
+inc @r5
+mov L36, @r6
+sub @r1, @r3
+add @r7, @r1
+m3
+L46: red L0
+m0
+L47: jsr @r0
+dec @r0
+dec L15
+inc @r5
+L48: rts
+L49: mov -17, L28
+red L26
+m1
+jsr L54
+jsr @r0
+bne @r1
+mov L25, D0
+jmp L14
+sub 400, @r0
+m1
+bne L46
+clr L30
+clr @r1
+m3
+sub @r3, @r5
+red L6
+m3
+rts
+jmp L14
+jmp @r4
+mov L46, @r6
+add L52, @r1
+lea L54, @r3
+inc @r4
+clr L49
+not @r0
+add @r3, L18
+clr L10
+jsr L24
+prn L34
+jmp @r5
+dec @r5
+mov 103, L34
+m1
+inc L58
+L50: not L34
+cmp @r0, L15
+jmp L9
+L51: jmp @r0
+L52: not S2
+jsr D0
+cmp 273, L23
+rts
+not L32
+L53: lea L4, L7
+bne @r5
+red @r5
+rts
+add L50, L18
+L54: cmp @r2, -321
+jmp L8
+m4
+L55: add @r1, S4
+cmp L56, S6
+jsr L15
+prn @r3
+rts
+m4
+jsr X3
+jsr @r5
+L56: mov 295, L58
+sub -168, @r2
+L57: cmp -343, L43
+jsr @r5
+bne L59
+add 265, @r3
+prn -309
+m1
+not @r6
+add @r2, @r3
+L58: jsr X4
+m0
+not L59
+L59: cmp @r0, D0
+dec @r5
+m4
+rts
+sub S2, S2
+sub S5, @r0
+dec S5
+clr D0
+mov D0, L47
+stop
+D0: .data 9,88,31,-99,382,315,401,-132,-16,-66
+D1: .data 317,-159,343,-143,-124,175,-185,-388,-209,39
+D2: .data -347,-103,-468,242,-192,-30,48,137,52,500
+D3: .data -411,500,8,-311,491,-205,-173,171,267,-150
+D4: .data 443,-270,-227,-93,439,-132,338,486,151,257
+D5: .data 464,234,191,101,57,-11,298,423,-28,170
+D6: .data -447,-451,-414,-358,27,-159,-116,-71,185,-221
+D7: .data 152,348,-143,402,388,-142,331,83,284,14
+D8: .data -122,352,-326,-292,196,281,-89,-242,116,-347
+D9: .data 461,29,-169,-93,-497,-348,189,98,-329,460
+S0: .string "suxcorq"
+S1: .string "vbsjyvt"
+S2: .string "mwpzoqvcrghmfomqhse"
+S3: .string "ycitgxgoneefyzjw"
+S4: .string "ntnogtvivziu"
+S5: .string "prgykcj"
+S6: .string "q"
+S7: .string "atyerx"
+S8: .string "lwfnsrekp"
+S9: .string "fb"
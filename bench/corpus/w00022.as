@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r3
+    prn 50
+endmcro
+mcro m1
+    sub @r3, @r0
+    prn 96
+endmcro
+mcro m2
+    sub @r7, @r0
+    prn 1
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 22
+endmcro
+mcro m4
+    sub @r7, @r2
+    prn 66
+endmcro
+jmp @r7
+bne @r6
+jmp @r6
+add @r7, @r0
+L0: sub @r0, L0
+jsr @r5
+bne L0
+L1: prn X0
+inc @r1
+L2: bne L2
+bne @r0
+prn L0
+mov -266, @r3
+dec @r3
+prn @r1
+L3: red L4
+add L2, @r5
+cmp @r7, @r5
+red @r1
+dec @r4
+L4: prn 14
+L5: red L1
+red L4
+not @r3
+dec L1
+dec @r4
+bne L5
+inc @r1
+m2
+L6: rts
+m1
+L7: dec @r1
+dec @r2
+m3
+L8: add 245, L5
+L9: clr L7
+bne @r1
+cmp L1, @r3
+clr L8
+L10: clr S7
+rts
+L11: cmp @r4, L9
+prn @r7
+inc L4
+rts
+prn @r3
+L12: lea L12, @r6
+mov 231, @r5
+bne L6
+m0
+jsr @r5
+sub L3, @r2
+rts
+mov @r7, @r5
+jmp L2
+m4
+jsr L8
+L13: add @r4, L7
+sub 117, @r1
+prn @r0
+bne L2
+inc @r2
+rts
+not @r4
+not @r0
+m1
+m3
+dec L8
+L14: jmp @r6
+red L35
+jmp @r4
+clr @r4
+clr L11
+L15: sub 359, @r2
+L16: mov @r3, @r1
+not @r1
+mov L5, @r0
+rts
+bne L11
+jmp @r5
+m2
+sub L15, L6
+prn @r6
+inc L0
+clr @r5
+jmp @r6
+clr L1
+rts
+clr @r6
+m4
+red L1
+clr L1
+L17: jsr L4
+lea L11, @r5
+mov @r5, L11
+rts
+not L8
+L18: add L15, @r7
+add 348, L3
+m0
+dec @r4
+rts
+cmp @r6, 322
+add L13, L9
+dec L14
+jmp L6
+L19: jsr L7
+dec L2
+prn @r3
+m4
+cmp 435, @r0
+lea L7, L4
+jsr @r6
+prn L17
+jsr @r3
+m4
+prn 6
+dec @r4
+dec @r4
+add -193, L2
+sub 34, L17
+cmp -45, 40
+clr @r7
+red @r4
+jsr L2
+rts
+prn L19
+rts
+m0
+L20: sub @r4, @r5
+jsr @r5
+m0
+prn @r3
+clr L14
+bne L17
+sub @r4, @r4
+L21: jmp L6
+jmp @r0
+inc @r7
+add 498, @r0
+m3
+prn -10
+L22: bne @r0
+not @r6
+prn @r7
+L23: lea L19, @r0
+clr @r1
+jsr @r5
+jmp L2
+cmp L5, 30
+mov @r0, S5
+m2
+L24: sub L13, L53
+m4
+mov 200, L11
+dec @r5
+lea L2, @r2
+inc L15
+bne L14
+jmp @r1
+lea L19, @r2
+jmp @r5
+cmp 271, @r0
+jsr L7
+rts
+L25: mov 294, L37
+clr @r3
+prn L16
+sub @r2, @r0
+dec @r0
+not @r5
+m2
+jmp L3
+inc @r6
+inc @r4
+add -175, L17
+rts
+prn S3
+mov L22, @r2
+L26: clr L17
+dec L16
+m4
+add L14, @r2
+dec L55
+inc @r5
+clr L20
+inc L43
+prn -186
+bne @r6
+m0
+lea L13, @r7
+L27: add L2, L0
+add @r4, L22
+m1
+add L8, @r0
+add L8, L27
+sub @r4, L24
+cmp L21, -385
+dec @r7
+sub @r4, @r5
+red @r6
+inc L2
+m1
+rts
+m3
+L28: lea L17, L27
+lea L22, L26
+cmp @r5, @r6
+clr @r6
+inc L15
+lea L13, L13
+jsr @r5
+add 446, @r6
+sub -8, L17
+clr L4
+jmp @r3
+rts
+lea L16, @r2
+m3
+not L0
+rts
+inc @r4
+sub @r3, @r0
+cmp -465, 118
+not L7
+red @r2
+cmp X1, -329
+L29: inc L16
+L30: clr @r0
+add L18, @r2
+sub -351, L14
+jsr @r0
+sub 196, @r4
+rts
+prn S0
+inc @r2
+rts
+sub -134, L22
+mov @r0, X2
+mov L0, L8
+L31: jsr @r1
+bne L17
+jsr @r3
+inc L6
+clr @r2
+not L14
+bne L4
+red @r4
+not @r6
+bne @r1
+rts
+mov -501, L7
+dec @r1
+rts
+jsr @r3
+L32: prn 201
+mov @r2, L21
+L33: bne @r1
+not @r2
+lea L47, @r0
+m1
+dec @r0
+lea L26, @r2
+clr L20
+mov 413, L0
+bne L19
+red L3
+prn @r5
+m1
+clr L3
+add D0, D0
+jsr @r4
+jsr @r0
+bne L31
+lea L20, @r4
+not @r0
+prn @r3
+clr L28
+sub @r1, @r0
+bne D0
+m0
+mov @r6, L27
+add 241, @r6
+mov L20, @r4
+bne @r1
+mov L15, @r4
+rts
+jsr @r0
+clr @r3
+add -407, @r7
+L34: jmp @r3
+mov 475, L23
+red @r6
+inc @r3
+jsr @r5
+lea L0, @r3
+clr @r1
+rts
+prn 387
+cmp @r5, @r3
+dec @r6
+lea D0, @r5
+add 101, L13
+inc @r2
+not @r4
+L35: lea L23, L53
+L36: jsr @r6
+L37: not @r3
+m0
+dec @r5
+m4
+prn @r7
+mov L27, @r1
+cmp L56, L21
+dec @r6
+m4
+clr L19
+mov -119, L35
+sub -225, L16
+m0
+lea L30, L15
+clr @r5
+lea L33, L57
+clr L21
+inc @r5
+inc L27
+rts
+cmp L11, -271
+not L12
+dec L48
+prn L5
+dec @r5
+L38: jmp L37
+m2
+rts
+mov L28, @r3
+not L32
+sub -428, L49
+m1
+mov @r2, L13
+lea L28, L23
+L39: inc @r2
+add -470, L34
+not @r7
+m3
+jmp @r3
+jmp L45
+dec @r0
+m0
+L40: dec L38
+red @r4
+m4
+cmp @r0, 226
+clr L23
+L41: red L33
+jsr @r2
+clr @r2
+clr L0
+jmp L31
+m0
+sub 356, @r1
+rts
+dec L45
+add D0, L35
+jsr @r4
+L42: clr L32
+lea D0, L20
+clr L56
+L43: lea L29, @r5
+rts
+jmp @r0
+cmp 474, L42
+add @r4, @r2
+L44: bne L15
+L45: rts
+sub S1, @r4
+L46: rts
+lea L50, L46
+bne @r5
+L47: cmp @r6, L15
+clr @r2
+mov 507, L32
+jsr @r1
+mov L50, @r5
+clr @r7
+clr @r1
+jsr @r1
+cmp L46, @r0
+mov L25, @r0
+L48: cmp @r5, L9
+dec @r4
+mov L11, @r3
+dec @r4
+L49: bne L47
+rts
+add L45, @r1
+inc D0
+L50: bne @r6
+clr @r1
+red L45
+L51: add L57, @r5
+inc L39
+bne @r0
+inc D0
+L52: dec L20
+dec @r5
+lea L43, @r2
+L53: dec @r1
+add L4, @r0
+dec @r3
+L54: clr @r0
+red X3
+bne X4
+mov @r5, @r5
+rts
+clr @r1
+cmp 345, @r0
+L55: rts
+L56: red @r2
+add @r4, L0
+prn @r4
+L57: clr @r6
+sub L12, @r1
+clr @r0
+L58: sub 82, @r1
+dec L59
+red L51
+add 349, @r6
+m1
+clr S6
+red @r1
+m4
+m3
+mov S0, S9
+sub @r1, @r4
+inc L59
+L59: sub D0, @r7
+cmp D0, @r0
+lea D0, L14
+rts
+stop
+D0: .data 148,26,273,216,-207,-272,279,-161,-485,93
+D1: .data -454,-385,256,-105,-395,-108,-390,132,-376,266
+D2: .data 309,-468,186,-13,6,-112,-431,17,-72,10
+D3: .data -498,-231,400,-433,-348,450,-277,-284,301,360
+D4: .data 407,-383,61,-94,399,274,277,-12,-303,-260
+D5: .data -495,229,-243,-183,-347,358,282,280,-440,-74
+D6: .data 130,175,-115,-494,254,460,205,201,50,15
+D7: .data -418,311,-103,-143,455,137,173,-156,-436,-366
+D8: .data -79,-222,184,-196,500,-291,272,-350,-31,429
+D9: .data -424,-199,440,482,169,272,-123,432,-236,-364
+S0: .string "waexj"
+S1: .string "pcp"
+S2: .string "en"
+S3: .string "vcokluwmeppdt"
+S4: .string "qfwkuqexcxxlmbdr"
+S5: .string "bcxpbi"
+S6: .string "hfcigpucrwu"
+S7: .string "egrvptaykvwblbljx"
+S8: .string "kshqalfmuwyaryavtv"
+S9: .string "jxswobwpsh"
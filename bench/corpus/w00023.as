@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r6
+    prn 21
+endmcro
+mcro m1
+    sub @r0, @r1
+    prn 95
+endmcro
+mcro m2
+    sub @r1, @r6
+    prn 66
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 99
+endmcro
+mcro m4
+    sub @r1, @r1
+    prn 91
+endmcro
+inc L0
+add L0, @r4
+clr @r6
+prn 225
+L0: inc L37
+dec @r4
+dec @r4
+L1: dec L1
+cmp -64, L1
+m0
+not @r1
+L2: dec @r6
+jsr @r0
+rts
+m2
+cmp @r5, -237
+rts
+cmp 446, L2
+rts
+mov L1, @r1
+L3: prn 85
+jsr L2
+cmp L1, L3
+red @r3
+L4: red @r3
+jsr L0
+not L4
+bne L2
+add @r5, @r1
+L5: cmp @r7, @r0
+red L4
+lea L0, L5
+jsr L4
+L6: inc L3
+prn L6
+red L4
+bne S1
+m0
+add @r6, @r0
+cmp -508, @r5
+dec L2
+jmp L4
+red L6
+L7: add @r7, L7
+add -8, L7
+sub @r1, L7
+L8: bne S8
+rts
+jsr @r1
+add -78, L4
+dec L1
+dec @r2
+m0
+red L4
+rts
+jmp L2
+m0
+sub 209, L7
+red L2
+lea L8, @r3
+mov @r7, L8
+add L4, @r6
+bne L3
+clr @r6
+not L6
+dec L5
+sub @r1, L0
+inc L2
+mov L5, @r1
+m2
+lea L4, L2
+prn L5
+jsr @r6
+not @r2
+inc @r0
+add L0, L4
+jmp L0
+bne L8
+jsr @r3
+mov -16, L4
+prn @r2
+jmp L2
+L9: red @r5
+add 257, @r5
+L10: lea L10, @r0
+bne L5
+jmp @r4
+mov @r7, @r7
+cmp L54, L5
+not @r5
+m3
+lea L4, L5
+L11: rts
+sub @r6, @r0
+jsr @r4
+add L10, @r6
+m0
+m4
+jmp L4
+clr @r4
+prn L3
+bne @r2
+dec @r7
+jsr @r1
+sub @r0, L3
+L12: prn -384
+L13: clr L13
+add L5, L12
+mov @r5, D0
+jmp X0
+lea L7, L3
+rts
+red L13
+jsr @r7
+jmp L8
+dec L10
+bne L13
+add -47, @r5
+mov @r5, L2
+add L9, L9
+jmp L3
+rts
+m0
+cmp @r6, -17
+m1
+not L7
+L14: lea L1, L12
+prn L8
+inc L9
+inc L13
+bne S6
+inc L6
+L15: dec @r1
+jsr @r6
+cmp @r0, L2
+prn L3
+prn -105
+prn @r7
+m3
+L16: lea L15, L16
+prn @r7
+mov @r6, L12
+L17: clr L8
+jmp L2
+L18: jsr L17
+dec @r2
+add L9, @r6
+mov L17, @r7
+mov L11, L11
+jmp L11
+prn D0
+clr L2
+jsr L7
+jsr L4
+dec @r3
+dec L15
+not L13
+bne @r3
+sub @r5, @r3
+prn L5
+not @r3
+dec @r1
+lea L5, L4
+prn @r5
+L19: dec @r7
+inc @r7
+sub L11, @r0
+not L17
+dec @r5
+L20: cmp -494, 369
+lea L5, L6
+m2
+jsr @r3
+mov @r6, @r3
+m0
+clr @r7
+mov 180, @r6
+rts
+jsr L15
+lea L11, @r5
+m4
+L21: lea L19, @r3
+rts
+prn -137
+L22: lea L20, L4
+L23: rts
+not L23
+cmp L5, @r0
+cmp X1, L2
+dec @r0
+inc D0
+jmp @r4
+red L15
+m3
+cmp L10, @r0
+m4
+lea L0, @r3
+rts
+m2
+jsr @r5
+rts
+sub @r5, L4
+mov @r7, D0
+L24: inc L19
+lea L17, @r2
+sub -220, @r5
+sub L19, L18
+red L24
+L25: jsr @r2
+dec L24
+red @r7
+L26: dec L12
+rts
+jsr L17
+L27: lea S6, X2
+mov L3, L2
+m3
+prn S8
+not @r0
+red L25
+mov -34, @r7
+not D0
+mov @r3, L16
+prn 357
+red @r0
+jmp @r6
+mov -238, L9
+not L0
+add L27, @r2
+L28: clr L12
+prn L17
+m3
+prn 215
+lea L21, @r3
+add L19, @r7
+red L13
+cmp @r5, L27
+jmp L19
+jmp L14
+bne L25
+clr L12
+cmp L17, @r0
+inc @r3
+L29: mov -75, D0
+m3
+red L23
+m1
+sub @r6, @r0
+mov L14, L19
+sub S1, @r2
+lea D0, L20
+jsr L1
+m2
+jsr @r3
+L30: prn L18
+inc @r0
+red L0
+clr L19
+L31: add @r3, L16
+mov @r2, L2
+m0
+jmp @r4
+rts
+jmp @r0
+mov L2, @r5
+bne @r3
+prn 250
+dec @r4
+mov @r5, @r1
+L32: lea L25, L29
+rts
+cmp L28, 431
+L33: rts
+inc @r0
+mov 53, @r1
+prn 257
+red L4
+add @r4, @r6
+L34: cmp L22, -405
+mov -113, @r1
+m4
+prn L17
+L35: dec L19
+red @r2
+m1
+L36: red @r5
+sub @r2, L27
+L37: red @r5
+jmp L11
+sub 40, @r3
+inc @r2
+red @r2
+mov L1, @r6
+sub -200, L17
+L38: lea D0, @r6
+m1
+rts
+inc @r2
+L39: sub @r2, @r0
+jmp L8
+rts
+L40: clr L33
+dec @r2
+red L17
+jmp L29
+L41: add L16, @r3
+L42: not @r1
+L43: prn -505
+dec @r7
+inc @r1
+cmp -381, 193
+L44: not @r2
+lea L26, L15
+cmp L5, L3
+clr @r4
+inc L21
+jsr S1
+inc L39
+red @r2
+lea L8, L7
+cmp 457, @r7
+m4
+clr L12
+L45: cmp 205, @r2
+jmp L55
+sub 367, L38
+jmp L45
+not @r2
+prn @r0
+inc @r3
+bne L36
+prn L10
+dec L12
+m1
+jmp @r4
+m0
+rts
+m1
+inc @r5
+red L40
+jsr L30
+sub 167, @r2
+prn @r1
+L46: prn @r3
+m4
+L47: dec L2
+jsr L58
+inc @r7
+clr @r6
+not @r5
+L48: prn 416
+bne L39
+L49: jmp @r1
+L50: jmp L57
+jmp @r4
+lea L53, @r6
+dec L55
+cmp @r0, -327
+prn L28
+m2
+m3
+lea L11, @r3
+jsr L20
+sub S8, L20
+L51: jsr @r1
+dec L53
+bne @r4
+dec @r6
+not @r5
+m3
+L52: cmp -217, L57
+add D0, L29
+inc @r2
+inc @r2
+m4
+red L45
+rts
+L53: dec L12
+sub L59, L16
+L54: jsr S1
+jmp @r0
+inc @r0
+jmp L21
+cmp L39, -442
+L55: rts
+cmp 319, -63
+clr L28
+jmp L34
+cmp -295, L2
+prn @r5
+sub L6, @r2
+jmp @r2
+rts
+m0
+prn @r0
+sub L48, L5
+m1
+clr L35
+m1
+dec @r7
+rts
+clr @r5
+rts
+L56: not @r2
+L57: red @r6
+cmp 294, @r6
+prn @r1
+cmp L15, @r3
+mov 447, @r5
+add -248, @r6
+lea S0, @r4
+dec @r1
+cmp @r7, L26
+L58: jsr L10
+lea L7, @r6
+jmp @r1
+not @r3
+rts
+add -337, L20
+jmp @r0
+add L27, L12
+clr L59
+m1
+sub @r0, D0
+L59: lea D0, D0
+dec X3
+prn S5
+cmp L20, @r5
+clr L51
+jmp @r1
+red L7
+red @r0
+prn @r7
+not D0
+rts
+rts
+prn S8
+mov X4, D0
+prn S8
+mov D0, S9
+stop
+D0: .data -222,48,-344,-214,253,450,-288,466,-88,472
+D1: .data 66,-110,-280,101,103,-445,464,65,-146,265
+D2: .data -197,-33,102,266,279,-442,-354,490,455,-130
+D3: .data 372,-41,-147,-254,245,97,-3,-136,-148,-2
+D4: .data -306,180,-377,445,258,-397,-70,212,318,-124
+D5: .data 453,-298,121,-192,-351,197,-113,-386,-38,12
+D6: .data 363,-225,44,-195,-175,467,485,232,-450,278
+D7: .data 79,472,213,116,-62,-295,484,422,-254,-166
+D8: .data 478,199,-410,-381,-89,154,-246,91,140,-234
+D9: .data -316,-2,202,408,-292,168,257,60,220,-389
+S0: .string "eo"
+S1: .string "movhkpffzvvio"
+S2: .string "xansawkk"
+S3: .string "oxox"
+S4: .string "pblnbanmnkcza"
+S5: .string "zpmucwcnwpe"
+S6: .string "vbbtggdxxouvmep"
+S7: .string "loucvcssxwgjmcpq"
+S8: .string "braquqvqdtyradgtyqcv"
+S9: .string "plbcbbwh"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r1
+    prn 59
+endmcro
+mcro m1
+    sub @r4, @r2
+    prn 93
+endmcro
+mcro m2
+    sub @r3, @r3
+    prn 32
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 75
+endmcro
+mcro m4
+    sub @r3, @r7
+    prn 15
+endmcro
+jsr @r0
+L0: jmp L0
+add @r1, @r4
+m3
+rts
+jsr @r7
+L1: jmp @r1
+jsr L0
+cmp L1, @r6
+L2: prn @r1
+not @r3
+clr @r2
+jsr L0
+lea L0, @r3
+m3
+jmp L0
+not @r5
+clr @r4
+add L0, L0
+sub @r4, L0
+jsr @r2
+L3: lea L3, L3
+dec @r6
+jmp @r0
+add L0, @r3
+red L2
+rts
+not @r1
+sub @r7, @r6
+L4: mov 183, L3
+prn 393
+cmp L2, 434
+cmp 108, L0
+rts
+inc L1
+red L2
+m1
+jmp L3
+L5: clr L2
+lea L0, @r0
+lea L4, L2
+bne L2
+jsr L3
+inc @r2
+red L3
+sub @r7, L2
+rts
+rts
+L6: not @r6
+cmp @r5, L3
+L7: prn @r6
+sub L0, L2
+lea L3, L6
+prn @r5
+cmp @r3, @r7
+cmp @r4, L0
+rts
+add L2, L2
+m2
+m4
+clr @r6
+m3
+rts
+m4
+dec D0
+m3
+prn -226
+inc L2
+red @r5
+m3
+inc @r1
+jsr L3
+mov L4, @r2
+m1
+clr @r2
+bne L5
+dec @r3
+dec L5
+jsr L1
+sub @r2, L4
+bne L3
+mov L6, @r0
+dec L7
+add L5, @r5
+lea L0, @r0
+jmp @r5
+inc @r6
+inc @r7
+m0
+bne @r2
+cmp -67, -398
+clr L1
+inc @r0
+m3
+lea L7, @r3
+bne @r0
+sub L7, L7
+not L1
+L8: sub 67, L23
+sub @r0, @r2
+clr L6
+m0
+dec @r7
+bne @r3
+jmp L0
+red @r6
+red @r4
+lea L6, @r4
+jsr L2
+L9: jmp L5
+L10: add L0, L9
+m0
+prn @r3
+add 112, @r0
+m1
+not @r6
+bne L6
+clr L9
+jsr S2
+add @r2, L10
+bne @r0
+sub @r1, L9
+clr L5
+m3
+bne @r6
+clr L7
+sub L2, @r0
+rts
+L11: clr @r0
+red L2
+m3
+jmp @r7
+mov @r2, @r1
+clr @r5
+cmp -127, -4
+L12: add -16, L10
+inc @r6
+sub 507, @r7
+bne @r0
+sub L9, @r6
+dec @r3
+m0
+L13: not @r4
+clr L6
+cmp @r7, -190
+L14: cmp L10, @r2
+bne @r4
+prn 258
+L15: lea L13, @r4
+inc L48
+cmp L0, 435
+red L15
+mov @r7, @r3
+L16: dec @r7
+inc @r5
+lea L1, L1
+cmp @r3, 126
+sub @r7, L12
+jsr L8
+clr L1
+dec L2
+bne @r2
+inc @r3
+L17: jmp @r0
+prn @r1
+L18: add -367, @r3
+jsr @r3
+L19: not L0
+sub L30, L5
+L20: dec @r0
+red @r1
+m4
+mov L20, L17
+L21: jsr L16
+L22: bne @r1
+not @r4
+red @r7
+jsr @r3
+clr @r7
+add 381, L1
+cmp @r0, @r3
+dec @r4
+L23: red @r1
+jmp @r0
+prn 342
+mov @r7, L6
+m4
+prn L15
+m3
+red L6
+inc @r2
+not @r3
+jmp @r5
+L24: red L6
+cmp L20, 403
+sub @r2, L3
+rts
+red @r5
+not @r6
+clr @r1
+m3
+L25: cmp 503, L14
+inc L1
+prn L21
+mov -59, @r4
+rts
+add @r3, L38
+dec L1
+inc L11
+m1
+lea L10, @r1
+not @r6
+prn L7
+clr @r0
+dec @r5
+L26: jsr L26
+add L25, L12
+dec L13
+sub L11, @r6
+prn 78
+rts
+red L25
+not L8
+L27: cmp L17, -179
+clr @r7
+bne @r2
+L28: dec L58
+clr @r6
+dec @r2
+prn L19
+mov @r1, L47
+mov @r5, L23
+cmp @r3, @r6
+add -146, @r7
+mov 342, L17
+clr L2
+mov @r6, @r3
+rts
+L29: sub X0, @r2
+inc @r7
+dec S9
+not @r3
+dec L9
+rts
+dec S2
+mov -247, L36
+L30: mov @r5, L27
+inc @r1
+dec S8
+dec L23
+sub @r7, @r1
+bne @r2
+m3
+sub 155, L37
+jmp @r3
+L31: add 451, L9
+sub -26, @r6
+m1
+bne L17
+red L0
+dec L24
+mov L6, L14
+not @r5
+lea L10, @r3
+mov L13, L27
+lea L25, L31
+prn @r1
+inc @r5
+m0
+jsr L22
+jsr S8
+dec L19
+add @r4, L2
+inc L12
+rts
+rts
+clr L5
+prn @r5
+rts
+jsr L49
+sub -179, X1
+mov @r7, L15
+clr @r3
+jsr L5
+jmp @r7
+m4
+clr @r1
+dec @r4
+sub @r1, @r6
+add L1, @r4
+cmp L6, -40
+not @r3
+red L26
+jsr L9
+prn L37
+rts
+L32: clr @r1
+rts
+dec @r4
+sub 104, @r2
+mov L17, @r7
+inc S3
+L33: red @r3
+cmp L25, @r4
+L34: cmp L25, 434
+L35: inc L53
+jmp @r1
+jmp @r0
+L36: sub @r1, L53
+clr L23
+clr L22
+red @r4
+cmp -305, @r7
+clr @r5
+dec L17
+clr @r6
+dec @r1
+L37: inc L53
+red @r4
+L38: lea L23, L23
+clr @r7
+L39: dec @r0
+inc L48
+L40: jmp @r7
+not X2
+bne D0
+jmp @r5
+dec @r7
+L41: sub L26, @r7
+jmp L27
+L42: lea L52, @r7
+add @r5, L26
+prn L6
+add L2, @r3
+rts
+prn @r3
+rts
+inc L9
+L43: inc @r1
+sub 376, L36
+inc L16
+clr L47
+cmp -416, L34
+prn S8
+add 6, @r4
+jsr @r6
+clr L30
+clr D0
+mov 483, L17
+cmp L41, L4
+m2
+m4
+m2
+lea L56, @r6
+L44: rts
+jmp @r7
+m1
+cmp -229, @r1
+clr @r1
+red @r6
+inc @r0
+dec @r3
+sub @r6, L54
+m0
+clr @r0
+rts
+lea L6, L23
+mov @r0, L24
+not L39
+not @r1
+red @r7
+not @r4
+rts
+jsr L26
+sub L39, L7
+L45: prn 428
+add X3, @r3
+m4
+cmp -68, -272
+L46: rts
+clr L27
+bne @r5
+L47: rts
+not @r3
+bne D0
+clr @r4
+L48: inc L24
+L49: red D0
+L50: rts
+mov @r2, L44
+cmp L16, -251
+bne L53
+cmp -71, @r1
+jsr L34
+clr @r4
+jsr @r1
+m4
+L51: bne @r3
+inc @r0
+jsr @r2
+m1
+inc L30
+dec @r0
+inc L37
+sub @r1, L4
+jsr @r2
+red L1
+bne L42
+m3
+m2
+cmp -120, X4
+cmp L21, @r0
+cmp L5, @r4
+cmp L23, L12
+L52: not L49
+L53: add -484, @r0
+dec L52
+inc @r6
+m1
+inc @r6
+L54: jmp @r3
+L55: add L27, @r3
+prn -456
+jsr @r5
+add L57, @r1
+L56: dec L6
+add @r1, @r5
+red @r1
+dec @r2
+bne @r4
+jmp S4
+prn 383
+m0
+L57: add D0, @r3
+L58: red D0
+cmp L59, @r3
+red D0
+m1
+L59: bne D0
+bne S0
+stop
+D0: .data 219,-346,-161,-260,-440,4,-274,264,462,-350
+D1: .data 470,-117,-464,485,-23,-53,-30,-65,266,242
+D2: .data 421,-184,220,-194,39,-163,189,-363,79,228
+D3: .data -423,-413,239,-179,-427,-221,-201,56,420,208
+D4: .data -305,-234,447,-468,414,-349,-9,-19,355,-304
+D5: .data 115,-65,-255,-189,11,-375,140,406,446,-39
+D6: .data 172,-349,440,169,-433,-470,-139,-385,-263,-21
+D7: .data 96,-149,-142,402,-96,44,-262,-87,247,437
+D8: .data 227,469,-217,121,-143,-452,-435,-3,-247,24
+D9: .data 23,168,-375,244,482,120,-48,-148,290,-375
+S0: .string "qvzlbzzuuutjfov"
+S1: .string "fewiniso"
+S2: .string "bwmqzdibqnd"
+S3: .string "moicjftrgzryemgnedla"
+S4: .string "vpifrx"
+S5: .string "lorf"
+S6: .string "agledwux"
+S7: .string "dukvjiqvzjwfllm"
+S8: .string "zukdvlpecnxxwb"
+S9: .string "ilqzlzpqwunowybls"
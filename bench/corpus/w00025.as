@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r3
+    prn 29
+endmcro
+mcro m1
+    sub @r1, @r4
+    prn 92
+endmcro
+mcro m2
+    sub @r5, @r1
+    prn 29
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 52
+endmcro
+mcro m4
+    sub @r5, @r5
+    prn 40
+endmcro
+sub @r1, L0
+m2
+dec @r6
+L0: not L0
+m1
+L1: prn @r4
+jsr L1
+add @r3, @r1
+cmp L1, -246
+m2
+not L0
+rts
+clr @r6
+add @r7, L1
+L2: clr L1
+jmp L0
+L3: add @r2, @r1
+red L1
+not L2
+not @r2
+L4: prn -486
+sub -389, @r5
+sub 304, L3
+inc @r4
+prn L3
+dec @r6
+m1
+red @r7
+clr @r0
+L5: not L2
+rts
+add @r6, L5
+add L1, @r1
+m0
+m1
+red L4
+m1
+jsr @r5
+sub @r5, @r0
+m4
+lea L3, L4
+dec L1
+jmp L0
+inc L5
+rts
+prn L2
+prn 451
+L6: dec @r0
+not L2
+red @r3
+cmp @r6, @r2
+cmp -166, @r4
+sub 277, @r5
+lea L1, L3
+add @r3, L5
+clr @r7
+sub -345, @r2
+jmp L3
+prn @r5
+sub -361, L4
+jsr L6
+rts
+L7: dec L0
+mov -468, @r5
+m0
+jsr L3
+prn 197
+lea L1, L48
+L8: lea L5, @r5
+bne @r6
+lea L6, L5
+m0
+bne @r6
+mov X0, @r6
+jsr @r1
+clr L3
+lea L2, L4
+sub 51, @r7
+m4
+m4
+rts
+inc L1
+lea L2, L5
+prn 186
+inc L3
+lea L0, L4
+jmp L3
+prn @r0
+add -359, L6
+sub 510, L3
+m0
+jsr @r7
+bne L5
+L9: cmp 332, -199
+not @r1
+L10: red L4
+m3
+lea L4, L2
+bne @r0
+prn @r6
+jsr @r4
+jmp L5
+bne L8
+rts
+L11: lea L7, @r6
+L12: add L0, L6
+clr L3
+jsr L6
+prn @r2
+not L9
+not @r7
+add @r1, @r1
+inc L9
+jmp @r0
+m1
+lea L3, @r4
+jmp L12
+dec @r4
+add L12, L54
+cmp @r2, -402
+rts
+bne L1
+jsr @r1
+L13: rts
+cmp @r1, S8
+lea L1, @r7
+add @r1, @r5
+add -50, @r2
+cmp -467, @r0
+sub 356, L13
+clr @r6
+cmp L10, @r0
+red @r1
+bne L3
+bne @r0
+jsr L1
+sub 193, L11
+clr @r5
+sub L1, L3
+L14: jmp @r5
+jmp @r1
+red @r7
+cmp @r1, 165
+lea L9, L0
+L15: not L37
+prn @r2
+dec L6
+dec @r7
+m2
+prn -486
+clr @r2
+mov -84, L0
+not L15
+not L9
+rts
+clr @r4
+prn 495
+prn @r4
+add S4, L2
+prn 473
+sub L15, @r3
+mov L11, L7
+L16: mov -184, @r6
+L17: add @r6, @r6
+red @r5
+m3
+bne L5
+m2
+dec L9
+jmp L1
+red L9
+rts
+sub 24, D0
+rts
+dec S8
+dec L17
+prn @r2
+red L11
+clr L15
+L18: red L15
+jsr L12
+m0
+not L1
+red @r6
+jsr L15
+inc L8
+L19: cmp 6, @r0
+dec @r0
+inc @r0
+L20: bne D0
+L21: rts
+L22: rts
+bne L0
+add @r7, L3
+sub 165, @r1
+prn 384
+mov @r3, @r6
+bne L11
+inc L1
+inc @r2
+jmp L21
+cmp @r2, L22
+red L21
+bne @r2
+inc @r3
+cmp -151, @r0
+clr L21
+inc L3
+inc @r0
+jmp L33
+m2
+inc @r2
+not L15
+rts
+prn -478
+L23: add L19, L17
+cmp @r3, L14
+add @r7, @r1
+prn L16
+cmp L22, L22
+L24: add 370, @r5
+jmp L22
+add L20, L45
+bne @r2
+inc @r6
+red @r4
+bne L1
+inc @r4
+L25: sub 348, L39
+L26: clr @r6
+bne L6
+not L3
+red @r2
+jmp L17
+inc L8
+red @r4
+L27: jmp @r6
+m2
+clr L2
+add 264, X1
+sub 366, @r2
+cmp @r0, L6
+sub L9, @r1
+L28: bne @r6
+red L20
+dec @r7
+clr @r4
+sub 437, L25
+bne L19
+jmp @r0
+add D0, @r3
+L29: jsr L20
+prn L9
+rts
+sub 237, @r5
+cmp L11, @r1
+red @r3
+add -167, @r1
+m0
+clr L28
+rts
+add @r7, @r4
+inc L36
+mov L31, L27
+jsr @r7
+jmp @r7
+lea L5, S3
+inc @r3
+jmp L22
+red @r3
+lea L11, L8
+red L6
+add -398, @r4
+dec @r6
+clr @r4
+not D0
+cmp -461, @r7
+rts
+lea L23, @r4
+m1
+inc L15
+cmp L10, 12
+jsr L26
+m1
+dec L4
+rts
+L30: add X2, L14
+lea L9, L1
+L31: rts
+sub 77, L9
+L32: jmp L16
+m4
+m1
+mov @r1, L25
+prn @r7
+bne L28
+red L32
+L33: dec L27
+L34: dec @r0
+m1
+cmp 373, -58
+jsr @r0
+L35: red L8
+jsr @r0
+inc L12
+L36: bne @r2
+L37: sub 413, L35
+bne @r3
+clr L50
+m1
+bne @r7
+inc @r7
+add L50, @r0
+clr @r6
+L38: sub @r0, L37
+inc L17
+rts
+inc @r0
+mov L22, @r0
+L39: jmp D0
+lea L9, L13
+clr L31
+m2
+add @r0, L47
+cmp L29, L35
+sub 189, @r2
+mov L23, @r3
+dec L30
+clr S2
+L40: rts
+m4
+m0
+inc L4
+cmp S4, @r1
+L41: mov @r7, @r0
+mov 45, L6
+red @r6
+not @r2
+mov L12, L32
+red L27
+m0
+bne @r5
+L42: prn L39
+dec @r5
+clr @r6
+dec @r4
+L43: sub @r2, L6
+L44: bne @r6
+m1
+sub @r7, L31
+mov @r0, @r3
+bne @r2
+not L3
+clr L9
+cmp @r4, @r2
+L45: sub L6, L35
+red L35
+cmp -268, @r7
+jsr @r2
+jsr @r7
+L46: cmp L13, @r7
+add 340, L26
+L47: dec L43
+L48: add @r6, L4
+rts
+L49: bne @r0
+inc L43
+m2
+L50: not L9
+lea D0, L27
+add @r6, L43
+prn L35
+add @r5, @r3
+m2
+m0
+dec L47
+inc @r2
+jsr L36
+rts
+mov S3, L43
+rts
+jsr @r2
+L51: sub -421, L48
+red S5
+dec L14
+mov L39, @r7
+dec L25
+L52: sub 466, @r2
+red L2
+mov @r0, @r7
+L53: prn 492
+mov L54, L6
+L54: rts
+sub L51, @r7
+cmp L56, @r7
+m1
+m2
+L55: bne L6
+L56: not S8
+dec @r4
+sub S2, L59
+prn @r4
+red L55
+inc @r4
+add @r5, @r6
+jmp L58
+add -365, L10
+not @r6
+add L58, L22
+mov @r2, L47
+jsr L45
+bne L17
+L57: jsr L13
+bne @r0
+red @r1
+mov L17, @r2
+L58: cmp L40, -435
+m3
+dec @r0
+jmp X3
+inc X4
+jsr @r5
+m3
+mov @r2, L13
+L59: jmp @r6
+rts
+red L6
+sub D0, @r3
+not D0
+rts
+inc @r5
+clr @r7
+jmp @r3
+lea D0, S7
+jsr @r7
+inc @r5
+red D0
+cmp S4, D0
+jmp @r4
+sub D0, @r6
+stop
+D0: .data 377,176,-364,436,320,-26,63,381,16,436
+D1: .data -219,466,247,262,-337,318,134,161,-268,303
+D2: .data 151,442,-479,428,-143,-246,39,76,106,33
+D3: .data -471,443,-327,-172,205,2,-434,-390,-156,220
+D4: .data 342,232,-270,-240,274,-398,-61,136,62,-175
+D5: .data -83,-391,390,311,-164,-273,460,-201,-215,-423
+D6: .data -304,255,-493,427,371,-479,-363,-133,219,4
+D7: .data 328,-99,320,-118,-476,128,359,143,298,-68
+D8: .data 116,488,-50,-63,13,-150,166,-434,474,348
+D9: .data -434,97,-13,154,142,-453,103,-433,-307,199
+S0: .string "xjpultryqkrdvqyc"
+S1: .string "nqlckpwgqxpvqmtefon"
+S2: .string "wsyqbldskh"
+S3: .string "hshgr"
+S4: .string "hhcsoclgyvodd"
+S5: .string "fuiymnfnccr"
+S6: .string "nhmhtzrtzyyk"
+S7: .string "avltls"
+S8: .string "svxzkoafjx"
+S9: .string "vvniyp"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r6
+    prn 68
+endmcro
+mcro m1
+    sub @r5, @r5
+    prn 58
+endmcro
+mcro m2
+    sub @r7, @r7
+    prn 94
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 96
+endmcro
+mcro m4
+    sub @r7, @r3
+    prn 64
+endmcro
+jmp L0
+red @r1
+mov L0, @r0
+L0: prn @r2
+sub @r1, @r5
+sub 272, L0
+prn @r5
+prn L0
+lea L0, @r5
+L1: add 177, L1
+bne L1
+L2: add L2, @r5
+L3: add 109, @r4
+rts
+red L0
+dec L3
+cmp @r1, L2
+cmp L3, -50
+m2
+jsr @r2
+jmp @r5
+L4: not L2
+add -22, @r5
+jmp L2
+inc L1
+jsr @r1
+red @r4
+jmp @r0
+m4
+rts
+not L3
+sub 37, D0
+L5: lea L3, L3
+rts
+sub @r1, @r5
+sub 381, X0
+lea L2, L0
+jmp @r3
+jsr L3
+rts
+inc @r2
+red @r1
+bne @r7
+L6: sub L1, L5
+sub S8, @r7
+add @r1, L3
+clr @r3
+lea L5, L0
+jmp @r0
+rts
+L7: inc @r5
+L8: not L0
+cmp 67, L2
+inc L2
+red L4
+inc L42
+L9: red L4
+sub L0, L0
+m1
+jsr L8
+L10: jmp @r5
+mov 315, D0
+jsr @r6
+prn 91
+m3
+cmp -436, @r4
+lea L3, L4
+clr @r0
+red @r7
+rts
+m0
+m0
+bne @r5
+bne L9
+m4
+prn @r3
+inc @r0
+cmp @r2, -243
+sub L46, @r4
+lea L2, L5
+clr L6
+not L4
+lea D0, L6
+sub 267, @r6
+not L8
+red L7
+jmp L4
+add 142, @r7
+jmp @r5
+jsr @r6
+m2
+jsr L7
+lea L2, @r5
+mov L1, L0
+L11: rts
+L12: prn 77
+sub -83, @r6
+m1
+red L3
+jsr @r7
+add L9, @r4
+rts
+sub @r3, @r1
+rts
+prn L2
+lea L10, L3
+dec @r7
+rts
+prn @r7
+cmp L7, 115
+clr L8
+bne @r6
+jmp @r5
+not L8
+prn L6
+mov -507, @r7
+red L11
+jmp @r0
+clr @r7
+red L11
+rts
+not L3
+L13: cmp -372, -387
+m1
+L14: dec @r7
+m2
+red L1
+jsr @r7
+red S3
+bne L2
+not @r7
+bne L6
+m1
+L15: mov -161, @r6
+clr L13
+mov @r6, L14
+dec @r5
+sub S2, L10
+m1
+jmp L12
+lea L10, L2
+clr @r6
+L16: inc L2
+prn 83
+m0
+L17: jmp @r5
+not L7
+L18: lea L3, L7
+L19: bne @r2
+m4
+mov L5, @r2
+jsr @r1
+jsr L11
+bne @r4
+red @r0
+L20: dec L4
+m1
+prn @r5
+rts
+sub L9, L9
+add 21, @r6
+red @r4
+add -178, L6
+sub L4, D0
+L21: prn @r1
+jmp @r5
+mov 256, @r5
+lea L13, L3
+L22: jsr @r7
+L23: lea S8, @r3
+L24: inc @r0
+sub @r0, @r1
+dec @r5
+lea L13, L30
+L25: add L8, @r4
+sub @r0, @r7
+prn @r2
+lea L1, L4
+cmp @r1, @r1
+inc L19
+inc @r7
+m4
+mov @r5, @r3
+red @r3
+not @r2
+jmp L25
+lea L6, L17
+not L6
+add L17, L3
+sub L4, @r7
+prn @r5
+lea L4, @r5
+prn @r6
+inc @r6
+sub 161, L21
+prn -188
+red L18
+red @r4
+red L17
+sub -393, L16
+clr L8
+add L19, L8
+prn L23
+inc @r5
+bne L3
+jmp @r7
+dec @r0
+dec @r1
+L26: jmp @r6
+jsr L8
+dec @r7
+lea L11, L9
+bne @r0
+cmp @r1, L11
+m4
+inc @r3
+red @r5
+clr @r4
+mov @r5, L10
+bne @r3
+not @r7
+jmp @r0
+prn @r3
+m3
+rts
+clr @r1
+inc @r7
+rts
+add @r3, L11
+mov @r0, L5
+add L19, @r5
+m4
+clr @r5
+rts
+L27: sub L42, L20
+L28: dec L28
+lea L9, @r5
+jsr L21
+sub @r7, @r7
+rts
+red L23
+dec @r0
+prn L8
+lea D0, @r6
+L29: dec @r0
+m2
+mov @r5, L25
+L30: bne L39
+add L29, L5
+m3
+not L0
+add L21, X1
+jsr @r1
+add @r6, @r2
+lea L11, L14
+m2
+jmp @r2
+dec @r6
+not L18
+add -85, @r3
+jsr @r6
+L31: cmp L16, @r6
+lea L1, L29
+not @r0
+add @r2, @r6
+L32: dec L13
+L33: inc @r3
+clr @r7
+m4
+inc L1
+prn @r6
+sub 125, L11
+mov -372, L26
+add -356, @r0
+bne @r6
+L34: jsr L53
+sub L9, @r3
+lea S2, @r6
+sub -52, L10
+not @r7
+sub 144, L18
+clr @r1
+m4
+jmp @r5
+L35: jsr L1
+L36: clr X2
+L37: prn -108
+mov L21, L22
+inc S8
+inc @r5
+jmp L18
+rts
+prn @r3
+cmp L58, @r3
+L38: bne X3
+L39: clr @r6
+sub -243, @r2
+prn D0
+inc @r3
+prn -160
+L40: jmp D0
+clr D0
+rts
+rts
+L41: sub @r0, @r2
+m3
+L42: dec @r0
+prn 40
+sub L33, @r2
+inc L47
+inc L40
+jmp @r6
+rts
+m2
+prn 447
+bne L4
+inc L38
+lea L2, L4
+lea L38, @r5
+L43: prn @r6
+inc L5
+rts
+not @r7
+sub L17, L29
+jmp @r7
+dec @r3
+jsr L56
+inc L20
+L44: dec L7
+lea L31, @r4
+rts
+bne @r3
+rts
+m4
+L45: jsr L2
+L46: add 241, L35
+m1
+m4
+red @r3
+m3
+m2
+jmp @r0
+m3
+m2
+inc X4
+L47: not L47
+jsr @r6
+add L27, @r1
+bne S3
+mov @r7, @r7
+mov L26, L19
+clr @r1
+L48: inc L29
+jmp L0
+dec L16
+clr @r2
+mov -322, L1
+sub L3, L21
+bne L31
+add L1, L44
+inc @r5
+bne L4
+bne @r7
+jmp L13
+m1
+L49: clr L57
+jmp @r2
+prn L6
+lea L19, @r4
+bne L44
+add -417, @r3
+bne L49
+cmp @r6, L10
+L50: bne @r4
+red @r3
+L51: mov 87, L23
+mov L57, @r7
+clr S5
+clr @r6
+red L16
+bne @r7
+mov @r7, @r4
+L52: rts
+cmp L43, L36
+sub L11, L3
+lea L8, @r6
+rts
+bne L29
+rts
+m0
+L53: cmp 428, L0
+dec @r0
+clr @r6
+m3
+cmp 118, -200
+dec L42
+sub @r5, @r6
+sub @r3, L33
+sub L7, @r3
+m4
+dec @r4
+not S2
+sub -39, @r5
+L54: rts
+L55: prn L34
+clr @r1
+dec @r5
+bne @r0
+m1
+bne L39
+L56: red L22
+red L53
+clr @r1
+not L14
+jmp @r2
+m4
+rts
+sub -226, @r7
+inc L52
+not @r4
+bne @r3
+L57: red @r5
+prn L58
+mov @r7, L42
+lea D0, D0
+inc L59
+mov D0, S8
+clr @r5
+rts
+jsr D0
+lea L34, L54
+red L52
+mov -33, @r6
+sub 130, D0
+L58: sub 90, @r6
+L59: lea D0, @r4
+rts
+bne S0
+lea S9, @r1
+jsr S3
+stop
+D0: .data 49,203,397,-26,490,-170,125,351,-211,-324
+D1: .data -268,4,-313,-45,139,184,364,175,269,290
+D2: .data 342,-444,317,-277,468,400,189,-442,-187,-16
+D3: .data -429,-115,-450,-39,-448,-175,-35,-85,86,261
+D4: .data 254,321,-37,179,-240,-135,-164,203,282,-363
+D5: .data 402,224,-180,272,479,-346,-289,-152,-286,-171
+D6: .data -253,86,-105,-213,-114,-457,-62,-346,-349,-63
+D7: .data 430,235,277,-144,132,-25,288,216,-284,-304
+D8: .data 253,360,50,-235,458,-355,204,-222,169,-371
+D9: .data -216,-402,-159,-348,-407,-325,-257,-364,410,-247
+S0: .string "drplqxxdinpr"
+S1: .string "fjehpzxi"
+S2: .string "j"
+S3: .string "nwkel"
+S4: .string "jjiroszdl"
+S5: .string "ftjkzxextojvn"
+S6: .string "ivdmpquchazfr"
+S7: .string "dshennzar"
+S8: .string "hgczzvldoyptzuvdu"
+S9: .string "vdyyqooajn"
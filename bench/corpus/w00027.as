@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r0
+    prn 38
+endmcro
+mcro m1
+    sub @r1, @r6
+    prn 57
+endmcro
+mcro m2
+    sub @r1, @r5
+    prn 60
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 72
+endmcro
+mcro m4
+    sub @r1, @r2
+    prn 88
+endmcro
+rts
+jsr L0
+bne @r2
+jmp @r6
+L0: jmp L0
+clr L0
+jsr @r1
+rts
+m2
+red L0
+mov L0, @r5
+sub @r0, L0
+sub 42, @r1
+jsr L0
+mov -367, @r4
+add @r2, @r1
+L1: inc @r4
+add -510, @r1
+sub -136, L0
+add 193, @r6
+jmp L0
+L2: mov @r5, X0
+inc @r4
+mov @r3, L14
+red L0
+dec @r6
+dec L2
+jmp @r0
+rts
+L3: add L3, L0
+add L2, @r4
+jmp S3
+L4: clr L1
+lea L20, @r1
+L5: jmp @r4
+bne @r3
+prn -316
+lea L4, L5
+dec @r2
+prn @r0
+cmp L4, L13
+m2
+add L0, @r7
+not @r3
+red @r4
+L6: sub @r0, @r4
+L7: cmp -407, @r1
+not L0
+clr @r3
+cmp -372, @r1
+add L0, @r6
+add 255, @r1
+mov @r4, D0
+inc L1
+L8: add L5, @r4
+cmp 401, @r2
+add L2, L7
+mov L37, L2
+add 401, @r2
+dec L3
+dec L1
+add L7, @r0
+bne @r1
+not L4
+inc @r0
+clr @r1
+red L3
+clr @r1
+jsr L5
+m3
+L9: jmp @r0
+lea L8, @r6
+mov -3, @r1
+add -434, @r0
+L10: lea L9, @r5
+bne L7
+m4
+prn @r7
+add 115, @r4
+dec @r4
+jsr L8
+jsr @r7
+jmp @r0
+inc L0
+not @r2
+L11: dec L8
+jsr L6
+sub @r0, L9
+red @r4
+red @r0
+inc L9
+rts
+m0
+m0
+rts
+sub 367, @r6
+red L44
+red @r7
+rts
+lea L8, @r3
+add L8, L1
+cmp L11, 100
+bne D0
+red L3
+m4
+red @r6
+red @r5
+lea L19, L9
+jsr L8
+L12: cmp @r0, L10
+m4
+dec @r0
+clr L10
+bne @r3
+jsr @r7
+L13: cmp -90, @r2
+cmp -53, 177
+dec L9
+dec L2
+red L4
+prn L7
+red L1
+jsr @r3
+inc @r7
+dec L2
+add 17, @r0
+L14: inc L14
+lea L53, L14
+L15: dec @r0
+m4
+red @r2
+inc L48
+L16: rts
+sub L1, L8
+cmp 388, L8
+bne @r2
+red @r2
+add @r5, @r7
+cmp 175, -414
+dec @r0
+jsr @r2
+prn -32
+L17: inc L6
+mov 476, L16
+mov -488, L5
+prn @r6
+not L12
+cmp @r2, L1
+jmp @r2
+cmp L15, L3
+inc @r1
+cmp @r0, 77
+m0
+sub @r7, @r4
+jsr @r3
+lea L12, L17
+m0
+jsr @r1
+L18: add 424, @r7
+dec @r4
+prn L1
+clr L3
+inc @r1
+add 134, L4
+prn L0
+dec @r2
+cmp 457, @r4
+mov L10, @r5
+sub -453, @r4
+prn L2
+bne @r7
+lea L6, @r6
+jmp @r7
+clr L1
+red @r3
+red L13
+bne @r2
+L19: add @r5, L9
+dec L17
+mov @r4, S9
+L20: mov L17, L10
+lea L11, L17
+add @r4, @r1
+L21: not @r1
+jmp @r2
+m4
+add L6, @r7
+prn 305
+cmp @r3, 73
+L22: bne L10
+jsr @r3
+L23: jmp L4
+rts
+add -165, @r0
+cmp L9, @r6
+jmp @r5
+red @r2
+rts
+rts
+jmp @r5
+L24: dec L11
+red @r5
+inc L24
+red @r1
+jmp L33
+mov @r6, L23
+m3
+dec L3
+clr @r7
+not L20
+jsr @r4
+dec @r3
+clr @r3
+inc @r6
+L25: prn L52
+rts
+dec @r1
+m4
+prn 31
+red L11
+lea L17, @r6
+sub L17, L2
+lea L17, L18
+L26: prn -89
+m4
+L27: add @r1, @r3
+inc @r7
+L28: mov -115, @r4
+lea L1, L16
+inc L27
+m3
+jsr L55
+L29: not @r1
+inc @r0
+red @r3
+bne @r3
+mov -437, L22
+m2
+clr @r1
+add @r6, L2
+L30: clr L4
+lea L19, @r7
+prn -463
+lea L24, @r5
+m2
+lea S6, L24
+sub @r3, L15
+red @r1
+m1
+m4
+L31: bne L11
+not D0
+jsr @r4
+jmp @r6
+L32: add @r6, @r6
+m3
+m4
+mov 342, L28
+bne L15
+sub 374, L32
+L33: lea L24, L12
+bne @r4
+prn @r7
+bne @r7
+clr L1
+L34: sub @r4, L4
+m3
+m4
+cmp 149, L59
+cmp @r7, L31
+dec L33
+red L18
+dec L3
+L35: prn @r6
+cmp @r3, @r7
+L36: clr @r3
+dec @r5
+L37: rts
+m4
+inc L23
+cmp -293, 451
+L38: cmp @r3, 44
+mov @r0, L21
+jsr L46
+inc S3
+m3
+red @r5
+lea L37, L38
+bne @r1
+not L26
+jmp @r7
+rts
+jsr @r5
+L39: add -60, @r5
+rts
+L40: jsr L26
+sub 342, @r7
+rts
+cmp @r0, 264
+sub @r0, @r6
+mov @r5, @r7
+not @r7
+bne @r4
+L41: jmp @r5
+cmp 132, @r3
+jsr L38
+m1
+inc L7
+m0
+L42: add 437, L9
+add L15, @r2
+cmp 373, L24
+inc L16
+bne L14
+jmp L11
+jmp L17
+not @r6
+not @r7
+L43: sub -23, L26
+L44: rts
+jmp L0
+inc L8
+jmp L30
+clr L43
+red @r0
+add 33, L23
+L45: inc @r6
+jmp @r7
+L46: jmp L35
+m2
+L47: sub L20, L45
+inc L10
+lea L21, @r3
+red L9
+m0
+add @r0, L3
+m0
+sub @r3, L9
+rts
+L48: mov L32, L13
+dec @r7
+sub @r7, @r5
+cmp @r2, @r2
+dec L47
+rts
+L49: bne L48
+m1
+m1
+jmp L40
+cmp L36, -214
+jsr @r0
+jsr L51
+dec @r5
+prn 246
+cmp @r1, L32
+red X1
+m1
+L50: clr @r0
+red L6
+clr L57
+jmp L41
+cmp @r0, L22
+clr @r3
+jmp @r2
+m3
+L51: red S1
+inc L57
+rts
+cmp L55, L18
+mov 94, L4
+clr D0
+inc L37
+inc @r6
+add L49, @r2
+mov L49, S1
+not @r1
+dec @r3
+clr L39
+m0
+bne @r0
+rts
+mov L48, @r1
+not L47
+L52: clr @r4
+inc L18
+clr L50
+bne @r3
+cmp 304, @r1
+jmp X2
+L53: cmp @r7, @r5
+sub -227, D0
+mov 373, D0
+m0
+cmp @r5, L44
+bne @r5
+jsr L10
+L54: sub @r0, @r1
+L55: jmp @r0
+m1
+rts
+rts
+lea L58, L26
+prn L34
+red @r6
+not S0
+bne L58
+lea S3, @r2
+add -147, L31
+jsr X3
+add L6, @r2
+L56: jmp @r0
+sub X4, @r0
+jsr L59
+cmp L57, S3
+L57: rts
+mov 338, @r5
+bne @r3
+red L9
+clr @r7
+m1
+red @r2
+not L59
+inc L36
+L58: cmp L4, @r2
+bne L6
+jsr @r6
+jmp L20
+mov -158, @r4
+jmp L10
+dec L50
+lea L27, @r7
+sub L58, @r0
+add L59, L39
+clr @r0
+m1
+jmp @r7
+jsr L59
+cmp @r6, L20
+L59: rts
+add D0, @r1
+stop
+D0: .data -344,-17,249,214,-225,-322,44,76,-139,-13
+D1: .data 62,256,-427,-115,200,46,488,392,-351,-81
+D2: .data -187,84,245,-36,-472,-128,-212,9,-80,-451
+D3: .data -2,114,465,323,-62,219,364,-477,-318,354
+D4: .data -385,-158,-57,27,389,-304,441,-309,-274,403
+D5: .data 308,411,-397,-231,320,-140,-183,231,128,81
+D6: .data 262,373,-338,-35,-416,-23,174,15,82,-295
+D7: .data 440,206,-142,387,116,-228,195,392,-397,-46
+D8: .data 498,391,485,-160,-486,284,-179,-181,194,-309
+D9: .data 440,187,-347,196,385,400,-84,51,227,263
+S0: .string "haseorc"
+S1: .string "noouiukfrzpx"
+S2: .string "m"
+S3: .string "lojdwfmzad"
+S4: .string "vid"
+S5: .string "w"
+S6: .string "tuvlnvrwcud"
+S7: .string "jzbxsfzeocdhnysn"
+S8: .string "fsaswhsfvavit"
+S9: .string "aidyyjgzw"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r3
+    prn 76
+endmcro
+mcro m1
+    sub @r6, @r0
+    prn 55
+endmcro
+mcro m2
+    sub @r3, @r3
+    prn 25
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 49
+endmcro
+mcro m4
+    sub @r3, @r0
+    prn 13
+endmcro
+L0: not L0
+rts
+rts
+bne @r7
+m1
+not L0
+L1: inc @r7
+sub 510, @r7
+m0
+L2: mov L2, @r2
+m0
+dec L0
+add 344, @r4
+m1
+cmp @r7, @r7
+L3: clr @r5
+jsr @r4
+sub @r3, @r2
+cmp -261, L3
+mov 355, @r5
+cmp @r0, -316
+lea L3, @r6
+add @r1, @r4
+m1
+bne @r5
+jsr L1
+not @r3
+clr @r7
+not L1
+cmp L3, L0
+L4: mov -149, S0
+rts
+clr L0
+sub L1, L4
+L5: clr L4
+m0
+sub 422, L4
+rts
+lea L0, L4
+sub -6, @r4
+jmp L3
+prn -319
+sub -33, L2
+lea L2, @r4
+cmp L4, L3
+not L4
+inc @r2
+inc @r1
+mov 123, @r5
+inc @r4
+L6: clr @r3
+not L4
+L7: bne L2
+clr L7
+m3
+red @r1
+L8: cmp @r4, @r3
+inc @r4
+m3
+inc @r4
+not L8
+L9: bne @r4
+cmp 406, X0
+L10: add @r1, @r7
+rts
+cmp @r3, -339
+red @r5
+red @r1
+not @r5
+L11: sub @r1, L8
+lea L0, @r1
+rts
+L12: clr L8
+jmp @r3
+lea L12, @r2
+jsr @r1
+dec L52
+m4
+not L10
+clr @r1
+inc L2
+add L12, @r2
+lea D0, @r6
+L13: clr L10
+cmp @r1, 215
+add -237, @r7
+L14: not @r7
+mov L9, @r4
+sub @r0, @r5
+add L13, @r6
+m2
+m0
+bne L11
+cmp @r4, L13
+not @r7
+rts
+m4
+inc @r4
+inc @r6
+lea L8, @r5
+cmp @r4, L2
+inc L10
+lea L7, L10
+red L4
+sub -470, @r7
+inc @r4
+bne @r3
+jsr @r4
+add -83, L12
+L15: mov -116, @r6
+jsr L2
+prn D0
+L16: dec L6
+cmp L7, L15
+red @r0
+add @r4, @r2
+sub L2, L14
+sub 96, L15
+m0
+L17: jmp L49
+L18: clr @r3
+rts
+inc @r3
+jsr L5
+m0
+lea L16, @r4
+lea D0, L13
+inc @r3
+m4
+lea L14, L9
+dec L4
+L19: clr L12
+bne @r1
+dec @r7
+L20: not L17
+cmp L16, L8
+rts
+dec L10
+m1
+prn L5
+inc L6
+cmp @r0, 507
+prn -460
+prn L2
+jsr L12
+lea L5, @r0
+inc @r7
+cmp -145, 431
+dec @r4
+jmp L2
+jmp L12
+jsr L19
+red L4
+not L16
+L21: sub @r2, L3
+cmp 454, 279
+jmp @r0
+red @r0
+lea L0, @r3
+add L15, @r6
+m0
+rts
+add @r2, @r0
+m4
+add L1, @r4
+not @r4
+m4
+clr @r4
+prn 275
+add 6, L12
+m3
+add @r5, @r7
+L22: jmp L2
+jmp L13
+dec D0
+L23: jsr @r4
+jsr L0
+lea L2, @r7
+not @r2
+add L6, L22
+rts
+not L10
+bne L22
+L24: bne S2
+mov 169, L8
+L25: mov -95, L23
+not @r2
+inc @r3
+cmp @r5, @r5
+inc @r2
+red @r1
+bne @r0
+cmp S5, @r7
+mov @r4, D0
+dec @r5
+cmp L2, @r6
+m0
+red L22
+bne L6
+clr @r3
+cmp -484, L14
+add L22, L38
+m1
+lea L20, L24
+red @r5
+add @r7, @r4
+mov @r2, @r1
+rts
+red L12
+sub -311, L19
+clr L43
+m0
+bne L7
+mov @r6, L3
+L26: sub @r5, @r6
+jsr L21
+L27: bne L10
+L28: jmp L8
+L29: inc L17
+mov L4, L15
+not L26
+L30: dec @r0
+red @r4
+m1
+add 222, @r5
+dec L10
+clr D0
+red @r1
+L31: prn @r3
+prn L27
+jsr L30
+lea L26, @r4
+red L5
+lea L7, @r3
+inc L17
+lea L10, L26
+not @r0
+jsr L19
+add L15, @r0
+red @r0
+sub @r4, @r7
+lea L20, L5
+jmp L8
+L32: red @r1
+inc @r2
+L33: rts
+dec @r0
+prn L29
+red @r3
+L34: clr @r0
+prn @r4
+rts
+prn L21
+clr L20
+m3
+sub L28, @r5
+red L11
+L35: sub L12, L30
+mov -212, L33
+mov L3, L9
+L36: inc @r7
+prn @r2
+jmp @r1
+sub -121, L16
+rts
+lea L49, L4
+jsr @r1
+m0
+clr L24
+jmp @r3
+L37: lea L13, L31
+rts
+dec L59
+dec L26
+inc L36
+cmp L9, L11
+red L35
+cmp @r5, L4
+cmp L36, -456
+clr @r6
+bne @r6
+clr L6
+dec @r2
+add -74, L26
+mov @r7, L4
+add @r2, X1
+inc L24
+prn -131
+dec L3
+sub 167, @r5
+add @r1, @r3
+cmp @r6, @r6
+red @r4
+add L27, @r1
+not @r5
+m2
+jsr L32
+sub L4, @r7
+m0
+jmp L18
+L38: lea L18, L36
+rts
+bne L33
+not L23
+rts
+jmp L36
+cmp L21, L14
+L39: red @r2
+inc L35
+lea L35, @r0
+dec @r6
+L40: inc L36
+L41: sub L0, L44
+m4
+rts
+m3
+red @r5
+lea L28, L22
+red @r0
+not @r2
+m3
+mov L26, L40
+m0
+prn 269
+dec @r1
+L42: not L23
+prn -350
+inc @r3
+sub L3, L36
+inc @r5
+sub L14, X2
+add X3, L57
+mov L39, L22
+prn L23
+m4
+jsr L6
+clr S2
+jsr @r2
+prn @r3
+not @r4
+sub S7, @r0
+not @r0
+inc L14
+clr @r7
+lea L28, @r0
+L43: red @r1
+inc @r7
+prn @r6
+L44: not @r7
+inc L38
+prn -308
+L45: add @r2, @r6
+m0
+not L14
+bne L50
+clr @r3
+L46: prn L41
+jmp @r6
+red L10
+not L8
+not L53
+L47: not @r6
+L48: dec L6
+red L45
+m1
+m3
+L49: bne @r4
+L50: red @r3
+prn L41
+cmp 213, L8
+mov @r7, L49
+L51: inc @r6
+prn @r7
+inc @r3
+clr L58
+L52: jmp @r1
+not @r3
+lea L15, L2
+add @r0, L46
+L53: clr L48
+jsr S2
+cmp -317, L41
+mov @r7, L34
+prn @r7
+inc @r6
+cmp L59, L32
+mov @r6, L58
+inc @r3
+L54: rts
+lea L29, @r6
+L55: not L32
+prn 159
+bne L45
+mov 444, @r3
+jsr L58
+mov D0, L50
+m4
+lea L20, @r0
+dec @r4
+dec @r7
+lea L59, @r5
+inc @r1
+jmp D0
+bne @r4
+jsr L1
+bne L48
+sub @r1, @r5
+bne L30
+cmp 209, L54
+not @r0
+add D0, L3
+cmp X4, @r1
+lea L18, @r2
+inc @r7
+L56: jsr @r6
+prn -247
+red @r7
+inc @r0
+jmp L2
+clr @r3
+lea L22, L59
+inc @r3
+sub S5, L26
+L57: dec L59
+sub @r2, S9
+sub 43, @r0
+L58: prn @r2
+cmp @r2, @r0
+bne @r7
+cmp @r7, S8
+red @r4
+add 482, L14
+m2
+sub @r0, L44
+dec @r4
+rts
+dec S8
+jsr S6
+m3
+m4
+L59: stop
+D0: .data 249,-462,372,-400,-417,144,-135,-369,163,473
+D1: .data 368,139,229,442,493,252,-290,346,-249,-32
+D2: .data -287,493,495,-19,-395,404,246,249,-454,450
+D3: .data 486,-101,374,164,171,-379,-46,357,9,-130
+D4: .data 284,87,-104,-260,128,1,-173,-55,-230,353
+D5: .data -434,136,-293,255,456,-429,-230,289,-6,-432
+D6: .data 434,-260,274,-124,-103,282,-154,179,-348,48
+D7: .data 76,-252,-194,25,88,390,-420,-106,1,294
+D8: .data -290,189,-135,465,-434,213,-105,320,-174,217
+D9: .data 357,106,109,-132,387,-130,-290,-129,-262,357
+S0: .string "xmwukllmcxxsocvh"
+S1: .string "hzizrkrmkwnkb"
+S2: .string "zhepbfnuxxincx"
+S3: .string "czgzsgwleyf"
+S4: .string "j"
+S5: .string "wacfylnisivjpt"
+S6: .string "nixu"
+S7: .string "nxno"
+S8: .string "ottl"
+S9: .string "ldukvtqvyipekdli"
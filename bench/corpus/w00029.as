@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r6
+    prn 47
+endmcro
+mcro m1
+    sub @r2, @r1
+    prn 54
+endmcro
+mcro m2
+    sub @r5, @r1
+    prn 90
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 25
+endmcro
+mcro m4
+    sub @r5, @r6
+    prn 37
+endmcro
+bne @r5
+L0: add @r3, L0
+m0
+clr @r0
+not @r6
+red L0
+L1: prn @r6
+L2: not L2
+red @r3
+inc L59
+cmp @r5, @r0
+bne L0
+prn 253
+red @r3
+L3: not L2
+bne L2
+lea L1, @r0
+mov L3, L1
+sub -297, @r5
+cmp -113, @r0
+clr L1
+rts
+mov @r5, L0
+m3
+sub @r2, L3
+jsr L2
+lea L1, @r3
+bne @r5
+m2
+bne @r5
+rts
+red @r4
+m0
+rts
+L4: bne L2
+inc @r1
+jmp @r0
+dec @r7
+clr @r1
+m4
+clr L0
+jmp @r0
+rts
+add @r6, @r4
+cmp @r4, @r5
+m4
+dec X0
+jmp @r2
+m3
+mov L0, L3
+jmp L2
+lea L3, @r2
+clr @r4
+dec @r5
+L5: not L1
+inc @r6
+clr @r6
+jsr @r2
+red L4
+L6: mov L4, S6
+jsr @r4
+red @r6
+rts
+m2
+rts
+lea L4, @r6
+L7: mov -2, @r0
+inc L5
+dec @r7
+dec @r2
+jmp @r4
+clr L3
+red L1
+add L1, @r0
+jmp @r7
+sub 98, @r1
+L8: cmp L6, -502
+not L2
+dec @r5
+rts
+cmp @r0, -78
+jsr L6
+not @r6
+add -153, L4
+not L6
+lea L5, @r7
+add -443, L1
+L9: sub @r1, L0
+bne @r4
+L10: sub @r4, L3
+L11: cmp -16, @r7
+dec L8
+L12: bne L12
+not @r7
+dec @r7
+add -478, @r6
+red @r6
+cmp L4, 127
+inc L4
+L13: add -203, L1
+mov -122, @r0
+red @r5
+dec L7
+mov 219, L4
+cmp 205, @r3
+bne L8
+inc @r7
+not @r4
+m2
+cmp @r0, 70
+prn 426
+rts
+L14: prn @r1
+cmp -500, L9
+jsr @r0
+cmp L0, @r6
+m1
+jsr L13
+mov L22, L17
+jmp @r3
+red @r4
+L15: sub @r1, @r5
+m1
+jsr L10
+dec @r6
+cmp -197, @r1
+red @r0
+prn -242
+m3
+not @r2
+add 451, @r6
+L16: prn -15
+sub 3, L11
+jmp L3
+red L11
+sub @r1, @r6
+add @r4, L9
+rts
+cmp 342, @r2
+inc L1
+bne @r0
+dec L5
+inc S8
+clr @r2
+L17: not @r1
+jsr L8
+rts
+prn -249
+cmp @r6, S3
+not @r4
+cmp @r0, @r7
+jsr L31
+L18: inc L5
+sub @r2, L13
+lea D0, L15
+L19: lea L7, @r2
+dec L13
+add L6, @r7
+not L14
+sub L11, @r1
+jmp @r5
+clr @r3
+not L11
+red L16
+m4
+prn L13
+rts
+m3
+L20: sub L3, @r3
+m0
+mov -128, L2
+m2
+lea L17, @r0
+L21: lea L9, @r1
+lea L4, @r6
+dec L20
+mov @r5, @r5
+L22: prn @r7
+dec @r6
+red X1
+dec @r1
+mov L13, L9
+clr @r2
+m4
+not @r7
+sub @r6, @r6
+lea L22, L13
+L23: add @r6, L20
+dec @r4
+rts
+lea L9, L19
+cmp @r4, @r2
+lea L4, L22
+L24: dec L12
+dec @r7
+not @r5
+add L20, L15
+jmp @r5
+cmp 86, L23
+red L12
+lea L16, L5
+mov L20, L1
+cmp L10, L12
+m2
+sub @r3, @r2
+red L12
+m1
+jsr L4
+L25: mov @r4, @r5
+red @r0
+bne L16
+not L38
+L26: mov @r0, @r0
+L27: clr @r1
+bne L1
+add -455, L19
+rts
+bne @r4
+not L20
+L28: not @r4
+add -197, L28
+L29: not @r3
+L30: clr L29
+bne L3
+L31: bne @r5
+jmp @r0
+inc @r0
+rts
+dec L20
+lea X2, @r2
+jsr L18
+rts
+jsr @r3
+red @r1
+L32: prn 149
+m3
+m0
+bne @r7
+L33: sub L1, @r2
+L34: dec L24
+rts
+bne @r4
+sub L59, @r4
+clr @r6
+add @r5, L34
+m1
+clr S7
+mov L8, @r7
+mov -434, @r7
+jsr @r5
+lea L32, L5
+m0
+m0
+sub @r6, L2
+jmp L14
+lea L33, @r5
+prn S5
+sub L20, @r6
+m2
+jsr L18
+prn L11
+sub @r3, @r6
+cmp L4, @r6
+m2
+dec L15
+clr @r7
+sub -67, @r1
+prn L25
+L35: clr @r7
+dec L26
+add @r3, L20
+jsr @r2
+prn -350
+sub @r6, @r3
+mov @r0, @r1
+prn L31
+red @r4
+rts
+L36: dec L14
+add @r7, L17
+not L6
+dec @r3
+lea L2, @r2
+add L21, L10
+add @r7, L18
+m3
+lea L23, @r5
+sub -192, @r3
+clr @r3
+L37: jsr @r4
+L38: prn @r7
+rts
+L39: mov @r0, @r2
+mov L31, L33
+L40: clr L12
+lea D0, L0
+jmp @r4
+clr @r5
+sub 31, @r3
+clr @r4
+inc L3
+jsr L13
+lea L58, @r2
+cmp L7, L10
+m0
+dec @r1
+bne L5
+inc L24
+jsr @r2
+rts
+lea L0, @r4
+L41: jsr L40
+red L36
+dec L39
+cmp L0, @r6
+L42: prn @r0
+inc S9
+inc @r4
+sub 181, @r3
+L43: jsr L3
+inc @r4
+L44: inc @r0
+bne X3
+bne S1
+prn @r6
+cmp -80, @r5
+L45: dec @r0
+mov 327, L26
+mov 475, @r7
+clr @r5
+cmp L35, 65
+lea L23, L8
+red @r1
+m2
+lea L49, @r4
+jmp L12
+cmp 262, L36
+not @r2
+rts
+sub -126, @r5
+clr @r0
+clr L16
+lea L20, L38
+not @r1
+jsr L3
+red @r2
+mov L2, @r7
+add -451, L30
+rts
+red @r5
+red @r2
+cmp L29, @r1
+rts
+m4
+dec L7
+add -368, L56
+L46: red @r4
+L47: cmp L39, L47
+L48: dec L7
+jmp @r7
+clr L30
+m2
+prn 46
+inc @r6
+L49: lea L42, D0
+clr L34
+mov L41, L19
+m1
+L50: jmp L59
+red @r7
+L51: sub 415, @r5
+m4
+jsr @r0
+not L0
+mov 336, L50
+m2
+clr @r4
+m1
+prn -94
+m4
+inc L3
+dec @r7
+jmp @r6
+L52: lea L9, @r4
+cmp @r2, @r2
+m0
+prn 223
+jmp @r6
+jsr L29
+jmp @r3
+bne @r0
+rts
+mov @r1, L18
+mov @r0, D0
+sub @r7, @r6
+L53: clr L13
+dec @r6
+mov -399, L45
+prn L41
+L54: add -321, @r5
+m0
+rts
+dec @r5
+sub -375, L42
+mov -239, @r0
+L55: cmp @r4, @r0
+lea L22, @r7
+not L45
+cmp @r4, S1
+jsr @r1
+lea D0, D0
+m1
+not @r0
+L56: rts
+rts
+lea D0, L46
+clr L58
+L57: prn 170
+not @r5
+mov D0, @r6
+red S7
+inc @r0
+inc L58
+clr D0
+not @r3
+lea S1, D0
+L58: mov @r6, @r2
+bne X4
+clr L43
+red @r6
+red L59
+cmp L59, @r6
+L59: add 160, @r5
+rts
+m1
+red D0
+not S8
+clr D0
+not D0
+not S6
+stop
+D0: .data 324,-252,-246,78,473,124,-196,23,157,-396
+D1: .data -70,282,-358,133,106,177,467,12,-162,-230
+D2: .data 154,-45,295,297,90,-486,-414,482,258,-230
+D3: .data -109,-159,-110,-206,393,-275,352,416,468,-486
+D4: .data -351,454,356,-294,-180,-413,357,-352,-104,-208
+D5: .data 301,169,191,-364,97,430,-383,86,-311,-467
+D6: .data 206,-268,22,356,104,-444,284,-175,229,-139
+D7: .data 48,227,-193,352,77,-108,21,-315,-40,-57
+D8: .data 466,-137,-230,149,-359,-113,-123,107,191,107
+D9: .data -211,-238,147,-361,-453,-479,270,-316,-159,116
+S0: .string "rhfhebzoovdjrciywe"
+S1: .string "areepjpucxmg"
+S2: .string "ybbbcilahs"
+S3: .string "yniszxiscn"
+S4: .string "dk"
+S5: .string "hihwvjahnjjdckj"
+S6: .string "xgdzwwqol"
+S7: .string "ly"
+S8: .string "ocuszhmkpqy"
+S9: .string "obcpiysalucse"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r0
+    prn 85
+endmcro
+mcro m1
+    sub @r6, @r2
+    prn 52
+endmcro
+mcro m2
+    sub @r0, @r7
+    prn 88
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 1
+endmcro
+mcro m4
+    sub @r7, @r4
+    prn 62
+endmcro
+jmp L0
+jmp @r0
+bne L0
+rts
+bne @r1
+clr @r3
+sub @r5, @r7
+lea L0, L0
+mov @r4, L0
+not @r4
+bne @r3
+add @r3, @r1
+L0: lea L0, @r3
+rts
+jmp L0
+add -418, @r1
+jsr L0
+not L0
+not @r4
+add L0, @r2
+lea L0, L0
+clr @r5
+not @r6
+mov L0, L0
+L1: inc @r2
+L2: cmp -377, -311
+sub @r6, @r4
+m4
+L3: clr L2
+clr @r5
+L4: rts
+L5: clr L1
+not @r6
+mov L5, L4
+jsr @r5
+rts
+not L0
+L6: add @r2, L4
+jmp L5
+add D0, @r2
+rts
+prn @r7
+sub L6, @r1
+rts
+inc @r7
+lea L48, L1
+bne L1
+L7: rts
+add -394, @r3
+clr @r4
+cmp @r1, @r7
+prn @r2
+L8: mov L4, @r3
+add @r6, @r4
+red @r0
+jsr L8
+m2
+L9: rts
+red @r1
+L10: jsr D0
+m4
+sub S0, @r7
+cmp 276, L0
+dec @r6
+L11: dec @r0
+m3
+mov @r7, @r6
+cmp @r7, @r1
+m2
+m4
+sub 491, L8
+L12: add @r0, @r5
+rts
+prn -55
+add @r4, S6
+L13: add -74, L0
+sub @r4, @r6
+jmp S1
+m0
+red L1
+jsr @r6
+sub L13, @r3
+L14: red @r7
+add L6, L39
+L15: bne @r4
+cmp 13, L9
+sub L48, @r5
+not L15
+bne S5
+mov @r1, L15
+bne @r3
+dec @r3
+not @r0
+m2
+cmp @r2, 216
+L16: prn @r5
+m4
+jsr @r4
+L17: cmp @r5, 298
+bne L13
+clr L2
+sub 326, @r2
+m3
+red L1
+sub 55, L3
+clr @r5
+bne @r0
+inc L7
+jsr @r5
+not @r3
+lea L16, @r6
+jsr L2
+clr @r6
+jmp @r7
+L18: jsr L3
+L19: jmp L14
+jmp @r2
+L20: dec @r7
+m2
+lea L19, @r3
+add L10, L14
+m0
+clr @r0
+dec L10
+bne L17
+add X0, @r5
+bne L4
+red L5
+inc @r7
+L21: dec @r4
+not L13
+not @r5
+dec L1
+sub L11, @r3
+not @r6
+m3
+m1
+add @r6, @r4
+m4
+dec L16
+dec @r5
+sub L4, @r7
+inc L5
+cmp 412, L4
+clr @r5
+bne L12
+m0
+m1
+m3
+mov L9, @r1
+clr D0
+mov @r6, @r2
+L22: inc L21
+red @r0
+rts
+clr L46
+red @r1
+dec L19
+prn @r0
+rts
+not @r2
+dec @r2
+not @r4
+dec L14
+bne L5
+jsr L10
+L23: cmp 470, @r4
+L24: rts
+prn 9
+prn @r3
+jsr L1
+inc L3
+lea L21, L16
+lea L21, @r0
+inc @r0
+L25: bne D0
+jmp L23
+dec @r2
+dec L24
+m1
+not @r6
+not @r4
+add @r7, L21
+m1
+red @r3
+lea L6, @r4
+clr @r4
+inc L6
+mov @r1, L41
+prn L23
+add @r7, L2
+dec @r1
+dec L19
+sub @r7, @r5
+L26: prn -95
+rts
+add 332, L13
+L27: clr @r4
+bne @r6
+bne @r6
+L28: rts
+jmp L7
+m1
+inc L22
+not @r4
+cmp -187, @r4
+m1
+not @r3
+L29: not @r1
+clr @r3
+mov L23, L21
+m0
+prn @r3
+inc L11
+m1
+L30: cmp 87, 353
+m4
+prn -76
+prn L15
+rts
+m3
+not @r2
+lea L0, L6
+L31: dec @r6
+cmp @r4, @r0
+L32: clr L26
+L33: not @r4
+bne @r2
+not L20
+bne S4
+not @r7
+prn @r6
+red @r3
+lea L16, @r1
+lea L9, @r3
+red @r5
+sub L35, L3
+lea L0, @r0
+jmp @r4
+L34: cmp L4, -311
+dec @r3
+L35: mov @r6, @r5
+L36: mov 178, @r2
+cmp @r5, @r7
+not @r7
+m0
+add L3, L7
+m4
+cmp @r2, 458
+jsr L22
+red @r5
+mov 492, @r2
+L37: bne L24
+jsr @r7
+inc @r7
+clr @r3
+inc @r4
+m0
+bne @r7
+red @r3
+m3
+cmp -114, L2
+add @r6, L36
+rts
+bne @r7
+L38: jsr L14
+dec @r7
+inc @r6
+m4
+cmp @r0, @r5
+L39: clr @r6
+add -2, L15
+clr L52
+inc L50
+clr @r1
+cmp @r3, -367
+jmp L39
+clr L4
+dec @r0
+add @r1, @r7
+add -288, @r2
+red @r3
+jmp L10
+mov 455, L23
+L40: jsr @r3
+not L15
+L41: lea L17, L0
+cmp @r7, @r6
+cmp L6, 162
+jsr @r2
+jsr X1
+cmp @r2, 436
+prn L40
+red @r2
+sub 30, L32
+add L6, @r5
+sub @r4, L28
+add L31, L36
+add L15, L2
+sub D0, @r6
+lea L23, L23
+sub L16, D0
+L42: inc L30
+mov 215, @r7
+rts
+inc L36
+sub L40, @r3
+cmp 30, @r0
+cmp -60, @r7
+dec L38
+mov @r4, L38
+cmp @r3, L16
+m1
+L43: jsr @r4
+m2
+clr L23
+jsr @r2
+not L6
+not L40
+L44: not D0
+jsr L17
+m1
+sub -353, @r1
+jsr @r4
+prn @r6
+mov L17, L44
+lea S3, @r2
+dec @r0
+not L15
+cmp 202, L26
+add 495, L14
+red @r7
+red L14
+clr @r7
+L45: jsr @r6
+m2
+L46: cmp @r3, -238
+jmp @r2
+red L45
+m0
+lea X2, L27
+not L9
+mov -201, L38
+add @r2, D0
+bne L44
+mov -479, @r3
+L47: inc @r5
+inc L45
+not @r4
+L48: rts
+not @r0
+clr @r4
+red @r5
+add L10, @r1
+jsr L30
+clr @r6
+dec L52
+add L10, D0
+red @r5
+jsr @r5
+L49: lea L5, @r2
+cmp @r7, @r7
+dec @r3
+L50: jmp @r2
+jmp L26
+sub D0, @r4
+add L57, L37
+mov @r1, D0
+L51: prn @r3
+prn 459
+cmp @r4, L39
+jmp L54
+lea L10, @r5
+lea L12, @r7
+clr @r7
+red @r5
+inc L26
+prn @r6
+prn -425
+mov L45, @r1
+sub @r2, L11
+add 272, @r1
+clr L32
+L52: lea D0, L34
+prn @r2
+L53: cmp @r6, L18
+cmp @r1, L42
+bne @r0
+add @r6, L19
+jmp @r2
+inc @r0
+rts
+dec L54
+m2
+not @r1
+jmp L35
+jsr L59
+not @r2
+L54: mov -225, @r1
+lea L27, @r2
+rts
+not L4
+mov @r0, L11
+bne @r1
+not L58
+sub -507, @r2
+dec L28
+m3
+jmp L55
+L55: sub 185, @r1
+mov L50, @r3
+m1
+prn 0
+bne @r4
+bne L10
+bne @r1
+sub S0, @r5
+rts
+sub -272, @r2
+rts
+not @r7
+L56: mov @r5, @r1
+lea D0, L57
+clr L25
+L57: prn @r2
+rts
+sub -182, @r4
+sub @r3, L59
+clr L0
+not L59
+L58: rts
+L59: prn X3
+jsr @r5
+rts
+prn -421
+inc L3
+bne @r1
+mov X4, @r2
+add S8, D0
+m3
+stop
+D0: .data -124,-471,-95,-349,111,-49,-197,194,205,346
+D1: .data 4,136,-109,-491,278,-420,-42,437,158,61
+D2: .data -380,-336,0,354,397,-15,369,-470,-466,311
+D3: .data -327,370,-189,-481,-34,15,-365,365,107,-203
+D4: .data -240,-405,189,31,337,-241,39,-49,-432,338
+D5: .data -398,403,-25,-7,-415,362,-208,-118,226,17
+D6: .data -139,3,145,369,-472,-259,-434,-301,-451,-465
+D7: .data -72,480,27,-363,-234,462,-35,91,-381,-371
+D8: .data 164,-218,449,195,227,56,255,-232,-483,-93
+D9: .data -105,-212,67,-3,-304,-329,-133,-173,-179,-154
+S0: .string "syaksilzlcqaocqygv"
+S1: .string "bmxftypczz"
+S2: .string "taxvzqfs"
+S3: .string "xvyvkn"
+S4: .string "qrgeynzqwyjwoefpthv"
+S5: .string "tdjyqpkupftwj"
+S6: .string "hiuny"
+S7: .string "ctrgdpmafbmzxrc"
+S8: .string "glmhpu"
+S9: .string "uxevqvhfvudviqhmqahy"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r3
+    prn 55
+endmcro
+mcro m1
+    sub @r3, @r3
+    prn 51
+endmcro
+mcro m2
+    sub @r2, @r5
+    prn 53
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 78
+endmcro
+mcro m4
+    sub @r1, @r3
+    prn 86
+endmcro
+rts
+red @r0
+red L0
+not @r7
+prn @r0
+prn L0
+m0
+clr @r3
+prn @r1
+lea L0, L0
+rts
+mov -510, @r1
+sub -258, L0
+bne @r2
+L0: jsr @r0
+m3
+L1: prn @r4
+sub 243, L1
+rts
+cmp 5, L10
+cmp -149, 491
+dec L1
+lea L1, L1
+mov L0, @r7
+dec L1
+cmp 494, @r5
+red @r2
+L2: jsr L0
+red @r1
+L3: add @r6, @r6
+L4: clr @r6
+L5: not @r0
+dec @r2
+add L1, @r6
+jmp S5
+mov @r6, @r2
+m2
+m0
+cmp L1, L4
+jsr L1
+dec L1
+jmp @r7
+rts
+rts
+bne L0
+not @r6
+lea L1, @r5
+inc L2
+inc @r3
+not @r0
+jmp L3
+bne L0
+inc @r6
+L6: add @r1, L0
+dec @r3
+rts
+dec L2
+bne L4
+add 19, L0
+sub @r4, L1
+red @r2
+inc @r0
+red L4
+jmp L0
+rts
+not L6
+lea L5, L6
+L7: sub @r7, @r2
+m1
+L8: mov 485, @r3
+add @r7, @r6
+clr L6
+add @r3, @r3
+red @r2
+add -60, @r7
+clr L20
+cmp -430, @r2
+add L38, @r7
+L9: mov L9, @r2
+m1
+sub @r0, D0
+jmp L9
+jmp L48
+cmp @r1, -240
+not @r7
+inc L2
+inc @r6
+L10: sub @r7, L3
+mov @r0, L0
+prn @r3
+prn L3
+sub L8, L6
+jmp @r6
+sub 74, L5
+L11: sub L11, @r5
+red L10
+L12: not L4
+lea L9, @r7
+m0
+sub L6, @r2
+not L2
+m1
+prn @r3
+m0
+L13: red L6
+jsr @r6
+not L0
+L14: prn @r4
+cmp 90, @r2
+red @r1
+lea L1, @r1
+jsr @r6
+lea L22, L4
+clr L14
+add @r5, @r2
+jsr L8
+inc @r2
+L15: not L10
+mov @r7, L11
+L16: prn L2
+add -3, @r4
+L17: dec L3
+prn -466
+m0
+L18: bne @r5
+jmp @r6
+jmp L37
+inc L10
+L19: rts
+prn @r2
+prn 485
+m0
+clr @r1
+not L0
+L20: rts
+prn @r3
+m2
+jsr L11
+L21: inc @r4
+inc L21
+jmp L6
+m0
+dec L12
+jmp L9
+prn 343
+bne @r4
+cmp L18, 101
+m0
+L22: sub L13, @r1
+jmp @r3
+sub @r5, L0
+m0
+L23: clr L20
+sub 449, @r1
+m3
+jsr @r3
+rts
+prn @r6
+bne L22
+clr @r3
+jsr @r2
+L24: clr @r2
+sub L12, L15
+lea D0, @r1
+jmp L19
+lea D0, L14
+not L5
+m3
+bne L6
+sub @r1, @r0
+L25: bne X0
+m3
+lea S5, L22
+L26: not L25
+prn L16
+red @r6
+inc L15
+red @r3
+rts
+sub @r0, @r1
+cmp @r7, 378
+rts
+cmp 299, @r2
+mov -487, @r3
+L27: clr L22
+m0
+L28: add @r1, @r1
+sub 277, @r2
+jmp @r6
+L29: inc @r6
+mov L26, @r5
+jmp @r7
+m2
+dec @r3
+clr L26
+inc L13
+lea L18, @r6
+jsr L5
+add -460, @r4
+rts
+bne L21
+prn @r5
+m1
+bne @r0
+bne L11
+inc @r6
+jsr L24
+inc L28
+L30: red L13
+clr L3
+red L4
+lea L27, @r2
+L31: add L28, @r3
+L32: dec @r7
+prn L30
+inc @r5
+jsr @r0
+L33: red @r5
+dec @r7
+dec L22
+inc D0
+dec @r6
+L34: not L13
+clr L27
+m0
+L35: add -331, D0
+L36: rts
+L37: dec @r2
+not @r7
+clr X1
+mov -429, L3
+inc @r6
+prn @r7
+rts
+rts
+prn 197
+add -279, L15
+m1
+inc @r4
+add 465, L25
+lea L33, @r6
+jmp @r1
+rts
+not L8
+add -188, @r7
+jmp @r0
+inc @r5
+clr @r1
+jsr L4
+m0
+rts
+bne L11
+add L36, L21
+red L7
+L38: rts
+add @r0, S2
+clr @r4
+lea L38, @r4
+sub @r1, @r0
+sub L0, @r2
+add 473, @r2
+red @r7
+rts
+sub L14, L35
+m1
+L39: not L31
+red L24
+dec L35
+rts
+clr @r0
+bne @r0
+L40: dec S7
+lea L9, L39
+prn L34
+inc @r1
+bne L48
+prn 496
+cmp L22, -505
+lea L7, @r3
+rts
+mov L44, @r4
+m3
+not L34
+prn -371
+bne L19
+bne @r1
+bne @r2
+L41: inc L48
+red L35
+dec L39
+cmp @r7, -273
+prn L36
+jmp L37
+cmp -230, 13
+m3
+red @r3
+rts
+cmp @r0, @r7
+L42: cmp L41, 297
+m4
+m2
+prn L20
+not L38
+jsr S2
+dec L48
+jmp @r4
+sub -469, L51
+rts
+mov @r4, @r2
+jmp @r5
+sub 153, L15
+sub -145, L29
+L43: clr L15
+mov L13, D0
+L44: red @r7
+bne L31
+cmp @r1, S5
+inc @r5
+cmp @r2, @r2
+rts
+bne @r5
+rts
+dec @r4
+L45: red @r0
+m3
+m2
+lea L21, L55
+lea L44, S1
+bne @r3
+dec L2
+m4
+red @r7
+cmp @r2, @r1
+lea L56, @r1
+mov L10, L32
+add -498, L39
+red S3
+bne @r4
+jmp @r6
+clr @r1
+bne L9
+red L42
+add -193, @r3
+prn L45
+m4
+L46: lea L5, @r0
+lea L23, L28
+not @r0
+L47: not @r6
+jmp L24
+rts
+dec @r7
+clr L36
+dec L30
+cmp @r3, L9
+mov L10, @r1
+prn -23
+jsr L36
+jsr L8
+m2
+clr @r0
+dec @r2
+inc @r3
+bne L14
+cmp L8, L35
+bne @r7
+lea L22, @r6
+bne L5
+mov 73, @r2
+jsr @r6
+jsr @r0
+lea L13, L30
+not @r1
+dec @r6
+bne S4
+rts
+rts
+clr L36
+add @r0, L58
+L48: add L43, L2
+jsr L47
+L49: jmp S6
+jmp @r4
+red @r0
+not L31
+sub -367, S3
+lea L17, @r7
+L50: jsr @r7
+red L48
+jmp @r3
+L51: prn @r4
+cmp @r1, L59
+m0
+prn -348
+prn L7
+lea L19, L16
+rts
+L52: add -141, @r6
+red @r3
+prn @r4
+prn L47
+m2
+inc L54
+L53: add L31, L32
+add L43, L8
+L54: not X2
+cmp @r2, @r4
+cmp -35, -423
+add @r4, L57
+mov L35, @r6
+add @r1, @r3
+red L56
+bne L1
+sub L36, L54
+jmp @r4
+m0
+L55: cmp 350, @r0
+prn L59
+jsr D0
+L56: add @r2, @r6
+m1
+jmp L24
+add -259, @r7
+not @r5
+mov L48, L54
+m4
+jmp X3
+prn @r6
+L57: dec L22
+red @r0
+m2
+cmp -485, L47
+red @r1
+sub L54, @r0
+L58: inc @r7
+L59: clr @r3
+jmp L47
+rts
+lea X4, D0
+prn D0
+stop
+D0: .data 99,31,-460,-426,302,404,178,383,7,-223
+D1: .data 129,-143,-259,78,435,2,363,-425,426,5
+D2: .data 202,-343,65,-74,-62,-334,-200,-342,480,269
+D3: .data 269,312,-321,34,215,-158,-42,-177,-496,47
+D4: .data 132,-33,-358,115,-409,50,-352,107,189,450
+D5: .data 37,-235,104,-363,-296,-9,62,388,-289,258
+D6: .data 315,-437,253,419,320,498,-15,362,-371,-213
+D7: .data -173,56,-271,284,108,87,-356,-139,121,-29
+D8: .data 57,-136,193,366,-216,-235,-145,233,-10,-293
+D9: .data -305,68,135,277,188,-24,-249,-260,-368,-497
+S0: .string "gz"
+S1: .string "rdzyytpgolsubto"
+S2: .string "hxtphzhduwajrgld"
+S3: .string "umqbsxiuxw"
+S4: .string "wodrrvjpqopkau"
+S5: .string "bu"
+S6: .string "pvrpbrkjbvocuskem"
+S7: .string "f"
+S8: .string "ffhfwojzblstduit"
+S9: .string "ffyez"
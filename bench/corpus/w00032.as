@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r5
+    prn 93
+endmcro
+mcro m1
+    sub @r7, @r5
+    prn 49
+endmcro
+mcro m2
+    sub @r4, @r2
+    prn 18
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 54
+endmcro
+mcro m4
+    sub @r4, @r1
+    prn 43
+endmcro
+not @r0
+L0: lea L0, L0
+bne @r1
+dec @r5
+mov @r5, L0
+m0
+mov 268, L0
+add 401, L0
+m4
+clr L0
+clr @r3
+L1: mov L1, L1
+sub L1, @r7
+prn @r5
+prn L1
+clr L1
+clr @r4
+sub L1, L1
+not @r2
+dec L0
+L2: lea L1, @r7
+dec @r4
+add @r4, L0
+L3: red @r5
+sub -444, L1
+not @r4
+clr L1
+mov @r2, @r0
+jsr L0
+jmp @r6
+red L2
+rts
+m1
+clr L1
+L4: sub 450, @r6
+L5: cmp @r5, S5
+sub @r3, @r7
+cmp 276, 94
+rts
+L6: jmp @r1
+not L3
+not @r3
+lea L4, L5
+mov @r2, L4
+L7: cmp L3, S3
+mov L5, L4
+inc L4
+bne @r7
+L8: sub -461, @r3
+m3
+L9: bne L3
+jmp @r4
+sub -72, @r4
+clr @r3
+jsr L9
+not @r1
+rts
+L10: prn L6
+lea L2, @r3
+jsr L6
+cmp D0, @r7
+cmp L6, @r2
+sub @r7, L8
+not @r0
+jsr @r4
+inc L6
+not L8
+clr L6
+lea L0, @r4
+dec L9
+sub 322, @r2
+m2
+rts
+m0
+L11: clr L7
+clr @r0
+dec @r2
+lea L11, L0
+mov L0, L3
+bne L11
+sub @r4, @r4
+dec L9
+bne @r0
+clr @r4
+L12: sub 21, L4
+rts
+rts
+dec L6
+not L3
+L13: prn L11
+L14: red L7
+m1
+m2
+add -194, @r3
+add L11, L7
+dec @r3
+dec @r1
+add -420, @r6
+cmp L0, L14
+sub 58, L11
+clr @r4
+add -291, @r0
+jsr @r3
+cmp L14, @r7
+red S7
+add -497, L12
+L15: clr @r0
+cmp -168, -329
+jmp L8
+jsr @r0
+clr L4
+jsr L7
+L16: jmp @r3
+jsr @r2
+m1
+not @r6
+rts
+lea L16, L4
+not L16
+L17: sub @r5, L10
+inc S2
+L18: mov -282, L32
+lea L1, @r2
+m1
+jsr @r0
+mov L16, L11
+sub L9, L13
+rts
+rts
+m4
+add @r2, L17
+L19: not L5
+lea L2, L13
+mov @r1, L6
+add 81, L45
+mov 405, L13
+red @r7
+jmp L9
+sub L0, L11
+inc @r3
+red L22
+L20: bne @r2
+not @r6
+add L1, L8
+lea L20, @r2
+lea D0, L12
+clr L8
+L21: dec @r6
+jsr @r6
+not L0
+m3
+sub @r2, @r1
+red @r5
+rts
+prn @r3
+cmp -275, L17
+L22: mov 361, L5
+clr L7
+clr L58
+L23: lea L57, @r2
+clr @r7
+L24: add L18, L24
+m2
+cmp @r5, @r0
+add @r1, L21
+add L14, @r1
+jmp @r4
+m2
+clr @r0
+mov @r7, @r2
+rts
+bne L23
+not L23
+L25: clr @r0
+jmp L16
+L26: dec @r0
+clr @r7
+L27: not L24
+dec @r0
+jmp @r5
+sub L24, @r7
+m1
+not L7
+clr L56
+bne @r0
+L28: mov -208, @r1
+m1
+rts
+bne L2
+rts
+jmp D0
+add -54, L27
+clr L31
+jsr @r0
+red @r6
+jmp @r3
+prn @r7
+m0
+not L22
+mov -168, L9
+L29: clr L16
+prn L19
+inc @r3
+bne L0
+prn -417
+m3
+m3
+L30: jsr @r3
+cmp 160, L16
+jmp X0
+L31: cmp @r3, -496
+m2
+prn L0
+m4
+L32: prn -252
+prn L10
+m0
+inc @r0
+L33: jsr @r0
+jsr @r1
+lea L14, L8
+rts
+lea L7, S8
+m3
+not L19
+clr @r6
+not @r1
+cmp L9, @r1
+rts
+L34: add @r2, L17
+clr @r2
+red @r1
+mov 112, L6
+prn @r0
+jmp @r3
+cmp L5, L17
+red L26
+not D0
+bne @r7
+jmp @r3
+bne L34
+rts
+add 392, @r4
+mov @r7, @r3
+dec L22
+jmp L32
+prn -461
+mov @r4, @r0
+sub S5, L0
+dec @r3
+inc L19
+dec L33
+prn @r1
+cmp 245, @r3
+rts
+L35: add @r0, L23
+L36: jsr L24
+red D0
+m0
+clr L22
+inc L3
+mov @r6, @r6
+lea S1, L1
+jsr L17
+L37: dec L20
+sub @r3, @r1
+rts
+jsr X1
+inc L22
+rts
+L38: jmp @r4
+dec L3
+red L12
+jsr L24
+add L17, @r0
+add @r0, L26
+m0
+bne L33
+rts
+dec @r3
+cmp -311, @r3
+m2
+cmp 102, L32
+mov @r4, @r3
+add L11, L12
+m4
+cmp L53, L38
+dec @r4
+inc L27
+red D0
+inc L28
+prn @r6
+prn -269
+m3
+mov L26, @r3
+L39: not @r2
+prn @r1
+prn L2
+mov @r3, L34
+prn L15
+L40: inc @r7
+cmp 493, L8
+jmp X2
+jsr @r6
+sub @r1, @r4
+sub 322, @r3
+bne L34
+prn 53
+jsr @r0
+prn 279
+add L34, L35
+sub @r3, @r3
+jsr L17
+L41: sub @r6, @r5
+jsr L16
+bne D0
+prn L30
+red @r7
+clr L5
+mov 213, L39
+dec L21
+jsr L36
+prn 335
+jmp @r7
+bne @r0
+not @r0
+m1
+jmp @r3
+m3
+add @r2, L9
+cmp D0, 227
+prn L48
+inc L0
+jmp @r3
+bne @r6
+dec @r1
+lea L2, L34
+inc @r5
+dec @r7
+L42: cmp 223, L35
+rts
+jmp L0
+m0
+cmp -115, X3
+L43: inc @r7
+cmp @r5, -367
+lea L7, L25
+m0
+jmp @r7
+m4
+red @r7
+rts
+not L18
+jmp L13
+clr L40
+lea L4, @r4
+jsr D0
+jmp @r4
+not @r6
+L44: lea L38, L11
+mov @r1, @r1
+jmp L58
+L45: rts
+mov @r6, @r5
+sub @r6, L54
+not @r6
+not L6
+L46: mov @r6, @r4
+lea L30, L22
+L47: bne @r6
+cmp L25, L21
+rts
+clr D0
+bne L15
+bne L25
+dec L12
+jsr @r7
+L48: add L19, @r7
+lea L15, @r6
+rts
+not L12
+m4
+not @r5
+m4
+sub 269, @r2
+not L0
+jsr @r2
+red @r6
+jmp @r3
+lea L58, S4
+prn @r0
+L49: sub -285, L15
+mov @r5, L38
+mov L32, L13
+L50: inc L11
+clr @r0
+L51: lea L28, L30
+bne L37
+cmp -378, @r4
+mov @r4, L4
+bne L6
+L52: bne L45
+dec L54
+L53: red @r3
+bne @r1
+L54: red @r1
+L55: sub L59, L37
+sub @r0, L50
+jsr L0
+clr L56
+clr @r3
+red L35
+sub @r1, L42
+red @r5
+cmp @r2, L24
+prn @r5
+clr L29
+jmp S8
+prn L24
+m0
+red L9
+jsr @r0
+jmp L39
+L56: jsr L58
+bne S5
+red L57
+L57: lea L35, @r7
+jsr @r5
+rts
+m0
+cmp @r1, @r3
+m1
+sub @r0, L58
+L58: bne L36
+inc L59
+m1
+m3
+L59: clr S6
+dec X4
+jmp @r0
+stop
+D0: .data 437,444,-330,10,-211,457,32,-194,45,-488
+D1: .data 143,374,-172,-289,-348,348,-309,-499,140,-368
+D2: .data 125,-97,410,-21,343,-86,-122,-268,-210,155
+D3: .data 249,381,-61,394,81,-419,91,-180,-93,204
+D4: .data 252,382,-198,348,190,-287,-322,-369,-79,-180
+D5: .data -342,462,101,96,303,487,128,310,321,137
+D6: .data -334,308,14,-176,125,-48,-86,400,115,-14
+D7: .data 192,330,-424,-480,387,-195,387,-23,489,-20
+D8: .data -209,-398,-487,163,184,-244,-382,-471,465,-364
+D9: .data 239,-190,375,-486,-18,-480,-71,-392,283,-263
+S0: .string "zlaedvujlfs"
+S1: .string "lqxrpmeorsdqonw"
+S2: .string "oz"
+S3: .string "fdhebmixiqojbbdw"
+S4: .string "mwuigskkzbarpwmal"
+S5: .string "ao"
+S6: .string "nyjihajuv"
+S7: .string "ykvzsrgjkrosqmqixal"
+S8: .string "dnhtngsafixrxue"
+S9: .string "yefikjxdwhopask"
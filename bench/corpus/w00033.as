@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r0
+    prn 64
+endmcro
+mcro m1
+    sub @r3, @r6
+    prn 48
+endmcro
+mcro m2
+    sub @r6, @r0
+    prn 84
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 30
+endmcro
+mcro m4
+    sub @r6, @r7
+    prn 67
+endmcro
+bne L0
+sub @r4, @r6
+m2
+jmp @r2
+add @r7, @r7
+red @r4
+not @r3
+jsr L0
+not L0
+L0: mov -432, @r2
+add L0, L0
+m0
+inc @r7
+clr @r2
+sub 262, L0
+L1: clr L1
+inc L1
+rts
+sub @r4, @r3
+mov L1, L1
+bne @r5
+sub @r3, @r4
+L2: mov L2, @r7
+not @r0
+rts
+L3: dec L2
+not @r3
+inc L0
+add 104, L3
+prn @r3
+jsr @r5
+add 278, L0
+clr @r7
+jsr @r2
+rts
+clr @r6
+dec @r4
+red @r2
+lea L3, L0
+rts
+sub L1, L3
+sub @r3, @r6
+inc @r1
+not L0
+cmp @r6, @r5
+prn @r4
+clr L1
+rts
+sub @r1, @r5
+m0
+jsr @r2
+dec @r3
+add L1, L3
+jmp @r3
+rts
+sub 295, @r6
+L4: lea L0, L1
+clr L4
+bne D0
+rts
+clr L1
+m0
+lea L0, L4
+add @r2, L4
+jmp @r4
+bne @r5
+bne L3
+m3
+mov -343, L4
+add L43, L0
+inc @r1
+clr L1
+add @r1, L2
+jmp @r6
+m4
+jmp L1
+dec L0
+sub L3, L3
+lea L1, L4
+L5: jsr L5
+m1
+inc @r4
+clr L5
+cmp @r0, 57
+inc @r2
+sub 64, @r6
+m2
+sub @r5, @r7
+m1
+jsr L0
+bne @r7
+red L0
+L6: sub 21, @r0
+m4
+prn L4
+clr L0
+inc L6
+not @r5
+dec L2
+clr S8
+mov @r1, L3
+cmp L4, L2
+mov -505, @r5
+sub 63, L1
+L7: lea L2, @r6
+bne @r2
+jsr S8
+jsr L4
+bne L2
+mov @r6, @r7
+L8: clr L2
+lea L23, L5
+cmp @r5, L1
+dec L6
+clr L6
+L9: jmp @r6
+rts
+m1
+L10: sub @r1, L2
+m4
+mov L4, L2
+jmp L5
+m0
+lea L1, @r1
+sub @r0, @r6
+L11: prn @r0
+jmp @r5
+m4
+rts
+sub 55, L8
+rts
+inc L51
+prn -302
+cmp 113, @r2
+bne @r5
+not L4
+L12: add L12, @r5
+not @r0
+sub @r4, @r6
+L13: sub @r2, @r7
+cmp @r6, -65
+dec @r0
+cmp 329, -141
+L14: jsr L35
+m3
+lea L11, L2
+m4
+mov 101, @r1
+dec L14
+prn L12
+red L14
+jsr L11
+sub @r5, @r0
+m1
+rts
+clr @r3
+L15: not L3
+jmp L10
+prn L5
+cmp L5, 349
+prn @r5
+lea L8, @r1
+L16: inc L14
+clr @r4
+not @r6
+dec @r2
+inc @r1
+rts
+mov @r0, L13
+cmp @r7, 416
+m4
+cmp @r1, 159
+dec L3
+lea L1, L15
+L17: add @r4, @r0
+lea L1, @r2
+jmp @r1
+inc L14
+L18: prn L16
+cmp -242, X0
+L19: jmp @r6
+bne L17
+jmp L7
+jmp @r4
+L20: prn L18
+lea L0, @r2
+rts
+sub 181, L38
+rts
+jmp @r4
+rts
+L21: sub L7, @r3
+L22: inc @r5
+rts
+dec @r2
+dec @r0
+not @r4
+m1
+cmp 103, L21
+red @r6
+inc @r5
+jsr L17
+jmp X1
+rts
+bne L9
+lea L9, @r1
+not L37
+sub S8, @r4
+red L8
+L23: cmp L19, -328
+m2
+inc L6
+rts
+red @r4
+clr @r3
+jsr L2
+L24: sub 299, @r6
+add 482, S8
+add -88, L1
+L25: jsr L8
+red L18
+cmp @r3, L9
+m2
+L26: jmp L5
+mov 39, L25
+inc S4
+mov L6, @r1
+bne L8
+add @r0, @r2
+dec @r3
+L27: cmp @r2, L21
+dec L16
+jsr L6
+prn @r3
+red @r6
+L28: not @r5
+sub D0, L20
+L29: jsr @r4
+mov L28, @r2
+rts
+not @r0
+red @r4
+inc @r4
+add @r2, L24
+m4
+m1
+clr L24
+m3
+not L19
+inc L29
+L30: bne @r4
+L31: bne @r2
+lea L1, @r6
+jsr @r2
+L32: prn @r2
+add @r6, L27
+red @r6
+not @r0
+lea L8, L5
+rts
+lea L20, L18
+add @r5, @r5
+cmp @r5, 435
+bne L14
+lea L11, @r3
+not @r5
+jsr X2
+prn -170
+m4
+bne L24
+L33: bne @r7
+bne @r0
+jmp @r0
+L34: prn @r6
+L35: not D0
+cmp -398, L10
+m0
+cmp L16, @r3
+sub 284, @r2
+not L12
+jsr L16
+not @r1
+prn L33
+L36: sub 4, L5
+L37: add @r2, @r1
+prn 226
+prn L22
+cmp @r5, @r5
+rts
+dec @r1
+dec L2
+jsr L11
+dec @r6
+m2
+L38: mov 104, L35
+bne L26
+inc @r5
+rts
+jsr X3
+L39: lea L41, @r3
+dec L17
+jmp @r3
+L40: lea L4, L1
+jsr @r0
+jmp L18
+m1
+lea L38, L25
+dec @r0
+L41: mov L1, @r2
+lea L6, L31
+rts
+bne @r0
+m3
+add -100, L56
+L42: jmp L18
+prn L0
+red @r4
+m4
+not L49
+red L34
+cmp @r5, @r2
+cmp @r5, -286
+dec L16
+mov L48, L36
+rts
+add -73, L4
+bne @r2
+m2
+clr L42
+clr @r1
+mov 238, D0
+prn @r2
+clr @r5
+L43: mov @r0, @r2
+not @r3
+sub @r6, @r6
+rts
+rts
+clr @r4
+bne @r6
+L44: add L41, @r3
+dec @r2
+prn 431
+m1
+clr @r2
+L45: prn @r1
+prn 317
+jmp @r3
+m4
+clr L49
+L46: inc L23
+bne @r6
+inc @r6
+not @r1
+mov @r7, L20
+red @r1
+lea L16, @r6
+prn -55
+lea L25, L46
+m3
+m0
+L47: lea L52, @r5
+L48: sub 109, L15
+L49: inc @r3
+jmp L24
+mov -34, @r1
+bne L59
+sub 76, L37
+L50: not L29
+lea L28, L11
+prn -263
+mov @r5, L52
+L51: add 245, L14
+sub L32, @r6
+mov D0, @r0
+inc L17
+bne L42
+red L33
+rts
+rts
+jsr @r5
+dec L3
+red L46
+red @r4
+lea L18, L55
+cmp L13, 407
+L52: cmp L59, 288
+mov X4, @r2
+dec @r2
+add -303, L3
+not L15
+add L28, @r6
+add -481, L51
+add L19, @r6
+add @r2, @r7
+rts
+L53: lea L35, @r3
+jmp @r7
+add @r4, @r3
+red L0
+not @r3
+sub @r4, @r1
+m4
+cmp @r1, L18
+jmp @r7
+not @r1
+rts
+clr @r2
+prn -435
+mov -233, L57
+m4
+add -142, L56
+cmp -18, -174
+bne L12
+rts
+L54: sub 454, @r4
+m2
+not @r5
+inc @r3
+add @r1, L21
+L55: dec S3
+cmp @r2, -473
+add @r4, @r6
+inc L58
+jmp @r0
+L56: clr D0
+rts
+jsr @r1
+not D0
+jmp @r0
+m3
+dec @r5
+prn D0
+L57: sub D0, @r2
+L58: sub L59, L59
+lea L59, @r2
+clr @r1
+rts
+jmp L59
+m4
+L59: stop
+D0: .data -281,-150,17,255,-11,295,-83,-26,-208,439
+D1: .data 364,-194,104,386,254,-138,-72,420,-486,117
+D2: .data 18,429,51,53,-183,75,206,-458,-183,-310
+D3: .data -102,396,-462,-112,-462,207,-300,-208,-318,-185
+D4: .data -240,317,435,254,-76,468,51,-194,99,-102
+D5: .data -387,-143,385,284,290,-115,136,-364,-73,-242
+D6: .data 56,-107,399,289,-198,193,-444,360,-408,425
+D7: .data 460,445,-1,-453,439,-395,174,432,-412,-103
+D8: .data -460,487,63,-432,-399,162,325,-21,-414,-392
+D9: .data 455,-324,483,-152,-338,496,137,-114,-271,113
+S0: .string "uhv"
+S1: .string "vkizuksngshknuevwivy"
+S2: .string "yhcyecztpuimq"
+S3: .string "dokigeakrslxwvry"
+S4: .string "tmemmramfbeo"
+S5: .string "ar"
+S6: .string "xqje"
+S7: .string "uchqoa"
+S8: .string "nflyvq"
+S9: .string "wzip"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r3
+    prn 2
+endmcro
+mcro m1
+    sub @r0, @r7
+    prn 14
+endmcro
+mcro m2
+    sub @r0, @r6
+    prn 81
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 75
+endmcro
+mcro m4
+    sub @r0, @r5
+    prn 92
+endmcro
+cmp -75, @r5
+lea L0, L0
+mov L0, L0
+cmp -378, @r6
+not @r5
+m0
+m3
+lea L0, @r5
+red @r4
+L0: not L0
+m3
+add @r0, @r4
+sub L0, L0
+m0
+mov -228, @r0
+m4
+L1: add L1, L1
+add 428, @r4
+bne @r3
+prn 11
+jmp L0
+sub @r1, L9
+bne @r3
+cmp L1, 491
+prn @r2
+add @r1, @r1
+clr L0
+lea L0, L1
+mov -372, L13
+bne @r2
+L2: jmp @r4
+lea L2, @r0
+bne @r6
+L3: prn -53
+add 118, L3
+lea L2, @r0
+prn -85
+clr @r7
+red L3
+bne S2
+cmp 432, @r7
+bne @r3
+jmp @r5
+m1
+L4: jsr L1
+lea L0, L3
+bne L3
+prn @r2
+inc @r6
+jsr @r0
+m1
+mov -109, L4
+red L1
+not @r4
+clr @r5
+L5: red L3
+jmp @r4
+inc @r5
+not @r4
+m3
+mov L28, @r2
+jsr L4
+jsr @r7
+L6: cmp 504, 134
+red @r3
+rts
+cmp L5, @r4
+prn 52
+add @r4, @r2
+L7: rts
+dec L38
+jsr @r5
+L8: clr L8
+red @r0
+cmp @r1, L7
+dec L2
+jsr L8
+jsr L3
+L9: inc @r2
+rts
+add @r0, @r6
+L10: red L2
+dec L7
+L11: dec L10
+cmp @r3, 498
+rts
+mov @r7, L8
+m0
+clr L0
+jsr @r2
+mov L7, L7
+add 332, L5
+jsr @r7
+lea L1, @r7
+mov @r3, @r4
+dec @r1
+bne S9
+rts
+cmp @r5, L4
+jmp @r5
+sub L8, @r2
+L12: bne @r5
+red L7
+m1
+mov @r5, @r6
+jsr @r7
+L13: prn -338
+rts
+cmp @r2, @r6
+L14: rts
+jmp @r5
+prn L9
+mov -496, @r1
+mov L2, L14
+inc @r4
+sub @r5, L6
+dec @r5
+L15: not L13
+not D0
+mov L7, @r3
+dec L15
+add L9, L4
+inc @r7
+inc @r1
+m0
+rts
+inc L12
+dec L9
+bne @r2
+jsr L7
+inc @r0
+bne @r1
+L16: not @r5
+cmp @r7, @r4
+red @r4
+prn @r1
+jmp L15
+jsr @r2
+lea L13, L40
+mov 222, @r7
+red @r2
+bne L16
+L17: prn @r0
+inc L3
+red L3
+inc L7
+L18: add 224, L17
+inc L15
+red @r6
+prn L0
+L19: jmp L0
+red L14
+m0
+sub L16, L18
+mov @r1, @r2
+cmp L17, L10
+sub L2, @r1
+m3
+L20: bne L9
+bne L17
+m0
+add L10, L3
+m4
+sub L4, L12
+dec L8
+jmp @r2
+sub @r7, L8
+add -329, L31
+inc @r4
+inc @r5
+add @r2, @r6
+bne @r6
+sub L17, L16
+m2
+jsr L13
+sub L3, L1
+inc L7
+jsr @r7
+sub 59, @r7
+add @r7, L3
+not @r7
+add S7, L7
+rts
+L21: add @r5, @r4
+m4
+rts
+lea L20, L16
+L22: jmp L9
+L23: cmp @r6, X0
+clr L20
+prn -232
+clr @r2
+jsr @r3
+L24: jmp L24
+m1
+L25: clr @r3
+cmp @r2, @r3
+L26: jsr L15
+jsr @r5
+red @r6
+red @r1
+red @r3
+prn 332
+sub L13, @r0
+sub @r7, L3
+L27: sub 336, L7
+sub -12, L30
+L28: clr @r2
+red @r2
+prn @r7
+add @r1, L18
+jmp L0
+bne L42
+clr @r5
+jmp @r3
+inc @r3
+L29: sub @r5, L12
+not @r3
+bne L13
+mov S0, @r2
+m1
+add @r6, @r3
+m3
+sub -123, @r0
+sub -360, L6
+sub 272, L42
+cmp @r1, @r6
+red L25
+red @r0
+m0
+dec @r1
+cmp L39, @r3
+L30: mov 346, @r5
+L31: sub @r3, L9
+jsr L13
+red L21
+L32: cmp -418, @r3
+L33: prn L30
+lea L3, @r2
+red @r7
+red @r7
+dec @r1
+dec @r6
+L34: rts
+inc L20
+jmp @r0
+L35: mov @r6, @r0
+m4
+mov @r4, L18
+mov L15, L17
+m3
+lea L0, @r3
+not L6
+not @r4
+inc @r1
+lea L21, D0
+bne L9
+jmp @r4
+mov -311, @r0
+cmp 479, L17
+bne @r6
+m2
+lea L17, @r4
+not @r3
+not @r0
+jsr @r4
+not L12
+add L13, @r6
+clr L15
+sub L0, @r4
+L36: lea L48, L34
+jmp @r2
+jmp L19
+L37: not @r4
+rts
+rts
+lea L32, L22
+inc @r2
+cmp 182, -23
+jmp L37
+dec @r2
+prn X1
+prn D0
+rts
+mov @r1, @r2
+red L3
+rts
+L38: prn 344
+sub L31, @r0
+L39: not @r3
+L40: rts
+m0
+L41: prn L27
+cmp L41, L34
+jmp L7
+rts
+mov L28, L53
+not @r0
+jsr L26
+inc @r5
+jmp @r4
+m0
+bne @r2
+jsr @r5
+mov @r6, @r0
+inc @r6
+lea L43, @r7
+inc L29
+red @r1
+m4
+red L31
+bne L18
+L42: add -507, @r2
+m2
+m0
+L43: lea L51, @r4
+dec L32
+rts
+lea L28, L12
+bne S8
+mov L3, @r3
+sub L28, L6
+clr @r1
+add @r4, L12
+rts
+m2
+rts
+lea L28, @r3
+jmp @r2
+jmp @r2
+m3
+cmp L49, L8
+dec L41
+L44: jmp L25
+prn -264
+jmp @r5
+L45: red L41
+mov L13, L33
+lea L39, @r7
+red @r7
+jmp @r5
+L46: prn @r0
+jsr @r7
+jmp @r2
+cmp 308, 347
+L47: rts
+prn 174
+inc L15
+m4
+bne L45
+m0
+L48: cmp -384, @r3
+inc @r4
+jmp @r7
+bne @r0
+rts
+red @r1
+jmp @r7
+mov L46, L23
+rts
+prn 256
+m2
+not @r7
+jmp @r6
+L49: prn @r6
+prn L52
+rts
+jsr @r2
+inc @r5
+mov -147, @r7
+prn 301
+dec @r1
+clr L19
+m0
+red @r0
+clr @r7
+rts
+clr @r2
+L50: add L11, S5
+red @r3
+inc L17
+add -188, L45
+cmp @r3, L54
+L51: add D0, @r4
+prn @r7
+lea L42, @r1
+add 279, L27
+L52: inc L57
+dec L45
+rts
+L53: rts
+rts
+m4
+prn L41
+prn @r5
+dec L20
+L54: jmp L31
+lea L52, @r1
+m1
+add @r0, @r2
+jsr @r2
+jmp @r7
+not @r5
+clr @r5
+rts
+jsr S0
+jmp L59
+inc @r2
+L55: add @r7, @r0
+mov 217, X2
+prn L4
+not L7
+m2
+add 402, L56
+prn L14
+dec L0
+prn L39
+add X3, @r2
+add @r0, L7
+inc @r1
+L56: add L57, @r6
+inc L36
+m0
+bne L59
+L57: clr X4
+inc @r6
+lea D0, L59
+inc @r4
+L58: bne S0
+add D0, L27
+red L53
+jsr L24
+lea L53, D0
+lea L17, L59
+L59: mov 297, @r7
+lea L55, L33
+m2
+sub 381, L38
+inc @r6
+mov S5, @r7
+stop
+D0: .data -250,33,115,393,-413,-252,-315,-311,218,-323
+D1: .data -440,-22,-85,-475,-305,390,-496,-460,372,-65
+D2: .data -73,207,39,-367,30,-306,203,-163,497,-493
+D3: .data 119,170,-350,486,-3,-275,167,-163,-375,-210
+D4: .data -299,161,-109,-330,-486,222,20,189,138,159
+D5: .data -500,266,186,468,-477,273,129,224,55,-260
+D6: .data 457,380,293,99,273,111,35,476,-242,-62
+D7: .data -184,62,11,-19,-356,-215,-206,-135,-91,-470
+D8: .data 457,126,414,131,-119,418,128,-296,-234,-21
+D9: .data 138,251,409,-92,317,6,-417,-407,-354,-285
+S0: .string "bxefxhkibvkpynb"
+S1: .string "oypsfayvo"
+S2: .string "sgxhocxq"
+S3: .string "jkdawmfyyerftoojt"
+S4: .string "kklbfnwm"
+S5: .string "oonhkulytfy"
+S6: .string "xfjqgasyyiu"
+S7: .string "fchjnaiszqkcwtrqzf"
+S8: .string "hqseywncydizkap"
+S9: .string "apyc"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r5
+    prn 72
+endmcro
+mcro m1
+    sub @r4, @r1
+    prn 13
+endmcro
+mcro m2
+    sub @r2, @r4
+    prn 46
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 51
+endmcro
+mcro m4
+    sub @r2, @r4
+    prn 16
+endmcro
+m3
+m2
+m0
+add @r0, @r6
+rts
+L0: prn L0
+not L0
+not L0
+clr @r3
+clr @r7
+m2
+m2
+red L0
+L1: jmp L1
+m0
+prn 270
+bne @r3
+jmp L1
+prn @r5
+jsr L1
+add L1, D0
+mov 20, L0
+lea L1, @r2
+rts
+add L0, @r2
+bne @r0
+bne L1
+m0
+clr L1
+mov L1, @r0
+cmp -60, 391
+sub 348, L1
+clr @r6
+cmp 116, @r0
+jmp L1
+add -508, @r2
+inc @r7
+sub @r0, L0
+L2: add L2, L1
+cmp L1, @r4
+red @r3
+jmp @r3
+clr @r4
+prn -35
+sub @r2, @r2
+not D0
+red L2
+bne L2
+cmp @r5, @r2
+cmp @r5, @r6
+mov -428, @r7
+clr @r1
+cmp L0, @r6
+L3: not L2
+bne @r5
+lea L2, L2
+L4: jmp @r5
+add @r7, @r0
+add @r0, L0
+jsr L1
+bne L1
+inc L0
+L5: rts
+jmp @r5
+inc @r2
+sub L2, @r5
+jsr L0
+dec L2
+not L1
+rts
+sub @r1, L2
+L6: not @r2
+jmp @r6
+dec L3
+rts
+bne L1
+add L1, L31
+jmp L0
+red L4
+clr L0
+dec @r0
+jmp @r2
+jmp @r1
+mov 206, L5
+rts
+m3
+red @r6
+inc @r3
+red L1
+jmp L6
+add @r3, L2
+rts
+L7: inc L4
+add @r3, @r5
+bne L6
+L8: rts
+mov @r3, L1
+mov L7, L35
+rts
+not @r0
+rts
+rts
+lea L2, L2
+bne L4
+red L8
+L9: jmp L6
+cmp L17, @r5
+prn L4
+clr @r4
+mov @r2, X0
+red @r5
+add L1, L5
+cmp @r6, -323
+mov @r5, @r2
+bne @r7
+jmp @r4
+inc @r7
+m2
+red L9
+clr L5
+add @r5, @r6
+red @r5
+lea L0, @r5
+jmp @r7
+jmp L3
+m2
+not @r2
+lea L4, @r2
+lea L7, @r5
+m1
+rts
+add 506, @r3
+jsr @r3
+m3
+L10: not @r2
+m1
+clr @r4
+prn L57
+add S6, @r2
+jsr L0
+L11: bne L9
+jsr L1
+inc @r7
+not @r1
+L12: sub -114, @r3
+m4
+sub 455, L4
+add @r6, @r0
+lea L12, L12
+jmp L1
+m2
+dec @r3
+inc L6
+prn -91
+jsr L10
+mov 23, @r6
+bne @r4
+cmp @r1, L11
+dec @r6
+lea L7, S2
+m0
+lea L3, L7
+rts
+bne L0
+dec @r1
+prn @r0
+red @r1
+rts
+jsr L11
+jsr @r4
+sub 51, L10
+prn L0
+bne @r2
+m0
+not L9
+L13: sub @r5, L7
+add 57, @r5
+rts
+L14: bne L6
+L15: jsr @r3
+L16: jmp @r4
+L17: clr L4
+m1
+L18: bne @r4
+inc L11
+L19: not D0
+clr L19
+inc @r4
+L20: inc L11
+jmp L2
+dec @r0
+clr S2
+L21: cmp 16, -392
+inc @r5
+L22: dec @r4
+add @r6, @r7
+L23: cmp -388, @r3
+m4
+inc S0
+mov @r2, L19
+L24: bne L22
+jmp L23
+cmp L11, 347
+L25: add @r5, @r7
+red @r5
+clr @r6
+bne L13
+not L21
+L26: sub L13, @r7
+mov -439, @r3
+L27: jsr L33
+jmp L26
+rts
+inc @r6
+L28: rts
+dec @r0
+add @r0, @r3
+inc L14
+sub @r1, @r3
+clr @r3
+add 156, @r5
+prn L9
+red L23
+dec @r6
+jmp @r7
+m2
+cmp 295, @r6
+bne L10
+jmp @r2
+jsr @r4
+m3
+cmp @r0, L4
+lea X1, @r4
+add @r3, L0
+L29: sub 313, L12
+bne @r4
+clr @r0
+L30: jmp @r2
+mov L7, L25
+L31: cmp @r4, @r0
+cmp 491, L9
+dec @r0
+not L19
+m2
+clr @r3
+sub @r5, D0
+prn @r0
+not @r4
+rts
+sub -260, L22
+sub @r6, @r0
+sub D0, L10
+add -331, @r7
+m2
+m4
+inc L49
+jmp L16
+mov @r0, @r4
+m4
+L32: dec L22
+inc @r0
+L33: mov L10, L12
+bne L5
+m3
+not L16
+L34: not @r0
+jsr L7
+sub @r2, @r7
+inc @r4
+bne @r2
+L35: mov -318, @r1
+bne S5
+red L2
+jsr @r6
+not @r7
+jmp L4
+prn @r0
+mov -75, L28
+lea L3, @r3
+mov L34, D0
+lea L5, L2
+rts
+L36: cmp L24, @r6
+not @r2
+clr L16
+cmp @r4, -463
+cmp L18, -496
+inc L18
+add -356, @r5
+L37: not @r0
+dec L29
+bne @r0
+m1
+dec L34
+L38: jsr @r1
+prn L19
+prn @r7
+L39: sub L30, @r6
+lea L9, @r6
+L40: dec @r7
+not @r3
+lea L16, @r0
+lea L24, L22
+red L48
+lea L10, @r0
+jmp L27
+mov @r2, @r2
+sub S6, S6
+sub -2, @r3
+red @r1
+L41: jmp L1
+rts
+not L22
+clr L39
+sub L36, L2
+mov @r7, L34
+L42: jsr @r6
+m2
+sub L32, @r1
+jmp L11
+mov -477, L5
+bne L59
+L43: mov @r0, @r3
+rts
+not @r6
+not L10
+bne @r6
+lea L34, L36
+cmp @r2, D0
+L44: inc L7
+jsr @r2
+add L31, L17
+inc L42
+prn -227
+jmp L41
+cmp 254, -439
+m2
+rts
+jmp @r7
+L45: jsr @r1
+cmp L50, @r1
+L46: clr L16
+cmp 342, @r5
+jsr @r4
+m2
+rts
+prn L18
+lea L38, L3
+jsr @r2
+bne @r6
+cmp @r5, @r0
+m3
+rts
+sub @r5, @r4
+m0
+rts
+jmp L2
+rts
+mov @r3, L50
+L47: mov L11, @r3
+jmp L2
+cmp 393, @r4
+sub 259, L39
+rts
+red @r0
+inc @r5
+inc L38
+dec L2
+bne @r6
+add 140, S6
+L48: sub X2, L2
+L49: dec @r4
+prn D0
+m4
+jmp L5
+L50: jmp S9
+mov @r7, L11
+jsr @r7
+clr @r3
+L51: dec L48
+clr @r4
+cmp 377, X3
+L52: sub -106, L43
+lea L1, @r0
+L53: dec L15
+prn @r7
+jmp @r7
+red L20
+L54: red @r5
+add 393, @r3
+jsr S5
+rts
+lea L15, S4
+m2
+m4
+inc L6
+bne @r4
+clr L33
+dec L8
+prn @r3
+lea L2, @r6
+jmp @r3
+inc L10
+not @r0
+not L40
+prn L57
+m4
+sub 400, @r7
+dec @r5
+red L47
+L55: lea L58, @r6
+bne S9
+inc @r3
+L56: not @r5
+mov 64, @r5
+m0
+jmp L6
+not @r0
+dec @r2
+not L37
+not L35
+m1
+add D0, @r3
+L57: mov 356, @r0
+rts
+clr @r4
+inc D0
+lea L58, L39
+rts
+cmp 40, -147
+bne S5
+red L54
+dec L59
+m0
+L58: red @r5
+L59: prn X4
+add S5, L8
+rts
+m4
+lea D0, S6
+stop
+D0: .data -36,-275,178,-197,-375,-474,193,-412,-420,-148
+D1: .data 249,95,-116,-302,186,27,-235,294,395,-85
+D2: .data -141,-245,-471,232,68,122,138,-21,-98,-59
+D3: .data 481,-73,461,351,248,82,51,-89,-91,66
+D4: .data -310,320,322,-486,471,-483,-260,-12,-137,478
+D5: .data -474,56,432,-367,311,-153,357,115,138,-265
+D6: .data 98,13,-427,114,-52,491,-164,173,-410,-332
+D7: .data -200,78,282,-207,-348,420,55,-239,392,173
+D8: .data 339,408,-247,57,-190,46,281,-500,195,-103
+D9: .data -267,381,-296,174,208,-33,105,89,-311,55
+S0: .string "iacx"
+S1: .string "hlv"
+S2: .string "nizqjhazukhwlzpxsnyz"
+S3: .string "cfyfuhs"
+S4: .string "kygoizdwawsywwf"
+S5: .string "bncuqpaxlssisl"
+S6: .string "hnlntsbcnj"
+S7: .string "ihticaklthssq"
+S8: .string "hcj"
+S9: .string "fapfzf"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r0
+    prn 11
+endmcro
+mcro m1
+    sub @r0, @r2
+    prn 11
+endmcro
+mcro m2
+    sub @r4, @r2
+    prn 12
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 28
+endmcro
+mcro m4
+    sub @r4, @r2
+    prn 40
+endmcro
+m2
+bne L0
+bne @r2
+m0
+prn L0
+m2
+jmp L0
+add L0, @r6
+rts
+clr L0
+add -117, L0
+clr L0
+red @r0
+cmp @r0, @r5
+dec L0
+prn @r5
+red L0
+sub L0, @r2
+jmp L0
+inc L0
+not L0
+m1
+mov L0, L0
+sub -415, @r6
+jmp @r4
+inc L0
+L0: jsr @r6
+add -318, @r1
+jmp L0
+mov @r5, L0
+jmp @r6
+sub @r2, L0
+sub @r2, @r5
+mov -253, L0
+red L0
+m3
+add @r0, L0
+prn L0
+add X0, @r7
+rts
+not L0
+mov -378, L37
+L1: dec @r0
+not L0
+dec @r0
+mov L0, @r2
+clr L0
+L2: jmp L2
+jsr L2
+clr @r4
+cmp -3, L0
+red L2
+inc L2
+m3
+lea L0, @r5
+cmp 493, L0
+dec @r7
+prn 313
+not @r7
+clr @r7
+red L1
+mov 213, @r3
+m1
+sub L0, @r2
+L3: rts
+bne L0
+cmp @r5, @r6
+inc @r6
+jsr L1
+jsr @r5
+sub L1, @r6
+clr @r4
+not L3
+mov -116, @r6
+lea L1, L2
+sub L1, L3
+L4: inc @r0
+rts
+L5: sub -258, L20
+not X1
+dec @r1
+cmp -72, L1
+rts
+add L4, L1
+bne L5
+not @r1
+m4
+mov @r2, L2
+rts
+bne L4
+jmp @r0
+bne L2
+rts
+add @r6, L3
+rts
+L6: add D0, S3
+L7: jsr @r5
+add -401, L1
+bne L1
+sub @r3, @r4
+dec @r7
+inc @r1
+add -286, L6
+prn @r7
+jmp L0
+sub 258, L1
+m1
+dec L2
+lea L6, L0
+sub L1, X2
+cmp L0, 262
+jmp L4
+prn @r4
+red L6
+m3
+jsr L2
+not @r7
+mov @r6, L1
+L8: lea L7, @r0
+L9: clr L4
+mov @r1, @r2
+cmp -53, @r2
+jmp L5
+clr L4
+bne @r0
+add 83, @r4
+not @r2
+prn @r1
+cmp @r3, -396
+cmp @r2, L1
+L10: red L9
+lea L3, @r0
+lea L0, @r3
+red L7
+dec L10
+prn 185
+dec @r0
+not L0
+m3
+m1
+not @r1
+jmp L10
+inc L5
+dec L1
+cmp D0, 320
+mov L10, @r0
+m0
+jmp L5
+inc L0
+clr L3
+clr L7
+L11: sub @r7, @r0
+add L28, @r6
+sub L7, @r3
+clr @r1
+lea L7, L5
+bne L9
+m3
+add L7, @r0
+jmp @r7
+L12: jsr @r0
+m2
+jmp L8
+mov @r5, @r7
+jsr D0
+lea L34, L8
+jsr L4
+prn @r7
+mov @r4, @r2
+L13: cmp 438, L4
+lea L9, @r2
+m1
+m3
+prn 355
+prn L8
+cmp @r4, @r2
+cmp S6, 33
+L14: inc @r2
+L15: mov L8, @r1
+bne L2
+rts
+sub @r7, @r5
+cmp @r2, -466
+L16: add -47, @r4
+bne @r1
+lea L4, L12
+clr @r4
+m2
+rts
+L17: dec S9
+jsr L12
+m1
+L18: clr L7
+prn L12
+rts
+prn L4
+red @r2
+add @r4, L11
+L19: mov L8, @r7
+L20: lea L18, @r6
+lea L54, @r7
+cmp -238, L53
+add 64, L8
+lea L12, L20
+sub @r6, @r7
+sub L12, @r3
+add L0, L47
+jsr L9
+jmp L20
+add L15, L15
+dec @r2
+clr @r5
+lea L10, @r1
+cmp L1, @r4
+jsr @r2
+not @r4
+bne @r1
+clr @r6
+m4
+sub -290, L16
+bne L17
+jsr @r4
+prn @r4
+L21: jsr D0
+inc @r7
+lea L2, @r5
+lea S2, L5
+L22: cmp @r5, L6
+L23: jsr @r3
+rts
+jsr L6
+m0
+red L18
+sub 186, @r1
+jsr @r2
+prn L19
+lea L3, @r5
+sub -55, L17
+rts
+clr @r3
+inc @r4
+jmp @r2
+L24: clr @r5
+lea L18, @r4
+add @r5, L21
+add -294, @r3
+L25: mov @r4, @r3
+jsr L44
+L26: clr @r1
+inc L0
+add @r0, @r4
+jmp @r2
+cmp 452, L42
+jsr @r1
+m4
+not @r6
+clr L44
+m3
+L27: jmp @r1
+dec L14
+inc L35
+m1
+sub @r3, @r6
+dec @r7
+dec L16
+m1
+m3
+red L27
+bne L23
+inc L13
+lea L0, L39
+L28: jsr L3
+clr L2
+m2
+cmp @r4, @r1
+rts
+bne L28
+clr @r5
+prn @r7
+lea L2, L9
+dec @r2
+sub @r6, L20
+m1
+add 249, L17
+prn L19
+L29: bne L16
+mov L20, L21
+lea L21, @r6
+clr L25
+jmp L10
+L30: prn 295
+inc L16
+prn -391
+rts
+not @r2
+not L15
+red L18
+m1
+m0
+dec L1
+bne @r4
+clr @r2
+L31: jmp D0
+L32: not @r6
+L33: dec @r7
+lea S2, L13
+lea S9, @r5
+L34: red @r3
+mov @r6, @r5
+rts
+jmp L29
+cmp -435, @r6
+bne @r4
+inc @r0
+L35: cmp @r0, @r3
+rts
+not S8
+not L1
+bne L12
+mov @r5, L26
+prn @r4
+m1
+lea L22, L5
+m0
+red @r1
+clr @r1
+rts
+not L23
+L36: sub L36, D0
+dec L25
+jsr @r4
+L37: prn L15
+red @r3
+L38: prn @r0
+L39: rts
+jsr L1
+jsr L44
+m4
+prn -182
+jmp @r1
+L40: inc L31
+m4
+rts
+not @r4
+rts
+rts
+bne @r1
+L41: prn @r1
+not @r4
+cmp L14, @r3
+L42: sub 392, L39
+L43: jmp L4
+jsr @r5
+L44: clr @r3
+prn L37
+L45: mov L41, L36
+bne @r6
+L46: clr L28
+mov 346, L48
+prn -443
+prn 206
+L47: sub 19, @r7
+jmp @r1
+inc @r4
+red @r3
+L48: prn 324
+L49: not @r0
+add -444, L59
+inc L7
+clr L30
+m4
+prn L45
+jmp @r5
+prn 119
+add @r0, L34
+inc L25
+m0
+m2
+prn -172
+inc @r7
+inc L25
+prn 254
+rts
+inc L41
+clr L40
+jmp @r1
+lea L26, X3
+lea D0, L16
+L50: mov -468, L1
+mov 463, L3
+mov @r1, L4
+red L2
+prn S8
+not S9
+cmp 308, L16
+mov @r4, @r3
+sub L9, @r2
+clr L44
+lea L58, L23
+dec @r0
+m3
+mov @r3, @r6
+prn L10
+mov @r0, L9
+bne @r3
+clr L12
+L51: not @r2
+L52: rts
+rts
+L53: cmp @r4, 417
+jsr @r4
+mov @r2, @r5
+cmp -375, @r2
+sub 213, @r7
+lea D0, L59
+m1
+L54: red L4
+inc @r0
+rts
+mov 442, @r6
+L55: dec @r3
+jsr @r1
+jmp @r1
+L56: cmp L39, -252
+red L25
+jmp @r6
+dec @r3
+L57: jmp L16
+rts
+dec L18
+inc L3
+add @r1, @r1
+L58: lea S5, X4
+prn @r4
+sub @r5, @r3
+sub S7, L13
+dec L59
+L59: prn D0
+m1
+add S7, S3
+stop
+D0: .data 453,-238,467,-35,243,-367,298,281,268,156
+D1: .data 319,-96,-164,-440,-257,-354,-296,-386,-80,-158
+D2: .data 354,-75,450,-440,-316,-268,321,227,-324,67
+D3: .data 381,-118,-494,-494,304,-459,465,-236,-55,-104
+D4: .data -346,-416,184,-210,166,468,-59,-489,-237,-181
+D5: .data -96,-209,116,-491,458,334,41,-141,177,329
+D6: .data 249,480,429,303,263,-476,-246,469,-72,190
+D7: .data -117,19,470,-324,292,-470,-383,399,-423,-186
+D8: .data -365,152,-151,-110,469,-471,-263,165,335,240
+D9: .data 43,-113,459,481,-226,-370,-48,167,214,-139
+S0: .string "viswysuid"
+S1: .string "pm"
+S2: .string "vfnxdnqqmdqdkrbw"
+S3: .string "nokttuuq"
+S4: .string "zxagj"
+S5: .string "mc"
+S6: .string "jpbtyhsxkfzkyi"
+S7: .string "abvujamsregvtqndq"
+S8: .string "curhygybkviodv"
+S9: .string "nwxugbjsrdnriow"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r2
+    prn 81
+endmcro
+mcro m1
+    sub @r5, @r3
+    prn 10
+endmcro
+mcro m2
+    sub @r6, @r0
+    prn 77
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 4
+endmcro
+mcro m4
+    sub @r6, @r0
+    prn 65
+endmcro
+L0: red S6
+L1: lea L1, @r0
+rts
+m3
+jmp @r1
+jmp L1
+jmp @r3
+m0
+not @r6
+inc @r6
+m3
+prn -298
+not S2
+dec L1
+cmp @r6, @r4
+L2: add L0, @r6
+rts
+m4
+jmp L1
+red @r5
+dec @r2
+jmp L1
+lea L2, L1
+jmp @r5
+clr @r3
+m4
+prn L0
+not L2
+inc @r0
+jsr @r5
+mov L0, L2
+cmp @r0, @r6
+L3: bne @r1
+not @r3
+dec @r3
+prn L0
+mov @r1, @r0
+bne @r6
+m2
+jmp @r3
+jsr L2
+bne L1
+inc L3
+dec @r7
+red L2
+not L2
+red @r6
+not L0
+sub -3, L3
+dec @r2
+prn L0
+m4
+jmp @r1
+not @r0
+inc L0
+sub -332, @r1
+lea L1, @r4
+rts
+add @r4, L2
+clr L0
+m2
+rts
+add L0, L0
+inc L0
+sub @r2, L2
+L4: bne L0
+dec L4
+sub L3, @r2
+L5: jsr L33
+dec @r4
+L6: cmp @r0, 421
+dec @r5
+bne @r0
+add @r0, @r3
+jsr L2
+not S5
+red L5
+prn L5
+mov L2, L2
+rts
+add -39, L2
+sub L6, L1
+dec L3
+inc L2
+L7: prn L5
+cmp 303, L4
+bne L2
+L8: lea L4, @r3
+jsr @r4
+add X0, L1
+bne @r5
+clr L4
+rts
+prn 484
+jmp @r3
+lea L4, L5
+L9: add L5, L1
+mov @r6, @r0
+m0
+lea L6, @r2
+jmp L7
+jmp L7
+L10: not L4
+L11: mov L8, L9
+sub L6, @r1
+jmp L5
+L12: rts
+L13: cmp -426, -359
+jmp @r0
+m2
+L14: dec @r5
+rts
+sub L7, @r2
+not @r6
+mov 494, L0
+not L11
+bne @r0
+not @r0
+cmp -285, @r6
+clr @r0
+not @r5
+L15: cmp L12, -242
+add @r3, L0
+mov @r0, @r4
+inc @r7
+L16: lea L6, L50
+clr @r7
+dec L1
+jsr L10
+prn L51
+L17: rts
+red @r0
+rts
+sub -13, @r4
+mov -443, @r0
+cmp L5, 400
+clr @r6
+inc L11
+lea L3, L17
+sub @r7, @r1
+mov @r3, @r4
+bne L15
+jmp L17
+L18: jmp @r0
+inc @r0
+mov L11, L1
+dec @r2
+bne @r2
+bne L15
+m4
+bne L2
+lea L14, @r4
+red @r5
+cmp @r1, @r5
+add L10, L13
+m2
+m1
+sub -200, L16
+L19: inc L0
+cmp @r6, @r4
+bne L15
+jsr @r2
+L20: inc D0
+bne @r2
+bne @r6
+L21: dec @r6
+jmp L13
+dec L13
+prn @r0
+jsr @r4
+m1
+dec L5
+dec L12
+rts
+jmp L14
+rts
+mov 246, L11
+rts
+clr L12
+add @r0, @r1
+sub L3, S9
+mov L11, L12
+m3
+not @r2
+cmp 338, -489
+L22: dec L21
+jmp @r4
+inc L3
+bne @r5
+bne L14
+L23: jmp L1
+L24: rts
+L25: lea L23, @r5
+rts
+mov -340, S0
+cmp L51, L13
+red @r6
+sub L15, @r2
+m4
+m3
+bne L23
+L26: jmp L7
+not L2
+mov L16, L4
+jsr @r0
+m1
+sub @r2, @r7
+m0
+prn @r4
+red @r5
+mov L7, L18
+prn @r5
+red @r4
+lea L13, L22
+jmp @r6
+not @r0
+jsr @r0
+mov -344, L3
+m2
+L27: rts
+cmp @r1, L2
+sub S2, @r4
+L28: lea L23, L22
+rts
+L29: cmp L26, -503
+prn @r5
+m3
+m2
+jmp @r1
+not L14
+inc @r7
+not @r2
+L30: jsr L10
+cmp L0, L26
+dec L18
+clr @r3
+red @r7
+bne @r4
+rts
+inc D0
+m2
+dec L10
+jmp @r1
+prn @r4
+add L24, X1
+lea L1, L28
+m0
+bne L13
+jsr @r0
+cmp -72, -97
+add -436, @r6
+sub 299, @r4
+cmp @r5, 10
+L31: add L25, @r2
+add L2, L18
+jsr @r4
+m0
+m1
+red L12
+not @r4
+mov X2, L16
+lea L54, @r6
+L32: lea L18, @r0
+clr L30
+add @r6, @r7
+prn 72
+rts
+prn -245
+jsr L7
+sub -462, L4
+bne L11
+L33: add @r3, L22
+L34: prn 175
+L35: add L34, @r6
+red L33
+jsr @r0
+mov -501, L30
+sub -176, L0
+bne @r5
+clr L5
+jsr @r5
+mov D0, L26
+m0
+clr @r6
+L36: mov @r2, @r5
+clr L12
+rts
+jmp @r7
+inc L14
+add @r4, @r1
+m2
+cmp 3, @r6
+m4
+dec L1
+L37: sub L3, D0
+rts
+jmp L19
+sub @r0, L24
+lea L7, L25
+sub 112, @r0
+prn @r7
+mov -346, @r1
+prn @r3
+rts
+L38: dec @r1
+clr L36
+inc L0
+add L5, L59
+red @r3
+L39: jmp L55
+m3
+L40: dec @r6
+L41: rts
+m4
+clr @r5
+lea L3, L8
+dec @r5
+jsr @r0
+L42: jmp L38
+mov @r3, L29
+dec @r4
+clr L23
+m2
+lea D0, @r3
+clr @r4
+add L22, @r1
+rts
+cmp 350, -109
+cmp L29, 411
+jmp L2
+L43: clr @r2
+m3
+jsr L27
+add L8, L21
+add @r1, @r0
+dec L2
+dec L20
+rts
+inc @r3
+cmp L43, @r0
+not L35
+add L4, D0
+rts
+L44: prn L20
+mov D0, @r1
+m0
+lea L3, S4
+red @r1
+prn L5
+rts
+clr @r2
+red @r0
+L45: clr S2
+L46: lea L57, L46
+rts
+L47: lea L25, @r5
+jmp @r1
+bne L7
+jmp @r5
+bne L31
+jmp @r1
+inc L48
+add L3, L47
+m1
+mov 254, L58
+add L16, L3
+not L10
+clr @r0
+L48: dec @r1
+not L10
+add 97, D0
+L49: inc @r2
+lea L14, @r0
+L50: prn @r1
+prn L47
+not @r6
+clr @r2
+cmp @r2, -386
+m3
+rts
+L51: not L2
+bne L56
+add @r2, @r0
+jmp @r1
+not @r3
+jsr @r0
+clr X3
+jmp L5
+rts
+L52: sub L54, @r3
+add @r5, @r5
+prn L20
+cmp 108, @r7
+clr L58
+m4
+L53: lea L15, @r5
+cmp L8, -53
+prn L38
+jsr @r0
+jsr @r5
+red L35
+cmp 84, -364
+jmp L40
+m1
+bne D0
+sub L59, @r6
+add @r0, @r7
+L54: cmp -193, -121
+add L38, @r0
+cmp -258, L55
+not D0
+rts
+dec L16
+rts
+add 464, L6
+not S4
+cmp -101, @r6
+rts
+L55: sub @r1, L44
+inc @r1
+mov L16, @r2
+red @r0
+red @r5
+mov -143, L54
+jsr L44
+not L22
+dec @r7
+m0
+prn L39
+rts
+L56: lea D0, L13
+L57: jsr @r6
+L58: jmp @r6
+dec L47
+bne S9
+m1
+dec X4
+add L59, D0
+L59: red S8
+lea S9, @r2
+stop
+D0: .data -3,48,63,-23,64,-419,-53,139,-49,-315
+D1: .data -83,205,-379,319,-249,-106,-349,234,-448,420
+D2: .data 367,99,-106,-349,419,267,74,257,108,-209
+D3: .data -421,-384,300,485,-75,-100,329,116,-489,-244
+D4: .data 202,487,257,-34,-113,-162,192,176,-385,387
+D5: .data -104,-383,300,-336,-171,-90,-57,-397,123,-419
+D6: .data 259,458,188,381,-11,419,-339,-443,-56,421
+D7: .data -487,66,-432,-11,480,-482,-124,185,-266,-347
+D8: .data 340,-75,446,196,-477,287,405,-357,-25,-229
+D9: .data -173,206,-36,270,-484,203,-407,488,300,345
+S0: .string "gblmsgyyamhaaqrguozg"
+S1: .string "jkjtzfsagedtlak"
+S2: .string "delxuciembmdqoe"
+S3: .string "muwulcj"
+S4: .string "jlmbcuigqfbrx"
+S5: .string "vfc"
+S6: .string "u"
+S7: .string "hxcmhpa"
+S8: .string "jponuhcyndslaqxhpbn"
+S9: .string "qmwojgn"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r5
+    prn 19
+endmcro
+mcro m1
+    sub @r1, @r4
+    prn 8
+endmcro
+mcro m2
+    sub @r0, @r6
+    prn 42
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 80
+endmcro
+mcro m4
+    sub @r0, @r6
+    prn 89
+endmcro
+cmp L0, @r6
+rts
+m3
+lea L0, @r3
+L0: clr L0
+rts
+L1: jmp L0
+cmp @r5, @r7
+cmp @r5, @r6
+dec L1
+clr L1
+cmp @r5, @r7
+not L1
+prn L0
+cmp L1, -350
+sub L1, L0
+clr @r1
+m4
+sub L0, @r3
+lea X0, @r1
+add @r3, @r1
+mov -511, L48
+L2: inc L0
+dec L0
+dec @r4
+jmp @r2
+L3: mov 72, @r1
+dec @r4
+inc @r3
+L4: lea L3, L15
+clr @r7
+inc L0
+dec L2
+add @r4, L1
+jsr L1
+inc @r6
+inc @r3
+bne @r7
+jsr @r1
+L5: inc @r3
+m3
+cmp -481, L4
+jsr L4
+dec @r5
+cmp 295, 490
+bne L5
+lea L0, @r6
+jmp @r2
+jmp @r0
+L6: red L0
+red @r4
+bne L3
+L7: mov -134, D0
+bne L37
+L8: rts
+L9: jsr @r2
+L10: red L51
+bne S3
+L11: lea L10, L3
+inc @r4
+L12: cmp L4, @r2
+bne L9
+rts
+jsr L2
+m2
+lea L12, L1
+rts
+bne @r3
+not @r2
+not @r6
+cmp 123, L1
+jsr L12
+dec @r2
+prn L0
+not L9
+L13: jsr L3
+mov L1, L2
+rts
+bne @r5
+lea L5, L12
+red L11
+prn L12
+add @r7, L1
+m1
+jsr @r7
+add @r7, L9
+mov @r0, L4
+L14: add @r7, L13
+sub @r0, @r7
+add 350, @r5
+L15: prn L8
+m2
+bne @r6
+m1
+bne @r4
+prn 131
+lea L8, L8
+rts
+L16: jsr L15
+mov 504, L4
+prn @r2
+red @r1
+add L16, L4
+not L6
+m4
+lea L9, L9
+cmp -349, @r4
+sub -173, L13
+clr L7
+inc @r2
+m3
+m1
+inc L14
+L17: sub 147, L2
+jmp L17
+lea L16, L0
+mov @r6, @r0
+bne @r0
+sub L3, L5
+jsr @r5
+jsr @r0
+red @r4
+red L5
+prn @r2
+bne L10
+prn @r0
+L18: inc L54
+cmp @r6, 291
+bne @r6
+red L17
+dec L9
+not @r0
+jmp @r7
+bne L9
+bne @r0
+add L7, @r1
+cmp L12, L10
+jsr @r2
+L19: clr L6
+jsr @r5
+m3
+red @r5
+L20: cmp L7, @r4
+L21: not @r6
+jmp @r6
+dec L21
+cmp 34, 75
+jmp L12
+mov L9, L20
+sub @r3, @r4
+dec L19
+jmp @r3
+jmp @r3
+L22: inc L13
+jsr @r6
+not @r4
+red D0
+not L12
+add -139, L12
+jsr L9
+cmp 497, -209
+red @r5
+lea L20, @r6
+inc L14
+L23: inc @r3
+rts
+prn L1
+inc L20
+lea L16, @r4
+lea L9, @r4
+m2
+red @r3
+mov 454, @r1
+cmp L8, @r3
+sub @r6, @r3
+rts
+L24: jsr @r7
+jsr L3
+jsr @r1
+jmp @r3
+prn @r6
+clr L19
+prn 505
+red @r6
+bne @r2
+cmp L8, L3
+prn -83
+L25: dec @r5
+dec @r4
+rts
+not @r6
+L26: jsr L0
+mov @r5, L21
+bne L25
+prn -7
+mov 397, @r0
+L27: not @r0
+prn L14
+jmp L20
+add @r7, @r2
+L28: cmp @r1, L13
+mov L25, @r3
+inc @r6
+mov @r4, @r0
+dec L27
+not @r3
+L29: not L20
+not L20
+L30: dec L21
+bne L6
+L31: red @r3
+mov @r2, L2
+dec @r4
+clr S1
+L32: jmp L28
+cmp 106, @r0
+sub -13, L14
+bne @r3
+jsr L19
+bne L11
+sub L14, X1
+prn -129
+add -93, @r2
+rts
+inc L1
+dec L14
+not @r2
+jsr L18
+add -60, @r1
+sub L18, L24
+add L32, L10
+jmp L23
+m2
+mov -201, @r7
+add -367, L14
+rts
+lea L25, L13
+inc L19
+dec L29
+dec @r5
+lea D0, L12
+add -28, L18
+m1
+mov 340, @r3
+add @r3, @r3
+red D0
+L33: rts
+add L26, @r0
+m0
+mov 61, @r3
+not L3
+m2
+add L24, @r6
+prn @r7
+mov L6, @r6
+mov -312, @r7
+rts
+add L1, D0
+m4
+L34: not L30
+cmp -400, 400
+jmp L2
+not L22
+red L9
+m2
+m3
+add -66, @r0
+mov 250, @r0
+m2
+cmp L26, L30
+m0
+m3
+L35: jsr L7
+prn L27
+mov L8, L4
+add -465, @r5
+m2
+clr @r2
+sub -176, @r1
+L36: jmp @r4
+red @r5
+clr @r5
+jmp @r3
+add @r5, @r1
+m3
+rts
+cmp L16, @r2
+m4
+jmp L0
+m4
+clr @r5
+m2
+L37: cmp 125, L54
+rts
+mov -273, @r6
+inc L9
+rts
+bne L17
+bne L18
+cmp -196, @r0
+bne L42
+prn L27
+cmp @r2, 423
+red @r2
+prn L2
+prn -464
+m4
+red @r0
+red L58
+L38: cmp -279, L25
+mov @r4, L17
+m1
+red @r7
+inc @r2
+sub L38, L18
+jsr @r2
+jsr L6
+jsr L0
+lea L7, @r6
+jmp @r7
+cmp @r1, -196
+dec @r7
+m1
+lea L26, @r7
+dec @r2
+L39: prn @r6
+cmp @r0, L0
+sub L38, @r0
+L40: dec X2
+jmp @r7
+jsr @r0
+jmp @r2
+rts
+m0
+m1
+jsr @r3
+dec @r1
+red S1
+jsr @r2
+prn 104
+m2
+L41: jmp @r2
+L42: clr @r6
+m1
+not @r4
+lea L26, L45
+L43: not L16
+add -208, @r0
+L44: rts
+add @r5, @r7
+dec @r0
+sub @r7, D0
+L45: sub @r0, L22
+clr L42
+prn 497
+L46: add -111, @r4
+dec @r4
+lea L48, L42
+clr L49
+jsr @r2
+sub @r7, L8
+rts
+mov 311, @r6
+m2
+m3
+rts
+dec L21
+mov @r2, @r4
+clr @r0
+m0
+not @r7
+dec L27
+lea L20, S1
+clr L23
+jmp @r2
+add L41, L24
+clr L15
+inc @r6
+L47: sub @r6, L21
+dec @r0
+L48: jmp @r0
+clr @r4
+L49: prn -148
+inc @r2
+clr L12
+inc @r0
+not L47
+bne L57
+m4
+cmp 299, -307
+sub 211, @r1
+bne L16
+jsr @r5
+rts
+L50: lea D0, L54
+red L35
+sub -451, S7
+L51: prn 304
+dec @r0
+not D0
+rts
+clr @r7
+rts
+m4
+inc L9
+jmp @r6
+inc L14
+red @r4
+not X3
+jmp @r3
+red @r1
+clr @r7
+lea L29, L19
+bne L42
+rts
+L52: not @r4
+red L13
+mov -284, @r6
+rts
+clr @r4
+rts
+L53: dec @r3
+m3
+jmp @r5
+inc L59
+L54: add S2, L58
+L55: dec D0
+L56: clr @r2
+jmp L57
+inc L57
+cmp L45, X4
+jsr S9
+prn L57
+mov @r2, @r7
+L57: red D0
+bne S4
+lea D0, S9
+L58: rts
+rts
+L59: lea S3, S4
+stop
+D0: .data -92,351,136,377,174,-451,-303,-289,-245,-108
+D1: .data -328,353,-479,269,-420,-476,427,367,-105,-83
+D2: .data -126,91,-85,236,4,-269,500,-215,434,431
+D3: .data -384,-278,-397,-205,-230,8,-46,-110,-250,438
+D4: .data -236,-109,-398,184,-69,-368,-341,-386,216,295
+D5: .data -210,286,-255,-159,413,-32,355,-499,366,433
+D6: .data -71,35,-467,72,-447,407,87,318,333,-48
+D7: .data -258,459,194,135,118,-459,-55,-51,-88,-182
+D8: .data 323,93,483,262,-67,-443,-467,-412,-31,293
+D9: .data -113,-72,216,313,376,28,353,278,190,494
+S0: .string "ghojfuddwzvimcebi"
+S1: .string "rjcybgbff"
+S2: .string "pszkmpymwzpdnkhkfor"
+S3: .string "zsfbxfgotlcuzpi"
+S4: .string "gftrdsmw"
+S5: .string "hzymvavthidpk"
+S6: .string "cdknohc"
+S7: .string "e"
+S8: .string "mratfnmhhcgumhehaeb"
+S9: .string "atyghr"
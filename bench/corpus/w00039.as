@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r0
+    prn 90
+endmcro
+mcro m1
+    sub @r5, @r6
+    prn 7
+endmcro
+mcro m2
+    sub @r2, @r3
+    prn 40
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 57
+endmcro
+mcro m4
+    sub @r2, @r5
+    prn 14
+endmcro
+L0: inc @r6
+red L0
+L1: prn 184
+clr L0
+jmp L1
+prn L1
+clr L1
+lea L54, @r7
+lea L0, L6
+prn 287
+prn @r1
+L2: lea L2, L19
+red @r4
+not @r6
+m1
+sub @r6, @r6
+L3: prn -219
+mov @r2, L0
+bne L1
+dec X0
+clr L0
+L4: lea L18, L0
+jsr @r7
+jmp @r0
+lea L3, L2
+add 318, L4
+L5: not L2
+prn @r6
+dec @r5
+L6: jsr L0
+cmp 277, @r1
+L7: mov @r5, L2
+m2
+m1
+jmp @r7
+L8: cmp @r2, @r1
+clr @r5
+add @r4, L5
+cmp L5, @r0
+rts
+red L6
+add @r3, @r0
+m3
+inc L1
+inc @r7
+add @r5, @r7
+red L8
+add L6, @r3
+L9: not L9
+inc L0
+add @r3, L5
+cmp L0, L1
+prn L8
+prn L6
+lea L7, @r2
+clr L3
+bne L9
+jsr @r4
+bne @r5
+not L2
+red L0
+rts
+m2
+L10: inc L8
+add -77, L8
+jsr @r1
+m3
+dec @r2
+prn L3
+jsr @r1
+not @r1
+dec L2
+jmp @r1
+m2
+jmp L0
+clr @r5
+jsr L10
+jmp @r2
+m0
+prn @r0
+red @r3
+L11: dec @r5
+m2
+bne @r5
+cmp @r2, @r5
+clr L1
+dec L11
+cmp @r0, @r3
+cmp @r3, -11
+L12: clr L2
+mov L3, @r5
+L13: bne S6
+rts
+dec @r3
+jmp @r4
+m0
+prn -339
+red @r5
+jmp L9
+red L44
+red @r1
+L14: sub L7, L5
+sub -41, L3
+lea L1, @r7
+jsr L7
+jmp @r2
+red @r3
+bne L12
+L15: clr L4
+bne @r0
+rts
+red @r3
+jsr @r7
+inc L5
+jmp L4
+bne L4
+L16: bne L14
+not @r7
+rts
+add @r1, L13
+L17: red L0
+m0
+mov 261, L11
+L18: lea L12, S3
+L19: dec L9
+inc @r5
+sub @r4, L17
+rts
+jmp @r3
+dec @r0
+clr @r4
+clr L9
+sub -297, L17
+red @r1
+red @r6
+m3
+mov L6, L3
+jsr L17
+inc L15
+jsr L7
+jmp L1
+cmp @r5, @r5
+m2
+dec L5
+add -431, L15
+lea L1, L18
+lea L7, @r3
+bne L13
+m1
+clr @r6
+L20: dec L6
+lea L5, L2
+sub @r4, X1
+sub @r6, L17
+cmp L4, 398
+dec L18
+m0
+not S6
+not @r3
+bne L42
+L21: rts
+L22: bne L4
+inc @r4
+dec @r3
+red @r5
+rts
+L23: rts
+red L13
+sub @r7, L18
+rts
+rts
+sub 257, L11
+mov 260, @r7
+L24: not L20
+red @r0
+m2
+rts
+L25: add @r2, @r0
+red @r5
+L26: red S4
+jmp L17
+L27: inc L6
+jmp @r0
+red S3
+lea L3, L14
+dec L10
+mov @r6, @r4
+dec D0
+rts
+m2
+cmp @r7, @r7
+L28: not L20
+L29: jmp L26
+red L23
+add L10, L9
+L30: clr @r2
+lea L6, L24
+jmp L12
+m4
+mov @r3, @r5
+inc @r0
+jmp L14
+m2
+cmp 444, L10
+dec L24
+not L47
+L31: add @r3, @r4
+sub L14, @r5
+bne L16
+m1
+L32: cmp @r5, L25
+add L19, @r5
+lea L27, D0
+jsr @r1
+jsr @r6
+bne @r2
+jsr @r4
+L33: bne L10
+L34: jsr @r6
+clr L18
+jmp @r7
+dec L0
+cmp L32, -435
+m4
+sub L30, L23
+mov L10, @r2
+jmp @r5
+cmp L9, @r5
+jsr @r0
+prn @r0
+cmp -461, L16
+lea L3, @r5
+m3
+inc @r0
+red @r3
+bne @r0
+not @r6
+red @r4
+L35: cmp @r7, 497
+red L34
+red L13
+clr @r0
+m1
+add L33, @r0
+bne @r6
+L36: jmp L14
+jsr @r4
+jsr @r5
+L37: cmp @r1, 384
+m3
+m3
+add 55, L11
+add -321, @r1
+prn -327
+sub @r3, @r7
+dec @r2
+m3
+m4
+L38: clr L12
+add @r0, L52
+add L9, @r2
+add L25, @r6
+clr L14
+jsr S2
+L39: rts
+jsr @r2
+cmp -6, L12
+m0
+jsr L38
+bne @r7
+L40: jsr @r0
+bne L16
+sub @r4, @r1
+red @r6
+m2
+add -414, L36
+dec L22
+prn 233
+bne @r4
+prn L51
+m2
+L41: sub 357, L20
+inc @r5
+rts
+mov 330, L12
+cmp 414, @r4
+red L9
+L42: mov L31, L38
+prn L39
+sub L38, @r4
+add L22, L1
+sub L4, L59
+rts
+jmp @r5
+m2
+prn @r1
+bne L20
+rts
+add L0, @r1
+clr @r4
+L43: jsr @r3
+cmp L11, @r1
+jmp L15
+sub L23, L7
+mov @r1, @r0
+clr @r3
+add 31, L12
+L44: bne @r0
+prn L42
+prn -167
+lea L55, @r2
+m2
+L45: not @r4
+inc @r3
+jmp @r7
+m1
+red L27
+L46: jmp @r6
+jmp @r5
+add @r1, @r2
+not @r5
+rts
+L47: red L3
+not L17
+sub @r2, L38
+inc L17
+dec @r5
+clr L44
+clr @r3
+red @r6
+not @r0
+not @r7
+not L20
+dec L37
+lea L20, @r4
+jsr @r6
+m0
+prn L6
+jmp L6
+sub @r5, L48
+not L7
+jmp @r6
+not L15
+rts
+bne L15
+m4
+L48: dec @r4
+bne @r7
+lea L37, L34
+cmp -362, L19
+lea L33, @r1
+dec @r2
+L49: clr @r0
+L50: add @r1, L59
+sub 485, L1
+add -42, L7
+m3
+clr D0
+mov L46, @r0
+cmp -484, L6
+jsr @r1
+clr L40
+jmp @r0
+lea X2, L33
+jmp @r4
+cmp 300, L11
+not @r2
+red @r2
+jsr L42
+cmp L47, -110
+jmp @r6
+mov 385, L57
+jsr X3
+m2
+add @r3, @r7
+jsr @r2
+cmp @r5, -108
+bne @r0
+lea L53, L16
+inc @r4
+sub L16, D0
+lea L18, L24
+sub S2, L1
+rts
+not L11
+jmp L32
+L51: prn L39
+inc @r4
+L52: clr @r2
+cmp @r7, @r1
+jsr L39
+m1
+lea L53, L27
+add -386, @r4
+clr @r7
+bne @r5
+cmp @r6, 148
+cmp L19, L26
+rts
+jsr S8
+rts
+lea L3, @r6
+L53: add 1, @r7
+L54: add L28, D0
+clr L12
+prn L53
+red @r2
+sub 55, L9
+add -501, S0
+rts
+clr @r1
+prn @r1
+prn S6
+clr @r1
+lea L51, @r5
+jmp @r6
+L55: red @r4
+jmp L1
+L56: red L21
+m0
+inc L57
+sub L41, L43
+jmp @r1
+red @r1
+prn @r4
+rts
+lea D0, L35
+lea S9, @r7
+m2
+L57: prn @r0
+clr @r5
+rts
+L58: dec @r4
+dec D0
+inc L13
+cmp X4, D0
+L59: inc D0
+mov S1, @r5
+jmp D0
+lea D0, @r7
+stop
+D0: .data 3,-119,481,-400,116,417,-256,-45,-175,-303
+D1: .data 253,-52,305,92,-111,-355,27,-332,-453,-89
+D2: .data -69,116,460,190,-392,-448,-418,-85,9,-432
+D3: .data -51,100,-149,-395,-16,261,247,406,-365,-163
+D4: .data -70,-142,-268,286,499,-499,-43,12,-50,445
+D5: .data -259,-79,-395,-452,-431,449,-411,493,149,-269
+D6: .data -67,175,11,401,61,261,187,-360,-237,341
+D7: .data 161,-300,-337,322,284,-358,381,-462,-337,-149
+D8: .data 149,48,16,339,76,61,-63,-70,352,-459
+D9: .data 237,-122,255,-41,-115,443,53,-264,160,169
+S0: .string "nxsylkndwevmzob"
+S1: .string "cvi"
+S2: .string "gqnedvshflfyqk"
+S3: .string "gozriwzabrmspcgyjl"
+S4: .string "pzyvglffasljr"
+S5: .string "ctwuzqldgluzgdhfdth"
+S6: .string "sdivagpmenotch"
+S7: .string "wykkwdngzmxogf"
+S8: .string "ldfqubyvpcvctke"
+S9: .string "cw"
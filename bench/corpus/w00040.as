@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r2
+    prn 28
+endmcro
+mcro m1
+    sub @r2, @r7
+    prn 5
+endmcro
+mcro m2
+    sub @r4, @r1
+    prn 5
+endmcro
+mcro m3
+    sub @r4, @r1
+    prn 33
+endmcro
+mcro m4
+    sub @r4, @r3
+    prn 38
+endmcro
+prn L0
+bne @r7
+prn L0
+clr @r3
+m0
+cmp @r0, @r6
+m2
+not L0
+add @r5, @r6
+jmp L0
+bne @r7
+m4
+rts
+lea L0, L0
+L0: cmp -427, -49
+sub 225, @r4
+bne @r0
+lea L0, @r2
+mov L0, L0
+red D0
+m1
+L1: add -115, @r0
+lea L1, X0
+clr @r7
+jsr @r3
+m0
+rts
+jmp L0
+jsr L1
+prn 148
+add @r4, X1
+add @r2, L1
+jmp L1
+m3
+jmp L0
+m2
+rts
+dec L0
+L2: jsr @r4
+clr @r0
+m1
+L3: cmp L0, @r0
+mov L3, S6
+jmp @r3
+red @r6
+not @r2
+bne @r6
+m2
+jmp L3
+lea D0, L0
+not @r1
+lea L1, L3
+mov @r0, @r6
+bne @r1
+L4: cmp @r2, -69
+cmp 103, @r3
+rts
+m3
+prn 208
+clr L4
+jmp @r0
+mov @r1, L4
+L5: jmp L3
+L6: sub L0, L2
+L7: red @r6
+lea L4, L4
+m3
+L8: dec @r2
+clr @r7
+jsr L3
+m4
+dec @r2
+not @r7
+L9: mov L8, @r0
+red L8
+m2
+mov L2, L5
+sub @r4, @r7
+prn @r3
+cmp 483, @r5
+rts
+rts
+rts
+bne @r5
+L10: add @r7, D0
+mov @r7, L6
+red L6
+jmp L7
+prn L59
+red @r3
+add 257, @r1
+dec L8
+L11: lea D0, L1
+dec @r5
+L12: mov 122, @r1
+rts
+add L9, L4
+L13: jsr L6
+mov L1, L12
+sub -258, L9
+mov @r7, @r6
+rts
+lea L9, L12
+not @r1
+jsr L2
+rts
+red L8
+prn @r5
+rts
+rts
+dec L3
+rts
+lea L4, @r0
+jmp @r7
+L14: lea L9, @r4
+L15: jmp L4
+red L3
+inc L14
+sub L8, @r0
+rts
+inc L26
+sub L7, L10
+lea L14, L12
+m0
+m4
+bne @r6
+rts
+m2
+dec @r5
+inc L6
+L16: prn L15
+m2
+dec S6
+red @r1
+not @r7
+jmp @r6
+jmp L9
+add @r3, L13
+L17: sub L6, L1
+not @r1
+add @r6, L2
+mov L6, @r2
+jsr L4
+m3
+prn -462
+lea L11, L6
+jsr L17
+lea D0, @r0
+cmp @r7, @r5
+m1
+jmp L1
+not L6
+red L7
+lea L3, @r7
+inc L15
+L18: prn @r3
+mov L5, @r4
+L19: jmp L8
+inc @r0
+L20: not @r1
+red @r5
+jmp D0
+sub 201, L17
+m1
+L21: clr @r6
+cmp @r5, @r3
+not @r1
+L22: dec L4
+cmp -259, L16
+jmp @r3
+cmp 106, 370
+L23: bne @r2
+m3
+add 155, @r6
+cmp -462, -235
+cmp @r5, @r1
+sub 408, L18
+L24: jsr @r4
+add L3, @r0
+lea L8, @r6
+not @r4
+clr @r0
+L25: jmp @r7
+lea L20, @r6
+bne @r5
+sub L15, @r2
+prn L21
+bne L2
+clr @r6
+inc @r7
+rts
+rts
+L26: dec @r0
+jsr S6
+sub L8, L2
+red L11
+L27: not @r0
+prn @r3
+red L16
+not @r7
+mov @r1, S1
+prn 302
+m1
+clr @r6
+prn 378
+jsr L21
+jsr @r4
+not @r7
+m3
+cmp D0, @r1
+L28: sub @r5, @r2
+not L13
+inc @r2
+jsr @r6
+L29: mov @r5, @r6
+L30: lea S1, @r0
+m2
+inc L5
+lea L4, @r6
+L31: not @r0
+m2
+L32: lea S2, L0
+inc @r4
+prn -20
+prn L28
+lea L16, L17
+dec L21
+inc @r2
+L33: clr L32
+m2
+add @r3, L12
+jsr L30
+cmp L4, -179
+rts
+dec L26
+L34: jsr L25
+lea L50, @r0
+L35: prn -130
+rts
+not @r4
+L36: inc @r3
+jmp L7
+red L36
+mov L41, L33
+m1
+jmp @r1
+inc @r0
+L37: mov L2, @r2
+sub L27, L34
+rts
+red @r2
+dec @r0
+lea L24, L21
+bne L28
+clr @r3
+mov -125, @r7
+red @r0
+L38: lea L4, @r4
+dec D0
+jmp @r2
+clr L18
+sub @r1, L5
+sub L22, @r4
+lea D0, @r7
+m2
+cmp L32, S4
+red L17
+L39: rts
+lea L19, @r2
+m3
+jsr @r1
+L40: lea L26, @r0
+m1
+inc L13
+L41: not L3
+not @r4
+dec @r7
+jsr L5
+red L11
+add L18, @r5
+clr L3
+inc X2
+L42: mov L30, @r2
+add 65, L43
+prn L13
+m3
+clr L22
+red L39
+red @r7
+cmp @r5, L52
+cmp -230, L38
+L43: jsr L20
+jmp @r2
+m1
+sub @r4, L24
+add 123, L38
+clr @r7
+jmp @r0
+jmp @r1
+jsr @r3
+cmp L47, @r3
+mov -112, L23
+jmp @r0
+L44: cmp L4, 286
+dec D0
+sub @r2, @r1
+cmp @r6, @r6
+jsr L19
+L45: dec @r2
+jmp @r5
+mov 254, L18
+bne L2
+mov @r6, L14
+mov L23, L8
+rts
+m3
+prn L25
+jsr L11
+dec @r2
+not @r2
+not @r5
+inc @r0
+add 266, @r7
+L46: bne L7
+L47: jmp @r5
+add L15, @r2
+rts
+dec L35
+L48: add @r0, L34
+bne @r6
+lea L41, @r4
+jsr @r2
+m4
+mov 324, @r7
+dec @r4
+bne @r1
+add 246, @r5
+L49: bne L32
+bne @r2
+m2
+L50: bne D0
+mov S1, L9
+rts
+lea L19, L28
+bne @r7
+sub L23, @r2
+dec @r3
+sub @r4, L8
+sub @r3, L25
+bne L32
+rts
+add L52, @r1
+lea L40, L16
+not L58
+red @r6
+L51: jsr L25
+bne @r7
+bne L47
+m0
+clr L48
+bne @r5
+prn -347
+add L23, @r1
+cmp 332, @r6
+add 468, X3
+mov S7, @r1
+clr @r0
+red @r3
+not L29
+rts
+not L3
+dec @r0
+L52: jsr @r3
+rts
+sub L3, @r1
+sub L45, @r6
+rts
+lea L27, @r2
+dec L29
+dec @r2
+inc L50
+bne @r7
+jsr L38
+bne L9
+dec @r6
+bne L16
+bne S1
+L53: jsr @r2
+dec L11
+red L13
+clr L52
+sub 189, @r6
+prn L33
+lea L49, @r1
+not @r7
+m3
+L54: prn -153
+prn @r3
+not D0
+not @r3
+dec L18
+prn @r7
+add 31, @r0
+sub L39, @r6
+not L4
+inc @r6
+m3
+prn @r6
+jsr L57
+cmp L0, @r6
+jsr @r4
+sub -266, S5
+inc L8
+m1
+bne L59
+L55: clr L48
+add L4, L47
+mov 8, @r2
+jmp @r6
+L56: lea L0, @r3
+L57: prn -61
+prn @r2
+red @r1
+bne L37
+lea L59, @r4
+clr @r6
+jmp @r5
+inc L46
+mov @r5, L58
+m0
+cmp -433, @r2
+L58: clr @r4
+cmp -88, 279
+L59: red D0
+jsr L33
+not D0
+red @r4
+add X4, @r3
+lea S4, S8
+dec @r1
+stop
+D0: .data 493,183,448,189,432,-279,178,-192,43,248
+D1: .data 86,239,-404,61,380,425,-223,-467,-400,439
+D2: .data -391,429,92,340,219,416,-231,-493,-190,-63
+D3: .data -449,-30,398,-107,-173,-302,-154,-174,-455,-247
+D4: .data -419,-238,67,-342,175,-259,-434,357,427,313
+D5: .data -456,-101,452,86,-498,234,203,-361,440,-265
+D6: .data 60,321,344,268,-447,-109,-103,-14,-154,-456
+D7: .data -99,-205,-197,133,-321,-414,191,-480,-350,-260
+D8: .data -52,-322,-443,-226,-428,489,204,-279,-436,-499
+D9: .data -487,313,-347,211,444,468,-318,383,214,440
+S0: .string "urulkqlkjjegc"
+S1: .string "qgszqczoawqkbogctfvc"
+S2: .string "pfdao"
+S3: .string "mrdnlavbahhfxlhxmx"
+S4: .string "jaczjt"
+S5: .string "prkciudyoplgqlnsgpz"
+S6: .string "c"
+S7: .string "wudqtgokceqnlr"
+S8: .string "pbdhltrxbrdeundvbvr"
+S9: .string "ghimqcwsrm"
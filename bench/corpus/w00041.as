@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r5
+    prn 98
+endmcro
+mcro m1
+    sub @r6, @r0
+    prn 72
+endmcro
+mcro m2
+    sub @r6, @r7
+    prn 70
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 77
+endmcro
+mcro m4
+    sub @r6, @r1
+    prn 95
+endmcro
+sub @r0, @r1
+m3
+dec @r5
+jsr @r3
+mov L0, L0
+cmp L0, @r0
+jsr L0
+jmp @r7
+sub L0, L0
+sub -325, @r3
+jmp L0
+sub -303, @r0
+add @r0, L0
+red L0
+cmp -490, 188
+jmp @r4
+L0: dec L0
+add @r4, @r3
+add -424, L0
+inc L0
+dec L0
+L1: dec @r2
+not @r2
+jmp @r5
+L2: sub L1, @r2
+mov 2, @r4
+cmp @r2, @r3
+sub L2, @r5
+not L1
+L3: rts
+dec L2
+clr @r7
+m4
+sub -475, L0
+sub L50, S9
+red @r4
+dec @r1
+L4: not L1
+L5: lea L3, L0
+add @r0, L0
+rts
+L6: mov @r7, L5
+not @r6
+dec L58
+lea L4, L6
+not @r1
+L7: lea L7, @r3
+add L1, L10
+L8: rts
+not L2
+jsr L2
+jmp @r6
+jsr @r3
+dec @r3
+cmp @r2, @r4
+mov L4, L0
+bne @r1
+m0
+bne @r2
+dec @r3
+L9: mov -260, @r0
+L10: cmp -420, @r1
+dec L9
+jsr L4
+not L2
+L11: jmp L8
+not @r6
+add L5, L1
+bne @r3
+inc @r4
+add @r1, L3
+dec @r4
+clr L1
+m3
+cmp @r6, L4
+dec @r1
+not @r7
+inc @r2
+red L3
+dec L9
+mov -187, L4
+prn -249
+not @r7
+L12: clr @r0
+L13: sub @r6, L0
+not L9
+m2
+jsr L41
+add @r3, L13
+m3
+dec @r2
+L14: rts
+bne L0
+dec L13
+dec @r5
+not L4
+lea L10, L23
+L15: prn 314
+L16: cmp -373, 19
+m0
+mov -46, L16
+clr @r0
+sub L13, @r7
+red L9
+cmp @r2, D0
+mov L7, L12
+L17: add L2, @r2
+L18: inc L4
+red L9
+jmp @r7
+m3
+sub L18, L11
+red @r0
+jsr S9
+not L9
+add @r1, @r5
+clr @r7
+bne L36
+L19: dec @r6
+prn L13
+m3
+mov L11, @r2
+m4
+m3
+add L19, @r4
+m2
+jsr @r5
+m4
+inc L7
+add -481, L12
+mov @r5, L5
+lea L1, @r3
+not @r4
+m2
+m2
+dec @r2
+m4
+sub -384, @r5
+clr L8
+jsr @r3
+L20: lea S6, L14
+L21: cmp 35, L5
+L22: not @r3
+red L1
+lea L6, L10
+jsr @r1
+inc @r6
+jsr L5
+rts
+lea L4, L9
+cmp L5, -438
+bne L10
+lea X0, L1
+m2
+inc @r1
+sub L0, L7
+lea L11, @r4
+jsr L19
+red L11
+red L13
+prn L12
+clr @r7
+jsr @r3
+jsr @r1
+jsr L20
+inc @r7
+prn L18
+dec @r5
+inc @r4
+dec L18
+lea L13, L9
+mov 364, @r1
+rts
+inc @r3
+mov @r5, @r1
+dec @r2
+add 135, @r2
+m2
+L23: sub -312, L15
+clr @r7
+bne S4
+L24: clr L10
+sub @r4, @r3
+m0
+lea L23, L8
+inc @r2
+bne @r6
+prn L16
+not L59
+m1
+L25: lea L13, L0
+jsr L7
+bne L19
+not @r5
+clr @r5
+sub @r7, @r7
+mov @r7, @r0
+mov L32, L17
+jsr @r4
+jmp @r5
+mov L24, @r7
+inc D0
+L26: red D0
+add L49, @r4
+clr @r2
+L27: not L13
+inc @r2
+prn L25
+cmp L43, @r5
+L28: clr L8
+red @r4
+prn -149
+bne @r2
+m4
+mov L8, @r3
+inc L11
+L29: inc L14
+prn 84
+lea L26, L14
+add @r2, L5
+not L10
+m2
+prn L27
+mov L22, L4
+lea L47, L6
+cmp @r1, L6
+cmp @r6, @r6
+lea L20, @r2
+m3
+sub @r1, @r2
+jmp L21
+sub L26, L6
+mov @r2, L11
+m2
+inc @r1
+dec L13
+not @r6
+prn L16
+lea L19, L27
+L30: lea L36, L11
+jsr L13
+not L0
+clr D0
+add 188, L29
+prn L6
+clr @r1
+dec @r5
+L31: mov @r6, L1
+prn L19
+cmp -235, 387
+mov L39, L19
+inc X1
+bne L2
+m2
+jmp @r6
+inc L14
+bne @r1
+L32: cmp @r6, @r4
+jsr @r3
+cmp L29, -115
+inc L3
+rts
+sub @r1, L16
+bne L28
+add 343, @r7
+inc @r6
+prn L6
+L33: prn S0
+mov -91, @r5
+not @r6
+mov L2, @r5
+not @r1
+m0
+jmp L45
+cmp -493, L5
+clr @r5
+not @r7
+jsr @r3
+clr L25
+mov L17, @r2
+lea L1, L4
+cmp 409, D0
+lea L37, @r0
+cmp 328, @r4
+jmp @r4
+m0
+inc L33
+m2
+cmp @r4, 468
+L34: cmp L4, L27
+jsr L22
+rts
+bne @r1
+m2
+jsr L18
+dec L2
+add @r4, L31
+jsr @r6
+red L17
+bne L8
+mov @r0, L31
+jmp @r2
+clr L32
+rts
+L35: not L17
+rts
+m1
+m2
+m3
+m3
+jsr @r4
+rts
+L36: lea L11, @r7
+cmp L10, L29
+L37: cmp L35, 110
+not L24
+rts
+prn 502
+cmp L13, -135
+m1
+prn L23
+jsr L7
+lea L23, @r5
+m3
+prn @r3
+L38: jsr L3
+L39: jsr L5
+jmp L11
+jsr L13
+bne @r3
+jsr @r7
+not @r2
+prn @r6
+inc @r6
+L40: cmp L38, L29
+cmp @r7, 229
+lea L31, L22
+L41: prn S7
+L42: cmp -85, X2
+L43: add -457, L16
+L44: rts
+prn @r7
+lea L20, L30
+lea L31, @r4
+sub -183, L38
+bne L18
+lea D0, L19
+jmp @r3
+prn @r2
+not L7
+prn -182
+cmp @r6, L37
+rts
+inc @r4
+lea L12, @r6
+add @r0, @r0
+jsr L44
+dec @r6
+sub @r4, S6
+prn 124
+jsr @r6
+add L26, L25
+jsr L13
+bne L9
+inc L4
+inc X3
+m0
+bne L5
+lea L53, L14
+L45: clr L9
+prn -185
+mov -308, @r2
+bne @r1
+add @r2, @r4
+cmp -421, @r5
+not @r6
+L46: inc @r4
+mov -157, @r4
+bne L3
+cmp @r3, 118
+cmp @r2, L38
+rts
+clr L14
+dec L3
+jsr @r0
+L47: prn -379
+jsr @r6
+not @r3
+cmp 511, -460
+red L32
+lea L5, L36
+cmp -49, L47
+mov @r7, @r4
+sub L44, L17
+jsr L28
+lea L58, @r4
+L48: mov 418, @r6
+mov -207, L47
+lea L58, @r1
+clr L17
+m4
+rts
+jsr L8
+rts
+L49: red @r7
+mov @r3, L5
+rts
+not @r6
+mov L22, @r2
+rts
+sub 387, L17
+clr L11
+L50: not L37
+add 446, D0
+L51: sub L26, @r4
+L52: mov L12, L19
+prn @r1
+prn -370
+add X4, D0
+jsr L45
+L53: mov 102, @r6
+jmp @r4
+prn L58
+bne @r7
+dec @r6
+m2
+L54: jsr D0
+L55: mov L7, @r6
+m0
+L56: sub @r4, @r2
+mov @r0, @r0
+L57: clr L59
+rts
+L58: cmp 264, @r3
+m3
+not @r4
+rts
+lea S6, S1
+bne L59
+L59: jmp D0
+stop
+D0: .data 152,348,163,351,-447,-381,117,451,-59,288
+D1: .data 287,-409,-158,-155,439,174,214,34,199,-191
+D2: .data 18,381,-318,-45,67,-354,96,-352,249,-128
+D3: .data -22,383,-389,-127,403,-346,-425,334,-244,167
+D4: .data 386,147,-243,-291,415,209,-280,75,167,-446
+D5: .data 263,-35,411,-234,122,-407,377,-239,-447,-60
+D6: .data -305,186,-129,412,328,206,396,-54,-121,-174
+D7: .data 104,106,447,115,34,211,124,-462,-422,444
+D8: .data -80,299,-120,-27,367,224,-153,-6,414,-338
+D9: .data -388,155,269,138,418,-187,-466,-387,-261,-110
+S0: .string "agyfvachjo"
+S1: .string "gqp"
+S2: .string "xovpxkyeiha"
+S3: .string "wbywfbtxnzqnwerqh"
+S4: .string "vhwszppaatphqojp"
+S5: .string "zvbxfffjde"
+S6: .string "qbzlfiiqldritmekjabu"
+S7: .string "cegmwvzjxsw"
+S8: .string "jikdzgpxsrfaadzx"
+S9: .string "ydqpgbgeyawvorlic"
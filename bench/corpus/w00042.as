@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r7
+    prn 37
+endmcro
+mcro m1
+    sub @r2, @r2
+    prn 70
+endmcro
+mcro m2
+    sub @r0, @r5
+    prn 36
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 54
+endmcro
+mcro m4
+    sub @r0, @r7
+    prn 19
+endmcro
+dec L0
+jmp L0
+L0: jmp @r7
+rts
+mov L0, L0
+rts
+bne @r1
+add @r4, L0
+m1
+dec L0
+prn @r2
+lea L0, @r0
+bne @r3
+lea L0, @r3
+prn -56
+prn @r6
+sub L0, @r1
+red L0
+m1
+L1: mov L0, @r2
+L2: not L1
+L3: bne @r4
+L4: cmp @r7, L4
+not L37
+mov -56, @r6
+jsr L0
+jmp @r4
+cmp L3, L1
+jmp L3
+clr L0
+clr L4
+bne @r5
+rts
+red @r1
+red @r7
+red @r3
+not L4
+m3
+cmp @r5, 357
+lea L0, @r3
+inc @r7
+jmp L0
+dec L4
+add @r7, @r0
+jsr L1
+rts
+red @r0
+add L1, L2
+jmp L1
+jmp L1
+dec @r4
+m4
+L5: add L4, @r4
+prn L2
+bne S8
+inc @r6
+mov 332, L4
+sub L4, @r4
+not @r7
+mov @r5, L1
+dec L1
+not @r1
+L6: rts
+clr L2
+sub @r6, L5
+sub @r6, L0
+L7: cmp @r5, @r0
+lea L56, @r6
+L8: lea L5, @r6
+rts
+dec @r2
+add @r1, @r6
+m4
+dec @r3
+prn L5
+cmp L4, 389
+L9: bne @r7
+clr L2
+L10: rts
+L11: jmp @r4
+lea L10, L6
+m3
+not X0
+not L3
+L12: cmp @r2, 426
+lea L8, @r6
+jmp @r2
+L13: inc L8
+mov 299, @r1
+L14: dec L1
+lea L1, @r5
+mov 367, @r3
+clr @r1
+m3
+sub L12, @r4
+not L10
+jsr L6
+add @r5, @r1
+clr L13
+dec L0
+clr @r1
+sub 373, L13
+dec L5
+L15: jmp L26
+cmp -139, L4
+bne @r7
+lea L4, L9
+dec L15
+add @r4, @r3
+lea L14, @r3
+add @r5, @r3
+jmp L10
+L16: jmp L16
+lea L4, @r4
+clr L7
+add @r0, L4
+sub @r4, @r6
+cmp L2, 411
+L17: prn L6
+dec @r1
+sub @r7, @r1
+bne L9
+sub L14, @r7
+L18: dec L11
+prn @r0
+clr L18
+red L35
+m4
+cmp @r0, L1
+dec @r6
+bne @r1
+L19: red L15
+rts
+clr @r6
+add @r7, @r7
+sub @r6, @r5
+sub 288, @r1
+dec L5
+cmp 343, 118
+rts
+dec @r3
+add -250, L13
+cmp L8, @r1
+prn @r2
+L20: red L7
+add -175, L0
+dec L7
+add L20, L19
+L21: rts
+m3
+bne L17
+m0
+add @r7, @r4
+cmp -112, @r3
+bne L2
+clr @r0
+L22: mov @r6, L0
+rts
+jsr @r2
+rts
+dec @r0
+mov @r4, @r5
+clr @r6
+cmp L8, @r4
+cmp 137, L4
+bne L12
+jsr @r4
+L23: sub L13, @r0
+not @r6
+m1
+m1
+L24: bne @r3
+lea L11, @r7
+rts
+clr L13
+lea L15, @r7
+bne @r6
+dec L6
+not @r4
+red @r5
+not L7
+cmp @r4, -134
+prn 506
+add -368, @r2
+inc @r2
+red L21
+sub @r2, L12
+red @r6
+not L3
+L25: sub L10, L14
+jmp @r1
+not L14
+rts
+L26: sub -161, @r1
+mov -352, L8
+cmp L17, 129
+add @r1, @r0
+jsr @r3
+L27: clr L4
+bne @r7
+m0
+inc @r6
+prn -35
+m4
+red @r0
+m4
+L28: jsr @r7
+jsr @r3
+L29: not L24
+rts
+m2
+cmp @r5, -62
+m3
+rts
+clr @r3
+jsr D0
+dec L15
+sub S2, L27
+red @r6
+clr L26
+add 425, L21
+not L11
+clr @r5
+m4
+mov @r5, @r6
+rts
+cmp 36, L13
+L30: mov -232, D0
+mov 266, L16
+bne @r6
+not L23
+inc L19
+inc L1
+jmp L27
+jsr L0
+rts
+L31: mov -457, @r0
+not L5
+m3
+add L10, @r4
+m0
+prn -148
+L32: not @r5
+add @r1, L24
+lea L30, @r0
+red @r5
+mov L32, L57
+add @r7, L18
+prn @r7
+mov 25, @r0
+L33: rts
+mov S4, @r5
+jmp L33
+cmp @r0, @r3
+bne @r6
+not L4
+L34: bne @r4
+red @r5
+bne L24
+not @r6
+m3
+bne L48
+bne L6
+cmp -318, -372
+cmp @r2, L13
+sub @r3, @r6
+add @r6, @r2
+add -233, @r1
+add @r4, @r6
+bne L33
+jsr @r0
+clr L3
+dec @r1
+prn @r4
+L35: bne L52
+lea L31, @r1
+not L42
+red L34
+prn @r4
+mov @r5, @r4
+jmp @r3
+m0
+add @r4, L33
+rts
+jmp L3
+bne L48
+red L17
+dec L8
+dec @r0
+jsr @r5
+red L30
+cmp @r1, 64
+cmp @r0, 332
+inc S5
+sub 123, L37
+bne @r6
+red L27
+mov @r0, @r1
+clr D0
+clr @r4
+jmp @r7
+rts
+not L18
+L36: dec @r5
+clr @r5
+prn L6
+cmp L33, 286
+clr L7
+inc L8
+inc @r4
+sub L26, @r1
+inc @r3
+prn 494
+jsr @r4
+m3
+prn @r2
+inc L30
+add 67, L17
+add L7, L11
+L37: jmp @r1
+inc L14
+m4
+sub @r6, L13
+L38: not L37
+red @r6
+clr L30
+m3
+cmp @r3, @r6
+m2
+dec @r1
+not L30
+L39: add L8, L9
+m3
+lea L24, @r7
+clr L7
+red L9
+add @r1, X1
+cmp -140, -488
+L40: lea L27, L5
+m4
+bne L49
+m3
+m2
+jmp L39
+rts
+clr @r5
+jsr @r4
+clr @r5
+L41: jmp L5
+lea X2, @r2
+jmp @r3
+sub @r0, L23
+L42: dec @r5
+lea L28, L17
+add D0, L3
+mov 74, L22
+jmp L33
+inc L40
+lea L18, @r2
+bne D0
+clr L10
+not L5
+jmp @r7
+not @r1
+mov 413, @r5
+L43: prn -342
+cmp 481, L34
+dec @r1
+L44: jmp L20
+sub @r4, L42
+inc L2
+add L52, @r7
+prn @r6
+bne L56
+m2
+red @r6
+L45: dec L46
+L46: rts
+jmp L55
+cmp -383, S3
+jsr L18
+jsr L2
+red L24
+m3
+dec @r4
+jsr L21
+not L7
+lea L9, L40
+dec L25
+mov L37, L18
+m1
+bne L51
+sub @r2, @r4
+L47: lea L49, @r4
+m1
+mov L15, @r6
+lea L17, @r7
+rts
+L48: prn L16
+prn 275
+rts
+cmp @r5, L55
+mov L35, @r1
+m4
+L49: lea L2, L38
+bne L40
+clr @r5
+add S5, L57
+red @r1
+inc L34
+L50: red @r2
+mov 230, @r1
+jmp @r5
+L51: inc @r4
+m0
+jmp L53
+m2
+L52: mov @r6, D0
+clr L55
+L53: add @r5, @r7
+inc @r5
+jsr L18
+L54: cmp @r6, L27
+inc L15
+red L57
+L55: rts
+m1
+L56: clr @r4
+red @r0
+prn @r2
+L57: inc X3
+m0
+m0
+rts
+bne X4
+red L59
+rts
+mov L59, D0
+L58: lea D0, L59
+L59: mov S7, @r7
+stop
+D0: .data -358,-111,154,417,-180,432,-398,-348,-481,-135
+D1: .data -427,364,-144,-116,-401,-379,-166,-315,-315,-155
+D2: .data -74,183,-160,-110,289,263,-139,48,-321,141
+D3: .data -114,85,-151,176,-15,-121,81,321,-64,-468
+D4: .data 408,130,384,179,-435,-255,-403,-72,-264,-211
+D5: .data 401,-151,-328,436,147,-184,25,94,-34,205
+D6: .data -245,146,172,-135,67,286,-215,390,-44,-487
+D7: .data -138,-102,-336,35,-429,14,208,224,-68,-274
+D8: .data -423,235,406,446,491,-108,-216,193,-195,470
+D9: .data 321,472,449,-282,463,415,80,91,-209,-127
+S0: .string "dznmwovgtazxg"
+S1: .string "fpacindq"
+S2: .string "fkkrmwmvxaqfra"
+S3: .string "opptuwgctehrzomjqzqn"
+S4: .string "qn"
+S5: .string "xasoafooobzmlb"
+S6: .string "gsf"
+S7: .string "givwrstzlyinypcdv"
+S8: .string "zkkeylcpesefonakt"
+S9: .string "vdqjbhtwdjcbovrdibvh"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r2
+    prn 7
+endmcro
+mcro m1
+    sub @r7, @r3
+    prn 69
+endmcro
+mcro m2
+    sub @r2, @r3
+    prn 1
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 30
+endmcro
+mcro m4
+    sub @r2, @r6
+    prn 44
+endmcro
+inc L0
+lea L0, @r7
+m4
+L0: add @r4, @r3
+cmp -143, @r0
+m0
+cmp 16, @r6
+red L0
+dec @r1
+L1: prn @r5
+prn L1
+not @r2
+mov @r4, @r3
+m4
+dec @r6
+jsr L1
+clr L1
+L2: jsr @r4
+red @r6
+L3: sub 382, @r1
+rts
+L4: jmp @r7
+bne @r5
+mov -390, @r5
+L5: bne L2
+lea L1, L1
+rts
+inc L1
+sub @r4, @r2
+m2
+sub L3, L0
+add -381, L1
+L6: add 469, L3
+L7: jsr L0
+inc @r0
+cmp L0, L1
+m0
+clr @r5
+red L0
+red L1
+add @r4, L7
+prn L5
+add @r5, L0
+m2
+jmp L5
+rts
+red L4
+jmp @r1
+sub @r2, L6
+jsr @r5
+cmp L3, L1
+dec @r7
+L8: dec @r6
+red @r5
+clr @r6
+inc @r1
+rts
+red @r4
+add @r7, L0
+sub D0, X0
+red L5
+jsr L7
+L9: cmp @r4, @r2
+prn @r7
+inc @r1
+jmp @r5
+m2
+add L1, @r6
+not L8
+lea L8, L3
+jsr L5
+L10: lea L3, L0
+add @r7, D0
+L11: rts
+inc L9
+sub -508, L3
+prn @r5
+dec L4
+m1
+L12: cmp L9, L12
+L13: clr @r3
+not L1
+mov L8, L3
+red @r7
+rts
+dec @r4
+sub 179, L7
+inc @r1
+sub L7, @r5
+add L2, @r3
+L14: lea L4, L7
+jsr L5
+red L14
+bne @r5
+cmp L3, @r2
+sub -121, L3
+L15: jsr S8
+L16: add 201, @r3
+m4
+prn @r5
+red L45
+add -376, @r2
+clr @r5
+jsr @r3
+cmp L13, @r5
+m3
+L17: cmp L43, @r3
+bne L6
+m2
+prn -186
+jmp L4
+lea L12, L8
+red @r6
+bne D0
+not @r4
+lea L5, @r3
+red L17
+sub L2, D0
+sub @r3, @r6
+clr @r7
+red @r1
+prn @r4
+mov L8, L2
+dec @r6
+clr @r2
+m0
+add L15, L7
+jmp @r3
+jmp D0
+rts
+inc L13
+add L6, @r5
+L18: mov L16, @r6
+sub 164, @r1
+L19: not @r5
+jsr @r0
+L20: rts
+dec @r3
+red @r3
+cmp @r6, @r7
+dec L18
+m0
+rts
+cmp L9, 76
+clr @r4
+L21: prn 391
+sub L11, @r6
+m2
+bne L10
+L22: add @r0, @r5
+not @r2
+not @r3
+mov @r0, S1
+m1
+sub -250, L12
+jsr L16
+sub @r0, @r4
+not L18
+add @r4, @r2
+rts
+inc @r0
+jmp @r0
+clr @r6
+cmp S0, @r2
+jmp L6
+inc L17
+jmp @r4
+add 457, @r7
+inc L19
+L23: sub L19, @r3
+m4
+bne @r1
+jmp L17
+jmp L7
+clr @r6
+m1
+cmp 191, -119
+jmp L13
+sub 51, @r6
+L24: rts
+bne L34
+mov L8, L9
+red L5
+rts
+not S7
+m1
+jmp @r2
+rts
+not L29
+prn 488
+add L12, @r3
+red L16
+cmp @r2, -64
+rts
+lea L20, @r0
+m3
+red S2
+clr L46
+red @r4
+sub 371, @r1
+sub 60, L21
+mov -394, @r4
+inc @r5
+L25: jmp @r7
+inc @r2
+jsr S6
+prn @r2
+inc L11
+sub 446, @r2
+L26: rts
+prn 97
+add L35, @r4
+sub 115, @r1
+bne @r4
+dec L8
+jsr L4
+mov 89, @r4
+L27: clr @r5
+lea L2, L4
+dec @r7
+prn L16
+jmp @r0
+not L16
+prn 342
+inc @r6
+L28: jmp L5
+add @r7, L10
+mov @r4, L6
+dec L14
+mov L17, L57
+jmp @r6
+m3
+bne L11
+red L23
+L29: jmp L3
+sub L24, L14
+add 368, L15
+add L11, @r7
+add L29, L15
+not @r2
+L30: red @r0
+lea L15, @r7
+lea L16, L23
+cmp 128, L17
+cmp L10, S9
+cmp -350, -265
+not L59
+L31: sub -469, @r6
+jmp S5
+add @r1, L4
+red L0
+inc L33
+L32: rts
+clr L8
+L33: sub -23, @r7
+rts
+L34: jmp @r0
+cmp -26, 256
+red L20
+jmp L13
+jmp L0
+mov L6, @r4
+add L5, @r6
+bne L13
+L35: cmp L2, -66
+rts
+inc @r2
+rts
+bne L6
+m3
+dec @r7
+rts
+mov L35, L10
+dec L32
+bne L21
+sub L33, @r2
+prn L12
+L36: mov L11, @r5
+red @r0
+cmp 232, 299
+bne @r7
+L37: lea L1, L21
+clr L9
+red L7
+lea L52, L28
+lea L13, L7
+bne @r2
+not @r0
+not L2
+prn 117
+jmp @r1
+mov @r3, L10
+dec L25
+not L19
+red @r1
+clr L19
+not @r3
+jmp L16
+inc @r1
+jmp L1
+m3
+mov L8, L27
+L38: add 411, L18
+red L9
+clr @r2
+cmp L36, L14
+prn -402
+mov @r6, L29
+lea L28, @r7
+rts
+dec L33
+clr @r6
+jsr @r5
+L39: red @r3
+rts
+inc @r3
+cmp X1, -191
+dec @r7
+jsr @r1
+cmp -226, @r4
+sub L32, @r7
+red @r7
+L40: sub @r3, @r1
+rts
+L41: dec L2
+L42: dec L32
+m3
+sub @r5, L34
+add L5, @r2
+red @r3
+prn 200
+dec L30
+L43: not L18
+jsr L11
+L44: mov @r1, L52
+bne @r4
+L45: inc L16
+not @r0
+bne L17
+inc @r1
+mov -323, L42
+m0
+m0
+rts
+L46: prn L25
+clr @r3
+jsr L35
+m1
+prn @r7
+inc @r0
+dec L5
+m3
+m0
+mov L50, @r1
+m2
+jsr @r0
+jmp L7
+rts
+jmp @r5
+mov L1, L47
+clr @r1
+inc @r6
+sub @r2, @r3
+lea L19, L17
+bne @r0
+m0
+L47: mov @r4, L49
+jsr L38
+red @r5
+L48: jsr L39
+L49: add L26, D0
+mov -468, L6
+dec D0
+m0
+m1
+rts
+clr @r0
+sub -265, D0
+sub @r4, @r1
+inc @r7
+jsr L46
+jsr @r6
+lea S7, @r2
+L50: add L36, @r6
+L51: cmp 73, L50
+m4
+L52: red @r0
+prn -200
+prn L16
+L53: inc @r1
+L54: cmp 274, L31
+jmp L54
+red @r3
+cmp -70, L53
+jmp L51
+sub @r7, @r6
+L55: dec @r2
+lea L18, @r1
+not L4
+clr @r0
+L56: clr L27
+dec S8
+rts
+m0
+rts
+rts
+sub L45, L37
+sub @r6, L14
+bne L23
+dec L55
+add L6, X2
+red L8
+sub @r0, @r1
+jmp @r0
+jsr @r7
+clr L51
+clr @r4
+add L26, @r4
+m2
+m3
+inc @r4
+jmp @r1
+red @r0
+m4
+m4
+not L17
+lea S0, @r0
+bne @r1
+mov @r3, S1
+lea L49, X3
+L57: prn -312
+bne S4
+lea L58, L34
+jsr @r0
+L58: bne L55
+m3
+bne X4
+m4
+lea L59, L59
+L59: lea D0, S5
+stop
+D0: .data 439,380,-98,364,-252,360,350,434,262,170
+D1: .data -99,452,-213,206,256,271,37,-229,470,97
+D2: .data 101,-297,-496,-190,447,294,261,411,-316,447
+D3: .data -34,-207,205,-394,276,120,-174,449,-330,-185
+D4: .data 381,372,153,-241,331,-9,-321,-13,362,311
+D5: .data -433,303,284,-395,339,-305,193,-274,-195,436
+D6: .data 30,427,-92,-36,-107,-93,450,-258,-38,251
+D7: .data -165,-380,-129,-55,-436,52,-98,496,-211,473
+D8: .data -473,149,-270,-21,118,18,-40,-299,-241,-254
+D9: .data -343,21,53,-107,317,-292,42,260,-373,125
+S0: .string "gctofno"
+S1: .string "kxgbtv"
+S2: .string "i"
+S3: .string "zotdltechnjicb"
+S4: .string "xkbxemwgc"
+S5: .string "xslxxyhxkve"
+S6: .string "club"
+S7: .string "gzhclz"
+S8: .string "fuadqjyyqszehovluwwr"
+S9: .string "xjlclfpndztfrfas"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r5
+    prn 45
+endmcro
+mcro m1
+    sub @r3, @r4
+    prn 67
+endmcro
+mcro m2
+    sub @r4, @r1
+    prn 98
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 7
+endmcro
+mcro m4
+    sub @r4, @r4
+    prn 68
+endmcro
+prn @r2
+not @r3
+dec @r4
+dec @r4
+not L0
+sub -182, @r7
+sub 326, L0
+sub L0, D0
+sub L0, @r4
+L0: add 113, L0
+L1: prn L1
+red L0
+dec S9
+bne @r1
+rts
+rts
+inc @r2
+bne @r5
+mov -146, L1
+dec @r0
+jmp @r6
+sub L0, @r5
+add -36, L0
+m0
+clr @r0
+clr @r3
+clr @r3
+sub @r2, L0
+red @r0
+cmp @r0, @r5
+dec L1
+mov L0, L1
+cmp 138, @r1
+clr @r7
+lea L0, @r6
+prn 193
+m1
+bne L0
+not @r2
+inc @r1
+not @r3
+clr L0
+L2: add L0, @r4
+m0
+jsr @r4
+L3: dec @r6
+cmp @r6, 100
+jsr L1
+not @r1
+L4: clr L1
+lea L4, L4
+red @r6
+sub -441, @r0
+L5: clr @r4
+clr @r7
+m0
+inc @r3
+mov 463, @r3
+mov -411, L0
+inc @r4
+jmp @r1
+L6: lea L1, @r6
+jmp L4
+inc @r6
+cmp L4, L3
+add @r3, @r6
+bne @r2
+jsr @r4
+cmp L0, 163
+sub @r1, S7
+m2
+mov L4, @r0
+mov @r1, X0
+m2
+add @r7, D0
+jmp L6
+L7: jmp L1
+L8: rts
+dec X1
+jsr @r7
+rts
+jsr @r4
+rts
+rts
+sub @r0, L3
+jsr L1
+sub @r1, L3
+L9: jsr L28
+jmp L3
+sub -25, L2
+clr @r4
+m1
+m2
+cmp @r3, @r2
+bne @r6
+sub L0, @r1
+L10: jmp @r0
+dec L0
+jsr @r1
+m4
+clr @r1
+L11: jsr L2
+rts
+red @r5
+red S5
+prn 126
+sub @r0, @r7
+prn L0
+not @r1
+lea L1, @r0
+add -445, L11
+m1
+red L37
+prn -192
+add 129, L2
+mov -428, L1
+dec L4
+cmp @r2, @r1
+rts
+cmp -405, L1
+red D0
+jmp @r0
+rts
+prn @r4
+L12: sub @r6, L5
+m1
+prn L7
+dec L0
+bne L2
+inc @r2
+add @r3, @r0
+jmp L3
+cmp @r5, @r6
+m0
+rts
+dec L1
+not @r7
+lea L2, L10
+jmp @r2
+L13: add 291, @r5
+cmp L9, L13
+red L9
+add L4, @r6
+L14: jmp L9
+cmp L0, @r4
+m4
+sub -90, @r0
+jmp @r0
+inc L11
+jsr @r2
+inc @r6
+dec L2
+m4
+jsr L0
+lea L4, L10
+bne L7
+not @r5
+lea L11, L14
+inc L14
+lea L5, @r3
+m2
+prn 341
+prn L11
+m2
+not @r4
+prn 270
+add 275, @r7
+dec L5
+red @r4
+L15: dec @r5
+lea L1, L15
+L16: bne @r0
+lea L5, @r0
+m3
+inc @r4
+add -380, L15
+dec @r3
+sub -88, L1
+m2
+m2
+sub -433, @r5
+L17: cmp @r6, L7
+jsr L15
+L18: prn L3
+m0
+lea L10, @r5
+clr @r6
+m4
+dec L18
+inc L13
+L19: rts
+dec @r5
+mov -239, L0
+dec L1
+add L0, L5
+rts
+clr L0
+cmp @r6, @r3
+L20: bne L20
+m2
+not @r5
+prn 485
+jsr @r0
+red L13
+not @r2
+clr @r1
+dec @r3
+rts
+lea L0, @r1
+lea L19, @r1
+lea L3, L1
+sub -364, L6
+dec @r6
+inc @r5
+dec @r0
+L21: add L20, L5
+prn L3
+clr L0
+dec L16
+bne L18
+rts
+sub 392, L6
+jsr L15
+rts
+L22: red @r2
+clr L0
+L23: lea D0, L7
+jsr @r3
+dec @r1
+m4
+L24: rts
+m4
+not @r2
+m1
+cmp 205, L21
+L25: jsr @r0
+mov -326, L6
+jsr L3
+bne L14
+dec L42
+clr L10
+inc @r3
+m0
+L26: inc @r3
+jsr @r5
+sub L8, L7
+L27: add L8, @r7
+sub L7, S9
+dec @r3
+lea L4, @r2
+L28: red L4
+clr @r2
+bne @r3
+L29: sub 0, S4
+lea L20, L19
+rts
+not L2
+L30: mov -48, L18
+red L14
+not L3
+prn @r0
+bne @r7
+L31: inc L36
+dec @r4
+jmp L8
+jmp L11
+rts
+jsr @r7
+add 167, L27
+m0
+bne @r2
+bne L6
+L32: jmp @r4
+dec L37
+dec @r6
+prn L12
+L33: bne L13
+lea L3, L32
+red L4
+inc @r1
+jsr L29
+add -162, @r2
+add L24, @r0
+L34: not @r5
+L35: add @r5, @r5
+red @r4
+cmp @r4, @r6
+lea L34, L41
+rts
+L36: bne @r6
+m4
+inc @r5
+cmp 426, @r5
+m2
+m2
+prn @r0
+sub @r0, @r7
+prn @r2
+L37: jmp @r6
+add @r7, @r6
+rts
+prn -77
+L38: rts
+jsr L14
+not L58
+mov @r5, @r7
+not @r2
+L39: prn D0
+not @r2
+cmp 227, 284
+dec @r0
+not @r7
+bne @r6
+rts
+inc @r4
+cmp 291, @r5
+red L59
+red L7
+cmp @r5, L38
+mov @r5, @r0
+not L34
+inc L1
+dec L29
+dec L27
+m3
+jsr L25
+cmp L2, L23
+red L46
+mov L24, X2
+L40: mov -181, L54
+rts
+prn L7
+prn @r6
+jmp @r6
+m0
+m4
+cmp @r4, 144
+not @r4
+red @r4
+clr L49
+red L59
+sub @r4, L40
+red L3
+jmp @r2
+m4
+L41: cmp D0, 205
+mov @r2, @r0
+dec @r3
+clr S3
+jsr @r3
+jsr S7
+rts
+L42: jsr @r5
+jmp L17
+jsr L4
+mov @r6, @r6
+prn L33
+L43: dec @r7
+clr L6
+clr @r1
+mov -215, L56
+m3
+sub 410, @r3
+rts
+lea L25, @r0
+jmp @r2
+sub @r1, @r4
+prn @r0
+L44: jsr L4
+jsr @r0
+add L22, L44
+dec @r7
+not @r5
+L45: clr @r3
+inc L27
+lea L28, L21
+inc L19
+red @r2
+cmp L44, @r6
+cmp 342, -115
+L46: inc @r0
+L47: red @r7
+dec L24
+clr @r0
+mov S9, L50
+cmp @r4, 413
+red @r0
+prn @r5
+jmp L55
+L48: dec @r4
+L49: inc @r4
+jsr L44
+inc @r0
+dec @r6
+L50: dec @r0
+cmp L6, 382
+jsr L36
+dec @r3
+cmp -424, -293
+sub -91, L30
+prn -300
+m2
+m1
+add L10, L35
+jsr @r6
+clr @r4
+L51: clr @r4
+red @r3
+m2
+lea L42, @r0
+L52: lea L1, @r7
+inc @r1
+L53: bne @r3
+L54: rts
+lea L59, @r4
+jsr L42
+m2
+L55: cmp 344, S6
+L56: sub @r3, L2
+cmp X3, 405
+lea L11, L1
+cmp -475, -399
+cmp -163, -405
+L57: mov 461, @r4
+rts
+L58: jsr @r3
+sub 251, D0
+sub 24, @r6
+jmp L55
+prn D0
+clr @r1
+prn L58
+add D0, L24
+m0
+cmp S1, L46
+L59: jsr S2
+rts
+inc X4
+clr S2
+sub D0, S0
+stop
+D0: .data -271,-117,-227,-471,-446,28,-290,-361,-456,-134
+D1: .data 34,-234,83,-27,-397,-157,317,-444,-40,-114
+D2: .data 402,223,120,451,-45,-146,-369,-426,-441,203
+D3: .data 42,-94,-319,-48,-402,116,-310,207,-116,-151
+D4: .data 366,480,482,-84,-80,357,-459,229,-261,66
+D5: .data -4,-401,-145,-315,-32,350,226,95,-303,494
+D6: .data 102,-85,-88,330,-180,-325,-236,396,107,89
+D7: .data -384,-156,355,-438,21,-395,101,-306,365,-67
+D8: .data 47,-264,-127,-281,-388,-416,-265,-180,-213,203
+D9: .data 138,5,-241,180,-236,68,-25,330,-56,11
+S0: .string "qmwxrlfemlfoszzgjkj"
+S1: .string "nxt"
+S2: .string "igomlps"
+S3: .string "oyrwomqvzzorqv"
+S4: .string "qvuqbsge"
+S5: .string "jcdykqbyjyn"
+S6: .string "xedplpk"
+S7: .string "b"
+S8: .string "vqsrjpduelxrhwetors"
+S9: .string "oqehqhw"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r7
+    prn 15
+endmcro
+mcro m1
+    sub @r7, @r5
+    prn 66
+endmcro
+mcro m2
+    sub @r6, @r7
+    prn 64
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 83
+endmcro
+mcro m4
+    sub @r6, @r2
+    prn 93
+endmcro
+m4
+dec @r4
+not @r6
+inc @r1
+jsr L0
+not @r1
+not @r0
+bne @r4
+jmp @r6
+m0
+jmp L0
+L0: prn L0
+cmp L0, 296
+bne @r6
+cmp @r0, @r5
+inc @r1
+cmp L0, L0
+rts
+bne L0
+jsr L0
+inc L0
+cmp L0, @r2
+rts
+cmp L0, @r7
+sub -441, @r5
+inc @r2
+prn -408
+clr @r3
+L1: add @r5, @r2
+m1
+bne L0
+jmp L0
+bne @r6
+clr L1
+m1
+not L1
+add @r5, L0
+m0
+not L0
+dec L0
+mov L0, L1
+jmp @r7
+red @r3
+clr L0
+jsr @r5
+jsr L0
+not L1
+not @r3
+L2: mov @r1, @r6
+L3: cmp L3, -480
+mov L0, L1
+rts
+mov @r1, L0
+dec @r7
+bne D0
+cmp 367, 479
+L4: jsr L3
+rts
+mov L0, L2
+jsr L0
+lea L0, @r3
+dec @r4
+cmp @r4, L0
+lea L1, S3
+add @r4, L3
+sub @r7, @r7
+L5: not @r7
+cmp -139, L5
+red L2
+m4
+L6: clr @r4
+bne L22
+mov -443, @r5
+L7: inc @r6
+mov L2, L0
+bne @r2
+not L5
+lea L6, @r6
+cmp L2, X0
+jmp @r3
+not @r5
+cmp 349, @r0
+rts
+prn L7
+dec L2
+red @r4
+L8: jsr L5
+L9: lea L8, D0
+cmp L8, L2
+not L9
+L10: rts
+clr L9
+clr @r5
+mov @r7, L2
+clr L10
+not L1
+add L2, @r3
+add L4, L5
+dec @r6
+bne @r4
+sub X1, S8
+not @r4
+add 413, S8
+prn @r3
+mov L8, @r6
+L11: cmp @r3, @r4
+not @r3
+prn L7
+jsr @r6
+inc @r3
+sub L0, @r7
+L12: clr @r5
+dec L5
+bne L11
+rts
+prn @r3
+dec L5
+not @r3
+jmp @r6
+clr L7
+sub @r0, @r0
+L13: mov L11, @r6
+cmp L7, 342
+m0
+dec @r2
+L14: add @r6, L4
+cmp @r1, @r3
+jmp L3
+cmp L4, L3
+cmp 80, 163
+not L6
+L15: rts
+lea L13, @r4
+dec L3
+red L7
+add @r3, L1
+sub L5, @r0
+rts
+L16: clr L35
+cmp L13, -145
+prn @r3
+clr L1
+m3
+clr L3
+m1
+L17: bne @r1
+dec @r5
+cmp L5, L12
+sub 456, @r2
+clr L7
+red D0
+inc @r6
+rts
+inc L17
+L18: prn @r7
+sub L17, L5
+lea L14, L13
+clr @r0
+prn @r3
+cmp @r7, @r2
+L19: prn L8
+red @r4
+inc L18
+rts
+dec @r5
+bne L7
+add 484, @r6
+not L7
+jmp @r6
+clr @r1
+L20: jmp @r3
+not @r0
+inc @r1
+sub @r0, L10
+L21: prn L11
+lea L8, L1
+inc @r0
+clr L8
+m3
+bne @r2
+L22: inc L46
+clr @r2
+cmp -6, 481
+bne @r6
+dec @r7
+inc L14
+m2
+sub @r1, @r5
+sub L12, @r6
+L23: red @r3
+m1
+jmp @r6
+mov -407, L20
+m2
+L24: clr L15
+m2
+rts
+m1
+mov L4, @r2
+sub @r1, @r1
+jsr @r2
+not D0
+add -49, L10
+rts
+L25: bne @r4
+rts
+rts
+L26: rts
+prn 96
+red L15
+m3
+rts
+prn 184
+rts
+L27: bne X2
+cmp L8, @r3
+red L20
+jsr @r6
+bne @r2
+m2
+sub 338, @r3
+m0
+rts
+cmp 80, @r7
+L28: inc L3
+m3
+dec @r2
+clr @r3
+mov @r7, @r1
+L29: rts
+L30: red @r6
+m2
+jmp @r1
+red L0
+sub L3, @r7
+L31: dec @r1
+lea L9, L11
+bne @r4
+lea L11, @r2
+add -170, @r3
+add @r6, @r6
+bne @r1
+lea L27, @r4
+add @r4, L23
+bne @r4
+cmp @r2, @r3
+dec L1
+red L26
+L32: bne L41
+jmp L29
+not L12
+red @r2
+jsr L16
+bne @r0
+add -266, @r1
+cmp L19, 155
+jsr @r3
+dec L32
+lea L28, L28
+m1
+L33: prn -112
+not @r3
+inc @r5
+sub 244, @r4
+bne L32
+m3
+jsr @r2
+L34: jsr L28
+red L29
+cmp -372, L7
+L35: lea S6, @r3
+bne L21
+inc @r6
+dec L47
+not L33
+clr @r0
+m0
+red L35
+red L30
+jsr @r0
+red @r2
+not L23
+rts
+clr @r6
+L36: clr L4
+L37: jmp L31
+m2
+prn 35
+not L3
+red @r3
+rts
+lea L15, L55
+lea L47, @r2
+rts
+not L29
+lea L28, L36
+dec @r2
+add @r1, @r7
+inc @r4
+jsr L2
+add @r2, L31
+jsr @r4
+cmp 224, L12
+sub 167, @r6
+L38: red L19
+sub L2, L5
+rts
+m4
+jmp L21
+sub L59, D0
+rts
+clr S6
+m2
+rts
+L39: sub 214, L26
+not @r6
+L40: jsr L43
+jmp L13
+inc L27
+m3
+L41: red @r4
+clr L56
+m3
+red D0
+cmp @r3, @r0
+clr L29
+cmp @r1, @r2
+clr @r2
+clr L13
+add @r5, @r6
+clr S4
+mov L24, @r2
+clr L4
+clr L42
+jmp L34
+cmp L35, L32
+add @r7, L3
+clr L23
+dec @r5
+inc @r2
+jsr L34
+red @r4
+inc @r6
+L42: rts
+m2
+red @r4
+mov @r1, @r7
+clr L41
+red L27
+L43: dec L16
+inc L38
+not L27
+not @r4
+jsr S0
+sub @r1, @r3
+L44: lea L44, @r3
+prn @r6
+L45: not @r4
+cmp L0, L36
+jsr L11
+L46: clr L7
+add @r7, @r5
+jmp @r6
+L47: dec @r2
+sub 314, L0
+L48: add L39, S2
+L49: cmp 179, 469
+clr @r1
+m1
+L50: jsr @r5
+add @r4, L33
+L51: dec L37
+dec @r7
+cmp L21, L46
+dec @r7
+prn -96
+L52: inc L39
+L53: jsr @r3
+clr @r1
+cmp L11, -369
+jmp @r4
+mov @r2, L19
+L54: add 499, @r6
+bne @r1
+add L18, @r5
+mov D0, @r7
+m2
+L55: sub L32, @r1
+red @r0
+clr @r0
+prn @r4
+jmp L28
+bne L24
+jmp L34
+m3
+red @r2
+L56: cmp 339, L20
+m1
+jmp L40
+bne @r5
+clr @r3
+jmp L58
+clr @r6
+jmp D0
+jmp @r4
+not @r3
+m4
+add @r7, L33
+bne @r6
+not @r5
+rts
+m2
+dec L42
+rts
+sub L20, S4
+m1
+jmp @r0
+prn L58
+m3
+m2
+jmp @r3
+lea X3, L5
+clr L57
+L57: prn L59
+add L4, @r5
+red @r0
+rts
+prn @r2
+L58: mov 366, L59
+m1
+m2
+rts
+jsr L59
+add S4, @r3
+bne S9
+L59: add D0, @r2
+red D0
+bne L11
+mov X4, D0
+prn S2
+stop
+D0: .data -395,-414,267,-436,-230,442,-354,-296,415,227
+D1: .data -266,45,-348,76,-10,-93,-454,-485,30,77
+D2: .data -471,194,466,-476,188,-172,-248,-398,249,-234
+D3: .data -229,234,-488,78,-407,496,-64,-267,-180,-475
+D4: .data -327,-451,18,-271,-407,-48,-125,316,-307,-442
+D5: .data 378,415,-342,440,215,446,-198,-429,347,-218
+D6: .data 479,26,82,-156,202,-380,112,-169,-258,410
+D7: .data 116,111,98,34,-369,-465,-139,422,111,291
+D8: .data -125,144,372,108,-197,-427,-414,-119,-55,-379
+D9: .data 383,288,289,-276,309,-186,-387,203,-146,-115
+S0: .string "rya"
+S1: .string "hxvpehqdkfb"
+S2: .string "fxraorcpgqugdanx"
+S3: .string "bwmvynyozrnwcd"
+S4: .string "yvddkhlmlpviebwqqccf"
+S5: .string "dgemlidsj"
+S6: .string "iaxqvqlhbvtdbqs"
+S7: .string "nonbyngpgodjn"
+S8: .string "ul"
+S9: .string "zxzpgku"
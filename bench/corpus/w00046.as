@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r2
+    prn 54
+endmcro
+mcro m1
+    sub @r4, @r7
+    prn 64
+endmcro
+mcro m2
+    sub @r0, @r5
+    prn 29
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 59
+endmcro
+mcro m4
+    sub @r0, @r0
+    prn 17
+endmcro
+dec @r4
+red @r0
+red L0
+bne @r0
+dec @r5
+dec L0
+rts
+L0: sub L0, @r0
+m3
+red L0
+add L0, @r6
+prn @r7
+dec @r7
+inc S3
+m4
+sub L0, @r3
+prn -417
+bne L0
+mov -269, L0
+inc L0
+add @r2, L0
+bne L44
+rts
+mov @r0, L0
+bne @r1
+m3
+lea L0, @r3
+m3
+sub L0, L0
+red @r3
+m2
+L1: inc L0
+bne L0
+jsr @r0
+bne L54
+inc @r5
+jmp L1
+jsr L1
+lea L1, L0
+rts
+rts
+red L1
+jsr L0
+red L1
+sub 16, @r0
+m4
+clr L0
+L2: rts
+jsr L2
+inc @r3
+jsr L0
+rts
+jmp @r7
+cmp L2, @r5
+mov L2, L32
+mov L1, @r5
+jsr L0
+cmp 75, @r6
+sub L2, L0
+red @r4
+bne @r2
+jmp L2
+L3: cmp 48, 2
+cmp @r1, L2
+not @r6
+inc L2
+mov -454, L1
+add @r2, @r1
+bne L2
+sub 222, L26
+m3
+sub -83, @r1
+m2
+red L3
+clr L2
+cmp L1, -62
+mov L3, L2
+clr @r3
+cmp L1, L0
+L4: lea L0, L2
+prn 141
+L5: cmp L1, L1
+sub @r2, L2
+bne @r4
+not S3
+red L0
+inc @r5
+mov 36, L3
+dec @r4
+jmp S9
+L6: sub @r0, @r5
+red L5
+bne @r5
+cmp 250, @r4
+mov @r6, @r7
+mov @r4, S3
+clr L1
+dec L0
+jsr @r5
+m4
+jmp @r2
+red @r3
+red L1
+bne @r5
+add L6, L5
+dec L2
+not L6
+L7: red L4
+bne L7
+L8: jmp L1
+lea L6, @r1
+rts
+m3
+jsr L6
+L9: jmp L4
+clr @r2
+mov L5, @r5
+jsr @r5
+lea L2, @r3
+add L8, L21
+add -371, L2
+mov L3, L0
+lea L6, L1
+lea L6, L5
+not L2
+not @r5
+prn 2
+dec @r2
+inc L4
+L10: jmp @r6
+cmp 15, L9
+rts
+add @r1, L5
+L11: clr L0
+jmp @r4
+lea L4, L11
+bne @r1
+sub 31, L7
+jsr @r2
+L12: red @r0
+inc @r0
+not D0
+add L7, @r2
+L13: not @r0
+sub 218, @r5
+mov L5, L3
+red @r4
+m0
+m1
+prn -288
+cmp 494, @r2
+jsr @r5
+lea L12, @r1
+red L5
+cmp -338, L13
+add L13, @r2
+mov @r5, L5
+mov L10, @r6
+clr @r7
+prn -337
+L14: jsr D0
+lea L10, @r0
+prn -295
+not L15
+cmp L4, L10
+lea L12, @r5
+L15: lea L15, L9
+prn L14
+m4
+lea L14, L10
+clr @r1
+m2
+jmp @r5
+bne @r6
+clr @r6
+not L55
+cmp L40, -289
+clr @r1
+m3
+prn -169
+L16: jsr L13
+mov 54, L2
+m4
+red L10
+m3
+mov 149, @r4
+jsr @r3
+prn 495
+m4
+lea L3, L12
+lea L6, @r0
+dec @r5
+prn L59
+m1
+rts
+L17: jmp L8
+L18: dec L19
+cmp 227, @r6
+inc L12
+sub 423, @r6
+jsr L9
+jmp L18
+jsr @r7
+red L16
+inc @r0
+L19: inc D0
+cmp L13, @r3
+L20: cmp -343, X0
+not L7
+L21: dec @r0
+bne L14
+mov L18, L20
+L22: bne L20
+L23: add -70, @r5
+dec L21
+cmp 135, -30
+bne L1
+jsr @r6
+m2
+m4
+m2
+bne L11
+cmp L5, 271
+lea L17, @r5
+rts
+mov @r0, @r2
+rts
+L24: rts
+jsr @r3
+red @r3
+jmp @r2
+inc @r1
+mov X1, @r4
+red L22
+lea L17, L13
+L25: jmp L5
+red L9
+add @r5, L0
+mov 306, @r7
+lea L18, L3
+L26: sub L14, L7
+prn -221
+rts
+inc L1
+not @r4
+clr L10
+bne @r2
+m0
+prn -167
+red L7
+red L1
+add @r5, @r2
+L27: red L12
+jmp L24
+L28: red @r1
+jsr @r6
+cmp -456, 475
+not @r7
+dec L8
+red L10
+prn 472
+L29: add @r5, @r2
+L30: jmp L21
+lea L0, L15
+inc L13
+m2
+not @r1
+sub @r1, @r2
+prn L26
+mov @r4, @r5
+not @r3
+mov 40, @r3
+prn 205
+add S5, @r1
+mov L4, L13
+not @r3
+L31: clr L26
+add L28, @r5
+inc L28
+L32: prn L19
+sub -33, L18
+add L3, @r4
+L33: bne L13
+add L6, @r0
+L34: jmp L21
+add 397, L22
+prn -194
+dec X2
+not @r2
+bne @r4
+sub @r1, L10
+m4
+rts
+rts
+cmp @r0, 208
+not @r3
+m1
+rts
+red S8
+mov @r3, @r3
+mov L17, L7
+jsr L4
+m0
+add @r5, D0
+add -411, @r3
+dec @r0
+sub 446, @r1
+red @r6
+inc @r7
+m2
+L35: bne @r2
+L36: jmp @r3
+not @r4
+lea L20, L28
+L37: not L20
+L38: prn L11
+add -209, @r7
+L39: jmp @r0
+lea L37, @r1
+bne L30
+add L8, @r2
+not L21
+not @r3
+L40: dec @r6
+jsr L39
+prn -69
+L41: inc L11
+clr L27
+jmp L8
+L42: jmp L24
+jmp L8
+prn -146
+dec @r0
+bne L50
+inc X3
+prn 105
+jsr L0
+rts
+L43: lea L41, L32
+dec L2
+lea L48, D0
+L44: jsr L19
+prn -431
+inc L35
+L45: cmp @r0, L37
+rts
+L46: jmp @r2
+add @r6, L30
+bne @r6
+add @r4, @r5
+jsr L1
+clr @r1
+m4
+lea L45, @r2
+cmp 458, 212
+not @r1
+not L15
+bne @r7
+clr @r2
+bne @r4
+m0
+red L36
+mov @r0, L26
+not L23
+L47: inc L55
+cmp 432, L1
+add 12, L58
+sub @r0, L13
+inc L14
+sub @r6, L12
+sub L6, L3
+L48: lea L22, @r3
+inc D0
+m4
+jsr L28
+not @r3
+jmp @r4
+cmp @r0, 218
+add L31, @r5
+jmp @r1
+jmp @r3
+prn @r7
+m1
+inc L5
+dec @r5
+add L53, @r1
+inc L58
+add -124, L31
+jmp L6
+cmp @r1, L9
+L49: red @r3
+dec @r3
+m2
+clr @r2
+sub -358, @r3
+m4
+clr L55
+add -208, @r7
+red @r5
+sub -384, S7
+mov L19, @r6
+L50: prn @r0
+bne D0
+sub L1, L14
+m0
+L51: add L55, @r5
+m0
+m2
+sub L39, L1
+m1
+dec @r2
+L52: jmp L53
+cmp @r3, 439
+jsr @r3
+jmp @r6
+prn L56
+cmp @r3, @r1
+cmp @r2, -88
+m3
+rts
+m2
+add 371, @r0
+dec L8
+bne L17
+L53: mov @r4, L57
+jsr @r4
+dec @r6
+L54: add L14, @r2
+mov @r5, L53
+clr L58
+dec @r6
+L55: jsr @r7
+bne L43
+L56: jsr S6
+L57: mov -492, X4
+red D0
+L58: jsr @r6
+L59: sub -244, @r0
+rts
+mov S6, S0
+stop
+D0: .data 301,-389,470,-249,-51,1,66,35,-18,-112
+D1: .data 249,-358,-148,438,-21,487,448,-88,-224,130
+D2: .data -487,-304,388,-428,482,-486,-324,-144,-491,-83
+D3: .data 357,215,167,470,284,308,-170,287,113,64
+D4: .data 447,11,220,243,-115,242,289,200,-160,-106
+D5: .data 251,305,-428,-247,236,61,-452,321,-203,-55
+D6: .data 104,408,-439,-188,45,-299,-454,384,-432,-286
+D7: .data 464,-28,152,-18,-70,-123,423,63,-184,-135
+D8: .data 294,224,-277,435,286,460,-355,-87,-138,362
+D9: .data -305,434,39,421,236,-7,168,-485,-183,148
+S0: .string "whbggsmgkw"
+S1: .string "pbwfutx"
+S2: .string "z"
+S3: .string "rlzjfjvbezosnpndmk"
+S4: .string "gswmueis"
+S5: .string "dgxm"
+S6: .string "jexfpauwwhje"
+S7: .string "hgtcksmnpywgemath"
+S8: .string "elxgt"
+S9: .string "kggdgejsmqiknlig"
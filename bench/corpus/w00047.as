@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r4
+    prn 24
+endmcro
+mcro m1
+    sub @r0, @r0
+    prn 63
+endmcro
+mcro m2
+    sub @r3, @r2
+    prn 94
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 36
+endmcro
+mcro m4
+    sub @r2, @r7
+    prn 41
+endmcro
+rts
+prn 44
+clr L0
+bne @r7
+jsr @r3
+L0: inc @r4
+m4
+rts
+bne @r0
+bne L0
+bne @r3
+dec @r3
+m2
+lea L0, @r2
+add L0, @r1
+bne @r5
+jsr @r1
+clr @r0
+L1: add @r3, L0
+add -175, L1
+add L0, L1
+mov L1, @r6
+not L0
+L2: prn D0
+add L0, @r5
+cmp L2, @r5
+sub L2, @r7
+m3
+prn @r5
+cmp @r6, -1
+m2
+dec @r0
+sub L2, @r7
+cmp X0, L1
+add -106, @r4
+lea L0, L1
+add @r6, L1
+clr L0
+dec @r5
+lea L2, L0
+prn 95
+dec @r4
+add L0, L1
+L3: rts
+m4
+clr @r6
+cmp 499, L3
+inc @r7
+cmp @r0, @r0
+sub -40, @r3
+cmp L1, @r6
+lea L2, @r5
+rts
+prn 53
+not L2
+add @r1, L2
+clr L1
+m1
+bne L1
+prn @r1
+m1
+L4: clr @r2
+rts
+rts
+L5: cmp L2, 268
+jmp D0
+prn -469
+not L5
+red @r2
+add L1, L2
+bne @r1
+L6: add L2, L0
+jmp @r4
+lea L1, L2
+jmp @r3
+dec @r1
+red L5
+not @r6
+red @r0
+mov L6, @r6
+sub @r0, @r2
+sub L1, L6
+bne L2
+jsr @r0
+prn L1
+m0
+jmp @r3
+L7: prn L6
+inc @r4
+sub L7, @r4
+L8: sub L2, L4
+add @r7, @r5
+prn @r0
+inc @r3
+lea L5, L2
+dec L7
+jsr L5
+lea L35, @r3
+add @r5, L6
+L9: add -53, @r6
+rts
+lea L6, L2
+add @r4, L9
+jmp L8
+L10: inc @r4
+rts
+clr @r4
+jsr @r1
+red @r1
+m2
+inc @r2
+cmp @r2, @r1
+bne L1
+not @r5
+bne L2
+mov L3, L8
+inc L0
+clr L9
+mov L10, @r5
+add @r0, S5
+inc L10
+bne @r1
+L11: add L3, L4
+rts
+red S7
+red L57
+m4
+add L3, L8
+bne L7
+L12: jmp D0
+inc L9
+sub @r3, @r2
+clr L0
+add L1, @r4
+prn @r2
+L13: prn @r4
+cmp 33, L5
+L14: sub 14, @r7
+inc @r2
+inc @r2
+mov 357, L10
+rts
+jsr @r3
+m0
+bne @r4
+L15: sub L15, @r5
+add @r6, L12
+lea L14, L13
+jmp L7
+m0
+jsr L7
+L16: red L12
+clr @r0
+L17: lea L10, @r4
+sub L1, @r1
+L18: inc @r6
+rts
+add L0, @r5
+jmp L13
+cmp @r6, 382
+rts
+clr L16
+dec L6
+bne L12
+jmp @r6
+L19: rts
+L20: prn 359
+prn -348
+L21: dec @r7
+jmp @r6
+inc @r0
+m1
+m3
+bne L14
+rts
+m1
+add D0, @r1
+jsr @r0
+dec L20
+cmp L17, 100
+mov @r1, @r1
+jsr L0
+L22: cmp @r6, @r4
+mov @r6, L19
+rts
+prn 289
+lea L10, L7
+prn -383
+m1
+jsr @r6
+not @r5
+bne L0
+L23: mov -498, @r7
+jmp L10
+m4
+m1
+cmp -175, S8
+rts
+add L39, L22
+dec X1
+red @r7
+clr @r0
+cmp L15, @r5
+not L4
+not L3
+lea L0, @r7
+lea L16, @r6
+dec @r3
+prn @r7
+sub L41, S0
+cmp L18, 442
+jsr L26
+jmp L4
+jmp @r4
+rts
+prn 226
+prn L22
+prn @r2
+jmp L12
+jmp @r0
+clr L35
+not @r3
+cmp 70, L11
+lea S6, L11
+lea X2, @r6
+cmp @r0, L0
+red L9
+sub L7, L15
+not @r3
+sub @r2, L10
+red @r5
+L24: dec L19
+prn L11
+lea X3, @r3
+clr L13
+red L18
+inc L17
+m3
+lea L2, @r0
+L25: jmp L9
+lea L13, L5
+lea L9, @r1
+L26: inc L4
+red @r3
+L27: cmp L24, @r5
+jsr @r4
+dec L13
+clr L18
+clr @r6
+red X4
+cmp -254, 5
+inc @r5
+clr @r7
+jsr @r1
+m3
+jsr @r7
+inc L10
+dec D0
+prn 447
+L28: not @r2
+L29: clr @r4
+L30: jmp L17
+L31: add @r1, L20
+m2
+prn L20
+jsr @r2
+inc @r1
+inc @r5
+red @r4
+rts
+red @r1
+L32: lea L29, L29
+clr L14
+L33: dec L22
+add @r4, @r5
+dec L17
+red @r5
+red L58
+L34: sub @r6, D0
+lea L10, @r6
+m1
+cmp L15, L21
+red @r3
+dec L15
+bne L12
+dec L23
+red @r7
+not L2
+jmp L23
+m1
+not @r2
+L35: lea L27, @r3
+prn @r5
+sub 118, D0
+dec L16
+m2
+jsr @r3
+lea L22, @r1
+red @r3
+red L19
+prn -227
+dec L42
+mov -20, @r2
+sub @r0, @r5
+cmp -263, L32
+L36: add L43, L26
+prn @r5
+bne L51
+m3
+lea L49, S4
+inc L27
+lea L59, L17
+cmp -219, @r7
+L37: not L14
+add L36, @r5
+m0
+rts
+clr @r0
+jmp @r0
+jsr L29
+jsr @r3
+L38: add 295, L25
+clr L18
+L39: rts
+mov @r6, L22
+inc @r2
+lea L24, L24
+inc @r5
+sub 444, L8
+rts
+dec L20
+L40: jmp @r4
+lea L7, L15
+jsr S1
+bne L24
+cmp @r2, -92
+mov L24, L29
+jmp @r3
+L41: not L31
+rts
+sub 10, @r6
+add 457, @r2
+m4
+prn 263
+lea L7, @r4
+inc @r4
+jsr L18
+bne @r3
+not L26
+red @r2
+inc L23
+m0
+bne L37
+m1
+sub @r0, @r4
+jsr L4
+red L1
+sub -178, L6
+red @r6
+sub 469, L6
+m1
+L42: sub S2, @r0
+L43: not L15
+sub @r4, @r6
+m0
+not @r1
+m1
+jsr @r7
+L44: mov L33, @r6
+L45: dec @r3
+L46: mov 496, L37
+clr @r6
+jmp @r7
+clr @r1
+L47: bne L26
+inc L12
+L48: bne L0
+mov 496, @r2
+dec @r7
+bne L26
+jsr @r7
+mov 68, S5
+jsr @r6
+dec @r5
+m2
+not @r2
+red L47
+L49: clr L47
+red L22
+dec L45
+L50: dec @r1
+jsr L19
+not L53
+dec L2
+L51: red L32
+bne L41
+sub L16, L54
+m2
+mov 479, L23
+L52: jsr L8
+m1
+red L14
+bne L2
+red @r2
+prn L2
+L53: prn D0
+L54: prn -152
+inc @r1
+red L0
+prn -271
+m4
+inc L18
+jmp @r5
+rts
+L55: cmp L37, @r7
+jmp @r7
+jsr @r6
+bne S6
+add -242, S2
+m1
+mov @r4, @r2
+m0
+clr @r1
+mov 219, @r2
+inc @r3
+lea D0, L56
+L56: lea L58, @r0
+m3
+m2
+dec @r4
+L57: bne @r2
+L58: red L19
+inc L23
+bne L22
+red L45
+inc @r4
+jmp D0
+L59: red S1
+rts
+not D0
+stop
+D0: .data -114,325,225,-24,-215,-20,-255,-145,174,422
+D1: .data -27,494,-155,-128,-374,-405,-376,-476,-26,135
+D2: .data 127,-98,106,500,-162,-104,434,-492,-390,451
+D3: .data -488,435,444,-292,209,2,-37,296,300,25
+D4: .data -462,2,-45,268,60,119,166,-358,368,129
+D5: .data 36,-271,25,467,427,-121,-355,202,-44,347
+D6: .data -433,17,-168,-112,-482,-268,86,-5,103,357
+D7: .data -388,204,439,-422,232,-63,-155,-410,312,367
+D8: .data 414,-191,5,71,9,347,-80,499,222,379
+D9: .data 119,276,-218,-203,-276,-459,-252,-311,-487,98
+S0: .string "lqnptptgtsrugxvojhkd"
+S1: .string "qemogh"
+S2: .string "ymdfhpngufkvin"
+S3: .string "il"
+S4: .string "dfrkkty"
+S5: .string "zdacivtyixwzl"
+S6: .string "xytddplbsgzhoaunynln"
+S7: .string "mgibckkjujljkdbog"
+S8: .string "oycrbeqsgbtwnncpiqx"
+S9: .string "vnktwljbelcwhthnni"
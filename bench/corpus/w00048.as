@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r7
+    prn 62
+endmcro
+mcro m1
+    sub @r4, @r1
+    prn 29
+endmcro
+mcro m2
+    sub @r5, @r0
+    prn 60
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 12
+endmcro
+mcro m4
+    sub @r4, @r5
+    prn 66
+endmcro
+L0: lea D0, L0
+jmp L0
+not L0
+jmp @r0
+prn @r0
+jsr L0
+L1: dec @r1
+bne L0
+L2: jsr @r3
+clr L52
+L3: sub @r0, @r5
+not L1
+red @r0
+sub L0, L1
+clr @r3
+rts
+inc @r0
+clr @r6
+m4
+mov @r0, L2
+sub L2, @r3
+dec @r3
+bne L3
+rts
+clr L1
+L4: cmp @r5, L0
+L5: bne L1
+not @r3
+sub @r0, L0
+lea L1, L1
+lea L2, L0
+bne L1
+clr @r0
+m1
+L6: clr L5
+inc @r6
+sub @r2, L0
+sub L6, L4
+not L5
+add @r3, @r6
+cmp -199, @r5
+lea L2, L1
+cmp @r0, @r3
+jsr L2
+rts
+dec L3
+not L0
+inc L6
+clr L0
+m1
+rts
+rts
+L7: jsr L5
+L8: sub L6, @r5
+sub 358, L0
+prn L2
+L9: cmp 208, L4
+clr @r0
+jsr D0
+rts
+rts
+jsr @r1
+m3
+mov 61, @r5
+L10: prn -427
+mov L8, L7
+add @r3, L2
+add L10, @r6
+inc L1
+m4
+clr @r2
+mov -124, L0
+L11: lea L7, @r3
+jmp @r6
+not @r6
+prn L0
+add L9, @r4
+inc L3
+inc L11
+dec L0
+bne @r0
+jmp @r1
+prn @r0
+rts
+cmp -2, 341
+mov L3, @r1
+prn @r1
+jmp @r6
+dec @r7
+bne L1
+L12: inc D0
+sub -479, L9
+prn L1
+prn @r7
+jmp L8
+dec L11
+L13: not L7
+add -254, D0
+dec S8
+L14: bne L14
+prn L10
+cmp L4, L9
+sub @r4, @r1
+m2
+L15: clr L15
+cmp @r7, -156
+mov @r2, L9
+cmp @r5, @r6
+add @r5, @r0
+jsr @r6
+not L1
+red L1
+m1
+dec L12
+jmp L0
+prn L13
+clr L11
+not @r1
+jmp L5
+cmp L12, L10
+jmp @r2
+red L14
+red L9
+bne @r1
+not L4
+L16: inc @r2
+sub @r6, @r7
+L17: not @r5
+m2
+rts
+not L0
+sub L4, @r0
+bne @r2
+L18: cmp -111, L4
+jmp @r6
+rts
+sub -132, @r5
+red L16
+rts
+inc @r2
+dec X0
+prn @r5
+prn 6
+dec L11
+mov 424, @r7
+L19: sub @r0, @r5
+jmp @r4
+mov @r4, L8
+red X1
+clr @r7
+cmp L8, L28
+prn @r3
+bne L10
+lea L10, L15
+dec L11
+m4
+red L0
+mov @r4, @r1
+jmp L2
+m3
+L20: cmp D0, 1
+dec L6
+L21: sub L4, L56
+clr @r6
+m3
+rts
+lea L15, L17
+dec @r7
+add @r2, @r6
+jmp @r5
+L22: cmp L52, @r2
+not @r0
+cmp L3, -472
+dec @r4
+L23: bne L10
+clr L6
+not @r2
+L24: sub L0, @r1
+jmp @r1
+sub L10, @r3
+prn L1
+mov @r4, @r7
+cmp @r0, @r0
+red @r2
+m3
+dec L17
+dec L19
+m1
+add @r7, @r1
+cmp -240, L6
+cmp -452, L21
+L25: jmp L6
+m3
+m2
+L26: clr @r4
+dec @r2
+prn 88
+jmp L17
+mov 139, L9
+L27: red @r5
+L28: bne @r6
+jmp @r7
+not @r5
+lea L46, L47
+lea L8, @r7
+lea L28, @r3
+lea D0, @r6
+dec L2
+lea S2, @r6
+inc L21
+jmp @r4
+L29: bne S5
+jmp L29
+L30: sub L13, L16
+m1
+jsr @r1
+m3
+sub @r7, @r6
+dec @r0
+bne L20
+red L15
+not @r3
+red @r4
+red @r2
+L31: clr @r6
+lea L8, L3
+L32: cmp L28, 290
+add L18, @r1
+cmp @r1, D0
+cmp @r6, -231
+dec @r1
+cmp L24, @r7
+prn @r1
+rts
+clr @r7
+L33: sub L39, L19
+L34: jsr L32
+jmp L3
+red @r3
+dec S7
+clr @r6
+L35: inc L0
+sub L9, @r4
+L36: jmp @r1
+bne L2
+clr @r7
+L37: clr L12
+prn 305
+prn 52
+rts
+mov @r0, @r0
+jmp L15
+m1
+prn -140
+mov L8, L45
+cmp 220, 327
+mov S9, L25
+cmp L1, @r7
+m2
+m1
+rts
+not @r4
+L38: clr @r0
+L39: jmp @r2
+jmp L21
+clr @r2
+m0
+jmp @r0
+clr L2
+sub @r6, L29
+sub -429, @r5
+sub @r6, @r3
+m2
+mov 230, L10
+rts
+mov 331, @r3
+L40: red @r7
+mov -31, @r6
+not @r6
+m1
+dec @r7
+bne L24
+lea L53, L17
+sub L30, L6
+sub 179, L15
+add @r6, L35
+not L9
+L41: not @r6
+bne L37
+clr L40
+clr L9
+lea X2, L43
+L42: add @r0, @r1
+m0
+cmp -57, @r5
+dec @r2
+add @r3, @r4
+inc L0
+red @r5
+add @r2, L12
+red @r0
+lea L19, L22
+dec @r4
+cmp 18, 222
+m0
+m1
+mov 33, S2
+lea L56, L22
+jsr L0
+red @r1
+lea L42, L42
+m2
+dec @r2
+clr @r2
+rts
+clr L29
+inc L24
+dec L8
+lea L15, L2
+jmp L13
+prn L21
+mov @r3, @r0
+jsr @r0
+sub L15, L28
+L43: prn 66
+rts
+not @r1
+prn -247
+mov L42, @r7
+clr L12
+red @r6
+L44: inc @r1
+m1
+lea L23, @r4
+m4
+cmp -441, @r7
+mov L25, @r4
+cmp L13, L30
+jmp L3
+cmp @r6, 288
+dec L41
+jmp L6
+not L53
+rts
+jmp @r2
+add -138, L44
+lea L45, D0
+inc L6
+lea L32, L13
+mov -378, L16
+not D0
+sub -234, @r5
+inc L27
+inc L56
+jsr L57
+bne @r4
+L45: lea L4, @r4
+inc @r3
+sub X3, L17
+rts
+inc @r2
+red L42
+prn 61
+rts
+rts
+red L32
+sub -410, L45
+dec @r2
+m4
+m4
+m1
+L46: cmp L25, L10
+not @r3
+sub @r7, @r7
+bne L44
+m0
+L47: clr @r1
+inc @r2
+rts
+sub -437, L5
+not L47
+lea L31, L5
+mov @r7, @r6
+m0
+bne @r7
+dec @r4
+red @r6
+jsr @r7
+dec @r2
+dec @r3
+lea L34, @r5
+jsr @r4
+rts
+L48: cmp @r0, L31
+mov 150, @r7
+prn L5
+bne @r2
+mov @r5, @r6
+dec @r5
+dec L13
+m4
+bne @r5
+inc @r2
+L49: jmp L42
+L50: rts
+prn @r3
+not @r4
+clr L25
+add S1, @r2
+not X4
+m3
+mov -382, @r1
+L51: rts
+rts
+L52: sub 7, @r7
+cmp @r2, @r7
+prn L51
+L53: add @r2, @r0
+m3
+jsr L56
+add @r0, D0
+m1
+sub L41, @r2
+red @r0
+L54: bne L25
+prn @r6
+red L36
+add 325, @r4
+L55: jsr @r1
+cmp @r4, 97
+m4
+L56: prn 419
+dec L57
+cmp D0, L59
+L57: prn -211
+L58: bne L59
+cmp L34, -19
+prn L59
+m0
+L59: jmp S9
+stop
+D0: .data -314,153,178,-468,14,120,-474,-252,260,-171
+D1: .data -56,388,367,480,108,212,-207,119,-228,196
+D2: .data -443,107,440,-484,-72,112,-14,139,-333,237
+D3: .data 438,-65,-34,-459,-51,198,17,-476,319,325
+D4: .data -239,167,-89,-424,-76,217,-486,-445,-294,-439
+D5: .data -310,-461,161,-151,-495,-281,441,-165,-464,64
+D6: .data -471,-25,338,-417,-487,-19,-368,27,72,-382
+D7: .data 273,-319,-481,-326,305,401,0,134,335,-284
+D8: .data 168,171,-191,61,304,489,94,273,-32,396
+D9: .data 93,-5,-153,78,439,94,-205,449,-72,400
+S0: .string "lsiknqbxpkjab"
+S1: .string "ulnkezwnecjerkdaqhss"
+S2: .string "qdvhjkvyyuyvp"
+S3: .string "uplijxhiormjvssfcw"
+S4: .string "pcbvdgrh"
+S5: .string "lvirxkhhteqxhphga"
+S6: .string "mowbbrjdrcb"
+S7: .string "jjsrwhbjotkb"
+S8: .string "jplbdlusvkbfvne"
+S9: .string "codxcpvwhmfioid"
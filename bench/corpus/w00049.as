@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r2
+    prn 33
+endmcro
+mcro m1
+    sub @r1, @r3
+    prn 28
+endmcro
+mcro m2
+    sub @r7, @r6
+    prn 57
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 56
+endmcro
+mcro m4
+    sub @r7, @r3
+    prn 90
+endmcro
+sub L0, @r7
+m2
+bne L0
+jsr @r4
+mov 233, @r0
+L0: jmp @r3
+m2
+inc @r1
+red L0
+clr L0
+m1
+red L0
+bne @r5
+jmp @r0
+inc L0
+m3
+lea L0, @r7
+rts
+L1: red @r2
+red L0
+prn L0
+bne L0
+inc @r2
+jmp @r1
+sub @r3, @r2
+m3
+prn L0
+m3
+L2: bne @r0
+not @r4
+add S0, L2
+jsr @r6
+prn L0
+m4
+clr L2
+m0
+red L1
+L3: rts
+L4: sub L2, L0
+add @r7, @r5
+L5: jsr @r5
+sub @r6, @r3
+m3
+add 91, @r2
+jsr L3
+prn @r6
+not @r7
+lea L4, L4
+dec S0
+add @r7, L1
+prn @r3
+rts
+L6: prn L2
+L7: bne L4
+clr @r5
+jmp L5
+mov @r6, L3
+inc L16
+dec L3
+dec L6
+not X0
+prn L1
+mov @r4, @r0
+rts
+lea L0, @r2
+rts
+prn @r7
+add L0, L51
+dec @r5
+jsr @r5
+m0
+jsr L4
+m4
+mov L2, @r5
+m0
+rts
+jsr S0
+mov -78, @r7
+add -368, L6
+sub L6, @r1
+sub L6, L6
+jsr @r7
+cmp @r2, @r3
+L8: bne @r2
+lea L1, @r6
+jmp L1
+L9: add @r1, @r6
+jmp L9
+clr @r2
+clr L2
+add @r7, L3
+jmp L3
+cmp L5, L6
+rts
+cmp @r5, -247
+dec L4
+lea L4, L2
+m1
+m1
+mov 207, @r2
+jsr @r5
+add @r5, L7
+L10: dec L7
+dec @r5
+prn L10
+rts
+L11: bne L4
+cmp L5, L5
+rts
+add @r5, @r2
+lea L1, @r2
+clr L4
+clr D0
+jsr @r7
+inc L1
+prn @r3
+not L10
+L12: inc @r7
+prn L11
+rts
+bne @r7
+prn L55
+jmp @r0
+L13: clr @r0
+clr @r3
+L14: jsr @r6
+jsr L13
+dec L0
+sub L8, L9
+rts
+not L4
+sub @r4, @r2
+sub L3, @r2
+mov L5, @r0
+jsr @r5
+L15: mov 17, @r4
+cmp -107, 153
+bne L15
+mov L6, L3
+rts
+inc @r7
+dec @r3
+inc @r2
+mov 35, L14
+L16: lea L0, L1
+prn -159
+jmp @r3
+prn -10
+mov 321, L4
+not L0
+prn L13
+jsr L4
+L17: dec L11
+sub L4, @r2
+lea L15, L9
+L18: cmp -56, L12
+add @r6, @r0
+jsr @r2
+dec @r4
+sub @r0, L36
+add @r6, @r3
+red @r2
+L19: red @r0
+add 280, @r1
+L20: bne L2
+prn L16
+dec @r2
+cmp 297, @r5
+inc L7
+m4
+rts
+jsr L15
+jmp @r3
+sub 368, @r0
+L21: clr L31
+sub L6, @r2
+L22: jsr @r5
+not L14
+prn L17
+m3
+lea L21, @r7
+red L14
+rts
+L23: add L20, @r1
+clr @r7
+add L55, L13
+red @r2
+jsr L3
+rts
+mov 374, L40
+inc D0
+m1
+rts
+inc L18
+mov 111, @r2
+sub @r6, @r0
+mov L23, @r2
+m2
+lea L18, L4
+red @r0
+jsr @r1
+m0
+cmp -337, @r2
+dec @r2
+L24: add 17, L13
+L25: cmp @r3, @r1
+jsr L17
+not X1
+bne @r2
+add 412, @r4
+sub @r5, @r5
+L26: prn L3
+not L26
+mov @r6, L12
+bne L55
+m1
+red @r1
+add L15, @r5
+sub -223, @r3
+mov -298, @r1
+lea L16, @r4
+L27: rts
+L28: cmp S1, 428
+inc L17
+prn -120
+L29: bne L0
+L30: cmp -345, -180
+mov -121, D0
+cmp @r1, @r4
+inc L20
+not @r1
+rts
+dec L0
+red @r5
+not L10
+mov @r4, @r7
+red @r0
+inc @r1
+not @r4
+clr L30
+L31: bne L30
+add -297, L27
+jmp L1
+add -168, L1
+clr L19
+dec L20
+not @r1
+m4
+dec @r7
+jmp L30
+inc @r2
+red L30
+sub @r6, @r3
+dec @r2
+L32: jsr L10
+jmp @r1
+red L27
+jsr @r7
+mov -171, L14
+dec @r0
+dec L30
+jsr @r5
+lea L55, @r6
+inc L1
+sub @r5, @r4
+red @r6
+not L26
+clr L7
+m4
+add @r2, @r0
+L33: prn L13
+jmp @r2
+L34: not @r6
+prn 323
+L35: lea L34, @r6
+red L30
+lea L24, @r6
+L36: rts
+m4
+bne @r5
+L37: add D0, @r1
+m1
+inc @r7
+bne L6
+prn L29
+prn L22
+dec S1
+red L21
+prn L24
+L38: dec @r1
+jsr @r0
+rts
+prn D0
+m1
+jmp L35
+bne L17
+add L30, L4
+prn 261
+inc @r6
+lea L43, L8
+L39: cmp L31, 17
+m0
+sub L32, @r1
+L40: cmp -306, @r7
+bne @r7
+add L1, L30
+add @r6, L2
+lea L2, L10
+inc L26
+L41: clr @r4
+rts
+inc @r5
+bne L21
+red @r3
+red @r3
+red L5
+lea L11, L15
+L42: sub @r0, L59
+bne L5
+add -213, L8
+mov -2, @r3
+red S1
+add 136, @r1
+bne L29
+prn @r2
+mov @r3, @r2
+sub @r6, L0
+inc D0
+m2
+rts
+jmp @r1
+add 60, L46
+red L14
+prn 17
+clr @r7
+L43: cmp L27, 347
+jsr @r3
+m4
+not L30
+red L21
+m1
+L44: add @r4, S5
+m0
+m1
+jsr @r1
+jsr X2
+inc L1
+L45: rts
+red L15
+clr L8
+mov @r5, L7
+mov 115, L54
+jmp @r2
+clr L1
+L46: jsr @r0
+inc L13
+dec @r0
+clr @r3
+cmp @r2, @r0
+m2
+not L22
+dec L27
+m0
+rts
+clr @r5
+rts
+red L7
+not L47
+lea L3, @r7
+jmp L27
+L47: dec L33
+mov @r3, L3
+add S9, L20
+clr @r7
+cmp @r3, @r6
+bne L56
+red @r4
+rts
+m3
+clr L10
+mov L11, D0
+m4
+L48: not L29
+dec @r5
+L49: add @r3, @r4
+bne @r0
+jsr @r6
+not L6
+prn 185
+rts
+m0
+m3
+not @r0
+dec @r3
+mov @r4, @r4
+sub -62, @r7
+add @r0, @r2
+L50: clr L56
+red @r5
+inc L7
+lea L22, L19
+cmp L18, X3
+not @r7
+inc @r7
+m0
+L51: bne L59
+jmp L58
+bne D0
+L52: bne L6
+dec L56
+dec @r5
+red L0
+jsr S5
+cmp L51, L3
+m2
+rts
+lea S9, @r6
+inc @r3
+inc L12
+L53: lea L22, @r4
+red L12
+m2
+L54: lea L20, L46
+mov @r7, L51
+dec L41
+lea L28, @r4
+red @r4
+L55: bne @r6
+prn @r7
+bne L58
+bne @r4
+L56: not @r7
+L57: inc L59
+prn @r5
+L58: not L37
+mov 484, @r3
+bne S5
+cmp L29, 466
+L59: rts
+add X4, L11
+stop
+D0: .data 179,-309,-316,-118,144,420,426,-62,-314,-404
+D1: .data 163,286,219,-204,-153,40,365,206,-165,79
+D2: .data -205,-290,-63,-288,-122,-250,-159,-282,-246,-455
+D3: .data 239,-289,-232,-115,-432,99,-177,-197,422,377
+D4: .data -270,421,413,332,-241,-431,-55,107,-206,-150
+D5: .data 210,263,-163,273,-142,-383,-433,-39,-395,-463
+D6: .data 388,-496,-388,-92,23,-93,-226,53,242,410
+D7: .data 83,131,30,53,341,188,-328,236,-481,170
+D8: .data -308,-284,-27,135,-76,15,-406,267,-243,500
+D9: .data 270,-317,117,70,375,-117,444,381,-245,-113
+S0: .string "kexebpjpddssubmraee"
+S1: .string "fcewkdwpzjdxye"
+S2: .string "ukeapzhsbzg"
+S3: .string "vxaknmxyteu"
+S4: .string "fysinkrcit"
+S5: .string "wrutcacykbhs"
+S6: .string "l"
+S7: .string "lqq"
+S8: .string "yajrihcktuszpnw"
+S9: .string "edxzokbougoovlqoqm"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r4
+    prn 71
+endmcro
+mcro m1
+    sub @r5, @r4
+    prn 26
+endmcro
+mcro m2
+    sub @r1, @r4
+    prn 22
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 33
+endmcro
+mcro m4
+    sub @r1, @r1
+    prn 15
+endmcro
+dec X0
+cmp -408, @r4
+m2
+cmp -369, -315
+inc @r7
+m2
+dec @r4
+L0: inc @r2
+bne L0
+L1: add 134, L1
+prn @r0
+not @r6
+m2
+L2: inc L2
+not L0
+prn @r1
+mov 94, @r0
+m2
+clr @r3
+jmp @r5
+jsr L0
+lea L40, L1
+clr @r6
+not L2
+lea L0, L2
+dec @r4
+L3: red @r7
+clr @r5
+m4
+jmp L2
+L4: inc L0
+bne L1
+red L0
+mov -131, L2
+m3
+L5: jmp L2
+dec @r3
+L6: cmp -309, @r7
+m1
+L7: not L6
+m0
+inc @r1
+cmp 402, L7
+sub L4, @r3
+not @r7
+inc @r4
+rts
+add @r2, L5
+rts
+rts
+L8: lea L1, @r6
+dec L6
+rts
+rts
+red @r1
+not @r7
+L9: bne L30
+not @r4
+jsr @r5
+red @r5
+m1
+cmp @r4, L1
+lea L12, @r0
+prn -7
+bne @r5
+jsr @r3
+L10: bne L9
+prn L10
+cmp -186, L5
+m4
+jsr L6
+rts
+prn 106
+jmp @r0
+sub L2, L2
+cmp @r1, @r6
+bne L2
+m3
+L11: not S7
+dec L4
+mov @r2, @r7
+mov -291, @r0
+dec L2
+rts
+L12: lea L3, L10
+cmp D0, L7
+lea L4, X1
+jmp @r7
+prn -297
+rts
+jsr @r3
+L13: prn @r1
+jsr @r7
+dec L0
+m3
+cmp @r5, 317
+prn -392
+prn L2
+m3
+cmp L53, 313
+not @r1
+add @r1, @r0
+sub L12, @r6
+inc D0
+add 417, @r3
+L14: bne @r7
+dec L8
+inc @r5
+clr @r0
+m4
+jsr @r2
+add @r3, @r4
+mov 233, @r0
+jmp @r3
+L15: sub -208, @r7
+rts
+mov L10, @r6
+red @r6
+clr @r6
+red @r3
+cmp -448, L14
+dec L10
+cmp L6, -479
+lea L7, @r3
+dec L6
+add L12, L15
+L16: add L15, @r7
+inc L14
+cmp -31, 338
+m0
+L17: rts
+jmp L0
+cmp L31, 345
+not @r5
+rts
+rts
+m2
+L18: mov @r3, S8
+L19: add @r6, @r2
+clr L10
+L20: clr L1
+dec L14
+not @r5
+bne @r7
+red @r2
+mov @r7, L24
+bne L20
+jmp @r1
+add L17, S9
+prn L16
+rts
+not @r3
+add L4, L7
+clr L10
+m3
+L21: inc @r6
+sub L20, @r3
+lea L17, @r5
+red @r4
+lea L9, L5
+inc @r7
+rts
+jsr L19
+mov @r1, L17
+prn L5
+add @r5, L37
+sub L9, @r2
+red @r7
+red L8
+inc L0
+clr @r6
+m1
+jmp L1
+m1
+L22: prn -62
+clr L16
+bne @r4
+L23: not @r0
+red L1
+dec @r7
+cmp L18, @r0
+m0
+not L23
+red L13
+jmp @r4
+prn @r3
+rts
+clr @r6
+L24: rts
+add L7, @r1
+L25: rts
+cmp -46, L54
+bne @r4
+red @r6
+not @r2
+prn @r6
+L26: inc @r0
+dec @r4
+jsr L26
+mov L15, @r3
+L27: mov L2, L2
+clr @r3
+jmp L26
+clr @r0
+inc L11
+L28: sub @r2, @r7
+inc @r7
+cmp @r7, @r1
+lea L13, @r0
+jmp L10
+jsr @r3
+bne @r2
+sub L25, S1
+jmp @r1
+add 496, @r7
+inc @r6
+bne @r0
+add @r4, L24
+add @r2, L13
+sub L12, @r6
+mov @r6, L24
+bne L25
+jsr L24
+red @r7
+dec @r5
+m3
+m0
+sub L16, @r6
+rts
+L29: dec L25
+sub 27, L12
+dec L17
+clr @r5
+m3
+mov L17, @r4
+cmp @r0, 206
+mov 385, @r0
+m1
+L30: prn L20
+dec @r5
+rts
+L31: jsr L21
+L32: jsr @r3
+inc @r2
+clr L7
+not L32
+mov 486, D0
+sub L31, L3
+add @r6, X2
+L33: prn @r5
+dec @r7
+inc @r6
+jmp @r6
+m1
+jsr @r3
+jmp @r2
+jsr L1
+prn -182
+rts
+m3
+L34: inc @r2
+clr L3
+rts
+clr @r7
+add L0, L16
+sub L15, @r1
+L35: add 268, L21
+rts
+L36: clr @r0
+add L20, @r5
+add -328, L15
+L37: lea L23, @r7
+mov 455, L10
+L38: clr L14
+sub 12, L4
+inc L42
+mov @r2, L27
+jmp L35
+L39: not L31
+cmp L16, @r1
+bne L3
+rts
+add L3, @r1
+jsr L27
+dec L6
+m3
+add L39, S9
+lea L0, L12
+mov S4, @r0
+red @r0
+L40: not @r1
+red L12
+clr L29
+dec @r1
+clr @r4
+L41: dec @r2
+red L30
+sub @r5, @r5
+jsr L10
+cmp -246, @r6
+rts
+prn L0
+inc @r1
+prn -65
+add 92, L29
+prn @r1
+rts
+prn L26
+not @r6
+add @r4, @r4
+red @r0
+prn @r7
+red @r7
+jsr @r6
+red S5
+jsr L8
+mov -376, L0
+m4
+jmp L12
+red @r7
+jsr @r4
+m2
+rts
+inc L11
+mov @r1, @r7
+L42: rts
+clr L47
+cmp L35, L56
+jsr @r7
+jsr L6
+m2
+L43: inc L56
+L44: cmp @r4, -83
+clr @r6
+sub L16, @r3
+red @r5
+red L35
+dec X3
+L45: bne D0
+L46: dec @r2
+add @r0, L38
+dec L1
+sub @r1, @r1
+lea L19, L31
+lea L35, @r6
+not @r2
+clr L36
+lea L41, L13
+red @r1
+bne L38
+cmp L25, L35
+lea L41, @r3
+inc L28
+jmp L41
+inc @r5
+dec @r0
+prn L2
+sub L18, L7
+inc L37
+rts
+cmp @r2, @r3
+jmp @r2
+clr @r2
+red L56
+bne @r2
+red @r5
+m3
+sub L26, @r1
+lea L14, @r5
+dec L2
+bne @r2
+m4
+m2
+sub 138, @r7
+prn -212
+not @r5
+L47: lea L30, L29
+m0
+red @r4
+jsr L36
+L48: sub @r0, @r6
+red L48
+dec @r5
+not L12
+rts
+prn @r6
+cmp D0, @r7
+m0
+inc L29
+red @r7
+mov -323, @r3
+rts
+inc S4
+L49: sub L50, L35
+sub L4, @r2
+red L46
+inc @r4
+L50: lea L50, L55
+L51: bne @r2
+sub @r0, @r6
+prn S3
+L52: dec @r0
+clr @r3
+mov @r0, @r6
+L53: cmp -377, 292
+L54: sub -68, S8
+sub @r1, @r6
+m0
+sub -419, L22
+add @r5, @r7
+red @r7
+m3
+m3
+red @r0
+L55: dec @r7
+lea D0, X4
+m1
+not L50
+L56: clr L6
+m3
+bne L31
+L57: prn @r2
+clr L30
+L58: clr @r5
+inc @r2
+jmp @r1
+add D0, L34
+jmp @r3
+L59: jmp @r6
+cmp L39, 488
+clr @r3
+clr @r6
+mov D0, S0
+jmp @r1
+red S6
+jmp D0
+sub D0, L53
+jsr S1
+dec D0
+clr D0
+stop
+D0: .data 250,-163,146,-6,294,-22,-208,37,-6,189
+D1: .data -13,-451,20,-231,20,-381,38,384,417,331
+D2: .data 325,-311,39,190,37,288,-45,-483,-325,211
+D3: .data 126,58,32,-151,-331,-226,218,164,-458,236
+D4: .data 464,67,466,-294,284,168,-351,-81,-366,-178
+D5: .data 411,318,-201,69,377,-421,340,-488,376,79
+D6: .data 344,-15,-230,353,83,-351,114,-325,-151,292
+D7: .data -71,473,-419,-492,-223,-381,-1,425,-224,-196
+D8: .data 212,-341,-189,87,216,9,-453,235,-403,-417
+D9: .data 494,77,146,-323,-29,349,248,19,115,328
+S0: .string "srlb"
+S1: .string "lgbbgfvn"
+S2: .string "z"
+S3: .string "pufoxlrui"
+S4: .string "k"
+S5: .string "ygqpobgsiai"
+S6: .string "njbxxybdiro"
+S7: .string "wdg"
+S8: .string "nkad"
+S9: .string "ohnasv"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r7
+    prn 41
+endmcro
+mcro m1
+    sub @r1, @r5
+    prn 25
+endmcro
+mcro m2
+    sub @r3, @r2
+    prn 88
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 9
+endmcro
+mcro m4
+    sub @r3, @r7
+    prn 71
+endmcro
+rts
+red @r4
+inc L0
+L0: jsr L0
+rts
+jmp L0
+sub @r0, @r5
+not @r2
+rts
+m0
+bne L0
+sub L0, @r1
+red @r7
+m2
+red @r1
+cmp @r6, L0
+m0
+add @r7, @r1
+mov 293, L0
+add @r4, L0
+lea L0, L0
+mov 165, S5
+prn @r3
+cmp 449, -67
+L1: lea L1, L0
+mov -353, X0
+red @r2
+clr L0
+bne @r7
+mov L0, L0
+prn @r7
+lea L0, L0
+sub L0, @r2
+sub @r6, X1
+sub @r3, L1
+not @r7
+inc L0
+prn 335
+L2: lea L2, L2
+L3: inc @r0
+jsr L3
+jsr L1
+m3
+red @r1
+dec L0
+L4: inc L1
+jmp L2
+mov @r1, S0
+m3
+add 156, @r3
+jsr L4
+jsr L3
+m0
+not L1
+bne L4
+clr D0
+rts
+jmp @r4
+L5: jmp L3
+jmp L0
+sub L2, L5
+m2
+m1
+m4
+sub L4, @r7
+L6: add @r1, @r1
+prn L4
+not L1
+red @r2
+L7: jmp L5
+lea L4, L2
+not @r4
+clr @r3
+L8: clr L4
+bne L5
+L9: bne @r4
+m0
+prn -278
+L10: cmp -494, L0
+L11: add -59, @r5
+jmp @r1
+jsr L2
+cmp L9, @r4
+lea L8, @r3
+jmp L0
+dec @r4
+bne @r0
+jsr L2
+dec @r1
+lea L2, L5
+add -417, D0
+sub L5, L22
+red @r6
+rts
+clr @r0
+L12: not @r1
+L13: dec @r6
+L14: red L14
+jsr L1
+bne L6
+m2
+red L6
+jsr @r4
+prn @r4
+jmp @r1
+prn L0
+red @r2
+not @r0
+rts
+mov @r4, L28
+clr D0
+rts
+add @r4, L37
+bne L11
+cmp @r3, @r4
+sub L6, @r6
+jmp L14
+lea L10, L0
+add @r3, @r0
+mov L13, @r3
+jsr @r2
+mov 288, @r2
+rts
+prn @r1
+dec @r5
+bne L10
+dec L0
+m1
+L15: inc @r4
+m3
+not @r4
+red @r5
+jsr L14
+m0
+bne L7
+inc L13
+L16: bne L0
+mov @r2, @r7
+L17: inc L17
+bne @r4
+prn @r2
+sub @r3, L2
+lea L10, L11
+jmp D0
+cmp L11, L11
+cmp @r0, L11
+L18: dec L17
+m3
+L19: cmp 52, 456
+add L14, L13
+dec @r2
+lea L4, @r6
+rts
+cmp @r7, -422
+jsr @r4
+inc L19
+L20: dec L1
+cmp L9, -366
+bne @r6
+sub 226, L18
+mov @r0, L0
+bne L6
+jmp @r5
+add L18, @r5
+dec L12
+lea L1, @r1
+m1
+L21: rts
+bne @r2
+m2
+add -91, @r7
+sub @r5, @r6
+add @r7, @r1
+dec L12
+cmp 324, L2
+m2
+bne @r5
+dec L16
+lea L3, @r6
+L22: rts
+m2
+prn -245
+L23: jsr L8
+jsr @r2
+add L21, @r3
+prn L18
+dec @r5
+red @r2
+inc L14
+rts
+inc @r6
+not @r3
+rts
+jsr @r2
+m1
+L24: dec L17
+m1
+jmp @r1
+clr L11
+rts
+mov -203, @r6
+dec @r2
+m4
+add @r7, L23
+L25: lea L24, @r6
+L26: clr @r1
+L27: clr X2
+jsr @r7
+clr L6
+inc L17
+clr L20
+dec L23
+bne L15
+bne @r5
+not L16
+m4
+L28: bne L26
+jmp L8
+red L47
+inc L20
+inc L57
+inc L12
+rts
+not @r2
+mov @r4, @r3
+jsr @r2
+mov L4, @r7
+m3
+rts
+dec L21
+m1
+L29: rts
+add @r3, L10
+sub L5, L27
+clr @r6
+cmp L30, @r3
+dec @r3
+m2
+rts
+add L4, L6
+L30: lea L42, L21
+inc L7
+bne @r1
+m3
+clr L1
+not @r5
+clr L21
+bne @r2
+m2
+dec @r1
+not L12
+mov 123, @r6
+prn L18
+not L13
+jmp @r0
+L31: inc L2
+dec L35
+mov @r6, L28
+lea L29, L24
+sub -133, @r2
+prn L31
+prn 385
+L32: bne @r5
+jsr @r1
+mov -423, L1
+rts
+mov @r3, L18
+m2
+jsr @r3
+not @r5
+lea L46, @r4
+m1
+not @r7
+red L24
+jmp @r0
+rts
+mov L30, @r1
+mov L20, L18
+prn -206
+m1
+mov @r3, L7
+jmp @r1
+add @r6, L15
+jsr L12
+red L21
+prn L9
+red @r1
+lea L13, @r5
+jsr @r5
+L33: add -506, @r3
+bne L14
+not L26
+clr L3
+add 433, L11
+add L4, L6
+bne @r4
+L34: rts
+red @r5
+L35: bne @r0
+cmp L8, L38
+m1
+jmp @r4
+dec L14
+inc L0
+inc L3
+lea L2, L25
+add @r5, @r1
+rts
+not @r4
+cmp L24, L54
+dec L9
+bne @r7
+inc L35
+sub 212, L9
+cmp 386, @r4
+cmp S1, L5
+rts
+jmp L30
+L36: not @r7
+lea L18, @r1
+dec @r0
+dec S3
+prn L30
+prn @r5
+rts
+mov L1, L14
+red L10
+L37: cmp @r3, L22
+mov L50, L28
+dec D0
+jsr L23
+cmp 130, @r5
+clr L5
+L38: rts
+not L7
+cmp D0, 15
+L39: mov L9, @r1
+L40: jmp L27
+m4
+dec L11
+jsr L20
+mov @r2, L16
+L41: dec @r2
+jsr @r1
+lea L4, L6
+L42: dec @r7
+jsr @r4
+not L13
+m4
+jsr L6
+not @r0
+L43: jsr @r5
+not L33
+m4
+L44: jmp L43
+m3
+jmp L12
+cmp @r5, @r0
+jmp @r6
+dec @r5
+sub -368, L6
+sub S9, L43
+cmp L15, L19
+add -434, @r2
+red L18
+L45: jmp @r0
+inc L18
+L46: clr @r7
+L47: add L56, @r7
+red @r5
+L48: rts
+inc L47
+m3
+L49: clr L20
+L50: lea S9, @r6
+jmp @r0
+clr @r1
+L51: jmp L31
+lea L47, L38
+lea D0, @r4
+clr L42
+m4
+m1
+L52: rts
+prn @r3
+inc @r6
+L53: rts
+not S0
+red @r1
+prn 216
+sub -349, L50
+L54: bne @r6
+clr @r0
+sub @r1, L42
+dec @r3
+rts
+inc L16
+L55: bne @r5
+lea L51, @r6
+mov @r0, L36
+inc L59
+bne L46
+sub -179, @r1
+inc X3
+jsr L42
+not @r5
+clr @r4
+prn L51
+rts
+bne L55
+clr L31
+bne L24
+L56: not L55
+prn -369
+add 95, L47
+mov -236, @r1
+jsr @r2
+lea L17, @r7
+sub L21, L10
+prn L41
+cmp -438, @r1
+jsr @r3
+inc @r0
+inc S4
+sub 220, L59
+sub @r5, @r3
+m4
+L57: jsr @r2
+prn 3
+inc S5
+mov D0, @r6
+inc L58
+L58: red S0
+L59: clr S8
+bne S4
+dec S7
+red S3
+jsr L0
+jsr X4
+mov D0, S3
+stop
+D0: .data 495,306,482,-17,-381,-287,-33,343,53,-356
+D1: .data 174,-187,-337,-60,406,-147,26,343,-306,213
+D2: .data 313,106,31,-292,-124,371,223,-34,392,-287
+D3: .data -351,-31,362,-497,-65,-444,-408,171,151,-87
+D4: .data 364,-416,-271,54,-24,-476,329,461,464,-245
+D5: .data -296,-98,-49,271,129,124,125,480,232,474
+D6: .data -468,-240,430,460,-445,-212,-432,88,-334,241
+D7: .data -305,151,439,444,163,-355,305,132,-425,-42
+D8: .data 141,271,-450,-333,-455,94,313,-117,-1,-456
+D9: .data 65,-195,-4,117,-312,-280,73,140,-448,226
+S0: .string "deenqm"
+S1: .string "qumksambmcqcyacwi"
+S2: .string "xgzbel"
+S3: .string "ce"
+S4: .string "hrxc"
+S5: .string "hhhenpi"
+S6: .string "qmgtguznburd"
+S7: .string "nikdvimadkygldnf"
+S8: .string "enknsgfhseqhj"
+S9: .string "qwcoeyksp"
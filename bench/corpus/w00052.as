@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r1
+    prn 12
+endmcro
+mcro m1
+    sub @r6, @r6
+    prn 23
+endmcro
+mcro m2
+    sub @r5, @r0
+    prn 53
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 85
+endmcro
+mcro m4
+    sub @r5, @r6
+    prn 96
+endmcro
+m1
+inc @r0
+jmp L0
+red @r0
+jmp @r0
+cmp @r4, 145
+mov L0, L0
+red @r3
+mov @r3, L0
+lea L0, L0
+L0: mov -136, S2
+cmp L0, @r7
+red L0
+rts
+bne @r5
+red @r2
+rts
+clr L0
+red L0
+lea L0, D0
+sub L0, L0
+L1: sub L1, L0
+L2: red @r1
+m2
+prn 477
+mov L2, @r4
+rts
+lea L1, L0
+prn L0
+dec @r7
+bne L0
+lea L1, L0
+L3: inc L1
+prn @r0
+L4: bne @r1
+prn L3
+dec L1
+jmp @r3
+sub -15, @r3
+mov @r5, L2
+L5: sub L3, L4
+prn L4
+mov 176, @r7
+add -12, @r4
+jmp @r4
+not @r5
+clr @r0
+dec @r6
+bne L2
+inc L3
+inc @r6
+rts
+jsr @r1
+red @r6
+rts
+bne @r3
+not @r7
+L6: lea L1, L1
+m4
+cmp @r4, L6
+lea L5, @r4
+not L32
+L7: inc D0
+bne @r6
+mov L0, @r5
+cmp 378, -411
+bne L6
+sub @r1, L7
+prn L1
+prn L5
+red L2
+m4
+inc L5
+bne L5
+not @r2
+bne @r3
+inc L7
+jsr L3
+L8: sub @r2, @r6
+clr L2
+inc X0
+jmp D0
+rts
+L9: mov S5, @r7
+not L6
+sub L4, L3
+prn L9
+add L9, L7
+mov @r3, @r2
+lea L6, L9
+L10: clr @r5
+m4
+prn L0
+sub -252, L1
+lea L8, @r3
+clr @r3
+L11: jmp @r7
+jsr L8
+cmp L9, @r0
+prn L4
+red L10
+m4
+L12: not L8
+jsr X1
+not @r5
+lea L12, @r3
+jmp @r4
+rts
+add -509, L0
+lea L6, @r5
+lea L9, L9
+red L1
+bne L5
+bne L5
+add 3, @r3
+jmp @r3
+L13: add 428, L13
+cmp L55, @r7
+inc L10
+red L11
+jsr @r2
+bne L11
+add @r4, @r0
+L14: red X2
+add 469, L7
+lea L0, L3
+cmp S0, S2
+m3
+jsr L21
+L15: sub 325, @r5
+prn @r2
+lea L7, @r4
+not L8
+m4
+rts
+not @r7
+bne L15
+cmp @r0, -59
+jsr L10
+m3
+dec @r0
+m2
+rts
+L16: rts
+cmp 441, -15
+m2
+jmp L5
+rts
+red @r0
+L17: jsr L16
+mov L8, @r6
+m4
+dec L3
+prn 143
+dec L3
+jsr L8
+lea L9, L10
+jsr L5
+dec @r7
+L18: bne @r6
+dec @r5
+m0
+bne L8
+jmp @r6
+m4
+jmp L14
+red @r4
+cmp -361, -116
+cmp L13, D0
+L19: inc L3
+mov @r0, L3
+clr @r5
+inc @r1
+clr @r3
+m3
+red @r0
+mov -216, L4
+prn -20
+mov L4, @r5
+clr L2
+dec @r2
+clr @r1
+L20: add @r5, L0
+L21: prn @r7
+lea L0, @r7
+m2
+inc @r5
+rts
+bne @r0
+lea L2, @r0
+m1
+dec L19
+m4
+L22: bne @r5
+rts
+jmp L17
+add -333, L4
+not L2
+clr L11
+inc @r6
+mov L16, L6
+bne L22
+jmp L19
+L23: red @r3
+jsr L18
+m1
+m3
+red @r5
+L24: rts
+jsr @r6
+bne @r2
+m4
+red @r7
+clr L20
+L25: clr L19
+jmp L12
+sub L15, @r0
+add @r2, @r5
+bne @r1
+not @r3
+clr L19
+m0
+prn @r7
+prn -84
+clr @r3
+not L12
+inc @r2
+L26: add 370, @r1
+L27: sub @r0, D0
+m2
+L28: bne L3
+mov 172, L6
+cmp @r6, -385
+red D0
+jmp L9
+add -59, L22
+bne S1
+m4
+prn L3
+sub -39, @r1
+rts
+red @r3
+lea L11, L3
+jmp L8
+lea L17, @r0
+m2
+add 323, L27
+sub -275, L14
+L29: prn 332
+m1
+clr @r1
+red L20
+bne @r2
+dec @r0
+bne L26
+m0
+inc L19
+jsr L7
+not @r6
+sub L29, @r5
+L30: bne @r1
+red @r2
+L31: inc L49
+lea L58, @r3
+L32: not L10
+m2
+L33: bne S0
+bne @r4
+m3
+not @r4
+lea L13, L19
+bne L2
+cmp -296, L18
+m1
+L34: mov L1, @r2
+cmp L7, L59
+L35: dec L21
+L36: add -462, @r4
+not L7
+clr L24
+dec L34
+bne @r3
+dec L25
+jmp L7
+not L8
+rts
+dec L25
+L37: rts
+inc @r7
+clr L19
+mov @r6, L28
+clr L22
+rts
+jmp @r1
+clr @r3
+add @r3, L13
+sub @r7, L2
+m2
+add L46, @r1
+cmp L12, L25
+mov 475, S5
+add @r2, L21
+rts
+mov D0, @r2
+lea L42, @r7
+L38: dec @r3
+dec @r6
+not L27
+L39: bne @r3
+mov -295, @r2
+lea L33, @r4
+inc @r7
+add L30, L26
+prn L25
+lea L37, L10
+mov @r0, L17
+not L12
+m4
+prn L4
+L40: mov @r3, @r0
+rts
+prn L31
+L41: red @r6
+inc X3
+L42: red @r4
+inc D0
+clr L0
+m1
+cmp L25, L14
+inc @r0
+sub -340, L20
+L43: add L36, L13
+sub S6, @r0
+L44: red @r3
+clr S2
+L45: cmp L36, L27
+L46: dec @r1
+L47: jmp @r4
+rts
+m1
+sub L37, @r2
+dec @r1
+lea D0, L36
+lea L47, @r5
+jmp L19
+clr @r2
+m2
+dec L45
+bne @r4
+m0
+lea L38, @r6
+mov L34, @r0
+prn 375
+clr @r6
+jsr L13
+jmp @r3
+add L3, L16
+rts
+rts
+L48: add 376, L21
+add L3, L28
+L49: red L6
+jsr L22
+not L24
+cmp 346, -205
+sub -160, L15
+cmp L10, L1
+L50: jmp @r6
+cmp @r5, L39
+red @r3
+cmp L38, L22
+jsr @r6
+inc L5
+mov -260, @r6
+cmp L50, D0
+add 38, @r2
+not @r3
+clr @r6
+m1
+add L11, L20
+L51: add @r4, @r2
+bne L36
+jmp L15
+rts
+add @r3, L21
+sub @r2, @r3
+L52: mov 278, L25
+rts
+clr L19
+dec L11
+L53: dec @r0
+add L24, @r2
+dec @r5
+mov @r4, @r4
+L54: dec L31
+L55: jsr @r4
+lea L57, L59
+rts
+m4
+mov 256, L49
+dec L21
+dec @r5
+red L55
+prn 7
+dec @r1
+m2
+L56: prn @r4
+not @r6
+rts
+dec @r6
+sub @r1, @r2
+cmp -229, L26
+cmp -468, -216
+prn -365
+red @r5
+dec L59
+clr @r5
+red @r5
+add 413, L52
+inc S1
+jsr @r1
+dec @r6
+L57: inc @r7
+inc L27
+jmp @r2
+sub L58, L16
+m2
+L58: add @r3, @r5
+prn L59
+mov @r6, @r1
+cmp L59, L59
+cmp 140, -143
+L59: add @r2, S5
+sub 434, @r7
+sub 194, L58
+mov S1, X4
+dec @r5
+not S6
+cmp S2, -95
+dec D0
+stop
+D0: .data -12,400,-250,-262,54,83,-5,210,-372,-363
+D1: .data -147,21,-167,410,194,125,-188,225,437,428
+D2: .data 135,-367,220,-320,-60,-451,49,36,285,-394
+D3: .data 147,101,387,484,428,-163,-276,-243,-487,79
+D4: .data 122,-330,254,-175,-64,330,-195,-341,201,38
+D5: .data -68,199,438,269,106,-327,-271,54,281,179
+D6: .data -424,67,135,175,-299,-150,-404,446,81,408
+D7: .data 241,105,312,78,106,-293,-454,-111,-10,-341
+D8: .data 487,479,-366,334,456,482,-284,181,-190,-125
+D9: .data -386,161,-313,215,-347,141,-71,-391,41,-65
+S0: .string "tqlxeslwfuukxjkux"
+S1: .string "zoijwpbcnkh"
+S2: .string "dmvpxsvvbxgy"
+S3: .string "wjo"
+S4: .string "jujcpoyesajcvkh"
+S5: .string "veximczqaltmzw"
+S6: .string "stb"
+S7: .string "smsssjwxl"
+S8: .string "vvfjo"
+S9: .string "c"
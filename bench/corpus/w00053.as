@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r4
+    prn 50
+endmcro
+mcro m1
+    sub @r2, @r0
+    prn 22
+endmcro
+mcro m2
+    sub @r7, @r6
+    prn 50
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 62
+endmcro
+mcro m4
+    sub @r7, @r4
+    prn 20
+endmcro
+bne @r2
+m4
+sub -394, L0
+lea L0, @r5
+L0: not @r6
+red L0
+cmp 264, @r6
+inc L0
+cmp L0, L0
+add @r1, L0
+mov L6, D0
+jmp L0
+jsr @r1
+m0
+lea S3, @r5
+sub L0, @r5
+m2
+inc @r6
+add @r4, L0
+not @r7
+inc @r6
+jsr L0
+prn L0
+prn L0
+L1: inc @r7
+mov L0, @r5
+clr @r1
+jmp L0
+dec L42
+clr @r2
+cmp L1, @r6
+bne @r6
+m2
+m2
+mov -482, L1
+red L0
+dec @r1
+clr @r5
+jmp L0
+mov @r2, L0
+lea L1, L0
+rts
+inc L0
+dec @r3
+not D0
+jmp L0
+clr X0
+jsr L1
+lea L12, @r4
+add @r5, L0
+mov L1, L0
+add L0, L0
+jmp @r3
+L2: dec L0
+not L0
+lea L1, @r4
+mov @r6, @r4
+not L1
+prn L1
+bne L0
+L3: red @r1
+rts
+add @r6, L1
+sub L3, L1
+clr @r3
+add @r7, L1
+m3
+m0
+inc @r5
+add @r5, L0
+red L3
+mov L3, @r7
+L4: clr @r0
+L5: jsr L5
+mov @r3, L1
+jsr @r7
+m2
+m3
+m2
+inc L3
+inc @r5
+bne @r4
+dec L57
+lea L1, @r1
+L6: red @r1
+sub @r0, @r6
+jmp @r4
+mov L3, @r0
+sub L1, @r0
+jmp L6
+L7: rts
+mov @r4, L3
+m4
+red L47
+lea L5, @r5
+sub L1, L7
+L8: mov L1, @r3
+rts
+sub L4, L7
+inc L6
+sub -51, L4
+not @r2
+m2
+bne D0
+jsr @r5
+not L0
+jmp @r3
+jsr L0
+inc @r4
+not @r1
+jmp L7
+cmp @r6, L3
+m3
+sub @r4, @r7
+inc L2
+bne L4
+clr L8
+rts
+mov @r5, L2
+prn L5
+rts
+m4
+L9: jmp @r3
+cmp L9, @r7
+clr L3
+L10: jmp @r4
+red L5
+sub 181, @r7
+clr L10
+cmp @r1, 217
+inc L4
+sub L3, @r3
+lea L2, @r0
+not @r0
+jsr @r3
+m0
+not @r3
+bne X1
+prn 390
+jmp @r5
+jsr L1
+m3
+bne @r7
+m2
+red L8
+sub @r3, S8
+bne L5
+prn L9
+bne L8
+red @r6
+m3
+m3
+bne @r3
+inc @r2
+mov -263, L0
+L11: add @r4, L2
+jsr @r4
+jmp @r0
+prn @r1
+add 333, L7
+rts
+prn @r6
+L12: jmp @r1
+L13: dec @r2
+add @r4, L10
+L14: jmp @r5
+m3
+jsr D0
+clr @r7
+lea L12, L8
+prn L9
+bne @r1
+clr L8
+cmp @r1, @r3
+not @r6
+prn L2
+lea L13, L6
+red L1
+inc L50
+m0
+m4
+jmp @r4
+m0
+lea L0, L6
+not @r1
+sub @r6, L9
+clr L2
+dec @r6
+clr @r6
+L15: lea L4, L8
+dec @r4
+inc L7
+add 340, L12
+bne L7
+dec @r0
+lea L15, L0
+mov @r2, @r7
+L16: inc @r7
+cmp @r5, -60
+red L12
+L17: mov L16, @r5
+L18: lea S3, X2
+L19: inc L4
+L20: add @r4, D0
+rts
+rts
+L21: lea L2, L14
+mov L35, L13
+add @r0, L4
+cmp 401, @r5
+bne L0
+inc @r0
+lea D0, @r0
+lea L10, @r6
+cmp 130, L19
+red D0
+sub @r3, @r2
+L22: add L11, D0
+inc L22
+mov L21, L4
+mov 307, L20
+rts
+jmp @r3
+jmp @r0
+L23: inc @r6
+mov L4, S6
+cmp @r6, 255
+bne @r3
+L24: jmp @r6
+rts
+L25: cmp L23, @r2
+prn -278
+L26: clr L11
+m3
+L27: clr L10
+m4
+red D0
+clr L26
+rts
+L28: dec L10
+red @r2
+clr @r7
+jmp L3
+bne L15
+jsr @r3
+jmp L8
+jsr @r4
+L29: mov L29, @r7
+sub L11, @r0
+m1
+mov L8, @r3
+clr L2
+lea L21, @r5
+m1
+sub L16, @r0
+bne @r4
+sub -466, L9
+jsr L1
+clr L27
+mov 87, L6
+L30: add L29, @r4
+red @r4
+inc @r6
+inc @r4
+jsr L25
+sub X3, @r6
+L31: rts
+clr L13
+dec @r6
+clr L3
+sub L5, L8
+L32: sub L11, L24
+mov @r5, L2
+not L16
+L33: red L28
+clr L30
+red L57
+jmp L48
+lea L24, @r2
+bne L13
+add @r5, L19
+inc @r3
+clr L8
+not L17
+cmp @r7, @r0
+lea L20, L32
+inc @r7
+mov -313, L28
+prn @r4
+bne L52
+mov L33, @r7
+mov -340, L21
+rts
+L34: clr L3
+not @r0
+jsr @r0
+jsr @r6
+not @r1
+dec L17
+inc @r0
+prn L11
+L35: jmp @r5
+L36: cmp L18, L24
+mov 70, @r0
+cmp L8, @r6
+L37: lea L35, L6
+cmp @r7, 314
+clr L32
+clr @r3
+dec @r6
+rts
+clr L27
+add 235, @r3
+add 263, X4
+mov @r2, @r6
+mov L17, L25
+rts
+not L31
+inc @r2
+dec L36
+cmp 469, @r3
+L38: add @r5, @r7
+cmp L12, 144
+bne L6
+bne L30
+bne L15
+L39: lea L24, L10
+prn @r3
+add 148, @r0
+dec L21
+prn 38
+not @r6
+red L3
+red @r2
+m3
+lea D0, @r3
+lea L14, L38
+bne L16
+mov @r6, @r4
+dec L21
+jsr @r6
+m4
+L40: rts
+lea L20, L35
+red @r1
+jsr L27
+L41: cmp @r4, -188
+sub @r0, @r2
+clr @r2
+bne L1
+sub @r7, @r5
+dec L9
+bne L41
+m1
+jmp @r7
+red L2
+inc L41
+L42: jsr S7
+L43: prn @r0
+inc L12
+L44: red L47
+bne L8
+inc @r7
+rts
+prn L18
+lea L55, @r1
+m3
+sub L7, @r6
+add -104, L39
+L45: inc @r5
+jmp @r1
+clr L6
+sub L58, L40
+red L1
+m2
+inc @r7
+clr @r4
+inc L41
+red L47
+m1
+rts
+red @r6
+bne L43
+jsr @r5
+dec @r7
+clr @r3
+m3
+add @r0, L35
+L46: rts
+lea L0, @r5
+bne @r6
+cmp @r5, S9
+rts
+m3
+L47: dec L6
+not @r4
+sub L12, @r6
+L48: prn L53
+lea L46, @r4
+m1
+L49: dec L40
+lea L8, @r0
+jmp L56
+L50: rts
+lea S4, L16
+m3
+jmp @r0
+L51: lea L15, @r7
+clr L39
+L52: rts
+m1
+red @r1
+jsr D0
+bne L16
+mov -452, D0
+m2
+clr @r7
+dec L37
+prn 51
+m1
+not @r7
+red L57
+L53: bne L52
+jsr @r5
+jsr S1
+L54: jsr @r4
+jmp @r2
+L55: lea L34, @r1
+L56: jmp L27
+L57: clr @r4
+dec L46
+L58: clr L59
+prn -14
+bne @r4
+jsr @r1
+clr L12
+mov S8, @r3
+jmp L58
+clr @r1
+L59: bne D0
+stop
+D0: .data 459,-137,375,-44,-381,-190,-399,73,-314,-241
+D1: .data -89,385,353,185,366,-428,-295,454,-175,-77
+D2: .data -155,482,-402,78,399,390,-314,53,-101,84
+D3: .data -49,399,-292,180,140,-132,-158,-422,476,-242
+D4: .data -218,-11,-98,-371,309,394,5,478,-120,304
+D5: .data -153,-193,-366,388,346,-428,429,198,401,-135
+D6: .data 124,302,152,-421,-195,-86,322,114,-476,436
+D7: .data -65,178,-3,-320,247,-156,-355,115,486,-438
+D8: .data 89,320,-252,-270,-210,36,230,93,385,-66
+D9: .data -97,-484,46,-355,-59,-201,-202,273,-32,-499
+S0: .string "mcltjxekrofjyahr"
+S1: .string "kksdqguyqpclypjkdp"
+S2: .string "axfhekbxsfhhmtcrrw"
+S3: .string "rwkayhp"
+S4: .string "gpfafbvsfefudhtbjhw"
+S5: .string "soapgyvr"
+S6: .string "a"
+S7: .string "tzou"
+S8: .string "envhx"
+S9: .string "r"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r7
+    prn 20
+endmcro
+mcro m1
+    sub @r6, @r1
+    prn 20
+endmcro
+mcro m2
+    sub @r1, @r4
+    prn 15
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 38
+endmcro
+mcro m4
+    sub @r1, @r2
+    prn 45
+endmcro
+cmp @r3, L0
+jmp @r4
+rts
+m0
+bne @r4
+cmp 147, -231
+jsr L0
+L0: sub L0, L0
+rts
+jsr X0
+not L0
+prn 200
+red @r6
+jmp @r4
+prn -224
+inc @r4
+add @r4, @r6
+m1
+L1: inc L0
+clr @r7
+cmp L0, 205
+sub -303, L0
+inc L0
+m1
+sub @r2, @r1
+not L1
+not @r4
+m2
+m1
+L2: jmp L2
+sub 9, @r0
+L3: mov 176, @r5
+add 120, @r4
+lea L1, L0
+dec @r0
+mov @r2, L2
+rts
+add 485, L2
+m4
+m2
+jmp L3
+dec L1
+dec L14
+jsr L0
+cmp @r5, 448
+L4: lea L4, @r3
+jmp @r6
+m0
+prn L0
+m3
+jmp L2
+red @r2
+cmp L4, @r1
+inc @r2
+L5: rts
+not L3
+add L0, L4
+jmp L3
+dec @r5
+L6: add @r0, @r5
+jmp @r2
+sub L3, @r0
+add @r0, @r7
+inc L5
+mov @r7, L5
+L7: jmp L3
+clr @r2
+L8: sub @r0, L5
+bne @r3
+m4
+jsr L3
+inc L56
+prn 313
+mov @r3, @r5
+L9: mov 92, L7
+not L4
+L10: cmp 135, L6
+sub 246, L4
+lea L6, @r1
+L11: not @r4
+m2
+m4
+not L20
+mov L9, @r5
+m1
+dec @r2
+L12: red X1
+lea L1, @r6
+bne L3
+sub -230, @r3
+add L7, L4
+dec @r1
+cmp @r5, L8
+m4
+clr @r6
+rts
+jmp @r0
+not L3
+sub L1, @r5
+jmp @r5
+add 74, L2
+red @r6
+jsr @r0
+m0
+inc L8
+jsr @r7
+L13: inc L3
+dec @r7
+add @r2, @r2
+mov @r2, L11
+add @r4, @r2
+jsr L5
+red L8
+jsr @r4
+dec L4
+mov L10, @r7
+prn @r6
+dec L49
+mov @r2, @r4
+L14: red @r2
+m0
+dec L55
+sub L1, @r4
+rts
+clr @r6
+lea L3, @r3
+m3
+sub 78, @r3
+m2
+cmp @r0, L0
+L15: mov @r1, @r6
+rts
+cmp -182, -319
+not L8
+sub @r7, L3
+red @r1
+cmp L5, -332
+cmp 128, @r4
+jmp @r5
+clr L5
+clr @r6
+m2
+add @r4, D0
+red X2
+dec @r3
+clr L5
+m2
+dec @r2
+add 34, @r5
+cmp L5, @r5
+m1
+m0
+inc @r7
+L16: lea L11, @r1
+prn @r2
+L17: not @r6
+inc @r7
+lea L14, L10
+red @r7
+jmp L13
+sub L6, @r6
+mov 336, @r2
+inc L12
+m2
+not @r0
+m1
+bne @r2
+jmp S1
+bne @r0
+bne L14
+red L11
+dec L2
+add 358, L14
+mov @r3, L17
+add L12, L3
+inc L13
+jmp S7
+dec L6
+jsr L15
+mov -57, @r5
+m1
+L18: prn @r4
+L19: sub L5, @r5
+rts
+sub @r6, L9
+inc @r3
+mov @r1, @r5
+add L11, L14
+lea L1, L18
+inc @r5
+inc L13
+sub @r1, @r6
+rts
+add L6, L9
+not L14
+L20: jmp @r2
+sub -34, @r2
+lea L14, L14
+m4
+jmp @r1
+sub 84, @r1
+m3
+prn L1
+L21: dec L18
+not L1
+L22: rts
+red X3
+dec L17
+jmp @r1
+m4
+clr @r3
+red L8
+prn L8
+L23: sub L16, X4
+mov L3, L36
+L24: red L23
+jmp L4
+jsr L18
+L25: add L16, L25
+rts
+mov L13, S7
+bne @r7
+cmp L13, L19
+bne @r0
+clr @r7
+clr L4
+L26: lea L5, @r7
+inc @r5
+lea L15, L17
+m2
+prn L26
+L27: red @r0
+add L36, L8
+dec @r3
+rts
+red L38
+prn 165
+inc @r3
+inc L7
+red @r0
+cmp S6, -255
+not L55
+L28: jmp @r5
+add L5, L20
+mov 429, @r7
+sub -263, @r2
+rts
+not @r3
+not @r3
+jsr L22
+inc L3
+cmp L4, @r4
+bne @r3
+rts
+red L26
+lea L23, L3
+L29: mov @r5, @r2
+L30: rts
+mov 464, L30
+dec L12
+not @r3
+inc @r1
+jmp L12
+jmp @r3
+bne L1
+not @r5
+rts
+m0
+lea L3, L36
+mov -120, L46
+L31: dec @r4
+dec @r7
+clr L3
+prn @r0
+m1
+bne @r3
+L32: bne L6
+L33: jmp L27
+dec L18
+L34: jmp @r0
+clr @r4
+clr @r2
+L35: cmp L3, @r5
+L36: red @r2
+add -251, L5
+inc @r6
+clr L5
+bne L11
+rts
+lea L3, @r4
+m4
+L37: red @r2
+red @r7
+L38: jmp @r0
+mov L15, @r3
+red L18
+mov 93, @r5
+not @r2
+rts
+bne L12
+prn -387
+jsr L57
+rts
+dec L34
+m1
+prn 199
+mov 167, L7
+clr @r5
+inc @r1
+L39: add 31, @r1
+L40: jsr L49
+L41: lea L7, L21
+not @r4
+lea L34, L1
+L42: dec L14
+add L55, L16
+sub @r4, @r2
+rts
+rts
+prn L4
+m0
+prn -125
+cmp L13, 428
+bne @r2
+L43: cmp L19, -62
+lea D0, @r0
+cmp @r5, -117
+not @r5
+L44: red L34
+lea L14, @r2
+L45: lea L0, @r4
+jsr L13
+lea L19, L5
+L46: dec L19
+add @r6, @r7
+prn 258
+clr @r4
+cmp -5, @r3
+L47: lea L16, @r2
+clr L2
+clr L21
+jsr @r3
+add -34, @r3
+rts
+add @r5, L1
+red @r6
+bne @r7
+red L10
+jsr @r3
+jsr L36
+prn L54
+not L44
+clr @r5
+jmp @r5
+L48: rts
+inc @r1
+mov L56, @r3
+rts
+m0
+inc S8
+clr L15
+jsr S5
+jmp @r5
+prn 385
+red L9
+prn @r2
+jsr L14
+jsr @r4
+L49: jmp L39
+cmp L17, 149
+L50: cmp L39, @r1
+inc @r2
+add @r5, L39
+jmp D0
+clr @r1
+m3
+L51: lea L2, L37
+lea L12, L26
+cmp 422, 453
+lea L30, @r0
+L52: rts
+cmp @r5, @r6
+clr L1
+bne @r1
+dec @r5
+jsr L3
+sub L39, @r3
+cmp 451, @r5
+lea L50, @r4
+red @r2
+m4
+not @r2
+prn @r2
+mov 163, L57
+sub 296, L37
+jsr L57
+red @r7
+bne D0
+lea L47, @r6
+m2
+rts
+sub L27, @r2
+jmp @r2
+dec L28
+not L20
+m3
+L53: lea L35, @r7
+lea L48, @r5
+lea L43, @r7
+sub D0, L58
+prn 225
+clr @r4
+clr L40
+cmp -168, 208
+bne @r1
+lea L39, @r0
+clr @r7
+L54: red D0
+prn L22
+not S4
+L55: cmp D0, L51
+L56: jmp L57
+red @r5
+L57: jmp S6
+inc @r4
+sub L12, @r3
+jsr @r2
+not @r1
+lea L30, @r3
+jsr L22
+L58: rts
+m2
+sub L16, L59
+dec @r7
+L59: lea S3, L39
+bne @r6
+mov @r3, @r1
+dec S4
+add D0, @r5
+rts
+stop
+D0: .data 34,31,405,-431,-272,-468,112,105,-499,-40
+D1: .data 415,111,55,-336,-373,240,-413,-238,202,19
+D2: .data 132,-65,7,360,445,359,459,-289,-113,13
+D3: .data -350,-60,-353,-147,483,-152,247,113,-196,267
+D4: .data 155,315,344,235,140,209,-128,-223,86,-366
+D5: .data 475,437,47,-422,136,86,-373,-142,-348,24
+D6: .data 345,-115,-177,463,233,73,-392,-323,139,-249
+D7: .data 234,140,-385,-124,-434,-483,431,123,-173,353
+D8: .data 89,-250,198,85,295,-76,-418,-15,315,-177
+D9: .data -235,-104,-203,35,280,-107,460,175,308,-496
+S0: .string "w"
+S1: .string "dncjyoxnvywlrbfdf"
+S2: .string "ddyvbk"
+S3: .string "ebh"
+S4: .string "flidoc"
+S5: .string "at"
+S6: .string "aasccfl"
+S7: .string "otqt"
+S8: .string "guuqbf"
+S9: .string "bjbornwpbyzbqqofjzw"
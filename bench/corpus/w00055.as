@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r1
+    prn 59
+endmcro
+mcro m1
+    sub @r3, @r2
+    prn 87
+endmcro
+mcro m2
+    sub @r3, @r1
+    prn 81
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 15
+endmcro
+mcro m4
+    sub @r3, @r0
+    prn 69
+endmcro
+clr L0
+m4
+L0: mov L0, L0
+m4
+L1: jsr @r6
+mov L1, @r3
+clr @r0
+add @r4, @r3
+bne L0
+cmp -493, L1
+inc L1
+red @r1
+L2: cmp @r1, -406
+rts
+cmp @r4, @r4
+add @r2, @r3
+clr @r2
+sub @r2, @r4
+not L1
+mov L1, @r5
+jsr @r6
+m2
+red L1
+cmp @r5, L1
+inc @r1
+jmp L5
+L3: clr L1
+cmp -118, @r7
+inc L1
+red L0
+bne @r6
+inc @r5
+lea X0, D0
+m3
+prn @r0
+m3
+L4: not L3
+clr L3
+bne @r7
+rts
+dec L1
+jsr L2
+not L0
+m4
+add @r5, @r7
+dec L2
+mov @r6, L1
+bne L1
+inc @r3
+rts
+inc @r7
+inc @r2
+add @r3, D0
+cmp -428, L4
+clr @r0
+not @r0
+cmp 42, L1
+lea L4, L3
+red @r3
+m1
+lea L4, L4
+clr @r6
+add @r0, @r5
+sub -452, L1
+prn 246
+jsr L1
+add -218, @r3
+red @r3
+clr @r2
+sub L3, @r4
+mov @r6, L0
+rts
+inc L3
+add -205, L2
+L5: red L4
+dec L3
+mov L5, L0
+jsr L1
+add L3, L3
+inc L2
+lea L1, L5
+m3
+clr @r6
+jsr @r2
+lea L5, @r6
+bne @r7
+mov -278, L0
+m4
+lea X1, @r2
+sub @r2, L5
+dec @r7
+dec L5
+prn L20
+L6: dec @r3
+jsr @r1
+red L4
+sub L0, L1
+m4
+bne @r0
+m1
+rts
+m2
+L7: mov @r6, L2
+m2
+mov @r6, @r0
+rts
+mov @r5, L7
+mov L0, @r4
+L8: rts
+dec L2
+prn @r0
+m0
+L9: dec @r2
+red L0
+jmp @r7
+cmp @r7, @r1
+red L0
+add L2, @r1
+lea L4, L3
+rts
+red @r6
+L10: rts
+dec @r2
+not @r0
+bne @r3
+prn L8
+mov -340, @r1
+clr @r7
+mov L0, @r4
+bne @r1
+sub @r3, L6
+inc @r1
+clr @r3
+not L3
+jmp @r6
+add L9, L1
+prn @r4
+L11: mov -44, L10
+rts
+cmp L0, -277
+inc @r0
+cmp -92, 151
+clr L4
+prn @r4
+jmp L1
+clr L7
+cmp @r3, L5
+prn L4
+mov @r3, @r1
+m3
+cmp L5, 221
+jmp L3
+mov 253, @r4
+L12: prn L2
+not L12
+jmp @r4
+rts
+L13: sub @r2, L6
+prn 276
+prn @r2
+inc D0
+sub 76, @r5
+m0
+jmp @r0
+jmp @r5
+sub @r4, @r0
+red L12
+clr @r5
+inc L12
+prn @r5
+lea L2, @r1
+jsr L0
+add @r4, @r5
+lea L2, L12
+lea L7, @r5
+cmp 7, 177
+not L1
+rts
+jsr L1
+L14: rts
+jmp L4
+clr L9
+prn -355
+add @r2, @r6
+lea L0, D0
+bne L37
+jmp L4
+bne @r4
+not L11
+rts
+jmp @r6
+mov @r3, L10
+cmp L14, 459
+dec @r3
+red @r5
+dec @r6
+lea L13, @r0
+cmp @r0, @r2
+m2
+red L45
+jsr L1
+dec L0
+add L12, L6
+rts
+not L1
+mov @r6, L8
+cmp @r3, @r3
+bne @r2
+jmp @r6
+inc @r1
+sub L6, @r3
+lea L8, D0
+L15: jsr L5
+m2
+m0
+mov @r0, @r4
+rts
+jsr L13
+bne @r6
+rts
+dec @r4
+red @r5
+not L11
+L16: not L2
+m3
+rts
+m2
+mov -127, @r0
+L17: rts
+cmp @r1, @r1
+red S9
+lea L4, L22
+jmp @r7
+lea L9, @r6
+not @r5
+jsr @r2
+red @r0
+inc L4
+add @r5, @r6
+bne @r6
+dec @r6
+cmp L11, -4
+clr L10
+add -251, L8
+L18: lea L11, @r6
+jmp @r4
+rts
+red L12
+rts
+L19: cmp 241, 502
+clr @r4
+cmp -369, 313
+cmp -436, -50
+cmp 4, @r1
+jsr @r4
+bne L56
+cmp @r2, -367
+cmp L17, L1
+rts
+inc @r3
+m2
+L20: rts
+sub @r4, L13
+L21: dec @r1
+jsr L14
+mov L58, @r2
+mov L19, @r3
+L22: sub L3, D0
+m4
+dec @r2
+m2
+clr L22
+dec @r1
+L23: lea L16, S2
+red @r1
+rts
+m1
+lea L0, @r0
+not @r5
+cmp L57, L20
+rts
+not @r5
+dec @r7
+L24: jsr L24
+mov -294, L21
+L25: red @r3
+L26: cmp @r1, @r7
+L27: not L26
+L28: add @r6, L10
+not L6
+L29: inc L59
+rts
+rts
+dec @r2
+add L0, L12
+sub L32, L12
+m0
+clr L6
+jmp L13
+add L19, L49
+L30: lea L7, S9
+bne L4
+sub L17, @r2
+not @r3
+inc @r7
+rts
+red L22
+L31: sub 247, @r1
+dec @r7
+prn @r0
+inc L3
+L32: prn @r2
+L33: clr L12
+sub @r4, L26
+m3
+m1
+lea S8, L9
+jsr L21
+jmp L13
+lea L4, @r0
+L34: lea L15, L10
+cmp @r6, L24
+L35: rts
+inc D0
+dec @r3
+clr @r5
+m1
+m2
+not @r2
+sub 423, @r2
+red @r5
+L36: not @r7
+mov -306, @r3
+m3
+m4
+L37: red D0
+bne @r0
+dec S8
+rts
+clr @r3
+m1
+prn L10
+rts
+L38: red @r1
+dec @r2
+m3
+mov -396, L0
+lea L22, @r7
+L39: red @r5
+lea L13, L14
+red @r2
+rts
+L40: inc @r4
+add 371, D0
+prn @r2
+mov L15, L17
+dec @r5
+dec @r4
+prn @r1
+L41: cmp L44, @r3
+cmp @r4, L29
+rts
+clr @r2
+m1
+dec L12
+mov -174, L34
+rts
+sub @r2, @r2
+m1
+L42: dec L16
+L43: dec @r4
+cmp @r1, @r3
+L44: rts
+L45: clr L21
+add L44, @r1
+jsr X2
+jsr @r4
+cmp L19, L36
+cmp -153, L48
+red L8
+L46: clr L37
+L47: bne @r2
+not L34
+L48: inc @r7
+L49: dec @r2
+jmp L19
+jmp @r7
+cmp -78, @r6
+L50: inc L31
+L51: clr L36
+m0
+L52: mov @r2, D0
+cmp -129, @r7
+L53: add -377, @r2
+lea L6, D0
+L54: lea L12, @r0
+jsr L54
+clr @r7
+inc @r2
+lea L57, L57
+mov @r0, @r2
+L55: rts
+prn @r6
+bne @r6
+prn -429
+rts
+L56: add 45, L18
+prn @r4
+not @r0
+rts
+jmp @r4
+jmp L51
+jmp L56
+m1
+cmp L5, @r0
+clr S8
+red L33
+clr @r1
+jsr X3
+clr @r1
+clr S5
+jsr L55
+not L30
+inc L23
+not @r2
+L57: inc L56
+L58: red @r3
+lea L25, @r0
+dec S5
+jsr @r0
+L59: add 63, L49
+add 167, @r0
+m1
+lea D0, X4
+red @r1
+bne D0
+inc D0
+not D0
+mov D0, @r5
+m2
+stop
+D0: .data 442,40,462,-320,-416,473,230,-42,-484,3
+D1: .data 79,316,-72,217,434,338,-69,-54,246,99
+D2: .data 82,-303,-202,259,190,135,-43,-301,-108,233
+D3: .data 59,-66,118,145,-321,306,208,-39,-384,40
+D4: .data -205,-434,-443,-314,440,-389,493,-313,184,442
+D5: .data -297,393,-64,-318,-226,249,139,-146,-111,-429
+D6: .data -48,233,275,358,-204,378,-346,312,-14,-261
+D7: .data -367,-184,461,490,145,-255,-168,104,10,-331
+D8: .data -252,-434,439,-323,-4,-135,466,-123,-183,380
+D9: .data 469,-233,297,-41,271,-211,334,-91,171,-489
+S0: .string "rxxtwqdkppivdxzqvs"
+S1: .string "pbrjqerklrwvcjlewy"
+S2: .string "acdlp"
+S3: .string "nbbardhsxcpkt"
+S4: .string "ebjztjpxvr"
+S5: .string "ltfxan"
+S6: .string "kuklruzifensfy"
+S7: .string "umxcfbnussjikiia"
+S8: .string "pefkhq"
+S9: .string "mmcpobinxsed"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r4
+    prn 29
+endmcro
+mcro m1
+    sub @r7, @r3
+    prn 85
+endmcro
+mcro m2
+    sub @r5, @r7
+    prn 46
+endmcro
+mcro m3
+    sub @r7, @r1
+    prn 59
+endmcro
+mcro m4
+    sub @r5, @r7
+    prn 93
+endmcro
+not @r5
+not @r0
+clr L0
+add @r5, L0
+m4
+L0: bne @r2
+bne @r3
+add 50, L0
+inc L0
+red @r6
+bne @r1
+not @r1
+L1: clr @r0
+L2: clr @r5
+m1
+sub @r4, L2
+bne @r6
+lea S0, L1
+red @r1
+bne @r3
+mov 295, L2
+red L1
+mov -435, @r0
+jmp L2
+mov @r1, @r5
+bne @r0
+inc L0
+sub @r3, L1
+lea L2, @r1
+L3: rts
+inc L2
+lea L2, @r7
+not @r1
+inc L0
+jsr L0
+cmp 260, @r5
+not @r2
+mov 88, @r1
+m1
+L4: jmp L2
+rts
+inc @r5
+dec @r4
+L5: cmp @r5, @r3
+red L4
+mov L5, @r5
+lea L3, L0
+add @r3, L5
+jsr L3
+not @r1
+bne L2
+L6: bne @r0
+L7: clr @r3
+not L1
+bne @r3
+bne L7
+jmp @r6
+dec @r4
+jmp L4
+cmp L1, @r7
+sub @r1, L3
+dec L4
+sub @r0, @r6
+jsr @r0
+sub 146, @r2
+bne @r5
+jmp @r7
+jmp L7
+dec L6
+inc L1
+m2
+jsr L0
+inc @r3
+L8: lea L7, @r0
+sub @r4, L1
+inc L4
+lea L8, @r2
+inc L5
+jmp @r4
+inc @r4
+m0
+mov 405, L0
+prn L5
+rts
+m1
+red L2
+mov L2, @r4
+red L5
+add 404, L8
+L9: jsr L7
+m0
+rts
+m3
+bne L7
+jsr @r6
+cmp L1, L9
+L10: clr L1
+rts
+add @r5, L0
+L11: mov X0, L3
+dec @r4
+jsr L6
+m4
+rts
+cmp @r4, 39
+clr @r3
+L12: jsr L7
+red L2
+sub L7, @r5
+jsr @r5
+red @r3
+inc L4
+sub 235, L1
+jmp @r3
+m0
+L13: rts
+m3
+dec L20
+inc L1
+dec L1
+rts
+L14: cmp -32, 256
+red L12
+rts
+add 99, X1
+L15: not @r5
+jmp L5
+cmp @r6, D0
+jsr @r7
+inc L16
+sub @r5, @r7
+bne L15
+add @r5, L13
+red @r4
+dec @r0
+mov L14, L3
+rts
+dec L8
+add L3, L15
+prn -99
+bne @r2
+red L14
+jmp L39
+cmp -481, 150
+mov @r6, L8
+rts
+rts
+m1
+rts
+L16: add L3, L39
+clr L1
+cmp L16, -458
+clr @r1
+lea L15, @r6
+inc L2
+m3
+clr L11
+mov @r7, L12
+jsr L9
+red @r7
+L17: sub 313, L9
+jmp @r1
+L18: clr @r6
+cmp 130, L1
+m4
+clr L3
+sub @r0, L10
+mov L11, L1
+jmp @r6
+not @r5
+prn @r7
+L19: clr @r0
+bne @r5
+lea L18, L19
+dec @r2
+sub @r5, L22
+rts
+clr L39
+lea L12, L2
+cmp X2, L10
+rts
+add 225, @r0
+L20: cmp 120, @r0
+L21: add L6, @r3
+add L19, L45
+L22: cmp -95, 478
+prn @r0
+m3
+bne L17
+prn 185
+rts
+cmp @r6, @r4
+bne D0
+jsr L28
+red L5
+bne @r2
+clr @r4
+bne @r4
+L23: inc @r7
+prn L16
+inc @r1
+add @r6, L12
+prn -215
+prn L11
+cmp S9, @r0
+cmp D0, @r4
+cmp -238, 176
+mov L20, L23
+lea L10, L17
+not @r2
+inc @r3
+lea L13, L0
+jsr L13
+sub @r0, L18
+cmp L14, -193
+red @r7
+lea L15, L17
+L24: add @r0, @r4
+L25: lea L8, L22
+rts
+prn L2
+clr @r4
+dec L22
+inc @r1
+m3
+prn @r2
+jmp @r4
+add -138, @r5
+m4
+jsr L16
+cmp L12, 177
+L26: sub @r0, L6
+dec @r2
+red @r6
+L27: red L1
+prn @r7
+L28: bne L14
+L29: bne L4
+mov @r2, @r3
+red @r1
+m1
+jmp @r7
+m3
+m4
+jsr L6
+inc @r0
+prn @r3
+add L6, @r0
+m0
+cmp L10, S6
+lea L23, @r3
+cmp 159, @r2
+prn @r7
+not L4
+clr L20
+L30: clr @r2
+L31: clr L12
+add @r3, L25
+mov L11, @r6
+not @r1
+lea L56, L8
+red @r4
+clr @r6
+not L6
+mov L52, L0
+sub 510, S1
+sub D0, L18
+L32: sub @r6, L9
+cmp -169, X3
+rts
+clr @r5
+mov L9, L21
+jsr @r1
+m4
+L33: dec L14
+L34: bne @r1
+clr L46
+m3
+jmp L4
+rts
+m2
+L35: not L32
+lea L23, L8
+L36: red L17
+not L5
+add L19, L30
+L37: red @r0
+rts
+L38: add L5, L37
+m3
+prn @r2
+red @r1
+clr L54
+bne L3
+inc L8
+L39: not @r0
+L40: jmp L4
+L41: mov -268, L9
+m0
+m1
+jmp L32
+add @r4, @r7
+lea L47, L22
+lea L28, @r1
+L42: lea L33, @r2
+cmp L40, 467
+inc L30
+rts
+rts
+add @r7, L39
+L43: bne L41
+rts
+prn 232
+cmp @r6, @r5
+not @r6
+m4
+jsr @r0
+add S0, L35
+jmp @r0
+dec L37
+prn @r0
+cmp 349, L31
+rts
+sub @r7, @r1
+jmp S3
+lea L22, L31
+jmp @r6
+L44: clr @r1
+m1
+add L43, L15
+add -208, L17
+m0
+L45: sub @r5, @r6
+lea L37, @r5
+jmp @r4
+bne @r4
+L46: lea S7, @r3
+jmp @r7
+add @r2, L37
+m1
+sub L37, S5
+dec @r1
+inc @r1
+prn 416
+red @r3
+sub @r0, @r7
+m0
+rts
+dec L2
+L47: rts
+m3
+not @r1
+jmp L33
+L48: jsr L11
+prn @r2
+add 317, @r4
+rts
+prn -120
+m1
+L49: rts
+inc @r6
+red L0
+dec @r2
+mov 129, L15
+cmp @r5, @r0
+m3
+lea L28, @r3
+red L18
+not L25
+clr L20
+sub L49, L49
+clr @r0
+lea L38, @r7
+bne @r2
+red @r4
+L50: dec @r6
+bne @r5
+inc @r6
+cmp 456, @r0
+add @r0, L23
+dec L59
+cmp -108, L10
+rts
+dec @r2
+m4
+jmp @r6
+not L46
+lea L35, L36
+clr @r7
+L51: bne L40
+lea L26, @r6
+L52: add 164, @r1
+dec @r1
+jmp @r6
+lea L39, @r1
+sub @r7, @r7
+clr @r3
+bne L52
+dec @r1
+L53: jmp @r6
+add @r7, @r7
+L54: mov 225, @r3
+cmp L46, -135
+prn @r7
+red L30
+lea D0, @r6
+cmp @r6, -107
+jsr @r7
+m3
+L55: prn 288
+lea S0, @r6
+bne L54
+add L27, L47
+rts
+cmp @r0, @r2
+mov L48, @r1
+rts
+m1
+bne D0
+not @r5
+red L27
+mov -461, L46
+red L1
+m1
+add @r5, L38
+add 392, @r1
+rts
+L56: sub 351, @r0
+L57: jsr L58
+jsr L59
+L58: lea L11, L59
+sub L59, L59
+jmp D0
+not @r4
+m0
+clr L59
+cmp X4, L59
+lea L59, L36
+L59: lea D0, L23
+dec D0
+stop
+D0: .data 390,340,-43,-39,42,-52,188,205,-367,398
+D1: .data -482,-421,370,387,-453,-144,188,-280,46,60
+D2: .data 255,-74,-433,241,-329,231,-242,-388,-428,76
+D3: .data -310,-218,83,-241,-374,348,-288,-128,-317,-362
+D4: .data 491,-288,-267,-200,190,-442,-64,-43,329,495
+D5: .data -412,-369,-499,-97,-411,-36,376,-69,-487,-87
+D6: .data -389,-422,436,-232,-401,-21,91,-91,-169,411
+D7: .data -136,-473,-461,86,44,441,385,48,259,-130
+D8: .data 325,-404,302,218,-425,-31,-390,-187,458,-279
+D9: .data -314,-240,-304,-244,144,210,-355,29,3,72
+S0: .string "hkhxfpknujjavwtfhf"
+S1: .string "tvxuukdmibyeynikte"
+S2: .string "ewwcbroskkqcxdsrc"
+S3: .string "hgpaj"
+S4: .string "rqzpknodpm"
+S5: .string "gymjexq"
+S6: .string "hqjsukfiltdwmzhp"
+S7: .string "hkcnjftwvyjy"
+S8: .string "bpnavzrawycoqgtufem"
+S9: .string "spmwmu"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r6
+    prn 67
+endmcro
+mcro m1
+    sub @r4, @r5
+    prn 84
+endmcro
+mcro m2
+    sub @r7, @r5
+    prn 11
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 35
+endmcro
+mcro m4
+    sub @r7, @r5
+    prn 18
+endmcro
+bne L0
+L0: sub L22, L0
+not L0
+bne @r2
+add L0, @r6
+lea L0, @r0
+m4
+prn @r1
+mov L0, L0
+L1: add 399, @r1
+lea L0, @r1
+jmp @r7
+cmp @r2, S0
+jsr @r3
+bne @r2
+L2: dec @r7
+prn S3
+lea L1, @r6
+add L1, L2
+add L1, L0
+L3: sub -442, @r7
+m2
+jmp L1
+jsr L3
+prn L2
+bne L21
+dec @r1
+L4: jmp L1
+prn L2
+L5: rts
+jsr L2
+jmp @r2
+red L4
+prn @r2
+m4
+L6: jsr @r4
+bne @r3
+cmp L6, @r0
+jsr @r7
+inc X0
+m2
+inc L0
+clr L39
+cmp -466, -439
+L7: jmp @r3
+inc @r0
+m3
+sub @r6, @r4
+inc @r7
+bne L5
+m0
+inc @r3
+rts
+L8: jmp @r3
+prn @r4
+sub L1, @r5
+jsr L6
+cmp S6, @r3
+bne L5
+cmp -451, L5
+not @r5
+inc L3
+L9: red L3
+prn L6
+m2
+rts
+m4
+lea L8, @r0
+cmp D0, L1
+rts
+jsr @r2
+L10: prn -368
+red @r0
+L11: rts
+m2
+L12: inc @r4
+dec @r3
+sub L9, L9
+sub L6, @r5
+dec L1
+mov -47, @r4
+lea L0, L10
+jmp L46
+L13: rts
+sub @r2, @r3
+jmp @r5
+lea L1, @r2
+bne L1
+cmp 351, @r4
+rts
+mov @r7, D0
+mov -492, L1
+sub -141, L12
+jsr @r7
+jsr @r3
+L14: rts
+inc L9
+m3
+add -258, L13
+sub @r6, @r2
+cmp 399, @r5
+m4
+jmp L0
+cmp -419, L7
+bne @r6
+lea L3, L16
+rts
+add @r6, @r0
+not L3
+bne @r1
+jsr L6
+m3
+add @r5, L10
+prn L3
+red @r1
+add -147, X1
+not L0
+bne @r2
+dec @r2
+jsr L57
+add 158, L7
+L15: red @r2
+red @r4
+jsr L9
+clr @r6
+lea L0, @r0
+L16: bne @r1
+add 277, @r2
+not @r6
+rts
+sub D0, L10
+prn -376
+sub L14, @r0
+rts
+jsr L15
+clr @r0
+mov 357, @r1
+mov 483, L4
+cmp @r0, L29
+L17: jmp @r1
+lea L2, @r4
+inc @r6
+bne @r3
+jsr @r7
+lea L38, L15
+inc D0
+dec @r1
+dec @r2
+m0
+L18: rts
+clr S1
+m3
+L19: bne @r0
+dec L7
+L20: inc L11
+jmp @r6
+L21: sub 300, L15
+clr @r1
+sub L5, @r0
+bne L10
+L22: jsr @r3
+lea L20, L4
+clr @r3
+jsr @r3
+clr L3
+L23: clr @r1
+mov L14, L7
+bne @r4
+bne L2
+add @r6, L19
+prn L21
+m0
+not @r4
+inc @r4
+cmp @r1, L21
+cmp L6, -302
+jmp L13
+red @r4
+m3
+L24: mov L18, @r1
+m4
+inc @r2
+jsr @r4
+add @r7, L1
+jsr @r7
+clr L15
+mov @r7, @r4
+sub -451, @r6
+prn @r6
+m3
+cmp @r7, -228
+prn L16
+L25: red @r2
+cmp -14, 383
+m3
+mov L18, L23
+jmp L25
+jmp L9
+add 339, @r1
+red L14
+m1
+jmp @r4
+dec L19
+clr L17
+jsr @r3
+L26: add @r1, L13
+not @r1
+cmp 252, -28
+L27: not @r2
+add @r2, L8
+L28: jsr L22
+prn S9
+lea L17, L26
+L29: cmp @r1, L17
+prn L16
+dec L1
+prn -39
+L30: sub @r3, @r6
+not L10
+not L13
+prn -370
+dec L24
+cmp -120, L24
+add L21, @r7
+L31: inc @r7
+jmp L9
+m0
+jsr L23
+inc L25
+not L1
+cmp -34, L16
+jsr L26
+jmp L30
+m2
+jsr L7
+m4
+prn L30
+dec @r2
+not @r2
+prn @r4
+mov @r5, @r5
+m1
+L32: clr L24
+red @r0
+L33: jmp @r6
+not @r3
+prn L31
+mov L2, L29
+prn @r4
+bne L11
+clr @r6
+L34: clr @r1
+bne @r5
+dec L41
+sub -127, @r1
+L35: cmp 47, -494
+prn @r3
+L36: sub @r7, @r6
+sub @r3, @r1
+m4
+sub L19, @r3
+jmp @r2
+prn @r7
+jsr L21
+rts
+inc L34
+not @r5
+prn -104
+inc @r0
+dec L11
+mov L26, L1
+dec L12
+cmp -151, L30
+not L0
+L37: rts
+cmp -116, -242
+jmp @r1
+dec @r7
+cmp L1, 159
+lea L34, L17
+prn 419
+red @r1
+m0
+mov -147, @r1
+dec @r5
+add -336, @r6
+bne L10
+red L16
+lea L24, L25
+not @r4
+bne @r5
+prn @r7
+prn -268
+dec @r3
+red S7
+red L4
+L38: inc L27
+bne L27
+sub @r0, @r1
+sub X2, L6
+jmp @r2
+jsr @r0
+prn -464
+rts
+L39: jsr L49
+not L26
+rts
+add -133, @r4
+L40: not L13
+lea X3, L36
+sub L53, @r0
+L41: jmp @r2
+L42: clr L1
+jsr L29
+clr @r5
+bne L9
+bne L21
+jmp L47
+sub 320, L43
+not @r7
+prn -318
+m4
+dec L28
+not @r5
+cmp -496, L30
+inc L24
+red @r1
+m4
+add @r7, L23
+jsr @r5
+red L13
+jmp @r2
+inc S8
+add 375, @r5
+L43: not D0
+add -144, L7
+bne @r2
+clr L13
+not L1
+mov L42, L35
+m0
+not L5
+not @r6
+m1
+cmp 180, @r1
+m4
+bne L54
+L44: jmp @r7
+not @r5
+sub -276, @r3
+rts
+dec L15
+jsr @r6
+not @r0
+cmp @r2, @r6
+lea L37, @r0
+m1
+clr @r3
+jmp L40
+prn 130
+bne @r0
+add L40, D0
+cmp -385, -10
+rts
+not L1
+L45: sub @r3, L6
+L46: cmp @r5, @r7
+clr @r0
+L47: jsr S1
+dec @r7
+m1
+dec @r1
+dec @r0
+prn L53
+L48: lea L4, @r6
+bne @r5
+jsr L42
+bne @r7
+clr @r2
+not @r6
+m0
+L49: sub -209, L6
+sub -342, L11
+inc @r6
+add @r6, @r3
+L50: not L29
+m3
+L51: not @r3
+clr @r6
+red L17
+cmp 145, @r0
+L52: jsr @r5
+red L35
+L53: sub -294, L9
+rts
+jmp @r5
+bne @r6
+cmp -180, 263
+bne @r6
+prn -189
+sub L56, @r1
+cmp -245, 161
+prn 65
+L54: mov @r0, @r1
+L55: red @r4
+L56: sub L58, @r2
+L57: sub D0, L3
+inc @r3
+m1
+dec @r7
+not @r4
+bne @r5
+m4
+rts
+m1
+cmp -55, X4
+rts
+cmp @r6, @r3
+m3
+jsr D0
+clr @r7
+red L55
+cmp 487, -504
+bne @r0
+lea L3, @r1
+jsr @r3
+cmp L54, -188
+red @r1
+red L31
+add -325, D0
+clr @r2
+dec @r2
+lea S0, L12
+red @r0
+sub -47, @r5
+sub L59, @r3
+L58: cmp D0, 273
+clr L59
+cmp D0, 358
+m1
+L59: stop
+D0: .data 204,-325,425,132,-228,421,-466,273,229,33
+D1: .data -400,-477,440,-24,-293,-223,463,227,-362,138
+D2: .data 80,-234,-317,-130,-283,389,423,-410,-1,-349
+D3: .data 334,-8,55,-283,249,-72,170,86,290,417
+D4: .data 221,434,-395,-267,232,-28,-346,-198,-51,-270
+D5: .data 154,266,-163,241,322,-147,-457,429,-416,390
+D6: .data -330,-102,245,-424,-330,-140,293,263,-393,-370
+D7: .data -228,344,-447,72,440,405,-385,142,-417,-301
+D8: .data -154,-59,119,83,340,-105,464,-82,-480,254
+D9: .data -32,260,-59,146,114,-257,212,-366,-57,-474
+S0: .string "ngzyek"
+S1: .string "gaecspikmqeidizf"
+S2: .string "yxamyxhacnjtsjut"
+S3: .string "mhetdwpwws"
+S4: .string "tvmyfxohgvwwreiu"
+S5: .string "vhwarmjchgt"
+S6: .string "rjerxsbi"
+S7: .string "piacutjld"
+S8: .string "rkcnqlebargdsfkqb"
+S9: .string "llstvnthvbwnllzlfjo"
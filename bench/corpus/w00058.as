@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r1
+    prn 37
+endmcro
+mcro m1
+    sub @r0, @r6
+    prn 82
+endmcro
+mcro m2
+    sub @r1, @r3
+    prn 9
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 12
+endmcro
+mcro m4
+    sub @r1, @r3
+    prn 42
+endmcro
+cmp 228, @r0
+rts
+dec @r7
+prn -182
+mov 225, L0
+cmp L0, @r3
+jmp L58
+prn L0
+not @r3
+cmp 152, L0
+clr @r3
+prn L0
+mov 30, L0
+red @r1
+cmp L0, L0
+dec @r5
+dec @r5
+rts
+inc L33
+L0: cmp @r5, L0
+m1
+prn @r2
+mov 422, L0
+jsr @r1
+add @r0, L0
+L1: clr L1
+sub 443, @r2
+inc L1
+rts
+sub L1, @r7
+lea L1, @r3
+bne @r3
+L2: rts
+cmp 164, -502
+bne @r5
+m1
+prn -73
+rts
+red L2
+bne @r6
+sub @r5, @r6
+bne S3
+add 153, L0
+jsr L1
+L3: not @r1
+L4: prn -388
+add L59, @r3
+m4
+cmp @r6, @r0
+L5: not L3
+dec @r4
+red L0
+bne @r1
+mov @r2, L3
+prn @r0
+red L5
+inc @r4
+lea L1, L1
+red @r0
+mov L4, L4
+sub L4, L0
+prn @r0
+m1
+prn -493
+rts
+sub @r0, @r2
+rts
+cmp @r7, L0
+dec @r5
+jsr @r6
+red L3
+jmp L1
+L6: not @r0
+lea L2, L4
+jsr @r2
+clr @r5
+sub 495, @r2
+jmp L6
+dec @r2
+cmp 403, 136
+clr @r0
+rts
+prn @r6
+m2
+not L1
+L7: dec @r7
+m2
+bne L7
+L8: red L7
+rts
+rts
+jsr L7
+dec L4
+not @r6
+mov @r5, @r2
+cmp L4, L0
+clr L3
+mov L0, L5
+L9: cmp 199, @r5
+jsr L2
+jsr L7
+add L8, @r5
+red @r6
+jsr L0
+jmp L3
+cmp -196, 511
+mov 322, @r6
+prn @r5
+dec L3
+inc L1
+m0
+add @r2, D0
+add @r5, L5
+cmp L4, L8
+red @r2
+L10: rts
+not L8
+dec @r6
+add @r4, L5
+not @r5
+dec @r1
+m0
+red S9
+m1
+cmp 407, @r1
+lea L9, L58
+add L7, @r1
+clr @r6
+rts
+L11: jsr L10
+prn L11
+bne @r5
+lea L9, @r6
+prn @r4
+L12: add L0, L3
+inc @r4
+jsr S5
+rts
+dec L0
+inc L11
+inc S8
+bne @r1
+L13: rts
+dec @r5
+lea L11, L2
+m3
+rts
+m2
+L14: add -4, L2
+clr @r0
+clr @r1
+add 487, L23
+add @r1, L3
+m4
+prn L5
+red L8
+L15: red @r2
+m0
+cmp @r2, @r7
+L16: bne @r1
+rts
+m4
+not L7
+prn -119
+m1
+not L3
+rts
+prn 498
+clr @r4
+lea L5, @r4
+dec @r4
+clr L9
+L17: rts
+L18: jsr L8
+not @r4
+m2
+clr @r5
+not @r3
+add @r0, L8
+mov L16, @r3
+mov 55, @r4
+m0
+cmp L13, @r5
+m3
+mov 158, @r4
+cmp -168, @r2
+L19: add @r6, @r2
+red @r0
+jsr @r6
+add L10, L19
+bne L4
+lea L8, L0
+not @r7
+L20: clr L7
+L21: lea L18, @r5
+L22: inc @r5
+L23: dec L23
+clr @r3
+jmp L32
+m4
+dec @r0
+inc L13
+clr @r1
+inc D0
+inc @r4
+inc L13
+not @r4
+jsr L21
+cmp -390, L20
+L24: lea L13, @r1
+not @r1
+dec @r2
+L25: red L14
+prn @r5
+add L6, L37
+prn -372
+mov @r1, L22
+cmp L3, @r3
+red L33
+L26: clr @r6
+jmp L2
+m4
+cmp -113, @r5
+not L19
+add -217, @r6
+bne @r6
+L27: prn -453
+clr @r5
+m1
+mov -459, @r3
+m2
+inc @r5
+sub @r7, X0
+clr L1
+clr L13
+m4
+rts
+add L20, L18
+not @r2
+clr @r2
+L28: lea L28, @r6
+inc L17
+sub L28, @r5
+m2
+red L22
+inc L25
+jmp @r3
+dec L28
+red L13
+L29: cmp L4, @r1
+m3
+rts
+inc L19
+jmp @r0
+red S9
+lea L14, @r7
+jsr @r4
+dec L9
+bne @r5
+inc @r6
+jmp @r3
+inc @r5
+rts
+jsr L4
+L30: inc @r6
+prn L9
+L31: cmp @r6, @r6
+sub L22, L24
+m1
+m1
+not @r7
+clr @r1
+m4
+L32: jmp @r5
+L33: not @r7
+not L0
+bne L23
+sub @r5, L23
+rts
+bne L22
+jsr L3
+not @r2
+not L8
+cmp L1, -425
+m3
+inc @r1
+L34: lea L6, @r1
+m3
+not L0
+rts
+jsr L33
+sub L18, L32
+jmp L5
+add L30, @r1
+lea L17, @r3
+m0
+inc L7
+not @r3
+mov @r3, @r7
+rts
+lea L7, @r4
+cmp @r2, @r3
+jmp L7
+L35: mov 416, L6
+cmp @r1, L21
+L36: cmp L1, -214
+m3
+red @r7
+add @r2, @r3
+cmp 406, L34
+L37: rts
+dec L13
+prn L27
+L38: sub L18, L57
+red L16
+add @r4, @r6
+prn -481
+mov @r4, @r4
+add L25, @r5
+inc L1
+L39: add @r4, L31
+lea L53, L13
+clr L15
+L40: cmp @r6, L33
+jmp @r0
+jmp L10
+inc @r1
+L41: clr L31
+cmp L25, @r0
+m4
+inc @r7
+mov D0, @r5
+mov @r3, @r7
+jmp L3
+L42: red @r2
+lea L7, @r5
+jsr @r3
+m1
+lea L12, @r5
+prn 483
+prn L21
+L43: rts
+add @r7, L21
+jmp L2
+mov @r7, L27
+jsr @r6
+mov L2, @r1
+not L52
+red @r2
+cmp 43, L6
+lea D0, L25
+inc L0
+dec L56
+red @r2
+cmp -388, L29
+not @r4
+lea L28, @r0
+m3
+dec L25
+jsr @r7
+mov @r5, @r7
+red @r0
+jsr L5
+mov @r3, L17
+rts
+L44: jmp X1
+inc @r6
+jmp @r7
+m2
+L45: cmp @r2, S7
+L46: not L9
+jmp @r2
+clr @r4
+L47: prn 110
+prn L20
+bne S3
+m0
+rts
+sub @r1, @r5
+prn L11
+L48: dec @r7
+jmp L58
+L49: bne @r7
+red @r7
+not L39
+mov 331, L18
+lea L51, @r0
+prn D0
+jsr L59
+add 412, L10
+not X2
+rts
+dec L14
+L50: mov X3, L10
+not @r3
+m1
+rts
+L51: jmp @r0
+clr @r1
+m4
+rts
+L52: bne L33
+sub 2, @r1
+jsr @r7
+clr @r3
+prn S8
+m2
+L53: lea L49, L19
+sub @r5, L1
+not S9
+L54: clr @r4
+not @r5
+prn D0
+L55: dec L30
+inc @r2
+red @r4
+not @r0
+inc S5
+jsr L36
+inc D0
+prn @r4
+cmp 284, @r4
+L56: not L59
+mov @r2, L7
+jmp L59
+L57: dec @r0
+sub @r4, @r3
+mov @r5, D0
+clr @r7
+L58: bne L45
+lea S5, @r7
+L59: prn -108
+jsr @r5
+bne @r1
+mov L16, @r2
+rts
+mov S3, D0
+not L37
+sub D0, D0
+lea X4, L32
+stop
+D0: .data -296,431,-200,28,70,-267,-474,-492,135,-178
+D1: .data -473,51,-177,201,444,325,449,78,-342,174
+D2: .data -197,-51,-195,36,405,19,232,-373,-383,120
+D3: .data 364,-232,-77,-374,362,143,-325,171,474,112
+D4: .data -399,-185,-454,368,-57,3,-74,-414,378,310
+D5: .data -303,299,439,126,-6,344,128,-497,120,-75
+D6: .data -254,136,-125,-18,415,151,36,-254,-410,432
+D7: .data -439,265,40,449,-353,224,-99,243,-437,345
+D8: .data 0,139,-61,121,266,-371,-349,446,-209,139
+D9: .data 356,304,-251,126,-184,-44,328,136,-103,-173
+S0: .string "b"
+S1: .string "xlcoqyglhbsv"
+S2: .string "wpzatnngnerftqpdpcds"
+S3: .string "uhsge"
+S4: .string "ucvicaj"
+S5: .string "mh"
+S6: .string "urdfttpdahxanzrd"
+S7: .string "joxjrny"
+S8: .string "ysa"
+S9: .string "xuiwjsqdroympmezwai"
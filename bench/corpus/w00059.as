@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r4
+    prn 76
+endmcro
+mcro m1
+    sub @r4, @r7
+    prn 81
+endmcro
+mcro m2
+    sub @r3, @r1
+    prn 74
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 88
+endmcro
+mcro m4
+    sub @r3, @r1
+    prn 67
+endmcro
+clr L0
+add @r5, L0
+prn L0
+bne L0
+sub @r2, @r2
+jmp L0
+lea L0, @r0
+L0: mov @r7, L0
+L1: jmp @r1
+L2: red @r3
+sub L2, L0
+m0
+bne @r3
+sub @r4, L0
+clr @r2
+cmp L0, @r0
+jsr @r2
+sub -116, L8
+not @r4
+L3: lea L2, L0
+m1
+m3
+m3
+mov @r3, @r6
+jsr @r0
+dec @r3
+cmp L3, -236
+clr @r1
+clr L1
+lea L2, @r4
+m2
+add -88, @r1
+mov L1, @r6
+sub L1, L1
+jmp L3
+prn @r2
+L4: sub L1, L2
+sub 115, L2
+jsr @r0
+prn @r1
+m4
+L5: inc X0
+prn -471
+lea L0, L3
+prn D0
+m0
+dec L50
+jmp L2
+lea L2, L3
+L6: dec L3
+m1
+mov L2, @r7
+lea L3, L6
+m1
+inc @r4
+rts
+lea L6, @r2
+lea L49, L2
+lea L0, L4
+dec @r6
+not @r1
+dec L46
+L7: mov L0, @r4
+L8: sub -287, L7
+inc L3
+m4
+L9: jmp L9
+bne @r5
+jmp L5
+add @r3, L7
+bne @r6
+m1
+add -262, @r3
+L10: red @r5
+jmp @r3
+lea L4, L1
+prn L3
+dec L30
+jsr L0
+prn L4
+dec L4
+inc L6
+rts
+jsr @r3
+jsr @r7
+inc @r3
+bne @r6
+clr @r0
+sub -384, @r5
+inc @r2
+inc @r1
+not L4
+m3
+add 268, @r5
+jsr @r4
+add @r7, L10
+L11: dec L26
+m4
+cmp 398, @r0
+dec L8
+L12: add D0, @r6
+m1
+not @r4
+bne L6
+add @r6, @r1
+L13: red L5
+dec L11
+m1
+jmp L1
+L14: dec @r5
+red @r4
+red L14
+red @r3
+m1
+jmp @r5
+not @r2
+L15: bne @r4
+rts
+prn L12
+jmp L14
+inc @r3
+jmp @r4
+L16: cmp L16, @r2
+not L14
+sub -78, D0
+mov @r3, L15
+dec @r5
+jmp L3
+dec L4
+L17: not L17
+prn 489
+cmp @r4, @r7
+red L7
+not @r7
+not @r4
+red @r6
+not D0
+L18: cmp @r5, L4
+clr @r4
+add @r4, L2
+prn L8
+lea L2, L2
+lea L38, @r2
+inc L4
+rts
+sub 21, L9
+inc L15
+jsr @r7
+cmp @r0, @r2
+sub @r4, @r3
+rts
+cmp 252, L5
+bne @r1
+cmp @r5, @r0
+L19: jmp @r5
+prn @r6
+rts
+not @r3
+jsr @r4
+jmp L4
+cmp @r0, 100
+jsr @r1
+lea L48, L4
+bne L12
+sub @r3, @r1
+inc L8
+jsr L4
+cmp L0, @r6
+cmp L6, L7
+jmp @r6
+dec @r1
+L20: prn @r3
+L21: inc L4
+prn 464
+mov L58, @r0
+rts
+red L3
+jsr L1
+prn L0
+dec @r1
+m3
+m4
+lea L1, @r1
+mov 386, L1
+mov @r1, @r5
+red L19
+m2
+lea L20, @r7
+add @r6, @r3
+m1
+prn @r2
+jsr L20
+lea L4, @r2
+dec @r6
+cmp L21, @r0
+cmp L11, L14
+mov L31, X1
+cmp -372, -435
+cmp L2, L11
+lea L23, L15
+L22: bne @r0
+red @r3
+prn @r3
+jmp L16
+dec @r1
+rts
+red L7
+sub L9, @r1
+inc @r1
+add 370, L19
+red L4
+cmp @r3, @r0
+jmp L13
+clr @r7
+m3
+add @r1, L0
+lea L8, L18
+clr L19
+L23: clr L3
+prn @r6
+jsr L58
+clr L1
+lea L5, L33
+dec @r3
+jsr L7
+rts
+L24: dec @r4
+sub @r5, L5
+red L15
+m1
+not @r5
+add @r0, @r1
+not @r2
+clr L5
+cmp -36, 248
+clr L9
+add -266, L24
+jsr L7
+bne L22
+m0
+L25: add L9, L12
+inc L13
+red L1
+mov 319, L12
+lea S6, @r1
+dec L6
+prn -371
+m2
+dec L5
+m0
+add @r4, @r3
+cmp @r2, 344
+rts
+inc @r4
+L26: add L20, @r1
+L27: lea L35, L25
+L28: jmp L1
+L29: lea L27, L1
+cmp 67, L13
+L30: cmp -6, L6
+jsr L24
+mov L45, @r5
+red @r4
+not @r6
+red @r1
+m0
+L31: lea L22, L8
+m2
+inc @r3
+L32: sub 231, L30
+not L14
+jmp @r6
+prn L25
+add @r1, L29
+sub L29, @r7
+red @r0
+not L10
+sub 271, L9
+not @r0
+mov L18, L23
+m0
+sub @r1, @r6
+sub @r1, L18
+L33: cmp @r2, @r7
+inc L19
+rts
+cmp L31, @r6
+lea L25, @r1
+inc L7
+clr @r6
+L34: bne S5
+m0
+red @r3
+L35: inc L13
+rts
+mov @r1, @r1
+bne L40
+lea L9, @r0
+jsr @r3
+cmp @r7, -249
+not L34
+dec @r7
+clr @r4
+dec L3
+jmp @r4
+cmp L4, L3
+cmp @r7, 287
+L36: red @r6
+sub 316, @r0
+rts
+clr @r7
+red D0
+L37: red L12
+jmp L3
+cmp L35, @r6
+dec @r7
+red @r6
+m3
+add 216, @r0
+L38: dec @r3
+prn -441
+jsr @r4
+mov @r7, L36
+rts
+jmp @r2
+not S7
+L39: rts
+sub L25, @r4
+cmp L37, -243
+red L21
+not @r6
+rts
+red @r2
+clr D0
+bne L38
+cmp @r3, L34
+m4
+jsr @r5
+not L0
+prn @r7
+m2
+red @r7
+cmp 497, L25
+lea X2, L5
+prn L12
+sub @r6, @r5
+L40: prn L16
+lea L29, L31
+prn 436
+red D0
+add L27, @r3
+m4
+red @r5
+not L30
+L41: cmp -420, -225
+rts
+m4
+prn L3
+L42: prn -365
+lea X3, L20
+red @r6
+L43: dec @r0
+m0
+rts
+L44: jmp L44
+jmp L8
+prn 454
+bne @r6
+jsr D0
+red @r1
+m1
+mov -264, @r1
+L45: inc @r3
+dec L24
+inc @r2
+L46: clr @r7
+L47: add @r6, @r1
+red @r5
+bne @r5
+bne L37
+L48: jsr @r6
+L49: jmp @r0
+L50: lea L24, L45
+L51: prn -471
+red L21
+prn L8
+prn L7
+mov L43, L28
+cmp L35, -297
+m0
+L52: rts
+prn 197
+jsr @r1
+m4
+L53: add @r2, D0
+red @r2
+red L18
+L54: jsr @r4
+prn L51
+sub @r2, @r0
+bne L13
+add @r6, L9
+inc S5
+L55: cmp @r1, @r4
+clr @r3
+lea L48, @r7
+red @r6
+L56: clr S4
+bne L46
+sub 288, L19
+mov 118, L27
+jsr @r6
+sub L38, @r6
+sub L59, D0
+red L21
+lea L0, L4
+not @r3
+inc L43
+lea L32, L40
+L57: not L59
+jsr L59
+rts
+inc @r0
+red @r1
+dec @r3
+bne @r1
+dec D0
+m0
+m2
+inc L59
+dec @r5
+rts
+lea X4, L44
+red L58
+L58: jmp L59
+sub L59, @r3
+L59: dec L31
+jsr S0
+dec @r5
+add L48, @r4
+stop
+D0: .data 286,-355,444,203,-408,-471,-399,-103,409,-309
+D1: .data -148,-425,-160,-41,111,-484,139,-61,-195,441
+D2: .data -62,-187,102,83,25,-420,47,149,207,134
+D3: .data -280,-480,139,-234,132,72,160,-117,-455,456
+D4: .data -347,-500,-493,-5,449,-30,-337,347,-392,236
+D5: .data 463,205,270,212,428,217,245,-355,-28,111
+D6: .data 392,322,292,-139,-152,239,-485,-380,323,-254
+D7: .data 392,485,-302,-319,1,-308,-324,-325,455,-364
+D8: .data 141,294,-448,415,427,489,457,-128,406,-348
+D9: .data -432,368,-235,55,35,388,-499,-421,65,112
+S0: .string "ppu"
+S1: .string "ljaxevivhm"
+S2: .string "yvjobpoaaczkyywms"
+S3: .string "cmtmfsvdel"
+S4: .string "qm"
+S5: .string "pdcpeorzsrydxyxyl"
+S6: .string "fumolrnqpgvr"
+S7: .string "atjlrvshfyz"
+S8: .string "ngqxig"
+S9: .string "ydeywasgsgb"
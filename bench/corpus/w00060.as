@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r6
+    prn 46
+endmcro
+mcro m1
+    sub @r1, @r1
+    prn 79
+endmcro
+mcro m2
+    sub @r5, @r7
+    prn 39
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 64
+endmcro
+mcro m4
+    sub @r5, @r0
+    prn 23
+endmcro
+prn -362
+L0: add L0, @r4
+jmp L0
+lea L0, L0
+dec @r3
+m4
+bne L0
+red L0
+L1: prn L0
+red S4
+dec @r5
+mov 225, L0
+add @r0, L0
+L2: add 247, @r4
+mov @r3, L1
+rts
+mov @r2, L1
+rts
+L3: red @r4
+jsr L2
+red @r3
+L4: prn @r5
+inc L2
+L5: mov L0, @r5
+bne L1
+dec L1
+mov 51, @r7
+dec L0
+bne @r1
+cmp 450, 205
+lea L2, L2
+red L5
+mov 470, @r7
+jmp @r5
+jsr L2
+sub L2, L2
+bne L5
+clr @r3
+m4
+red @r6
+dec L18
+prn L3
+rts
+inc @r0
+mov L4, L1
+m3
+L6: prn L4
+m0
+sub @r5, @r2
+L7: clr L0
+m0
+L8: mov L4, L37
+sub L1, @r4
+inc L8
+prn @r1
+lea L3, L8
+cmp 17, 437
+m3
+prn 336
+red @r7
+mov L0, L2
+cmp L4, L0
+m1
+jmp @r4
+jsr L7
+prn L8
+cmp @r5, 248
+cmp 465, @r1
+L9: red L9
+L10: prn L23
+red @r3
+red @r5
+dec @r7
+m2
+m0
+L11: prn L0
+sub 493, S3
+m2
+clr @r4
+inc L5
+sub -445, L0
+lea L3, @r7
+m1
+prn 59
+m4
+lea L11, @r1
+jmp L4
+lea L6, L3
+inc L1
+prn @r7
+jmp @r4
+lea L0, @r1
+sub L3, @r1
+prn 259
+clr L3
+mov @r2, @r6
+inc L4
+red @r0
+jsr @r7
+jsr @r6
+rts
+sub L1, L9
+prn -363
+red L9
+cmp L9, L8
+mov @r3, L10
+inc L3
+cmp @r4, -427
+jsr L2
+bne @r0
+L12: jsr L12
+m0
+prn L0
+L13: sub L4, L8
+dec @r2
+dec @r5
+inc @r5
+red L8
+inc L31
+add L3, L48
+clr L45
+rts
+rts
+mov -268, L5
+rts
+dec L3
+bne @r2
+clr L4
+mov 415, L4
+L14: prn @r5
+lea L5, D0
+dec @r0
+jsr @r1
+rts
+not @r5
+sub 393, L9
+lea L7, L11
+jsr L6
+L15: clr L9
+L16: cmp D0, L4
+inc @r0
+rts
+m4
+L17: prn L7
+inc @r5
+jmp @r2
+sub @r6, L8
+mov 18, @r4
+sub -389, @r0
+add -154, L0
+bne @r5
+red @r5
+m2
+rts
+red L16
+clr X0
+sub -510, @r1
+jmp @r7
+clr @r0
+m3
+sub L16, @r5
+m3
+prn @r5
+clr L1
+jmp D0
+jmp L1
+cmp @r4, @r1
+lea L11, L9
+m0
+lea L1, L25
+L18: mov @r4, @r3
+L19: clr @r3
+rts
+L20: jmp L19
+L21: sub -313, @r2
+m0
+clr L14
+clr @r4
+m3
+bne L19
+rts
+bne @r0
+prn @r2
+dec L14
+red L15
+inc L2
+mov @r7, L9
+lea L2, @r1
+cmp @r3, L9
+inc @r1
+prn @r4
+lea L19, L3
+rts
+not L16
+L22: mov 241, L20
+mov @r1, @r0
+red @r1
+L23: jmp @r1
+rts
+jmp L19
+L24: inc @r6
+not L12
+sub L24, @r5
+L25: rts
+clr L19
+add L19, L8
+lea L5, L0
+rts
+rts
+lea L20, @r4
+L26: red @r5
+L27: jsr @r5
+not @r7
+inc @r6
+L28: rts
+jsr @r0
+L29: bne L24
+sub -45, L43
+dec L1
+jmp L19
+not L29
+clr @r6
+L30: add @r3, L8
+jmp @r4
+sub @r4, L43
+mov L19, @r0
+clr L18
+red @r7
+m3
+m4
+inc L27
+rts
+not @r2
+m4
+m0
+clr @r2
+clr @r1
+lea L27, @r2
+add @r6, L18
+L31: mov 234, @r1
+L32: jsr @r3
+rts
+sub -306, L36
+jsr @r7
+rts
+add @r5, @r2
+m3
+jmp @r5
+inc @r5
+jmp L19
+not L31
+L33: rts
+sub @r5, @r0
+m0
+bne L7
+lea D0, L7
+jmp @r2
+mov @r3, L5
+add @r6, @r1
+cmp @r7, L32
+mov 93, L32
+bne S7
+L34: bne @r4
+rts
+add @r0, L31
+prn @r5
+L35: bne @r0
+lea L23, @r5
+clr X1
+m3
+L36: inc L28
+L37: cmp L32, L24
+mov @r3, @r1
+sub 463, @r4
+cmp @r7, L5
+sub S1, L5
+clr L4
+cmp @r5, -211
+not S5
+prn L35
+prn @r1
+prn -496
+jmp L28
+rts
+mov -119, @r6
+cmp -186, @r0
+cmp L32, @r0
+dec @r4
+sub L0, L37
+m2
+inc @r1
+lea L34, @r4
+prn 82
+mov L15, L17
+clr @r1
+L38: bne L30
+mov L10, D0
+rts
+m1
+lea L29, @r0
+not @r3
+rts
+clr @r2
+m4
+lea S7, L27
+m1
+lea L7, L20
+L39: not L51
+L40: bne @r1
+cmp @r0, @r3
+jmp @r4
+jmp @r3
+L41: clr @r2
+L42: cmp @r4, L38
+red @r4
+red @r3
+sub -403, L30
+bne L6
+jsr @r7
+rts
+jsr @r6
+prn L6
+dec L21
+m4
+inc @r1
+dec @r5
+prn @r0
+L43: rts
+sub -71, X2
+jmp @r0
+lea L39, L38
+lea L13, @r1
+rts
+not @r4
+add L17, @r7
+dec @r4
+inc L27
+inc @r4
+rts
+jmp L24
+bne @r3
+dec L1
+clr L37
+lea L17, L28
+not L38
+m3
+rts
+L44: red L38
+bne L35
+jmp D0
+clr @r4
+bne @r4
+jmp L23
+sub D0, @r2
+jmp @r3
+mov @r3, @r4
+red @r4
+jmp @r6
+L45: cmp -494, L39
+cmp L56, L48
+add -328, L28
+lea S0, L57
+clr @r5
+L46: lea L31, @r0
+lea S3, L5
+L47: lea L47, @r0
+cmp @r2, L53
+not L22
+m0
+L48: mov @r7, L48
+rts
+lea L21, L54
+rts
+prn L41
+L49: dec D0
+L50: rts
+cmp L28, -244
+mov L26, @r3
+jmp L16
+sub 58, @r0
+rts
+L51: add 202, @r5
+dec S1
+red L33
+prn @r2
+sub L39, L22
+jmp L51
+add 111, L49
+lea L26, L41
+jmp @r4
+cmp L31, L5
+L52: jsr @r4
+L53: clr @r4
+prn 173
+clr L52
+red L43
+not L0
+lea L54, L0
+jmp L12
+clr @r2
+jsr @r2
+mov S3, L35
+cmp @r7, L30
+lea S0, @r1
+m3
+L54: not L59
+add @r3, @r5
+m1
+prn 105
+rts
+L55: cmp L48, @r2
+L56: mov -426, L9
+not @r2
+rts
+add L19, @r3
+inc @r5
+jsr @r0
+m3
+add @r2, L28
+red @r1
+jsr L49
+clr @r6
+m0
+sub @r7, L59
+m3
+sub L44, L15
+add 11, @r2
+rts
+L57: bne X3
+sub -142, @r6
+clr @r1
+m0
+dec @r1
+L58: cmp -158, L28
+jsr @r3
+clr X4
+L59: not L43
+cmp S4, @r3
+jsr S0
+red L18
+stop
+D0: .data -474,-71,-276,494,293,-160,-258,322,268,-459
+D1: .data 26,-410,229,467,67,-104,256,14,-58,-199
+D2: .data -254,-325,-137,-306,191,237,299,257,453,-350
+D3: .data 478,-447,378,-479,16,-484,-486,-474,279,-403
+D4: .data -156,58,306,-387,256,195,-152,-154,56,247
+D5: .data -81,440,-432,-441,144,108,-353,30,-103,-384
+D6: .data 59,-248,-174,-238,104,-487,-253,101,487,-383
+D7: .data -289,-474,-107,111,-106,-273,48,-470,-408,-358
+D8: .data -97,-18,-57,41,307,236,-175,73,391,468
+D9: .data -3,184,-176,360,-84,-166,301,131,417,81
+S0: .string "gwe"
+S1: .string "jxgsrhu"
+S2: .string "kgtyrha"
+S3: .string "mnf"
+S4: .string "xuwx"
+S5: .string "dqxnftpjwfdhtbd"
+S6: .string "jej"
+S7: .string "xujbpladscxbql"
+S8: .string "rmvljwj"
+S9: .string "ifrrgbquws"
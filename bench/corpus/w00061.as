@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r1
+    prn 84
+endmcro
+mcro m1
+    sub @r5, @r2
+    prn 78
+endmcro
+mcro m2
+    sub @r7, @r5
+    prn 5
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 41
+endmcro
+mcro m4
+    sub @r7, @r6
+    prn 48
+endmcro
+m4
+not L0
+lea L0, @r6
+mov 60, L0
+jsr @r6
+clr L0
+prn -297
+m1
+jsr @r0
+sub L0, @r2
+m1
+prn @r4
+m2
+prn @r0
+clr L0
+inc @r5
+prn -390
+not @r4
+sub L0, L0
+prn @r1
+add @r2, L0
+add L0, L0
+L0: cmp -86, @r4
+jmp L0
+dec @r6
+bne L0
+m2
+dec L0
+rts
+prn -506
+L1: mov L1, L1
+cmp L0, L0
+dec @r4
+jmp L0
+lea L0, @r4
+cmp L1, S2
+bne @r7
+jmp @r0
+m3
+bne @r0
+mov @r4, @r0
+not L1
+prn @r2
+inc @r5
+add 481, @r1
+sub L1, @r6
+L2: dec L2
+not @r4
+dec L1
+jsr @r1
+bne @r2
+sub L2, L42
+jmp @r3
+not L0
+rts
+red @r5
+m4
+lea L1, @r0
+lea L1, L1
+sub L53, L1
+mov @r0, L0
+lea L0, @r3
+lea L2, L2
+bne L2
+inc L2
+lea X0, L42
+red L1
+prn @r7
+dec @r2
+jmp @r1
+cmp L0, @r2
+dec @r5
+lea L1, @r1
+clr L2
+m0
+L3: clr @r4
+L4: clr L4
+m0
+cmp L0, @r5
+jsr @r0
+L5: not @r5
+clr L3
+jsr @r5
+rts
+L6: not L0
+dec @r5
+red L6
+rts
+bne @r3
+m0
+mov L5, L5
+m3
+rts
+not L2
+lea L6, @r1
+L7: lea L7, L3
+not L4
+sub @r2, @r0
+dec @r3
+add L0, @r1
+mov L59, @r3
+jsr L6
+lea S1, @r1
+mov L4, @r2
+m2
+m1
+cmp 214, @r3
+clr L3
+jmp L6
+bne L10
+clr @r0
+not @r3
+clr @r1
+L8: add @r4, @r7
+prn L1
+L9: mov 457, L6
+L10: jsr @r3
+m4
+jmp @r5
+sub L1, L2
+m2
+red L10
+red @r7
+jsr L5
+m3
+dec @r0
+jmp @r5
+L11: dec @r1
+m4
+L12: jsr L3
+not @r1
+mov L0, @r1
+clr @r0
+L13: dec L0
+jsr @r5
+add L6, @r0
+cmp -416, @r6
+m3
+add L6, @r7
+mov L4, L0
+rts
+mov 436, @r5
+jmp L2
+add @r5, @r2
+m3
+inc L9
+cmp L7, @r0
+L14: lea L12, @r6
+m1
+not @r6
+bne @r4
+clr @r1
+sub L17, L5
+L15: sub 387, L8
+L16: bne L0
+jmp L4
+lea L12, @r5
+L17: not L3
+L18: jsr @r7
+prn @r1
+jmp @r3
+rts
+cmp @r0, @r5
+sub -400, @r6
+clr L12
+lea L3, @r0
+red @r5
+jsr L12
+sub L13, @r2
+not @r2
+cmp @r4, -267
+L19: add L2, L18
+inc @r0
+add @r1, L16
+clr L19
+L20: prn L9
+sub 462, L3
+jsr @r1
+L21: dec L5
+L22: jsr L32
+cmp @r1, @r5
+inc @r7
+inc L18
+jsr L51
+prn L4
+L23: add L1, L38
+not @r7
+lea L20, L17
+dec L10
+sub -374, L1
+jmp @r7
+add L3, L16
+rts
+prn -350
+lea L1, @r1
+prn -324
+L24: mov -199, L4
+sub 396, L15
+inc L13
+inc L8
+rts
+clr L5
+cmp -373, @r2
+not @r4
+inc @r0
+L25: mov @r4, L15
+m3
+bne L10
+add -282, L10
+m4
+clr L5
+jmp @r2
+mov @r1, @r3
+L26: prn L13
+clr @r0
+rts
+dec @r6
+m3
+red @r1
+dec @r6
+add @r1, L16
+bne L20
+jsr @r7
+L27: prn @r3
+add @r3, @r3
+jsr @r6
+L28: red L27
+rts
+L29: red L12
+jsr L26
+bne X1
+L30: jmp @r0
+bne L9
+add L20, L24
+add @r7, L5
+cmp @r4, 253
+add -188, L19
+sub L26, @r0
+L31: jmp L15
+jmp L8
+dec L13
+inc L6
+sub D0, L13
+red L3
+inc @r0
+inc @r1
+prn L53
+lea L6, @r0
+L32: mov 177, L31
+not L0
+inc @r2
+bne @r7
+m2
+mov L2, L9
+L33: jmp @r7
+add @r2, @r1
+dec @r4
+jsr @r6
+jsr @r3
+red @r0
+not @r5
+sub L28, L20
+add @r0, L6
+dec L28
+not @r3
+m3
+jsr @r1
+inc L14
+sub 275, @r5
+red @r4
+mov L12, @r7
+dec @r5
+prn -445
+sub L2, @r1
+mov -170, L15
+clr L8
+L34: prn -282
+not @r2
+inc @r4
+mov -218, @r6
+L35: bne L30
+clr L1
+m4
+inc L4
+inc L48
+lea L29, @r3
+L36: sub L17, @r7
+m1
+m0
+m3
+rts
+cmp @r2, @r7
+not @r3
+sub L6, L10
+m1
+clr @r0
+L37: add S5, @r5
+inc L6
+L38: inc @r3
+clr L28
+lea L18, L28
+rts
+dec L28
+m4
+add @r6, S0
+L39: add L14, @r1
+L40: jmp @r7
+bne L19
+m0
+lea L14, @r7
+sub @r2, L20
+jsr L15
+cmp @r4, S8
+cmp D0, L32
+red S2
+add @r6, @r5
+sub L21, L28
+lea L14, @r3
+bne L36
+prn @r6
+L41: inc L25
+jsr S5
+L42: add L40, @r7
+dec L1
+jmp @r5
+m0
+jsr L42
+add @r4, @r5
+red @r2
+L43: clr L34
+m0
+jmp L42
+sub @r6, @r1
+mov L19, @r6
+lea L26, @r0
+prn @r1
+L44: jsr L38
+not @r5
+clr @r0
+rts
+lea L58, @r4
+L45: dec @r4
+L46: mov L16, S8
+mov 264, @r3
+bne L22
+mov L13, L20
+red L26
+sub @r1, L38
+red L37
+sub 509, S8
+not L22
+mov 113, L19
+clr L48
+jsr @r2
+jsr @r4
+bne @r1
+jmp L42
+L47: jsr L23
+prn L23
+L48: rts
+jmp L19
+bne @r4
+lea L41, @r0
+add L18, X2
+jmp @r3
+mov L20, @r5
+mov L18, @r4
+cmp -14, 10
+jsr @r1
+sub @r2, @r0
+L49: jsr @r3
+jmp @r4
+sub @r2, D0
+red @r7
+L50: dec L40
+sub -312, L45
+L51: mov @r4, @r6
+jsr L25
+cmp -86, @r0
+m0
+clr @r1
+L52: inc @r4
+sub -179, @r1
+bne @r0
+lea L0, L49
+L53: not L32
+cmp 51, L36
+bne L18
+cmp @r5, -488
+jsr @r2
+m1
+rts
+sub -486, @r4
+add @r7, L45
+m0
+rts
+dec @r0
+inc L52
+inc @r3
+L54: mov @r7, @r3
+clr L58
+dec @r7
+bne @r0
+add -427, L30
+mov 507, @r7
+mov -468, L25
+m1
+add L28, @r1
+mov 315, @r2
+add @r2, @r0
+L55: mov D0, @r4
+inc @r6
+dec @r4
+L56: rts
+inc S0
+prn L58
+m4
+jsr D0
+not @r7
+jsr @r3
+sub @r7, @r3
+cmp -46, -355
+m1
+clr @r7
+L57: add L41, @r2
+inc @r0
+mov @r1, S7
+inc @r1
+jsr @r3
+clr S3
+sub L59, S8
+bne @r6
+lea X3, L59
+sub L20, @r5
+not D0
+bne L59
+add S9, @r1
+L58: jsr D0
+L59: red X4
+jmp D0
+stop
+D0: .data -499,193,257,67,-381,-47,414,-376,-131,421
+D1: .data 89,-405,-238,-153,293,491,43,-301,-355,-479
+D2: .data 356,-154,-87,396,193,-328,249,273,-432,-492
+D3: .data -420,57,-465,107,18,-115,-347,-327,-469,-68
+D4: .data -490,-95,377,442,219,222,496,-360,61,195
+D5: .data -125,265,60,104,-426,-81,305,-430,453,-96
+D6: .data 244,-286,415,-86,217,-3,-328,-384,-38,-7
+D7: .data -89,430,58,-279,265,-244,231,95,-340,-499
+D8: .data 348,79,324,-248,-241,-493,479,-7,426,-188
+D9: .data 54,-218,468,129,146,-277,-342,-247,-486,-115
+S0: .string "pnqeyutrueihphhxck"
+S1: .string "n"
+S2: .string "dvvcegwwpapblvqdff"
+S3: .string "aencci"
+S4: .string "coojcyurmlag"
+S5: .string "bawgonu"
+S6: .string "ibiwdfkzfcyhbvbfijx"
+S7: .string "yjhmipv"
+S8: .string "dbxzhjbjx"
+S9: .string "ofdbqd"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r3
+    prn 55
+endmcro
+mcro m1
+    sub @r1, @r3
+    prn 44
+endmcro
+mcro m2
+    sub @r1, @r3
+    prn 70
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 17
+endmcro
+mcro m4
+    sub @r1, @r4
+    prn 72
+endmcro
+m0
+not L0
+L0: sub -336, L0
+m3
+add L0, @r2
+L1: not L1
+rts
+add L1, @r5
+sub -27, @r4
+prn 326
+add L0, @r5
+red @r7
+red L0
+m2
+cmp -501, -27
+inc L41
+clr L0
+cmp @r3, @r7
+L2: jsr S1
+rts
+mov -198, L0
+rts
+m0
+red L2
+not L1
+sub L0, L1
+m1
+clr @r0
+L3: red @r4
+add -200, L3
+lea L1, @r6
+cmp L0, L3
+rts
+not L0
+mov -200, @r0
+clr L3
+jsr @r6
+L4: bne @r4
+bne L2
+red L3
+jmp @r2
+red L2
+prn L1
+inc @r5
+dec @r0
+not @r3
+red @r7
+dec @r7
+jsr L0
+L5: rts
+jmp @r7
+add L4, L1
+jmp L5
+m1
+cmp L3, -144
+m0
+rts
+m2
+clr @r7
+not L2
+sub @r1, @r4
+m4
+jsr @r0
+add L0, @r2
+L6: add L4, @r1
+bne @r3
+add L4, @r6
+mov -432, L5
+red @r2
+m0
+bne @r5
+L7: dec @r5
+L8: bne L0
+L9: clr L51
+prn @r4
+rts
+clr @r7
+prn @r7
+clr @r2
+bne @r5
+L10: rts
+L11: red L3
+clr @r3
+add @r0, L4
+rts
+dec @r6
+cmp L8, @r5
+m0
+inc L39
+jsr L11
+clr @r3
+lea L33, L9
+inc @r0
+red L10
+cmp 229, -407
+L12: clr L7
+jmp L9
+jmp @r5
+L13: add @r2, L10
+not @r2
+jsr @r0
+red @r1
+lea L3, X0
+prn @r5
+inc L0
+clr @r7
+prn @r6
+bne @r5
+lea L6, L12
+jmp @r0
+mov L7, @r4
+L14: bne @r6
+L15: prn -470
+mov 316, @r2
+red @r0
+add @r0, L11
+lea L2, L10
+prn L19
+rts
+L16: red @r5
+L17: rts
+lea L6, @r6
+prn @r0
+m2
+sub @r1, @r4
+inc @r3
+m2
+m0
+bne L11
+add -381, L14
+bne L4
+L18: add 227, @r5
+bne @r3
+L19: jmp L1
+L20: cmp 310, 127
+cmp @r2, @r3
+rts
+mov @r3, @r0
+L21: inc L3
+dec L1
+clr @r0
+red @r5
+jsr @r4
+mov L5, @r3
+add L20, @r7
+jsr @r5
+sub -83, @r7
+not L3
+red @r3
+L22: dec @r2
+red @r7
+dec L6
+dec L12
+cmp @r5, @r4
+L23: not @r7
+jmp @r6
+clr L2
+jmp D0
+lea L9, @r2
+prn L3
+L24: bne L24
+red @r6
+add L3, @r0
+jmp L20
+red L21
+L25: sub @r3, L1
+mov @r4, @r6
+prn L1
+clr @r3
+prn L1
+L26: prn -226
+clr @r7
+jmp L19
+m4
+bne @r4
+not L8
+rts
+dec L1
+jsr L49
+prn -16
+jsr @r6
+m4
+red L49
+add @r1, L0
+m1
+dec @r0
+jmp L18
+red L11
+clr @r2
+sub -175, @r5
+rts
+prn @r1
+clr L8
+jmp L16
+red L7
+add L13, L6
+rts
+lea L7, L25
+m4
+bne @r6
+clr L15
+not @r0
+jmp L17
+rts
+sub @r1, @r6
+dec @r3
+jmp L26
+prn -296
+sub @r5, @r6
+rts
+not @r7
+clr @r3
+rts
+lea L22, @r6
+add -153, L10
+lea L22, L22
+cmp @r6, @r7
+inc L10
+L27: cmp -250, L22
+lea L22, @r7
+jmp @r5
+add @r5, L17
+not @r2
+inc @r6
+add 456, S4
+clr L54
+dec @r7
+mov @r3, @r4
+m4
+jmp @r0
+not @r4
+m0
+dec L28
+clr @r1
+not @r4
+add @r7, L23
+mov L9, @r6
+prn -425
+jsr @r3
+sub L1, L4
+prn 480
+m4
+add L19, L20
+dec L5
+sub L45, @r7
+L28: prn @r7
+cmp @r5, @r7
+L29: jsr @r7
+rts
+m1
+cmp 351, L21
+cmp @r2, L18
+L30: rts
+L31: mov 48, L53
+L32: red L5
+add @r4, L12
+clr L1
+bne @r6
+add -436, @r3
+clr @r1
+m3
+clr L34
+m1
+jsr @r4
+not @r5
+lea L39, @r4
+add @r6, @r1
+red @r6
+sub 479, L20
+m0
+add @r7, @r0
+clr L18
+prn @r2
+jmp L1
+jmp L24
+not @r7
+L33: cmp S4, L16
+red L3
+not @r1
+dec @r4
+L34: mov -24, @r3
+red L4
+cmp L29, L5
+jmp @r7
+jsr @r2
+jmp L37
+rts
+L35: sub 458, @r5
+jmp L29
+L36: add @r4, L47
+sub L29, L31
+sub -495, L35
+lea L2, @r3
+jsr L14
+sub -432, L34
+jsr @r5
+prn 19
+rts
+red @r1
+add @r2, @r3
+add S6, @r1
+jmp L41
+jmp L32
+mov D0, @r0
+sub L31, @r7
+m0
+bne L24
+lea L19, @r5
+rts
+m3
+sub 232, @r3
+m0
+sub L17, @r3
+add -291, L5
+rts
+L37: inc L0
+jsr L16
+L38: not L22
+m3
+add L55, L22
+lea L4, L57
+L39: inc @r0
+bne @r0
+inc @r1
+m2
+bne L22
+L40: rts
+not @r6
+rts
+not L27
+red @r0
+L41: rts
+sub S4, L20
+not L15
+rts
+L42: dec @r0
+jsr @r7
+dec @r0
+jmp @r1
+L43: jmp @r0
+red L19
+m1
+clr L3
+dec L17
+dec @r7
+prn 288
+not @r6
+not @r6
+red S4
+L44: rts
+prn L10
+prn @r0
+m0
+add 366, S1
+jsr @r1
+clr @r2
+add X1, @r6
+clr L32
+dec L59
+dec @r4
+dec @r3
+mov L37, L2
+red @r3
+m1
+red @r1
+mov L26, L34
+clr X2
+bne @r0
+L45: prn L21
+dec L6
+dec @r5
+prn -92
+L46: inc D0
+lea L9, @r7
+m4
+m3
+m4
+add 184, L39
+rts
+m2
+clr @r7
+L47: sub L4, @r7
+lea L3, @r1
+cmp L7, L31
+inc @r3
+dec @r2
+L48: red L19
+sub S8, L27
+dec L54
+prn @r0
+jmp L19
+m0
+m4
+L49: dec @r3
+red @r7
+jsr @r5
+red L10
+clr @r2
+inc L58
+cmp -308, X3
+sub @r5, @r5
+prn L26
+inc @r1
+jmp L33
+mov 222, L12
+jmp L23
+dec @r0
+L50: not L43
+dec L43
+not @r2
+L51: red @r6
+red @r2
+red D0
+red L25
+L52: prn D0
+red @r5
+clr L50
+L53: jmp L55
+bne L19
+clr @r7
+clr @r1
+L54: lea D0, @r1
+add L48, @r1
+jsr L43
+jmp L11
+L55: mov 493, X4
+not L51
+clr D0
+mov D0, D0
+m3
+L56: jmp @r4
+jmp @r7
+not L43
+L57: sub @r0, L8
+L58: mov -68, @r0
+not @r2
+clr @r4
+L59: red L20
+not S1
+lea L23, @r4
+stop
+D0: .data -253,-500,-451,-218,269,-317,32,-205,-420,-34
+D1: .data -446,-228,306,447,424,-228,-350,-347,-226,-454
+D2: .data 279,-251,-170,441,-226,-218,-281,-281,-449,266
+D3: .data 170,-59,-420,-121,288,-204,431,-41,125,-447
+D4: .data -429,-68,331,-258,190,-215,496,-111,-165,-235
+D5: .data 325,-474,-207,-212,-69,-386,-485,-202,224,355
+D6: .data 464,-467,-312,-486,282,295,-49,179,227,-158
+D7: .data -402,-282,410,-120,124,282,-435,-166,429,102
+D8: .data -200,-448,-230,-407,-233,69,-68,-408,-181,335
+D9: .data -125,-110,81,288,232,-402,191,365,-499,-130
+S0: .string "xpfadb"
+S1: .string "ebfvgoafnphuvikzdif"
+S2: .string "nizlftqwegowuux"
+S3: .string "bgg"
+S4: .string "aftsqbltdhwq"
+S5: .string "stmqybobulhfsy"
+S6: .string "jzhjcd"
+S7: .string "ogsatjlssfauupkap"
+S8: .string "oa"
+S9: .string "grvlxby"
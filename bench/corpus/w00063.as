@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r6
+    prn 93
+endmcro
+mcro m1
+    sub @r6, @r4
+    prn 43
+endmcro
+mcro m2
+    sub @r3, @r0
+    prn 67
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 94
+endmcro
+mcro m4
+    sub @r3, @r2
+    prn 97
+endmcro
+clr @r3
+prn L0
+cmp -235, L0
+rts
+jmp @r2
+sub 426, @r7
+add -429, @r0
+prn 422
+L0: rts
+inc L0
+not L0
+dec L0
+mov @r1, @r0
+not L32
+bne L0
+sub L0, @r2
+L1: prn L0
+red L0
+bne @r7
+m4
+add -58, @r0
+m1
+dec @r5
+lea L1, @r2
+L2: dec L0
+lea L1, @r2
+dec L0
+sub @r3, @r4
+add 137, @r3
+lea L0, @r3
+not @r2
+rts
+not @r4
+add @r6, @r3
+jsr L1
+sub @r3, L2
+L3: add 82, @r6
+sub L2, @r7
+inc L3
+rts
+bne L0
+dec @r1
+jmp @r2
+cmp L0, @r7
+m1
+mov @r7, L1
+bne L2
+L4: jsr @r6
+lea L2, @r7
+bne @r7
+lea L1, @r7
+mov @r6, @r5
+cmp L0, @r1
+not L0
+jmp @r0
+cmp L2, L1
+dec L0
+cmp L20, L1
+sub @r6, @r2
+add L54, L2
+mov -127, @r1
+jmp L1
+dec L37
+dec @r6
+m4
+prn @r0
+cmp L0, @r4
+cmp @r0, D0
+clr L4
+clr @r5
+jsr @r0
+m3
+m3
+sub @r4, @r0
+red @r7
+inc L2
+rts
+mov L18, L3
+L5: sub S9, @r6
+m1
+clr L1
+add L1, L3
+m0
+red @r7
+prn -132
+red L2
+L6: clr L1
+clr L4
+m3
+L7: jsr @r5
+mov @r4, @r4
+red L6
+jmp L0
+jsr @r7
+m2
+red @r5
+red @r1
+not L6
+L8: dec @r6
+L9: not L6
+inc L1
+jmp L7
+clr L0
+add -82, @r3
+rts
+jmp @r3
+dec L41
+bne @r5
+jmp L6
+red L21
+L10: rts
+red L9
+prn X0
+jmp L7
+bne @r1
+rts
+lea L0, L2
+mov 388, @r0
+clr L5
+prn L4
+L11: jsr @r0
+mov @r6, L1
+m4
+mov @r2, @r4
+m0
+jsr L6
+jsr L7
+m4
+L12: dec @r6
+not L7
+clr @r5
+not @r4
+L13: not @r7
+mov @r5, L10
+sub @r5, @r0
+prn L12
+jsr @r7
+L14: mov @r1, @r4
+L15: jmp @r5
+lea L0, L7
+rts
+L16: bne L14
+L17: lea L6, @r0
+rts
+bne @r1
+jmp @r6
+not D0
+add @r2, @r5
+L18: dec L8
+lea L17, @r6
+jmp @r3
+L19: prn -249
+jsr L55
+inc @r1
+m4
+jmp @r1
+bne L24
+L20: jsr @r4
+mov -403, @r5
+add L11, L1
+L21: red @r7
+clr @r3
+m1
+dec @r3
+inc L9
+L22: mov L21, L16
+clr @r1
+add L18, D0
+mov 447, @r1
+dec L13
+dec L0
+rts
+sub -279, @r7
+L23: cmp @r7, L3
+dec L4
+bne L0
+add L22, L38
+jmp L16
+prn @r4
+not L17
+m4
+lea L0, S6
+m3
+m2
+rts
+m0
+L24: red L17
+prn @r2
+lea L5, @r2
+lea L4, L1
+mov S0, @r0
+dec @r3
+lea L4, @r2
+L25: red L20
+lea L3, @r5
+not L7
+mov -443, @r7
+add L25, @r3
+add L14, @r0
+dec @r1
+lea L24, L18
+mov L21, @r4
+sub L2, @r6
+jsr L3
+inc L25
+inc @r2
+clr L4
+rts
+m2
+red L7
+jsr @r4
+m2
+not @r2
+m2
+jsr @r7
+jmp @r5
+clr @r3
+jsr @r6
+sub L11, @r6
+mov L21, L23
+L26: jmp @r6
+jmp @r2
+jsr L3
+mov L15, @r7
+bne L25
+cmp L6, L7
+not L6
+dec @r0
+lea L15, @r5
+prn L9
+L27: cmp @r7, @r3
+dec L6
+not L27
+L28: sub @r6, L1
+L29: prn @r0
+lea L10, @r6
+bne L21
+jsr @r6
+m4
+L30: sub -32, @r1
+mov L29, L2
+add L8, L3
+jmp @r2
+red L14
+bne S0
+red L30
+L31: jsr @r2
+add @r5, L9
+bne L29
+jmp @r4
+add L3, L32
+prn L24
+cmp @r6, 186
+red @r0
+add @r6, @r5
+red L10
+bne L20
+bne L7
+rts
+rts
+jmp L22
+L32: sub L3, @r1
+red @r0
+inc L20
+cmp 116, L4
+jmp L11
+L33: red @r2
+not @r3
+L34: dec L10
+mov L3, L16
+clr L10
+clr @r1
+lea L27, @r7
+cmp L18, @r3
+prn -352
+add L45, @r2
+lea L18, @r0
+m2
+add 213, @r4
+add -308, @r6
+clr @r2
+m2
+mov L23, L7
+dec @r2
+lea L1, L6
+L35: rts
+jmp @r3
+L36: not @r7
+sub @r7, @r7
+jsr @r0
+jmp L5
+not L36
+red L14
+sub L9, @r2
+red @r7
+clr @r2
+L37: bne @r4
+add L30, L32
+L38: sub 509, L3
+clr @r1
+jmp L2
+clr @r7
+add L8, L22
+clr L14
+add L12, L18
+m2
+red L24
+inc @r4
+inc L2
+L39: clr @r7
+sub @r4, L10
+clr L29
+lea L1, L14
+prn @r6
+sub 151, L53
+add L26, @r3
+rts
+L40: red L8
+L41: sub L49, L38
+prn 208
+jmp L40
+jsr @r0
+lea L11, @r2
+lea S7, @r4
+m3
+inc L13
+red @r6
+inc @r7
+L42: add -11, L13
+lea L44, @r5
+jsr @r7
+cmp L11, 362
+L43: jsr L20
+lea L8, @r2
+bne L41
+L44: inc @r2
+red L8
+bne @r1
+cmp 305, L4
+bne @r6
+m1
+clr L15
+jsr @r1
+inc L8
+m2
+sub -404, @r1
+sub @r5, @r0
+clr @r0
+rts
+rts
+sub @r1, @r3
+rts
+L45: mov @r2, @r6
+rts
+L46: clr @r2
+m2
+mov L59, L13
+jmp L11
+jsr @r7
+L47: not @r5
+cmp L45, 1
+lea L9, @r1
+m3
+L48: sub L37, @r2
+L49: add @r0, L32
+jsr L30
+m0
+m4
+rts
+inc L15
+mov @r7, @r6
+dec L41
+red @r5
+lea S9, L0
+L50: not @r1
+sub 488, L32
+red @r5
+dec @r1
+cmp @r1, 419
+L51: jmp @r2
+add @r6, L37
+jsr @r2
+L52: jsr L2
+sub L25, @r0
+cmp @r7, -501
+jsr @r3
+bne X1
+sub L16, @r2
+clr @r0
+sub L3, @r1
+rts
+sub @r3, @r5
+mov L23, @r7
+inc D0
+L53: add -247, X2
+jmp @r5
+bne @r6
+mov 126, @r4
+m3
+rts
+L54: prn -76
+add D0, L51
+rts
+inc @r7
+m4
+cmp S1, L37
+dec @r4
+cmp D0, -52
+cmp 238, 262
+m3
+jsr @r5
+m0
+inc L23
+m0
+rts
+jsr @r5
+not L12
+L55: lea L49, @r4
+rts
+not S4
+prn @r0
+bne L19
+jmp @r1
+add @r1, L56
+L56: jsr L58
+m3
+sub 487, D0
+L57: jmp @r6
+bne @r6
+cmp S1, -506
+L58: cmp L59, @r4
+rts
+sub @r0, @r4
+m2
+jsr S5
+red D0
+bne D0
+L59: lea L40, S1
+bne X3
+sub X4, D0
+stop
+D0: .data -293,465,-104,-397,-300,173,344,451,93,-355
+D1: .data -30,217,35,224,199,90,-28,-192,395,-244
+D2: .data -189,-3,14,-374,245,458,-143,-415,126,497
+D3: .data -323,-272,320,-311,375,-446,-131,419,-355,71
+D4: .data -400,35,-497,235,-476,498,259,-235,-484,-40
+D5: .data 414,-279,-414,251,-380,-232,-387,-330,-348,410
+D6: .data 385,-330,461,-405,23,282,238,-441,250,-281
+D7: .data 98,225,-248,444,93,-198,221,376,-409,479
+D8: .data -360,-64,367,-454,30,207,-278,-52,412,294
+D9: .data 154,156,-445,167,342,-130,357,98,488,494
+S0: .string "mvwxonawukntawklay"
+S1: .string "irxjfazrfzewg"
+S2: .string "zx"
+S3: .string "ecmgarbsteiyoqxv"
+S4: .string "ybbdtzvhiifj"
+S5: .string "izemkqrrkq"
+S6: .string "rovfknutcdwofr"
+S7: .string "ssvsdaobcyidzz"
+S8: .string "rka"
+S9: .string "u"
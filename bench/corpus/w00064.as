@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r1
+    prn 63
+endmcro
+mcro m1
+    sub @r2, @r6
+    prn 41
+endmcro
+mcro m2
+    sub @r6, @r6
+    prn 33
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 38
+endmcro
+mcro m4
+    sub @r5, @r1
+    prn 21
+endmcro
+prn L0
+bne L0
+lea L0, L0
+rts
+cmp @r1, @r2
+cmp L0, -362
+mov L0, L0
+add @r4, L0
+L0: jsr L0
+not L0
+inc L0
+m0
+sub @r1, L0
+L1: jmp L0
+inc L1
+bne @r5
+L2: mov @r2, L1
+m1
+m2
+jsr L1
+dec L1
+L3: bne @r5
+inc @r6
+sub L3, L0
+L4: cmp L3, L3
+bne @r4
+bne @r6
+L5: add @r2, @r7
+mov @r7, X0
+L6: prn 451
+mov 186, L4
+dec L1
+m0
+jsr @r5
+L7: inc L6
+rts
+cmp L3, -438
+m1
+bne @r1
+prn L5
+add L1, L2
+L8: prn 440
+lea L14, @r5
+not @r2
+cmp L8, -190
+bne @r6
+jsr L3
+jmp @r7
+L9: not @r3
+L10: jsr @r6
+red L6
+bne @r3
+L11: bne L10
+mov @r6, @r1
+sub 430, @r7
+clr @r5
+clr @r2
+bne @r5
+dec L8
+L12: mov L2, L4
+jmp @r5
+m1
+red L11
+add @r4, @r3
+add L4, @r1
+dec L6
+clr L5
+L13: add 470, @r4
+dec L12
+m3
+m1
+L14: cmp L2, L40
+m2
+sub L36, L11
+prn @r1
+prn 457
+L15: clr L14
+mov -218, L3
+red @r5
+jsr @r0
+not @r4
+L16: inc D0
+lea L7, @r1
+mov @r4, @r0
+prn @r5
+jsr L10
+red @r1
+not L4
+L17: bne L52
+cmp L16, 310
+inc @r5
+m1
+L18: prn L15
+red @r3
+m1
+inc L8
+m4
+lea L6, @r2
+prn D0
+bne D0
+add L9, @r6
+jsr @r7
+inc L1
+red @r5
+inc @r2
+prn L3
+jmp L11
+cmp L4, 131
+sub L16, L21
+lea L18, L3
+sub L14, @r5
+lea L5, L3
+mov S5, @r7
+cmp L15, -173
+red @r1
+rts
+dec @r6
+dec L8
+jmp L5
+mov 392, L6
+lea L9, @r3
+clr L8
+L19: not @r6
+red @r4
+clr L23
+rts
+clr L17
+L20: cmp L4, -315
+m4
+m3
+bne L10
+L21: jsr @r1
+bne @r3
+rts
+mov L18, L5
+cmp @r5, 446
+L22: prn @r0
+prn @r0
+red @r3
+L23: mov -155, L5
+rts
+not X1
+m2
+add @r7, L4
+lea L1, @r6
+inc @r1
+inc L18
+red L20
+m3
+bne @r7
+mov L16, L7
+dec L17
+m2
+not @r6
+L24: jsr L7
+jsr @r6
+bne L1
+m2
+m1
+cmp 63, 65
+prn @r2
+jsr @r7
+dec L1
+sub @r4, L3
+red L14
+mov @r6, @r0
+inc L18
+inc L8
+add @r1, @r1
+inc L16
+not S5
+not @r2
+L25: jmp L1
+L26: jsr @r0
+sub L14, @r1
+m2
+rts
+red @r6
+red L1
+m2
+mov 94, L12
+dec @r2
+bne L12
+red @r4
+lea L21, L25
+L27: jsr @r7
+clr @r4
+rts
+mov @r0, @r5
+clr L13
+clr @r0
+clr @r2
+dec L26
+rts
+add @r5, @r0
+jsr @r0
+lea L8, L11
+prn @r2
+red @r2
+clr @r3
+clr @r4
+rts
+jmp @r4
+m4
+add L2, @r7
+lea S0, @r3
+inc @r3
+sub @r1, L14
+bne L6
+m3
+cmp @r3, @r3
+lea L23, @r0
+dec L17
+L28: cmp @r0, -260
+prn L13
+cmp @r5, @r1
+prn @r0
+m2
+dec L5
+L29: dec L23
+clr L29
+rts
+not @r5
+bne @r0
+jsr @r7
+m4
+L30: clr L6
+inc L0
+prn L22
+clr L21
+not L27
+rts
+lea L3, L2
+lea L1, L9
+m4
+L31: dec @r7
+L32: inc L30
+prn -210
+bne @r7
+prn 92
+cmp @r4, -503
+jmp @r7
+dec @r4
+L33: jmp @r6
+m3
+prn -129
+inc @r4
+bne @r5
+clr @r5
+m3
+m2
+jmp @r3
+rts
+lea L2, L39
+prn @r0
+L34: lea L7, @r5
+lea L42, @r0
+not @r2
+sub 428, L1
+rts
+lea L21, @r6
+rts
+red @r5
+mov -318, @r0
+L35: jmp @r2
+add -264, L20
+cmp @r6, 344
+not L54
+jsr L17
+clr L13
+prn -369
+L36: inc @r0
+not L24
+not L24
+red @r7
+bne L28
+m0
+L37: lea L29, S9
+rts
+mov @r5, @r2
+jmp @r1
+clr L2
+rts
+cmp @r6, @r5
+jsr @r6
+red @r3
+jsr L26
+L38: not @r0
+mov L31, S2
+clr L46
+m4
+dec @r2
+m2
+L39: add @r0, @r0
+jmp @r1
+red L13
+prn L29
+rts
+L40: red X2
+sub L19, @r2
+prn L29
+lea L22, L10
+red @r0
+cmp @r6, 509
+jsr @r6
+not @r5
+not L18
+L41: not @r1
+prn @r5
+sub 233, @r3
+prn 267
+clr @r7
+dec @r6
+lea L0, @r1
+mov D0, L15
+not L38
+not @r1
+sub @r0, L28
+dec @r6
+jmp L49
+mov @r4, L21
+add @r5, X3
+mov L0, D0
+jmp @r7
+L42: add L13, @r0
+m3
+cmp @r5, @r0
+red L22
+lea L17, L27
+sub 149, L12
+prn L15
+inc @r4
+dec L25
+clr @r3
+jmp L0
+m0
+L43: red L2
+L44: inc @r2
+clr L37
+rts
+cmp -80, 166
+cmp @r7, L12
+jmp L34
+L45: prn -383
+m4
+sub @r0, L50
+L46: clr L24
+L47: clr @r2
+mov L29, @r4
+red L7
+jmp L0
+lea L16, @r0
+L48: bne L55
+inc L59
+jmp @r0
+lea L16, L42
+inc @r6
+dec @r2
+jsr @r7
+rts
+add @r5, @r1
+dec L20
+add -428, L13
+red @r6
+jsr S9
+L49: jsr @r3
+L50: sub L27, L31
+cmp -311, -335
+inc L26
+jsr L5
+jsr @r3
+mov @r6, @r7
+add @r1, @r1
+bne L21
+bne @r5
+clr L23
+not L51
+cmp @r3, @r0
+cmp L38, @r0
+red @r5
+red L49
+red L47
+add @r1, @r3
+m4
+jmp @r4
+cmp L52, @r3
+L51: clr L45
+jsr @r3
+clr @r6
+not L6
+L52: bne L43
+L53: not @r5
+prn L44
+red S9
+not @r5
+rts
+mov -73, @r0
+clr @r3
+mov 217, L12
+jmp @r5
+m2
+add L43, @r0
+m1
+L54: dec L56
+sub D0, L18
+cmp 67, -6
+jmp @r1
+jmp @r2
+dec @r2
+inc L17
+lea L14, @r7
+L55: dec @r3
+inc L4
+sub @r6, @r2
+L56: jmp @r4
+L57: jsr L19
+jmp L3
+rts
+rts
+lea L59, @r3
+sub 191, L40
+lea D0, @r0
+rts
+dec @r4
+not @r1
+bne L59
+red X4
+mov -285, S8
+red @r5
+prn @r1
+mov @r4, L41
+rts
+m1
+sub -114, @r0
+sub D0, @r0
+rts
+L58: not D0
+prn L59
+m0
+L59: lea S9, D0
+stop
+D0: .data 440,-319,-255,-228,428,230,384,-448,-440,234
+D1: .data -466,-33,379,202,-423,69,-101,-400,311,241
+D2: .data 438,267,119,269,69,-439,265,-388,157,-85
+D3: .data 163,40,421,-230,123,428,32,335,-156,-453
+D4: .data -282,391,317,267,-399,-481,-85,177,458,204
+D5: .data -315,254,195,391,92,139,-491,9,-335,424
+D6: .data -152,244,41,232,-159,-463,-395,201,-75,429
+D7: .data 273,-476,-22,-267,-21,171,-475,285,-317,461
+D8: .data -47,364,39,-152,-72,491,-473,-487,-96,-294
+D9: .data 59,467,134,-240,39,-311,-423,448,331,-113
+S0: .string "defrzl"
+S1: .string "yfpzlndopnhnyosluap"
+S2: .string "iudjwrhzxdexx"
+S3: .string "oj"
+S4: .string "gftkjvuvfysjmlic"
+S5: .string "fhnkqxbhmqaklfdygfk"
+S6: .string "nulgta"
+S7: .string "komxpcxwsnlkxnttew"
+S8: .string "ocaywc"
+S9: .string "dpajvtawuo"
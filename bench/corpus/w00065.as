@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r3
+    prn 2
+endmcro
+mcro m1
+    sub @r6, @r7
+    prn 39
+endmcro
+mcro m2
+    sub @r0, @r4
+    prn 98
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 14
+endmcro
+mcro m4
+    sub @r7, @r7
+    prn 45
+endmcro
+add @r5, @r4
+lea L0, L46
+jsr @r7
+lea L0, @r0
+prn 242
+rts
+mov -26, L0
+m4
+m0
+jsr @r3
+bne L0
+clr L0
+not @r6
+cmp L0, @r1
+L0: jsr @r4
+jmp L0
+jsr @r2
+cmp -141, -366
+m2
+jsr L0
+jsr L0
+dec @r5
+not L0
+L1: prn @r5
+sub @r7, @r6
+red L1
+L2: jsr L2
+inc X0
+mov -169, S2
+m4
+L3: cmp L31, @r2
+bne @r1
+mov @r0, @r1
+L4: prn L3
+lea L0, @r1
+not @r1
+rts
+jsr L2
+m4
+m4
+prn -214
+inc D0
+m2
+mov L0, L1
+jmp L1
+inc L3
+L5: prn L4
+jmp L3
+inc @r6
+sub -282, L3
+not L1
+prn -242
+L6: clr L17
+cmp @r7, L3
+rts
+L7: prn @r5
+m0
+jsr L6
+inc @r0
+rts
+not @r7
+L8: bne L3
+not @r2
+rts
+red @r0
+inc @r3
+add @r3, @r6
+not L7
+mov 216, L8
+jsr @r1
+sub @r2, L2
+mov @r3, L0
+inc S8
+mov @r7, @r1
+prn @r0
+L9: lea L0, L8
+prn @r4
+prn L9
+rts
+prn -185
+rts
+cmp L5, @r1
+clr L3
+dec @r4
+jmp L0
+not @r0
+cmp L6, @r2
+not @r4
+m2
+red L3
+clr L6
+rts
+jsr @r4
+bne S6
+bne X1
+add L2, @r6
+red L7
+jsr @r0
+jsr @r6
+jsr L2
+mov 112, @r2
+mov -508, L2
+bne L4
+dec @r5
+L10: dec L6
+jsr @r7
+L11: jmp L2
+dec @r4
+clr S0
+m4
+red L2
+jmp @r5
+jsr L1
+m4
+lea L5, L10
+jsr @r3
+clr @r4
+sub -472, L6
+m2
+add @r1, @r5
+add @r2, @r7
+sub @r0, L10
+not @r2
+cmp -311, -464
+cmp L8, 292
+bne L7
+inc @r6
+inc L0
+lea L1, L8
+add @r2, L4
+cmp @r1, @r2
+jsr @r6
+prn -173
+dec L1
+mov -463, L8
+m1
+dec L7
+jsr L8
+rts
+lea L4, @r0
+jsr @r1
+not L40
+not @r1
+jsr L5
+lea L48, L1
+m4
+L12: inc L10
+dec L9
+cmp -485, L5
+cmp @r3, L11
+mov L9, L12
+clr @r5
+add @r1, L10
+lea L8, @r2
+sub L9, L11
+L13: lea L10, L6
+m1
+mov 439, @r5
+jsr L9
+rts
+mov @r1, L7
+add -281, @r1
+rts
+lea D0, @r1
+clr @r2
+dec @r6
+clr L7
+m2
+m0
+m2
+L14: mov 267, L5
+bne L4
+lea L13, @r7
+add @r5, @r7
+jsr @r0
+mov L0, L3
+add -474, L4
+sub @r7, @r1
+not L11
+jsr @r4
+cmp L14, L4
+mov L38, @r4
+clr S6
+rts
+rts
+add 50, L4
+m3
+L15: mov @r6, L3
+add @r1, S9
+L16: clr @r4
+clr @r1
+dec L2
+mov @r6, @r6
+inc @r2
+L17: dec @r3
+m4
+not @r4
+L18: rts
+jmp D0
+L19: dec @r2
+L20: rts
+inc @r3
+m4
+L21: not @r6
+sub L21, @r7
+add L4, @r7
+clr @r6
+m4
+L22: lea L21, L22
+L23: red L37
+dec @r5
+L24: mov @r3, L13
+m2
+clr @r3
+prn L10
+L25: jmp L25
+jmp @r2
+jsr L32
+dec L13
+jsr @r5
+add @r5, @r1
+m0
+red L18
+m0
+L26: dec L9
+rts
+L27: clr L9
+cmp -244, @r4
+L28: lea L13, L15
+clr L2
+prn 369
+sub -275, @r7
+prn 119
+rts
+rts
+sub L3, L17
+cmp @r7, L13
+bne X2
+jmp L24
+jsr @r5
+not @r3
+rts
+prn L20
+m2
+jmp L22
+lea L27, L0
+dec L22
+prn 77
+m2
+red L22
+m1
+L29: rts
+m2
+mov 72, @r3
+lea D0, L10
+bne @r1
+L30: not @r2
+L31: jmp @r7
+bne @r2
+L32: jsr @r1
+dec L23
+rts
+mov @r1, L12
+sub @r3, L22
+cmp -185, -196
+dec @r0
+clr L21
+L33: bne @r5
+bne @r4
+L34: red L19
+add @r1, @r7
+jmp L6
+clr @r7
+prn 257
+jmp @r5
+m0
+bne L50
+lea L17, @r6
+bne @r5
+L35: jmp @r0
+clr S7
+clr L20
+clr L14
+jmp S5
+inc @r0
+prn @r2
+red D0
+dec L12
+red L11
+jsr @r3
+jmp L50
+dec L24
+add D0, L10
+jmp L11
+inc @r5
+lea L13, L0
+m0
+inc @r0
+dec L24
+rts
+prn @r5
+L36: red L36
+bne @r2
+lea L22, @r7
+red @r1
+m2
+bne @r0
+bne @r0
+not @r7
+clr @r4
+clr @r1
+jmp @r0
+L37: prn @r1
+jsr @r5
+m4
+red @r7
+dec L3
+red @r2
+m2
+sub L36, L31
+L38: add @r1, @r0
+sub -44, @r5
+not L30
+cmp @r7, -187
+lea L21, L25
+rts
+lea L16, @r4
+add L14, @r7
+jsr L31
+add @r5, @r6
+dec L44
+L39: bne @r6
+L40: not L15
+L41: clr @r0
+lea L33, L38
+cmp L36, 325
+jmp L29
+dec L1
+mov @r4, L24
+sub @r0, @r2
+sub @r4, L41
+jmp @r0
+L42: clr @r0
+jsr L20
+L43: dec L15
+jsr L11
+sub @r3, L35
+jsr L53
+sub -88, @r4
+jsr @r6
+jmp L9
+lea L9, D0
+L44: prn @r2
+jmp @r4
+L45: not @r2
+rts
+sub L20, @r2
+dec L11
+red @r1
+bne @r2
+rts
+L46: red @r0
+m0
+red @r0
+add L43, L53
+m3
+L47: sub L28, L51
+sub @r4, L44
+bne @r0
+add 318, @r4
+jmp @r4
+red @r4
+mov -165, L36
+L48: inc @r2
+inc D0
+clr L18
+L49: add L4, L25
+L50: not @r5
+m2
+jsr @r1
+clr L45
+clr L58
+lea L28, @r7
+inc @r4
+lea L35, L48
+jmp @r6
+rts
+inc L3
+clr @r5
+jsr @r3
+bne L25
+not L35
+prn @r7
+mov 406, L1
+cmp L46, @r6
+not D0
+rts
+L51: dec L16
+bne L31
+mov 355, X3
+add L1, @r5
+jsr L3
+jmp D0
+L52: inc S5
+dec L10
+red @r0
+cmp @r5, L21
+inc @r7
+red @r0
+mov 247, L3
+m4
+cmp 361, L9
+jsr L53
+L53: mov L26, L34
+cmp -188, @r0
+L54: add -45, @r1
+jmp @r2
+jsr L12
+rts
+bne @r4
+L55: rts
+m1
+bne @r6
+add -431, L30
+L56: jsr @r6
+bne L17
+prn @r7
+lea L57, @r4
+add @r7, D0
+cmp L59, L13
+cmp L55, -379
+dec @r0
+bne @r6
+L57: lea L41, @r3
+L58: clr L59
+L59: rts
+sub 443, L37
+m2
+clr D0
+clr X4
+stop
+D0: .data 405,-312,-29,-137,241,-164,-131,-410,-266,-406
+D1: .data -320,143,273,491,-373,386,152,-2,304,-487
+D2: .data 275,-381,-299,-118,-333,-276,-300,-182,-399,413
+D3: .data 458,-79,224,234,-196,-281,-406,98,-251,-271
+D4: .data -13,369,177,287,-326,-474,146,-54,131,424
+D5: .data -305,302,131,458,-253,254,358,-357,-24,-274
+D6: .data -234,341,228,-431,355,-359,-121,226,-348,-436
+D7: .data -3,-244,-403,-340,-102,-218,-299,55,0,18
+D8: .data 362,122,-464,-230,186,-131,-38,302,-189,-353
+D9: .data -428,-469,126,-123,267,456,-383,430,-128,-355
+S0: .string "hpkusdirqjykvdped"
+S1: .string "wfrrelhxejpjprj"
+S2: .string "vzbx"
+S3: .string "lmjhyzblib"
+S4: .string "vshvxriybgxwzbvabnpb"
+S5: .string "fnvikonvazlg"
+S6: .string "hllqsex"
+S7: .string "gm"
+S8: .string "vugvorswaple"
+S9: .string "ayrntvtplmz"
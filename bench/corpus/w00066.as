@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r6
+    prn 72
+endmcro
+mcro m1
+    sub @r3, @r0
+    prn 38
+endmcro
+mcro m2
+    sub @r2, @r2
+    prn 63
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 91
+endmcro
+mcro m4
+    sub @r1, @r5
+    prn 70
+endmcro
+dec L0
+L0: jmp L0
+bne @r0
+L1: clr @r1
+jmp @r1
+jmp @r7
+jsr @r7
+clr L0
+jmp L0
+L2: jmp L0
+m1
+lea L1, L2
+clr @r1
+cmp @r7, @r0
+add L0, L1
+bne @r1
+add @r4, @r2
+rts
+cmp L0, @r7
+lea L2, S5
+m2
+sub L0, L1
+sub -53, @r3
+rts
+jsr @r2
+rts
+red @r5
+cmp L1, @r1
+rts
+jsr L0
+m3
+L3: jmp L3
+m3
+m2
+lea L1, @r2
+mov 419, L1
+rts
+prn L1
+rts
+not L40
+inc L3
+prn L3
+m3
+mov @r3, L2
+not @r7
+L4: add L3, @r1
+rts
+L5: clr L1
+clr L1
+jsr L2
+bne L5
+prn 183
+inc L1
+dec L4
+jmp X0
+L6: rts
+prn 187
+not L3
+red L9
+mov @r2, L34
+sub L5, D0
+jmp @r3
+sub -497, @r7
+not @r3
+cmp @r1, 161
+inc L2
+add -493, @r4
+cmp -174, X1
+clr @r0
+L7: jsr L5
+clr S5
+m3
+inc @r3
+sub 46, @r5
+bne L6
+inc @r2
+red L1
+cmp 8, @r7
+lea L1, @r7
+L8: sub L6, @r6
+prn @r0
+prn L42
+bne L24
+cmp 215, -130
+rts
+jmp L3
+L9: not L3
+sub L7, L3
+dec @r1
+dec L3
+lea L3, L6
+red @r3
+dec @r0
+rts
+mov L4, @r2
+jsr L8
+clr L5
+L10: rts
+m3
+red L48
+jsr @r1
+jsr D0
+L11: bne @r0
+L12: add @r5, @r7
+red L4
+bne L53
+m3
+cmp 3, @r2
+sub L4, L35
+m3
+not @r1
+m1
+dec L1
+lea L3, @r2
+rts
+jmp L9
+L13: rts
+not L5
+lea L5, @r0
+jsr L5
+add 368, @r3
+m3
+red @r5
+mov L0, L10
+cmp @r2, L3
+rts
+add -449, @r1
+sub L11, L13
+jsr @r1
+prn L4
+add 268, @r4
+m4
+L14: sub @r0, @r7
+lea L4, @r3
+m3
+sub -65, L10
+clr @r6
+not @r7
+lea L9, @r2
+jmp @r2
+cmp 11, L9
+rts
+clr L2
+dec L12
+rts
+red L13
+red L1
+red L14
+bne @r7
+L15: add -126, @r3
+red @r1
+clr L14
+m4
+m2
+red @r4
+lea L14, L10
+not @r3
+inc L7
+clr @r5
+L16: lea L18, @r5
+m2
+mov 303, L4
+dec @r1
+L17: bne D0
+inc L13
+rts
+lea L11, L10
+inc @r4
+m3
+clr L13
+sub @r3, @r0
+L18: red L1
+rts
+cmp @r0, 275
+m4
+not @r5
+prn @r4
+L19: inc L3
+bne @r7
+mov @r5, L10
+jmp L18
+L20: sub -102, @r0
+jsr @r6
+sub L0, L17
+inc @r1
+jmp @r0
+mov -354, @r1
+lea L16, D0
+L21: cmp @r5, @r6
+m1
+cmp L13, @r5
+sub L5, @r6
+lea L4, L1
+lea L9, L2
+clr @r0
+m1
+clr @r2
+clr L9
+add L8, @r6
+jsr @r2
+dec L6
+sub @r0, L4
+L22: jsr L12
+bne S6
+red @r6
+prn @r0
+dec L21
+bne L12
+m1
+prn L4
+jsr @r6
+sub @r3, @r0
+mov L18, L21
+m3
+jmp L7
+sub @r2, @r6
+m3
+prn @r5
+rts
+add L16, @r3
+L23: jsr @r0
+rts
+L24: prn L20
+mov @r4, @r4
+mov @r6, @r1
+sub L24, @r2
+L25: not @r4
+inc L15
+sub -235, L4
+lea L17, L25
+dec @r2
+jmp L1
+dec L46
+L26: add 241, @r1
+sub @r6, @r2
+m4
+not L4
+cmp @r1, L23
+m4
+mov L25, L33
+L27: bne @r6
+L28: mov 469, @r1
+L29: dec L23
+L30: rts
+m0
+inc @r7
+mov -289, L0
+lea L33, @r6
+jsr L31
+rts
+mov L5, L14
+not S1
+m3
+bne @r0
+lea L25, L0
+clr @r1
+jmp @r6
+m4
+red L9
+L31: dec L17
+inc @r6
+L32: mov -158, @r6
+mov L21, @r0
+clr L17
+bne @r5
+sub -155, @r5
+lea L29, L12
+L33: rts
+L34: red L5
+jsr L19
+L35: cmp 390, L23
+rts
+mov @r6, @r4
+not @r2
+mov L29, @r3
+not @r1
+L36: clr @r5
+jmp L12
+sub L29, L28
+jsr @r6
+sub @r1, L54
+cmp -372, L20
+L37: rts
+mov @r6, @r1
+dec @r5
+L38: mov -295, L12
+rts
+lea L17, @r0
+sub 292, @r0
+bne L20
+lea L4, L51
+add @r3, L27
+lea L37, @r3
+cmp -75, L36
+clr L3
+sub @r7, L32
+L39: jsr L33
+jsr L2
+bne L25
+mov S8, @r5
+bne L9
+not @r5
+inc @r7
+not @r5
+sub @r0, @r2
+mov @r0, L33
+red L13
+add L34, L53
+L40: red @r7
+clr @r0
+inc @r5
+red @r7
+sub L18, L20
+L41: mov @r3, S8
+jmp L25
+sub L22, L4
+L42: prn -3
+clr L9
+bne @r6
+add @r5, @r4
+prn L28
+red @r7
+sub @r1, L16
+add -167, @r6
+jsr X2
+dec @r1
+red @r5
+red @r0
+inc D0
+clr L33
+jmp @r2
+clr @r6
+m2
+red L18
+L43: dec @r0
+clr S5
+mov 451, @r4
+mov 388, @r3
+dec L51
+inc L33
+not L55
+inc L13
+rts
+L44: jmp @r2
+lea L40, @r0
+red @r1
+L45: sub -199, L3
+dec @r1
+lea L10, L30
+not L22
+L46: clr @r6
+L47: clr @r7
+mov @r1, D0
+not S3
+cmp L5, L28
+L48: mov @r7, @r3
+m2
+sub @r1, L27
+jmp L21
+L49: sub 90, L2
+rts
+jsr X3
+bne L42
+cmp L20, L29
+inc L22
+sub @r1, L20
+clr L44
+red S0
+add L48, @r4
+inc L44
+rts
+m3
+not @r2
+dec @r4
+not @r6
+add @r5, @r0
+bne @r7
+lea S8, @r1
+jmp @r5
+prn @r1
+bne @r6
+bne @r0
+bne @r7
+jsr @r4
+m3
+red @r2
+jmp L37
+red @r2
+inc L48
+rts
+L50: bne @r0
+dec L6
+red @r7
+L51: sub L54, L11
+prn L31
+clr L22
+prn L15
+red @r2
+m0
+L52: sub L6, L31
+cmp @r4, @r1
+bne L25
+mov L38, @r2
+m4
+jmp L10
+m4
+L53: mov 402, L49
+L54: cmp L59, 119
+prn @r2
+jsr @r4
+L55: not @r3
+bne @r1
+jsr @r5
+bne @r6
+dec D0
+dec @r7
+not @r0
+inc L30
+lea L6, @r5
+dec @r1
+add -96, @r5
+L56: jmp L43
+jmp L5
+jsr X4
+jmp @r4
+sub L50, @r7
+L57: jsr L58
+jmp L13
+clr @r7
+m0
+bne L40
+L58: dec @r1
+dec @r5
+m4
+lea L29, @r2
+L59: mov D0, @r0
+clr @r7
+m3
+red @r2
+m1
+stop
+D0: .data 10,19,41,254,289,220,159,183,257,-352
+D1: .data -218,149,-404,423,278,360,222,-52,389,-31
+D2: .data 109,86,292,24,260,158,-259,142,-270,-153
+D3: .data -33,167,-115,-67,40,414,420,473,-397,339
+D4: .data 139,-404,96,330,-336,-489,-62,-484,-402,315
+D5: .data 83,-109,292,409,347,326,-441,24,56,-3
+D6: .data 17,-290,-268,-222,130,-165,-152,390,-242,-214
+D7: .data 367,407,-364,306,-394,297,-415,-469,-136,258
+D8: .data 329,-79,298,70,-271,-305,215,-283,-70,-138
+D9: .data -261,116,468,-336,404,64,33,423,187,-261
+S0: .string "bkacxxi"
+S1: .string "ztkfcwzeyejatn"
+S2: .string "re"
+S3: .string "nqexnmyrkfogstdph"
+S4: .string "dqynyzwtr"
+S5: .string "xtsfwmgyvujgqzag"
+S6: .string "lxdbltui"
+S7: .string "mqgonbcdo"
+S8: .string "oxztazajvjr"
+S9: .string "dngi"
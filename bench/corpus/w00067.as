@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r0
+    prn 10
+endmcro
+mcro m1
+    sub @r7, @r2
+    prn 36
+endmcro
+mcro m2
+    sub @r4, @r0
+    prn 61
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 67
+endmcro
+mcro m4
+    sub @r4, @r3
+    prn 94
+endmcro
+jsr L0
+lea L0, L0
+red L0
+L0: jsr L0
+jmp L0
+m2
+inc L0
+inc L0
+rts
+inc D0
+sub L0, @r0
+cmp @r1, @r2
+m4
+jsr L0
+clr @r1
+cmp @r3, -334
+m4
+lea L0, L0
+L1: dec @r3
+dec @r1
+jmp L0
+not @r0
+prn 302
+prn @r6
+jmp L0
+L2: add 218, @r2
+add @r6, @r6
+cmp 340, L0
+dec @r1
+bne @r1
+L3: red @r5
+sub @r0, L2
+cmp @r3, @r0
+add L0, L2
+sub @r5, @r0
+clr L2
+m4
+sub -268, L2
+red L1
+red @r2
+bne L3
+m3
+L4: lea L0, @r1
+L5: add @r1, L5
+add @r6, @r7
+m1
+jmp @r0
+red @r4
+jmp @r5
+L6: add @r1, L1
+cmp @r1, @r7
+L7: bne D0
+add L4, L2
+jsr L4
+inc L6
+L8: inc L2
+add -120, L3
+rts
+add -264, @r6
+dec @r1
+dec L3
+L9: cmp @r2, L0
+inc @r0
+jsr L7
+jmp L9
+red L5
+lea L2, @r6
+L10: mov 161, L5
+L11: inc @r3
+L12: clr @r0
+jmp L2
+L13: bne @r3
+inc @r0
+mov 194, S8
+add @r2, @r0
+lea L11, L12
+bne @r6
+not @r7
+jmp L8
+dec @r0
+jmp @r0
+L14: bne @r0
+dec L2
+L15: bne L2
+bne @r1
+red L15
+L16: prn @r0
+add -240, @r0
+jsr @r4
+jmp @r7
+m3
+L17: red L2
+L18: sub 307, L9
+sub @r2, L11
+not L2
+jmp @r0
+bne L2
+clr @r7
+cmp L14, -511
+m3
+clr X0
+prn L1
+inc @r5
+mov 7, L12
+cmp 187, @r2
+jsr L5
+rts
+bne L0
+not L9
+m3
+inc L3
+add 491, @r2
+bne L17
+lea L4, L7
+lea L19, @r4
+red L10
+bne @r1
+m4
+L19: bne @r2
+m0
+m1
+prn @r4
+lea L11, @r0
+bne L6
+jmp L29
+L20: prn L11
+L21: prn -439
+L22: rts
+dec @r2
+lea L3, @r5
+clr @r1
+m3
+not L18
+L23: bne L7
+lea L12, L15
+jsr L21
+prn -150
+jmp @r3
+mov -20, L22
+bne @r7
+bne L12
+mov -272, L9
+cmp @r0, -37
+add -179, @r1
+L24: inc L15
+m3
+inc L0
+L25: rts
+bne @r3
+rts
+m0
+sub -450, L20
+add @r5, L7
+jsr @r1
+dec L0
+rts
+dec @r1
+red L3
+L26: jmp L13
+bne L26
+lea L22, L18
+sub L14, L19
+add 72, L5
+inc L22
+add @r6, L3
+mov 50, @r6
+m1
+m2
+jmp L22
+add @r7, @r7
+prn @r6
+not @r6
+jsr @r3
+m3
+L27: mov L10, L20
+jsr L10
+sub L23, @r1
+red @r5
+clr L3
+clr L12
+sub L48, @r7
+prn L11
+L28: bne L25
+L29: jsr L47
+dec @r5
+prn @r7
+clr @r2
+sub 180, @r2
+L30: cmp L0, L24
+L31: prn L26
+add 406, L11
+cmp 436, @r4
+rts
+L32: rts
+cmp @r7, @r1
+jsr @r1
+mov @r4, L1
+L33: jmp @r2
+lea L32, @r2
+not L3
+L34: mov L33, D0
+add L34, @r4
+jmp L3
+red L33
+rts
+m3
+m2
+lea L25, @r1
+prn L22
+m4
+lea L11, @r7
+L35: add -430, @r4
+mov L38, L11
+add @r3, @r2
+prn L4
+inc L20
+mov L12, S7
+m2
+not @r7
+L36: clr @r2
+bne @r7
+jsr D0
+L37: jmp L36
+lea L24, @r1
+rts
+prn @r7
+sub @r3, L19
+jsr L2
+bne @r6
+dec @r3
+clr L34
+prn @r3
+mov D0, @r5
+L38: not L36
+lea L10, L0
+red L26
+mov L28, D0
+inc L23
+clr @r4
+add @r7, L16
+jsr @r3
+L39: cmp D0, -481
+inc @r5
+clr L37
+L40: dec @r1
+not L24
+m0
+add 182, L11
+jsr @r4
+mov @r7, @r6
+lea L26, @r5
+jsr @r2
+rts
+prn L26
+add -312, L29
+jmp @r5
+jsr X1
+inc L31
+add -204, L2
+not L38
+m0
+dec @r0
+jsr @r4
+jsr L19
+prn -7
+m2
+L41: cmp L47, L24
+m2
+cmp @r7, @r1
+inc @r3
+clr @r3
+add -92, L26
+jmp L1
+inc @r7
+not L2
+not L29
+dec L6
+cmp L8, L25
+cmp -154, @r6
+dec @r3
+add -113, @r0
+L42: inc D0
+dec @r3
+lea L15, L27
+clr @r7
+jmp L35
+not @r2
+cmp -450, @r4
+m2
+mov @r5, L57
+lea L16, L59
+mov L28, L27
+red @r7
+m3
+dec L11
+dec @r3
+L43: not @r6
+red @r3
+cmp L11, 14
+dec @r2
+L44: cmp L2, X2
+inc D0
+dec X3
+m2
+m2
+prn @r7
+clr L37
+add L6, @r5
+jsr @r5
+cmp 284, 250
+rts
+inc L7
+add @r0, @r6
+inc @r3
+rts
+L45: jsr L41
+L46: jsr L30
+bne @r6
+L47: lea L15, L11
+inc @r2
+jsr L44
+clr L42
+not L21
+rts
+L48: jsr @r6
+rts
+m4
+add L57, @r6
+red L34
+bne S6
+bne D0
+lea L28, @r2
+cmp @r6, 406
+L49: not @r4
+red @r4
+dec L41
+dec @r2
+jmp @r4
+rts
+add S9, L17
+add -218, L59
+m1
+add @r0, L13
+mov 401, @r3
+jmp L9
+bne @r6
+add @r2, @r4
+dec L35
+clr L5
+lea L3, L4
+L50: add L38, L21
+L51: jsr @r1
+prn -419
+rts
+jsr @r7
+lea L17, @r6
+cmp @r5, L48
+m3
+rts
+jsr L53
+L52: lea L3, @r6
+m3
+clr L52
+red S9
+dec @r5
+sub -281, L12
+jmp S3
+lea L17, @r3
+prn @r7
+prn 209
+m2
+m2
+lea L56, L26
+jsr S1
+not L35
+jsr @r0
+clr @r6
+inc L41
+cmp L17, @r7
+rts
+clr @r2
+add -265, @r5
+L53: lea X4, L29
+jmp @r3
+prn @r1
+prn L9
+jsr @r4
+mov L57, @r7
+clr L36
+red @r7
+prn @r6
+mov @r4, L9
+add L10, @r1
+lea L42, @r2
+jmp @r7
+lea L32, @r6
+add 12, S1
+L54: rts
+jmp @r0
+clr @r6
+jsr L19
+bne @r0
+inc @r1
+inc L38
+inc @r7
+clr L2
+inc L51
+add -492, D0
+red @r4
+bne @r3
+rts
+L55: cmp L59, L29
+prn -137
+sub L53, @r2
+add @r2, L23
+jmp @r6
+sub -240, @r2
+add @r4, L53
+L56: prn @r1
+clr D0
+L57: prn @r6
+jsr L39
+prn 468
+rts
+m3
+m3
+prn @r6
+dec @r0
+not @r2
+m1
+add -251, @r2
+prn 206
+L58: lea L59, L27
+jsr L59
+not D0
+L59: dec L59
+inc @r6
+inc D0
+m1
+bne D0
+stop
+D0: .data -232,455,33,-138,-291,29,-221,-1,-366,225
+D1: .data 318,-432,51,-356,408,-330,-282,39,167,475
+D2: .data 382,-310,-61,332,-222,-410,335,141,78,-161
+D3: .data 36,153,351,62,423,-141,417,313,173,295
+D4: .data -315,-139,-472,344,322,-247,-26,-9,-21,105
+D5: .data 318,321,108,-146,37,84,-193,-22,285,-428
+D6: .data -369,313,-127,192,-94,-33,167,76,-473,-254
+D7: .data 495,468,481,-228,170,385,385,259,170,-155
+D8: .data -463,417,256,-409,-355,-96,90,-57,-315,443
+D9: .data 452,147,-456,-250,412,333,346,-215,-311,68
+S0: .string "rp"
+S1: .string "iciqwrhnyljgerzf"
+S2: .string "mipathkkhhlikvxdr"
+S3: .string "m"
+S4: .string "bebxlmocfuuyt"
+S5: .string "ho"
+S6: .string "hqvkszspqeqgin"
+S7: .string "oxjyrxfblshn"
+S8: .string "bckym"
+S9: .string "xmcjkksbovvuncx"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r3
+    prn 81
+endmcro
+mcro m1
+    sub @r3, @r3
+    prn 35
+endmcro
+mcro m2
+    sub @r6, @r6
+    prn 26
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 43
+endmcro
+mcro m4
+    sub @r6, @r2
+    prn 19
+endmcro
+lea D0, L0
+L0: sub L0, L0
+L1: add 458, @r1
+L2: mov L55, @r5
+L3: not @r6
+jmp @r0
+jsr @r6
+add L1, @r6
+clr @r0
+clr @r3
+jmp @r3
+rts
+not @r6
+red @r4
+rts
+inc L1
+jsr L3
+dec @r3
+red L1
+sub 368, @r1
+rts
+bne @r4
+m2
+L4: add 99, L4
+jmp L0
+jsr L2
+m2
+dec L1
+m3
+jsr @r5
+red @r0
+jsr L2
+clr L1
+inc @r6
+L5: sub L3, @r5
+m4
+prn 443
+lea L4, L5
+L6: lea L3, L4
+clr L0
+prn -243
+lea L4, @r1
+prn @r0
+red L3
+lea L2, @r6
+L7: inc L4
+L8: jmp @r0
+rts
+sub L1, @r2
+sub @r0, @r7
+not L8
+not @r0
+bne L7
+m3
+dec @r3
+jsr D0
+lea L3, L38
+inc @r0
+cmp 186, L1
+L9: jmp @r6
+jmp @r1
+rts
+prn -335
+m3
+add L0, L7
+rts
+cmp 506, @r4
+L10: red @r3
+lea L8, @r7
+rts
+lea L2, @r6
+not @r7
+dec L4
+prn L9
+L11: cmp L9, L46
+add L5, L8
+jsr L1
+rts
+red L8
+L12: not L12
+jsr L1
+jmp S7
+L13: rts
+L14: bne @r5
+not @r3
+add 145, @r4
+sub @r4, L7
+not @r3
+clr @r3
+inc @r7
+inc L12
+jsr L3
+cmp L6, -456
+clr L12
+clr @r1
+add L12, L8
+mov L1, @r6
+inc @r1
+jmp @r7
+inc L0
+jsr L12
+L15: cmp 474, @r2
+red L4
+cmp @r2, 283
+bne L43
+red @r4
+red L15
+red @r4
+add -304, @r3
+clr L43
+lea L13, @r7
+lea L47, L2
+jsr @r0
+m0
+m1
+sub L4, @r0
+lea L1, L14
+rts
+not @r4
+jsr @r3
+mov 267, @r3
+jsr @r7
+rts
+inc @r3
+jsr @r7
+jsr L15
+lea L11, L19
+L16: bne @r3
+bne X0
+prn -316
+jsr L15
+cmp @r1, @r2
+jsr @r3
+jmp @r4
+not @r7
+m2
+jsr @r0
+L17: prn L2
+add -464, L3
+jmp L13
+rts
+dec L13
+add L9, @r3
+mov @r4, L4
+bne @r2
+L18: prn @r4
+bne @r5
+cmp @r4, -27
+inc @r1
+not @r3
+mov L6, L0
+not L3
+rts
+m3
+prn -239
+m1
+clr L13
+rts
+jsr @r1
+sub -19, S9
+L19: clr @r0
+cmp -79, -476
+L20: prn -53
+clr L7
+not @r7
+add L15, @r1
+dec @r5
+lea D0, L17
+not L15
+sub -469, @r1
+L21: dec @r2
+prn @r0
+clr @r0
+m2
+mov L16, L18
+dec L0
+sub @r1, @r7
+red L10
+not @r5
+dec @r3
+jsr L16
+cmp L12, 318
+add -493, @r6
+clr L12
+clr @r1
+prn @r3
+L22: prn @r3
+sub @r5, L4
+prn @r0
+rts
+dec @r6
+sub -180, L13
+bne @r4
+prn -473
+m2
+mov 443, L17
+not L1
+jmp L0
+jmp L15
+mov @r2, @r7
+jmp L3
+jmp L17
+L23: cmp L7, @r3
+rts
+dec @r1
+mov @r2, @r0
+L24: dec L5
+L25: prn L20
+jmp @r0
+jmp @r4
+not @r4
+clr L19
+prn L24
+m3
+prn L20
+jsr @r3
+prn S6
+red L2
+prn @r4
+L26: bne L0
+not L20
+rts
+sub 232, @r3
+not @r6
+red @r7
+jsr L12
+sub L9, @r7
+lea L10, L22
+not @r0
+inc L22
+L27: lea L22, @r4
+clr @r4
+dec @r1
+sub L25, L1
+sub L47, L19
+red @r5
+prn -132
+red L26
+red L10
+lea L20, L14
+m1
+clr @r4
+rts
+dec L1
+bne L22
+rts
+clr L5
+jmp @r2
+L28: bne L2
+jmp @r7
+L29: cmp -370, -125
+inc @r0
+m2
+m1
+prn L26
+rts
+L30: cmp @r6, L10
+m1
+cmp L3, @r3
+not @r0
+sub L16, L9
+prn 90
+m2
+m0
+not L18
+L31: sub 72, L1
+prn 430
+clr @r0
+prn L5
+jmp @r3
+L32: add 201, D0
+inc L9
+L33: mov D0, X1
+bne @r5
+L34: inc @r4
+m4
+inc S1
+inc L42
+dec @r2
+m3
+add L30, L13
+cmp @r7, L7
+lea L19, L34
+rts
+inc L14
+prn 179
+not @r2
+prn 28
+dec L32
+m2
+L35: jsr L3
+clr @r3
+jsr L1
+rts
+rts
+L36: dec @r7
+L37: jsr @r1
+L38: prn @r1
+m1
+m2
+m0
+m2
+red @r0
+inc L25
+sub L23, @r1
+sub L5, L50
+L39: jmp @r2
+rts
+cmp L21, @r2
+mov -82, L33
+bne L21
+prn @r2
+add @r4, @r3
+jsr @r3
+add @r7, @r3
+sub -298, L47
+jsr L12
+L40: cmp 306, L40
+jsr L20
+inc @r4
+L41: bne L4
+m1
+m3
+m1
+red @r2
+lea L30, L4
+jsr @r6
+lea L1, @r3
+bne @r0
+L42: jsr @r1
+red L23
+jsr S0
+inc D0
+L43: sub D0, X2
+lea L2, L37
+L44: prn @r5
+m1
+add @r0, L11
+jsr L55
+jmp @r3
+mov @r0, L37
+bne L45
+m0
+red @r1
+inc L16
+mov S3, @r0
+clr @r3
+cmp L4, @r1
+red L10
+red S4
+dec L19
+L45: inc @r0
+add @r4, L37
+rts
+cmp L26, 17
+cmp -329, @r3
+sub L21, L33
+not L24
+not @r7
+jmp L41
+L46: jmp L32
+bne @r1
+L47: dec L24
+dec @r2
+L48: jsr L13
+lea L2, @r7
+cmp @r6, L42
+jmp @r6
+mov L31, @r4
+dec @r5
+not @r2
+not L46
+L49: inc L29
+red L45
+lea S9, L45
+m4
+L50: jmp @r1
+mov @r6, L22
+prn L10
+cmp 223, L21
+dec @r3
+dec X3
+cmp L21, L50
+rts
+prn @r5
+L51: dec L22
+add @r0, L27
+sub 362, L43
+red L18
+not L29
+mov -75, @r7
+inc @r2
+dec @r5
+m1
+m4
+m3
+mov L53, L55
+L52: bne L39
+L53: not @r4
+clr @r0
+mov -343, L27
+lea L37, L47
+jsr L6
+mov -260, @r6
+m4
+not @r1
+jmp @r5
+L54: clr @r2
+cmp 118, 209
+red L20
+L55: red @r3
+jsr @r3
+prn 473
+jsr @r7
+lea L11, D0
+sub L34, @r0
+jsr L48
+clr @r7
+bne L23
+rts
+clr L36
+clr @r1
+L56: lea S5, @r5
+not @r1
+m1
+jmp D0
+L57: red @r4
+m3
+dec @r7
+m0
+sub 221, @r1
+red @r3
+inc S6
+dec L59
+L58: bne L59
+cmp D0, @r1
+clr L59
+clr L11
+add X4, S7
+L59: lea S9, L31
+stop
+D0: .data 121,11,-445,-88,215,127,299,383,-248,323
+D1: .data 11,378,-33,-127,-487,-174,270,-346,-64,36
+D2: .data 264,-313,38,-409,342,418,9,308,141,359
+D3: .data 15,-254,-496,-386,237,-465,402,-463,144,-16
+D4: .data -54,398,-324,-154,105,-140,-377,303,-108,186
+D5: .data -142,-26,157,424,-211,288,-472,-313,-294,-261
+D6: .data 404,399,-64,-335,-388,-293,395,-381,247,-209
+D7: .data 240,-185,481,-212,-327,313,87,141,128,200
+D8: .data -465,98,278,-77,486,415,288,218,270,-178
+D9: .data 478,274,158,-61,-413,335,253,-334,423,179
+S0: .string "cdgjj"
+S1: .string "fxvkalucafnzl"
+S2: .string "rfqymckfrlcupnzqc"
+S3: .string "hurafgicjsrymy"
+S4: .string "uhixyq"
+S5: .string "pvik"
+S6: .string "qzwlkrucrjaryzxa"
+S7: .string "fbzketukiysjiseu"
+S8: .string "hkygcezgwtyvg"
+S9: .string "xbmz"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r6
+    prn 19
+endmcro
+mcro m1
+    sub @r0, @r4
+    prn 1
+endmcro
+mcro m2
+    sub @r0, @r4
+    prn 91
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 20
+endmcro
+mcro m4
+    sub @r0, @r0
+    prn 43
+endmcro
+L0: add 131, L0
+not L0
+prn @r7
+L1: jmp @r6
+not L1
+red L0
+dec @r2
+mov 354, @r7
+dec L1
+bne L57
+sub -261, L0
+bne @r4
+mov L26, L0
+rts
+m3
+not L1
+m3
+jsr L0
+L2: lea L1, @r2
+clr @r2
+red @r2
+m3
+m1
+jmp L2
+sub @r5, @r0
+lea L1, @r0
+mov @r2, L1
+red L1
+prn @r5
+lea S7, L2
+inc L1
+L3: lea L2, @r7
+jmp L3
+mov @r5, L1
+L4: dec L1
+L5: sub @r0, L5
+prn L1
+dec L4
+jsr L1
+dec L3
+bne @r1
+dec L2
+jsr L3
+m0
+inc L4
+lea L4, L2
+add L5, L0
+not L1
+rts
+add L4, L4
+jmp @r4
+m0
+L6: rts
+dec @r2
+not @r7
+inc L0
+dec L6
+dec @r3
+jsr L3
+L7: mov -315, L3
+L8: sub -334, @r3
+jmp @r3
+add L8, @r0
+add @r1, @r2
+jsr L0
+m4
+m0
+not @r2
+L9: sub D0, @r5
+L10: rts
+lea L3, L4
+cmp -89, -82
+dec @r5
+not @r6
+inc L2
+add L12, @r3
+rts
+not @r5
+bne D0
+bne @r6
+m0
+jmp @r2
+not L8
+prn L6
+m0
+sub @r6, @r3
+L11: bne L8
+bne @r7
+sub L5, @r3
+lea L6, @r6
+jsr L0
+bne @r0
+mov @r5, @r6
+clr L5
+add -312, L10
+rts
+L12: jmp @r2
+sub @r0, @r7
+jmp L4
+L13: rts
+add @r1, L2
+add L13, @r1
+jmp D0
+rts
+inc L9
+add @r0, D0
+not @r5
+inc L2
+clr L12
+add L5, @r2
+mov L9, @r3
+clr L12
+lea L23, L9
+add 79, @r1
+inc L13
+L14: bne @r6
+mov @r7, L10
+sub L10, @r4
+inc @r2
+add -299, L9
+mov -45, L5
+L15: cmp @r0, 318
+mov @r4, @r6
+rts
+sub @r6, L4
+m4
+dec L3
+inc @r2
+L16: rts
+inc @r3
+red L9
+jmp L6
+L17: inc @r4
+not @r0
+mov L15, L9
+red @r2
+L18: rts
+red L54
+L19: dec @r5
+sub L8, L2
+m3
+dec @r6
+mov L8, L13
+rts
+clr L5
+not @r3
+mov 257, L5
+clr @r0
+m0
+L20: jsr @r1
+m0
+jmp @r3
+inc @r2
+m3
+L21: lea S9, @r2
+lea L20, L6
+L22: mov @r7, L15
+m4
+lea L22, @r1
+L23: red L8
+L24: not L7
+rts
+jsr @r2
+dec @r1
+L25: sub 265, @r5
+m2
+dec @r6
+clr L16
+lea L2, @r3
+not L19
+L26: dec L2
+jsr L10
+bne @r6
+cmp @r1, -387
+cmp -132, L1
+bne @r4
+red L21
+add @r2, L9
+mov L7, @r2
+prn L22
+prn @r7
+jmp @r3
+red @r6
+cmp L12, L19
+prn @r1
+sub L17, L1
+L27: jmp D0
+jmp L11
+not @r6
+sub L4, L26
+L28: add -388, L14
+cmp L16, -309
+add L15, L7
+clr @r7
+clr @r7
+cmp @r0, @r6
+add @r2, L4
+mov 258, L9
+L29: bne @r0
+clr L23
+sub -308, L3
+lea D0, L17
+not L11
+L30: inc L0
+m0
+L31: clr L18
+clr @r3
+add L56, @r5
+dec @r6
+mov 237, L14
+prn @r0
+red @r7
+jsr @r4
+jmp @r7
+not @r6
+bne @r1
+prn -317
+jmp @r6
+jsr L25
+bne L16
+mov @r7, L6
+jmp @r0
+lea L28, @r7
+not L9
+inc L53
+mov -209, @r5
+sub @r2, @r7
+clr L25
+m4
+m3
+sub 33, L31
+rts
+L32: inc L23
+cmp 360, -275
+dec @r6
+jmp @r0
+lea L5, L29
+m0
+sub 23, @r4
+jmp L22
+rts
+inc @r6
+cmp 203, L16
+prn 349
+L33: red L13
+bne @r1
+L34: sub L1, L10
+sub 347, @r1
+dec @r5
+sub @r0, @r0
+red L15
+m3
+m3
+jsr L1
+lea L20, @r0
+red @r7
+rts
+lea L5, L0
+mov 363, L27
+L35: clr L58
+bne @r5
+prn -391
+jmp @r4
+L36: sub -482, L29
+cmp @r0, L19
+jmp L15
+cmp @r2, -76
+add D0, L0
+not L6
+cmp @r1, L10
+not L3
+m4
+jmp @r7
+L37: add L23, L17
+lea L36, @r3
+bne @r4
+rts
+red L2
+jmp @r7
+sub L31, @r4
+dec L59
+m3
+add L0, L36
+lea L26, @r5
+inc @r4
+jmp @r4
+not L27
+clr @r7
+jmp L13
+dec @r3
+L38: sub L15, @r3
+cmp @r6, L29
+jmp L19
+jmp @r2
+sub -281, @r5
+add L2, @r6
+sub @r1, @r2
+m1
+add @r4, @r3
+inc @r3
+red @r5
+mov L46, L5
+clr L41
+sub L10, @r0
+prn @r2
+clr L38
+L39: jmp @r7
+m4
+clr L32
+add 258, D0
+cmp @r1, 188
+cmp 177, L4
+dec @r2
+clr @r7
+m0
+red @r5
+not @r5
+cmp @r6, @r5
+mov L38, @r3
+L40: mov @r5, L35
+clr @r0
+L41: jmp L57
+sub @r3, @r0
+red L20
+jmp L11
+prn @r1
+jsr L32
+jmp L48
+L42: cmp @r7, L25
+m0
+clr @r3
+rts
+jmp D0
+jsr @r1
+clr L2
+not @r4
+sub L14, @r3
+L43: prn S3
+jmp S5
+L44: lea L48, @r3
+clr @r0
+L45: rts
+red @r4
+mov @r3, @r5
+dec L16
+jmp L24
+mov 468, @r3
+red L0
+dec @r5
+sub @r6, @r0
+dec X0
+red L25
+sub 227, X1
+lea L19, @r7
+jmp @r2
+prn L45
+bne @r3
+rts
+L46: jsr L33
+red L29
+jsr L6
+m2
+rts
+m1
+red L25
+jmp @r0
+jmp L8
+m2
+jmp L32
+sub L21, L12
+jsr @r1
+L47: jsr @r2
+L48: dec L35
+dec @r6
+sub L9, L39
+rts
+L49: jmp @r6
+clr @r7
+inc @r1
+inc L46
+add L44, @r0
+not L20
+jsr L3
+red L33
+sub -276, L44
+L50: inc L3
+bne @r3
+L51: inc L4
+rts
+L52: prn @r0
+prn D0
+inc @r4
+prn @r6
+not @r3
+m1
+m3
+m2
+L53: cmp @r1, -457
+mov L44, L22
+L54: lea D0, X2
+m1
+m3
+L55: sub L57, @r1
+jsr @r3
+not @r2
+not L53
+not L44
+sub D0, @r7
+sub L26, L56
+cmp 133, -28
+jmp S0
+red L7
+jsr D0
+prn @r4
+m4
+lea L17, @r6
+sub @r7, L24
+dec L23
+not S6
+L56: red L43
+m1
+sub L16, @r7
+mov @r3, L1
+mov L42, @r5
+sub S0, @r4
+jmp @r5
+jsr @r4
+m1
+dec L58
+bne @r2
+cmp 243, D0
+L57: red @r0
+rts
+not @r5
+mov 290, X3
+L58: cmp X4, 193
+clr L32
+jsr L26
+L59: rts
+dec D0
+stop
+D0: .data -144,259,27,254,321,-492,436,-407,359,175
+D1: .data -17,215,-76,-45,-352,-471,-428,478,-386,284
+D2: .data 306,119,-28,-76,-267,427,461,-27,392,-273
+D3: .data 423,-382,480,-184,46,-355,189,335,398,277
+D4: .data 282,-217,-29,-445,-493,95,-482,179,450,-260
+D5: .data 477,-105,155,229,-75,487,314,6,494,-290
+D6: .data 264,-299,197,-6,111,-185,-177,-235,-424,-172
+D7: .data 196,-350,189,236,-415,479,-270,-434,-397,-45
+D8: .data 179,-61,305,-130,150,23,461,352,335,313
+D9: .data -496,-427,-52,470,-158,234,205,194,395,77
+S0: .string "soug"
+S1: .string "wdxclhknmpfhy"
+S2: .string "rkyuvloyxwrtaqj"
+S3: .string "c"
+S4: .string "upfjtxn"
+S5: .string "blhyg"
+S6: .string "cg"
+S7: .string "tvyvdhwxu"
+S8: .string "hbo"
+S9: .string "jtg"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r0
+    prn 89
+endmcro
+mcro m1
+    sub @r4, @r5
+    prn 0
+endmcro
+mcro m2
+    sub @r2, @r1
+    prn 57
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 96
+endmcro
+mcro m4
+    sub @r2, @r6
+    prn 0
+endmcro
+dec @r2
+m1
+mov L0, L40
+jmp L0
+m4
+mov -219, L0
+rts
+L0: add 422, @r4
+not @r2
+prn -28
+L1: inc @r3
+bne @r0
+sub L1, @r1
+sub @r7, L0
+cmp 261, 302
+sub 410, @r4
+not @r4
+m0
+not @r4
+bne @r4
+sub @r1, L0
+dec L0
+L2: prn @r4
+sub L1, L1
+cmp @r4, @r0
+sub @r6, L2
+L3: prn @r3
+rts
+inc L3
+cmp @r1, S9
+bne L3
+m4
+lea L1, @r2
+m3
+bne L3
+not L1
+lea L3, L0
+L4: mov L0, @r5
+rts
+sub S5, L2
+L5: not @r1
+cmp L24, L5
+mov L5, @r7
+jmp @r2
+mov 481, @r1
+add S5, @r4
+mov 99, @r3
+cmp @r4, L3
+prn L1
+rts
+dec L0
+add L4, L5
+sub L1, @r2
+red @r1
+m0
+m4
+L6: dec L6
+dec @r3
+jmp L5
+mov L57, L4
+bne @r3
+m2
+dec @r0
+mov 22, L1
+inc L4
+rts
+bne @r3
+bne S1
+sub 483, L2
+mov @r4, @r5
+clr L2
+m3
+jsr @r6
+L7: bne @r5
+jsr L1
+rts
+add @r4, @r6
+rts
+m2
+jsr L4
+L8: red @r6
+add 132, L1
+not L5
+bne L5
+mov @r1, @r4
+bne @r0
+sub L2, L8
+lea X0, L6
+clr @r3
+mov @r5, @r2
+prn @r6
+red L6
+L9: inc L7
+not @r0
+L10: add @r7, L10
+jmp @r2
+m3
+m3
+lea L4, L0
+rts
+rts
+lea L7, L0
+m2
+not @r5
+L11: jmp L1
+not @r6
+jsr L11
+red L6
+sub L0, L4
+L12: inc L5
+inc L7
+prn -386
+lea L10, @r3
+L13: dec L0
+dec L2
+clr @r2
+inc @r6
+clr @r0
+add @r5, L48
+L14: mov @r2, L3
+clr @r3
+lea L10, @r5
+mov @r7, @r6
+clr @r5
+jsr L9
+lea L2, @r6
+red @r3
+jmp @r7
+L15: add -403, @r3
+inc L12
+mov @r1, @r7
+rts
+inc @r2
+not @r2
+rts
+rts
+cmp @r6, @r4
+sub L1, L15
+sub -160, @r6
+lea L3, L5
+jmp L5
+L16: jsr @r2
+jmp L51
+sub @r3, @r0
+lea L1, @r4
+m2
+prn -266
+red L16
+prn L12
+lea L0, @r7
+add @r2, L6
+inc L7
+red L3
+L17: jmp L12
+not @r2
+bne @r3
+add -205, @r2
+lea L2, L8
+jsr @r0
+jmp S6
+mov L4, L15
+L18: add -254, @r1
+bne @r2
+mov @r2, L12
+lea L12, L11
+prn @r6
+lea L9, L59
+add L1, @r6
+inc L11
+dec L17
+L19: jmp L5
+red @r6
+L20: rts
+rts
+L21: mov L16, @r5
+clr L10
+lea L9, L9
+mov -491, L8
+inc @r0
+L22: clr @r0
+L23: lea L23, L2
+rts
+not L8
+red @r7
+bne @r0
+lea L17, @r4
+m2
+L24: bne L23
+red L16
+sub -235, L16
+L25: clr @r0
+L26: prn @r0
+red @r7
+rts
+L27: prn L5
+m0
+sub @r6, L22
+bne @r1
+m0
+L28: lea L42, L4
+L29: mov -362, L16
+sub @r0, D0
+dec L26
+m2
+red @r4
+jsr L4
+add L12, L2
+jmp L33
+red L4
+prn 218
+jmp L13
+L30: dec @r3
+m1
+rts
+m1
+bne L4
+mov -248, @r4
+jmp @r4
+red @r1
+red L29
+jsr L11
+red L14
+jmp L11
+mov 95, L48
+inc @r3
+rts
+dec @r3
+mov L16, L12
+add @r1, L17
+sub @r5, @r7
+L31: prn 441
+bne L14
+cmp L31, @r5
+sub 358, @r0
+mov @r7, L1
+clr L21
+mov @r1, L24
+dec L27
+L32: lea L22, @r6
+bne S7
+mov @r3, @r7
+prn -283
+clr @r7
+sub L5, L14
+add @r5, @r3
+cmp 55, -409
+jmp @r6
+sub @r2, @r6
+sub L15, L19
+bne @r6
+L33: sub L11, L24
+dec @r6
+inc @r2
+L34: bne @r1
+rts
+L35: prn L16
+jmp @r0
+prn L41
+jsr L12
+dec L1
+clr L3
+cmp @r3, L35
+prn -400
+prn L12
+not L25
+not L13
+jsr L32
+lea L3, @r5
+mov @r7, L13
+rts
+L36: cmp 432, @r6
+inc @r3
+L37: jsr @r7
+dec @r3
+L38: rts
+L39: cmp -402, @r5
+inc L23
+L40: dec L27
+jsr @r5
+add @r2, L12
+prn @r7
+L41: inc L25
+lea L37, L0
+jsr L27
+m1
+red L19
+clr L38
+mov L0, @r3
+prn D0
+jmp @r4
+mov L30, L0
+dec @r0
+L42: mov 67, @r1
+not L19
+cmp @r2, -422
+m0
+prn L41
+m0
+clr L28
+inc @r5
+prn @r6
+sub L26, L36
+cmp L36, @r1
+m0
+lea L6, L26
+cmp L22, L34
+prn @r1
+add @r4, L3
+jsr L21
+dec L22
+add L19, L22
+not L24
+not L21
+rts
+bne @r1
+not D0
+clr L10
+cmp L30, L36
+dec @r1
+red @r1
+jsr L7
+m1
+dec L39
+not L33
+inc @r2
+lea L12, L39
+L43: rts
+lea L38, L5
+not @r1
+m1
+prn @r1
+rts
+m2
+bne L16
+L44: mov @r4, @r2
+bne @r0
+rts
+bne @r0
+cmp X1, L18
+m4
+bne L43
+bne L28
+lea L55, @r5
+clr L17
+mov L44, @r3
+not @r2
+L45: sub S3, @r2
+L46: prn L46
+lea L13, @r4
+add 297, L26
+bne @r4
+cmp L36, -379
+m4
+L47: add L33, L23
+lea L23, @r4
+cmp 128, @r0
+not X2
+L48: add L28, @r3
+not @r4
+m1
+L49: cmp 137, @r5
+red L26
+red @r0
+L50: clr L53
+prn L43
+mov @r6, S8
+red @r2
+cmp X3, @r4
+not L59
+cmp L18, @r3
+jsr @r6
+sub L24, L4
+mov -401, L47
+inc @r5
+L51: clr @r7
+m4
+m4
+jsr L15
+mov 56, @r2
+bne @r6
+prn @r0
+cmp @r0, @r0
+jmp D0
+not @r5
+mov -322, L48
+sub 158, L50
+m4
+bne L20
+clr L50
+inc L5
+m3
+rts
+L52: not L28
+red L22
+jmp L45
+not L15
+not @r0
+lea L59, @r3
+dec @r4
+inc @r4
+prn 217
+sub D0, L55
+jmp @r6
+L53: red @r2
+L54: clr @r2
+bne @r1
+rts
+red L0
+jsr L20
+cmp @r0, L10
+m0
+m2
+not @r2
+not L56
+red L16
+dec @r4
+L55: mov L58, @r1
+m0
+bne @r5
+rts
+sub L6, L57
+bne @r4
+L56: dec @r6
+not @r5
+L57: jmp D0
+red X4
+cmp 141, @r6
+sub @r6, @r3
+dec L9
+m3
+red @r0
+m0
+bne L58
+L58: not S7
+m2
+prn D0
+rts
+L59: jmp D0
+red D0
+dec D0
+stop
+D0: .data -271,380,195,289,-388,480,251,-84,-13,-48
+D1: .data -229,97,497,-256,-159,-125,132,17,30,-282
+D2: .data -436,92,-222,213,188,499,32,90,138,476
+D3: .data 159,144,97,-95,-222,-36,325,-244,-429,-34
+D4: .data 450,16,-308,-379,201,244,228,-351,-366,-320
+D5: .data 196,96,-424,292,-218,-316,444,-256,-116,-27
+D6: .data -265,-406,130,-430,42,-282,-491,-311,-193,-135
+D7: .data -222,130,62,-12,-84,150,0,215,-69,495
+D8: .data -22,-223,-106,316,380,111,473,-303,429,227
+D9: .data -389,-363,-468,-421,280,68,-267,118,-454,-73
+S0: .string "lxncn"
+S1: .string "xvw"
+S2: .string "bcwarlesk"
+S3: .string "mnqrzzojky"
+S4: .string "cbyrerjeuobojgdyxnyf"
+S5: .string "ybjiqb"
+S6: .string "calzsambdtowzal"
+S7: .string "yigrbtid"
+S8: .string "cmovmxppoivxytbxrxu"
+S9: .string "jptdmaaieexfsnjbm"
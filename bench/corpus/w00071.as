@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r3
+    prn 27
+endmcro
+mcro m1
+    sub @r0, @r7
+    prn 98
+endmcro
+mcro m2
+    sub @r4, @r7
+    prn 22
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 72
+endmcro
+mcro m4
+    sub @r4, @r4
+    prn 24
+endmcro
+jsr L0
+add L51, @r6
+L0: jmp L0
+jsr L0
+dec L0
+bne L0
+mov @r2, L0
+lea L0, @r5
+not @r7
+m1
+rts
+add @r2, L0
+sub -398, @r2
+jmp @r6
+red @r0
+not @r4
+L1: mov L1, L0
+clr L0
+L2: rts
+m3
+inc @r1
+mov @r5, @r6
+lea X0, L0
+not @r0
+m3
+dec L0
+rts
+m2
+sub -48, @r7
+lea L1, @r7
+clr @r4
+m3
+jsr L0
+prn @r3
+bne @r7
+dec L1
+L3: red @r1
+m0
+L4: prn L3
+prn L1
+dec @r0
+L5: red L3
+clr L2
+red L10
+cmp @r1, @r7
+red @r5
+dec @r5
+not @r0
+bne L3
+cmp L4, @r6
+jsr @r3
+jmp @r0
+jsr @r3
+L6: add @r3, L4
+sub @r6, @r2
+m4
+cmp D0, L6
+rts
+sub L0, @r5
+red L4
+jsr L3
+bne L1
+prn -183
+prn @r6
+m3
+dec @r7
+clr @r4
+m0
+m1
+lea L0, @r2
+m1
+prn L5
+not L4
+L7: jsr L4
+inc L7
+inc L6
+L8: dec @r0
+red @r7
+sub @r7, @r2
+dec @r0
+add 55, @r0
+not @r3
+cmp L4, -76
+mov 194, L3
+sub @r1, @r6
+prn S1
+cmp S3, -16
+sub @r6, L1
+add @r7, @r0
+dec @r3
+inc L1
+lea S0, S2
+not L4
+prn 437
+jsr @r6
+rts
+mov @r0, @r7
+red @r1
+bne L4
+sub L6, D0
+clr @r1
+L9: jsr @r2
+jmp L2
+L10: jmp @r3
+add 445, @r2
+clr @r2
+clr L3
+add L4, @r3
+lea L0, @r6
+prn -392
+rts
+inc L6
+clr @r4
+lea L5, L9
+red @r3
+m3
+m4
+rts
+lea L49, @r0
+jmp @r7
+m4
+red @r6
+L11: mov 201, L7
+jsr L10
+prn L6
+L12: prn L3
+dec X1
+sub -447, @r2
+clr @r7
+bne L2
+jsr L13
+bne L9
+jmp @r6
+inc @r7
+dec @r4
+m1
+sub @r3, @r1
+rts
+prn 310
+jmp @r3
+red @r3
+add @r7, L5
+mov @r7, L1
+rts
+not @r7
+L13: sub L8, L5
+not @r1
+red L9
+mov L12, @r4
+dec L9
+dec @r3
+dec L10
+m3
+lea L6, @r4
+cmp -79, 91
+lea L6, L8
+L14: add -333, @r3
+L15: rts
+rts
+m0
+red @r4
+L16: rts
+L17: not L7
+not @r5
+L18: jmp @r2
+cmp @r3, @r0
+red L17
+dec L13
+m2
+m3
+m3
+prn 171
+m4
+inc @r7
+bne L15
+L19: mov L4, L3
+red @r2
+bne L0
+mov L15, @r1
+red D0
+add 158, L27
+not L8
+sub @r2, L7
+L20: rts
+inc @r5
+m2
+mov @r6, L14
+dec L7
+m4
+mov -143, @r5
+L21: add 390, @r0
+inc @r0
+cmp @r5, @r6
+m3
+cmp L13, L6
+L22: jmp @r0
+lea L18, L0
+jmp @r1
+jsr L10
+jsr L2
+bne L19
+bne L19
+dec L16
+rts
+jmp @r4
+add L7, @r6
+L23: dec L22
+red L6
+jsr @r0
+m3
+mov L10, L19
+red @r7
+red L3
+not L13
+lea L16, L2
+not L19
+sub @r5, L0
+cmp @r4, 147
+m0
+add @r5, @r0
+rts
+dec L23
+L24: jsr @r3
+inc @r0
+red L15
+L25: not @r0
+sub -398, L6
+red L24
+jmp L25
+clr L23
+bne L20
+add L7, S1
+sub @r5, @r5
+sub 181, L16
+bne L19
+clr @r2
+inc @r0
+inc @r6
+m0
+rts
+L26: dec L19
+m1
+mov L5, @r7
+jsr L37
+clr L24
+inc @r3
+prn @r4
+not @r2
+L27: not L26
+sub L27, @r7
+L28: lea L17, L48
+sub 36, L6
+L29: bne @r0
+add 479, @r5
+mov @r3, @r7
+dec @r5
+dec @r7
+inc @r5
+L30: red L30
+dec @r2
+red L29
+L31: not @r7
+L32: prn @r2
+mov L29, L5
+jmp D0
+prn L3
+L33: add @r3, @r3
+add -317, @r5
+rts
+lea L31, L30
+jmp @r4
+not L33
+clr L32
+rts
+cmp L15, @r1
+L34: dec L3
+prn L28
+rts
+m3
+dec L21
+cmp 176, @r5
+dec @r1
+mov -420, @r7
+sub 178, @r5
+L35: clr L54
+mov 326, L0
+m2
+rts
+jmp L8
+inc @r1
+m4
+rts
+L36: rts
+add 222, L14
+m4
+sub L3, @r0
+dec @r1
+add @r5, L5
+red @r5
+L37: cmp -268, 108
+bne @r3
+m1
+inc L14
+rts
+bne L20
+red L13
+jsr L42
+L38: bne @r3
+lea L35, @r4
+L39: inc @r0
+dec @r2
+m0
+dec L55
+rts
+dec L15
+cmp -161, L37
+add @r4, @r6
+dec L59
+add L30, L33
+dec L50
+add @r2, @r6
+rts
+lea L21, L26
+L40: rts
+prn @r1
+L41: not L39
+red @r0
+clr L32
+dec @r5
+L42: rts
+dec L30
+L43: rts
+m4
+add 159, @r1
+not L28
+rts
+sub L5, D0
+prn 175
+jsr @r3
+inc @r1
+jmp @r6
+L44: add L20, D0
+jsr @r7
+jsr @r4
+add @r0, L32
+sub L31, S8
+inc @r4
+bne @r4
+add L15, @r0
+sub L12, L46
+sub -270, @r5
+jmp @r4
+prn @r4
+not L12
+L45: lea L4, L7
+prn L20
+jsr L57
+cmp @r5, L25
+add L9, @r6
+L46: clr @r4
+prn @r3
+add X2, L26
+add L30, @r5
+rts
+inc L28
+cmp @r7, L21
+mov S7, @r4
+inc @r3
+rts
+rts
+lea L16, L37
+bne @r4
+L47: prn @r1
+L48: sub -434, L34
+clr @r3
+bne @r1
+prn L55
+inc @r5
+jsr L57
+L49: cmp L45, 332
+bne L48
+lea X3, @r4
+prn L32
+dec L46
+sub -467, @r0
+inc @r2
+cmp L22, @r3
+red L36
+m2
+lea L10, @r2
+sub L2, @r7
+dec @r2
+add @r0, @r6
+sub @r0, S0
+inc @r6
+add -338, L51
+L50: cmp 32, -80
+dec L3
+L51: sub 28, L1
+jmp @r1
+lea L0, @r2
+L52: mov -128, L50
+clr L3
+not @r0
+rts
+not @r1
+add L45, @r2
+rts
+jmp @r1
+cmp -104, @r5
+mov -324, S4
+L53: red @r0
+L54: sub @r6, L46
+inc @r4
+not X4
+mov @r6, L40
+red L25
+clr L30
+L55: inc @r7
+L56: not L42
+sub @r5, @r4
+bne @r1
+m0
+prn -206
+lea L58, @r2
+clr @r3
+L57: lea L59, L16
+lea L41, L19
+m2
+jsr L58
+clr S9
+cmp L5, L10
+L58: jmp @r4
+bne @r2
+L59: dec @r6
+inc @r4
+lea S8, @r0
+m0
+m4
+bne D0
+stop
+D0: .data 159,-382,-320,-235,341,383,454,496,-281,124
+D1: .data -415,-77,-463,73,-214,-57,365,222,51,-374
+D2: .data -43,-90,424,62,-459,-285,-73,-337,255,-116
+D3: .data -286,-202,-470,-162,-286,103,6,363,-407,-389
+D4: .data 342,-496,-227,252,203,397,96,313,-333,-439
+D5: .data 285,-27,-120,-112,498,142,-202,267,-196,-73
+D6: .data -95,-416,-302,-372,-75,-50,-283,-88,-325,-396
+D7: .data 390,-188,-397,35,78,249,-8,-23,-484,61
+D8: .data -393,-65,469,136,-479,-19,-478,-357,-261,-200
+D9: .data -343,63,271,-227,-160,153,178,-213,419,41
+S0: .string "kpl"
+S1: .string "hkodfysrzapebnicejs"
+S2: .string "koyrgiravtyf"
+S3: .string "f"
+S4: .string "vfluppihxhihnqhaqdnr"
+S5: .string "ewdhkblpyvu"
+S6: .string "eqpugqjoqijuldzooguk"
+S7: .string "zm"
+S8: .string "ysjklagtytz"
+S9: .string "wceqoty"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r5
+    prn 98
+endmcro
+mcro m1
+    sub @r5, @r0
+    prn 97
+endmcro
+mcro m2
+    sub @r6, @r5
+    prn 19
+endmcro
+mcro m3
+    sub @r2, @r1
+    prn 17
+endmcro
+mcro m4
+    sub @r6, @r3
+    prn 49
+endmcro
+lea L0, @r7
+add @r0, @r4
+red L0
+add @r6, L0
+m2
+clr @r2
+L0: add L0, L0
+sub L0, @r0
+lea L0, @r4
+L1: lea L0, @r5
+mov @r7, L0
+sub -436, @r1
+clr L1
+jmp @r6
+m2
+L2: mov L1, L1
+clr L0
+jmp L0
+red L47
+prn @r4
+not L1
+L3: lea L2, @r6
+L4: clr @r0
+sub 122, @r5
+clr @r3
+mov @r4, @r5
+add L0, @r7
+m3
+L5: jmp @r4
+inc @r5
+m4
+lea L1, @r7
+rts
+dec S9
+L6: bne L6
+jmp L1
+inc @r6
+L7: rts
+clr @r1
+L8: add L7, L5
+jsr @r2
+inc @r1
+clr L2
+dec L8
+m1
+inc L6
+jsr L2
+L9: rts
+rts
+m1
+rts
+jmp @r4
+m4
+m3
+L10: mov @r5, L5
+add -50, L5
+jsr @r7
+bne L10
+m4
+jsr @r7
+sub L3, @r6
+m0
+clr L5
+sub @r6, L10
+m2
+prn 135
+bne L0
+bne L4
+jsr L5
+add L0, @r5
+L11: mov -62, L8
+jmp @r2
+jsr L7
+m4
+jsr @r4
+not L10
+lea L8, L7
+bne L0
+dec @r2
+jmp L3
+rts
+m1
+add @r1, @r6
+L12: mov L3, L8
+not X0
+jmp @r2
+m2
+mov @r1, @r0
+cmp 365, L7
+L13: cmp L12, -185
+L14: inc L12
+jmp L16
+not L13
+bne L14
+clr @r2
+m2
+jsr L3
+sub -431, @r2
+mov @r2, @r7
+m3
+prn @r3
+cmp L13, 361
+rts
+m0
+L15: sub @r4, @r0
+prn @r5
+sub L0, L5
+prn 492
+L16: cmp @r1, @r5
+cmp -142, -25
+cmp L4, L4
+jsr L11
+L17: rts
+lea L43, @r3
+cmp @r5, @r1
+sub L17, @r4
+m0
+add L1, @r2
+bne L17
+L18: inc L13
+red @r0
+prn @r0
+jsr @r7
+L19: inc @r1
+add L19, L11
+L20: not @r1
+L21: jsr L20
+not @r4
+not @r4
+add @r7, L15
+lea L11, L21
+m4
+L22: jsr @r4
+inc L15
+jsr L22
+jmp L7
+add 474, @r3
+L23: bne @r3
+dec @r5
+cmp @r0, L10
+L24: sub L12, L18
+rts
+mov L6, @r1
+mov L17, L35
+red @r0
+dec @r1
+L25: clr @r6
+L26: clr @r4
+m1
+L27: mov 461, L8
+mov 503, @r4
+not L3
+red L10
+m2
+L28: inc @r7
+add @r3, L14
+m1
+sub L9, @r5
+m1
+add @r2, S6
+add 406, L44
+not L14
+m3
+red L0
+cmp L7, 361
+mov @r1, L11
+red L6
+clr @r7
+L29: red @r5
+cmp L5, L14
+L30: dec @r3
+sub L30, @r4
+jmp @r4
+lea L1, L21
+m1
+dec L12
+jsr @r6
+bne L21
+jsr X1
+L31: prn L23
+dec L58
+red @r7
+inc @r0
+m1
+jsr L13
+not @r0
+clr @r6
+inc @r4
+add L49, L9
+lea L6, @r0
+cmp @r1, @r3
+red @r2
+dec @r0
+clr @r4
+sub L7, L20
+bne @r2
+sub L45, L39
+clr @r2
+bne @r0
+jmp @r7
+prn L29
+inc L21
+m4
+clr @r0
+jmp @r2
+L32: cmp L11, @r5
+cmp L16, @r6
+m0
+red L18
+cmp 12, L14
+clr @r5
+inc L1
+L33: mov -435, @r2
+lea L23, @r1
+cmp -154, S7
+not L9
+jmp @r4
+mov X2, @r5
+rts
+not L16
+L34: rts
+bne @r3
+L35: add @r3, @r6
+L36: prn 390
+L37: cmp -337, @r6
+m4
+not @r2
+jsr @r2
+sub @r6, @r4
+bne @r1
+bne L37
+dec L34
+sub L38, L26
+lea L0, @r0
+cmp D0, L1
+dec X3
+cmp L28, -218
+bne L14
+not @r7
+cmp L14, L3
+red @r1
+clr @r1
+clr L20
+L38: add L23, L2
+jmp S2
+clr @r5
+rts
+dec @r4
+bne L12
+bne L13
+L39: not L7
+red L38
+m0
+L40: rts
+jmp @r0
+cmp -508, 1
+rts
+jsr @r6
+L41: jmp @r4
+rts
+rts
+lea D0, @r5
+m1
+jsr L15
+clr L21
+L42: jmp X4
+lea L12, L37
+inc @r5
+jmp L15
+L43: dec @r1
+lea L38, @r0
+dec L7
+rts
+prn @r7
+L44: sub L16, @r2
+cmp -4, @r6
+mov @r5, @r6
+rts
+clr L11
+add @r1, L20
+sub @r6, @r7
+bne L26
+not L13
+add @r0, L7
+m3
+prn @r7
+lea L10, @r2
+dec @r0
+rts
+L45: cmp @r2, L47
+lea L2, @r1
+jsr @r7
+not L18
+bne L25
+lea L45, L2
+L46: dec L30
+mov @r6, @r3
+lea L24, @r4
+m4
+sub -76, L33
+cmp 477, L28
+sub @r2, @r5
+jsr L33
+L47: inc L0
+lea L27, L55
+jmp @r3
+red L51
+cmp -49, @r7
+dec L7
+inc @r4
+L48: not @r6
+dec S9
+rts
+add -293, @r7
+not @r5
+red D0
+lea L4, @r2
+clr L13
+sub -408, @r0
+clr D0
+inc @r3
+clr @r7
+jmp L2
+sub 205, L30
+dec L5
+L49: bne @r4
+add @r2, L8
+cmp L32, @r1
+rts
+jmp @r2
+L50: rts
+clr @r6
+not @r7
+mov L49, D0
+prn -447
+add L4, L50
+jsr @r0
+jmp @r0
+L51: add L19, @r0
+red L38
+bne L1
+jsr @r6
+cmp -405, @r0
+jmp L16
+jsr L52
+prn L21
+prn @r4
+bne @r4
+mov 461, L14
+not S7
+dec @r7
+mov -477, @r6
+prn @r0
+lea S2, L10
+not L6
+L52: add L37, @r4
+bne @r2
+mov L48, D0
+sub -355, D0
+add @r4, L5
+add L23, @r1
+inc L20
+lea L26, @r3
+cmp L55, L5
+jsr @r7
+cmp L0, -306
+not @r1
+lea L5, @r0
+clr @r3
+L53: jmp @r5
+bne @r3
+bne @r7
+prn 28
+L54: prn D0
+rts
+mov @r0, @r3
+bne @r4
+clr @r5
+not L47
+m3
+inc @r5
+L55: sub @r2, @r1
+jmp @r3
+jsr L35
+bne @r6
+dec @r5
+clr @r2
+bne @r5
+mov @r4, L16
+cmp L31, L9
+sub L59, S9
+clr @r4
+m3
+cmp L39, L15
+L56: mov @r5, @r1
+L57: sub L36, L50
+m0
+mov L1, @r2
+jsr @r7
+prn 69
+mov L59, @r0
+m3
+jmp L30
+not D0
+jmp L20
+sub @r2, L2
+mov @r4, @r7
+clr L43
+rts
+L58: jmp @r4
+sub 292, L9
+red @r0
+inc @r2
+rts
+rts
+inc L35
+add @r5, L34
+m0
+jmp @r6
+mov L50, L8
+not D0
+prn 132
+jmp L48
+lea L22, @r4
+mov 196, @r1
+lea L59, L34
+rts
+jsr L35
+jmp @r1
+prn L12
+mov S6, @r3
+inc L59
+L59: jmp @r4
+sub L4, @r0
+dec L14
+m3
+m2
+rts
+dec D0
+lea D0, @r3
+stop
+D0: .data -124,123,-385,274,415,-264,263,415,109,471
+D1: .data -261,339,-406,427,-494,-13,-18,-475,352,-268
+D2: .data 197,-283,-183,-457,84,478,485,309,182,141
+D3: .data -36,-239,250,420,-407,47,-33,36,-469,236
+D4: .data -322,-92,288,356,-322,394,53,-35,68,435
+D5: .data -461,-327,371,273,357,418,224,-139,-299,383
+D6: .data -57,-126,-12,-380,66,443,1,225,-474,-431
+D7: .data -422,310,-472,-248,172,296,-191,-212,-334,100
+D8: .data 383,-214,-177,488,-28,70,-170,391,-50,299
+D9: .data -30,-499,-170,296,-472,355,213,129,-454,486
+S0: .string "tqbjwsdaorrvsxaj"
+S1: .string "vtprgtafqdbedi"
+S2: .string "hnohpfnrjftipvduiqj"
+S3: .string "rghkwbhza"
+S4: .string "zolnupulbzcepxlih"
+S5: .string "bsymnbmdcpbpegmpe"
+S6: .string "on"
+S7: .string "xdzeubutd"
+S8: .string "prwbgjx"
+S9: .string "kybdvwrpfercivr"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r0
+    prn 36
+endmcro
+mcro m1
+    sub @r1, @r1
+    prn 95
+endmcro
+mcro m2
+    sub @r0, @r3
+    prn 85
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 93
+endmcro
+mcro m4
+    sub @r0, @r1
+    prn 73
+endmcro
+bne @r4
+jsr L0
+L0: red L0
+lea L0, L0
+sub @r4, S3
+L1: rts
+cmp L1, 87
+not L1
+red L0
+clr @r0
+lea L1, @r6
+not L1
+not L1
+jsr L1
+sub L1, @r7
+red L22
+red @r5
+clr @r2
+m2
+jmp @r1
+red L0
+inc @r0
+not L0
+jsr @r4
+clr S1
+jsr L1
+bne @r2
+inc @r1
+prn L1
+jsr L1
+jsr @r5
+not @r0
+cmp 142, @r0
+bne L1
+m1
+red @r3
+not L0
+jsr @r7
+lea L1, @r1
+jmp L0
+bne L1
+lea L0, L0
+mov -416, @r2
+L2: lea L1, @r7
+sub 22, @r2
+bne S9
+m0
+bne @r4
+cmp @r1, @r1
+sub 475, @r1
+not @r1
+prn L0
+add @r3, @r4
+prn L2
+cmp -433, @r1
+lea L0, @r2
+inc @r6
+L3: cmp L1, L54
+add L3, @r3
+L4: jmp L0
+m1
+rts
+not L1
+L5: not L0
+dec @r7
+clr D0
+m3
+L6: jmp @r2
+lea L3, @r0
+cmp L2, @r4
+L7: add L0, @r1
+prn L4
+jsr @r7
+cmp L2, @r2
+add @r0, L0
+m1
+sub @r4, L1
+sub L3, L4
+L8: jsr L7
+red L2
+dec L8
+L9: prn L8
+lea L5, L3
+prn @r1
+dec L1
+L10: not L4
+L11: lea L9, L8
+clr L10
+L12: prn L6
+mov @r2, L1
+not L8
+bne @r4
+rts
+m0
+m3
+m0
+m2
+prn L0
+jsr L9
+L13: jmp D0
+cmp 306, -109
+not L9
+clr @r4
+rts
+inc @r4
+add @r5, @r0
+not @r7
+L14: jmp L8
+mov @r0, @r0
+m2
+prn @r4
+prn @r1
+bne L11
+m2
+m2
+mov L0, @r4
+bne @r5
+lea L8, @r7
+dec L11
+red L4
+m3
+mov @r7, @r1
+m1
+cmp L3, @r1
+red L27
+sub L4, @r4
+jsr L3
+cmp @r5, @r4
+dec @r0
+jmp @r2
+jmp @r0
+sub @r6, @r6
+lea L14, L14
+not @r1
+add @r5, @r1
+dec L11
+mov 276, S9
+L15: prn 265
+add @r2, L14
+sub -447, @r7
+red @r3
+L16: sub @r0, S0
+dec @r2
+bne L16
+jsr L11
+dec L5
+L17: add @r6, @r7
+m4
+cmp @r3, L9
+add @r5, @r3
+dec L0
+jmp @r6
+rts
+L18: mov L38, L3
+bne L7
+sub @r7, @r4
+jsr L5
+clr @r6
+jsr S7
+lea L4, L1
+jmp L23
+red L10
+inc L14
+jmp L5
+jsr L6
+red @r5
+add L4, S5
+jmp @r1
+L19: sub @r1, L19
+mov 254, L10
+lea L19, L13
+cmp 150, L5
+dec @r0
+dec @r2
+cmp -138, -209
+sub L12, L7
+red @r2
+sub 416, L11
+inc L3
+clr @r4
+L20: red @r6
+dec @r4
+add 430, @r3
+bne @r7
+dec @r4
+mov 369, @r6
+rts
+m4
+inc L3
+sub D0, L13
+inc @r3
+bne L11
+lea L2, L56
+red @r1
+sub @r1, L19
+inc L18
+inc @r4
+sub @r2, @r2
+red L57
+not @r7
+add @r6, @r3
+inc L3
+jmp D0
+mov @r2, L3
+not L13
+inc @r0
+prn X0
+cmp @r2, -19
+dec @r2
+L21: add -256, @r5
+m3
+m1
+mov 134, L10
+inc L37
+L22: dec @r4
+cmp L11, @r2
+bne L39
+prn L8
+cmp 255, L5
+not L11
+L23: rts
+red @r5
+clr @r5
+red L3
+prn @r5
+not @r4
+bne L22
+m1
+sub L1, @r5
+m1
+L24: lea L24, @r0
+L25: inc @r5
+mov L8, @r7
+lea L5, @r7
+mov @r2, L25
+bne L22
+add @r6, @r5
+jsr @r3
+jsr @r7
+dec L14
+rts
+cmp D0, L23
+L26: dec @r4
+m0
+clr L11
+dec L7
+L27: lea L1, L19
+bne L23
+add @r6, L9
+m2
+lea L15, L10
+jsr L19
+m0
+cmp @r4, S4
+L28: rts
+cmp @r7, @r1
+clr @r0
+bne L8
+cmp -37, 58
+not L18
+L29: mov @r2, L22
+L30: lea L30, @r1
+L31: mov L10, L29
+clr @r6
+m3
+m2
+L32: rts
+red @r2
+cmp @r0, L39
+prn 218
+bne @r2
+clr @r0
+not L6
+mov 47, L16
+jmp L14
+L33: clr @r6
+m0
+prn @r0
+L34: add @r0, L33
+jsr L7
+m4
+inc @r5
+bne L12
+mov @r3, L4
+inc @r3
+m0
+rts
+lea L20, @r1
+cmp -192, @r3
+dec L27
+not @r1
+not @r5
+sub -353, D0
+jmp @r2
+m4
+bne L22
+jsr @r4
+mov @r1, L16
+prn L31
+m1
+sub L15, L4
+not L51
+not L13
+inc L7
+m2
+lea L55, @r4
+lea L2, L28
+L35: clr @r5
+m0
+inc @r5
+L36: rts
+not @r7
+dec L10
+L37: clr @r1
+add -443, L28
+L38: cmp -348, @r5
+L39: jmp @r6
+prn -343
+rts
+mov @r2, L23
+sub @r2, @r3
+add X1, L34
+L40: clr L26
+m4
+red @r4
+L41: jsr @r1
+bne @r6
+prn L22
+L42: jsr @r4
+prn @r0
+prn @r4
+inc L16
+add -485, @r0
+red L10
+red L8
+red @r4
+add 439, L33
+L43: rts
+jsr @r5
+L44: mov @r0, @r7
+clr L12
+jsr L44
+inc @r4
+L45: jmp L28
+prn @r1
+L46: red @r3
+mov @r5, @r1
+cmp L24, @r5
+bne @r1
+jmp S6
+dec @r1
+add 360, @r7
+L47: bne @r0
+rts
+L48: clr L57
+bne D0
+cmp 137, L32
+lea L34, @r6
+cmp L7, @r6
+L49: rts
+bne L6
+dec @r0
+sub L6, L43
+bne @r5
+bne @r2
+jsr L4
+dec L27
+bne L28
+L50: red @r4
+sub L50, @r4
+m2
+lea L24, @r0
+rts
+jsr @r3
+clr L14
+L51: jmp @r7
+dec @r5
+add 291, @r3
+not L18
+mov X2, @r0
+sub L31, @r6
+bne @r0
+jsr @r0
+L52: jmp @r3
+prn @r2
+clr L17
+jsr @r6
+m1
+clr @r0
+add L49, @r5
+bne L25
+prn L47
+not L35
+dec L38
+cmp @r1, @r4
+inc @r4
+cmp @r4, 277
+m1
+inc L18
+mov 175, X3
+inc @r6
+dec @r6
+rts
+L53: add @r7, L56
+prn -255
+rts
+dec L42
+red L39
+red @r3
+clr @r2
+L54: sub L32, L36
+cmp -88, 215
+not @r2
+L55: prn S9
+clr @r4
+L56: jsr L26
+lea S0, L58
+L57: cmp @r1, 469
+jmp @r1
+mov @r5, S3
+add @r0, @r1
+bne @r1
+m1
+jsr @r0
+prn -19
+dec S0
+sub 175, @r0
+jsr L6
+not S8
+m4
+m0
+L58: lea L10, L59
+not L4
+not S8
+cmp @r6, @r2
+jmp D0
+lea L41, @r3
+bne X4
+L59: clr @r1
+not S0
+stop
+D0: .data -409,55,-63,244,107,-344,180,-156,-21,-390
+D1: .data 280,471,358,-124,175,18,-277,454,-126,430
+D2: .data -145,425,333,-88,-119,-144,32,41,-217,-168
+D3: .data -42,-203,425,369,-19,-188,-81,206,349,-321
+D4: .data -79,-158,-158,-219,-394,203,220,-90,288,-176
+D5: .data 306,-278,490,447,-115,-160,493,-9,156,111
+D6: .data -486,-157,294,-167,-343,-115,-81,200,269,-246
+D7: .data 24,-124,308,-426,52,8,479,457,402,211
+D8: .data 233,478,-126,-311,-309,69,460,492,143,96
+D9: .data 48,-142,178,-436,194,-32,-452,-80,62,-429
+S0: .string "pmtnatdhuimsptfie"
+S1: .string "ooibgsv"
+S2: .string "bkpltw"
+S3: .string "kkslyssnowonvrzpx"
+S4: .string "cuj"
+S5: .string "rhvouuaawbk"
+S6: .string "qsjddkljwshaquezu"
+S7: .string "r"
+S8: .string "cj"
+S9: .string "qnvsrsbuttsmjospncxa"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r3
+    prn 6
+endmcro
+mcro m1
+    sub @r5, @r3
+    prn 94
+endmcro
+mcro m2
+    sub @r2, @r1
+    prn 50
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 70
+endmcro
+mcro m4
+    sub @r2, @r7
+    prn 98
+endmcro
+mov -274, L0
+m1
+add @r6, @r1
+not L0
+cmp 68, L0
+lea D0, @r6
+clr @r5
+L0: mov @r1, L0
+m3
+m1
+jsr @r1
+cmp L0, 324
+rts
+L1: clr L1
+m3
+prn @r7
+not @r3
+lea L0, @r4
+jmp L0
+add @r4, @r1
+m3
+jsr @r7
+m4
+sub L0, @r4
+L2: clr @r3
+cmp 101, -268
+jmp @r6
+L3: sub @r7, @r6
+add @r6, @r4
+L4: sub 261, L0
+L5: lea L3, @r1
+L6: not @r2
+not L4
+inc L0
+not L5
+dec L0
+not @r1
+jsr L0
+dec L1
+mov L0, L4
+lea L5, @r1
+sub @r1, L1
+m4
+bne @r0
+bne @r0
+cmp L0, L3
+L7: not @r4
+jmp @r7
+mov -332, @r4
+dec L3
+jmp @r0
+lea L0, D0
+red @r5
+cmp L4, 446
+bne @r6
+m3
+dec L3
+red L5
+clr @r7
+sub 148, L1
+mov 254, L0
+mov L0, @r7
+jmp @r3
+add L5, L7
+cmp @r2, 390
+bne @r2
+not @r3
+inc L4
+cmp 69, -411
+bne @r2
+cmp @r5, -10
+jmp @r3
+L8: rts
+m4
+cmp -257, @r0
+jmp L8
+bne L3
+dec @r5
+rts
+bne L1
+add 399, @r3
+not L4
+dec @r2
+prn @r2
+rts
+add @r2, @r2
+clr L4
+not @r7
+mov L8, @r0
+bne @r2
+m4
+L9: prn L3
+lea L1, @r3
+m4
+L10: prn 80
+mov 204, @r1
+rts
+jmp L5
+rts
+m0
+sub @r7, L0
+clr @r2
+m3
+not @r0
+L11: add 208, @r0
+cmp 114, @r5
+dec @r6
+jsr L1
+mov L5, @r0
+red @r5
+L12: sub D0, L4
+rts
+jsr L1
+sub -296, L5
+bne L5
+cmp -137, L9
+bne L31
+red @r5
+rts
+red L12
+dec L5
+jmp @r0
+clr @r4
+cmp @r3, L3
+L13: lea L3, @r0
+m3
+dec @r5
+m1
+red @r7
+sub L2, L6
+clr L0
+m4
+jmp @r7
+bne @r0
+red @r1
+inc L2
+cmp L2, @r5
+bne L13
+cmp -170, 99
+clr L7
+cmp L13, L23
+not @r4
+mov -40, @r4
+prn L53
+red L12
+m0
+jmp L13
+prn L2
+prn -38
+add L5, L5
+clr L8
+not L5
+sub @r1, L8
+jmp L5
+L14: rts
+inc @r4
+jsr L12
+m2
+dec L11
+add -409, L8
+jmp @r0
+not D0
+m0
+m4
+jsr L13
+dec L13
+m1
+L15: rts
+dec @r1
+mov @r0, L10
+L16: jmp L4
+jsr L16
+sub @r5, @r5
+jsr L12
+dec @r1
+bne L14
+sub -187, @r3
+red @r7
+red L2
+cmp 297, @r0
+inc @r3
+L17: jsr L9
+red L17
+clr @r3
+mov -3, L8
+not @r0
+dec L1
+cmp @r3, 61
+clr @r0
+mov @r0, @r4
+inc L0
+L18: red S1
+lea L10, @r7
+cmp @r3, @r3
+jmp L5
+L19: lea L35, L8
+mov @r7, L6
+lea L4, @r1
+clr L49
+add 493, L19
+L20: red @r6
+jmp L14
+L21: inc L17
+mov L51, L21
+inc L15
+cmp L8, L14
+lea L4, L13
+red @r1
+bne L3
+cmp 399, @r0
+sub @r7, @r3
+bne L19
+prn @r2
+sub @r5, @r1
+L22: inc @r3
+inc @r5
+red @r1
+jsr L9
+prn -168
+lea L3, S7
+not L19
+add @r1, L18
+L23: inc @r4
+lea L14, @r7
+bne L10
+mov 46, L8
+jsr L5
+bne @r4
+L24: dec L15
+inc L10
+clr @r1
+mov L20, L5
+L25: inc @r2
+m3
+rts
+cmp -365, L13
+clr L21
+L26: dec L12
+bne @r0
+bne @r5
+cmp L12, 283
+m2
+jsr L16
+bne L17
+L27: prn 249
+m0
+sub -243, L9
+sub @r1, @r4
+L28: not @r1
+dec @r1
+inc L3
+red @r5
+L29: lea L15, L29
+cmp L3, @r0
+mov 375, L47
+prn -433
+L30: clr @r3
+lea D0, L14
+lea L18, @r5
+sub -352, @r3
+lea L25, L17
+not @r5
+L31: prn L22
+L32: not @r7
+sub 262, @r6
+m3
+add -111, L41
+L33: inc @r0
+rts
+bne L32
+mov L17, L2
+add -180, @r6
+red @r5
+clr L4
+sub D0, L22
+sub L7, L3
+m0
+prn @r0
+add @r3, L5
+add L52, L31
+L34: add @r2, L4
+dec D0
+sub @r2, @r7
+not @r1
+cmp L23, @r6
+L35: red L4
+L36: dec L18
+inc @r0
+rts
+bne @r1
+red D0
+bne @r4
+jsr @r5
+lea L57, @r5
+rts
+L37: cmp 45, @r5
+cmp L35, X0
+jmp @r2
+L38: lea S8, L51
+cmp @r6, L11
+jsr L31
+lea D0, L12
+m4
+L39: jsr L14
+jmp L20
+sub -275, @r0
+jsr @r6
+bne @r1
+prn S0
+m4
+L40: jsr L40
+not L8
+cmp @r5, L3
+m0
+inc L38
+L41: dec @r7
+jsr S8
+m1
+jsr L35
+not L11
+clr L49
+inc @r1
+clr @r5
+clr @r4
+sub @r3, @r7
+add @r0, L17
+mov X1, L30
+L42: prn L32
+dec @r1
+m3
+clr @r3
+mov L17, @r6
+m4
+add 72, @r1
+prn L42
+jmp @r3
+L43: dec L22
+prn 289
+sub -121, @r2
+sub @r2, @r7
+add 280, @r3
+mov 81, L19
+jmp L38
+jmp @r7
+mov L36, L51
+red @r7
+L44: bne S6
+L45: dec @r3
+lea L21, L20
+bne @r5
+mov 125, L15
+inc L3
+lea L25, L31
+sub -196, @r6
+bne L45
+m3
+prn -158
+jsr @r0
+mov @r6, L33
+red @r5
+dec L43
+prn L29
+rts
+jmp L16
+prn @r0
+m3
+not @r3
+inc L20
+m3
+red @r7
+bne @r3
+dec L30
+L46: jmp @r5
+L47: not @r6
+sub -120, L24
+cmp 489, -376
+jsr @r0
+rts
+jmp @r6
+L48: bne @r3
+L49: sub @r7, @r7
+L50: jsr L37
+clr @r0
+L51: jmp @r0
+rts
+sub @r1, L28
+rts
+jsr @r3
+L52: add L37, L58
+red L15
+mov @r6, @r4
+L53: inc S3
+L54: jsr L39
+red @r7
+m0
+bne @r2
+dec L58
+dec L27
+jsr @r7
+bne @r5
+sub @r1, L24
+cmp -442, @r6
+jmp L29
+rts
+L55: rts
+jsr L26
+m4
+m2
+jmp @r6
+L56: add L55, L17
+not @r7
+inc @r7
+jsr @r5
+cmp L26, L36
+L57: red @r3
+jsr @r7
+bne L40
+m2
+jmp @r1
+sub -223, @r7
+cmp L59, X2
+add @r2, @r7
+jsr L58
+m0
+lea L58, L59
+bne L24
+cmp L59, -287
+dec @r4
+not D0
+jsr @r6
+L58: cmp L41, 392
+sub @r2, @r4
+dec @r1
+bne @r7
+add -139, D0
+L59: bne @r2
+mov D0, @r2
+mov S6, X3
+not X4
+red L33
+stop
+D0: .data 343,-31,322,-51,-272,85,-318,-455,-157,-41
+D1: .data -142,99,497,142,473,427,-472,307,-267,347
+D2: .data -473,-42,-308,-444,-82,87,-323,238,37,204
+D3: .data 55,398,128,353,86,488,95,-192,-428,-187
+D4: .data 102,402,400,-33,387,474,-380,-12,-369,57
+D5: .data 6,-252,-186,-222,-203,-186,-336,18,-91,113
+D6: .data -336,-22,-129,-168,-384,160,-21,-264,233,134
+D7: .data -402,233,286,-240,375,192,-462,50,-248,345
+D8: .data 449,-121,-62,419,297,-45,345,192,-457,-184
+D9: .data -367,-105,127,-72,-438,-206,-341,-167,495,339
+S0: .string "zoyeyagvfwlp"
+S1: .string "tuwbhxqignasgkmjbbw"
+S2: .string "wbrlowz"
+S3: .string "vsjsiagbfzfjfhtcjge"
+S4: .string "kmixk"
+S5: .string "hgzcpdecwbwqpibdgzep"
+S6: .string "g"
+S7: .string "pustprzjcu"
+S8: .string "ojovxigplbrdt"
+S9: .string "ayhahuyjaqfcniwcmxne"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r5
+    prn 45
+endmcro
+mcro m1
+    sub @r2, @r4
+    prn 92
+endmcro
+mcro m2
+    sub @r4, @r7
+    prn 15
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 46
+endmcro
+mcro m4
+    sub @r4, @r5
+    prn 22
+endmcro
+rts
+dec D0
+cmp L0, L0
+cmp L0, L0
+m1
+m3
+L0: inc L0
+inc L0
+L1: rts
+not L1
+not L1
+clr @r1
+not @r3
+lea L1, L0
+m1
+m2
+cmp L38, @r2
+not L1
+clr @r5
+sub @r0, L0
+lea L1, D0
+add @r7, @r2
+red D0
+L2: jsr @r1
+L3: lea L2, L1
+add 58, @r4
+clr @r1
+add 253, @r2
+dec L3
+dec @r0
+prn @r4
+rts
+mov L3, L2
+lea L0, @r6
+dec @r2
+mov 77, @r2
+jmp @r3
+sub -368, L1
+add @r6, L3
+L4: sub @r0, L4
+L5: clr L23
+add L1, L4
+clr L4
+jsr L0
+dec @r2
+m4
+L6: jmp @r6
+mov @r6, @r2
+mov L4, @r4
+L7: dec @r1
+rts
+bne @r3
+jsr @r2
+L8: prn 287
+rts
+cmp L6, -356
+jmp L1
+mov @r1, S5
+sub L2, L8
+L9: bne @r6
+not L5
+not L0
+m1
+cmp L8, 20
+sub @r4, L7
+lea S1, L7
+rts
+red L8
+L10: inc @r5
+not @r0
+lea L6, @r5
+mov L0, L58
+jsr @r0
+m1
+rts
+prn -38
+L11: sub 15, L3
+clr @r7
+red @r5
+L12: prn L8
+m1
+jsr @r1
+clr @r1
+lea L7, L7
+L13: dec @r3
+inc L41
+bne @r5
+red L2
+add -273, @r3
+sub L1, @r2
+sub L10, L6
+L14: not L55
+m3
+inc L8
+red L12
+cmp -193, 416
+jmp @r6
+red L13
+bne @r1
+not @r2
+dec L0
+cmp L7, L1
+L15: jmp L4
+inc @r5
+L16: jsr L6
+inc L15
+L17: rts
+jsr L2
+red L7
+jmp L12
+red L10
+jmp @r0
+clr L5
+L18: mov L15, L24
+mov @r2, @r4
+add -114, @r0
+rts
+lea L3, L17
+not L8
+m3
+not @r7
+not L6
+rts
+dec L16
+bne @r3
+inc @r0
+lea L2, @r6
+sub -337, @r2
+m3
+rts
+L19: mov @r6, L4
+L20: inc @r6
+jsr L11
+clr @r1
+jmp @r6
+add @r0, L10
+L21: lea L14, L20
+prn @r5
+sub -355, @r1
+L22: clr D0
+L23: red @r2
+L24: bne @r7
+prn @r4
+m0
+sub @r3, L23
+m4
+dec L2
+not @r5
+sub L18, L10
+jsr L19
+clr @r7
+L25: red @r0
+jmp L15
+m1
+mov L18, L2
+inc @r1
+mov @r1, L11
+clr @r0
+L26: add @r0, L11
+L27: red @r7
+rts
+prn @r5
+jmp L23
+L28: sub S3, L20
+inc L13
+L29: jmp @r7
+sub -382, @r3
+sub -114, L23
+dec @r4
+add L21, @r7
+L30: dec L38
+mov L9, @r7
+lea L12, L12
+add -57, @r5
+m2
+rts
+not @r0
+inc @r4
+sub 363, @r2
+cmp L5, -355
+red @r6
+rts
+cmp L10, @r3
+bne @r6
+L31: sub @r3, L17
+clr @r1
+sub L4, @r2
+dec @r2
+cmp L44, -41
+L32: sub @r4, @r7
+red L23
+jmp L23
+mov L20, L19
+L33: mov 17, @r2
+L34: sub L7, L3
+red @r2
+mov @r2, @r6
+red @r7
+jmp @r0
+not @r0
+rts
+mov -27, @r2
+clr @r5
+red @r2
+cmp L32, D0
+jsr L5
+sub L26, @r3
+jsr L11
+sub L11, L41
+add @r4, @r3
+L35: add L34, @r4
+inc L34
+m2
+L36: add L28, L14
+inc L19
+lea L12, @r1
+L37: cmp -115, @r0
+bne @r3
+dec @r3
+prn L7
+L38: red @r2
+m1
+jmp L5
+inc L8
+dec @r7
+red L23
+dec L27
+dec @r5
+add @r7, L37
+clr @r1
+m4
+m3
+dec L17
+m1
+lea L15, @r5
+lea L18, @r6
+jmp L6
+jsr @r2
+bne @r1
+L39: sub @r0, L7
+L40: dec L22
+mov L16, L36
+inc L21
+jmp @r6
+mov @r7, @r2
+L41: prn @r7
+L42: rts
+sub L31, L19
+not @r5
+jmp @r0
+mov @r3, L0
+prn L19
+dec L39
+mov 78, @r3
+bne L2
+bne @r6
+rts
+inc @r3
+L43: inc @r6
+mov S2, L4
+add @r4, @r0
+dec L43
+rts
+mov -167, @r7
+add L34, L5
+L44: red L43
+not L41
+L45: clr L48
+cmp X0, @r1
+add -340, L4
+sub 9, @r2
+L46: cmp @r3, @r3
+red L3
+jsr @r2
+L47: jsr @r4
+clr @r2
+cmp @r2, @r4
+mov @r2, @r2
+not @r7
+m3
+m0
+clr @r6
+cmp @r2, -66
+dec @r5
+bne @r6
+m2
+red @r6
+m3
+jsr @r1
+m2
+rts
+add L38, L20
+red @r5
+rts
+cmp L14, @r1
+jsr @r6
+inc @r1
+prn -344
+mov @r0, L37
+jsr L8
+L48: jsr L36
+clr L33
+inc @r7
+clr @r1
+not L52
+sub L58, @r2
+sub L43, L25
+m0
+not @r0
+not S6
+cmp @r0, @r2
+mov @r3, L13
+add L43, @r5
+lea L5, L28
+cmp @r5, 495
+jsr L33
+L49: red L8
+prn @r1
+inc L34
+m1
+m2
+L50: clr D0
+mov @r0, @r3
+inc @r1
+rts
+dec L10
+bne @r2
+mov 99, L9
+clr L33
+red L20
+m3
+mov L31, S9
+red L26
+clr D0
+clr L48
+jmp @r5
+not @r3
+lea L34, L0
+bne L23
+jsr @r4
+L51: cmp -380, @r1
+sub -460, L1
+cmp L31, L44
+rts
+not @r4
+inc L43
+prn @r1
+clr @r4
+L52: clr L22
+dec @r1
+rts
+jmp @r7
+sub @r0, L3
+mov L22, D0
+inc @r3
+dec L8
+prn @r6
+red @r6
+sub L38, L24
+inc L31
+jsr L5
+red L31
+m0
+prn @r1
+red @r5
+red D0
+mov @r2, @r4
+jmp @r0
+prn L56
+mov L40, L14
+L53: prn 269
+m2
+inc L47
+inc @r6
+cmp L58, 221
+add L51, @r1
+dec @r5
+sub L29, @r3
+dec L32
+L54: jmp L12
+red L34
+dec @r7
+L55: mov @r0, L8
+not L12
+mov @r7, @r5
+jmp L35
+jmp @r0
+m0
+prn @r7
+jmp @r0
+m2
+add -73, X1
+jmp @r1
+bne @r4
+L56: jmp X2
+dec @r0
+bne L58
+m4
+prn L42
+inc D0
+inc L22
+prn L48
+cmp @r5, @r4
+mov L33, @r0
+L57: dec @r6
+bne D0
+add @r1, @r2
+red @r2
+rts
+inc @r3
+m3
+jsr X3
+jsr L9
+dec @r0
+m2
+bne @r6
+dec L27
+m2
+add S9, @r7
+add @r6, @r1
+L58: prn L12
+bne @r3
+add @r5, L59
+lea L59, L59
+inc L8
+clr L47
+not @r0
+L59: dec @r1
+red L19
+sub D0, @r7
+cmp 490, @r2
+m4
+m2
+red L57
+rts
+bne @r1
+rts
+prn D0
+jmp X4
+m0
+stop
+D0: .data 199,-268,-489,-30,134,-21,172,-212,213,310
+D1: .data 143,-227,-229,486,-325,-390,277,-453,440,-34
+D2: .data 244,-222,144,109,-183,-384,-101,-75,-340,-39
+D3: .data 481,235,50,-258,496,493,-326,224,-336,389
+D4: .data 143,498,-446,-15,-6,222,256,-120,-272,425
+D5: .data 268,54,400,420,-403,-330,29,-327,-90,-428
+D6: .data 69,-241,314,-407,43,-291,-149,-15,-62,342
+D7: .data -56,179,-106,438,170,-460,-155,-84,321,482
+D8: .data -372,53,-40,197,379,111,15,398,-355,-74
+D9: .data 434,193,170,213,208,-426,-14,-471,-370,-18
+S0: .string "q"
+S1: .string "ychxlzgknfdsxweambsp"
+S2: .string "nnt"
+S3: .string "xrdg"
+S4: .string "wtsqgyzgfdho"
+S5: .string "przdshnhoelxktzpvi"
+S6: .string "aqlj"
+S7: .string "hj"
+S8: .string "gvcltcrtryxvszf"
+S9: .string "xprjwwoeenkwpaebwgcj"
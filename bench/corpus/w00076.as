@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r0
+    prn 15
+endmcro
+mcro m1
+    sub @r6, @r5
+    prn 59
+endmcro
+mcro m2
+    sub @r6, @r5
+    prn 81
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 22
+endmcro
+mcro m4
+    sub @r6, @r4
+    prn 46
+endmcro
+lea L0, @r2
+not L0
+sub L0, L0
+m2
+cmp L0, -15
+mov 35, @r7
+clr @r7
+cmp -485, @r1
+L0: jmp L0
+mov @r6, @r7
+sub 215, L0
+clr L0
+jmp L0
+bne L0
+jmp S3
+add @r6, @r5
+rts
+bne @r6
+m3
+sub @r6, L0
+lea L0, @r4
+m0
+m2
+L1: rts
+L2: cmp L1, 100
+bne @r7
+m3
+bne L1
+add @r4, @r1
+clr @r4
+L3: dec X0
+lea L2, L2
+L4: not @r2
+cmp L4, 77
+mov -242, L0
+cmp 67, 273
+cmp @r5, @r4
+inc L0
+prn L0
+jsr @r6
+jmp @r5
+m2
+not @r0
+sub @r3, @r4
+prn -64
+red @r3
+bne L3
+not @r6
+cmp L3, @r5
+prn -372
+clr @r3
+jsr @r2
+sub @r2, L4
+m4
+dec @r5
+lea D0, @r6
+lea D0, @r0
+add @r0, @r7
+jsr L0
+dec S6
+mov @r5, L4
+rts
+inc @r6
+L5: prn @r3
+inc @r4
+rts
+L6: lea L6, L2
+clr L6
+lea L0, L0
+L7: jmp @r0
+bne L1
+not @r7
+red L3
+mov @r1, L4
+L8: red L0
+L9: rts
+cmp @r2, @r5
+L10: add @r7, L3
+inc @r7
+not L8
+sub L9, L3
+sub 292, L7
+jsr L10
+not @r1
+m2
+jsr L14
+lea S6, @r4
+prn L2
+cmp L3, L2
+red L8
+lea L8, @r2
+cmp @r1, L5
+inc L0
+cmp 75, @r6
+not S1
+bne L2
+bne @r6
+m1
+lea L2, L4
+inc L8
+not L6
+cmp L10, L1
+rts
+red L4
+lea L3, @r2
+add 421, L9
+sub -238, @r6
+bne D0
+m4
+mov 66, @r5
+not D0
+not @r4
+clr @r3
+bne @r5
+cmp L2, 355
+clr L4
+L11: prn L0
+add 244, L1
+not L4
+dec L10
+mov @r0, @r0
+rts
+prn L5
+lea L5, @r1
+sub @r7, L0
+L12: add 89, L3
+jsr @r5
+L13: dec L54
+L14: prn L5
+m1
+mov -34, L11
+red L0
+rts
+clr @r5
+not @r7
+jsr L10
+L15: clr L6
+L16: jmp L12
+bne @r2
+rts
+L17: cmp -82, L1
+L18: bne @r0
+bne @r6
+jmp @r7
+rts
+mov @r6, @r3
+lea L9, L12
+not @r5
+jmp @r3
+jmp L11
+clr @r3
+prn @r4
+bne @r6
+sub 263, @r6
+sub 163, L2
+bne L16
+bne @r4
+rts
+rts
+jmp @r2
+clr L0
+lea L9, L3
+m1
+not @r7
+rts
+red @r3
+lea L2, @r0
+dec L3
+L19: lea L38, L4
+add L0, L18
+sub L1, L7
+lea L5, @r3
+jmp @r2
+prn L5
+red @r6
+clr @r6
+jsr @r4
+dec @r0
+red @r3
+clr L15
+L20: add @r3, @r3
+L21: mov -456, L18
+inc @r5
+add @r5, L27
+bne L18
+mov L15, @r5
+sub L0, L19
+bne @r2
+not @r5
+L22: clr L22
+add 496, L22
+red L16
+jmp L18
+m3
+cmp L13, @r1
+bne L1
+cmp @r6, 364
+m2
+not @r7
+m4
+sub L0, @r2
+prn @r7
+lea L7, @r0
+add 224, @r5
+m0
+jsr @r1
+L23: mov @r0, L0
+dec L1
+rts
+mov -298, @r6
+dec L23
+cmp L19, -211
+inc L22
+L24: jsr @r7
+inc L11
+bne @r4
+jmp L10
+add L14, L23
+not @r0
+m0
+m0
+add @r0, @r0
+clr L5
+red L13
+m1
+dec @r3
+add -292, L2
+L25: inc L13
+mov L8, @r2
+L26: clr L8
+rts
+lea L39, L13
+lea L44, L7
+clr L12
+not L24
+jmp X1
+red L6
+inc @r5
+mov @r0, L58
+cmp @r0, L5
+sub L7, L15
+add @r6, L11
+cmp @r3, -4
+m1
+cmp 33, L22
+mov @r3, L11
+jsr @r3
+mov 232, @r2
+mov L13, L23
+m4
+L27: clr X2
+clr L19
+jmp @r6
+L28: jsr @r6
+sub L10, L28
+inc @r7
+jmp L1
+L29: not L9
+m0
+sub -402, @r1
+inc L28
+prn @r3
+jsr @r6
+inc @r2
+add @r5, L3
+red L47
+dec @r4
+m1
+add 343, L9
+red @r5
+bne @r1
+rts
+cmp 150, -114
+lea L3, @r3
+m0
+m3
+m3
+L30: prn 391
+L31: cmp -377, @r7
+not @r6
+add 462, L22
+not L44
+cmp @r4, L26
+jmp L56
+add @r0, @r4
+bne @r3
+L32: mov 132, @r0
+bne @r3
+m4
+L33: bne @r6
+m1
+m4
+bne L24
+bne @r5
+L34: mov 84, L14
+L35: prn L29
+m1
+dec @r1
+red @r0
+L36: lea L40, @r1
+rts
+dec L32
+bne D0
+jmp @r2
+mov L23, @r2
+not @r1
+mov 340, @r1
+jsr @r1
+prn @r2
+m0
+m0
+rts
+inc L50
+jsr L31
+inc L18
+clr L2
+m0
+lea L57, L0
+prn 221
+jmp L25
+not L2
+mov L17, L35
+L37: prn @r1
+sub L19, @r7
+L38: rts
+not @r1
+mov L25, @r2
+L39: prn L16
+inc @r3
+dec @r1
+clr @r0
+not D0
+L40: red @r0
+jmp @r2
+sub L5, @r1
+dec @r3
+L41: not @r0
+jsr L11
+L42: jsr L15
+not @r1
+dec L13
+L43: add 466, L24
+m0
+L44: lea L33, @r7
+jmp @r0
+L45: dec S1
+jsr L14
+add L40, L54
+jsr @r5
+L46: inc L15
+add L26, @r6
+add @r3, L8
+rts
+cmp -277, 7
+m2
+prn @r5
+cmp @r2, @r2
+add -375, L17
+red @r0
+sub L8, L7
+jsr @r4
+clr L39
+jmp L35
+L47: add 275, @r7
+add @r3, L30
+prn 495
+L48: jsr L52
+prn @r7
+dec L34
+m1
+cmp 156, L15
+prn L44
+prn @r6
+L49: bne @r7
+prn @r3
+inc @r3
+cmp @r2, @r6
+sub L25, L55
+inc L34
+not @r4
+L50: red L4
+inc @r5
+lea D0, X3
+not @r1
+m4
+cmp 94, @r0
+add -404, @r3
+red L1
+mov @r7, L52
+add -263, @r1
+mov 252, @r5
+L51: rts
+jsr @r2
+bne @r5
+inc @r5
+dec @r7
+L52: prn @r4
+lea L3, L32
+L53: sub L37, L52
+L54: red L55
+add @r0, @r1
+L55: inc D0
+L56: not @r4
+bne @r1
+jmp @r0
+lea L59, L0
+jmp L0
+L57: prn @r7
+mov 224, @r2
+m4
+red L41
+sub @r7, L12
+inc L12
+m1
+inc @r6
+clr @r2
+m2
+red X4
+clr @r1
+red L10
+red L41
+lea L59, @r3
+prn L46
+not @r6
+inc L25
+add -65, L44
+L58: mov -509, L59
+L59: mov -132, L26
+dec L51
+inc L39
+inc @r7
+clr D0
+cmp D0, 461
+add S5, @r1
+clr @r7
+inc @r7
+cmp S4, 145
+red D0
+rts
+jsr S5
+stop
+D0: .data 243,387,494,29,-21,-171,361,262,469,-35
+D1: .data -263,252,-352,202,47,-484,-5,172,-62,-342
+D2: .data -173,-237,487,493,219,-234,308,314,-286,-328
+D3: .data -448,-480,351,109,254,213,-108,466,-136,261
+D4: .data 392,391,362,-281,-402,-262,460,60,292,-284
+D5: .data 484,23,-31,-160,158,29,5,-127,-207,-138
+D6: .data -288,-213,-334,215,-416,-24,-309,-202,-101,-435
+D7: .data 132,439,-394,-155,361,489,463,327,-247,-455
+D8: .data 209,139,70,310,-467,-222,347,59,-146,-391
+D9: .data 13,-292,490,-12,364,-220,68,-6,379,-213
+S0: .string "xirhzcgp"
+S1: .string "le"
+S2: .string "jydwpih"
+S3: .string "eq"
+S4: .string "di"
+S5: .string "kezqczwjshoz"
+S6: .string "mxhptcgioelvkeugppgw"
+S7: .string "vbfijlsl"
+S8: .string "axjiufotxzatvxochslp"
+S9: .string "dvvmotyi"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r2
+    prn 53
+endmcro
+mcro m1
+    sub @r2, @r6
+    prn 57
+endmcro
+mcro m2
+    sub @r0, @r3
+    prn 78
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 99
+endmcro
+mcro m4
+    sub @r0, @r2
+    prn 71
+endmcro
+bne @r0
+lea L0, L0
+lea L0, @r4
+clr L0
+bne @r0
+clr @r6
+jsr @r6
+dec L0
+jsr @r7
+dec @r0
+mov L0, @r0
+m4
+clr L0
+lea D0, L0
+L0: rts
+jmp @r7
+rts
+inc L0
+sub L0, @r1
+bne L0
+mov 7, L27
+jsr L0
+prn @r6
+red L0
+rts
+add 315, @r6
+jsr L0
+jmp L0
+clr @r3
+lea L0, @r4
+jsr L0
+sub L0, L0
+bne L0
+red L0
+cmp @r0, L0
+L1: prn 106
+not L0
+mov -463, L0
+lea L1, L1
+red @r7
+cmp @r0, L0
+m3
+m4
+sub @r0, @r1
+L2: lea L2, L2
+add @r3, L2
+jsr @r3
+jmp L2
+m4
+clr L0
+jmp L2
+sub L1, @r7
+L3: add L3, @r4
+add L2, L3
+lea L0, @r0
+sub -61, L1
+add @r4, @r5
+clr @r2
+clr L1
+jsr @r2
+clr @r7
+m2
+mov L2, L1
+cmp -421, -431
+inc @r7
+m3
+add -406, @r1
+dec @r0
+clr L2
+inc @r0
+inc @r1
+mov L2, L1
+dec L1
+add S3, @r1
+L4: inc L2
+m4
+rts
+cmp @r0, @r1
+clr D0
+not L2
+lea L22, L3
+rts
+rts
+not @r5
+L5: clr @r5
+dec L1
+lea L0, @r7
+cmp 317, 431
+not L13
+inc @r5
+sub @r7, @r5
+L6: jsr @r4
+prn L14
+clr L4
+prn @r4
+bne @r5
+jmp X0
+mov -327, L4
+not @r6
+not L1
+mov @r4, @r3
+lea L2, D0
+m4
+clr L0
+jmp @r6
+cmp 501, @r1
+bne @r7
+inc L2
+clr @r7
+lea L2, @r5
+L7: not L2
+dec L7
+dec @r2
+prn @r6
+L8: mov @r3, L4
+L9: lea L2, @r0
+clr L0
+L10: jsr @r1
+L11: rts
+L12: dec L4
+red @r5
+m4
+m4
+dec L0
+sub @r1, X1
+cmp L6, @r1
+rts
+sub 328, L45
+L13: mov D0, @r5
+rts
+mov L6, @r1
+rts
+m3
+mov 198, @r4
+jsr @r7
+lea L47, S5
+add -272, @r7
+clr L41
+L14: dec L29
+jsr @r5
+cmp @r6, @r7
+L15: inc S9
+red @r0
+inc L3
+L16: inc @r2
+dec @r0
+L17: add 444, L8
+m2
+not L3
+L18: jsr L2
+red @r6
+mov -245, L0
+jsr @r0
+add @r7, L59
+red L2
+clr @r2
+clr L1
+jmp @r6
+cmp @r4, L17
+rts
+prn L7
+rts
+L19: prn 199
+L20: prn @r6
+lea L18, L4
+L21: clr L12
+jmp X2
+inc @r7
+L22: sub @r2, L0
+m1
+m0
+sub L19, @r1
+jsr @r6
+dec @r5
+bne @r1
+L23: dec L21
+jmp @r3
+bne D0
+lea S0, @r7
+red L13
+lea L18, @r1
+inc @r4
+not @r1
+sub L1, @r7
+prn L0
+jsr L18
+dec @r7
+add L8, L16
+jsr L13
+cmp @r1, L12
+inc L19
+jmp @r0
+L24: bne @r7
+rts
+clr L0
+cmp @r1, @r7
+L25: prn -482
+sub L19, L10
+inc L6
+mov L9, L1
+add -409, @r4
+lea L13, L2
+m3
+L26: red L20
+add @r7, @r6
+add -290, L1
+mov @r1, L30
+not L21
+m3
+rts
+rts
+add @r2, @r1
+dec @r7
+L27: lea L9, @r0
+inc L24
+sub L6, @r4
+L28: cmp D0, @r6
+dec @r6
+prn 475
+dec @r1
+cmp 287, @r0
+inc L13
+inc L7
+L29: cmp L25, @r6
+m3
+bne L27
+add @r6, L6
+inc @r1
+dec @r4
+prn 400
+mov L18, L19
+prn -384
+prn @r0
+rts
+rts
+add @r1, L1
+dec @r5
+lea L40, @r1
+bne @r1
+inc @r2
+mov -447, @r7
+m4
+mov L23, L46
+jmp L26
+add 308, L22
+L30: not @r2
+jsr @r4
+mov @r1, L10
+m4
+L31: add -2, L6
+not @r5
+L32: mov L20, L27
+jmp L29
+jsr @r4
+cmp -19, L19
+jmp L24
+dec L26
+sub @r4, @r7
+not L10
+L33: rts
+red L10
+not @r5
+L34: clr @r3
+jmp @r6
+prn @r1
+m1
+L35: jsr @r2
+lea L0, @r7
+L36: rts
+m1
+prn 400
+rts
+bne @r7
+m2
+rts
+lea L16, L6
+not L35
+bne L31
+mov 229, L14
+dec L28
+jmp L30
+dec @r6
+rts
+L37: sub L32, @r2
+m2
+rts
+rts
+inc @r1
+jmp @r6
+jsr L1
+jmp L37
+cmp @r7, -163
+lea L28, L5
+L38: inc L25
+jsr L4
+mov L18, @r0
+add 242, @r5
+rts
+bne L11
+L39: rts
+lea L29, @r0
+bne @r6
+red @r4
+sub @r5, L30
+clr L30
+clr L13
+L40: sub @r0, @r1
+mov @r4, @r0
+red L23
+jsr @r0
+jmp L29
+prn 157
+sub L47, @r0
+rts
+L41: dec @r6
+dec @r2
+m4
+red L11
+dec @r0
+L42: dec @r7
+m4
+mov 33, @r0
+lea L38, L4
+inc @r3
+prn -192
+rts
+m1
+m0
+lea L40, @r5
+m2
+cmp -186, @r4
+L43: bne L4
+dec @r6
+inc X3
+inc L7
+L44: clr L17
+m2
+not L34
+sub -217, @r5
+cmp L48, L26
+L45: jsr L49
+jsr L44
+lea L45, L23
+dec L14
+L46: clr L5
+cmp @r7, @r3
+inc L19
+L47: bne L5
+m3
+sub -232, L45
+not @r2
+sub L8, L39
+cmp -54, L29
+dec @r0
+clr L42
+m1
+mov L20, @r3
+L48: clr @r1
+not L40
+prn @r7
+lea L24, @r0
+L49: sub L46, L12
+add L49, @r0
+jmp @r2
+mov @r0, L45
+m1
+m1
+rts
+dec L42
+dec L49
+m2
+mov D0, @r0
+m3
+prn -254
+m3
+rts
+bne @r0
+red L2
+inc L13
+L50: rts
+L51: lea L56, L49
+m0
+red L28
+add L14, @r4
+prn 271
+L52: inc @r3
+prn @r2
+inc L26
+jsr L26
+inc L4
+L53: sub S9, @r6
+clr L49
+prn L14
+jmp L8
+lea L28, L32
+inc @r5
+not L20
+red S5
+lea L7, @r6
+jsr @r7
+cmp L34, @r6
+prn @r4
+clr @r0
+red @r5
+mov 111, @r4
+clr L24
+mov -467, L25
+inc L56
+lea L12, @r7
+dec @r7
+inc @r0
+jmp L54
+red L55
+jsr S8
+not L55
+m2
+cmp @r4, -308
+jmp @r5
+L54: rts
+lea L26, L58
+m2
+dec L5
+mov -407, L23
+jmp @r5
+m2
+rts
+red @r3
+prn X4
+mov @r5, @r4
+L55: clr L43
+cmp L58, L17
+rts
+L56: cmp L59, 333
+add @r2, @r3
+L57: bne @r0
+inc @r4
+cmp -301, L59
+L58: clr L51
+cmp D0, L59
+L59: inc L30
+stop
+D0: .data 349,-165,175,185,238,-459,-199,210,-355,415
+D1: .data 126,428,-263,-159,-251,77,16,-452,-418,-315
+D2: .data -196,382,-266,439,-155,-375,30,227,166,414
+D3: .data -491,291,-391,165,-304,-432,-130,-92,-13,311
+D4: .data -281,212,-262,-478,-46,487,33,372,114,163
+D5: .data -85,36,-47,-123,-459,-448,-141,494,323,-219
+D6: .data 127,133,314,267,-385,-325,417,344,104,-244
+D7: .data -320,-448,-6,453,37,311,-456,-382,-274,-301
+D8: .data -159,250,236,121,452,-308,262,-321,469,-410
+D9: .data 128,-90,122,314,214,-96,433,375,-467,126
+S0: .string "ecxf"
+S1: .string "vmpokbeptkovqk"
+S2: .string "wial"
+S3: .string "atkmirvus"
+S4: .string "hjqvoli"
+S5: .string "modj"
+S6: .string "ahwrpkt"
+S7: .string "mhqbqfsyxs"
+S8: .string "sutvpxzmshxbxmi"
+S9: .string "nmsyujyunkibgorr"
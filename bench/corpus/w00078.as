@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r5
+    prn 24
+endmcro
+mcro m1
+    sub @r7, @r0
+    prn 56
+endmcro
+mcro m2
+    sub @r2, @r0
+    prn 43
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 75
+endmcro
+mcro m4
+    sub @r2, @r0
+    prn 95
+endmcro
+m2
+cmp L0, @r5
+L0: jsr @r0
+inc @r4
+L1: jmp @r2
+m4
+clr @r4
+inc L0
+inc @r6
+dec L1
+not @r5
+sub -395, @r3
+jmp L1
+bne @r3
+not @r3
+mov @r4, @r6
+mov @r0, L0
+dec L1
+lea L0, @r1
+L2: clr L0
+clr L0
+red @r1
+cmp L2, -234
+L3: jmp L0
+L4: clr @r6
+dec @r5
+lea L2, @r1
+rts
+m3
+lea L2, @r0
+cmp L1, L1
+m4
+L5: inc @r5
+inc @r3
+rts
+L6: mov L5, @r3
+red @r7
+add L5, @r3
+rts
+cmp L4, L3
+jsr @r7
+add 461, X0
+rts
+inc @r7
+dec @r1
+red L1
+L7: bne @r5
+add @r7, @r7
+add 373, L7
+clr @r0
+not @r2
+m0
+L8: prn 45
+add L8, @r0
+jmp @r7
+lea L4, @r4
+m4
+inc L4
+sub L8, @r5
+sub @r4, L4
+cmp @r0, L4
+inc @r7
+prn L1
+jsr L5
+rts
+clr @r2
+inc L38
+L9: clr @r5
+lea L1, L8
+clr L3
+mov -264, L0
+inc @r2
+prn 94
+inc L8
+sub L3, L3
+jmp @r2
+m2
+jsr @r2
+prn @r4
+L10: inc @r0
+jsr L4
+jsr L1
+sub @r1, L1
+bne L7
+add @r5, @r4
+lea L12, @r2
+red L2
+bne @r2
+red L40
+cmp D0, @r6
+prn L10
+jmp L4
+cmp @r0, L3
+L11: rts
+mov 24, L24
+clr L1
+cmp @r6, -298
+lea L4, @r4
+inc L5
+not @r7
+m4
+not L3
+dec L4
+lea L4, L6
+not L11
+sub 406, L11
+sub L7, L35
+L12: dec @r1
+L13: prn 232
+lea L6, L10
+dec @r1
+L14: sub L10, @r3
+m4
+jsr @r3
+L15: jmp L3
+not @r2
+L16: mov @r7, L6
+inc L4
+prn 445
+m4
+m1
+dec L12
+jsr L51
+mov @r0, @r3
+inc L1
+L17: add @r3, @r0
+lea L15, @r1
+L18: rts
+m4
+not L3
+red L13
+add @r3, L9
+inc L13
+bne @r5
+lea D0, L12
+m2
+L19: dec L3
+prn @r3
+red @r0
+red @r1
+add -134, L14
+prn L12
+lea L7, @r5
+prn 500
+cmp @r4, L8
+lea L1, @r1
+sub L0, @r4
+mov @r5, L7
+lea L38, @r5
+m3
+cmp L14, D0
+lea L10, @r0
+L20: clr @r3
+prn @r6
+clr L19
+mov L19, L18
+dec L13
+bne @r5
+dec @r7
+clr L0
+lea L7, L1
+red @r0
+L21: dec @r5
+dec @r3
+bne S6
+clr L7
+m4
+add 356, L9
+clr @r6
+red L4
+rts
+bne L5
+rts
+L22: dec @r1
+mov @r4, @r0
+inc @r5
+L23: sub L2, L23
+L24: add 23, L20
+clr L20
+jmp @r1
+red L9
+dec L17
+sub -363, @r1
+clr @r5
+red @r5
+clr @r6
+L25: dec L5
+prn @r6
+jmp L17
+lea D0, L5
+L26: add @r2, L22
+add @r0, L8
+rts
+rts
+inc L5
+inc @r4
+L27: bne @r6
+L28: prn @r6
+prn @r6
+mov 355, L16
+bne @r1
+L29: not @r1
+mov 58, L9
+m4
+mov -488, @r7
+rts
+not @r0
+m4
+add -380, L28
+lea L22, L11
+L30: bne L53
+cmp @r1, L25
+L31: sub L30, @r0
+add @r2, L16
+jmp L13
+mov -216, L31
+jmp @r3
+dec @r3
+L32: sub -76, @r1
+bne L18
+m2
+L33: lea L30, @r5
+cmp @r3, 91
+not @r3
+inc @r4
+sub @r4, @r0
+bne S7
+prn 122
+mov 264, L9
+inc L16
+lea L33, @r2
+m2
+m2
+add L1, L28
+rts
+bne L41
+jmp @r7
+bne @r6
+bne @r0
+L34: sub -37, @r4
+L35: sub L4, @r4
+add L28, @r7
+dec @r3
+rts
+cmp 37, @r3
+add L23, @r6
+jsr L13
+L36: bne @r2
+inc @r1
+L37: cmp L1, 124
+red L59
+L38: red L2
+not @r3
+m4
+jmp @r7
+m1
+red L0
+sub L47, @r4
+clr L33
+mov @r1, L2
+jsr @r0
+prn @r5
+prn -498
+m4
+dec @r5
+inc L26
+lea L24, L32
+sub @r4, D0
+prn L3
+dec @r2
+jmp @r1
+L39: add L4, L52
+inc @r4
+red S7
+clr L25
+sub -44, @r1
+dec @r0
+sub @r4, L25
+rts
+sub -303, L46
+L40: not L8
+rts
+add @r0, L17
+jsr L15
+jmp @r7
+prn 1
+mov @r5, @r5
+clr L26
+L41: dec L26
+sub @r2, L13
+red L16
+m0
+dec L18
+not @r1
+mov L34, @r2
+inc @r6
+clr @r2
+not L14
+rts
+red @r4
+lea L11, L22
+inc L1
+inc L32
+mov L9, L6
+prn 437
+add 264, L26
+jmp L16
+dec @r7
+prn -416
+L42: inc @r5
+prn L42
+jmp D0
+m1
+prn L29
+add L11, @r7
+prn 511
+sub -347, L14
+m0
+L43: sub L39, @r1
+L44: clr L12
+cmp L29, @r2
+add L1, @r5
+lea L0, @r1
+dec @r3
+mov @r0, L31
+jmp L10
+jmp @r0
+red D0
+red @r3
+lea L16, L40
+cmp @r7, L23
+red @r4
+L45: mov @r7, @r0
+jsr L39
+jsr L41
+prn 128
+m1
+sub 417, @r7
+m3
+lea L54, L20
+inc @r2
+red @r3
+dec @r6
+prn 280
+m0
+L46: prn 300
+add L12, @r2
+prn L10
+dec @r6
+not L13
+dec L24
+L47: sub -5, L51
+clr L29
+jsr @r0
+not L30
+red L20
+L48: inc L21
+jsr @r4
+dec @r1
+dec @r3
+jmp @r3
+bne L21
+cmp L4, L13
+rts
+sub -429, @r6
+m2
+dec @r2
+inc L46
+mov L41, @r6
+lea L38, L2
+dec @r7
+not @r5
+L49: dec @r1
+sub L19, L56
+dec @r3
+m2
+inc @r5
+not L30
+add L40, L42
+inc L8
+red L45
+inc @r2
+m4
+L50: jsr @r0
+inc L21
+L51: inc @r1
+L52: prn @r6
+lea L45, @r7
+L53: clr @r0
+m1
+clr @r0
+m2
+mov @r3, @r3
+bne @r1
+add 89, @r7
+not D0
+add 224, L59
+m1
+jmp L26
+bne L47
+m1
+cmp -252, @r7
+m2
+m1
+not L57
+sub L28, @r7
+cmp L8, @r4
+rts
+m1
+inc @r1
+L54: sub -427, L17
+jmp @r0
+inc L6
+mov @r6, @r7
+lea L20, X1
+inc L9
+jsr @r1
+jsr @r3
+jmp L56
+clr S2
+clr L10
+cmp 96, @r0
+not @r1
+sub L11, L58
+L55: prn -174
+L56: sub @r0, L37
+mov @r5, @r0
+cmp @r7, 483
+jsr X2
+L57: sub L58, @r7
+mov X3, @r0
+prn @r6
+inc D0
+sub L59, L30
+m2
+inc D0
+bne X4
+L58: add S1, D0
+L59: lea D0, @r6
+jmp S2
+stop
+D0: .data 235,-36,-325,-278,360,-499,357,-76,174,-248
+D1: .data 122,-364,278,298,-225,-136,297,-157,439,322
+D2: .data -308,63,111,290,322,-254,274,-85,-114,103
+D3: .data 51,220,133,135,-12,-222,-104,304,308,200
+D4: .data 117,40,314,-1,-144,-273,254,-173,43,-161
+D5: .data 50,-192,102,153,-457,-263,66,-61,333,217
+D6: .data -204,218,-432,-107,306,60,-390,400,1,-424
+D7: .data 222,-146,401,-272,2,-59,-25,323,104,-264
+D8: .data -242,-301,-180,-174,-151,175,-421,-87,-398,-317
+D9: .data -255,185,-171,-229,328,-146,-229,315,169,300
+S0: .string "uet"
+S1: .string "zweyqcijivgbjfetz"
+S2: .string "mstttdzlltvqubc"
+S3: .string "uga"
+S4: .string "n"
+S5: .string "qdzfyt"
+S6: .string "txxxzelatedxc"
+S7: .string "md"
+S8: .string "sozexnr"
+S9: .string "hsks"
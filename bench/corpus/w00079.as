@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r0
+    prn 62
+endmcro
+mcro m1
+    sub @r3, @r1
+    prn 54
+endmcro
+mcro m2
+    sub @r4, @r6
+    prn 9
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 19
+endmcro
+mcro m4
+    sub @r4, @r6
+    prn 52
+endmcro
+m3
+L0: cmp L0, @r5
+sub -318, L0
+sub -178, L0
+inc L0
+lea L0, @r5
+sub 21, L55
+L1: jmp @r2
+m2
+add -308, L1
+m2
+clr @r0
+jsr L0
+sub @r3, L25
+add @r0, L1
+dec @r6
+lea L1, @r5
+jmp L0
+red @r3
+L2: sub -136, @r1
+lea L1, L0
+clr L1
+red @r0
+sub @r6, @r5
+inc L1
+L3: prn @r7
+not L1
+add 130, @r5
+L4: bne @r0
+lea L3, L1
+jmp @r0
+prn L0
+add 481, L1
+sub @r6, L3
+L5: lea L3, L3
+rts
+m2
+clr @r3
+red @r0
+inc @r3
+not @r5
+L6: sub @r7, L6
+bne L6
+red @r4
+cmp -465, @r7
+m0
+L7: bne @r6
+inc @r6
+jmp @r1
+red @r6
+m0
+m1
+jsr @r7
+add @r0, @r3
+m0
+jmp @r3
+cmp -99, X0
+bne @r2
+lea L1, L5
+mov @r7, L5
+jmp L2
+mov -421, L7
+mov @r5, @r5
+m2
+jmp @r3
+lea L0, @r6
+jsr @r4
+add -463, L7
+clr L2
+dec @r2
+jsr @r1
+cmp @r3, -367
+L8: jmp @r2
+mov @r3, @r7
+bne @r0
+lea L1, L8
+L9: add @r3, @r3
+jmp @r4
+bne @r0
+inc L2
+m3
+mov L0, L0
+jsr @r7
+dec L1
+inc L3
+jmp @r1
+add L26, L4
+inc L0
+jmp L7
+inc @r6
+mov @r2, @r7
+L10: jmp L10
+jmp L8
+sub L8, L2
+L11: jmp L0
+m2
+not @r4
+not @r7
+L12: add -3, L4
+jmp @r1
+add @r1, L57
+rts
+sub 390, L1
+clr @r4
+lea L0, L6
+rts
+dec @r0
+prn @r6
+sub S7, @r2
+m0
+L13: inc @r5
+add L7, L8
+m1
+cmp -107, L4
+bne L10
+add L31, @r3
+dec S9
+clr L10
+cmp 397, 251
+prn @r5
+red L9
+L14: lea L12, L29
+red L7
+bne L13
+bne L5
+inc @r2
+sub 138, L14
+jmp @r3
+bne @r3
+add L11, L11
+dec L2
+add L13, L12
+lea L11, @r5
+prn @r5
+cmp L1, L3
+lea L7, @r4
+m0
+jsr L2
+prn @r2
+prn L1
+prn L12
+inc @r3
+red @r5
+add -491, @r3
+L15: prn L2
+bne @r0
+mov L5, L9
+jmp L3
+rts
+lea L4, L6
+L16: bne L6
+jmp @r3
+inc @r6
+lea L5, @r2
+jmp L15
+dec L1
+jmp L1
+jmp L9
+L17: mov @r1, @r1
+red @r7
+jmp L0
+L18: sub @r7, @r4
+sub @r1, L0
+sub @r2, L2
+rts
+jsr @r6
+mov L16, L6
+L19: add -316, @r4
+clr @r0
+not L6
+jmp L19
+bne L10
+bne L4
+red D0
+lea L37, L9
+cmp @r6, -324
+mov 153, @r6
+jsr L6
+m1
+add L11, @r3
+bne L16
+jsr @r2
+lea L9, @r3
+L20: cmp @r3, -152
+L21: cmp -308, -111
+dec @r5
+dec @r0
+add @r5, L12
+mov @r2, L11
+rts
+rts
+jmp @r7
+inc L14
+prn L0
+inc @r0
+jsr D0
+bne X1
+clr L29
+bne L10
+L22: clr @r4
+cmp -205, @r4
+clr @r4
+inc @r3
+jsr L3
+dec @r2
+m2
+clr @r0
+sub -73, @r6
+jsr L31
+mov @r6, @r3
+add L3, @r0
+m0
+prn L9
+add D0, @r6
+red @r5
+jmp @r0
+L23: dec L17
+sub L44, @r2
+jsr @r6
+bne L12
+jmp L23
+m2
+cmp @r5, @r3
+prn L16
+add @r5, L6
+jmp @r3
+L24: lea L11, @r0
+lea L4, @r3
+m1
+jmp L13
+mov 295, L1
+m3
+prn @r1
+m2
+jsr S3
+L25: cmp X2, L21
+add @r6, L21
+add 6, @r6
+m0
+not L14
+cmp @r2, L11
+inc @r2
+sub L50, L0
+jsr L25
+not L15
+rts
+mov -162, @r6
+bne @r0
+lea L4, @r0
+jmp @r2
+L26: add -311, D0
+clr @r0
+L27: jmp @r2
+m3
+L28: clr L17
+L29: dec L20
+dec @r1
+not L36
+L30: bne @r5
+L31: jmp @r6
+prn L5
+L32: jmp @r6
+cmp -221, @r4
+lea S8, @r5
+mov @r3, @r6
+rts
+cmp L20, -472
+inc @r3
+add L10, @r1
+L33: lea L6, @r1
+red L16
+inc @r1
+lea L5, L16
+m1
+mov @r2, @r3
+L34: prn @r7
+L35: rts
+jmp @r7
+m2
+m0
+dec L46
+dec L13
+L36: jsr @r1
+m1
+lea L29, @r0
+inc @r1
+L37: red @r4
+add 38, @r7
+bne @r0
+cmp L23, -432
+red @r1
+dec @r4
+m1
+mov @r5, L12
+clr @r5
+m0
+L38: inc L6
+mov L26, @r1
+sub 232, L33
+rts
+jmp L34
+inc L17
+mov @r4, L7
+mov -444, L0
+not @r2
+dec L22
+rts
+L39: red L11
+mov -376, @r6
+L40: jsr @r5
+cmp -359, L17
+prn L45
+mov @r2, @r3
+m1
+dec @r5
+bne L39
+L41: dec L36
+dec @r0
+jsr L33
+dec @r5
+red @r0
+L42: red @r1
+inc @r1
+add 461, @r2
+clr L42
+L43: bne @r4
+prn @r7
+m3
+m4
+mov L8, @r7
+inc L37
+cmp @r5, -143
+mov L23, L49
+dec @r3
+sub @r7, L44
+mov @r3, L51
+L44: cmp @r4, -12
+sub 306, @r3
+clr @r3
+L45: cmp L3, @r5
+rts
+L46: add L25, @r4
+m1
+L47: red L36
+add L32, L29
+red L20
+sub L53, @r6
+clr L4
+L48: cmp L41, L37
+rts
+rts
+dec L27
+red L15
+red L31
+clr L33
+prn L34
+sub L13, @r5
+sub -486, @r3
+L49: rts
+lea L9, @r7
+clr @r7
+bne @r0
+L50: mov @r2, L27
+L51: jsr @r3
+L52: bne @r1
+L53: add L7, @r1
+jmp L32
+L54: sub @r1, L36
+sub L33, @r2
+inc @r7
+rts
+L55: sub L44, L36
+clr @r2
+add 232, L7
+clr @r0
+dec @r5
+lea X3, @r2
+bne @r3
+sub -507, L33
+add S0, @r3
+mov -195, L34
+inc L24
+lea L3, @r3
+jmp D0
+bne @r7
+bne @r7
+cmp 503, @r5
+lea L3, L12
+rts
+m0
+prn @r2
+clr @r4
+sub L51, D0
+m2
+lea L27, L32
+m2
+m1
+L56: clr @r5
+red @r3
+prn @r2
+not L8
+lea L36, L11
+cmp @r4, L12
+add @r7, @r2
+clr @r1
+rts
+L57: clr @r0
+inc @r1
+cmp -485, @r6
+red X4
+bne L31
+not @r3
+rts
+jsr @r0
+lea S8, L58
+prn -129
+L58: cmp 442, -54
+not L59
+bne @r2
+L59: dec @r4
+mov -288, @r6
+sub -107, S0
+m0
+clr D0
+sub @r0, @r5
+bne @r3
+add 252, D0
+m3
+inc S3
+lea L59, S8
+cmp @r7, -17
+jmp D0
+jsr L50
+bne L42
+rts
+lea S5, @r1
+not @r5
+m4
+not L56
+cmp D0, 95
+stop
+D0: .data 450,-350,477,168,-362,136,202,-155,-197,353
+D1: .data -217,17,-369,-60,-490,305,-38,-390,435,-236
+D2: .data -338,329,-396,401,317,-4,-436,92,-72,451
+D3: .data -161,-129,176,-401,499,-160,68,104,244,231
+D4: .data -121,67,-494,313,-26,-416,250,-161,-240,-468
+D5: .data 416,-153,-90,406,-442,-333,496,-464,-294,359
+D6: .data 136,235,-431,-21,-124,-493,-268,255,109,43
+D7: .data -500,-90,33,172,377,-153,126,241,253,-34
+D8: .data -236,-235,22,-495,-121,-151,-446,-109,247,342
+D9: .data -181,405,379,395,22,-286,-289,-190,474,293
+S0: .string "q"
+S1: .string "ck"
+S2: .string "fuiawsswduwf"
+S3: .string "beoim"
+S4: .string "qrnssxfs"
+S5: .string "otwmjifwz"
+S6: .string "utleqkia"
+S7: .string "pvsonlironqjwxad"
+S8: .string "gbemofyubhohilcmnhp"
+S9: .string "mynanqlndpcn"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r2
+    prn 32
+endmcro
+mcro m1
+    sub @r7, @r2
+    prn 53
+endmcro
+mcro m2
+    sub @r6, @r4
+    prn 74
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 96
+endmcro
+mcro m4
+    sub @r6, @r5
+    prn 76
+endmcro
+L0: red @r3
+L1: clr @r2
+L2: dec L1
+prn L0
+red L0
+mov -415, @r7
+prn @r6
+L3: bne L3
+mov L3, @r5
+L4: mov L0, L4
+m0
+prn -503
+cmp L4, @r6
+m1
+cmp L1, -481
+not L4
+cmp -35, L4
+jsr @r4
+L5: jsr @r2
+mov L3, @r3
+bne @r0
+L6: prn @r2
+L7: inc @r0
+rts
+m0
+add @r7, L2
+bne L2
+dec L0
+clr L5
+clr L6
+m3
+add L6, @r4
+m1
+bne L5
+mov -135, L2
+jmp @r3
+m1
+red L6
+cmp @r2, L4
+add L6, L6
+inc L7
+not @r0
+add @r5, L6
+bne L1
+L8: dec @r0
+L9: clr @r3
+jmp @r0
+dec L4
+rts
+jmp @r7
+add 330, @r5
+sub 397, @r7
+mov L3, @r4
+m2
+not L5
+m2
+jsr @r1
+inc L2
+inc L9
+m4
+m2
+cmp @r7, -473
+mov 72, @r5
+m4
+jmp @r2
+L10: jsr @r0
+L11: cmp L5, -252
+jmp @r0
+m0
+jsr L3
+jmp D0
+bne L1
+sub L0, @r0
+jsr L7
+L12: sub -287, L4
+not X0
+m3
+jsr L59
+not L8
+mov -457, L9
+jmp L9
+cmp -3, L6
+clr @r0
+dec @r5
+cmp @r1, L0
+jmp L12
+inc L2
+lea L12, @r0
+bne @r5
+add @r3, @r0
+prn @r1
+lea L2, @r0
+cmp -151, -351
+not L0
+not L1
+jmp @r5
+not L46
+mov @r2, @r2
+not @r4
+red L12
+mov 95, L8
+L13: inc @r5
+jmp L2
+rts
+prn @r5
+prn D0
+mov @r7, @r4
+dec L2
+jsr @r5
+dec L10
+clr L10
+jmp @r0
+dec @r3
+cmp 462, -280
+dec L7
+not @r3
+jsr @r5
+add @r7, D0
+prn 52
+L14: dec L52
+prn @r1
+L15: red L23
+L16: red @r4
+red @r1
+cmp -391, L3
+not L9
+rts
+L17: sub L3, L1
+dec L14
+dec S0
+add @r5, L54
+L18: add 372, L8
+m1
+jmp @r1
+add @r2, @r0
+dec L18
+bne @r0
+L19: jsr L2
+jsr L17
+m1
+cmp @r1, @r4
+rts
+prn L18
+cmp @r0, L2
+not L19
+jsr L11
+inc @r7
+sub 263, @r2
+not @r2
+red L15
+not @r0
+clr L5
+jsr @r4
+dec L19
+L20: bne L19
+dec @r4
+not L16
+cmp L18, @r2
+not @r7
+bne L12
+clr @r3
+clr @r2
+bne @r6
+L21: dec L2
+jmp L32
+inc L11
+mov @r1, L6
+m0
+L22: sub @r0, L19
+add @r5, @r1
+L23: cmp 329, L5
+inc @r0
+inc @r7
+clr @r2
+m4
+mov L45, L8
+lea L16, @r7
+sub L29, @r5
+bne S2
+red L4
+dec L23
+clr L14
+jmp @r2
+L24: not @r4
+L25: rts
+cmp L17, @r5
+m4
+L26: cmp L17, L7
+rts
+sub L26, @r2
+L27: prn @r5
+dec @r4
+not @r1
+jmp L10
+clr L21
+L28: jmp @r2
+cmp @r1, X1
+m0
+clr @r3
+prn L12
+jmp L8
+jsr @r0
+bne L7
+m4
+L29: jmp L11
+dec L25
+red @r2
+cmp @r6, L51
+prn -159
+dec L19
+inc @r7
+prn L13
+jsr L29
+lea L13, @r3
+jmp L10
+L30: sub L27, L6
+jsr @r1
+L31: mov L20, L5
+m4
+red L19
+mov L0, L18
+m4
+clr @r2
+add L13, L27
+L32: sub L14, @r7
+L33: jmp L11
+sub S0, L24
+mov L13, L4
+red L10
+lea L31, L11
+inc @r3
+inc L20
+rts
+jsr L30
+dec @r2
+add @r2, L5
+not L14
+rts
+m0
+bne @r4
+dec @r0
+m0
+clr L40
+L34: cmp L34, 147
+bne @r4
+dec L9
+lea L30, L26
+prn L40
+cmp L2, 179
+L35: red @r2
+not L17
+prn L49
+jsr @r7
+prn L29
+lea L4, @r6
+jsr @r2
+red @r3
+jmp @r1
+cmp 185, L21
+dec @r2
+m2
+L36: jsr L4
+clr L22
+lea L26, @r3
+add @r1, L13
+red L17
+prn 84
+bne @r0
+L37: dec L32
+add 262, S3
+inc @r6
+rts
+rts
+red @r3
+jsr L29
+dec L25
+jsr L10
+not S9
+bne @r2
+dec L37
+m4
+inc @r5
+bne L5
+bne @r7
+jsr L7
+bne @r6
+mov -241, L2
+jmp @r7
+red @r6
+prn L20
+prn 459
+inc @r1
+sub @r0, L1
+m1
+L38: not L10
+jsr @r0
+cmp @r7, @r0
+lea L13, L11
+m1
+jmp @r4
+red D0
+m3
+prn L39
+L39: jsr L5
+prn 468
+jmp L35
+rts
+jsr @r1
+rts
+dec L30
+lea L10, @r1
+sub -138, L18
+sub -487, @r1
+prn @r3
+bne @r7
+dec @r5
+sub @r4, @r1
+red X2
+rts
+red L38
+jmp L15
+m4
+add @r5, L8
+clr D0
+bne L13
+bne L26
+lea L27, L9
+clr L4
+m2
+red L37
+bne @r7
+jsr @r0
+clr L32
+dec @r5
+m2
+rts
+dec @r1
+L40: inc L37
+mov L5, L6
+not @r4
+dec @r6
+not @r4
+L41: red L20
+L42: red X3
+clr @r4
+clr @r6
+inc @r7
+rts
+rts
+L43: not L12
+dec @r6
+dec L19
+lea L26, @r1
+mov L58, @r5
+mov @r1, @r7
+jsr @r1
+L44: cmp L27, @r0
+L45: not L1
+rts
+add 19, S3
+prn @r0
+cmp -139, -338
+lea L44, D0
+mov -508, L43
+red @r5
+clr @r0
+m0
+inc @r3
+L46: jmp @r3
+dec D0
+m1
+inc L25
+L47: lea S4, @r7
+inc X4
+m1
+clr L17
+clr L25
+m4
+L48: dec @r4
+not L45
+sub 274, L17
+L49: rts
+red @r2
+prn @r5
+red @r5
+m2
+jsr L14
+lea L44, L33
+prn @r5
+cmp L4, @r0
+L50: rts
+bne @r1
+m0
+clr L45
+dec @r5
+rts
+lea L21, @r1
+red D0
+L51: rts
+prn -230
+L52: inc @r3
+jsr @r3
+clr @r1
+L53: red L59
+m4
+dec L37
+L54: mov @r6, L29
+bne L42
+prn L57
+jmp L24
+sub @r6, L22
+prn -324
+inc D0
+bne @r1
+lea L48, L53
+L55: add @r4, @r0
+cmp L25, S6
+L56: rts
+L57: clr S7
+cmp -198, L51
+cmp -130, @r6
+rts
+red D0
+jsr L31
+clr L57
+add -120, @r7
+mov -510, @r2
+dec @r1
+add L59, @r6
+m3
+jmp L9
+inc S6
+dec @r6
+L58: jmp L42
+red @r0
+sub L59, D0
+L59: inc @r0
+jmp L9
+inc @r1
+inc D0
+stop
+D0: .data -430,371,194,-183,292,-217,-251,256,-186,-207
+D1: .data 136,52,50,-390,-2,389,494,-244,300,-113
+D2: .data 279,-29,-24,110,98,-423,248,-488,-273,411
+D3: .data -43,-25,381,248,95,201,391,172,-361,400
+D4: .data 22,-377,-230,-381,-104,432,78,229,-262,212
+D5: .data 152,-431,-165,-169,223,-398,-420,328,-58,-147
+D6: .data 439,119,403,-396,-494,422,-234,303,-211,-363
+D7: .data 89,-59,176,384,130,-486,246,-358,256,-382
+D8: .data 70,-104,-349,116,476,-251,-305,-38,428,487
+D9: .data -482,104,226,333,-71,434,63,-182,-202,-14
+S0: .string "gmwsicpuxf"
+S1: .string "smnzqkuygyzvbgvee"
+S2: .string "iibzfsj"
+S3: .string "fbbourtrjz"
+S4: .string "xn"
+S5: .string "xbqe"
+S6: .string "mhqcgfkiq"
+S7: .string "opidz"
+S8: .string "niczhfpzkznhd"
+S9: .string "xfdvjhhmq"
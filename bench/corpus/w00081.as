@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r5
+    prn 70
+endmcro
+mcro m1
+    sub @r4, @r4
+    prn 51
+endmcro
+mcro m2
+    sub @r1, @r2
+    prn 71
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 72
+endmcro
+mcro m4
+    sub @r0, @r3
+    prn 1
+endmcro
+add @r4, L0
+dec @r4
+bne L0
+add -87, L0
+L0: mov -104, S1
+dec L0
+bne @r0
+m0
+jmp L0
+mov L47, @r4
+cmp @r7, L0
+jmp L0
+rts
+L1: bne L13
+rts
+inc @r5
+mov L1, L1
+jsr L1
+L2: dec L1
+L3: cmp -16, L1
+red L3
+jsr @r2
+not L2
+prn L8
+jsr @r2
+jmp @r1
+m4
+rts
+add -206, L0
+sub -21, @r2
+m1
+not @r2
+add -324, @r5
+mov -172, @r3
+jmp L2
+bne L1
+clr L0
+m1
+jsr @r4
+add @r4, @r0
+prn -327
+m3
+clr D0
+L4: rts
+inc L2
+inc @r1
+red @r1
+sub 359, L0
+clr @r6
+dec L1
+m4
+jmp L0
+bne @r6
+jsr @r3
+rts
+rts
+mov -345, L3
+add -361, @r7
+prn L2
+clr @r7
+sub @r6, L2
+m2
+bne @r2
+inc @r4
+m0
+prn 20
+jsr S6
+lea L0, L4
+L5: jsr L4
+jsr @r7
+clr @r1
+L6: cmp 108, -170
+m3
+prn L0
+lea L1, @r4
+not L2
+rts
+L7: jsr @r4
+m1
+prn -430
+sub L3, @r2
+red @r7
+red @r2
+red L4
+mov 42, @r7
+L8: sub 112, @r5
+cmp 57, -354
+m4
+mov L6, @r3
+jmp @r5
+jmp L1
+dec @r1
+clr L8
+jsr L12
+jsr @r2
+dec @r4
+add L8, @r4
+mov @r5, L4
+lea L8, @r1
+clr @r5
+sub @r2, L5
+sub 55, L7
+L9: add 19, L3
+m1
+lea L3, L7
+inc L8
+L10: dec @r5
+m1
+clr @r4
+dec @r7
+jsr @r0
+clr @r0
+dec @r0
+inc D0
+bne @r5
+jsr @r5
+L11: inc L8
+not L10
+L12: add @r6, @r6
+rts
+m0
+red L1
+rts
+inc L2
+mov L2, L9
+not @r1
+jmp @r7
+m2
+cmp -485, @r4
+lea L1, @r2
+add L6, L10
+add -318, @r0
+m4
+lea L9, L11
+sub L12, L0
+L13: lea L6, L6
+jmp @r4
+dec L6
+cmp @r4, L0
+dec @r2
+m1
+dec @r1
+red @r3
+jsr X0
+add S0, L11
+L14: not L8
+prn 325
+jmp S8
+jsr @r4
+m2
+jsr @r7
+lea L2, @r1
+cmp L2, @r6
+mov @r0, @r3
+L15: inc @r0
+rts
+not @r7
+lea L12, @r6
+add X1, L3
+dec @r2
+bne L2
+L16: clr @r4
+red L2
+L17: mov @r5, L17
+L18: clr @r1
+m1
+clr L12
+rts
+dec @r3
+add L18, @r6
+bne @r2
+jsr L5
+jsr @r4
+rts
+lea X2, @r1
+prn 276
+prn @r3
+dec L14
+lea L10, L3
+add -225, L1
+dec @r2
+clr L18
+add L15, @r7
+jmp @r0
+red L2
+L19: bne @r1
+jsr L15
+jsr L11
+mov L10, L6
+prn 14
+rts
+lea L0, @r4
+clr @r0
+red @r5
+lea L10, @r3
+L20: cmp -474, @r7
+dec @r3
+add @r3, L13
+m4
+red D0
+rts
+dec L4
+bne L43
+rts
+jmp L3
+red L6
+L21: add L3, L8
+m2
+jsr L6
+jmp L39
+dec L18
+lea L0, L4
+bne @r5
+lea L20, L17
+L22: jsr L8
+rts
+bne @r7
+prn @r2
+prn L22
+m3
+mov 511, L10
+lea L1, @r7
+mov @r0, L15
+jsr @r4
+mov L6, @r3
+clr @r6
+jsr @r0
+L23: clr L17
+jsr L17
+inc L23
+prn 324
+red @r0
+red L10
+not L1
+inc L12
+jmp @r1
+cmp 140, @r5
+dec L0
+L24: cmp L20, 433
+sub L24, L6
+red L22
+add L2, L8
+L25: rts
+lea L19, L12
+L26: jmp @r7
+m2
+jmp @r1
+add -171, L34
+L27: dec @r4
+add -58, L13
+jmp L19
+rts
+sub -26, @r5
+clr L10
+m0
+mov L14, @r5
+lea L1, @r2
+rts
+L28: jsr D0
+inc L0
+jmp L17
+m0
+m3
+jsr @r4
+jmp @r1
+add @r7, @r7
+L29: add L15, @r2
+jmp S4
+L30: cmp -43, 97
+prn L15
+inc L10
+jmp L2
+rts
+cmp @r2, @r5
+not @r0
+m0
+mov L24, L24
+m3
+sub 459, L4
+m2
+L31: dec @r1
+add L31, @r6
+prn @r3
+red @r6
+not X3
+m3
+dec @r1
+rts
+dec S2
+add 430, @r7
+jmp @r2
+L32: dec L22
+prn -163
+red L6
+not @r7
+clr L4
+jmp @r0
+clr @r5
+red L47
+red @r0
+sub @r0, L28
+inc @r5
+cmp -468, @r6
+L33: prn @r6
+mov @r4, @r7
+not @r7
+mov -139, @r4
+L34: cmp -272, @r0
+red L17
+cmp 165, L20
+mov L13, L12
+clr L17
+red @r0
+m3
+jsr @r1
+sub L31, L39
+prn @r5
+sub L14, @r0
+red L9
+sub @r0, L34
+L35: jmp @r1
+bne @r1
+inc L26
+clr @r3
+prn @r2
+clr @r5
+prn -211
+cmp -126, L32
+jmp @r7
+sub L19, @r1
+jsr @r1
+lea L6, L10
+clr @r6
+bne L17
+cmp @r5, @r0
+L36: add L21, @r5
+m0
+L37: red L36
+m1
+m4
+mov L16, @r3
+cmp @r4, 345
+L38: prn @r7
+sub @r5, L9
+lea L44, @r4
+add 140, @r0
+jsr @r7
+L39: cmp L34, L32
+inc L16
+L40: jmp @r4
+rts
+lea L53, @r4
+dec @r1
+cmp @r5, @r6
+m1
+mov L13, @r1
+L41: add L4, @r3
+cmp L55, @r6
+bne @r0
+L42: add 452, L58
+cmp @r3, 502
+L43: add L47, @r4
+L44: clr L58
+L45: red L33
+not @r6
+red @r4
+rts
+L46: red L54
+prn @r6
+m1
+dec L7
+cmp L5, 46
+not L7
+clr @r7
+L47: lea L12, L12
+L48: inc @r1
+not @r3
+prn L33
+inc L21
+jsr @r6
+dec @r7
+prn @r2
+L49: jmp @r2
+jmp L45
+L50: lea L25, @r2
+L51: sub 297, @r2
+lea L40, @r6
+dec @r7
+jsr @r4
+dec D0
+m2
+L52: inc L57
+mov @r6, @r7
+red @r0
+add 372, @r7
+lea L58, @r5
+rts
+lea L31, L52
+dec @r3
+L53: lea L45, @r5
+sub 111, L43
+jsr @r1
+lea L17, @r6
+cmp S2, 298
+dec @r2
+inc L46
+clr L32
+clr @r5
+lea L13, @r6
+mov @r4, @r3
+jsr @r3
+L54: jsr @r0
+jsr S4
+L55: sub 394, @r2
+lea L59, L58
+mov @r0, L25
+jsr L58
+L56: jsr @r2
+jsr @r0
+sub L4, @r6
+m3
+add @r6, @r1
+lea L51, D0
+inc L27
+red L58
+L57: not @r5
+bne @r3
+mov @r2, X4
+not L45
+inc @r6
+dec L58
+prn 95
+sub -211, @r7
+red L53
+m4
+L58: lea L59, @r1
+sub @r0, D0
+m4
+inc L24
+L59: mov S6, L48
+stop
+D0: .data 132,-265,-213,-114,-374,371,160,32,210,-245
+D1: .data 105,-448,357,97,-325,-346,-184,362,-376,152
+D2: .data -64,457,268,-412,-419,476,332,-247,52,-82
+D3: .data 393,234,-144,-332,385,227,-73,-121,67,-365
+D4: .data 361,111,471,-456,-205,77,-248,103,112,190
+D5: .data -234,-224,62,-343,63,-201,205,-192,380,-176
+D6: .data -337,-132,-265,323,28,29,389,-438,-283,-194
+D7: .data 417,-158,-405,242,302,-90,-45,-197,122,86
+D8: .data -360,38,183,147,-273,-483,166,-290,-93,-217
+D9: .data -338,446,-73,461,-93,155,-350,251,-388,210
+S0: .string "lgyhjkes"
+S1: .string "cstcaqtrvphhbxkaesk"
+S2: .string "lhkswgjkmzbiv"
+S3: .string "cbtepeaxsts"
+S4: .string "cfmgxkkkunkmidpiag"
+S5: .string "fjfkulizkqpaktd"
+S6: .string "ycqjkgpeuwmgezxbz"
+S7: .string "czlcydeasuvnju"
+S8: .string "ohudusi"
+S9: .string "fydlihe"
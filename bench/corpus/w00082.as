@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r0
+    prn 41
+endmcro
+mcro m1
+    sub @r0, @r5
+    prn 50
+endmcro
+mcro m2
+    sub @r3, @r0
+    prn 37
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 49
+endmcro
+mcro m4
+    sub @r2, @r1
+    prn 25
+endmcro
+mov 498, L0
+jsr @r0
+prn @r1
+red L0
+cmp -5, 165
+jsr L0
+jmp @r7
+add L0, @r1
+inc L0
+sub @r5, L0
+lea L0, @r3
+m1
+jmp @r6
+m3
+rts
+sub L0, L0
+sub L0, @r4
+jmp @r4
+prn @r0
+red D0
+jsr @r5
+add @r3, D0
+lea L0, @r2
+rts
+L0: prn @r4
+mov @r2, @r2
+inc @r0
+clr L0
+L1: dec L0
+m0
+inc @r2
+m4
+jmp L1
+clr @r3
+prn -312
+L2: jmp @r3
+add @r4, D0
+bne L0
+not @r2
+m1
+m0
+inc @r4
+lea X0, @r5
+L3: jmp @r5
+clr @r1
+cmp @r5, L2
+cmp L3, L1
+inc @r2
+inc @r7
+cmp L2, L2
+red L3
+red @r2
+jsr L2
+m4
+bne @r6
+m0
+prn L2
+add L0, L1
+L4: mov 138, L1
+bne L3
+L5: clr L3
+mov L4, S8
+mov L0, L3
+L6: rts
+clr L4
+inc @r1
+L7: prn @r0
+L8: sub @r4, @r7
+clr L2
+prn @r6
+L9: cmp L1, @r1
+sub -52, L7
+dec @r0
+add -62, @r4
+m1
+bne L7
+clr @r7
+L10: sub 274, @r7
+prn @r4
+bne @r3
+lea L6, L3
+inc @r6
+cmp -492, L8
+red @r1
+jsr @r3
+mov L2, @r5
+m3
+dec @r6
+jsr @r2
+sub @r3, @r5
+L11: lea L5, L11
+rts
+inc @r1
+jsr L7
+inc @r7
+prn -182
+L12: red @r7
+jsr @r0
+bne @r7
+rts
+jsr S3
+clr S7
+rts
+bne @r3
+clr @r4
+mov -58, L7
+lea L7, @r5
+clr L5
+lea L0, L6
+cmp L6, L6
+rts
+add 255, L0
+mov @r6, L5
+jsr L0
+not L28
+jsr @r0
+cmp @r7, L8
+red @r2
+mov 130, @r5
+inc L9
+mov -117, L5
+jsr @r1
+prn -495
+mov L2, @r1
+rts
+prn -196
+lea L1, L12
+m0
+clr @r7
+mov -129, @r2
+dec L6
+jmp @r3
+add L7, L2
+rts
+add L3, L0
+lea L3, L6
+jmp D0
+not @r1
+lea L12, L4
+bne @r4
+red L4
+dec L4
+L13: add -43, L6
+mov @r4, @r4
+rts
+L14: clr @r6
+m3
+sub @r0, X1
+inc L6
+bne L5
+not L12
+prn @r5
+jsr L9
+L15: jsr @r7
+m4
+L16: clr @r2
+m3
+add -473, L7
+lea L0, @r4
+L17: cmp L8, @r6
+add L0, @r3
+rts
+jmp @r6
+cmp -328, @r4
+bne @r4
+L18: clr L47
+not @r4
+not L2
+dec @r0
+red L12
+bne L7
+prn -506
+jmp @r7
+add -459, @r4
+mov @r1, L5
+inc @r0
+bne S2
+lea L8, @r5
+mov @r7, @r5
+clr @r4
+inc @r7
+m2
+clr @r5
+lea L13, @r1
+L19: bne @r7
+not L0
+dec L2
+clr L13
+L20: bne @r3
+jsr @r7
+mov L15, @r1
+clr S9
+lea L18, @r6
+lea L6, L2
+jmp @r1
+not @r0
+m2
+dec @r7
+sub L11, L12
+mov 369, @r1
+add L18, @r3
+mov L9, @r1
+prn -68
+L21: red L11
+m3
+add L24, @r7
+m2
+lea L8, L15
+red @r4
+m0
+prn @r1
+jmp L5
+cmp L10, L35
+cmp @r4, -129
+cmp L11, -489
+not @r6
+inc @r1
+prn L15
+cmp -105, 100
+bne L12
+mov L5, L22
+not @r3
+bne L15
+not L12
+L22: red @r2
+m3
+L23: bne @r0
+m2
+not L4
+L24: dec @r4
+lea L15, L7
+jsr @r5
+dec @r0
+m4
+dec @r2
+dec L1
+clr L3
+L25: inc @r0
+L26: prn L7
+red @r4
+m1
+inc @r1
+mov @r4, L15
+clr @r1
+m0
+sub @r5, @r6
+sub @r0, @r7
+L27: red @r5
+L28: rts
+mov L17, L21
+red @r5
+L29: jsr L19
+inc L22
+lea L10, L25
+jmp L12
+clr @r1
+inc L18
+inc L10
+inc @r4
+mov L3, D0
+rts
+m3
+sub @r4, L0
+inc @r5
+L30: red L4
+m2
+sub L10, @r7
+L31: dec @r3
+inc L2
+inc @r0
+cmp @r1, L18
+bne L7
+clr @r3
+jsr L2
+lea L6, L28
+L32: jmp L25
+L33: add L10, @r1
+m2
+mov L32, @r4
+L34: mov L10, L30
+bne L30
+jmp L7
+jsr L21
+rts
+not @r3
+L35: sub -396, @r7
+L36: lea L4, @r7
+inc @r7
+red L9
+lea L35, @r0
+sub @r4, L33
+clr L8
+add @r3, L22
+L37: prn L16
+lea L26, @r5
+m3
+lea L15, L27
+inc @r4
+clr @r4
+rts
+not L4
+sub @r3, @r4
+L38: bne L11
+cmp @r0, X2
+cmp @r0, @r6
+add L13, L30
+mov -334, L16
+m4
+clr L30
+L39: prn @r6
+L40: mov L13, L7
+jsr L16
+cmp L32, L58
+jmp L30
+jmp @r3
+mov @r1, @r7
+dec L33
+dec L25
+L41: clr @r5
+m0
+L42: not L0
+cmp @r6, L9
+L43: clr @r7
+mov L12, L11
+mov @r1, @r1
+clr L49
+rts
+clr L24
+jmp D0
+bne @r1
+L44: rts
+lea L39, S5
+sub L40, L2
+red L32
+prn 120
+bne L6
+L45: rts
+jmp @r7
+clr @r3
+inc @r6
+jsr L20
+lea L24, @r7
+m0
+jsr L53
+rts
+add 290, L9
+L46: lea L31, L47
+bne @r6
+sub @r4, D0
+prn @r5
+lea L43, L26
+jmp L11
+sub @r4, S8
+bne @r5
+clr @r7
+L47: jmp @r1
+m3
+clr L13
+add @r7, @r2
+m2
+L48: prn 35
+L49: clr L13
+sub @r1, @r7
+sub -403, L36
+m4
+rts
+jsr @r3
+prn @r0
+cmp @r6, -411
+sub L48, @r5
+rts
+jsr L23
+clr @r1
+cmp 444, @r6
+jsr @r6
+jmp @r7
+L50: inc L25
+clr L16
+bne L12
+sub 107, L27
+inc @r3
+L51: add 110, @r3
+red @r3
+bne D0
+L52: inc L41
+not @r4
+red L17
+jsr L23
+m4
+rts
+L53: bne L38
+cmp @r2, 298
+m3
+m3
+inc @r0
+L54: jsr @r4
+bne @r0
+sub -64, L19
+not L13
+sub D0, L30
+rts
+L55: inc L59
+bne @r2
+jsr @r7
+lea S7, @r2
+rts
+not L48
+add @r3, D0
+clr @r6
+jmp L36
+sub L19, @r1
+cmp @r6, @r3
+bne @r6
+clr @r7
+jsr L36
+not L23
+not L29
+lea L57, @r0
+m3
+sub -387, L58
+not @r4
+cmp L8, @r7
+red @r6
+L56: lea L39, @r2
+lea L54, L3
+sub L8, @r7
+lea L57, @r6
+L57: clr X3
+m1
+L58: add 191, L51
+m0
+red S1
+L59: dec S3
+mov D0, S2
+add D0, S9
+mov D0, @r4
+sub @r5, L21
+red X4
+inc D0
+mov D0, @r4
+stop
+D0: .data -261,178,-189,143,143,34,-50,-392,112,-300
+D1: .data -476,421,-304,-419,208,-264,-419,-177,486,-237
+D2: .data 181,-205,-240,-65,2,472,68,236,198,424
+D3: .data 112,-493,464,-483,-165,-189,313,121,177,-492
+D4: .data -210,427,-379,417,-47,206,383,-5,-479,161
+D5: .data -222,-270,-207,217,382,60,-297,-37,284,106
+D6: .data 359,-374,-241,373,-59,-133,-254,-131,-192,-463
+D7: .data -285,-244,-313,127,384,-426,-173,424,-358,409
+D8: .data 438,-75,-155,393,-40,-100,-107,-97,-174,142
+D9: .data -46,-347,-148,284,374,-242,61,-26,-75,-17
+S0: .string "ffwwuutdkiurioqqsebl"
+S1: .string "hh"
+S2: .string "kh"
+S3: .string "hcagrs"
+S4: .string "qczdxtd"
+S5: .string "yqioysugpg"
+S6: .string "nktvoruftsc"
+S7: .string "nnrnrtyzapskueitqbwz"
+S8: .string "zngzryswjqwmchoxzau"
+S9: .string "ci"
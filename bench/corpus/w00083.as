@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r2
+    prn 79
+endmcro
+mcro m1
+    sub @r4, @r6
+    prn 16
+endmcro
+mcro m2
+    sub @r5, @r6
+    prn 2
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 25
+endmcro
+mcro m4
+    sub @r4, @r7
+    prn 50
+endmcro
+clr L0
+m3
+prn @r4
+jsr L50
+prn 159
+jmp L0
+add L0, @r0
+m3
+clr @r3
+add L28, @r7
+L0: cmp @r3, L0
+mov -487, @r1
+inc L0
+jsr L0
+L1: red @r4
+dec L0
+lea L0, L1
+prn @r2
+cmp L0, @r7
+m4
+m4
+bne @r5
+not @r1
+jmp L1
+not L1
+L2: rts
+red L1
+jmp @r0
+jmp L0
+sub @r1, @r0
+add L1, L2
+lea L0, @r0
+cmp @r3, L1
+lea L1, @r3
+cmp @r6, L0
+bne @r4
+mov X0, L1
+bne L0
+sub L2, @r0
+jsr L2
+jsr L1
+mov L2, @r2
+red @r5
+red L2
+L3: dec @r5
+cmp L2, 316
+lea L0, @r2
+prn @r2
+bne @r0
+lea L2, L1
+jsr L1
+clr @r7
+prn @r3
+not @r1
+clr @r2
+red L1
+not L1
+jmp L2
+inc @r7
+clr @r2
+add @r2, @r1
+not L2
+jsr @r6
+lea L2, L3
+L4: lea L0, @r7
+mov L2, @r7
+L5: rts
+prn L5
+prn @r6
+sub -76, @r4
+red L4
+red @r6
+dec @r1
+inc L2
+dec L5
+m1
+prn @r4
+L6: jsr L6
+L7: jmp @r0
+cmp 394, L3
+L8: jmp L0
+cmp -475, @r5
+inc L8
+sub @r0, @r3
+jsr L12
+m4
+cmp @r3, L4
+mov @r0, @r4
+red @r3
+m2
+inc L0
+jsr L2
+sub @r0, @r7
+m1
+prn @r1
+L9: prn @r5
+sub @r6, @r1
+dec @r5
+bne @r6
+m4
+dec @r4
+cmp L8, 200
+red L0
+clr L1
+jsr L6
+red @r3
+mov 337, L1
+clr L9
+not @r5
+clr @r1
+rts
+prn @r0
+m2
+mov 341, L9
+prn @r3
+m3
+L10: prn @r5
+red L10
+inc @r7
+m1
+mov 8, @r0
+jmp @r6
+L11: red @r7
+sub -88, S7
+cmp L2, L7
+bne L6
+clr @r1
+jmp L7
+red L0
+sub L3, @r7
+L12: rts
+not L3
+bne @r1
+inc X1
+lea L4, L8
+m4
+clr @r3
+jmp @r0
+not @r3
+prn L1
+L13: mov L10, L50
+jsr L9
+red L1
+rts
+jmp @r5
+red @r4
+prn L13
+mov @r1, @r5
+prn 174
+sub L11, @r4
+red L6
+red L9
+prn 481
+m1
+lea L12, L5
+sub -276, L12
+jsr L12
+sub L8, @r4
+cmp -305, @r0
+lea L54, L14
+clr @r4
+sub @r7, L7
+not @r7
+jmp L1
+cmp @r0, @r3
+dec @r1
+dec L30
+red L9
+bne L10
+mov -224, L6
+L14: not @r2
+jmp D0
+add L3, @r3
+jmp L1
+lea L6, L5
+L15: clr @r3
+L16: inc L13
+add @r2, L3
+jsr @r4
+not @r2
+mov @r4, L4
+L17: lea L9, L15
+lea L1, L14
+m2
+m1
+add -222, L8
+add @r1, L9
+not L16
+L18: red L9
+mov 325, @r1
+clr @r0
+m1
+L19: jsr L1
+dec @r5
+L20: not L17
+L21: lea S6, L6
+lea S0, @r4
+not L17
+dec L18
+L22: mov L1, L15
+prn @r5
+L23: rts
+m3
+prn 447
+sub 284, L20
+sub -45, @r7
+rts
+sub L8, @r5
+dec L15
+rts
+prn L16
+not L6
+L24: inc @r3
+jmp S8
+jmp @r1
+sub L9, X2
+cmp -453, -437
+clr L18
+sub -297, @r0
+red @r2
+mov -104, @r4
+m1
+clr @r0
+inc @r1
+inc L2
+rts
+jmp L12
+add @r4, L2
+m2
+jmp @r5
+prn -429
+prn @r4
+L25: jmp L19
+mov -241, @r3
+cmp -109, @r6
+m2
+lea L19, @r5
+not @r4
+not @r7
+L26: not @r0
+red L22
+jsr @r2
+not L25
+bne @r4
+cmp @r2, 437
+cmp @r7, -280
+mov -32, L20
+jsr L6
+mov L8, L12
+jmp L14
+rts
+mov 402, L0
+clr @r3
+cmp -173, L12
+m2
+cmp L22, -384
+bne @r6
+L27: mov D0, L11
+L28: mov @r1, L15
+L29: cmp @r7, @r6
+inc @r2
+L30: rts
+cmp @r5, 383
+bne @r1
+jsr @r7
+jmp L3
+lea L21, L36
+inc D0
+add L28, @r7
+not L10
+prn 446
+inc @r3
+sub @r5, L9
+L31: add L15, @r0
+clr L22
+L32: jmp L28
+add L31, L29
+inc L27
+m0
+L33: jsr L18
+cmp L13, L9
+jmp @r3
+mov 388, L11
+cmp L28, D0
+clr S5
+red @r7
+prn L12
+add -168, L18
+jmp L33
+m0
+rts
+red @r2
+lea L25, L14
+L34: prn @r1
+L35: jsr L9
+L36: rts
+dec @r1
+bne @r1
+jmp @r7
+add -70, @r5
+mov @r2, @r3
+not L1
+bne @r7
+m2
+m0
+jmp @r0
+jsr @r1
+lea L0, L6
+m2
+L37: prn 427
+inc @r5
+inc L2
+mov L8, @r4
+L38: cmp L5, @r5
+red @r0
+add 157, D0
+cmp L17, L10
+m1
+L39: dec @r3
+sub -125, @r5
+bne @r6
+L40: inc @r2
+inc @r1
+rts
+prn -449
+not X3
+m1
+add D0, L3
+clr L38
+m0
+add @r0, L25
+dec S1
+clr @r0
+L41: prn @r2
+m2
+prn L1
+inc L33
+L42: lea L14, L14
+L43: rts
+L44: clr L30
+bne @r1
+red @r5
+sub -93, L25
+red @r1
+mov L22, L24
+L45: jmp @r0
+red @r4
+add @r2, L57
+dec L43
+m0
+lea L42, L10
+L46: not @r4
+m0
+jsr L51
+prn -41
+clr @r6
+dec L12
+inc L33
+inc S5
+L47: bne @r1
+sub L26, L18
+sub @r7, @r6
+L48: cmp -319, 465
+add L38, @r0
+red @r0
+clr @r2
+bne L56
+add @r3, D0
+jmp L37
+inc L2
+mov 63, @r2
+jmp @r3
+m4
+prn -143
+sub S5, @r1
+m3
+lea L17, L33
+red @r1
+rts
+dec @r0
+bne L20
+clr @r3
+red S5
+sub 255, S2
+bne L0
+jsr L1
+mov L2, L41
+add L36, L20
+m0
+jsr @r0
+L49: jsr @r4
+not @r1
+dec @r5
+bne @r1
+mov L37, L46
+prn @r7
+jmp @r1
+L50: red @r1
+dec @r6
+not @r2
+inc @r1
+jsr @r2
+prn -85
+m1
+not @r5
+add L1, L59
+jsr X4
+L51: dec @r7
+L52: clr @r2
+not L57
+bne @r7
+sub D0, @r3
+rts
+jsr @r3
+jmp S7
+add @r3, L8
+not S5
+dec L52
+jmp @r4
+mov L2, @r0
+L53: bne @r3
+dec L59
+m0
+m3
+bne L55
+L54: jsr @r6
+L55: mov 221, L40
+L56: not @r6
+bne L41
+jsr @r1
+add -63, @r6
+m0
+L57: not L34
+bne L58
+clr L4
+bne @r6
+L58: mov L59, @r6
+L59: sub S1, @r7
+rts
+lea S4, S2
+stop
+D0: .data 258,-297,156,327,-412,209,101,231,-460,-272
+D1: .data 249,-261,-240,-132,234,369,-60,-335,360,290
+D2: .data -249,-178,-86,-488,-170,44,112,52,177,427
+D3: .data -4,-451,-161,154,493,-186,176,360,-327,-261
+D4: .data -481,-312,-190,119,-81,-419,224,494,241,-234
+D5: .data -11,286,200,416,115,364,-5,-77,-341,-198
+D6: .data 21,-90,-496,-217,-425,-323,480,369,7,422
+D7: .data 220,465,352,-192,-428,-165,71,47,-190,156
+D8: .data -96,11,128,125,-359,293,19,-139,-179,-222
+D9: .data 133,400,-181,325,-496,-61,-431,285,-156,-348
+S0: .string "hilesqolvnugjjncguo"
+S1: .string "coyecghhpiua"
+S2: .string "hyvjawemsegpil"
+S3: .string "wtapnocatxem"
+S4: .string "eychkfqks"
+S5: .string "kdqbutrbry"
+S6: .string "qmxrpnljusooqrhw"
+S7: .string "ruifyfexqhqhazvhohq"
+S8: .string "iiqtfxisyiwolwqbrbs"
+S9: .string "mjnktgptf"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r5
+    prn 49
+endmcro
+mcro m1
+    sub @r1, @r7
+    prn 15
+endmcro
+mcro m2
+    sub @r7, @r4
+    prn 67
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 1
+endmcro
+mcro m4
+    sub @r7, @r5
+    prn 74
+endmcro
+red L0
+prn L0
+lea L0, @r5
+dec @r1
+rts
+L0: mov @r6, L0
+m0
+add L0, @r6
+not @r3
+dec @r1
+rts
+cmp L0, @r2
+jmp L23
+inc @r4
+not @r2
+cmp 476, L0
+clr L0
+lea D0, L0
+inc @r2
+L1: prn -163
+clr L0
+bne L1
+jmp @r7
+prn -347
+not L0
+lea X0, L1
+m3
+bne X1
+clr @r6
+mov S4, @r2
+prn L1
+dec @r7
+clr @r0
+bne @r2
+inc L1
+cmp 273, 203
+L2: mov L0, L15
+m3
+bne @r3
+inc @r6
+not L0
+bne D0
+add 362, L1
+inc L1
+jsr @r3
+red L0
+L3: jmp L0
+prn -477
+cmp -415, 405
+L4: prn L3
+lea S6, D0
+bne L0
+clr @r4
+bne L3
+L5: rts
+prn @r1
+mov L21, L1
+clr L5
+L6: jmp L3
+prn @r5
+rts
+dec L6
+add @r6, @r3
+lea L2, @r3
+prn L0
+dec L2
+add L5, @r5
+m3
+clr @r2
+lea L3, @r3
+sub L2, @r4
+cmp @r4, -299
+not L0
+clr L0
+m3
+jmp @r1
+rts
+m0
+L7: rts
+prn L3
+bne L3
+lea L47, L0
+not @r5
+not @r7
+inc L41
+m4
+bne L7
+L8: clr @r1
+dec L0
+cmp L3, 509
+jsr L0
+dec @r2
+bne @r6
+m3
+lea L4, L2
+lea L5, @r7
+not @r7
+m3
+sub @r7, @r0
+m3
+jsr L1
+dec @r5
+add L3, @r2
+prn L7
+bne L5
+m1
+not L7
+cmp 41, @r4
+m3
+jsr @r3
+jsr @r7
+L9: sub L0, @r7
+clr @r3
+jmp L5
+lea L1, L0
+dec @r5
+m1
+L10: rts
+L11: jsr L37
+cmp L5, L6
+L12: clr @r5
+bne L1
+inc @r1
+dec L4
+jsr @r3
+clr L6
+sub @r3, L11
+m4
+cmp L12, L3
+L13: lea L0, L3
+L14: cmp 84, @r2
+dec @r1
+red @r5
+jsr @r4
+add L7, L1
+L15: mov @r2, L1
+m0
+jmp @r7
+cmp 181, L4
+dec @r5
+not @r1
+rts
+jmp L10
+L16: rts
+mov @r0, @r4
+dec L14
+sub -37, L10
+jmp L0
+L17: jsr L2
+m1
+L18: rts
+add -181, @r3
+L19: sub L42, L0
+L20: red L9
+add -47, @r5
+mov L14, @r6
+m1
+inc L1
+dec L11
+dec L12
+rts
+L21: dec @r3
+rts
+L22: dec @r1
+m0
+not L15
+clr @r5
+sub L13, @r7
+add 389, @r1
+dec L10
+bne L4
+m1
+mov -105, L11
+lea L11, L9
+L23: jmp @r3
+mov @r1, @r6
+rts
+dec @r5
+red L10
+m2
+red L19
+clr L17
+mov -147, @r6
+L24: lea L3, L32
+L25: mov 104, @r2
+lea L22, @r4
+red @r3
+not @r5
+clr L7
+not L34
+clr L19
+lea L25, @r0
+red @r2
+L26: bne @r0
+L27: dec L0
+lea L24, @r1
+m1
+lea L10, L23
+L28: dec L9
+cmp @r2, L10
+cmp L26, 155
+jmp L0
+jsr @r7
+jsr @r5
+m2
+clr @r4
+rts
+jmp L2
+cmp L22, @r3
+dec @r7
+red @r2
+dec @r2
+jsr L2
+sub @r6, L12
+jmp @r4
+mov 422, @r5
+inc @r4
+cmp L21, @r0
+dec @r6
+sub L6, @r2
+L29: rts
+m2
+m4
+cmp L7, 399
+m4
+jmp L23
+jsr L5
+mov 462, L10
+not @r4
+inc @r4
+m2
+cmp L11, L0
+rts
+inc L25
+lea S2, @r4
+add L5, L19
+prn @r5
+m2
+jsr D0
+prn S9
+sub @r6, L27
+add 238, L16
+not L29
+lea L13, @r7
+prn L25
+cmp 147, @r0
+cmp L11, 411
+bne L1
+inc L25
+lea L2, @r2
+bne @r6
+not @r2
+jsr L24
+dec @r5
+L30: clr @r0
+sub L22, L9
+red @r7
+L31: mov -184, X2
+add L20, @r6
+mov @r5, @r5
+clr @r6
+m1
+clr L8
+red @r3
+mov L30, @r6
+clr L1
+rts
+rts
+rts
+mov L22, @r7
+clr @r7
+jsr @r7
+sub @r0, L18
+jsr L21
+dec L31
+bne @r0
+add @r5, @r6
+not @r3
+L32: sub @r0, L46
+sub 317, @r3
+jsr L21
+L33: lea L13, L50
+dec @r5
+prn -180
+m1
+red L1
+red L22
+clr L13
+cmp L20, L18
+sub -81, @r7
+mov -372, L17
+clr L5
+dec L16
+L34: bne @r6
+not @r4
+jmp @r1
+m3
+jsr L13
+m3
+prn -238
+red L34
+rts
+L35: add @r5, L26
+not L35
+cmp -486, L30
+L36: red @r1
+rts
+sub L5, @r5
+jsr S7
+prn @r3
+L37: mov @r1, @r0
+jsr L16
+sub X3, @r4
+m4
+jmp L20
+cmp 51, L27
+inc @r7
+mov 118, L25
+m0
+red @r0
+clr D0
+rts
+L38: mov -334, @r3
+add L49, L38
+L39: lea L4, L11
+L40: mov @r6, L39
+jsr @r7
+lea L8, @r6
+L41: cmp @r6, -170
+jmp @r3
+m2
+bne @r3
+rts
+not @r4
+not @r4
+add -102, L8
+lea L29, L0
+mov 455, L29
+not @r3
+L42: rts
+rts
+L43: jsr @r0
+dec L43
+L44: sub L17, @r4
+m0
+L45: rts
+cmp -262, L5
+m2
+jmp @r5
+L46: lea L25, @r1
+mov 171, @r7
+jmp L4
+red L44
+bne @r5
+sub @r6, L31
+add L24, @r4
+L47: add -369, @r6
+red @r6
+L48: clr L4
+L49: rts
+jsr @r7
+clr S6
+sub L9, @r7
+m2
+jmp L46
+L50: dec L2
+lea L20, L48
+sub 63, @r5
+not @r3
+jmp L22
+not @r5
+L51: rts
+add @r0, L17
+red L48
+bne @r5
+bne L39
+rts
+rts
+jmp @r4
+clr L40
+cmp @r0, -21
+L52: dec S4
+red @r2
+m2
+rts
+L53: sub @r7, D0
+cmp L58, @r7
+mov 322, @r0
+L54: jmp L24
+jmp @r4
+clr L2
+sub S3, @r3
+red L11
+clr @r3
+not L4
+prn 232
+dec @r3
+cmp L39, 387
+jmp @r1
+dec @r7
+red @r2
+not @r3
+bne L22
+sub -449, @r0
+lea L10, @r1
+dec @r0
+dec L58
+sub L30, L41
+not S6
+dec @r7
+L55: red L6
+bne L26
+L56: lea L17, S4
+bne @r3
+m2
+cmp @r1, 428
+sub 246, @r4
+lea L18, L48
+prn L45
+cmp L58, L14
+not @r2
+not L37
+jmp X4
+prn L35
+not D0
+L57: clr L57
+cmp L8, 52
+L58: add S5, S6
+inc @r4
+lea L28, @r6
+sub 475, @r6
+L59: dec @r0
+mov 126, S1
+cmp S6, @r7
+cmp 493, L23
+m4
+clr D0
+red S7
+mov D0, L32
+mov S4, L18
+stop
+D0: .data -320,132,-140,-452,229,458,178,-430,105,-317
+D1: .data -382,176,-70,-286,-262,343,191,325,-141,-419
+D2: .data 382,112,-268,-197,121,-328,330,80,-119,488
+D3: .data -478,265,-369,-35,-348,-118,-454,315,-373,146
+D4: .data -348,-154,16,-385,0,113,-227,322,-408,371
+D5: .data -62,-375,356,470,47,238,210,-452,-490,48
+D6: .data 464,59,83,-385,43,280,38,-330,-28,164
+D7: .data 300,52,295,-402,307,77,-408,-228,-7,276
+D8: .data 348,488,-232,-466,-429,234,-439,-109,467,464
+D9: .data -104,484,-351,-408,-375,-286,68,353,-348,239
+S0: .string "ajeizvsuh"
+S1: .string "dtsnhnv"
+S2: .string "ltd"
+S3: .string "vwhfsrvpdaodyehz"
+S4: .string "ujlpxvimhbvj"
+S5: .string "whinmpbgoqvysqzbrq"
+S6: .string "gtw"
+S7: .string "uh"
+S8: .string "tiucwfvzgvsvrcofjnc"
+S9: .string "rxtruqzlwgae"
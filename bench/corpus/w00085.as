@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r7
+    prn 88
+endmcro
+mcro m1
+    sub @r5, @r1
+    prn 13
+endmcro
+mcro m2
+    sub @r1, @r2
+    prn 33
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 78
+endmcro
+mcro m4
+    sub @r1, @r4
+    prn 98
+endmcro
+add -371, @r3
+red L0
+L0: cmp @r5, @r6
+add L50, @r2
+L1: clr @r3
+cmp L1, @r0
+L2: mov @r0, L1
+sub -494, L1
+rts
+add L2, @r7
+clr L2
+inc @r5
+rts
+rts
+bne @r2
+L3: clr @r2
+red @r3
+cmp @r7, 148
+m2
+cmp -375, @r2
+dec L0
+jmp L47
+sub -108, L2
+m2
+clr @r5
+prn @r5
+not @r3
+add @r4, @r1
+L4: not X0
+dec @r4
+lea L4, @r2
+cmp @r3, L1
+mov @r2, @r0
+red L2
+m2
+sub @r2, @r2
+dec D0
+mov L3, @r0
+L5: sub 340, X1
+mov @r2, L5
+clr @r0
+jsr @r5
+inc L5
+prn @r1
+jsr L5
+cmp L26, L4
+jmp L0
+sub @r1, L3
+sub L0, L0
+L6: bne L2
+mov -465, @r0
+bne L2
+clr L6
+L7: lea L6, @r5
+cmp 291, L0
+L8: bne L4
+mov 86, L5
+jmp L6
+sub @r0, L12
+dec @r3
+cmp @r3, @r0
+not @r4
+L9: sub L5, L1
+lea L7, @r4
+jsr @r5
+add @r2, L7
+bne L8
+m1
+jsr @r0
+jsr L0
+prn @r4
+red L2
+lea L4, L3
+L10: jmp @r6
+clr L10
+red L7
+not L4
+L11: mov 179, L2
+m1
+L12: add L9, @r1
+sub L11, L5
+m1
+sub @r0, L11
+prn L9
+clr @r3
+prn @r4
+not @r6
+jsr L7
+red L5
+lea L4, @r3
+m4
+inc L4
+jmp @r2
+inc L5
+jmp L1
+L13: not L5
+rts
+add L13, @r2
+dec L7
+cmp L10, @r2
+prn L9
+jmp @r1
+red @r6
+L14: lea L13, @r2
+dec L40
+cmp @r7, L5
+clr @r2
+clr L11
+bne @r3
+lea L8, L14
+m4
+rts
+mov -433, L12
+not @r7
+rts
+L15: sub @r3, @r7
+m4
+L16: clr L0
+red L8
+jmp L10
+m4
+add L2, L1
+L17: prn L7
+lea L15, @r5
+bne @r4
+mov -504, L10
+jsr L9
+L18: prn @r6
+mov @r1, L32
+rts
+L19: clr L2
+L20: cmp L9, L23
+L21: red @r5
+sub @r0, @r6
+dec @r0
+mov -222, L5
+sub @r3, @r3
+sub 136, L10
+dec L4
+cmp @r2, @r6
+bne L2
+inc L7
+rts
+L22: bne L17
+L23: jsr L19
+jmp @r0
+not L23
+L24: lea L49, L1
+sub @r1, L20
+mov 112, L23
+jsr @r3
+add L16, L14
+m4
+L25: prn -353
+red L33
+L26: mov 207, @r5
+cmp 29, L8
+dec L32
+m4
+m2
+clr @r4
+clr L18
+m1
+sub -193, @r7
+sub -494, L10
+not @r3
+cmp L18, @r7
+m4
+m3
+L27: lea L24, @r6
+rts
+rts
+add L17, @r7
+lea D0, L12
+jmp L18
+m4
+lea D0, @r6
+lea L7, L25
+not @r0
+not @r6
+cmp @r6, L17
+rts
+L28: lea L15, @r3
+L29: clr @r0
+L30: red @r4
+mov 229, @r4
+clr L10
+add L11, L10
+inc S4
+not @r6
+add D0, L0
+rts
+rts
+prn L15
+m2
+jsr L9
+rts
+L31: mov @r7, @r0
+rts
+cmp D0, @r2
+L32: not L11
+bne L18
+m2
+jmp @r5
+jsr @r6
+m2
+cmp L4, @r0
+prn @r7
+inc @r2
+sub 111, L6
+dec X2
+prn 194
+bne @r4
+cmp L8, L28
+add L3, L1
+prn L19
+lea L2, L4
+not @r5
+L33: not L49
+not L20
+rts
+red L15
+L34: rts
+red L20
+red @r6
+dec @r6
+L35: inc @r7
+jsr @r7
+jsr L31
+sub L35, L18
+rts
+not @r4
+sub @r4, @r5
+mov -437, @r3
+dec L1
+prn 173
+prn L0
+red @r1
+prn 453
+m2
+mov L30, @r6
+bne L23
+red @r3
+red @r1
+sub L10, L4
+mov L34, @r2
+L36: red @r0
+m4
+lea L13, L16
+jmp L32
+mov @r4, @r3
+jmp L13
+not @r6
+red L23
+L37: lea L28, @r6
+mov L30, @r5
+add -55, L25
+L38: rts
+prn 268
+rts
+sub L6, @r6
+m1
+cmp @r6, 106
+dec @r6
+L39: rts
+m4
+sub 25, L32
+jmp L17
+rts
+lea L3, L11
+L40: rts
+clr @r4
+m4
+not L34
+dec @r6
+m1
+jsr @r1
+L41: sub -39, @r6
+m2
+jmp @r0
+m2
+m0
+L42: inc @r1
+bne L0
+prn 13
+not L3
+cmp @r6, @r3
+bne L3
+clr S0
+lea S3, X3
+L43: clr @r2
+red @r7
+cmp @r1, @r4
+inc @r4
+rts
+lea D0, L38
+L44: dec @r1
+add 293, L6
+inc L6
+lea L38, L36
+bne L8
+not @r5
+add -332, L47
+red L59
+not L38
+m4
+prn @r3
+lea L32, @r0
+jmp L44
+red @r0
+inc @r1
+sub L22, @r1
+rts
+clr @r3
+L45: lea L35, @r4
+not L0
+mov L39, @r5
+add L25, @r5
+L46: lea L12, @r1
+m1
+dec @r7
+L47: dec L25
+L48: red @r1
+jsr L15
+inc @r1
+jsr L20
+m2
+clr @r3
+not L14
+L49: dec L6
+red L45
+clr L12
+jsr L8
+lea L18, L24
+not L27
+cmp -271, @r6
+L50: bne L41
+L51: mov @r7, L21
+not L3
+m2
+lea L17, L51
+rts
+lea L50, L40
+bne @r1
+sub @r6, L56
+clr @r7
+sub L59, @r6
+inc L40
+jsr @r7
+prn @r3
+m1
+red L2
+clr L11
+red @r2
+inc @r5
+prn @r1
+jsr L50
+inc L42
+L52: sub @r4, @r2
+add -99, @r7
+prn L41
+not @r5
+rts
+jsr L26
+not D0
+red L42
+jsr @r4
+sub L32, @r2
+L53: bne @r4
+mov 488, @r4
+inc L50
+L54: jmp L50
+dec L18
+jmp @r4
+clr @r3
+not @r5
+add L45, @r1
+clr @r0
+m2
+mov 161, @r6
+prn 281
+cmp L40, -373
+jsr L33
+dec @r1
+add L47, L34
+prn 286
+L55: lea L12, @r3
+inc L58
+L56: dec @r1
+dec @r1
+add 434, L38
+jsr @r1
+lea L58, @r6
+clr @r3
+rts
+add @r0, @r0
+prn L41
+m1
+L57: add @r3, S9
+red @r6
+bne @r7
+prn -340
+inc D0
+m3
+dec @r5
+jsr @r2
+rts
+jsr L50
+clr L8
+dec @r7
+lea L29, D0
+not L18
+sub 447, @r3
+jmp L14
+jmp @r1
+L58: rts
+mov @r3, L59
+not @r6
+prn L20
+inc @r7
+inc @r7
+inc @r5
+clr L10
+lea S7, L5
+cmp -339, @r6
+inc @r2
+bne @r1
+dec L59
+m3
+m2
+m3
+cmp -1, L59
+inc D0
+rts
+bne X4
+inc L59
+clr S8
+jsr D0
+bne D0
+L59: jsr S5
+stop
+D0: .data 180,-121,-453,-220,-160,-247,-241,293,288,1
+D1: .data 267,5,-453,132,180,-262,189,249,415,84
+D2: .data 488,97,-137,175,119,419,166,146,-407,454
+D3: .data -137,-7,-382,-428,198,21,191,-60,-127,440
+D4: .data -149,209,285,-443,-289,312,416,164,459,338
+D5: .data -217,118,-255,211,-51,-192,276,269,248,-79
+D6: .data -163,5,-278,-372,476,-90,-211,28,30,268
+D7: .data -417,-35,-168,433,-288,413,-462,-359,237,-114
+D8: .data 480,384,430,117,166,132,341,-1,407,376
+D9: .data 174,-334,-119,-480,52,-148,-392,-453,201,-369
+S0: .string "surjqqggvzeuspoi"
+S1: .string "ieufmskytmogkfalvnp"
+S2: .string "zsqwaazahvazunxbz"
+S3: .string "uocculncnqyinmqchk"
+S4: .string "bdefhaoxlsnijtttautb"
+S5: .string "iepfj"
+S6: .string "pgwlqjvgwdvwzph"
+S7: .string "excnblgggngzgqpqlix"
+S8: .string "nrrszcqteoobrtvewi"
+S9: .string "acokwkrxwbtweyvfokc"
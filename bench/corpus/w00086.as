@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r2
+    prn 58
+endmcro
+mcro m1
+    sub @r1, @r2
+    prn 12
+endmcro
+mcro m2
+    sub @r3, @r7
+    prn 30
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 54
+endmcro
+mcro m4
+    sub @r3, @r2
+    prn 23
+endmcro
+inc L0
+red @r0
+jsr L0
+not L0
+jmp @r5
+rts
+red L0
+lea L0, L0
+L0: red @r5
+rts
+L1: jsr L0
+L2: lea L2, @r4
+not @r4
+jmp @r3
+add L2, D0
+L3: rts
+lea L3, L3
+m4
+lea L1, @r1
+bne @r6
+clr @r4
+jsr @r4
+mov @r3, D0
+not @r0
+not @r7
+sub @r6, L3
+m3
+dec @r0
+add L1, @r4
+m0
+prn @r6
+L4: bne @r2
+L5: prn @r2
+L6: not L2
+clr L3
+bne @r4
+jmp @r3
+m0
+mov 215, L4
+bne @r2
+L7: prn L0
+dec L0
+L8: rts
+inc @r7
+red @r2
+L9: not L7
+jmp @r2
+L10: inc L1
+prn L10
+m3
+clr @r2
+m3
+red @r2
+lea L8, @r2
+inc L3
+clr @r7
+m1
+rts
+add -86, L3
+red L0
+red L7
+cmp @r4, L5
+L11: cmp @r7, -226
+cmp @r6, @r5
+lea L2, @r4
+dec L10
+sub 208, @r3
+red @r4
+L12: jsr L10
+L13: dec @r7
+lea L10, @r4
+m2
+L14: cmp L4, 17
+rts
+L15: inc @r2
+inc L15
+inc L11
+red L2
+m0
+rts
+jmp @r3
+m0
+sub @r7, @r6
+cmp -257, @r4
+jmp @r0
+add -423, @r6
+L16: inc L12
+jmp L10
+prn @r3
+red @r7
+m3
+add L39, @r2
+L17: lea L0, L17
+lea L11, L1
+L18: dec @r2
+rts
+mov @r7, L16
+jmp L11
+L19: clr @r3
+mov -362, @r6
+cmp 182, L11
+L20: jmp @r0
+prn @r3
+dec @r5
+sub @r3, L17
+not L20
+mov -112, L2
+dec S2
+mov @r1, L13
+jmp L14
+lea L9, L20
+inc L12
+red @r5
+L21: jmp L16
+clr L15
+not L16
+mov 70, L2
+L22: not L3
+inc @r0
+bne L2
+dec @r3
+prn @r3
+jmp L11
+lea L7, L4
+inc L3
+rts
+clr @r5
+jmp @r2
+cmp -410, 259
+mov 90, @r1
+inc @r4
+dec L21
+not L3
+not L1
+inc @r0
+m4
+red L9
+L23: prn L8
+jmp @r7
+cmp @r2, L11
+red @r4
+clr L4
+not L17
+m0
+L24: cmp @r7, -332
+bne L10
+bne @r3
+mov L19, L13
+jsr @r2
+sub L18, L38
+red L15
+cmp @r3, 37
+m4
+prn -274
+add L7, L54
+L25: bne @r4
+L26: jmp L7
+clr @r5
+inc L14
+bne D0
+inc @r6
+rts
+clr @r7
+sub @r3, L1
+sub -458, @r4
+not L1
+rts
+bne L16
+L27: dec @r2
+rts
+inc L19
+not L12
+mov L18, @r3
+rts
+jmp @r5
+jsr L10
+jsr @r7
+cmp L7, -381
+jmp @r6
+dec S9
+L28: inc L6
+m2
+clr @r3
+cmp L20, L20
+L29: jmp @r7
+rts
+inc L9
+L30: inc L27
+inc L4
+L31: dec L14
+prn -10
+rts
+cmp @r0, @r0
+m4
+lea L20, L20
+red L13
+L32: red L24
+not L19
+inc L23
+add 353, @r3
+mov 88, L1
+L33: prn @r6
+lea L21, L25
+sub D0, L29
+mov 490, @r5
+dec L27
+cmp @r1, 508
+sub L3, L9
+L34: bne L27
+lea L12, @r7
+sub L1, @r6
+m3
+not S4
+dec S4
+cmp L14, @r7
+L35: not @r1
+rts
+not L25
+L36: jsr L53
+dec L29
+m0
+prn -241
+jsr @r1
+lea L4, L28
+L37: lea L22, L14
+L38: mov -395, S2
+cmp S8, L15
+dec D0
+red L5
+not L34
+sub -494, @r3
+mov -371, L15
+bne L24
+jmp @r4
+prn @r3
+sub L15, @r4
+jsr @r2
+dec @r7
+lea L27, @r6
+dec L30
+not L43
+clr @r1
+red D0
+red @r6
+jmp @r0
+cmp 89, -285
+m0
+L39: clr L9
+L40: sub -415, @r4
+m3
+lea S2, D0
+L41: sub -70, @r0
+m0
+cmp L6, -4
+mov -215, L25
+jmp L38
+bne L52
+cmp -255, @r5
+prn L0
+jsr L17
+inc @r4
+m3
+lea L9, L15
+m2
+rts
+L42: lea L24, @r7
+m3
+jmp @r2
+prn @r6
+L43: mov @r6, X0
+inc L26
+m3
+jsr L22
+bne @r2
+lea L25, L28
+cmp 273, L53
+cmp @r0, L27
+prn -272
+mov 98, @r2
+L44: jsr @r5
+m4
+dec @r6
+bne L29
+inc @r0
+mov -410, @r5
+sub L30, L39
+lea L18, @r4
+add @r0, L28
+add -130, L10
+lea L29, @r3
+cmp L7, 449
+L45: jsr L34
+bne @r3
+inc L29
+bne @r0
+m3
+not @r2
+red @r0
+L46: mov L27, @r6
+inc L19
+mov -194, L38
+cmp L37, L9
+m4
+dec @r1
+mov L42, @r3
+cmp 75, @r2
+m2
+inc L21
+cmp @r1, L19
+cmp -37, -313
+cmp @r3, @r7
+L47: inc @r3
+add -44, @r2
+not @r5
+inc L6
+L48: bne L27
+lea L34, L36
+mov @r4, @r0
+lea L5, @r4
+m1
+not L2
+jmp L3
+bne L15
+red @r2
+mov @r0, @r3
+inc @r2
+L49: not L56
+prn @r6
+m0
+m3
+lea L32, L24
+jsr L18
+add @r4, @r1
+m0
+red @r2
+jsr L49
+rts
+mov L5, @r2
+prn @r7
+add -224, @r4
+rts
+rts
+not L57
+prn @r7
+jmp @r7
+rts
+dec @r6
+m2
+m4
+add S8, @r4
+clr L10
+m3
+clr @r7
+red L46
+rts
+lea L28, @r4
+lea L8, L50
+clr @r0
+prn -430
+sub L42, @r4
+jsr @r1
+L50: red L49
+add 38, L57
+lea L47, @r0
+lea L21, L50
+L51: prn 484
+cmp L8, 300
+mov L54, @r5
+prn 189
+red L40
+rts
+m1
+m1
+jmp @r1
+sub L25, L15
+L52: not @r4
+lea L19, X1
+cmp @r6, -114
+cmp -511, @r6
+rts
+inc L47
+bne @r6
+L53: lea L43, @r6
+inc L22
+L54: prn L3
+rts
+dec @r2
+add @r1, L16
+jsr L36
+bne D0
+not @r0
+clr S8
+sub @r3, @r5
+m2
+mov 139, L26
+red L0
+not S1
+L55: clr D0
+bne L3
+clr L29
+L56: inc L28
+bne @r7
+lea L58, L7
+m2
+mov @r3, L46
+clr L22
+add L13, @r6
+dec L40
+lea L53, L51
+rts
+lea L57, @r4
+jsr D0
+red @r6
+rts
+mov L57, @r5
+red L34
+sub L51, L47
+rts
+jsr @r6
+jmp X2
+red @r1
+lea L12, @r0
+clr L29
+bne @r7
+L57: not X3
+jmp L53
+jsr L59
+inc @r0
+lea D0, @r0
+clr L59
+sub 426, L24
+inc L8
+sub L32, X4
+rts
+sub L18, L4
+jmp @r0
+L58: add @r3, L51
+L59: sub L39, L11
+mov S2, @r3
+bne S0
+stop
+D0: .data 219,-329,-473,484,-73,-164,206,491,60,157
+D1: .data -255,118,383,343,227,-299,132,-458,61,144
+D2: .data 270,-103,-416,393,184,69,-355,2,-229,306
+D3: .data -495,-426,394,77,351,-382,170,-284,-341,-37
+D4: .data -158,290,238,199,-29,-487,167,125,235,-403
+D5: .data 431,-484,-444,-500,458,99,-193,-377,-282,-181
+D6: .data -140,349,-69,-438,130,-200,-306,-432,315,63
+D7: .data -54,68,-375,-455,122,-91,335,43,-437,283
+D8: .data 125,-437,3,-369,-124,-431,91,254,264,-309
+D9: .data 437,44,420,-316,372,465,-469,428,-288,436
+S0: .string "kbsmnqpql"
+S1: .string "fzporwzhyuxyeermije"
+S2: .string "vcsndzsml"
+S3: .string "uznxo"
+S4: .string "wftzmagjpbmlzgj"
+S5: .string "wmuvunosgmq"
+S6: .string "pxr"
+S7: .string "b"
+S8: .string "gpnlhuyiweghdamwmoag"
+S9: .string "myykgczcdajtuv"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r5
+    prn 96
+endmcro
+mcro m1
+    sub @r6, @r3
+    prn 10
+endmcro
+mcro m2
+    sub @r5, @r5
+    prn 95
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 98
+endmcro
+mcro m4
+    sub @r5, @r0
+    prn 47
+endmcro
+jsr @r1
+jsr L0
+mov L0, @r7
+dec @r4
+L0: sub @r1, @r4
+jsr @r6
+L1: bne @r1
+prn @r0
+bne L1
+cmp @r0, L1
+rts
+sub L0, @r3
+bne L0
+sub -85, L1
+jsr @r3
+dec @r1
+m0
+add L1, L1
+rts
+mov @r4, @r6
+bne @r7
+bne L0
+L2: not L0
+clr @r7
+jmp @r2
+clr @r2
+add @r2, L0
+m4
+lea L2, @r1
+L3: add L3, L0
+jsr L0
+L4: jsr @r0
+jsr L1
+jsr @r5
+prn L2
+not L0
+not L1
+red L3
+rts
+add L3, L0
+L5: add @r5, @r6
+L6: jsr @r7
+L7: inc @r5
+L8: jsr @r1
+jsr L7
+add @r7, @r2
+mov @r0, L5
+jmp @r3
+clr @r4
+bne @r4
+mov @r0, @r2
+cmp L1, -419
+prn L7
+inc L1
+prn L3
+L9: prn L0
+clr L2
+red L4
+prn 387
+not @r0
+not @r5
+m1
+sub L3, @r6
+prn -44
+m0
+clr @r3
+not L5
+add 271, L1
+add -202, L6
+clr L2
+prn L9
+sub -13, @r6
+prn -375
+m0
+L10: red @r0
+m4
+jsr @r7
+clr L5
+jmp @r7
+rts
+lea L2, @r0
+jsr L1
+not L3
+sub -226, L10
+m4
+rts
+rts
+m4
+L11: lea L10, L7
+dec L7
+jmp L4
+lea L2, @r1
+m0
+inc @r3
+jsr @r4
+prn 120
+dec @r4
+L12: rts
+L13: dec L2
+bne X0
+inc L7
+add -270, @r7
+lea L8, L8
+dec L13
+jmp L6
+cmp 92, L7
+bne @r1
+sub L8, @r0
+sub L11, @r5
+prn @r6
+bne L8
+inc L1
+L14: mov @r1, @r0
+mov 265, L12
+bne L3
+m4
+not L4
+bne @r7
+rts
+L15: not @r7
+L16: sub 181, @r0
+dec @r1
+rts
+inc @r2
+L17: add @r5, @r5
+clr @r2
+mov L9, L9
+L18: not @r3
+lea L53, @r7
+m2
+dec L12
+add L2, L0
+lea L0, L1
+inc @r7
+inc @r5
+bne @r1
+add @r2, L13
+L19: sub L3, @r3
+jsr L29
+clr L14
+add -184, L19
+add @r5, @r6
+rts
+lea L0, @r2
+inc L7
+jsr L8
+prn -318
+cmp @r4, L16
+add -67, L14
+dec L57
+sub 420, @r0
+dec @r1
+cmp -305, @r6
+rts
+jmp @r4
+dec @r4
+add -292, @r2
+inc L15
+mov @r7, L1
+cmp L2, L11
+L20: jsr @r7
+L21: lea L9, @r6
+mov @r1, L15
+lea L3, L2
+not L0
+dec @r6
+sub @r7, @r7
+L22: cmp @r2, -228
+clr L12
+inc L17
+clr L22
+jmp @r0
+prn L11
+not @r1
+L23: clr L11
+red @r2
+m2
+cmp L7, L4
+cmp @r4, L20
+L24: clr D0
+clr @r6
+cmp 406, @r6
+inc L20
+bne L6
+clr L44
+jmp @r7
+inc @r1
+sub L14, D0
+inc @r6
+red L16
+add @r5, @r5
+m4
+cmp @r1, L22
+prn 128
+lea L21, @r3
+inc @r7
+mov 386, D0
+bne @r3
+prn @r4
+inc @r7
+cmp D0, L4
+mov L4, @r1
+L25: jmp L19
+L26: jmp @r1
+not @r1
+jmp @r7
+not @r6
+m2
+sub S7, @r0
+rts
+add 387, L7
+bne @r3
+L27: prn @r7
+not L25
+L28: sub L22, @r0
+prn 187
+prn L11
+L29: mov L7, S9
+L30: not L3
+L31: clr L10
+not L29
+cmp L20, @r7
+m3
+sub 235, @r3
+L32: cmp @r2, 293
+lea L22, @r5
+m1
+inc @r3
+not L2
+m4
+jsr L5
+prn L31
+lea L20, @r6
+add L18, @r7
+bne L23
+prn L12
+rts
+lea L6, L16
+lea L31, L26
+m4
+add S5, @r2
+jmp @r1
+lea L17, @r3
+clr L21
+lea L24, L21
+jmp @r2
+jsr @r0
+m3
+bne @r0
+L33: jmp L36
+sub -45, L2
+not L30
+jmp @r0
+add @r3, @r0
+jsr L32
+jsr @r1
+not @r3
+L34: jmp @r3
+inc @r2
+L35: inc L29
+bne @r4
+jsr L28
+not L17
+red D0
+m3
+red @r5
+m4
+L36: add @r2, @r4
+bne @r4
+cmp L13, @r3
+inc @r0
+inc L33
+cmp @r4, L26
+prn @r2
+L37: sub L21, @r1
+add X1, L19
+cmp L0, S6
+red L32
+inc L30
+jmp L13
+L38: lea L16, @r2
+jsr @r4
+rts
+m3
+lea L36, L27
+rts
+jsr @r3
+rts
+L39: rts
+L40: mov -455, L34
+lea L50, D0
+dec @r0
+cmp @r4, L0
+clr @r4
+jsr @r6
+bne L50
+red X2
+red L29
+bne @r6
+jsr L11
+clr @r5
+jmp @r4
+dec @r2
+cmp L29, -168
+lea L42, L23
+L41: red @r1
+mov 350, L1
+clr @r4
+L42: add @r0, L37
+dec L40
+jmp @r0
+prn 207
+m4
+bne @r0
+cmp L42, L50
+m3
+m3
+rts
+bne @r6
+L43: lea L21, L37
+rts
+red @r5
+L44: sub @r5, @r4
+dec L36
+rts
+cmp L10, 393
+L45: mov @r1, L58
+jmp L26
+L46: red L29
+rts
+red L15
+jsr @r2
+mov -402, @r4
+dec @r2
+m0
+not L40
+not L9
+L47: rts
+mov L40, L15
+prn -490
+L48: sub -462, @r7
+inc @r6
+cmp @r3, L15
+inc @r3
+sub -141, @r1
+bne L36
+m4
+add 438, @r1
+bne L12
+cmp @r4, -258
+cmp L57, @r4
+jsr L46
+prn @r5
+rts
+jmp L49
+sub 494, @r5
+prn L26
+L49: inc S3
+dec L10
+m3
+not @r4
+m4
+jsr @r5
+bne @r6
+cmp L13, 460
+L50: prn -244
+inc @r6
+add -129, @r4
+dec L8
+rts
+jmp @r5
+dec @r6
+not @r2
+not L55
+m4
+mov -95, @r2
+red @r6
+cmp L19, L10
+jmp @r4
+clr @r5
+red @r6
+jsr D0
+m4
+jsr @r4
+sub L52, L34
+sub L22, X3
+jsr L55
+bne @r3
+add 243, L5
+add 140, L53
+m2
+not @r1
+add @r7, L7
+L51: sub @r5, L8
+L52: jmp L54
+mov L11, @r0
+L53: add L14, @r5
+rts
+inc @r0
+dec L59
+m4
+mov @r3, L43
+prn @r5
+m0
+m2
+prn @r4
+not S7
+jmp L29
+jsr @r3
+m1
+add @r1, @r6
+sub @r6, @r7
+m1
+jsr @r4
+bne @r3
+L54: bne L2
+red @r2
+dec L52
+L55: bne @r6
+mov L41, @r7
+m2
+red L15
+clr @r6
+L56: jmp @r1
+prn -5
+m1
+lea D0, @r0
+lea D0, L30
+mov @r1, D0
+m2
+L57: jsr @r2
+L58: sub D0, X4
+bne L59
+jsr L59
+prn -268
+L59: lea D0, @r7
+bne D0
+add @r5, @r3
+jmp @r1
+inc S5
+stop
+D0: .data 186,475,-370,353,-142,388,-165,-204,389,411
+D1: .data -290,-97,500,-217,-193,-220,-405,320,228,356
+D2: .data -467,424,-348,84,-415,-193,-358,-378,423,67
+D3: .data 363,259,251,-207,167,-220,-180,271,111,2
+D4: .data 354,364,-404,-201,35,-207,102,-204,221,14
+D5: .data 154,-220,357,127,-387,-331,325,455,400,494
+D6: .data 278,-10,254,330,-475,-208,-369,-360,-97,-65
+D7: .data 21,475,-2,95,78,-257,250,-346,175,330
+D8: .data 353,-143,381,214,415,86,-214,189,-71,-90
+D9: .data 339,273,484,-141,-313,297,-344,443,470,96
+S0: .string "byiteufmugw"
+S1: .string "ye"
+S2: .string "movibxyfumhyjhyihypm"
+S3: .string "prjkihv"
+S4: .string "fw"
+S5: .string "nugtgjovuzjgv"
+S6: .string "znliavmxxmubnoifybzo"
+S7: .string "tf"
+S8: .string "dbpjatfapzgdvdnfdgfj"
+S9: .string "vatckaxndcilfybr"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r7
+    prn 67
+endmcro
+mcro m1
+    sub @r2, @r5
+    prn 9
+endmcro
+mcro m2
+    sub @r7, @r3
+    prn 61
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 75
+endmcro
+mcro m4
+    sub @r7, @r6
+    prn 72
+endmcro
+m1
+clr L0
+red L0
+dec @r5
+m2
+lea L0, L0
+add @r1, L0
+prn L0
+m2
+prn L0
+L0: rts
+lea L0, @r4
+m3
+m4
+jsr @r0
+L1: dec @r4
+rts
+jsr @r3
+m4
+L2: clr @r4
+clr @r4
+rts
+dec L13
+mov -85, @r6
+L3: add 136, L0
+rts
+cmp 91, @r0
+rts
+inc @r5
+not @r7
+L4: prn 55
+L5: rts
+sub @r4, X0
+prn @r3
+clr @r4
+add @r7, L1
+m1
+add 422, L4
+cmp L1, 384
+bne @r4
+prn -47
+inc L0
+inc L5
+m3
+prn @r5
+sub L3, L4
+jsr @r6
+mov L2, @r7
+not @r5
+bne @r3
+sub 358, L3
+add L4, L5
+clr @r0
+rts
+jsr L3
+rts
+add -367, L4
+cmp L4, L1
+sub -146, L3
+bne @r3
+red @r2
+dec L2
+jsr @r1
+m3
+m1
+rts
+m4
+inc S8
+m2
+add @r7, @r7
+lea L2, @r1
+jsr @r2
+prn L2
+jsr L0
+inc @r2
+sub L3, L34
+L6: cmp @r2, @r1
+inc @r7
+prn -407
+jsr @r0
+red L1
+jsr @r2
+L7: mov @r6, L5
+L8: lea L7, @r7
+prn -304
+L9: mov L2, @r4
+prn L6
+add @r7, @r0
+mov L2, L1
+lea L9, L2
+mov @r6, @r7
+cmp @r3, 428
+rts
+cmp 62, -15
+inc @r7
+red @r7
+prn -208
+red D0
+L10: jmp L1
+jsr L1
+L11: cmp L1, L6
+inc L3
+prn @r0
+L12: dec @r7
+add -23, @r3
+L13: sub L9, L3
+rts
+not @r2
+clr @r5
+clr L10
+cmp L0, @r0
+add L1, @r3
+add @r0, L10
+prn @r5
+mov @r5, L1
+dec L13
+add @r4, @r3
+sub @r6, @r6
+jmp @r6
+L14: clr L8
+red @r1
+red L1
+jsr L2
+cmp @r1, @r1
+m2
+red @r1
+cmp -266, L5
+bne L12
+prn L12
+prn L14
+dec @r3
+red L13
+L15: prn L5
+red @r3
+jsr S5
+L16: dec L13
+jmp L8
+prn @r3
+m3
+clr L48
+inc L13
+jmp @r5
+jsr @r1
+prn L11
+m1
+L17: not L15
+add -16, L12
+clr @r4
+mov -372, @r2
+L18: prn @r7
+prn @r5
+L19: not L1
+lea L10, L7
+not L4
+jsr @r2
+cmp L3, @r6
+clr D0
+cmp -50, D0
+m2
+bne L13
+sub @r7, L33
+m0
+lea L7, L10
+L20: bne @r5
+L21: dec L7
+L22: inc @r5
+jmp L18
+mov L16, @r3
+clr L21
+m0
+sub @r7, @r7
+not L21
+not @r5
+m2
+L23: dec @r6
+rts
+mov @r4, D0
+lea L11, @r7
+jmp L5
+cmp -437, @r1
+not @r3
+clr @r6
+add 24, @r0
+jsr @r1
+dec S6
+prn 480
+L24: lea L10, L14
+dec @r5
+mov -270, @r1
+bne @r2
+inc L16
+sub @r1, L1
+clr L22
+add L0, @r5
+jmp @r6
+bne L21
+add -175, L23
+not L17
+L25: mov @r4, @r7
+clr @r4
+L26: prn L7
+m4
+cmp 135, @r6
+jsr @r3
+m0
+clr @r1
+jmp L3
+mov L13, @r3
+L27: not L9
+jsr @r0
+m0
+L28: add @r0, L20
+dec L0
+clr @r4
+sub L26, L13
+dec D0
+jsr @r2
+mov -472, @r3
+bne L52
+add L16, @r4
+m3
+L29: jsr L20
+m1
+jmp L12
+add L19, @r3
+not L19
+L30: red L7
+sub -25, L13
+jsr L19
+L31: jsr @r3
+prn L21
+jsr @r5
+bne L14
+mov L31, L26
+not L26
+L32: prn @r3
+not L3
+L33: add L7, @r7
+inc L9
+L34: red D0
+L35: bne L6
+add L35, L6
+rts
+not @r3
+prn L26
+rts
+prn @r2
+cmp L20, L44
+bne @r2
+L36: clr L29
+jmp L10
+jsr @r6
+cmp @r2, 233
+clr @r3
+jmp L8
+not L1
+dec @r0
+sub @r0, L17
+jmp L14
+m3
+bne L4
+m4
+mov @r5, L15
+jsr L34
+jsr L36
+sub -445, @r2
+red @r6
+L37: lea L24, L30
+sub 301, @r5
+not @r2
+mov L42, L44
+prn @r6
+prn @r2
+mov L23, L7
+dec L54
+clr L16
+bne @r0
+prn @r7
+prn @r6
+mov L36, L8
+dec @r2
+clr @r2
+L38: jmp L38
+cmp -114, @r2
+sub @r7, L27
+red L25
+L39: not L38
+dec L28
+bne @r4
+dec L42
+rts
+dec @r4
+add L34, @r4
+jsr @r7
+rts
+clr @r7
+red @r4
+jmp @r7
+red L11
+red L4
+m1
+m0
+cmp 144, S6
+m3
+rts
+prn -223
+jmp L6
+L40: bne L6
+m0
+red L37
+add -295, @r7
+bne @r3
+m4
+rts
+add L1, @r6
+bne @r1
+bne @r2
+red @r5
+L41: mov @r2, @r4
+sub @r6, @r2
+not @r1
+inc @r1
+L42: clr @r4
+sub L21, @r4
+mov @r1, @r3
+jmp @r1
+L43: bne @r5
+rts
+not X1
+L44: add @r5, L22
+not L40
+lea L16, @r7
+inc L28
+not S3
+jsr @r3
+bne L32
+clr @r1
+m0
+rts
+jmp @r5
+L45: dec L9
+L46: rts
+clr @r6
+prn 434
+L47: rts
+L48: sub @r4, D0
+rts
+cmp @r1, L31
+lea L43, L56
+lea L26, L48
+rts
+jmp L19
+add L25, @r3
+lea L26, L11
+m0
+red L38
+L49: sub L14, L26
+m1
+prn 493
+inc @r6
+jsr L2
+jsr L50
+sub L22, L49
+not L4
+dec @r0
+dec @r0
+m0
+dec L49
+bne @r1
+jsr @r1
+red @r5
+prn 215
+red @r0
+sub @r7, @r5
+m0
+clr L31
+sub 491, @r5
+mov L49, S5
+L50: red @r1
+L51: not @r1
+inc @r6
+jmp @r3
+lea L0, L40
+L52: mov @r7, @r7
+red L57
+L53: jsr X2
+not @r0
+cmp @r4, @r5
+inc D0
+L54: inc L42
+clr L58
+prn 474
+L55: bne L6
+cmp 59, L12
+jmp D0
+cmp @r0, @r1
+jmp @r0
+m0
+rts
+clr X3
+L56: inc @r1
+rts
+not @r7
+mov D0, @r3
+bne @r4
+jmp @r0
+m4
+mov 490, L23
+jmp L31
+add @r3, @r3
+prn S3
+jsr X4
+inc L42
+sub -256, L34
+L57: mov -202, @r0
+prn @r7
+jsr @r6
+cmp @r7, -136
+dec @r5
+lea L13, D0
+red @r4
+L58: bne S3
+bne S2
+dec @r1
+m0
+bne @r0
+inc @r1
+rts
+red @r3
+m0
+jmp S0
+not L1
+clr L53
+jsr @r3
+L59: mov @r6, @r3
+prn S5
+prn D0
+lea S3, D0
+prn 422
+add D0, @r2
+stop
+D0: .data 71,-274,5,125,220,474,95,495,-93,-231
+D1: .data -106,-234,-147,118,-305,381,310,-211,59,-219
+D2: .data 231,473,200,-267,-354,-250,279,-204,263,205
+D3: .data 403,-415,-362,-206,459,394,167,103,-300,-275
+D4: .data 178,-369,118,224,274,-276,428,351,-216,-160
+D5: .data 417,-54,-278,447,-199,-257,-178,484,-220,160
+D6: .data 86,77,-471,69,250,221,273,-311,295,50
+D7: .data -212,6,323,-192,-21,-408,-335,110,233,-311
+D8: .data -251,167,457,208,-423,1,200,422,-313,25
+D9: .data -59,-492,-146,239,-463,47,-353,-404,-395,-301
+S0: .string "dqz"
+S1: .string "sdnmsdmxbkyfsdid"
+S2: .string "rqmtpnhiowknqxpbnej"
+S3: .string "gcfablqsdbbcpxjerdhr"
+S4: .string "prjvacwocby"
+S5: .string "qxsvahuoooclnbmur"
+S6: .string "zko"
+S7: .string "auydlrlqhmirgvtr"
+S8: .string "ojaqztgywybhsph"
+S9: .string "yicnhbg"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r2
+    prn 37
+endmcro
+mcro m1
+    sub @r7, @r6
+    prn 7
+endmcro
+mcro m2
+    sub @r1, @r1
+    prn 26
+endmcro
+mcro m3
+    sub @r0, @r1
+    prn 51
+endmcro
+mcro m4
+    sub @r1, @r5
+    prn 28
+endmcro
+L0: add @r3, @r6
+inc @r7
+add L0, @r2
+red L0
+lea L0, L0
+add -510, @r6
+add L0, L0
+mov 276, @r2
+dec X0
+jsr L27
+add @r0, L0
+dec @r0
+bne L0
+lea L0, @r4
+prn @r2
+lea L0, L0
+L1: not L1
+jsr L1
+prn L1
+sub L1, @r4
+m2
+L2: bne L0
+m2
+L3: rts
+prn @r5
+inc @r5
+L4: jmp @r5
+L5: bne L4
+m1
+L6: not L1
+mov @r5, L3
+jmp L0
+L7: sub @r4, L2
+mov L7, L5
+L8: red L20
+L9: dec @r6
+prn @r2
+inc @r7
+m4
+jmp L4
+jmp @r3
+red L4
+clr L2
+lea L3, @r1
+mov L3, @r6
+jsr L7
+m1
+m2
+sub @r6, L2
+sub @r6, L4
+rts
+jmp @r1
+L10: bne L2
+lea L2, @r7
+jmp L4
+sub @r6, @r1
+add -43, L5
+L11: sub @r7, @r6
+add L1, @r4
+L12: rts
+bne @r6
+dec L6
+m0
+L13: cmp 485, L12
+clr L3
+jmp @r3
+jsr @r1
+dec L6
+L14: red @r6
+sub @r7, L1
+jsr @r3
+L15: clr @r4
+inc L0
+clr S0
+clr L3
+prn 253
+jsr L8
+jmp L9
+red L2
+inc @r2
+prn @r1
+dec @r2
+sub -477, L8
+m0
+inc L3
+red L12
+not L42
+add L0, @r3
+dec @r3
+cmp L12, L13
+L16: clr L13
+dec L15
+not @r5
+jsr @r3
+m1
+L17: cmp @r0, -511
+dec @r4
+bne L4
+lea L12, @r3
+red L9
+add L8, @r1
+prn L12
+m0
+sub 269, @r5
+jsr L30
+bne @r5
+jmp @r7
+lea L4, S6
+m0
+sub L11, @r6
+m1
+mov -95, @r3
+bne @r2
+m0
+add L6, @r0
+bne @r6
+prn L12
+rts
+jsr L3
+L18: cmp 195, L4
+mov L12, @r5
+L19: not L12
+jsr L15
+not @r6
+m4
+L20: lea L21, L15
+not @r1
+m4
+red @r4
+rts
+jmp @r0
+prn L16
+rts
+add -138, L15
+lea L3, @r5
+dec L10
+clr L15
+not @r3
+m4
+bne @r4
+m3
+bne @r4
+mov L14, L17
+L21: add L2, L19
+jmp @r6
+m3
+not @r6
+not L14
+L22: clr @r7
+mov L12, L3
+clr L4
+dec L0
+sub L19, L27
+prn @r3
+prn 27
+jmp @r2
+not L22
+L23: cmp -381, L18
+add L22, L17
+L24: jmp L5
+not D0
+lea L0, L10
+red @r3
+L25: sub @r1, @r6
+add L24, @r1
+clr L17
+not L15
+bne @r0
+cmp L4, 319
+not @r2
+red S7
+cmp @r5, 111
+sub @r3, @r3
+L26: sub @r4, L3
+inc L24
+m1
+red L17
+red @r5
+lea L3, L8
+clr L5
+jmp @r4
+red @r5
+sub @r1, @r0
+cmp @r5, L18
+cmp L5, @r5
+red L16
+jmp L9
+prn L24
+cmp 98, L9
+m3
+clr L53
+dec L3
+jsr @r6
+clr L18
+rts
+sub L44, @r2
+lea L33, L21
+jsr L7
+add X1, L11
+L27: lea L15, L11
+dec L24
+L28: lea L37, L8
+clr @r7
+bne @r2
+lea L10, L8
+mov @r7, @r4
+prn -267
+inc @r2
+rts
+bne @r0
+cmp @r5, L7
+jmp @r4
+cmp L22, @r3
+mov 379, D0
+lea L3, @r7
+not L54
+lea L28, S0
+L29: sub -118, @r1
+not @r2
+clr @r2
+jsr L7
+rts
+m3
+inc L26
+add @r5, S9
+rts
+m1
+inc L3
+sub @r5, @r0
+rts
+prn L14
+jsr @r6
+L30: rts
+dec @r7
+jmp @r4
+prn @r2
+m1
+prn 508
+cmp 23, L13
+add L22, S0
+mov @r1, @r0
+inc @r7
+dec @r0
+cmp -97, @r7
+L31: clr @r3
+red @r7
+rts
+mov @r5, L17
+L32: mov @r1, L19
+L33: dec @r4
+red @r4
+jsr L21
+dec @r1
+jmp L33
+L34: inc L1
+rts
+clr L33
+clr @r2
+L35: not L7
+jmp @r1
+sub X2, L5
+m2
+cmp 423, 483
+cmp @r4, -302
+mov 250, L18
+cmp L5, @r3
+add @r4, @r1
+add 323, L31
+bne @r0
+rts
+sub L3, @r3
+jmp L19
+jsr @r6
+clr L33
+mov -396, @r5
+prn L16
+L36: inc @r6
+L37: not @r5
+L38: clr @r3
+dec L32
+L39: prn @r5
+bne @r6
+bne L7
+dec L9
+jmp @r6
+not L14
+sub 194, @r1
+L40: bne @r4
+clr L3
+sub @r4, @r1
+dec L18
+m1
+red @r7
+red L12
+L41: bne @r0
+prn -59
+bne L7
+add @r7, L29
+L42: cmp @r1, @r6
+mov -45, @r6
+mov L20, @r3
+L43: jsr @r7
+jmp @r5
+L44: cmp 424, -88
+lea L58, @r0
+m4
+red L27
+L45: cmp 51, -174
+cmp @r3, -477
+add @r5, L12
+inc @r5
+bne L40
+jsr @r0
+rts
+not L8
+m3
+cmp X3, L42
+rts
+L46: inc L20
+prn 90
+rts
+clr L4
+inc @r4
+inc @r0
+bne L13
+rts
+mov @r0, @r6
+clr @r7
+m4
+red @r4
+jsr L45
+m4
+L47: rts
+m3
+L48: bne @r6
+lea D0, @r1
+lea L48, @r4
+inc L27
+prn L3
+m0
+jmp L38
+not @r2
+jsr @r2
+cmp @r3, @r0
+sub @r0, L38
+L49: sub @r1, L9
+L50: lea L43, @r0
+m2
+lea L10, L56
+jmp @r3
+m2
+jsr L0
+L51: inc @r2
+rts
+red @r5
+not L37
+add 339, @r6
+prn -44
+rts
+cmp L6, -196
+clr L36
+inc S0
+cmp S7, @r0
+bne @r2
+m4
+jsr D0
+red L22
+sub -324, @r0
+rts
+inc @r6
+jsr L23
+lea L1, @r1
+dec @r7
+sub @r4, L48
+dec @r1
+sub 234, L7
+L52: bne @r0
+jsr L9
+m2
+L53: red L57
+L54: jmp L44
+cmp L55, -488
+mov @r5, L27
+dec L21
+L55: bne L29
+cmp -443, L8
+mov @r7, @r3
+rts
+lea L31, @r2
+dec L41
+L56: not @r3
+jmp @r7
+m2
+L57: cmp 267, L56
+cmp @r3, 213
+clr @r6
+m3
+lea L21, @r2
+lea L52, @r0
+prn L48
+cmp @r6, -186
+clr @r0
+rts
+m1
+not @r6
+lea S9, @r6
+inc L51
+prn L52
+mov @r2, X4
+rts
+lea L2, @r6
+not L59
+rts
+L58: prn 9
+rts
+cmp @r6, 462
+add -80, L38
+m4
+bne L12
+bne D0
+mov -468, @r6
+dec @r4
+not L59
+jsr L59
+lea S2, L59
+mov @r4, @r3
+bne @r3
+mov @r1, L12
+m4
+prn L59
+jsr @r3
+lea D0, L14
+jsr S3
+cmp -13, @r4
+red S9
+prn @r4
+L59: dec @r3
+bne @r7
+sub S1, @r0
+prn D0
+stop
+D0: .data -52,342,199,63,-203,272,365,374,199,-448
+D1: .data 7,351,-254,220,202,17,-10,470,-263,-271
+D2: .data 270,117,-33,225,215,-150,332,-446,-172,410
+D3: .data 43,1,-218,479,-488,-485,-418,225,-395,-319
+D4: .data -412,345,141,414,120,-465,365,-390,-234,336
+D5: .data -399,-300,-371,-224,370,-46,-64,-359,243,458
+D6: .data 360,-177,-374,-216,-198,-149,-362,368,-246,-167
+D7: .data 136,-413,164,-290,-487,-229,-8,167,-415,15
+D8: .data -352,-90,-112,-483,-327,450,-474,-372,481,-283
+D9: .data -37,44,176,-427,301,-11,32,322,197,37
+S0: .string "hdmmqkaciw"
+S1: .string "hlgwi"
+S2: .string "dgbqncjcyb"
+S3: .string "ml"
+S4: .string "mroece"
+S5: .string "kyilhqmtuoww"
+S6: .string "curhgvbzyumdnk"
+S7: .string "qkrwoehxsqn"
+S8: .string "zrcuexfnwx"
+S9: .string "pfxgsetfrgihdlitpo"
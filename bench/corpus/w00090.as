@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r4
+    prn 75
+endmcro
+mcro m1
+    sub @r3, @r7
+    prn 74
+endmcro
+mcro m2
+    sub @r3, @r7
+    prn 91
+endmcro
+mcro m3
+    sub @r3, @r1
+    prn 28
+endmcro
+mcro m4
+    sub @r3, @r3
+    prn 53
+endmcro
+L0: inc @r4
+mov L0, @r5
+add 321, @r3
+sub L0, L0
+prn -156
+jsr @r4
+not @r6
+jmp @r3
+not @r0
+mov -506, @r3
+L1: mov L0, @r1
+dec @r0
+L2: lea L2, L2
+jmp L1
+add @r3, @r6
+red L0
+prn L2
+mov 0, L2
+red @r3
+jsr @r5
+L3: inc @r1
+jmp @r7
+add -74, @r2
+cmp @r0, @r3
+inc @r4
+prn L3
+L4: add 153, @r7
+lea L3, L3
+red L2
+jsr L2
+jsr L2
+bne L4
+rts
+L5: bne L3
+jsr @r5
+red L5
+clr L5
+red L5
+L6: jsr L1
+rts
+jmp @r6
+prn @r7
+cmp @r4, -446
+jmp L6
+prn L5
+inc @r3
+add -227, @r2
+dec @r3
+bne X0
+add L3, L6
+red L0
+not D0
+prn L1
+sub @r3, @r6
+lea L3, @r5
+L7: prn 256
+L8: bne @r7
+sub L3, L3
+not L3
+inc L0
+add 283, L2
+jmp L1
+sub 342, L5
+L9: sub @r1, L35
+bne L7
+L10: red L6
+cmp -358, 108
+not @r0
+not L3
+lea L2, L10
+jsr L4
+cmp L5, @r5
+L11: dec @r6
+prn @r1
+dec L9
+m4
+m1
+jmp L7
+add 120, @r1
+add L8, @r3
+jmp @r2
+mov L7, @r1
+red @r7
+L12: mov -319, L9
+prn @r3
+mov L9, @r6
+red @r4
+inc @r5
+prn S8
+jmp @r0
+inc @r6
+jsr @r3
+L13: prn D0
+jsr @r3
+prn @r5
+L14: lea L54, @r1
+L15: rts
+dec @r3
+cmp L8, -6
+red L8
+lea L6, L3
+clr L4
+lea L1, @r6
+add 219, S2
+rts
+bne L5
+mov L15, L0
+m1
+cmp L7, L11
+bne L14
+clr L1
+sub L1, L4
+sub @r2, @r5
+not L0
+inc L2
+m2
+m4
+bne L4
+m2
+red @r0
+L16: cmp L9, L3
+mov D0, L7
+cmp @r3, L12
+prn 415
+cmp L8, L12
+m0
+mov L49, @r2
+add L6, @r6
+red L12
+mov @r2, @r0
+bne L12
+jmp L0
+clr @r4
+lea S6, L6
+clr L11
+cmp @r3, L0
+sub 105, @r7
+L17: mov L21, L7
+dec L5
+L18: mov @r1, @r6
+cmp 195, 316
+inc L6
+mov @r5, L3
+jmp @r3
+mov 352, L8
+bne @r1
+L19: inc @r7
+not L6
+add L8, L5
+jsr L16
+L20: mov @r5, @r5
+red L15
+mov @r5, L16
+m0
+bne @r7
+sub L19, @r3
+clr L10
+add @r3, @r0
+red L45
+m4
+clr @r5
+clr L3
+prn -247
+inc L2
+sub D0, @r1
+bne L2
+L21: red @r5
+jsr @r2
+inc D0
+inc L11
+m4
+m3
+jmp @r0
+mov -368, @r4
+mov @r0, L3
+jmp L10
+m1
+sub L11, @r3
+prn 326
+jmp S8
+L22: red L15
+prn L5
+not @r6
+L23: jmp L47
+sub -151, @r2
+lea L6, L11
+mov 473, L1
+not L13
+red L9
+clr L56
+L24: lea L21, @r0
+L25: add @r2, @r4
+prn L13
+prn L56
+sub @r3, L23
+mov L4, D0
+red L16
+clr L11
+rts
+clr @r0
+lea L3, @r7
+red @r4
+add @r4, L2
+rts
+jmp @r7
+bne S1
+m1
+mov 290, L0
+cmp @r2, @r7
+inc @r0
+dec @r2
+bne L9
+add @r2, @r6
+m1
+prn @r4
+clr @r4
+red L53
+mov 128, D0
+L26: dec @r5
+prn @r5
+bne @r2
+jsr @r3
+dec L49
+rts
+m3
+L27: jsr L1
+m3
+m1
+lea L10, L1
+red L6
+red @r7
+red L25
+not @r6
+jsr L21
+bne L18
+L28: jmp L5
+sub -53, L7
+clr @r4
+jsr @r2
+rts
+dec L6
+L29: jmp @r5
+lea L29, L12
+L30: jmp L15
+cmp @r3, L11
+sub 490, @r5
+lea L10, L1
+m3
+add @r5, @r0
+rts
+rts
+inc L14
+L31: cmp -128, D0
+bne L24
+red L13
+dec @r4
+m4
+L32: red @r4
+bne L18
+L33: red @r1
+L34: mov 179, L21
+sub L27, L33
+L35: bne @r0
+sub @r4, @r3
+m2
+inc @r2
+lea L22, @r3
+jsr L14
+L36: jmp L8
+add L19, @r7
+L37: cmp L2, @r3
+dec @r1
+m1
+L38: sub -216, @r7
+m0
+clr @r0
+m2
+cmp L35, 474
+not L3
+m3
+L39: red L3
+bne L37
+L40: jmp @r2
+mov L2, @r1
+rts
+cmp @r5, L2
+mov @r5, L16
+m2
+mov @r0, @r3
+rts
+jsr @r7
+m1
+red L34
+mov -427, L16
+mov 396, L53
+mov L27, @r0
+L41: jsr L6
+prn 356
+mov L1, @r5
+lea L20, @r3
+L42: not L12
+cmp @r1, L18
+red L2
+dec @r4
+inc @r2
+red @r6
+L43: add @r0, @r6
+bne @r2
+mov @r7, L25
+L44: cmp @r5, L43
+mov -207, L24
+clr @r4
+inc @r5
+prn L31
+sub 180, L39
+lea L1, @r4
+dec L16
+not D0
+sub L10, @r0
+rts
+jsr @r1
+not @r3
+prn 197
+not L43
+not L33
+L45: jsr L44
+m4
+jmp L16
+rts
+add -329, L27
+add -104, L15
+dec @r7
+L46: red @r1
+not @r3
+jsr @r5
+not L47
+m4
+clr L45
+jsr @r4
+cmp @r0, L44
+jmp X1
+inc @r5
+m2
+dec L20
+red @r4
+rts
+rts
+clr L34
+prn @r6
+cmp L40, -169
+prn L49
+m2
+L47: not L45
+mov 436, L25
+jmp L19
+m0
+jsr D0
+jsr L14
+clr @r4
+cmp 257, -381
+jmp @r6
+jsr @r2
+bne L50
+rts
+sub -412, L30
+m3
+jmp L19
+bne L33
+L48: dec L11
+prn @r5
+m2
+not L48
+lea L43, @r2
+prn -12
+lea L24, L56
+L49: lea L48, L28
+jsr @r1
+jsr L28
+not @r3
+prn L28
+rts
+L50: inc L25
+red L47
+L51: inc L47
+L52: mov 299, L17
+jmp L53
+bne L7
+L53: dec L46
+jmp @r6
+mov L11, @r0
+rts
+clr @r5
+prn @r0
+jsr L36
+L54: jsr @r2
+jmp @r3
+m0
+not @r1
+m2
+inc L21
+L55: add @r7, L7
+m4
+L56: lea X2, @r1
+sub @r5, S8
+cmp @r6, @r5
+jmp @r0
+L57: add -167, L31
+rts
+prn -46
+m2
+clr @r0
+inc @r7
+m0
+jsr @r6
+not @r1
+clr L34
+rts
+jmp X3
+jmp @r5
+cmp @r0, S9
+rts
+m4
+rts
+dec @r3
+clr @r6
+cmp X4, L58
+jmp @r5
+jmp @r5
+L58: cmp 157, L59
+bne L44
+prn L59
+inc L59
+dec @r2
+m4
+cmp @r4, @r3
+inc D0
+clr L51
+red L57
+L59: jsr S2
+jmp S8
+stop
+D0: .data -60,358,124,-96,-358,-366,-35,369,373,-260
+D1: .data 81,119,277,-166,69,-327,434,192,-233,-95
+D2: .data -67,416,-1,456,135,-71,440,-61,-138,50
+D3: .data -188,140,-313,-384,348,202,-496,212,183,45
+D4: .data -292,249,296,244,43,398,-228,33,-255,211
+D5: .data 294,-475,-410,342,150,-364,358,-235,-118,237
+D6: .data -377,139,385,-475,406,403,184,-285,-284,397
+D7: .data -426,134,406,143,457,-183,-264,-296,-6,256
+D8: .data -31,173,494,156,-21,479,175,172,179,23
+D9: .data 47,17,122,-483,133,-352,309,-305,-68,421
+S0: .string "qvnkwombiklzvatxr"
+S1: .string "qfsobgq"
+S2: .string "tcrzhkav"
+S3: .string "hnfjasljuiwtzuht"
+S4: .string "qckqrdsluhmo"
+S5: .string "vurjmnhhnnpfdu"
+S6: .string "hlsox"
+S7: .string "bbjlqmyeohsrqmlp"
+S8: .string "rey"
+S9: .string "atfrowbrko"
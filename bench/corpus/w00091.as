@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r7
+    prn 46
+endmcro
+mcro m1
+    sub @r7, @r0
+    prn 72
+endmcro
+mcro m2
+    sub @r5, @r5
+    prn 88
+endmcro
+mcro m3
+    sub @r6, @r1
+    prn 4
+endmcro
+mcro m4
+    sub @r5, @r1
+    prn 77
+endmcro
+jsr L0
+lea L0, L0
+mov @r7, @r5
+L0: bne L0
+add -32, @r2
+mov L0, @r3
+L1: red S9
+clr L0
+prn L0
+jmp @r0
+jmp @r5
+dec D0
+mov L0, L0
+L2: clr @r3
+add -349, L2
+m1
+L3: mov 64, @r0
+jsr @r4
+cmp @r0, @r5
+sub L3, L2
+mov 474, L1
+L4: add L2, @r7
+L5: bne @r3
+not L0
+lea L2, @r4
+prn 276
+dec @r5
+rts
+jsr @r6
+cmp L50, 380
+sub @r6, @r3
+m3
+L6: clr @r0
+rts
+L7: mov @r5, @r6
+not L4
+L8: sub -284, L0
+clr L5
+L9: rts
+dec D0
+L10: red L9
+lea L7, @r6
+mov 494, L10
+m0
+cmp L9, L10
+L11: jmp @r7
+bne @r6
+jmp @r6
+L12: not L10
+dec @r5
+jmp L5
+jsr L6
+not @r4
+add @r0, L6
+prn -114
+m1
+bne @r2
+mov @r1, @r3
+m1
+red @r4
+inc @r1
+mov L12, @r6
+sub L9, @r0
+red @r2
+clr L5
+not L0
+m3
+m2
+red @r6
+red @r3
+bne @r0
+L13: prn 36
+add -192, @r4
+prn @r3
+prn L4
+prn 282
+jsr L1
+cmp L4, L10
+jmp @r5
+red @r6
+rts
+red @r1
+bne @r7
+inc @r0
+bne @r6
+not @r0
+inc L1
+sub @r4, @r3
+not @r3
+inc L0
+rts
+bne @r4
+rts
+dec @r1
+sub @r5, @r5
+red L10
+prn @r4
+lea L46, L6
+cmp L7, @r1
+dec @r1
+clr @r1
+prn L1
+m3
+bne L3
+sub @r0, @r6
+L14: rts
+dec @r0
+sub L12, L0
+L15: sub L0, @r2
+add @r6, L0
+m2
+clr L2
+L16: mov L12, L13
+prn L6
+sub @r7, L14
+red @r5
+lea L56, L15
+L17: rts
+jmp @r5
+rts
+prn 115
+clr @r2
+rts
+L18: prn L2
+jsr @r2
+m1
+m1
+cmp L13, -391
+lea L0, @r1
+mov L15, @r1
+jmp @r0
+bne @r5
+add -430, L13
+cmp L12, -315
+bne L13
+red @r3
+mov -83, L11
+dec L13
+prn L20
+cmp @r1, 202
+m4
+mov @r4, @r3
+inc @r6
+not @r5
+dec L0
+L19: not @r1
+inc L7
+rts
+m3
+jmp L8
+red L5
+mov @r5, L11
+dec L12
+m4
+add -252, L2
+clr L6
+sub L0, @r3
+add D0, L3
+m1
+clr L17
+bne L14
+jsr L18
+m3
+m2
+sub L1, @r1
+lea L9, L14
+sub L6, @r7
+not @r3
+jmp @r7
+cmp -471, L40
+clr L14
+add L2, @r1
+jsr L8
+bne L16
+L20: dec @r3
+L21: clr @r5
+inc @r0
+sub @r6, L17
+m4
+L22: add @r6, @r7
+L23: rts
+sub @r2, @r2
+red @r7
+L24: red @r2
+cmp L23, L23
+sub 158, @r0
+jmp @r5
+dec L7
+sub L8, L19
+rts
+clr L5
+cmp -174, @r4
+prn @r1
+L25: bne @r6
+cmp -78, L7
+rts
+add X0, @r0
+inc @r2
+jsr @r5
+L26: jsr L1
+L27: not L5
+rts
+cmp -504, L18
+dec @r6
+jmp @r2
+mov @r0, @r2
+bne @r5
+add @r6, L28
+m3
+add @r6, S7
+lea L7, @r6
+dec L15
+bne @r4
+red L10
+not @r3
+lea L27, @r0
+m0
+prn L20
+L28: add -501, L14
+prn 139
+L29: bne @r4
+prn -284
+L30: rts
+jmp L0
+cmp 364, @r6
+sub L16, @r0
+prn 187
+not L25
+lea L23, @r5
+rts
+lea S8, L11
+cmp 414, L15
+cmp -276, @r1
+inc @r2
+L31: inc @r3
+add 124, L1
+L32: jsr @r6
+clr @r6
+add L4, L11
+prn 487
+cmp L18, L28
+prn 413
+add @r4, L43
+dec L15
+not L31
+cmp 119, -112
+L33: dec L1
+mov D0, @r5
+L34: not @r7
+m4
+jmp @r0
+L35: add @r5, S9
+cmp @r5, @r6
+inc @r0
+m0
+inc @r3
+rts
+prn -342
+rts
+add @r4, @r6
+rts
+m3
+m3
+m4
+not L34
+jmp L12
+jsr @r6
+jmp @r5
+add @r0, @r7
+jmp @r2
+mov L22, L26
+clr L35
+jmp @r3
+L36: lea L26, L47
+jsr L33
+cmp -51, 159
+inc L18
+red L6
+L37: not L3
+sub L23, @r4
+jmp L12
+jmp L13
+cmp 79, @r4
+L38: rts
+jmp L31
+clr L32
+jmp L1
+bne L37
+m1
+L39: mov @r3, @r1
+L40: dec @r6
+prn L39
+add @r3, @r1
+mov L32, L30
+not @r7
+L41: bne @r5
+dec L15
+clr L1
+L42: mov @r1, D0
+clr L48
+L43: rts
+lea L28, @r0
+not @r2
+inc S5
+cmp @r1, @r6
+m3
+red @r7
+jmp L31
+rts
+red @r5
+inc @r5
+mov @r2, S7
+bne L8
+m1
+cmp @r5, 267
+prn L37
+bne L23
+mov L36, L42
+jsr L47
+dec @r6
+red @r6
+sub D0, L32
+L44: jmp L43
+sub L3, @r5
+L45: prn 99
+m2
+L46: inc @r7
+bne @r6
+L47: lea X1, @r7
+dec L15
+jsr @r7
+not @r7
+red L12
+lea L33, @r3
+prn @r4
+prn L33
+dec L45
+jsr L8
+red @r2
+L48: dec L33
+jmp @r2
+bne @r0
+rts
+lea L34, L20
+L49: cmp @r7, @r1
+add L37, S4
+m1
+prn L23
+clr L33
+cmp L47, L32
+m3
+sub -491, L37
+dec @r0
+inc L0
+mov @r0, L7
+mov -236, L43
+cmp 458, @r3
+jsr @r4
+inc @r4
+not L46
+not L34
+prn @r0
+lea X2, L14
+red L57
+jmp L49
+jmp @r4
+mov 125, @r5
+L50: red @r7
+not @r4
+mov L46, L55
+sub @r1, L8
+bne @r1
+L51: dec @r4
+clr @r6
+jmp X3
+m1
+L52: clr @r7
+prn L12
+m2
+L53: inc @r5
+lea L27, @r3
+jsr L22
+inc S2
+prn D0
+not @r5
+L54: jsr @r0
+bne L16
+cmp 73, -98
+add L5, @r0
+clr @r4
+m2
+rts
+m0
+dec L21
+rts
+m0
+jmp L39
+lea L28, @r1
+sub -7, @r5
+clr @r7
+L55: cmp @r3, @r7
+mov -503, @r6
+add S5, @r6
+clr X4
+jmp L3
+mov @r0, L27
+lea L33, @r2
+lea L25, L57
+L56: inc @r6
+rts
+dec @r1
+lea L16, L13
+prn D0
+cmp 492, D0
+dec L7
+cmp 145, 55
+m4
+m1
+lea S4, L58
+L57: rts
+dec L0
+cmp L59, -326
+prn -117
+bne @r6
+cmp -339, 492
+not S5
+jmp L59
+sub -411, D0
+jmp L5
+jmp @r5
+jmp S8
+clr L43
+m1
+cmp -212, 264
+lea L21, S4
+m2
+sub 184, L10
+L58: sub 90, L59
+L59: inc @r3
+add L15, L54
+stop
+D0: .data -21,-225,37,-173,153,-89,-398,-494,-462,-312
+D1: .data 223,94,25,188,-33,-199,-215,50,346,-41
+D2: .data 17,16,215,-340,133,-167,-430,-147,167,-430
+D3: .data 191,179,-359,232,329,101,-452,-26,265,211
+D4: .data -406,-306,231,130,-344,109,303,-44,-59,128
+D5: .data -218,-382,210,115,287,472,218,-197,173,-284
+D6: .data -173,-250,-421,-390,225,-146,-460,-449,447,232
+D7: .data -171,341,-392,198,-7,260,277,97,109,240
+D8: .data -437,-89,329,-166,249,-352,-424,103,-90,172
+D9: .data -238,127,41,-370,-40,306,-272,456,-9,362
+S0: .string "khfdd"
+S1: .string "gljdkiqzkkyveafn"
+S2: .string "mrgthvekfhjpko"
+S3: .string "ginvtdrgceqviqxsikcj"
+S4: .string "jiubhbclrcuhukjvwv"
+S5: .string "jidscf"
+S6: .string "xtuowhtttoerhpzpkzax"
+S7: .string "qnx"
+S8: .string "hoksqymzeotym"
+S9: .string "ezdjooacfkthlm"
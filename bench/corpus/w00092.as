@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r2
+    prn 84
+endmcro
+mcro m1
+    sub @r4, @r2
+    prn 71
+endmcro
+mcro m2
+    sub @r7, @r3
+    prn 54
+endmcro
+mcro m3
+    sub @r1, @r1
+    prn 80
+endmcro
+mcro m4
+    sub @r7, @r7
+    prn 2
+endmcro
+lea L0, S1
+L0: prn -341
+rts
+jmp L0
+cmp L0, @r7
+dec @r2
+dec L0
+L1: dec L1
+cmp L0, @r6
+inc L1
+mov L0, @r7
+inc @r7
+bne @r6
+jsr S9
+red @r3
+lea L0, @r7
+inc L0
+inc L0
+lea L1, L0
+not @r1
+lea L1, @r7
+red @r5
+dec @r6
+sub @r5, @r5
+inc L1
+sub L0, @r4
+rts
+L2: jsr @r4
+mov L2, L0
+not @r5
+cmp @r7, -196
+dec @r1
+L3: clr @r2
+mov @r5, @r7
+rts
+m0
+rts
+prn 97
+bne @r2
+dec L2
+cmp L0, 243
+not @r7
+inc @r2
+lea L1, L32
+lea L0, L0
+prn 453
+lea S7, L3
+inc S8
+dec @r0
+dec @r7
+clr @r6
+add L2, L3
+jsr @r4
+add @r5, @r7
+not @r4
+add -447, L1
+L4: clr L2
+jmp L9
+mov -350, @r2
+sub -319, @r3
+inc L0
+rts
+m3
+bne L2
+m1
+clr L3
+mov L10, @r4
+clr L2
+bne @r6
+prn L4
+cmp L3, 414
+lea D0, L1
+add @r5, L4
+clr @r6
+L5: red L5
+bne L2
+m0
+add L2, L1
+mov @r2, @r2
+m4
+mov L1, L0
+bne L2
+sub L3, L5
+bne L4
+dec @r1
+jmp L4
+rts
+L6: cmp @r1, @r5
+mov 214, @r6
+not @r6
+L7: dec L5
+mov 348, L2
+bne @r6
+cmp 33, 215
+inc L6
+sub 224, L6
+rts
+L8: rts
+m0
+L9: cmp -504, -232
+jsr L4
+red @r6
+mov L9, L6
+m0
+cmp @r2, @r2
+jsr @r1
+m3
+inc L6
+L10: rts
+inc @r6
+rts
+sub -30, @r0
+jmp @r4
+dec @r3
+m4
+red @r5
+clr @r6
+jsr @r4
+mov -343, L1
+cmp 238, L43
+jmp @r1
+bne L5
+L11: add -444, L5
+jmp L1
+not X0
+L12: inc L12
+red @r2
+red @r5
+rts
+prn @r1
+mov L5, @r6
+m3
+dec @r1
+not L9
+clr L3
+jmp @r3
+mov L5, S2
+rts
+L13: clr @r3
+jmp L2
+inc @r6
+jsr L8
+m0
+jsr L0
+jmp L7
+L14: lea L13, @r6
+inc @r5
+prn -360
+lea L3, @r1
+dec @r6
+jsr L9
+rts
+m1
+bne @r6
+add -309, L2
+rts
+clr @r3
+dec @r0
+m0
+L15: mov -353, @r2
+add @r1, @r2
+jsr L9
+add -493, @r3
+mov @r2, @r0
+add 381, @r7
+L16: rts
+sub -364, L6
+cmp 466, @r0
+prn @r2
+jsr L16
+red L6
+jmp L1
+not @r3
+clr @r2
+L17: inc L1
+prn L5
+mov L13, @r3
+lea L7, @r2
+rts
+prn L6
+lea S9, @r5
+jsr @r3
+jmp L6
+m2
+L18: lea L0, @r0
+red @r7
+L19: mov L2, @r7
+inc L14
+cmp L9, -55
+not @r5
+lea L9, @r0
+dec @r5
+lea L16, L2
+dec L12
+inc @r6
+m3
+lea L12, @r3
+L20: dec L7
+m2
+L21: bne S9
+add -314, L38
+add L10, L18
+red @r7
+L22: dec L13
+m1
+rts
+cmp L19, L14
+lea L11, @r1
+m0
+prn @r1
+prn @r3
+jsr @r2
+dec @r0
+m1
+jmp @r6
+prn -475
+jmp L3
+clr L0
+cmp 77, @r3
+not L19
+mov 365, @r0
+clr @r4
+inc @r1
+bne @r6
+clr @r7
+L23: not S1
+L24: bne L9
+prn @r1
+prn @r7
+inc @r2
+L25: rts
+prn 363
+jmp L16
+bne @r6
+red @r6
+lea L8, @r4
+rts
+add @r1, @r6
+jmp L24
+L26: not @r6
+sub 362, L0
+lea L12, S2
+jmp L13
+dec @r5
+jmp L22
+cmp @r6, 437
+inc L15
+clr @r2
+m1
+lea L17, L24
+lea L5, L24
+cmp @r0, @r1
+dec @r0
+lea L5, L17
+not L51
+rts
+cmp L13, @r2
+L27: mov 182, @r1
+red L8
+prn @r2
+jmp @r0
+sub L1, L7
+not L38
+lea L0, L22
+jmp L6
+L28: rts
+L29: lea L0, @r3
+rts
+not L5
+cmp -85, L22
+jsr S7
+L30: bne L53
+rts
+lea L16, @r7
+cmp L3, @r4
+sub 500, L7
+sub D0, @r3
+L31: sub @r6, L28
+L32: inc @r5
+jmp @r5
+add -454, @r3
+not D0
+bne L24
+m0
+not @r6
+dec @r5
+L33: inc @r4
+cmp 474, -446
+inc @r0
+L34: bne @r6
+inc L10
+m4
+m3
+mov L15, @r7
+mov L14, L28
+sub S1, L31
+clr L24
+rts
+mov 490, L23
+inc L28
+prn L14
+prn L12
+L35: cmp 422, -398
+rts
+L36: lea L33, @r0
+rts
+not L5
+not @r1
+L37: jmp @r6
+jmp @r5
+L38: jmp @r3
+m4
+L39: inc L7
+m1
+rts
+jsr L34
+not L18
+cmp @r4, D0
+cmp @r0, L12
+inc @r0
+m2
+L40: rts
+cmp -143, L57
+m2
+L41: jmp L22
+prn -254
+m4
+dec @r3
+inc @r7
+mov L19, @r4
+bne L17
+jsr @r1
+clr L31
+L42: not @r0
+jsr L26
+add -263, L0
+inc L21
+jmp L44
+L43: clr L3
+m1
+clr @r4
+m4
+mov @r0, L31
+dec @r7
+lea L36, S9
+jsr @r1
+mov @r4, @r5
+jsr L19
+prn L35
+clr @r7
+bne L22
+cmp @r5, L33
+L44: mov 313, @r7
+sub -502, L15
+sub -235, @r2
+inc L42
+mov D0, L30
+rts
+not L20
+inc @r0
+sub L20, L4
+prn @r1
+jsr L35
+bne @r4
+jmp L4
+L45: not @r1
+L46: add @r6, L14
+m1
+bne L46
+dec @r0
+L47: lea L37, @r1
+red X1
+dec @r5
+bne L1
+L48: dec @r1
+dec S7
+L49: inc L27
+m4
+L50: add L35, @r7
+lea L37, @r5
+L51: rts
+m2
+jsr @r3
+jmp L1
+inc L47
+red D0
+add L21, @r6
+lea L2, @r4
+inc L49
+add @r0, S7
+bne L37
+not @r4
+not @r4
+jmp @r1
+m1
+inc @r4
+cmp 224, -208
+m2
+L52: dec L10
+L53: sub L45, S8
+lea L22, @r6
+prn @r2
+sub -65, @r7
+sub 272, L13
+inc X2
+L54: inc @r5
+jsr L51
+red @r0
+red S2
+lea L59, L23
+dec L1
+bne @r0
+not @r5
+jmp L43
+L55: lea D0, @r7
+red @r2
+jsr L46
+dec L9
+m1
+not @r2
+L56: cmp 266, @r4
+clr L2
+dec @r5
+m4
+lea D0, L39
+bne L40
+L57: cmp -89, X3
+cmp @r6, @r2
+rts
+sub @r5, L54
+m3
+L58: bne L33
+red S0
+add L25, D0
+m3
+L59: bne @r0
+red S2
+mov S8, L20
+sub X4, S0
+m2
+stop
+D0: .data -137,-404,-488,492,144,-309,-128,306,161,-463
+D1: .data -185,-285,-263,-249,440,265,-207,-84,-215,457
+D2: .data 36,372,-139,-255,7,239,-379,-402,132,-219
+D3: .data 491,-243,-440,159,36,-459,-240,220,-428,392
+D4: .data 316,-484,27,82,-353,-242,-466,485,-257,-381
+D5: .data -391,438,-356,132,-423,-130,279,358,345,475
+D6: .data -377,-211,313,121,-38,43,-53,17,487,336
+D7: .data 50,-375,351,-135,-166,-167,87,457,165,-67
+D8: .data -355,-40,-243,345,-213,262,-385,58,481,-201
+D9: .data -449,379,194,413,62,-356,-394,-41,-335,-314
+S0: .string "bk"
+S1: .string "gpmpygzrzi"
+S2: .string "rhmzuchazqyj"
+S3: .string "eemixvj"
+S4: .string "hmivlksrvdny"
+S5: .string "mcbjpyacibxcli"
+S6: .string "kmcoemteka"
+S7: .string "eurojgg"
+S8: .string "ruukwbulx"
+S9: .string "orkdehsmi"
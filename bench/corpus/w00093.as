@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r4
+    prn 54
+endmcro
+mcro m1
+    sub @r0, @r3
+    prn 69
+endmcro
+mcro m2
+    sub @r1, @r1
+    prn 19
+endmcro
+mcro m3
+    sub @r5, @r1
+    prn 57
+endmcro
+mcro m4
+    sub @r1, @r6
+    prn 26
+endmcro
+jmp L0
+bne L0
+lea L0, @r3
+clr @r4
+sub L0, L0
+lea L0, L0
+bne L0
+red L0
+not @r6
+add L54, L0
+inc @r7
+L0: bne L0
+L1: inc @r2
+red L1
+clr @r2
+rts
+not L1
+bne L0
+not @r4
+bne @r0
+inc @r1
+prn 427
+m2
+lea L1, L0
+bne @r2
+L2: red L1
+L3: red D0
+red @r3
+L4: jmp L5
+prn L0
+prn @r6
+mov L1, @r1
+jsr @r1
+L5: add L4, @r6
+L6: jsr L4
+dec L5
+m3
+jsr L6
+inc L1
+lea L4, @r7
+cmp @r0, @r3
+m4
+cmp @r2, @r2
+rts
+cmp @r0, L17
+cmp L0, @r4
+red @r1
+dec @r1
+red L4
+clr L4
+not L6
+L7: prn @r7
+sub L0, @r1
+red L2
+add L0, @r0
+jmp @r7
+dec @r4
+inc L4
+rts
+bne L1
+clr @r3
+prn D0
+not @r5
+lea L5, L5
+clr L5
+sub @r1, @r1
+sub @r0, L1
+red @r4
+bne @r6
+sub L4, L1
+bne L29
+not @r0
+L8: dec @r7
+inc @r0
+dec @r1
+red L4
+rts
+m4
+lea L3, @r4
+m1
+prn -270
+jmp L8
+m2
+jsr @r2
+bne L7
+bne L0
+inc @r0
+sub 347, @r4
+prn @r0
+not L5
+clr @r2
+L9: dec @r3
+L10: rts
+rts
+red @r5
+m3
+jmp @r0
+lea L2, @r7
+red @r3
+m4
+bne @r0
+L11: not @r7
+inc L10
+red @r5
+L12: dec L5
+L13: clr @r5
+lea L13, L7
+L14: sub L14, @r0
+add -33, @r7
+m4
+dec L39
+jsr @r4
+not L13
+L15: jsr @r7
+prn @r4
+jsr L9
+add -20, @r5
+red @r1
+rts
+clr X0
+add -437, L8
+rts
+red L4
+m0
+clr L9
+jmp @r3
+jmp @r2
+bne S9
+L16: not L11
+not L3
+mov @r1, L3
+inc L8
+jsr @r1
+m2
+sub @r5, S8
+not @r6
+sub L3, L5
+prn 146
+L17: jsr @r2
+mov @r3, @r5
+not L31
+red X1
+rts
+clr D0
+sub L2, L12
+prn -507
+bne L31
+lea L1, @r0
+mov 167, @r1
+not D0
+bne L6
+mov @r1, @r0
+m0
+sub @r5, L17
+L18: sub 380, L5
+rts
+add 46, L9
+L19: mov @r5, L14
+m0
+L20: sub @r6, @r4
+add L13, L15
+m1
+mov L13, L18
+lea L3, @r3
+inc @r2
+clr L16
+jmp L9
+cmp D0, @r3
+m1
+cmp @r4, L10
+clr @r0
+mov L10, L4
+m2
+m3
+inc L14
+not L3
+bne @r3
+sub -277, @r7
+add @r3, @r0
+dec L3
+L21: lea L16, @r2
+L22: bne L2
+cmp 302, L22
+not L15
+jmp @r0
+lea X2, L23
+clr L50
+L23: rts
+clr L28
+bne @r6
+jmp @r5
+sub L9, @r4
+rts
+rts
+prn 416
+m2
+L24: cmp @r7, 161
+jmp @r2
+prn @r0
+mov 262, L19
+cmp L30, L17
+m0
+cmp @r6, 491
+rts
+cmp @r2, @r7
+L25: add @r7, @r5
+lea L11, @r1
+sub 198, @r6
+add @r5, @r0
+dec L5
+jsr @r7
+rts
+red @r4
+jsr L7
+m2
+L26: red @r5
+bne L2
+m0
+dec L5
+sub 192, L9
+lea L18, L9
+red L1
+prn 505
+mov L16, @r2
+clr @r7
+sub 34, @r1
+L27: mov -242, L12
+m1
+sub 293, L30
+L28: clr L11
+add 86, @r4
+mov L6, @r2
+cmp L8, -218
+cmp L4, L5
+L29: inc @r5
+not @r4
+red @r3
+inc L8
+jmp @r0
+inc @r6
+rts
+rts
+rts
+red L27
+L30: cmp L11, X3
+red @r4
+red L17
+L31: red @r3
+clr @r7
+clr @r2
+add 138, @r0
+prn @r7
+L32: rts
+not L27
+m1
+L33: lea L28, L7
+mov -53, L6
+mov @r3, L7
+bne @r0
+cmp @r3, L11
+add 486, @r0
+add L2, @r3
+add -408, @r0
+jmp L28
+red @r7
+dec @r4
+red @r1
+jmp @r7
+rts
+prn L11
+L34: jsr @r3
+not @r1
+dec @r2
+m0
+not @r7
+inc @r7
+red @r7
+jmp L9
+cmp L12, L4
+lea L32, @r4
+prn L5
+L35: jsr @r5
+L36: jmp L19
+clr L15
+L37: prn 10
+inc @r2
+not L22
+prn 268
+cmp @r6, L37
+cmp L31, L30
+bne @r0
+cmp L30, L13
+sub @r7, @r7
+inc L35
+lea L20, @r5
+cmp @r1, L18
+L38: rts
+inc @r5
+dec @r7
+L39: cmp @r6, 293
+cmp L11, @r7
+cmp 155, @r0
+inc @r5
+lea L50, L35
+add @r3, L20
+m2
+not @r2
+prn @r4
+bne @r0
+L40: clr @r5
+jsr @r1
+L41: lea D0, @r3
+m3
+bne L38
+rts
+rts
+m4
+jsr L14
+dec L37
+add L10, L18
+L42: clr L52
+clr L18
+dec @r5
+not @r4
+bne @r7
+clr L25
+add -21, L29
+m1
+m4
+dec L7
+rts
+clr @r5
+jsr @r6
+jmp @r3
+add -405, L20
+bne L16
+cmp L7, -331
+m1
+prn -253
+rts
+jsr L2
+jsr @r2
+jsr L20
+L43: inc L37
+mov @r6, @r2
+L44: clr L17
+m1
+jmp @r1
+dec @r0
+lea L35, @r5
+mov L58, L46
+sub 480, @r5
+L45: mov 215, L39
+mov L45, @r5
+bne @r1
+dec @r0
+dec L6
+clr @r2
+add @r0, L34
+not @r0
+add -235, @r5
+red L24
+m3
+m0
+L46: rts
+L47: jsr L34
+prn L31
+not @r1
+L48: mov @r7, L37
+L49: prn S1
+sub 248, @r5
+L50: clr @r7
+clr L22
+jmp L54
+sub @r4, @r5
+bne @r1
+m1
+cmp L40, -219
+m2
+jsr L1
+L51: dec L58
+mov -163, L52
+jmp @r2
+dec @r6
+jsr @r2
+L52: add L46, L37
+add L23, L52
+m4
+jmp L0
+cmp L7, @r1
+add 373, @r1
+add L55, @r2
+clr @r5
+L53: cmp 207, L56
+m2
+add L57, L0
+prn @r3
+clr L49
+prn L33
+m0
+red @r7
+dec @r5
+mov @r6, @r6
+not @r0
+rts
+mov L35, D0
+m4
+red L31
+sub L36, @r4
+red L49
+add @r1, L29
+cmp 406, @r6
+cmp -46, 454
+m2
+clr L57
+L54: inc X4
+dec L13
+inc @r0
+red @r1
+jmp L22
+add @r5, L34
+L55: cmp L24, L56
+lea L58, @r7
+L56: cmp L26, -232
+dec S5
+lea L9, L6
+clr @r6
+red @r4
+L57: sub -461, L18
+bne @r5
+cmp L41, 451
+rts
+prn 384
+L58: red L59
+dec @r6
+L59: inc D0
+dec S9
+mov D0, @r7
+not L16
+prn 441
+stop
+D0: .data -353,106,-147,248,-345,-346,283,144,-179,175
+D1: .data -120,160,-297,-24,241,-415,-379,449,274,-76
+D2: .data 420,-465,-492,66,15,7,184,407,-319,305
+D3: .data -372,-62,244,262,447,-339,-480,-84,-76,-438
+D4: .data 231,-61,-297,-295,-343,492,434,-5,348,-254
+D5: .data -55,-201,-51,-363,-200,-265,177,382,-345,-487
+D6: .data -254,-440,-332,-247,-171,340,172,-186,-170,413
+D7: .data 66,-204,-72,413,436,481,174,157,143,434
+D8: .data 398,103,374,-47,-95,-472,-361,-26,-125,-319
+D9: .data -58,87,348,188,323,-464,115,416,381,-382
+S0: .string "nxplbwogqsbrojqmd"
+S1: .string "hkn"
+S2: .string "araycljcyesxv"
+S3: .string "nqoaegrgkvan"
+S4: .string "yhrxdxgubbpyaeapbpme"
+S5: .string "yenlqlzmiy"
+S6: .string "qhqkiqmmlujknaubst"
+S7: .string "quhqcyyiowuj"
+S8: .string "yorlbevkxib"
+S9: .string "oisjvyhwcnih"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r7
+    prn 92
+endmcro
+mcro m1
+    sub @r4, @r4
+    prn 68
+endmcro
+mcro m2
+    sub @r3, @r6
+    prn 84
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 1
+endmcro
+mcro m4
+    sub @r3, @r4
+    prn 50
+endmcro
+mov @r7, L0
+mov 57, @r7
+inc @r0
+mov -293, @r0
+m2
+L0: rts
+L1: red @r7
+dec @r6
+m2
+clr @r4
+jmp @r6
+L2: inc @r1
+L3: red @r2
+L4: not @r1
+mov L2, @r5
+jsr L4
+L5: jmp L5
+dec @r7
+L6: not @r4
+dec @r1
+inc L6
+add @r6, L3
+prn S8
+cmp L6, @r0
+m2
+clr L59
+clr @r5
+prn @r3
+cmp @r3, L3
+not @r6
+clr @r2
+not L4
+mov @r4, L5
+mov @r6, @r3
+red @r7
+inc @r5
+jmp @r4
+L7: inc @r6
+m0
+m2
+cmp -434, L4
+red @r7
+red @r7
+dec L1
+cmp @r7, @r4
+jsr L3
+cmp @r4, L4
+cmp @r3, L5
+not L0
+jmp L2
+clr @r6
+jsr L3
+m1
+add 168, L7
+lea L7, L1
+bne @r1
+sub D0, @r2
+red L4
+inc @r5
+red @r4
+sub L0, L0
+m3
+cmp L2, @r5
+L8: jmp @r2
+L9: jsr @r4
+jsr D0
+jsr L0
+not D0
+dec @r4
+inc L6
+lea L1, L8
+red @r4
+inc @r4
+cmp L19, @r7
+prn -398
+prn -60
+not @r3
+L10: clr L17
+L11: lea L4, L10
+L12: rts
+bne L5
+add -227, L3
+L13: dec @r0
+jmp @r6
+mov @r2, @r5
+L14: bne @r5
+sub @r6, @r7
+red L0
+rts
+add L12, L13
+lea L3, @r5
+mov @r4, @r2
+clr L12
+rts
+dec @r3
+not L8
+dec L5
+add @r2, @r1
+m2
+dec @r6
+cmp L10, D0
+add @r3, L3
+m3
+rts
+dec L1
+L15: cmp @r5, @r6
+L16: bne @r7
+not @r6
+jmp @r5
+prn @r2
+jsr @r4
+not @r4
+m2
+dec @r2
+m4
+sub @r0, @r7
+sub L16, @r3
+add L6, L7
+L17: sub L25, @r2
+prn L0
+not L17
+jsr L8
+not L0
+L18: dec L5
+jsr @r1
+add L47, @r5
+L19: jsr L19
+not L11
+cmp L17, @r5
+bne L7
+add @r4, @r0
+rts
+lea L11, L16
+cmp @r5, @r4
+m0
+L20: rts
+dec L3
+jsr L16
+jmp @r4
+m0
+jmp @r2
+lea L3, L12
+jsr L10
+inc L9
+prn L9
+m0
+L21: not @r6
+inc @r5
+jmp @r7
+add 125, @r2
+inc D0
+m3
+sub -356, @r6
+mov -9, @r6
+rts
+cmp 294, @r2
+add -187, @r3
+bne L5
+bne @r3
+jmp L52
+m0
+lea L6, @r1
+not @r7
+rts
+rts
+rts
+not L1
+m4
+lea L16, @r6
+inc @r4
+mov 175, @r0
+m0
+sub @r3, @r6
+m2
+L22: inc @r4
+red L15
+mov 342, L18
+jsr L11
+prn 17
+sub L3, X0
+sub -109, @r1
+sub L9, @r4
+lea L20, @r6
+bne L13
+rts
+L23: prn 306
+jmp @r1
+clr @r7
+not L17
+mov @r0, L48
+rts
+L24: clr L6
+m3
+prn @r3
+clr L19
+m2
+prn L9
+m2
+mov L19, L10
+red L11
+red L9
+dec @r2
+add @r3, L10
+not L22
+not L10
+clr @r1
+L25: add -466, L19
+bne @r4
+add D0, @r7
+not @r7
+dec @r2
+add L8, @r1
+jsr @r6
+lea L0, L20
+inc @r2
+red L15
+prn L10
+rts
+L26: sub @r3, @r5
+mov -69, @r1
+sub @r1, @r1
+lea L12, @r7
+m3
+m1
+m4
+prn @r6
+sub @r3, L17
+jmp @r7
+cmp L24, @r5
+rts
+L27: clr @r0
+mov -120, L1
+clr L2
+red @r6
+rts
+mov @r0, @r0
+bne @r2
+cmp L13, L13
+inc L5
+prn L6
+m0
+lea L2, L27
+L28: bne @r5
+red @r1
+prn L12
+mov 136, @r4
+cmp -130, L10
+prn @r5
+cmp L1, L12
+red @r4
+cmp @r6, L19
+inc L51
+jmp D0
+cmp -94, 317
+bne @r7
+lea L23, @r2
+L29: jsr @r3
+mov -54, @r2
+inc L10
+jmp L11
+L30: rts
+lea L8, L2
+dec L10
+inc @r1
+jsr @r1
+jsr L12
+prn L52
+add L3, L25
+m1
+cmp @r5, 49
+m0
+add -219, L58
+prn L24
+L31: not @r1
+L32: not L34
+not L27
+sub @r5, L3
+m3
+red @r0
+lea L0, @r5
+clr @r0
+jmp L12
+L33: prn L12
+L34: dec @r3
+rts
+red @r0
+L35: bne L30
+jmp @r0
+L36: mov @r6, @r3
+sub @r2, @r3
+L37: red L36
+L38: bne @r1
+cmp L38, @r7
+cmp @r4, 34
+add L16, L26
+cmp L34, @r4
+jmp @r1
+rts
+L39: clr L19
+sub L31, @r5
+prn L2
+inc @r1
+rts
+lea L39, L27
+cmp L30, @r6
+jsr S2
+add L11, @r1
+L40: prn @r2
+prn 20
+bne L35
+bne L53
+sub @r3, @r2
+sub 51, L39
+jmp @r3
+mov @r1, L22
+inc @r4
+rts
+add X1, @r6
+mov L32, @r1
+rts
+jsr @r7
+bne L35
+L41: jmp @r1
+jsr @r3
+not L38
+jmp L14
+L42: add L41, L13
+sub @r6, @r7
+mov 492, L43
+lea X2, @r0
+L43: dec L12
+prn L21
+sub S1, @r1
+jsr @r0
+red L24
+inc @r3
+L44: inc L27
+L45: cmp @r7, @r3
+lea L17, L37
+rts
+clr S9
+L46: add 245, @r1
+sub L0, @r4
+jsr @r2
+jsr L8
+inc L26
+red @r3
+mov -151, @r7
+clr L24
+add L20, L1
+jsr @r1
+red @r1
+m4
+cmp @r0, L23
+bne @r2
+sub L42, @r5
+inc D0
+L47: jsr @r4
+m4
+red X3
+prn L4
+prn -99
+inc L59
+m3
+m1
+jsr @r1
+mov L7, L13
+add @r0, L9
+m3
+clr L8
+jsr L1
+jmp L8
+L48: mov L30, @r0
+rts
+inc @r2
+jmp @r5
+prn 105
+mov 496, @r2
+bne L48
+jsr @r7
+mov 224, L44
+clr L49
+not L7
+lea D0, L55
+dec L23
+jsr L34
+rts
+cmp L5, L3
+dec @r6
+L49: sub -180, @r4
+mov @r0, L10
+dec @r4
+clr L2
+m4
+cmp -280, @r7
+m4
+clr @r1
+L50: sub L28, @r6
+mov -375, @r1
+rts
+add L45, @r6
+L51: clr L32
+mov @r1, @r5
+mov @r0, @r7
+dec L23
+inc @r4
+L52: mov 107, @r3
+rts
+L53: jsr L40
+L54: inc @r4
+jmp @r2
+red @r4
+mov 198, @r0
+inc S7
+jmp @r0
+dec L36
+inc @r4
+bne @r7
+add -26, @r7
+clr L4
+dec S5
+add @r4, L25
+m2
+mov -494, L59
+m2
+L55: rts
+m3
+jsr L37
+lea L20, D0
+m1
+lea X4, L52
+prn -123
+L56: add @r1, S5
+red @r7
+L57: clr D0
+rts
+L58: jmp D0
+mov L59, L59
+inc L59
+L59: rts
+stop
+D0: .data -305,81,-156,-325,-129,-234,233,-497,359,-164
+D1: .data 22,212,334,-447,-39,-328,-375,25,-143,338
+D2: .data -498,-149,205,-89,80,-262,379,-467,260,-392
+D3: .data 334,-274,5,477,272,125,330,-20,491,-255
+D4: .data -110,371,-472,222,32,-34,172,-417,68,100
+D5: .data -370,375,-166,-392,232,-105,456,242,-302,267
+D6: .data 40,238,13,112,271,-312,17,-10,365,-362
+D7: .data -100,-161,-354,140,-205,283,376,170,62,149
+D8: .data -425,-197,127,90,211,-258,32,201,-130,111
+D9: .data -318,417,43,497,262,-59,-73,154,222,175
+S0: .string "iuhkfdiwyuy"
+S1: .string "ideoshaxfi"
+S2: .string "tqvn"
+S3: .string "yvy"
+S4: .string "cjz"
+S5: .string "pziondj"
+S6: .string "yltgkvbuojoiqh"
+S7: .string "kwmo"
+S8: .string "ah"
+S9: .string "wsniadxpwwcttxnhj"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r1
+    prn 63
+endmcro
+mcro m1
+    sub @r1, @r5
+    prn 66
+endmcro
+mcro m2
+    sub @r5, @r4
+    prn 50
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 77
+endmcro
+mcro m4
+    sub @r5, @r2
+    prn 75
+endmcro
+m1
+prn 324
+lea L0, @r0
+sub @r7, L0
+bne L0
+clr @r4
+sub 176, @r6
+red L0
+dec L0
+inc @r4
+prn @r0
+L0: rts
+prn S9
+m3
+not L0
+L1: sub @r0, @r5
+L2: red @r3
+jsr L0
+red L2
+sub @r3, @r0
+L3: rts
+lea L27, @r2
+jmp @r4
+add @r5, L24
+clr L13
+L4: inc L1
+prn L4
+m4
+prn 284
+m3
+L5: sub -416, @r6
+dec L3
+bne L0
+inc @r0
+jsr L4
+L6: rts
+L7: jsr L5
+jsr @r6
+sub 445, @r0
+mov 195, @r0
+add L0, L6
+jsr @r4
+prn L1
+m2
+cmp L2, @r4
+dec L2
+prn L2
+add @r5, L0
+inc L2
+bne L5
+m4
+mov L2, L5
+lea L3, @r3
+jsr L1
+bne @r5
+red @r2
+cmp @r6, @r7
+inc @r6
+jsr @r6
+add @r4, L0
+rts
+jmp @r2
+cmp -261, @r5
+L8: jsr L2
+not L7
+rts
+jmp L4
+cmp L0, L7
+dec L8
+bne L2
+jmp L4
+rts
+rts
+clr L8
+jmp @r4
+rts
+bne @r6
+not @r1
+bne @r5
+lea L4, L0
+L9: prn -109
+mov @r5, @r4
+jsr @r3
+L10: add @r7, @r3
+rts
+red L3
+add -271, @r6
+L11: rts
+dec @r6
+red @r5
+sub -470, @r2
+m4
+jsr L5
+jmp @r2
+dec L2
+not L7
+dec @r1
+red @r1
+m0
+mov L9, L6
+prn 302
+red L0
+mov L9, L59
+bne @r6
+m2
+jmp L11
+lea L5, L5
+add 305, @r4
+L12: not L3
+prn L5
+dec L8
+L13: red @r2
+red @r5
+inc L12
+bne @r7
+m0
+prn L7
+bne @r7
+mov S0, L2
+not @r1
+inc L5
+add 251, @r6
+m4
+bne @r7
+inc @r1
+cmp -459, L11
+not L5
+bne @r4
+sub 418, L0
+dec L9
+sub -406, L19
+rts
+sub @r1, @r7
+bne @r5
+m2
+rts
+clr L5
+bne L6
+L14: mov D0, @r3
+L15: red L13
+L16: not @r3
+red L2
+jmp L10
+not L7
+L17: sub L15, @r6
+cmp L8, L16
+sub @r2, @r6
+bne L15
+not @r1
+L18: lea L17, L0
+jmp L6
+clr @r6
+jsr L15
+L19: cmp L14, @r0
+clr L8
+add 417, L16
+cmp @r6, L15
+clr L6
+L20: add -230, L10
+lea L5, @r4
+cmp 360, @r6
+bne L7
+L21: lea L17, L13
+dec L15
+sub @r0, L1
+clr @r3
+L22: prn L4
+L23: prn @r1
+jmp @r2
+add @r5, @r1
+add @r5, L17
+not @r1
+inc L10
+m2
+jmp L9
+m3
+cmp 105, @r0
+m2
+jmp L6
+jmp L10
+clr @r6
+cmp L6, L12
+m3
+jsr @r3
+prn L6
+dec @r6
+clr L23
+cmp 162, L15
+sub @r0, @r7
+not @r2
+m2
+lea L59, @r3
+dec @r6
+add L33, @r2
+mov @r6, @r5
+cmp L5, L19
+L24: bne @r2
+jsr @r3
+mov 383, @r3
+m3
+bne L10
+red @r0
+sub L3, @r7
+mov @r2, @r1
+L25: dec L2
+mov 371, X0
+red L15
+lea L8, X1
+bne @r1
+L26: rts
+rts
+lea X2, @r6
+inc @r6
+mov @r3, @r1
+clr @r3
+m3
+not @r2
+L27: jsr @r5
+L28: not L21
+red L26
+jmp @r2
+inc @r0
+jsr @r2
+not L10
+inc @r3
+prn @r3
+sub @r1, L3
+add @r4, L21
+jmp @r1
+inc L20
+lea L7, @r2
+jmp @r5
+rts
+mov L25, L12
+m4
+cmp @r4, L18
+jsr @r6
+red L28
+prn L13
+not L2
+not @r2
+not L27
+L29: inc @r6
+red L31
+mov L13, L51
+L30: cmp -391, L13
+sub @r4, L16
+clr @r1
+m3
+bne L7
+L31: bne @r6
+m0
+lea L0, L29
+add S6, @r1
+jmp L8
+m3
+dec @r1
+red L4
+add L24, L25
+lea L17, L7
+red S2
+m2
+rts
+dec L12
+m2
+rts
+m1
+add 290, @r3
+prn L8
+clr L13
+not @r6
+m3
+cmp @r7, @r3
+sub L29, @r2
+L32: lea L30, L24
+jmp @r1
+clr @r1
+rts
+inc L0
+clr @r4
+L33: not @r5
+m2
+m4
+prn @r6
+jmp @r5
+jsr @r3
+rts
+m0
+mov 62, @r6
+prn L5
+cmp L20, @r5
+L34: not S5
+jsr @r0
+m2
+bne @r2
+jsr @r5
+jsr L21
+add L7, @r5
+jsr L3
+jmp L53
+L35: jsr @r0
+clr L28
+rts
+red L25
+red @r2
+L36: cmp @r6, @r6
+dec L1
+mov L17, @r6
+add @r6, @r5
+m3
+rts
+red @r0
+jmp L33
+not L33
+L37: jsr @r3
+m1
+dec @r2
+clr @r5
+cmp L7, @r3
+lea L2, L6
+not @r1
+dec @r1
+jsr L11
+not @r7
+prn @r3
+bne @r2
+dec L31
+dec @r2
+m1
+prn 388
+jsr @r6
+add L7, L45
+m4
+bne @r0
+jsr @r7
+rts
+L38: cmp L26, D0
+m0
+jsr @r4
+L39: clr @r3
+prn -21
+L40: add 106, @r2
+prn @r6
+inc L5
+L41: rts
+jmp @r1
+dec @r4
+mov 156, @r2
+jmp L52
+bne L22
+red @r2
+m0
+inc L35
+jsr @r7
+L42: bne @r3
+inc @r3
+dec L0
+red L31
+clr @r0
+L43: prn @r2
+cmp 31, L8
+not L8
+not @r5
+mov 31, @r6
+red @r3
+L44: rts
+L45: lea L49, L25
+L46: jsr @r1
+L47: clr L14
+L48: jsr @r0
+not @r3
+jsr L1
+not @r2
+lea L44, @r6
+L49: add L10, L29
+inc @r5
+red @r6
+m2
+lea S0, S6
+red @r7
+add @r3, @r5
+prn 192
+m3
+bne L23
+jmp D0
+bne @r2
+rts
+mov @r6, L15
+not @r1
+clr L54
+add @r3, L23
+sub @r7, X3
+mov @r5, L20
+jsr @r2
+L50: rts
+jmp L5
+not L16
+L51: prn @r6
+sub L29, @r0
+L52: not L22
+dec @r6
+L53: rts
+clr L54
+lea L59, @r3
+m0
+clr L56
+prn @r3
+sub 4, L58
+clr @r1
+add @r6, L54
+L54: jmp L55
+red L53
+inc D0
+dec @r6
+mov @r6, @r7
+L55: dec S4
+L56: sub L9, L35
+prn @r0
+jsr L57
+inc X4
+L57: inc @r5
+red @r5
+bne L26
+sub @r7, @r2
+dec L58
+jsr L44
+jmp @r6
+clr @r6
+prn @r6
+lea L59, @r2
+L58: prn L59
+jmp L33
+jmp L40
+not @r1
+cmp L59, L16
+sub D0, L59
+rts
+clr @r4
+L59: add -171, @r4
+inc D0
+stop
+D0: .data -482,-436,412,-316,-241,47,-280,-68,-416,339
+D1: .data -241,-311,221,178,-390,-88,-477,19,-28,-382
+D2: .data 344,-417,23,-13,-105,447,94,339,-301,53
+D3: .data 133,83,-273,49,410,372,-289,-290,297,124
+D4: .data -168,-389,-38,-266,32,222,318,338,361,-489
+D5: .data -120,-149,206,-335,-272,189,467,368,-495,215
+D6: .data -396,294,346,-499,-444,-440,279,-208,314,-317
+D7: .data 103,-3,94,372,150,293,474,-358,-315,-496
+D8: .data 198,183,-253,185,-280,62,182,-12,408,359
+D9: .data -69,-70,-459,-47,2,305,154,272,-13,-392
+S0: .string "bhcnocvo"
+S1: .string "efmjysnyumbeelb"
+S2: .string "xawqvrdhhztcajt"
+S3: .string "uxwsozglquoxllccc"
+S4: .string "yeynivppakamlp"
+S5: .string "alsgkxsupfrtej"
+S6: .string "jllztvqiycjge"
+S7: .string "vhlsvlhstnlhgamse"
+S8: .string "hlccttgqohqkwgp"
+S9: .string "vdv"
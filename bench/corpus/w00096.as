@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r4
+    prn 1
+endmcro
+mcro m1
+    sub @r5, @r7
+    prn 65
+endmcro
+mcro m2
+    sub @r7, @r2
+    prn 47
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 54
+endmcro
+mcro m4
+    sub @r7, @r0
+    prn 99
+endmcro
+lea L0, @r2
+prn -142
+m0
+mov L0, @r4
+inc @r1
+sub @r1, @r6
+inc L0
+not @r5
+lea L0, @r3
+cmp @r6, 344
+jmp L0
+jmp @r3
+add L0, L0
+inc L0
+jmp @r4
+m2
+bne L0
+sub L0, L0
+L0: jmp @r5
+inc @r4
+m4
+dec L0
+lea L0, @r0
+L1: jsr L0
+cmp 88, -191
+m0
+add L0, @r2
+m0
+jsr @r6
+bne @r0
+bne @r0
+clr @r2
+m1
+dec @r7
+m1
+add L0, L0
+red @r5
+red @r0
+red @r5
+sub @r3, L1
+lea L1, @r7
+jsr @r5
+L2: mov -233, @r6
+lea L1, @r4
+jmp L0
+lea L0, L24
+mov @r6, L0
+cmp L2, L2
+add @r0, L1
+m4
+not L0
+not @r6
+clr @r3
+jmp @r4
+jsr @r3
+m2
+cmp @r4, @r3
+m3
+L3: prn @r7
+L4: prn -137
+mov 370, L0
+mov @r4, L3
+m2
+clr L3
+bne @r2
+rts
+L5: prn L0
+L6: jmp @r5
+mov L1, L5
+jmp @r3
+inc @r1
+clr L1
+lea L1, L1
+L7: lea L1, @r1
+clr @r7
+rts
+not L2
+dec @r0
+not @r4
+lea L4, @r4
+lea L6, @r4
+red @r3
+m1
+cmp @r5, L0
+add @r2, L5
+mov -42, L1
+m3
+m0
+inc @r0
+m3
+cmp -307, L5
+sub 181, @r1
+dec @r7
+dec @r1
+prn -121
+dec @r7
+bne @r7
+prn L2
+L8: jmp L8
+m4
+jsr @r5
+dec @r0
+add 205, L44
+bne L6
+not D0
+sub L6, @r0
+jmp L1
+red @r6
+not @r5
+inc S2
+rts
+clr @r3
+cmp @r6, L59
+L9: add L7, L5
+add L6, @r7
+lea L0, @r4
+L10: bne @r3
+L11: bne X0
+jmp @r2
+L12: clr @r3
+add L8, L8
+L13: mov 200, L4
+bne @r6
+clr L1
+L14: mov @r2, L8
+add @r3, @r7
+jmp @r2
+jsr @r2
+add -280, L9
+cmp L12, -198
+inc @r7
+red @r7
+sub @r5, L9
+prn @r5
+add L0, L9
+lea L8, @r3
+clr @r1
+not L9
+clr @r6
+lea L0, L13
+add 385, @r0
+jsr @r1
+red @r0
+L15: jmp @r5
+bne @r6
+lea L8, @r7
+L16: dec @r3
+red L11
+jsr @r2
+lea L8, @r2
+jmp @r7
+jsr S2
+add @r5, @r3
+L17: dec @r6
+m0
+m0
+sub L54, @r3
+mov 262, L6
+jmp @r1
+red L13
+sub -105, @r7
+lea L6, @r4
+cmp L4, -68
+L18: not @r5
+dec L2
+add L3, L8
+lea L10, @r0
+clr L7
+jsr L9
+bne L7
+L19: add L13, L12
+L20: add -274, L2
+rts
+inc D0
+add @r1, L10
+L21: bne L11
+inc L4
+clr L2
+add -36, L5
+m0
+m0
+prn L51
+not L15
+jsr @r5
+L22: jmp @r7
+inc L10
+jsr L15
+m1
+L23: lea L16, L12
+lea L7, L15
+clr L9
+L24: clr L4
+rts
+cmp 56, 138
+mov @r7, @r7
+m4
+clr L5
+mov @r3, @r6
+bne L8
+m3
+sub 438, L0
+L25: mov L24, @r7
+jsr @r5
+not L50
+jsr L38
+clr @r5
+not D0
+lea L6, L2
+not L3
+rts
+L26: sub L5, L24
+inc L23
+L27: bne @r1
+m4
+bne L16
+prn L25
+bne @r0
+L28: dec @r2
+jmp @r4
+sub -278, X1
+inc L4
+red L18
+bne L10
+dec @r7
+m0
+lea L4, X2
+L29: dec @r7
+jmp L1
+L30: red @r3
+jsr L2
+cmp -105, @r5
+m2
+mov -295, @r4
+jsr @r7
+red L3
+clr S9
+L31: inc L37
+sub D0, L20
+bne L35
+lea L24, L9
+mov L10, @r4
+m2
+jmp @r7
+cmp L19, @r2
+bne @r7
+m3
+sub 173, @r2
+L32: inc L16
+dec @r4
+sub L56, S6
+sub L8, @r3
+add L21, L29
+not L0
+red L15
+inc L14
+dec @r2
+L33: cmp @r4, 407
+sub 385, @r4
+mov @r5, L18
+sub 395, @r5
+rts
+m0
+prn 304
+inc @r7
+not @r6
+add @r7, L15
+red @r4
+dec L15
+red @r6
+jmp L32
+not @r0
+inc @r3
+dec @r5
+cmp -371, @r7
+jsr S2
+prn 153
+L34: prn L19
+clr @r7
+lea L1, @r0
+cmp @r6, L28
+bne @r6
+mov @r5, L17
+red L15
+inc @r3
+mov 109, L16
+cmp L5, -120
+L35: red @r4
+m1
+not L17
+add 23, @r2
+L36: sub -480, @r2
+rts
+cmp -407, @r5
+L37: mov @r3, L37
+cmp L16, L29
+m0
+jmp @r2
+mov L2, L19
+m2
+L38: inc @r2
+jsr @r3
+jsr @r0
+add L25, @r6
+red @r5
+jmp L6
+L39: add -218, L58
+inc @r1
+add -510, @r0
+L40: red L2
+dec L35
+prn -26
+m3
+L41: dec @r5
+red @r6
+mov L44, L33
+add L26, L10
+add @r7, @r3
+dec L10
+bne @r6
+jsr @r0
+m0
+rts
+red @r0
+not @r4
+m2
+L42: bne @r4
+dec @r7
+clr L8
+lea L19, @r4
+add L43, @r4
+prn 375
+L43: red @r6
+red L39
+L44: red @r0
+not L32
+L45: jsr L43
+jsr @r0
+sub 466, @r3
+lea L29, L14
+lea L39, @r1
+add @r2, L31
+not @r2
+dec L6
+mov L28, @r7
+dec @r0
+L46: red L25
+rts
+L47: jsr @r4
+prn -148
+lea L19, L46
+add L30, L3
+cmp @r3, 334
+dec @r4
+jsr @r0
+add @r5, L15
+sub @r4, L33
+lea L5, @r4
+sub @r4, L37
+L48: lea S4, L43
+L49: prn @r0
+cmp 401, @r7
+clr L35
+clr L8
+sub @r2, @r3
+clr @r1
+m3
+bne L31
+L50: prn -188
+not L2
+inc D0
+not @r0
+jmp @r6
+m1
+m1
+lea L17, L16
+dec L45
+prn -410
+clr @r7
+bne L59
+L51: sub @r5, L51
+lea L28, @r3
+sub L31, L4
+clr @r7
+sub @r4, @r0
+cmp -122, @r3
+inc L43
+L52: red @r6
+L53: add S4, @r2
+jmp @r1
+clr L47
+bne L4
+jmp L29
+jsr @r3
+not @r5
+rts
+L54: bne @r6
+jmp L43
+rts
+rts
+rts
+jsr L48
+add L57, @r7
+not L6
+m0
+red L27
+rts
+L55: not L45
+L56: add @r1, L59
+L57: jmp @r1
+m1
+clr @r3
+lea L2, @r0
+clr L20
+L58: inc L59
+red L59
+red L2
+jsr @r4
+lea L23, L1
+sub @r7, @r6
+sub L55, X3
+dec S1
+add L0, @r6
+inc @r7
+L59: prn S2
+add @r1, S7
+jsr @r6
+red @r1
+add -32, @r7
+inc @r1
+add @r4, X4
+rts
+red S6
+cmp D0, 437
+inc L30
+inc @r1
+inc D0
+lea D0, @r2
+not D0
+jmp D0
+inc D0
+stop
+D0: .data -207,-495,-471,42,121,234,379,-417,451,-60
+D1: .data 471,-371,200,124,-123,288,312,-62,-77,-297
+D2: .data 175,310,55,80,238,89,387,-120,265,18
+D3: .data 29,303,-473,-350,147,148,-113,132,500,-397
+D4: .data 252,-259,430,-405,-134,-342,-136,-8,375,-292
+D5: .data -78,440,221,199,57,69,-93,-336,-51,250
+D6: .data -18,296,270,-255,105,-178,133,-271,-313,-347
+D7: .data -246,-236,-351,166,-201,-125,-411,-222,-48,175
+D8: .data -493,136,43,-220,-494,395,-218,258,-447,-1
+D9: .data -114,-181,-272,460,124,495,36,462,-102,-476
+S0: .string "vmfuvgygpzhcsip"
+S1: .string "caldppj"
+S2: .string "bnyoslpx"
+S3: .string "lxulfurf"
+S4: .string "txglvflgkfv"
+S5: .string "abbjs"
+S6: .string "vxsoifhdw"
+S7: .string "dbmjwvzvvgoy"
+S8: .string "kofxysbvhx"
+S9: .string "anaxumdwfqqmhlamtvkr"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r7
+    prn 71
+endmcro
+mcro m1
+    sub @r1, @r0
+    prn 63
+endmcro
+mcro m2
+    sub @r1, @r0
+    prn 12
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 30
+endmcro
+mcro m4
+    sub @r1, @r7
+    prn 24
+endmcro
+jmp @r2
+rts
+bne @r6
+prn L0
+add -58, L44
+L0: not @r1
+jsr @r4
+add 251, @r5
+lea L0, L0
+L1: dec @r2
+dec L0
+sub -157, @r6
+jmp L0
+add @r2, @r2
+prn -230
+L2: dec L0
+lea L1, L2
+dec @r7
+clr L5
+L3: prn L2
+L4: jsr @r4
+bne @r1
+rts
+mov 432, @r5
+bne @r4
+lea L18, L1
+prn 301
+add @r0, L3
+L5: jmp @r0
+red L2
+sub 309, @r1
+red L4
+prn L5
+bne L1
+jsr L5
+clr @r5
+mov @r7, D0
+jsr L2
+bne @r2
+L6: jmp @r6
+bne @r7
+lea L4, @r1
+prn L17
+rts
+clr @r4
+inc L3
+prn 462
+jmp @r0
+add L6, L2
+bne L0
+mov @r1, @r7
+red @r2
+m3
+inc @r2
+mov -370, @r4
+m3
+rts
+L7: add -445, @r0
+m2
+lea L3, L1
+rts
+inc L7
+mov @r0, @r5
+rts
+jsr L7
+lea L26, @r2
+jmp @r4
+L8: lea L4, L8
+lea D0, L0
+L9: add L0, L0
+prn @r0
+rts
+prn @r1
+L10: jsr L7
+L11: jmp L9
+m0
+L12: jsr L5
+rts
+L13: prn L10
+prn -208
+jsr @r3
+sub -323, @r2
+not @r5
+add -499, L6
+L14: cmp @r1, L12
+L15: jmp @r4
+not L15
+bne @r4
+rts
+clr L20
+m4
+dec @r7
+bne L7
+jsr @r0
+L16: mov -302, L12
+lea L4, @r3
+bne L7
+jmp L12
+clr @r3
+L17: red @r4
+m1
+not @r5
+jmp L6
+prn @r3
+L18: jmp L0
+rts
+rts
+jmp @r7
+jsr @r6
+red @r7
+mov L5, @r7
+clr @r7
+rts
+bne @r4
+cmp @r6, L8
+m0
+inc @r5
+inc @r4
+L19: not @r2
+lea L19, @r3
+clr @r2
+not L12
+L20: cmp @r2, L17
+m1
+L21: red @r3
+m0
+jmp L14
+lea L2, L5
+clr L11
+mov L41, @r1
+L22: add 412, L20
+clr @r1
+sub @r3, L6
+not L17
+jsr L3
+dec @r1
+dec L19
+clr L2
+not @r1
+jsr L19
+jsr @r6
+L23: inc L23
+L24: dec @r7
+not @r0
+add 401, @r5
+L25: inc @r3
+jmp L14
+inc @r6
+not L6
+mov -118, L8
+L26: clr @r6
+prn L0
+red @r4
+jsr @r1
+m0
+L27: jsr L8
+lea L23, L5
+clr L17
+dec L17
+red @r4
+inc @r1
+m0
+bne L11
+m0
+red L14
+add @r5, @r3
+m0
+bne L15
+clr @r5
+cmp @r1, L27
+L28: add -32, @r7
+rts
+prn X0
+m4
+m2
+add @r4, D0
+sub -115, L10
+m1
+m3
+clr L19
+clr L18
+inc @r4
+jsr @r0
+clr @r5
+L29: red L23
+bne @r1
+lea L11, L21
+cmp L13, 64
+not @r0
+rts
+L30: not @r6
+inc @r0
+not @r4
+prn @r5
+L31: dec @r3
+red L12
+m3
+clr @r3
+m2
+prn L54
+clr @r3
+not @r4
+dec L2
+mov -443, L49
+cmp 244, @r1
+L32: bne L2
+red L58
+inc @r4
+red L18
+not L19
+red @r6
+jmp L28
+jmp L14
+m3
+mov @r2, @r5
+add -224, L7
+dec @r2
+m4
+lea L6, @r2
+L33: jsr L2
+m2
+dec L20
+m4
+bne L0
+jmp @r3
+L34: cmp 130, L28
+dec @r1
+bne @r7
+jsr L24
+sub @r6, L5
+sub 26, S1
+clr @r5
+L35: not S6
+jsr @r4
+jsr @r0
+bne S2
+red @r3
+bne L21
+cmp 199, @r4
+cmp L26, 157
+jsr @r7
+cmp @r6, @r1
+red L2
+add -313, S9
+red L5
+not @r7
+mov L32, @r3
+cmp @r6, L41
+clr @r4
+mov -337, L33
+not L35
+mov L14, @r7
+L36: red L1
+L37: cmp @r1, @r1
+bne @r2
+m3
+not @r5
+sub L6, @r0
+dec L11
+lea L2, @r1
+cmp L18, D0
+sub @r4, @r7
+cmp @r6, @r5
+prn L34
+red L3
+bne L33
+m0
+clr L7
+dec @r4
+cmp L15, @r7
+m1
+lea S3, @r3
+add @r0, @r2
+add L38, @r7
+lea L16, @r6
+L38: jsr L37
+jmp @r2
+sub -113, @r4
+bne L35
+add 394, @r5
+prn @r5
+sub L24, L31
+mov @r0, @r1
+not L24
+jsr @r5
+jsr L6
+not L26
+jsr L58
+prn @r7
+m4
+m3
+mov -480, @r6
+m4
+inc @r1
+clr L31
+bne L23
+L39: mov @r2, @r7
+L40: jsr L5
+L41: add @r3, L1
+cmp @r3, L32
+jmp @r1
+bne L36
+lea L3, @r0
+cmp -476, S8
+clr @r0
+L42: dec @r5
+sub 369, L22
+dec L18
+rts
+red @r7
+not @r2
+sub L14, @r3
+L43: mov 82, @r6
+mov @r7, L4
+L44: jmp L34
+jmp @r4
+clr L21
+prn L48
+red @r7
+sub -461, @r1
+clr @r3
+bne L2
+not L2
+m1
+dec L31
+dec L30
+jmp @r7
+prn @r3
+jsr L43
+L45: add L32, L28
+sub X1, @r4
+inc @r7
+cmp -503, -187
+inc L12
+inc @r2
+prn L26
+add 435, L18
+L46: dec L5
+lea L44, L28
+bne L44
+cmp 222, 429
+jmp L5
+mov 173, L15
+mov 11, @r0
+m4
+sub L51, L7
+jsr @r4
+inc @r0
+sub 104, L7
+mov 176, @r5
+bne @r4
+prn @r7
+jsr X2
+L47: not @r3
+L48: dec L45
+mov @r2, L37
+bne @r0
+dec L36
+sub L5, @r4
+cmp 259, L13
+cmp @r7, L40
+m4
+L49: red X3
+m2
+L50: sub L25, @r3
+not L22
+rts
+not L51
+lea D0, @r3
+sub 255, L54
+sub L19, L38
+L51: inc L30
+inc @r6
+sub @r0, @r7
+lea L20, L19
+prn 314
+add L15, @r3
+rts
+add L39, L8
+prn @r6
+inc @r2
+L52: jmp @r4
+m4
+m0
+inc L26
+sub @r5, L43
+jmp L28
+prn @r4
+lea L27, L55
+lea L32, L20
+L53: not @r2
+cmp L45, -283
+m1
+prn 213
+dec @r3
+jsr @r3
+add L22, L23
+clr @r2
+L54: mov 406, @r3
+sub @r7, @r5
+L55: add L43, @r7
+not @r5
+jsr @r5
+jsr S4
+lea L54, L21
+m0
+m2
+dec D0
+sub 66, @r0
+mov @r2, @r4
+not L40
+rts
+dec L5
+m0
+bne @r3
+bne L59
+lea S7, D0
+rts
+inc D0
+add @r2, L3
+dec @r5
+m2
+jsr L50
+jmp @r3
+prn @r6
+prn -491
+jmp L18
+cmp 170, -222
+add L59, @r0
+sub @r0, L21
+jmp @r3
+not @r6
+L56: jsr @r7
+L57: prn -176
+L58: not D0
+clr @r4
+inc X4
+not S3
+L59: cmp D0, @r5
+sub D0, @r6
+stop
+D0: .data -69,-384,-95,-68,500,-243,430,-86,-436,26
+D1: .data 443,-83,128,420,-35,250,491,-138,-253,-126
+D2: .data 220,-349,330,-403,408,195,-458,141,387,384
+D3: .data 96,-400,-421,382,89,71,283,463,-349,-346
+D4: .data 231,-232,-209,233,205,-27,113,38,215,355
+D5: .data -306,-208,-273,89,-318,-93,-299,368,-156,61
+D6: .data -137,-328,-411,-493,-286,-109,-281,370,-495,423
+D7: .data 259,392,-419,48,496,224,-122,-123,-133,-227
+D8: .data -392,245,410,204,-142,-427,-264,-169,228,-161
+D9: .data -212,-270,176,-445,497,490,78,-323,219,44
+S0: .string "wswxzskxadxoicqlbpp"
+S1: .string "mud"
+S2: .string "tewy"
+S3: .string "ccqavpxqok"
+S4: .string "vymykttsdctkmecik"
+S5: .string "hrroljsd"
+S6: .string "tjffawtoxznkrzhyc"
+S7: .string "isamsgq"
+S8: .string "cczxjnxwmcczmzdxvhvt"
+S9: .string "dsj"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r1
+    prn 10
+endmcro
+mcro m1
+    sub @r6, @r1
+    prn 30
+endmcro
+mcro m2
+    sub @r4, @r6
+    prn 78
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 6
+endmcro
+mcro m4
+    sub @r3, @r5
+    prn 48
+endmcro
+mov -3, L0
+jmp @r2
+rts
+not @r6
+L0: cmp -172, -26
+L1: red L1
+inc @r1
+rts
+not L1
+red @r6
+L2: jmp @r2
+jmp @r1
+jmp @r1
+red @r4
+add -256, @r5
+L3: cmp 372, -143
+L4: cmp @r2, L2
+m4
+L5: jmp L4
+red @r4
+dec L16
+not @r6
+red @r4
+L6: mov -487, @r6
+not @r1
+inc @r6
+dec @r5
+red L5
+L7: rts
+red @r5
+not @r6
+dec @r5
+bne @r1
+dec @r1
+cmp L58, 110
+mov -225, @r4
+clr L3
+jmp L4
+m4
+dec @r3
+jmp @r4
+clr @r0
+inc L7
+jsr @r3
+add -413, @r0
+sub 391, @r3
+not L6
+m2
+inc @r2
+m4
+sub 42, @r0
+mov -161, @r0
+m4
+red @r3
+clr @r6
+mov L6, @r3
+not @r3
+L8: red L3
+jmp L4
+L9: jsr L1
+mov L1, L3
+add 295, @r4
+prn @r0
+mov @r2, @r6
+inc L0
+inc @r0
+red L5
+mov D0, @r7
+inc L7
+rts
+L10: jsr L4
+red L9
+red @r1
+clr @r6
+L11: sub 303, L11
+jmp @r2
+lea L11, @r7
+dec L11
+cmp @r4, 137
+clr L11
+L12: prn @r3
+mov @r1, L11
+m0
+m4
+mov @r0, @r0
+L13: add @r5, L6
+m4
+jmp L34
+sub @r3, L42
+dec L10
+mov @r1, @r0
+L14: mov L10, @r6
+mov 191, @r5
+dec @r7
+red @r5
+clr L13
+mov @r4, L5
+rts
+inc @r0
+inc L12
+cmp @r4, -480
+dec @r4
+clr @r4
+jmp L5
+rts
+not @r0
+dec L9
+L15: jsr @r6
+bne L15
+rts
+bne L15
+L16: bne @r6
+rts
+add @r6, L2
+jmp L11
+clr @r7
+jmp L10
+dec @r5
+jsr @r6
+inc @r7
+dec @r7
+m0
+dec @r3
+m3
+add @r5, L5
+not @r6
+L17: bne D0
+m0
+L18: dec L1
+rts
+L19: mov -178, D0
+inc L18
+prn L9
+bne S3
+cmp -195, 309
+sub 487, L0
+rts
+bne @r0
+lea L43, L5
+add L15, @r0
+red L11
+inc L16
+rts
+not L16
+inc @r4
+jmp L18
+L20: clr @r6
+add 437, @r3
+dec L0
+m0
+lea L25, L4
+not L7
+not @r4
+L21: inc L7
+not @r5
+sub @r1, L1
+prn -446
+L22: add 309, L2
+red @r0
+dec L14
+inc L11
+L23: not L13
+sub @r5, L16
+red L18
+mov S3, L2
+dec @r7
+bne @r0
+lea D0, @r5
+L24: cmp @r6, @r4
+inc @r2
+jsr @r6
+m0
+mov 415, @r1
+L25: rts
+clr @r0
+prn @r0
+clr @r0
+clr L18
+m2
+L26: jmp @r0
+jmp L1
+rts
+dec @r1
+L27: cmp 306, @r1
+L28: rts
+dec L13
+bne L22
+m2
+add L7, L2
+rts
+rts
+inc @r3
+L29: bne L23
+jsr @r1
+m1
+L30: inc @r0
+L31: prn L22
+red @r1
+not L12
+lea L0, @r4
+jmp @r5
+prn @r5
+not @r2
+dec L30
+m2
+add X0, L8
+add L22, L19
+lea L23, L12
+rts
+not L23
+sub L0, L28
+jsr L4
+jsr L7
+rts
+prn -61
+m2
+jmp @r7
+inc @r6
+m1
+clr @r4
+L32: jmp @r5
+jmp L23
+m2
+jmp L13
+m0
+m1
+jsr L10
+sub @r5, L20
+L33: rts
+inc L20
+jmp @r2
+jsr L5
+m2
+clr L2
+rts
+add -70, @r7
+red L9
+jsr @r1
+inc L45
+prn L1
+mov 403, L32
+inc @r2
+rts
+not @r4
+dec L3
+m4
+red @r5
+add L32, L26
+m2
+not @r2
+jsr @r3
+L34: not @r3
+prn L25
+red L8
+dec @r5
+jmp L27
+prn L29
+add -372, L16
+m0
+jsr L3
+dec L33
+jmp L2
+m1
+L35: lea L9, @r3
+lea X1, @r2
+mov 189, L13
+mov 494, @r3
+add @r3, @r0
+m4
+L36: jmp @r7
+L37: bne L28
+mov @r4, @r0
+prn L16
+inc L1
+cmp -284, @r0
+clr @r1
+jsr L26
+add L18, L20
+cmp L1, @r3
+mov -391, L11
+rts
+L38: rts
+cmp @r6, L4
+m2
+lea L42, L37
+L39: sub @r2, @r4
+add @r5, L23
+cmp 243, @r3
+not @r2
+L40: mov @r7, @r0
+bne L43
+not @r7
+dec @r7
+lea L21, @r4
+jsr @r1
+mov L33, L51
+prn L25
+not L3
+L41: mov @r7, L39
+L42: dec @r0
+jmp @r5
+L43: jmp L23
+jsr L34
+jmp @r3
+jsr L39
+m3
+dec @r4
+m2
+cmp @r1, -503
+L44: red @r7
+lea D0, @r0
+jmp @r2
+L45: rts
+inc L27
+rts
+rts
+cmp L39, L7
+cmp -398, -355
+not L24
+mov S8, L2
+sub S9, L16
+m0
+lea L39, @r3
+prn @r0
+dec S9
+L46: prn L48
+sub @r3, @r4
+clr @r6
+inc @r7
+cmp @r2, @r0
+cmp L21, -240
+sub L21, S9
+add -117, L18
+red @r2
+rts
+dec L43
+dec L41
+dec L36
+jmp L30
+sub -326, L10
+red @r1
+sub @r0, L51
+add L42, L14
+add L43, @r3
+L47: red L45
+m0
+prn 444
+rts
+mov L57, L34
+mov 331, L57
+L48: rts
+clr @r4
+jsr L49
+inc L20
+red D0
+add L10, @r2
+bne L29
+sub L40, @r3
+mov @r1, L30
+dec L40
+clr @r3
+sub L32, L20
+m1
+prn -482
+red @r0
+jsr L44
+cmp L17, L50
+cmp L45, L36
+m0
+cmp L48, L8
+m3
+not L16
+not L12
+L49: cmp 422, L25
+rts
+cmp L33, @r5
+prn @r1
+jsr @r0
+mov @r1, L0
+prn @r1
+red L12
+clr L36
+add L21, L28
+sub 160, @r5
+rts
+bne L16
+L50: clr @r5
+L51: jsr @r6
+L52: mov L1, L26
+prn -349
+cmp L7, @r7
+inc L49
+jmp L31
+L53: sub -110, @r3
+rts
+cmp L25, L38
+clr L1
+lea D0, @r6
+m3
+sub @r2, L21
+L54: red L59
+jmp @r7
+L55: bne @r0
+sub 392, L10
+rts
+add -181, L30
+cmp L4, -384
+add @r6, L56
+L56: sub -49, @r7
+lea L5, @r0
+m2
+L57: rts
+m1
+rts
+clr @r3
+prn L21
+jmp @r7
+prn -441
+red @r0
+L58: dec @r3
+clr @r0
+jsr @r4
+L59: dec S2
+lea L56, @r7
+inc @r4
+jsr @r6
+inc S5
+jsr L59
+prn -503
+red @r3
+not X2
+m4
+cmp S4, X3
+clr S6
+lea L0, X4
+lea D0, D0
+red @r5
+not S6
+lea S9, L37
+add D0, L10
+stop
+D0: .data -488,-17,-156,-11,-41,487,-33,106,91,-166
+D1: .data 471,58,472,-419,-398,-447,-447,-431,51,56
+D2: .data 197,108,489,67,344,-403,-448,-336,383,0
+D3: .data -176,18,-166,-332,-410,291,-150,-5,170,-337
+D4: .data -391,-272,413,400,283,-489,288,-78,40,259
+D5: .data 174,376,176,-84,474,389,177,-172,64,-274
+D6: .data -204,-455,-469,-133,142,44,-457,-297,409,195
+D7: .data 337,-326,102,-491,344,-149,-202,17,-108,104
+D8: .data -317,204,53,179,45,39,26,433,234,-209
+D9: .data -186,262,64,339,-321,-70,107,-128,-156,26
+S0: .string "mutwwffyky"
+S1: .string "bfiysbaitodzjgjje"
+S2: .string "ojokqixxmklrlqr"
+S3: .string "zyguqh"
+S4: .string "cbuh"
+S5: .string "syllty"
+S6: .string "xxtjvpx"
+S7: .string "dqnh"
+S8: .string "hyzgcyhwt"
+S9: .string "ssncwlcfmnqngdqwzde"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r4
+    prn 80
+endmcro
+mcro m1
+    sub @r2, @r3
+    prn 28
+endmcro
+mcro m2
+    sub @r6, @r4
+    prn 43
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 83
+endmcro
+mcro m4
+    sub @r5, @r3
+    prn 5
+endmcro
+L0: not @r4
+clr @r4
+L1: cmp @r4, L1
+prn @r3
+sub @r6, L1
+cmp L0, S7
+dec L1
+cmp @r5, -243
+L2: bne @r2
+not L2
+prn @r1
+not L2
+red @r0
+not L2
+m0
+mov L2, @r1
+dec L0
+sub @r4, L1
+prn @r4
+L3: jsr L0
+L4: lea L0, L49
+cmp L3, S5
+add @r0, L2
+dec @r3
+cmp @r7, @r7
+L5: rts
+dec @r4
+m3
+m3
+L6: jmp @r0
+rts
+mov @r2, @r2
+bne @r2
+m3
+add -123, @r5
+prn @r2
+m4
+not @r0
+L7: lea L1, L3
+clr L5
+sub L5, L3
+jmp L7
+prn @r0
+m1
+red @r0
+not @r0
+inc @r2
+m4
+rts
+red D0
+cmp @r7, L4
+cmp @r5, L7
+jmp @r1
+rts
+clr L6
+mov L2, @r6
+clr @r2
+cmp @r5, L6
+rts
+jmp X0
+cmp L5, @r2
+m1
+add -33, @r7
+dec @r1
+not @r5
+sub L28, L5
+rts
+jmp @r6
+clr @r2
+bne L4
+rts
+dec @r6
+L8: rts
+add 446, L8
+cmp L2, S0
+lea L7, @r0
+inc @r2
+prn -68
+add @r3, L2
+L9: red @r1
+jmp @r7
+m1
+jsr L3
+dec L5
+m3
+dec L9
+mov L8, L3
+sub @r2, @r3
+jsr L0
+m4
+m2
+m3
+L10: clr @r4
+prn @r3
+inc L10
+red @r0
+L11: jmp L8
+L12: lea L12, D0
+m0
+cmp -189, L5
+prn -154
+prn @r0
+lea L10, @r5
+m2
+red L8
+clr @r4
+rts
+sub @r4, L5
+lea L8, L12
+cmp 40, -478
+jmp L6
+lea L7, @r7
+dec L9
+dec @r0
+mov 258, L4
+L13: sub L16, @r2
+red L5
+mov L6, @r1
+sub -314, @r2
+m2
+clr L7
+mov @r7, @r4
+dec L10
+clr L6
+clr L12
+L14: jmp D0
+L15: not L12
+jsr L11
+inc @r2
+red @r6
+inc @r5
+prn @r1
+jmp L11
+L16: clr @r0
+clr L1
+clr L7
+not L12
+sub L6, @r6
+prn L7
+lea L12, @r2
+jsr L13
+L17: clr L9
+m3
+inc L17
+L18: inc L13
+dec @r4
+rts
+cmp L15, @r0
+bne @r1
+L19: red @r4
+prn @r3
+rts
+L20: rts
+add @r5, @r1
+sub D0, L14
+prn -469
+lea L14, @r4
+not @r1
+red L12
+jmp L2
+L21: rts
+sub @r5, @r1
+mov L10, L4
+m2
+L22: prn @r4
+dec @r2
+sub L22, @r5
+cmp 485, -24
+red L7
+jmp L17
+jmp L20
+L23: jmp @r6
+jmp L19
+red L4
+L24: not @r6
+add -253, L13
+sub @r3, L6
+L25: cmp L4, @r1
+bne @r0
+clr L8
+m1
+red L15
+jsr L16
+rts
+cmp -495, @r6
+mov -390, L22
+bne @r4
+m4
+L26: red L20
+rts
+mov L16, L2
+L27: mov L5, @r5
+rts
+m2
+mov L26, @r0
+clr L21
+red D0
+m2
+red L26
+inc @r0
+inc L21
+L28: red @r2
+m3
+rts
+cmp L10, @r3
+inc L28
+cmp L1, 154
+m1
+inc L26
+cmp 316, 454
+sub L0, @r5
+prn @r2
+L29: red @r1
+L30: jmp L27
+sub @r1, L30
+L31: jsr L7
+not L1
+jsr L16
+jsr L6
+L32: lea L0, @r1
+sub 65, @r2
+L33: prn -230
+m1
+dec L23
+cmp L9, @r1
+cmp L20, 19
+jmp @r6
+rts
+dec @r0
+not L19
+L34: jmp L5
+L35: red L29
+m2
+mov -21, @r4
+L36: prn L28
+jsr @r6
+not @r6
+cmp 356, L5
+cmp L1, @r7
+lea L19, @r0
+sub L26, L29
+inc L21
+clr @r4
+not L11
+sub @r0, @r5
+cmp @r0, @r7
+L37: red @r5
+bne L19
+clr L28
+bne @r4
+dec @r6
+inc L28
+rts
+cmp @r3, @r2
+cmp @r0, @r4
+clr @r0
+cmp -375, L25
+m2
+jmp L33
+prn L9
+jsr @r0
+m4
+L38: clr @r4
+jsr @r0
+not L17
+dec L25
+L39: add -311, L49
+jsr L1
+jsr L18
+bne L10
+L40: jsr L2
+m1
+L41: red @r4
+rts
+jmp L31
+inc @r6
+jmp @r1
+dec L7
+add @r5, S3
+prn @r6
+L42: red @r0
+not L18
+m4
+clr S5
+m3
+jsr @r0
+lea L37, D0
+mov L5, L48
+add L28, @r5
+mov @r0, @r1
+L43: rts
+m2
+dec L25
+add -46, @r7
+jsr L51
+jsr @r0
+L44: sub -404, L24
+red L32
+jsr @r3
+rts
+L45: add @r3, L37
+clr L31
+L46: red @r7
+dec @r3
+prn L14
+clr L34
+cmp @r6, L38
+not L40
+cmp 263, L7
+prn @r5
+prn @r0
+red @r3
+cmp L33, @r7
+lea L44, L28
+cmp L7, @r1
+bne L34
+jsr L30
+m4
+red @r1
+mov 222, L8
+mov 103, @r1
+lea L41, @r1
+L47: jsr @r1
+prn @r6
+m1
+cmp @r4, @r1
+L48: dec @r1
+jmp @r1
+cmp S3, 482
+bne @r1
+L49: add @r3, L47
+bne @r0
+inc L55
+m4
+inc L5
+add @r3, L16
+m0
+dec @r6
+mov @r1, L26
+red L28
+L50: add 455, L46
+red L25
+inc @r1
+sub @r5, @r0
+L51: jsr L5
+jsr @r0
+jsr @r4
+clr L0
+lea X1, L17
+prn @r4
+mov 80, L37
+red @r2
+sub @r7, L40
+jsr L8
+jsr @r2
+clr @r1
+inc @r7
+red @r4
+lea X2, L56
+jsr @r3
+jmp L3
+not @r2
+cmp @r7, @r4
+lea L18, L57
+bne L51
+L52: sub L19, @r1
+not @r6
+lea L43, L58
+L53: jmp L50
+rts
+jsr @r4
+inc @r6
+cmp @r2, -394
+red L1
+cmp L22, S5
+clr @r7
+dec L48
+rts
+L54: red L59
+L55: lea L49, @r0
+jsr @r7
+prn -255
+inc @r7
+L56: cmp @r0, L54
+red L57
+bne @r0
+clr @r0
+inc L57
+inc @r4
+mov @r2, @r5
+inc @r4
+rts
+jsr @r2
+not L0
+red @r6
+mov -67, @r3
+L57: red @r0
+mov -170, @r2
+jsr L4
+dec @r2
+red @r1
+red @r5
+sub @r2, @r4
+jsr S2
+inc L15
+jsr @r4
+lea L45, L58
+clr @r0
+prn -414
+clr @r0
+m4
+m0
+L58: red @r2
+L59: rts
+rts
+dec @r0
+lea L46, D0
+jmp D0
+red S5
+dec L32
+dec L11
+not L31
+rts
+add 75, L25
+m0
+not @r0
+rts
+rts
+m1
+rts
+jmp L11
+red S6
+rts
+rts
+jsr D0
+rts
+inc S9
+add X3, S5
+lea X4, S5
+dec D0
+stop
+D0: .data -440,43,451,-182,186,403,100,35,-434,-354
+D1: .data -313,94,-179,-78,-105,130,325,-77,268,335
+D2: .data -440,9,-95,-368,-130,395,54,-62,312,-14
+D3: .data 185,337,-272,63,-386,384,-385,-202,-489,488
+D4: .data -124,-206,424,-39,-376,-112,421,253,481,451
+D5: .data 4,326,-318,14,258,177,464,-388,-319,252
+D6: .data 330,139,32,-53,64,213,211,325,-92,125
+D7: .data -453,-22,421,341,478,188,431,325,-189,205
+D8: .data 9,476,-189,50,479,-62,183,-371,-15,55
+D9: .data 35,75,364,427,-338,370,-301,-210,-339,320
+S0: .string "dhdujxsjxbmvmuyxcqa"
+S1: .string "zzebxfiktdsofz"
+S2: .string "rljyloaduxbauhomiy"
+S3: .string "biebzbmljoquaft"
+S4: .string "eiofuooai"
+S5: .string "ukkbkugqqqa"
+S6: .string "elhp"
+S7: .string "ohjkkrnyehrkmlolbg"
+S8: .string "hsyspzgjbrxmkihlovd"
+S9: .string "vc"
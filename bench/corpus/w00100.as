@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r6
+    prn 18
+endmcro
+mcro m1
+    sub @r6, @r4
+    prn 27
+endmcro
+mcro m2
+    sub @r0, @r2
+    prn 40
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 59
+endmcro
+mcro m4
+    sub @r7, @r1
+    prn 29
+endmcro
+red L0
+add L0, S1
+prn S4
+cmp -51, @r0
+L0: jmp @r0
+bne @r4
+add @r6, @r1
+red @r1
+prn -76
+red @r4
+inc L0
+bne L0
+clr L45
+cmp L0, 169
+mov @r6, L0
+inc L0
+L1: red L1
+dec L0
+bne L0
+cmp @r5, @r3
+add @r0, @r4
+jmp @r5
+m0
+jmp @r6
+inc @r0
+m2
+rts
+dec L1
+m0
+jmp L1
+jsr L1
+add L1, @r2
+m3
+L2: mov @r1, L1
+mov @r4, L2
+dec @r1
+clr @r1
+dec L0
+sub 210, @r4
+L3: red L2
+cmp @r1, -510
+inc @r4
+sub 254, L2
+L4: clr L4
+rts
+sub L3, L2
+red L0
+dec L0
+add @r5, @r2
+m3
+mov @r7, @r1
+bne L0
+m0
+add @r3, @r7
+rts
+mov @r3, L1
+lea L2, @r6
+add 274, D0
+rts
+sub L4, @r0
+m3
+inc L1
+m0
+clr @r5
+jsr L4
+not L2
+lea L2, @r0
+jmp @r1
+mov L0, @r1
+jmp L4
+L5: rts
+m2
+rts
+inc L2
+not L5
+jmp X0
+prn L3
+prn @r5
+dec L4
+jmp L2
+red L3
+cmp @r7, -51
+L6: bne @r3
+L7: bne @r5
+L8: lea L1, @r2
+bne L1
+rts
+red @r4
+L9: jsr L4
+not @r4
+red @r3
+not @r5
+m1
+jmp @r6
+jsr L3
+inc L3
+jsr @r7
+rts
+inc L8
+inc L6
+prn L6
+L10: not @r7
+bne @r3
+L11: sub @r2, @r1
+L12: sub -358, @r2
+cmp S1, L0
+prn -233
+m0
+clr L27
+m2
+jsr @r0
+L13: mov L1, @r2
+clr L12
+sub L13, @r6
+bne L7
+dec @r4
+m1
+not @r6
+clr @r4
+clr @r7
+L14: red L5
+not L4
+L15: lea L6, L1
+L16: cmp L5, L13
+bne L13
+jmp @r1
+m0
+m3
+jmp @r2
+dec L2
+jsr L15
+red @r7
+jmp @r0
+inc @r6
+lea L6, S0
+prn @r7
+jmp L9
+inc @r6
+dec @r1
+jmp @r7
+prn @r5
+not @r2
+dec @r7
+rts
+inc @r7
+mov L4, @r4
+inc @r0
+L17: mov L13, @r4
+mov @r1, @r1
+sub @r4, @r5
+rts
+mov @r7, @r5
+jsr @r3
+bne L13
+L18: jmp L15
+cmp L2, 162
+mov -270, @r4
+sub 126, @r6
+add L18, L0
+jsr L6
+lea L10, @r6
+L19: mov L10, @r3
+dec @r0
+L20: add @r6, @r0
+prn @r0
+add 104, L0
+add @r5, L11
+jmp L5
+red L31
+L21: bne L14
+lea L15, @r6
+mov L5, L21
+jsr L1
+prn L21
+clr L21
+inc L0
+bne @r4
+not L11
+m0
+clr @r1
+jmp @r1
+mov 212, @r4
+add -212, L1
+not @r4
+dec @r7
+jmp L11
+cmp L19, @r7
+lea L21, @r5
+inc @r4
+add 464, @r7
+jsr L19
+L22: prn @r3
+sub L14, @r2
+add @r6, @r5
+m0
+L23: clr L13
+not L15
+m3
+L24: sub @r1, L32
+red @r0
+jsr L20
+L25: sub L16, @r2
+red L2
+cmp @r7, 117
+m4
+rts
+mov L0, @r7
+add @r6, @r1
+dec @r3
+jsr @r4
+L26: add -109, @r7
+bne @r5
+dec @r5
+add @r3, L3
+cmp L16, @r6
+mov -465, L22
+add 420, L1
+lea L8, @r3
+cmp L14, -197
+jmp L26
+mov @r3, L4
+prn @r5
+prn 494
+lea L42, L26
+sub L13, @r3
+jmp L26
+L27: lea L6, S8
+rts
+rts
+clr @r0
+cmp L27, @r1
+bne @r0
+dec D0
+m3
+rts
+dec L14
+sub -499, L5
+bne @r4
+inc @r0
+clr L1
+red @r4
+clr @r6
+m1
+jsr L15
+lea X1, @r5
+red L13
+lea L3, L4
+sub @r6, L27
+dec L6
+not L12
+m2
+red @r2
+m2
+add @r1, @r1
+jsr L24
+bne L28
+clr L25
+red L22
+inc L4
+L28: prn @r3
+red L6
+m3
+dec L8
+jmp L1
+L29: not L26
+sub @r4, L21
+inc @r6
+dec @r7
+sub @r3, @r0
+add L3, @r3
+m2
+lea L29, L24
+rts
+sub L27, L45
+L30: bne @r2
+jsr L17
+L31: clr L39
+lea L18, @r7
+add -227, L1
+sub @r3, @r6
+mov L13, @r3
+dec L20
+red L19
+prn X2
+not L1
+clr L10
+m2
+not @r3
+cmp @r6, L2
+m2
+dec @r0
+m2
+dec L17
+sub @r7, @r1
+m3
+lea L14, @r2
+L32: rts
+red L18
+L33: inc @r6
+mov @r1, @r0
+not S6
+L34: sub 65, @r5
+L35: inc S4
+sub @r7, @r2
+mov 446, @r3
+jsr @r2
+m1
+bne L6
+lea L2, @r5
+jsr L21
+dec L15
+m1
+bne @r2
+clr @r0
+L36: dec @r1
+clr @r5
+mov X3, @r1
+L37: mov 224, L4
+L38: not L24
+dec L32
+cmp @r5, 70
+jmp @r1
+L39: dec L27
+add @r1, L30
+red @r4
+inc L29
+jmp @r3
+prn @r2
+L40: clr L32
+bne @r2
+red L31
+lea D0, L28
+rts
+cmp L4, @r2
+add -341, L0
+lea L29, L36
+mov @r7, L34
+not @r4
+clr @r7
+mov 166, @r2
+sub -430, @r0
+L41: prn L0
+L42: cmp @r0, L17
+m0
+lea L25, L40
+lea L32, @r0
+prn @r2
+lea L15, @r7
+bne L31
+L43: cmp 193, 127
+red L40
+jsr D0
+m0
+not @r7
+not L30
+m4
+clr L45
+mov -176, @r4
+m1
+jsr @r3
+L44: lea L23, D0
+add -78, L59
+inc L11
+rts
+inc @r4
+prn 190
+clr S0
+clr L10
+cmp L23, 386
+clr @r7
+not @r4
+L45: jsr @r2
+rts
+not L6
+mov L6, @r2
+lea L41, @r6
+rts
+L46: bne @r1
+sub L45, @r2
+bne @r7
+mov @r2, L40
+sub L3, L1
+cmp -40, -377
+mov 104, @r7
+red L7
+sub @r7, L9
+red @r5
+add -149, @r0
+clr @r6
+clr L0
+lea L10, @r5
+L47: mov @r3, @r5
+mov -330, L55
+L48: jmp L28
+m3
+clr @r7
+cmp 132, L25
+rts
+rts
+jsr @r2
+cmp 58, 185
+m3
+add L25, L53
+mov -117, @r5
+add 18, L52
+prn @r6
+mov -6, S8
+red @r5
+L49: rts
+lea S1, L25
+add L56, @r2
+red L12
+L50: not L15
+inc @r0
+m1
+clr @r6
+inc L11
+L51: not L16
+bne @r6
+clr L49
+m2
+jmp S6
+jmp X4
+L52: not @r0
+L53: sub @r5, L17
+m3
+L54: jmp @r5
+L55: jsr L57
+L56: sub @r2, @r7
+mov D0, @r2
+red @r0
+sub -172, @r5
+add D0, @r5
+add L58, L59
+mov @r3, @r0
+L57: jsr L58
+L58: prn D0
+cmp L59, 349
+prn D0
+L59: dec S1
+stop
+D0: .data 165,-210,244,-358,246,54,227,362,-390,-242
+D1: .data 211,-379,-166,-132,-81,-53,494,256,121,-315
+D2: .data 107,165,-363,-107,-170,157,-251,381,208,-117
+D3: .data -321,-219,-44,461,-100,-354,-416,-63,-337,-358
+D4: .data -315,428,54,-495,406,-296,198,-150,302,-105
+D5: .data 45,43,-386,-4,303,-36,201,217,-352,172
+D6: .data 69,360,97,55,-442,138,14,-164,27,-344
+D7: .data -226,217,262,-446,69,-132,374,-139,168,176
+D8: .data -203,399,500,-151,-23,456,-313,-435,326,77
+D9: .data -25,-121,144,-370,284,-330,-346,-418,270,104
+S0: .string "m"
+S1: .string "lvctexjtblriadcyrdqr"
+S2: .string "kqjiapuiyww"
+S3: .string "dyjoabwdjmexbdzjnfr"
+S4: .string "csatztrnnkmnphtra"
+S5: .string "wlezpjvpqdmzh"
+S6: .string "rmslkdhhjmxcnsuvc"
+S7: .string "kdmoyesuontqmcke"
+S8: .string "m"
+S9: .string "xxbq"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r1
+    prn 89
+endmcro
+mcro m1
+    sub @r3, @r5
+    prn 25
+endmcro
+mcro m2
+    sub @r2, @r0
+    prn 6
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 36
+endmcro
+mcro m4
+    sub @r1, @r0
+    prn 54
+endmcro
+jmp S0
+jsr L0
+prn 309
+jmp @r0
+lea L0, L0
+m3
+red @r5
+add @r0, L0
+lea L0, L0
+jmp @r7
+L0: bne L0
+L1: add L0, @r2
+prn -437
+clr L0
+L2: jsr @r7
+prn @r4
+cmp L1, 258
+clr L1
+L3: mov @r7, @r1
+bne @r2
+L4: not L0
+jsr @r1
+not @r7
+m4
+inc L3
+sub @r6, @r7
+dec L0
+clr L32
+add 339, @r3
+L5: lea L5, L5
+prn @r5
+L6: sub L3, L0
+sub 98, L3
+red L1
+not @r2
+lea L1, L1
+lea L2, @r0
+clr L2
+inc L1
+m4
+m1
+not L3
+bne L6
+cmp @r5, -410
+clr @r7
+rts
+bne L2
+mov L1, @r7
+L7: red @r6
+inc @r0
+m4
+mov -426, X0
+sub -329, @r2
+L8: sub L5, @r1
+clr @r7
+jmp @r1
+L9: jsr D0
+sub L6, L2
+jmp @r5
+L10: mov @r3, S9
+L11: rts
+jmp @r3
+L12: sub -410, L4
+bne L10
+lea L12, @r4
+bne @r7
+bne @r0
+jmp L3
+cmp L6, 228
+jmp @r3
+mov L11, L4
+lea X1, @r7
+m3
+jmp @r5
+rts
+add -127, L5
+prn L0
+mov 229, @r0
+prn 111
+add L9, L2
+clr L3
+m2
+not @r6
+jsr L1
+add L8, L5
+m0
+clr @r2
+mov -265, @r0
+L13: jmp @r0
+bne L2
+L14: bne L1
+add 356, @r6
+red @r7
+L15: inc @r0
+add L5, @r3
+prn -377
+clr L7
+L16: lea L0, @r6
+dec L1
+m2
+add L1, @r5
+cmp L9, @r6
+L17: bne L14
+m1
+L18: inc L18
+sub 313, @r4
+inc D0
+sub 307, L9
+sub @r4, @r6
+rts
+cmp L13, @r6
+prn @r0
+clr @r1
+mov -86, L9
+lea L3, L2
+dec L2
+m4
+cmp -407, @r3
+clr @r2
+prn @r2
+lea L10, @r3
+red @r4
+sub 511, @r3
+lea L15, L8
+inc L6
+L19: inc L3
+not @r5
+add @r6, @r1
+red @r4
+red @r6
+not @r2
+L20: jsr @r1
+L21: jsr L6
+m0
+mov -420, @r6
+L22: inc L22
+mov 154, L2
+lea D0, L10
+red L9
+m3
+clr L17
+m1
+mov -36, @r4
+cmp -336, L7
+jsr @r1
+m1
+jsr L10
+jsr L21
+inc L19
+jmp L16
+not @r1
+add @r1, @r7
+red @r3
+mov 82, @r6
+mov -91, @r6
+L23: rts
+lea L2, @r6
+L24: red L15
+dec L9
+m2
+cmp @r0, @r5
+L25: inc L5
+cmp @r6, -489
+dec L13
+rts
+prn -158
+add -94, L10
+inc L13
+L26: mov @r1, L19
+not L7
+L27: not @r4
+dec L19
+m3
+L28: jsr L1
+cmp L15, @r4
+dec L26
+prn 105
+lea S1, L5
+cmp -386, L9
+jsr L18
+rts
+bne L4
+add -28, L16
+dec X2
+lea L21, @r2
+bne L27
+lea L21, @r7
+clr L11
+jmp S8
+mov -490, L20
+clr L25
+bne @r1
+L29: inc @r7
+sub @r6, D0
+L30: mov @r3, @r3
+jmp @r6
+clr L13
+jmp L17
+inc @r6
+add L11, L11
+bne S5
+sub @r2, L13
+clr @r5
+add L2, L5
+not L17
+jmp L23
+jmp L20
+bne @r7
+prn L5
+lea L17, @r1
+mov L26, @r1
+m0
+m0
+mov @r1, @r4
+red @r5
+cmp L4, @r5
+jsr @r5
+add 321, L26
+prn 59
+mov 311, L10
+L31: add 44, @r7
+prn L13
+L32: add -476, L4
+m3
+rts
+add 264, @r4
+jmp L31
+L33: add L19, L7
+not L41
+m3
+not @r5
+add -178, L14
+mov 173, @r2
+jsr L12
+cmp L42, L25
+inc L32
+jmp L5
+inc L26
+m1
+L34: prn -15
+sub -349, L20
+m1
+red @r6
+not @r3
+dec @r6
+jsr @r4
+red L10
+dec @r4
+cmp -508, -116
+m0
+bne @r4
+L35: jsr @r1
+clr L6
+rts
+jmp L0
+not @r7
+L36: bne L38
+red @r5
+dec L2
+L37: dec L3
+sub @r7, L5
+L38: dec L32
+inc L7
+add -182, @r0
+red L35
+cmp @r2, L25
+sub -35, L18
+mov -180, L38
+jsr L20
+m1
+add @r7, L2
+red L20
+bne @r5
+cmp L24, -250
+L39: add @r1, L28
+L40: add 83, L38
+mov L24, L31
+lea L37, L10
+rts
+dec L23
+jsr @r4
+cmp 282, @r1
+not L38
+clr L30
+rts
+L41: prn @r6
+cmp -330, @r5
+add @r6, L45
+L42: not L17
+mov @r0, L51
+jmp @r3
+bne L4
+clr S7
+mov -240, @r7
+dec @r6
+add L11, L58
+mov L4, @r4
+clr L27
+m4
+lea L47, @r2
+dec S0
+L43: jmp X3
+L44: jsr L37
+jsr @r2
+clr @r5
+jsr L8
+L45: jsr L2
+bne L50
+jmp L3
+lea L40, @r3
+m2
+add -319, L2
+L46: rts
+jmp @r4
+m0
+sub @r1, @r1
+add L25, @r2
+dec L7
+clr L10
+lea L43, L32
+sub L31, L50
+lea L0, L25
+L47: dec L21
+jmp L28
+jmp @r5
+lea L13, L24
+jsr @r6
+L48: not @r4
+L49: not @r1
+jmp L38
+m0
+bne L3
+add 324, L57
+sub L23, L31
+inc @r6
+lea L19, L7
+mov L38, L15
+jsr L15
+red @r7
+inc L34
+not @r0
+cmp 251, L7
+rts
+inc @r6
+sub 47, L35
+add L28, @r2
+dec L52
+jmp L33
+clr @r6
+inc L9
+prn @r7
+dec L11
+sub 434, @r5
+m0
+mov L19, L23
+lea X4, L18
+L50: mov 355, L20
+red L41
+lea L40, @r0
+cmp L55, 303
+m1
+bne L29
+clr @r0
+bne L36
+m3
+dec L45
+inc @r0
+jmp L13
+L51: dec L32
+cmp L39, S1
+cmp 443, 411
+jsr L1
+sub @r4, @r5
+mov 1, S5
+red L57
+prn L57
+mov @r3, L26
+not @r0
+add L47, @r0
+not L40
+lea L33, @r5
+inc L26
+not @r5
+jsr @r1
+red @r4
+add -173, L47
+cmp -113, L2
+mov @r6, L42
+mov @r1, @r3
+prn @r0
+L52: inc D0
+dec @r5
+jmp L6
+inc @r1
+mov @r0, @r2
+not @r6
+inc @r1
+mov @r6, L5
+bne L58
+lea L6, @r1
+L53: lea L25, L11
+bne D0
+dec @r2
+inc L14
+L54: jmp @r3
+clr @r0
+m3
+m1
+L55: not @r3
+bne @r7
+m0
+L56: lea L21, @r4
+rts
+L57: cmp -362, @r4
+m3
+not L54
+jsr @r2
+m0
+jsr L53
+clr @r3
+add 279, @r7
+m0
+m3
+add L59, L33
+m2
+jmp L23
+L58: lea S6, @r4
+cmp L59, L46
+red @r5
+sub 487, @r1
+mov -200, L59
+cmp -139, S2
+clr L42
+dec @r4
+rts
+add -120, L59
+jmp S1
+inc @r6
+jmp L59
+L59: clr S7
+stop
+D0: .data 391,-299,175,-96,176,390,-14,398,260,-115
+D1: .data -118,-307,310,183,466,-443,105,23,31,219
+D2: .data 137,-31,269,406,-488,368,-9,319,42,-182
+D3: .data -105,-435,47,257,-375,130,329,-175,434,357
+D4: .data -308,268,168,-358,316,-438,64,-105,-354,-29
+D5: .data 357,-258,128,284,-1,-198,-152,-310,65,373
+D6: .data 335,-286,425,41,-471,16,-215,128,-174,130
+D7: .data -360,46,347,-412,-136,-90,-201,-413,16,-350
+D8: .data -40,276,11,-340,-142,-330,-369,-381,-224,-283
+D9: .data 296,303,-389,-262,-102,-467,-250,261,318,498
+S0: .string "apjbtfn"
+S1: .string "cdeqzqe"
+S2: .string "mjttsqpyocrjfx"
+S3: .string "azapczuzkojvh"
+S4: .string "cnielrwjsgxgoejb"
+S5: .string "aurapbtcykisgiw"
+S6: .string "pxtmwrvdanfltvhsxff"
+S7: .string "werkuoz"
+S8: .string "fnwpficouyepskwgygto"
+S9: .string "hptxdjvxoq"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r4
+    prn 27
+endmcro
+mcro m1
+    sub @r7, @r6
+    prn 24
+endmcro
+mcro m2
+    sub @r4, @r5
+    prn 71
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 80
+endmcro
+mcro m4
+    sub @r4, @r6
+    prn 78
+endmcro
+mov L0, @r5
+jmp L0
+lea L0, L0
+rts
+cmp L0, L0
+rts
+prn L0
+red @r0
+sub L0, L0
+red @r4
+mov L0, L0
+jsr L0
+L0: mov 403, @r0
+rts
+prn @r4
+L1: cmp L1, @r0
+dec L1
+L2: lea L2, @r3
+not D0
+dec @r3
+sub 194, L1
+dec L1
+red L0
+not L4
+cmp L1, L0
+sub -398, @r0
+red L0
+bne @r1
+mov @r0, L1
+m4
+rts
+add L0, L1
+m4
+sub 250, L2
+red L2
+L3: sub 203, @r6
+sub L2, @r0
+m1
+L4: clr L1
+add -144, L0
+cmp 81, @r0
+jmp @r4
+jsr L2
+clr @r1
+jmp @r6
+prn @r1
+not @r5
+add -214, @r6
+sub X0, L3
+rts
+m1
+clr L2
+cmp @r2, -454
+jsr L1
+bne @r1
+L5: jmp L23
+not L4
+jsr @r6
+bne L5
+prn 269
+lea L5, L3
+add 439, L1
+inc L0
+m2
+m2
+not @r3
+inc @r2
+not @r3
+L6: jmp L2
+add L3, L5
+add 67, @r1
+red L53
+lea L3, L4
+dec @r6
+prn L2
+jmp @r5
+jsr @r1
+clr @r5
+L7: prn L3
+inc L5
+sub @r1, @r5
+jmp L2
+L8: cmp @r7, L5
+lea L6, @r5
+red @r5
+m2
+L9: red @r4
+L10: red L9
+sub -412, @r6
+m2
+add @r1, @r5
+red L4
+L11: not @r0
+m0
+prn -160
+rts
+cmp -6, @r0
+mov L1, @r4
+inc @r0
+L12: red D0
+not @r1
+lea L3, @r6
+dec @r7
+prn D0
+mov L3, @r6
+dec @r4
+mov -321, @r2
+inc @r7
+add 508, @r0
+prn L2
+sub L7, @r5
+rts
+jsr @r5
+add -474, S1
+jsr L8
+prn @r6
+clr L6
+cmp L7, L10
+add @r0, @r0
+jsr @r5
+jsr @r0
+dec L1
+clr @r2
+cmp @r6, S7
+L13: dec @r4
+L14: add L1, @r6
+red L0
+sub L1, L3
+L15: inc @r2
+L16: clr @r6
+red @r5
+L17: bne @r2
+m0
+jsr L3
+sub @r0, @r7
+lea L9, L2
+bne @r4
+clr @r5
+m0
+not @r7
+m1
+rts
+not @r5
+lea L8, @r7
+inc @r4
+bne @r0
+sub @r7, @r0
+inc @r2
+prn D0
+inc L10
+not L4
+L18: sub L5, @r0
+prn -478
+prn L1
+dec L8
+sub 223, L17
+cmp @r4, 506
+L19: lea L7, @r4
+clr @r2
+sub L8, L2
+clr L11
+dec @r1
+rts
+dec @r7
+inc L1
+red L0
+m2
+L20: lea L6, @r0
+add @r7, L3
+prn @r3
+L21: jmp L12
+bne @r6
+lea L2, L15
+lea L4, @r3
+clr L6
+lea L16, @r4
+prn L17
+not @r1
+m3
+L22: sub 475, @r5
+lea L18, @r1
+bne L7
+m1
+sub L5, @r2
+L23: prn L0
+mov -339, L23
+add L26, X1
+not @r4
+add L13, L10
+jmp @r5
+red @r3
+cmp @r3, @r1
+bne L0
+clr @r6
+dec L23
+L24: jmp @r7
+clr L2
+add @r7, L21
+mov -126, @r4
+m3
+m3
+sub 442, L16
+jmp @r5
+m4
+sub @r2, S7
+jmp D0
+jmp L11
+clr L7
+L25: sub X2, L18
+sub 358, @r7
+rts
+not L24
+add -186, @r2
+rts
+jmp L20
+prn L4
+m2
+sub @r4, L34
+m1
+cmp -495, L2
+add @r7, @r7
+red L2
+cmp -225, L11
+L26: lea L14, @r0
+rts
+prn @r5
+clr @r2
+dec S5
+not @r1
+L27: red L27
+inc L14
+mov -173, L13
+jmp L3
+clr L5
+mov @r1, L9
+mov @r6, L3
+jmp @r1
+L28: jsr L1
+add @r5, @r3
+L29: jmp @r7
+mov @r3, L19
+jsr @r0
+jsr @r1
+red L22
+sub L15, @r5
+not @r4
+mov @r7, @r2
+not @r7
+clr @r4
+L30: clr L3
+prn @r2
+not @r7
+m2
+m3
+clr @r5
+inc @r6
+jsr L25
+sub L30, @r0
+L31: add @r5, L23
+prn L4
+inc @r5
+not @r0
+L32: cmp L14, -256
+add L17, L14
+inc L17
+cmp 237, 233
+L33: not @r5
+bne @r3
+L34: clr @r7
+clr L3
+m4
+jmp D0
+add @r7, @r1
+rts
+bne @r0
+jmp L8
+not L22
+red @r5
+m0
+L35: jmp L19
+clr @r7
+L36: mov @r3, @r5
+inc @r4
+L37: red @r6
+cmp 218, @r0
+add @r7, @r6
+inc @r3
+add @r1, L17
+jsr @r5
+L38: cmp -423, L24
+m4
+clr @r3
+inc @r4
+L39: lea L24, L0
+sub 331, @r6
+red L38
+add L10, L30
+dec L6
+prn @r4
+L40: jmp @r2
+jsr @r5
+m1
+inc @r3
+m1
+bne L1
+rts
+lea L34, @r3
+red @r2
+jsr @r4
+clr @r5
+jsr L15
+clr @r2
+L41: inc @r6
+m1
+m1
+L42: sub -101, X3
+L43: dec L57
+not @r5
+L44: add @r0, @r5
+not L58
+lea L13, @r2
+sub @r1, @r5
+jsr @r5
+red @r0
+L45: sub @r2, @r2
+not @r3
+not L25
+lea L0, L20
+cmp @r6, 331
+jsr L3
+add L28, @r5
+red @r2
+L46: inc @r7
+m1
+prn 63
+cmp @r1, L45
+L47: sub @r0, @r0
+not @r2
+jmp L9
+prn @r3
+m2
+sub 252, L23
+red L16
+m0
+inc @r4
+sub 195, @r6
+dec @r7
+lea L2, @r7
+rts
+sub L0, @r3
+clr @r5
+cmp @r0, L31
+jmp L47
+m4
+jmp @r4
+jmp @r0
+jmp @r7
+rts
+m2
+sub @r3, @r2
+dec L12
+not @r1
+mov -34, D0
+mov L15, @r6
+red @r3
+clr @r2
+dec L22
+not L58
+dec @r2
+L48: inc @r1
+not @r4
+not L2
+jmp L14
+L49: rts
+add L42, @r2
+dec L12
+inc @r5
+mov L6, @r2
+cmp @r2, -169
+jsr L18
+jmp @r5
+prn L16
+rts
+prn @r0
+cmp 307, @r7
+dec @r0
+rts
+cmp -156, -196
+sub @r3, D0
+bne L16
+m2
+prn @r5
+prn L9
+not L6
+m3
+dec @r1
+m3
+rts
+prn L45
+prn -413
+mov L43, L1
+clr @r4
+sub L51, L15
+jmp S1
+bne @r1
+bne @r3
+prn -483
+inc L45
+L50: bne @r6
+not @r6
+dec S5
+lea D0, @r0
+not L9
+L51: cmp L13, L36
+m1
+rts
+inc D0
+prn L58
+lea L32, @r1
+not L22
+L52: prn -422
+sub L22, L49
+jmp @r6
+L53: rts
+clr @r3
+mov X4, @r4
+L54: jsr D0
+m2
+L55: jmp D0
+m1
+L56: clr D0
+L57: prn L59
+L58: inc L59
+mov L59, S0
+clr D0
+inc S5
+jsr S7
+L59: prn D0
+inc D0
+cmp D0, S6
+stop
+D0: .data 454,237,-54,-431,-92,-187,93,85,44,-426
+D1: .data -328,51,-97,413,-265,-328,-63,145,322,-400
+D2: .data -293,153,253,-367,182,-146,-227,-136,125,-157
+D3: .data 258,496,-251,-96,231,184,498,268,-270,-361
+D4: .data 419,177,-11,-300,57,469,-374,136,-284,-237
+D5: .data 111,-413,-430,-289,97,54,-328,-243,427,-231
+D6: .data 39,-207,-151,379,-422,217,-179,-499,-318,356
+D7: .data 245,-68,-438,-168,309,-363,-11,-56,-55,-219
+D8: .data 425,230,-181,-299,135,405,-439,-230,-296,403
+D9: .data 144,-439,168,86,-89,-50,130,95,-462,-3
+S0: .string "p"
+S1: .string "mekbnsdyblt"
+S2: .string "cqmvbnkizlofsij"
+S3: .string "wvpvjradltmirzyo"
+S4: .string "ffhtmdwgk"
+S5: .string "utkdhnexq"
+S6: .string "adiakfrjyzb"
+S7: .string "evatofnnqi"
+S8: .string "atbzpbdxmpqrbb"
+S9: .string "hxjebpzuavjo"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r6
+    prn 97
+endmcro
+mcro m1
+    sub @r3, @r0
+    prn 22
+endmcro
+mcro m2
+    sub @r6, @r3
+    prn 36
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 56
+endmcro
+mcro m4
+    sub @r6, @r4
+    prn 3
+endmcro
+not L0
+red L0
+cmp L0, 119
+clr L0
+rts
+cmp L0, 420
+not L0
+not @r6
+jmp @r3
+jsr @r6
+jmp @r5
+clr L0
+lea L0, L0
+sub 220, @r1
+cmp -353, 90
+rts
+inc S6
+rts
+lea L0, @r0
+clr L0
+jmp L0
+inc L0
+m4
+red @r2
+L0: jmp L0
+L1: mov -484, @r7
+sub @r7, L1
+not @r4
+m3
+rts
+clr @r4
+add L1, L1
+jsr L0
+prn 95
+inc L1
+dec L1
+m3
+mov @r7, L0
+dec @r0
+bne L0
+prn @r4
+add @r6, @r3
+red @r7
+dec L48
+add @r5, @r4
+prn @r7
+jsr L0
+red L1
+L2: clr @r1
+bne @r1
+lea L2, S8
+add -395, @r4
+red @r7
+sub L0, @r1
+L3: lea L2, @r0
+dec L3
+not @r5
+add @r5, L1
+m1
+clr @r3
+bne @r0
+dec @r5
+dec @r4
+mov L0, L2
+m2
+jsr @r6
+not @r3
+add -40, L1
+lea L2, L32
+prn @r5
+cmp -262, L0
+add @r2, L2
+L4: jmp L2
+L5: sub @r2, L1
+clr @r1
+m1
+lea L0, @r6
+dec L0
+lea L0, @r1
+add 490, L3
+prn @r5
+add L2, @r4
+red L2
+m1
+m0
+m4
+mov -114, L5
+red @r2
+clr D0
+bne D0
+red X0
+jsr @r6
+L6: jmp @r0
+clr @r1
+prn @r1
+inc L0
+red @r4
+jmp L0
+prn @r1
+L7: dec @r5
+L8: mov L7, L2
+red L8
+jmp L1
+L9: red L33
+m3
+jsr L6
+red L3
+mov 281, L0
+L10: prn @r4
+not L1
+clr L0
+jmp @r5
+L11: red @r6
+mov L1, L6
+rts
+sub @r4, @r6
+red L24
+add -474, L10
+m4
+prn -172
+lea L0, @r1
+m1
+bne @r4
+clr @r7
+red L4
+L12: jsr @r3
+lea L12, @r7
+cmp L6, L55
+m0
+rts
+jmp @r6
+mov L4, L9
+sub L5, L7
+cmp L7, @r1
+cmp 64, 444
+rts
+sub L10, @r5
+L13: inc @r4
+L14: not @r2
+inc L4
+jmp @r6
+L15: mov L19, S1
+L16: jsr @r4
+prn 144
+bne L14
+dec @r2
+L17: not L16
+cmp @r7, D0
+lea L17, L14
+L18: mov L11, L12
+bne @r1
+dec L16
+clr L18
+m3
+prn -234
+jmp L16
+mov L3, @r6
+m1
+rts
+lea L1, @r0
+rts
+rts
+prn L3
+jmp @r6
+jsr L8
+bne @r5
+clr @r0
+lea L14, L0
+jmp L10
+sub @r7, L17
+bne @r2
+L19: not L9
+mov L1, @r1
+inc L2
+not @r3
+sub -421, @r2
+add 338, @r1
+L20: cmp @r2, @r6
+lea L6, @r5
+rts
+m4
+inc L6
+add L9, @r7
+L21: mov -246, L3
+lea L0, L18
+not @r7
+jsr @r6
+jsr @r7
+L22: dec L14
+cmp @r2, -201
+jsr @r6
+add @r4, @r2
+rts
+bne L22
+mov @r4, @r3
+jmp L3
+add @r3, L10
+inc @r7
+dec @r2
+prn @r5
+L23: bne L18
+red @r5
+add @r0, S4
+m2
+sub -504, @r6
+L24: dec @r6
+inc L4
+jsr L19
+clr @r2
+L25: clr L17
+bne @r6
+m4
+m0
+prn @r3
+L26: not @r1
+prn @r5
+prn L21
+cmp L25, 416
+lea L7, @r7
+red L3
+L27: rts
+red @r3
+jmp @r3
+jmp @r1
+add 412, @r7
+L28: mov -271, @r4
+clr L11
+lea L25, S1
+jmp @r7
+bne L11
+m0
+m3
+m0
+lea L10, L10
+bne @r0
+L29: prn @r6
+jsr L19
+add @r3, L2
+L30: clr @r2
+add -430, L12
+add @r3, @r4
+L31: jsr @r3
+lea L18, S1
+L32: jsr L19
+lea L6, L16
+clr @r6
+L33: add -83, @r2
+jsr L28
+not @r1
+red L27
+mov 197, @r5
+add -401, L9
+m0
+inc @r5
+m3
+m3
+add @r3, L25
+bne @r0
+lea L12, @r6
+m3
+jmp L24
+bne L33
+inc @r7
+dec L22
+jmp L30
+L34: rts
+red L11
+dec L27
+m1
+cmp @r7, L14
+rts
+clr @r6
+prn -166
+not @r1
+cmp -155, -351
+L35: jsr L13
+m4
+L36: not L23
+clr X1
+clr @r3
+m1
+red L12
+m0
+mov 110, X2
+mov L4, L9
+inc L39
+not @r4
+L37: jsr @r0
+add @r6, L15
+jsr L37
+m4
+dec @r0
+lea L31, L12
+cmp @r5, -9
+jmp L0
+L38: clr @r7
+inc L7
+mov @r7, @r6
+dec L29
+mov L3, L38
+lea L4, @r7
+bne L27
+m4
+lea L34, L37
+m0
+lea L30, @r1
+sub @r4, L5
+bne L17
+lea L14, @r4
+mov 396, L29
+prn L8
+cmp X3, @r3
+prn @r1
+L39: mov 435, @r5
+prn @r2
+add @r3, L31
+add L25, @r0
+add @r3, @r0
+not @r7
+bne S3
+jmp L26
+cmp 448, @r4
+mov 447, L4
+dec @r5
+not L39
+red L31
+not @r4
+rts
+L40: inc L37
+lea L32, @r6
+rts
+L41: cmp @r1, 101
+not L18
+dec @r4
+jsr L18
+m3
+L42: mov -342, L3
+jmp L30
+lea L0, L34
+prn L34
+inc @r5
+inc @r2
+rts
+jsr L40
+not L8
+m2
+clr D0
+L43: add 506, L25
+L44: prn 370
+red @r2
+L45: jsr @r1
+sub L46, L34
+L46: bne L37
+prn -202
+not D0
+not L21
+add 77, L31
+red L33
+mov 63, @r6
+L47: cmp @r4, @r7
+prn L53
+mov @r0, @r2
+lea L20, @r4
+m1
+lea L4, @r5
+jmp L27
+jsr D0
+m0
+red @r6
+L48: add @r2, L0
+dec L25
+add @r5, @r3
+not L32
+m3
+sub 479, D0
+lea L44, L24
+L49: inc D0
+prn L11
+add 148, @r5
+red L31
+L50: cmp L19, 251
+m2
+L51: clr L29
+prn @r0
+red @r2
+cmp L54, L50
+mov 336, @r2
+L52: cmp L28, @r1
+add @r2, @r0
+m4
+cmp L31, L55
+clr L29
+clr L11
+jmp @r5
+L53: jsr @r4
+L54: prn D0
+cmp -312, @r1
+inc @r7
+cmp @r1, @r0
+L55: sub 192, L8
+sub @r7, L48
+dec @r3
+dec S5
+inc @r6
+L56: mov -144, D0
+sub 257, @r2
+inc L21
+rts
+L57: red L46
+mov -459, L12
+cmp @r1, D0
+bne @r6
+L58: clr L27
+jsr L49
+lea L58, @r0
+jmp @r6
+rts
+bne @r7
+dec @r3
+rts
+cmp D0, 217
+clr @r3
+sub L59, @r7
+inc D0
+red L47
+clr @r3
+red X4
+jsr @r6
+inc @r4
+mov 322, L59
+cmp L59, @r3
+dec @r5
+add -324, L59
+red @r6
+lea L59, @r6
+lea D0, @r1
+mov @r4, L9
+L59: dec L40
+rts
+mov S5, D0
+stop
+D0: .data -127,404,159,26,179,20,-260,-178,1,-23
+D1: .data 140,19,329,453,150,444,407,220,-463,-208
+D2: .data -318,389,253,314,237,-466,-363,-394,-379,-360
+D3: .data -331,-379,-387,-7,-72,251,-302,-76,-307,-25
+D4: .data -58,-87,-438,54,254,-185,-483,-5,-320,-226
+D5: .data -399,-179,-371,-486,315,318,197,193,-380,403
+D6: .data -85,-227,278,-260,33,337,-232,-141,129,-479
+D7: .data -8,242,231,-19,-136,161,-159,149,-445,-259
+D8: .data 288,-325,392,-289,168,154,237,409,-436,472
+D9: .data -236,1,359,176,-62,231,-149,-150,-277,479
+S0: .string "oyecwflxzp"
+S1: .string "gqibeomevisbd"
+S2: .string "zcnkczegnmtgy"
+S3: .string "ebtzlghktpqy"
+S4: .string "rjno"
+S5: .string "xihqysocbepxri"
+S6: .string "rzavaprimcvm"
+S7: .string "nyivqntuvqfxa"
+S8: .string "vqbspybpzoyaxepdq"
+S9: .string "zizhrpfrar"
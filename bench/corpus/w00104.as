@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r1
+    prn 36
+endmcro
+mcro m1
+    sub @r0, @r1
+    prn 21
+endmcro
+mcro m2
+    sub @r0, @r1
+    prn 2
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 33
+endmcro
+mcro m4
+    sub @r0, @r2
+    prn 27
+endmcro
+m3
+bne @r0
+bne L0
+m2
+dec @r2
+m1
+jmp @r4
+L0: mov L0, @r1
+rts
+bne L0
+not @r0
+bne @r3
+m2
+bne L0
+sub 102, @r4
+m1
+rts
+rts
+lea L0, L0
+inc S2
+inc @r6
+L1: jsr @r2
+jsr L1
+lea L0, L1
+rts
+rts
+L2: prn @r0
+dec D0
+red L2
+m4
+inc @r0
+jsr @r1
+red L0
+sub L1, @r5
+mov @r7, @r5
+m0
+L3: add @r0, @r6
+red @r0
+mov @r5, @r4
+L4: rts
+red L0
+sub -216, L0
+L5: cmp L0, @r4
+lea L0, L5
+L6: sub L6, L5
+add 98, L1
+bne @r0
+clr L57
+mov 53, L3
+sub -191, @r5
+red L3
+red @r2
+sub @r6, @r4
+L7: clr L5
+bne @r6
+cmp L43, @r5
+add -294, @r1
+L8: mov L3, L2
+prn L18
+jsr @r1
+L9: bne L1
+prn L1
+L10: add -166, L5
+jmp @r6
+m4
+m4
+bne L4
+inc L9
+L11: add 87, @r1
+prn @r5
+jsr L1
+inc L3
+red @r5
+m1
+L12: inc @r7
+dec L3
+inc L12
+clr L0
+jmp L0
+not @r3
+bne @r1
+cmp @r0, L11
+cmp L1, @r6
+prn @r2
+cmp @r7, @r5
+not @r6
+lea L3, L0
+jmp @r0
+inc @r0
+L13: jmp @r5
+red L11
+jmp @r2
+sub L0, @r7
+add 167, @r5
+m0
+cmp L7, L8
+cmp L12, L12
+L14: clr @r0
+L15: lea L5, @r7
+bne @r4
+red @r0
+L16: red @r7
+lea L5, D0
+red @r1
+lea L16, @r7
+m2
+jsr L11
+L17: cmp @r7, @r7
+jmp L3
+m1
+add @r5, @r0
+red L3
+m3
+inc @r5
+jsr @r5
+prn @r2
+jmp @r6
+prn 262
+rts
+jmp L15
+jsr @r4
+prn @r2
+dec @r7
+m4
+red @r3
+mov L1, @r0
+mov 356, @r3
+inc @r1
+red @r7
+not L13
+mov @r0, L28
+jsr L0
+lea S4, @r6
+jsr @r1
+rts
+inc L8
+red @r2
+dec @r1
+inc @r0
+sub @r2, L6
+inc L5
+add @r4, @r6
+jmp L3
+m2
+m0
+L18: bne L4
+L19: bne @r6
+m0
+L20: lea L19, @r7
+sub L18, D0
+jsr S7
+sub @r1, L12
+red L10
+dec L0
+cmp @r6, L12
+sub L12, L8
+sub 114, X0
+red @r5
+lea L2, L2
+inc @r0
+L21: jsr L3
+jsr @r3
+L22: sub 291, L11
+mov @r1, L10
+m4
+m0
+cmp 432, 181
+inc @r0
+dec @r0
+prn -227
+bne L18
+cmp L19, @r2
+L23: clr L27
+lea L6, L1
+mov @r2, @r4
+clr @r3
+add @r7, L14
+inc @r1
+L24: dec L2
+red @r6
+add L2, @r5
+prn 489
+bne L6
+lea L23, @r6
+rts
+cmp -233, -106
+sub @r4, L21
+red L12
+sub @r5, @r5
+prn @r7
+L25: lea L0, L5
+m0
+inc L20
+inc @r7
+jsr L21
+L26: inc L54
+inc L6
+dec L18
+L27: rts
+L28: prn 354
+bne L8
+inc L16
+sub @r0, @r3
+rts
+clr @r7
+sub L0, @r4
+jsr @r1
+cmp 365, @r7
+inc @r2
+add 273, @r0
+red L5
+mov L15, @r6
+L29: lea L17, @r0
+lea L25, L26
+mov @r7, L3
+red L22
+dec L0
+lea L55, L9
+cmp @r1, @r2
+red @r1
+inc @r3
+jmp L19
+m3
+jmp @r2
+red @r3
+dec @r0
+bne L27
+bne @r6
+jsr @r6
+red L47
+not L8
+L30: clr @r5
+cmp L26, @r1
+m3
+add L20, @r5
+inc @r2
+rts
+L31: inc @r0
+not @r1
+mov 219, @r3
+red L25
+sub @r6, L5
+red L25
+bne @r0
+L32: not L0
+m0
+dec @r3
+mov @r7, @r2
+sub L1, @r1
+dec @r2
+bne L4
+bne @r2
+clr L4
+not @r1
+jmp L18
+dec L19
+prn L25
+L33: red @r4
+sub L19, L32
+m1
+L34: rts
+L35: red @r2
+m1
+L36: red L33
+L37: inc L34
+m0
+inc @r3
+mov L1, @r3
+bne @r2
+add -451, L33
+add L10, @r4
+clr @r1
+inc @r7
+L38: lea L13, L42
+add L8, L24
+cmp L23, -420
+L39: sub 462, L11
+clr @r0
+not @r2
+prn L26
+mov @r3, L5
+rts
+bne L22
+jsr @r7
+jmp S7
+L40: jsr L48
+clr L18
+jsr L12
+L41: lea L2, @r4
+not X1
+red @r4
+L42: mov -170, @r7
+m4
+jmp @r6
+cmp @r7, @r3
+add S8, @r1
+cmp 162, L4
+rts
+clr @r7
+m0
+jsr L3
+prn L21
+L43: sub @r3, @r4
+inc L12
+cmp -357, -146
+not L13
+bne L0
+clr @r1
+jsr @r5
+clr L46
+prn @r2
+mov @r6, @r6
+L44: jmp @r5
+sub @r3, @r5
+prn @r7
+prn X2
+lea L55, L28
+jsr @r2
+L45: sub -296, @r4
+jmp L14
+jmp L31
+prn -339
+not @r3
+jmp L36
+inc @r4
+L46: sub L13, L21
+not @r5
+L47: bne L33
+inc D0
+rts
+m4
+dec L24
+bne @r7
+inc @r7
+mov -153, @r7
+red L24
+m3
+inc X3
+cmp @r0, -460
+m4
+L48: sub @r7, @r3
+add L0, L4
+red @r4
+jsr @r0
+lea L2, @r2
+not @r2
+cmp @r3, L38
+m0
+L49: prn -190
+m3
+rts
+L50: red @r0
+cmp @r3, -113
+prn @r3
+L51: jmp @r0
+m1
+clr @r3
+inc @r3
+jsr @r4
+clr @r1
+mov @r5, L12
+m4
+L52: dec L52
+L53: dec L59
+jmp S8
+jsr @r2
+add L46, @r2
+rts
+clr @r1
+not @r4
+cmp @r0, 167
+add 440, L35
+rts
+rts
+inc L39
+prn L25
+bne @r7
+sub @r7, L30
+jsr L23
+mov 11, L58
+bne L57
+sub 426, L18
+dec L1
+jmp L36
+sub L21, @r4
+L54: dec D0
+L55: mov D0, @r3
+L56: dec @r4
+dec @r1
+sub @r4, @r7
+lea D0, L21
+m2
+rts
+mov L15, L15
+jmp X4
+clr L20
+L57: clr L34
+sub L8, S3
+rts
+mov @r5, L59
+dec D0
+m0
+not @r0
+lea L35, @r4
+mov @r4, @r5
+jmp L53
+L58: rts
+red @r2
+cmp @r2, -128
+add L20, @r5
+sub L55, L59
+jmp @r7
+dec @r2
+jsr L26
+m1
+dec D0
+add S8, L12
+inc L31
+dec @r0
+rts
+sub L55, @r1
+L59: red L31
+rts
+bne @r4
+m1
+prn -91
+prn @r1
+dec @r3
+bne L40
+bne @r7
+dec S6
+prn -41
+clr S0
+jmp @r1
+cmp @r0, S3
+jmp L47
+inc @r2
+not D0
+bne D0
+red D0
+stop
+D0: .data 249,-173,492,65,475,280,-163,41,-254,268
+D1: .data 275,347,370,229,-96,148,133,302,9,-12
+D2: .data 25,103,456,-16,475,-320,-374,26,-280,253
+D3: .data -135,409,-113,-355,400,480,-83,-139,-77,-19
+D4: .data -16,55,417,363,30,-106,-350,-423,230,-379
+D5: .data 145,255,-166,263,493,163,-266,-415,-157,394
+D6: .data -418,380,-314,-104,159,310,-440,-200,291,404
+D7: .data 476,51,262,24,423,332,-184,89,352,137
+D8: .data 10,179,-290,65,280,-163,89,-160,84,-458
+D9: .data -96,-483,230,102,-320,-181,11,362,-422,-150
+S0: .string "mlwelvcikdajlkjp"
+S1: .string "cgkls"
+S2: .string "hpobvkvareqkvydqvs"
+S3: .string "gppnfocq"
+S4: .string "slrwyhfjiovgyn"
+S5: .string "pdlis"
+S6: .string "jzbpvdjxuopdchz"
+S7: .string "zrpewhiqboaqbm"
+S8: .string "tkccrjhtumkgm"
+S9: .string "ececeobxzhawbcd"
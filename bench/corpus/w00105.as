@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r3
+    prn 6
+endmcro
+mcro m1
+    sub @r4, @r2
+    prn 87
+endmcro
+mcro m2
+    sub @r2, @r7
+    prn 99
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 9
+endmcro
+mcro m4
+    sub @r2, @r1
+    prn 51
+endmcro
+m4
+add L0, L0
+rts
+m3
+jmp L0
+rts
+clr @r1
+prn @r0
+mov L0, @r7
+mov @r3, L0
+red @r5
+jmp L0
+mov -80, L0
+bne @r6
+cmp @r6, @r2
+add @r6, @r2
+mov -21, @r4
+L0: inc L0
+inc @r1
+not @r4
+prn L0
+add -245, L0
+L1: lea L1, L0
+jsr @r1
+L2: dec L24
+mov 419, @r0
+cmp @r5, 159
+jsr L0
+m1
+L3: sub @r4, @r0
+L4: add @r7, @r4
+inc L1
+bne @r6
+m4
+jmp L3
+red @r2
+clr @r0
+rts
+jmp @r0
+m1
+clr L1
+add -315, @r1
+mov @r2, @r1
+bne L1
+jmp L2
+jsr L1
+inc @r7
+jsr L1
+not @r7
+not L0
+sub L0, L1
+sub @r7, L1
+prn 286
+dec @r3
+lea L1, @r2
+dec L2
+lea L2, X0
+add @r0, L0
+inc L36
+cmp L3, @r7
+dec @r2
+not L0
+not @r5
+jsr L2
+dec L0
+red @r4
+bne @r7
+sub 441, L1
+m1
+add @r7, @r5
+add 369, L0
+red L3
+dec L1
+sub @r2, @r4
+m3
+dec L2
+red L3
+lea L31, @r5
+jmp @r6
+jmp @r2
+not L9
+clr @r5
+inc @r6
+m1
+inc @r6
+L5: add L1, @r2
+cmp @r6, 263
+not L2
+L6: jsr @r6
+bne @r3
+not L6
+L7: jmp @r4
+red @r5
+red @r2
+jsr L7
+L8: jsr @r2
+lea L5, L3
+m4
+m4
+prn L0
+mov @r4, L1
+rts
+sub L3, @r1
+lea L0, L7
+m3
+inc D0
+mov L1, L2
+m4
+jmp L3
+m3
+add -300, @r2
+L9: prn @r3
+add @r0, L0
+jsr @r0
+rts
+rts
+inc L5
+clr @r6
+jsr @r5
+lea L1, @r1
+sub -372, L9
+sub @r5, L4
+jmp @r7
+prn L4
+m4
+sub L9, L6
+inc @r1
+lea L9, L0
+prn @r3
+dec @r5
+prn -64
+m3
+bne L8
+red D0
+rts
+m2
+cmp @r3, 62
+add @r5, L2
+jmp @r0
+rts
+prn -276
+bne @r5
+jmp L2
+jmp @r2
+m3
+inc L58
+mov L1, L2
+cmp L7, 458
+inc L0
+dec @r0
+add @r3, L0
+rts
+mov 477, S9
+prn @r3
+rts
+jsr @r4
+mov @r6, L3
+jmp L26
+jsr L1
+not @r1
+clr @r7
+prn @r3
+rts
+rts
+cmp L5, L0
+inc @r2
+bne @r3
+prn @r3
+jmp @r6
+dec L8
+dec @r3
+sub L6, @r4
+jmp L6
+cmp 315, -74
+red @r6
+add 165, @r2
+m3
+m2
+m3
+red @r5
+L10: prn L8
+L11: red @r6
+jmp @r2
+not L8
+m1
+bne @r3
+L12: sub @r3, L10
+rts
+L13: jmp @r3
+jmp L8
+not L12
+prn L23
+prn @r1
+red @r0
+mov 485, L1
+add 214, L39
+jmp L2
+jmp D0
+L14: inc @r4
+L15: cmp L9, @r5
+dec @r0
+rts
+L16: cmp L1, L12
+cmp @r4, L5
+lea L5, L0
+not L5
+clr L10
+cmp @r4, -169
+inc @r6
+cmp @r2, L12
+L17: jmp @r4
+m4
+L18: jmp @r1
+clr @r5
+prn 354
+m0
+jsr L4
+add L17, @r3
+cmp @r1, L43
+cmp L12, L16
+mov 421, L5
+lea L18, @r6
+red L13
+L19: inc L0
+L20: clr @r0
+L21: red L11
+dec L0
+not L19
+dec @r5
+inc L21
+lea L13, L3
+dec @r6
+jsr @r1
+rts
+dec L21
+not L0
+L22: bne @r7
+jmp @r0
+not L16
+jmp L5
+L23: sub -498, @r7
+mov L18, L1
+L24: dec @r4
+L25: prn -295
+mov -246, X1
+clr L22
+add -61, X2
+add @r7, @r2
+L26: inc L24
+prn @r4
+add -228, @r6
+sub S7, L37
+L27: add 362, L22
+jsr L10
+L28: not L11
+jmp @r6
+inc L24
+red L10
+red L7
+cmp L7, L6
+add L28, L28
+lea L18, @r3
+clr @r0
+sub @r4, L1
+dec @r1
+jsr @r7
+dec @r2
+m2
+add S9, L8
+L29: prn L25
+not @r0
+add @r5, S8
+add D0, @r0
+jsr L12
+clr L15
+clr D0
+m0
+m1
+not @r3
+dec L25
+lea D0, @r6
+L30: dec @r3
+cmp 86, @r4
+lea L8, @r1
+clr L51
+not L15
+jmp L3
+add 331, @r5
+m2
+jsr L0
+m4
+jsr @r0
+jsr @r4
+L31: prn D0
+m3
+L32: add @r3, @r6
+rts
+lea L14, @r6
+L33: rts
+L34: inc L2
+m1
+dec @r4
+prn @r4
+L35: cmp -468, 98
+dec @r2
+mov L41, D0
+mov L17, @r3
+jsr @r0
+rts
+m2
+sub @r1, @r1
+cmp @r0, L12
+red L1
+add 142, @r7
+cmp @r5, D0
+inc @r0
+L36: jsr @r6
+m0
+bne L21
+L37: mov @r7, L31
+prn -127
+sub 138, @r4
+L38: cmp L10, @r3
+L39: cmp @r2, 195
+sub L14, @r3
+mov @r2, @r4
+jsr L13
+m3
+dec @r1
+red @r5
+clr L7
+L40: red @r0
+m3
+inc L6
+not @r2
+add -366, @r5
+cmp L33, -510
+jmp L31
+add @r1, @r2
+L41: mov D0, L3
+clr L13
+dec L25
+add L37, X3
+red @r3
+jmp L28
+m2
+m0
+L42: prn S6
+prn @r1
+jsr @r6
+clr L19
+mov L29, @r3
+lea L6, L9
+clr L17
+jsr @r3
+m0
+mov L37, L2
+L43: bne @r2
+not L6
+cmp @r6, L40
+bne L9
+add @r3, @r2
+L44: bne @r3
+bne L32
+bne @r3
+L45: jsr L37
+cmp L4, @r6
+inc @r4
+dec @r4
+prn -16
+L46: sub 393, @r6
+L47: rts
+L48: jsr @r4
+inc @r6
+L49: prn -156
+jmp L36
+mov -112, @r1
+cmp @r0, S4
+clr @r0
+cmp L44, -368
+L50: red L49
+L51: jmp L47
+jmp L39
+clr @r0
+prn @r2
+rts
+sub L55, @r6
+not @r6
+L52: sub L25, @r7
+m2
+add @r5, @r0
+bne @r6
+bne @r0
+m0
+sub 301, L46
+bne @r3
+prn 145
+prn 207
+dec @r2
+mov @r5, @r1
+jmp @r2
+sub @r7, L28
+jsr @r0
+jsr L55
+add -259, L27
+rts
+dec L54
+cmp @r6, -258
+L53: mov -406, L22
+add 413, L12
+lea L44, @r4
+jsr L55
+jmp S7
+clr L32
+rts
+mov @r0, L44
+lea D0, L8
+cmp @r4, -121
+prn 452
+L54: inc L47
+jmp D0
+clr L16
+m0
+red @r6
+inc L39
+L55: cmp L58, @r4
+not L7
+add @r1, L3
+sub 7, L58
+prn @r2
+mov L25, L24
+jsr L45
+L56: jsr @r2
+L57: not L20
+L58: bne L0
+L59: rts
+mov D0, L13
+rts
+bne X4
+inc D0
+stop
+D0: .data -211,-113,-351,-361,-397,-297,-292,95,386,286
+D1: .data -379,32,309,450,331,187,-196,291,304,-236
+D2: .data -272,196,42,-469,217,-338,-285,-407,-251,215
+D3: .data 52,229,318,-317,-70,-301,-290,228,205,105
+D4: .data -293,-3,111,302,-48,-41,-399,371,344,357
+D5: .data -346,479,213,385,388,149,484,-196,370,-397
+D6: .data 325,423,-396,470,472,-355,-95,116,367,-208
+D7: .data 120,353,-32,-20,-258,370,-35,407,-447,-172
+D8: .data -438,78,176,488,476,306,442,-173,-190,342
+D9: .data 330,433,97,195,-229,88,134,36,-189,472
+S0: .string "ddn"
+S1: .string "c"
+S2: .string "selcuvabgtcwxhexvhd"
+S3: .string "hjgz"
+S4: .string "unx"
+S5: .string "bkoau"
+S6: .string "notgvbhbnllvr"
+S7: .string "ykjrddoorp"
+S8: .string "btsybjrwc"
+S9: .string "t"
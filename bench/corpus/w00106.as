@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r6
+    prn 44
+endmcro
+mcro m1
+    sub @r0, @r4
+    prn 86
+endmcro
+mcro m2
+    sub @r4, @r5
+    prn 64
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 85
+endmcro
+mcro m4
+    sub @r4, @r7
+    prn 76
+endmcro
+inc @r2
+jsr L27
+m3
+clr @r3
+clr L0
+L0: clr L0
+prn 378
+add @r7, @r3
+L1: jsr @r1
+add -326, @r6
+jmp L1
+inc @r6
+m4
+lea L0, @r4
+sub @r4, @r6
+rts
+lea L1, L0
+not L35
+not @r3
+L2: clr L0
+lea L3, @r5
+bne @r2
+L3: dec L1
+inc @r6
+lea L0, @r4
+add L3, @r4
+jsr L18
+L4: red @r1
+cmp L4, @r6
+L5: add L4, @r6
+dec L2
+lea L5, L4
+jsr @r0
+not L4
+clr @r7
+sub L0, L4
+prn @r6
+L6: cmp @r1, @r7
+prn 474
+mov L4, @r0
+L7: jmp @r0
+jsr L2
+inc L2
+mov 75, L7
+add @r6, L7
+m3
+L8: inc L4
+m2
+inc @r0
+m2
+jsr L2
+jsr L3
+not @r4
+jmp @r1
+inc L6
+bne @r0
+m4
+inc @r5
+jmp L0
+clr L4
+jsr L7
+L9: sub @r6, L4
+jmp @r1
+jsr L4
+mov @r4, L8
+lea L3, @r3
+L10: jmp L6
+L11: red @r7
+lea L5, L8
+dec @r2
+red @r2
+add L0, @r0
+dec @r1
+jmp L2
+m4
+jmp L8
+rts
+not L8
+m0
+red @r4
+L12: cmp @r7, L4
+sub @r1, @r2
+prn L6
+red @r5
+add @r3, @r6
+jmp L1
+dec @r3
+not @r1
+dec L3
+add 133, @r4
+mov L8, @r0
+prn -229
+cmp -481, -142
+jmp @r7
+lea L5, @r7
+L13: jsr @r0
+m1
+clr L0
+lea L7, L10
+sub 183, L5
+m1
+jmp @r5
+prn @r1
+red L5
+L14: sub -56, @r6
+mov -300, @r6
+L15: jmp L8
+dec L6
+m4
+L16: prn -417
+bne D0
+red @r3
+red L14
+rts
+clr L16
+add @r6, @r1
+not @r5
+jsr L11
+mov L7, @r1
+clr S5
+jmp D0
+prn -288
+L17: mov L15, @r3
+jsr @r7
+add @r3, @r5
+m4
+not L15
+not @r4
+cmp L9, @r2
+jmp L13
+prn L0
+jsr @r2
+inc L1
+m1
+dec @r7
+L18: red @r0
+lea L1, @r2
+inc L12
+red L12
+not @r0
+dec L1
+L19: lea L14, L12
+jmp @r7
+m3
+L20: bne L20
+sub L3, @r1
+not @r2
+red L5
+cmp @r1, L6
+m2
+prn -490
+L21: clr L12
+L22: jmp @r0
+jmp @r6
+dec @r7
+red L17
+L23: mov L31, @r2
+mov 105, L2
+red @r1
+lea L14, L9
+bne L12
+m0
+mov L16, L9
+L24: jsr @r7
+m3
+cmp -284, -478
+lea L15, L24
+L25: add -42, L11
+red L12
+jsr @r4
+mov 180, L10
+sub @r6, L4
+cmp 223, -143
+dec @r6
+sub 432, L48
+cmp -224, -477
+L26: prn @r7
+prn 348
+dec @r1
+rts
+not @r5
+m1
+mov @r7, @r2
+inc L15
+add -210, @r3
+rts
+jmp L15
+L27: jsr @r3
+clr @r5
+mov L17, @r2
+dec @r0
+clr @r7
+red L2
+m2
+L28: mov L7, @r5
+rts
+mov 145, @r7
+L29: dec @r3
+red @r2
+L30: inc L28
+dec @r2
+sub @r7, L23
+sub @r6, L0
+sub @r2, L8
+mov L8, L16
+prn @r1
+L31: dec @r2
+L32: bne L11
+jmp L12
+prn L7
+jmp @r1
+L33: jmp @r1
+add @r7, @r0
+m1
+clr @r7
+m3
+mov 3, D0
+jmp L53
+prn L32
+inc L14
+L34: prn L14
+bne @r4
+m3
+L35: cmp @r5, -440
+sub L11, L5
+cmp L1, @r7
+lea L4, @r5
+L36: red @r7
+cmp @r7, @r7
+inc L44
+mov -134, L11
+jmp @r4
+m1
+inc L19
+jmp L34
+lea L18, L12
+L37: sub 83, @r0
+inc D0
+clr @r5
+mov 118, @r3
+red @r7
+red L45
+clr @r1
+mov 433, L11
+not @r6
+L38: jsr L24
+prn @r6
+mov 105, @r4
+inc L27
+L39: red @r0
+clr L35
+rts
+cmp L49, L5
+L40: red L5
+m1
+add L5, L33
+inc L29
+lea L5, @r2
+rts
+dec @r3
+mov 65, L24
+m1
+sub L20, @r0
+sub @r4, @r5
+sub 21, L2
+jsr L38
+add -124, L6
+sub @r2, L33
+clr @r7
+prn L24
+lea L32, L30
+lea L24, L38
+jsr @r7
+rts
+clr @r0
+clr S7
+cmp @r5, @r0
+m1
+add L10, L42
+L41: add L3, @r7
+rts
+jsr L41
+dec @r4
+inc @r3
+lea D0, @r2
+clr @r6
+add @r2, @r7
+jsr @r7
+rts
+cmp @r1, L16
+add L34, @r0
+lea L7, @r1
+mov -232, L27
+inc L6
+L42: inc L15
+rts
+m3
+inc @r2
+prn -231
+jmp @r3
+jmp @r7
+dec L36
+jsr L42
+clr @r5
+jmp L40
+m4
+red X0
+cmp 321, L4
+not @r7
+bne @r5
+bne L8
+dec @r0
+prn @r0
+bne L40
+not L34
+dec L0
+jmp L42
+add -192, L31
+sub 40, L40
+rts
+sub L16, S1
+add 438, L20
+cmp @r6, L32
+mov -78, L38
+dec L27
+red @r4
+mov L1, @r3
+not @r3
+L43: clr @r2
+dec L40
+sub @r1, S8
+m4
+add @r5, X1
+jsr L9
+m4
+lea L12, @r7
+m1
+cmp @r6, @r2
+bne L26
+clr @r6
+add @r3, @r4
+mov L25, L13
+lea L43, @r3
+rts
+add L31, S7
+add @r7, @r6
+dec @r4
+L44: red L58
+prn @r5
+sub @r1, @r5
+bne @r4
+add -135, @r1
+lea L11, @r4
+m2
+L45: bne @r3
+sub -343, L21
+jmp @r0
+red @r0
+prn @r5
+rts
+red @r6
+dec L34
+clr @r6
+inc @r2
+L46: add L55, X2
+add @r0, @r0
+sub 334, D0
+clr L1
+dec L37
+cmp 110, L24
+sub 210, L1
+sub 160, @r5
+prn @r2
+rts
+inc @r3
+inc @r7
+jmp @r0
+rts
+add 94, @r0
+m1
+L47: red @r5
+inc @r4
+m1
+cmp @r3, @r3
+L48: sub @r7, @r1
+clr L24
+rts
+dec L31
+jsr D0
+lea L54, L28
+red @r6
+bne L31
+red L56
+sub @r6, L19
+red L5
+add -425, L10
+m2
+lea L51, @r1
+add @r3, @r1
+clr L19
+add @r6, @r1
+clr L4
+not L38
+L49: bne L52
+L50: bne D0
+not @r3
+cmp L49, L29
+L51: clr @r5
+m3
+bne @r3
+jsr L7
+sub L2, L47
+m2
+jsr L44
+inc L56
+jmp L44
+add L5, @r2
+bne L22
+not @r5
+jmp S0
+mov @r6, L49
+jmp @r3
+m1
+not L53
+m0
+dec @r0
+L52: prn 36
+mov 19, @r1
+m3
+L53: add @r5, @r0
+L54: inc L57
+bne @r4
+L55: prn X3
+cmp L58, -26
+jsr S9
+clr X4
+L56: prn L57
+L57: jsr D0
+L58: lea S4, L59
+L59: jsr @r2
+stop
+D0: .data 134,-79,-144,-115,48,409,-205,-232,209,439
+D1: .data -254,-451,-290,-405,-288,-419,429,-220,-294,297
+D2: .data -492,-338,-224,-399,-482,-84,-228,126,-217,-84
+D3: .data 263,-189,178,-26,-167,-271,18,-199,68,112
+D4: .data 195,94,227,107,-63,308,-2,-270,401,-264
+D5: .data 247,476,122,468,-454,203,-345,-179,-448,292
+D6: .data 240,112,414,272,-235,51,430,176,-373,118
+D7: .data 42,-462,83,-68,84,229,-397,-483,329,-468
+D8: .data -296,123,-288,92,185,31,396,-444,-315,-476
+D9: .data -449,492,368,251,-416,254,320,190,-495,176
+S0: .string "bjfkhhacjrxy"
+S1: .string "svlct"
+S2: .string "uuasozsvdbtcgjeplx"
+S3: .string "cmsfxffdsmwgihnwz"
+S4: .string "ixmlqpmkzwoshdq"
+S5: .string "oox"
+S6: .string "fpakkygrkazmdrmvnz"
+S7: .string "faubtjkc"
+S8: .string "whtrugrsill"
+S9: .string "fpmiatwxkuimsivwled"
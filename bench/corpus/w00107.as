@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r1
+    prn 14
+endmcro
+mcro m1
+    sub @r5, @r5
+    prn 84
+endmcro
+mcro m2
+    sub @r6, @r3
+    prn 30
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 62
+endmcro
+mcro m4
+    sub @r6, @r5
+    prn 0
+endmcro
+prn L0
+dec L0
+L0: jmp @r2
+prn @r6
+cmp -404, L43
+prn @r2
+mov L0, @r2
+clr L0
+sub 356, L0
+m0
+lea L0, @r7
+m4
+inc L0
+jmp @r6
+jmp L0
+inc L0
+red L0
+add -75, L0
+m0
+prn L0
+mov -273, @r0
+m0
+m3
+prn @r4
+rts
+inc @r4
+red @r5
+jsr L0
+not L0
+not L0
+mov -38, @r7
+L1: not @r3
+L2: inc L0
+lea L0, @r3
+m4
+jmp L1
+dec @r0
+mov @r4, @r2
+L3: jsr L3
+m0
+lea L2, D0
+L4: cmp @r1, @r0
+not @r6
+lea L37, @r6
+red L0
+L5: add @r3, @r0
+lea L3, L3
+L6: sub @r2, L1
+rts
+jsr L6
+lea L4, @r6
+not L0
+sub @r7, @r0
+m1
+add @r7, @r0
+L7: add S4, @r6
+sub L3, L5
+sub L0, D0
+m1
+dec D0
+rts
+not @r1
+L8: sub L5, L1
+L9: inc @r7
+not L8
+add @r5, L1
+prn @r7
+not @r3
+rts
+cmp 36, -239
+lea L22, L6
+L10: mov @r0, @r2
+clr @r1
+cmp -199, -106
+cmp @r2, L7
+inc @r7
+sub -442, @r5
+sub @r5, L2
+clr L1
+not L6
+not @r2
+inc L2
+jsr @r4
+L11: bne @r5
+jsr @r7
+mov @r1, L5
+jsr L1
+m1
+rts
+not L10
+L12: jsr L8
+sub L10, @r4
+red L11
+jsr @r2
+clr @r3
+bne L1
+lea X0, @r1
+red @r7
+prn @r4
+m3
+add @r4, @r1
+bne @r4
+jmp @r3
+jsr L12
+sub L6, L1
+red L10
+sub @r7, L8
+add -4, @r6
+m2
+dec L7
+L13: cmp L1, @r0
+cmp 463, L9
+mov 327, @r3
+prn @r4
+red L3
+clr L12
+jmp L0
+m2
+bne L4
+m4
+bne L5
+jsr @r5
+rts
+prn @r3
+m0
+L14: red @r3
+jmp L1
+bne @r3
+cmp L0, L13
+bne L1
+inc @r2
+rts
+not @r1
+sub L11, L1
+sub L11, @r3
+sub @r1, L3
+sub @r4, @r0
+inc @r1
+jsr @r3
+dec L3
+sub @r5, @r6
+prn L14
+cmp L10, @r2
+rts
+mov L9, L14
+rts
+prn @r0
+not L6
+inc L4
+jmp L14
+jsr @r2
+red @r4
+L15: jmp @r2
+jmp @r6
+dec @r1
+clr @r0
+dec @r3
+cmp @r1, 364
+rts
+red @r3
+cmp @r3, L11
+rts
+bne @r6
+bne @r3
+sub @r2, @r0
+cmp -489, @r6
+jsr @r4
+inc @r5
+L16: cmp L3, L11
+dec @r3
+cmp L6, L3
+jmp @r2
+jsr L2
+jsr @r1
+clr D0
+sub L16, L12
+dec @r7
+mov -5, @r7
+rts
+L17: red L14
+jsr L17
+L18: jmp @r2
+m3
+red L5
+not @r4
+inc @r3
+jsr @r7
+L19: cmp L7, 251
+inc L8
+jmp L6
+m1
+sub 95, @r6
+m3
+add 320, L18
+dec @r7
+prn @r6
+L20: rts
+add L36, L53
+prn -60
+m0
+inc @r6
+L21: inc L50
+lea L1, L12
+rts
+prn @r1
+L22: rts
+L23: sub @r4, L17
+jsr L15
+lea L1, L20
+jsr @r4
+sub -504, L23
+sub @r2, L7
+L24: add -364, L19
+rts
+m1
+rts
+rts
+L25: add @r1, L15
+L26: jmp L22
+jsr @r2
+clr L7
+m0
+red L7
+jmp @r2
+cmp L9, X1
+add L22, L13
+jmp @r1
+jsr @r4
+not @r5
+prn 169
+lea L16, @r7
+red @r1
+red @r2
+jmp @r2
+jmp L12
+cmp -409, L54
+prn 198
+mov L32, @r2
+jmp L1
+lea L6, L26
+cmp L20, @r7
+sub L10, @r7
+L27: red @r2
+clr @r6
+mov @r7, @r1
+L28: red @r0
+m0
+rts
+m4
+jmp @r7
+m3
+L29: dec @r1
+add @r4, @r5
+add 7, @r6
+rts
+not @r6
+jmp L22
+inc L26
+add 280, @r6
+rts
+L30: dec @r0
+clr @r1
+red @r6
+lea L11, L17
+L31: cmp 62, -473
+dec L10
+L32: cmp L24, @r3
+sub -399, @r6
+mov L5, @r2
+m0
+lea L8, @r7
+sub @r1, @r6
+mov -457, @r6
+dec L28
+dec @r6
+prn -408
+clr @r7
+add L26, @r7
+prn @r4
+rts
+rts
+m1
+L33: mov L23, L20
+prn L25
+mov S5, @r4
+L34: prn @r0
+add @r5, @r2
+not @r4
+m0
+prn @r2
+red @r2
+rts
+m3
+L35: jmp L7
+bne @r4
+rts
+lea L21, @r6
+lea S1, @r7
+rts
+dec L27
+L36: jmp @r4
+bne L9
+dec L34
+dec @r5
+jmp @r7
+jsr @r2
+inc @r0
+jsr L26
+lea D0, L44
+bne X2
+rts
+m3
+prn @r7
+sub 85, L17
+m3
+clr L35
+jsr @r6
+L37: jsr L18
+L38: red @r3
+bne L31
+cmp L2, -127
+jmp @r2
+m3
+jmp @r3
+m3
+jmp L15
+not @r6
+L39: add L39, L5
+cmp -441, -5
+clr @r5
+sub @r2, D0
+add L48, L15
+L40: sub L14, @r6
+L41: bne @r3
+L42: lea L28, @r6
+jsr X3
+sub @r2, @r3
+sub L26, X4
+L43: dec @r3
+dec @r0
+L44: red @r6
+clr L35
+m4
+m3
+dec L33
+L45: not D0
+not @r5
+jmp L24
+not L37
+clr L26
+prn @r2
+L46: bne @r3
+clr @r3
+inc @r4
+clr @r6
+cmp L18, L18
+sub @r0, L36
+dec @r3
+prn @r3
+prn @r6
+jmp @r7
+clr L27
+prn L30
+sub @r3, @r6
+clr L34
+jmp D0
+L47: sub @r4, @r4
+jmp L47
+rts
+L48: lea L7, @r3
+mov 163, L23
+jmp L4
+jsr L11
+L49: mov L39, D0
+jmp L39
+jmp @r0
+jsr D0
+jsr @r3
+clr D0
+prn L46
+L50: sub S2, @r3
+inc L51
+prn @r6
+jmp @r4
+mov L30, @r1
+not @r2
+not @r7
+add L42, L46
+not L33
+jsr L15
+add 452, L37
+m2
+jmp D0
+inc L47
+bne @r5
+prn @r1
+bne L19
+rts
+sub @r6, L43
+bne @r7
+sub @r0, L40
+add @r0, @r5
+m1
+L51: mov L55, L34
+inc L32
+rts
+L52: clr @r7
+prn L18
+inc L41
+rts
+lea D0, @r0
+jmp L18
+L53: mov D0, L15
+add 242, @r5
+m1
+L54: cmp @r3, L5
+L55: dec @r0
+L56: jsr L32
+L57: bne L40
+prn @r6
+red L58
+clr @r1
+cmp L32, L53
+inc L59
+mov -253, L27
+not @r2
+lea D0, @r3
+L58: not L59
+prn L9
+mov -374, @r7
+clr @r7
+rts
+m0
+L59: cmp -445, 451
+prn S7
+jmp D0
+prn S8
+not S5
+m0
+m1
+stop
+D0: .data -72,-395,407,-433,208,264,-454,-468,-326,-453
+D1: .data -498,301,-411,75,154,403,-457,217,3,371
+D2: .data -345,-118,-9,-29,74,458,-467,-119,-454,192
+D3: .data -426,64,485,435,-273,-280,77,265,62,-273
+D4: .data 105,-421,80,212,-35,271,262,-329,462,139
+D5: .data -416,233,283,223,-181,337,258,-157,-125,152
+D6: .data -285,-52,-230,-373,7,-320,-411,-448,302,-369
+D7: .data -185,447,162,-468,412,-275,-377,488,-371,118
+D8: .data 440,-323,-211,-115,-495,236,-258,216,-176,181
+D9: .data -154,128,-237,1,197,-347,-21,-112,-146,-190
+S0: .string "grucozvsfzz"
+S1: .string "jhmkvpxywn"
+S2: .string "r"
+S3: .string "grjttjuw"
+S4: .string "laekqdkllyemngkaqv"
+S5: .string "gtksyickrprqror"
+S6: .string "azznmpsebwlltsjj"
+S7: .string "y"
+S8: .string "ahkjtzrdtewpf"
+S9: .string "okqjlowgcjenyrpwyop"
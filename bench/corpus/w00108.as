@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r3
+    prn 53
+endmcro
+mcro m1
+    sub @r1, @r6
+    prn 83
+endmcro
+mcro m2
+    sub @r0, @r1
+    prn 95
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 38
+endmcro
+mcro m4
+    sub @r0, @r3
+    prn 57
+endmcro
+red L0
+L0: lea L0, @r6
+add -310, @r4
+jsr L0
+bne L0
+red L0
+clr L0
+not @r6
+rts
+m1
+clr L0
+cmp L0, -44
+inc L0
+L1: mov L1, @r1
+cmp @r5, -208
+lea L0, D0
+bne @r4
+rts
+clr @r7
+m1
+lea L0, @r1
+cmp @r4, L1
+jsr @r4
+dec L0
+mov -463, @r3
+lea L0, S0
+clr @r7
+sub L17, @r5
+m1
+mov L0, @r2
+mov L1, L0
+clr L1
+bne @r2
+m2
+lea L0, @r5
+rts
+sub L0, @r7
+L2: cmp 318, L0
+m2
+add -270, @r1
+inc X0
+clr @r2
+cmp @r4, L0
+sub 71, L0
+lea D0, L7
+clr @r0
+m2
+lea L1, @r4
+m1
+L3: not L1
+prn @r4
+jmp @r6
+inc @r2
+rts
+jsr L3
+sub L3, L3
+lea L3, @r2
+jmp D0
+m1
+lea L2, @r3
+m4
+cmp -449, @r6
+clr L1
+dec L27
+sub -260, @r5
+sub -418, @r2
+clr @r1
+prn L3
+red @r6
+inc L2
+L4: jsr @r2
+rts
+rts
+L5: jmp L5
+jmp L5
+not @r6
+dec L2
+m0
+sub @r6, L1
+m2
+clr L16
+not L1
+m2
+L6: jsr L1
+jmp L2
+clr L5
+m1
+red L1
+sub 3, L1
+inc @r2
+L7: lea L1, L3
+m3
+inc L30
+lea L7, @r5
+L8: prn L4
+mov -233, @r5
+clr L4
+mov L31, L7
+bne L8
+L9: mov L3, L45
+prn @r1
+m1
+prn L4
+L10: cmp 503, -165
+jmp L1
+bne @r3
+mov 439, @r3
+not S0
+dec L10
+m0
+jmp L8
+add L0, @r2
+jmp L0
+clr L1
+m3
+L11: rts
+lea L2, @r7
+sub L11, @r5
+sub 163, @r5
+prn @r0
+rts
+m0
+jmp L6
+mov L7, L10
+m1
+jmp L7
+cmp L8, @r2
+L12: cmp @r0, L0
+L13: lea D0, @r4
+clr L6
+lea D0, L3
+jsr L4
+sub @r2, @r5
+jsr @r7
+rts
+cmp @r4, L7
+m2
+not L12
+L14: clr D0
+dec @r6
+rts
+prn @r1
+L15: not @r5
+jmp L4
+clr L4
+cmp @r4, L15
+bne L1
+clr L5
+lea L1, L8
+m0
+inc @r6
+red L14
+rts
+lea L2, L2
+not L1
+sub L10, @r7
+add @r4, @r0
+add 162, @r2
+L16: jmp @r7
+red S9
+bne L1
+L17: jmp @r1
+m3
+dec S9
+add -314, @r3
+L18: dec L4
+dec L17
+jsr @r7
+jsr L3
+jmp L2
+inc @r5
+jsr L7
+red @r3
+add L56, L7
+mov -371, L0
+rts
+L19: add 233, L3
+L20: inc @r3
+L21: prn 168
+red @r2
+mov @r3, L18
+sub -39, @r3
+sub L21, L18
+add @r7, L15
+bne @r2
+add @r5, @r3
+sub L19, L1
+jmp @r0
+cmp L0, @r0
+cmp @r4, @r3
+m0
+m1
+m4
+not L18
+L22: jmp L12
+L23: red D0
+cmp L7, @r7
+mov L18, @r0
+not L9
+sub @r4, @r5
+jmp @r3
+jmp @r6
+L24: prn -447
+dec L8
+lea L4, @r4
+jmp @r4
+L25: sub @r6, L13
+jmp @r1
+L26: jmp @r1
+mov L22, @r1
+rts
+mov 158, L59
+L27: clr @r5
+cmp @r7, @r6
+L28: lea L15, L2
+m3
+L29: mov @r3, L6
+m4
+lea L3, @r0
+mov @r0, L15
+lea L13, L4
+jsr L9
+jmp @r4
+bne L6
+m2
+L30: rts
+jmp L24
+cmp L27, L29
+red @r7
+jsr @r6
+cmp @r1, -483
+dec L23
+clr @r2
+not @r7
+jmp L6
+lea L9, L18
+inc L27
+jmp L7
+m3
+dec @r5
+add L6, @r2
+L31: red @r1
+L32: clr @r0
+clr @r6
+lea L32, @r1
+dec L9
+jmp L23
+lea L31, L11
+sub 264, L6
+add -161, L19
+inc L10
+dec @r0
+dec L7
+inc X1
+red @r0
+jmp @r6
+jsr L24
+m1
+bne L32
+dec @r4
+jmp L30
+rts
+L33: add -404, L4
+cmp 259, L30
+add L24, L22
+inc @r3
+red L26
+inc L18
+not L20
+add @r2, @r3
+jsr @r6
+m0
+inc L2
+red @r4
+add -369, L3
+jsr @r5
+inc @r4
+rts
+L34: mov L12, @r3
+L35: inc L7
+lea L15, L27
+mov 336, L22
+rts
+m1
+red @r1
+rts
+inc L11
+cmp -8, L11
+L36: not @r3
+jmp @r5
+bne L8
+bne @r4
+clr @r0
+cmp 65, L26
+L37: lea L4, @r1
+bne @r7
+L38: cmp L22, 91
+red L43
+bne @r0
+red @r1
+L39: jmp L23
+L40: prn @r7
+clr L40
+L41: inc @r2
+m4
+L42: jmp @r1
+jmp @r6
+dec L17
+prn L30
+rts
+lea L33, @r5
+L43: cmp 304, 500
+mov L18, @r1
+L44: clr L39
+L45: red @r4
+mov @r0, L36
+m1
+jsr D0
+sub @r0, @r3
+prn L45
+not L35
+bne L48
+not L31
+L46: red @r1
+m4
+lea D0, @r3
+bne X2
+dec @r1
+jsr @r1
+dec L18
+jmp @r5
+L47: not L5
+dec @r5
+jmp L57
+sub L5, @r5
+rts
+inc L28
+dec @r7
+rts
+add @r4, @r7
+prn 391
+sub @r0, L29
+sub L22, L4
+prn @r4
+mov 167, @r5
+rts
+clr L8
+lea S0, @r2
+not @r1
+clr @r3
+not L40
+L48: lea L6, @r5
+rts
+bne L22
+inc @r3
+bne @r4
+dec L21
+m4
+rts
+jsr @r6
+rts
+L49: mov L14, L48
+L50: lea L59, @r3
+jmp @r1
+jmp @r6
+rts
+L51: jsr L56
+dec L43
+add -22, L7
+bne @r3
+L52: rts
+inc @r3
+inc L15
+bne L16
+inc @r0
+L53: sub @r2, @r2
+bne @r4
+rts
+prn L17
+mov S4, L29
+prn L11
+bne L42
+not @r2
+clr L24
+cmp @r0, @r4
+sub @r6, D0
+mov 173, L49
+L54: mov L0, @r7
+add @r1, @r6
+inc L0
+cmp L10, -101
+add -348, L53
+dec @r6
+clr L40
+mov L57, L22
+dec @r3
+red L30
+prn @r6
+jmp @r6
+L55: red L9
+cmp L20, 426
+m1
+mov L44, S4
+inc @r4
+add -106, @r1
+prn 66
+rts
+cmp L29, @r1
+prn -210
+dec L36
+L56: lea L25, @r4
+jsr @r4
+m2
+cmp 205, @r6
+inc L55
+red @r1
+dec L53
+clr L57
+add L2, @r5
+jmp @r6
+red X3
+not L2
+lea S2, L59
+cmp -278, L39
+jsr @r2
+m1
+jmp @r0
+rts
+m0
+clr D0
+L57: clr L35
+sub L59, S3
+L58: jmp @r6
+rts
+rts
+clr L59
+jmp X4
+L59: red @r2
+inc L12
+mov D0, L26
+stop
+D0: .data -306,368,-294,-349,-319,353,360,-230,416,-261
+D1: .data -218,402,-28,-153,498,491,417,478,-86,53
+D2: .data -485,-434,87,-79,184,246,388,-316,-25,-196
+D3: .data 378,437,323,-327,-177,437,-318,153,59,251
+D4: .data 94,390,201,-331,-227,175,291,-332,392,308
+D5: .data -454,-25,-146,328,351,-193,211,478,304,151
+D6: .data 107,-346,-48,343,-352,449,297,232,-238,-93
+D7: .data -357,-215,393,201,196,344,-122,-61,268,418
+D8: .data 128,-260,289,225,43,-359,-404,8,-11,-95
+D9: .data -31,-312,-92,476,-81,304,313,301,-349,-298
+S0: .string "srjkstbwdmpmnvnsm"
+S1: .string "garlmpgiv"
+S2: .string "wimxlfe"
+S3: .string "wddqxy"
+S4: .string "fkuwoxydekefynybw"
+S5: .string "mtzlvwkfyhskxtjvyu"
+S6: .string "drpcgzsfaimq"
+S7: .string "jarcj"
+S8: .string "mevyhovvmuxfsxmprqie"
+S9: .string "wlu"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r6
+    prn 23
+endmcro
+mcro m1
+    sub @r5, @r7
+    prn 81
+endmcro
+mcro m2
+    sub @r2, @r6
+    prn 60
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 83
+endmcro
+mcro m4
+    sub @r2, @r2
+    prn 81
+endmcro
+cmp -100, L0
+prn -452
+jmp L0
+clr L0
+dec @r6
+mov L0, L0
+sub -354, @r2
+add L0, L13
+sub @r7, L0
+cmp @r5, L0
+mov L0, L0
+L0: inc @r3
+red L0
+rts
+rts
+rts
+clr @r0
+L1: sub @r3, @r3
+jmp L1
+red @r0
+m4
+L2: add -45, @r7
+red @r7
+red L2
+L3: inc @r3
+add L0, @r5
+bne L2
+L4: jmp L4
+lea L3, @r0
+mov L3, @r6
+inc L4
+red @r3
+m1
+bne L3
+sub @r4, L3
+add 53, @r3
+L5: jmp @r0
+rts
+m0
+m1
+L6: add -372, X0
+dec L5
+cmp L6, 374
+rts
+not L6
+dec L3
+bne @r1
+lea L6, L1
+inc L1
+clr L0
+sub L2, @r4
+not @r3
+L7: prn @r7
+jsr X1
+mov 238, L1
+L8: bne @r2
+prn -150
+mov -377, @r6
+clr @r5
+rts
+m2
+lea L2, L25
+mov L6, @r5
+jmp L6
+rts
+lea L8, @r2
+lea L4, L6
+lea L4, @r1
+add @r7, L6
+jsr @r4
+not L7
+prn L5
+m1
+inc L8
+mov @r2, @r4
+sub 413, @r7
+jsr @r3
+add @r2, L5
+jsr @r0
+not L7
+cmp 197, L8
+jmp @r3
+add -113, L2
+L9: prn S0
+mov -210, @r6
+L10: prn L7
+dec @r7
+jmp L8
+sub 162, L10
+dec @r1
+prn @r6
+inc L4
+not @r5
+m2
+L11: not L15
+cmp @r4, -207
+mov @r4, @r5
+lea L7, @r7
+bne @r2
+m1
+bne L7
+red L11
+m4
+prn @r6
+inc L9
+add 460, L7
+prn @r2
+jsr @r2
+L12: clr L4
+mov L12, S6
+inc @r2
+rts
+m4
+clr @r2
+m3
+L13: not @r1
+jmp L8
+L14: mov L13, @r1
+red L10
+rts
+mov 376, S6
+mov @r7, @r6
+m3
+L15: not @r5
+clr L2
+bne @r0
+sub 387, L51
+L16: rts
+add @r2, @r1
+rts
+mov L16, L4
+mov -294, @r5
+mov 100, L11
+not L9
+L17: inc @r4
+bne @r3
+jsr L24
+add L2, L10
+m2
+sub 289, L10
+dec L6
+lea L7, L16
+not @r1
+rts
+jmp @r1
+L18: red @r6
+sub L7, L11
+bne @r7
+L19: red L7
+bne @r6
+cmp -373, @r5
+m2
+m0
+bne @r2
+sub @r5, @r3
+bne @r0
+cmp 125, L18
+L20: jsr @r5
+dec @r1
+jmp L17
+L21: bne L13
+clr L4
+cmp L15, L13
+inc L17
+L22: prn @r2
+jmp @r1
+m1
+jmp L7
+not L22
+clr @r0
+cmp L18, L0
+prn @r7
+clr @r4
+bne L21
+m2
+bne @r2
+bne L19
+inc L5
+inc L19
+prn 173
+inc @r5
+inc @r7
+dec @r4
+bne L16
+mov 136, L13
+prn L3
+mov @r5, @r4
+sub 428, L17
+lea L6, L20
+lea L10, @r3
+not @r5
+add 441, @r3
+not L11
+jsr L10
+jsr @r2
+lea L19, @r6
+red @r2
+m0
+clr @r5
+sub -319, @r0
+not D0
+m3
+m1
+prn L10
+L23: dec L12
+sub 404, L7
+inc @r0
+mov @r4, L23
+rts
+m0
+red L22
+jmp L3
+red L23
+rts
+jmp @r3
+add L1, L10
+red L2
+add -177, @r1
+dec @r0
+bne L35
+m4
+bne @r7
+L24: lea L3, @r7
+add L12, @r5
+L25: jsr L1
+bne @r5
+lea L6, L14
+lea L24, @r3
+red L25
+clr L30
+m2
+clr L49
+lea L21, L20
+not L14
+L26: sub @r5, @r1
+dec @r5
+prn -105
+sub L15, L21
+L27: jsr L8
+lea D0, L10
+mov @r2, S7
+inc @r3
+m1
+cmp @r2, @r2
+rts
+mov L16, @r5
+L28: lea L3, @r6
+L29: not @r2
+prn -337
+add 13, @r6
+clr @r7
+bne L27
+not L25
+sub @r1, @r4
+mov -57, @r0
+sub @r2, L55
+jmp X2
+lea L2, L28
+prn @r7
+lea L13, L2
+add L0, L7
+L30: inc L24
+L31: inc L1
+clr L6
+add -158, L21
+red L26
+L32: clr @r0
+inc L11
+add L32, D0
+L33: sub L17, @r5
+jsr @r2
+inc @r2
+mov L28, @r3
+inc @r0
+m4
+add L12, L26
+bne @r5
+L34: cmp L22, @r4
+jmp L7
+prn @r5
+jmp L20
+not @r6
+L35: jmp L1
+L36: dec @r4
+add -346, @r7
+red @r4
+inc @r0
+L37: cmp L37, L18
+jsr @r7
+bne @r1
+cmp L3, L37
+rts
+not L55
+sub @r3, @r5
+prn L29
+add 141, L37
+red L6
+red L22
+rts
+m0
+add @r0, @r0
+mov -302, @r5
+sub @r3, @r1
+not L20
+sub L0, @r6
+L38: rts
+dec @r1
+add L13, X3
+bne L25
+L39: red @r0
+mov D0, @r1
+bne @r4
+not @r2
+dec L6
+prn @r6
+jmp @r7
+not L39
+clr L8
+bne @r0
+sub @r5, L16
+sub @r7, @r1
+L40: inc L13
+prn -172
+not @r3
+not @r1
+bne @r6
+L41: dec L3
+sub -162, @r1
+bne @r4
+L42: bne @r7
+mov -155, D0
+sub @r5, @r4
+clr L27
+L43: bne L35
+clr L32
+m4
+jsr L57
+L44: prn L44
+m2
+inc @r2
+dec @r0
+inc L43
+bne L14
+m2
+cmp @r2, -35
+dec L29
+m4
+jmp @r2
+not D0
+red L5
+m4
+jsr @r4
+L45: prn 28
+rts
+m1
+not @r0
+add L43, @r1
+clr @r7
+L46: inc @r1
+jsr X4
+mov L41, @r1
+m4
+cmp -277, -196
+prn 69
+m3
+rts
+add -486, @r4
+bne @r4
+prn L14
+m1
+dec @r7
+clr @r3
+mov -464, @r3
+L47: bne @r1
+mov L34, @r6
+mov L12, L56
+cmp @r6, 315
+jsr @r3
+L48: not @r3
+m1
+L49: mov L1, L43
+jmp L58
+L50: prn @r4
+prn 288
+add -112, L25
+lea L19, D0
+jsr @r7
+cmp -225, L38
+L51: rts
+lea L47, L7
+m1
+lea L6, @r6
+cmp L57, L19
+jsr L41
+mov 8, L45
+add @r3, L19
+lea L41, @r0
+L52: cmp @r7, -214
+sub @r0, D0
+sub L10, S9
+cmp @r1, @r1
+clr L3
+m2
+prn 459
+cmp L59, L26
+jsr @r3
+bne L56
+inc L16
+sub 464, @r6
+dec @r5
+L53: rts
+sub L59, L57
+L54: add @r5, @r7
+cmp 349, @r3
+cmp -213, L56
+rts
+m1
+m3
+not L56
+not @r2
+prn 146
+mov @r0, @r2
+jmp L25
+L55: red @r2
+cmp @r3, L2
+bne @r0
+rts
+L56: prn @r2
+cmp S1, @r6
+mov -256, @r2
+bne @r3
+mov L58, @r7
+L57: bne @r5
+red @r4
+prn @r7
+lea D0, @r2
+L58: cmp S3, D0
+red S3
+L59: jmp @r3
+red S0
+stop
+D0: .data -478,188,341,-19,-1,-213,-107,428,-125,-34
+D1: .data 147,427,-459,-278,216,88,390,254,-405,-261
+D2: .data 42,-119,187,-438,-315,212,-428,491,-178,-146
+D3: .data 299,-125,-75,-184,-66,367,-370,-45,412,361
+D4: .data 406,-261,149,-410,-436,-341,298,496,331,92
+D5: .data -420,276,426,-203,142,-413,68,-153,214,-269
+D6: .data 37,276,219,221,-316,-127,-39,-496,419,147
+D7: .data 157,-177,225,-355,-266,153,-198,-174,226,71
+D8: .data 116,-320,-173,-276,419,235,-384,-198,7,-461
+D9: .data 12,132,449,-100,-185,-439,-284,-45,214,251
+S0: .string "qxmgxzxyiypvuwjclo"
+S1: .string "thirrxubygbc"
+S2: .string "nb"
+S3: .string "w"
+S4: .string "wnxsdgqhgzt"
+S5: .string "irw"
+S6: .string "jtfcukfgwibkdpy"
+S7: .string "pqdlfajrklatzddxnfh"
+S8: .string "jbywpypliyx"
+S9: .string "v"
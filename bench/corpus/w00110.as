@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r0
+    prn 61
+endmcro
+mcro m1
+    sub @r2, @r1
+    prn 80
+endmcro
+mcro m2
+    sub @r4, @r4
+    prn 58
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 59
+endmcro
+mcro m4
+    sub @r4, @r0
+    prn 6
+endmcro
+L0: inc L0
+mov 121, @r1
+sub -373, @r6
+prn @r3
+dec @r5
+dec L39
+bne L0
+inc @r6
+prn @r1
+clr @r1
+clr @r5
+add L0, @r4
+mov @r0, @r4
+rts
+prn L0
+jmp L0
+rts
+bne L0
+not @r6
+lea L0, @r7
+rts
+L1: red @r6
+L2: not L2
+red @r4
+bne @r0
+cmp L2, -180
+jsr L0
+jsr L0
+rts
+add 12, L1
+cmp @r0, @r0
+m4
+prn L0
+jsr D0
+L3: prn -75
+L4: not L2
+clr L0
+cmp @r5, @r3
+prn L2
+lea L0, @r5
+m4
+m2
+L5: mov L4, L3
+clr L0
+inc @r7
+add @r7, L5
+red @r2
+L6: bne @r0
+prn L0
+rts
+bne L2
+prn L6
+m2
+dec L1
+clr @r6
+m2
+dec @r4
+bne L3
+not L2
+sub -433, L1
+inc L4
+m1
+not L0
+L7: cmp L3, 509
+m1
+cmp L1, 21
+clr L1
+jmp L6
+clr L6
+inc L5
+L8: rts
+lea L5, L4
+dec L6
+lea L5, L7
+dec L4
+jmp @r1
+bne L2
+m0
+bne L6
+sub 114, @r6
+red @r6
+L9: jmp L4
+L10: add @r2, @r5
+L11: jsr @r5
+L12: jsr L24
+red L9
+L13: rts
+m2
+L14: lea L4, @r3
+lea L4, @r5
+clr L11
+m2
+mov -78, L8
+sub @r1, L12
+lea L14, @r2
+red S2
+clr @r3
+m4
+L15: cmp @r0, @r2
+add L12, L10
+not @r3
+sub L55, L14
+mov L6, L11
+not L3
+dec @r0
+jsr L14
+sub L14, L4
+inc L1
+jmp L1
+inc @r6
+cmp @r5, -395
+jmp @r3
+jmp @r7
+bne @r3
+jmp @r6
+red L6
+dec @r0
+jsr L1
+dec L4
+m3
+sub -425, @r2
+m0
+red L7
+L16: add L11, @r4
+add @r0, L8
+rts
+m3
+m1
+jsr L14
+dec @r6
+add 173, @r2
+L17: jmp L9
+sub @r4, L7
+L18: bne @r0
+L19: red L1
+sub 92, L44
+red L6
+rts
+rts
+L20: bne @r6
+L21: clr L2
+cmp L8, -495
+dec @r7
+rts
+clr @r2
+not L14
+m1
+m4
+not L2
+L22: prn -5
+bne L9
+L23: inc L5
+dec @r6
+jsr L16
+L24: prn @r5
+rts
+clr @r7
+jsr @r2
+not @r1
+add -204, @r4
+bne @r2
+not L15
+L25: not @r2
+lea L18, L5
+L26: dec @r4
+L27: sub @r2, @r2
+rts
+m0
+mov @r1, L6
+L28: lea L6, @r7
+L29: cmp L8, @r1
+L30: rts
+dec L28
+prn @r0
+jsr L35
+jsr @r6
+inc @r0
+mov -186, @r1
+sub @r3, S0
+prn L30
+jsr L21
+dec @r7
+dec @r5
+not L14
+not L14
+rts
+rts
+bne @r1
+cmp -266, L4
+not @r5
+jmp @r0
+m2
+dec L59
+not @r3
+m0
+clr L14
+jmp @r0
+mov -262, L10
+dec @r4
+prn @r5
+prn -375
+sub L14, L19
+red @r1
+lea L10, S8
+jmp L19
+red @r5
+inc @r7
+not L22
+not @r5
+rts
+add X0, L6
+cmp 460, 182
+dec L22
+clr @r2
+sub 412, @r5
+bne L29
+jmp L21
+L31: red @r4
+L32: jmp @r5
+m0
+inc @r6
+L33: bne L8
+lea L27, @r7
+red @r5
+not @r3
+mov 453, L5
+sub L43, @r0
+L34: clr @r2
+not @r6
+L35: clr @r5
+prn L35
+jsr L16
+m4
+sub @r2, @r6
+clr L0
+m4
+red @r6
+L36: jmp @r2
+add L6, @r3
+rts
+not @r7
+m3
+dec @r7
+dec @r4
+lea L32, L26
+lea L16, L19
+inc L29
+L37: rts
+bne @r0
+sub @r4, S7
+dec L51
+jmp L22
+sub 441, @r3
+lea L37, @r0
+lea L16, @r3
+cmp L36, L32
+sub L12, L20
+red @r4
+red @r3
+not L51
+jsr L7
+clr @r3
+cmp L17, 228
+L38: add L30, L31
+jsr @r0
+m0
+bne L5
+red L21
+L39: clr L9
+lea L6, L0
+lea L6, @r3
+L40: jmp @r3
+L41: prn -460
+L42: lea L15, @r2
+m2
+bne L28
+cmp -353, L31
+cmp 277, 27
+m0
+red L1
+jmp L5
+inc @r7
+cmp -99, @r0
+dec @r3
+dec L5
+L43: lea L15, @r7
+not @r1
+jmp L7
+clr L30
+not L23
+add S2, @r0
+jmp L30
+prn -414
+jmp @r2
+jsr L23
+inc @r2
+bne @r0
+not L46
+jmp L5
+L44: jsr L51
+not @r6
+clr @r0
+inc @r0
+L45: jsr @r4
+L46: rts
+m1
+prn -13
+cmp 428, L29
+bne L15
+cmp L10, 239
+lea L8, L22
+inc L44
+rts
+add 442, @r3
+sub L41, L49
+L47: jsr L15
+bne @r2
+L48: prn -304
+m3
+sub @r3, D0
+clr L21
+red @r7
+dec @r1
+bne @r0
+add @r3, L16
+lea D0, @r2
+mov @r0, @r1
+not @r5
+m4
+not L50
+not S7
+dec L36
+clr L7
+rts
+L49: not L21
+m3
+rts
+bne @r0
+jsr L15
+m4
+cmp X1, @r0
+bne @r2
+m0
+not L50
+rts
+dec L52
+m0
+cmp -494, @r7
+cmp -278, @r6
+prn L59
+inc @r1
+L50: add @r2, L12
+add L42, L15
+bne L10
+jmp L59
+bne @r0
+red @r2
+cmp L20, 347
+inc L33
+mov L35, @r3
+m2
+add L50, @r7
+dec L46
+L51: dec @r4
+inc L55
+add -49, L30
+inc L54
+not L31
+cmp @r0, L21
+clr @r5
+lea L29, L32
+lea L35, @r3
+rts
+not @r0
+inc @r6
+L52: clr L12
+m0
+red @r4
+L53: inc @r7
+sub X2, L28
+add L54, L24
+lea D0, @r0
+m0
+bne L24
+m3
+lea L3, L23
+jmp @r2
+rts
+add L9, X3
+m4
+jmp @r6
+dec L47
+sub L14, @r6
+add -122, @r5
+clr L45
+add L59, L37
+sub L46, L26
+lea L10, @r6
+L54: inc L56
+cmp -370, -194
+cmp 164, L10
+m0
+lea D0, @r2
+cmp 455, L33
+jmp L56
+red @r4
+bne @r3
+dec L51
+jmp @r1
+bne @r6
+not X4
+mov L6, @r1
+bne L18
+dec @r5
+L55: not L23
+L56: sub 455, L41
+dec L26
+clr L42
+L57: mov L39, @r4
+mov @r2, L40
+bne @r6
+jmp L17
+red @r0
+red @r2
+inc @r2
+jsr L35
+clr @r2
+sub S1, @r6
+dec D0
+L58: mov @r7, @r3
+add @r1, S2
+lea L4, @r4
+bne L47
+inc L9
+bne @r1
+L59: prn L10
+dec S7
+red @r3
+cmp D0, -440
+prn D0
+stop
+D0: .data -305,373,440,175,214,-486,-349,499,-113,-329
+D1: .data -322,-239,-422,184,311,158,491,390,28,34
+D2: .data -415,110,-256,443,225,385,446,-400,-391,-17
+D3: .data 119,111,58,-203,-428,-339,451,-340,398,-134
+D4: .data 390,-500,-66,418,-124,-298,-353,-52,406,245
+D5: .data -114,-360,-7,-233,-422,62,491,-131,425,-430
+D6: .data -389,164,349,456,-277,-99,-431,94,-366,333
+D7: .data -348,-69,41,-1,-429,461,242,-315,132,-468
+D8: .data -443,-421,123,484,-113,368,229,-217,-402,392
+D9: .data -218,335,-231,-230,-265,-480,-17,432,-142,359
+S0: .string "udng"
+S1: .string "uwfbrspucuzpyf"
+S2: .string "vccpmtdxgvcy"
+S3: .string "qcgcdt"
+S4: .string "jafmgtr"
+S5: .string "ervkqme"
+S6: .string "l"
+S7: .string "zdboirtzls"
+S8: .string "afjntrygisxcsaqabrd"
+S9: .string "zzrveqzldblyho"
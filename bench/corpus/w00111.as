@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r3
+    prn 32
+endmcro
+mcro m1
+    sub @r6, @r2
+    prn 78
+endmcro
+mcro m2
+    sub @r6, @r2
+    prn 23
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 35
+endmcro
+mcro m4
+    sub @r6, @r6
+    prn 30
+endmcro
+jsr @r6
+L0: clr L0
+L1: red @r2
+prn 398
+clr L1
+rts
+red @r1
+m2
+m2
+prn L1
+L2: mov -486, @r1
+not L0
+mov L1, S0
+inc @r1
+cmp L1, -24
+sub L27, @r4
+jmp L1
+bne @r5
+jmp @r4
+red D0
+jmp @r0
+lea L1, @r5
+L3: not @r6
+prn @r2
+m3
+not @r2
+dec L0
+clr L2
+red L1
+dec @r1
+jmp @r4
+dec @r1
+cmp @r0, L2
+jmp @r5
+not @r3
+clr L0
+m1
+rts
+add -511, L49
+cmp @r0, L1
+m0
+mov L2, L3
+m3
+prn @r1
+bne @r5
+bne @r4
+not L2
+dec @r3
+prn @r5
+L4: clr L2
+inc @r3
+clr L1
+lea L1, @r0
+dec L3
+L5: inc @r5
+cmp @r0, L0
+dec @r4
+add @r5, L2
+jsr L3
+add 446, L0
+mov @r1, L4
+add 22, @r3
+prn @r5
+cmp @r1, -321
+rts
+m3
+m2
+clr L3
+cmp L5, @r1
+jmp @r3
+sub -463, L1
+m3
+lea L0, L0
+mov @r6, L0
+jsr L4
+cmp L3, 368
+rts
+L6: jsr @r6
+clr L49
+red L5
+dec @r7
+rts
+prn S4
+lea L2, L5
+bne @r0
+jmp @r6
+dec L3
+L7: jmp L54
+sub 184, L7
+rts
+L8: cmp -504, @r0
+jsr @r4
+add L38, L3
+not @r5
+jsr D0
+m0
+not L1
+cmp L7, @r4
+lea L2, L3
+m4
+rts
+m3
+L9: jmp @r4
+jmp L9
+bne @r3
+add -244, L5
+L10: not L3
+cmp -264, -429
+sub @r4, L1
+lea L2, L1
+red L2
+jsr L10
+cmp L4, @r5
+jmp L5
+inc L1
+m0
+mov -180, @r5
+clr L4
+L11: inc @r0
+red L8
+m2
+m4
+L12: bne @r4
+prn @r4
+L13: rts
+rts
+clr L4
+not L6
+L14: jmp L14
+cmp 397, -261
+not @r0
+prn D0
+rts
+bne @r3
+cmp L3, -349
+mov L6, L1
+clr L8
+cmp @r4, -358
+red @r6
+mov 95, L10
+jmp L4
+clr L10
+prn -184
+jsr @r3
+cmp @r2, L14
+jmp @r1
+mov 118, @r0
+red @r3
+m1
+inc @r2
+L15: cmp @r1, -310
+L16: mov @r2, @r3
+inc L4
+m0
+sub 48, L10
+inc L5
+add @r7, @r2
+red L0
+red L8
+jsr @r7
+sub @r6, L11
+jsr L7
+L17: jmp @r2
+jsr L1
+dec L8
+not L3
+clr @r4
+L18: lea L18, @r4
+jsr L18
+lea L12, L15
+add L15, L12
+cmp 98, 291
+m1
+jsr L56
+jsr @r7
+prn L5
+L19: jsr @r5
+L20: cmp 136, 349
+lea L6, L19
+mov @r1, L6
+prn L11
+L21: bne L20
+jsr L7
+L22: mov L10, @r3
+clr L0
+m3
+cmp L2, -385
+red @r6
+lea L1, L31
+L23: jsr L7
+dec @r4
+clr @r5
+prn L20
+bne L3
+clr L1
+jmp L16
+L24: lea L9, L9
+add 505, @r4
+m0
+cmp @r7, L16
+clr @r3
+sub -394, L12
+L25: not L9
+prn L11
+L26: mov L23, @r6
+add @r1, @r2
+sub -187, L10
+add L9, L20
+red L14
+L27: dec L18
+m3
+rts
+L28: jmp X0
+L29: cmp 325, @r1
+red @r6
+m2
+lea L22, @r7
+prn L11
+cmp @r1, -498
+add @r4, L24
+jmp @r0
+dec L6
+lea L2, L23
+add @r1, L16
+red L11
+mov L20, @r3
+red L23
+m2
+clr L12
+jmp @r7
+L30: jsr L27
+cmp @r3, S6
+add -82, @r3
+prn @r1
+rts
+add 232, @r7
+jmp @r4
+sub L24, L7
+jmp @r5
+not @r2
+cmp @r6, -73
+jmp @r5
+mov 124, L9
+L31: not L12
+clr L6
+red L16
+m1
+clr @r1
+dec @r2
+sub 234, @r7
+cmp @r4, -511
+dec @r3
+m3
+m3
+red @r7
+lea D0, @r7
+L32: inc @r1
+sub @r1, L32
+not L32
+clr L4
+L33: inc @r1
+lea L0, L24
+cmp L10, S6
+red @r0
+prn 343
+bne D0
+red @r3
+red D0
+mov 274, L30
+bne @r5
+m1
+not L30
+prn L9
+L34: mov @r3, L52
+lea L10, @r3
+prn -403
+not L8
+sub L11, @r5
+m3
+red L5
+inc L55
+L35: jmp @r3
+cmp L29, L57
+dec L18
+red L40
+m0
+m0
+L36: prn 4
+add @r7, @r1
+bne D0
+add -169, @r1
+m4
+L37: mov 57, L11
+inc L24
+sub L14, L18
+jmp L33
+cmp L16, 231
+L38: jmp D0
+lea L21, @r0
+sub D0, L36
+mov L14, @r0
+mov 420, @r6
+mov L6, L31
+lea L38, @r6
+jsr L15
+cmp 120, @r3
+m3
+m3
+clr @r3
+not @r2
+clr @r7
+bne L36
+L39: jmp S4
+bne @r0
+red L23
+jmp L7
+m3
+rts
+mov @r2, @r2
+dec L3
+L40: rts
+lea L6, @r5
+sub @r7, L7
+not L6
+L41: clr @r6
+inc S1
+jmp L42
+jmp @r1
+clr @r1
+L42: lea L19, X1
+add @r2, @r2
+dec @r7
+L43: add @r1, @r2
+clr @r2
+L44: prn L21
+add @r2, @r6
+cmp @r4, S1
+L45: prn @r5
+jmp @r6
+L46: rts
+dec L34
+L47: lea L7, L38
+bne @r5
+not @r5
+L48: inc L32
+jmp @r5
+not L46
+sub L36, L21
+bne @r5
+lea L34, L1
+rts
+add 348, L33
+not @r5
+lea L8, @r6
+jmp @r4
+jmp L36
+jmp @r7
+jsr L6
+not L21
+jmp @r0
+add @r3, @r6
+m3
+jsr D0
+jmp L31
+m1
+cmp L44, @r3
+lea L30, @r6
+m4
+add -320, @r7
+add @r6, @r0
+jmp L34
+L49: jsr L37
+bne L23
+bne D0
+rts
+m1
+lea L23, L8
+add L45, L19
+mov 91, L18
+red L58
+jsr L26
+clr L1
+add @r2, @r6
+not L41
+jsr L22
+lea L20, @r0
+prn 376
+red @r0
+jsr L8
+not L3
+sub 235, @r3
+inc @r3
+cmp D0, @r5
+L50: add -404, @r4
+inc @r4
+inc L33
+cmp L48, L7
+L51: jsr L11
+L52: mov L36, @r1
+bne @r4
+jsr L15
+prn @r4
+jsr @r5
+L53: bne @r4
+mov L25, @r5
+L54: red @r1
+inc L45
+lea L24, @r4
+rts
+not @r3
+lea L16, L56
+L55: cmp 6, @r3
+cmp X2, L34
+L56: red @r1
+dec L54
+rts
+add 443, L16
+m4
+L57: clr L8
+sub L23, @r4
+L58: prn S2
+rts
+red D0
+add 228, L10
+not @r5
+clr @r1
+lea D0, @r5
+mov L49, X3
+clr S4
+prn L33
+lea L14, @r3
+clr L59
+m0
+jsr L44
+bne @r1
+red @r7
+jsr X4
+prn L53
+L59: red S5
+rts
+stop
+D0: .data 404,-203,-247,-226,-295,176,-394,210,-332,214
+D1: .data -126,69,-185,-375,-90,-60,19,-463,-184,288
+D2: .data -4,351,-142,-460,390,324,227,97,-328,458
+D3: .data -471,182,336,-183,-89,-168,-189,442,-168,-105
+D4: .data 52,288,422,-249,-274,481,228,-216,-259,403
+D5: .data -133,-109,-6,110,-116,244,-429,-469,322,-448
+D6: .data -399,-15,20,-211,-474,195,447,-290,-110,-482
+D7: .data -343,295,-136,-488,-79,106,251,-14,-329,-163
+D8: .data -102,-388,414,416,-113,-490,419,348,3,-45
+D9: .data 297,217,119,130,388,212,104,499,491,182
+S0: .string "hjgaqgokjkolkailui"
+S1: .string "mneqwaf"
+S2: .string "tmtcuuvu"
+S3: .string "qfynsql"
+S4: .string "mhxtxenqmyxmdivh"
+S5: .string "cxmhfeuntgu"
+S6: .string "wdtkpfbdtpgvlgrxsmq"
+S7: .string "bntqypgdkstgkl"
+S8: .string "f"
+S9: .string "fxtydlwmhmghik"
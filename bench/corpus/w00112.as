@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r6
+    prn 70
+endmcro
+mcro m1
+    sub @r2, @r3
+    prn 45
+endmcro
+mcro m2
+    sub @r0, @r0
+    prn 88
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 12
+endmcro
+mcro m4
+    sub @r0, @r4
+    prn 55
+endmcro
+sub L0, L0
+prn @r4
+prn -436
+L0: clr @r3
+m1
+clr @r0
+clr L0
+m2
+prn -47
+sub 217, @r2
+red L0
+add @r5, @r3
+add @r4, @r3
+add @r5, L0
+lea L0, @r3
+jsr L0
+lea L0, @r3
+not L0
+sub @r3, L3
+sub L0, @r6
+m4
+prn 122
+m2
+clr @r3
+lea L0, @r2
+sub L0, L0
+mov @r1, @r1
+red @r4
+clr L0
+not L0
+prn L30
+bne X0
+jmp L0
+m2
+m0
+L1: rts
+mov L0, L1
+jmp L1
+bne @r7
+inc L1
+lea L1, @r1
+cmp -129, L16
+prn @r7
+m3
+lea L1, @r7
+jmp @r0
+dec L0
+sub L0, L0
+prn @r1
+red @r7
+prn L1
+cmp @r1, @r7
+L2: prn -69
+mov L1, L1
+red @r4
+L3: clr L15
+dec @r4
+cmp -433, @r7
+jsr @r4
+L4: red @r3
+sub -455, L3
+L5: add @r1, L24
+m0
+lea L1, @r2
+L6: add @r0, L1
+L7: red L4
+dec @r1
+jmp L6
+L8: cmp 200, @r3
+L9: sub @r3, @r6
+m0
+red @r1
+add L4, L7
+bne @r7
+not @r6
+not @r4
+L10: red @r6
+red @r7
+L11: sub @r6, @r4
+dec L6
+jmp L3
+L12: clr @r1
+rts
+prn -273
+L13: cmp -118, @r2
+mov @r1, @r7
+jmp L1
+cmp -334, @r3
+rts
+red @r4
+L14: inc L6
+L15: dec @r0
+add L4, @r7
+jmp @r4
+mov @r4, L34
+cmp 489, 324
+m0
+mov L5, @r0
+inc @r6
+m1
+jmp @r2
+m3
+prn @r0
+prn L3
+prn @r6
+lea L12, @r5
+m4
+bne L15
+m0
+red @r6
+m0
+cmp 191, 426
+jmp L2
+not L15
+sub @r0, L1
+dec @r7
+jmp @r0
+m1
+mov @r7, L5
+cmp @r0, L14
+L16: inc @r2
+not @r3
+cmp @r7, 387
+L17: add @r1, @r6
+jsr L2
+jsr L10
+clr @r5
+dec L14
+lea L17, @r7
+m3
+prn L0
+red L15
+dec L8
+dec L30
+L18: mov L12, @r6
+rts
+not L9
+inc @r2
+L19: rts
+jsr @r4
+jmp @r6
+L20: dec D0
+not L11
+prn -66
+bne L16
+lea L10, @r7
+rts
+cmp @r6, @r7
+not @r4
+dec @r0
+jsr @r2
+jsr L19
+red L19
+rts
+jsr L15
+L21: lea L4, L19
+jsr L7
+clr @r2
+bne L8
+L22: prn L12
+add -182, L5
+not L7
+L23: jsr @r4
+sub L13, S1
+inc L0
+cmp @r0, -189
+lea L15, L10
+inc L0
+clr L8
+not @r6
+L24: mov 83, L22
+rts
+dec @r3
+add @r6, @r3
+m0
+red L6
+L25: mov 217, @r3
+jmp L7
+cmp @r2, L0
+m4
+prn L20
+L26: cmp L14, @r5
+cmp @r2, L14
+prn -356
+jmp @r3
+red L13
+lea L5, L18
+m3
+clr @r3
+not L20
+rts
+m3
+jsr @r7
+dec @r2
+jsr L16
+L27: clr L22
+dec @r2
+L28: dec D0
+not L1
+L29: dec @r3
+mov @r6, L51
+jmp @r5
+L30: add -66, L3
+not L27
+jsr L23
+red L57
+dec @r3
+jsr @r3
+prn L24
+sub L23, @r2
+not L27
+dec @r5
+not L53
+not @r2
+dec @r0
+clr @r6
+dec L19
+red @r3
+prn L0
+sub @r2, L9
+sub L49, @r2
+L31: prn @r3
+clr @r7
+cmp L3, 23
+cmp -100, L36
+rts
+bne @r5
+not L19
+L32: jsr L51
+L33: prn L30
+cmp L9, 90
+L34: inc L2
+dec L2
+not @r2
+jsr @r1
+lea L32, L24
+not @r0
+red @r4
+red @r3
+rts
+lea L6, L15
+mov @r7, L36
+rts
+add @r2, L29
+dec @r0
+L35: jsr L16
+jsr @r6
+m0
+add S6, L49
+L36: mov -441, L53
+prn -125
+m4
+clr L4
+inc L1
+L37: dec @r7
+jsr @r3
+clr @r4
+red @r2
+add @r7, @r7
+clr @r2
+not @r2
+bne @r1
+jmp L18
+jmp @r7
+mov L2, L15
+add L11, L7
+inc @r5
+jsr L30
+m0
+clr @r2
+rts
+rts
+inc @r5
+bne L59
+m3
+sub @r0, L33
+cmp X1, L1
+sub L7, L1
+m2
+sub L2, S0
+mov 279, L18
+not @r1
+jsr @r6
+lea L22, L10
+lea L24, X2
+not L27
+m4
+L38: add @r3, @r2
+jsr L5
+m2
+mov L37, L32
+sub L1, @r7
+red L5
+prn @r5
+dec L55
+L39: red @r5
+mov 452, @r0
+inc L31
+m1
+cmp L14, S1
+inc @r6
+L40: jmp L13
+lea L28, L34
+mov @r7, L27
+clr @r1
+add L39, L19
+m1
+jsr L37
+rts
+inc @r3
+red @r0
+m3
+inc @r7
+L41: not @r4
+dec L16
+L42: clr L11
+lea L19, @r5
+jsr L3
+red L11
+lea L35, L19
+sub L6, @r2
+not X3
+L43: not @r1
+m4
+mov @r0, L21
+prn @r5
+L44: clr L55
+jmp @r1
+jsr D0
+clr @r7
+red @r7
+dec L41
+sub @r7, L25
+inc L9
+m2
+L45: jsr L47
+mov @r1, L4
+dec @r2
+L46: dec L51
+rts
+L47: inc @r5
+jmp L37
+clr L9
+L48: mov D0, S7
+mov 180, S7
+inc @r6
+L49: prn 197
+bne L16
+clr L4
+cmp L6, @r3
+not @r3
+L50: mov -67, L28
+prn @r6
+L51: red L3
+bne L43
+cmp 225, @r1
+L52: rts
+prn @r7
+rts
+jsr L36
+bne @r3
+add -509, L20
+prn -289
+add L5, L32
+prn L57
+jmp L32
+sub 380, @r1
+prn @r2
+inc @r3
+jsr L43
+dec @r4
+cmp L20, -260
+sub 135, @r7
+jmp L52
+lea L48, @r0
+red @r6
+add L55, L28
+bne L1
+L53: clr @r2
+m0
+jmp L29
+m4
+not @r3
+red @r7
+not @r5
+add L51, @r6
+sub L1, @r3
+bne @r4
+mov L34, @r0
+jsr @r2
+m4
+inc L58
+m1
+dec @r5
+m1
+sub L3, @r1
+L54: add L51, @r1
+add L53, @r6
+mov @r1, @r4
+mov 392, @r2
+prn L29
+bne L32
+jsr @r3
+add L58, X4
+jmp L24
+inc L35
+L55: not D0
+jsr @r4
+lea L7, @r4
+clr @r2
+prn 158
+clr @r0
+mov @r7, @r7
+m3
+sub -160, D0
+L56: jsr @r4
+bne D0
+dec L1
+inc L22
+jsr @r7
+add 225, @r3
+prn L29
+inc @r5
+L57: mov L3, L8
+add @r2, @r4
+dec @r1
+bne L5
+mov @r7, @r0
+rts
+inc @r4
+L58: red @r3
+rts
+sub -144, @r0
+jmp L12
+m4
+L59: dec @r3
+clr S4
+inc L34
+red @r2
+mov S7, @r1
+stop
+D0: .data 444,15,445,-163,-254,-74,-124,-450,49,463
+D1: .data 27,-462,-345,159,-439,253,273,99,-26,-243
+D2: .data -270,175,235,-20,-355,-35,-465,253,142,460
+D3: .data 140,-329,489,-157,287,-402,69,83,-224,480
+D4: .data 102,277,150,-69,21,405,498,-70,-266,108
+D5: .data -436,241,-419,-268,-46,404,-417,437,-467,-322
+D6: .data -390,-416,359,51,-412,-208,-335,187,-58,-314
+D7: .data -309,41,-19,30,-18,96,-269,-481,193,338
+D8: .data 418,55,-435,308,381,465,-238,-491,294,-265
+D9: .data -140,-237,289,-219,480,-414,281,181,201,387
+S0: .string "yohhhlxgkztfvlxqknyg"
+S1: .string "sorqvvhwsxawurprtq"
+S2: .string "bkvwjwtekxxzr"
+S3: .string "dcafxiv"
+S4: .string "inukejhweidaz"
+S5: .string "tcmassimggdjzg"
+S6: .string "bfzezplbp"
+S7: .string "ahtjgkuhykafjhtsnzma"
+S8: .string "iyeryausgufyf"
+S9: .string "dbhrhpxwkucssggnjw"
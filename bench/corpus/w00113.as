@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r0
+    prn 40
+endmcro
+mcro m1
+    sub @r7, @r5
+    prn 43
+endmcro
+mcro m2
+    sub @r2, @r6
+    prn 54
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 88
+endmcro
+mcro m4
+    sub @r2, @r3
+    prn 79
+endmcro
+jmp L0
+prn 142
+red L0
+lea L0, @r4
+dec L0
+sub @r1, L0
+dec @r4
+m2
+mov -288, @r6
+not L0
+dec D0
+m4
+L0: rts
+bne L0
+jmp L0
+jsr L0
+m2
+lea L0, L0
+m4
+dec @r0
+cmp 45, S0
+prn L0
+inc @r2
+rts
+L1: mov L0, L0
+bne @r7
+jsr L1
+clr @r6
+cmp L1, @r1
+not @r1
+sub @r6, @r1
+lea L0, L1
+dec @r4
+add 168, @r3
+m1
+lea L0, @r1
+clr @r1
+sub @r0, @r4
+not @r2
+L2: cmp -298, 446
+rts
+jmp L1
+m0
+bne @r2
+dec @r0
+sub L0, @r5
+rts
+jsr L0
+mov L0, @r4
+prn @r3
+L3: cmp 145, L1
+red @r3
+prn @r4
+jmp @r1
+red @r1
+prn @r3
+inc L0
+L4: red @r1
+inc @r3
+m1
+prn 8
+inc @r0
+lea L2, @r7
+L5: red @r5
+L6: rts
+L7: bne @r0
+add 335, L2
+mov L6, L0
+rts
+inc @r7
+prn @r1
+clr @r4
+not L2
+red @r4
+add @r7, D0
+L8: sub L0, @r6
+jsr S5
+lea L2, @r3
+rts
+clr L8
+red @r2
+add L5, @r7
+bne L0
+red L2
+L9: lea L5, @r5
+dec @r5
+red L4
+rts
+clr L8
+add L8, @r0
+L10: lea L4, L0
+lea L9, @r7
+jsr @r5
+inc @r4
+rts
+mov @r3, @r6
+jsr @r5
+L11: sub @r2, L9
+lea L8, @r7
+L12: red @r3
+m1
+bne @r1
+not L6
+add 48, L6
+jsr L10
+m3
+L13: prn @r7
+L14: inc @r7
+inc @r2
+m4
+mov L14, @r5
+sub L11, L12
+L15: bne @r5
+clr L14
+add -243, @r7
+m4
+sub @r0, @r1
+clr @r4
+not L9
+inc L12
+add @r3, @r7
+mov -388, @r4
+prn @r0
+prn 141
+bne L0
+jmp @r6
+rts
+red L6
+mov L8, L14
+m3
+inc L11
+sub L6, L11
+bne L15
+m3
+m3
+L16: not @r4
+not @r3
+jsr L10
+cmp @r0, L8
+red L11
+clr L5
+add -341, @r7
+bne @r7
+m1
+L17: inc @r6
+jmp L11
+prn L14
+lea S7, @r3
+L18: lea L35, @r5
+L19: jmp L7
+lea L30, @r2
+bne @r1
+cmp L16, L10
+rts
+inc D0
+jsr @r4
+not L3
+prn L5
+mov 318, L0
+rts
+jmp L1
+rts
+lea L19, L16
+mov 256, @r7
+not @r6
+inc @r4
+L20: red D0
+jmp L14
+rts
+m4
+red L3
+L21: inc @r4
+cmp @r5, 362
+inc L5
+lea L19, L10
+rts
+L22: rts
+red @r5
+L23: jmp L10
+inc @r1
+mov @r6, L2
+rts
+not @r2
+bne @r3
+not @r1
+jmp L9
+bne @r0
+inc @r0
+inc @r6
+prn L13
+add -201, @r4
+jsr @r4
+add -299, @r4
+m0
+not @r6
+inc @r3
+jmp @r3
+clr L0
+add @r3, D0
+red L9
+rts
+mov @r3, L9
+lea S4, L1
+red S9
+cmp -277, -440
+L24: lea L10, L4
+m3
+inc @r1
+m3
+m2
+clr L7
+jsr L13
+L25: cmp @r7, @r5
+L26: sub L19, L10
+rts
+inc S7
+dec @r4
+L27: lea S0, L46
+bne L25
+dec @r3
+sub L18, @r1
+not @r4
+jmp L3
+mov @r3, @r6
+m2
+rts
+prn @r3
+L28: rts
+red L25
+prn @r4
+rts
+jmp L12
+jmp @r4
+sub L5, @r4
+m3
+mov @r1, @r3
+lea X0, @r1
+mov -206, L18
+dec @r2
+not @r5
+mov @r1, L20
+inc @r2
+add D0, L20
+L29: jmp @r4
+L30: inc @r6
+L31: not L13
+inc @r5
+mov L12, L34
+lea L9, X1
+L32: inc L32
+L33: dec L42
+mov L16, @r2
+bne @r4
+add 264, L8
+dec @r3
+L34: jmp @r4
+clr L26
+m3
+inc L19
+L35: inc @r1
+sub L9, L32
+dec @r0
+red L27
+not D0
+bne L11
+dec @r1
+sub L17, L11
+cmp L9, @r3
+dec @r3
+add L12, L32
+lea L10, L4
+clr @r5
+m1
+dec @r4
+rts
+cmp 484, 42
+sub L9, L17
+cmp 266, @r3
+bne @r2
+sub @r4, @r7
+sub -267, L12
+jmp L33
+jsr L5
+dec @r7
+jmp @r3
+m3
+cmp @r2, L28
+bne L1
+prn @r7
+cmp @r1, S9
+add @r4, @r6
+prn -83
+jmp L12
+red @r1
+rts
+inc @r7
+red @r1
+prn L47
+bne @r2
+m4
+not @r5
+jsr L29
+L36: not @r2
+L37: bne L30
+jsr @r4
+L38: not @r3
+m2
+cmp L57, @r7
+add L14, L22
+m1
+bne L37
+not @r2
+mov L47, L7
+rts
+add L27, @r4
+lea L30, L32
+clr @r7
+rts
+m0
+red @r4
+inc @r6
+m0
+clr @r4
+L39: sub 508, L20
+not L33
+bne @r3
+lea L33, L13
+L40: rts
+inc @r7
+cmp @r2, L2
+sub @r0, L39
+jsr L40
+inc L12
+jsr L33
+dec @r6
+sub @r6, @r3
+bne @r0
+mov L7, @r4
+lea L50, L26
+L41: rts
+m1
+red L40
+dec @r3
+lea L7, L35
+jmp @r1
+m1
+jmp @r3
+cmp L20, @r6
+lea L2, L0
+L42: clr L29
+m1
+lea L38, @r0
+sub @r4, @r6
+dec S9
+jsr L48
+add -416, @r6
+dec L41
+L43: jsr @r5
+rts
+red @r4
+sub S1, L11
+inc L55
+jsr @r4
+L44: bne L34
+L45: red @r4
+L46: bne @r3
+inc L9
+m2
+lea L8, @r3
+red @r3
+jmp L18
+L47: jsr X2
+sub @r5, S1
+L48: add L36, L23
+rts
+lea L34, L42
+L49: not @r6
+dec @r4
+clr @r7
+dec L39
+inc L34
+rts
+mov -7, @r7
+dec @r4
+dec L34
+L50: cmp @r5, L27
+bne L31
+L51: mov 488, L11
+lea L0, L1
+prn -298
+m3
+rts
+rts
+jmp L26
+m1
+sub @r0, L56
+inc L1
+not @r3
+mov L49, L47
+jmp L47
+L52: not @r0
+mov L59, D0
+L53: cmp @r2, 2
+m4
+rts
+red L25
+jmp @r5
+lea L24, @r5
+rts
+mov @r3, S0
+m1
+L54: mov @r0, @r4
+inc L9
+cmp -261, 291
+mov L5, @r3
+clr L20
+lea L48, @r3
+cmp L12, @r6
+red @r2
+red @r2
+L55: clr @r3
+red L46
+m0
+not @r7
+not @r0
+L56: jmp L42
+clr L58
+L57: bne L42
+sub 485, L59
+red @r1
+dec @r5
+m1
+jmp @r0
+dec L12
+bne X3
+jmp D0
+L58: jmp L59
+cmp S1, D0
+L59: lea X4, L9
+red D0
+stop
+D0: .data -460,115,-177,498,476,-389,-68,-72,-394,-329
+D1: .data -330,-304,-388,-90,177,-303,43,102,-75,-440
+D2: .data -75,311,-132,-101,323,154,330,401,-409,436
+D3: .data -141,-494,157,-338,328,-241,-304,288,412,288
+D4: .data 301,-482,180,65,442,221,145,96,-474,-495
+D5: .data -53,81,-483,149,-276,-153,-224,-127,-46,-157
+D6: .data 134,-344,160,-428,-318,196,-146,-281,201,229
+D7: .data -486,221,-253,-234,110,-422,-83,182,-450,101
+D8: .data 263,61,406,249,238,235,-216,126,455,364
+D9: .data -109,447,-197,-68,90,-134,-189,-370,462,-209
+S0: .string "nqonofwxngtltx"
+S1: .string "klyyqsguvsu"
+S2: .string "qkkpgcktzuko"
+S3: .string "iu"
+S4: .string "hvhdfxpaje"
+S5: .string "wkwxpvvc"
+S6: .string "bdxmzppqkitauigb"
+S7: .string "hct"
+S8: .string "izjkuyhqwcqsy"
+S9: .string "klzrfvazekjaydwilccc"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r3
+    prn 79
+endmcro
+mcro m1
+    sub @r3, @r6
+    prn 42
+endmcro
+mcro m2
+    sub @r4, @r4
+    prn 51
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 64
+endmcro
+mcro m4
+    sub @r4, @r1
+    prn 3
+endmcro
+inc @r1
+L0: cmp L56, -298
+L1: bne @r4
+jmp @r2
+inc @r3
+cmp L1, @r2
+lea L0, L0
+dec L0
+clr L1
+L2: rts
+add -283, @r6
+L3: not L2
+mov L0, L3
+clr @r0
+m4
+prn 318
+L4: sub @r3, L2
+red @r2
+sub @r6, @r6
+m4
+m4
+jmp L4
+L5: prn @r0
+m1
+lea L4, D0
+cmp -293, @r4
+m1
+dec @r6
+bne L5
+clr @r5
+red @r2
+dec @r2
+jmp L5
+inc L5
+prn @r1
+jsr @r1
+dec @r6
+rts
+dec L5
+dec @r3
+not L0
+m3
+bne @r1
+prn L3
+red L2
+cmp -250, @r1
+L6: cmp 307, -33
+mov @r2, L0
+clr L3
+rts
+inc @r2
+lea L1, @r5
+m2
+red L1
+jmp L6
+clr @r2
+jmp @r7
+prn L0
+prn @r4
+red L2
+dec L5
+m3
+lea L3, L4
+prn @r5
+inc @r3
+L7: prn -64
+prn L4
+L8: prn 507
+rts
+cmp 23, 316
+inc X0
+rts
+dec L0
+lea D0, L4
+dec L3
+dec L3
+jsr @r6
+L9: prn @r3
+sub L7, @r1
+red @r6
+add -477, X1
+jsr @r7
+jmp @r0
+lea L5, @r4
+sub @r3, L7
+cmp L6, @r3
+red @r4
+mov L5, @r0
+rts
+bne L1
+add -112, @r4
+m2
+not L4
+lea L7, @r2
+bne @r2
+rts
+jsr L7
+L10: clr @r1
+mov @r0, @r5
+L11: bne L0
+lea L9, @r3
+clr L3
+sub L11, @r2
+add 120, L0
+add 172, L11
+red @r6
+dec @r6
+mov L10, L4
+L12: jsr L4
+L13: clr L7
+dec @r4
+not L5
+m0
+inc L8
+m2
+jmp L8
+cmp @r5, L2
+not @r0
+rts
+not L11
+clr @r4
+add 301, L4
+m2
+m3
+m0
+red @r5
+rts
+red @r4
+rts
+cmp -155, -70
+cmp 390, @r3
+inc L8
+clr @r6
+bne L59
+m2
+L14: jsr L11
+sub 265, L43
+lea L0, L13
+m1
+jsr @r6
+sub @r3, L12
+lea L5, @r5
+clr @r0
+cmp L6, @r0
+clr L4
+inc @r1
+inc @r4
+L15: rts
+jsr @r4
+cmp L7, -95
+L16: lea L12, @r2
+inc L7
+L17: rts
+L18: dec L10
+clr @r4
+jmp @r6
+L19: mov -80, @r2
+mov L3, @r3
+prn -232
+L20: bne L17
+inc L36
+not @r0
+jmp @r4
+bne L1
+mov 375, L16
+not @r4
+lea D0, @r7
+inc @r2
+not @r4
+rts
+clr L7
+not @r5
+prn L19
+mov L5, @r7
+clr L8
+prn L6
+lea L13, L6
+m2
+jmp S7
+rts
+prn L4
+rts
+add L10, @r4
+clr @r4
+jsr L9
+L21: sub @r3, L15
+lea L19, L19
+bne @r4
+rts
+not L4
+rts
+prn L3
+L22: sub @r4, @r5
+add L15, L21
+clr @r6
+lea L20, @r7
+mov -53, L14
+clr @r4
+jsr @r2
+rts
+L23: rts
+L24: add @r6, @r6
+prn L0
+prn 268
+mov L8, L14
+prn L24
+jmp L57
+red L23
+cmp @r3, 484
+m2
+L25: cmp L4, @r4
+L26: jsr S5
+L27: jsr L20
+lea L0, @r3
+m2
+m1
+inc L19
+add L17, @r3
+mov 145, @r4
+cmp L2, -343
+L28: not @r2
+dec L26
+not L1
+sub @r3, L22
+dec D0
+bne @r0
+lea L2, L21
+L29: not L6
+not @r4
+sub @r3, @r3
+lea L3, L16
+dec L26
+jmp L39
+lea L27, L15
+L30: jmp @r4
+clr L7
+inc @r5
+sub 85, @r4
+mov 246, @r0
+cmp @r2, @r1
+clr @r5
+dec L1
+not @r2
+jsr L24
+m4
+clr @r7
+not @r1
+cmp L8, -334
+L31: add L58, L22
+m2
+m4
+inc @r1
+sub @r6, L0
+L32: clr @r5
+prn L57
+clr L31
+jsr @r1
+red L12
+red @r4
+L33: jmp L12
+jmp @r4
+dec @r7
+clr L8
+clr L0
+red @r6
+m4
+mov L54, L2
+inc @r0
+prn 39
+not L31
+jsr L19
+inc L4
+dec @r2
+cmp @r2, S3
+not L10
+L34: not D0
+jsr @r2
+lea L17, L6
+lea L17, @r1
+L35: sub @r0, L38
+mov 161, @r0
+sub L33, L32
+red @r2
+red L37
+clr @r6
+prn @r6
+not L1
+L36: not L21
+bne @r2
+rts
+m0
+L37: cmp 400, 103
+m0
+mov -506, L25
+jsr @r0
+m2
+cmp -361, 372
+not @r1
+rts
+clr @r0
+jmp L43
+prn 334
+mov -407, @r5
+not L30
+rts
+rts
+red @r1
+mov 111, L6
+L38: add -218, L26
+clr L28
+jsr L14
+bne @r5
+jsr @r1
+rts
+m1
+dec L38
+jsr L9
+jmp @r0
+mov 98, @r0
+bne @r4
+cmp -299, 8
+rts
+add L6, L29
+sub @r0, L25
+lea S2, @r4
+L39: jmp L36
+clr L21
+dec @r0
+jmp L24
+L40: clr L11
+prn @r7
+m2
+red L19
+bne @r4
+inc @r0
+inc L20
+m4
+m0
+m0
+m0
+sub L28, @r7
+red L15
+dec @r3
+dec L52
+m2
+bne D0
+jmp L18
+jsr @r4
+prn X2
+not L14
+sub L21, L36
+L41: add @r3, L40
+m1
+sub 46, L0
+rts
+add 7, @r7
+lea L47, L8
+L42: jsr L52
+add -354, @r1
+L43: prn L23
+L44: mov @r4, L19
+dec L12
+L45: rts
+jsr @r1
+add 408, L17
+jmp @r6
+L46: jmp L14
+m2
+sub @r2, L58
+jsr L25
+sub L9, X3
+L47: inc @r7
+not @r6
+jmp L17
+bne @r3
+bne @r4
+dec L23
+clr L36
+prn -273
+L48: sub L36, @r6
+clr L22
+sub L16, S3
+cmp -507, @r0
+prn @r4
+dec @r7
+jsr @r7
+sub @r7, L37
+lea L15, @r2
+m1
+lea L5, @r7
+L49: red L22
+inc @r3
+L50: red @r7
+inc L51
+L51: red @r7
+L52: rts
+lea L50, @r1
+red L2
+inc @r2
+rts
+jsr @r2
+add L2, L39
+bne @r6
+dec @r4
+L53: inc @r1
+lea L22, S4
+lea X4, @r3
+m2
+cmp -206, L11
+L54: not L20
+L55: bne L14
+cmp 498, -364
+inc @r3
+jsr L18
+clr @r7
+bne @r7
+red @r2
+L56: jsr @r4
+m1
+L57: prn @r6
+clr @r3
+bne @r3
+jsr S1
+cmp L25, @r7
+rts
+bne @r2
+bne L59
+clr @r4
+L58: inc D0
+bne L16
+jmp @r1
+jsr L59
+red @r7
+cmp S6, L59
+prn L59
+clr S3
+m3
+L59: rts
+jmp S0
+dec S5
+stop
+D0: .data 63,-29,-31,-104,464,96,-453,39,492,335
+D1: .data -187,155,-296,221,-181,-226,-301,-170,-234,30
+D2: .data -14,275,-88,-279,-432,-37,-416,-400,-377,-427
+D3: .data 283,442,-178,-143,-475,-459,153,205,-164,-160
+D4: .data 465,12,92,349,-86,433,186,287,386,-119
+D5: .data -22,482,-214,3,34,236,86,438,39,-393
+D6: .data 56,-370,-229,434,153,-226,50,87,31,-356
+D7: .data 420,-175,16,-183,30,249,196,500,45,308
+D8: .data 234,413,-190,420,-157,-285,-287,-15,-202,324
+D9: .data -89,-395,-102,252,-474,8,38,-4,339,486
+S0: .string "z"
+S1: .string "kdnswcbnp"
+S2: .string "dlfrqbbsvk"
+S3: .string "zzcnsxkuemco"
+S4: .string "ppoipniijkqefh"
+S5: .string "klumybpfbhnppq"
+S6: .string "xackblkfgkwgydc"
+S7: .string "uqwaoikpgx"
+S8: .string "jjygxiirlmkusunakiyu"
+S9: .string "kt"
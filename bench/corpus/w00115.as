@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r5
+    prn 49
+endmcro
+mcro m1
+    sub @r7, @r7
+    prn 40
+endmcro
+mcro m2
+    sub @r7, @r2
+    prn 16
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 41
+endmcro
+mcro m4
+    sub @r6, @r7
+    prn 28
+endmcro
+jsr L0
+red @r5
+cmp @r1, L0
+prn @r7
+not @r0
+add L0, L0
+inc L0
+prn 41
+red L0
+mov 411, @r6
+dec @r6
+add -174, @r3
+prn L0
+mov L0, L0
+lea L0, @r0
+inc L0
+bne @r3
+red L0
+dec @r7
+not @r7
+sub L0, @r0
+clr @r0
+L0: cmp 368, L0
+m2
+clr L0
+prn 258
+dec L0
+cmp L0, @r0
+jmp L0
+cmp 325, -215
+rts
+bne L0
+not @r5
+L1: cmp 158, @r4
+dec @r7
+dec @r3
+L2: rts
+dec @r5
+L3: jmp @r4
+dec @r3
+jmp @r0
+L4: prn L4
+jsr @r5
+add -11, L2
+L5: red L1
+L6: lea L6, L5
+jmp L6
+prn 317
+m2
+prn @r7
+m3
+rts
+lea L6, @r7
+red L4
+cmp -336, L41
+lea L6, L5
+L7: not @r1
+red @r5
+jsr @r2
+lea L2, L7
+red @r0
+dec L0
+add L6, @r5
+jsr L1
+rts
+cmp L7, L6
+L8: inc @r5
+m4
+jsr L8
+L9: mov L2, @r3
+not @r4
+L10: prn 21
+clr @r5
+sub L1, L7
+jsr @r3
+bne D0
+clr @r7
+cmp L3, 406
+prn @r4
+m2
+not @r7
+jmp @r2
+red L5
+dec L3
+bne @r1
+cmp L8, 98
+m4
+add -493, L2
+prn @r3
+not @r6
+not L4
+m1
+prn L9
+jsr @r7
+clr D0
+jsr L7
+mov L7, @r1
+m4
+add 208, L6
+red L18
+mov @r4, L10
+not L8
+mov L10, @r1
+rts
+bne @r3
+red @r5
+rts
+lea L0, L0
+inc L10
+bne L34
+lea L3, @r2
+m3
+add 364, @r5
+bne @r0
+m2
+bne L6
+add 69, L2
+add @r3, @r4
+bne L1
+sub 82, @r1
+add 108, L5
+sub @r5, @r6
+m3
+jmp @r5
+mov L3, @r6
+cmp L6, @r3
+L11: inc L4
+inc L11
+jsr @r1
+not L1
+jmp L0
+L12: mov @r1, @r4
+L13: inc L7
+jsr X0
+prn @r4
+L14: cmp -248, @r0
+L15: prn @r5
+clr L11
+rts
+bne L12
+inc @r0
+L16: clr L1
+prn 5
+red @r2
+mov @r1, @r0
+cmp L14, L14
+clr L5
+dec @r7
+m4
+m2
+jmp @r0
+sub -494, L14
+rts
+m1
+bne @r3
+mov L3, @r1
+L17: jsr L3
+add L0, @r3
+bne L12
+L18: prn -229
+L19: jsr X1
+lea S9, @r7
+cmp L7, @r0
+rts
+jsr L10
+m1
+jmp L5
+prn @r6
+prn @r2
+sub L2, @r3
+lea L2, @r3
+jmp L18
+jsr L40
+mov L49, L6
+lea L15, L14
+clr @r7
+bne L5
+rts
+add L14, L12
+lea L2, @r6
+red @r5
+jmp @r5
+L20: bne L16
+m4
+bne @r4
+red L15
+dec @r3
+prn @r7
+cmp @r1, @r2
+inc L18
+lea L6, L2
+sub S4, L13
+m2
+L21: mov 351, L14
+rts
+cmp L6, 353
+red L9
+sub L5, @r0
+jsr L16
+add L13, L19
+red L2
+L22: add @r7, L22
+red L11
+lea L0, L17
+rts
+lea L1, @r1
+prn @r7
+lea L6, S2
+rts
+prn L8
+dec L13
+m4
+m1
+m2
+L23: prn L20
+L24: dec @r7
+cmp L18, -422
+L25: dec L9
+bne @r6
+lea L17, @r6
+m0
+cmp -110, -438
+L26: clr @r0
+mov L13, L21
+L27: mov 331, L43
+lea L16, @r4
+rts
+lea L24, L4
+L28: cmp 473, @r3
+sub 382, L21
+cmp 455, L3
+L29: not @r7
+sub L11, @r2
+jsr L15
+not L4
+not L7
+lea L11, @r5
+mov 12, @r7
+m4
+not @r7
+not L27
+bne L12
+add 21, @r4
+mov -315, @r4
+lea L25, L20
+L30: cmp @r5, L6
+mov L6, @r1
+m3
+L31: cmp @r2, -46
+cmp -445, -9
+L32: red @r7
+add D0, L3
+mov 30, L21
+clr @r5
+m1
+prn L30
+not L17
+L33: not L11
+cmp 506, -145
+sub -117, @r3
+jmp L8
+mov @r5, @r3
+prn @r3
+dec L26
+sub 336, L37
+lea L22, @r7
+rts
+clr L14
+L34: clr L30
+L35: clr @r7
+add L28, @r1
+sub @r7, @r6
+dec L9
+add L53, @r5
+bne @r6
+lea L0, @r2
+dec @r1
+lea L4, @r0
+clr L18
+jsr D0
+dec L18
+m0
+dec @r0
+L36: not @r4
+bne L5
+add -299, L1
+lea L3, @r1
+L37: inc @r0
+m3
+jmp @r6
+add L4, @r1
+sub -421, @r7
+add S7, L17
+clr @r3
+prn @r4
+not @r5
+prn L49
+sub 458, L36
+bne L29
+sub @r7, @r4
+jsr L16
+clr @r6
+red L51
+red L12
+not L24
+lea L14, @r3
+clr L24
+rts
+cmp @r1, -272
+jmp L35
+not L27
+m3
+lea X2, @r2
+red L21
+red @r7
+bne L30
+m0
+not @r5
+jmp @r5
+jsr @r4
+m1
+L38: cmp @r7, L12
+lea L21, @r2
+mov L4, L19
+cmp @r2, @r6
+clr L9
+rts
+sub 270, L37
+not @r7
+add L29, @r0
+lea L59, L34
+lea L29, @r0
+jmp @r4
+rts
+inc L14
+bne S0
+lea L8, L57
+clr D0
+dec L32
+prn @r6
+L39: add @r3, X3
+mov @r5, L17
+not L30
+L40: inc S2
+clr @r5
+inc L29
+not @r1
+jmp L16
+bne @r2
+cmp @r2, -300
+jmp @r0
+dec L39
+add @r4, @r4
+dec L20
+m3
+prn 407
+m2
+L41: prn L17
+mov @r6, @r1
+red @r6
+mov S8, @r2
+not L36
+cmp -144, L2
+L42: not @r2
+L43: prn @r0
+lea L24, L19
+bne L33
+rts
+L44: sub @r7, @r2
+L45: inc D0
+inc L15
+L46: mov L23, L15
+m3
+prn -437
+prn @r7
+inc @r3
+cmp @r6, -380
+bne @r3
+jsr L28
+L47: sub @r5, @r0
+L48: sub L22, @r6
+L49: rts
+prn @r3
+not L24
+not L23
+L50: jsr L39
+dec @r5
+L51: inc @r3
+L52: inc @r5
+dec @r7
+L53: bne L19
+cmp -255, @r1
+not L57
+not @r5
+m1
+m4
+L54: not @r7
+lea L14, @r1
+sub D0, D0
+clr @r0
+sub @r2, L11
+jsr @r7
+bne L12
+red @r5
+m1
+prn @r5
+inc L12
+m2
+clr D0
+dec L42
+m0
+bne L20
+sub L1, @r5
+L55: red @r6
+L56: clr @r3
+clr L4
+sub S5, @r6
+m0
+jmp @r6
+m1
+L57: sub -123, L59
+bne @r4
+sub S6, @r1
+dec @r4
+jsr X4
+m0
+prn 35
+not D0
+mov 335, @r2
+jmp L58
+jsr @r3
+rts
+L58: clr @r6
+mov @r0, @r4
+mov D0, S5
+inc @r4
+clr S6
+L59: not D0
+sub D0, @r7
+dec S0
+stop
+D0: .data 298,-229,76,24,230,-374,358,341,-432,-176
+D1: .data -499,-146,-490,176,-140,-481,359,63,-248,-427
+D2: .data 350,-153,-479,-127,-87,-182,396,-56,-89,252
+D3: .data 497,493,-394,-46,-351,491,317,74,-314,48
+D4: .data 96,-257,-437,488,-441,-40,-120,161,-121,176
+D5: .data -296,-301,312,396,-183,-268,465,-89,160,-430
+D6: .data 391,469,146,391,-187,24,-375,461,384,302
+D7: .data 183,-156,467,-376,-427,-209,191,-434,279,210
+D8: .data 126,-113,489,280,-270,327,-76,-151,-399,494
+D9: .data -360,313,186,41,-133,252,-117,208,19,406
+S0: .string "ebatchjclufclxyoxltl"
+S1: .string "uoluznwqoykgn"
+S2: .string "uccpqsxfgkpdmtujv"
+S3: .string "ghtceloovuy"
+S4: .string "zlnu"
+S5: .string "uadpqbr"
+S6: .string "nydicxllb"
+S7: .string "uxptinorijn"
+S8: .string "msibbq"
+S9: .string "xcejwsgjk"
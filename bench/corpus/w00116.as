@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r0
+    prn 87
+endmcro
+mcro m1
+    sub @r4, @r0
+    prn 39
+endmcro
+mcro m2
+    sub @r1, @r0
+    prn 82
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 17
+endmcro
+mcro m4
+    sub @r0, @r5
+    prn 52
+endmcro
+sub -40, @r2
+not @r1
+m2
+cmp @r6, D0
+L0: prn @r5
+inc @r2
+cmp @r5, L0
+dec @r1
+L1: cmp 218, @r1
+dec @r2
+jmp L0
+mov -466, L0
+m4
+not @r3
+L2: rts
+jmp @r1
+L3: sub S8, L1
+cmp 191, @r5
+sub @r0, @r7
+jmp @r1
+dec L3
+red S0
+dec L3
+mov @r4, @r7
+rts
+L4: bne L0
+inc @r1
+prn -284
+rts
+m3
+rts
+add -366, L1
+red L4
+inc @r5
+add L3, L1
+sub L1, @r7
+L5: dec @r2
+sub @r2, L0
+red @r7
+jsr @r1
+add @r3, L4
+sub -2, @r7
+lea L1, @r3
+cmp L5, 18
+m1
+dec L4
+add 494, @r7
+not @r2
+cmp 58, L4
+L6: jsr L1
+bne @r2
+m2
+sub L5, @r2
+sub -456, @r0
+bne L6
+sub L4, L5
+prn @r7
+sub L2, @r0
+sub -43, @r7
+sub L3, @r7
+jmp L4
+lea L27, D0
+clr L0
+L7: jmp @r0
+add 265, L6
+sub L5, L7
+inc @r7
+add L6, L4
+m3
+m2
+rts
+inc L4
+dec L3
+jmp L7
+prn 266
+rts
+inc L3
+m0
+m0
+not @r5
+m1
+L8: sub -27, L6
+clr @r3
+red L6
+red @r0
+inc L14
+clr L0
+jmp L8
+L9: inc L8
+m2
+rts
+L10: prn 168
+add L10, L9
+jsr @r1
+dec @r2
+mov 157, @r1
+m1
+dec @r5
+L11: add D0, @r3
+m3
+red S6
+L12: jsr @r5
+inc @r7
+cmp @r0, 97
+sub L6, @r7
+rts
+m2
+lea L1, L0
+m4
+prn @r5
+bne @r0
+cmp @r1, -189
+jsr @r5
+L13: not L10
+cmp 389, L12
+cmp 60, @r5
+clr @r1
+lea L5, @r7
+lea L13, @r5
+cmp @r7, -295
+cmp @r6, L37
+dec L7
+red @r3
+L14: not @r1
+not L13
+L15: rts
+rts
+sub @r7, @r2
+bne @r4
+mov @r1, @r1
+m3
+jmp L12
+bne @r2
+inc L13
+L16: clr L6
+sub L8, @r0
+jmp L0
+m0
+mov 46, @r0
+lea L4, @r4
+m4
+jmp @r6
+bne @r7
+inc @r2
+lea L17, @r1
+L17: jmp L12
+clr @r4
+dec L2
+dec L0
+add @r1, L1
+sub @r0, @r3
+bne @r3
+dec @r7
+m2
+cmp 253, -421
+sub @r3, L16
+m0
+red L2
+not L30
+L18: cmp @r2, X0
+cmp @r6, L11
+inc L10
+red @r5
+L19: prn L1
+lea L5, L11
+rts
+clr L11
+mov L7, @r3
+L20: rts
+rts
+m2
+add @r5, @r6
+bne L12
+sub L1, L7
+L21: red @r0
+not @r6
+clr @r2
+m0
+prn L1
+jsr @r0
+jsr L10
+mov L21, @r1
+jsr L20
+L22: jsr L59
+L23: red L11
+red @r1
+rts
+bne @r6
+rts
+sub @r4, @r5
+dec @r0
+L24: inc @r5
+clr @r0
+cmp L1, -243
+mov -336, L2
+cmp 413, @r4
+sub -161, L22
+prn @r5
+inc @r2
+m2
+m3
+add @r7, @r5
+jmp @r5
+m1
+jmp L24
+m4
+red L22
+bne @r0
+dec @r3
+L25: bne @r6
+m4
+jsr L6
+red @r6
+cmp @r5, @r7
+prn @r2
+sub L5, L25
+sub L8, L25
+dec L18
+mov @r5, S2
+not @r5
+m3
+red L2
+red L31
+mov @r2, @r6
+jsr S8
+jmp L23
+mov L13, L21
+m1
+jsr @r7
+rts
+add L16, @r2
+clr L18
+L26: sub @r4, @r2
+sub L24, L26
+clr @r2
+m0
+lea L0, @r4
+bne L22
+prn @r5
+clr L24
+jmp L2
+L27: dec @r6
+add -311, L11
+not @r5
+mov L19, L17
+jmp @r5
+prn L53
+L28: dec L13
+clr L34
+dec @r4
+L29: dec L18
+jsr @r4
+dec @r7
+m1
+not D0
+dec @r5
+jsr L9
+sub 412, @r2
+add -129, S9
+L30: jmp @r5
+lea L24, @r2
+L31: dec @r7
+L32: jmp @r2
+L33: red @r2
+jmp @r4
+clr @r4
+not L10
+cmp D0, @r6
+mov -503, L15
+L34: cmp @r3, L20
+L35: clr @r7
+not @r7
+jmp @r0
+clr @r4
+mov @r7, L20
+L36: inc S4
+dec L4
+L37: red D0
+prn L43
+clr @r2
+sub -41, @r6
+prn 41
+sub 407, @r0
+prn -374
+mov @r4, @r6
+not L37
+prn 273
+dec @r4
+jsr @r5
+jsr L36
+not L15
+lea L5, @r0
+cmp -296, 358
+mov @r5, L12
+bne @r3
+jsr @r1
+cmp @r4, @r0
+bne @r7
+rts
+red @r0
+inc @r5
+inc L30
+mov -302, @r3
+L38: sub @r1, L10
+jsr D0
+rts
+add L15, @r2
+jmp @r0
+cmp -81, L2
+L39: prn S3
+m0
+cmp L20, -190
+not @r4
+prn L38
+red @r6
+mov @r1, @r1
+red L58
+dec @r6
+m2
+clr @r5
+L40: mov @r2, @r4
+dec L27
+add -379, L32
+rts
+not @r2
+mov @r1, @r6
+mov @r1, @r3
+prn @r1
+L41: add 259, @r6
+jmp @r4
+cmp L13, @r4
+L42: add @r2, L36
+sub -141, @r6
+bne L24
+red L38
+sub 218, L35
+L43: red L42
+cmp @r0, @r5
+dec L28
+jsr L16
+sub L29, @r6
+inc @r6
+prn -236
+clr @r3
+not L27
+cmp @r6, @r0
+bne X1
+cmp -507, -308
+dec @r6
+m0
+jsr L9
+sub L19, @r7
+m3
+rts
+clr L43
+dec L40
+jmp @r4
+L44: rts
+L45: red @r3
+m1
+cmp L36, 88
+clr @r2
+not @r3
+inc L54
+prn L13
+add 72, @r3
+prn @r7
+L46: clr L5
+cmp -474, @r0
+L47: prn L37
+L48: jmp @r2
+not @r6
+prn @r6
+L49: mov 284, L12
+bne @r6
+not S5
+m3
+dec @r6
+m0
+dec L50
+sub 33, L51
+m3
+lea L33, L7
+bne @r6
+sub -20, L56
+clr L36
+L50: dec @r4
+bne @r0
+rts
+lea L29, @r6
+L51: bne @r3
+not @r2
+mov S8, L26
+L52: jmp @r0
+L53: not @r6
+clr @r4
+jsr @r4
+sub L58, S5
+dec @r2
+mov @r2, S0
+m1
+L54: dec D0
+cmp -461, -26
+dec L24
+prn L12
+rts
+cmp L45, -205
+lea L25, @r3
+prn L58
+mov @r2, L13
+L55: sub @r5, X2
+rts
+mov @r6, @r3
+bne L10
+L56: rts
+jmp L0
+lea L52, L6
+jsr @r1
+L57: rts
+red @r7
+rts
+clr L27
+clr L24
+inc @r5
+L58: inc X3
+not @r1
+lea X4, S5
+bne @r4
+mov -300, @r6
+not @r4
+lea L57, @r3
+inc @r7
+cmp L56, @r5
+prn @r5
+L59: not @r2
+inc S6
+cmp -202, @r1
+sub 298, L15
+dec @r0
+prn S6
+stop
+D0: .data 1,-126,54,33,-277,194,-151,217,289,-150
+D1: .data 414,-213,-385,251,290,-270,481,404,-437,18
+D2: .data -371,377,424,367,-48,-388,-325,-29,54,354
+D3: .data 492,114,5,-278,222,-430,65,-83,134,352
+D4: .data -79,166,72,-212,421,-390,-495,-377,-10,-391
+D5: .data 93,-33,283,331,-347,425,167,-265,-48,338
+D6: .data 197,-379,182,-62,-141,95,-266,361,-481,-179
+D7: .data 297,-35,-276,245,-266,-474,165,-86,233,4
+D8: .data 213,148,-13,-154,-99,229,49,348,-80,-142
+D9: .data 401,344,-148,162,464,101,473,8,421,214
+S0: .string "juwraz"
+S1: .string "gxpybczfieexrvwznraz"
+S2: .string "knlnlxfdh"
+S3: .string "mexfyqqq"
+S4: .string "nlzpn"
+S5: .string "ojopjdmvgfbrytowiy"
+S6: .string "pa"
+S7: .string "laphranbxryxptko"
+S8: .string "eyjhtdswl"
+S9: .string "rnzboquyfoeya"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r3
+    prn 58
+endmcro
+mcro m1
+    sub @r0, @r2
+    prn 37
+endmcro
+mcro m2
+    sub @r3, @r5
+    prn 47
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 61
+endmcro
+mcro m4
+    sub @r2, @r3
+    prn 77
+endmcro
+jmp L0
+L0: bne L0
+rts
+rts
+inc L50
+dec L0
+m3
+sub -132, L0
+sub -358, L0
+mov -268, @r4
+lea D0, L0
+L1: jsr @r1
+prn -228
+mov L10, S9
+lea L1, @r3
+mov L1, L1
+lea L0, @r2
+not L0
+L2: jsr @r2
+clr L0
+sub 187, L1
+not L2
+inc L2
+inc L1
+L3: not @r5
+inc L0
+rts
+L4: dec L3
+red @r6
+dec @r5
+m3
+jmp @r0
+jsr L2
+dec @r3
+red @r3
+bne L3
+add L3, @r2
+sub @r2, L3
+mov @r2, @r6
+L5: lea L5, L2
+bne @r6
+prn L4
+red @r3
+lea L3, @r6
+not L4
+mov @r7, L0
+inc @r5
+L6: red @r0
+jsr @r7
+m4
+not @r3
+red @r1
+L7: prn -10
+not L5
+L8: jsr @r3
+jmp L7
+m2
+clr L8
+m3
+dec @r6
+m1
+mov @r5, @r0
+m2
+add -143, @r3
+mov @r2, L3
+bne L1
+prn L4
+clr L8
+clr @r3
+L9: cmp L4, L2
+sub @r5, @r1
+m0
+red @r7
+jsr @r4
+rts
+m1
+add L7, L22
+L10: add @r1, L4
+sub 454, L0
+L11: inc L2
+bne @r3
+m1
+lea L10, L7
+cmp 140, 11
+add 219, L7
+lea D0, L7
+jsr @r0
+cmp -435, @r3
+red @r5
+dec L7
+cmp @r2, L0
+clr L11
+L12: cmp @r1, -179
+inc L5
+cmp @r3, -31
+sub @r2, L1
+jmp @r4
+lea L10, @r6
+not L8
+not @r0
+jmp @r6
+bne @r6
+mov @r1, @r3
+m1
+inc L3
+jmp @r7
+not @r3
+mov -90, @r3
+bne @r2
+jmp L6
+red @r5
+jsr L8
+cmp 34, @r5
+jsr L11
+m1
+not L1
+L13: red L7
+lea L1, @r0
+rts
+L14: not L12
+red @r1
+prn L12
+sub @r6, L8
+dec @r5
+m3
+L15: prn -272
+sub L2, L2
+L16: red @r6
+lea L1, @r6
+cmp @r2, X0
+clr @r3
+lea L1, L3
+lea L6, L14
+sub @r6, L4
+L17: add @r5, @r4
+jmp @r3
+not L4
+jmp @r1
+cmp L3, @r4
+lea L13, L15
+rts
+inc @r5
+L18: red @r6
+add @r2, @r7
+inc L14
+L19: jmp L1
+not L14
+prn L9
+rts
+L20: rts
+L21: jsr @r4
+dec @r7
+rts
+jmp L19
+red @r7
+rts
+rts
+clr L56
+inc L0
+jsr @r4
+not L4
+jmp L12
+not L28
+cmp @r0, 53
+not @r2
+mov @r2, @r5
+m4
+lea L12, @r0
+prn L2
+m1
+L22: not @r7
+L23: not @r6
+cmp L39, L23
+prn -270
+sub L28, L13
+m4
+L24: clr L5
+rts
+m0
+m0
+jsr @r1
+m1
+dec @r1
+sub 163, L51
+cmp L8, L13
+red L8
+lea L14, L22
+add @r5, @r1
+inc @r6
+m2
+red @r6
+L25: prn -54
+sub L4, L4
+add L11, @r1
+cmp 220, L28
+red @r1
+add L23, S8
+L26: dec L19
+L27: rts
+sub L15, @r4
+sub -104, L15
+sub L14, @r4
+dec L18
+L28: inc X1
+L29: clr @r0
+sub @r5, L25
+rts
+L30: jsr @r7
+mov L19, L28
+prn L9
+prn L30
+m2
+m2
+m1
+clr @r3
+red @r6
+dec @r1
+prn -331
+not L3
+L31: dec L15
+sub @r1, @r1
+lea L1, @r7
+jmp L21
+cmp @r1, -318
+lea L29, @r6
+inc L57
+L32: add L3, @r4
+mov L11, L35
+L33: inc L4
+mov L24, L28
+L34: prn -41
+add @r1, @r2
+bne D0
+rts
+red L14
+sub -173, L30
+cmp 266, -89
+cmp @r7, @r5
+not @r4
+inc @r2
+sub @r3, @r3
+inc L23
+L35: dec @r2
+bne @r6
+lea L31, L0
+lea L10, @r6
+bne @r6
+add -403, L5
+L36: mov L30, X2
+prn 351
+m3
+red L16
+jsr L36
+m4
+not @r5
+lea S1, @r0
+red L31
+inc @r0
+rts
+mov -279, L18
+cmp 452, @r6
+clr L31
+L37: jmp @r3
+m4
+mov @r2, @r2
+rts
+prn 28
+lea L13, @r3
+clr L18
+clr @r1
+red L31
+prn @r4
+add -230, L59
+m3
+not @r3
+add -301, L2
+sub L20, L14
+bne L6
+sub L35, S0
+L38: rts
+jmp L19
+m4
+lea L22, @r4
+rts
+jmp L8
+L39: lea L42, L19
+clr L13
+cmp L23, L26
+rts
+jsr @r4
+prn 9
+jsr @r6
+red L7
+inc @r6
+clr @r1
+L40: jmp L20
+jmp @r7
+clr @r1
+not L0
+mov 239, @r2
+dec @r3
+sub @r2, @r1
+jmp @r2
+m1
+lea L24, L30
+cmp 25, L1
+dec @r3
+mov -267, @r3
+not @r0
+prn @r1
+add @r5, L13
+clr L17
+L41: jmp L20
+m2
+mov D0, S4
+rts
+jsr L34
+cmp @r0, S8
+add -162, L11
+bne L10
+rts
+jmp D0
+not L37
+inc @r5
+red L36
+not L35
+cmp @r2, -347
+mov @r6, @r2
+rts
+m3
+jsr @r7
+bne @r3
+bne @r2
+red @r1
+dec @r6
+L42: dec L52
+sub @r1, @r6
+add @r0, L30
+jsr D0
+sub D0, L23
+jsr L5
+dec D0
+dec @r1
+prn 180
+cmp 441, 487
+jmp @r5
+rts
+mov @r7, @r7
+inc S7
+bne L22
+L43: bne L2
+m3
+clr L21
+L44: mov @r0, @r5
+add -430, @r7
+bne @r0
+inc @r4
+m1
+m4
+L45: not @r4
+prn @r6
+L46: mov L3, @r6
+bne @r5
+L47: lea L9, @r6
+rts
+add D0, L31
+m4
+not @r7
+add @r4, L5
+bne @r4
+rts
+dec @r6
+L48: sub -355, L9
+add 216, L49
+m0
+cmp -110, @r6
+cmp @r3, L48
+L49: jsr L58
+L50: sub -470, @r3
+jsr @r1
+jmp L18
+m0
+red @r2
+jsr L1
+jmp @r4
+inc L9
+mov @r5, L35
+red @r4
+dec @r1
+L51: dec @r5
+bne L29
+jmp L14
+prn -134
+L52: dec @r4
+jmp L17
+clr @r0
+add -168, L12
+m1
+dec @r3
+dec @r3
+add L20, L56
+mov 74, L14
+not L6
+add -463, L31
+prn @r3
+clr L45
+rts
+mov @r1, L17
+prn -436
+mov @r4, @r2
+rts
+bne L48
+L53: mov L58, @r2
+dec L30
+m1
+jsr S8
+m0
+L54: mov 298, @r1
+jmp @r3
+L55: cmp X3, 77
+jsr @r3
+prn X4
+red @r0
+inc @r2
+dec @r7
+not @r5
+red @r0
+jsr L57
+rts
+L56: jmp @r3
+prn L45
+L57: lea L22, @r5
+red D0
+bne L11
+bne @r2
+L58: clr @r2
+mov L59, @r2
+L59: bne @r5
+lea S0, L44
+bne D0
+stop
+D0: .data 257,199,-264,-397,294,-236,-498,344,-179,154
+D1: .data -212,245,86,-435,-498,-343,329,-380,-26,-312
+D2: .data -186,278,-418,293,184,407,206,-291,-437,101
+D3: .data -175,-249,-97,-291,211,-98,489,235,278,-274
+D4: .data 113,-192,196,-484,-454,336,-221,-44,-131,154
+D5: .data 13,181,-3,-210,396,57,151,-183,106,-274
+D6: .data 151,258,-261,-222,58,-404,-39,-330,420,489
+D7: .data 488,273,-416,-389,196,65,-55,-47,-220,-299
+D8: .data -102,-98,499,323,-334,-259,26,103,-125,102
+D9: .data -198,146,-290,209,116,-179,-483,-353,-430,-93
+S0: .string "nuavctpfvpsffswg"
+S1: .string "fzxlthjdtcimx"
+S2: .string "mojx"
+S3: .string "obzmars"
+S4: .string "ispxfwmlytv"
+S5: .string "tervaqkbznnzhlupb"
+S6: .string "itzmasmaghzq"
+S7: .string "nepeqhtf"
+S8: .string "icv"
+S9: .string "ewacfbnmw"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r5
+    prn 96
+endmcro
+mcro m1
+    sub @r4, @r3
+    prn 36
+endmcro
+mcro m2
+    sub @r5, @r3
+    prn 12
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 38
+endmcro
+mcro m4
+    sub @r4, @r2
+    prn 33
+endmcro
+rts
+m2
+jsr @r6
+L0: jmp L44
+prn @r6
+jmp L0
+lea L0, @r2
+jmp L0
+dec L0
+dec S5
+m0
+clr L0
+prn L0
+cmp -411, @r0
+sub L0, @r0
+red L0
+cmp @r3, -370
+lea L0, L0
+m2
+L1: inc L36
+not @r1
+m2
+L2: rts
+m4
+prn L0
+rts
+add @r4, L2
+mov L1, L2
+cmp 307, S7
+prn L2
+red L1
+red @r2
+L3: not @r6
+mov 246, L0
+jsr L0
+cmp L1, 116
+red @r6
+mov @r2, L0
+lea L0, @r1
+add L1, @r7
+lea L2, L1
+not L3
+L4: sub @r4, @r1
+jsr L1
+mov L3, L4
+dec @r5
+dec L3
+add @r4, @r6
+prn D0
+prn @r3
+not @r0
+m0
+red @r7
+mov @r2, @r1
+cmp L1, 203
+rts
+not L3
+red L3
+inc L55
+add 345, L4
+L5: add L3, L1
+sub L4, @r3
+add @r2, @r2
+lea L1, L3
+inc L4
+clr @r3
+L6: dec @r6
+mov L4, @r7
+prn @r2
+jsr @r3
+inc @r3
+not @r1
+cmp 175, L3
+L7: bne L3
+m0
+jmp L7
+L8: lea L8, @r2
+lea L5, L1
+rts
+clr L6
+red L7
+clr @r0
+jsr @r4
+cmp L3, @r7
+rts
+cmp @r1, L8
+L9: lea L5, L3
+L10: red @r6
+add @r7, @r5
+inc S4
+mov @r4, @r0
+L11: not @r7
+add @r1, L5
+jmp L4
+prn L3
+prn -336
+add -412, @r5
+rts
+rts
+red S0
+cmp L3, L7
+not @r1
+clr L8
+add 369, L17
+L12: prn -467
+prn L5
+m1
+jmp L4
+jmp @r1
+jmp @r0
+add L6, L8
+m3
+dec L7
+lea L11, @r1
+bne L8
+rts
+add L1, @r1
+bne @r2
+L13: lea L4, L3
+cmp -383, L27
+m0
+bne @r4
+rts
+mov L1, @r1
+rts
+jsr L0
+jsr @r5
+not @r3
+not @r1
+cmp L12, 218
+jmp @r3
+sub -199, L5
+jmp L6
+jsr L8
+lea L3, L11
+bne L10
+jmp @r5
+inc @r5
+L14: dec L7
+cmp 0, L6
+L15: add @r0, L12
+bne L54
+bne D0
+add @r3, @r6
+prn -2
+lea L0, @r2
+clr @r6
+prn L13
+L16: mov @r4, L2
+L17: add L14, L20
+prn L3
+not L7
+cmp L5, @r0
+dec @r5
+bne @r4
+cmp -401, @r6
+m4
+prn @r6
+mov L1, @r5
+cmp L1, @r0
+L18: lea L1, @r3
+cmp L17, @r1
+rts
+add -404, @r0
+L19: cmp @r3, -339
+sub 340, @r7
+jmp @r1
+mov L13, @r1
+L20: jmp L20
+L21: inc X0
+red @r5
+clr L5
+m1
+cmp -146, L19
+m3
+m4
+clr L14
+inc L4
+dec @r1
+cmp 443, 497
+bne @r2
+lea L8, @r4
+clr L14
+jmp @r2
+add L0, L2
+sub L17, @r5
+rts
+jsr L17
+clr L16
+jmp @r1
+L22: not @r6
+jmp @r6
+clr @r4
+red L16
+sub L0, @r7
+dec @r2
+inc L14
+prn -241
+dec L22
+sub @r3, @r6
+lea L5, @r0
+L23: add @r3, @r0
+L24: not @r5
+mov @r2, @r5
+red @r1
+not @r7
+prn @r3
+bne L4
+jmp @r6
+lea L4, @r6
+jsr L20
+jmp @r3
+m3
+jmp @r7
+m0
+clr L5
+jsr @r1
+bne X1
+mov -482, @r0
+L25: inc L2
+L26: jsr L42
+m1
+L27: prn L23
+L28: red L18
+cmp 258, @r5
+clr L4
+inc L14
+m3
+clr D0
+add @r7, L8
+rts
+bne L21
+mov -45, @r0
+prn L10
+m0
+lea L19, @r7
+cmp X2, 240
+m1
+lea L21, L26
+inc @r0
+sub L18, @r4
+mov L0, @r5
+jsr L13
+not L9
+not L28
+not @r2
+L29: sub -62, L3
+dec L14
+m1
+sub @r3, L0
+jsr @r0
+mov L8, @r1
+L30: sub @r1, @r3
+not @r5
+inc L23
+inc L27
+L31: rts
+red @r0
+m3
+L32: lea L31, @r7
+lea L29, @r5
+jmp @r7
+m4
+rts
+L33: add 418, @r6
+rts
+m2
+m1
+m0
+L34: add 383, @r0
+red L41
+m1
+red L33
+bne @r4
+bne @r0
+cmp 117, 100
+L35: jmp L0
+bne L27
+mov @r2, @r1
+lea L2, L16
+prn @r4
+rts
+not L15
+bne L35
+cmp @r6, 85
+mov 378, @r6
+bne L28
+lea L47, @r3
+L36: jmp @r4
+add @r2, @r2
+L37: inc L28
+L38: red @r6
+jsr L54
+add L39, @r5
+L39: bne @r1
+cmp @r4, @r1
+rts
+rts
+cmp L34, L18
+red L16
+clr D0
+m3
+L40: sub -285, L19
+add L24, D0
+L41: lea L55, @r2
+jmp @r0
+red L1
+bne @r0
+L42: rts
+L43: rts
+L44: sub L44, L39
+dec L23
+bne L39
+sub -139, @r0
+m0
+jsr @r2
+not L8
+lea L13, @r7
+L45: lea D0, L8
+m2
+add 500, @r5
+L46: bne @r2
+sub -482, L15
+L47: inc @r2
+dec L15
+inc L44
+m0
+dec L5
+not @r5
+lea L4, @r1
+jsr @r5
+bne L19
+not @r2
+prn 427
+prn @r0
+lea L38, @r1
+dec @r6
+m3
+m1
+not @r0
+inc @r6
+sub L24, L8
+rts
+sub L40, @r6
+L48: dec @r6
+rts
+clr @r2
+bne L20
+prn -10
+bne L29
+m4
+clr @r2
+jmp @r0
+not L2
+sub L32, @r5
+clr @r1
+add L55, L22
+not L24
+jsr L10
+m0
+clr L30
+L49: clr L7
+L50: rts
+lea X3, @r0
+m2
+rts
+lea D0, D0
+not @r2
+clr @r7
+clr S4
+mov @r4, L42
+dec L33
+mov L29, @r2
+prn L28
+jmp @r3
+L51: cmp L57, L4
+dec L43
+inc L6
+rts
+bne L25
+add @r2, @r0
+rts
+L52: inc L26
+dec @r3
+red L21
+L53: not L10
+jmp @r7
+L54: prn @r2
+jmp L8
+rts
+L55: prn @r1
+clr L42
+inc @r6
+rts
+dec @r6
+L56: inc L56
+jsr L57
+clr @r0
+jsr @r0
+lea L58, @r1
+m2
+m4
+L57: clr D0
+dec @r2
+red @r5
+dec @r3
+jsr @r6
+prn @r5
+bne L40
+sub -300, L45
+clr @r2
+inc @r1
+dec @r6
+bne @r7
+jmp L58
+cmp L21, @r3
+lea L59, L17
+inc L26
+prn X4
+lea L47, D0
+jsr @r7
+dec L49
+bne L51
+L58: rts
+add @r5, @r3
+bne D0
+mov -298, @r2
+cmp @r3, L29
+red @r7
+add 24, L59
+jmp @r4
+m2
+mov -323, @r5
+inc L59
+L59: inc @r4
+add -73, D0
+mov @r2, @r0
+not @r0
+cmp S8, D0
+m3
+stop
+D0: .data -144,162,213,405,32,15,-12,-493,-165,-28
+D1: .data 256,143,201,379,-285,162,-281,11,16,-300
+D2: .data 248,394,457,128,163,-107,373,-218,-308,354
+D3: .data 283,106,309,209,348,230,-316,-226,348,405
+D4: .data -13,-283,-18,305,-478,422,-13,-334,154,151
+D5: .data 187,149,-256,291,-275,311,293,-41,180,-433
+D6: .data 199,187,405,458,-452,457,-379,-440,206,372
+D7: .data 128,331,-54,391,130,191,190,-419,344,268
+D8: .data 193,308,-236,199,125,282,-395,-271,334,59
+D9: .data 31,-375,303,352,10,335,427,-338,186,-232
+S0: .string "kggyaraejtul"
+S1: .string "e"
+S2: .string "mkc"
+S3: .string "cfehzmqbnpyxszmqs"
+S4: .string "aycbtsidrffwgwqw"
+S5: .string "bijqxtzpbrhzdtzdjht"
+S6: .string "jshenfmcmbjmqozgklh"
+S7: .string "rl"
+S8: .string "qerqhecftylp"
+S9: .string "nnrplpwbux"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r0
+    prn 66
+endmcro
+mcro m1
+    sub @r1, @r4
+    prn 2
+endmcro
+mcro m2
+    sub @r7, @r1
+    prn 10
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 14
+endmcro
+mcro m4
+    sub @r7, @r0
+    prn 58
+endmcro
+L0: not @r6
+jmp @r5
+clr L0
+prn L0
+m2
+mov L0, L0
+jsr L0
+sub 33, L0
+bne @r5
+cmp 353, @r1
+L1: red @r7
+cmp @r2, L1
+m3
+cmp L0, 200
+prn -390
+not @r7
+red @r3
+not @r2
+bne L1
+red D0
+mov 460, @r2
+prn L1
+bne L0
+m1
+sub @r6, L0
+sub -6, L0
+inc @r2
+inc L0
+L2: dec @r6
+jsr L1
+clr L0
+jmp @r5
+inc L0
+dec L0
+inc @r3
+lea L1, @r1
+clr @r4
+jsr L0
+m1
+L3: lea L2, @r5
+clr L0
+bne @r7
+L4: jmp @r7
+prn @r3
+mov @r3, @r5
+prn -315
+dec L3
+clr L9
+cmp @r0, 51
+cmp 356, @r6
+inc @r6
+jsr L1
+jmp L3
+clr @r1
+L5: jsr D0
+L6: clr @r1
+L7: red X0
+clr @r5
+add 130, @r3
+not L5
+cmp 154, L3
+sub S8, @r6
+m2
+dec @r7
+rts
+red L5
+add L6, L1
+L8: clr L1
+L9: lea L4, L6
+L10: not L1
+red L4
+clr L1
+clr @r6
+L11: rts
+m2
+bne @r0
+clr @r0
+rts
+lea L4, L11
+rts
+dec @r7
+lea L1, @r6
+L12: lea L49, L5
+add @r1, L4
+inc @r7
+jmp D0
+not L8
+clr @r1
+clr L5
+m0
+L13: lea L3, @r3
+cmp -68, L17
+lea L8, @r7
+m1
+prn @r2
+L14: cmp -400, L2
+cmp L38, @r3
+bne L7
+sub @r6, @r7
+cmp L5, @r0
+sub L13, @r4
+not L1
+clr L4
+m4
+red @r0
+prn 135
+add 246, L8
+L15: clr L8
+bne @r1
+cmp @r6, @r2
+red L3
+jsr L7
+add @r0, L9
+bne @r3
+clr @r5
+inc @r2
+inc @r3
+L16: sub @r1, @r2
+sub 194, L4
+L17: bne @r2
+mov @r0, @r5
+lea L7, @r4
+lea L5, @r0
+m4
+jsr L6
+cmp -309, L6
+m1
+sub @r3, L17
+add @r1, @r1
+dec @r7
+add -211, L11
+m3
+mov L3, @r0
+inc @r2
+add L6, @r6
+mov L0, @r6
+not @r2
+L18: cmp @r2, @r6
+red @r0
+add @r4, @r3
+lea L6, L13
+prn -475
+L19: clr @r3
+add @r2, @r1
+red L8
+L20: jmp L9
+clr L14
+sub L36, @r0
+L21: sub L6, L11
+clr @r5
+cmp L17, @r5
+m1
+L22: sub @r5, @r0
+m2
+prn -234
+red @r3
+dec L9
+prn 293
+not @r7
+add @r6, @r2
+dec L21
+dec L3
+lea L0, @r2
+cmp @r1, @r7
+add 418, L5
+sub 185, L10
+jsr @r7
+prn L4
+cmp @r3, -31
+dec @r4
+bne X1
+jmp L4
+rts
+L23: bne S6
+clr @r2
+red L47
+L24: not L0
+m4
+prn @r7
+jmp L9
+add @r3, @r3
+m0
+clr @r3
+red @r3
+m4
+cmp @r0, L36
+jsr L17
+inc @r0
+L25: sub @r5, L25
+jmp L11
+mov -360, L23
+m2
+dec @r7
+dec S4
+L26: dec L18
+jsr L19
+jsr @r7
+red L57
+cmp L11, @r1
+red L3
+jmp L24
+rts
+dec @r1
+not L1
+mov @r7, @r7
+dec L14
+red L15
+L27: prn @r6
+dec L2
+red L4
+red @r2
+m4
+L28: rts
+clr L4
+L29: dec @r1
+inc L7
+m0
+add 459, L33
+bne L8
+cmp -144, L6
+add @r3, L23
+dec @r0
+cmp @r2, L44
+prn 299
+cmp @r6, @r4
+jmp L17
+jmp @r7
+prn -35
+red @r5
+L30: sub -407, @r5
+not @r1
+L31: dec L13
+L32: jmp L19
+red @r7
+lea L5, L20
+sub L4, @r0
+inc @r0
+cmp -234, L0
+L33: bne @r2
+rts
+m1
+not L17
+add L22, @r0
+cmp -186, @r3
+m0
+rts
+add L1, L19
+red L27
+clr L29
+lea L16, @r1
+prn L25
+add L19, L23
+inc @r2
+mov L30, @r1
+bne L43
+sub @r1, L16
+jsr @r3
+add L1, L1
+jmp L33
+m3
+dec @r2
+inc L4
+dec L28
+L34: dec @r6
+prn 400
+jmp L14
+not L31
+bne @r6
+jmp L17
+not L19
+mov L21, @r6
+prn L7
+lea L9, L2
+dec @r3
+sub -398, @r6
+bne @r3
+lea L14, @r1
+inc L16
+inc @r6
+mov L52, @r3
+rts
+L35: sub -403, @r4
+not D0
+jmp @r6
+dec L24
+lea S4, @r2
+m3
+clr @r1
+rts
+L36: lea L2, @r4
+m1
+rts
+L37: lea L6, @r3
+jmp L8
+prn L39
+bne @r6
+m4
+m1
+not L4
+jmp @r7
+L38: prn @r1
+L39: cmp @r2, @r0
+dec @r1
+not L21
+m3
+jsr @r4
+red @r1
+jmp @r0
+jsr L28
+lea S5, @r5
+jsr X2
+not S0
+rts
+sub 504, L9
+jsr L41
+red @r1
+L40: dec L12
+m1
+sub -71, L22
+L41: jsr @r6
+add 133, L44
+prn -41
+jmp @r7
+L42: add L42, @r3
+L43: rts
+L44: cmp -43, L40
+add @r4, L21
+red @r0
+m0
+cmp L39, L17
+red L42
+mov @r7, L10
+lea L12, @r1
+jsr @r0
+m1
+prn -252
+prn L42
+m0
+sub S7, @r4
+sub @r4, @r6
+sub 110, @r6
+prn @r1
+not @r1
+red L25
+jmp L26
+L45: red @r2
+bne L2
+prn -93
+not @r0
+red L12
+clr L34
+not L44
+dec L33
+not @r0
+clr D0
+dec L30
+not @r6
+jsr L7
+sub -321, D0
+m0
+L46: cmp L31, 506
+mov L13, L14
+red L30
+rts
+L47: sub L42, L32
+prn @r4
+red L38
+red L7
+jmp L0
+m3
+prn 495
+lea L19, @r2
+clr L42
+red L30
+red @r6
+sub @r6, L8
+L48: prn L33
+sub L17, @r0
+not @r2
+L49: inc L48
+L50: lea L4, L35
+L51: prn @r3
+add 212, @r0
+L52: sub L48, L6
+red @r5
+not @r5
+jsr @r5
+jsr @r6
+L53: red D0
+m3
+L54: prn -456
+clr @r7
+rts
+lea L4, L28
+dec @r4
+jmp L47
+lea L42, @r7
+L55: lea L28, @r0
+m3
+jsr L22
+not @r3
+L56: rts
+inc L55
+clr @r7
+lea L51, L13
+clr @r0
+inc L58
+jmp @r2
+dec @r6
+red L55
+cmp @r7, @r7
+mov 289, @r4
+jmp @r4
+red @r2
+m3
+rts
+L57: inc S5
+lea L59, @r1
+dec L23
+prn -64
+mov -211, S4
+clr L56
+mov X3, L40
+add S9, @r3
+cmp @r2, @r4
+cmp -339, L11
+prn @r6
+bne L48
+not D0
+rts
+sub @r0, @r3
+m1
+sub @r7, @r0
+m4
+prn D0
+not L48
+jmp L59
+mov S7, L32
+L58: rts
+m2
+L59: stop
+D0: .data 490,100,-153,38,16,476,121,36,258,362
+D1: .data 137,-494,92,420,253,-212,-317,283,124,-3
+D2: .data 251,353,-156,295,-237,-293,113,-315,468,-231
+D3: .data -260,326,-38,-392,92,-16,185,-172,338,-21
+D4: .data -142,7,-453,-213,441,-462,189,220,-423,25
+D5: .data 396,379,197,145,467,28,401,210,493,-370
+D6: .data -37,128,116,-358,279,-127,-408,261,-209,352
+D7: .data -336,310,-420,382,-414,-296,333,145,-336,144
+D8: .data 365,-309,-318,-260,-495,53,-158,-370,-57,131
+D9: .data -387,37,307,419,304,39,-293,227,-194,385
+S0: .string "jjqvmzesgvuhmfghm"
+S1: .string "ttzmektgxzsuhthq"
+S2: .string "tswludzpeqexvlbjdzp"
+S3: .string "qhzsttf"
+S4: .string "pvoodmepoyyficfiey"
+S5: .string "zb"
+S6: .string "gcueismucmmknv"
+S7: .string "leaxkpqxmmzm"
+S8: .string "wcuucntudfhk"
+S9: .string "olvvpayorcziiurx"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r2
+    prn 4
+endmcro
+mcro m1
+    sub @r5, @r6
+    prn 1
+endmcro
+mcro m2
+    sub @r1, @r7
+    prn 75
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 91
+endmcro
+mcro m4
+    sub @r1, @r6
+    prn 82
+endmcro
+bne L5
+L0: dec L0
+jmp L0
+m0
+rts
+cmp @r0, -119
+bne L0
+bne @r7
+bne @r3
+clr @r1
+rts
+L1: bne L1
+red @r5
+jmp L1
+rts
+inc @r2
+prn @r5
+red @r3
+bne @r7
+m0
+bne @r1
+cmp 233, L0
+clr L1
+sub -371, L1
+not L0
+cmp @r2, -288
+lea L1, @r2
+L2: dec L1
+add L0, @r5
+lea L0, @r2
+inc @r7
+L3: jsr @r1
+add @r2, @r3
+inc @r4
+L4: sub L2, L3
+sub 4, L2
+bne L0
+prn 93
+bne L4
+cmp @r7, -6
+L5: jsr L1
+not @r6
+not @r1
+red L0
+red L1
+jsr L2
+inc @r5
+rts
+lea L5, @r1
+jmp L2
+bne L1
+mov -130, @r3
+m1
+jmp L2
+rts
+m3
+add 22, L1
+mov L5, L4
+not L4
+jmp L1
+bne X0
+L6: mov -254, L3
+jsr @r1
+not @r4
+add L6, @r2
+L7: red L0
+not L5
+inc L4
+lea L6, L6
+m3
+L8: bne L4
+clr S8
+prn @r0
+red @r7
+red L0
+add L5, L1
+L9: dec @r5
+not L1
+sub @r0, L7
+jmp @r0
+inc @r3
+L10: cmp @r4, 189
+dec D0
+L11: lea L11, @r2
+m2
+cmp -496, @r6
+L12: inc @r7
+L13: clr @r6
+L14: mov 328, @r7
+m4
+m4
+not @r4
+L15: clr L2
+m1
+L16: inc @r0
+prn S3
+add 491, @r7
+L17: sub @r1, L10
+rts
+dec @r3
+dec @r5
+jmp L9
+L18: jsr @r4
+prn -461
+inc L0
+mov 396, L10
+sub @r3, L8
+rts
+rts
+L19: add -421, @r2
+clr L6
+jmp @r6
+prn L4
+add @r2, @r1
+cmp 161, 25
+dec L8
+mov 387, L17
+add 258, @r2
+cmp L7, L19
+m2
+m2
+L20: mov @r3, L0
+clr @r2
+bne L18
+jsr L1
+jmp L6
+sub 288, L2
+sub -61, @r5
+bne L4
+clr L19
+not L17
+lea L18, L10
+lea L21, L18
+m1
+L21: clr L17
+red @r3
+mov 193, L6
+jsr @r7
+clr L7
+red L17
+dec L5
+cmp @r3, -62
+dec @r1
+cmp @r4, -50
+bne @r5
+not L6
+m2
+cmp -144, L10
+not @r1
+bne L9
+red @r4
+sub -53, @r2
+L22: jmp @r4
+jmp L15
+lea L20, L19
+L23: cmp @r0, L2
+not @r6
+mov 111, @r6
+rts
+L24: jsr L0
+prn S9
+mov -509, @r2
+prn L6
+cmp L3, X1
+not @r3
+jmp L20
+jsr @r3
+mov X2, L18
+add @r3, @r3
+prn @r3
+rts
+dec L21
+prn -391
+clr L0
+red @r3
+m3
+clr D0
+jsr @r6
+bne @r0
+not L26
+inc L7
+m3
+jmp L9
+L25: lea L5, @r2
+red @r6
+red @r2
+m3
+sub @r1, @r0
+add @r5, L0
+dec L17
+clr L1
+sub 332, L24
+prn @r1
+inc L9
+cmp L14, L5
+add -11, L9
+jsr L13
+m0
+prn 365
+L26: clr L56
+L27: inc @r7
+jmp @r2
+jmp L17
+sub -234, L20
+m1
+clr L17
+red L16
+lea L25, L10
+L28: inc @r2
+m1
+prn @r7
+dec L11
+m1
+cmp L0, @r1
+dec L31
+red L4
+L29: add -307, L3
+not L10
+cmp L6, L8
+clr @r6
+dec @r3
+cmp @r1, L24
+add L17, L11
+mov -312, L57
+L30: red L25
+L31: rts
+jmp @r3
+lea L17, @r4
+add @r2, @r6
+bne @r7
+red @r0
+m4
+m0
+lea L24, L5
+cmp 236, @r5
+bne S8
+L32: bne L16
+L33: rts
+rts
+L34: prn -490
+lea L27, @r5
+L35: not @r5
+prn L22
+sub @r5, L31
+lea L33, @r6
+mov L12, @r1
+lea L42, L20
+bne L7
+add L30, @r4
+prn L13
+lea L35, L59
+jmp L8
+prn L4
+jmp L18
+m4
+clr @r2
+lea L19, D0
+m2
+jmp @r6
+jsr L12
+m0
+m2
+not @r1
+red L23
+jmp @r2
+rts
+L36: jmp D0
+jmp L6
+mov -220, @r5
+bne L15
+lea L32, L20
+prn @r7
+dec @r3
+inc L21
+dec L19
+jsr @r7
+jsr @r4
+rts
+m3
+inc @r3
+lea L11, @r2
+jmp @r1
+jmp L4
+jmp L28
+jsr L0
+clr L36
+clr @r1
+bne @r7
+not L2
+rts
+bne L1
+m1
+jmp L22
+sub L30, L9
+bne @r1
+add 277, L1
+cmp @r7, 75
+clr L1
+red L26
+add -199, @r2
+add -10, @r3
+clr @r4
+cmp -479, 368
+not @r3
+jsr L28
+inc @r7
+rts
+red L18
+inc @r1
+cmp 111, @r2
+cmp @r7, -113
+mov L4, @r4
+clr L26
+L37: add @r1, L33
+red L35
+cmp L25, L54
+inc @r7
+jmp @r7
+inc L7
+jmp @r4
+bne @r5
+dec @r6
+mov L18, @r3
+not @r2
+jmp L10
+jmp L22
+m1
+L38: dec L12
+cmp 285, @r6
+rts
+mov 139, L23
+sub @r0, @r5
+m0
+add @r6, L13
+jsr @r0
+prn L16
+m2
+cmp L28, @r2
+clr X3
+prn @r6
+lea L36, @r5
+jsr L38
+dec @r5
+dec L28
+add @r2, @r5
+sub @r5, @r7
+add 381, L9
+not L23
+m3
+jmp L33
+inc L43
+clr @r2
+L39: bne @r4
+sub @r6, @r7
+cmp D0, 337
+L40: red S9
+jmp @r5
+L41: lea L44, @r3
+jsr L21
+m3
+bne @r7
+inc L8
+m4
+L42: lea S5, @r5
+inc @r1
+mov @r4, @r7
+prn @r7
+L43: not L24
+mov @r3, @r7
+L44: inc L6
+prn L28
+m2
+m3
+add 187, @r2
+m1
+rts
+L45: dec L29
+clr D0
+L46: sub 22, L17
+L47: jmp L56
+rts
+lea D0, X4
+jsr @r0
+L48: jmp L19
+red L46
+mov 278, @r4
+cmp -257, 105
+L49: bne @r3
+add 173, @r0
+L50: prn @r4
+L51: prn S0
+jsr @r4
+L52: not L52
+mov 484, @r4
+bne @r2
+clr @r1
+lea L46, L9
+lea L22, @r4
+cmp @r1, L5
+red D0
+lea L12, L58
+jsr L28
+prn L6
+L53: cmp 298, L5
+jsr L39
+L54: sub L5, @r4
+sub -264, @r4
+clr L24
+prn @r1
+red @r0
+clr D0
+sub D0, L17
+L55: prn @r6
+rts
+L56: dec L3
+inc @r2
+add @r2, L57
+red @r3
+prn @r5
+add -214, @r1
+dec L16
+mov -65, L53
+cmp L59, @r2
+sub @r3, @r4
+prn L9
+jsr @r5
+red @r2
+sub @r7, @r4
+sub @r3, L0
+L57: lea L58, S9
+m3
+inc L58
+rts
+m0
+cmp -302, L58
+L58: jsr L45
+add S1, D0
+add L54, L16
+m1
+L59: dec D0
+stop
+D0: .data 414,176,265,360,125,-326,111,-459,-170,443
+D1: .data -205,94,127,-315,-463,293,-35,493,214,370
+D2: .data -263,324,-471,-320,232,206,-149,290,354,314
+D3: .data -31,-62,286,95,-263,-393,-140,32,389,-379
+D4: .data -169,77,-159,-64,-298,-458,-209,386,-345,75
+D5: .data 10,-233,88,214,181,186,-290,-449,89,-412
+D6: .data 22,-21,-473,-252,-233,399,407,93,-353,308
+D7: .data 313,444,-422,-127,445,326,159,70,-477,308
+D8: .data 490,185,-326,386,-165,264,69,464,9,-426
+D9: .data -20,30,-225,-300,-203,-301,-293,452,106,-187
+S0: .string "edzbw"
+S1: .string "itolbbqhiwmbruq"
+S2: .string "zk"
+S3: .string "kufxggahvdrttpxtdw"
+S4: .string "wrbgwfslrl"
+S5: .string "emkwmtiiezt"
+S6: .string "hfxetolnfzamva"
+S7: .string "yzawpzw"
+S8: .string "gbbnjtfdkegqaitvy"
+S9: .string "xen"
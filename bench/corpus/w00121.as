@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r5
+    prn 75
+endmcro
+mcro m1
+    sub @r2, @r7
+    prn 99
+endmcro
+mcro m2
+    sub @r3, @r5
+    prn 40
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 67
+endmcro
+mcro m4
+    sub @r3, @r4
+    prn 7
+endmcro
+L0: jmp @r7
+mov @r2, @r6
+dec D0
+add 69, L0
+rts
+dec L0
+m3
+add -138, D0
+L1: inc L1
+L2: prn L1
+m3
+bne @r3
+rts
+jsr @r5
+prn 251
+m4
+clr @r4
+jmp @r6
+sub L2, @r5
+inc L53
+m0
+add 488, L1
+L3: dec L0
+rts
+m2
+rts
+rts
+cmp 7, -325
+L4: not L3
+jsr L4
+prn @r5
+mov @r5, @r3
+bne @r7
+L5: lea L4, L4
+clr L0
+red @r6
+L6: not @r6
+jmp L6
+jmp @r7
+L7: jsr L7
+sub 135, L0
+L8: mov -17, L2
+not L58
+inc L3
+L9: inc @r4
+dec @r1
+m3
+lea L9, L8
+mov L8, @r5
+m4
+not @r2
+jmp @r0
+L10: lea L5, L9
+rts
+clr @r7
+L11: inc @r6
+clr @r2
+jmp L1
+m2
+add -37, @r1
+jmp @r0
+L12: bne L1
+clr L11
+L13: dec @r0
+red @r4
+lea L5, L11
+bne L27
+rts
+mov @r3, @r5
+L14: jmp @r1
+L15: clr @r1
+L16: rts
+not @r5
+bne L9
+L17: not @r1
+dec L3
+m3
+red @r0
+L18: jmp L13
+L19: bne L17
+lea L4, L7
+prn L0
+lea L9, L16
+not @r5
+m3
+dec @r7
+jmp @r0
+red @r0
+rts
+rts
+L20: bne L14
+lea L56, @r4
+m0
+L21: red L7
+jmp L13
+inc @r2
+mov L13, L11
+m0
+jmp L17
+L22: jsr @r0
+L23: add 26, L12
+mov @r0, L2
+L24: lea L48, @r0
+rts
+L25: jmp L2
+clr L3
+L26: prn -230
+jsr L8
+add 194, L26
+jsr @r3
+bne @r5
+add 499, @r6
+L27: bne @r3
+rts
+inc L27
+not @r0
+L28: inc D0
+jmp @r2
+red @r4
+L29: sub L10, @r3
+mov L2, @r4
+mov L5, S3
+inc @r6
+m0
+red L15
+L30: inc @r3
+cmp @r1, L35
+cmp -456, L15
+rts
+prn L4
+add L26, @r1
+clr @r7
+clr L29
+bne @r6
+m3
+clr L27
+m1
+add @r6, L4
+bne L4
+prn -203
+lea L14, @r6
+rts
+red @r5
+add @r0, L39
+jmp @r6
+jmp L7
+inc L11
+bne L30
+mov 4, @r6
+add 293, L28
+rts
+jsr L0
+bne @r6
+L31: lea L34, @r1
+inc @r4
+add @r2, @r3
+jmp L19
+not L15
+cmp L9, @r0
+jsr L6
+m4
+L32: cmp @r2, -425
+add @r0, @r6
+bne L31
+sub @r7, S4
+bne @r7
+not @r4
+clr L5
+clr X0
+mov L5, L28
+rts
+inc @r3
+lea L7, L7
+rts
+cmp -348, -60
+red L5
+bne @r7
+sub L23, @r5
+add -277, @r0
+L33: not L24
+lea L11, @r6
+not L4
+sub L14, L30
+mov @r1, L17
+m3
+cmp L6, @r7
+inc L23
+dec L7
+prn 123
+lea D0, @r5
+add @r2, @r6
+lea L36, L11
+not @r5
+clr @r6
+jmp @r5
+rts
+add 314, L18
+not @r1
+clr @r2
+inc @r5
+cmp -360, L13
+clr L10
+jsr @r7
+m1
+m3
+sub -70, @r7
+add -142, @r7
+rts
+m2
+clr L56
+cmp @r2, S8
+rts
+rts
+m0
+not @r3
+rts
+L34: jsr S0
+dec X1
+L35: inc @r4
+jsr @r3
+L36: prn L9
+m4
+red L31
+not @r0
+sub @r7, L18
+inc @r6
+inc L16
+clr L18
+L37: lea L48, S0
+dec @r1
+jmp L1
+add L13, @r0
+bne L7
+cmp 451, 162
+prn 447
+L38: rts
+lea L55, L37
+m0
+add -232, L9
+prn 366
+clr L4
+inc L16
+m4
+bne @r6
+mov -478, L44
+red L13
+not @r0
+rts
+rts
+add @r2, @r7
+L39: not L19
+prn @r5
+rts
+sub @r0, L13
+rts
+not L16
+L40: inc L34
+lea X2, L36
+dec L36
+red L28
+mov @r7, L33
+bne @r2
+sub 329, @r4
+bne L17
+lea L12, @r3
+clr L40
+prn -399
+cmp @r2, L8
+jmp L36
+clr @r1
+m2
+clr L10
+jsr @r4
+mov @r5, L13
+red @r4
+add @r4, @r4
+red @r4
+m0
+dec L40
+clr @r4
+jsr L20
+mov 69, @r6
+bne @r6
+sub @r7, @r4
+clr L38
+not L14
+cmp 239, @r5
+cmp @r0, @r3
+add L30, L16
+cmp S3, @r6
+bne L0
+prn -433
+cmp -440, 450
+jsr L40
+jmp @r3
+mov @r6, @r5
+mov @r0, L29
+bne @r7
+L41: red D0
+mov L11, L5
+cmp @r4, L32
+dec L5
+jsr L27
+bne L31
+jmp L11
+L42: inc @r6
+dec L6
+inc L6
+cmp 174, -123
+lea L13, @r0
+m0
+jmp @r2
+cmp 324, @r1
+sub @r7, @r5
+rts
+rts
+jmp @r1
+red L29
+L43: jmp X3
+clr L37
+add @r7, @r5
+not L32
+cmp @r5, -258
+mov @r5, @r3
+lea L3, L3
+rts
+jsr @r2
+L44: jsr L9
+dec @r1
+m3
+jsr @r1
+not L43
+mov 118, @r4
+lea L17, @r4
+cmp -455, @r7
+L45: clr @r0
+jmp L13
+clr L22
+lea L37, L38
+L46: dec @r6
+L47: add L28, @r7
+L48: jsr L24
+m1
+inc L36
+L49: cmp @r0, L48
+m1
+mov L34, L40
+prn L0
+dec @r5
+rts
+sub -438, @r1
+add L31, L52
+prn @r3
+L50: bne @r4
+L51: clr L20
+inc @r0
+m1
+clr @r0
+jsr L0
+red @r0
+cmp L3, -9
+dec @r5
+inc L0
+jsr L38
+cmp 399, @r6
+m3
+jmp S2
+jmp @r5
+jmp @r7
+L52: dec L35
+m4
+clr L43
+clr @r2
+L53: clr @r6
+lea L59, L29
+jsr L12
+jsr @r5
+jsr L57
+add L34, @r7
+prn -486
+inc D0
+rts
+L54: dec L32
+add -94, L25
+m4
+mov L26, @r4
+not L25
+jmp @r6
+red @r5
+mov -443, @r4
+jsr @r5
+jsr @r1
+clr L29
+not L9
+lea L55, @r2
+inc L57
+jmp L11
+bne L46
+mov L4, @r6
+lea L10, @r6
+red @r0
+jsr L40
+rts
+inc L33
+cmp -188, L27
+add L39, L25
+m2
+dec L56
+m4
+clr @r4
+not L43
+cmp -467, 309
+not L0
+not L14
+red L44
+inc @r6
+rts
+red @r0
+rts
+jsr @r6
+m1
+bne D0
+dec @r1
+red @r0
+m2
+L55: lea S2, @r7
+not @r2
+cmp L34, 466
+L56: sub 90, @r5
+L57: jsr @r7
+cmp @r4, -149
+m1
+L58: sub @r2, L12
+L59: bne D0
+inc D0
+red X4
+m2
+mov D0, D0
+lea S1, @r4
+rts
+stop
+D0: .data -444,-389,16,-133,19,-338,365,-361,213,38
+D1: .data 320,-420,117,438,-287,-11,-20,443,-51,290
+D2: .data 423,-23,399,-427,-25,467,240,-405,342,82
+D3: .data -30,-364,144,-123,261,-45,42,-463,-446,-421
+D4: .data 389,187,-417,-313,1,263,-51,483,12,-439
+D5: .data -43,79,144,-390,-120,-175,397,373,-311,57
+D6: .data 3,-113,-294,172,326,327,138,-474,463,122
+D7: .data -32,97,-56,109,-419,-144,-321,337,-306,-321
+D8: .data 369,320,382,-380,171,-127,186,-397,468,405
+D9: .data -389,463,491,-466,-333,113,-187,213,-27,-379
+S0: .string "qahgqojye"
+S1: .string "uvkw"
+S2: .string "igwrewftsek"
+S3: .string "qgfllrsfybsmfauxsb"
+S4: .string "erwzofkx"
+S5: .string "hueapbqhrvurig"
+S6: .string "clpryqolysvuyys"
+S7: .string "tfbrrgwvktoeaynwdp"
+S8: .string "gapqzjxzjdwsxfdfu"
+S9: .string "vwes"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r0
+    prn 13
+endmcro
+mcro m1
+    sub @r6, @r0
+    prn 98
+endmcro
+mcro m2
+    sub @r5, @r3
+    prn 6
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 43
+endmcro
+mcro m4
+    sub @r5, @r3
+    prn 31
+endmcro
+m3
+jsr @r2
+cmp L0, -474
+clr L0
+jmp L0
+prn -230
+lea L0, @r5
+not L0
+L0: red @r1
+rts
+lea L0, @r0
+lea L0, L0
+prn -246
+bne L0
+mov -136, L0
+clr @r4
+not L0
+L1: jsr @r0
+red @r6
+red @r3
+prn @r4
+add 449, @r4
+inc @r2
+prn 120
+m1
+m3
+L2: not L0
+red L0
+add L0, @r0
+clr @r3
+L3: prn -35
+sub L3, L2
+prn @r6
+sub L0, L2
+L4: jsr @r6
+inc @r2
+dec @r4
+bne L1
+mov 268, @r5
+not L3
+prn L3
+L5: mov -208, @r5
+lea L0, @r2
+not @r2
+jmp L35
+dec @r7
+dec @r4
+m4
+jmp @r1
+clr @r1
+jmp X0
+m4
+clr @r7
+clr @r6
+L6: lea L59, L0
+dec @r3
+red @r3
+rts
+m4
+jmp L6
+add 70, L1
+rts
+prn L6
+inc L0
+add @r0, @r1
+jmp @r5
+rts
+inc @r2
+lea L1, @r1
+add L6, @r7
+cmp 485, @r2
+lea L1, L0
+inc @r5
+clr @r7
+rts
+not @r3
+prn L4
+mov @r7, L1
+lea L6, L4
+L7: rts
+prn @r0
+m0
+L8: bne L5
+clr L1
+L9: clr L1
+m3
+cmp @r3, -141
+clr L9
+jmp @r0
+cmp L6, @r6
+dec D0
+jsr @r6
+inc @r7
+jsr L0
+L10: bne @r4
+L11: add @r0, @r2
+add L5, L1
+m2
+lea L5, L23
+mov -448, D0
+m0
+jsr @r6
+inc @r4
+lea X1, L9
+prn @r1
+m1
+jmp @r1
+L12: rts
+lea L3, @r6
+bne L8
+L13: jmp @r0
+clr @r0
+red L0
+jsr L1
+add @r4, @r1
+dec @r6
+clr L2
+jsr L10
+cmp L8, 238
+L14: add L2, @r3
+L15: not L4
+mov L2, @r5
+L16: add 127, X2
+not L13
+lea L8, @r7
+red L56
+m0
+bne D0
+add @r2, L5
+prn 347
+cmp @r1, 59
+L17: clr L2
+dec @r2
+rts
+jmp @r6
+prn @r3
+cmp -174, @r2
+lea L14, L16
+mov L8, @r5
+dec @r4
+not @r1
+jsr L16
+not @r7
+L18: red L10
+mov @r4, @r7
+prn -289
+prn L1
+dec @r3
+red L9
+dec L8
+jmp D0
+not L26
+prn -245
+red @r4
+L19: mov -11, @r0
+L20: inc @r7
+clr @r4
+rts
+add @r2, L1
+L21: bne @r7
+L22: bne L6
+sub -220, L58
+not @r1
+red @r0
+lea L17, @r5
+sub @r0, @r2
+lea L41, @r1
+L23: cmp @r1, L19
+add L9, L14
+red L20
+mov L4, @r7
+not S1
+mov @r0, @r3
+jmp @r3
+add X3, @r3
+m1
+inc L22
+red @r3
+prn -148
+rts
+jsr L2
+clr L15
+cmp @r0, @r2
+inc @r0
+clr D0
+jmp L18
+m1
+red L41
+lea L15, @r0
+sub 58, L16
+cmp @r4, @r0
+L24: rts
+L25: bne L10
+cmp @r3, @r2
+lea L10, @r7
+rts
+rts
+clr L10
+clr L13
+dec L2
+red L7
+prn L5
+m0
+L26: prn 68
+not @r3
+red @r3
+inc @r4
+jmp L1
+rts
+m1
+bne L3
+dec @r2
+red L8
+jsr L14
+sub -98, @r2
+L27: red L18
+jsr L6
+clr L9
+L28: red L9
+jsr L2
+bne L15
+rts
+lea L2, L26
+inc @r2
+not L26
+L29: clr L3
+cmp @r3, -342
+sub L25, @r2
+sub -443, @r1
+L30: prn L3
+L31: rts
+m1
+L32: not L17
+L33: lea L4, @r2
+not L6
+bne L21
+L34: rts
+L35: clr L26
+red S8
+prn L0
+inc @r2
+jsr L37
+not L7
+m3
+clr @r3
+lea L17, L6
+sub @r7, @r1
+L36: red @r6
+mov -135, L5
+m1
+m2
+add -174, @r1
+dec @r6
+m4
+m2
+L37: lea L49, L17
+lea L1, L12
+sub 452, L4
+bne D0
+mov 348, @r4
+m0
+rts
+dec L27
+rts
+prn -215
+jmp L10
+m1
+L38: rts
+clr @r2
+cmp @r5, @r1
+m4
+rts
+m0
+bne @r3
+dec L5
+jmp L25
+lea L9, S8
+prn L32
+red @r1
+m2
+prn @r6
+lea L3, L9
+sub S3, @r1
+red L7
+rts
+sub @r3, L10
+sub 7, L34
+sub 253, @r7
+not @r6
+L39: dec L9
+bne L20
+rts
+L40: cmp @r7, L9
+L41: inc L14
+jmp L13
+cmp 18, @r1
+red @r3
+lea S2, @r3
+cmp @r6, @r3
+bne @r6
+cmp L23, @r2
+mov L35, L40
+cmp L12, -141
+jsr L21
+add L5, S7
+m2
+clr @r3
+bne @r4
+mov L41, L16
+add 433, S5
+L42: prn -137
+jsr @r4
+not @r3
+not @r6
+L43: dec L57
+add @r1, D0
+m1
+lea L5, L19
+clr @r7
+jsr L29
+sub L37, @r6
+m4
+L44: sub L6, @r4
+red @r6
+add @r1, L39
+not @r2
+add 113, L5
+bne @r5
+cmp 26, L3
+prn -229
+add L10, @r3
+sub L14, @r3
+rts
+red @r7
+cmp 292, 5
+inc L42
+bne @r1
+dec L15
+jsr @r7
+L45: bne @r5
+lea L8, @r7
+jmp @r1
+not @r1
+m1
+add 319, @r2
+bne L40
+bne @r4
+clr L6
+add -150, @r0
+jmp @r5
+cmp 465, L47
+jmp L42
+prn -229
+L46: jmp @r0
+m0
+rts
+rts
+L47: mov @r4, @r4
+L48: sub D0, L4
+inc @r4
+red L46
+m4
+m3
+L49: rts
+inc @r7
+not @r0
+add @r3, @r6
+lea L20, L30
+inc L40
+jmp L4
+prn L49
+L50: inc @r2
+L51: mov -280, @r0
+mov D0, L55
+sub 118, S8
+L52: rts
+bne @r6
+prn @r5
+red @r7
+inc @r4
+sub L32, @r0
+m4
+bne L4
+L53: add L58, @r2
+prn @r2
+bne L37
+mov @r5, @r5
+L54: inc @r7
+m3
+L55: jsr @r1
+red @r0
+rts
+prn -143
+m2
+jsr D0
+bne @r2
+jsr @r7
+red @r2
+prn -196
+lea L24, L32
+clr @r5
+bne D0
+prn L0
+clr @r1
+jsr @r5
+cmp @r7, L50
+sub L43, L39
+not @r5
+clr L45
+L56: not @r7
+rts
+cmp 12, L58
+mov L16, @r0
+dec @r0
+jsr @r5
+add @r4, @r4
+m3
+lea L17, @r7
+L57: inc L6
+clr L58
+prn @r0
+L58: rts
+m0
+prn 17
+not @r2
+mov @r3, @r5
+bne L32
+cmp D0, @r0
+jsr @r4
+L59: inc X4
+mov @r4, @r1
+bne @r1
+not L49
+cmp @r2, D0
+dec @r7
+not L1
+mov -322, @r3
+m1
+dec S9
+clr D0
+stop
+D0: .data -175,406,-17,-492,474,497,-386,-111,-345,219
+D1: .data -395,-100,299,-355,409,-443,-44,447,-300,444
+D2: .data 221,-228,306,467,-305,-5,-132,248,-362,181
+D3: .data -496,404,-478,221,-336,-132,-384,-164,-435,-89
+D4: .data 370,236,68,-177,-493,-135,-267,-77,-382,-191
+D5: .data -493,-190,3,-258,429,460,-159,489,-179,-228
+D6: .data -367,397,-292,-446,456,-12,-374,257,105,-307
+D7: .data 41,438,-186,133,-374,-27,79,-443,-206,337
+D8: .data 206,-352,413,-243,399,60,91,478,439,67
+D9: .data -27,-369,146,-367,166,440,446,396,-221,-99
+S0: .string "uvt"
+S1: .string "bqdbej"
+S2: .string "mvi"
+S3: .string "tb"
+S4: .string "ubujdlbjpgyobeziurv"
+S5: .string "fwywcttn"
+S6: .string "wbpnwptehc"
+S7: .string "wloybjoo"
+S8: .string "wqu"
+S9: .string "xhntlq"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r2
+    prn 83
+endmcro
+mcro m1
+    sub @r2, @r1
+    prn 96
+endmcro
+mcro m2
+    sub @r7, @r1
+    prn 71
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 20
+endmcro
+mcro m4
+    sub @r7, @r1
+    prn 56
+endmcro
+not @r1
+clr @r6
+m4
+jmp @r3
+red L0
+jsr L0
+cmp L0, @r0
+dec @r7
+cmp @r3, 25
+not L0
+m2
+cmp L0, L0
+mov 247, @r0
+bne L0
+cmp 240, @r1
+L0: prn L0
+clr L0
+red @r3
+red @r2
+L1: jmp @r4
+m0
+cmp L1, @r3
+bne @r2
+not @r2
+not L0
+jmp L1
+mov @r2, L1
+L2: rts
+rts
+dec L2
+jmp L1
+jmp @r1
+lea L2, L1
+bne L0
+cmp L1, @r5
+L3: add 336, L0
+red L2
+red @r5
+dec @r0
+clr @r5
+m0
+clr L2
+L4: jmp L3
+L5: red L3
+inc L13
+L6: jsr L42
+add L3, L3
+prn -77
+red L4
+jsr @r5
+L7: dec @r7
+inc @r4
+add -446, @r7
+cmp L5, @r6
+red @r7
+sub @r6, @r7
+mov -280, @r0
+L8: prn L54
+L9: inc @r5
+inc S7
+jsr L3
+clr @r1
+rts
+rts
+jsr L7
+clr L8
+bne @r1
+prn L8
+red L9
+bne X0
+sub -105, @r1
+jsr L0
+inc L1
+rts
+jsr @r3
+jmp @r1
+clr @r6
+mov @r0, @r7
+L10: lea L5, @r5
+rts
+clr L2
+clr L7
+clr L8
+cmp 223, L10
+clr @r6
+rts
+L11: jmp L3
+cmp -82, @r4
+jmp L4
+add L4, L1
+mov S6, @r4
+jmp L9
+rts
+m4
+m2
+rts
+red @r4
+bne L1
+clr @r2
+L12: mov 6, L3
+rts
+L13: clr @r5
+rts
+m3
+L14: lea L5, L13
+L15: jsr L11
+L16: clr @r7
+L17: add @r4, L0
+dec L16
+L18: sub @r7, L4
+jsr @r2
+cmp L18, @r7
+L19: cmp @r3, -475
+not @r3
+cmp L13, L54
+L20: clr S0
+add 135, L16
+inc @r0
+m2
+mov @r5, L10
+bne @r0
+L21: dec @r3
+inc L5
+lea L20, L11
+mov L4, @r7
+clr @r3
+mov -398, L5
+L22: bne @r3
+m2
+lea L15, @r0
+m3
+prn X1
+jmp @r4
+m0
+add 318, @r2
+rts
+cmp -125, 36
+mov @r2, L2
+m3
+L23: dec @r4
+dec L21
+clr @r2
+dec @r3
+L24: sub L4, L15
+rts
+jmp @r5
+clr @r6
+mov -168, L17
+clr L18
+red @r2
+mov L17, @r7
+bne L12
+prn L10
+sub 256, S8
+inc @r6
+bne D0
+cmp @r0, @r0
+red L17
+mov L17, L6
+not L22
+red @r0
+jmp L16
+add @r7, @r1
+cmp L18, -46
+not @r0
+add @r3, @r4
+not L2
+sub @r0, L10
+bne @r4
+jsr @r1
+clr @r5
+clr L13
+clr L5
+sub @r2, L14
+sub @r2, @r4
+add D0, @r7
+lea L19, L11
+m4
+L25: sub -411, @r3
+red @r6
+inc @r1
+add L58, @r3
+prn 189
+jsr L23
+clr @r3
+jmp L12
+sub L18, L4
+prn @r6
+rts
+m3
+jmp @r2
+jmp @r0
+inc L8
+L26: dec @r7
+m1
+sub @r4, @r5
+dec @r1
+sub -63, @r4
+jmp @r2
+lea L7, @r5
+jmp L13
+dec L8
+dec L25
+sub @r4, @r4
+L27: red @r0
+jmp L24
+add 74, L24
+prn 326
+not @r5
+cmp -176, 337
+m3
+bne @r4
+add L16, L18
+add L9, S6
+sub 396, L16
+red L14
+bne L6
+L28: red @r2
+dec @r0
+L29: red @r6
+L30: prn @r4
+mov @r4, L4
+m0
+rts
+clr @r2
+clr L21
+mov @r4, @r5
+L31: bne L27
+cmp @r3, L25
+lea L27, @r2
+cmp L15, @r0
+jmp @r4
+jmp D0
+m1
+not @r3
+m0
+jsr @r6
+m3
+L32: clr L18
+add 409, @r0
+cmp @r5, @r6
+sub S3, @r4
+sub -217, L23
+L33: mov L26, L3
+cmp -228, -239
+sub @r7, L5
+m4
+bne L40
+add @r5, L17
+not L6
+cmp @r7, 511
+jmp @r1
+rts
+mov 368, L27
+m3
+m2
+not L24
+L34: bne @r3
+add L13, @r4
+not L2
+cmp -141, @r7
+inc S3
+m2
+inc L16
+dec @r6
+m1
+jmp @r0
+L35: clr L6
+prn L32
+rts
+add @r5, @r2
+sub L22, @r4
+m3
+red @r5
+inc @r7
+clr @r2
+L36: jmp @r0
+m2
+cmp L11, 184
+red L22
+L37: jsr L30
+jmp L34
+sub L40, @r2
+m1
+cmp 167, L11
+mov L47, L10
+not L29
+L38: jsr @r6
+rts
+cmp L0, @r1
+L39: jmp @r7
+not @r4
+sub 381, @r6
+lea L2, @r0
+lea L8, L14
+bne L2
+cmp -186, -428
+L40: prn 157
+L41: clr L20
+L42: prn L11
+jsr @r6
+m0
+sub @r4, @r0
+m0
+mov -378, @r6
+clr @r4
+jmp @r1
+not D0
+inc L56
+clr L29
+jsr @r5
+dec @r6
+prn L2
+sub 280, L5
+red @r5
+inc L36
+sub 509, @r6
+clr L55
+rts
+add -107, L15
+jmp @r3
+not L42
+add @r7, @r1
+bne L24
+jmp S1
+cmp @r7, L32
+inc @r5
+cmp L25, 25
+dec L12
+L43: inc @r4
+jmp L40
+prn -17
+inc @r4
+add @r2, @r1
+inc L12
+L44: rts
+L45: prn @r1
+bne @r4
+jsr L18
+dec @r2
+sub @r0, @r6
+L46: rts
+dec L43
+clr L58
+m2
+clr L10
+sub @r5, L35
+m2
+m3
+m0
+jsr L8
+prn @r0
+not L31
+lea L27, @r6
+add L37, L32
+m0
+sub @r4, @r7
+sub -78, @r5
+inc @r2
+not L57
+jsr @r7
+lea L42, L33
+not @r0
+add -11, L3
+cmp @r1, @r3
+not @r4
+m2
+dec @r2
+mov 345, @r4
+rts
+L47: red L22
+jmp @r4
+m3
+lea S8, @r3
+jmp @r1
+add @r6, L14
+L48: inc @r5
+jmp L54
+prn @r4
+bne @r2
+not @r2
+jsr @r3
+lea L44, L48
+not S5
+L49: sub L28, @r3
+inc L16
+red L11
+L50: inc @r1
+clr @r4
+L51: mov L59, @r6
+jmp @r3
+L52: cmp @r6, L50
+not @r0
+clr L4
+red @r4
+lea L56, @r4
+sub 295, @r0
+bne @r5
+red S1
+inc @r1
+m3
+bne L23
+clr @r6
+bne L4
+add @r2, S0
+clr L28
+clr @r0
+L53: prn L59
+red @r5
+sub -490, @r3
+prn 367
+jmp @r2
+dec L44
+L54: jmp @r0
+jsr L52
+not L53
+bne @r2
+L55: lea L20, @r0
+L56: red @r1
+L57: bne L58
+add @r1, L23
+sub @r6, X2
+rts
+bne L24
+cmp X3, 28
+not L58
+add L9, @r4
+bne @r3
+L58: jsr @r1
+add L14, @r7
+m1
+jmp @r1
+red @r6
+bne D0
+add X4, D0
+add L49, L59
+add -502, @r2
+m0
+L59: dec S8
+clr D0
+stop
+D0: .data 95,-64,336,260,-25,380,332,-480,-218,120
+D1: .data 153,-168,-432,-93,369,384,-10,-25,-78,-164
+D2: .data -2,100,-497,-13,-477,-3,-199,-379,-431,-296
+D3: .data 282,-300,-90,73,-362,21,454,-391,-167,-389
+D4: .data -368,-252,497,-464,-114,-315,-383,107,354,-228
+D5: .data 207,450,124,298,341,-136,-246,-346,-145,-177
+D6: .data 197,227,-480,44,-362,347,-317,-425,9,-57
+D7: .data 10,-82,469,29,-19,-112,-10,336,-151,-205
+D8: .data -129,-129,-374,359,453,134,20,-131,200,-39
+D9: .data 441,373,-322,128,24,-32,324,28,218,395
+S0: .string "ewzmulamtl"
+S1: .string "wj"
+S2: .string "zhcycayfoijgfpynsnqu"
+S3: .string "ypianxlxpk"
+S4: .string "ebfoeugyoshsgrulvjj"
+S5: .string "itd"
+S6: .string "ywttppu"
+S7: .string "mqkmnm"
+S8: .string "xiwbpfhaoqvrwdttluv"
+S9: .string "knadrqqdcqsddaklu"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r5
+    prn 54
+endmcro
+mcro m1
+    sub @r7, @r3
+    prn 95
+endmcro
+mcro m2
+    sub @r1, @r7
+    prn 68
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 96
+endmcro
+mcro m4
+    sub @r1, @r7
+    prn 80
+endmcro
+bne L0
+L0: cmp L0, L0
+prn L0
+jmp @r6
+not @r7
+prn @r0
+not @r0
+red X0
+L1: dec @r3
+red @r5
+inc L0
+red L0
+m4
+not L1
+jmp @r3
+clr L0
+m2
+prn -492
+prn @r5
+red L0
+inc L1
+inc L0
+cmp @r6, @r4
+sub L0, L0
+prn @r7
+cmp -47, @r0
+dec L1
+jsr @r4
+L2: inc @r2
+jsr @r5
+sub @r5, L53
+dec L2
+sub 332, L0
+red @r4
+lea L1, L2
+red L0
+jmp @r6
+sub D0, L2
+cmp L1, @r0
+rts
+cmp @r5, 417
+add @r5, @r2
+bne @r5
+prn @r0
+red L0
+bne L1
+m4
+cmp 433, 354
+rts
+not @r2
+lea L1, @r5
+inc L1
+prn @r7
+dec @r7
+sub L2, @r0
+clr @r1
+inc L0
+jsr @r7
+m3
+prn 511
+jsr L0
+L3: jmp @r7
+m0
+inc L3
+inc L3
+red L0
+m4
+L4: jmp L0
+sub @r3, L4
+prn @r1
+bne L1
+not L37
+dec @r0
+bne L2
+sub -360, @r1
+jsr L4
+clr L1
+L5: jsr L18
+m3
+bne L5
+red L4
+add @r2, L1
+dec @r4
+m4
+L6: bne @r6
+L7: sub @r5, L6
+prn @r3
+sub @r6, @r2
+m2
+cmp L3, L2
+dec L4
+add L6, @r4
+m4
+jmp L1
+L8: mov L7, L7
+not @r2
+prn -88
+jmp L8
+lea L4, L7
+jsr L8
+L9: lea L9, L0
+mov @r5, L6
+cmp @r5, L6
+lea L7, L21
+cmp @r5, @r4
+m0
+m3
+m2
+add @r2, L7
+red L8
+prn D0
+add -434, @r3
+dec L5
+cmp @r5, @r3
+lea L8, L3
+m1
+red L8
+red L0
+L10: rts
+m4
+L11: bne @r0
+cmp 487, L1
+sub @r2, @r0
+not L9
+bne L5
+add L0, @r6
+not @r6
+sub @r0, L9
+L12: inc @r1
+bne @r4
+L13: sub @r3, L6
+bne L7
+L14: jsr L27
+cmp 509, @r0
+cmp @r6, L4
+not @r2
+L15: prn -147
+lea L4, @r7
+clr L7
+m3
+L16: red @r0
+rts
+rts
+m4
+m3
+sub @r6, @r3
+red @r0
+lea S9, L4
+m0
+L17: jsr @r3
+sub L9, L14
+not L13
+add @r2, L15
+sub @r1, L0
+not L14
+cmp L14, L6
+L18: rts
+inc L17
+dec L13
+jmp @r3
+cmp L31, @r1
+dec L17
+L19: not @r2
+L20: mov @r7, L18
+not @r6
+not @r4
+L21: jsr L0
+not L9
+bne L17
+m3
+jmp @r5
+rts
+L22: rts
+prn @r5
+jsr S9
+prn X1
+clr @r4
+mov @r0, @r4
+inc L17
+clr @r6
+jmp @r3
+jsr L10
+sub L9, L22
+jmp @r0
+prn L0
+sub 184, @r7
+dec @r3
+L23: red @r4
+inc L4
+inc @r3
+clr @r1
+mov -50, D0
+not @r0
+L24: red @r3
+lea L12, @r5
+rts
+m4
+m4
+cmp @r4, @r4
+sub @r6, @r5
+L25: bne L25
+jsr L15
+dec L8
+cmp @r0, @r3
+inc L20
+prn 334
+jsr L13
+bne @r2
+mov -402, S2
+add L28, @r0
+clr L25
+add L10, L15
+red @r5
+not @r3
+sub @r1, @r6
+dec @r7
+bne L3
+jmp L14
+rts
+sub 98, @r0
+rts
+lea L18, L9
+red L0
+bne L51
+L26: not L11
+lea S3, @r3
+lea L18, @r5
+L27: mov -202, L11
+L28: sub L25, L10
+jmp S3
+mov @r7, L11
+inc L6
+jmp L15
+L29: inc D0
+inc @r5
+not L23
+dec L13
+m1
+L30: clr X2
+not @r0
+bne @r5
+m0
+jmp L3
+prn 432
+dec @r3
+m0
+jsr L11
+L31: prn -163
+L32: inc L9
+inc L43
+red @r4
+bne L20
+add @r7, L16
+dec @r1
+clr L27
+lea L26, @r7
+dec @r5
+cmp @r2, @r2
+m1
+mov 297, @r2
+m1
+m4
+clr @r4
+sub L30, @r0
+rts
+red @r0
+m4
+mov 11, L0
+m4
+sub L24, @r6
+clr @r6
+rts
+lea L26, @r5
+sub -431, @r2
+red L20
+jmp @r6
+jmp @r1
+prn L17
+prn L22
+dec @r3
+cmp @r5, @r4
+bne L13
+cmp @r3, 467
+add -239, @r0
+lea L16, L19
+sub @r0, @r1
+not L4
+add 351, L31
+bne L26
+lea L26, D0
+L33: sub -487, L33
+cmp L31, @r1
+L34: not L55
+prn 64
+m1
+dec L7
+cmp X3, L6
+red @r5
+L35: mov D0, @r2
+L36: add L4, @r7
+m0
+L37: inc @r2
+L38: red L18
+L39: sub @r7, L11
+jsr @r3
+lea L23, @r3
+mov 193, L55
+L40: inc L19
+red D0
+red L15
+mov -440, @r6
+dec L5
+jsr L45
+prn @r3
+bne L38
+sub L39, @r4
+jsr @r7
+m2
+dec @r6
+rts
+not @r0
+L41: sub -313, L16
+L42: prn L24
+L43: cmp 388, L11
+rts
+jsr @r5
+not @r3
+sub @r5, L22
+m1
+jmp L40
+bne @r5
+dec @r6
+red L20
+jsr L39
+prn @r7
+clr L40
+sub @r5, @r4
+prn 347
+inc @r1
+clr @r7
+add @r2, L25
+sub L24, L10
+cmp @r0, -162
+prn -247
+inc L18
+mov 257, @r5
+red @r2
+red @r0
+L44: inc @r7
+bne L56
+lea L35, @r3
+lea S2, L35
+dec L17
+L45: red @r6
+L46: not @r4
+sub @r4, @r2
+bne L40
+not @r7
+mov L32, @r5
+L47: jmp @r2
+m0
+cmp @r0, 62
+inc @r5
+cmp -247, L30
+jmp @r4
+L48: mov @r2, @r5
+dec L24
+inc @r4
+dec L24
+inc @r6
+L49: mov 225, L20
+lea S4, @r4
+m3
+not @r5
+not L3
+m2
+lea L0, L26
+lea L29, S3
+rts
+sub @r2, L46
+L50: sub 405, L19
+rts
+lea L10, L33
+jsr @r4
+L51: not L43
+dec @r3
+inc @r5
+not L10
+inc @r5
+mov L1, @r7
+m0
+bne D0
+jmp @r5
+add -256, L8
+jsr @r4
+dec @r7
+L52: bne @r4
+add S4, @r7
+L53: rts
+prn @r0
+jsr @r2
+L54: sub D0, L1
+sub -26, @r2
+sub L14, @r2
+red L12
+prn 253
+dec L27
+jmp L57
+clr L39
+rts
+m3
+clr @r3
+jmp L39
+m0
+lea L2, L42
+L55: inc @r6
+bne L35
+jsr L59
+rts
+jsr @r5
+L56: lea X4, @r7
+jmp D0
+bne L10
+add L57, L56
+sub L25, L22
+prn 393
+cmp L57, @r7
+bne D0
+cmp L13, @r3
+mov L41, @r7
+jmp L59
+jmp L59
+jsr @r1
+not L40
+L57: lea L12, L58
+L58: prn L15
+L59: jsr L12
+cmp -261, -473
+red L26
+jsr @r5
+stop
+D0: .data -56,148,188,-255,-338,287,-356,406,-143,127
+D1: .data -161,-231,-106,491,200,265,301,491,-5,-194
+D2: .data 3,26,55,-466,-397,-159,246,-230,77,-368
+D3: .data 330,-181,-373,112,327,333,-406,-204,-177,-496
+D4: .data 208,-60,-189,-87,239,225,7,-204,-209,-435
+D5: .data 271,-87,-399,451,52,-25,-251,286,39,-414
+D6: .data 221,123,166,-273,301,436,-280,439,276,-368
+D7: .data -91,-315,-207,-402,-77,-439,-467,480,-179,308
+D8: .data 147,-67,487,320,-348,-11,-193,355,-492,204
+D9: .data 126,117,-262,489,387,202,-428,385,2,-448
+S0: .string "fedcpkzhbkikhewzplo"
+S1: .string "yewzghhx"
+S2: .string "ypjhsdnmtipbcneae"
+S3: .string "masxvc"
+S4: .string "vrafikazkhhrvhxwn"
+S5: .string "zichikitawhphnse"
+S6: .string "ycsutqq"
+S7: .string "iqdaqakxhu"
+S8: .string "vktsdsmq"
+S9: .string "dwueborjwdsslpy"
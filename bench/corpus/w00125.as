@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r7
+    prn 92
+endmcro
+mcro m1
+    sub @r3, @r4
+    prn 93
+endmcro
+mcro m2
+    sub @r3, @r4
+    prn 34
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 40
+endmcro
+mcro m4
+    sub @r3, @r5
+    prn 4
+endmcro
+cmp 421, @r3
+L0: sub @r1, @r2
+red L0
+m1
+not @r1
+bne @r1
+cmp 120, L0
+bne @r0
+mov @r6, @r5
+red @r0
+clr L0
+mov L0, @r6
+prn @r7
+red @r4
+L1: dec @r4
+prn @r7
+dec @r3
+inc @r3
+jsr @r6
+inc @r7
+jsr L1
+rts
+L2: inc L1
+L3: sub @r7, @r4
+rts
+m3
+not X0
+mov @r7, @r7
+clr L1
+clr @r7
+red @r2
+rts
+lea L3, @r0
+L4: clr @r6
+clr L0
+m0
+clr L1
+inc @r2
+not L3
+red L1
+m0
+not @r5
+add @r0, @r4
+prn @r2
+rts
+sub @r7, @r1
+rts
+jsr L4
+m4
+jmp @r5
+not L1
+jsr L0
+sub -445, @r6
+jmp @r4
+not @r3
+not L21
+clr @r0
+prn -20
+jsr @r7
+L5: mov @r2, L2
+m1
+not @r7
+L6: clr L5
+mov 267, @r2
+sub -279, L1
+L7: lea L3, @r0
+jmp @r6
+not @r1
+jmp @r5
+red X1
+bne @r7
+jmp L2
+m3
+rts
+inc @r2
+m0
+rts
+jsr @r7
+sub -347, @r4
+inc L5
+m3
+L8: sub -465, L47
+rts
+red @r7
+jmp @r3
+L9: lea S8, @r3
+clr L6
+inc @r7
+L10: red L0
+L11: red @r4
+bne @r0
+jsr L10
+m0
+clr L4
+L12: bne @r3
+m2
+cmp D0, L6
+dec L2
+lea L12, @r4
+L13: inc L1
+jmp @r0
+not @r4
+L14: mov @r6, L8
+clr X2
+sub L49, L3
+dec L13
+jmp @r6
+lea L6, @r2
+not @r0
+dec @r6
+lea L7, @r7
+m3
+add -278, L9
+clr L1
+lea L12, L4
+not @r3
+prn @r6
+sub L2, @r5
+jmp L48
+jmp @r3
+not L3
+rts
+m3
+m4
+jsr @r7
+L15: dec @r5
+clr L4
+cmp X3, @r4
+m2
+cmp -380, 17
+m3
+inc L21
+mov -2, @r7
+mov -104, @r1
+jmp D0
+m3
+prn @r1
+red L9
+L16: red L15
+lea L13, @r5
+dec L2
+clr L3
+prn L3
+L17: clr L1
+lea L2, L13
+cmp L9, L10
+red L11
+jsr @r6
+lea L14, L7
+not L40
+lea L16, @r4
+not @r3
+rts
+sub -337, L1
+add -239, L12
+L18: add L7, L15
+prn -494
+L19: lea L6, @r2
+L20: sub @r1, @r3
+L21: clr D0
+m1
+m2
+mov 411, L7
+prn L17
+m3
+jsr L11
+red @r6
+cmp 370, @r2
+jsr L10
+clr L36
+L22: cmp 349, @r0
+L23: add @r4, L18
+red @r4
+prn @r2
+cmp L29, @r5
+lea S9, @r4
+sub -142, @r7
+cmp 144, @r7
+m0
+jmp @r7
+m4
+m0
+clr L3
+prn @r2
+prn @r6
+bne L16
+m4
+jsr L13
+add -237, L20
+add L7, @r1
+dec @r7
+L24: not L23
+prn @r4
+rts
+rts
+inc L9
+cmp L4, L6
+rts
+red @r1
+cmp -293, L12
+inc D0
+L25: jsr L3
+lea L16, L3
+not @r5
+m4
+not L59
+not @r4
+dec @r2
+m2
+m0
+sub 487, @r0
+rts
+red @r4
+clr D0
+bne @r6
+add @r3, @r5
+jsr @r2
+not @r5
+prn -308
+lea L16, L23
+cmp @r5, -314
+cmp @r7, 280
+L26: prn 218
+L27: rts
+bne @r6
+bne L18
+jmp @r0
+clr @r7
+red S2
+red L0
+prn L2
+dec @r4
+L28: not L19
+jsr L1
+inc @r4
+sub @r2, L21
+rts
+bne @r5
+inc @r6
+bne L16
+clr @r3
+jsr L15
+prn L25
+L29: clr @r2
+add L0, @r7
+red L28
+bne @r1
+cmp @r7, @r1
+jsr L19
+L30: bne L2
+L31: jmp L22
+add @r7, @r1
+L32: rts
+inc L10
+dec L17
+L33: dec @r1
+cmp @r3, @r2
+jmp @r2
+inc @r5
+not @r2
+jmp @r2
+lea L27, L28
+sub -315, @r1
+sub @r3, @r2
+dec @r4
+cmp -159, 331
+m3
+dec L25
+not @r1
+L34: mov @r0, L6
+L35: bne @r3
+lea L0, @r1
+jsr L2
+bne L13
+dec @r6
+L36: jmp @r5
+sub @r5, @r0
+cmp 278, L9
+jmp D0
+inc L8
+add L26, L12
+add -475, L6
+inc @r3
+m0
+L37: add @r3, @r6
+sub 138, @r0
+mov L23, L36
+L38: cmp @r3, @r6
+red L17
+inc L34
+lea L0, @r0
+lea L5, D0
+cmp L27, 104
+not L24
+m3
+mov -429, L23
+bne @r0
+sub @r3, @r0
+clr L30
+clr L25
+add @r3, @r2
+m3
+cmp @r2, @r2
+sub 103, @r3
+not L35
+clr @r1
+jsr @r7
+inc @r5
+sub @r2, @r5
+mov -21, @r0
+cmp 75, 294
+jmp @r7
+jsr L5
+cmp L2, @r1
+cmp @r3, -187
+jmp L31
+sub 339, @r0
+red @r3
+m2
+inc @r0
+jsr @r5
+L39: not @r2
+sub D0, L18
+dec L2
+not L5
+bne @r0
+bne S8
+L40: mov L32, @r7
+lea D0, L39
+prn L19
+rts
+jmp @r0
+red L15
+L41: cmp @r1, -69
+mov L31, L6
+sub -309, @r6
+jsr S9
+red L30
+bne L34
+red L27
+jsr @r0
+inc D0
+jmp L8
+clr S6
+jsr L27
+dec L17
+inc @r0
+jsr L20
+L42: prn @r1
+L43: clr L3
+jsr @r2
+L44: add @r4, @r0
+L45: not L51
+inc @r3
+inc @r1
+clr S4
+sub L52, @r0
+cmp -187, L40
+jmp @r0
+L46: jmp @r2
+bne @r0
+dec L15
+mov L53, @r5
+jsr L36
+jmp L52
+dec @r7
+prn 381
+L47: rts
+m3
+m2
+jsr L17
+add @r7, @r1
+inc S8
+rts
+mov 487, @r4
+inc @r0
+L48: jmp L15
+L49: jsr @r6
+bne @r7
+prn L48
+not @r0
+mov @r1, L11
+cmp -263, @r0
+L50: mov -464, @r0
+L51: clr @r7
+inc L28
+m3
+L52: not @r3
+inc L29
+clr S1
+lea L2, @r4
+inc @r6
+jmp L37
+sub @r1, L7
+bne L48
+m3
+inc @r4
+L53: add L13, @r0
+inc L29
+jsr L3
+cmp -484, @r1
+jsr @r3
+not L39
+L54: lea D0, @r5
+cmp @r0, L15
+clr L2
+jsr @r5
+inc L46
+red @r6
+m2
+inc @r3
+mov L26, @r5
+bne L56
+jmp L16
+clr L30
+inc L56
+mov 178, L35
+m3
+L55: rts
+jsr S2
+rts
+rts
+lea S5, @r4
+not L51
+L56: sub L41, L57
+jsr @r5
+rts
+lea L46, @r7
+add @r4, X4
+prn 117
+cmp @r7, L44
+L57: bne @r5
+rts
+L58: clr L33
+m1
+add @r4, L55
+L59: inc @r2
+prn D0
+dec @r3
+m0
+stop
+D0: .data -6,126,-26,266,-87,268,389,-308,-4,345
+D1: .data -321,172,246,-421,-358,41,-103,-44,-414,-208
+D2: .data -423,-311,-438,-310,-384,461,-460,214,214,-405
+D3: .data -78,428,-84,-446,384,-146,-500,-227,172,-391
+D4: .data -153,152,46,275,-198,-315,87,-168,-316,497
+D5: .data -21,-442,-183,414,350,321,-273,204,-143,-58
+D6: .data -417,-423,155,-386,-8,313,301,-199,457,403
+D7: .data 464,-19,412,287,332,305,141,37,431,186
+D8: .data 229,-383,-28,-458,-369,177,-123,-282,337,233
+D9: .data 49,346,-26,-125,-198,-299,-243,61,-251,-386
+S0: .string "d"
+S1: .string "snagxkxftpyv"
+S2: .string "sqdmlcijrtfrqir"
+S3: .string "nyfthqxnmofkm"
+S4: .string "qbynxnyqpjnhif"
+S5: .string "kseuwuozytt"
+S6: .string "qwzisyqozgcz"
+S7: .string "uwybpoxicj"
+S8: .string "yctqbotkjineexipq"
+S9: .string "wnncirfoke"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r2
+    prn 62
+endmcro
+mcro m1
+    sub @r7, @r5
+    prn 60
+endmcro
+mcro m2
+    sub @r5, @r2
+    prn 99
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 17
+endmcro
+mcro m4
+    sub @r5, @r4
+    prn 29
+endmcro
+clr @r4
+cmp L0, @r5
+not @r2
+red @r4
+L0: jmp @r5
+jmp @r2
+dec L0
+lea L0, @r0
+prn -453
+L1: add @r1, @r2
+sub 170, L1
+dec L1
+inc @r3
+sub 113, @r0
+bne L1
+cmp L1, @r1
+prn 284
+m4
+clr @r0
+cmp @r2, L1
+lea L0, L1
+sub L0, @r4
+dec @r7
+jsr @r7
+dec L0
+L2: inc @r7
+bne @r3
+lea L14, @r1
+jsr L2
+inc L0
+bne L0
+clr L2
+lea L0, @r3
+not @r4
+jsr @r3
+add @r5, @r5
+inc @r6
+not @r7
+rts
+not @r3
+L3: red L2
+bne @r3
+inc L0
+mov @r2, L3
+m1
+sub 333, @r1
+cmp L0, L0
+lea L0, @r5
+sub L2, @r6
+dec @r4
+mov 503, @r3
+cmp -175, @r7
+jsr L2
+prn 283
+lea L5, @r1
+red @r7
+m3
+red L0
+mov @r3, @r6
+mov -307, L1
+inc @r4
+rts
+add L1, L2
+mov L2, S2
+red @r7
+L4: prn @r3
+mov @r4, L1
+dec L3
+prn L0
+prn L2
+L5: cmp @r5, 103
+dec L5
+jmp L5
+dec L0
+jmp @r6
+not L0
+m1
+cmp @r2, L2
+dec L5
+rts
+sub -456, @r5
+rts
+L6: dec L3
+lea L6, @r5
+m1
+dec L0
+m0
+clr @r2
+m1
+prn 126
+m1
+m3
+L7: bne L6
+mov -215, L5
+m1
+lea L2, @r0
+jmp @r3
+L8: lea L6, L15
+L9: inc @r4
+dec @r7
+red @r2
+m4
+not @r6
+rts
+jmp @r1
+m4
+jsr @r2
+sub @r4, @r7
+L10: jmp @r6
+dec L6
+sub @r5, @r7
+jmp @r3
+cmp -19, @r0
+add -190, L1
+mov L9, @r0
+clr @r2
+L11: bne @r2
+L12: prn -385
+m1
+lea L12, L9
+not @r7
+prn -208
+clr L7
+cmp @r5, -411
+jmp L12
+bne L7
+prn 473
+prn 376
+sub @r6, @r2
+clr L12
+m1
+add -16, @r3
+L13: jsr @r1
+sub 241, @r1
+clr L6
+add @r0, L0
+m4
+red @r4
+L14: jsr @r3
+mov -166, L3
+dec @r5
+red L11
+m1
+add L7, @r7
+mov L5, @r1
+not @r0
+mov L10, L1
+prn L14
+m2
+mov @r1, D0
+clr L1
+L15: mov @r2, @r5
+red L14
+inc L6
+mov @r2, @r0
+cmp L15, 506
+m1
+jsr L9
+bne L15
+bne L13
+cmp @r0, @r7
+clr L8
+inc @r3
+jsr L10
+sub 429, L13
+L16: jsr @r1
+L17: prn @r4
+rts
+bne L4
+bne L14
+prn L13
+lea L2, @r7
+cmp -123, @r3
+m2
+prn @r2
+clr @r6
+L18: rts
+mov X0, L14
+cmp L14, X1
+L19: lea L5, @r6
+prn -492
+lea L18, D0
+bne L57
+bne L5
+red @r0
+red @r6
+prn @r6
+sub L2, L6
+L20: sub L15, @r2
+red @r3
+mov L10, L13
+prn -18
+m4
+sub -216, @r4
+m3
+clr L56
+lea L17, L15
+clr @r6
+cmp L19, 323
+bne @r3
+rts
+jsr @r5
+jsr L2
+sub L12, D0
+mov L13, @r4
+jsr @r4
+mov L12, @r7
+clr @r5
+m4
+L21: sub -320, @r4
+lea L21, L15
+m3
+dec L1
+m4
+L22: add @r7, @r6
+lea L18, L3
+bne @r3
+L23: sub L7, @r4
+clr @r0
+red L15
+lea L5, D0
+dec @r4
+m3
+sub -313, @r2
+jsr @r2
+prn 377
+L24: jmp L15
+rts
+sub @r7, L14
+L25: jmp L5
+clr L47
+dec @r0
+clr L4
+prn @r5
+rts
+lea L9, L15
+m3
+dec L10
+L26: red @r3
+lea S1, @r6
+mov @r2, S1
+m4
+L27: sub L22, L8
+m0
+dec L19
+L28: prn @r0
+lea L18, @r0
+cmp @r0, -22
+clr L20
+rts
+lea L15, @r2
+lea L27, L10
+jmp L16
+bne L14
+L29: bne @r4
+sub L20, @r2
+dec @r5
+mov @r6, @r7
+dec @r5
+m4
+jmp L27
+jsr @r5
+m2
+prn @r6
+add -183, L17
+bne L17
+dec @r4
+L30: lea L30, L16
+not L20
+red L16
+m1
+m2
+clr L9
+clr @r7
+red L43
+inc L0
+not L12
+sub L18, @r3
+L31: inc @r6
+L32: sub S9, @r7
+prn -314
+jsr L35
+L33: add L14, @r1
+lea L0, @r6
+not @r7
+inc @r3
+mov -12, L19
+L34: jsr @r5
+add 499, @r7
+cmp @r4, -28
+lea D0, @r4
+L35: clr L30
+L36: lea D0, @r0
+rts
+clr L14
+clr D0
+L37: cmp 395, L34
+L38: sub L29, @r4
+sub @r5, L34
+m1
+not L10
+L39: dec L53
+add @r1, L12
+clr @r7
+jmp @r6
+prn -185
+add L35, L25
+cmp L37, L59
+jsr @r2
+lea L35, @r0
+lea L17, @r7
+red L4
+clr @r2
+add -261, L1
+add -55, @r5
+L40: cmp @r2, L28
+prn X2
+prn @r3
+sub @r3, L21
+cmp -356, L18
+dec L41
+L41: bne L39
+dec @r6
+cmp -345, @r3
+inc @r5
+m0
+lea L10, L3
+red L7
+rts
+red L21
+add L24, L28
+m0
+clr @r7
+m1
+L42: jmp @r3
+L43: add 491, L33
+L44: add 221, @r2
+lea L9, @r5
+inc @r5
+add @r2, @r4
+clr L58
+mov 172, @r7
+bne L43
+L45: clr @r5
+mov L7, @r3
+not L21
+rts
+clr L44
+L46: add -42, @r1
+m0
+clr L34
+lea D0, @r2
+add 178, @r3
+cmp -84, -201
+jmp L47
+mov -236, @r4
+sub L24, @r5
+jmp L35
+L47: bne @r6
+not @r1
+inc @r6
+L48: clr L1
+red @r1
+jsr @r7
+sub 468, @r1
+jmp @r2
+jsr @r5
+bne L9
+bne @r0
+mov L23, @r2
+mov @r2, @r1
+mov -381, @r7
+m4
+add @r6, @r6
+L49: bne @r6
+clr @r7
+rts
+red L2
+bne L28
+jmp L1
+bne L34
+L50: prn @r5
+not @r6
+L51: not @r2
+sub X3, D0
+L52: add -170, D0
+sub -439, @r0
+sub L52, X4
+mov 315, L33
+add D0, @r7
+m4
+clr @r7
+lea L59, @r0
+jsr L52
+prn L7
+L53: not L4
+clr @r6
+clr @r1
+jsr @r5
+L54: inc L24
+red L12
+inc L57
+not @r2
+cmp L58, @r3
+add L13, L0
+cmp @r1, @r4
+dec @r5
+mov @r4, L17
+dec @r7
+jsr L29
+dec L26
+inc L4
+jmp @r3
+rts
+jmp @r0
+L55: mov 10, L27
+inc D0
+sub L41, @r6
+mov -61, @r0
+jsr L13
+jsr @r6
+L56: not L58
+sub -45, L21
+red L31
+bne @r5
+red @r3
+mov @r1, L45
+m0
+cmp @r0, L59
+jmp S7
+sub L12, @r2
+bne @r5
+L57: dec L58
+sub @r6, @r6
+L58: lea S1, @r1
+L59: dec @r5
+prn 211
+add D0, @r0
+mov S1, @r5
+lea D0, @r0
+stop
+D0: .data -8,19,327,-497,-385,254,175,-257,-104,-241
+D1: .data -66,-192,-173,-126,-236,98,417,191,-164,195
+D2: .data -427,-426,-414,-10,-99,449,-323,258,-227,-378
+D3: .data -36,-18,76,-274,-177,361,369,230,210,-174
+D4: .data 434,-295,484,-405,60,225,-117,237,-111,-14
+D5: .data 274,191,156,-235,-358,-403,41,275,308,-304
+D6: .data -87,-59,-90,492,321,-368,366,266,152,313
+D7: .data -49,404,-461,-205,-462,456,80,264,-327,148
+D8: .data -349,335,-50,-271,113,-378,208,393,379,438
+D9: .data -256,-392,-281,-170,314,19,-477,88,-170,-276
+S0: .string "fzhvreaaayiyj"
+S1: .string "xqeeupuqiyyaa"
+S2: .string "zmnx"
+S3: .string "hrdafzrsub"
+S4: .string "thgkbnrzuuxgmanko"
+S5: .string "wd"
+S6: .string "sfaidiaylwuqefb"
+S7: .string "emaojpsaiusk"
+S8: .string "jsjncjfqj"
+S9: .string "ssus"
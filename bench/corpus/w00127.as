@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r5
+    prn 1
+endmcro
+mcro m1
+    sub @r4, @r7
+    prn 58
+endmcro
+mcro m2
+    sub @r7, @r0
+    prn 64
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 93
+endmcro
+mcro m4
+    sub @r7, @r2
+    prn 85
+endmcro
+not S1
+mov @r5, @r3
+rts
+jmp L0
+red @r2
+jmp @r0
+cmp L0, -244
+cmp -4, @r6
+jmp L0
+L0: red @r5
+jsr @r3
+cmp X0, @r5
+m2
+prn @r0
+bne @r4
+L1: dec @r3
+jmp @r3
+jmp L1
+L2: cmp 211, X1
+jmp L2
+mov @r2, L1
+mov @r3, L2
+jmp L1
+mov L2, L1
+red L0
+jsr L1
+L3: sub @r6, L3
+prn @r0
+clr @r4
+clr @r7
+red @r7
+prn @r1
+rts
+rts
+L4: mov 367, L1
+bne L1
+red L1
+cmp D0, L39
+prn -67
+sub @r2, @r6
+dec @r3
+L5: cmp @r2, 251
+inc @r1
+sub @r3, L0
+mov -389, L5
+L6: clr @r4
+sub L4, @r3
+cmp @r1, @r1
+rts
+L7: mov @r2, L6
+prn @r0
+add 95, L2
+dec @r3
+rts
+cmp @r0, D0
+bne @r3
+red L3
+not L0
+sub -91, L5
+mov @r6, L2
+prn L5
+bne @r7
+jsr L4
+L8: rts
+sub @r4, @r3
+L9: sub L5, @r4
+L10: jsr L3
+dec @r3
+dec @r5
+mov 92, L4
+m0
+red L5
+lea L2, L9
+rts
+sub L36, L6
+red @r6
+rts
+not @r2
+mov L5, @r1
+dec @r5
+m3
+clr @r3
+lea L6, @r5
+clr L1
+clr @r1
+dec @r6
+not L7
+mov @r0, @r4
+lea L10, @r3
+inc L8
+inc L5
+clr @r1
+clr L6
+sub 431, @r5
+L11: jsr @r5
+m0
+clr @r1
+m2
+inc @r0
+red L9
+inc L5
+not L6
+jmp @r1
+jmp @r1
+dec @r0
+rts
+sub @r6, @r0
+m0
+prn @r3
+add 173, @r7
+m2
+m3
+m1
+bne L3
+m4
+L12: cmp L7, 470
+clr @r5
+jsr L6
+dec L5
+cmp @r1, @r5
+add -368, L8
+rts
+mov 453, @r4
+jmp L1
+cmp 233, @r0
+not L5
+L13: dec L8
+jsr L8
+lea L0, @r6
+prn 471
+dec D0
+cmp S0, @r5
+jsr L2
+L14: add @r6, @r4
+mov L27, @r7
+lea L1, L7
+jsr L11
+bne @r3
+jsr @r3
+dec @r4
+cmp @r6, L12
+red L8
+jsr L10
+add @r7, L37
+cmp @r0, 483
+jsr @r4
+L15: sub -94, L12
+red @r2
+lea L10, @r0
+bne @r0
+not L13
+L16: clr @r4
+m0
+L17: rts
+lea L6, @r6
+clr @r1
+m4
+mov L6, L7
+sub L1, L5
+m4
+inc L12
+L18: red L11
+red @r0
+bne L17
+jmp @r2
+mov @r6, @r7
+sub L2, @r2
+m0
+m3
+cmp 190, -402
+red @r5
+m3
+prn @r1
+m0
+clr @r6
+add 343, L14
+rts
+clr @r1
+L19: inc L15
+rts
+L20: dec @r4
+L21: jsr @r1
+L22: add L10, @r3
+inc L8
+m1
+bne @r7
+bne @r0
+m4
+bne @r2
+m3
+bne L9
+sub -105, L13
+m2
+add 171, @r7
+sub @r7, L7
+lea L3, @r1
+rts
+bne @r4
+m3
+m0
+prn L11
+sub @r3, L14
+L23: add @r0, L13
+jsr L2
+cmp @r5, L0
+jsr @r4
+add 497, L11
+clr L11
+cmp L1, 143
+rts
+jmp @r0
+sub -455, L3
+add L10, @r4
+cmp @r7, @r6
+L24: jmp @r3
+L25: rts
+prn L12
+prn 487
+cmp @r5, -324
+m2
+sub -281, L21
+mov @r6, @r4
+sub @r2, @r5
+clr @r2
+L26: sub @r1, L6
+red S4
+rts
+prn L8
+clr @r6
+m3
+bne L17
+L27: red L9
+not L9
+inc @r5
+red D0
+inc L16
+red @r2
+red @r5
+red @r5
+add @r1, @r7
+L28: mov @r2, L12
+add L23, @r7
+jsr @r7
+add 207, @r1
+bne @r1
+not @r2
+L29: clr L33
+m3
+jmp L21
+L30: sub L41, @r3
+not @r6
+prn 305
+clr L16
+L31: mov @r7, L29
+cmp @r4, 502
+cmp L29, 83
+not L28
+mov @r1, @r0
+L32: jmp @r2
+red @r1
+lea L2, @r1
+sub 382, @r0
+jsr @r0
+not L13
+dec @r4
+jsr @r0
+not L5
+m4
+red L52
+jmp D0
+bne L12
+bne @r5
+lea L29, L32
+not @r0
+cmp L31, @r4
+bne @r2
+L33: prn 292
+bne @r7
+sub 364, L2
+bne @r5
+L34: red @r5
+jmp @r5
+prn 271
+prn L12
+m4
+m1
+cmp L11, @r5
+mov @r2, L28
+clr @r7
+dec @r4
+bne L6
+lea D0, L20
+m4
+L35: mov @r1, @r0
+rts
+mov -388, @r5
+m4
+jmp @r1
+m2
+clr L2
+dec L12
+L36: add @r6, @r6
+jmp L8
+red @r6
+L37: not @r0
+bne @r3
+not @r7
+L38: clr @r5
+jsr L41
+bne @r2
+sub @r6, L9
+add -393, @r0
+not L33
+cmp 24, @r2
+red @r1
+bne @r5
+mov L1, @r6
+cmp L26, D0
+dec L33
+sub @r7, @r2
+jsr @r2
+prn L17
+dec @r6
+jmp L18
+lea L7, @r3
+lea L4, @r4
+bne @r4
+dec @r4
+L39: prn -429
+add L56, L27
+clr L17
+L40: bne @r2
+L41: mov 279, @r6
+L42: add 7, L34
+L43: inc @r5
+add L19, @r3
+rts
+clr @r5
+dec @r6
+red L18
+inc @r1
+not @r5
+rts
+rts
+not @r4
+sub L18, L8
+L44: jmp L7
+not @r2
+inc @r0
+cmp @r5, 346
+jsr L15
+not L24
+m0
+cmp @r3, @r1
+mov L44, L34
+clr L43
+add @r6, @r6
+dec L38
+clr @r3
+L45: lea L20, L35
+L46: sub @r5, @r7
+lea L20, L34
+not S7
+m3
+cmp 283, @r2
+rts
+bne @r5
+red L53
+rts
+add L34, @r0
+L47: jsr @r5
+mov 51, L10
+L48: jmp @r0
+jsr @r6
+red L20
+prn @r2
+prn @r7
+clr @r5
+L49: not @r2
+clr L21
+rts
+prn 52
+cmp @r0, 33
+add -222, L48
+cmp 377, L24
+bne X2
+not @r4
+inc S6
+m2
+sub 229, L9
+bne D0
+m0
+cmp L38, 316
+rts
+cmp 370, @r5
+add @r1, L44
+clr @r5
+cmp 84, @r7
+bne @r3
+add -236, L55
+clr @r1
+L50: bne @r1
+L51: lea D0, @r5
+prn D0
+L52: lea L59, @r4
+rts
+sub @r4, L26
+cmp -439, L17
+sub 135, L59
+lea L45, L18
+rts
+jmp L22
+cmp -405, 131
+m1
+not @r2
+m0
+L53: clr @r2
+m0
+red L47
+cmp @r2, -183
+inc L9
+sub 42, @r0
+dec L41
+L54: inc @r4
+L55: add X3, @r4
+lea S5, @r6
+clr L38
+dec L38
+rts
+jsr L57
+jsr L56
+mov D0, X4
+L56: inc S0
+L57: inc D0
+L58: cmp D0, @r4
+add L59, L59
+not @r3
+dec L59
+L59: red S8
+m4
+stop
+D0: .data -257,-231,201,-474,263,-25,-297,56,-174,-404
+D1: .data -322,-43,-241,-329,382,92,27,387,-491,435
+D2: .data 104,406,394,350,362,-404,-412,-28,-454,-191
+D3: .data -113,-234,-390,500,177,181,123,-342,-13,-475
+D4: .data 98,-385,-346,72,127,76,253,-131,381,-92
+D5: .data 107,1,223,86,3,-110,112,209,-104,-395
+D6: .data -8,-101,53,-220,480,-151,-140,242,134,-312
+D7: .data 391,-176,159,366,372,-198,-382,227,141,-335
+D8: .data 357,-460,-112,432,115,-467,-90,-410,-479,129
+D9: .data -176,107,495,8,240,345,473,-283,-350,-241
+S0: .string "uxbhpvlsrfqrns"
+S1: .string "cwzftmkgbb"
+S2: .string "nboeyamxamgobjvqmgg"
+S3: .string "inhktbhvidx"
+S4: .string "tkvpsogbtyooif"
+S5: .string "pvdhvqxnqzkiscqlegmt"
+S6: .string "h"
+S7: .string "jru"
+S8: .string "ilmzo"
+S9: .string "ebbdk"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r7
+    prn 71
+endmcro
+mcro m1
+    sub @r0, @r0
+    prn 57
+endmcro
+mcro m2
+    sub @r1, @r6
+    prn 29
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 70
+endmcro
+mcro m4
+    sub @r1, @r0
+    prn 10
+endmcro
+bne @r6
+inc @r7
+lea L0, L0
+L0: jsr D0
+mov 427, L0
+m1
+red @r2
+mov L0, @r0
+sub -26, @r6
+inc S6
+mov @r2, L0
+jsr L0
+cmp @r1, -185
+dec @r5
+add @r5, @r3
+lea L0, L0
+L1: not L1
+sub @r4, L0
+red @r6
+rts
+add 332, @r4
+m0
+not L1
+add L0, @r4
+m2
+sub -176, @r5
+L2: cmp L1, X0
+not @r3
+red L2
+prn @r5
+clr @r2
+inc @r7
+cmp @r7, @r6
+jmp @r7
+prn L0
+m4
+prn 46
+prn @r4
+rts
+sub -31, L1
+L3: sub @r7, @r5
+L4: sub -46, L44
+jmp L4
+cmp @r1, L0
+lea L0, L3
+jsr @r6
+jmp L3
+L5: not L4
+rts
+sub -299, L0
+L6: sub @r3, @r3
+clr L2
+red @r2
+sub L6, @r0
+lea L4, L6
+not @r5
+L7: mov 297, @r1
+prn -98
+red L7
+L8: cmp -324, L2
+not @r2
+clr L7
+lea L4, @r2
+m1
+dec L4
+cmp 61, L1
+add @r5, L3
+jsr L6
+m1
+bne L2
+red @r4
+m2
+rts
+inc L2
+not L5
+not L3
+sub @r5, L1
+not @r7
+clr @r4
+jmp L3
+jsr L6
+prn 253
+L9: mov 468, L2
+lea L6, @r0
+L10: bne L2
+L11: prn L5
+inc S2
+m3
+cmp @r2, @r3
+m1
+inc @r1
+L12: jsr @r0
+m2
+dec L7
+not @r1
+jsr L10
+add @r2, @r1
+lea L0, L7
+inc L8
+L13: not @r6
+not D0
+clr @r0
+add L7, @r0
+bne @r3
+sub -308, @r2
+prn L10
+L14: sub @r7, @r7
+mov -308, @r3
+cmp L3, @r7
+L15: mov -339, @r3
+L16: mov @r0, L1
+jsr L14
+red @r6
+m4
+mov L3, @r6
+mov -90, @r6
+not L4
+mov -241, L11
+jmp L1
+clr @r5
+add L0, @r6
+m2
+jsr L3
+not @r4
+clr L6
+add @r7, L0
+dec L39
+L17: rts
+m4
+clr @r2
+sub 44, @r5
+sub -272, @r2
+jmp L50
+L18: inc L3
+m1
+jmp L6
+rts
+add L9, L1
+m1
+mov @r2, L18
+inc L5
+rts
+m0
+jsr @r1
+m0
+clr L17
+m4
+sub 291, L6
+clr @r5
+m4
+clr X1
+jmp @r6
+mov @r7, L17
+L19: jmp L10
+dec @r6
+sub L7, L11
+lea L12, L11
+lea L53, L4
+red @r7
+prn 435
+mov 257, @r7
+rts
+mov @r0, @r2
+jsr @r2
+cmp 354, -77
+red L15
+clr @r1
+jmp L8
+inc @r0
+bne L2
+jmp @r3
+lea L5, @r0
+clr L4
+L20: jsr @r2
+m4
+red L14
+L21: lea L21, @r4
+sub -84, L8
+not @r0
+m2
+prn -306
+sub L1, L2
+clr L17
+cmp @r6, L14
+jmp @r6
+bne L9
+m2
+bne L7
+clr D0
+clr L19
+red @r2
+cmp L14, -202
+red @r7
+cmp L0, @r6
+sub @r0, @r3
+dec @r4
+L22: dec @r0
+jmp L0
+mov 130, L13
+m3
+add L22, @r1
+jmp @r6
+red L14
+bne L13
+mov L1, L5
+sub 327, @r6
+not @r5
+L23: not @r0
+m4
+m0
+prn L12
+clr @r4
+inc @r1
+inc @r2
+L24: jsr @r7
+mov @r1, L15
+L25: rts
+add @r6, @r5
+bne @r5
+jmp L4
+m4
+jsr @r0
+m2
+clr @r4
+red L22
+rts
+jsr @r3
+mov @r7, @r3
+lea L7, @r4
+red @r4
+L26: mov 457, @r7
+cmp L19, @r2
+jsr @r4
+add L6, @r7
+jsr @r0
+prn @r7
+rts
+clr @r0
+rts
+inc S7
+add L18, @r6
+L27: bne @r1
+L28: inc L20
+dec @r6
+red L38
+inc @r1
+m0
+rts
+m1
+prn 228
+dec L5
+dec X2
+sub @r6, @r2
+clr @r0
+L29: sub L29, @r2
+prn L11
+jsr L29
+dec @r6
+prn -436
+add -353, @r3
+prn @r6
+red L26
+clr L17
+prn @r4
+L30: inc L1
+L31: mov L21, L21
+m2
+not @r7
+sub 374, L22
+L32: jsr @r6
+bne @r1
+mov -175, @r2
+clr L9
+sub -145, L3
+prn -396
+add S2, @r0
+inc @r3
+bne S1
+add @r7, L18
+m0
+sub @r0, L25
+jmp X3
+red @r2
+red @r6
+jsr L12
+prn @r4
+sub L53, L19
+red L4
+L33: clr L45
+rts
+m4
+cmp 488, -161
+red @r6
+add 339, S4
+mov 459, S0
+jmp L11
+L34: prn -58
+L35: dec L17
+rts
+rts
+cmp @r6, 76
+dec @r4
+jsr L1
+L36: not @r3
+jmp L14
+dec L54
+inc @r3
+rts
+add L21, @r3
+cmp 381, S1
+red @r4
+inc L25
+jmp @r6
+jsr L18
+clr @r6
+add L7, L28
+prn @r5
+jmp @r5
+lea L36, L7
+cmp @r5, @r1
+L37: dec S4
+m0
+inc L36
+clr L11
+add @r5, L28
+L38: bne L37
+red L28
+lea L45, L0
+m2
+add @r2, @r2
+rts
+not L9
+red @r5
+jmp L24
+L39: rts
+clr @r0
+cmp @r3, L17
+prn 371
+cmp L23, L48
+jmp L5
+jmp @r4
+L40: inc L16
+bne @r1
+L41: bne L15
+L42: sub -399, @r4
+L43: inc L32
+jsr @r2
+rts
+prn -77
+not @r2
+cmp L10, L30
+L44: add 316, @r1
+jsr @r3
+m0
+jmp L52
+not @r3
+inc L43
+L45: mov S6, L52
+rts
+m1
+jsr L17
+cmp @r6, L25
+inc @r7
+mov L13, L27
+add 310, @r5
+sub @r4, L49
+mov @r7, @r3
+L46: jmp D0
+cmp S8, 313
+m3
+mov @r5, @r1
+add -147, L45
+cmp @r1, @r1
+m1
+L47: clr @r2
+m4
+L48: mov 259, @r0
+prn 214
+inc @r1
+jmp @r1
+L49: bne L37
+rts
+jmp L36
+clr L16
+clr L15
+L50: clr L6
+prn @r3
+jsr @r4
+lea L56, L59
+not @r3
+mov @r5, @r0
+L51: cmp @r5, L43
+rts
+lea L27, L26
+sub @r5, @r2
+m2
+dec L51
+jmp @r2
+red L29
+L52: not @r2
+lea D0, @r6
+jsr L45
+lea L56, @r3
+mov @r6, @r5
+jmp L0
+prn @r3
+clr @r1
+mov L15, S6
+L53: add @r3, L23
+cmp @r5, 401
+inc @r0
+red @r2
+mov -285, @r7
+add 427, L4
+clr @r7
+L54: lea L7, @r1
+L55: inc L57
+rts
+jmp L35
+jmp L17
+lea L32, @r6
+lea L0, L48
+inc L13
+cmp @r7, @r4
+jsr L6
+L56: jmp L36
+L57: prn S6
+lea L58, @r1
+rts
+red @r7
+jsr @r7
+bne @r4
+mov -230, D0
+lea D0, @r1
+cmp @r4, @r5
+sub @r1, L6
+add X4, @r7
+add 359, L59
+L58: lea L59, L22
+L59: lea L44, L31
+stop
+D0: .data 335,-116,-203,282,-190,-138,-324,-20,-176,-119
+D1: .data -92,185,-252,238,119,145,187,467,-218,-278
+D2: .data -221,474,-151,-394,416,117,265,364,258,-380
+D3: .data 275,-410,492,174,161,-94,210,-43,-17,118
+D4: .data -331,390,-474,314,-325,-105,188,50,-10,-458
+D5: .data 422,196,-399,303,-443,432,182,207,338,-5
+D6: .data -259,-158,155,-441,460,245,-291,-250,98,-299
+D7: .data 137,407,-29,187,-314,-167,432,479,-491,241
+D8: .data 155,-315,-271,327,198,412,-203,127,323,-287
+D9: .data 343,-276,396,-133,-6,-428,-19,158,131,-500
+S0: .string "wvxyjydwnpqih"
+S1: .string "dimtnpga"
+S2: .string "lgmmrphv"
+S3: .string "evngu"
+S4: .string "dydskcvuphob"
+S5: .string "hmiahweumxsooe"
+S6: .string "ifrku"
+S7: .string "hncpimemke"
+S8: .string "mygoyy"
+S9: .string "mnnwthvzauavthcswfye"
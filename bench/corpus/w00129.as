@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r2
+    prn 9
+endmcro
+mcro m1
+    sub @r4, @r1
+    prn 55
+endmcro
+mcro m2
+    sub @r3, @r4
+    prn 27
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 46
+endmcro
+mcro m4
+    sub @r3, @r6
+    prn 34
+endmcro
+cmp 296, -391
+rts
+jmp L0
+red L0
+lea L0, L0
+clr L41
+L0: prn L0
+jsr L0
+L1: mov 7, @r2
+add L0, L1
+m2
+cmp 223, @r7
+L2: add L2, L0
+inc @r7
+L3: bne D0
+jsr L3
+clr @r6
+red S1
+prn L3
+L4: mov -348, @r5
+rts
+lea L2, @r5
+jmp @r4
+rts
+L5: lea L5, L4
+inc @r5
+inc @r0
+m1
+jsr L4
+not L0
+L6: cmp @r7, -469
+sub @r7, @r7
+L7: jmp L1
+bne @r1
+m0
+m2
+jsr @r6
+red @r6
+clr L2
+dec L0
+lea L0, L7
+inc L6
+rts
+prn @r4
+jsr @r5
+sub -440, L6
+rts
+L8: mov 303, L2
+prn @r5
+sub -430, @r1
+inc @r3
+dec @r4
+prn @r3
+jmp X0
+L9: bne @r2
+clr L5
+L10: add @r7, @r4
+cmp @r6, @r1
+inc L4
+cmp L4, 207
+dec @r6
+inc @r3
+cmp @r1, @r0
+clr L9
+clr L2
+rts
+jmp @r0
+inc @r7
+bne @r5
+red L4
+m2
+bne @r2
+cmp @r3, -479
+L11: inc @r1
+jmp L7
+clr @r5
+m3
+prn @r5
+L12: red @r0
+L13: cmp -44, @r2
+lea L4, L13
+add L10, @r2
+not L12
+m2
+dec L38
+jmp @r2
+add 38, L2
+cmp L3, -129
+clr @r3
+cmp @r2, 40
+jsr L7
+m4
+clr @r1
+not @r0
+red L10
+L14: bne @r7
+L15: mov @r4, @r6
+cmp -256, @r7
+add -306, L14
+lea L5, L57
+bne L47
+clr L12
+L16: rts
+sub 24, @r2
+sub @r1, L0
+m3
+add @r5, L4
+rts
+prn X1
+inc L13
+rts
+lea S3, @r2
+bne @r0
+jmp @r3
+add L13, @r6
+clr L10
+sub @r4, L15
+cmp @r2, @r7
+L17: dec L3
+red L4
+prn @r2
+prn -94
+sub L14, @r1
+mov L15, @r3
+cmp 486, @r6
+L18: not L0
+lea L12, @r0
+L19: clr @r4
+dec L2
+jmp @r2
+m4
+cmp -337, 500
+rts
+mov L2, @r6
+sub -293, @r5
+m3
+red L17
+red L6
+jsr @r0
+lea L11, @r3
+lea L7, @r7
+jsr @r4
+prn L12
+prn L15
+jmp @r2
+rts
+bne L3
+cmp -487, @r5
+L20: inc L17
+L21: not L4
+cmp -305, L4
+dec L16
+L22: mov L5, @r6
+lea L0, L7
+jmp L2
+red L17
+sub -327, L16
+sub @r7, @r4
+add @r5, @r5
+L23: inc @r4
+L24: inc @r7
+m3
+cmp @r6, L59
+not L10
+add -134, L2
+rts
+dec @r5
+L25: dec @r7
+cmp L20, L9
+jmp @r7
+not L1
+not @r3
+add L7, S1
+m4
+m0
+jmp @r5
+bne L19
+cmp L11, L4
+inc L6
+jmp @r1
+lea L9, @r2
+add @r7, L25
+rts
+jsr L19
+m1
+m1
+bne @r4
+L26: bne L0
+clr L22
+add L17, L14
+add L3, L18
+lea L35, L57
+mov L18, @r7
+bne @r5
+jmp @r6
+inc @r4
+m2
+prn @r5
+inc L5
+add @r4, @r3
+prn L4
+prn 285
+not @r1
+lea D0, L18
+mov S5, L5
+cmp -436, L20
+mov 476, @r7
+m2
+sub @r1, L13
+jmp @r4
+rts
+m1
+inc @r1
+L27: not L17
+m3
+add @r0, L23
+rts
+L28: not @r1
+bne X2
+red @r6
+clr @r7
+bne @r3
+red @r5
+clr L6
+dec @r5
+lea L8, @r5
+sub 156, @r5
+add L32, L16
+L29: cmp @r7, L29
+L30: cmp @r6, @r5
+sub L26, @r1
+clr L2
+cmp -454, @r7
+rts
+sub L8, L14
+prn 173
+prn -390
+clr @r1
+red L1
+inc L18
+L31: rts
+lea L20, L27
+cmp 309, @r0
+add L29, L23
+lea L4, @r4
+m0
+L32: clr D0
+not @r1
+L33: add 75, @r6
+add 85, @r2
+lea L2, @r1
+rts
+clr S7
+L34: not L15
+L35: rts
+red @r0
+cmp 149, @r0
+jsr L11
+lea L2, L56
+rts
+red L5
+clr L10
+dec @r1
+mov L20, L14
+L36: mov @r0, @r1
+red L4
+L37: dec @r3
+lea L30, L5
+m4
+L38: cmp @r1, @r4
+jmp L27
+L39: jmp L39
+jsr L9
+cmp -253, L1
+cmp -263, L0
+jsr @r3
+mov L0, @r0
+red L48
+sub @r0, L31
+sub @r5, @r6
+dec L27
+red @r0
+lea L4, @r5
+not @r2
+L40: jmp L34
+m0
+not L11
+m0
+jsr @r0
+L41: dec L11
+add L13, D0
+inc L19
+add @r2, L49
+add @r2, @r4
+jmp L7
+L42: rts
+L43: bne L12
+red L20
+lea L44, L50
+bne @r3
+red L48
+jsr @r7
+red L9
+red @r1
+sub @r7, @r1
+add L21, @r6
+bne @r2
+L44: prn -419
+lea L7, @r4
+jmp L1
+sub @r2, @r5
+cmp -244, 219
+lea L37, L8
+jmp L33
+jsr @r7
+m4
+cmp L24, L36
+jmp L27
+jmp @r0
+m0
+prn 229
+lea L18, L53
+jsr @r4
+not @r7
+jmp L29
+rts
+L45: rts
+L46: cmp @r4, @r4
+red L24
+jsr L33
+sub L15, L21
+rts
+m3
+L47: inc L42
+L48: bne @r2
+m3
+inc @r1
+jsr @r7
+add 211, L30
+m3
+jmp L33
+jsr @r1
+L49: red @r5
+jmp L24
+cmp 204, @r1
+jsr L35
+lea D0, @r4
+red L34
+not L32
+not L1
+not L44
+red D0
+not L25
+prn S4
+clr @r6
+mov L51, @r2
+rts
+bne @r7
+jsr @r0
+sub 346, @r4
+not L21
+rts
+sub 426, @r6
+m3
+add D0, @r5
+m1
+L50: cmp L34, -10
+cmp @r6, 141
+add @r4, L41
+lea L5, L37
+cmp @r2, -193
+m3
+mov @r6, L25
+L51: inc @r1
+not L36
+rts
+jmp D0
+clr @r7
+jmp @r5
+cmp L59, L27
+cmp -111, @r4
+inc @r3
+L52: lea L8, @r1
+not @r5
+mov @r4, L20
+jmp @r3
+bne L26
+cmp -208, 193
+bne L17
+mov @r5, @r7
+lea L0, L18
+m2
+cmp L11, -388
+dec L1
+inc L50
+clr @r4
+mov L29, S8
+prn 17
+mov 260, L41
+dec L38
+mov L22, X3
+clr L19
+L53: jmp L5
+L54: mov -47, @r3
+not L33
+m1
+not L50
+L55: bne @r6
+m3
+prn 453
+jmp D0
+bne @r2
+red L34
+rts
+rts
+m2
+clr @r3
+not L15
+sub L14, @r0
+rts
+prn L45
+m3
+inc L58
+rts
+bne @r1
+add @r3, L55
+L56: red @r7
+sub -438, L12
+m3
+not @r3
+inc @r0
+L57: add D0, L59
+L58: lea L35, S3
+clr L54
+m3
+m3
+red S6
+L59: mov X4, @r0
+rts
+not D0
+stop
+D0: .data 141,-105,-231,108,81,-232,328,-89,353,481
+D1: .data -391,-271,-325,24,-414,-168,116,313,-492,-500
+D2: .data 428,-387,-248,408,-79,-222,106,-36,145,-272
+D3: .data -218,410,-266,134,-354,251,-433,-135,-150,-84
+D4: .data -322,172,-165,-79,22,-141,131,265,60,147
+D5: .data -411,441,-245,413,490,-204,15,-418,-499,-487
+D6: .data -128,-59,225,-167,268,485,409,176,16,388
+D7: .data -373,91,-268,-37,-387,-58,329,-49,80,86
+D8: .data 301,-207,122,447,417,390,-161,-40,-420,266
+D9: .data -440,406,-282,297,477,435,-237,148,290,288
+S0: .string "owtugjnqxw"
+S1: .string "tdaibfhzunw"
+S2: .string "f"
+S3: .string "uwiwpnbvawftsehezoo"
+S4: .string "yrmzgt"
+S5: .string "nvutmq"
+S6: .string "izfoexlnofczmmryhj"
+S7: .string "ilapwibvmitzzt"
+S8: .string "iawjr"
+S9: .string "risa"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r4
+    prn 80
+endmcro
+mcro m1
+    sub @r1, @r2
+    prn 54
+endmcro
+mcro m2
+    sub @r5, @r2
+    prn 92
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 22
+endmcro
+mcro m4
+    sub @r5, @r5
+    prn 59
+endmcro
+L0: inc @r7
+rts
+clr @r6
+red L0
+dec @r2
+cmp @r6, @r2
+sub L0, L25
+m0
+prn 126
+inc @r0
+mov L0, L0
+bne @r4
+inc L0
+red @r3
+add L0, @r5
+rts
+bne @r1
+L1: jsr @r5
+prn -422
+lea L28, L1
+cmp @r3, -328
+lea L1, L1
+m2
+sub @r0, @r6
+jsr @r6
+inc L0
+mov 399, @r0
+mov @r2, L1
+rts
+inc L0
+not @r6
+L2: inc L0
+lea L2, @r7
+bne L2
+L3: sub L3, L0
+jmp @r3
+add L0, L0
+prn -427
+rts
+m0
+sub @r7, L0
+clr L3
+mov -254, @r0
+cmp @r1, -2
+not L0
+L4: inc L0
+bne L3
+dec L3
+L5: clr @r5
+cmp L1, 369
+add -50, @r2
+inc @r6
+bne L3
+not @r0
+jsr L1
+rts
+jsr L4
+rts
+L6: rts
+dec L3
+L7: bne L3
+cmp L4, L1
+inc L3
+red @r6
+jsr L1
+bne L4
+mov @r1, @r1
+not L5
+inc @r3
+sub -222, L45
+sub -390, @r4
+jsr L1
+m1
+lea L6, @r0
+sub L4, L5
+inc @r2
+mov S4, L2
+lea L1, L4
+bne D0
+lea L7, @r3
+jsr @r7
+mov 119, @r7
+jsr L1
+m3
+not @r1
+L8: add L5, L6
+not @r2
+jsr @r4
+lea L0, @r4
+rts
+L9: lea L1, @r2
+L10: jmp L10
+red @r5
+inc X0
+not @r7
+not L6
+jmp L3
+not @r3
+m2
+bne @r4
+bne @r2
+cmp L23, @r7
+L11: not @r7
+rts
+sub @r6, L2
+red @r6
+dec @r7
+L12: inc L0
+rts
+m2
+clr @r6
+lea L7, @r3
+cmp L7, @r3
+clr @r3
+mov L10, @r0
+dec L8
+rts
+red L5
+bne @r0
+sub -161, L1
+inc @r1
+sub @r2, L1
+bne @r6
+bne L8
+m2
+cmp L1, -278
+not @r4
+L13: dec @r6
+m2
+not @r3
+dec @r0
+L14: bne L12
+dec L7
+add L6, L13
+sub L1, L4
+m0
+jsr L4
+inc @r4
+inc @r4
+not @r7
+prn @r0
+not L5
+jmp @r2
+prn 443
+m4
+not L0
+jsr L11
+L15: rts
+L16: jsr L1
+mov @r3, L7
+bne L1
+m3
+bne L0
+m4
+cmp @r6, -430
+L17: add @r0, L4
+cmp L16, L10
+prn @r2
+L18: rts
+m4
+inc L1
+m4
+L19: sub -270, L17
+m2
+sub -217, @r6
+mov @r5, @r7
+inc L11
+m1
+not L5
+clr @r2
+sub L18, D0
+mov @r7, S0
+jsr @r3
+jmp L10
+lea L9, @r4
+bne @r6
+sub 189, L16
+lea L9, L19
+L20: prn L4
+L21: lea L10, @r7
+lea L8, @r4
+add L10, L18
+m0
+m4
+sub -341, L9
+mov L39, @r6
+L22: cmp -490, -279
+rts
+not L16
+bne L50
+prn @r6
+bne L13
+jmp @r5
+bne S9
+mov -399, L10
+dec @r0
+bne L18
+clr @r5
+L23: jmp @r5
+cmp -302, @r4
+L24: cmp 319, @r7
+jsr L10
+bne L20
+lea L41, L8
+mov @r1, @r0
+add 326, L18
+clr L8
+prn 352
+lea L3, @r6
+cmp @r6, L14
+jsr @r2
+lea L14, L3
+not S2
+rts
+m0
+add 502, L11
+sub D0, @r0
+red L23
+not L11
+L25: prn -420
+add -342, L17
+cmp 33, -152
+red @r0
+red @r2
+not @r2
+L26: not @r7
+L27: clr S1
+sub @r5, L7
+cmp @r0, -188
+m0
+sub L9, L38
+cmp L19, @r6
+clr @r0
+prn 158
+inc L24
+not @r5
+L28: inc @r3
+red @r5
+prn @r0
+mov L15, @r1
+dec L14
+prn 484
+m3
+m3
+jsr L22
+m4
+L29: clr @r1
+L30: mov @r6, L32
+cmp -63, -420
+rts
+rts
+lea X1, @r0
+clr @r6
+add 120, L0
+mov @r4, @r0
+sub L1, @r4
+add X2, L18
+dec @r2
+add @r3, @r6
+m3
+jsr @r7
+m2
+m1
+jmp L19
+clr L26
+L31: mov @r5, @r2
+jmp @r3
+dec @r4
+dec L7
+add X3, L19
+L32: add -419, L1
+add L25, L1
+inc @r1
+not L2
+L33: clr L58
+L34: bne L22
+bne L27
+inc L11
+lea L9, @r2
+inc L2
+prn @r3
+not @r3
+add -279, @r5
+bne @r7
+jsr @r0
+jmp L10
+bne L29
+L35: jsr L19
+add 157, L18
+mov -220, L0
+inc @r4
+m3
+L36: bne L22
+bne L0
+m4
+mov @r6, L29
+inc @r3
+mov @r4, @r2
+mov @r0, @r4
+dec @r2
+m3
+jmp L59
+m1
+dec @r4
+prn L31
+not L5
+m1
+m3
+inc L45
+lea L6, L35
+red L32
+sub L14, @r3
+lea L10, L18
+prn 425
+L37: inc @r1
+red L22
+bne @r3
+not L9
+not L45
+red @r6
+L38: jmp L13
+dec L19
+jmp L52
+L39: not @r1
+red L18
+bne @r6
+not @r5
+red S3
+cmp D0, 194
+prn @r0
+not @r6
+m4
+jmp @r4
+cmp @r7, @r5
+dec @r7
+not L21
+cmp 101, 491
+add -7, L18
+jsr L17
+mov @r0, L37
+jmp L30
+add L7, @r7
+L40: add @r0, @r5
+sub L32, @r3
+L41: sub @r1, L40
+not @r3
+bne S3
+clr L19
+mov @r3, @r0
+add -81, L27
+jmp L26
+rts
+not @r6
+add 301, D0
+m0
+inc @r2
+m1
+prn -8
+clr L10
+mov @r1, @r5
+m1
+red L26
+add L37, L56
+cmp L0, -185
+rts
+jsr @r7
+clr L21
+rts
+dec @r2
+jsr L17
+jmp L26
+sub L3, @r1
+red L19
+lea L39, L13
+clr @r7
+L42: dec @r7
+dec @r7
+mov @r1, L17
+lea L29, @r5
+mov @r6, L24
+cmp @r7, -71
+lea L18, @r5
+L43: not L39
+L44: mov -500, @r4
+inc L51
+L45: dec @r4
+lea L2, L12
+sub 189, L25
+L46: not L10
+jmp L1
+L47: cmp @r4, L46
+inc @r3
+red @r3
+jsr @r3
+L48: mov @r0, L47
+bne L0
+jmp @r0
+sub L48, L36
+clr L34
+sub L19, @r7
+add @r3, L26
+prn @r3
+cmp @r2, L51
+L49: prn @r3
+m3
+prn L41
+L50: not L22
+L51: prn -113
+sub L22, L21
+jmp @r5
+not @r4
+prn @r1
+mov 343, @r0
+mov L25, @r7
+L52: mov 313, L52
+cmp 265, 188
+rts
+jsr L56
+m3
+lea L13, @r7
+bne L7
+prn @r1
+L53: mov L58, @r4
+red @r2
+inc @r7
+sub L56, @r4
+L54: clr L56
+not @r5
+mov @r4, @r1
+bne L55
+dec @r4
+L55: inc @r3
+lea D0, S7
+L56: jsr @r3
+cmp -374, 390
+L57: mov X4, S5
+L58: prn @r7
+m3
+L59: clr D0
+jmp S9
+stop
+D0: .data -211,49,-3,-285,310,235,-230,423,-67,-127
+D1: .data -20,456,271,-80,-195,460,-308,449,-428,-470
+D2: .data 403,-416,92,-301,249,-455,-350,251,-218,-315
+D3: .data -118,-268,-358,-388,477,-42,0,258,387,-161
+D4: .data 400,129,117,-227,-14,478,222,-240,20,17
+D5: .data 190,265,104,-492,353,-479,357,228,-158,138
+D6: .data -5,88,411,79,187,-238,313,-80,170,459
+D7: .data 246,221,-326,337,-19,-59,457,234,216,-293
+D8: .data -243,-309,433,362,470,-54,277,-421,-373,72
+D9: .data 381,-93,292,-66,481,318,-329,-176,-190,310
+S0: .string "gnxl"
+S1: .string "qll"
+S2: .string "hmpqwdly"
+S3: .string "jnrotxml"
+S4: .string "elxcfscrpgyavlwi"
+S5: .string "vzqdgvwwvbe"
+S6: .string "cujbgjaqtwfiedqkr"
+S7: .string "bnpaprwylc"
+S8: .string "iznrjcjj"
+S9: .string "odkcbxmkgnuue"
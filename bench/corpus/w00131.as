@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r7
+    prn 18
+endmcro
+mcro m1
+    sub @r5, @r4
+    prn 52
+endmcro
+mcro m2
+    sub @r7, @r0
+    prn 57
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 99
+endmcro
+mcro m4
+    sub @r7, @r3
+    prn 83
+endmcro
+L0: prn L0
+dec @r2
+not @r4
+m0
+jsr @r2
+m3
+dec @r3
+red L0
+lea S4, L0
+dec @r7
+prn 42
+red L0
+dec @r5
+jsr @r0
+inc L0
+sub @r1, L0
+not L0
+m0
+jsr L0
+clr @r5
+inc L0
+L1: prn 107
+jsr L1
+not @r2
+jmp @r5
+jmp @r4
+not @r3
+bne L0
+m0
+L2: dec L1
+cmp @r4, 181
+L3: inc L3
+dec @r6
+m4
+bne L2
+lea L27, @r3
+bne L1
+dec @r3
+clr @r7
+add L2, @r4
+clr L0
+dec @r3
+clr L2
+dec @r1
+mov @r4, L0
+clr L2
+L4: inc L1
+inc L8
+dec L0
+L5: jmp @r4
+lea S2, @r6
+not L5
+lea L4, L1
+red L3
+jmp L1
+bne L1
+clr @r0
+add L0, @r3
+jmp L1
+dec L2
+not @r6
+lea L1, L5
+lea L5, @r4
+cmp @r1, 296
+add -3, @r1
+sub L1, L1
+m4
+sub @r2, @r1
+L6: mov @r5, L55
+jsr @r3
+clr @r5
+cmp 382, @r1
+red L3
+cmp 87, L5
+bne @r7
+m2
+jmp L3
+m1
+prn @r4
+mov @r6, L1
+clr L2
+cmp -148, -391
+rts
+jsr L4
+red L5
+L7: sub L6, L1
+red @r2
+jmp L0
+lea L0, @r2
+m2
+inc L2
+m3
+not L41
+inc L37
+add L3, @r7
+m2
+clr @r5
+dec L6
+m3
+cmp L7, L4
+lea L0, @r7
+inc L0
+jmp @r2
+cmp L4, 163
+jsr L6
+sub L30, L5
+bne L6
+red @r5
+sub L1, L5
+L8: jmp @r1
+m2
+mov @r0, @r4
+sub L5, @r5
+jsr @r0
+mov @r2, @r1
+L9: dec L8
+L10: clr L7
+prn -158
+m2
+inc @r1
+sub 492, @r4
+m3
+not @r5
+cmp L1, L9
+mov -31, @r0
+rts
+inc @r1
+inc @r3
+inc @r6
+add L10, L7
+prn L0
+jsr L8
+add L8, @r0
+inc @r3
+L11: jmp @r7
+not L2
+m0
+lea L53, L8
+add S7, L11
+L12: prn @r0
+jmp @r2
+bne @r5
+bne L2
+clr L11
+dec @r1
+rts
+clr L4
+dec L7
+dec @r6
+red @r2
+jsr @r3
+cmp 299, @r1
+jmp @r1
+prn 470
+rts
+bne L0
+m4
+clr L1
+m1
+rts
+prn @r7
+L13: not @r3
+L14: bne L12
+sub 370, @r7
+red @r7
+dec @r5
+lea L3, L9
+sub L14, @r5
+m4
+clr L7
+L15: jmp L2
+lea L8, @r0
+red L15
+L16: red @r3
+mov L10, @r1
+red L4
+clr L47
+clr L1
+m0
+L17: inc L10
+not L0
+dec S8
+m0
+dec @r7
+not @r5
+m1
+mov L11, L8
+inc L17
+cmp L10, @r4
+mov -385, @r5
+L18: red @r7
+mov 122, L9
+jsr @r2
+not @r6
+jmp @r5
+jsr L32
+dec L10
+mov L16, L1
+L19: clr L4
+not @r6
+lea L4, L3
+L20: prn -149
+inc @r6
+m0
+L21: bne @r6
+bne @r1
+inc L11
+mov -396, @r4
+bne @r6
+L22: jsr L14
+inc @r0
+clr @r0
+cmp L2, @r5
+bne L10
+red @r1
+sub L9, L16
+sub @r7, L20
+red @r7
+rts
+inc L16
+inc L13
+bne L20
+add 27, @r0
+sub @r6, @r1
+red @r1
+cmp @r7, X0
+lea L17, L9
+prn L10
+sub L5, L3
+dec L26
+sub -420, L2
+jsr L21
+prn @r1
+prn @r7
+cmp 491, @r7
+L23: cmp -431, L16
+mov L12, @r1
+jmp @r6
+red L23
+L24: clr L17
+red @r0
+not @r7
+not L2
+m2
+jmp L17
+clr L15
+L25: cmp L12, @r4
+dec @r2
+cmp L7, @r1
+prn L3
+not L18
+clr L25
+sub -69, L21
+bne L11
+add -350, L41
+add D0, @r0
+lea L19, L5
+jmp L47
+bne @r3
+mov L7, L31
+cmp -471, @r2
+m2
+add D0, @r4
+lea L13, @r7
+L26: add -356, @r1
+add -47, L6
+m1
+jsr @r6
+jmp @r3
+L27: jmp L16
+clr @r5
+prn -364
+sub -206, @r4
+L28: jmp L20
+L29: dec L14
+sub L12, L24
+L30: dec L14
+lea L10, @r0
+sub @r7, @r5
+inc @r0
+m1
+L31: mov L58, L28
+jsr X1
+dec L22
+clr @r2
+bne @r4
+rts
+bne @r1
+sub -102, @r7
+L32: prn @r3
+not @r6
+sub @r5, @r1
+not @r4
+lea L1, @r2
+L33: jsr D0
+not L29
+m2
+L34: jmp @r0
+add 415, @r2
+jsr @r5
+dec L10
+jmp @r1
+lea L24, @r5
+jsr L8
+not L14
+m3
+L35: bne @r4
+m2
+add 424, @r0
+sub -164, @r7
+cmp -309, L21
+clr L10
+bne L2
+add @r7, L29
+red L2
+add @r5, L34
+inc @r7
+L36: inc @r1
+mov -190, @r7
+inc @r1
+L37: not @r1
+lea S6, L21
+jmp L8
+inc @r1
+m3
+mov L16, @r6
+mov 187, @r5
+red @r1
+sub 90, @r1
+sub @r1, L9
+bne L23
+L38: lea L29, @r7
+inc @r6
+prn X2
+jmp L15
+jsr @r1
+L39: prn L29
+m4
+L40: not L27
+clr @r1
+bne @r3
+dec L25
+L41: bne L26
+m2
+dec @r2
+not L20
+clr L14
+red L8
+L42: not L31
+add L39, D0
+bne @r0
+prn 416
+L43: sub @r1, @r1
+jmp L40
+rts
+add @r1, L38
+jmp S7
+jmp L17
+not X3
+cmp L11, -19
+not @r6
+L44: jmp L36
+dec @r4
+sub 144, @r5
+clr @r1
+cmp @r0, 265
+clr L24
+L45: clr L30
+L46: jsr @r7
+L47: add 454, @r6
+bne @r5
+L48: prn D0
+L49: bne @r2
+L50: rts
+red @r5
+red D0
+red @r2
+dec L0
+lea L22, @r4
+lea L24, @r4
+lea S2, L9
+jmp L35
+L51: cmp @r1, 334
+add -348, @r3
+m2
+inc L2
+m1
+inc @r4
+rts
+cmp @r5, @r7
+jsr L33
+sub L40, L6
+m4
+bne @r2
+m1
+clr @r3
+bne L17
+not @r0
+prn S8
+L52: cmp @r5, @r5
+bne @r6
+L53: sub -293, L43
+add L44, @r2
+m1
+add @r1, @r4
+bne @r1
+L54: bne L21
+sub @r7, L24
+cmp @r1, @r1
+add @r7, L19
+jmp @r7
+prn L24
+sub @r3, @r0
+lea D0, @r1
+inc L55
+L55: mov L14, @r3
+bne L59
+L56: clr X4
+L57: jsr @r6
+prn 152
+prn -233
+rts
+jsr L59
+sub @r1, @r6
+prn -82
+red @r7
+jmp @r1
+jsr @r0
+add @r4, L5
+L58: not @r1
+jmp S2
+lea L59, @r5
+mov @r3, @r6
+bne L7
+rts
+prn D0
+m2
+dec L59
+m1
+L59: red S5
+stop
+D0: .data 199,223,-3,484,-125,-393,-144,366,-24,325
+D1: .data -338,393,350,241,-133,-11,-50,382,-106,86
+D2: .data 105,194,301,403,-484,-453,-244,-190,-26,33
+D3: .data -396,444,451,8,127,490,355,360,-97,430
+D4: .data -88,-226,155,417,-27,346,124,-27,308,441
+D5: .data 305,-343,-56,388,119,-86,326,-212,-371,-112
+D6: .data 411,-68,-68,-465,-183,-222,-100,348,-376,-53
+D7: .data 210,-163,-357,26,218,21,140,93,220,-18
+D8: .data -89,-332,113,82,178,480,464,183,-371,280
+D9: .data -444,-306,-301,386,396,-39,235,338,86,262
+S0: .string "k"
+S1: .string "xbnathqgrs"
+S2: .string "gdboagdbwfpjirjkq"
+S3: .string "ufqvu"
+S4: .string "osehccjj"
+S5: .string "ximpgnhsj"
+S6: .string "pkbqhteriuqc"
+S7: .string "fnybkuypvpg"
+S8: .string "kqnibx"
+S9: .string "qahm"
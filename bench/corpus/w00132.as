@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r2
+    prn 88
+endmcro
+mcro m1
+    sub @r1, @r5
+    prn 51
+endmcro
+mcro m2
+    sub @r2, @r6
+    prn 23
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 43
+endmcro
+mcro m4
+    sub @r1, @r1
+    prn 8
+endmcro
+sub @r1, L0
+bne L0
+clr L0
+jsr @r6
+bne @r0
+bne L30
+rts
+clr @r3
+inc @r7
+add @r5, @r0
+not L0
+red @r7
+lea L0, L0
+bne @r7
+sub @r6, L0
+red L0
+L0: inc @r6
+m3
+jmp L0
+mov -223, @r0
+clr @r1
+not X0
+sub -241, @r3
+jmp @r4
+cmp @r6, @r7
+dec @r5
+add @r3, @r7
+jsr L0
+rts
+inc @r4
+L1: prn -53
+clr L0
+bne @r2
+m4
+cmp L0, 508
+sub @r7, L1
+prn L1
+add -363, @r0
+L2: lea L1, @r3
+L3: clr L3
+cmp @r0, 499
+L4: dec @r5
+prn -265
+prn @r4
+not @r4
+L5: jsr L5
+L6: add @r2, @r3
+mov -183, @r1
+cmp 163, L39
+sub -131, L4
+rts
+sub 308, @r3
+L7: lea L7, @r5
+bne L5
+add @r0, @r6
+jmp @r7
+L8: bne @r1
+L9: jsr @r0
+sub L8, L7
+rts
+add @r0, L7
+sub @r5, @r1
+m3
+sub L1, L2
+jmp L7
+m0
+sub D0, L5
+add -466, L3
+red @r1
+rts
+not L2
+red L3
+jsr @r0
+not @r4
+m0
+L10: rts
+not @r3
+sub -497, @r6
+L11: sub 52, L48
+not L1
+sub -331, L4
+not @r0
+red @r7
+jsr L10
+m1
+L12: lea L9, L3
+bne L4
+L13: rts
+sub @r0, @r0
+L14: sub @r5, @r4
+not @r6
+bne L2
+m0
+L15: jsr @r3
+jsr L12
+mov L14, @r5
+mov -304, X1
+jmp L8
+clr @r2
+clr L2
+sub @r7, L9
+prn 153
+prn @r3
+m2
+L16: red @r7
+L17: inc L12
+jmp @r0
+cmp @r6, @r3
+L18: inc L6
+sub @r2, @r6
+m2
+lea L7, @r4
+red @r6
+dec L9
+cmp S4, @r3
+rts
+L19: prn @r5
+m1
+L20: clr L4
+clr L1
+bne L12
+not @r7
+m3
+mov 426, @r7
+sub L4, L10
+prn L20
+jsr @r2
+sub @r6, L17
+L21: clr @r5
+red @r1
+prn S2
+m1
+mov @r5, @r7
+not @r2
+sub @r1, L13
+mov -424, @r0
+m0
+sub 367, L8
+lea L21, @r3
+m4
+inc @r0
+sub @r6, @r1
+lea L11, D0
+clr @r5
+add @r6, L2
+red L14
+add 98, @r7
+sub @r0, @r7
+clr L8
+jsr L16
+prn 469
+L22: inc @r1
+jsr @r5
+jsr @r3
+red L5
+m4
+dec @r6
+m4
+cmp @r3, 393
+jmp @r5
+jsr L7
+add -125, @r3
+m0
+dec L11
+not L1
+L23: sub L12, L21
+L24: lea L14, L22
+L25: lea L19, L23
+m3
+m0
+not L9
+jsr L24
+inc @r5
+inc @r3
+clr @r6
+inc L17
+not L23
+jsr L42
+bne L17
+mov @r3, L25
+prn @r3
+jsr @r1
+L26: rts
+m2
+sub @r7, L0
+L27: inc L17
+add @r5, @r2
+prn L25
+inc L55
+sub -142, @r5
+jsr L16
+dec @r5
+mov @r2, L19
+cmp L6, @r2
+add @r0, L16
+bne @r6
+clr L55
+L28: inc L13
+add @r4, L16
+inc L19
+jmp L23
+rts
+bne @r1
+m0
+mov 191, @r1
+rts
+dec @r7
+jsr @r1
+prn -99
+cmp @r3, @r5
+dec @r0
+cmp @r1, -188
+lea L8, @r5
+lea L26, @r2
+bne L16
+lea L25, L15
+cmp 29, 85
+jsr L16
+rts
+L29: bne L29
+jmp @r5
+m4
+jsr @r6
+lea L38, S0
+jmp L28
+jmp L11
+bne @r6
+add 271, X2
+prn @r3
+prn @r7
+rts
+rts
+m3
+mov L20, L10
+m4
+prn 343
+mov 389, L23
+lea D0, @r5
+add @r2, @r7
+rts
+m3
+red L25
+clr @r6
+not @r3
+L30: add -434, @r6
+L31: dec L51
+lea L12, L5
+sub 496, @r4
+rts
+m4
+m1
+inc L31
+rts
+jsr @r1
+m3
+L32: add L10, L19
+jsr @r6
+jmp @r5
+L33: rts
+cmp L27, @r6
+L34: rts
+red @r0
+m0
+inc L12
+jmp @r5
+sub @r4, L10
+dec @r2
+sub 53, @r4
+lea L29, @r7
+rts
+clr L28
+not @r0
+inc @r5
+red L7
+L35: lea L26, L21
+m2
+bne @r6
+bne @r3
+cmp 164, L25
+L36: clr @r3
+prn L2
+mov L24, @r5
+L37: red @r4
+cmp L12, @r1
+jsr L22
+lea L14, @r6
+inc @r0
+inc L27
+L38: sub @r1, @r3
+prn L7
+add 100, @r1
+jsr L25
+add 358, @r4
+rts
+clr @r2
+not L46
+dec @r3
+mov L10, L21
+jmp @r0
+prn @r2
+L39: cmp -58, 383
+not L34
+L40: jmp @r1
+lea L27, L35
+dec @r4
+L41: cmp S7, L14
+inc @r1
+red L27
+m0
+jsr L53
+cmp @r0, @r5
+mov L46, @r5
+sub L29, L14
+inc L41
+jmp @r3
+dec @r7
+clr @r3
+inc L1
+add 21, @r5
+dec @r0
+cmp @r1, @r1
+not @r2
+red @r1
+dec @r6
+add @r5, L14
+L42: clr S0
+not @r1
+red @r3
+rts
+add 65, @r6
+cmp @r7, @r5
+clr @r2
+cmp @r6, S5
+bne @r5
+L43: add L9, L17
+m3
+red L8
+m4
+L44: not L36
+prn 460
+not @r3
+dec L24
+clr L35
+L45: inc L14
+mov L23, L4
+L46: add 452, @r3
+mov -488, L31
+lea D0, @r1
+cmp -440, -143
+jmp @r1
+prn L1
+L47: lea L13, L3
+red @r5
+mov @r2, L15
+jmp L41
+bne @r3
+jmp L34
+not L19
+add -103, L11
+jmp @r6
+L48: sub -232, @r1
+m3
+L49: dec L4
+inc L35
+mov L54, L27
+prn @r7
+mov 458, @r4
+cmp -421, 113
+sub @r0, @r0
+L50: cmp -150, D0
+rts
+not @r5
+L51: prn -217
+m2
+m4
+cmp L10, L29
+not L22
+jmp @r3
+jsr @r3
+jsr D0
+bne L52
+jmp L27
+clr @r6
+bne @r4
+L52: bne L27
+cmp @r5, 198
+m3
+rts
+clr L16
+clr L10
+bne @r6
+clr @r0
+lea S3, @r4
+m3
+jmp @r6
+dec L5
+dec L14
+L53: jsr L4
+mov @r7, D0
+bne @r2
+cmp @r1, -299
+L54: jmp @r2
+red @r6
+mov -5, @r4
+L55: not D0
+L56: add @r1, L53
+add -247, @r3
+add @r4, @r5
+clr @r3
+rts
+rts
+dec L1
+cmp -41, 77
+L57: cmp L13, @r2
+prn L45
+add -204, @r3
+rts
+add L3, S2
+rts
+dec @r7
+sub L7, @r7
+not L15
+prn @r7
+jmp @r2
+rts
+m4
+L58: mov -503, @r0
+cmp L59, X3
+L59: not S3
+not D0
+prn D0
+bne S8
+sub D0, L35
+dec L46
+dec L57
+m4
+clr S8
+lea S5, S2
+dec D0
+prn X4
+stop
+D0: .data -249,306,-144,-401,259,470,210,355,188,-435
+D1: .data 489,-385,-419,437,-221,-171,-50,-245,446,-404
+D2: .data -276,-312,-323,-492,-495,277,175,485,234,-436
+D3: .data 142,-50,-176,-221,237,273,429,-214,-359,-37
+D4: .data -105,-75,320,72,238,107,-310,-42,-114,-249
+D5: .data 350,-83,-318,-143,-410,270,418,-111,-89,-33
+D6: .data -266,-61,-193,-409,-463,158,-220,-455,88,-291
+D7: .data -219,324,344,-191,28,-378,156,210,-401,78
+D8: .data 243,460,303,323,-137,189,148,-149,-141,216
+D9: .data 486,-161,-71,87,70,345,-93,99,-412,-246
+S0: .string "tfunoqqpypjjaahprtam"
+S1: .string "aswjziilbprnbul"
+S2: .string "qyteyjpuhqfxj"
+S3: .string "jtmvvjsrqbleybzof"
+S4: .string "j"
+S5: .string "jewkrygavtyzhqcm"
+S6: .string "yatzgmvuqaxjf"
+S7: .string "cjyqhspkobjzeeyj"
+S8: .string "zulm"
+S9: .string "gvysdy"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r4
+    prn 26
+endmcro
+mcro m1
+    sub @r6, @r6
+    prn 17
+endmcro
+mcro m2
+    sub @r4, @r3
+    prn 20
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 19
+endmcro
+mcro m4
+    sub @r3, @r7
+    prn 32
+endmcro
+dec @r2
+cmp 364, @r7
+prn @r0
+L0: lea L0, @r0
+inc L0
+clr @r7
+jsr L0
+add 36, L0
+jmp @r6
+m3
+L1: rts
+inc @r7
+cmp L0, @r1
+jsr L0
+jsr @r7
+m3
+L2: rts
+lea L1, @r7
+lea L2, L0
+not L1
+lea L0, @r2
+clr @r5
+sub L5, @r6
+clr L2
+bne @r1
+add @r1, @r0
+clr @r5
+inc @r3
+dec L1
+red L2
+lea L1, @r2
+inc @r7
+lea L1, @r3
+lea L0, @r0
+sub @r6, @r5
+dec @r0
+jmp L2
+rts
+inc @r1
+m2
+L3: dec @r5
+m4
+lea L3, D0
+add @r7, L1
+mov -18, L0
+jmp L1
+not @r1
+prn @r7
+not L3
+clr L3
+inc L2
+red @r4
+mov L51, @r6
+lea L2, @r7
+prn -487
+not L2
+jmp L3
+dec L1
+cmp L0, S0
+L4: not L3
+L5: not @r7
+clr @r2
+L6: sub -170, L6
+sub @r0, L2
+dec L6
+L7: clr @r3
+mov -489, L6
+rts
+L8: lea L1, @r1
+L9: inc D0
+red @r4
+red L3
+m4
+m0
+add 35, L2
+rts
+clr @r5
+red L12
+lea X0, L4
+cmp @r1, @r4
+cmp 473, @r1
+m2
+prn L1
+clr @r4
+prn -195
+prn 510
+bne L9
+clr @r6
+L10: cmp @r6, L6
+m3
+clr @r7
+L11: dec @r4
+prn L3
+L12: prn L8
+add -424, @r3
+L13: red @r7
+m1
+red L2
+jmp L4
+dec L4
+not @r6
+m1
+dec L8
+jsr @r6
+dec @r7
+inc @r4
+L14: mov L3, L14
+clr L7
+L15: dec L11
+mov @r5, L6
+jsr @r0
+L16: prn L14
+rts
+not L3
+m1
+dec L16
+L17: inc @r2
+L18: lea L4, L59
+cmp L13, @r3
+jsr @r0
+L19: sub @r0, L8
+clr L7
+rts
+lea L9, L10
+clr L1
+m0
+red L17
+m3
+lea L0, D0
+inc @r1
+lea L25, L18
+inc @r1
+jsr @r5
+clr @r2
+red L17
+red @r3
+red @r4
+m4
+L20: dec L3
+add L8, L3
+L21: dec L23
+m2
+L22: dec @r5
+not @r4
+clr @r2
+add L16, @r7
+sub L55, @r5
+bne L1
+mov L8, L10
+dec L17
+mov @r6, @r3
+sub S9, L18
+dec L10
+lea L11, L7
+mov L23, L11
+add 131, L3
+rts
+cmp L5, -43
+not D0
+jmp @r5
+rts
+not L14
+m1
+m4
+not @r5
+L23: inc @r2
+inc L19
+clr @r3
+jsr @r5
+L24: clr D0
+jsr L22
+dec @r6
+bne @r1
+cmp -228, @r5
+red @r1
+bne @r7
+m1
+L25: red L0
+rts
+jmp L3
+bne @r5
+L26: prn L12
+add 29, @r3
+inc @r1
+dec @r3
+jsr @r5
+lea L26, L11
+sub 479, @r2
+clr L12
+inc @r3
+not @r1
+sub 191, @r7
+not @r6
+add S3, @r0
+cmp L22, L11
+sub -140, L5
+L27: bne L16
+m3
+sub L12, @r4
+lea L12, @r7
+mov @r3, @r1
+add L24, L9
+m0
+clr L11
+dec L2
+m1
+add L14, L8
+prn 50
+m2
+dec @r6
+cmp @r0, @r1
+rts
+cmp 29, L1
+sub @r6, @r5
+prn L15
+bne @r6
+L28: red @r3
+prn L25
+L29: not L2
+L30: cmp 39, -339
+cmp L7, @r4
+inc L16
+not @r5
+m4
+rts
+red @r7
+clr @r7
+L31: jsr L13
+L32: bne L20
+lea L29, L14
+mov @r3, L21
+lea L25, @r0
+cmp @r1, 47
+jsr L32
+lea L2, S0
+clr @r0
+m0
+red L13
+L33: not @r4
+rts
+red L41
+clr @r5
+m0
+add L19, L16
+rts
+m3
+L34: sub S9, L13
+not @r7
+inc @r3
+clr @r4
+m4
+L35: inc @r0
+sub 78, @r3
+clr @r7
+lea L13, @r0
+m4
+L36: add @r5, @r4
+dec @r6
+L37: clr @r4
+rts
+dec @r0
+jsr @r4
+dec @r0
+cmp @r3, L7
+jsr L14
+dec @r0
+prn @r4
+red L3
+not L2
+cmp @r2, 466
+inc @r0
+jsr @r7
+sub L0, @r7
+L38: mov @r5, L22
+L39: dec @r7
+rts
+bne L16
+red @r3
+red @r3
+sub -436, L6
+prn @r0
+bne L53
+not L13
+add L2, @r7
+rts
+mov D0, L30
+jsr @r2
+L40: jsr L49
+dec L26
+L41: dec @r7
+red @r2
+m4
+L42: jsr L41
+jsr L32
+bne L22
+jsr @r2
+not S4
+dec @r4
+L43: red L4
+bne @r4
+dec @r1
+m0
+m3
+m4
+not @r6
+inc L27
+m0
+sub -380, L24
+L44: sub 60, @r0
+add @r1, L37
+sub @r4, L43
+dec L44
+L45: rts
+L46: sub L32, @r3
+m3
+lea L35, L15
+m0
+dec L38
+dec @r7
+add L24, L43
+lea L38, @r1
+bne L46
+L47: bne @r4
+cmp @r2, 93
+red @r1
+not @r1
+m2
+red @r3
+mov L32, @r1
+mov L38, @r6
+m3
+jmp L42
+clr L16
+L48: add L7, @r6
+clr L54
+red L8
+cmp 495, L46
+prn 435
+lea L46, L29
+clr L3
+prn 270
+prn L32
+bne X1
+mov @r5, @r0
+L49: sub @r0, L40
+jsr L8
+prn -275
+clr X2
+clr @r0
+prn @r0
+not @r4
+jsr @r4
+bne L40
+clr L5
+dec @r6
+L50: cmp -4, @r3
+L51: prn @r3
+prn L46
+clr L18
+red L30
+not @r6
+bne L26
+inc L34
+prn L33
+jmp @r1
+sub L8, @r5
+red L17
+add 439, L53
+not L53
+sub @r7, L41
+dec L24
+clr @r1
+cmp @r0, L57
+inc L12
+red L27
+add L50, L13
+L52: add L26, L25
+mov @r6, L16
+jmp @r7
+red @r2
+sub X3, L17
+L53: not @r1
+L54: red @r3
+L55: clr L30
+lea L56, L25
+rts
+lea S3, @r2
+L56: prn 260
+lea L38, @r2
+clr @r4
+jsr L46
+L57: mov L40, L51
+dec L7
+prn -127
+lea L5, L58
+L58: clr L49
+jmp @r5
+inc L31
+rts
+inc @r0
+rts
+add L4, @r5
+inc @r2
+lea L30, L16
+sub L59, @r6
+inc @r0
+dec @r4
+m2
+L59: mov L16, L4
+mov @r5, @r0
+rts
+clr @r7
+mov -442, L53
+m2
+lea L43, L31
+dec L46
+inc @r5
+jsr @r5
+add @r4, S2
+cmp -425, L37
+dec D0
+lea L3, @r6
+red L3
+add -361, S7
+lea L47, D0
+jmp S6
+not @r2
+jsr X4
+prn S0
+jsr L19
+inc L30
+jsr @r4
+sub @r3, @r7
+jsr L5
+prn 352
+not @r6
+prn 320
+sub D0, L57
+clr D0
+m1
+stop
+D0: .data -227,-24,429,384,-129,-460,366,-343,75,175
+D1: .data 222,-11,-444,260,-28,164,224,-207,-18,-448
+D2: .data 381,362,-222,-118,-206,-281,5,-373,-137,317
+D3: .data 326,444,-207,3,423,-373,-398,179,200,423
+D4: .data 39,95,-13,79,-79,-351,26,113,-85,-382
+D5: .data -70,-344,264,96,293,192,245,417,28,191
+D6: .data 396,103,-372,431,-344,210,-246,-10,-236,-314
+D7: .data 115,-141,-196,-136,-49,-277,-373,288,-26,-449
+D8: .data 428,-78,-467,-238,441,-411,-98,398,-22,223
+D9: .data 246,150,-201,122,-429,-404,-235,-404,-414,-39
+S0: .string "xcwendllwngcu"
+S1: .string "ab"
+S2: .string "oesdbrwubfthadddcass"
+S3: .string "smkplelxcpkcvkozs"
+S4: .string "wzkvqvwzgdopjwf"
+S5: .string "mfjijb"
+S6: .string "u"
+S7: .string "vresqfnygg"
+S8: .string "mda"
+S9: .string "qcfdaakuhgfxexffnlw"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r7
+    prn 97
+endmcro
+mcro m1
+    sub @r2, @r7
+    prn 16
+endmcro
+mcro m2
+    sub @r6, @r1
+    prn 85
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 96
+endmcro
+mcro m4
+    sub @r5, @r6
+    prn 56
+endmcro
+inc L0
+sub @r3, L0
+L0: inc @r2
+L1: not L1
+mov 124, @r0
+sub @r7, @r2
+L2: lea L0, L1
+m3
+add @r1, @r7
+not @r7
+rts
+cmp L2, -438
+mov S8, @r5
+rts
+L3: dec @r1
+clr @r0
+cmp @r3, @r2
+jsr L7
+inc L0
+add L1, @r5
+lea L1, L1
+prn @r6
+rts
+add @r1, L0
+rts
+L4: dec @r2
+m4
+bne L1
+dec @r4
+L5: dec @r1
+inc X0
+not L4
+clr @r0
+jsr L16
+dec @r6
+m4
+dec @r4
+bne @r1
+add L1, L38
+bne L0
+prn @r4
+not L4
+not L2
+not L2
+inc @r3
+inc @r3
+sub L4, @r3
+inc @r1
+jmp L0
+inc L3
+rts
+cmp 116, -253
+prn 174
+sub -455, @r5
+cmp @r2, @r5
+add 101, D0
+rts
+dec L0
+bne L5
+prn -393
+clr D0
+add L1, L2
+clr @r6
+sub 369, @r5
+dec @r2
+add @r2, @r4
+m2
+rts
+mov @r1, @r3
+L6: lea L4, @r6
+bne L14
+clr L5
+inc @r1
+L7: sub -304, @r5
+m3
+bne L6
+add L0, @r1
+rts
+L8: prn @r7
+clr L6
+not L56
+not L8
+clr L5
+L9: bne L3
+dec @r7
+clr @r3
+sub -364, L7
+lea L7, L4
+L10: dec L2
+bne L27
+dec @r3
+add 160, @r5
+dec @r4
+sub @r4, D0
+bne @r6
+add @r6, @r3
+L11: prn -505
+red L10
+not @r4
+clr @r3
+red @r7
+cmp @r7, @r0
+red @r4
+red @r3
+mov L4, L2
+bne @r4
+red L1
+bne @r3
+red L1
+m0
+prn -330
+L12: inc @r5
+lea L7, L10
+jsr L0
+m3
+not L0
+prn @r0
+lea L3, @r1
+dec L0
+jsr L0
+jsr D0
+jmp L6
+clr @r7
+jmp L12
+clr @r7
+rts
+not @r6
+rts
+red @r1
+inc @r0
+not @r4
+L13: dec L10
+cmp 170, L39
+jmp L11
+add L27, @r4
+jmp L3
+sub @r2, L6
+dec L4
+red L4
+jsr L1
+L14: mov 285, L13
+L15: dec @r3
+jmp L2
+bne @r4
+prn -495
+dec @r1
+sub 293, L5
+lea L10, @r1
+jsr L8
+red L3
+clr @r6
+L16: sub L4, L11
+cmp 342, -477
+dec @r7
+bne @r3
+inc L8
+add L1, @r4
+m1
+inc L1
+inc @r4
+cmp 309, @r4
+mov 67, @r1
+m1
+bne L53
+lea L0, @r1
+cmp -97, L8
+prn @r4
+bne L12
+add @r6, S7
+inc L16
+jmp @r6
+add @r7, L13
+red L5
+L17: cmp L10, L9
+dec @r7
+L18: prn D0
+L19: jmp L19
+m0
+sub -241, L2
+red L12
+lea L7, @r7
+cmp L5, -327
+dec @r1
+sub -385, @r5
+lea L2, L11
+m2
+dec L0
+L20: inc L11
+cmp L10, L5
+not L11
+cmp -276, 300
+jmp @r7
+prn L11
+L21: lea L2, L4
+prn @r7
+jmp @r4
+jsr @r2
+bne L6
+jmp L17
+L22: add @r4, L12
+dec L13
+L23: rts
+jsr @r3
+jmp @r1
+bne @r4
+m1
+cmp @r5, -81
+mov L4, S2
+jsr @r5
+cmp L18, -180
+m4
+prn @r3
+not L18
+m2
+mov L19, @r4
+dec L19
+L24: sub @r2, L17
+L25: prn L0
+jsr L15
+lea L17, @r4
+rts
+L26: prn @r1
+m1
+clr @r4
+not @r6
+cmp -346, @r4
+dec L22
+m3
+not @r0
+L27: dec @r0
+jmp L11
+clr @r5
+sub @r0, @r2
+bne L24
+L28: cmp @r6, -385
+L29: clr @r4
+jsr L23
+not @r0
+mov @r1, L29
+red @r4
+red L13
+jsr S2
+cmp -230, 377
+L30: dec @r3
+rts
+inc @r3
+add 234, @r5
+rts
+sub @r0, @r4
+mov L15, @r1
+add @r1, @r2
+mov L21, L55
+lea L19, X1
+L31: add @r6, @r2
+m1
+not L25
+not @r1
+m4
+sub L14, @r1
+clr L21
+jmp L15
+cmp 39, L18
+red D0
+cmp L26, L13
+clr L29
+bne L22
+inc L25
+dec L9
+clr @r2
+jmp @r1
+not @r4
+cmp 481, 362
+L32: add L17, @r7
+dec X2
+lea L21, @r2
+L33: mov -65, L30
+bne L18
+jsr L0
+L34: rts
+cmp 48, -463
+L35: red @r1
+red @r2
+rts
+m2
+cmp 435, L24
+m0
+m1
+dec @r6
+L36: lea L35, L10
+lea L1, L10
+L37: rts
+cmp @r0, @r3
+sub 161, @r0
+inc @r0
+L38: sub 496, L3
+lea L38, @r5
+prn 317
+bne @r1
+not @r6
+rts
+mov @r2, L34
+m2
+prn L37
+m0
+not L31
+cmp 57, @r5
+m2
+inc L38
+jsr @r1
+cmp -475, L7
+sub -2, L3
+not @r3
+rts
+rts
+mov L8, L59
+m0
+L39: mov L13, L38
+rts
+m4
+bne D0
+sub @r7, L18
+m2
+jsr L57
+sub @r2, @r3
+mov L33, @r6
+add X3, @r0
+add L42, L22
+jsr @r7
+dec @r3
+jsr L35
+rts
+lea L6, L34
+dec L25
+jmp L15
+lea L28, @r1
+dec L35
+red L35
+jmp @r6
+dec @r7
+dec @r0
+m3
+mov @r2, @r2
+prn @r7
+L40: not L29
+dec L51
+L41: add L39, D0
+not L5
+lea L3, @r2
+L42: jmp @r6
+L43: cmp -207, 329
+rts
+cmp L39, @r5
+jsr @r0
+bne @r3
+inc L39
+L44: dec @r3
+L45: bne @r5
+m3
+m3
+clr @r2
+dec @r2
+m1
+L46: clr L7
+L47: clr L42
+m0
+not @r2
+bne L11
+sub @r6, L7
+m0
+m4
+L48: rts
+inc L48
+jsr @r4
+L49: lea L49, L43
+rts
+m1
+lea L13, L48
+cmp @r0, @r5
+m3
+red L2
+cmp -456, S6
+add L23, @r3
+bne L3
+L50: rts
+dec L21
+prn @r7
+lea L57, L22
+rts
+L51: mov @r3, L52
+lea L42, @r7
+jmp L4
+jmp @r4
+clr @r3
+jmp L33
+add L33, @r1
+dec @r6
+not @r5
+jsr @r0
+bne L38
+m4
+dec L54
+add D0, @r5
+L52: red L3
+inc @r3
+bne @r4
+prn -230
+L53: red @r7
+inc @r4
+m1
+prn D0
+jsr L36
+cmp @r4, @r1
+lea L23, L21
+add -220, L42
+lea S7, L39
+not L25
+L54: add -60, L35
+dec @r3
+m3
+add -68, L6
+L55: rts
+L56: lea L49, L45
+inc L58
+L57: red @r0
+bne S5
+rts
+jsr L11
+rts
+mov 219, @r6
+clr @r3
+red S6
+L58: prn -301
+cmp @r0, 431
+jmp L54
+inc L59
+mov -481, L59
+m1
+mov S4, @r6
+inc L50
+L59: jsr X4
+stop
+D0: .data -62,452,454,-482,-78,40,17,102,-97,-246
+D1: .data -300,-51,-245,-155,-223,-301,173,319,21,-145
+D2: .data -391,-241,-366,-287,-185,-5,469,422,210,-340
+D3: .data 270,425,329,-246,-153,430,395,219,143,-157
+D4: .data 363,487,-7,401,9,205,65,-339,500,-363
+D5: .data 240,-160,-104,-312,-460,170,-474,233,-488,145
+D6: .data 127,-490,-166,-441,244,394,345,-288,-239,422
+D7: .data -14,121,340,-32,-414,79,-378,-428,364,-107
+D8: .data 493,274,-358,-89,195,-64,-500,-322,323,-186
+D9: .data -204,481,165,416,-275,-345,252,364,-471,148
+S0: .string "qadodromffgyhw"
+S1: .string "eelltu"
+S2: .string "inbbwbfefayt"
+S3: .string "zgeeyezssvuiibo"
+S4: .string "vyzjykkpthc"
+S5: .string "tgimvizovhq"
+S6: .string "bxyj"
+S7: .string "hy"
+S8: .string "cmehnzpbekdjpbux"
+S9: .string "vfcjwsxnhzhfurqvc"
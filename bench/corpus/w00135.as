@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r1
+    prn 35
+endmcro
+mcro m1
+    sub @r6, @r1
+    prn 14
+endmcro
+mcro m2
+    sub @r0, @r7
+    prn 51
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 72
+endmcro
+mcro m4
+    sub @r7, @r4
+    prn 81
+endmcro
+prn -388
+inc L0
+jsr L0
+red L56
+L0: mov @r4, L0
+lea L0, @r6
+rts
+lea L0, L0
+dec S7
+prn L0
+m0
+dec L0
+m2
+mov L0, L0
+jmp L0
+bne L0
+sub L0, @r1
+clr L0
+not @r2
+mov @r2, @r0
+L1: cmp L0, 151
+prn L1
+clr @r2
+cmp 249, @r1
+m2
+red @r1
+L2: cmp -361, @r1
+dec @r4
+L3: not @r1
+jsr S3
+not @r3
+L4: dec L1
+L5: dec L4
+cmp 100, @r5
+prn @r0
+rts
+bne @r1
+L6: inc @r4
+m1
+rts
+sub L4, @r6
+not @r1
+inc L0
+rts
+cmp @r2, @r4
+jsr L0
+jsr @r4
+mov @r7, L5
+prn 268
+rts
+sub @r4, L6
+L7: jsr L1
+jmp @r5
+m1
+prn @r0
+jsr @r2
+L8: add L7, L4
+lea L1, L8
+prn -130
+cmp D0, @r4
+inc @r7
+rts
+red @r2
+inc @r3
+m4
+bne @r6
+add L3, @r4
+rts
+cmp L7, @r2
+add L38, L5
+clr L3
+red @r7
+sub L6, L4
+cmp L4, @r5
+rts
+clr @r2
+mov -202, @r5
+mov @r4, L2
+jsr L3
+rts
+m3
+not @r1
+prn @r7
+add -370, @r6
+bne L5
+prn -318
+sub L7, L8
+rts
+red @r5
+jmp L2
+L9: cmp 19, L27
+prn @r4
+prn @r3
+not @r0
+m4
+sub @r7, @r3
+not L6
+prn @r1
+inc L8
+sub @r1, @r3
+prn @r5
+rts
+mov L6, @r0
+inc L1
+clr L5
+bne @r1
+clr L49
+m2
+L10: jmp @r6
+not L5
+rts
+jmp @r7
+m1
+m4
+dec @r2
+red @r5
+L11: prn @r5
+dec @r6
+jsr @r6
+L12: cmp 198, L7
+add 101, L11
+L13: bne @r0
+bne L1
+L14: bne @r0
+add -82, @r2
+lea L12, D0
+not @r2
+prn @r6
+inc L7
+sub -340, L7
+m2
+rts
+dec L8
+not @r3
+sub L11, L5
+bne L13
+red @r1
+mov 314, L8
+not @r7
+jsr @r6
+dec L13
+dec L9
+not @r7
+inc L9
+inc L13
+jmp @r5
+bne L3
+jsr @r1
+bne @r5
+add @r1, @r1
+dec @r0
+clr @r5
+rts
+sub L9, L4
+dec @r1
+L15: rts
+L16: mov L0, @r0
+m1
+sub L9, L6
+sub 96, L14
+not @r4
+jmp L3
+inc @r3
+inc L14
+red @r2
+not @r0
+m4
+mov @r2, L10
+L17: prn @r3
+m2
+L18: clr @r0
+L19: cmp L40, L2
+L20: rts
+bne @r1
+bne @r5
+red L3
+bne L0
+rts
+inc L36
+not L10
+m2
+mov L4, @r3
+dec L13
+L21: inc L10
+lea L14, L4
+L22: sub @r2, @r4
+inc L11
+jmp @r4
+mov L3, D0
+dec @r7
+add @r4, L3
+dec @r3
+cmp L10, L5
+prn -485
+add L9, L7
+m3
+inc @r2
+add @r0, L22
+cmp L21, L19
+prn 44
+lea L10, @r0
+mov L6, L18
+cmp @r3, X0
+bne @r5
+m4
+clr L9
+red @r3
+jmp L12
+add 185, D0
+not L14
+dec @r0
+L23: rts
+add S0, S1
+cmp @r2, @r4
+clr @r0
+L24: sub L20, @r6
+L25: clr @r0
+jmp @r4
+jmp L4
+not @r3
+m2
+jmp L14
+jmp L25
+rts
+cmp @r7, -408
+not L6
+m4
+L26: cmp 248, @r1
+add X1, L15
+sub @r7, L5
+mov @r0, L12
+red @r2
+jsr @r3
+not L9
+rts
+red L14
+add L20, @r2
+add @r7, @r3
+cmp @r1, L18
+rts
+dec @r1
+m1
+dec D0
+red @r4
+cmp @r4, @r5
+m3
+lea L5, @r1
+L27: rts
+rts
+cmp L4, @r0
+clr D0
+L28: cmp @r4, -345
+m2
+inc @r1
+L29: not L3
+prn @r1
+lea L17, @r6
+jsr @r7
+inc @r5
+inc @r6
+jsr @r2
+rts
+L30: prn 38
+m4
+m1
+add 319, L26
+cmp 455, @r1
+add -75, L0
+clr L7
+sub @r1, L24
+cmp @r3, L20
+clr L23
+dec L26
+jmp @r1
+L31: lea L3, @r3
+lea L11, L3
+prn -465
+sub S2, @r3
+inc @r7
+m1
+prn 219
+m1
+cmp @r0, @r0
+L32: bne @r6
+clr L11
+mov L16, @r6
+not X2
+jsr L33
+bne L28
+m4
+cmp 272, -459
+m3
+cmp -45, L30
+red @r1
+m3
+inc D0
+jmp @r5
+red L4
+prn 409
+m2
+L33: inc @r6
+add -157, L1
+L34: rts
+L35: jmp L20
+L36: rts
+mov -148, @r4
+L37: dec @r7
+prn L25
+rts
+prn L19
+lea L15, D0
+red @r7
+add @r6, @r1
+jmp @r0
+dec L28
+L38: mov L32, @r1
+jsr @r2
+m4
+L39: dec L25
+jmp L19
+jmp L37
+bne L50
+rts
+dec @r2
+red L46
+L40: red D0
+jmp L10
+L41: lea L35, @r6
+L42: lea L47, L20
+clr L22
+prn @r6
+jmp L9
+rts
+clr L38
+red L7
+inc @r0
+dec L36
+lea L29, L39
+m2
+jsr @r7
+inc @r2
+jsr @r2
+inc L2
+dec @r5
+dec L41
+jmp @r6
+rts
+mov L9, @r1
+dec L36
+cmp L37, -484
+jmp L40
+rts
+m2
+m0
+clr L37
+not @r6
+mov -501, @r4
+mov L19, @r2
+rts
+cmp L4, L38
+red @r1
+dec @r4
+bne @r2
+clr X3
+not L5
+mov S6, @r0
+add @r6, L31
+L43: not @r4
+clr L12
+clr L23
+jmp @r4
+not X4
+clr L15
+rts
+prn -452
+bne @r4
+m0
+prn @r3
+dec S5
+mov L20, @r2
+bne L7
+L44: prn L0
+lea D0, @r1
+L45: mov @r5, L5
+L46: jmp @r4
+cmp -214, @r4
+L47: mov 147, L24
+L48: prn @r7
+sub @r6, @r0
+L49: cmp 56, @r1
+sub L56, @r7
+bne @r6
+jmp @r7
+not @r5
+jmp L12
+cmp 272, L36
+rts
+L50: lea L50, L7
+red L11
+L51: rts
+inc L58
+add L24, S4
+rts
+jmp L44
+m4
+cmp 91, L24
+m1
+jsr @r6
+jmp S2
+lea S6, L17
+L52: jmp L20
+L53: mov @r6, @r2
+lea L29, @r6
+jmp L6
+lea L59, L24
+m3
+lea L17, L27
+inc @r2
+prn -235
+inc @r5
+L54: bne S5
+inc L23
+jsr @r4
+cmp @r3, 477
+L55: red L36
+dec L11
+dec L58
+L56: cmp @r6, @r6
+L57: bne L43
+L58: bne D0
+jmp L34
+L59: jsr @r4
+lea L50, D0
+mov L4, L48
+jsr L3
+not @r1
+jmp @r2
+mov S5, @r1
+cmp D0, L48
+m0
+stop
+D0: .data -184,-8,77,461,-304,-157,268,40,50,-251
+D1: .data -391,80,414,-485,-377,-227,183,-157,-424,130
+D2: .data -246,88,-46,137,8,-92,-48,-478,73,-212
+D3: .data 467,-128,-302,-64,54,-72,-50,387,-127,-95
+D4: .data 438,42,-242,427,130,6,27,-215,-322,-482
+D5: .data -374,-361,118,267,390,-439,391,486,111,450
+D6: .data -274,322,-256,41,337,432,378,225,-239,-447
+D7: .data 156,14,199,-58,68,29,-211,-45,-437,-268
+D8: .data -185,-409,-211,39,-34,377,21,-393,-85,223
+D9: .data 44,458,-380,465,-157,323,-29,-409,-345,218
+S0: .string "prg"
+S1: .string "fk"
+S2: .string "hcwhvydtdmslua"
+S3: .string "sfexlxbzgqff"
+S4: .string "nqvtftuazabqssvsp"
+S5: .string "spy"
+S6: .string "rdmhkkgpucimqlxsilu"
+S7: .string "ddmoewgxqifseqbjncv"
+S8: .string "wyqfagxc"
+S9: .string "rfjldtwa"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r4
+    prn 5
+endmcro
+mcro m1
+    sub @r3, @r2
+    prn 13
+endmcro
+mcro m2
+    sub @r2, @r5
+    prn 16
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 49
+endmcro
+mcro m4
+    sub @r2, @r2
+    prn 5
+endmcro
+sub L0, @r6
+bne @r6
+jsr L0
+inc L0
+m4
+sub @r4, @r7
+L0: sub @r0, @r0
+not L0
+m3
+sub L0, @r4
+lea L0, L0
+jsr L0
+clr L27
+cmp 46, -467
+m1
+cmp -69, 221
+prn L0
+mov L0, L0
+red L0
+lea L0, L0
+red L0
+jsr S7
+inc @r2
+dec L0
+L1: mov L1, L0
+clr L0
+bne L0
+rts
+lea L1, @r0
+m0
+L2: not L43
+sub 499, L1
+mov @r7, @r5
+prn -481
+add @r7, L2
+L3: not L1
+dec L3
+jsr L1
+inc L0
+jsr @r3
+bne @r6
+jsr @r7
+not L3
+cmp 329, -43
+sub 115, L1
+not L1
+cmp 317, @r0
+L4: inc @r6
+inc D0
+bne @r3
+cmp @r0, @r3
+red @r7
+cmp -246, L1
+jsr @r1
+bne D0
+L5: not @r7
+red @r0
+clr @r5
+cmp 45, @r6
+L6: cmp @r3, @r0
+jsr L5
+m3
+rts
+lea L40, @r3
+m4
+jmp @r6
+clr L0
+dec @r7
+m4
+prn L4
+not L0
+m2
+prn L3
+cmp @r2, @r1
+L7: add L0, @r7
+prn @r1
+L8: rts
+L9: inc @r0
+rts
+L10: add -301, @r6
+sub L8, @r2
+inc @r4
+jsr @r5
+inc L4
+jsr @r3
+jsr L1
+L11: add -38, @r2
+lea L5, L5
+cmp L14, L9
+prn -71
+red @r2
+dec D0
+inc L3
+not @r4
+clr L10
+lea L11, @r1
+add L11, @r5
+L12: add L10, L12
+jsr L0
+bne @r5
+red @r2
+mov @r2, L3
+inc L8
+jmp L4
+dec @r0
+sub L6, L3
+add -163, L10
+mov @r2, @r4
+mov -170, @r3
+mov L0, L11
+sub -203, @r7
+inc L12
+jmp L9
+lea L10, @r3
+m3
+not @r2
+add @r5, L10
+prn L8
+dec @r5
+prn @r1
+jsr L4
+jmp L5
+bne @r5
+jmp @r1
+jsr @r7
+m1
+jmp L9
+clr @r3
+sub L12, @r6
+sub L1, L7
+bne L4
+L13: red L12
+L14: inc L8
+jmp L11
+add -302, @r3
+jmp @r2
+dec L0
+bne L1
+rts
+rts
+inc @r0
+red @r3
+L15: sub L15, @r2
+mov @r3, L10
+cmp 500, 208
+L16: add @r3, @r7
+bne L12
+L17: mov L1, L15
+dec L3
+clr L19
+prn L3
+cmp -321, @r0
+red @r0
+lea L6, L9
+rts
+bne @r5
+L18: bne @r2
+jmp L8
+bne @r1
+L19: jsr @r1
+not X0
+inc S0
+red @r2
+jsr L1
+inc @r0
+red @r7
+red @r4
+L20: bne L7
+red D0
+clr L4
+L21: inc L0
+L22: rts
+mov -116, @r3
+prn -147
+sub @r1, @r6
+red @r0
+mov @r1, L16
+L23: cmp L8, @r5
+jmp L10
+mov L9, @r2
+add L9, L18
+L24: mov 444, @r6
+sub 295, @r3
+prn L20
+L25: dec L17
+dec L16
+prn L14
+mov L21, L0
+add L10, @r7
+add S8, L25
+m0
+jsr @r7
+mov D0, S8
+m3
+L26: clr L14
+L27: add -344, L25
+red L21
+dec @r5
+add L0, @r5
+rts
+clr L1
+dec L22
+red @r5
+mov @r5, L4
+red S7
+L28: red L22
+clr L11
+rts
+cmp 317, L8
+jsr L6
+red L18
+inc L22
+m0
+lea L28, L24
+sub @r4, @r0
+clr L17
+red L22
+bne L27
+add L58, @r2
+L29: mov L11, @r6
+sub L10, @r2
+jsr @r0
+mov L50, @r0
+cmp -71, @r6
+jmp L1
+m3
+m0
+red L3
+inc L11
+sub @r5, L29
+mov L13, L28
+L30: jmp @r4
+mov @r7, L6
+inc @r0
+add 70, @r4
+rts
+L31: red @r4
+m4
+m1
+red @r1
+inc L7
+red L0
+jmp L31
+lea L29, @r7
+L32: mov @r7, @r4
+L33: inc @r0
+m2
+m1
+dec @r0
+lea L11, @r0
+jmp @r0
+jmp L33
+add -329, L13
+m2
+m2
+jmp L22
+rts
+m1
+not @r0
+not @r4
+L34: bne L15
+prn L24
+clr L17
+m3
+lea L11, L15
+jmp @r6
+red @r6
+mov -213, L0
+clr @r5
+sub D0, @r3
+dec L37
+L35: prn @r5
+L36: rts
+jsr @r6
+mov 346, L13
+sub -510, @r4
+inc L29
+prn L27
+m0
+sub @r6, L7
+mov 22, @r0
+add L33, @r5
+dec @r1
+jmp @r6
+add @r4, L22
+red D0
+not @r4
+prn 297
+prn -84
+L37: red @r3
+L38: not L13
+sub -508, @r3
+sub L7, @r5
+m0
+clr L35
+lea L3, @r0
+m2
+add L31, D0
+cmp L38, @r6
+inc L3
+clr L36
+m4
+m2
+clr @r4
+rts
+red L34
+inc @r1
+lea L11, L25
+dec @r0
+prn 391
+jmp @r0
+rts
+clr @r2
+jsr @r5
+L39: red @r3
+L40: red @r3
+L41: not L37
+rts
+prn @r6
+lea L19, @r6
+m3
+bne L20
+m4
+m3
+prn L26
+m3
+m2
+red @r0
+mov 444, @r7
+L42: inc L4
+rts
+mov -470, L21
+prn -12
+prn L29
+mov -511, L21
+rts
+inc @r3
+prn L15
+lea L36, L13
+red L39
+clr L49
+L43: cmp L40, @r1
+rts
+mov @r4, @r4
+L44: add @r6, @r1
+red S5
+rts
+jsr L31
+lea S9, L39
+sub @r2, L27
+jmp S2
+jmp L31
+mov @r5, @r3
+add 437, X1
+jsr L18
+L45: sub 139, @r6
+L46: sub @r2, S8
+cmp 117, @r6
+not @r5
+jsr L13
+cmp -474, @r4
+L47: cmp @r5, L30
+m0
+not @r4
+jsr L5
+red @r5
+L48: jsr @r2
+L49: cmp 313, @r2
+mov D0, L1
+jmp @r4
+rts
+bne L20
+L50: mov L23, L20
+sub @r2, L44
+L51: dec L40
+rts
+clr L4
+dec L1
+rts
+red @r0
+m3
+L52: cmp @r5, 129
+cmp -111, L44
+sub @r5, @r5
+inc L38
+L53: add -438, @r0
+red L28
+cmp 94, L1
+dec @r5
+cmp -398, 429
+cmp -344, X2
+add @r4, @r7
+cmp L14, L47
+L54: red L28
+rts
+m0
+mov -372, @r4
+sub L9, L53
+dec L53
+sub L14, @r3
+prn -155
+red L41
+L55: bne L53
+prn L0
+bne @r2
+jmp @r5
+lea L14, L5
+not @r0
+add -137, @r5
+L56: clr @r1
+L57: red @r3
+red L7
+inc L58
+bne @r4
+jsr @r6
+add @r5, S6
+m4
+not @r1
+m2
+bne D0
+sub -146, D0
+red @r6
+m1
+dec L59
+dec D0
+jsr L8
+red L18
+clr @r3
+L58: clr L8
+red L6
+lea S7, @r1
+jmp L31
+not L56
+dec X3
+cmp D0, L49
+red D0
+not S2
+m3
+L59: lea S5, S3
+mov X4, D0
+stop
+D0: .data -83,49,-351,-360,76,-428,-87,138,-53,-136
+D1: .data -254,243,19,-53,-7,-375,-492,-352,461,-469
+D2: .data -427,-248,345,-384,249,220,7,22,-313,366
+D3: .data -294,-336,393,-22,47,-415,120,-142,-384,446
+D4: .data -475,-90,173,107,172,-271,390,-79,-245,264
+D5: .data -289,96,-140,461,387,-484,361,-291,400,432
+D6: .data -326,212,284,-431,-22,-38,419,260,296,248
+D7: .data 479,62,278,29,-115,-187,-30,452,-148,-110
+D8: .data 283,-22,-241,-339,-281,-493,53,403,332,400
+D9: .data -227,-246,-210,-177,-252,-241,163,3,-201,78
+S0: .string "rggdpstmm"
+S1: .string "otegjxteh"
+S2: .string "fru"
+S3: .string "ho"
+S4: .string "zz"
+S5: .string "gq"
+S6: .string "kudwawyqtcjshfle"
+S7: .string "y"
+S8: .string "hrfxiimzphbybe"
+S9: .string "zoykngjlv"
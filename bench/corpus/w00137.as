@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r7
+    prn 44
+endmcro
+mcro m1
+    sub @r7, @r3
+    prn 11
+endmcro
+mcro m2
+    sub @r4, @r3
+    prn 81
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 25
+endmcro
+mcro m4
+    sub @r4, @r0
+    prn 62
+endmcro
+dec L0
+m3
+jmp L0
+L0: jsr @r4
+lea L0, @r3
+m2
+sub L0, L0
+L1: inc @r6
+not L0
+cmp @r1, @r7
+sub L0, @r0
+dec L0
+sub L1, L1
+m0
+red @r0
+inc L0
+L2: inc L2
+clr @r3
+mov L1, @r1
+inc @r1
+add 390, L2
+inc @r4
+L3: sub L2, @r7
+lea L0, @r7
+sub L3, L0
+mov L3, X0
+cmp -485, @r2
+mov 223, @r4
+jsr L0
+inc L0
+lea L2, @r4
+dec L1
+jsr @r0
+inc L3
+cmp S2, L1
+m4
+not @r1
+jsr L1
+L4: sub @r4, @r2
+prn D0
+jmp @r5
+jsr L4
+m3
+rts
+L5: rts
+mov -7, L3
+m4
+L6: mov L2, @r5
+inc @r1
+clr L2
+cmp @r6, @r0
+inc L0
+m1
+jmp @r6
+jsr @r3
+jsr L6
+cmp @r6, @r4
+rts
+lea L1, L0
+jmp @r3
+lea L6, @r2
+clr L0
+not @r0
+not @r4
+cmp -117, L0
+red L4
+lea L6, L1
+L7: lea L5, D0
+jmp @r2
+bne @r2
+rts
+red L1
+L8: jsr L0
+cmp @r4, @r6
+L9: jsr @r4
+clr @r3
+jmp @r7
+add L0, L8
+rts
+L10: jsr @r1
+m4
+red @r3
+cmp @r3, 390
+add 345, @r2
+rts
+L11: clr L10
+lea L9, @r2
+cmp @r1, L11
+rts
+prn @r6
+red @r4
+inc L0
+mov -117, L10
+m1
+lea L11, L2
+rts
+add @r5, L11
+inc @r7
+L12: clr D0
+red @r0
+jmp L7
+lea L12, @r3
+add L0, L5
+add @r6, @r1
+L13: jsr @r3
+mov -175, @r2
+sub @r7, @r4
+bne L9
+m0
+sub L11, L11
+jsr @r6
+L14: cmp -485, L7
+dec @r1
+jmp L14
+sub 505, @r4
+rts
+lea L14, L2
+L15: red L5
+dec L8
+red L8
+mov @r5, L14
+rts
+jmp L11
+cmp @r6, L2
+lea L7, @r2
+add -329, @r2
+bne @r3
+mov @r4, @r0
+red @r6
+add @r7, @r4
+red L12
+L16: jmp @r5
+L17: sub L10, @r3
+cmp @r2, 150
+not L17
+add @r2, @r4
+L18: rts
+L19: prn L4
+L20: lea L20, @r2
+clr @r0
+lea L8, L13
+sub L7, @r7
+prn -69
+bne @r4
+red L1
+clr @r1
+mov 339, @r1
+inc L20
+not @r7
+L21: sub @r4, L14
+cmp @r2, L4
+bne @r4
+L22: dec @r7
+rts
+add L8, L5
+cmp 419, L18
+lea L15, @r0
+clr L19
+m3
+prn @r4
+m3
+dec @r5
+jmp @r4
+prn L10
+m0
+rts
+rts
+m3
+jmp L14
+bne L3
+m1
+red @r6
+prn 365
+add @r6, S9
+cmp 34, -482
+not @r0
+bne L11
+red L20
+red @r2
+sub L18, L43
+prn L18
+sub @r0, L22
+L23: dec @r3
+L24: rts
+m0
+jsr L9
+m4
+dec L8
+prn @r0
+lea L6, L47
+not @r6
+bne L4
+jmp @r1
+mov @r3, L14
+dec @r3
+add -236, D0
+inc @r5
+bne L2
+red @r5
+L25: dec L3
+cmp 194, L12
+m0
+L26: prn L21
+prn L23
+not @r0
+prn L9
+jsr @r5
+red @r5
+m3
+L27: clr @r4
+dec L18
+not L21
+mov 389, L12
+red L15
+rts
+bne @r2
+mov L7, @r3
+m2
+not S8
+add -291, L15
+clr S3
+sub 230, @r0
+jmp L26
+cmp 128, L23
+jmp D0
+prn 20
+prn @r0
+clr L5
+prn L3
+dec @r6
+L28: add L34, L24
+rts
+jmp L2
+not @r4
+cmp L26, @r1
+red @r1
+bne @r7
+rts
+inc @r6
+jmp L28
+L29: inc @r5
+add L16, @r4
+L30: prn -390
+L31: not @r4
+jsr @r5
+mov @r4, L50
+m2
+L32: bne @r5
+L33: rts
+bne @r2
+inc @r6
+inc L21
+clr L29
+red @r2
+bne @r4
+L34: dec @r3
+rts
+inc L0
+rts
+jmp @r4
+lea L15, L6
+cmp @r7, L1
+red @r6
+lea L7, L24
+m0
+prn @r7
+cmp -39, 28
+jsr @r4
+inc S6
+not L25
+lea L11, @r1
+m3
+L35: add 64, @r3
+lea L8, L16
+L36: red @r5
+clr @r7
+clr S6
+jmp L12
+m3
+not @r0
+L37: prn @r3
+red L9
+red L16
+jsr L19
+clr @r2
+add @r7, @r6
+bne @r6
+prn @r6
+L38: prn L29
+bne @r7
+m3
+rts
+L39: jmp @r0
+red L12
+dec L18
+bne @r5
+m1
+jsr L32
+bne @r1
+jmp D0
+L40: clr @r4
+jsr L2
+m1
+mov @r1, L55
+rts
+jsr @r6
+add L56, @r7
+clr L7
+sub -464, L16
+prn 105
+rts
+sub @r7, @r3
+L41: mov -423, L0
+clr L13
+L42: not @r4
+sub -150, @r0
+m4
+inc @r2
+red @r5
+bne L0
+clr @r5
+dec L10
+L43: inc L21
+not X1
+add 173, L35
+clr L16
+clr @r5
+m4
+cmp @r0, @r4
+jsr @r6
+not L0
+L44: mov @r4, L6
+inc @r3
+rts
+L45: prn @r3
+red @r6
+mov L4, @r3
+dec @r5
+rts
+prn @r5
+inc L6
+jsr L37
+m2
+prn @r5
+add L22, S1
+cmp L45, 26
+rts
+m1
+L46: red L34
+L47: cmp 473, @r2
+prn @r2
+jmp @r6
+clr S5
+L48: clr @r4
+red @r4
+mov @r6, L24
+add 363, @r0
+not L49
+red @r3
+inc D0
+red L12
+lea L21, L18
+add @r4, L43
+m3
+m0
+dec @r6
+rts
+cmp -46, 397
+m3
+inc L10
+cmp -80, @r6
+bne L0
+lea L39, L13
+bne L28
+prn -111
+m4
+clr @r7
+m3
+L49: cmp L45, L59
+not @r4
+clr @r5
+L50: jsr L44
+jmp @r4
+jsr L55
+lea L50, L14
+L51: sub @r5, @r7
+L52: cmp @r3, D0
+cmp @r0, @r5
+not @r3
+cmp 125, X2
+L53: bne L57
+prn L21
+cmp @r3, @r3
+m0
+not X3
+dec L35
+rts
+rts
+cmp @r6, @r1
+rts
+L54: add L58, @r6
+not @r1
+inc L20
+inc L52
+L55: sub @r3, @r3
+inc @r7
+m0
+jmp @r2
+prn -181
+add @r3, @r4
+L56: bne @r0
+dec @r5
+lea D0, @r5
+sub L31, @r7
+bne L15
+prn 347
+prn 447
+jsr L58
+rts
+not @r0
+prn L49
+dec D0
+not @r0
+m3
+inc @r1
+sub -317, L34
+L57: red @r2
+sub -235, @r5
+clr @r3
+cmp L58, L58
+L58: sub @r7, S8
+L59: red S0
+add @r3, S9
+red L46
+m1
+add D0, D0
+not S0
+clr L1
+rts
+red X4
+stop
+D0: .data 186,237,-230,435,-71,130,-376,-495,348,207
+D1: .data 348,158,-27,-222,-323,-60,369,165,-67,-373
+D2: .data -274,115,-35,341,-335,-286,-33,187,170,-497
+D3: .data -169,304,-432,-66,434,-223,-4,262,-275,-112
+D4: .data 44,180,129,-203,471,-330,-462,52,235,236
+D5: .data 264,-217,-51,-484,52,291,409,194,-243,-183
+D6: .data -39,-410,-183,158,113,-373,-28,-448,462,47
+D7: .data 158,-73,-64,-445,-288,383,-126,-277,72,-134
+D8: .data -315,220,-167,-459,366,-218,-98,102,494,-187
+D9: .data 112,-112,293,375,-268,120,-453,-196,292,500
+S0: .string "nwclbdhppfyzxyuus"
+S1: .string "swyxtzlldfhfownkd"
+S2: .string "az"
+S3: .string "ttpfufugjpvqlbwbl"
+S4: .string "y"
+S5: .string "avf"
+S6: .string "wgrmijvjqizhyox"
+S7: .string "jesqoaknpzwuaewtyiv"
+S8: .string "lgcggsuquvtllbigzs"
+S9: .string "kgtjdszefsv"
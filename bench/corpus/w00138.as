@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r1
+    prn 14
+endmcro
+mcro m1
+    sub @r3, @r5
+    prn 10
+endmcro
+mcro m2
+    sub @r6, @r1
+    prn 79
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 1
+endmcro
+mcro m4
+    sub @r6, @r7
+    prn 86
+endmcro
+rts
+inc @r4
+mov 445, L0
+prn 323
+prn 11
+add @r0, @r2
+m3
+rts
+add 55, L0
+m3
+jsr L0
+m2
+dec @r5
+jsr L0
+jsr L0
+bne @r6
+m3
+not @r2
+sub 51, L0
+rts
+not L0
+sub L0, @r6
+prn -316
+lea L0, @r7
+add -468, S7
+rts
+lea L0, @r1
+add -207, @r2
+prn @r3
+bne L0
+jmp @r7
+prn @r5
+L0: not L0
+jmp L0
+dec L0
+jmp L0
+lea L0, L0
+red L0
+L1: prn L0
+not @r6
+bne L0
+add -45, @r5
+dec @r5
+cmp L1, -381
+m1
+inc L1
+not L1
+lea L1, @r4
+jmp L0
+L2: rts
+lea L0, L0
+jmp L1
+dec L2
+lea L2, X0
+lea L2, @r2
+m1
+lea L2, @r4
+jmp @r1
+rts
+jmp L0
+sub -264, L0
+m3
+sub @r0, @r6
+inc @r2
+inc @r1
+jsr L1
+L3: jmp L0
+jmp L3
+rts
+dec @r6
+L4: add 37, D0
+add -368, L1
+add L2, @r2
+bne L0
+dec L1
+inc @r0
+lea L2, L3
+prn L4
+inc L1
+prn 413
+bne @r0
+prn @r4
+not L2
+jmp L1
+clr @r2
+L5: clr L4
+red @r1
+L6: bne L14
+rts
+L7: add @r4, L5
+L8: red @r3
+m3
+sub L2, @r1
+L9: prn 301
+sub @r0, L6
+sub 415, @r7
+mov -235, L9
+jsr @r5
+clr @r7
+not L5
+cmp L6, -178
+jmp @r0
+bne L2
+not L1
+L10: prn L0
+clr L1
+m4
+lea L10, L8
+jsr @r4
+red @r1
+m1
+cmp -69, 299
+m2
+jsr @r1
+lea L3, @r3
+lea L7, @r1
+rts
+jsr L4
+L11: add 377, L10
+jmp L5
+dec @r7
+prn S0
+lea L7, @r1
+L12: rts
+bne L9
+inc L2
+red @r5
+L13: jmp @r2
+bne L10
+clr L0
+jsr @r7
+dec @r0
+not @r2
+jsr D0
+jsr @r3
+rts
+cmp -185, L7
+clr @r0
+L14: sub L1, @r6
+sub @r1, @r6
+inc S1
+cmp @r0, L13
+red L5
+jmp @r4
+lea L14, @r0
+add @r7, @r4
+sub L9, L9
+m3
+inc @r2
+lea L5, @r3
+add 363, @r5
+rts
+not @r4
+add @r1, @r7
+L15: sub 142, @r6
+sub L7, @r2
+L16: cmp -407, 91
+m2
+cmp @r2, @r1
+add -52, @r3
+not @r2
+mov -378, @r0
+dec @r6
+prn @r5
+L17: sub @r7, @r1
+inc L12
+red L3
+inc L14
+m4
+L18: jsr L8
+clr D0
+not L7
+sub -58, L9
+lea L9, L18
+red L8
+L19: clr @r7
+L20: red @r5
+lea L9, L1
+jsr L9
+not @r5
+red L4
+m4
+clr @r4
+jsr L14
+mov -142, L0
+lea L9, L10
+inc @r3
+L21: rts
+L22: sub @r7, L10
+cmp 108, @r2
+sub @r6, @r7
+bne L18
+prn L22
+L23: rts
+not L23
+m1
+m2
+rts
+jsr @r7
+jsr @r7
+jsr @r7
+not @r3
+prn 6
+bne @r1
+clr @r1
+lea L14, @r2
+mov @r1, @r0
+L24: jmp @r5
+m4
+red L7
+cmp 87, @r7
+jmp L4
+not L16
+bne @r6
+clr @r3
+jsr D0
+m0
+cmp -462, L8
+add D0, @r7
+rts
+L25: red @r0
+clr L32
+m0
+lea S3, L17
+jsr L24
+m0
+lea L7, @r0
+rts
+mov 453, L21
+inc @r3
+inc @r4
+red @r1
+bne @r4
+red L16
+cmp L13, 35
+m4
+prn -291
+L26: bne @r7
+sub @r1, @r4
+add L2, L2
+L27: add 268, L43
+L28: cmp @r1, -357
+mov L11, @r4
+red @r6
+clr @r5
+prn L0
+cmp 111, L45
+not L6
+lea L26, L13
+sub @r4, @r3
+bne @r3
+m3
+rts
+bne L8
+dec @r7
+prn L12
+not @r4
+m0
+jsr @r3
+clr @r5
+sub -371, @r1
+L29: not @r7
+dec L7
+L30: mov 435, L6
+not L28
+L31: prn @r2
+bne @r1
+dec L20
+rts
+cmp L23, @r2
+L32: clr @r5
+prn 336
+sub @r5, @r3
+lea L25, @r5
+inc @r7
+bne @r6
+clr L24
+jmp @r6
+lea L2, @r3
+sub -94, L4
+L33: dec @r4
+L34: clr @r0
+rts
+inc @r0
+m1
+rts
+cmp L19, L31
+mov D0, L5
+dec L20
+jmp @r7
+L35: dec @r6
+cmp L17, L10
+m2
+L36: lea D0, @r5
+prn @r0
+not @r0
+L37: clr @r4
+inc L35
+jmp L34
+m4
+bne @r1
+add @r4, @r2
+rts
+rts
+m1
+sub -149, @r2
+red @r5
+clr @r0
+sub -407, L14
+jmp @r2
+L38: sub L50, @r7
+mov L24, @r3
+sub L26, @r3
+sub S2, @r5
+dec @r3
+m4
+red L20
+bne @r7
+add @r7, L21
+rts
+prn @r1
+jsr L58
+dec @r2
+not @r7
+prn L24
+m0
+lea L54, D0
+dec @r2
+jsr @r0
+L39: mov X1, L0
+not L10
+inc L25
+jsr L4
+m3
+jmp @r0
+lea L31, @r1
+m2
+inc L18
+L40: red @r2
+m0
+L41: cmp L36, 141
+jsr L16
+clr L37
+not @r0
+L42: bne @r5
+cmp L39, @r3
+lea L7, L40
+rts
+rts
+clr @r0
+jsr L23
+inc L48
+rts
+L43: mov 20, L35
+mov @r7, L27
+inc @r2
+dec L26
+inc L31
+mov L35, L50
+add L32, L42
+lea L21, L57
+lea L50, @r6
+jmp @r6
+add @r6, @r7
+L44: dec L40
+not @r1
+cmp 432, L11
+jsr L42
+lea L31, @r3
+clr @r4
+red L14
+inc L1
+cmp L5, 463
+dec L17
+jsr @r5
+jmp S7
+jmp L27
+jmp @r4
+clr @r7
+m0
+add L6, L44
+L45: lea L23, L23
+sub L0, @r0
+sub -162, L10
+add L50, @r6
+L46: lea L16, @r2
+dec X2
+rts
+sub @r5, @r3
+red L32
+m3
+bne @r3
+add D0, X3
+clr L14
+L47: mov 267, L29
+rts
+rts
+L48: prn L18
+mov 430, L45
+jmp L0
+not @r3
+L49: dec @r4
+mov L44, L39
+m1
+mov @r6, L34
+L50: lea L7, @r6
+jmp @r3
+lea L56, L31
+cmp 316, 62
+mov D0, L56
+L51: clr L30
+L52: lea L11, L22
+m4
+jsr L29
+clr @r6
+add @r2, @r1
+clr L17
+lea L55, @r6
+m1
+jmp L51
+L53: red @r5
+m2
+L54: red L37
+jsr L55
+L55: dec @r1
+rts
+lea L56, @r5
+dec L9
+inc @r1
+rts
+sub 481, X4
+lea L57, L23
+L56: cmp -476, S5
+L57: mov -381, @r0
+L58: rts
+bne D0
+lea S3, L21
+prn D0
+L59: bne D0
+m0
+stop
+D0: .data -338,-313,5,-49,-42,230,363,-62,-381,-353
+D1: .data -138,-105,-472,-468,429,-431,-295,128,-495,-161
+D2: .data 91,64,349,65,79,-170,171,-32,383,339
+D3: .data -318,229,52,-463,-392,-35,262,95,274,332
+D4: .data -315,-198,-109,-368,-144,424,-118,-146,-64,-136
+D5: .data 410,382,110,-112,-431,496,18,157,233,-268
+D6: .data -395,-62,474,-264,356,246,120,499,70,-90
+D7: .data 480,-277,-235,471,24,-46,-191,254,281,-469
+D8: .data 492,-351,-137,-484,236,-241,131,449,466,-205
+D9: .data -428,198,383,401,456,-150,-161,-156,-43,486
+S0: .string "nhpeojnysxktwbeuer"
+S1: .string "bgjlobgfqoeiiwbz"
+S2: .string "gwfkfec"
+S3: .string "jwwaoqohak"
+S4: .string "pxgwu"
+S5: .string "nghdxhjgexxhayjgx"
+S6: .string "mfjtfsjwen"
+S7: .string "ueezclkfilhubfy"
+S8: .string "xefvpsgucryluib"
+S9: .string "blqnn"
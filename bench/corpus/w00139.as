@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r4
+    prn 52
+endmcro
+mcro m1
+    sub @r0, @r6
+    prn 8
+endmcro
+mcro m2
+    sub @r0, @r7
+    prn 44
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 78
+endmcro
+mcro m4
+    sub @r0, @r5
+    prn 11
+endmcro
+lea L0, @r2
+clr @r0
+m1
+inc @r0
+jsr @r4
+not L0
+jmp S6
+inc @r3
+jsr @r6
+dec L0
+sub S2, @r2
+bne @r6
+bne L0
+L0: sub L0, L0
+L1: rts
+red @r3
+mov @r0, S4
+dec L1
+m4
+not @r1
+add L0, @r6
+jmp L0
+dec L39
+add L1, L0
+rts
+L2: red L0
+not L1
+sub L0, @r2
+sub L0, L16
+jmp L2
+sub 155, @r5
+dec L0
+m0
+inc @r4
+m1
+L3: cmp -360, L52
+L4: rts
+add @r4, L3
+jsr @r3
+add @r7, @r6
+cmp -147, 379
+m1
+bne @r4
+bne @r1
+sub L44, @r5
+inc @r6
+lea L0, @r2
+not L4
+dec L3
+jmp @r4
+prn @r3
+m1
+not @r2
+add @r3, @r2
+red @r7
+bne @r7
+L5: inc @r0
+not @r5
+inc L3
+jsr @r4
+L6: cmp 101, @r7
+add 69, L0
+clr @r3
+inc L2
+L7: prn -285
+L8: mov L0, @r1
+cmp @r4, @r1
+clr L7
+lea L2, L5
+red L0
+jsr @r2
+mov @r2, @r0
+L9: inc L8
+L10: dec X0
+L11: inc L1
+bne L40
+L12: red L5
+bne @r0
+add L1, @r5
+inc @r3
+bne @r3
+lea L7, @r1
+dec @r4
+m2
+add @r1, L7
+L13: inc L7
+prn L12
+rts
+sub -142, @r7
+jmp L5
+bne L35
+dec @r1
+lea L9, L10
+jmp @r4
+cmp -228, L2
+rts
+mov L10, L10
+bne L10
+sub -376, @r0
+cmp -396, L13
+jsr @r0
+rts
+L14: clr @r2
+not L0
+m2
+jsr X1
+add L7, @r1
+rts
+rts
+red @r7
+prn @r1
+lea L6, @r5
+inc L13
+clr @r3
+jsr @r0
+L15: inc @r7
+red @r3
+prn 276
+cmp L13, @r4
+m1
+cmp L6, @r0
+bne L10
+rts
+cmp @r7, @r6
+jmp @r7
+add @r2, L40
+prn @r1
+jmp @r2
+mov L0, @r7
+red L58
+inc @r7
+mov -230, L14
+sub 212, L11
+rts
+cmp L0, @r4
+dec L13
+m3
+inc @r4
+not @r2
+lea L9, L31
+m4
+m1
+clr @r0
+jsr L12
+L16: rts
+sub L9, L14
+not @r4
+mov @r1, @r5
+inc L10
+red L9
+cmp @r5, @r4
+add L3, L13
+L17: red L1
+L18: mov 332, L5
+cmp 358, @r2
+dec L4
+lea L8, L15
+mov L5, L8
+prn @r2
+mov @r0, @r2
+not L12
+m0
+sub -13, L13
+bne @r3
+mov L13, L1
+inc L7
+bne @r7
+mov -201, @r5
+rts
+m1
+m4
+m4
+L19: cmp 194, -42
+add L11, @r0
+mov @r1, L17
+m2
+L20: cmp L8, @r3
+rts
+not L35
+jsr L2
+L21: clr L18
+jsr @r6
+cmp -384, 176
+add @r1, L21
+rts
+m0
+m4
+cmp -380, L9
+add -20, L0
+inc @r4
+jsr @r7
+L22: cmp -241, L11
+cmp @r4, @r5
+mov @r4, L8
+L23: prn 119
+dec @r1
+lea L9, @r6
+red @r0
+m3
+lea X2, @r2
+red @r4
+dec L13
+m3
+sub @r2, @r6
+mov -427, @r0
+L24: cmp @r5, L21
+inc @r2
+m3
+bne @r7
+dec @r6
+rts
+m4
+red @r7
+jmp @r0
+m4
+cmp @r1, @r5
+m2
+prn -380
+rts
+not @r0
+L25: inc @r4
+bne @r1
+m2
+jmp L1
+red L15
+add -36, @r2
+m4
+jmp @r3
+bne L17
+L26: inc @r1
+not @r2
+lea L26, L24
+m2
+cmp L0, @r2
+mov L19, L17
+jsr L11
+prn L48
+clr @r1
+dec @r4
+L27: add 20, @r7
+jsr L41
+cmp 230, 34
+jmp L19
+rts
+mov 402, L10
+prn @r4
+cmp 114, -68
+mov -293, L50
+prn @r0
+jmp @r0
+add @r4, L10
+L28: lea L4, @r2
+red L9
+jsr @r7
+m0
+L29: red L4
+clr @r4
+dec L28
+sub -301, @r0
+dec D0
+not L29
+bne @r0
+prn @r4
+jmp @r1
+mov L29, @r3
+m4
+L30: jsr L30
+sub -15, L15
+mov 475, @r5
+prn @r2
+sub 106, L18
+clr L9
+sub @r5, @r5
+prn @r3
+jmp @r3
+not L20
+rts
+dec L8
+rts
+clr L21
+jmp @r2
+prn @r7
+cmp L0, -376
+L31: not @r3
+bne @r5
+jmp @r5
+add 443, @r6
+L32: jmp L22
+rts
+jmp L10
+cmp -284, @r3
+cmp @r4, L4
+L33: bne @r3
+L34: mov @r5, @r2
+m1
+jmp @r6
+m4
+inc @r5
+jmp @r4
+L35: not L36
+add @r6, @r4
+cmp 64, L23
+red @r2
+prn -171
+jmp @r4
+m0
+prn 228
+sub @r6, L9
+mov 124, L30
+prn L43
+L36: cmp L8, @r2
+red @r6
+prn @r6
+cmp L22, D0
+L37: lea L32, @r2
+clr @r7
+jmp @r1
+L38: cmp L8, L13
+add @r4, L8
+jsr L4
+L39: prn @r6
+jsr L30
+prn L27
+dec L27
+not L33
+mov D0, L16
+mov L7, L10
+mov L18, L4
+inc L7
+mov @r5, L5
+cmp -45, @r7
+L40: dec @r0
+red @r2
+lea L26, D0
+m1
+lea D0, L56
+red @r7
+prn -499
+bne @r7
+L41: add @r6, @r2
+prn L0
+inc @r0
+mov @r6, @r2
+not @r3
+jsr L10
+rts
+sub 102, @r5
+L42: jmp @r1
+inc L12
+clr @r3
+add -425, @r2
+red L16
+rts
+jmp @r1
+jmp @r5
+prn -187
+mov -313, L0
+prn -259
+not L22
+rts
+L43: bne D0
+red @r2
+L44: rts
+sub -319, @r2
+jsr @r1
+dec @r3
+jsr X3
+add -111, L46
+sub @r2, D0
+bne L13
+red @r5
+prn 119
+red @r7
+dec @r3
+cmp L30, @r0
+m1
+L45: jmp L24
+inc L30
+inc @r2
+L46: rts
+red @r4
+cmp @r3, 36
+L47: bne @r3
+jsr @r7
+red L39
+dec @r6
+bne L44
+red L48
+L48: sub L11, L30
+red L21
+sub @r6, L6
+sub -477, @r7
+clr S7
+L49: mov 491, @r5
+L50: not @r6
+L51: lea L36, D0
+red @r2
+m1
+add @r0, @r4
+rts
+rts
+jsr @r2
+m0
+prn L13
+L52: add -379, L58
+dec @r4
+L53: not S4
+red @r4
+L54: rts
+rts
+clr @r4
+sub 115, @r6
+clr @r1
+jsr L24
+add S1, @r6
+prn -32
+m3
+L55: lea L35, @r1
+mov @r7, @r2
+clr @r4
+jmp @r0
+jsr @r0
+jsr S6
+L56: jsr @r5
+bne L19
+add L58, @r1
+m4
+L57: inc X4
+dec L6
+dec @r1
+inc L29
+m1
+not S0
+clr @r2
+inc @r7
+L58: mov S4, L46
+jmp L59
+clr L54
+sub S5, L46
+L59: sub D0, L30
+stop
+D0: .data 339,364,-436,325,348,50,472,-219,140,-268
+D1: .data 479,377,389,-270,-95,482,-291,35,24,372
+D2: .data -173,324,225,169,161,-83,-354,309,-265,-43
+D3: .data 5,-462,45,-254,118,21,-161,-470,-63,-29
+D4: .data -264,16,-71,-119,370,445,-477,186,90,5
+D5: .data -206,461,272,109,-187,-195,-151,2,-203,-10
+D6: .data -139,-44,-197,-386,-28,46,33,-366,-353,-432
+D7: .data -371,208,-470,-98,-481,-496,283,-351,-269,476
+D8: .data -203,-316,-351,-52,458,81,331,-403,-395,379
+D9: .data 181,-293,-125,-73,138,407,-130,489,246,174
+S0: .string "ood"
+S1: .string "siph"
+S2: .string "zfgk"
+S3: .string "cdiqgslfbvywcpmukeun"
+S4: .string "dstxafyrhgxguv"
+S5: .string "hnbzohcls"
+S6: .string "u"
+S7: .string "upnvezqbmzs"
+S8: .string "cqnyvcd"
+S9: .string "jxesjxlcshgwzxxuj"
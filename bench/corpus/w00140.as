@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r6
+    prn 23
+endmcro
+mcro m1
+    sub @r4, @r7
+    prn 75
+endmcro
+mcro m2
+    sub @r2, @r5
+    prn 9
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 22
+endmcro
+mcro m4
+    sub @r2, @r3
+    prn 35
+endmcro
+L0: sub 230, @r4
+mov @r2, @r3
+L1: lea L0, @r4
+jsr @r0
+dec L1
+lea L1, @r1
+jsr @r7
+m4
+red L0
+dec L0
+jsr L1
+clr @r0
+sub L1, @r5
+clr L0
+L2: rts
+prn L6
+jmp L2
+m4
+inc @r5
+jsr L2
+L3: jsr L0
+m0
+sub @r3, L3
+sub @r2, L2
+m0
+not L3
+mov 368, @r2
+lea L0, @r2
+m1
+m1
+not @r4
+not @r5
+inc L0
+mov L1, L0
+m0
+m4
+jsr L2
+m1
+L4: not @r6
+rts
+jsr L3
+prn @r4
+dec @r6
+m3
+mov -318, @r1
+not L1
+bne L2
+jmp @r7
+L5: inc L2
+not L45
+m1
+lea L4, L4
+jsr @r4
+not @r7
+L6: lea L3, L3
+L7: sub -367, @r2
+inc @r3
+sub @r2, D0
+inc @r0
+inc @r4
+not @r0
+mov -439, @r6
+jsr @r0
+bne @r1
+lea L40, @r4
+L8: jmp @r1
+lea L4, D0
+L9: rts
+rts
+sub @r2, L6
+L10: inc @r1
+prn @r1
+m3
+lea L10, L9
+m4
+sub -104, L1
+m0
+cmp L2, L2
+red @r4
+sub L10, L9
+rts
+bne L2
+m1
+cmp L4, L10
+L11: jsr @r6
+jsr @r6
+prn @r1
+clr L6
+L12: clr @r4
+mov @r3, L7
+red L7
+not D0
+L13: sub @r6, @r4
+L14: red L6
+dec L6
+m1
+L15: lea L6, @r6
+prn L11
+L16: dec @r2
+add S3, L4
+mov L2, @r6
+jmp L4
+red L12
+sub -97, L7
+red L6
+bne @r7
+inc @r3
+L17: inc L14
+sub D0, L15
+red L15
+lea L10, L9
+mov 385, L0
+add 258, L9
+rts
+lea L10, L17
+add 442, @r4
+m2
+m3
+rts
+lea L2, @r7
+red @r0
+rts
+dec L3
+inc L13
+L18: bne L5
+mov 476, L18
+cmp 55, L16
+jsr @r4
+add L17, @r5
+mov L18, @r4
+cmp @r6, -42
+jmp @r0
+prn L8
+add -503, @r6
+red L2
+inc L57
+rts
+add @r4, @r2
+m0
+red L12
+jsr L12
+not L9
+L19: clr L0
+jsr L13
+lea D0, @r0
+dec L2
+L20: inc @r7
+lea L6, @r2
+bne @r6
+jsr @r3
+not @r6
+L21: add @r4, L8
+jmp @r0
+L22: jsr L11
+not L12
+L23: add L3, L23
+m4
+red @r5
+m4
+lea L18, @r1
+red L3
+inc S8
+clr L3
+cmp @r7, @r7
+m4
+prn @r7
+jsr @r6
+not @r3
+add @r1, L5
+L24: sub @r4, @r2
+add 304, L12
+m2
+add 203, @r7
+not L23
+lea D0, @r4
+not L23
+not @r1
+L25: rts
+bne @r1
+add @r5, L0
+dec L3
+prn @r0
+m3
+bne L18
+jmp L16
+clr @r1
+jsr @r6
+mov @r3, @r0
+m1
+sub @r0, L17
+red @r4
+red L13
+not S6
+not L23
+red L20
+jsr L0
+inc @r0
+clr L15
+cmp L22, @r0
+L26: prn @r1
+jmp L13
+L27: bne L11
+m4
+add L26, L8
+lea L24, @r7
+m2
+L28: bne @r2
+m4
+L29: red L3
+mov L7, @r4
+L30: prn L13
+clr L30
+inc @r1
+lea L25, L3
+inc L17
+sub @r4, L11
+inc L6
+mov @r1, @r2
+add 311, L14
+jmp L24
+red @r7
+prn L18
+L31: jmp L30
+rts
+red L12
+jsr L59
+L32: jsr @r6
+clr S5
+jsr S7
+cmp L3, @r6
+inc L16
+m0
+L33: prn @r6
+m0
+m3
+sub -191, @r0
+bne @r0
+m3
+bne @r1
+bne L9
+not L18
+m1
+clr @r2
+prn @r3
+inc L2
+prn 158
+add @r4, L20
+lea L30, D0
+mov 196, @r0
+cmp 259, -422
+inc L31
+inc @r3
+mov @r1, @r4
+dec L24
+clr @r7
+prn 229
+clr L19
+rts
+sub 59, L22
+inc L10
+L34: dec L32
+L35: sub L7, @r7
+red L10
+sub 437, L6
+sub L48, L3
+jsr L23
+add 330, @r0
+prn L0
+bne L15
+jmp L47
+jmp X0
+sub @r1, L14
+L36: cmp -118, @r2
+prn 137
+jmp L13
+L37: lea L29, @r6
+mov @r6, @r3
+L38: rts
+sub 55, @r6
+mov L8, D0
+add -67, @r1
+rts
+add L34, @r0
+clr L14
+L39: red @r1
+m2
+lea L40, L25
+sub L36, @r2
+rts
+L40: clr @r5
+lea L11, @r5
+clr D0
+jmp L31
+L41: jmp @r1
+not @r2
+sub L22, L46
+L42: dec @r5
+not L8
+red L5
+L43: cmp -490, L36
+bne L20
+clr @r1
+clr @r2
+rts
+bne @r4
+lea L31, D0
+L44: cmp L33, L42
+L45: lea L8, @r5
+jmp L12
+jmp @r6
+not @r1
+dec @r6
+L46: mov S4, @r3
+not S7
+prn 490
+red L40
+lea S2, L12
+cmp L0, @r1
+L47: prn @r1
+prn 211
+lea L23, @r1
+m1
+not @r6
+jmp @r6
+jsr @r7
+mov -267, L27
+m3
+L48: jmp @r4
+inc L13
+bne L32
+m4
+m2
+prn @r0
+cmp -222, -509
+rts
+add @r0, L39
+sub 292, L14
+jsr @r1
+prn -317
+rts
+bne @r0
+jsr @r3
+clr L37
+inc @r4
+sub @r6, L55
+dec @r2
+jsr @r1
+not L32
+add L26, L6
+clr L33
+inc L36
+jsr @r4
+cmp @r1, @r6
+prn -183
+L49: mov L23, @r3
+mov @r3, @r2
+dec L56
+dec @r5
+rts
+sub @r7, L7
+prn @r0
+dec @r3
+L50: rts
+lea L15, @r0
+dec @r7
+not S9
+bne L48
+mov L14, L38
+lea X1, @r7
+m3
+jmp @r5
+L51: rts
+jmp @r6
+clr X2
+mov @r6, L20
+L52: red @r4
+sub L57, @r1
+mov L5, L47
+lea L21, @r3
+m1
+rts
+jmp @r1
+inc L18
+cmp X3, D0
+jmp @r0
+clr @r6
+prn L43
+rts
+rts
+cmp @r3, -96
+lea S5, @r5
+L53: dec @r2
+mov 0, L3
+bne @r2
+add @r4, @r0
+add L11, @r7
+L54: jmp L25
+L55: bne @r7
+mov L0, @r5
+cmp @r7, L34
+red L2
+L56: add @r1, D0
+clr L33
+rts
+add -177, L30
+L57: not @r3
+prn L35
+not @r2
+bne L23
+mov @r5, @r3
+red L4
+inc @r4
+cmp @r4, L50
+rts
+mov 410, @r4
+inc @r7
+mov 257, @r5
+cmp 372, @r7
+cmp L58, L38
+add L24, @r6
+bne L2
+not @r4
+red L58
+cmp L38, @r4
+L58: jmp S1
+add X4, @r3
+dec L59
+lea L25, L14
+dec @r0
+dec @r2
+clr L37
+rts
+rts
+L59: jsr L2
+red L20
+cmp L27, -236
+red @r0
+prn 305
+clr S3
+red D0
+stop
+D0: .data -62,-222,-256,-21,245,-150,-9,392,-85,203
+D1: .data -26,-53,-498,33,-93,-39,160,369,437,22
+D2: .data -211,-333,82,-255,-24,391,-59,59,-352,-312
+D3: .data -170,-83,128,299,-270,474,-382,86,277,146
+D4: .data -121,12,-500,-166,63,490,-79,-268,-433,18
+D5: .data -499,400,-135,36,368,413,263,-316,231,6
+D6: .data -452,307,-28,314,93,-444,232,6,369,-257
+D7: .data -349,-22,246,-41,-402,115,-66,-187,26,-476
+D8: .data 117,-20,-80,-296,110,153,367,368,329,-190
+D9: .data 10,-219,-487,434,-242,-275,493,13,-275,-283
+S0: .string "ug"
+S1: .string "lujhnkrauvzrkq"
+S2: .string "bzrhvbspjqku"
+S3: .string "kttt"
+S4: .string "vlytfxttygvqcy"
+S5: .string "inhtzfznjeangwzmt"
+S6: .string "somnrubnlc"
+S7: .string "tyjhmsbmobkkkqblskci"
+S8: .string "lbmcoaowwfbibfk"
+S9: .string "avrdevdofj"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r1
+    prn 61
+endmcro
+mcro m1
+    sub @r0, @r0
+    prn 73
+endmcro
+mcro m2
+    sub @r4, @r2
+    prn 75
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 98
+endmcro
+mcro m4
+    sub @r4, @r1
+    prn 60
+endmcro
+dec L0
+jmp L20
+add @r4, @r1
+sub L0, L0
+inc L0
+L0: clr L0
+jsr L54
+add L0, @r7
+not @r3
+m0
+m0
+dec L0
+L1: clr X0
+red @r3
+not @r1
+m2
+red @r5
+L2: sub L0, @r5
+m1
+L3: bne @r4
+add 63, L0
+add L2, @r4
+prn L3
+mov -383, @r6
+mov -201, L3
+jmp @r0
+clr @r7
+m4
+sub L3, @r7
+prn L2
+inc @r6
+m4
+inc @r0
+not L1
+red L2
+not @r5
+add @r2, @r5
+jmp @r0
+not @r4
+red L2
+sub L3, @r2
+jsr L0
+rts
+dec L3
+jsr @r3
+L4: mov @r4, L1
+clr L1
+m4
+jmp L3
+inc L3
+clr @r1
+mov L0, L3
+red @r5
+add S7, L0
+sub @r6, L4
+clr L3
+L5: sub @r7, L0
+inc @r6
+clr L1
+inc L0
+jsr L1
+L6: rts
+m3
+bne @r5
+lea L3, @r6
+jsr @r1
+add L3, @r1
+sub L5, L1
+L7: red L3
+L8: red @r7
+prn L5
+dec @r5
+m1
+add L8, L1
+jsr @r2
+lea L2, L3
+prn @r5
+L9: bne L5
+inc @r4
+jmp L0
+prn @r1
+lea L8, L5
+rts
+clr @r1
+sub -365, L6
+rts
+prn 76
+dec L5
+not L6
+L10: jsr @r2
+L11: jsr @r4
+m3
+sub L5, @r2
+add @r6, @r0
+m0
+cmp L10, -297
+L12: mov L53, L11
+L13: sub @r4, @r5
+mov @r2, @r1
+jsr @r2
+dec @r5
+L14: lea L10, L0
+m1
+lea L1, @r0
+L15: clr X1
+rts
+rts
+jmp L1
+dec L42
+m0
+L16: bne @r6
+rts
+red L14
+inc L6
+inc @r3
+L17: red @r5
+m4
+mov L16, L16
+add -501, L15
+sub 126, L15
+prn L16
+mov -163, @r1
+bne L14
+mov L3, @r2
+red L6
+cmp 63, S5
+bne @r7
+jmp L10
+L18: sub -160, @r4
+add 280, L1
+dec @r4
+L19: add @r1, L2
+bne L27
+not @r7
+not @r0
+lea L4, L16
+inc @r6
+mov 94, @r2
+prn L18
+red L3
+L20: mov 60, L4
+sub -43, L19
+L21: clr L14
+not @r6
+m1
+m2
+cmp L2, @r0
+bne @r5
+clr L10
+prn L2
+dec @r4
+sub @r5, L14
+bne @r5
+jmp L11
+inc L8
+L22: add @r4, @r3
+inc L13
+m0
+rts
+sub L13, @r2
+bne @r2
+inc L17
+inc L21
+m2
+dec @r2
+prn 377
+m2
+bne @r5
+sub @r5, L9
+rts
+dec L1
+cmp -500, L50
+dec L8
+L23: dec @r0
+jsr L7
+mov -207, @r0
+sub @r1, @r6
+L24: sub @r6, L12
+L25: rts
+cmp 402, @r7
+m4
+not L9
+cmp L9, -195
+clr @r7
+prn L25
+prn 112
+inc @r4
+L26: rts
+red @r6
+lea L6, @r0
+red X2
+lea L10, L20
+not L15
+prn L25
+m2
+L27: inc L16
+L28: cmp 331, 13
+L29: mov 306, @r6
+bne L14
+red L52
+lea L12, L1
+m3
+jsr @r0
+add @r7, L7
+sub @r4, L26
+sub -467, @r6
+not L2
+sub L31, L22
+add @r0, @r6
+clr L3
+jsr @r5
+cmp L20, L17
+dec @r6
+not @r1
+inc @r7
+jsr @r1
+m2
+red L3
+bne @r7
+jmp @r2
+rts
+jmp @r5
+dec L23
+dec @r0
+L30: lea L22, @r1
+L31: lea L9, @r5
+prn @r0
+bne @r2
+inc @r5
+jsr L28
+inc L29
+cmp -137, @r5
+inc L23
+clr L41
+inc @r3
+dec @r4
+jmp @r3
+L32: lea L26, @r4
+rts
+lea L14, S2
+m0
+rts
+m0
+m1
+bne @r6
+inc L25
+red L28
+sub -252, @r3
+bne L22
+m3
+jmp L50
+prn L55
+add -477, L42
+mov @r1, @r3
+jmp @r5
+prn L9
+L33: red @r2
+m0
+L34: lea L4, @r2
+jmp L39
+lea L32, @r6
+dec @r7
+mov @r7, L16
+m2
+add 150, L20
+L35: bne L30
+bne @r1
+L36: dec L25
+not @r2
+dec @r5
+lea L1, L48
+L37: sub @r2, S8
+L38: clr L13
+red L8
+clr L8
+sub L22, L11
+add L27, L2
+mov @r6, @r0
+dec L42
+not @r4
+not @r7
+cmp L22, 505
+L39: clr @r1
+L40: bne @r7
+clr @r1
+inc L19
+bne @r2
+mov L27, @r1
+inc L22
+jmp L41
+add L16, @r7
+L41: inc @r1
+inc @r7
+lea L38, L54
+L42: add -287, @r2
+L43: lea L36, L40
+not S0
+jsr @r1
+dec @r4
+L44: lea L4, L6
+jmp @r3
+inc @r5
+m0
+lea L25, L9
+lea L1, L13
+prn @r5
+m2
+inc L33
+sub @r5, L18
+dec @r4
+add @r1, L21
+jmp L22
+jmp @r3
+L45: mov -299, L24
+red L45
+rts
+prn 274
+sub @r4, L30
+prn L29
+jsr L28
+add -243, L13
+mov -264, L5
+lea D0, @r6
+cmp L39, L22
+sub L55, @r7
+add @r6, @r5
+m1
+mov -208, L44
+clr @r0
+L46: cmp @r6, @r3
+lea L40, @r6
+rts
+bne L35
+jsr L40
+clr L18
+L47: bne @r5
+bne L6
+not L30
+dec L28
+dec L36
+inc @r4
+red @r3
+sub L53, @r7
+m2
+mov @r2, @r0
+mov L14, L25
+jmp L38
+add -232, L23
+red L5
+m0
+mov L30, X3
+clr L46
+L48: inc @r2
+red @r3
+clr L35
+sub L20, L8
+mov L0, L52
+jsr L33
+bne @r1
+dec L21
+jsr @r6
+lea L7, @r5
+not @r6
+mov @r1, @r0
+L49: cmp 29, 403
+prn @r4
+add L17, @r0
+lea L12, @r4
+L50: cmp @r5, @r7
+L51: add 428, @r4
+clr @r4
+sub -479, @r4
+m3
+not @r0
+clr @r2
+jsr L53
+m0
+mov @r4, @r7
+add @r6, @r5
+rts
+jmp @r4
+not @r0
+jmp @r4
+rts
+cmp 45, @r7
+sub L23, L58
+prn @r7
+add 261, @r0
+m0
+L52: add 27, L7
+lea L49, @r1
+cmp 64, @r6
+L53: add L45, L30
+jsr L56
+dec L2
+jsr @r6
+dec @r5
+add L0, @r4
+not L31
+dec S6
+m4
+L54: mov @r3, @r3
+clr S0
+mov @r0, @r1
+L55: mov 510, L12
+mov @r4, @r2
+dec L58
+red L35
+cmp @r6, @r5
+L56: red @r6
+dec @r6
+jsr L50
+clr L0
+rts
+m3
+add @r4, L35
+L57: inc L41
+add L59, L10
+mov L50, @r2
+dec @r6
+mov -505, L59
+clr @r0
+mov 133, @r7
+clr @r6
+inc @r4
+mov L37, @r0
+jmp @r2
+rts
+lea L18, L37
+sub L16, @r0
+red D0
+add S3, L4
+lea L59, L35
+m4
+add L33, X4
+not L59
+rts
+sub 13, @r2
+L58: inc D0
+L59: red D0
+stop
+D0: .data 109,-295,-479,-118,-51,342,374,-164,-287,105
+D1: .data 357,363,-394,365,-10,-208,-406,-9,53,-116
+D2: .data -127,-242,69,207,-3,442,-70,308,-91,-137
+D3: .data -126,189,329,-218,385,-457,-392,75,-383,31
+D4: .data -286,179,222,149,-190,143,27,496,487,-417
+D5: .data -313,-229,-123,-215,-49,-193,289,-331,-64,-116
+D6: .data -279,-338,266,223,177,-407,242,-479,320,480
+D7: .data 184,302,8,-456,394,300,171,40,-172,99
+D8: .data -167,202,192,26,-109,490,-438,-285,-170,-50
+D9: .data 74,-320,-185,9,-86,245,-158,364,-190,-96
+S0: .string "tcpkzat"
+S1: .string "blsfepllkoqjiwca"
+S2: .string "xzarqqiiquazd"
+S3: .string "fvo"
+S4: .string "srnzug"
+S5: .string "vflwhforwedcbch"
+S6: .string "zpemephl"
+S7: .string "nejvwqagsqroyotfri"
+S8: .string "jvsmaoh"
+S9: .string "kg"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r4
+    prn 31
+endmcro
+mcro m1
+    sub @r5, @r2
+    prn 72
+endmcro
+mcro m2
+    sub @r6, @r0
+    prn 40
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 75
+endmcro
+mcro m4
+    sub @r6, @r0
+    prn 84
+endmcro
+L0: rts
+clr L0
+lea L0, @r3
+bne L0
+dec L0
+dec @r2
+red L0
+mov L0, L0
+m3
+bne L0
+bne L58
+bne L0
+inc L0
+mov @r0, @r1
+m4
+bne L0
+m2
+jsr @r5
+m3
+m2
+clr L0
+jsr L0
+m1
+L1: prn 440
+mov @r6, L1
+bne @r6
+mov L0, @r4
+rts
+L2: clr L21
+inc @r5
+L3: not @r1
+jmp L1
+bne L0
+mov L0, S5
+lea L3, L0
+m4
+m2
+sub L41, L0
+prn @r4
+jmp @r6
+prn L0
+L4: lea L4, L2
+cmp @r0, L2
+mov -182, L1
+red L4
+m4
+not @r3
+L5: clr @r1
+cmp @r1, @r4
+jsr @r3
+jmp L3
+dec L3
+rts
+cmp -27, -12
+mov @r6, @r6
+lea L3, @r1
+lea L3, L1
+prn L3
+prn @r7
+jsr L1
+add 13, @r2
+bne @r4
+prn L0
+inc @r1
+L6: clr @r6
+dec @r0
+L7: lea L7, @r0
+bne @r4
+lea L1, @r6
+L8: add @r2, @r0
+lea L8, L0
+cmp @r5, L0
+bne @r1
+add -130, L3
+red @r7
+mov @r2, L0
+clr L7
+prn 280
+m2
+prn -294
+add @r3, L0
+cmp @r5, 253
+jmp @r1
+L9: mov L9, L2
+prn @r0
+lea L5, L2
+red L4
+L10: not D0
+lea L7, @r3
+mov 292, L6
+inc L1
+sub L2, L4
+prn @r1
+add L3, L6
+inc L47
+not L1
+prn @r2
+mov L3, L0
+jsr L7
+rts
+bne L24
+not L5
+bne @r0
+L11: not @r7
+jmp L5
+clr L6
+mov 116, L9
+L12: clr @r0
+L13: jsr L12
+L14: add @r1, L5
+jsr L5
+jsr @r2
+dec L7
+bne L8
+L15: bne @r3
+clr @r2
+lea L11, L3
+add -359, @r7
+L16: cmp 249, 203
+jmp @r3
+L17: mov L16, L12
+add -345, L30
+clr L16
+sub 317, L16
+lea L0, L12
+dec L0
+jmp @r0
+rts
+lea L10, @r3
+rts
+L18: lea L16, @r7
+add S6, @r2
+prn -306
+dec @r0
+m3
+dec @r7
+clr L7
+L19: bne @r6
+cmp -324, L8
+cmp 442, L14
+mov L0, L3
+prn -336
+add 506, @r0
+inc D0
+red L1
+L20: mov L3, @r6
+mov @r3, @r6
+m2
+clr L57
+bne X0
+dec @r3
+m0
+m4
+jsr L15
+L21: prn L15
+jsr L10
+jmp L17
+mov @r6, L19
+L22: not @r7
+mov 315, @r3
+bne L18
+inc L5
+jsr L21
+lea L15, L4
+inc L9
+mov L20, L8
+prn L21
+cmp L20, -56
+m3
+add 394, @r0
+clr @r6
+lea L19, @r6
+bne @r5
+lea X1, L7
+m4
+red @r1
+rts
+not @r5
+red @r1
+add L11, @r1
+red L8
+mov L0, L46
+not @r7
+inc @r6
+rts
+cmp @r3, @r7
+bne L57
+clr L9
+jsr L5
+add @r0, @r2
+red @r7
+lea X2, @r7
+red L8
+mov -492, L13
+red D0
+m4
+lea L5, @r1
+rts
+red @r0
+prn @r6
+sub -445, L19
+L23: jsr @r2
+lea L6, @r6
+rts
+inc @r5
+inc L7
+red L21
+rts
+jmp L12
+red L11
+m2
+L24: clr L12
+jmp @r6
+dec @r3
+L25: cmp 414, 79
+inc L6
+inc @r7
+jsr L13
+jmp @r4
+sub L23, @r7
+not L40
+inc L10
+bne L12
+clr @r3
+not L23
+red @r2
+not @r5
+lea L46, D0
+L26: bne @r4
+jsr L25
+L27: not @r5
+L28: lea L6, L12
+dec @r6
+inc L14
+dec @r2
+m0
+cmp L28, -108
+rts
+lea L15, @r5
+prn -45
+red @r4
+bne @r3
+bne L16
+prn -487
+add @r1, L1
+jsr @r6
+bne L8
+add -385, L13
+cmp 452, 432
+red @r3
+rts
+inc S0
+inc L7
+L29: add L25, L22
+jsr S5
+jmp L25
+dec @r3
+cmp -198, @r1
+L30: cmp @r5, @r2
+m0
+inc L22
+red L15
+dec L23
+jsr @r3
+not L12
+lea L30, @r7
+lea L2, @r7
+not D0
+mov L46, L16
+add @r7, @r3
+L31: clr @r4
+inc L11
+m1
+red @r5
+inc L26
+lea L13, @r0
+lea L24, L29
+dec @r2
+red @r1
+L32: jmp L13
+L33: inc @r4
+m0
+red @r5
+clr L14
+inc @r3
+inc L8
+not @r2
+L34: mov L16, @r7
+m4
+prn L10
+dec S3
+bne L28
+L35: sub -144, @r1
+bne @r2
+jmp L33
+mov @r4, @r5
+cmp 312, -376
+not L32
+not @r4
+L36: cmp @r6, 384
+inc @r4
+not @r0
+m0
+cmp 257, @r2
+inc L34
+bne L7
+m0
+lea L34, @r5
+rts
+L37: add L33, L21
+clr L3
+prn X3
+cmp @r5, 497
+lea L5, L7
+mov 10, @r3
+cmp 167, L8
+jsr L56
+add 272, @r1
+clr @r5
+clr L32
+mov -166, L21
+lea L23, @r6
+m1
+m0
+bne D0
+lea L16, D0
+not L10
+bne @r1
+L38: sub -290, @r4
+red L1
+mov @r0, L13
+prn 223
+dec @r2
+rts
+m0
+m3
+prn -63
+mov L10, L0
+not L12
+m4
+clr @r6
+jsr @r5
+lea L18, @r2
+red L12
+rts
+dec @r1
+not L29
+clr L32
+not L29
+L39: dec L25
+L40: add @r4, S5
+mov D0, L30
+L41: prn L2
+jmp @r6
+jsr @r4
+not L40
+jsr @r1
+red S9
+L42: red @r0
+bne L13
+not L25
+clr @r1
+prn L59
+L43: rts
+rts
+sub @r7, @r2
+add @r0, L29
+m1
+cmp @r6, 126
+m3
+inc L5
+add -220, @r4
+add -22, L26
+cmp L14, L7
+inc @r2
+L44: jmp L55
+mov @r5, @r1
+L45: add @r6, @r6
+m4
+red L43
+L46: cmp @r6, @r1
+cmp @r5, @r5
+red @r3
+L47: cmp -189, L30
+jsr @r5
+inc @r1
+L48: cmp L39, 204
+dec @r2
+cmp @r4, L46
+jsr @r0
+bne L7
+sub 222, @r3
+cmp L41, 29
+prn -212
+mov L38, L45
+L49: add -106, D0
+rts
+red L12
+L50: red L42
+m1
+m3
+dec L56
+dec L50
+L51: red L2
+inc L0
+red L41
+bne L5
+L52: dec L7
+red @r1
+bne L6
+m1
+m3
+lea D0, @r7
+clr @r5
+mov L50, @r7
+lea L4, L8
+rts
+bne @r3
+rts
+bne L47
+sub L21, @r4
+prn D0
+m2
+sub -40, L55
+jmp @r5
+L53: prn @r5
+L54: lea L57, L24
+not L11
+L55: not @r4
+L56: bne @r7
+L57: bne L36
+L58: cmp @r5, @r5
+rts
+jsr L59
+bne @r4
+m2
+jmp L1
+L59: not S6
+clr X4
+m2
+stop
+D0: .data -9,-66,120,-451,-463,73,59,-2,-96,454
+D1: .data 271,-199,306,-218,85,-85,28,-425,-147,-296
+D2: .data -428,32,-128,309,-363,-207,-498,493,243,471
+D3: .data 205,333,414,190,-315,-201,27,-270,232,-496
+D4: .data 54,176,-356,-489,-385,375,342,307,-266,-402
+D5: .data 416,223,-475,233,-478,279,467,-442,-144,117
+D6: .data -119,-359,-153,422,118,343,270,-41,-392,-147
+D7: .data 128,-473,-93,314,-76,11,-292,361,-318,-277
+D8: .data 444,130,-238,165,63,-405,-346,-125,-483,191
+D9: .data 0,-131,258,-204,489,-104,211,-64,-349,350
+S0: .string "cfutdmt"
+S1: .string "kfpdowxlkbq"
+S2: .string "ihhshfsg"
+S3: .string "pkwoks"
+S4: .string "rznpkmvuyfeivchgd"
+S5: .string "aginirfb"
+S6: .string "aryxsdvrnbozvoggttg"
+S7: .string "vslbmlsrdsmfamtyii"
+S8: .string "hxoxgum"
+S9: .string "weufwfsgbhyok"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r6
+    prn 69
+endmcro
+mcro m1
+    sub @r1, @r3
+    prn 70
+endmcro
+mcro m2
+    sub @r0, @r6
+    prn 37
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 51
+endmcro
+mcro m4
+    sub @r0, @r6
+    prn 8
+endmcro
+lea L0, L0
+m2
+cmp @r0, L0
+sub @r6, @r5
+not @r5
+prn L0
+L0: not @r7
+sub 145, @r4
+rts
+jsr @r7
+not @r1
+rts
+L1: dec L1
+cmp @r7, -118
+red @r0
+m1
+lea L1, L1
+sub @r6, @r7
+sub L0, L1
+m1
+L2: cmp -499, -426
+prn @r7
+inc @r5
+rts
+add 197, @r3
+prn L2
+sub @r2, D0
+red @r1
+inc L0
+cmp -338, @r6
+rts
+clr @r7
+L3: lea L2, @r7
+m1
+prn @r1
+L4: clr @r4
+bne L1
+inc @r4
+add 185, L1
+L5: not L2
+lea L5, L4
+bne L4
+bne S4
+m4
+lea L3, L1
+inc L3
+red @r6
+jsr L0
+not L4
+red @r5
+mov @r0, L3
+inc @r6
+m3
+inc @r4
+jmp @r4
+dec @r7
+rts
+m2
+not L2
+bne L0
+m1
+clr @r6
+mov 435, L5
+rts
+jsr L5
+dec @r6
+L6: lea L0, @r7
+jsr L4
+sub @r6, L0
+prn L4
+dec @r1
+jmp L6
+add -267, L5
+add -421, L1
+red L1
+m3
+red L3
+jmp L3
+m3
+prn 383
+dec @r5
+L7: dec L4
+bne @r6
+jmp L1
+jsr L0
+not L2
+sub L5, @r2
+rts
+L8: prn @r0
+red @r3
+clr @r3
+L9: add -403, L3
+jmp L8
+jmp L2
+m0
+L10: lea L1, @r7
+jmp @r3
+rts
+red @r5
+m0
+m0
+m0
+sub 175, L8
+clr L3
+not @r4
+clr @r0
+cmp -307, L2
+m4
+L11: clr @r1
+mov @r3, @r0
+mov L34, @r1
+m4
+L12: jsr L9
+rts
+add L8, @r7
+prn @r4
+L13: dec L3
+not @r5
+rts
+m2
+L14: clr @r0
+m3
+cmp 502, D0
+lea L10, @r4
+lea L9, L4
+sub -209, @r0
+mov L11, L7
+red L14
+jmp L14
+cmp -222, 20
+cmp -488, X0
+lea L26, L13
+sub L12, @r0
+sub L5, L7
+inc L24
+cmp L5, @r1
+L15: prn L3
+jmp L14
+red @r7
+mov L13, L7
+sub L5, L4
+dec L6
+add L7, L9
+jmp @r5
+red L14
+jsr @r1
+bne L2
+clr L3
+prn L5
+m1
+L16: cmp @r7, L11
+jsr L1
+bne @r5
+cmp L0, L1
+add L1, @r4
+jsr @r3
+sub @r4, S8
+rts
+inc L11
+lea L4, @r1
+m2
+bne @r4
+lea L16, L1
+prn @r6
+m2
+sub @r5, L5
+add L3, L10
+L17: add @r6, @r1
+sub 105, L9
+not @r2
+sub @r4, @r4
+red L6
+bne L7
+cmp 284, 267
+jsr L1
+clr @r3
+jsr @r7
+rts
+dec @r4
+clr @r1
+rts
+prn @r1
+m1
+bne @r5
+add @r7, L12
+jsr @r3
+add @r1, @r1
+bne L4
+L18: rts
+jsr @r2
+add L8, @r0
+L19: cmp 286, @r6
+clr @r2
+L20: cmp L14, @r7
+L21: not @r7
+jsr @r0
+red L21
+bne @r5
+jmp L51
+dec L5
+mov -408, D0
+prn D0
+not L0
+clr @r0
+prn @r0
+jsr D0
+lea L17, L15
+add L16, L3
+m4
+cmp -453, @r3
+jsr @r7
+mov 283, @r5
+dec L21
+L22: red @r0
+cmp L20, S8
+m0
+jmp @r3
+m0
+inc L5
+L23: inc D0
+jmp L22
+add L15, L7
+add -10, L18
+clr L1
+lea L2, @r6
+dec L13
+bne L16
+prn L10
+rts
+L24: dec @r3
+L25: bne @r1
+L26: bne L5
+jsr @r0
+not @r2
+clr @r0
+bne L5
+cmp -168, @r4
+lea L0, S5
+add @r7, L5
+m2
+L27: sub @r5, @r5
+dec L7
+jsr L13
+cmp L9, -429
+add @r6, @r7
+jmp @r7
+L28: prn L21
+L29: mov L12, @r0
+sub L9, @r2
+inc S0
+prn L46
+rts
+L30: sub 341, L19
+not @r4
+m3
+L31: bne L12
+sub @r4, S9
+red @r6
+mov -123, L1
+dec @r3
+dec @r5
+L32: mov L55, @r5
+cmp @r2, -63
+inc @r7
+sub 390, S8
+jsr @r3
+jmp L2
+cmp -475, X1
+red L12
+inc @r4
+L33: jmp L7
+inc L30
+m0
+prn @r1
+mov @r4, @r1
+add L32, L26
+jsr @r4
+not @r4
+prn L4
+prn L14
+jsr @r3
+add @r6, L18
+bne L13
+clr L17
+mov 334, @r0
+jmp @r1
+L34: jmp L40
+cmp -458, L12
+dec X2
+dec L19
+dec @r0
+L35: dec @r2
+m0
+bne @r1
+add L15, L20
+prn 149
+dec L0
+clr L10
+cmp @r7, @r7
+prn L19
+L36: add L13, @r5
+add 167, L9
+cmp L1, @r0
+inc @r7
+prn @r6
+sub @r4, @r0
+L37: prn L29
+clr @r1
+cmp L26, D0
+inc @r1
+mov @r1, @r0
+sub 306, L50
+jmp L7
+not @r3
+mov L13, @r3
+sub @r0, @r7
+dec L22
+L38: sub L5, L2
+prn -318
+sub @r7, @r6
+mov 259, L34
+rts
+prn 212
+L39: lea L10, @r3
+jmp @r0
+dec L25
+m4
+rts
+add L13, L41
+dec @r2
+jmp L6
+L40: not L2
+inc @r0
+prn L39
+L41: cmp L5, L21
+L42: mov @r5, D0
+L43: add @r6, @r5
+jsr @r7
+L44: add @r4, L29
+cmp -333, @r1
+cmp L42, -144
+bne @r7
+add L37, @r4
+sub @r7, @r3
+inc L0
+bne @r6
+mov L21, L26
+dec L1
+dec L3
+clr @r2
+not L25
+not L16
+clr L12
+add @r5, @r5
+m0
+m3
+rts
+mov 316, L22
+add @r2, @r0
+sub @r6, @r7
+bne @r5
+add @r1, L22
+sub @r0, L30
+lea L36, @r0
+add @r7, @r7
+dec L29
+sub -156, @r2
+red @r3
+jsr L4
+jmp L42
+m0
+clr @r5
+prn 320
+not @r4
+inc @r7
+red @r3
+prn @r2
+jmp L15
+add @r5, L34
+lea L35, @r4
+rts
+L45: sub 182, L49
+sub @r4, L17
+add 431, @r1
+prn -28
+add @r4, @r7
+m3
+inc @r1
+mov S9, @r1
+sub S2, @r6
+L46: mov @r6, L55
+L47: mov @r2, @r3
+m2
+not @r7
+rts
+clr L23
+L48: prn 174
+jmp L43
+m0
+cmp -394, L18
+prn @r2
+L49: sub L35, @r6
+L50: sub @r0, @r7
+inc @r4
+mov L19, @r7
+add L33, @r0
+L51: mov L5, @r1
+L52: not @r5
+jsr @r7
+m3
+L53: inc @r2
+red X3
+inc @r7
+m2
+lea L54, L54
+m4
+L54: add 235, L50
+L55: lea L59, L42
+cmp @r6, @r6
+L56: mov 457, @r1
+prn L57
+jmp L11
+inc @r3
+sub @r7, @r3
+mov @r4, @r1
+lea X4, @r4
+not S1
+L57: red L37
+dec @r5
+L58: jsr S4
+jmp @r3
+inc @r6
+sub -87, @r7
+mov 413, @r1
+m0
+L59: red D0
+cmp S4, S3
+dec S4
+not S8
+bne S0
+stop
+D0: .data -225,-49,-452,221,239,383,-242,-66,31,-426
+D1: .data 365,481,497,-297,-431,-25,133,-437,-295,-194
+D2: .data 127,404,-68,213,168,-463,380,-150,46,58
+D3: .data 463,390,-157,3,328,-328,-421,-130,-386,282
+D4: .data 81,-239,-475,-181,112,-296,-395,58,378,118
+D5: .data 5,81,236,-52,-406,-500,-53,-217,318,-205
+D6: .data 281,33,94,-341,309,432,-368,-246,220,178
+D7: .data 28,-323,305,-266,-254,-215,-255,-275,490,258
+D8: .data 302,-112,-469,-52,52,431,-181,197,-303,-271
+D9: .data -30,464,412,-380,117,44,-62,-134,-321,194
+S0: .string "ilw"
+S1: .string "pznmidmipybnilwz"
+S2: .string "mgqocmupfnjrxv"
+S3: .string "r"
+S4: .string "ydiszci"
+S5: .string "anzxrjtvek"
+S6: .string "mwiwanfrnr"
+S7: .string "lpfwtbcyjbtmdjrxgm"
+S8: .string "ytziho"
+S9: .string "pjszrkol"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r1
+    prn 40
+endmcro
+mcro m1
+    sub @r5, @r4
+    prn 69
+endmcro
+mcro m2
+    sub @r2, @r4
+    prn 3
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 27
+endmcro
+mcro m4
+    sub @r2, @r4
+    prn 33
+endmcro
+bne L0
+lea L0, @r7
+bne @r3
+prn @r4
+cmp @r1, -303
+red L0
+not L0
+mov 265, @r0
+dec L0
+inc @r2
+sub @r7, L0
+mov @r2, @r0
+add L0, L0
+red S6
+mov @r6, @r4
+prn 137
+dec @r2
+jmp X0
+m3
+rts
+cmp -378, D0
+m3
+inc @r7
+L0: dec @r6
+inc L55
+jsr @r3
+mov L0, @r5
+mov -83, @r3
+jsr L0
+jsr L0
+L1: inc @r3
+add L1, L1
+m0
+inc @r7
+sub -169, @r7
+m4
+m1
+mov @r6, L0
+m4
+dec @r3
+m2
+bne @r0
+red @r6
+add 307, @r7
+m2
+dec @r1
+dec L1
+add L1, @r0
+inc L1
+inc @r2
+rts
+jmp @r3
+jmp @r2
+inc @r7
+bne L1
+jmp @r4
+m3
+lea L1, @r3
+clr @r6
+jsr L1
+not L0
+not @r7
+jmp @r3
+red @r4
+L2: bne @r6
+cmp -17, 61
+mov 220, L0
+clr @r6
+not @r2
+sub @r2, @r7
+dec S6
+dec L1
+jsr @r1
+L3: lea L1, L1
+dec L1
+prn @r6
+jmp L1
+rts
+sub L0, @r7
+sub -94, L2
+rts
+L4: jmp @r7
+m0
+add 354, @r4
+dec L2
+sub -128, L57
+cmp @r2, -51
+not L1
+mov L2, L4
+jmp @r3
+L5: jsr @r0
+L6: dec L3
+sub -118, @r2
+prn L3
+m2
+bne @r4
+jmp @r0
+jsr @r0
+inc @r6
+jsr L4
+jsr L2
+lea L0, L0
+clr L2
+cmp D0, @r6
+L7: prn @r6
+jsr L38
+sub 293, L0
+jsr L0
+L8: not @r3
+cmp L2, -391
+jsr L3
+dec L7
+L9: dec @r6
+inc @r1
+sub -6, L0
+inc @r1
+jsr L37
+lea L3, @r2
+red L9
+m1
+bne L50
+L10: sub L5, @r4
+prn L3
+m3
+rts
+inc L1
+sub @r5, L2
+jsr @r6
+not L3
+L11: bne @r6
+not L8
+sub 307, L6
+L12: lea L1, @r2
+bne @r7
+lea L5, @r6
+jmp @r5
+L13: rts
+bne L11
+L14: jsr @r3
+prn 266
+L15: bne L13
+m4
+not L0
+lea L9, @r3
+not @r6
+inc L2
+L16: jmp L14
+red @r3
+inc @r3
+m1
+mov @r6, L57
+inc L15
+red @r5
+cmp 226, @r1
+sub -151, @r2
+prn -356
+jsr L14
+red L7
+clr L3
+jmp L0
+clr L11
+m2
+cmp @r2, -423
+L17: jsr L11
+clr @r2
+add 305, @r1
+clr @r6
+add L7, @r0
+mov 169, @r0
+not @r4
+m3
+red @r7
+inc @r1
+mov L7, L12
+rts
+not @r2
+m3
+prn 230
+lea D0, @r0
+jsr @r6
+mov 138, @r1
+add -178, @r0
+prn L15
+L18: inc L12
+lea L0, L13
+dec @r7
+cmp @r2, -467
+sub L17, L5
+bne L14
+add @r3, L8
+L19: sub L3, @r4
+rts
+cmp -375, @r7
+dec L2
+m4
+dec @r7
+clr @r7
+m1
+dec L43
+L20: cmp @r2, L8
+not @r0
+L21: bne @r5
+L22: red L18
+clr @r4
+L23: cmp @r5, @r2
+L24: red L10
+mov @r5, @r6
+not L14
+jmp L6
+rts
+L25: not @r3
+dec L8
+bne @r7
+prn @r5
+prn L22
+prn @r5
+sub 465, @r2
+L26: rts
+add 107, @r7
+m3
+L27: jsr @r7
+m2
+red D0
+dec @r0
+add -161, @r4
+m3
+jsr L14
+rts
+lea L10, L27
+red L22
+red L26
+sub D0, L5
+red L27
+add @r1, @r4
+prn -43
+dec L26
+mov -235, L23
+m1
+not @r7
+jsr L39
+jsr S6
+clr @r1
+cmp L17, @r6
+inc @r2
+red @r4
+jmp @r0
+sub L18, L58
+red L21
+cmp L3, @r6
+not L17
+cmp L17, L17
+m3
+prn 164
+not L12
+L28: clr L16
+jmp L5
+cmp @r3, -429
+cmp 284, -334
+prn L7
+jsr L25
+add @r5, @r2
+L29: lea L7, L9
+mov L5, L3
+not L6
+dec L35
+clr L5
+m2
+bne @r2
+red @r0
+cmp L24, -473
+red L28
+mov -47, L9
+not @r1
+jsr L5
+prn L4
+prn L7
+bne L18
+jsr @r4
+rts
+lea L19, D0
+not @r3
+cmp -152, L18
+bne @r3
+red L1
+clr @r2
+add @r4, @r1
+not @r7
+jmp L11
+m3
+dec @r2
+L30: mov @r6, @r4
+jsr L4
+red @r2
+dec @r7
+rts
+red @r7
+cmp -510, @r7
+clr @r1
+jsr D0
+L31: mov L14, L24
+add @r0, L8
+inc @r3
+L32: inc @r1
+rts
+mov @r4, @r7
+jsr L26
+rts
+L33: dec @r2
+prn L10
+m0
+prn @r3
+m3
+clr L2
+dec X1
+dec @r3
+red D0
+sub @r6, @r5
+m2
+L34: not @r5
+sub L12, L27
+inc L19
+inc @r0
+m4
+rts
+jmp L27
+mov @r1, @r7
+cmp D0, 358
+not L32
+add L28, L8
+m0
+L35: lea L21, @r4
+lea L19, L35
+m3
+prn L4
+L36: inc @r6
+cmp -129, @r6
+L37: clr @r5
+cmp D0, @r6
+dec @r2
+jsr @r7
+sub L15, @r5
+jmp @r6
+dec L36
+add L1, @r7
+sub @r1, @r4
+clr L53
+jsr @r7
+L38: dec L22
+L39: rts
+clr @r1
+jsr @r4
+L40: mov L55, X2
+L41: jmp L50
+sub -68, L14
+L42: sub 170, L36
+m2
+inc @r4
+cmp @r2, 184
+jmp @r0
+L43: mov 232, S3
+dec L17
+red @r5
+L44: add 334, @r6
+not @r4
+lea L20, L27
+red @r5
+lea L30, @r7
+jsr L8
+sub L33, L28
+m4
+bne @r6
+red @r3
+clr @r6
+L45: bne L32
+cmp -304, @r4
+dec @r0
+bne L5
+rts
+L46: sub @r0, @r7
+prn -283
+rts
+L47: rts
+L48: prn @r0
+bne @r3
+clr X3
+mov L32, L32
+clr @r1
+prn -184
+jsr L22
+bne @r2
+not @r2
+L49: mov @r2, L41
+sub @r5, D0
+L50: dec S3
+prn @r7
+not L15
+add @r3, L15
+clr @r4
+L51: bne L58
+m1
+jmp @r6
+add @r1, @r2
+sub 98, D0
+clr L1
+L52: not @r2
+inc @r1
+clr L16
+rts
+cmp L13, @r0
+lea L31, @r3
+L53: mov @r4, @r4
+sub @r1, L27
+jmp D0
+m4
+add L27, @r7
+mov 329, @r5
+bne @r7
+L54: cmp 44, 19
+add 495, @r0
+inc @r1
+sub @r0, @r6
+m1
+not L50
+mov L58, @r4
+L55: lea L57, L30
+lea L12, S7
+L56: bne @r4
+dec @r6
+prn @r7
+sub L3, @r4
+bne @r3
+m4
+m0
+red @r4
+cmp D0, X4
+L57: clr @r3
+L58: cmp S8, @r4
+add S5, D0
+red @r0
+L59: jsr D0
+stop
+D0: .data -392,-75,341,425,-272,-459,399,-441,-395,-142
+D1: .data -108,-162,-479,188,119,-217,-65,-474,-66,351
+D2: .data 317,-226,53,196,58,187,-374,7,-311,159
+D3: .data -491,-250,-64,-61,441,76,-298,-261,243,408
+D4: .data -425,425,-482,173,86,96,-225,-51,430,249
+D5: .data -69,-416,-352,-44,126,212,89,-499,-89,-262
+D6: .data 332,177,100,63,-299,197,343,-255,-87,61
+D7: .data -253,-425,-254,-122,338,-243,465,362,-123,231
+D8: .data 5,136,333,53,-250,-385,-461,431,354,295
+D9: .data -368,-317,-498,348,-321,-208,-387,159,-85,-358
+S0: .string "mir"
+S1: .string "hcgqnujmmbps"
+S2: .string "dpblkqbzksjep"
+S3: .string "jhjagbzmasunxvnz"
+S4: .string "khlaweldmhejmawn"
+S5: .string "l"
+S6: .string "uuvkffczygp"
+S7: .string "oihlsvrwodondsq"
+S8: .string "t"
+S9: .string "dvieazsdlrzggcjynr"
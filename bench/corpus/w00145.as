@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r4
+    prn 78
+endmcro
+mcro m1
+    sub @r2, @r6
+    prn 67
+endmcro
+mcro m2
+    sub @r4, @r2
+    prn 68
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 4
+endmcro
+mcro m4
+    sub @r4, @r2
+    prn 57
+endmcro
+mov @r5, @r2
+red @r0
+bne L0
+not L0
+m0
+prn L30
+lea X0, L0
+add @r0, L0
+red L0
+cmp -393, @r7
+add -12, @r4
+L0: sub L0, @r3
+dec @r7
+inc L0
+bne L0
+L1: not L1
+red L1
+cmp @r1, 317
+cmp L0, @r7
+rts
+inc @r1
+L2: dec @r3
+jsr @r1
+bne L2
+not @r2
+jmp @r1
+lea S2, L1
+red @r2
+jmp @r6
+jsr D0
+m2
+jmp @r3
+L3: mov -402, @r4
+L4: lea L0, L4
+bne L1
+dec @r5
+jmp L2
+L5: dec @r4
+bne @r5
+jmp L4
+bne L3
+jmp @r3
+sub -406, @r6
+L6: prn @r0
+L7: inc L1
+sub @r2, @r2
+not @r6
+L8: jmp L3
+m4
+jmp L7
+L9: jmp @r5
+prn -307
+L10: add 128, @r1
+prn -509
+inc @r3
+prn L2
+mov @r6, @r4
+rts
+mov S0, L2
+L11: rts
+sub -441, @r4
+prn -328
+cmp L0, L1
+mov L1, L3
+bne L7
+dec L11
+m4
+m4
+sub L1, L15
+clr L1
+dec L5
+L12: prn -349
+bne @r0
+sub L1, L12
+L13: prn 222
+m2
+m4
+mov 202, @r1
+m1
+not @r7
+m2
+not @r2
+not L4
+inc L13
+mov 62, @r1
+prn @r7
+m0
+red @r0
+not @r0
+jmp L0
+prn @r3
+clr L9
+clr @r4
+prn L56
+inc @r0
+prn @r3
+mov 481, L6
+jmp @r6
+lea L13, L3
+L14: rts
+sub L9, @r4
+cmp L13, 89
+add 159, @r0
+inc L6
+L15: rts
+bne @r2
+not @r7
+L16: jsr L15
+not @r4
+not L15
+inc @r7
+dec L1
+not L5
+lea L5, @r2
+jmp S7
+add -303, @r0
+L17: jsr L14
+not L13
+m2
+inc L16
+L18: add -42, L10
+bne L17
+dec @r1
+m3
+jmp L13
+rts
+m3
+bne L9
+cmp L9, -393
+L19: lea L12, @r7
+prn -64
+cmp @r0, @r0
+cmp @r4, -6
+bne @r2
+rts
+mov @r7, @r1
+mov L5, L10
+jmp L1
+not @r6
+L20: add 397, L1
+jmp X1
+mov -192, L6
+lea L46, L4
+inc L19
+prn L17
+prn L12
+cmp L26, @r3
+jmp @r7
+lea L19, @r7
+clr @r4
+clr @r2
+dec L16
+L21: not S3
+prn -160
+prn @r3
+jsr L10
+sub L2, @r3
+jmp L14
+prn @r1
+add @r7, L17
+dec @r4
+inc @r2
+inc @r5
+sub @r3, L18
+add 451, @r1
+L22: mov -353, D0
+not @r4
+dec @r3
+red L7
+prn -33
+jmp @r5
+dec D0
+m4
+sub 478, L18
+dec @r1
+lea L9, @r2
+mov @r0, @r7
+dec S3
+jmp @r2
+jmp L48
+bne L22
+jmp L3
+jmp @r2
+jsr L6
+L23: mov L19, @r6
+cmp @r5, L18
+m1
+cmp 395, S5
+red L15
+jsr L6
+cmp 49, -268
+clr L1
+jsr L14
+rts
+sub -66, L18
+sub 33, L3
+lea L18, @r6
+dec @r0
+bne @r5
+not @r2
+m3
+m0
+add L15, L7
+L24: rts
+mov -132, @r4
+L25: dec D0
+m0
+jsr L4
+add L18, @r4
+sub 298, @r7
+L26: mov @r6, L26
+add L25, @r7
+red @r6
+prn @r4
+prn @r3
+rts
+mov 487, @r4
+L27: jsr L25
+clr @r3
+dec L20
+rts
+red L26
+prn -428
+inc L15
+m0
+sub @r2, L20
+jmp @r0
+lea L14, @r7
+L28: inc @r2
+mov L16, @r5
+dec D0
+dec @r1
+L29: cmp @r5, L17
+mov 198, L3
+jmp @r2
+L30: jsr @r2
+red @r3
+prn @r2
+rts
+jsr @r5
+add L2, @r7
+m4
+clr @r6
+jsr D0
+mov L30, L16
+not @r6
+rts
+lea L30, L7
+rts
+dec @r4
+add L9, @r7
+inc @r5
+not L18
+L31: dec L6
+jmp @r6
+bne L29
+bne L31
+rts
+L32: cmp -10, L29
+add -229, @r5
+L33: red @r1
+prn -462
+L34: cmp L2, -218
+cmp 166, 66
+rts
+m3
+m1
+prn L19
+not L36
+dec L19
+red L3
+bne @r7
+bne L19
+red @r7
+m2
+m1
+jsr @r4
+inc L2
+red L0
+inc L29
+bne L53
+L35: dec @r0
+lea L18, @r4
+inc L26
+m3
+sub L25, L22
+lea L22, @r6
+not X2
+red L18
+jmp L23
+lea L21, L51
+L36: rts
+lea L8, L9
+not @r6
+inc @r4
+not L5
+prn 423
+add L19, @r5
+lea L6, L11
+lea L28, @r5
+m0
+inc L7
+jsr @r4
+not L19
+cmp 465, -308
+mov @r3, @r4
+inc L1
+prn 108
+not L12
+sub 474, @r7
+clr L39
+red L36
+m2
+not @r2
+jsr @r2
+m3
+m4
+m3
+not @r4
+mov @r6, L16
+jsr @r7
+rts
+clr @r4
+red L29
+inc @r6
+bne L50
+jmp @r3
+L37: add L5, @r4
+jmp L0
+clr L30
+m0
+m1
+clr S9
+dec @r7
+red @r3
+inc @r6
+lea L37, @r3
+add L26, D0
+L38: mov 46, L29
+inc @r1
+prn -19
+add @r1, L0
+inc @r7
+L39: dec L24
+not @r4
+red L12
+m4
+L40: sub @r6, @r1
+jmp @r2
+red L23
+jsr @r5
+L41: cmp L33, -395
+m0
+dec L15
+lea L13, L0
+sub 338, L38
+rts
+dec @r5
+dec S8
+cmp 363, L51
+L42: mov @r7, L33
+cmp @r1, @r1
+dec L2
+mov -331, @r3
+add L19, L30
+m4
+L43: cmp L36, @r7
+jsr L10
+L44: bne L39
+m0
+not @r5
+bne @r1
+m4
+inc L39
+red D0
+m0
+jsr L50
+m3
+cmp -382, @r1
+jsr @r3
+L45: red @r2
+prn L33
+bne @r3
+L46: cmp -140, 101
+sub 81, D0
+red @r4
+L47: cmp -503, L31
+inc L3
+cmp L44, @r6
+dec @r3
+L48: jmp L20
+dec L26
+lea L29, L48
+prn @r6
+prn -303
+red @r6
+clr @r4
+red L45
+cmp 424, @r5
+prn S9
+prn 414
+L49: jmp L48
+L50: clr L39
+add @r2, L21
+bne L18
+L51: lea L40, @r3
+L52: sub L58, S5
+dec @r5
+jsr L54
+jsr D0
+inc @r7
+jsr @r7
+cmp L42, L20
+bne L59
+jmp L17
+prn -454
+not @r0
+prn L16
+jsr @r7
+red @r2
+not L55
+jmp @r3
+L53: jsr @r3
+red L30
+not L31
+prn -249
+L54: cmp L19, L48
+L55: clr @r3
+not L36
+not @r4
+m2
+add 479, X3
+L56: dec L57
+L57: clr L58
+cmp X4, L6
+lea D0, @r5
+mov -142, @r1
+clr L50
+L58: inc L10
+L59: red L9
+stop
+D0: .data -163,-390,334,204,-419,205,-215,3,-413,-30
+D1: .data 271,-212,47,-130,424,463,-59,442,5,150
+D2: .data 374,-222,-111,-67,94,-358,-380,77,-200,412
+D3: .data 145,-487,-28,285,-107,-409,211,-330,-442,2
+D4: .data -37,-27,-108,-148,-494,17,230,-164,-438,427
+D5: .data -102,123,46,100,-181,-430,126,-493,-246,436
+D6: .data 43,-291,-308,-495,-406,-154,192,-158,86,491
+D7: .data 305,-220,-136,-112,202,159,-447,-349,-47,-387
+D8: .data 54,-455,-350,38,-41,18,-295,356,372,-143
+D9: .data -477,317,500,362,391,343,-6,244,296,54
+S0: .string "kjrndkmafrsarinbrnvm"
+S1: .string "pwnkdejouzssv"
+S2: .string "mezudryj"
+S3: .string "cyepqjkscqji"
+S4: .string "rhbylyacyvjcvhxsdmzn"
+S5: .string "tibjrlkerkv"
+S6: .string "fnfcow"
+S7: .string "gche"
+S8: .string "bkakr"
+S9: .string "pw"
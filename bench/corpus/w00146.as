@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r6
+    prn 48
+endmcro
+mcro m1
+    sub @r6, @r7
+    prn 66
+endmcro
+mcro m2
+    sub @r6, @r0
+    prn 33
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 80
+endmcro
+mcro m4
+    sub @r6, @r1
+    prn 14
+endmcro
+clr L0
+sub @r6, @r7
+jsr @r3
+jsr @r0
+jmp D0
+red L0
+not @r5
+dec @r7
+m1
+m3
+L0: sub @r7, L0
+rts
+sub L0, @r2
+red L0
+cmp -300, L56
+dec L0
+dec L34
+red L0
+m1
+lea L0, L0
+bne @r5
+inc L0
+L1: lea L0, L0
+rts
+sub L1, @r1
+add 391, L0
+cmp 178, -459
+cmp @r6, -508
+lea L1, L1
+jmp L0
+mov L0, @r0
+L2: not D0
+L3: rts
+L4: not L0
+inc L2
+rts
+L5: lea L2, L2
+cmp @r0, @r1
+L6: inc L4
+m0
+lea L7, @r4
+red @r6
+sub @r1, @r3
+rts
+L7: bne @r0
+dec L6
+lea L1, @r0
+L8: mov @r5, L5
+red @r2
+lea L2, @r4
+lea L6, @r4
+clr @r3
+clr L4
+rts
+clr L8
+L9: rts
+m0
+sub -134, L1
+m1
+dec L8
+mov -254, L2
+sub @r0, L18
+inc L8
+m1
+m3
+prn L4
+m2
+mov L3, L6
+bne @r1
+jsr @r7
+add L6, L7
+red L4
+mov @r2, @r6
+add L20, L52
+rts
+cmp @r3, L7
+sub @r6, L9
+m4
+dec L4
+add @r3, L5
+dec @r3
+prn L4
+inc @r1
+clr @r0
+lea L5, X0
+L10: sub -103, @r7
+jmp L4
+mov @r3, L0
+bne @r5
+sub L0, @r7
+jsr L18
+jsr L8
+red @r7
+L11: prn 153
+m1
+m0
+dec L8
+L12: prn 404
+m1
+cmp L3, @r7
+not @r6
+clr @r6
+cmp @r2, L8
+red @r1
+dec L0
+mov L5, @r7
+L13: cmp @r4, -36
+m2
+lea L4, @r4
+L14: not @r6
+bne L3
+L15: cmp @r0, @r5
+jsr @r6
+clr L15
+jmp L9
+m1
+sub @r3, L15
+bne L6
+cmp @r2, -69
+dec L2
+add L4, L3
+dec L11
+lea L8, @r0
+clr @r7
+m1
+sub -13, L7
+add -154, @r1
+red @r6
+sub @r6, L9
+jmp L3
+add L2, @r2
+lea L6, @r4
+rts
+clr L3
+cmp @r5, 252
+inc @r4
+bne @r6
+mov @r3, S2
+L16: jmp L5
+prn L7
+dec @r1
+red @r5
+mov @r0, L4
+m3
+m0
+inc L2
+bne L7
+mov @r4, @r1
+clr @r6
+dec S6
+L17: inc L6
+inc @r1
+L18: dec @r3
+rts
+L19: lea L11, L19
+rts
+L20: dec L10
+add 91, @r0
+rts
+clr @r4
+jmp L7
+dec @r6
+bne @r5
+bne @r3
+rts
+clr @r2
+not @r3
+cmp L4, -400
+mov L8, @r3
+not L19
+prn @r1
+lea L6, L14
+L21: add @r1, @r6
+L22: inc L2
+not @r5
+L23: cmp L11, L15
+not @r5
+rts
+cmp L18, @r1
+m0
+m3
+L24: clr @r3
+m1
+add 215, L19
+inc @r7
+inc L55
+jsr L22
+red S3
+prn L11
+L25: lea L0, L1
+L26: lea L1, L5
+sub 262, @r5
+rts
+cmp @r5, -135
+jsr L11
+m3
+mov @r5, @r1
+red @r2
+jsr L13
+L27: rts
+prn L13
+jmp @r3
+add @r7, L17
+L28: prn L25
+m1
+bne @r3
+m0
+red @r0
+bne L4
+cmp @r4, L54
+mov 11, @r0
+jsr S7
+m3
+mov L18, @r3
+red L46
+not @r2
+add 206, @r4
+bne L1
+clr L0
+cmp L6, @r2
+lea L27, L13
+L29: red @r6
+L30: sub @r0, L3
+lea L1, D0
+rts
+prn @r0
+not @r6
+L31: bne @r2
+red L15
+rts
+inc L51
+lea L14, @r6
+red D0
+L32: cmp @r2, L27
+L33: rts
+jsr L6
+rts
+not @r2
+not @r0
+L34: red L19
+mov @r7, @r2
+bne L25
+m4
+red L15
+jmp @r0
+jmp @r0
+L35: inc @r5
+L36: mov @r5, L19
+m4
+sub 22, L1
+cmp -17, L18
+L37: inc @r5
+sub @r4, @r7
+jsr @r5
+lea L21, @r3
+lea L36, L22
+m0
+jsr @r5
+not @r2
+dec @r1
+m2
+sub L3, D0
+dec L16
+lea L1, L29
+rts
+sub -345, @r5
+mov L7, @r2
+mov -287, L13
+add @r0, @r1
+sub -122, @r0
+jmp @r3
+L38: red L24
+jsr @r0
+add @r7, L33
+L39: bne @r0
+mov @r2, L34
+not L35
+dec @r1
+red @r1
+clr @r6
+cmp @r1, L27
+m0
+L40: jmp L0
+clr @r6
+red @r7
+rts
+lea L33, @r3
+bne L24
+sub 255, @r0
+clr @r0
+mov 271, @r0
+L41: rts
+jsr L41
+red L20
+prn L38
+cmp @r5, @r0
+rts
+dec L1
+bne L7
+cmp @r3, @r6
+m3
+L42: inc @r7
+prn -127
+jsr S2
+dec L23
+L43: prn @r3
+jsr @r5
+sub L6, L30
+bne @r2
+dec L27
+jsr L39
+inc @r1
+not L5
+cmp @r7, L0
+bne S4
+inc @r1
+m4
+sub 505, L16
+inc @r2
+add -145, L32
+prn L19
+add 485, @r0
+rts
+jsr @r7
+jsr @r3
+cmp L36, @r6
+sub @r0, @r4
+lea L27, @r0
+mov @r4, S4
+m1
+L44: clr L19
+m2
+lea L3, L6
+inc L22
+rts
+inc @r7
+mov L16, @r7
+L45: bne @r1
+red @r0
+jmp @r1
+L46: sub L24, @r2
+not @r2
+rts
+add @r5, L21
+add @r4, L18
+red @r7
+cmp @r7, 444
+cmp -364, 40
+prn @r1
+inc @r5
+add D0, @r7
+cmp 467, @r6
+L47: rts
+inc @r6
+not @r4
+not @r2
+inc L29
+L48: rts
+prn 408
+lea L24, L23
+L49: prn -34
+cmp L18, @r0
+red L10
+add L36, L23
+cmp 256, 449
+clr L39
+not @r0
+L50: clr @r6
+jmp @r5
+m1
+L51: mov L12, L55
+red @r0
+prn @r4
+add 173, @r5
+clr @r0
+inc @r5
+add @r0, L4
+sub @r5, L17
+inc @r0
+rts
+L52: red L22
+add -25, @r0
+jmp @r7
+L53: cmp -83, @r0
+m0
+mov 319, @r2
+bne @r7
+jmp @r2
+sub @r3, @r3
+jmp @r7
+red @r0
+L54: cmp 10, -11
+L55: dec @r4
+jsr L32
+mov L56, L7
+mov L53, L38
+rts
+red L57
+rts
+clr @r2
+clr L14
+L56: not @r6
+m4
+red @r7
+sub @r6, L19
+prn @r0
+rts
+bne L42
+prn @r0
+sub -234, L54
+jsr @r5
+red @r7
+inc @r3
+dec @r7
+add -391, @r4
+prn 178
+not @r4
+L57: jmp X1
+mov @r2, L56
+jsr L3
+rts
+m2
+clr L38
+L58: cmp @r3, -353
+prn X2
+clr D0
+m1
+m1
+rts
+jmp X3
+prn L59
+bne L59
+add L59, L59
+sub S3, L59
+not D0
+L59: lea S4, X4
+bne S6
+prn S8
+inc S0
+add S2, L27
+stop
+D0: .data -263,54,446,219,373,462,434,-33,490,-316
+D1: .data 279,-229,60,169,157,91,231,-383,384,380
+D2: .data 167,-14,-353,67,344,-461,-93,220,70,-85
+D3: .data -464,57,341,-19,88,-387,15,-66,145,379
+D4: .data -85,394,41,96,360,-79,95,57,211,253
+D5: .data -384,93,454,-121,-393,-397,-51,69,-473,330
+D6: .data 380,-324,470,499,252,453,-241,-462,229,-184
+D7: .data 147,-7,120,-321,-15,-321,-129,207,-497,145
+D8: .data 476,-108,51,193,44,8,-209,-361,49,-311
+D9: .data 12,313,200,335,191,-298,240,-122,-428,130
+S0: .string "phcqfbn"
+S1: .string "w"
+S2: .string "fbuyxkxmpj"
+S3: .string "wvjzjkulq"
+S4: .string "dofqnpevtcwqactggfdg"
+S5: .string "alksqspwmxzizb"
+S6: .string "kfdhcjv"
+S7: .string "pekh"
+S8: .string "inaogxpgyejvtwpx"
+S9: .string "w"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r1
+    prn 87
+endmcro
+mcro m1
+    sub @r2, @r0
+    prn 32
+endmcro
+mcro m2
+    sub @r0, @r6
+    prn 31
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 25
+endmcro
+mcro m4
+    sub @r0, @r7
+    prn 38
+endmcro
+lea L0, @r0
+not L0
+dec @r7
+m1
+bne L0
+jmp @r7
+jsr @r3
+m3
+inc @r3
+clr @r6
+bne L0
+not L0
+mov L0, @r4
+add L0, L0
+inc @r6
+L0: not @r5
+clr @r7
+not @r6
+dec @r5
+mov L0, @r7
+mov L0, @r3
+dec L0
+L1: prn -334
+sub @r0, L0
+dec @r2
+add L0, @r3
+mov L0, L0
+L2: cmp @r5, @r5
+jmp L1
+prn 205
+rts
+L3: bne L1
+prn -427
+clr L0
+bne @r7
+clr @r3
+m1
+clr @r5
+lea L0, L3
+m4
+L4: jsr @r4
+L5: clr @r1
+not X0
+red @r5
+L6: jsr @r1
+prn @r6
+bne @r3
+bne L1
+prn L3
+inc L1
+bne L6
+rts
+add L4, L0
+red @r4
+cmp -480, L3
+L7: not L3
+L8: not @r3
+lea L0, @r4
+bne @r2
+clr @r3
+add @r2, L0
+jmp @r0
+add -192, @r2
+mov L37, @r1
+add L7, L5
+inc @r4
+bne @r5
+rts
+clr @r2
+jsr @r4
+rts
+m0
+bne @r7
+L9: rts
+not L5
+rts
+jsr @r5
+sub @r4, @r7
+L10: dec @r7
+jmp L4
+not @r4
+inc @r7
+add L7, L10
+dec L4
+jsr @r7
+jmp @r0
+L11: lea L1, @r2
+rts
+red @r1
+cmp @r7, 236
+inc L51
+rts
+L12: dec L53
+m2
+red @r5
+lea L7, @r5
+L13: cmp -454, 458
+cmp D0, @r0
+m0
+m4
+rts
+clr @r3
+rts
+jmp L2
+cmp 154, @r1
+L14: clr D0
+red L10
+lea L3, L9
+sub -146, @r7
+jmp @r5
+not @r1
+rts
+sub L3, @r0
+dec @r3
+jsr L8
+inc L2
+not @r5
+lea L7, L8
+L15: rts
+dec @r6
+L16: jsr @r0
+cmp L4, @r7
+add 119, @r2
+jmp @r1
+L17: mov -345, @r2
+cmp -261, @r6
+bne L1
+sub @r0, D0
+L18: jsr @r4
+bne @r0
+m3
+not @r1
+inc L6
+mov @r7, L2
+rts
+red @r5
+not @r3
+m2
+cmp @r7, 153
+red @r5
+jmp @r2
+jmp @r3
+not @r1
+add -199, @r1
+jmp L2
+lea L2, L18
+clr L16
+bne L7
+sub @r4, L44
+cmp @r4, 205
+m3
+prn @r7
+prn @r7
+add L12, L6
+dec L5
+rts
+rts
+cmp @r1, @r3
+dec L10
+jmp L3
+L19: lea L15, L17
+rts
+jmp L16
+prn @r2
+L20: clr L53
+L21: cmp @r4, L10
+dec L18
+L22: red L22
+add @r3, @r1
+prn @r5
+dec @r7
+L23: lea L22, @r5
+rts
+jmp L5
+m2
+L24: prn @r1
+clr L11
+jsr L4
+inc @r3
+cmp L6, -239
+m2
+mov L24, @r7
+lea L0, S7
+bne @r1
+inc L0
+prn @r4
+jsr L19
+jmp @r4
+lea L7, L7
+not @r4
+bne L3
+cmp 406, @r6
+m4
+dec L9
+jmp L40
+rts
+jsr @r0
+not L4
+cmp @r0, @r7
+dec @r2
+L25: red @r6
+cmp @r4, 340
+jmp L22
+L26: lea L15, L21
+rts
+m4
+mov -296, @r4
+clr @r1
+red @r4
+mov L14, @r6
+red L18
+L27: clr D0
+inc @r1
+lea L1, @r3
+m1
+dec L0
+dec @r4
+mov -221, @r0
+clr L26
+m1
+m0
+mov L0, @r2
+cmp -407, L23
+cmp 4, L24
+dec L22
+bne @r5
+red @r5
+jsr @r0
+clr L19
+L28: red @r1
+m4
+bne @r4
+dec @r2
+clr L7
+m1
+m3
+m2
+add @r4, L20
+L29: add L9, @r6
+m4
+clr L58
+dec @r0
+L30: dec @r5
+cmp -444, L49
+mov @r1, @r4
+dec L22
+lea L8, L0
+clr @r6
+jmp @r7
+rts
+m2
+add -459, @r6
+L31: add 210, @r3
+clr @r2
+L32: dec @r6
+clr @r7
+add L22, L32
+red @r7
+bne L29
+lea L18, @r6
+clr L16
+mov @r3, L15
+prn 33
+mov 133, L26
+jmp @r4
+dec L42
+m3
+jmp L14
+L33: prn L19
+m4
+lea L32, L16
+add @r1, L21
+L34: dec L58
+m3
+add @r3, @r0
+rts
+prn @r6
+prn @r7
+L35: red @r2
+jsr L35
+inc L11
+m3
+m3
+jmp @r2
+clr @r1
+prn L1
+dec @r0
+mov L53, X1
+lea L31, L0
+sub @r1, L14
+L36: add @r7, @r2
+jsr L28
+add L1, L4
+add 116, L39
+rts
+sub L1, L30
+lea L2, @r6
+prn L34
+m0
+clr L2
+clr @r2
+mov 144, @r0
+prn L18
+inc @r7
+sub -424, L37
+cmp L9, @r3
+inc L5
+sub L31, @r4
+not L23
+prn @r0
+sub @r0, @r3
+m0
+clr @r1
+L37: jsr @r1
+sub L8, @r0
+mov X2, L18
+jmp L11
+dec @r0
+lea L12, L33
+jsr @r0
+jmp @r0
+m3
+m4
+L38: cmp 223, L21
+jsr S9
+L39: jsr L31
+mov @r2, L35
+lea L5, @r3
+sub 448, L24
+bne @r6
+sub -195, L29
+jsr L2
+jsr @r6
+m1
+rts
+prn L41
+red @r7
+clr S8
+dec S4
+L40: mov L36, @r4
+not @r0
+m1
+m2
+jmp @r3
+lea L39, L35
+jmp L23
+dec L32
+jsr @r5
+rts
+prn @r1
+prn @r6
+dec @r5
+inc L11
+lea L9, @r3
+L41: cmp @r0, -171
+L42: clr @r5
+not @r6
+m4
+bne @r0
+jsr @r6
+dec L34
+L43: bne L39
+inc @r7
+L44: bne @r7
+bne @r3
+red @r6
+prn X3
+sub @r7, L56
+prn 145
+red @r1
+bne L26
+clr @r4
+inc L35
+clr @r6
+lea L0, @r6
+jmp L2
+L45: dec @r1
+jsr L26
+sub @r5, L41
+dec L29
+sub L23, @r2
+L46: mov S6, @r4
+prn -203
+L47: dec @r4
+prn L9
+m3
+bne L53
+L48: sub 503, @r0
+jsr @r0
+cmp L40, @r3
+mov 175, L22
+mov L31, L42
+not @r2
+prn @r7
+L49: rts
+clr @r1
+lea L2, L15
+clr S3
+sub @r7, L43
+bne X4
+mov @r0, @r1
+sub L31, L39
+jmp L0
+L50: rts
+m4
+cmp 280, @r5
+not @r5
+L51: clr @r0
+add -91, @r6
+dec @r7
+sub @r4, @r7
+L52: rts
+add @r0, L16
+add L33, @r1
+jmp L55
+L53: jsr L55
+L54: sub 298, L59
+L55: dec @r0
+L56: sub L13, D0
+not L51
+m0
+sub @r7, @r7
+cmp L45, @r0
+jsr D0
+sub D0, @r6
+inc @r1
+L57: red S7
+add L16, @r3
+sub S1, @r7
+inc @r7
+red L11
+L58: add 321, L59
+bne L1
+L59: jmp @r0
+jsr S6
+add @r5, D0
+inc S3
+red @r0
+sub D0, L17
+add D0, @r2
+stop
+D0: .data -269,133,140,479,-164,190,109,-52,8,406
+D1: .data 236,23,-36,-239,-215,-378,-4,389,65,-246
+D2: .data -61,228,-106,479,121,-93,-281,-259,-454,-123
+D3: .data 334,-1,6,-163,412,206,-201,-437,-242,45
+D4: .data 27,209,-37,53,494,-483,128,364,-24,-74
+D5: .data 453,-89,395,-362,-63,399,371,216,-163,11
+D6: .data 459,-354,373,-118,-125,432,424,391,-157,-74
+D7: .data 419,-75,-454,-273,-19,242,-384,-236,-18,492
+D8: .data 11,267,-242,347,-360,473,-344,241,-65,-346
+D9: .data -198,-36,307,184,-449,29,-64,225,-330,-320
+S0: .string "fijznmrvpscx"
+S1: .string "xgibbl"
+S2: .string "boxbuszoi"
+S3: .string "rqoxtqxqm"
+S4: .string "xqiojqjlguzcmxr"
+S5: .string "dkcmtvl"
+S6: .string "lepnitxmdnezaosrdjyr"
+S7: .string "cpmwccvj"
+S8: .string "jucmmdqxiau"
+S9: .string "dhghtujxudfnj"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r3
+    prn 57
+endmcro
+mcro m1
+    sub @r7, @r1
+    prn 31
+endmcro
+mcro m2
+    sub @r2, @r3
+    prn 96
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 1
+endmcro
+mcro m4
+    sub @r2, @r5
+    prn 63
+endmcro
+m1
+dec @r3
+jsr @r0
+inc L0
+mov -258, @r7
+lea L0, D0
+L0: add @r2, L0
+prn -475
+m3
+jsr L0
+jsr L0
+inc @r2
+jmp @r0
+cmp L6, -13
+jsr @r7
+clr @r5
+rts
+dec @r7
+L1: mov -335, @r3
+rts
+L2: red @r2
+lea L1, @r4
+bne @r4
+L3: not @r0
+L4: inc @r2
+clr @r6
+m1
+dec @r1
+m0
+jmp @r4
+jmp @r0
+dec L4
+m3
+mov L2, S2
+clr L2
+jmp @r7
+mov L4, @r4
+sub X0, @r6
+dec @r3
+jsr @r3
+red L0
+not @r6
+prn L4
+cmp @r4, L3
+prn 237
+clr D0
+m3
+L5: bne @r3
+L6: lea L1, L4
+L7: inc @r3
+clr @r5
+lea L5, L4
+L8: lea L3, @r2
+m3
+red @r6
+rts
+jsr @r7
+cmp @r2, -393
+L9: rts
+lea L7, L2
+red L9
+red @r5
+clr @r1
+inc @r4
+mov @r4, @r2
+sub L4, @r2
+jmp L3
+add 122, L1
+rts
+prn -236
+dec L0
+jmp @r7
+red @r2
+clr @r5
+not @r4
+mov X1, L1
+mov @r3, @r0
+dec @r7
+jmp L1
+not L3
+not L2
+add L9, @r7
+inc @r4
+jsr L9
+prn -41
+jmp L8
+add L5, L3
+red @r1
+mov L21, @r1
+dec L7
+m1
+rts
+jmp L1
+jsr S5
+bne D0
+add 10, @r2
+bne L4
+m0
+inc L4
+m2
+mov @r1, @r3
+red L1
+dec L5
+bne @r3
+jmp @r2
+add 219, @r6
+jmp L5
+dec @r6
+prn L5
+sub @r6, @r5
+jmp L4
+L10: lea L7, @r2
+L11: clr @r6
+bne L3
+prn 50
+L12: inc L5
+cmp @r6, L12
+m1
+red L12
+sub L6, @r1
+L13: jmp L7
+m1
+m4
+L14: jmp L5
+rts
+lea L0, @r3
+m0
+jmp S8
+prn @r7
+m3
+mov L13, @r3
+m3
+dec L7
+cmp L7, 416
+m0
+sub L3, @r7
+rts
+sub 378, L10
+prn @r5
+sub L10, @r5
+m0
+red L10
+bne @r0
+add @r0, L7
+L15: inc @r2
+red @r7
+mov @r0, @r3
+jmp @r5
+bne L14
+mov L0, @r1
+dec @r1
+sub L6, S5
+dec @r1
+inc @r5
+jsr @r0
+clr L4
+prn @r1
+L16: bne @r4
+sub @r0, @r1
+sub L13, L15
+jsr @r2
+rts
+L17: prn L13
+mov @r3, @r1
+cmp @r6, @r7
+L18: red L6
+not L2
+jmp @r3
+L19: jmp @r1
+cmp 309, L22
+bne L18
+prn @r6
+jmp @r6
+L20: sub -333, L32
+clr L13
+jmp L4
+bne L5
+lea S1, L59
+jsr @r2
+lea L13, L5
+lea L4, @r3
+lea L10, L1
+m1
+prn @r4
+dec @r6
+jsr L12
+red @r4
+clr L13
+lea D0, L3
+cmp L20, L0
+clr L17
+clr L18
+cmp 17, L11
+rts
+rts
+jmp L0
+mov L10, @r4
+L21: cmp 43, @r1
+red @r2
+clr @r4
+mov L7, @r7
+L22: jsr L5
+rts
+L23: prn L4
+m3
+red @r4
+dec L18
+inc L12
+dec L10
+clr @r7
+mov @r1, @r5
+add L24, @r4
+m0
+L24: bne @r0
+lea L27, @r6
+clr @r2
+not L24
+dec X2
+lea L19, @r4
+clr L7
+mov @r7, @r2
+m2
+cmp L7, -2
+inc L21
+L25: sub L3, L13
+add -419, @r1
+add 309, @r7
+clr @r3
+sub 387, L19
+L26: rts
+add -292, @r1
+red L22
+dec L7
+lea L0, D0
+jmp @r4
+jmp L16
+lea L3, @r6
+rts
+L27: bne @r4
+L28: red @r4
+bne @r1
+dec @r7
+m4
+not @r0
+inc L18
+prn 217
+inc L14
+add L13, @r3
+clr L26
+bne @r7
+mov -205, D0
+jsr L18
+L29: jmp @r1
+L30: red @r2
+not @r1
+lea L4, @r3
+lea L10, L26
+add -302, L29
+L31: jmp L29
+sub L18, @r5
+m0
+prn @r5
+m3
+L32: inc L7
+inc X3
+bne L8
+prn L22
+L33: jsr @r3
+L34: add L33, @r6
+dec @r1
+inc @r1
+jsr @r3
+L35: mov L7, @r2
+inc L20
+rts
+jmp L0
+jsr L48
+jmp @r4
+sub @r3, L14
+L36: mov -62, L2
+red @r4
+jmp @r2
+L37: cmp @r0, @r6
+L38: mov 505, L23
+mov @r6, @r0
+L39: red L38
+L40: jmp L51
+cmp 488, L49
+rts
+dec L7
+add L35, L4
+m3
+inc L19
+rts
+jsr @r4
+jmp @r7
+L41: bne L10
+add 360, L23
+jmp @r4
+inc @r6
+not L28
+lea L6, @r4
+red @r5
+L42: prn @r6
+jsr L33
+clr @r1
+sub @r5, @r3
+bne @r6
+m1
+bne L17
+L43: rts
+red L6
+jsr @r6
+lea L8, @r0
+bne L40
+inc L7
+mov @r7, L35
+m3
+not L5
+clr @r4
+add @r4, L27
+rts
+inc L42
+sub 41, L31
+add @r0, @r1
+jmp L5
+inc L3
+L44: cmp L37, L33
+m3
+L45: lea L3, L44
+m0
+L46: cmp L6, @r7
+jsr @r5
+inc L32
+jsr L23
+prn L23
+jsr @r0
+not L0
+bne @r1
+rts
+jmp @r3
+bne L0
+clr @r3
+dec @r3
+not @r2
+sub @r4, @r0
+clr @r3
+lea L5, L7
+inc L8
+clr X4
+bne L39
+sub L27, L31
+clr @r7
+jmp @r7
+rts
+rts
+rts
+L47: add -405, @r4
+clr L11
+m4
+cmp L30, 471
+clr @r0
+mov L36, L45
+jmp @r3
+m1
+L48: bne @r1
+L49: rts
+dec L18
+inc L21
+clr L59
+jmp L48
+clr L27
+m3
+add @r4, @r7
+prn -350
+sub @r3, @r0
+m4
+rts
+L50: prn L57
+mov @r5, D0
+sub -369, @r6
+red L22
+mov @r5, @r4
+not L24
+L51: red @r7
+inc D0
+dec L32
+m3
+jsr L22
+clr L9
+dec L26
+m0
+dec @r6
+prn -347
+cmp L12, @r5
+sub -171, L29
+not L43
+L52: clr @r1
+mov L54, @r2
+m3
+add L44, L55
+sub 314, L30
+L53: red @r5
+prn S7
+jmp @r5
+inc @r2
+red D0
+red L41
+clr @r6
+m4
+mov @r6, @r4
+add L53, @r2
+clr @r0
+jsr L52
+L54: jsr L7
+prn @r0
+jsr D0
+L55: cmp S3, @r5
+add L51, L34
+L56: add L54, @r6
+rts
+cmp L47, L36
+m4
+L57: prn -42
+jsr @r7
+clr @r7
+jmp @r7
+L58: jsr @r6
+lea L31, D0
+inc L13
+jmp D0
+cmp 247, @r4
+bne @r5
+rts
+cmp L59, L59
+not D0
+not L59
+m2
+L59: red S9
+cmp S1, D0
+stop
+D0: .data 475,-191,-397,71,264,341,291,-165,-257,240
+D1: .data -365,409,-389,88,434,141,491,-478,-376,-434
+D2: .data -94,160,-95,-361,233,438,-306,-421,-152,-404
+D3: .data 39,348,-79,-311,256,-264,-393,173,264,467
+D4: .data -310,-119,-85,238,34,281,-358,402,-321,-186
+D5: .data 197,434,295,344,34,286,-461,129,1,-89
+D6: .data -420,-132,-409,283,135,-375,-63,142,140,263
+D7: .data 65,128,69,-129,-462,386,-249,-292,-143,-484
+D8: .data 195,-17,-119,358,-167,-4,134,-71,234,-276
+D9: .data 475,-319,-269,9,169,427,304,-158,-431,436
+S0: .string "lgqhvrrlggaj"
+S1: .string "levlmcqdawjfmz"
+S2: .string "wgsjxxwtfgsh"
+S3: .string "cps"
+S4: .string "ozzzxtdqonclxuyma"
+S5: .string "ocihdunifgudrduhulv"
+S6: .string "zhilqjahmfmrkdo"
+S7: .string "pulwbegkqvcus"
+S8: .string "xehpkzhw"
+S9: .string "cwliqbotd"
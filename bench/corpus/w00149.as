@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r6
+    prn 95
+endmcro
+mcro m1
+    sub @r3, @r3
+    prn 29
+endmcro
+mcro m2
+    sub @r5, @r1
+    prn 61
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 77
+endmcro
+mcro m4
+    sub @r4, @r3
+    prn 87
+endmcro
+cmp L0, 111
+m3
+mov L0, @r7
+dec @r1
+prn @r4
+m1
+prn 192
+sub L0, L0
+inc L0
+lea L0, L0
+m2
+red @r4
+sub @r4, L0
+sub @r0, L0
+sub @r1, L0
+not @r5
+dec L0
+clr @r2
+prn L0
+inc @r6
+L0: sub @r0, L0
+mov -265, L0
+L1: cmp @r6, L0
+sub @r5, @r0
+lea L1, @r2
+clr @r1
+prn L1
+L2: bne @r6
+rts
+sub @r0, L0
+m2
+m4
+mov @r6, L1
+bne D0
+inc L1
+rts
+prn @r4
+dec @r0
+rts
+cmp L0, @r3
+mov L2, @r2
+L3: sub 23, @r3
+clr @r0
+jsr L3
+L4: inc L3
+not L2
+dec L1
+rts
+rts
+add L3, @r6
+jmp @r0
+red L4
+rts
+inc L0
+L5: bne L4
+lea L3, @r5
+bne L5
+sub L4, @r2
+mov -136, L2
+dec L3
+red L3
+L6: cmp @r4, @r6
+cmp L1, 253
+m3
+prn @r4
+cmp 350, 307
+L7: add -352, @r7
+jmp @r1
+rts
+clr @r6
+jsr L5
+not L2
+jmp L2
+rts
+rts
+red L7
+jmp @r5
+mov 378, @r2
+inc L2
+rts
+not @r0
+mov @r4, @r3
+m3
+jmp @r0
+L8: jmp L5
+clr @r4
+sub 299, @r6
+red @r0
+L9: cmp @r3, @r3
+not @r5
+m4
+clr L5
+rts
+jmp @r4
+prn 444
+m0
+bne L9
+L10: sub 419, L2
+bne @r5
+clr L10
+mov -347, L1
+L11: clr @r4
+inc L8
+prn @r3
+not L10
+lea L3, @r0
+prn @r6
+L12: sub @r7, L6
+L13: mov 64, @r7
+dec @r6
+sub 55, L3
+L14: jmp @r1
+cmp @r0, 114
+cmp L9, -278
+prn @r2
+lea L5, L2
+mov @r2, L13
+red @r2
+dec L2
+mov 74, L9
+m4
+mov -315, L0
+sub @r6, @r7
+jsr L12
+cmp @r4, @r7
+dec L9
+lea L7, @r3
+add L3, L4
+bne @r6
+not L11
+clr @r2
+jsr L7
+not L9
+L15: prn @r3
+sub -442, @r5
+add L2, L9
+jmp L9
+L16: red @r3
+mov L59, @r7
+lea S9, L5
+cmp @r0, L7
+m0
+jsr L14
+inc L4
+cmp -315, L15
+jsr @r0
+mov L36, @r3
+clr @r6
+prn @r0
+add @r7, L0
+rts
+lea L11, @r2
+lea L14, @r0
+L17: jmp L0
+add @r6, @r5
+lea L0, L14
+cmp @r3, 410
+dec @r5
+L18: add @r7, @r2
+red L4
+sub L1, L16
+sub @r4, @r1
+bne L8
+rts
+m0
+prn 275
+cmp L8, -282
+cmp 409, @r2
+jsr @r1
+lea L15, L12
+add L14, @r3
+red @r2
+L19: not @r1
+jsr @r3
+red @r7
+mov -226, @r4
+inc L0
+jmp L15
+jsr L10
+jsr @r4
+m0
+not @r6
+mov L14, L5
+add @r1, @r6
+sub @r2, @r3
+bne L13
+prn @r5
+jmp L17
+m2
+lea L41, @r7
+jmp L0
+prn 275
+cmp @r7, -319
+m0
+bne @r4
+m0
+m1
+mov @r4, @r7
+m0
+inc L11
+prn @r6
+L20: bne L14
+clr L13
+cmp 200, @r6
+dec @r7
+red @r2
+bne @r3
+cmp -308, L20
+L21: mov 503, L6
+L22: red @r5
+dec L5
+prn @r4
+dec @r5
+not @r2
+sub -299, L7
+L23: rts
+L24: red @r7
+bne @r5
+red @r7
+m2
+sub @r0, L17
+m0
+lea L20, @r1
+add @r5, L24
+clr L9
+cmp 310, @r5
+prn 493
+not @r5
+m0
+sub 23, @r7
+L25: prn L12
+dec @r1
+jmp L1
+cmp @r0, @r2
+sub @r5, L15
+mov @r1, @r5
+L26: prn 289
+rts
+add @r6, @r3
+L27: red L56
+not L1
+prn 124
+L28: dec @r0
+lea L7, @r7
+not L23
+jmp @r7
+rts
+inc @r0
+m1
+dec @r4
+red L8
+dec @r0
+mov L0, @r5
+clr @r0
+not @r1
+L29: cmp L3, @r5
+bne @r2
+clr L8
+L30: jmp @r2
+mov L25, @r1
+cmp S3, L58
+m4
+L31: red L28
+cmp @r0, @r5
+m3
+m1
+jmp @r3
+rts
+red @r4
+m0
+jsr L9
+not D0
+inc L7
+L32: cmp -366, 99
+m4
+not @r6
+prn L20
+cmp L27, L8
+add @r3, @r6
+L33: mov 315, @r5
+dec L52
+dec @r1
+dec X0
+m3
+m0
+red @r1
+sub -139, @r7
+cmp @r7, @r3
+jsr @r4
+jsr @r0
+jmp @r2
+dec @r0
+bne @r3
+sub L24, S2
+red @r4
+mov S4, @r6
+inc @r3
+cmp @r1, @r0
+bne L19
+dec @r6
+m3
+add @r3, @r2
+jsr L16
+sub 7, @r1
+not L54
+cmp -82, L5
+prn L32
+L34: dec @r3
+lea L23, L22
+red L30
+bne L55
+prn @r3
+cmp L29, L1
+L35: sub L18, L35
+jsr @r6
+sub L1, @r4
+rts
+m1
+jsr @r5
+jmp L0
+L36: mov @r1, @r3
+L37: red @r4
+L38: not L6
+inc @r3
+mov @r0, L49
+jmp @r7
+add L16, L22
+mov 302, L3
+add 281, L32
+not @r7
+mov L0, @r3
+rts
+L39: prn L14
+red @r2
+dec @r7
+inc L28
+L40: inc @r5
+mov L44, D0
+prn L7
+dec @r7
+lea L14, @r1
+inc @r4
+jsr @r4
+L41: inc L20
+inc L11
+bne L40
+red S5
+red D0
+mov S3, L38
+m1
+L42: dec S6
+jmp @r7
+jsr @r4
+m0
+cmp @r1, L20
+L43: not @r6
+prn 453
+dec D0
+dec @r6
+jmp L33
+prn @r2
+cmp @r4, L6
+not L43
+not L20
+bne L41
+rts
+dec L33
+m0
+bne @r3
+sub 287, S1
+L44: not @r7
+add @r2, L9
+prn @r7
+lea S1, @r5
+L45: dec L48
+bne @r7
+jsr @r5
+prn -330
+L46: mov @r6, @r6
+prn @r7
+red S6
+m4
+cmp 446, -66
+mov @r0, D0
+clr L25
+m1
+L47: rts
+L48: mov @r7, @r7
+add @r0, @r3
+cmp 361, L55
+m0
+bne X1
+add @r0, D0
+red L22
+add -31, @r2
+sub L27, @r4
+inc @r5
+L49: inc @r6
+dec L17
+L50: cmp @r7, 410
+jmp L32
+mov @r0, @r4
+L51: red @r5
+jsr @r5
+cmp @r6, L53
+dec L13
+red L46
+mov L50, @r0
+L52: add @r4, L57
+L53: jmp L17
+L54: lea L47, S5
+lea L57, L15
+rts
+lea X2, @r4
+bne @r1
+red D0
+not @r0
+bne @r5
+jsr L28
+clr L16
+L55: sub @r4, @r0
+L56: jsr L5
+m3
+rts
+L57: add @r7, L4
+red @r1
+red @r1
+cmp L23, 322
+clr L58
+inc @r5
+rts
+red S5
+lea L58, @r4
+L58: jmp L59
+add @r4, L59
+m3
+m3
+sub X3, X4
+not @r7
+L59: inc S3
+stop
+D0: .data 234,76,-376,20,-70,-133,-401,-222,-496,-147
+D1: .data 215,124,-223,-193,-281,285,-3,75,-6,-421
+D2: .data -480,-435,436,190,475,264,54,100,395,68
+D3: .data 20,-406,12,488,422,-190,-171,-47,-20,-376
+D4: .data -337,248,-418,-26,-195,-53,-410,-68,-443,59
+D5: .data 125,464,496,495,439,53,442,-166,-182,-100
+D6: .data 114,-103,-175,81,333,-462,-341,144,-96,-299
+D7: .data -187,165,346,192,-295,190,-139,-235,-30,260
+D8: .data 428,11,-324,-408,-111,-384,228,384,-268,-36
+D9: .data -397,59,196,-139,449,451,-297,321,-225,-248
+S0: .string "pwrgur"
+S1: .string "mxpxcudbfrayqdpgtiy"
+S2: .string "daw"
+S3: .string "zqjossptohbcm"
+S4: .string "vyqokyzbsirpo"
+S5: .string "zfuraxxnzfteinp"
+S6: .string "nxkkhvvkacbp"
+S7: .string "qivfifmzvnqbdeuv"
+S8: .string "zvbvktwrcmmb"
+S9: .string "vmxgdseuy"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r1
+    prn 66
+endmcro
+mcro m1
+    sub @r7, @r4
+    prn 28
+endmcro
+mcro m2
+    sub @r7, @r7
+    prn 27
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 54
+endmcro
+mcro m4
+    sub @r6, @r1
+    prn 12
+endmcro
+clr @r1
+jmp D0
+prn L0
+m2
+dec @r3
+add @r7, L0
+not @r3
+dec @r2
+sub @r3, L0
+prn @r0
+m2
+clr @r3
+clr @r7
+not @r1
+inc @r7
+add L0, L0
+mov L0, @r0
+bne @r5
+clr L0
+cmp 129, L0
+red L0
+jsr L0
+inc L0
+jsr @r3
+L0: bne @r6
+red L0
+jsr @r3
+L1: clr @r7
+sub -21, L0
+L2: dec @r1
+red L2
+cmp 373, L2
+L3: mov @r7, L3
+L4: add @r0, L4
+bne L4
+m2
+lea L4, L2
+m4
+red L0
+m0
+rts
+L5: jsr @r4
+lea L5, @r6
+jsr L2
+L6: add @r6, L3
+rts
+lea L0, @r3
+L7: jmp @r4
+red L7
+inc D0
+mov L0, @r1
+dec @r3
+not @r1
+sub -70, L22
+red @r7
+rts
+rts
+add -296, @r0
+cmp @r2, 377
+lea L2, @r0
+m3
+lea L0, @r6
+not L1
+jmp L7
+prn L3
+sub @r5, @r6
+dec @r3
+mov -34, L5
+L8: bne @r5
+bne @r5
+m4
+L9: red L2
+cmp 490, @r7
+rts
+sub L9, @r2
+not @r5
+L10: mov @r5, X0
+jsr L8
+jsr L10
+not L9
+bne @r4
+cmp 113, L6
+jsr @r6
+sub L14, @r1
+not L8
+L11: lea L6, @r4
+jmp @r2
+inc D0
+dec @r3
+prn 448
+m3
+m3
+rts
+clr @r4
+m1
+sub -275, L8
+jsr L8
+bne L9
+jmp L6
+m0
+sub 372, @r2
+L12: inc @r6
+inc L11
+dec @r6
+sub @r5, @r1
+sub L11, @r4
+rts
+m4
+L13: rts
+red L2
+add L5, L13
+red @r6
+L14: sub X1, @r1
+clr @r2
+m4
+prn 15
+red L5
+bne @r7
+L15: add L11, L0
+L16: jsr L1
+L17: inc L17
+rts
+prn -35
+inc @r0
+dec @r3
+prn L14
+bne L15
+rts
+L18: jsr L10
+red @r1
+sub L5, @r1
+jmp L6
+cmp -371, 23
+cmp 384, L14
+L19: clr @r5
+m2
+rts
+m3
+bne L11
+sub @r1, @r5
+sub L33, @r5
+clr @r6
+rts
+not L6
+clr @r2
+L20: dec @r7
+rts
+jsr @r2
+prn -138
+prn -286
+cmp -202, @r7
+m2
+L21: jsr L11
+cmp @r2, @r6
+rts
+mov 327, D0
+L22: mov @r7, @r2
+m1
+not @r3
+red L12
+prn @r2
+jsr L11
+red @r4
+not L11
+clr @r7
+jsr L9
+L23: jsr @r3
+jmp L23
+sub L41, @r0
+bne @r6
+red L6
+add @r7, L13
+L24: clr L9
+jmp L22
+jmp L12
+bne L16
+dec @r4
+dec L15
+bne L14
+L25: lea L20, @r2
+jmp L8
+L26: jmp D0
+m4
+cmp @r1, -318
+prn L4
+lea L23, L15
+dec @r7
+bne @r1
+m1
+sub L20, @r3
+bne @r0
+red @r5
+jsr D0
+rts
+bne @r1
+L27: add S3, L20
+inc L7
+red @r3
+L28: inc @r0
+lea L16, L27
+mov -494, X2
+lea L6, X3
+rts
+jmp @r6
+inc @r7
+prn L26
+not L19
+red L18
+sub D0, L2
+jmp L27
+L29: lea L18, @r5
+L30: red L3
+clr L12
+sub L28, L17
+clr L14
+m0
+m0
+bne D0
+mov L9, L17
+lea L6, @r5
+jsr @r7
+lea L49, @r6
+clr @r4
+dec L4
+not @r1
+dec L12
+jsr L30
+cmp 62, L30
+m2
+bne L2
+jmp L24
+red L2
+not L51
+add @r1, @r5
+inc L22
+jmp @r7
+L31: red @r1
+bne @r3
+dec @r1
+add 17, D0
+clr @r6
+clr @r7
+sub @r7, L6
+L32: clr @r5
+inc @r5
+cmp 87, L16
+inc L12
+m2
+red @r0
+m2
+sub 152, L23
+m0
+lea L22, L29
+L33: red @r2
+dec L16
+cmp @r5, @r4
+L34: lea L13, @r1
+red @r0
+jsr @r7
+add -217, D0
+cmp @r1, 198
+red L32
+not L31
+jsr L26
+inc L23
+add @r6, L44
+L35: red L7
+jmp S6
+cmp @r5, L16
+sub @r2, @r3
+dec @r5
+add L42, L31
+inc @r7
+rts
+cmp 237, -444
+L36: mov L17, L34
+lea L20, @r2
+prn -231
+cmp @r7, @r0
+cmp @r0, 164
+jsr L20
+lea L35, @r4
+inc @r4
+prn L29
+add -362, S8
+inc @r5
+jmp @r3
+jmp L20
+mov L36, S2
+rts
+lea L24, L30
+jsr L33
+lea L19, L33
+prn L21
+mov @r0, L28
+m4
+red L13
+jmp L4
+m3
+inc @r5
+sub -102, @r2
+jsr @r0
+mov @r3, @r0
+add @r0, @r7
+L37: inc @r6
+inc L15
+not @r4
+cmp 185, 31
+add 88, @r7
+add L9, L9
+jmp L13
+inc L0
+L38: mov 13, @r0
+sub @r0, @r5
+jsr @r1
+bne @r7
+clr @r1
+m1
+jsr @r1
+bne S2
+L39: red L17
+L40: clr @r6
+jmp @r1
+add L2, @r7
+L41: prn L38
+jsr @r0
+L42: red @r2
+rts
+not D0
+sub @r0, L4
+L43: inc L41
+bne L8
+dec L54
+rts
+L44: not L46
+not L29
+bne @r6
+bne @r4
+dec @r1
+m1
+m4
+jmp L17
+jsr @r3
+rts
+cmp @r2, @r0
+m2
+prn 247
+m1
+L45: mov 375, @r4
+cmp @r3, @r5
+mov L42, L45
+lea L25, @r0
+add -329, L5
+cmp L44, S2
+m3
+jsr @r3
+red L25
+not @r0
+m3
+L46: prn @r2
+cmp @r7, -39
+add L4, L37
+add L20, L52
+L47: lea L49, L24
+prn -26
+m1
+L48: not @r6
+jsr @r5
+dec @r7
+not @r1
+clr @r2
+mov -155, L47
+inc @r2
+bne L26
+clr L16
+mov @r1, X4
+inc L27
+m3
+lea L37, @r2
+add @r0, @r5
+dec @r2
+sub -349, L31
+sub @r2, @r6
+L49: prn @r5
+inc L23
+L50: cmp L43, @r2
+jmp @r5
+mov -283, L23
+L51: prn @r2
+bne @r4
+sub @r7, L57
+bne @r3
+L52: sub -160, L12
+dec @r0
+m3
+cmp 176, @r5
+bne L56
+mov @r0, L42
+rts
+jmp L0
+L53: clr @r3
+red @r4
+m1
+clr @r3
+red L53
+L54: clr @r3
+sub @r6, L47
+dec @r6
+lea D0, @r7
+inc @r2
+prn L44
+red @r7
+sub L44, L55
+sub @r4, @r5
+bne @r0
+L55: red L48
+m2
+m0
+jmp @r4
+dec L19
+lea L39, @r6
+cmp S1, 495
+L56: dec L33
+L57: jmp @r1
+L58: cmp 48, @r0
+mov -491, @r0
+rts
+rts
+L59: prn @r1
+jsr @r2
+lea S4, @r1
+mov S4, S2
+red L26
+sub -425, S8
+inc L16
+prn 123
+jmp L24
+not L32
+add D0, D0
+red @r4
+stop
+D0: .data 335,-164,-204,426,-481,-241,-354,277,-242,274
+D1: .data 306,-443,183,195,-242,474,65,-104,428,-208
+D2: .data -292,-452,-263,165,1,-445,482,-353,157,9
+D3: .data -163,-65,390,-72,32,37,208,-375,438,22
+D4: .data -203,-365,-278,125,-491,-493,-332,-52,-279,51
+D5: .data -298,398,-378,93,-314,-379,-392,-87,77,-341
+D6: .data -74,-96,183,47,-84,-257,404,-78,167,37
+D7: .data 470,-224,357,-250,-155,-377,184,-470,-256,373
+D8: .data 42,60,341,-135,-315,472,56,-322,-196,-302
+D9: .data 99,245,-414,-153,57,-110,162,-92,202,373
+S0: .string "zzb"
+S1: .string "dtbohrlddnat"
+S2: .string "wxfybquzehlllilldmgb"
+S3: .string "xwvyfzwp"
+S4: .string "zwfmjaolcvswlk"
+S5: .string "fsagogjrcrrxhizp"
+S6: .string "whfuflrerc"
+S7: .string "dsqfcqqvodujcecijn"
+S8: .string "flhzoei"
+S9: .string "emjv"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r3
+    prn 4
+endmcro
+mcro m1
+    sub @r4, @r5
+    prn 26
+endmcro
+mcro m2
+    sub @r1, @r5
+    prn 92
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 30
+endmcro
+mcro m4
+    sub @r0, @r0
+    prn 36
+endmcro
+L0: prn 133
+jsr @r2
+jmp L0
+m2
+bne @r3
+L1: not L0
+sub -335, @r7
+not L0
+add L1, @r1
+add @r3, L1
+jsr L0
+inc @r2
+cmp L1, X0
+L2: prn @r6
+jsr L2
+red @r7
+lea L1, @r4
+jsr L1
+red @r0
+mov @r0, @r1
+clr L2
+lea L0, @r7
+sub -131, L2
+sub @r6, @r4
+L3: add -504, @r5
+rts
+red L1
+jmp @r6
+cmp @r7, L0
+lea L2, @r5
+m4
+dec L0
+clr L3
+sub @r4, @r0
+jmp @r5
+L4: red @r4
+jmp @r1
+bne L0
+clr @r4
+bne @r3
+lea L2, L1
+jsr L4
+jmp L0
+add @r0, L1
+bne @r3
+m0
+dec L2
+dec L3
+jsr L1
+lea L4, L3
+m1
+L5: inc @r7
+lea L3, @r3
+sub L4, @r6
+rts
+cmp -495, -124
+cmp @r7, @r2
+cmp @r7, 180
+dec @r0
+jsr L1
+jmp L0
+L6: add L4, L6
+L7: clr L1
+mov 422, L5
+L8: prn -483
+mov -195, L1
+not @r7
+clr @r1
+bne L31
+jsr L8
+jsr @r6
+bne L8
+m2
+bne @r3
+lea L5, @r1
+dec @r4
+L9: jmp L8
+mov L3, S6
+m0
+add L1, L5
+add -57, @r2
+not @r4
+not L36
+red L3
+dec L41
+bne @r4
+jsr L3
+clr L9
+L10: jmp L4
+clr L0
+mov @r5, L3
+prn 197
+L11: dec L1
+L12: inc @r6
+clr L7
+L13: not @r2
+jmp @r3
+clr @r5
+prn -137
+L14: prn @r0
+prn @r7
+lea L12, @r2
+jsr L14
+add L0, S4
+m2
+not L10
+prn @r1
+m4
+prn -427
+rts
+mov -365, L4
+clr @r4
+m0
+lea L3, L14
+L15: cmp @r1, 343
+clr @r0
+jmp @r6
+cmp L8, @r4
+L16: not @r2
+add @r6, @r4
+not @r7
+clr @r7
+bne L8
+m4
+not L0
+not @r7
+bne @r6
+prn @r1
+not @r2
+prn @r7
+bne L15
+sub -49, @r0
+L17: dec @r6
+add S3, L16
+m2
+inc L13
+dec @r6
+prn L12
+jmp @r5
+bne L31
+clr @r5
+inc @r7
+prn @r6
+cmp 240, L6
+dec L12
+dec @r2
+lea L7, @r3
+L18: red L14
+rts
+m0
+not L13
+jsr L3
+clr L0
+m3
+mov -41, @r0
+bne @r0
+clr L6
+jsr @r3
+L19: prn L3
+inc L5
+sub L3, @r1
+jsr @r3
+rts
+m3
+L20: rts
+prn @r2
+lea L9, @r7
+L21: clr L19
+clr L15
+jmp L10
+rts
+L22: red @r2
+mov L5, S7
+inc L9
+not L9
+red @r5
+bne @r6
+rts
+bne @r6
+prn L14
+mov 485, @r3
+inc @r6
+L23: dec L10
+not @r2
+L24: rts
+sub L1, @r7
+dec L0
+prn -332
+L25: jmp L21
+mov L24, @r3
+rts
+L26: add @r0, L23
+bne L22
+sub 29, @r1
+jsr @r6
+not L13
+inc L24
+sub L17, L1
+jsr @r6
+add L5, L6
+L27: prn 117
+red @r7
+m3
+m0
+mov L23, @r1
+lea X1, @r3
+rts
+inc D0
+L28: sub L23, L5
+m0
+add L12, @r0
+sub 97, @r5
+not L14
+m2
+cmp D0, 390
+L29: cmp 408, -381
+add @r2, @r2
+clr @r4
+red @r3
+prn @r3
+m3
+L30: bne L29
+L31: mov -50, L15
+inc L3
+m0
+inc L14
+inc @r1
+not @r2
+dec @r3
+jmp @r4
+not L21
+mov L20, @r1
+dec L1
+prn L20
+prn @r6
+prn 374
+cmp -268, 152
+mov S3, L19
+m2
+lea L9, @r6
+clr @r6
+inc L29
+L32: rts
+m4
+L33: cmp L0, L23
+mov L7, L32
+mov @r1, @r5
+jmp L58
+sub @r6, @r7
+cmp @r4, D0
+prn 396
+sub L30, @r4
+L34: rts
+dec L56
+inc L34
+jmp L5
+jsr @r2
+cmp @r7, -116
+red @r2
+L35: dec L8
+inc L3
+m0
+m0
+L36: inc L11
+jsr @r5
+not @r7
+sub @r2, @r0
+L37: jsr L8
+sub 46, L33
+clr @r7
+L38: jmp @r1
+rts
+clr @r7
+mov L25, L3
+bne L30
+add 30, @r4
+jsr @r5
+red L36
+lea L5, @r5
+clr @r0
+bne @r7
+sub @r0, L22
+lea L4, @r5
+L39: red L32
+red @r3
+jmp D0
+prn @r4
+cmp S5, @r6
+rts
+dec @r2
+red L0
+inc L26
+red L25
+dec L16
+clr L30
+not L2
+mov @r2, @r0
+dec L46
+sub -424, @r5
+L40: dec @r5
+m1
+L41: clr L11
+bne @r7
+bne L45
+inc L14
+L42: rts
+rts
+prn L4
+cmp L23, L15
+L43: mov L23, @r3
+mov @r3, L35
+L44: rts
+rts
+mov @r6, @r3
+sub L43, @r4
+dec @r5
+cmp -213, D0
+dec L26
+cmp -399, L23
+dec @r1
+prn 411
+jsr L7
+red L14
+jsr @r4
+m0
+clr @r5
+rts
+dec X2
+m3
+m4
+prn 115
+rts
+L45: mov L32, L17
+red @r1
+m4
+lea L34, L11
+prn L20
+red D0
+jsr L0
+not @r4
+m0
+dec L25
+rts
+L46: bne S1
+sub @r0, @r6
+mov @r1, @r4
+m1
+bne @r0
+lea L43, L46
+m0
+inc L30
+rts
+not L40
+dec L33
+L47: bne L36
+jmp @r3
+not @r4
+lea L19, @r0
+mov L59, @r4
+jsr @r7
+L48: lea L50, @r0
+add -395, @r1
+prn @r1
+prn L25
+jsr @r7
+add -384, @r3
+jsr @r5
+rts
+m0
+add L27, L33
+rts
+m0
+lea X3, @r4
+clr L40
+m4
+cmp -243, L48
+m1
+clr @r0
+L49: rts
+not L39
+cmp @r2, L2
+clr @r7
+m1
+prn @r5
+not L59
+jsr @r3
+L50: prn @r6
+L51: cmp @r3, L39
+cmp @r7, @r6
+cmp -183, L58
+m1
+cmp @r5, 386
+add L35, L26
+cmp L12, @r5
+jsr @r2
+L52: jsr L54
+not @r2
+mov -477, @r3
+prn @r0
+jmp @r0
+mov -41, D0
+L53: red @r1
+cmp @r5, 246
+clr L11
+sub -327, @r4
+L54: bne L12
+inc @r7
+not L37
+bne L21
+lea L58, L30
+bne @r3
+jmp @r3
+rts
+mov L18, @r5
+L55: add 458, @r0
+L56: jsr L59
+rts
+red L44
+bne @r0
+L57: clr L34
+dec L59
+prn L8
+inc L58
+m3
+L58: lea L44, L59
+sub L0, @r0
+sub 197, L59
+mov @r1, L22
+clr L2
+mov @r6, @r3
+jmp S3
+jsr L36
+jmp @r0
+cmp L59, @r5
+mov S8, L22
+m2
+jsr S5
+prn L59
+mov L59, L6
+L59: rts
+stop
+D0: .data -77,335,231,-303,-254,319,422,-384,375,-266
+D1: .data 331,-139,0,463,-173,-322,-143,64,-75,80
+D2: .data 397,-407,438,259,-122,219,-381,391,34,-112
+D3: .data -37,39,-214,-256,296,-162,-426,121,-262,-308
+D4: .data 169,281,110,-120,451,98,-102,-146,17,63
+D5: .data 198,-284,390,376,340,-46,465,176,277,299
+D6: .data 377,312,183,-266,-291,75,313,-315,327,-342
+D7: .data -249,373,-425,460,-262,402,269,42,-146,-385
+D8: .data 248,277,462,279,-106,229,-93,-89,-295,-262
+D9: .data 106,220,-440,364,-241,-164,-314,85,-428,68
+S0: .string "kkpdngmemzsudqxy"
+S1: .string "argjdmbkkmmjateh"
+S2: .string "nmin"
+S3: .string "hrurvwdtftykt"
+S4: .string "nbpqfrsqkjwzdopy"
+S5: .string "jyx"
+S6: .string "pypnuyuyrdugphhxqy"
+S7: .string "emvlcucmked"
+S8: .string "qqtoadrsecle"
+S9: .string "twwqohnixturxxnatnn"
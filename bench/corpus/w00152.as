@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r6
+    prn 74
+endmcro
+mcro m1
+    sub @r0, @r7
+    prn 25
+endmcro
+mcro m2
+    sub @r3, @r3
+    prn 89
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 6
+endmcro
+mcro m4
+    sub @r2, @r6
+    prn 61
+endmcro
+add @r3, @r6
+cmp L0, @r6
+add @r5, @r6
+jsr L0
+dec L0
+bne L0
+rts
+not L0
+m1
+lea L0, @r0
+L0: red L0
+mov L0, @r5
+lea L0, L0
+m1
+add -475, L0
+cmp L0, L0
+m0
+bne L0
+bne @r1
+m1
+dec @r5
+not L0
+inc @r1
+sub @r6, @r4
+prn @r5
+prn L0
+mov 319, @r1
+rts
+L1: dec @r5
+jsr @r7
+prn @r4
+mov 111, @r6
+inc @r6
+jsr @r2
+L2: red L2
+m3
+clr L1
+mov @r6, L1
+not L2
+L3: rts
+not @r0
+mov @r3, L43
+jmp L2
+red L3
+red L3
+prn @r0
+not L1
+L4: bne L13
+L5: sub @r4, L1
+bne L46
+add -54, L5
+red @r4
+m2
+rts
+prn @r1
+inc @r6
+red L1
+not @r0
+add S8, L3
+jmp S6
+add 447, L4
+jmp L0
+not L1
+clr @r6
+add @r2, @r4
+jmp @r0
+inc @r6
+mov @r7, @r5
+add L1, @r0
+prn L3
+L6: dec @r7
+clr @r4
+rts
+m2
+prn L1
+mov 295, L2
+jsr L2
+cmp L0, @r4
+m0
+dec L5
+jmp @r4
+m4
+bne L4
+m0
+L7: mov L4, D0
+inc L7
+lea L0, @r3
+m0
+not @r0
+red L4
+jsr @r4
+L8: prn -508
+lea D0, @r3
+L9: clr L0
+m3
+clr L7
+jmp @r0
+jsr @r6
+inc @r1
+lea L1, L5
+dec L4
+clr @r0
+L10: clr @r2
+L11: add 220, @r2
+m4
+add @r3, @r7
+mov @r6, L11
+dec L1
+prn L9
+bne @r5
+L12: prn -18
+red @r1
+dec @r2
+mov 463, @r5
+sub 489, L7
+not @r3
+jsr @r6
+mov @r1, L8
+red L2
+lea L24, L3
+add 494, @r3
+add @r4, L3
+m1
+L13: red @r6
+dec @r3
+bne L8
+rts
+not @r5
+red @r2
+sub L11, L9
+red L9
+jmp @r2
+m1
+sub @r0, L8
+lea L12, L8
+cmp -198, -362
+prn @r7
+cmp 67, @r0
+add L9, L4
+bne L4
+red D0
+cmp L8, L5
+L14: sub 506, L2
+m2
+L15: prn L50
+lea L14, L6
+clr L8
+L16: add -317, @r3
+m3
+mov -296, S6
+jmp L4
+add L1, L6
+sub L14, L15
+sub L10, @r6
+L17: mov @r4, S4
+L18: add @r1, L8
+bne @r4
+L19: mov L5, @r1
+mov -418, L10
+red @r2
+m2
+mov @r3, L15
+L20: mov L3, L5
+cmp -93, @r6
+rts
+lea L7, @r7
+add L3, @r2
+prn 405
+jsr L19
+jsr @r4
+dec @r3
+not L12
+sub 200, @r5
+bne L15
+L21: inc L7
+L22: rts
+prn L11
+m4
+clr @r6
+inc @r6
+L23: clr L37
+sub @r6, L16
+jsr D0
+dec @r2
+sub @r6, @r1
+prn L3
+inc L23
+dec @r4
+sub -187, L16
+mov @r5, @r2
+jsr L1
+mov @r7, @r5
+m1
+clr @r6
+rts
+L24: cmp -241, @r2
+sub @r2, S3
+not @r2
+jsr @r7
+L25: prn L6
+clr @r0
+sub @r6, @r2
+lea L2, L8
+m4
+not L12
+L26: not L1
+bne L9
+L27: sub 390, @r3
+rts
+sub -506, @r1
+dec L23
+clr L0
+jmp L13
+add L16, L19
+rts
+inc @r7
+lea L3, L46
+rts
+inc L16
+red L18
+red L3
+cmp -467, L10
+cmp @r0, @r6
+bne @r3
+rts
+prn -372
+sub -347, X0
+jmp L4
+cmp L18, L2
+L28: jsr @r5
+not @r4
+dec L15
+lea L18, @r2
+L29: rts
+not @r4
+L30: sub L16, @r7
+m0
+prn @r0
+add L23, L24
+mov -45, L4
+L31: rts
+not @r7
+m1
+bne L7
+dec @r3
+red L26
+L32: add L20, @r7
+red L29
+mov 369, @r5
+L33: cmp -441, @r1
+L34: inc @r6
+m3
+lea L20, L34
+prn @r1
+cmp 293, 433
+cmp 509, @r7
+rts
+sub 292, @r0
+mov L12, @r2
+jmp L30
+jsr @r0
+red @r0
+inc L27
+red L34
+lea L4, L24
+dec L3
+clr L6
+m1
+lea L23, @r7
+mov L6, L21
+prn @r4
+add L37, @r4
+L35: rts
+clr X1
+dec L28
+jmp @r3
+inc @r4
+jmp L12
+jsr X2
+lea L10, L25
+m4
+prn L7
+L36: jsr @r3
+rts
+mov -110, L31
+L37: jsr L36
+rts
+dec L7
+m2
+sub 314, L44
+lea L29, S4
+add @r7, L2
+mov 407, @r1
+dec @r4
+L38: not L23
+m0
+add L10, D0
+red D0
+m4
+L39: jsr L13
+L40: jmp L27
+m1
+add @r3, L28
+m2
+inc @r3
+jsr L14
+bne L10
+rts
+rts
+clr L25
+L41: sub L25, L17
+red @r1
+not @r0
+m1
+L42: rts
+L43: inc L24
+clr L10
+clr L26
+clr @r4
+bne @r5
+bne L34
+L44: red @r2
+m3
+L45: cmp @r5, @r4
+inc @r2
+jmp L45
+L46: rts
+m0
+inc @r7
+sub L13, D0
+lea L29, @r4
+L47: red @r4
+lea L40, @r7
+inc @r4
+sub @r5, @r0
+cmp L28, -342
+L48: add 33, L59
+jmp L45
+cmp @r1, -232
+prn 231
+mov L45, @r1
+jsr @r2
+prn L16
+m1
+not L29
+L49: jmp L16
+lea L49, L10
+cmp L14, L12
+sub -189, L47
+L50: clr L13
+add -266, L57
+rts
+mov @r3, @r0
+prn 116
+lea L6, L14
+inc L18
+m1
+jsr @r0
+not L5
+L51: clr @r4
+jsr @r7
+dec @r0
+dec @r4
+sub 139, @r7
+mov @r4, L35
+sub 378, @r4
+jsr L49
+L52: not L47
+jmp L58
+sub @r4, L14
+dec L13
+dec @r7
+red L7
+add @r0, @r7
+L53: jmp L46
+L54: mov D0, @r3
+L55: cmp @r0, @r4
+prn L24
+prn 137
+inc L0
+jsr L5
+bne @r3
+clr L6
+inc L6
+red @r4
+m4
+add L30, L46
+clr L25
+add 282, L25
+jmp @r6
+jsr @r7
+cmp L59, -99
+jsr L37
+rts
+not S8
+L56: cmp 439, @r5
+not L56
+dec @r0
+inc L20
+bne @r5
+L57: inc @r0
+red L52
+sub @r4, @r7
+add @r6, @r5
+bne @r1
+m4
+inc D0
+sub L22, S0
+mov 255, X3
+add L56, L34
+rts
+L58: inc D0
+jmp D0
+lea S1, @r5
+clr X4
+bne L33
+m4
+inc @r0
+inc L59
+jsr @r6
+jmp @r4
+m4
+prn @r6
+rts
+red L41
+not @r4
+bne L59
+lea L23, @r5
+sub 412, @r0
+cmp @r5, @r2
+inc L55
+prn S7
+rts
+not @r1
+mov @r6, L0
+L59: dec @r1
+clr S6
+bne D0
+red S5
+cmp S5, L26
+stop
+D0: .data 190,-187,21,-319,62,-318,209,-488,-414,-263
+D1: .data 275,227,372,336,-479,167,-151,76,-94,315
+D2: .data -444,15,-35,226,-249,-190,42,-331,409,-355
+D3: .data 342,35,135,-5,439,266,-488,-146,-219,-362
+D4: .data -39,142,-490,322,-128,-82,-479,123,-213,351
+D5: .data -347,307,-25,-393,332,436,-372,452,-495,-163
+D6: .data -487,96,-421,-144,-217,425,-385,-176,464,-322
+D7: .data -472,111,248,-59,-424,241,-116,-497,489,-135
+D8: .data 35,14,-135,32,351,-372,77,-496,252,359
+D9: .data -360,-361,241,-17,-26,63,-288,-296,201,-220
+S0: .string "khfzfxl"
+S1: .string "pdld"
+S2: .string "ai"
+S3: .string "oizmfyhmvyaxoivq"
+S4: .string "uhqrybbnxqqkdstunysl"
+S5: .string "qtshavqm"
+S6: .string "hpismh"
+S7: .string "lkjdkm"
+S8: .string "usbjxpmk"
+S9: .string "kjvkv"
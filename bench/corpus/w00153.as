@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r0
+    prn 13
+endmcro
+mcro m1
+    sub @r4, @r0
+    prn 23
+endmcro
+mcro m2
+    sub @r5, @r1
+    prn 55
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 83
+endmcro
+mcro m4
+    sub @r4, @r4
+    prn 85
+endmcro
+cmp -425, L0
+red L0
+lea L0, @r1
+mov D0, L0
+L0: cmp @r5, @r7
+cmp L0, @r4
+bne @r2
+bne @r6
+prn L0
+m1
+clr @r1
+inc L0
+bne L0
+prn L0
+rts
+cmp 38, 158
+m3
+sub L0, @r5
+L1: jmp @r7
+m1
+L2: sub 119, @r6
+not @r4
+red L14
+rts
+bne L46
+L3: dec D0
+prn @r3
+L4: cmp -191, @r7
+m4
+inc L2
+L5: add @r4, L3
+red @r2
+red @r6
+clr L2
+not @r0
+jmp @r4
+bne L0
+lea L3, L0
+cmp -447, @r2
+rts
+rts
+dec @r0
+L6: inc L2
+m2
+clr L3
+inc @r1
+prn -258
+bne L6
+dec S8
+lea L1, @r4
+L7: inc @r5
+jsr L0
+not L1
+jsr @r3
+L8: lea L3, L1
+clr @r4
+dec @r6
+red L1
+L9: mov L4, @r0
+m4
+red L6
+m4
+not S1
+bne @r3
+jmp L0
+red @r7
+rts
+sub L8, @r4
+L10: prn L9
+mov L5, @r3
+m4
+not @r1
+clr @r4
+inc @r6
+mov 366, @r5
+dec L1
+dec @r0
+m3
+mov @r4, L5
+cmp L1, @r5
+bne @r7
+inc L1
+rts
+mov @r0, L7
+L11: cmp L4, L8
+not @r0
+sub L9, @r2
+sub @r3, L9
+dec L2
+L12: not L2
+mov L1, L1
+cmp -168, @r0
+add @r7, X0
+red L2
+add -208, @r5
+not L50
+rts
+m1
+sub 372, L8
+sub 322, @r7
+inc L45
+red L1
+L13: mov L1, @r6
+red @r6
+jmp L1
+inc L12
+sub L10, L9
+inc @r5
+jsr @r1
+sub L0, @r1
+sub @r5, S7
+mov L7, @r1
+L14: dec @r1
+mov @r3, @r3
+L15: red @r0
+lea L14, L14
+red @r0
+m3
+add @r2, L0
+cmp L12, @r5
+not @r2
+inc @r0
+inc @r7
+red @r6
+cmp -390, L4
+jsr @r7
+not L3
+m0
+L16: prn L1
+dec L16
+mov 66, @r4
+prn L10
+m1
+jsr @r4
+lea L16, L4
+clr L16
+dec @r4
+jmp L0
+red L15
+jsr @r4
+prn @r1
+jsr L37
+jsr L14
+sub L6, @r3
+bne L0
+L17: not @r1
+m2
+cmp L1, D0
+not @r6
+dec @r2
+L18: sub @r0, @r7
+clr @r1
+sub 325, @r5
+cmp -16, @r4
+L19: rts
+m3
+inc @r7
+mov 132, L6
+mov @r0, @r2
+add L17, @r5
+mov L2, @r0
+cmp -508, L2
+not L11
+bne @r2
+sub -131, @r4
+prn @r5
+L20: bne L20
+L21: not @r1
+L22: inc L12
+jsr @r2
+sub -27, L4
+dec @r6
+rts
+dec @r1
+sub L8, @r1
+L23: not @r1
+sub 471, L21
+inc @r6
+jmp L23
+m3
+not L7
+bne @r4
+red L17
+sub L8, L51
+red L18
+jsr L2
+lea D0, L2
+L24: lea L23, @r6
+dec L11
+add -156, @r5
+L25: red L21
+jsr L17
+L26: red L25
+red @r4
+mov @r0, L15
+add L17, L5
+rts
+bne L17
+clr L2
+cmp L29, 314
+m2
+sub -162, @r1
+not L2
+not @r4
+m4
+rts
+jsr @r6
+clr S7
+bne L6
+not L15
+jmp @r5
+mov @r2, @r3
+jsr @r2
+add @r0, @r7
+clr L4
+add @r6, L1
+L27: not @r1
+jmp @r5
+prn @r6
+jmp @r2
+L28: lea L27, @r6
+clr L24
+inc L2
+add @r1, L2
+jmp L13
+mov 412, L8
+not L14
+rts
+sub -232, @r3
+inc L22
+mov -291, @r6
+lea L18, L14
+prn L25
+jsr @r7
+m1
+clr L23
+L29: jsr L2
+sub @r2, L28
+inc @r3
+not L26
+m2
+L30: cmp 123, L0
+inc @r2
+bne L7
+bne L1
+mov L10, L19
+L31: inc L15
+sub 414, @r0
+L32: inc @r5
+lea L11, @r5
+inc L15
+rts
+dec @r7
+mov @r2, L4
+dec @r7
+cmp @r0, @r1
+lea L24, L10
+L33: not L31
+L34: jsr @r7
+sub @r0, @r5
+rts
+red @r7
+dec L2
+cmp L34, L18
+sub @r3, @r7
+prn -118
+add L25, L17
+bne @r7
+lea L21, @r0
+red L34
+L35: mov -325, @r6
+add L4, L28
+add L10, @r1
+jsr L28
+sub @r7, L1
+bne @r3
+bne L35
+red @r4
+L36: inc @r3
+sub @r7, @r7
+jmp L13
+sub 232, @r0
+L37: lea L24, @r5
+red @r5
+bne @r3
+prn L36
+dec L8
+jmp @r5
+jmp L7
+mov -31, @r3
+L38: clr L25
+rts
+dec @r7
+mov -303, @r6
+mov 437, L25
+prn @r2
+lea L23, L37
+m4
+lea S2, @r5
+m3
+clr L16
+sub -92, @r1
+L39: cmp @r1, -47
+clr L27
+sub @r5, @r0
+bne @r2
+dec L25
+red @r5
+L40: add @r1, L39
+clr D0
+m2
+L41: sub L20, @r0
+rts
+m1
+inc @r7
+rts
+jsr @r7
+rts
+jsr @r3
+L42: red @r7
+m3
+clr L16
+lea L34, L47
+inc @r0
+cmp L23, L15
+bne L41
+m4
+lea L38, L3
+L43: bne @r4
+inc L7
+sub @r7, X1
+mov L4, @r7
+m3
+dec @r2
+not @r6
+add @r7, @r0
+mov @r3, @r3
+not L25
+add 337, @r6
+cmp -483, L1
+dec @r6
+add L6, @r1
+mov L23, L5
+m3
+prn @r0
+sub 29, @r3
+red L53
+m0
+red @r6
+lea L33, S7
+rts
+jsr @r1
+L44: jmp @r0
+mov @r3, L0
+not L9
+sub 427, @r7
+add -444, @r3
+jsr L13
+jmp L36
+rts
+m2
+prn -485
+jsr L26
+bne @r3
+m2
+not @r1
+dec L24
+prn @r3
+m1
+L45: dec L1
+mov L26, @r4
+jmp @r2
+add @r0, L7
+dec @r1
+bne @r6
+inc @r0
+red @r6
+L46: cmp -397, L4
+inc @r0
+red S5
+rts
+m1
+L47: jsr L54
+rts
+m3
+L48: sub L45, @r1
+dec S6
+m1
+m4
+jmp L50
+L49: dec @r1
+red @r0
+m1
+m4
+sub @r0, L20
+jmp @r6
+L50: rts
+L51: rts
+L52: mov @r1, @r5
+red @r6
+L53: clr L59
+inc @r6
+inc @r1
+m2
+inc @r1
+lea L8, @r5
+lea L53, @r0
+rts
+mov -331, @r4
+bne @r1
+not @r6
+sub @r1, @r1
+cmp L20, @r3
+prn @r0
+inc @r5
+L54: sub L54, L24
+red X2
+cmp @r5, @r6
+jsr @r0
+dec @r4
+red S6
+sub L58, L55
+L55: red S7
+not L58
+L56: rts
+mov D0, S0
+add -250, @r1
+L57: add @r0, D0
+prn L58
+jsr L33
+inc L59
+red S5
+m0
+inc @r2
+L58: rts
+bne X3
+L59: dec S0
+mov S7, X4
+mov S4, L16
+red D0
+stop
+D0: .data -365,-337,-460,315,462,-27,83,492,-72,3
+D1: .data -423,-356,70,-155,-286,52,-263,121,285,463
+D2: .data -174,428,-118,-399,-482,222,-388,50,-169,215
+D3: .data -202,126,281,396,-390,377,-251,386,428,-308
+D4: .data -193,144,-443,-314,396,142,-50,264,-204,-88
+D5: .data 332,19,364,-93,-288,268,111,-309,101,410
+D6: .data 18,121,-24,292,-268,365,-295,23,351,-326
+D7: .data 152,468,91,-340,-304,-423,-480,254,-105,448
+D8: .data -165,-219,-459,-174,116,120,426,141,452,115
+D9: .data -59,-205,-337,-261,376,-289,-415,-465,118,88
+S0: .string "aogrmdzcchqfo"
+S1: .string "kieyqlivg"
+S2: .string "xbgmuwclvmdx"
+S3: .string "hqfejhgamnzdhicsloa"
+S4: .string "yiycvk"
+S5: .string "zsbiadpbdoneedjqk"
+S6: .string "payzptknn"
+S7: .string "kbwhjlxfgdgmkkcdch"
+S8: .string "g"
+S9: .string "coirvhl"
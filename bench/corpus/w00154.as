@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r3
+    prn 83
+endmcro
+mcro m1
+    sub @r1, @r1
+    prn 22
+endmcro
+mcro m2
+    sub @r7, @r7
+    prn 20
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 59
+endmcro
+mcro m4
+    sub @r7, @r2
+    prn 9
+endmcro
+clr L0
+not L0
+bne @r0
+red L0
+cmp @r7, @r1
+rts
+rts
+m1
+rts
+inc @r5
+m1
+cmp @r7, -8
+mov -50, @r4
+m2
+red L0
+not @r4
+dec @r3
+jsr @r7
+clr @r3
+L0: inc @r1
+add L0, @r7
+mov 475, @r2
+dec L0
+L1: not @r3
+add L0, @r6
+bne @r5
+sub @r3, L1
+sub @r1, @r0
+not L1
+not @r6
+jmp @r2
+jmp @r6
+L2: jsr L0
+dec L1
+m3
+prn S7
+cmp -419, 153
+mov @r1, L1
+lea L0, L1
+cmp L1, @r4
+bne L36
+inc @r3
+jmp @r7
+m2
+not @r3
+sub @r7, @r4
+bne L1
+red @r4
+red @r6
+jmp @r3
+clr L0
+red L0
+L3: jmp @r4
+jsr @r2
+prn @r0
+m4
+L4: lea L4, L3
+m4
+L5: cmp @r7, D0
+jmp L2
+bne L4
+sub @r6, @r5
+jmp @r1
+jmp L1
+prn @r2
+bne L5
+not L43
+clr @r5
+inc L5
+mov L4, L4
+not @r4
+m1
+inc L2
+sub 116, @r1
+m3
+lea L0, L4
+clr L3
+rts
+inc L49
+red L0
+m4
+sub -71, L3
+prn L2
+L6: jmp @r0
+lea L3, D0
+m1
+clr @r5
+inc @r0
+jmp L20
+jsr @r6
+L7: lea L3, @r5
+sub -2, L3
+mov L0, @r2
+add @r2, @r1
+dec L1
+red L57
+dec L43
+not @r7
+cmp @r0, L7
+L8: jsr L37
+prn L3
+dec L1
+L9: jmp @r7
+sub L9, @r1
+m1
+not L8
+dec @r2
+rts
+inc L9
+inc @r4
+jsr L5
+red @r4
+clr L9
+jsr @r2
+rts
+rts
+dec @r7
+m4
+inc @r4
+jmp L9
+not @r2
+not L9
+prn L5
+L10: add -315, @r1
+m0
+m4
+rts
+mov @r5, @r4
+clr @r7
+not @r0
+jsr @r1
+m1
+jsr L3
+add L9, @r7
+inc @r3
+m4
+clr @r6
+sub -358, L2
+red @r7
+lea L8, L8
+L11: dec L5
+rts
+jsr L0
+jsr L11
+L12: jsr @r0
+add -233, L3
+clr L12
+cmp @r0, L7
+jmp @r3
+clr @r4
+jsr @r5
+lea L12, L9
+mov @r7, @r6
+red @r1
+inc L7
+jmp @r0
+L13: prn @r3
+mov L1, @r2
+jsr L0
+prn -180
+rts
+red @r2
+L14: red L8
+rts
+clr L13
+L15: not @r5
+jsr @r6
+add L10, @r3
+inc L13
+jsr L2
+jsr L10
+L16: jmp @r5
+clr @r4
+rts
+jsr @r7
+bne L3
+clr @r1
+mov L49, @r0
+inc @r1
+sub 448, L12
+L17: cmp -116, L13
+m4
+prn -504
+L18: red L2
+red L17
+L19: prn -99
+add @r7, @r6
+L20: red @r0
+clr L9
+lea L19, @r6
+not @r7
+add L13, @r1
+dec L19
+m1
+mov -318, L18
+lea L19, @r2
+inc L2
+mov -352, L12
+bne @r7
+jsr @r4
+L21: rts
+clr @r3
+jsr L21
+red @r5
+sub 13, @r3
+red L47
+lea L9, L21
+mov 194, L15
+cmp L19, L14
+prn @r4
+bne @r2
+red @r4
+sub @r6, L9
+red @r4
+not @r3
+L22: jsr L8
+m4
+jmp L17
+red L58
+prn S9
+sub L40, L12
+red @r5
+m1
+cmp @r7, 100
+red @r1
+lea L28, @r3
+sub @r2, D0
+not @r3
+prn 275
+m2
+jsr @r5
+clr L6
+m2
+sub L20, L16
+not @r6
+L23: bne @r5
+L24: jmp @r7
+red L6
+m2
+mov 502, L16
+add -237, L8
+clr L16
+sub L23, @r5
+clr L20
+L25: prn @r3
+jsr L16
+bne @r1
+red @r7
+add L21, L19
+bne L17
+red L7
+add @r7, L23
+jsr @r5
+L26: inc L17
+L27: mov L9, L0
+dec L24
+sub @r6, S6
+L28: mov @r5, L13
+jmp L5
+clr @r3
+clr @r0
+dec L5
+m3
+inc @r1
+red L15
+L29: clr L17
+sub -309, L8
+jmp L16
+lea L27, @r7
+L30: jsr @r4
+L31: add @r7, L29
+add L21, @r5
+m1
+jsr L19
+inc @r6
+rts
+L32: bne @r4
+lea L32, @r1
+jsr L29
+sub @r0, @r2
+L33: lea L2, L53
+prn @r7
+L34: not L23
+mov L14, @r7
+prn @r3
+jsr @r6
+add -251, D0
+m0
+bne @r5
+mov L12, L32
+bne @r5
+mov L31, L34
+jsr @r2
+inc L33
+jmp @r0
+jsr @r6
+dec L28
+add X0, L1
+L35: jsr L24
+sub 161, L26
+mov X1, L26
+m2
+m3
+lea L25, @r6
+L36: sub L27, L19
+L37: cmp S2, L28
+L38: cmp -145, @r3
+L39: jmp S6
+not L28
+L40: jmp @r0
+clr @r5
+prn L50
+L41: bne @r1
+L42: inc L55
+L43: inc L36
+not @r7
+L44: jsr L0
+clr @r7
+not L29
+L45: lea L0, @r5
+clr @r7
+mov 119, @r3
+sub @r3, L18
+inc @r0
+red L33
+jsr @r3
+dec @r6
+prn L44
+bne L55
+m1
+mov L32, @r5
+not L48
+add -156, @r1
+L46: bne L21
+m2
+prn @r1
+add @r2, L33
+m1
+jsr L46
+L47: prn L2
+add -210, L48
+rts
+L48: sub 478, @r2
+cmp @r4, -194
+prn -504
+dec L20
+inc L7
+dec L32
+rts
+m2
+clr @r0
+L49: sub L52, S1
+inc L42
+sub -9, @r3
+m0
+mov @r3, @r4
+clr @r3
+red @r3
+m4
+lea L43, @r4
+bne L54
+jmp L36
+m4
+m3
+rts
+not @r4
+sub -224, @r1
+L50: mov -489, L22
+dec L4
+sub L28, L30
+jmp @r1
+jmp @r2
+add L4, L30
+m3
+prn @r1
+jmp @r6
+jmp S8
+lea L5, @r6
+cmp L38, @r4
+bne L11
+add @r2, @r3
+rts
+sub L31, L46
+sub 131, @r6
+cmp @r1, @r4
+lea L13, @r7
+m0
+mov S4, @r4
+not L2
+m2
+red L26
+bne @r3
+lea L36, @r2
+prn L37
+prn @r2
+bne @r3
+L51: not @r7
+L52: red L7
+add -310, L23
+add -485, L4
+L53: dec D0
+lea X2, L1
+inc L27
+rts
+lea L9, L4
+cmp L49, -115
+L54: sub L27, @r2
+inc L29
+L55: rts
+dec L40
+add L23, @r6
+jmp L8
+jsr L25
+sub @r4, L49
+prn L44
+mov 244, X3
+mov L59, L40
+red @r0
+sub 509, L2
+clr @r4
+prn @r4
+L56: jsr L17
+L57: red @r5
+rts
+red S6
+bne @r1
+jmp X4
+L58: mov @r0, @r7
+prn @r2
+prn @r7
+bne @r2
+cmp L59, @r6
+not @r7
+jmp L55
+jsr @r1
+mov L57, @r3
+L59: jsr S0
+jsr D0
+not D0
+sub D0, L18
+stop
+D0: .data -150,444,-450,-90,11,223,-316,-100,-67,-171
+D1: .data -60,267,-115,-254,-469,-371,-448,-110,441,-454
+D2: .data -159,450,318,-203,-3,-283,-44,-114,-379,318
+D3: .data -320,-184,327,427,373,-48,243,-423,322,170
+D4: .data -401,69,440,-400,300,-283,-50,-427,-136,-215
+D5: .data -234,460,50,-399,131,5,-6,383,264,-392
+D6: .data -207,-221,-15,474,227,457,482,-84,-483,-264
+D7: .data -297,342,-447,51,69,-402,353,-38,273,-89
+D8: .data -457,-352,-272,-365,-499,-249,-252,-449,-390,-147
+D9: .data -307,-180,251,-380,114,-151,-141,-328,238,262
+S0: .string "qjtreukoidfxct"
+S1: .string "wtxmzwvykjx"
+S2: .string "bjgcwzrehplt"
+S3: .string "ymrmyntamhymtudar"
+S4: .string "lq"
+S5: .string "q"
+S6: .string "ingihbfcckrhhktv"
+S7: .string "tqlr"
+S8: .string "sxkhokiy"
+S9: .string "tqvl"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r6
+    prn 21
+endmcro
+mcro m1
+    sub @r5, @r2
+    prn 88
+endmcro
+mcro m2
+    sub @r1, @r5
+    prn 85
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 4
+endmcro
+mcro m4
+    sub @r1, @r1
+    prn 34
+endmcro
+prn L0
+mov D0, L0
+red L0
+not @r3
+jsr @r7
+clr L0
+cmp L34, 54
+bne @r2
+inc @r5
+L0: jmp @r6
+m1
+jsr L0
+clr @r0
+jmp L0
+rts
+cmp L0, L0
+rts
+jmp L0
+bne @r6
+L1: rts
+bne L0
+mov 308, L26
+jsr L1
+lea L0, @r3
+dec @r1
+sub -54, @r1
+rts
+clr @r2
+prn @r0
+m1
+sub -508, @r1
+mov -99, L1
+m3
+mov @r3, @r6
+jsr @r5
+L2: sub L1, L1
+add 429, @r3
+rts
+clr L0
+sub @r3, L2
+rts
+not @r5
+clr @r3
+dec L1
+dec @r2
+inc L1
+cmp @r0, @r7
+rts
+L3: clr L0
+dec @r7
+inc L3
+m0
+m0
+mov 221, L2
+prn 371
+inc @r7
+m1
+sub L2, @r3
+cmp -311, @r1
+bne L0
+inc D0
+add @r4, @r5
+inc L0
+bne L1
+mov -87, L2
+not L0
+red @r1
+dec @r4
+m4
+dec @r7
+sub -110, @r1
+dec L1
+jmp L2
+inc L3
+inc L2
+prn @r7
+bne X0
+sub @r1, @r4
+prn L1
+lea L31, L1
+mov L2, @r2
+inc @r3
+mov 111, @r5
+add @r7, @r2
+not L1
+cmp @r4, -486
+L4: inc L1
+rts
+mov -92, @r4
+not @r2
+cmp @r3, L4
+inc L4
+m1
+bne L1
+not L4
+inc L3
+not L4
+m1
+bne @r3
+add L4, @r7
+cmp @r0, @r4
+inc L2
+jsr L4
+jsr @r7
+L5: red L5
+L6: sub L3, @r0
+L7: bne L30
+jsr @r4
+bne @r6
+L8: rts
+dec @r1
+lea L2, L2
+L9: bne L2
+jmp L54
+mov L46, @r2
+rts
+L10: prn @r7
+not @r6
+bne L4
+jsr @r4
+cmp -119, L0
+cmp 78, @r4
+clr L3
+mov @r0, @r5
+clr L25
+red L2
+m2
+clr @r2
+add @r7, @r1
+jsr L1
+L11: inc @r4
+clr L7
+sub L6, L0
+mov 194, L10
+not L25
+bne @r4
+not @r0
+inc L9
+L12: dec L8
+clr @r0
+dec L0
+jsr @r6
+sub @r6, @r7
+jsr @r6
+m3
+L13: bne @r1
+clr L1
+red @r6
+clr L7
+rts
+L14: mov L6, L14
+jsr L7
+m1
+prn @r6
+dec @r7
+L15: lea L8, L12
+m2
+mov -189, L11
+dec L7
+bne L9
+lea L6, D0
+m2
+inc L8
+m1
+jsr @r0
+jsr @r1
+m0
+bne L15
+mov L31, L14
+jmp L15
+add -105, L2
+L16: mov @r0, L3
+L17: inc @r3
+bne L10
+red @r1
+L18: clr @r1
+rts
+prn 10
+add -434, L8
+L19: rts
+inc @r4
+not L14
+jsr L17
+red L54
+m3
+not L9
+L20: jmp @r6
+prn L20
+cmp @r4, L9
+cmp L11, 253
+m3
+lea L10, @r7
+m4
+sub @r1, L13
+cmp -442, L3
+inc L57
+sub -293, L6
+clr @r5
+prn @r0
+bne @r2
+L21: jsr @r1
+cmp @r5, @r6
+lea L15, S6
+dec L0
+add -212, L1
+not X1
+not L2
+L22: inc L16
+prn @r7
+rts
+mov L6, L0
+inc L13
+jmp @r4
+not L14
+add @r1, L0
+cmp -50, 39
+bne @r7
+clr L7
+mov 362, @r4
+mov L6, L0
+sub -368, @r3
+lea L18, L8
+prn @r4
+prn L9
+rts
+lea L9, L4
+m3
+m3
+sub -104, L4
+not L6
+m2
+jmp L12
+cmp @r5, L15
+m1
+sub S3, L7
+m3
+add L15, L20
+mov L19, @r0
+add 40, L20
+L23: inc @r4
+L24: add @r4, @r0
+lea L13, L20
+rts
+L25: bne @r5
+m0
+L26: jmp @r7
+m2
+mov L22, L47
+L27: add 39, @r0
+not L16
+clr L8
+L28: bne @r5
+bne @r4
+jsr L11
+jmp L24
+dec @r5
+clr L25
+sub -487, @r4
+mov L13, @r7
+jsr L8
+clr @r6
+m1
+jsr L24
+bne L19
+rts
+dec @r5
+inc L5
+jsr L25
+mov 486, L10
+m2
+m1
+dec L9
+clr @r7
+m4
+dec @r7
+red @r7
+rts
+L29: jmp @r7
+jsr L18
+rts
+L30: cmp @r6, -160
+dec @r5
+bne @r0
+rts
+clr @r1
+bne @r4
+L31: red L3
+m0
+jsr @r6
+add L29, @r4
+clr L9
+m4
+lea D0, L19
+jmp L25
+sub @r5, @r2
+mov L21, L31
+sub L58, L13
+clr L28
+dec L39
+jsr L0
+L32: rts
+not @r4
+bne L15
+mov @r5, @r4
+bne L20
+red @r1
+red @r5
+mov @r4, @r5
+L33: not @r5
+sub -371, L3
+clr @r6
+rts
+L34: bne @r5
+red @r7
+clr @r6
+dec @r0
+inc @r0
+rts
+L35: sub D0, L34
+m2
+inc L35
+jmp @r6
+L36: dec @r3
+dec @r4
+prn L23
+jmp L22
+prn -477
+cmp L19, L25
+add L4, @r1
+m3
+L37: clr L16
+jmp L30
+clr @r0
+not @r3
+rts
+not @r5
+not @r6
+lea L5, L11
+L38: jmp L25
+bne L11
+L39: inc L16
+L40: jsr L16
+add -46, L40
+mov L9, L8
+clr @r1
+L41: red S6
+clr @r4
+sub -146, L49
+inc @r5
+L42: mov @r2, L29
+inc @r6
+sub L23, @r2
+prn L42
+mov -438, D0
+inc @r1
+jmp @r3
+dec @r7
+prn -102
+cmp -70, @r4
+red @r3
+not @r5
+jmp L41
+inc @r4
+add -51, L17
+clr L35
+red @r0
+red L35
+m3
+add @r0, L2
+dec L28
+prn 24
+clr @r3
+not @r2
+sub @r7, L21
+L43: rts
+L44: cmp 109, L31
+sub -198, @r5
+L45: dec L6
+mov L25, X2
+add L44, @r4
+not @r4
+sub -441, D0
+L46: rts
+cmp @r4, 69
+sub @r5, L25
+prn L37
+mov -510, @r3
+jsr @r1
+cmp @r3, L12
+m2
+mov L43, @r7
+add 15, @r0
+jmp L42
+add L27, @r1
+m4
+bne @r2
+L47: rts
+cmp 374, L44
+inc @r2
+L48: not @r5
+prn @r3
+not @r7
+bne L35
+m1
+bne @r1
+m4
+red @r3
+jsr @r6
+lea L13, S5
+L49: red @r0
+inc @r1
+mov @r0, @r5
+L50: not L57
+jmp @r1
+mov L51, L16
+inc @r3
+cmp 174, @r5
+L51: jsr S1
+red S4
+cmp L59, @r7
+L52: not L11
+jmp L47
+jsr @r5
+L53: jsr L29
+rts
+L54: sub @r0, L55
+dec @r7
+L55: prn @r7
+bne @r0
+L56: inc D0
+L57: sub 10, @r5
+clr X3
+L58: cmp D0, @r0
+L59: prn S8
+not S0
+add S1, D0
+dec @r6
+m0
+prn D0
+prn X4
+stop
+D0: .data 141,45,-329,188,-308,481,-351,-69,-225,395
+D1: .data 228,-267,-232,-289,-351,-280,-23,-421,14,-116
+D2: .data 58,-379,-85,-495,-10,-43,-167,334,469,410
+D3: .data 303,-445,133,96,-106,-33,370,-191,-156,118
+D4: .data -147,-16,1,286,400,-357,277,-25,314,-160
+D5: .data 405,324,209,37,466,-23,472,-123,222,102
+D6: .data 493,-422,222,-263,214,73,-303,-182,141,298
+D7: .data 214,334,-162,-131,107,452,89,-422,-12,412
+D8: .data 157,229,-367,-498,-46,-193,-425,-302,57,91
+D9: .data -442,-181,-295,-428,-405,128,-258,306,-314,485
+S0: .string "lurmojbtwmgdohhfqgv"
+S1: .string "fntjqlobt"
+S2: .string "dmgwekhvyhfcggpcau"
+S3: .string "viplbmzgkparqfwirzv"
+S4: .string "cvjdqxruwc"
+S5: .string "uoeropnoicblvtsrnyuo"
+S6: .string "fo"
+S7: .string "yoytvkzniurqpsrif"
+S8: .string "zjquyaaqqakigreuurqq"
+S9: .string "aqbcfoqsuxckyy"
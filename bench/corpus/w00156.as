@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r0
+    prn 91
+endmcro
+mcro m1
+    sub @r2, @r4
+    prn 87
+endmcro
+mcro m2
+    sub @r3, @r2
+    prn 51
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 80
+endmcro
+mcro m4
+    sub @r3, @r7
+    prn 90
+endmcro
+add -271, L0
+rts
+prn L0
+L0: sub @r6, L0
+jmp L0
+jsr L0
+m2
+jsr X0
+jmp @r1
+m4
+clr @r7
+jmp L0
+jmp @r3
+cmp @r6, -315
+mov -367, @r7
+inc @r2
+m4
+sub @r3, @r0
+dec @r3
+rts
+dec @r7
+cmp -412, @r6
+m3
+L1: cmp -438, L1
+m2
+prn 258
+L2: rts
+mov -468, @r3
+inc L0
+inc L0
+jmp L2
+rts
+clr @r4
+lea L0, @r4
+red L2
+L3: clr L0
+red @r1
+L4: red @r7
+sub @r0, @r3
+clr @r2
+cmp 31, -280
+red L3
+cmp L4, @r1
+mov L2, @r4
+not L0
+jsr D0
+dec @r3
+L5: bne @r7
+m2
+prn -227
+jsr @r2
+mov -398, @r5
+m0
+L6: jmp L0
+add @r4, L2
+lea L6, @r0
+rts
+jmp @r4
+L7: clr L0
+bne @r3
+L8: inc L6
+prn @r0
+dec @r6
+m4
+dec D0
+not L8
+m0
+jmp @r3
+bne L1
+clr @r5
+clr L0
+L9: rts
+mov @r5, L0
+red @r3
+L10: rts
+add -319, @r1
+add -222, @r7
+L11: rts
+L12: bne L11
+mov L34, @r5
+lea L3, @r4
+bne L1
+jmp L4
+L13: bne @r7
+jsr L12
+L14: bne @r3
+inc L2
+L15: prn -425
+mov L7, @r7
+not @r6
+cmp @r6, L6
+rts
+inc L6
+rts
+inc @r2
+jsr @r0
+jmp L6
+inc L4
+inc @r6
+inc @r5
+lea L11, L3
+jsr @r7
+red @r4
+jsr @r2
+m1
+dec @r2
+cmp @r2, 60
+not L0
+lea L7, D0
+lea L12, @r4
+lea L1, @r3
+inc L4
+cmp -111, L6
+lea L3, L8
+inc L39
+bne L15
+L16: sub @r0, L15
+sub @r4, L16
+inc L10
+sub -86, @r5
+inc @r1
+clr @r4
+bne L7
+cmp L6, @r7
+L17: clr @r5
+mov L3, @r6
+not L10
+m0
+rts
+jsr @r0
+m4
+lea L15, L17
+clr @r7
+bne @r5
+L18: lea L5, D0
+inc L2
+cmp 384, 72
+red L12
+clr L58
+rts
+L19: bne L7
+jmp L8
+m4
+jmp L15
+prn L10
+add L14, D0
+bne @r2
+not L5
+cmp 242, 288
+mov @r2, L6
+jsr L15
+sub @r3, L19
+prn S7
+jmp L17
+lea L17, L1
+jmp L8
+red @r7
+inc @r1
+lea L16, L6
+sub -373, L11
+L20: mov @r7, @r3
+dec L13
+m0
+clr @r4
+m1
+prn @r2
+not @r4
+jsr @r5
+mov @r1, S9
+rts
+red @r1
+not @r1
+not @r5
+m3
+L21: cmp L0, @r2
+dec L19
+red D0
+cmp L2, L19
+bne @r2
+L22: bne L6
+m0
+clr @r1
+clr @r1
+jmp L10
+cmp @r4, L17
+not @r4
+not @r2
+L23: bne @r3
+cmp @r7, @r1
+prn -9
+L24: not L24
+add L2, @r6
+m3
+m2
+L25: cmp 62, L3
+not L18
+add 111, @r0
+mov @r2, @r5
+dec @r2
+cmp @r0, -477
+L26: jmp L12
+L27: sub -384, L12
+L28: mov 149, L22
+jmp L10
+rts
+jsr L16
+jmp @r5
+add -291, @r1
+bne @r6
+prn 159
+lea L13, @r0
+sub -41, L20
+L29: red L9
+jsr @r4
+m1
+rts
+jsr L10
+lea D0, L8
+jmp @r4
+not @r3
+rts
+mov @r1, @r1
+sub @r5, L3
+rts
+red @r7
+lea L8, @r0
+sub @r3, @r6
+prn @r0
+red L4
+jsr @r2
+m2
+m1
+inc @r4
+rts
+bne L47
+not @r1
+not L52
+inc L7
+m4
+bne @r3
+bne L15
+dec @r7
+rts
+L30: inc @r3
+add 92, @r2
+dec @r2
+m0
+mov -462, L1
+not L18
+bne L11
+red S0
+cmp L12, @r0
+L31: cmp @r1, @r0
+add @r6, L29
+inc L12
+L32: cmp -94, @r2
+clr L23
+clr @r6
+bne L25
+L33: lea L3, @r3
+jmp L8
+prn 94
+prn -180
+L34: bne @r0
+add 48, @r2
+jmp L13
+L35: clr D0
+rts
+rts
+sub -233, @r5
+dec L28
+bne @r3
+L36: jmp @r3
+rts
+L37: red @r1
+red @r1
+inc @r5
+m4
+inc L35
+lea L2, @r2
+inc L30
+lea L5, @r2
+rts
+red L13
+dec @r4
+m4
+jmp @r6
+not @r2
+cmp L32, @r6
+dec L21
+mov L4, @r3
+cmp @r3, -463
+bne L34
+L38: add L18, L22
+bne L56
+rts
+not L14
+lea L51, L1
+jsr @r5
+clr L5
+dec L51
+lea L17, L15
+rts
+inc @r2
+L39: inc @r1
+cmp -498, @r7
+L40: sub L29, L13
+not L29
+L41: sub @r1, L18
+dec L15
+dec @r4
+m1
+L42: rts
+prn @r2
+dec @r2
+add L31, L54
+mov @r4, L2
+L43: sub @r0, L15
+cmp @r2, 33
+add 416, L40
+clr L37
+L44: rts
+sub L3, @r5
+clr L10
+prn @r7
+mov @r1, L36
+prn @r5
+not L4
+mov L57, @r2
+L45: dec @r0
+rts
+L46: prn L2
+cmp -506, @r2
+sub L24, L9
+jmp L52
+dec L40
+L47: add -310, L9
+L48: lea D0, @r2
+L49: prn -466
+m2
+jsr L44
+red @r2
+jsr @r5
+m2
+inc @r2
+m1
+prn L46
+L50: inc L50
+m2
+inc @r7
+bne @r1
+red @r5
+m3
+rts
+jmp L41
+lea L8, @r6
+lea L17, @r1
+mov @r5, L12
+L51: sub @r3, @r1
+bne @r2
+sub @r3, @r1
+dec @r4
+not L11
+m2
+add L39, L13
+inc @r3
+sub -369, L55
+cmp @r1, @r5
+cmp L44, 257
+clr S1
+add 457, @r4
+red L14
+jmp @r7
+lea L15, L39
+inc L36
+jmp @r5
+jmp @r1
+sub L43, X1
+prn 29
+dec L27
+m2
+dec D0
+L52: cmp L16, @r3
+prn L12
+not @r0
+rts
+m4
+prn @r4
+cmp @r3, 448
+clr @r4
+m2
+red @r3
+cmp X2, L8
+dec @r6
+jmp L52
+rts
+bne @r2
+sub @r7, L16
+L53: clr @r7
+bne @r3
+jsr S4
+L54: mov 133, L11
+mov @r2, L2
+L55: rts
+not S2
+jmp L36
+m1
+inc @r2
+red @r5
+L56: prn 424
+jsr @r6
+sub L12, @r4
+clr L4
+cmp L12, L47
+not L0
+add L23, @r5
+sub @r7, @r6
+m1
+red @r1
+L57: dec @r1
+rts
+lea L9, L59
+m4
+prn L59
+not @r6
+m3
+rts
+add @r5, @r2
+prn L59
+L58: red L9
+lea D0, L59
+rts
+rts
+lea L59, S5
+inc L59
+rts
+L59: clr D0
+cmp D0, X3
+jsr D0
+jmp X4
+stop
+D0: .data 277,-490,349,153,-268,30,-435,-125,279,306
+D1: .data 442,83,-103,239,447,205,-325,-358,-183,-279
+D2: .data 356,-260,390,-494,120,324,-309,-349,288,81
+D3: .data 202,-58,-286,-219,-112,-192,340,133,-309,49
+D4: .data 205,-295,-268,-272,-29,-164,-323,-323,254,-418
+D5: .data -373,-234,120,325,-13,-369,132,469,25,430
+D6: .data -432,-101,136,491,335,281,-388,-120,102,88
+D7: .data 229,-264,354,-142,311,-183,-459,-357,-220,-21
+D8: .data 257,-136,-201,-464,-333,90,224,-153,-343,398
+D9: .data -255,-52,-470,127,231,490,55,450,0,132
+S0: .string "vhzcnexgec"
+S1: .string "ymfbyaguubjkcwvhajc"
+S2: .string "xsssmoybb"
+S3: .string "bngibkzpu"
+S4: .string "sjiqgnedegts"
+S5: .string "dbi"
+S6: .string "rplktxdncgfntkjynz"
+S7: .string "uxg"
+S8: .string "m"
+S9: .string "dqgkvitb"
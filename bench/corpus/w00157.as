@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r3
+    prn 30
+endmcro
+mcro m1
+    sub @r6, @r5
+    prn 85
+endmcro
+mcro m2
+    sub @r5, @r0
+    prn 48
+endmcro
+mcro m3
+    sub @r1, @r0
+    prn 56
+endmcro
+mcro m4
+    sub @r5, @r5
+    prn 15
+endmcro
+dec @r0
+cmp -479, @r1
+dec L0
+mov -282, L0
+prn L0
+m4
+add 97, @r4
+jsr @r4
+jmp @r6
+jsr @r1
+rts
+dec L0
+jsr @r1
+jmp @r6
+rts
+m1
+prn L0
+m0
+lea L0, @r7
+red @r1
+clr @r2
+cmp L0, -365
+L0: red L0
+m3
+sub -126, @r2
+clr L0
+m0
+jsr S7
+L1: jmp L0
+L2: not L2
+bne @r5
+red L0
+m4
+L3: dec L2
+not L45
+m3
+m4
+dec L2
+rts
+inc D0
+rts
+not L0
+bne @r5
+dec L1
+clr L1
+bne @r3
+jmp L0
+lea L1, @r6
+L4: mov L4, @r4
+inc @r1
+jmp @r3
+L5: clr L3
+mov 446, L3
+add -234, @r5
+red @r1
+red @r6
+L6: not D0
+inc @r2
+prn @r2
+m4
+red @r3
+cmp @r5, L6
+L7: dec L7
+red @r5
+prn L6
+m4
+add 424, @r5
+jmp L0
+prn @r1
+add 413, @r4
+cmp 62, L7
+mov L6, L5
+sub @r6, @r7
+clr @r5
+m3
+jsr L0
+jsr @r2
+clr L5
+L8: clr X0
+jmp S0
+rts
+not @r2
+m4
+dec L1
+L9: clr L3
+cmp @r6, @r4
+lea L7, @r6
+L10: sub 302, L22
+cmp L6, 323
+jsr L7
+dec L1
+dec D0
+m2
+jmp L2
+m4
+inc D0
+jsr L2
+rts
+bne L0
+L11: lea S7, L11
+cmp D0, L10
+mov @r4, L4
+L12: add @r0, L3
+rts
+add -412, @r6
+L13: inc L6
+red L7
+jsr L6
+L14: inc @r3
+rts
+cmp @r6, @r7
+inc @r1
+inc @r1
+jsr @r4
+add 469, L10
+cmp L7, @r3
+L15: lea L10, @r0
+prn 476
+m0
+mov @r7, D0
+bne @r0
+prn -158
+dec L9
+dec L9
+prn L6
+jmp @r7
+L16: rts
+sub @r2, L4
+rts
+L17: lea L16, @r4
+sub @r6, L11
+red L11
+cmp L17, -246
+red @r4
+bne L5
+mov 183, @r2
+red @r2
+L18: sub 413, @r0
+m0
+clr @r4
+jmp @r2
+inc L15
+sub L5, L43
+lea L3, L14
+L19: clr L9
+L20: cmp 43, L8
+clr @r5
+sub -142, L10
+bne @r1
+not @r7
+inc @r0
+rts
+L21: inc @r5
+not @r0
+jmp @r1
+L22: rts
+mov @r3, L2
+bne L21
+L23: add 46, @r1
+prn @r5
+lea L17, @r3
+L24: jmp @r1
+cmp L13, L15
+jmp L5
+red @r3
+not @r5
+mov @r6, L16
+jmp L21
+inc L14
+lea D0, @r5
+prn -300
+sub @r5, @r5
+jsr L14
+add @r1, @r3
+inc @r0
+rts
+red L21
+lea L10, @r3
+jmp @r4
+lea L4, L4
+mov X1, X2
+jmp L23
+prn @r0
+lea L2, @r6
+bne L12
+rts
+L25: red L4
+add @r2, X3
+rts
+clr L7
+rts
+sub 134, @r5
+dec L4
+sub L20, @r4
+jmp L14
+jsr @r3
+m4
+mov @r1, L48
+prn @r1
+cmp L4, @r3
+not L22
+dec L18
+cmp L11, @r4
+sub -495, L4
+rts
+add 385, @r2
+cmp 135, L4
+L26: sub 369, @r4
+rts
+m1
+sub L20, @r2
+m3
+jmp L12
+L27: rts
+cmp L22, L1
+lea L23, @r5
+jsr L23
+rts
+rts
+cmp @r6, -49
+L28: dec L28
+add -472, L3
+rts
+sub L14, @r7
+inc @r2
+m3
+L29: not L28
+rts
+mov @r3, @r7
+lea L9, @r5
+m0
+L30: add S9, L8
+bne L17
+bne L27
+sub -234, L9
+rts
+L31: dec L31
+clr @r2
+jmp L20
+L32: dec L4
+L33: add -127, L0
+inc @r6
+lea L32, L18
+lea L11, @r7
+inc @r6
+jsr L22
+jsr @r3
+red @r4
+clr @r1
+dec L4
+jmp L20
+jmp @r3
+bne L21
+mov -503, @r7
+m0
+jsr L19
+dec @r6
+sub L23, @r5
+mov @r0, L27
+add 350, @r7
+mov 455, L27
+L34: dec L13
+bne @r7
+m3
+red @r3
+jsr L10
+mov 412, L33
+bne @r0
+not L12
+rts
+bne @r0
+rts
+jsr @r5
+jsr @r7
+clr S6
+dec D0
+jsr L34
+sub @r1, @r2
+bne @r5
+lea L14, @r2
+rts
+cmp @r3, @r2
+jsr @r0
+bne L5
+m2
+clr @r4
+jmp L33
+prn @r0
+add L6, @r5
+lea L17, L31
+prn @r7
+inc @r5
+sub 212, @r2
+sub L24, @r3
+sub -191, L30
+not @r7
+L35: jmp @r4
+rts
+bne L52
+cmp L4, L12
+inc L17
+red @r3
+cmp S2, L6
+sub L1, L33
+lea L20, @r5
+rts
+jsr @r3
+sub @r6, L27
+cmp L35, 397
+dec L31
+cmp -128, S1
+add L11, @r2
+clr @r6
+L36: red L23
+m1
+m3
+add 268, L21
+rts
+L37: jsr L8
+L38: mov S1, @r3
+lea L27, @r6
+not L22
+L39: add L21, L59
+clr L2
+jsr L31
+add 348, @r0
+jsr @r2
+jmp L33
+red L27
+inc L17
+not @r3
+clr @r7
+m0
+prn L25
+rts
+L40: lea L32, @r5
+L41: mov -258, S4
+sub L20, @r7
+jmp @r7
+rts
+prn L8
+mov -17, L35
+m3
+not L33
+jmp @r2
+dec L6
+m2
+add L34, D0
+L42: clr L18
+clr @r0
+L43: lea L25, L23
+dec L15
+jsr L3
+sub @r4, @r0
+jmp @r0
+jsr L11
+add -58, L54
+add -49, L12
+not L17
+cmp S4, S0
+cmp @r7, 36
+L44: bne @r2
+jsr L14
+add L26, L57
+dec @r3
+add -14, L38
+inc @r4
+L45: clr L3
+inc @r0
+sub 496, S0
+L46: add S7, L32
+clr L0
+sub @r2, L46
+L47: not @r1
+red L32
+prn L22
+prn @r0
+sub 300, @r1
+rts
+red L6
+jmp @r0
+cmp L21, @r2
+m1
+bne @r6
+L48: bne L12
+m0
+jsr L32
+bne L55
+dec L18
+not L47
+L49: prn -34
+add L25, @r0
+add 2, L47
+dec @r3
+lea L21, L8
+jsr L33
+m1
+inc L10
+bne L28
+L50: red @r6
+cmp @r3, L15
+m2
+L51: sub L28, @r4
+add @r6, L44
+L52: jsr @r7
+m1
+rts
+L53: not @r2
+cmp -398, @r2
+cmp @r1, -34
+add -107, @r7
+L54: jmp L1
+red L54
+clr L58
+lea L12, @r0
+m3
+jmp L58
+m1
+rts
+dec L56
+mov L58, @r7
+mov @r5, S2
+jmp D0
+clr @r2
+m0
+L55: mov @r5, L11
+L56: rts
+rts
+L57: mov L53, L45
+L58: inc @r1
+m4
+lea L15, @r6
+cmp @r3, L24
+rts
+m2
+dec @r6
+m2
+L59: prn X4
+sub D0, S5
+bne D0
+stop
+D0: .data -301,-140,-70,427,-290,-382,126,257,-85,0
+D1: .data -286,-221,-440,-8,-478,10,344,25,-309,-196
+D2: .data 24,99,-260,-119,-372,-102,-458,374,45,-307
+D3: .data -176,264,454,323,494,-10,-356,296,-475,462
+D4: .data 475,417,256,-155,139,-387,-84,-400,190,-110
+D5: .data -421,-458,-60,-132,276,139,154,119,-462,-295
+D6: .data 122,-160,-418,334,410,18,310,-18,-173,416
+D7: .data -374,-173,-224,-63,334,480,329,-229,113,404
+D8: .data 97,200,-91,108,-426,272,-406,125,79,-38
+D9: .data 114,-437,-256,347,322,228,157,-371,-258,230
+S0: .string "rfnqchehwjxotrlarll"
+S1: .string "hw"
+S2: .string "ki"
+S3: .string "wxjulalmihfiyshqbnxf"
+S4: .string "tbjsdohyybcdydlelvl"
+S5: .string "rhhxwmehbvhtkvym"
+S6: .string "vyqpaqysjqwbcers"
+S7: .string "ctvizgzqeerqqlrk"
+S8: .string "rnolbxerxbwycuskjlf"
+S9: .string "wqveuexxfehdvfchz"
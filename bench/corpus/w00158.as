@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r5
+    prn 0
+endmcro
+mcro m1
+    sub @r2, @r6
+    prn 84
+endmcro
+mcro m2
+    sub @r7, @r6
+    prn 13
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 33
+endmcro
+mcro m4
+    sub @r7, @r3
+    prn 39
+endmcro
+jsr D0
+L0: bne L0
+cmp 490, L0
+L1: prn L1
+jmp @r6
+add @r3, L1
+lea L0, @r1
+m3
+red @r6
+L2: lea L1, @r3
+mov -459, @r4
+inc @r5
+m1
+red L0
+not L1
+not @r2
+red L17
+rts
+sub 327, @r5
+clr L1
+red @r1
+mov -357, @r0
+inc L0
+dec @r6
+cmp 468, @r1
+lea L2, L1
+m0
+L3: not L30
+L4: dec L2
+jsr @r0
+sub @r3, @r2
+jmp @r7
+red @r1
+lea L29, @r6
+red L2
+red L3
+L5: clr @r7
+sub 475, @r0
+mov 431, @r1
+cmp @r6, @r3
+m2
+dec L2
+sub @r6, @r6
+not @r7
+prn L4
+m3
+m4
+jmp @r2
+mov 270, L4
+prn @r4
+bne L5
+not @r6
+inc L5
+jmp L1
+lea L1, @r3
+add @r0, @r5
+m2
+m4
+clr @r6
+not L1
+clr L2
+jsr @r7
+dec L4
+L6: dec @r2
+clr L4
+L7: clr @r1
+mov 265, L7
+mov -454, L39
+L8: prn 358
+m3
+m4
+bne @r4
+dec @r4
+rts
+clr @r6
+m2
+lea L3, L2
+lea L1, L3
+cmp L3, -507
+red L7
+rts
+not L8
+add -35, L4
+jmp @r5
+L9: lea L3, @r1
+clr @r1
+sub @r0, @r3
+dec L8
+jsr @r5
+mov L2, L2
+jsr L25
+add L6, L2
+sub 253, @r5
+m0
+cmp @r5, @r1
+inc L3
+clr @r3
+add L4, @r6
+L10: add @r1, L5
+add @r1, @r3
+inc @r7
+clr @r3
+clr L10
+L11: inc L9
+m0
+add -472, @r4
+cmp 339, 367
+L12: rts
+sub @r2, X0
+cmp -327, S5
+dec @r3
+not L0
+jmp L9
+jsr L7
+red L1
+rts
+bne L10
+mov @r1, L6
+m4
+inc @r7
+L13: clr @r3
+add @r2, @r7
+m0
+sub @r1, @r7
+L14: red @r6
+mov 106, @r5
+clr @r4
+dec @r4
+red L7
+L15: jsr @r4
+red L13
+red L1
+jmp @r7
+dec @r7
+jmp @r2
+cmp L9, -76
+L16: jsr L4
+rts
+dec @r3
+bne L0
+not @r5
+red L7
+prn L12
+add L5, @r5
+not @r7
+add L4, L0
+m2
+L17: sub L2, @r5
+m2
+jsr @r7
+lea L13, @r1
+red L0
+L18: jsr L10
+sub L16, L2
+red @r0
+lea L12, L0
+jmp @r4
+lea L7, L16
+dec @r4
+dec @r5
+add @r3, L20
+m4
+L19: clr L11
+lea L12, L11
+jmp L16
+cmp @r4, 213
+inc @r0
+bne L0
+add L18, L7
+prn @r4
+lea L8, @r7
+dec L6
+m4
+L20: dec @r2
+cmp L9, L47
+inc @r1
+prn L7
+sub @r3, L20
+rts
+prn -334
+m2
+jsr @r5
+jsr L17
+L21: add L19, @r5
+inc L10
+bne @r2
+mov L1, @r4
+cmp L0, @r0
+m1
+add @r6, @r1
+dec D0
+not L0
+add L17, @r0
+bne @r0
+L22: add -409, @r2
+jsr @r2
+jmp L11
+red L20
+clr @r1
+clr L9
+m2
+lea L18, L18
+dec L17
+red L15
+jsr @r5
+jsr L1
+m3
+prn -264
+lea L20, @r4
+rts
+jsr L31
+not L10
+prn L30
+jmp L13
+clr @r7
+lea L12, L10
+not @r5
+inc @r5
+dec @r0
+bne @r3
+dec L15
+prn @r4
+mov -86, L11
+clr L19
+L23: jmp @r1
+clr L8
+m3
+lea L5, @r7
+L24: jsr L14
+dec L18
+L25: lea L3, @r0
+bne @r2
+mov L17, S2
+cmp @r3, @r5
+cmp -271, -98
+L26: dec L4
+lea X1, @r7
+jsr @r6
+jsr @r5
+jmp @r0
+L27: rts
+mov L3, L25
+inc @r0
+rts
+jmp L18
+L28: cmp 128, L25
+jmp L24
+lea L26, L5
+L29: jsr @r5
+m3
+jmp L25
+rts
+clr @r7
+add @r0, @r7
+not @r0
+red @r7
+inc @r2
+L30: inc L25
+dec @r5
+L31: sub @r5, @r7
+m3
+prn @r4
+inc @r7
+L32: cmp -25, -288
+m0
+red @r3
+jsr @r6
+bne L23
+rts
+dec L30
+prn -52
+L33: sub @r7, L50
+rts
+red @r4
+bne D0
+add -480, @r0
+prn L55
+L34: inc L43
+inc @r7
+clr S1
+add -83, @r2
+m4
+m0
+lea L25, L28
+L35: prn L26
+rts
+inc @r4
+clr @r4
+jsr L21
+m1
+not @r5
+sub -116, @r3
+bne L32
+sub L21, L6
+mov -333, L49
+bne @r3
+L36: dec @r7
+bne @r2
+clr @r6
+not @r6
+clr @r3
+dec @r1
+rts
+not @r5
+lea L31, L27
+inc @r7
+bne @r3
+lea L13, S4
+inc @r7
+m0
+red @r4
+L37: jmp @r3
+L38: dec L25
+m1
+cmp 56, L25
+lea L21, L1
+m2
+cmp 192, @r2
+m0
+m2
+jmp @r3
+inc @r2
+lea L20, @r7
+L39: jsr D0
+mov -189, S6
+inc @r4
+dec @r5
+bne @r0
+L40: rts
+prn @r1
+prn @r7
+prn @r0
+L41: cmp L0, 177
+L42: mov @r7, D0
+L43: jmp L42
+rts
+L44: lea L14, L0
+L45: lea L38, @r6
+cmp -329, 475
+mov @r2, @r6
+inc @r0
+cmp @r5, L25
+mov @r6, @r6
+prn L33
+jmp @r3
+jmp L14
+jsr L14
+dec @r4
+clr L30
+jmp L28
+L46: bne L20
+mov @r3, @r2
+not @r2
+jsr L31
+prn L10
+mov 185, @r2
+red @r0
+prn L29
+rts
+dec @r3
+L47: mov 1, @r5
+red D0
+sub @r5, S4
+jsr @r4
+bne @r6
+prn L0
+jsr L31
+L48: sub @r2, @r1
+clr L31
+dec @r6
+clr @r6
+sub 160, L47
+rts
+red L15
+rts
+add L29, D0
+add 346, @r7
+red @r1
+jsr @r2
+mov -260, X2
+prn -69
+clr L42
+mov L17, @r5
+red @r1
+sub L47, L6
+bne @r7
+prn @r4
+m3
+dec L15
+L49: rts
+cmp L8, L20
+dec @r4
+rts
+m4
+L50: inc L30
+L51: bne L28
+jmp S5
+sub @r5, @r4
+jmp L59
+rts
+jmp L32
+not L54
+red L15
+cmp 235, L46
+m2
+add -330, L9
+L52: mov -491, L14
+cmp 395, 280
+lea L13, @r6
+add -1, @r5
+clr L55
+jsr @r3
+add @r6, @r4
+jsr @r5
+dec L41
+L53: mov -32, @r3
+prn @r7
+bne @r0
+prn @r5
+dec L55
+jmp @r4
+lea L49, X3
+L54: not @r3
+L55: prn L30
+jsr L56
+rts
+L56: jmp @r4
+jmp L24
+cmp 170, @r4
+mov 371, L58
+not S0
+m2
+not @r1
+jsr L38
+m1
+L57: inc D0
+lea S7, L59
+L58: not X4
+dec L59
+L59: jmp S9
+stop
+D0: .data 288,159,408,260,-16,-341,312,385,465,-87
+D1: .data -305,324,-195,-50,-293,387,-478,-429,378,-420
+D2: .data -269,179,320,472,111,343,-283,319,384,439
+D3: .data 298,-424,389,34,-158,417,169,421,-226,423
+D4: .data -226,193,53,-322,-268,206,-405,185,331,430
+D5: .data -28,1,-24,-88,323,293,6,-238,194,381
+D6: .data -1,-440,-163,-349,483,429,-275,95,468,7
+D7: .data 102,-483,-85,255,-283,3,369,-104,315,13
+D8: .data -203,133,-343,12,135,198,282,82,-163,-379
+D9: .data -227,-223,-193,393,-144,286,-207,36,190,-330
+S0: .string "axvagxtqwmosul"
+S1: .string "pj"
+S2: .string "zrhzifl"
+S3: .string "qvxro"
+S4: .string "b"
+S5: .string "zolhm"
+S6: .string "kct"
+S7: .string "xlbgil"
+S8: .string "btphkrdmqkbakzxjchfj"
+S9: .string "srzqyidtkwanxkqukke"
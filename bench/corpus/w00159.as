@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r0
+    prn 38
+endmcro
+mcro m1
+    sub @r7, @r0
+    prn 82
+endmcro
+mcro m2
+    sub @r1, @r4
+    prn 79
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 9
+endmcro
+mcro m4
+    sub @r1, @r2
+    prn 64
+endmcro
+prn L0
+jsr L0
+jmp @r6
+red @r7
+L0: bne L0
+red @r3
+inc L0
+L1: clr @r3
+not @r6
+dec L0
+clr L0
+jsr @r6
+sub L57, L1
+m4
+clr @r7
+bne L0
+mov -337, L0
+prn @r6
+prn 379
+not L56
+bne @r4
+jsr L0
+L2: clr @r3
+inc L14
+lea L0, L2
+sub -151, @r1
+add L1, @r6
+dec @r6
+red L2
+prn L2
+rts
+dec @r5
+dec L1
+clr @r7
+add L0, @r3
+m3
+L3: lea L2, L1
+dec L0
+jsr L0
+dec S6
+not L0
+L4: lea L3, L4
+m3
+sub @r1, @r1
+bne L2
+L5: cmp 123, L4
+mov -462, L1
+mov -436, L36
+not L3
+L6: jmp L3
+cmp -357, @r1
+m2
+not L5
+inc L2
+red @r1
+add L1, D0
+bne L6
+m3
+sub 363, L4
+mov -223, @r5
+L7: red @r2
+bne L3
+mov 182, L0
+add 200, @r5
+mov 324, L6
+mov L6, L3
+lea L6, L28
+red S7
+prn @r7
+L8: inc L0
+jmp L1
+inc @r2
+bne @r6
+jsr @r3
+m2
+add L3, @r6
+bne L0
+L9: sub 196, L5
+dec @r6
+L10: cmp @r3, -337
+L11: sub @r1, @r2
+L12: add @r1, @r5
+jmp L8
+red @r4
+mov L12, @r0
+L13: prn @r1
+lea L6, L7
+dec @r7
+jmp @r3
+jmp L12
+L14: bne L4
+L15: lea D0, L9
+mov 224, L4
+L16: sub L4, L12
+cmp @r5, L0
+prn @r1
+L17: mov @r6, S0
+rts
+not L9
+jmp L16
+jsr @r4
+jsr @r7
+sub @r1, L3
+sub L5, L6
+jsr L0
+m1
+cmp @r3, @r2
+clr L6
+red @r0
+jmp @r6
+m0
+sub L16, L10
+sub L4, L7
+inc @r2
+bne L1
+prn @r1
+dec @r1
+jsr @r5
+dec @r3
+m2
+cmp @r6, @r5
+jsr L3
+L18: bne L8
+prn @r7
+red @r2
+jmp L6
+m2
+m1
+prn 220
+rts
+jsr @r0
+add @r2, @r3
+inc @r5
+inc S8
+inc L18
+jsr L13
+jmp @r6
+lea L3, @r7
+sub @r1, L15
+L19: bne L19
+mov 55, L9
+L20: dec L8
+m3
+cmp 434, -494
+L21: sub @r2, L0
+mov L5, L2
+add -117, L14
+L22: add -78, L0
+mov L1, L4
+L23: rts
+rts
+L24: lea L10, L2
+clr @r1
+jsr X0
+inc L10
+dec @r1
+red @r7
+prn -217
+not X1
+L25: mov @r3, @r1
+L26: clr @r3
+m4
+mov @r2, L13
+inc @r1
+m0
+red L16
+add 76, L14
+rts
+bne L17
+lea L7, L35
+prn L1
+sub L0, @r0
+rts
+not D0
+not S5
+not @r0
+m3
+bne L18
+red L9
+lea L10, @r2
+add 118, S9
+jmp L24
+add -105, L12
+red @r2
+m0
+rts
+jmp L15
+red L11
+rts
+m0
+cmp 90, @r7
+cmp 426, -44
+red @r6
+clr @r3
+jmp L4
+not L25
+L27: red L4
+m0
+jmp @r7
+clr L6
+add @r3, @r2
+lea L12, L14
+mov 5, L10
+not L8
+m2
+inc @r3
+sub @r4, L17
+clr @r3
+rts
+jmp D0
+not @r2
+prn @r4
+not @r1
+prn 160
+jmp L17
+m4
+not L7
+mov @r1, @r0
+rts
+inc @r2
+cmp 302, -345
+inc @r1
+L28: red @r6
+clr L17
+add @r6, L3
+red @r6
+bne L52
+add 103, L13
+m2
+cmp @r6, -412
+lea L23, @r6
+red L2
+cmp 238, L9
+cmp @r3, 290
+add L1, @r2
+inc L17
+m0
+m0
+add L6, L17
+rts
+clr @r7
+m2
+clr @r6
+dec @r1
+clr @r3
+jsr L0
+add L19, L17
+rts
+jsr @r6
+jsr S2
+not @r4
+m2
+lea L3, @r4
+lea L5, L19
+bne L18
+jmp @r3
+L29: jmp @r7
+mov L9, L29
+rts
+red @r0
+inc @r6
+bne L16
+clr L1
+m2
+dec S5
+clr @r0
+m3
+sub L28, @r4
+L30: mov L27, @r2
+mov L22, @r0
+rts
+prn L9
+rts
+lea L20, @r1
+prn L20
+bne @r5
+L31: dec L21
+prn @r6
+prn L37
+lea S6, L25
+mov L27, S9
+rts
+L32: inc L2
+mov -409, @r1
+not L1
+lea L7, L8
+lea L31, @r0
+dec L6
+clr L14
+red @r4
+bne @r0
+rts
+m1
+m3
+L33: not L8
+L34: bne @r7
+cmp 414, @r5
+not @r2
+prn L49
+lea L1, @r1
+inc L24
+cmp L8, 494
+lea L35, L21
+dec @r2
+prn L22
+bne L32
+dec @r4
+m4
+L35: dec @r6
+mov @r4, @r0
+add @r6, @r5
+L36: jsr @r1
+inc @r6
+inc @r5
+m3
+cmp L16, @r2
+lea L10, @r1
+sub L15, @r1
+red @r1
+mov L12, @r5
+bne L11
+mov @r5, @r7
+clr @r3
+inc L9
+jsr @r7
+L37: mov @r7, @r7
+inc L1
+sub @r2, L34
+jsr L31
+prn -254
+prn L6
+add -64, @r4
+L38: cmp L46, -344
+red @r4
+L39: inc S6
+inc L8
+jmp L25
+jsr @r4
+jsr @r7
+m4
+cmp @r7, D0
+add L35, X2
+L40: clr L12
+add -70, @r5
+lea L34, @r1
+m3
+mov L25, @r2
+lea L54, @r4
+cmp 483, @r6
+m0
+L41: mov @r4, @r3
+jsr @r3
+add @r7, @r5
+dec @r0
+rts
+bne L4
+m2
+add -328, @r1
+cmp L5, @r2
+inc L3
+lea L27, @r2
+prn S8
+add 456, @r1
+dec L39
+prn @r3
+jsr @r4
+red @r2
+rts
+inc @r1
+jmp @r0
+L42: jsr @r3
+rts
+clr L41
+sub @r2, @r2
+m0
+L43: red L29
+m3
+rts
+L44: lea L10, @r2
+sub L11, X3
+inc @r7
+sub 278, @r2
+L45: prn 309
+m4
+prn X4
+prn @r4
+L46: jsr L6
+mov -224, L25
+red L37
+jmp D0
+L47: jmp L14
+bne @r1
+jmp L38
+add @r1, L21
+prn @r1
+clr @r6
+cmp L24, @r7
+red @r2
+L48: lea L24, @r6
+not @r3
+clr L21
+rts
+rts
+L49: prn L43
+lea L11, @r7
+m2
+L50: bne L37
+red @r4
+sub L27, @r7
+L51: dec L55
+not @r7
+add 255, @r5
+L52: not @r3
+mov 119, L5
+inc L59
+red @r1
+L53: dec @r7
+L54: rts
+jsr L21
+L55: not L57
+L56: not @r1
+sub D0, @r6
+inc @r1
+red @r2
+add @r0, L45
+dec L28
+jsr @r1
+sub S8, S1
+inc @r6
+cmp @r4, @r7
+lea L25, @r7
+L57: mov @r0, S0
+rts
+bne D0
+m1
+mov -243, L58
+L58: rts
+L59: jsr D0
+not L48
+bne L39
+stop
+D0: .data 471,33,-415,-104,-46,-32,315,-46,-305,466
+D1: .data 89,259,444,-96,-334,-416,-415,-37,409,-205
+D2: .data -135,252,-280,497,38,-174,-106,219,-125,393
+D3: .data 399,396,-154,264,143,-105,-259,-292,70,442
+D4: .data -153,-89,59,400,11,-268,-497,290,379,-161
+D5: .data 249,256,247,166,176,50,-431,-53,-97,-427
+D6: .data 256,114,-18,85,80,463,-205,-398,-302,238
+D7: .data 421,44,416,413,-345,396,73,426,118,220
+D8: .data 218,-55,-7,-295,407,85,36,-76,-487,350
+D9: .data 134,-8,320,364,77,-340,177,-12,-258,-183
+S0: .string "kztr"
+S1: .string "wpuftijbvnwsraugnl"
+S2: .string "thrzsjcjrlgnk"
+S3: .string "ktvwhuvoopg"
+S4: .string "lkcaazghvhjuviykky"
+S5: .string "pgsoosjosqn"
+S6: .string "ewswdjsjchsjrylskc"
+S7: .string "fphdwgimgfghpgvty"
+S8: .string "tvgjiaag"
+S9: .string "n"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r3
+    prn 9
+endmcro
+mcro m1
+    sub @r3, @r1
+    prn 81
+endmcro
+mcro m2
+    sub @r3, @r2
+    prn 44
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 85
+endmcro
+mcro m4
+    sub @r3, @r0
+    prn 88
+endmcro
+L0: add L0, @r4
+not @r7
+m0
+dec @r2
+clr @r1
+L1: lea L1, L0
+cmp 114, -340
+jmp @r0
+cmp @r1, @r2
+L2: not L55
+cmp @r4, L1
+red L0
+not @r1
+rts
+m3
+rts
+inc L1
+sub L2, L0
+dec S4
+jsr L2
+sub @r6, @r1
+L3: not @r5
+red @r3
+lea L3, L2
+rts
+L4: prn @r5
+jmp L1
+not L2
+bne L1
+cmp @r2, 215
+m0
+bne L4
+rts
+prn @r2
+clr @r5
+dec L1
+cmp 305, L2
+clr L0
+clr L0
+m1
+cmp @r0, 351
+red L0
+cmp L4, @r1
+dec @r3
+sub @r2, L3
+bne @r0
+L5: inc @r7
+red @r5
+L6: red L4
+clr L1
+jsr L5
+jsr L4
+L7: sub @r7, L3
+jsr L1
+m4
+prn -173
+jmp @r1
+jmp L5
+mov L2, @r3
+dec L0
+sub L3, L6
+prn L5
+bne @r2
+inc L0
+dec @r3
+add @r2, @r1
+sub @r1, L3
+dec L0
+inc L1
+red L5
+L8: add 339, L2
+mov L4, @r0
+m0
+sub 341, @r4
+prn 271
+L9: dec @r2
+jmp L9
+clr @r5
+prn L9
+jsr L7
+lea L6, L4
+jsr @r2
+prn @r7
+cmp L1, L1
+m0
+bne L2
+clr S7
+not L7
+jmp @r2
+cmp -39, X0
+not L3
+inc @r0
+jsr @r1
+L10: inc @r1
+red @r4
+clr L3
+m0
+not L6
+L11: dec L8
+dec @r4
+inc @r3
+L12: clr L1
+lea L6, L0
+m2
+not @r2
+L13: sub -313, @r5
+dec @r7
+prn @r7
+inc L2
+L14: clr L10
+jsr L1
+rts
+bne @r3
+L15: jsr L4
+L16: bne L3
+cmp 393, @r6
+mov @r7, @r3
+sub -212, L0
+bne @r1
+not @r0
+inc L16
+m2
+m2
+dec L11
+m4
+red L9
+jmp D0
+mov @r1, L8
+jsr L2
+mov 483, L7
+jsr D0
+add -154, S3
+prn L11
+prn 86
+not @r7
+dec L13
+m1
+jsr L12
+bne @r5
+m0
+rts
+L17: add @r5, @r4
+prn L8
+rts
+bne @r5
+L18: jsr @r4
+rts
+L19: jmp L10
+dec @r2
+rts
+red L13
+rts
+not @r7
+cmp L21, L17
+L20: dec @r4
+L21: rts
+jmp L10
+lea L21, @r2
+L22: add -82, @r2
+prn @r7
+rts
+cmp -417, @r4
+bne L22
+lea L17, L17
+sub @r0, L20
+not @r5
+prn L7
+m4
+rts
+lea L11, L15
+lea L10, L7
+inc L6
+jmp @r2
+red @r2
+L23: bne L4
+jmp L8
+bne L44
+dec @r0
+jsr @r2
+sub @r1, @r4
+lea L13, L17
+not L13
+sub @r0, @r5
+dec @r7
+clr @r3
+dec @r0
+dec L12
+L24: red L7
+jmp @r2
+clr L4
+L25: jsr L7
+clr @r0
+rts
+prn -491
+L26: add 424, L16
+rts
+L27: inc @r4
+prn L10
+inc @r5
+jsr @r1
+jsr @r1
+L28: lea L25, @r6
+m4
+L29: sub 504, @r6
+m1
+sub 142, L17
+dec @r5
+rts
+L30: jmp @r3
+not @r2
+L31: mov @r5, @r2
+prn L28
+cmp 493, L14
+jmp @r6
+cmp @r4, 438
+rts
+m1
+m0
+L32: add @r1, @r2
+bne @r3
+add 75, L5
+L33: inc @r3
+m2
+L34: jsr @r6
+lea L27, L5
+add L31, @r7
+rts
+not D0
+inc @r5
+L35: prn -388
+clr @r7
+jmp @r3
+sub L42, L12
+not L10
+L36: cmp @r0, L34
+not L12
+bne L7
+sub @r1, L36
+prn 175
+rts
+jsr L1
+L37: add 292, @r3
+m1
+rts
+dec @r5
+add @r7, @r1
+cmp L9, L30
+sub -317, L55
+L38: mov @r2, L28
+sub -306, L7
+jsr L34
+m0
+clr @r1
+clr @r2
+add @r3, L22
+rts
+dec L25
+bne @r2
+cmp 333, @r5
+not L9
+sub 241, @r5
+dec D0
+rts
+L39: cmp L0, -363
+inc @r1
+red @r2
+clr L15
+m1
+red L10
+m0
+m2
+red @r4
+sub L11, L3
+mov 222, @r2
+mov -232, @r4
+inc L27
+prn @r2
+mov 449, @r7
+prn -383
+add 181, @r2
+add -88, @r4
+L40: mov -363, @r6
+add L55, @r7
+rts
+add @r1, @r4
+L41: jsr L2
+cmp L3, @r2
+jmp L20
+bne @r4
+L42: lea S1, @r0
+not X1
+L43: clr L32
+add 30, @r5
+clr L7
+sub 425, @r1
+cmp L0, L19
+red L32
+jsr @r2
+not L21
+sub 35, L21
+cmp @r7, S3
+rts
+dec L30
+rts
+jsr @r3
+sub @r3, L17
+m2
+inc L5
+jmp L22
+prn 363
+bne L36
+L44: jmp @r7
+L45: prn -320
+not S1
+inc L10
+jmp @r0
+m4
+dec L40
+clr @r1
+mov L26, @r3
+lea D0, L40
+red @r1
+rts
+mov @r7, @r4
+cmp @r2, @r7
+mov L45, @r4
+jmp L35
+lea L3, L2
+cmp L41, L23
+red L26
+clr L0
+clr L13
+not L32
+inc @r2
+jmp @r0
+rts
+red @r4
+not @r6
+jsr D0
+lea L29, @r4
+mov -462, L40
+m1
+cmp @r7, 193
+L46: jmp L32
+not @r6
+m1
+dec L57
+jmp @r2
+m1
+jmp @r0
+L47: dec @r5
+red @r2
+clr L48
+clr @r1
+jmp @r2
+red L28
+mov @r0, D0
+m2
+L48: cmp L22, 302
+L49: add @r1, L26
+L50: prn @r2
+m2
+m3
+mov L4, @r7
+not L54
+m3
+sub L54, L23
+bne L30
+L51: rts
+clr @r5
+add 382, @r4
+clr @r0
+L52: sub @r6, @r7
+red @r0
+L53: rts
+lea L2, @r3
+prn @r1
+lea L54, @r1
+lea L37, S4
+L54: clr D0
+m3
+add 468, @r0
+lea L14, L20
+jmp @r4
+m3
+bne L43
+rts
+add @r7, @r4
+bne @r7
+red @r2
+cmp L55, -289
+bne @r2
+not L7
+sub L2, L37
+jmp L57
+jmp X2
+jsr @r4
+red @r4
+add L12, @r6
+jmp @r2
+L55: rts
+bne L8
+add @r5, @r5
+clr @r4
+bne @r1
+prn 148
+L56: mov L9, @r7
+L57: add L35, @r1
+inc D0
+m0
+jmp L41
+sub @r4, L22
+L58: lea L46, L44
+sub @r3, @r5
+bne @r3
+not L39
+cmp S4, -302
+m4
+sub @r2, @r4
+lea L5, @r7
+add S2, @r3
+sub -431, @r4
+m1
+not @r4
+red @r4
+jsr @r7
+clr @r6
+clr @r2
+not X3
+mov L59, @r4
+m1
+mov L59, @r5
+red L59
+sub D0, D0
+bne @r5
+clr S4
+red L38
+L59: rts
+red X4
+jsr S5
+stop
+D0: .data -18,462,323,-415,-250,55,218,-467,-115,268
+D1: .data 347,80,-29,-409,-83,-67,252,415,403,65
+D2: .data -16,399,296,-287,-208,-489,359,428,439,-72
+D3: .data 337,309,-180,460,365,-378,419,-268,495,331
+D4: .data -188,-405,331,-26,-238,23,7,466,-231,406
+D5: .data -150,228,-70,-389,259,280,173,277,21,340
+D6: .data -58,-124,115,458,-220,35,333,312,264,-275
+D7: .data -47,-168,-67,-23,157,-402,89,110,-303,-496
+D8: .data -452,-248,127,-246,310,-398,197,215,269,220
+D9: .data -292,392,-240,-127,130,429,-345,78,-339,383
+S0: .string "dwvvoqfkgbyzrnnyb"
+S1: .string "fqufrwdtddmbls"
+S2: .string "heiuvtx"
+S3: .string "uxntjothraklxoo"
+S4: .string "uvdvsqsbagkmszb"
+S5: .string "wuglbockdeorwr"
+S6: .string "rlrzsxyy"
+S7: .string "htlycrqdrvvhthal"
+S8: .string "mlwwgordrvyl"
+S9: .string "owhkrr"
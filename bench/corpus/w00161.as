@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r5
+    prn 79
+endmcro
+mcro m1
+    sub @r7, @r2
+    prn 79
+endmcro
+mcro m2
+    sub @r5, @r0
+    prn 41
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 62
+endmcro
+mcro m4
+    sub @r5, @r6
+    prn 13
+endmcro
+dec L0
+prn -414
+add @r6, L0
+m1
+m0
+jsr @r2
+cmp @r3, L0
+jmp @r7
+not L0
+bne @r5
+m4
+sub @r4, L0
+add L0, L0
+lea D0, L0
+bne L0
+lea L0, L0
+rts
+prn L0
+prn 19
+add @r2, L0
+rts
+sub L45, L0
+dec L0
+mov 256, @r5
+sub @r7, @r0
+m0
+L0: add L0, @r1
+mov @r1, L0
+add S9, L0
+lea L0, L0
+mov 78, L0
+dec L0
+add L50, L18
+bne @r3
+mov @r7, @r2
+inc L0
+L1: red @r3
+m1
+jmp L0
+bne L1
+mov -49, @r0
+m1
+not @r5
+m3
+clr @r1
+m2
+jsr @r2
+cmp -478, L1
+jsr @r2
+prn 136
+L2: jmp L1
+lea L46, @r1
+jsr L52
+add L2, L2
+mov L1, @r3
+bne L2
+m0
+L3: sub L2, L2
+bne L25
+clr @r7
+jmp L3
+m4
+sub L1, @r6
+bne L2
+prn L2
+rts
+lea L0, L2
+rts
+red L3
+L4: jmp @r1
+jsr @r0
+bne @r7
+mov 11, L2
+jmp @r6
+cmp -168, @r7
+lea L0, L53
+prn @r0
+dec @r1
+inc @r2
+L5: mov -134, @r3
+lea L2, L0
+clr @r0
+jmp L2
+red @r4
+mov L0, L1
+not @r4
+prn L0
+not @r7
+jmp @r3
+cmp L2, @r6
+dec L5
+jsr L2
+rts
+bne @r4
+mov @r4, L1
+prn 489
+L6: lea L0, L1
+inc @r3
+sub 496, L5
+sub @r4, L5
+dec @r3
+red L2
+bne L4
+jmp L1
+rts
+lea L5, @r0
+jsr L1
+bne @r6
+mov @r3, L2
+not @r0
+dec @r1
+mov L6, @r2
+jsr @r4
+sub @r5, L5
+m0
+cmp L0, L5
+rts
+cmp @r4, 429
+sub @r6, @r1
+red L1
+prn @r4
+mov -16, @r3
+cmp L3, L0
+prn L4
+add @r6, L1
+clr @r6
+inc L2
+inc L3
+bne @r5
+clr D0
+L7: mov @r6, L3
+clr S3
+mov 386, L4
+dec @r0
+m0
+L8: prn -183
+bne @r2
+L9: prn @r2
+mov L0, @r3
+jsr @r4
+L10: cmp L9, L1
+jmp @r1
+jmp @r0
+bne L27
+jsr L3
+cmp L10, @r2
+sub -201, L7
+not L2
+dec @r0
+prn L10
+jmp @r1
+rts
+bne @r0
+L11: prn L9
+not L2
+add L9, L10
+cmp -107, @r5
+jsr @r1
+cmp L2, @r3
+lea L10, @r3
+L12: lea L4, @r5
+clr L1
+jsr @r7
+inc S3
+not @r4
+red @r4
+clr L6
+bne @r4
+not @r3
+m0
+sub @r1, L5
+jsr L9
+add -500, L5
+dec L6
+L13: dec @r0
+red L2
+red L6
+cmp 267, 212
+L14: jsr L12
+m1
+clr @r1
+jsr L0
+dec L11
+bne @r5
+m4
+m4
+rts
+prn L6
+red @r5
+L15: jsr @r6
+clr @r7
+jsr L7
+cmp 231, -477
+rts
+dec L5
+L16: bne @r1
+dec L3
+jmp @r2
+cmp -501, 393
+L17: lea L15, L2
+not L2
+cmp L1, @r1
+sub @r3, X0
+m2
+cmp @r3, -392
+bne L22
+clr @r2
+cmp @r0, L10
+mov @r4, @r5
+clr @r1
+jsr X1
+not L15
+dec @r5
+not @r2
+m1
+lea L9, @r0
+dec @r7
+jsr D0
+m3
+L18: dec L14
+rts
+red D0
+L19: prn -305
+prn @r7
+L20: add 340, L39
+dec @r4
+L21: jsr L16
+inc @r4
+jmp @r0
+lea L20, @r7
+m0
+L22: mov -47, L14
+m4
+red L14
+dec L15
+rts
+sub 204, L14
+add @r7, L13
+clr @r0
+jsr @r5
+lea L10, @r2
+L23: mov 360, @r6
+inc L22
+bne @r4
+L24: jmp @r7
+bne L19
+jsr @r3
+mov @r2, L19
+L25: inc L15
+m1
+inc L4
+mov 328, L6
+L26: inc L2
+clr @r2
+m0
+jsr L7
+L27: not @r5
+L28: dec L36
+not @r0
+L29: add @r6, @r6
+L30: inc L7
+clr L12
+inc L49
+not @r4
+add @r3, @r4
+mov L29, L17
+add L56, @r1
+inc L24
+m1
+m2
+bne @r3
+sub L0, @r2
+cmp L22, -276
+not L7
+clr @r2
+clr L21
+m1
+jsr @r3
+dec L3
+L31: dec L14
+clr L26
+inc L13
+L32: add -390, @r4
+dec X2
+inc @r2
+red L22
+L33: inc @r0
+L34: dec @r5
+not L6
+L35: cmp -247, -432
+jsr L19
+mov @r1, @r5
+red S9
+m0
+jsr @r5
+L36: mov -320, @r3
+sub -256, @r4
+cmp @r0, L5
+dec @r4
+L37: jsr @r6
+L38: not @r3
+not @r0
+jsr @r6
+sub 167, L14
+prn @r6
+red L24
+bne @r4
+prn 89
+cmp @r0, @r3
+bne @r4
+jsr S3
+jsr @r0
+sub 98, @r5
+jsr @r6
+prn S3
+jmp @r7
+jmp L4
+not @r0
+cmp @r3, L2
+clr L8
+jmp @r7
+red L35
+m4
+sub -426, L13
+rts
+dec @r3
+L39: inc L6
+inc @r3
+lea L6, X3
+L40: inc @r1
+bne L36
+m3
+sub 476, @r3
+cmp -54, L27
+jsr L44
+mov @r6, L2
+m1
+jsr L9
+jsr L25
+jsr @r1
+sub 42, @r0
+m1
+prn -452
+add -436, D0
+m2
+mov L20, L51
+L41: clr @r4
+L42: red L33
+sub @r3, @r6
+L43: add L13, S3
+L44: bne @r6
+dec L38
+mov 0, @r0
+mov -242, L49
+add L33, L39
+L45: jmp L43
+L46: cmp -410, L34
+mov @r4, L20
+bne @r3
+lea L9, @r1
+prn -264
+mov 200, @r1
+L47: add L0, @r0
+cmp 291, 402
+sub 222, @r6
+inc L30
+jmp @r5
+L48: jmp @r5
+L49: not @r6
+red @r1
+cmp -182, -143
+lea D0, L59
+rts
+m3
+jsr L47
+red L54
+m1
+L50: prn L48
+bne @r7
+sub L27, @r2
+prn @r3
+not L54
+L51: sub @r5, L44
+clr L2
+inc L28
+L52: prn @r0
+L53: inc L3
+jsr @r6
+prn @r5
+bne L22
+m3
+add 221, L12
+L54: prn 203
+clr @r5
+inc L5
+sub -160, L5
+mov @r7, @r3
+prn L0
+prn 228
+sub L48, D0
+L55: lea L48, L39
+cmp -41, @r3
+m0
+bne L33
+lea L55, @r1
+red @r4
+red L8
+add @r2, L52
+L56: add L5, @r5
+m2
+prn 416
+rts
+prn @r0
+m0
+m2
+jsr @r0
+L57: jmp L12
+add -347, L41
+jsr L46
+add @r7, S5
+m4
+not L28
+dec @r0
+cmp 213, 85
+L58: dec L52
+mov @r6, @r1
+L59: clr D0
+lea L33, L3
+bne @r6
+inc @r3
+jsr @r6
+jmp @r6
+inc L44
+mov S4, S4
+rts
+inc @r1
+jmp S8
+mov S0, L56
+inc X4
+jsr S1
+stop
+D0: .data -121,381,135,-104,-186,458,-40,93,-432,-455
+D1: .data -358,-208,-142,11,-225,167,407,-465,-223,263
+D2: .data -429,10,-77,424,-382,-127,351,-469,426,-4
+D3: .data -2,366,267,-37,130,-485,-310,138,449,373
+D4: .data 263,101,-50,-428,-423,422,-134,197,174,-27
+D5: .data -315,-228,335,359,258,-137,-74,224,376,-66
+D6: .data 467,249,470,-17,-305,301,281,-495,448,-30
+D7: .data -44,330,491,-486,-383,-319,-42,268,-188,47
+D8: .data 264,-242,-159,40,151,419,96,428,107,116
+D9: .data -213,-52,-297,275,-383,146,449,139,447,-397
+S0: .string "cejgnq"
+S1: .string "nclnicias"
+S2: .string "ldnwmszjdrzdhjyrtf"
+S3: .string "hyvhxrachhehsxp"
+S4: .string "ukarkqcttxf"
+S5: .string "idxgomgnxqgthuljziqy"
+S6: .string "wqxwfq"
+S7: .string "mgjmnr"
+S8: .string "wlumbpokxzinlmmb"
+S9: .string "ccgrf"
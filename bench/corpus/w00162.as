@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r0
+    prn 17
+endmcro
+mcro m1
+    sub @r4, @r3
+    prn 46
+endmcro
+mcro m2
+    sub @r7, @r6
+    prn 7
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 6
+endmcro
+mcro m4
+    sub @r7, @r4
+    prn 37
+endmcro
+jsr @r4
+bne @r1
+L0: jmp L0
+bne @r7
+L1: add @r7, L0
+rts
+add L0, L0
+dec L1
+clr @r5
+add L0, L0
+inc @r7
+inc L1
+bne @r6
+cmp 37, 408
+jmp @r7
+bne L1
+prn -480
+red L0
+cmp -320, L56
+cmp -140, @r5
+lea L1, @r3
+dec L0
+dec L0
+m4
+rts
+cmp @r0, @r3
+L2: bne L2
+m1
+inc @r3
+rts
+mov L2, L1
+add D0, @r0
+cmp L1, @r6
+rts
+m1
+m2
+dec L1
+red @r5
+mov 147, @r0
+red @r7
+L3: rts
+inc @r4
+red @r1
+inc @r6
+L4: rts
+m2
+red L0
+mov -103, @r1
+add 157, L0
+L5: sub L3, @r1
+dec @r6
+rts
+L6: jsr L2
+cmp @r7, @r7
+bne L2
+clr @r1
+add D0, @r4
+bne @r5
+dec L1
+L7: inc L0
+jmp L0
+clr @r0
+not @r4
+lea X0, @r5
+inc L2
+mov @r4, @r6
+L8: bne @r5
+red @r1
+L9: lea L4, L0
+m2
+lea L6, L5
+jsr @r2
+dec L5
+jsr @r1
+L10: jsr L10
+sub 450, L9
+L11: mov -181, L6
+lea L8, @r0
+L12: jmp L10
+rts
+clr @r2
+dec @r0
+red L3
+jmp L2
+dec @r7
+not L5
+add L11, L1
+lea L4, @r4
+inc L3
+bne @r5
+m4
+rts
+prn @r5
+clr @r1
+m4
+clr L9
+sub @r4, @r2
+dec @r6
+prn 491
+mov -1, L11
+cmp -125, 146
+add @r0, L10
+m1
+m0
+lea L2, L24
+bne @r0
+not D0
+m1
+prn 183
+cmp L2, -59
+L13: dec L5
+L14: add L10, @r3
+L15: jmp @r1
+m3
+inc L6
+dec @r7
+jmp @r6
+not L6
+inc @r1
+not L12
+L16: lea L13, L2
+dec L10
+L17: jmp L12
+dec @r6
+red @r3
+bne L7
+inc L2
+m4
+m3
+inc @r0
+lea L14, L0
+dec L0
+red @r6
+rts
+jmp L0
+add L15, @r4
+inc @r7
+jsr L1
+rts
+L18: prn 344
+lea L6, L8
+L19: not L6
+cmp L14, L6
+dec @r5
+prn L2
+not L19
+add @r4, L5
+m3
+sub @r3, L10
+m2
+red @r1
+jmp L4
+clr L11
+inc @r0
+lea L12, @r2
+bne L20
+sub @r4, @r2
+rts
+clr L14
+jmp @r4
+not L19
+sub L19, @r2
+L20: cmp @r0, L16
+jmp L18
+jsr L14
+inc @r6
+jmp L18
+L21: inc @r0
+L22: lea L12, L17
+m1
+L23: red @r5
+jsr L5
+jsr @r1
+inc L7
+rts
+mov @r5, X1
+clr L13
+cmp @r1, @r6
+prn -39
+clr @r3
+jmp L56
+red L2
+add L19, L6
+m2
+sub 505, L53
+add 24, L13
+L24: jmp L10
+jsr L18
+clr L1
+sub -5, L12
+lea L6, L9
+red L20
+not L12
+L25: jmp @r6
+prn -20
+bne L13
+lea L10, @r1
+jsr L8
+m0
+L26: prn L10
+jmp @r6
+add -256, L11
+red @r4
+rts
+jsr @r1
+mov @r2, @r5
+bne L13
+add L0, L49
+dec @r6
+prn @r0
+add @r7, L12
+m2
+rts
+clr L19
+cmp @r4, L2
+rts
+dec @r1
+red @r0
+inc @r3
+m1
+add 236, @r6
+prn S8
+rts
+rts
+red @r4
+not @r7
+clr @r2
+inc @r5
+jmp L24
+add 300, L25
+clr L13
+lea L15, @r1
+L27: rts
+inc L23
+L28: red L22
+dec L21
+sub 97, L25
+rts
+not @r2
+dec L1
+bne L56
+dec L1
+L29: jsr L0
+add L39, @r3
+prn L6
+m4
+cmp L26, L2
+clr L21
+cmp L25, @r6
+not @r3
+add @r7, @r4
+L30: clr L0
+L31: prn -50
+bne @r3
+red L37
+L32: sub -464, @r1
+bne @r3
+rts
+dec L23
+cmp L21, L3
+L33: jmp L7
+jsr @r3
+L34: prn @r2
+dec @r4
+m4
+jmp @r1
+lea L30, L18
+L35: clr @r3
+rts
+mov @r5, L9
+clr L33
+rts
+red @r5
+dec L34
+lea L25, @r1
+bne L29
+rts
+jsr L21
+m3
+add @r4, @r4
+cmp L12, @r2
+dec @r3
+m2
+rts
+m0
+inc L0
+sub -194, @r3
+not @r4
+jsr L30
+rts
+L36: inc L24
+inc @r7
+not @r1
+rts
+red @r2
+not @r2
+add @r1, @r6
+not @r0
+add 20, @r2
+m0
+m1
+not L3
+prn L25
+L37: inc @r1
+L38: mov L0, @r7
+m3
+not S7
+mov @r5, L28
+lea L18, @r0
+jsr L38
+bne L32
+L39: cmp @r7, L14
+L40: red S6
+add 289, L33
+bne @r6
+clr L24
+cmp @r1, -210
+jsr @r4
+rts
+bne L2
+L41: jmp L30
+bne @r3
+L42: jsr L6
+bne L50
+not @r4
+dec @r7
+jsr @r4
+bne @r4
+inc L51
+not L54
+not @r3
+prn L50
+L43: bne @r5
+lea S7, S6
+bne L50
+mov -336, L34
+m2
+prn @r3
+m3
+m0
+dec @r1
+dec L36
+L44: jsr L48
+prn -466
+lea L33, L34
+L45: add 48, L41
+jmp @r3
+jmp @r3
+jmp L51
+clr L15
+jsr L24
+lea L31, @r2
+lea L36, @r4
+mov L7, L33
+add L28, L25
+cmp @r5, L14
+L46: rts
+prn @r3
+m0
+L47: not @r2
+clr @r7
+clr S6
+dec L8
+dec L4
+mov L32, @r6
+add @r7, L27
+L48: bne @r0
+inc @r4
+jsr L23
+m2
+bne @r0
+not L59
+jmp @r3
+L49: cmp 410, L17
+inc @r4
+jmp L6
+inc @r2
+add 165, L13
+m1
+m0
+mov @r0, D0
+not L42
+bne @r5
+add 24, L27
+prn -420
+dec L44
+clr @r6
+L50: mov L50, S4
+bne @r3
+rts
+L51: jsr @r3
+not @r0
+add L40, L5
+red @r7
+sub L22, @r7
+clr @r1
+add 351, L4
+lea X2, @r3
+L52: lea L57, @r1
+L53: cmp 445, 134
+bne L56
+clr @r0
+L54: cmp 399, L20
+jsr L31
+dec @r1
+m2
+L55: add -14, @r2
+L56: jmp D0
+m0
+add L42, S5
+jsr L59
+add -223, L15
+rts
+jsr @r6
+m0
+rts
+jmp @r3
+rts
+mov 250, @r3
+not L10
+not L57
+bne @r4
+not L14
+rts
+red @r3
+jmp @r0
+L57: clr L26
+rts
+jmp @r2
+L58: bne @r0
+inc L23
+prn @r6
+mov D0, @r3
+rts
+jmp L59
+m3
+dec D0
+L59: rts
+not X3
+jmp X4
+stop
+D0: .data -48,143,56,414,262,247,-443,312,87,-295
+D1: .data -453,479,488,-469,-408,491,110,465,-360,-228
+D2: .data -261,-147,127,355,417,-87,-343,-266,-254,377
+D3: .data -451,-100,223,-213,258,216,39,-349,110,-193
+D4: .data 162,-154,-117,-224,327,186,-397,276,145,-323
+D5: .data 89,-119,-471,-423,-254,-340,189,292,-309,-181
+D6: .data -28,-108,-181,-468,356,-375,-25,245,-236,-382
+D7: .data -353,42,-137,17,-78,376,14,-141,71,-56
+D8: .data -93,-160,-93,358,-446,43,-263,244,-473,154
+D9: .data 68,14,-351,-476,-412,103,-26,477,294,492
+S0: .string "coefyguh"
+S1: .string "ghbqfhedshsczwk"
+S2: .string "tfiexbgkeyfomw"
+S3: .string "tyrcwqpqqevextzurir"
+S4: .string "qnemidq"
+S5: .string "egzbakkwsl"
+S6: .string "xwdhikgieob"
+S7: .string "sivecoxtruginls"
+S8: .string "eyar"
+S9: .string "njyt"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r2
+    prn 88
+endmcro
+mcro m1
+    sub @r0, @r5
+    prn 44
+endmcro
+mcro m2
+    sub @r1, @r4
+    prn 72
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 82
+endmcro
+mcro m4
+    sub @r1, @r3
+    prn 61
+endmcro
+lea L0, L0
+jmp @r5
+bne L0
+rts
+inc @r4
+jmp @r7
+inc L0
+lea L0, @r6
+prn @r3
+jmp @r6
+mov 326, @r2
+m3
+m4
+inc @r2
+inc @r0
+red @r5
+m4
+bne L0
+L0: red @r1
+cmp L0, @r6
+L1: bne L0
+add -344, @r2
+jsr L0
+add -470, L0
+sub -142, @r3
+prn @r1
+lea L0, @r6
+L2: mov @r1, @r4
+L3: add X0, L0
+jmp @r4
+L4: rts
+cmp L4, @r0
+m2
+prn @r7
+not L3
+m2
+m0
+not L1
+not @r1
+clr L3
+rts
+jmp @r4
+cmp @r1, @r4
+L5: lea L3, X1
+prn -257
+L6: inc @r2
+L7: sub L4, L0
+jmp L3
+jsr L1
+sub L13, L13
+cmp L2, @r1
+add @r2, @r6
+L8: add -45, @r0
+lea L1, L5
+clr L6
+cmp 419, L2
+L9: jsr L9
+add 303, @r3
+add L8, @r0
+mov L0, @r2
+lea L5, L7
+dec L3
+rts
+prn 62
+dec @r4
+red L6
+jmp L2
+L10: add @r5, @r6
+sub -491, @r7
+m0
+add -450, @r2
+mov @r3, @r3
+jsr @r0
+m3
+jsr S1
+m4
+rts
+dec @r7
+lea L7, @r4
+red L9
+lea S5, L8
+add -373, L8
+rts
+inc @r0
+prn L7
+bne L9
+clr L8
+lea L4, L8
+prn L4
+cmp @r4, @r4
+inc L3
+bne L4
+m3
+bne @r2
+bne D0
+m3
+cmp @r3, L6
+L11: sub 25, @r6
+red L3
+rts
+cmp -361, -427
+dec @r6
+m1
+bne @r7
+sub L10, L0
+dec L4
+bne @r1
+dec L6
+red L2
+mov 478, @r7
+add -56, L11
+mov @r7, L6
+inc @r1
+lea L10, @r2
+jmp L3
+bne @r6
+cmp @r5, @r2
+m1
+sub L8, @r3
+clr L7
+sub L11, L11
+cmp L3, L5
+L12: add -329, @r1
+m0
+m3
+jsr @r6
+cmp @r4, 276
+mov -287, @r2
+cmp @r4, L8
+jsr @r3
+sub L10, L12
+inc L6
+not L9
+jmp L0
+L13: mov L10, @r6
+prn @r7
+rts
+L14: add L4, L1
+dec @r1
+m3
+m2
+clr @r0
+not @r4
+not L9
+not L11
+m3
+m1
+jsr @r3
+jmp L8
+bne L2
+add @r1, @r5
+L15: inc @r5
+dec @r0
+inc @r6
+not L6
+red L6
+red L1
+not L3
+red L57
+add L3, L10
+bne L14
+not @r3
+m1
+rts
+cmp 119, @r6
+prn L8
+jmp L7
+add L10, @r7
+bne @r2
+lea L10, @r1
+add 276, L2
+clr S4
+L16: jmp S7
+not L3
+dec @r3
+inc L12
+L17: bne @r2
+prn -108
+rts
+L18: jsr L14
+jmp L1
+L19: prn -262
+lea L11, L7
+cmp @r5, @r4
+mov @r2, L12
+lea L55, @r0
+mov L16, L17
+inc L9
+bne @r6
+cmp L12, @r3
+m4
+prn L4
+L20: not @r4
+red @r5
+prn L15
+jsr L16
+m3
+L21: red L11
+clr L20
+clr L33
+rts
+m1
+dec L11
+jmp L6
+m4
+not @r3
+prn L35
+jmp L37
+sub L12, @r1
+lea L7, @r6
+jmp L39
+not @r6
+L22: cmp -448, L13
+L23: lea L1, @r2
+mov L5, L50
+mov -496, L9
+L24: add 365, L20
+lea L12, L0
+bne @r5
+L25: clr @r4
+jmp L15
+add @r5, @r6
+cmp -23, @r0
+sub S9, @r7
+bne L16
+inc @r5
+m3
+rts
+L26: sub @r2, @r4
+cmp L16, @r2
+not @r6
+inc @r5
+m3
+dec L20
+inc L24
+bne L14
+cmp -442, @r5
+L27: cmp @r2, @r0
+bne @r4
+add @r0, @r0
+rts
+jmp L23
+mov L53, L18
+mov L24, L0
+cmp -165, L3
+sub L8, @r3
+L28: red L13
+jmp L6
+clr L7
+dec L23
+bne @r1
+mov L6, S2
+dec @r5
+red L23
+L29: sub @r6, L4
+mov L15, S3
+jmp L20
+L30: dec @r4
+jmp L7
+rts
+add L9, @r3
+prn @r0
+L31: prn -337
+m1
+dec @r0
+m2
+cmp -11, 5
+sub -393, @r2
+rts
+bne L39
+inc L21
+rts
+jsr @r5
+m2
+m3
+m2
+dec @r4
+clr L13
+add L30, L1
+L32: mov -91, X2
+inc L1
+red L32
+clr @r2
+cmp @r4, -52
+clr @r4
+mov L15, L22
+m4
+jsr L16
+clr L22
+L33: jsr @r6
+mov L24, S8
+bne D0
+sub 276, L32
+prn -160
+L34: prn @r3
+prn X3
+not S2
+L35: jsr @r4
+L36: inc @r2
+jmp L7
+m2
+rts
+m0
+sub @r5, L29
+dec @r1
+L37: red L6
+L38: lea L30, L8
+sub @r0, L0
+red @r1
+lea L0, @r7
+jmp @r3
+clr L36
+not @r5
+L39: sub 29, L57
+jsr @r3
+bne D0
+L40: red @r2
+red @r5
+rts
+bne @r7
+m4
+red @r1
+jsr @r7
+dec L3
+L41: jmp L17
+cmp 195, -134
+prn @r0
+jmp @r0
+L42: red L33
+bne L2
+not L30
+add L48, L1
+rts
+bne @r7
+prn L24
+m4
+jsr @r7
+L43: red L13
+jsr L24
+L44: add @r3, @r7
+rts
+jsr @r5
+mov L43, L42
+prn 413
+bne L17
+inc X4
+cmp 162, D0
+clr L39
+L45: cmp D0, L6
+m2
+clr L5
+jsr S0
+jsr L34
+prn L37
+jsr @r6
+inc @r0
+inc L27
+add 199, @r1
+lea L37, L23
+sub L34, @r3
+add @r4, L1
+jsr L30
+sub L0, L15
+prn L4
+mov @r0, L0
+L46: not @r6
+jsr @r2
+jmp @r0
+L47: dec @r2
+cmp -24, D0
+rts
+prn @r3
+cmp @r1, L2
+prn -488
+rts
+clr @r3
+sub L10, @r2
+mov @r7, @r5
+inc @r4
+cmp 52, L39
+L48: cmp L3, -400
+L49: bne L43
+prn 356
+not L25
+L50: jsr @r3
+L51: dec @r7
+sub -379, L40
+L52: jsr S1
+L53: sub L50, L53
+sub @r4, L23
+sub @r4, @r4
+cmp @r7, -437
+lea L25, L5
+sub -479, L26
+bne L24
+lea L47, @r7
+sub 226, @r5
+mov 184, D0
+cmp -348, -421
+add @r0, @r5
+jmp L38
+sub @r5, L28
+jsr @r5
+not @r0
+mov @r5, @r2
+cmp 133, -330
+jsr @r5
+mov @r4, S4
+not @r1
+m3
+not @r3
+L54: bne S3
+sub @r7, @r6
+cmp L12, L49
+clr L38
+L55: lea L36, @r0
+L56: bne @r2
+red @r5
+red L43
+bne @r3
+rts
+cmp -200, @r7
+jsr @r7
+dec L12
+clr @r7
+L57: rts
+inc L58
+mov @r4, L59
+lea L51, @r2
+L58: dec @r0
+L59: add @r3, @r5
+add @r6, D0
+red D0
+cmp @r5, L58
+m2
+mov @r1, @r1
+m1
+rts
+rts
+clr D0
+stop
+D0: .data -188,-348,295,-276,267,-106,92,-87,-51,94
+D1: .data 485,386,55,-65,151,-405,246,-242,-178,68
+D2: .data -60,-59,-321,-326,-291,-474,-265,126,104,139
+D3: .data 166,304,-411,153,-472,-409,250,-266,30,373
+D4: .data -385,457,397,19,-350,-155,-386,-113,331,197
+D5: .data 253,6,478,15,366,-404,291,83,-127,116
+D6: .data -183,488,431,-333,337,192,-457,-163,-398,-460
+D7: .data 273,383,345,332,166,-30,-496,-426,-56,106
+D8: .data 457,13,-217,278,305,-5,450,-408,-495,91
+D9: .data -441,-245,-286,388,104,238,0,-179,468,358
+S0: .string "viwngqrdau"
+S1: .string "evftbikfzpceoxpfljri"
+S2: .string "nkrmqquxdivl"
+S3: .string "wljmxuh"
+S4: .string "tpngyevbcpxpymefp"
+S5: .string "twq"
+S6: .string "grfcxdsiwntsypdscaxc"
+S7: .string "rmhiumvji"
+S8: .string "avjtmqocpqr"
+S9: .string "oehxsloxjjsyrx"
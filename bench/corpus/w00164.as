@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r5
+    prn 26
+endmcro
+mcro m1
+    sub @r4, @r6
+    prn 43
+endmcro
+mcro m2
+    sub @r3, @r1
+    prn 37
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 59
+endmcro
+mcro m4
+    sub @r3, @r1
+    prn 86
+endmcro
+jmp @r6
+jmp L0
+L0: jmp L0
+clr L0
+lea L0, L0
+lea L0, @r6
+L1: inc @r2
+prn @r3
+rts
+red @r2
+cmp @r3, L1
+jmp @r1
+jsr L11
+dec @r5
+rts
+add 143, L0
+prn L0
+cmp -11, @r5
+L2: bne @r2
+lea L0, @r2
+prn L1
+dec L2
+jsr S9
+add @r2, L0
+m0
+add L2, L2
+inc L2
+clr @r0
+add @r6, L2
+prn L1
+prn 202
+inc @r6
+L3: cmp L1, 375
+m3
+inc L2
+bne L1
+sub L2, L3
+rts
+dec @r4
+red @r5
+lea L16, @r4
+red L1
+jmp @r1
+mov 480, L1
+jsr L0
+lea L0, L42
+bne L3
+bne L1
+lea D0, L0
+mov 264, L53
+mov L1, L1
+sub L1, @r7
+not L0
+bne @r1
+jsr X0
+lea L0, @r3
+jsr L0
+clr L2
+not @r7
+inc L2
+clr @r1
+L4: dec L0
+add @r6, L1
+L5: jmp @r6
+jsr @r3
+L6: cmp 55, -99
+clr L6
+jmp L3
+m1
+sub L3, @r3
+cmp -401, @r5
+not L0
+dec @r7
+bne @r7
+add L2, @r3
+rts
+mov L25, L1
+jmp L5
+L7: cmp @r3, 90
+inc L0
+L8: bne L8
+L9: sub 348, @r2
+jmp L4
+dec L5
+L10: jsr L4
+cmp 23, @r0
+jmp @r6
+m2
+inc L7
+m3
+bne L5
+red L1
+prn 337
+jmp L1
+L11: red L1
+L12: lea L0, L11
+L13: lea L29, @r7
+add -423, L13
+sub 435, L7
+m4
+cmp L10, @r6
+prn -152
+prn 75
+lea L12, @r0
+prn -71
+lea L6, L12
+jsr @r0
+not @r4
+cmp @r1, 313
+L14: not X1
+sub @r0, @r0
+clr L0
+add -196, L11
+L15: not L8
+jmp @r5
+inc L11
+L16: clr L4
+bne L8
+dec @r4
+dec L15
+L17: jmp L55
+red L10
+sub L16, L1
+m4
+rts
+jmp L8
+m0
+lea L15, @r5
+cmp L15, L23
+m2
+sub L12, L15
+clr L9
+inc @r3
+m3
+L18: inc L1
+prn L3
+red L13
+dec @r5
+jmp @r6
+red S6
+red L15
+m0
+bne @r2
+sub L15, L5
+red @r1
+sub -446, @r7
+L19: prn @r6
+cmp 393, @r4
+jsr L17
+prn 461
+cmp @r4, -511
+cmp @r7, @r1
+L20: bne L6
+dec L8
+jmp @r4
+L21: sub L17, @r1
+lea L6, @r3
+m1
+not @r1
+m1
+jmp @r4
+L22: bne L2
+m1
+L23: cmp -370, L13
+dec @r0
+add 350, L23
+m0
+jmp L18
+dec L5
+bne @r2
+jsr @r1
+m4
+mov L12, @r3
+red @r1
+clr @r6
+prn 63
+prn @r4
+cmp 340, L14
+not @r2
+jmp L9
+L24: jsr L6
+not @r3
+cmp 447, 287
+L25: inc @r0
+L26: jmp @r7
+dec L25
+dec L14
+add L25, L2
+jsr L4
+inc L19
+prn @r4
+jmp @r4
+cmp L7, L6
+cmp -239, L2
+L27: mov @r1, L6
+L28: bne @r4
+jsr @r0
+mov @r3, L5
+not L28
+rts
+inc @r6
+m4
+bne @r4
+add -338, @r0
+rts
+add L49, @r5
+mov 233, @r0
+dec L26
+sub L26, @r1
+dec @r4
+lea S6, L14
+lea L3, @r3
+inc @r7
+inc @r4
+bne @r4
+bne L18
+add L6, @r1
+L29: dec L16
+L30: jmp L29
+m1
+jsr L30
+sub -162, L1
+red @r1
+jsr @r7
+dec @r7
+clr @r5
+add 508, @r2
+mov 326, S9
+not @r2
+m4
+m0
+prn 392
+inc L29
+not L2
+rts
+mov -302, @r4
+lea L28, L3
+not @r3
+prn -38
+m0
+rts
+bne X2
+m4
+jmp @r3
+add 244, @r0
+clr S0
+clr @r4
+jsr @r4
+red L26
+L31: lea L29, @r4
+clr L14
+lea L9, L4
+L32: add 166, L20
+L33: mov 66, L1
+prn @r7
+L34: clr L6
+m1
+inc @r3
+clr L0
+inc @r2
+prn -158
+L35: jsr @r6
+dec @r3
+jsr @r2
+sub @r3, L31
+inc L23
+clr @r0
+mov -267, @r5
+inc @r1
+dec @r4
+dec @r2
+cmp -423, L29
+sub L13, L12
+red D0
+jmp @r5
+rts
+dec L9
+sub @r6, @r4
+prn -501
+inc L32
+m4
+red @r7
+m1
+clr L13
+jmp @r3
+red @r4
+not L21
+sub L36, @r7
+prn 357
+lea L12, L21
+jsr L18
+rts
+clr L8
+red @r6
+sub -358, L4
+m4
+prn @r5
+rts
+not @r6
+inc L19
+L36: red L34
+L37: add L29, @r3
+mov L23, S9
+clr @r5
+jmp L34
+L38: not L18
+prn @r5
+dec @r6
+jmp L58
+lea L35, @r4
+m0
+sub 32, L55
+m2
+clr L0
+bne @r1
+prn @r7
+prn -212
+bne L29
+sub -17, @r4
+bne L0
+inc @r0
+cmp @r0, 208
+mov L7, L16
+m3
+m4
+dec @r2
+dec @r5
+mov @r0, @r6
+bne @r1
+rts
+clr @r5
+sub L36, L50
+sub L11, @r7
+L39: cmp @r6, @r0
+dec @r7
+rts
+clr L10
+not L34
+L40: red S0
+add -477, L32
+L41: jsr @r0
+L42: clr L23
+clr L36
+not X3
+L43: red @r7
+sub @r5, L20
+L44: dec @r4
+inc @r3
+add L47, L7
+add L34, @r4
+L45: dec @r5
+dec L45
+sub @r4, @r5
+rts
+mov L34, L38
+cmp 276, @r2
+L46: not @r2
+clr L18
+not @r0
+red D0
+m3
+prn @r1
+L47: red @r1
+mov -324, L38
+mov L9, L19
+m2
+sub -335, L26
+red L55
+m4
+jmp L11
+cmp -89, -258
+L48: sub @r0, L40
+mov L28, L16
+L49: dec L43
+prn @r6
+dec @r0
+dec @r6
+dec L26
+jmp L59
+cmp L47, L39
+inc @r7
+rts
+L50: dec L23
+dec L13
+jsr L29
+red @r6
+lea S3, @r4
+not L26
+bne @r7
+m1
+bne L56
+not @r6
+inc @r0
+L51: add @r6, @r4
+jsr @r2
+prn @r7
+red D0
+not L21
+dec L55
+L52: red L16
+L53: mov L14, @r5
+m0
+bne @r4
+sub 207, L55
+clr @r1
+cmp L14, -96
+not L48
+jmp @r4
+prn @r2
+lea L50, L22
+L54: bne L28
+prn S4
+red @r6
+jsr @r7
+inc @r5
+m1
+prn @r1
+jsr @r7
+red @r1
+m1
+prn L26
+m3
+sub -238, L58
+red @r1
+jsr @r1
+L55: add 77, D0
+m2
+L56: bne L35
+m1
+dec L46
+cmp @r3, D0
+prn @r3
+L57: not @r2
+dec L30
+clr L16
+cmp D0, X4
+lea L59, L25
+L58: bne S8
+prn L59
+L59: jmp D0
+stop
+D0: .data -36,-477,329,316,-124,175,-474,-418,183,-70
+D1: .data 365,72,20,342,-405,-156,-111,-257,-449,279
+D2: .data 209,-9,-73,-250,-40,-117,214,-342,-456,-112
+D3: .data 275,-42,-438,-349,-445,462,-92,-407,473,276
+D4: .data 127,-35,-333,-450,-479,-183,-48,-419,-104,302
+D5: .data -313,62,-342,-256,-388,26,-163,15,-436,39
+D6: .data 402,141,-57,-173,416,-317,101,175,-359,-295
+D7: .data -16,-237,56,-344,0,-265,-467,372,259,-17
+D8: .data -469,-48,-280,-94,17,90,-246,112,-25,209
+D9: .data 402,8,-87,485,205,355,-181,-456,-110,-398
+S0: .string "qpmdlzirxjzvwyztgxmj"
+S1: .string "lfhkxmx"
+S2: .string "oiwyxeaytl"
+S3: .string "w"
+S4: .string "qisorm"
+S5: .string "rhg"
+S6: .string "izzujcw"
+S7: .string "poe"
+S8: .string "sykwwkgnjcjmahfjsp"
+S9: .string "oulyjetbnln"
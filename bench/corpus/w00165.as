@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r0
+    prn 96
+endmcro
+mcro m1
+    sub @r1, @r7
+    prn 41
+endmcro
+mcro m2
+    sub @r5, @r7
+    prn 2
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 35
+endmcro
+mcro m4
+    sub @r5, @r7
+    prn 10
+endmcro
+m4
+lea D0, L0
+sub @r2, L0
+rts
+m2
+cmp @r6, -212
+rts
+not @r6
+prn @r2
+rts
+m0
+cmp L0, @r3
+mov L0, @r6
+L0: inc L0
+L1: jmp L0
+jmp @r5
+jmp @r5
+dec L0
+rts
+L2: rts
+red L1
+jmp @r5
+cmp -475, 133
+lea L2, @r6
+inc @r4
+cmp L0, @r6
+m4
+inc @r0
+rts
+bne @r1
+inc L2
+L3: inc L0
+jmp L3
+jmp @r2
+L4: cmp 284, L1
+inc @r2
+mov L4, L3
+red @r6
+m2
+rts
+jmp @r1
+inc L0
+lea X0, @r0
+L5: jsr L0
+mov -366, @r1
+m0
+m3
+lea L5, @r7
+red L36
+L6: bne L5
+bne @r6
+m3
+sub L5, @r7
+L7: red @r0
+jmp @r2
+jsr L2
+clr L3
+red @r2
+jmp D0
+prn 5
+jmp @r1
+m3
+m0
+jmp @r4
+not L3
+sub @r6, @r0
+L8: red @r5
+L9: cmp L39, L7
+L10: dec @r4
+add @r2, L6
+inc L2
+mov @r2, @r3
+lea L4, L2
+jmp @r6
+L11: add 45, L0
+jmp L6
+dec L11
+add L14, @r5
+mov 509, @r5
+bne @r2
+m0
+lea L8, @r4
+inc @r2
+sub -372, L2
+lea L7, L1
+red L4
+bne @r1
+jmp L5
+rts
+m1
+rts
+inc @r5
+m3
+add @r5, @r6
+not L11
+dec L5
+m1
+L12: sub L3, @r3
+mov 475, @r3
+jsr L1
+inc @r5
+L13: dec L1
+not @r5
+m1
+L14: not L0
+prn -385
+red @r2
+red @r5
+lea L0, @r6
+sub 9, L13
+inc L8
+clr @r0
+L15: add L5, S1
+dec L12
+lea L13, @r2
+L16: bne @r5
+L17: rts
+jsr L16
+lea L13, L56
+not L2
+lea L14, L5
+m2
+jmp L1
+jsr L4
+m4
+L18: rts
+jsr @r0
+L19: clr @r7
+L20: mov @r5, @r4
+clr L20
+L21: lea L13, @r1
+L22: not @r5
+inc D0
+dec L5
+jsr L16
+m4
+inc L11
+clr D0
+jsr @r0
+L23: cmp L2, 322
+dec @r6
+red @r5
+add -387, @r4
+m2
+lea L18, @r1
+L24: jmp @r2
+red L19
+bne L13
+dec @r2
+jmp @r6
+jsr S4
+dec L14
+add @r3, @r0
+add -240, L5
+L25: dec @r6
+rts
+rts
+cmp @r4, L18
+jmp L15
+sub L22, L2
+jsr L1
+mov S8, @r3
+m4
+bne @r4
+L26: not L20
+mov 485, S7
+lea S4, L20
+cmp @r1, @r5
+red @r7
+inc @r0
+cmp 15, -306
+cmp @r1, @r6
+not @r0
+lea L22, @r1
+jsr L10
+m2
+jsr L11
+inc L0
+jmp @r6
+m0
+prn 216
+rts
+prn @r3
+red L8
+inc D0
+L27: mov -51, L26
+clr @r5
+mov -153, L10
+not L6
+jmp L14
+L28: bne L6
+cmp @r5, L21
+clr L16
+cmp 92, @r5
+L29: jsr L21
+L30: rts
+add L11, L20
+cmp @r4, 36
+cmp L34, @r4
+jmp L19
+L31: clr @r4
+sub @r5, @r4
+jmp @r3
+cmp -168, D0
+not @r3
+jsr L25
+inc @r3
+cmp S1, -336
+bne @r4
+inc L11
+inc @r3
+clr L4
+prn L12
+prn -52
+mov -469, L5
+not L21
+cmp @r1, -30
+clr @r5
+rts
+not L6
+rts
+add @r6, L25
+L32: sub @r3, @r4
+L33: jsr D0
+sub 499, @r2
+sub @r6, L13
+cmp 510, -345
+L34: sub L33, @r4
+not @r7
+clr @r5
+m1
+mov L17, L19
+inc L23
+add S5, L1
+inc @r0
+inc @r7
+rts
+red L7
+prn -414
+jsr @r0
+dec @r7
+add L17, L28
+clr @r0
+cmp -488, @r2
+prn @r0
+red L27
+jsr @r5
+not L2
+bne @r2
+bne L33
+clr @r2
+add L31, @r2
+inc @r4
+jsr L41
+mov 50, @r0
+L35: bne L15
+bne L15
+lea L55, L2
+prn -119
+inc @r4
+sub @r4, L20
+not L29
+add L30, @r5
+rts
+m0
+bne L10
+L36: prn 210
+mov L14, L36
+add L29, @r4
+m0
+prn @r6
+inc L21
+jmp L17
+prn @r6
+L37: sub 39, @r0
+jsr L6
+inc @r7
+add L0, L32
+m1
+L38: cmp S8, L12
+m3
+rts
+rts
+red S6
+clr L6
+bne L7
+jsr @r0
+not L12
+inc @r6
+not @r7
+L39: red L58
+m3
+inc L47
+jsr @r5
+sub S9, @r7
+L40: clr @r6
+m3
+sub X1, L49
+cmp 182, 13
+bne @r7
+add 192, @r0
+not L11
+bne @r5
+L41: dec L32
+lea L36, @r4
+cmp @r5, L30
+jsr D0
+inc @r5
+add -384, L21
+inc D0
+L42: red @r3
+add -406, L37
+dec L23
+jmp @r7
+L43: sub 40, X2
+jsr @r6
+sub @r3, @r1
+sub @r1, @r4
+cmp @r6, -162
+m1
+clr L7
+red @r4
+add -444, L40
+clr L20
+lea L3, L35
+red @r5
+clr @r5
+add @r0, L43
+bne @r2
+m2
+cmp @r0, L40
+sub L4, @r3
+clr L21
+jmp @r7
+bne L30
+not @r6
+m0
+jsr L9
+inc L26
+jsr @r6
+inc @r4
+bne L36
+clr @r3
+m0
+rts
+clr @r0
+jmp @r1
+clr @r5
+dec L0
+red @r2
+L44: not @r7
+red @r7
+red @r3
+inc @r0
+prn @r3
+bne @r0
+mov 499, @r3
+sub @r0, L10
+jmp @r0
+prn L41
+red @r7
+jmp @r7
+clr L21
+add L17, L12
+inc X3
+L45: red @r5
+dec @r4
+L46: add @r0, @r4
+sub L24, @r5
+L47: jsr @r6
+sub @r6, L52
+jmp @r2
+L48: lea L44, @r1
+lea S4, @r7
+not @r5
+sub L37, @r2
+jmp L7
+clr S7
+bne @r3
+bne L11
+L49: clr L41
+mov -249, L6
+inc L36
+not L31
+dec @r5
+L50: mov L53, L29
+cmp L12, L5
+L51: lea L31, L0
+clr L15
+jmp L51
+sub L4, @r1
+L52: lea L50, L52
+lea L22, @r6
+bne L57
+red L45
+L53: add @r0, L27
+m1
+cmp @r6, 439
+lea L53, @r2
+add @r6, @r3
+m4
+L54: cmp -248, @r0
+L55: dec L49
+cmp -349, 120
+L56: rts
+L57: cmp L12, 500
+L58: jmp D0
+m2
+clr @r2
+inc L24
+m0
+bne L8
+prn 355
+lea L50, L8
+inc @r0
+cmp L3, -303
+bne @r6
+bne L51
+dec L50
+m0
+jmp L10
+rts
+inc L17
+m2
+inc @r2
+m2
+inc @r7
+rts
+red @r0
+lea S1, @r5
+mov @r0, @r6
+red @r3
+not @r1
+bne @r5
+bne @r0
+inc L59
+L59: not D0
+prn S2
+sub D0, L36
+sub X4, @r7
+stop
+D0: .data -160,-189,206,-66,-283,-128,-275,-12,-47,-416
+D1: .data -391,-3,486,-316,-289,471,-317,370,245,-102
+D2: .data -308,45,-111,305,-290,-236,27,-111,49,151
+D3: .data -223,-267,-90,-151,-276,-214,-141,-159,-284,-313
+D4: .data -187,-360,-475,165,-495,21,-146,-22,0,93
+D5: .data 38,-105,-78,237,368,-207,46,367,398,-162
+D6: .data -99,-149,317,-299,-63,-289,87,-73,-146,-176
+D7: .data 97,-178,220,-104,128,413,-128,378,112,-65
+D8: .data 111,298,-287,355,-310,-265,98,-149,199,143
+D9: .data -107,-380,-30,-211,-181,399,-304,-440,-391,-128
+S0: .string "dngqhsamudqwqnksnu"
+S1: .string "yxavgkrrmrd"
+S2: .string "cjklihxdbisjwk"
+S3: .string "ihxjonreiycbcsrydaj"
+S4: .string "sgplomcfrnodmbvudm"
+S5: .string "eilrurzibyq"
+S6: .string "ajaqxdtv"
+S7: .string "jn"
+S8: .string "kgqasulcxtk"
+S9: .string "fcxx"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r2
+    prn 35
+endmcro
+mcro m1
+    sub @r5, @r1
+    prn 40
+endmcro
+mcro m2
+    sub @r0, @r5
+    prn 0
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 12
+endmcro
+mcro m4
+    sub @r7, @r5
+    prn 67
+endmcro
+jsr L0
+not @r6
+rts
+sub L0, L0
+L0: jmp @r5
+L1: lea L1, @r6
+inc @r0
+red @r1
+not D0
+mov 349, @r1
+L2: clr L1
+clr @r4
+inc L2
+dec L2
+L3: dec @r7
+L4: jsr @r6
+dec L0
+L5: add -462, @r5
+bne L3
+m2
+prn @r0
+lea L3, L4
+m2
+cmp @r6, -231
+bne @r3
+mov L3, @r6
+jsr D0
+rts
+cmp L2, -132
+L6: mov L1, L4
+inc @r4
+mov L0, @r4
+m2
+not @r3
+prn L3
+rts
+L7: not @r5
+add L1, @r6
+jsr @r7
+jmp L1
+bne L2
+sub 100, @r4
+jsr @r2
+bne @r7
+prn 180
+add @r4, L5
+jmp L6
+not L37
+L8: dec @r1
+jsr @r4
+not @r6
+not L5
+dec @r5
+mov -276, @r0
+dec L3
+jmp L7
+bne @r6
+jsr @r2
+red @r1
+m4
+not @r7
+rts
+jmp L0
+rts
+lea L6, @r6
+prn -179
+prn L2
+mov @r4, L1
+clr @r3
+cmp -415, 50
+clr L5
+dec L14
+rts
+jsr @r1
+mov L3, L8
+L9: jsr L2
+red L3
+cmp -274, -380
+m3
+dec L3
+jmp @r0
+clr L5
+prn 389
+rts
+clr L8
+lea L7, @r5
+bne @r7
+m2
+L10: jsr L3
+L11: cmp L8, -157
+dec L6
+clr L7
+mov @r1, L19
+L12: cmp @r2, L5
+m3
+L13: red @r5
+jsr L11
+red L12
+L14: prn L0
+red @r4
+bne @r3
+add L8, @r6
+bne @r1
+clr L8
+jsr @r6
+rts
+prn @r3
+sub 4, @r6
+sub L11, @r1
+mov 371, @r7
+not L1
+rts
+m0
+jsr L6
+L15: prn @r5
+not @r5
+bne L15
+inc L10
+m2
+m4
+rts
+clr L0
+lea L7, L19
+rts
+sub -490, L5
+jsr @r7
+lea L3, L15
+sub L15, @r5
+jmp L10
+rts
+prn L5
+red @r7
+m4
+rts
+prn -137
+mov L11, @r1
+clr @r5
+clr @r1
+sub 390, @r5
+L16: bne D0
+not @r6
+rts
+inc @r0
+L17: dec X0
+m3
+L18: clr L14
+dec @r3
+inc L11
+sub L15, @r7
+rts
+clr @r0
+prn 114
+clr L6
+add @r7, @r4
+inc @r1
+L19: add 407, L18
+prn -90
+cmp 106, L4
+m1
+prn @r6
+lea L3, @r2
+clr @r1
+mov @r1, X1
+mov 107, S9
+rts
+jsr L6
+L20: bne @r0
+rts
+m4
+dec L18
+clr @r1
+add 466, @r3
+L21: add @r6, @r1
+prn L11
+m2
+cmp -214, 449
+jsr @r0
+rts
+rts
+sub @r6, @r5
+jsr L21
+not @r1
+jmp @r1
+prn L7
+m3
+L22: rts
+mov L17, @r6
+m1
+bne @r3
+bne L20
+cmp @r6, L16
+dec @r4
+not L15
+bne @r3
+sub -87, L10
+m3
+mov 260, @r4
+L23: sub D0, L17
+lea L9, @r3
+L24: rts
+not @r7
+cmp L18, 105
+lea L18, @r1
+mov L2, @r2
+mov 84, L17
+rts
+cmp L10, -54
+inc D0
+prn -373
+clr @r6
+dec L0
+jmp L16
+add L12, @r4
+L25: red L4
+dec L7
+prn @r6
+dec @r3
+red @r2
+L26: jmp @r2
+red @r1
+clr @r3
+sub 215, @r1
+prn L18
+inc L55
+sub @r1, L21
+m1
+dec @r1
+clr L1
+sub @r7, @r6
+L27: mov L11, L21
+rts
+lea L6, @r7
+mov L3, L23
+m4
+add @r3, @r4
+m3
+m1
+jmp @r1
+rts
+dec @r4
+jsr L11
+m4
+jsr L14
+clr @r0
+prn L2
+L28: jsr L17
+sub 316, S1
+sub L8, @r7
+bne X2
+lea L26, @r7
+red @r3
+L29: prn @r7
+m0
+cmp L22, @r2
+sub @r2, @r4
+clr L18
+lea L19, @r0
+m2
+m2
+cmp @r3, @r3
+inc L28
+jsr @r3
+mov -146, L14
+bne @r5
+inc L19
+rts
+rts
+red @r5
+clr @r0
+cmp -19, @r6
+mov 401, @r7
+clr L29
+jmp L6
+jmp L9
+mov 191, @r6
+prn L15
+L30: not L1
+bne L17
+cmp @r0, 386
+jsr L20
+dec L11
+red @r6
+jsr L15
+prn @r6
+rts
+mov L22, L33
+L31: jmp @r1
+add L0, L25
+rts
+L32: clr @r3
+rts
+m2
+jsr @r1
+clr L0
+add L16, L5
+lea L30, @r5
+clr L14
+sub -304, @r2
+jsr @r6
+not X3
+sub @r4, @r1
+mov L30, L28
+lea L0, L35
+dec @r4
+L33: mov @r6, L21
+L34: cmp 499, L32
+L35: dec L32
+L36: mov L31, L54
+add -423, L59
+m0
+red @r6
+inc D0
+L37: bne L27
+dec L4
+L38: inc @r1
+L39: bne L14
+prn @r6
+mov 348, @r6
+L40: dec @r5
+add @r3, L10
+inc L21
+m3
+red L19
+rts
+L41: cmp -364, 26
+inc L16
+not L17
+mov L58, @r4
+red L22
+L42: jmp @r5
+add -503, L30
+sub @r6, L23
+prn @r6
+L43: prn @r6
+mov @r5, L12
+cmp L9, @r5
+bne D0
+m2
+mov 344, @r0
+bne @r5
+m4
+L44: red L27
+L45: cmp 312, @r5
+clr L36
+prn -120
+dec L32
+cmp @r5, -91
+sub -444, S4
+lea X4, L16
+sub -101, @r7
+prn @r2
+inc @r7
+mov L8, @r5
+L46: not L4
+red L20
+rts
+jmp L35
+jmp @r6
+rts
+L47: not L21
+jmp @r7
+red @r7
+bne L16
+lea L19, L49
+cmp -80, 212
+dec @r3
+cmp @r3, 486
+jsr @r0
+m2
+dec @r6
+red @r2
+inc L26
+inc @r2
+red @r3
+L48: lea L40, @r2
+sub L55, L8
+lea L46, L30
+bne L28
+inc @r4
+mov @r6, L58
+bne @r7
+bne @r4
+m1
+clr L5
+prn 305
+jmp @r6
+prn @r6
+L49: rts
+rts
+bne @r5
+cmp 128, 298
+L50: mov @r5, @r1
+cmp @r0, -90
+cmp L40, -268
+inc @r7
+L51: dec @r5
+m4
+L52: inc @r3
+rts
+rts
+sub L11, @r4
+L53: jmp @r1
+L54: bne L4
+cmp L17, @r7
+jsr L57
+inc L59
+cmp L0, 456
+jmp @r4
+add 51, @r0
+cmp @r7, @r4
+sub @r6, @r5
+dec @r3
+mov 341, L59
+m1
+L55: inc S0
+rts
+not @r5
+mov -283, @r7
+prn 64
+not L29
+L56: bne @r7
+m4
+clr L50
+lea L59, S9
+inc @r2
+dec @r0
+sub L59, @r0
+prn @r3
+m3
+L57: jmp L58
+cmp 323, L58
+m3
+L58: bne D0
+red L59
+add S9, L59
+L59: mov 190, S6
+bne D0
+m2
+not D0
+m1
+stop
+D0: .data -274,-91,-174,-330,-456,-491,-64,274,22,-498
+D1: .data -490,142,270,-215,-36,79,-219,-436,-301,-298
+D2: .data 135,484,153,-82,464,237,464,227,-312,-140
+D3: .data 181,358,332,343,-329,-435,460,471,340,-179
+D4: .data -338,178,149,296,491,-99,-88,-129,-219,-260
+D5: .data -138,208,432,-345,-487,178,362,-80,-431,466
+D6: .data 214,-93,23,144,7,-37,-32,-481,373,1
+D7: .data -106,14,160,271,-130,-60,-140,-309,276,197
+D8: .data -349,-60,313,-122,389,259,290,-483,479,59
+D9: .data 165,-134,-199,-170,235,-441,176,-407,292,213
+S0: .string "l"
+S1: .string "nuzylmjgctfvuyacehha"
+S2: .string "smobqvbsfviezybvc"
+S3: .string "hgk"
+S4: .string "wwwbizqeaq"
+S5: .string "mpwpwjvpkxxqg"
+S6: .string "n"
+S7: .string "fx"
+S8: .string "jxzdosvcgmmkslzijdny"
+S9: .string "azdjjbalyteffidy"
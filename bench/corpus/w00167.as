@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r5
+    prn 5
+endmcro
+mcro m1
+    sub @r1, @r2
+    prn 38
+endmcro
+mcro m2
+    sub @r2, @r3
+    prn 65
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 88
+endmcro
+mcro m4
+    sub @r1, @r4
+    prn 91
+endmcro
+lea L0, L0
+m2
+m0
+L0: lea L0, S6
+cmp @r2, @r0
+rts
+sub 395, L0
+red @r5
+cmp @r1, 327
+bne L0
+bne L0
+L1: rts
+dec L1
+inc L1
+bne L0
+m3
+add @r4, @r5
+inc S0
+m1
+clr L1
+bne L1
+inc @r1
+cmp L1, L0
+prn -297
+add @r2, L1
+m4
+m1
+cmp L0, 279
+m3
+m0
+m0
+jmp L1
+bne @r7
+m3
+inc @r2
+sub @r5, @r5
+rts
+m1
+jmp @r4
+clr @r6
+rts
+bne @r0
+prn L0
+prn @r5
+clr @r4
+rts
+bne @r3
+L2: jsr @r2
+prn @r5
+prn @r4
+prn @r2
+jsr L1
+jsr L2
+sub @r7, L2
+L3: dec @r0
+m0
+mov L0, L2
+mov 9, @r5
+sub @r1, @r7
+red @r6
+lea L3, @r4
+red L3
+lea L2, @r7
+sub @r0, @r2
+sub -495, @r0
+dec L1
+cmp @r7, L2
+lea L3, @r5
+sub 394, @r3
+inc L1
+jsr @r4
+lea L3, @r3
+cmp L0, -374
+m0
+bne @r0
+clr @r5
+cmp @r0, 235
+L4: red L1
+L5: dec @r6
+red @r6
+red L4
+L6: cmp -234, @r4
+L7: rts
+cmp L0, L5
+add L3, S0
+add 10, @r4
+clr @r3
+sub L7, L1
+red @r0
+bne D0
+L8: jsr L6
+lea L4, @r3
+clr L1
+m1
+rts
+red L5
+rts
+m3
+prn @r6
+lea L8, L1
+dec L3
+jsr L1
+prn @r6
+jmp @r0
+cmp L3, @r4
+dec @r2
+cmp @r3, L4
+jmp L7
+red L2
+L9: add @r1, L8
+L10: sub L5, L2
+jmp L10
+jmp L1
+rts
+not @r4
+m4
+add L10, @r0
+L11: not L7
+L12: not L5
+L13: clr @r0
+cmp @r4, -51
+not L8
+clr L28
+mov S8, L27
+sub @r7, @r2
+inc @r5
+mov @r3, L12
+jsr @r1
+not L11
+not @r2
+L14: prn 360
+L15: clr L0
+prn -230
+jmp L9
+jsr @r7
+jmp @r5
+lea L15, @r1
+clr L11
+m4
+sub @r4, @r3
+dec @r1
+add L1, @r0
+m0
+L16: lea L6, L14
+m0
+prn L48
+inc L15
+bne L0
+not @r1
+m3
+L17: red @r7
+bne @r2
+mov 61, @r2
+clr L6
+L18: sub 348, L7
+add 392, L2
+lea L17, L4
+not @r4
+not L15
+mov L51, L11
+L19: red L13
+cmp @r5, L15
+clr L1
+prn -129
+m1
+rts
+m0
+add L19, @r3
+L20: clr @r2
+mov 47, @r2
+add L1, S6
+L21: rts
+cmp @r5, @r7
+not L28
+jmp L18
+L22: rts
+not @r2
+L23: cmp 178, L12
+not @r1
+inc @r0
+sub L23, L21
+L24: jmp @r5
+lea L13, @r2
+inc L12
+jsr L10
+L25: add @r0, L25
+mov L17, @r0
+m2
+jsr L4
+not @r0
+dec L6
+lea L11, @r6
+L26: sub 406, L19
+m2
+not @r1
+rts
+m2
+jsr L19
+inc L14
+cmp @r0, -416
+m4
+L27: bne @r4
+clr @r2
+L28: mov @r4, L8
+rts
+sub @r1, L29
+mov L3, @r5
+L29: rts
+dec @r5
+sub @r2, @r0
+jsr L11
+rts
+L30: jmp @r5
+inc @r1
+red L38
+dec @r3
+lea L23, @r6
+jsr L22
+red @r6
+not @r1
+jmp L27
+add 256, L22
+m2
+inc @r3
+clr @r1
+clr L17
+not @r0
+jsr @r0
+mov L2, @r0
+inc @r3
+jmp L3
+clr L23
+not L2
+clr @r5
+not L10
+dec L18
+rts
+L31: jsr @r5
+jmp L14
+lea L1, L26
+mov L14, @r0
+bne L21
+prn L56
+add L17, D0
+L32: prn L1
+cmp L10, L3
+bne L5
+inc L19
+prn -62
+m0
+rts
+sub -415, @r3
+sub L22, L9
+rts
+not L26
+L33: clr @r4
+sub L27, @r5
+prn @r5
+m2
+sub -376, @r6
+inc @r7
+dec L22
+m0
+m4
+bne L18
+L34: bne @r1
+m0
+jmp L7
+L35: dec @r0
+jsr L3
+m3
+add L11, L29
+sub -375, L13
+L36: lea L12, @r0
+rts
+inc L21
+not @r5
+cmp 121, @r1
+clr @r1
+bne @r4
+mov @r1, @r4
+rts
+add @r1, L26
+mov 306, @r6
+cmp L31, X0
+L37: cmp 17, L14
+m0
+L38: clr @r1
+L39: not L34
+jmp L33
+L40: lea L15, @r2
+prn @r4
+clr @r5
+not @r3
+jsr @r2
+L41: add @r7, L28
+cmp @r3, @r6
+cmp -271, 92
+m4
+L42: inc L30
+L43: add @r2, @r5
+cmp 244, -143
+lea L39, L37
+jmp @r5
+not @r3
+L44: rts
+jmp @r2
+prn @r4
+add L34, L4
+rts
+L45: mov 462, L21
+lea L21, @r4
+jmp L38
+lea L20, L22
+clr @r7
+red L1
+jsr X1
+red @r7
+L46: lea D0, @r1
+prn L7
+not @r2
+red @r5
+dec @r4
+rts
+cmp -444, L56
+rts
+L47: not L11
+inc @r4
+jmp @r3
+prn L33
+red L11
+red @r5
+mov 194, @r3
+jmp @r1
+inc @r2
+L48: cmp L9, L5
+L49: prn L11
+add L58, @r2
+rts
+bne @r4
+bne @r5
+mov @r2, D0
+L50: not L16
+sub 170, S5
+L51: lea L48, @r6
+sub @r3, L25
+red @r7
+L52: rts
+jmp L57
+cmp 231, 309
+cmp -48, @r6
+cmp S2, L38
+inc L11
+rts
+inc L11
+L53: clr L59
+cmp @r0, @r2
+not S5
+rts
+dec @r4
+m4
+L54: rts
+lea L7, @r5
+mov L39, @r7
+add L51, @r3
+inc @r0
+m3
+L55: inc L27
+inc L4
+add @r5, @r7
+clr @r2
+L56: inc @r1
+lea L5, L41
+bne @r3
+add L17, @r1
+clr L27
+add @r2, L56
+mov 428, @r5
+prn S5
+rts
+bne L49
+red L19
+L57: dec L9
+mov 338, L55
+prn L41
+inc @r5
+sub D0, @r6
+dec @r7
+rts
+dec @r6
+inc @r0
+clr L45
+m1
+rts
+cmp 474, -177
+red L7
+L58: dec L59
+jmp @r0
+inc L59
+m3
+sub 13, L25
+red L5
+jmp @r7
+red L41
+jsr @r3
+not @r4
+m1
+bne D0
+jmp @r6
+mov @r2, L57
+inc L52
+prn L59
+jmp L21
+mov @r0, L25
+inc @r4
+add X2, @r7
+inc X3
+clr L2
+bne L56
+bne @r2
+lea L10, @r3
+lea D0, S5
+cmp L59, @r2
+bne L21
+mov -134, L43
+L59: prn L42
+not @r4
+clr @r0
+jmp @r7
+mov X4, L42
+prn D0
+lea D0, @r6
+clr @r1
+add 11, @r1
+prn @r6
+bne D0
+sub D0, @r2
+dec D0
+jmp S2
+clr D0
+stop
+D0: .data 12,267,-107,197,394,-106,253,-14,341,-32
+D1: .data 275,110,83,399,69,271,-457,480,222,-10
+D2: .data 102,-262,282,161,54,323,-251,-390,-178,-228
+D3: .data 375,112,161,-26,70,-280,-172,-366,-229,-180
+D4: .data -342,-87,-317,-266,446,-300,106,336,-378,380
+D5: .data -445,-318,174,-129,-232,172,-72,-162,-500,-75
+D6: .data -176,-116,-483,-493,-422,225,-441,-289,246,-382
+D7: .data 316,-41,454,-310,486,-349,6,491,-40,217
+D8: .data -429,-211,-407,-380,202,306,-475,432,-404,-342
+D9: .data 263,-483,224,1,-445,455,117,74,-456,-218
+S0: .string "qi"
+S1: .string "crgcazukodpzddrc"
+S2: .string "pvewzyosk"
+S3: .string "cusw"
+S4: .string "imoypaclrnsyhpf"
+S5: .string "n"
+S6: .string "jkltgsztsvkifzflo"
+S7: .string "qenmqfnzkmlmjrzgpnrj"
+S8: .string "ssbgaogfrkpbb"
+S9: .string "l"
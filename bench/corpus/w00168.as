@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r7
+    prn 43
+endmcro
+mcro m1
+    sub @r6, @r3
+    prn 37
+endmcro
+mcro m2
+    sub @r4, @r1
+    prn 30
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 64
+endmcro
+mcro m4
+    sub @r3, @r2
+    prn 16
+endmcro
+jmp L0
+m1
+cmp -509, @r6
+sub L0, L0
+inc @r7
+inc L0
+dec @r1
+m3
+m0
+L0: dec @r2
+lea L0, @r3
+red @r4
+m3
+mov @r0, L0
+L1: red @r5
+clr L1
+jmp L1
+mov @r2, L0
+red @r3
+add L1, L0
+clr @r7
+bne L1
+L2: bne @r6
+m2
+prn L0
+not L1
+inc L1
+lea L1, L0
+prn L2
+L3: jsr L0
+L4: jmp @r6
+jmp L0
+sub @r2, L4
+dec L3
+bne @r0
+L5: rts
+clr L5
+L6: not L1
+L7: not @r5
+clr L3
+sub L54, @r5
+bne L6
+m1
+bne @r6
+L8: prn @r1
+add @r6, @r4
+jmp @r3
+prn S5
+jmp @r7
+mov L0, @r6
+red L7
+rts
+lea L3, @r1
+L9: lea L3, L8
+m3
+rts
+L10: red L5
+jmp @r4
+not L7
+lea L7, @r0
+sub L8, L6
+add L7, @r1
+rts
+clr L6
+L11: jsr L5
+jmp @r4
+L12: red @r3
+prn L7
+L13: dec L3
+rts
+mov L9, @r4
+lea L11, @r7
+sub @r4, L2
+m4
+L14: add L6, L40
+m1
+inc L4
+dec L3
+L15: inc @r1
+add -504, @r3
+bne @r6
+not @r3
+cmp L7, @r3
+jsr @r0
+dec L10
+jmp @r5
+lea L13, @r3
+m3
+m0
+red @r5
+L16: dec L2
+clr @r5
+dec L0
+inc L7
+m4
+clr L13
+inc @r5
+L17: clr @r7
+red @r3
+rts
+red L11
+inc L1
+jmp @r3
+rts
+add L11, L9
+L18: dec L13
+red X0
+add @r1, @r6
+jsr @r5
+jsr @r7
+sub -355, L1
+lea L1, L10
+bne @r7
+lea L8, @r3
+clr @r4
+not @r0
+lea L14, L12
+red L9
+L19: inc L1
+m2
+clr @r6
+inc L3
+sub -20, L3
+L20: jsr @r0
+L21: dec @r5
+lea L9, @r3
+sub @r6, @r5
+red L4
+dec @r1
+L22: jsr @r7
+jmp L22
+m0
+mov -393, L22
+bne @r5
+cmp @r6, @r3
+clr @r0
+dec L47
+sub 315, @r1
+red @r7
+dec @r4
+rts
+red @r5
+jmp @r3
+L23: bne @r7
+rts
+prn L21
+dec L12
+dec L49
+add L27, @r0
+red @r2
+jsr @r3
+red L23
+prn 331
+m4
+sub @r0, L11
+lea L9, L17
+lea L5, @r7
+not L13
+add L7, @r3
+inc L3
+sub -36, @r4
+m1
+L24: clr L13
+m4
+rts
+prn -415
+prn L24
+inc @r7
+sub L7, @r4
+L25: jmp L10
+m1
+red @r2
+sub @r7, L23
+mov @r2, @r4
+not @r5
+mov L5, @r1
+not @r6
+prn 208
+cmp L0, L9
+m3
+m3
+L26: lea L2, L12
+add @r5, L9
+prn @r0
+lea L14, @r3
+prn -232
+prn @r7
+cmp L16, L0
+L27: red @r0
+jsr @r7
+mov S9, L4
+L28: red @r6
+mov -165, @r7
+cmp @r0, L26
+L29: sub @r5, @r7
+clr L18
+dec L19
+L30: dec L30
+rts
+inc D0
+dec @r1
+bne @r7
+mov L26, @r2
+clr @r1
+L31: bne X1
+prn 366
+clr L1
+L32: not L4
+prn L23
+L33: jmp L6
+m0
+not @r7
+jmp L7
+prn L23
+lea L10, L20
+dec L5
+dec @r4
+rts
+rts
+cmp L10, @r2
+lea L2, L10
+add @r6, @r3
+m4
+add L14, @r2
+bne @r7
+m0
+cmp @r2, @r2
+cmp L28, L7
+dec @r7
+L34: inc L20
+dec @r4
+not @r3
+jsr @r2
+red L30
+sub 314, L2
+mov @r6, L2
+rts
+L35: add L3, L19
+dec @r6
+inc L31
+not @r0
+add @r1, L20
+add @r1, @r6
+inc S5
+red L30
+clr L8
+prn -357
+L36: bne @r2
+L37: lea L36, @r0
+rts
+dec @r3
+sub @r6, L26
+red @r5
+jsr @r0
+lea L17, @r6
+add @r4, L9
+bne L27
+cmp 499, -95
+inc @r4
+bne @r1
+inc @r4
+cmp @r4, -413
+prn L20
+lea L37, @r3
+L38: mov 143, L4
+m3
+not @r3
+mov L8, @r4
+prn @r2
+prn @r0
+rts
+add L33, @r4
+not @r3
+m3
+inc L53
+red L33
+clr L23
+cmp 490, @r0
+bne L14
+red @r0
+m0
+mov 434, L34
+rts
+m3
+not L11
+red L24
+bne @r2
+bne L24
+jmp L29
+clr L32
+m4
+sub 94, L42
+dec L9
+m0
+sub 248, @r3
+m3
+bne L23
+m1
+m1
+jsr L4
+clr @r3
+m2
+L39: sub -377, L15
+inc @r2
+dec @r3
+L40: lea L16, L16
+jsr L16
+dec L29
+L41: not L35
+mov L4, L11
+dec @r3
+not L23
+L42: sub @r4, @r6
+cmp L37, @r4
+dec L39
+inc L38
+jsr @r3
+sub @r7, L40
+mov L17, L35
+bne @r2
+L43: add L9, L14
+L44: sub @r7, L33
+red @r4
+rts
+jmp @r1
+prn -448
+L45: jsr L21
+clr @r5
+inc @r1
+prn -223
+lea L9, @r6
+jmp L20
+mov @r7, L29
+L46: dec @r1
+sub @r0, L11
+clr @r1
+rts
+not L30
+L47: mov L24, L49
+sub @r4, L35
+clr L5
+prn D0
+mov @r0, L48
+clr @r4
+bne L34
+dec @r7
+cmp @r3, D0
+jsr @r4
+rts
+mov @r5, @r3
+jsr L2
+not L46
+m3
+add -359, @r0
+not @r7
+L48: inc @r6
+inc L48
+dec @r2
+prn -28
+jsr @r7
+sub L4, @r6
+bne @r3
+add 220, @r0
+m3
+jmp @r3
+jsr @r4
+not L46
+L49: red L54
+bne @r0
+L50: bne @r6
+red @r2
+clr L49
+red @r4
+add @r0, @r7
+sub @r4, L45
+inc @r3
+jmp @r6
+inc @r2
+L51: mov @r5, L6
+dec L31
+m3
+dec L57
+mov -314, @r2
+bne @r4
+bne L16
+mov S9, L10
+jmp L14
+cmp @r4, S1
+m3
+sub -388, @r7
+m2
+m3
+red L11
+rts
+L52: bne @r4
+jmp L53
+clr @r2
+inc @r3
+not @r6
+add @r7, L15
+L53: prn L22
+sub L30, @r0
+add @r5, @r0
+bne L32
+L54: jsr @r5
+L55: mov @r7, @r3
+mov @r4, @r3
+bne @r6
+lea L59, @r5
+inc @r1
+inc @r7
+cmp 376, L56
+jsr @r2
+L56: mov L5, L22
+not L58
+not X2
+jsr @r6
+L57: clr L59
+clr @r5
+mov L58, @r1
+L58: rts
+cmp L59, -45
+inc @r3
+bne @r2
+clr X3
+jsr D0
+mov S2, @r3
+clr L59
+L59: jmp S8
+dec S5
+jsr S5
+jmp D0
+mov D0, @r0
+jmp X4
+mov S4, S9
+not @r3
+m3
+dec D0
+sub D0, D0
+mov D0, L9
+stop
+D0: .data 493,402,-259,76,82,266,-75,-391,-136,-78
+D1: .data -336,159,-226,30,-298,281,-450,451,49,-452
+D2: .data 472,135,435,410,-154,-252,257,38,221,191
+D3: .data -238,176,-339,-461,-393,484,-245,-195,468,-453
+D4: .data -412,-123,-404,154,-228,-211,176,-322,293,-205
+D5: .data 167,148,349,102,314,-184,-283,-182,-195,292
+D6: .data 493,-456,-102,-277,287,-107,97,382,-351,-476
+D7: .data 307,-5,-391,457,110,420,-196,93,354,-360
+D8: .data 85,-83,-441,145,4,-269,469,338,-433,-199
+D9: .data 482,-179,-129,-1,-65,-163,113,54,-53,-417
+S0: .string "pcbzkvdbpknwmikqveyp"
+S1: .string "otwmeynazwy"
+S2: .string "btpoaninfxh"
+S3: .string "mrvjitqyndpaoqvilrlb"
+S4: .string "b"
+S5: .string "uyvywduebz"
+S6: .string "sodzxobnpimi"
+S7: .string "elkqeeptjwfswbejswp"
+S8: .string "esdhcnfggejpfs"
+S9: .string "lheuatgswpoi"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r2
+    prn 13
+endmcro
+mcro m1
+    sub @r2, @r4
+    prn 3
+endmcro
+mcro m2
+    sub @r6, @r7
+    prn 96
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 41
+endmcro
+mcro m4
+    sub @r5, @r0
+    prn 40
+endmcro
+mov 96, L0
+clr L0
+L0: cmp L0, -356
+prn 428
+dec @r1
+L1: not @r2
+mov @r1, L0
+L2: not L0
+rts
+jmp @r1
+m2
+jsr @r7
+m4
+m0
+dec L1
+inc @r4
+add L0, @r3
+jmp @r7
+cmp -135, @r6
+dec @r2
+not L1
+bne L36
+prn 67
+inc L2
+bne L2
+lea L1, @r4
+m2
+bne L2
+bne L2
+dec L2
+sub L0, @r4
+bne @r1
+jsr @r1
+clr @r6
+L3: add -510, L0
+m3
+mov @r3, L1
+sub L0, @r2
+add @r7, @r1
+L4: jsr @r4
+add -355, L3
+jsr @r4
+clr L0
+mov 282, L2
+dec L0
+bne L1
+not @r5
+bne @r3
+prn L13
+rts
+lea L0, @r4
+red @r1
+m3
+lea L2, L2
+prn L0
+prn -402
+m0
+red L3
+m2
+dec @r6
+L5: rts
+m3
+rts
+inc L3
+clr @r0
+clr @r7
+bne L5
+clr @r1
+m4
+L6: bne L2
+rts
+inc L5
+m4
+m0
+inc L1
+m0
+jmp @r7
+add L0, @r2
+add @r2, L6
+jsr @r1
+lea L1, L4
+L7: add @r7, @r0
+clr @r1
+dec L2
+L8: dec @r0
+dec L3
+not @r6
+cmp @r2, -283
+lea L5, L0
+L9: sub @r7, L7
+rts
+jmp L0
+sub S5, L3
+L10: dec @r7
+rts
+jsr @r7
+bne @r0
+lea L5, @r4
+rts
+prn @r7
+dec L5
+prn @r7
+jmp L2
+jsr @r3
+m1
+bne @r4
+not @r5
+dec L10
+m0
+jmp @r7
+jsr @r6
+prn L8
+dec L19
+inc L6
+rts
+bne @r4
+inc @r4
+L11: add @r6, @r4
+add 442, @r0
+dec @r2
+bne @r2
+lea L0, L4
+L12: rts
+mov @r1, @r6
+bne L6
+rts
+cmp L0, 413
+mov 323, @r2
+bne @r5
+L13: red @r1
+mov @r7, @r3
+not @r1
+bne L13
+dec @r7
+jsr @r5
+red @r3
+m4
+bne L2
+red @r2
+red @r2
+prn -110
+dec @r0
+mov L6, @r4
+jsr L44
+L14: mov -508, @r5
+not @r6
+m3
+L15: prn 463
+jmp L57
+L16: add 153, @r0
+mov @r2, L11
+m4
+m3
+red @r6
+L17: dec L16
+not L10
+jsr L0
+dec @r3
+L18: bne L31
+prn L12
+m1
+lea L0, L11
+m2
+bne X0
+L19: add @r4, D0
+add 72, @r3
+red L5
+lea L1, L8
+L20: bne @r2
+L21: sub L20, S8
+L22: jsr @r0
+inc L22
+sub -374, @r0
+prn L58
+clr @r0
+jmp L8
+bne L18
+clr @r2
+L23: sub L4, L15
+mov L3, @r1
+jmp @r0
+mov L2, @r6
+sub @r5, L17
+lea L8, L22
+add -76, X1
+not @r3
+lea L39, @r1
+lea L8, L0
+jmp @r5
+L24: sub @r4, @r0
+rts
+bne L4
+rts
+cmp -189, 146
+mov @r6, @r2
+rts
+jsr @r0
+mov L5, @r7
+sub @r7, @r1
+prn @r2
+mov @r3, @r7
+bne @r1
+not L3
+L25: inc L18
+rts
+L26: not L5
+bne @r6
+not @r5
+m0
+sub L1, L1
+prn 157
+add 164, @r3
+not @r5
+dec L15
+add L7, @r3
+prn @r3
+jsr L2
+prn L15
+L27: cmp @r2, L13
+m4
+inc @r1
+jsr L27
+sub L11, @r7
+jmp @r5
+inc @r1
+jmp L9
+bne L11
+not L5
+cmp @r0, 147
+sub L3, L29
+cmp @r2, @r7
+jmp L3
+lea L12, L21
+L28: prn -511
+bne L22
+rts
+inc @r3
+prn L17
+lea L3, L28
+prn 252
+m3
+add @r6, L14
+prn @r0
+bne @r4
+L29: bne L18
+L30: jmp @r7
+jsr L23
+clr @r3
+jmp L14
+jmp @r1
+dec @r4
+mov 39, L43
+not L5
+rts
+mov -206, @r7
+m1
+bne L18
+L31: add L9, L0
+inc L18
+L32: jsr @r6
+L33: red @r6
+cmp L1, -175
+red L24
+not @r7
+L34: cmp 155, @r2
+red S9
+inc L26
+mov -311, L23
+add L32, L11
+mov L55, @r6
+sub L27, @r3
+add L26, L54
+not @r1
+m2
+L35: jsr @r6
+not L11
+jsr L33
+jsr @r6
+red L10
+m2
+L36: add L7, @r5
+inc L41
+m1
+sub -436, L20
+not @r0
+bne @r4
+jmp L28
+add 234, @r2
+red L31
+cmp L22, 155
+L37: mov 284, @r1
+L38: mov @r7, L14
+clr L7
+dec @r6
+inc @r7
+mov 171, L37
+jsr @r6
+lea L47, L52
+rts
+not L27
+bne @r4
+rts
+inc L30
+m0
+rts
+L39: red L35
+rts
+prn @r1
+bne @r3
+cmp 430, 151
+m0
+not @r1
+bne L27
+jmp L5
+bne L7
+jsr @r3
+not L13
+clr L9
+L40: clr L10
+L41: add -182, L2
+m0
+jsr L39
+jsr @r6
+not @r6
+prn -475
+rts
+m2
+sub L23, L21
+jmp L15
+cmp @r6, -427
+red @r4
+bne L2
+dec L46
+lea L13, @r7
+mov @r6, L28
+cmp @r3, @r2
+inc @r4
+cmp L35, @r7
+not @r4
+m2
+not @r6
+L42: lea L47, L38
+m2
+L43: jsr L30
+bne @r6
+clr @r2
+clr L38
+jsr @r4
+L44: mov 302, L21
+not L39
+L45: clr @r3
+prn @r5
+inc @r1
+clr L14
+bne @r2
+add @r4, @r7
+L46: bne @r1
+inc @r5
+L47: sub L31, @r4
+bne L39
+mov -337, @r2
+add @r3, @r6
+lea L56, @r0
+L48: dec L31
+L49: jmp @r2
+not @r5
+clr @r7
+add -409, L11
+dec @r6
+clr L30
+L50: cmp L57, 227
+mov @r5, L2
+inc @r0
+red L10
+lea S1, L27
+L51: jsr L14
+cmp @r5, 68
+lea L36, X2
+add L35, L23
+red L39
+rts
+prn 330
+add L45, @r7
+bne @r7
+L52: rts
+L53: add 461, L30
+jsr S5
+mov L16, @r6
+add -497, L28
+bne @r1
+jsr @r6
+sub 133, @r5
+L54: lea X3, L14
+rts
+sub L21, @r5
+m2
+sub @r3, L34
+sub 174, L25
+bne L30
+cmp 301, 98
+not L15
+not @r6
+m0
+add L47, @r0
+sub @r6, L57
+jmp @r7
+rts
+sub -4, @r2
+sub L1, @r3
+not D0
+L55: red @r2
+dec L55
+sub 7, @r7
+L56: jsr @r5
+dec @r6
+m0
+m2
+inc @r6
+m4
+lea L59, @r6
+bne @r3
+dec @r6
+add X4, L58
+rts
+m4
+red @r4
+jmp @r2
+dec L36
+L57: add L58, L58
+rts
+bne D0
+L58: not @r5
+bne L59
+lea L59, @r7
+L59: lea S8, D0
+bne D0
+lea L13, D0
+add 452, S0
+jmp @r7
+jsr D0
+stop
+D0: .data -286,248,-47,-271,481,180,222,15,306,-250
+D1: .data -406,144,-26,-383,-454,140,313,157,196,340
+D2: .data 314,146,346,430,303,-400,392,99,-126,-426
+D3: .data -319,-49,371,-441,-124,-446,-98,153,-482,308
+D4: .data 156,-96,-289,66,-494,-381,432,486,283,410
+D5: .data -42,-282,-340,415,-151,-121,-338,30,65,-340
+D6: .data -249,432,368,158,-132,-122,-270,304,128,158
+D7: .data -36,375,341,461,-102,9,57,-79,450,-292
+D8: .data 171,265,-33,357,239,-212,-243,-264,384,21
+D9: .data 73,-137,100,-456,-371,114,211,-366,54,-136
+S0: .string "vsagirosffhbrekwo"
+S1: .string "cerqfkftizg"
+S2: .string "edsiptywbq"
+S3: .string "ivbnhntztkd"
+S4: .string "cmtdzdsl"
+S5: .string "mbnpkrz"
+S6: .string "lasgcggophvxwmgnvi"
+S7: .string "qfzjc"
+S8: .string "jzke"
+S9: .string "yidskqmsvjxpk"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r5
+    prn 52
+endmcro
+mcro m1
+    sub @r6, @r6
+    prn 2
+endmcro
+mcro m2
+    sub @r0, @r5
+    prn 61
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 85
+endmcro
+mcro m4
+    sub @r7, @r6
+    prn 65
+endmcro
+clr L0
+jmp L0
+add 315, S3
+jmp L0
+mov -482, @r5
+L0: inc L0
+L1: mov @r0, @r2
+red @r0
+jsr @r0
+m1
+sub L0, @r1
+clr @r2
+add @r6, L0
+L2: bne L1
+add -207, L2
+rts
+cmp @r1, 170
+cmp @r5, L2
+m4
+inc L1
+jsr L2
+red @r2
+lea L1, L0
+jsr D0
+sub L1, L0
+sub @r0, @r5
+sub @r1, L1
+L3: bne @r6
+sub @r6, L3
+not L3
+bne @r0
+m3
+rts
+prn -373
+m4
+L4: mov L4, @r1
+jmp L2
+m2
+L5: dec @r1
+mov @r0, @r2
+m3
+add 404, L4
+red @r3
+jsr @r6
+m4
+lea L3, L1
+lea L4, L0
+rts
+dec @r6
+cmp L3, @r5
+cmp L0, 333
+inc L1
+jmp L44
+L6: lea L2, @r7
+L7: bne @r7
+mov L0, @r3
+m1
+dec L4
+not @r0
+prn @r1
+sub L16, @r6
+mov -140, L3
+lea L4, @r1
+red L5
+jsr @r4
+L8: bne @r6
+L9: clr D0
+bne L3
+jsr @r5
+jmp @r5
+L10: prn -127
+L11: dec L2
+red L8
+not @r2
+L12: mov @r3, @r0
+clr L9
+jsr L9
+lea L1, @r7
+jsr @r3
+bne L7
+L13: cmp L7, @r1
+dec @r1
+m1
+jsr L13
+m2
+L14: jsr L1
+jsr L3
+add L11, @r5
+L15: red @r1
+rts
+lea L9, @r7
+rts
+add L1, L15
+lea L7, @r5
+red @r1
+inc @r7
+bne @r6
+L16: mov -496, L3
+clr L8
+L17: inc L3
+cmp 3, 202
+jmp L11
+inc L6
+m0
+add 182, @r0
+L18: red @r5
+prn L0
+mov -94, L17
+mov 259, L15
+inc L1
+L19: jmp @r1
+jmp L18
+m3
+rts
+mov -159, L3
+inc @r0
+L20: red @r0
+jsr L14
+L21: clr @r6
+cmp @r0, L21
+add @r1, L16
+prn -269
+mov -152, @r3
+mov @r2, L3
+inc @r1
+inc L3
+inc @r7
+bne @r3
+sub 174, @r3
+red @r5
+mov @r7, L1
+m4
+L22: rts
+not @r4
+rts
+clr L0
+mov S0, @r5
+prn @r1
+sub L22, @r2
+m1
+dec L55
+dec @r2
+not L19
+cmp @r7, L39
+prn @r5
+jmp @r2
+jsr @r7
+add @r0, @r1
+inc @r2
+lea L21, @r0
+add -475, D0
+not L38
+sub L0, L15
+bne S7
+red @r5
+mov 37, @r4
+cmp @r2, @r1
+prn @r1
+lea L7, L6
+L23: bne @r4
+lea L13, L0
+lea L36, L19
+cmp @r1, @r6
+cmp @r1, -229
+L24: cmp L14, L19
+red L14
+jmp L22
+jsr L38
+m0
+sub S2, @r7
+add L11, L18
+mov L3, @r7
+not @r3
+red L7
+dec @r5
+m3
+sub L12, L1
+m1
+not S5
+L25: sub L18, @r3
+L26: jmp @r6
+inc @r3
+lea L2, @r5
+L27: not L26
+inc @r0
+jsr @r6
+dec @r1
+lea L8, D0
+L28: dec L28
+clr L16
+add -8, L6
+m1
+inc @r7
+m4
+jmp @r4
+cmp @r7, -473
+clr @r7
+prn D0
+rts
+L29: rts
+L30: inc L6
+not L4
+mov 319, @r7
+red @r6
+prn 484
+m4
+mov -200, L6
+rts
+prn L12
+m1
+sub 83, L18
+m4
+m2
+prn -383
+inc @r0
+bne @r0
+dec @r6
+rts
+mov 363, @r1
+lea L6, @r5
+clr L24
+not L40
+cmp L16, -161
+m3
+prn L22
+jsr @r6
+prn L18
+m2
+L31: rts
+red @r5
+m1
+clr @r5
+clr S4
+cmp @r7, L22
+add @r0, L13
+red S8
+jmp @r4
+m1
+L32: not @r0
+jsr @r0
+add L15, L24
+jmp L2
+inc @r2
+inc @r4
+mov X0, L16
+not L26
+add L29, @r4
+not @r2
+not S4
+rts
+not @r4
+red @r0
+m3
+jsr @r6
+rts
+jmp @r7
+add -387, D0
+L33: not L11
+rts
+cmp L3, @r1
+dec @r6
+inc @r2
+dec L16
+L34: dec L19
+prn 19
+jsr @r6
+lea L52, L14
+mov L17, @r0
+clr L29
+m0
+L35: dec L3
+mov L49, @r5
+L36: jsr L5
+jsr L9
+rts
+bne L18
+jmp L7
+m3
+lea L7, @r1
+mov @r1, @r4
+jsr L13
+mov @r2, @r1
+L37: not L2
+L38: rts
+inc L5
+add 383, L52
+rts
+add 349, L1
+clr L11
+L39: jmp L6
+mov @r0, L21
+mov -141, @r3
+m3
+sub -26, L1
+jmp L22
+cmp L36, L9
+L40: mov @r2, @r6
+jmp @r5
+dec S5
+inc L38
+L41: lea L5, @r4
+cmp 360, L1
+mov -187, @r0
+L42: add L16, L0
+not @r7
+dec @r0
+rts
+rts
+clr @r1
+add -220, @r2
+jmp L4
+dec L14
+bne L11
+add -424, L58
+red @r2
+sub 213, L18
+L43: lea L5, @r4
+m3
+L44: red L39
+dec @r2
+dec @r1
+clr L15
+prn @r1
+add L55, L29
+red L24
+bne @r3
+red @r2
+m4
+sub @r0, @r6
+clr L10
+mov L3, L34
+jsr @r2
+lea L37, L37
+L45: clr L12
+m1
+bne @r5
+prn @r1
+sub @r7, X1
+add L0, @r4
+red @r7
+red L12
+m3
+prn @r1
+mov 252, L51
+cmp -465, @r4
+clr @r1
+clr @r2
+inc @r0
+lea L47, @r2
+bne S3
+bne L2
+lea L40, L23
+L46: red @r3
+lea L5, @r2
+inc L5
+jmp L42
+jsr @r3
+prn 469
+red L17
+red @r2
+jsr @r7
+red @r6
+clr L24
+dec @r1
+L47: not @r3
+add @r1, L33
+m4
+not @r0
+rts
+jmp @r6
+clr L5
+not L40
+bne @r2
+prn -168
+bne X2
+lea L3, L41
+inc L23
+mov -257, L25
+red @r6
+lea L7, @r3
+L48: not @r2
+clr S6
+add @r2, L41
+rts
+mov @r1, @r6
+inc D0
+rts
+m3
+inc @r0
+L49: mov L33, @r3
+m1
+lea L19, @r7
+L50: red L8
+jsr L15
+L51: prn D0
+dec @r7
+bne L10
+m1
+mov L39, @r0
+mov @r7, L12
+bne @r1
+prn @r1
+jmp D0
+rts
+L52: not @r7
+add 12, @r6
+jsr L34
+L53: lea L8, @r7
+mov @r2, @r0
+not @r0
+red @r1
+L54: rts
+not @r3
+prn L25
+L55: inc @r6
+lea L31, L14
+jsr @r6
+L56: red L59
+sub 199, L28
+dec @r7
+L57: lea L48, @r2
+add 197, L54
+rts
+jmp @r4
+cmp 343, @r3
+prn -454
+sub 299, @r3
+lea L58, L6
+dec X3
+inc @r5
+m4
+prn L58
+dec @r6
+bne L47
+L58: cmp L39, 192
+bne @r5
+cmp @r3, @r2
+L59: jmp S7
+inc X4
+dec S5
+stop
+D0: .data 30,-272,37,-358,-376,-257,470,-165,35,389
+D1: .data 167,-161,-244,382,190,-467,359,-229,432,-396
+D2: .data 489,-348,-397,294,-296,53,-396,-207,475,-489
+D3: .data -286,-422,-413,-13,-319,412,-296,452,-432,-300
+D4: .data 244,486,340,-130,488,365,449,167,30,150
+D5: .data -283,-422,221,-461,302,43,410,139,158,397
+D6: .data -356,-458,65,-412,-35,254,-455,191,-35,359
+D7: .data 59,-98,-66,-175,-347,-163,398,299,401,174
+D8: .data 188,-62,301,-289,426,-321,-266,407,435,138
+D9: .data -276,331,43,-385,-275,368,-461,-384,-459,-484
+S0: .string "bwnggb"
+S1: .string "nrojustkxrcqzugv"
+S2: .string "aozuazsaurzuggtzg"
+S3: .string "ozuhqsptigzqjtstze"
+S4: .string "odwbgodiyawd"
+S5: .string "dl"
+S6: .string "wuzfnxuylfgykkno"
+S7: .string "r"
+S8: .string "wviarlqzcianwwq"
+S9: .string "xmjeussiwxxmldrgcsvs"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r7
+    prn 22
+endmcro
+mcro m1
+    sub @r3, @r7
+    prn 0
+endmcro
+mcro m2
+    sub @r2, @r3
+    prn 58
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 61
+endmcro
+mcro m4
+    sub @r2, @r5
+    prn 89
+endmcro
+red L0
+jsr @r6
+lea L0, @r0
+lea L0, @r5
+prn @r5
+cmp L0, L0
+L0: bne @r1
+add @r3, @r2
+not L0
+mov @r7, @r6
+cmp 281, 125
+m1
+jsr L0
+not L0
+m4
+m3
+inc @r3
+jmp @r3
+lea L0, L0
+inc @r6
+mov L51, @r0
+red @r4
+L1: prn -197
+L2: bne L2
+add L2, L2
+inc @r1
+jsr L1
+m2
+L3: jsr L1
+red L0
+L4: lea L1, L0
+m4
+dec @r7
+mov L2, L0
+not L3
+L5: jsr L3
+L6: inc S1
+dec @r4
+jsr L3
+lea L0, L5
+clr L2
+sub L4, L0
+jsr @r3
+L7: mov S3, L2
+sub @r4, L7
+prn @r0
+prn L2
+cmp -227, @r7
+cmp L2, @r6
+rts
+jmp L7
+clr L3
+cmp -86, @r1
+prn -91
+mov L2, L6
+rts
+L8: bne @r1
+cmp @r7, -114
+L9: mov -329, @r5
+L10: jmp @r6
+rts
+red @r4
+dec @r2
+bne L7
+red L3
+dec @r3
+jsr @r6
+m1
+lea L10, @r2
+clr L1
+lea L9, L4
+rts
+not L4
+add -491, @r5
+jsr L3
+jsr L4
+mov 389, @r3
+L11: jsr @r1
+red L49
+not @r6
+L12: prn L5
+add L0, @r0
+m0
+m3
+dec L55
+rts
+jmp L9
+prn @r1
+prn L11
+prn -2
+L13: sub 112, @r3
+prn L0
+dec L42
+prn -278
+bne @r5
+jmp @r7
+jmp L2
+rts
+red L6
+lea L10, L5
+add L11, @r7
+jsr @r2
+dec @r0
+clr @r3
+not @r1
+dec @r5
+L14: add @r5, @r5
+add @r2, @r7
+prn L9
+clr @r4
+rts
+not L4
+sub L11, L10
+clr L10
+jsr @r6
+lea L13, @r1
+dec @r7
+jsr @r2
+rts
+rts
+prn X0
+add @r3, L6
+lea L6, L0
+clr L0
+jmp @r6
+not @r2
+jmp @r1
+clr @r4
+sub @r3, @r0
+m1
+sub L0, @r3
+L15: clr L15
+L16: dec @r5
+jmp L9
+sub 415, @r0
+jsr L40
+lea X1, @r3
+L17: red @r1
+L18: red S6
+jsr D0
+L19: red @r0
+m1
+L20: rts
+red L17
+inc @r1
+red @r2
+inc L15
+cmp L11, L14
+red L6
+L21: not L18
+bne L19
+cmp -407, L7
+lea S4, L17
+inc @r2
+dec L10
+inc L16
+cmp 163, -30
+sub @r5, @r1
+lea L9, @r2
+bne @r0
+prn 130
+L22: red L12
+inc L4
+rts
+L23: rts
+clr @r4
+m1
+rts
+cmp X2, L22
+L24: bne @r4
+mov L22, @r0
+L25: add L5, @r3
+rts
+add L20, @r6
+inc L8
+add 71, @r0
+add @r0, @r3
+L26: not L15
+red L23
+inc L13
+m1
+L27: cmp @r6, @r2
+jsr @r2
+sub @r2, @r6
+jsr @r6
+L28: not @r0
+L29: jsr S9
+not L9
+m4
+jmp L1
+cmp @r5, @r7
+m1
+L30: clr @r4
+m2
+inc @r0
+L31: sub L18, L26
+add @r2, L15
+dec L17
+rts
+m3
+inc @r7
+sub @r4, L25
+add L50, @r7
+L32: clr @r0
+lea L28, @r0
+not @r2
+m4
+L33: clr @r3
+inc L30
+add @r5, L20
+m2
+red L22
+clr L32
+L34: red @r5
+dec L23
+rts
+dec L26
+jsr L7
+cmp 96, -378
+add L26, L19
+lea L6, L6
+mov @r3, @r5
+red @r0
+rts
+rts
+m3
+not L9
+prn -6
+cmp @r2, @r4
+jmp S4
+jsr @r6
+jmp L33
+lea L4, @r7
+inc L20
+add L26, @r7
+L35: prn 480
+rts
+add L42, @r2
+m0
+L36: jsr L32
+red @r2
+bne @r4
+jmp @r3
+clr L25
+mov L17, @r6
+cmp 470, 344
+jmp @r1
+inc L26
+red L10
+bne L58
+L37: mov 55, L27
+jsr @r6
+clr L18
+cmp -181, L6
+cmp @r1, -359
+jsr L49
+prn L6
+rts
+rts
+rts
+jmp L22
+inc @r6
+lea L21, @r6
+lea L50, @r7
+m4
+cmp @r1, @r6
+dec @r6
+sub 231, @r2
+jmp L19
+add S7, L23
+add 321, L11
+bne L7
+inc @r2
+m2
+jsr L16
+clr @r2
+red @r4
+sub L7, @r5
+clr @r2
+prn @r3
+L38: cmp @r0, @r6
+sub -420, @r5
+clr @r7
+clr @r1
+m2
+L39: bne L34
+mov 156, L17
+lea L17, @r6
+sub 139, @r1
+rts
+inc L9
+mov L29, @r3
+rts
+clr @r2
+lea L0, @r4
+m1
+sub @r1, L17
+jmp @r2
+cmp -82, @r2
+not @r4
+L40: cmp L3, L30
+dec @r7
+L41: rts
+sub @r3, @r2
+lea L31, L25
+m3
+lea L20, L33
+L42: mov @r6, @r7
+mov @r2, @r7
+prn L32
+L43: inc L14
+jmp @r5
+inc L42
+bne @r2
+L44: rts
+lea S4, L29
+cmp @r4, L43
+dec @r3
+L45: lea S0, L42
+not L49
+jsr @r6
+not L2
+mov -128, @r6
+dec L24
+L46: prn -175
+add @r3, L57
+cmp @r2, 242
+jsr L33
+prn @r1
+prn L37
+bne @r2
+L47: prn 297
+red @r3
+jsr @r0
+not L10
+m4
+add 464, @r2
+not @r2
+not @r0
+jmp L6
+lea L47, L0
+inc @r2
+m0
+rts
+bne X3
+add @r4, D0
+rts
+L48: add L18, @r6
+m2
+L49: rts
+prn @r5
+rts
+add @r0, L46
+red @r1
+mov @r7, @r4
+sub -123, L29
+lea L27, L2
+prn @r7
+jsr @r3
+lea L10, L34
+L50: lea L1, @r5
+inc @r4
+not @r3
+dec @r7
+m2
+rts
+clr @r5
+lea L25, S7
+dec @r4
+clr @r6
+bne L36
+not L59
+bne @r7
+mov -474, L33
+bne @r2
+mov @r7, @r5
+mov 488, L33
+clr L55
+clr @r4
+L51: not @r0
+red D0
+L52: bne L56
+L53: red L13
+clr L42
+m1
+lea L8, L29
+m1
+jmp @r2
+jmp @r0
+not @r5
+jsr L29
+clr @r1
+red @r4
+m4
+L54: rts
+m1
+cmp L53, -388
+sub -151, L27
+m2
+inc @r2
+red L9
+bne @r7
+add @r3, @r1
+cmp @r3, @r2
+red @r1
+m4
+L55: rts
+lea L57, @r0
+jmp @r0
+inc L27
+L56: dec L16
+jmp @r5
+jsr @r2
+dec @r1
+add @r4, L58
+m3
+mov @r7, @r6
+dec L16
+L57: jsr L58
+jsr L58
+not S8
+bne @r2
+dec L24
+not L2
+rts
+mov -468, @r7
+m3
+bne L59
+m3
+inc L58
+add -331, X4
+clr @r0
+jsr @r2
+m4
+clr @r3
+m1
+L58: prn L59
+add S0, L59
+sub L59, @r0
+L59: jmp D0
+stop
+D0: .data 219,-129,-64,301,-127,2,-183,169,-457,179
+D1: .data -413,144,83,76,469,-132,-498,197,-500,303
+D2: .data 429,-439,-388,293,-82,-389,113,262,-357,331
+D3: .data -33,-104,218,439,-349,312,-382,327,181,238
+D4: .data -145,119,75,366,-301,185,408,-190,416,190
+D5: .data 362,149,309,25,-29,126,-354,-127,-57,101
+D6: .data -58,355,370,303,437,303,482,58,-340,-114
+D7: .data 414,-500,72,39,240,496,170,52,186,-149
+D8: .data -435,-264,-380,295,339,165,-268,-291,198,268
+D9: .data -183,-463,-381,-309,-308,-189,-279,-267,493,-175
+S0: .string "ue"
+S1: .string "ciocehdgggohkuaecf"
+S2: .string "uphvckwvvqzbtnilp"
+S3: .string "lmoqvzzquyv"
+S4: .string "keodhuzqiiyoagt"
+S5: .string "bqs"
+S6: .string "cytpbpmhziekffu"
+S7: .string "nuipocrgdfbkqekpoav"
+S8: .string "eyqwzcwz"
+S9: .string "sotuqfnpxdzptoy"
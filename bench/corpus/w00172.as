@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r2
+    prn 60
+endmcro
+mcro m1
+    sub @r7, @r0
+    prn 99
+endmcro
+mcro m2
+    sub @r4, @r0
+    prn 24
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 38
+endmcro
+mcro m4
+    sub @r4, @r3
+    prn 13
+endmcro
+L0: bne @r5
+lea L0, L0
+not L0
+rts
+L1: jmp @r6
+L2: dec @r3
+jsr L2
+clr L2
+cmp L0, S4
+bne L0
+cmp S0, -488
+clr L1
+L3: jmp @r2
+lea L10, L1
+inc @r6
+cmp 148, @r5
+L4: red @r1
+not L1
+rts
+dec L4
+lea L0, @r1
+m0
+bne L1
+m0
+inc L4
+m2
+rts
+jmp @r6
+rts
+m4
+sub @r3, @r7
+add -455, L2
+m4
+m3
+inc D0
+m0
+jmp @r4
+prn L2
+mov -446, L3
+sub @r1, @r5
+m4
+dec @r7
+lea L3, L4
+add 396, @r1
+inc L2
+dec @r6
+rts
+not @r4
+lea S2, L1
+L5: jsr @r6
+inc L5
+jmp @r3
+not L2
+not @r0
+L6: mov L11, L4
+rts
+not L6
+not @r1
+not @r5
+inc @r5
+dec @r2
+dec L1
+prn @r5
+add @r5, L3
+L7: add @r1, L3
+L8: jsr @r2
+inc @r0
+L9: add 486, @r7
+L10: jsr @r6
+m2
+add @r5, @r6
+sub -261, @r1
+m4
+L11: clr @r6
+m0
+red @r3
+mov @r4, @r1
+jsr L5
+add -266, L11
+jsr L1
+cmp -489, @r5
+mov @r0, L2
+add L7, L7
+lea L10, @r3
+bne L5
+inc @r0
+m1
+bne L7
+sub @r0, @r4
+bne L8
+red L7
+not @r7
+clr @r4
+bne L8
+clr @r7
+inc L10
+prn -108
+not L0
+L12: cmp @r1, L6
+L13: inc L9
+jsr @r6
+add @r1, @r2
+prn @r1
+cmp 455, 147
+m2
+L14: mov L12, @r0
+L15: red @r7
+m1
+not @r4
+red L4
+jsr L1
+m2
+m0
+jmp @r6
+lea L8, @r4
+add 289, D0
+dec @r5
+jmp @r3
+L16: jmp D0
+add @r0, L11
+jmp @r0
+m0
+m0
+sub @r1, @r2
+not L2
+m2
+bne L5
+not @r2
+L17: bne L4
+jsr L13
+dec @r2
+m2
+clr L2
+m1
+dec L16
+mov -291, L11
+not L6
+sub @r2, L1
+rts
+inc @r3
+L18: add L8, L3
+add @r1, @r2
+L19: jmp @r7
+L20: red L17
+lea L1, L16
+clr L13
+red L18
+jmp L2
+m2
+prn -278
+jmp @r4
+L21: rts
+mov @r2, L6
+prn L1
+mov -163, L8
+red @r7
+bne L17
+inc @r6
+lea L24, @r0
+cmp L1, @r6
+sub @r5, L17
+jsr @r7
+bne @r6
+sub -226, L16
+L22: cmp -499, -75
+clr L6
+jsr L20
+jsr @r6
+jsr @r5
+L23: red @r2
+prn L21
+jsr L10
+clr L14
+jsr @r6
+rts
+jsr @r7
+sub L9, S6
+cmp -122, L29
+add 212, L8
+bne @r3
+rts
+jmp L7
+bne L12
+prn 176
+dec @r4
+mov 28, @r4
+bne @r3
+L24: inc @r7
+cmp @r6, 348
+bne @r6
+m0
+jmp L3
+cmp L17, @r7
+L25: prn @r2
+red @r4
+m0
+mov L11, @r1
+jsr L24
+jmp @r5
+L26: jsr @r0
+add 190, L13
+jmp L16
+not @r0
+sub @r3, L26
+clr @r7
+jsr L23
+clr @r6
+jsr @r4
+cmp @r5, -162
+rts
+rts
+not @r7
+L27: prn L7
+inc @r5
+jsr @r2
+cmp @r4, -309
+L28: bne L16
+lea L40, L12
+sub L2, @r4
+prn L12
+rts
+add @r3, @r2
+red @r7
+L29: sub L5, @r6
+rts
+jmp @r0
+inc L8
+jmp L28
+L30: jsr L13
+L31: bne @r0
+m1
+m0
+add -135, @r2
+add -119, @r0
+lea L1, L5
+rts
+L32: rts
+jmp @r2
+inc D0
+not @r6
+add L15, L15
+m4
+inc L11
+lea L40, @r4
+L33: bne L22
+L34: cmp -251, L4
+inc @r6
+L35: bne D0
+L36: mov L43, @r3
+jmp L10
+sub L2, @r1
+bne @r6
+mov 38, @r6
+prn @r3
+add L35, L32
+clr L30
+jmp @r6
+sub @r1, @r2
+lea L0, @r6
+m2
+bne L30
+L37: bne @r7
+jsr L23
+cmp @r4, D0
+cmp @r4, L30
+red S0
+L38: clr @r0
+rts
+L39: inc L28
+m1
+rts
+inc @r0
+cmp @r6, @r0
+jmp L8
+mov 283, @r1
+sub @r2, @r0
+red L2
+L40: prn L20
+clr @r6
+L41: clr D0
+m0
+lea S2, @r6
+clr @r7
+jmp L15
+L42: sub -440, @r2
+dec L41
+L43: prn L7
+rts
+clr @r5
+rts
+m1
+L44: not @r0
+inc @r2
+red L17
+cmp @r7, @r6
+mov 348, D0
+jsr L38
+jsr @r0
+jmp @r6
+bne L31
+sub @r1, @r2
+red @r3
+inc @r1
+lea L14, @r4
+add L36, L41
+jsr @r1
+cmp -268, L20
+red @r5
+sub @r4, L53
+red L11
+inc @r4
+jmp L47
+dec L2
+L45: clr L56
+inc @r5
+m3
+mov -80, @r7
+add -419, @r1
+L46: prn -503
+cmp -348, -444
+add -236, @r4
+dec L10
+not L50
+cmp L51, -158
+red D0
+dec L18
+m2
+inc @r2
+L47: jmp @r6
+jsr @r4
+dec L24
+prn @r3
+sub @r5, @r0
+red @r2
+not @r3
+bne L2
+not L33
+jsr @r1
+inc L4
+inc @r6
+dec L7
+L48: lea L16, L37
+mov -135, L48
+sub @r3, L47
+add L43, @r1
+not @r1
+jsr @r1
+cmp -67, -199
+m0
+cmp L14, @r5
+cmp L11, @r2
+prn @r6
+inc L32
+sub -213, L17
+jsr X0
+clr L37
+bne @r0
+rts
+jsr L28
+inc L11
+jsr L32
+red @r2
+dec @r2
+red L24
+mov @r0, @r6
+sub 466, @r3
+cmp L27, @r6
+L49: jmp L45
+clr L8
+m2
+m4
+clr L22
+dec @r6
+cmp L26, @r2
+bne L31
+add -135, L3
+mov 306, @r7
+bne L29
+L50: clr @r6
+add L0, L31
+rts
+not L19
+lea L10, @r2
+sub L56, L44
+not D0
+not L16
+L51: jmp @r4
+lea L52, @r5
+inc L59
+dec @r2
+cmp @r0, -406
+dec L59
+add 282, L24
+lea L13, L49
+mov 309, L36
+not @r2
+m1
+sub @r7, @r2
+L52: cmp -200, L21
+cmp -261, L24
+lea L52, L53
+not @r3
+dec L10
+add 279, X1
+prn 215
+m2
+sub L7, L8
+red L1
+bne L5
+not @r7
+L53: clr L1
+mov L27, @r7
+bne @r0
+m1
+not @r2
+L54: sub @r3, @r5
+inc X2
+rts
+L55: jsr L30
+prn L29
+red @r0
+cmp -111, @r5
+red @r3
+L56: lea L4, @r3
+jsr @r2
+red @r3
+dec @r1
+red X3
+cmp D0, @r6
+m0
+red X4
+bne @r0
+L57: jsr L58
+L58: inc D0
+jmp @r2
+L59: cmp @r3, @r0
+inc S2
+cmp D0, -191
+add S5, L36
+dec S6
+stop
+D0: .data -496,364,115,-486,-213,-442,-443,-119,-59,356
+D1: .data 303,42,-320,424,114,9,-395,-367,-76,-150
+D2: .data -165,-446,409,-473,-231,-357,-475,-412,-414,-361
+D3: .data -125,-332,-262,-318,-368,-151,322,-163,-499,116
+D4: .data 223,-228,-153,-38,-263,396,397,-346,162,-124
+D5: .data -303,-365,52,-232,-91,-345,-38,-474,10,91
+D6: .data -392,48,7,-309,-180,331,110,-6,162,46
+D7: .data -249,-311,-163,-465,218,146,39,392,427,-169
+D8: .data 357,-242,-69,15,449,-303,154,204,167,-431
+D9: .data 32,-74,-225,357,-221,97,-84,-99,-16,-267
+S0: .string "krserjhdpnpkwaoo"
+S1: .string "mxsbbsdtibteh"
+S2: .string "agcui"
+S3: .string "vha"
+S4: .string "tflduikqsmuqqt"
+S5: .string "qjtqcwhuqwefzcf"
+S6: .string "wfkjougdkgjjm"
+S7: .string "xqq"
+S8: .string "uplhjhjklbowfi"
+S9: .string "iyce"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r4
+    prn 31
+endmcro
+mcro m1
+    sub @r3, @r1
+    prn 97
+endmcro
+mcro m2
+    sub @r6, @r6
+    prn 89
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 14
+endmcro
+mcro m4
+    sub @r6, @r1
+    prn 38
+endmcro
+mov L0, L0
+rts
+L0: rts
+red L0
+red @r7
+cmp L0, @r1
+clr @r7
+cmp @r7, 140
+cmp @r4, L0
+dec L0
+sub -258, @r0
+rts
+sub L0, L0
+bne @r1
+m1
+jmp L0
+L1: red L0
+lea X0, L1
+clr L1
+L2: rts
+L3: sub -426, L3
+m4
+m1
+clr @r5
+dec L2
+prn L0
+rts
+L4: rts
+sub @r2, @r2
+bne @r3
+L5: prn L5
+L6: red L3
+bne @r5
+add @r4, @r1
+jsr L3
+lea L3, @r4
+dec @r5
+not L4
+not L5
+bne @r1
+dec L40
+lea L3, @r1
+m4
+inc @r3
+L7: red @r5
+inc @r1
+lea L0, L2
+sub L3, @r6
+clr L2
+add L2, L1
+add 449, L7
+red L3
+jsr @r4
+m0
+sub -216, @r7
+cmp @r7, @r5
+jsr L2
+jmp L5
+L8: red @r3
+jsr @r1
+bne @r7
+L9: cmp L5, 333
+jsr @r6
+bne @r2
+rts
+cmp L5, L6
+bne L5
+not @r7
+cmp @r1, -6
+red @r0
+mov L1, @r3
+red @r7
+jmp L2
+mov @r1, L4
+m1
+prn @r5
+bne @r1
+jmp @r3
+L10: dec L3
+m3
+inc L10
+add L3, @r6
+m0
+jsr L3
+m2
+jmp L2
+L11: jmp @r0
+not L7
+jmp @r5
+inc @r4
+rts
+dec L3
+mov L1, @r2
+add 215, L10
+red L11
+jmp @r2
+prn -316
+inc L10
+clr L11
+dec @r2
+L12: lea L12, L6
+jmp L12
+rts
+rts
+mov L6, @r5
+L13: jsr L12
+L14: inc L9
+prn @r1
+lea S1, L13
+red @r6
+mov 109, L34
+dec @r5
+red L10
+L15: bne @r3
+sub @r6, L11
+m2
+jsr L15
+rts
+bne @r0
+inc L4
+jsr L57
+cmp @r5, 256
+L16: lea L10, L12
+red @r0
+inc L10
+jsr @r4
+dec L7
+jmp @r2
+clr @r7
+bne @r7
+cmp 94, @r3
+m0
+dec L12
+red @r0
+prn L15
+add -466, L6
+jmp @r1
+rts
+dec L10
+jsr L7
+L17: jsr L16
+rts
+sub @r0, @r5
+dec @r7
+rts
+m0
+prn @r2
+jsr @r3
+red L2
+m1
+not @r0
+m2
+mov @r4, L8
+m2
+dec @r3
+L18: prn 418
+dec L8
+cmp L8, -314
+mov @r1, @r2
+jmp L2
+jsr S4
+m4
+add -206, L10
+prn @r0
+clr X1
+bne @r7
+lea L11, L11
+add L8, L18
+L19: red @r4
+not L15
+m1
+lea L7, @r6
+L20: not @r4
+jmp L3
+dec @r4
+red L1
+rts
+sub -485, @r3
+jsr @r5
+m1
+m2
+jsr @r4
+lea L4, @r5
+dec @r7
+prn @r3
+dec L4
+L21: jsr @r2
+prn L13
+bne L10
+bne L6
+bne @r1
+add L8, @r6
+clr L11
+L22: mov -146, L1
+L23: inc L8
+rts
+jmp D0
+jsr L1
+not @r1
+sub @r6, @r6
+cmp L8, @r7
+lea L20, S7
+sub @r6, @r7
+inc L16
+bne L12
+not L11
+jsr L16
+L24: prn -386
+mov L9, @r4
+bne L7
+jsr @r2
+L25: mov L44, @r0
+not L5
+jmp @r1
+m2
+not @r3
+m3
+rts
+rts
+red S2
+jsr @r5
+L26: mov @r1, @r5
+bne @r2
+L27: inc L22
+jsr @r4
+inc L57
+cmp -231, L9
+m1
+dec @r2
+not L32
+rts
+not @r0
+m4
+add L26, @r4
+rts
+add @r5, L36
+inc @r0
+clr L17
+L28: inc @r5
+sub 214, @r6
+prn @r7
+jmp @r1
+clr @r6
+rts
+dec @r1
+rts
+L29: bne @r4
+sub L0, @r2
+red S9
+red @r4
+L30: add 242, L19
+lea L28, L23
+jmp @r5
+clr @r0
+L31: red L30
+L32: prn -88
+clr @r4
+bne @r7
+cmp -23, @r4
+mov @r4, L25
+add L28, @r2
+L33: cmp L18, -86
+dec @r4
+m3
+L34: clr @r0
+dec L3
+jmp @r6
+sub @r7, @r0
+cmp @r0, S8
+inc L25
+L35: add -135, L15
+bne @r6
+L36: not L7
+clr @r6
+prn -393
+jmp L13
+L37: not @r4
+inc L0
+sub @r2, L3
+jsr L22
+m2
+jsr L19
+L38: cmp L47, 179
+lea L10, S6
+not @r2
+add -346, L45
+mov @r7, L47
+mov L9, @r5
+cmp 409, @r2
+jmp @r6
+m4
+sub @r4, L31
+rts
+cmp @r2, -48
+L39: dec @r4
+jmp @r5
+cmp -253, 107
+m0
+prn L28
+add @r2, L19
+m4
+inc @r4
+prn @r2
+inc L18
+L40: inc @r4
+jmp @r6
+lea L13, L32
+red L44
+inc @r3
+bne @r6
+rts
+red L24
+rts
+L41: lea L3, @r1
+m4
+red L50
+L42: bne @r1
+rts
+rts
+jmp @r7
+sub @r7, @r6
+L43: jsr L38
+L44: cmp L40, @r6
+inc @r7
+bne @r3
+jsr L13
+not @r6
+red @r0
+sub -468, @r1
+m3
+red L13
+sub L25, S1
+mov L1, @r7
+add @r3, L3
+red @r1
+sub @r5, L40
+m3
+L45: not L5
+jmp @r4
+mov 370, @r1
+jmp @r2
+sub @r7, L11
+L46: dec @r3
+jmp L22
+lea L20, @r1
+sub @r5, L20
+rts
+L47: prn D0
+cmp @r0, -495
+cmp -238, -347
+add @r0, @r3
+lea L9, L10
+red @r7
+lea L26, L35
+jmp @r1
+dec L49
+jsr L38
+lea L25, L40
+jsr @r1
+red L40
+jmp @r7
+cmp L11, -343
+m4
+L48: dec L29
+L49: clr @r6
+red L37
+jsr @r5
+m2
+add -23, S1
+lea L36, @r1
+jmp @r7
+rts
+mov L32, L37
+dec @r7
+bne L14
+sub S8, @r4
+lea L58, @r3
+L50: clr @r7
+inc L11
+L51: prn L20
+prn -403
+L52: clr @r5
+bne @r4
+prn L54
+rts
+m2
+sub @r7, @r7
+red L20
+L53: sub L52, L51
+bne @r5
+sub @r1, L9
+prn @r3
+jsr L14
+dec L6
+L54: red @r7
+mov L27, L57
+sub -326, @r1
+jmp @r6
+cmp 463, 121
+jsr @r5
+clr L34
+jmp L59
+mov @r1, L37
+prn @r3
+sub 462, S8
+prn 491
+lea L21, L51
+m1
+cmp L23, @r6
+red @r2
+m3
+L55: inc L23
+lea L31, L53
+bne L25
+jsr @r5
+rts
+prn 453
+add @r6, @r5
+sub L58, @r3
+m3
+prn L37
+not @r7
+inc @r7
+m2
+lea L40, @r6
+m4
+mov @r7, @r3
+m4
+dec S5
+inc L59
+L56: not L58
+jsr L20
+add X2, X3
+L57: not L58
+add L48, D0
+not X4
+clr L58
+L58: not L59
+L59: dec D0
+clr D0
+stop
+D0: .data -272,278,459,-493,-349,-176,463,-227,-63,-20
+D1: .data -52,-148,7,328,308,439,-206,-126,-495,249
+D2: .data -187,-191,-367,202,399,350,-32,385,-492,151
+D3: .data 219,-456,-292,326,293,466,34,-70,-10,428
+D4: .data 93,193,-253,-263,221,-34,7,-96,-387,-76
+D5: .data -98,-133,-117,-427,359,426,-132,156,-102,-244
+D6: .data -448,40,-34,-469,144,64,373,265,-148,378
+D7: .data 293,237,-452,-488,-366,101,317,-385,231,482
+D8: .data 453,168,-274,-158,51,100,305,185,-363,-420
+D9: .data -54,370,-368,134,-308,-77,206,-421,-390,-32
+S0: .string "mxliqcmtkjhumrksya"
+S1: .string "evlb"
+S2: .string "apbuvgqyviruqkyyfb"
+S3: .string "iwdvlonwjmifssn"
+S4: .string "zwlbhycdvrvzsir"
+S5: .string "nrvg"
+S6: .string "zvu"
+S7: .string "qqtbmlln"
+S8: .string "nlwmqkczwpknsu"
+S9: .string "sapamaxvxhiukx"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r7
+    prn 69
+endmcro
+mcro m1
+    sub @r0, @r3
+    prn 96
+endmcro
+mcro m2
+    sub @r0, @r4
+    prn 54
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 91
+endmcro
+mcro m4
+    sub @r0, @r7
+    prn 62
+endmcro
+clr @r7
+m1
+m2
+m0
+red L0
+bne @r1
+cmp @r3, 364
+L0: sub 101, L0
+L1: cmp -9, 403
+m4
+clr @r1
+inc @r2
+prn L10
+jsr L0
+lea L0, L1
+clr @r5
+prn L0
+inc @r0
+not @r6
+L2: rts
+jsr L2
+lea L0, @r5
+inc @r0
+jsr L2
+mov -157, L2
+clr @r5
+jmp L0
+jsr @r6
+m2
+inc @r5
+m0
+prn 84
+m4
+jsr L47
+sub L2, @r3
+cmp -375, L1
+L3: prn @r7
+L4: rts
+rts
+m4
+inc L1
+red L4
+jmp @r5
+dec @r4
+cmp @r5, @r4
+jmp @r1
+jsr @r4
+sub L13, L1
+L5: prn -424
+L6: rts
+jsr @r7
+m2
+cmp -240, @r1
+inc L0
+jmp @r5
+add L0, L6
+m1
+not @r4
+red @r5
+jsr @r6
+m3
+mov -508, @r7
+rts
+jsr L0
+clr L3
+jsr L3
+L7: inc @r7
+jmp @r6
+sub @r0, @r6
+L8: inc @r7
+add @r6, @r5
+bne @r3
+jsr @r0
+sub L7, L4
+bne L8
+rts
+inc @r4
+lea L2, L56
+clr L1
+red L3
+jsr @r1
+not L5
+L9: jmp L0
+bne L6
+jmp @r3
+add L7, L6
+inc L6
+cmp -274, -472
+cmp 322, -88
+rts
+mov @r5, L2
+sub -503, @r6
+lea L5, @r7
+sub 370, @r4
+L10: cmp L10, 325
+red L7
+red L7
+L11: rts
+dec @r4
+red L18
+m2
+m1
+add @r1, @r0
+not @r1
+L12: jmp @r3
+inc L4
+bne L12
+mov 127, @r0
+lea L6, L11
+L13: dec @r2
+rts
+m1
+lea L1, L13
+L14: bne L1
+mov -163, L11
+m4
+cmp @r5, L26
+red @r0
+mov -273, @r5
+cmp @r7, L9
+prn L14
+L15: add 303, L6
+bne @r0
+bne L14
+add L5, @r3
+clr @r2
+jsr L39
+L16: sub @r3, L11
+jsr @r0
+cmp @r3, @r2
+m1
+rts
+prn @r6
+jmp @r2
+L17: sub @r6, @r2
+clr @r2
+add 427, @r1
+add @r6, L29
+not L16
+red L2
+dec L17
+add @r3, L4
+inc L7
+lea L2, @r4
+inc L10
+not L16
+not @r3
+L18: bne L3
+sub @r3, L18
+jmp @r3
+mov -144, @r3
+L19: dec L4
+L20: rts
+m0
+jsr @r2
+sub @r2, @r0
+add 48, @r5
+bne L16
+m1
+m0
+sub -309, @r4
+jsr @r3
+red @r6
+rts
+prn 46
+cmp @r1, @r2
+clr @r7
+clr L0
+add @r4, @r0
+m0
+sub 127, L10
+add L4, @r6
+rts
+inc L2
+L21: lea L5, L18
+inc @r0
+jsr @r1
+add -13, @r4
+clr L19
+m0
+jmp @r0
+sub @r5, L7
+mov @r7, @r3
+rts
+L22: prn -184
+jsr @r1
+mov L16, L0
+m0
+L23: add 267, @r4
+red L13
+clr @r0
+clr @r0
+bne @r1
+L24: clr L24
+jsr L0
+sub @r6, L9
+rts
+mov @r2, @r6
+rts
+sub L16, @r5
+cmp -164, 485
+rts
+jmp @r7
+inc L5
+dec L22
+cmp L8, -315
+lea L7, L16
+dec L28
+inc @r6
+L25: bne @r3
+L26: mov L15, @r5
+jmp L26
+jmp @r0
+L27: rts
+jsr @r4
+cmp L12, 66
+rts
+add L15, @r6
+bne @r3
+L28: jmp L1
+cmp L21, 62
+L29: prn L9
+m0
+lea L19, @r4
+cmp -389, @r2
+L30: inc L17
+cmp @r0, @r1
+jsr L10
+m0
+bne L9
+not @r5
+clr @r7
+inc @r5
+not @r4
+m0
+m4
+not @r5
+cmp -177, X0
+lea L13, @r1
+clr @r2
+inc L24
+prn 176
+dec @r1
+jsr @r7
+cmp 354, @r1
+clr L6
+not @r6
+cmp @r1, -287
+dec L14
+jmp L0
+sub @r5, @r2
+red @r6
+jmp L8
+clr @r5
+rts
+not @r6
+lea S4, L13
+dec L11
+add 431, @r0
+L31: jsr L29
+jmp @r4
+L32: not @r2
+L33: add -273, L1
+L34: lea L13, @r0
+jsr @r6
+dec L33
+not L8
+jmp L23
+red L36
+L35: mov L23, @r3
+bne L41
+lea L20, L26
+dec L29
+bne L11
+m3
+inc @r3
+m3
+L36: red @r0
+jsr L28
+rts
+red @r0
+rts
+cmp @r7, L27
+red L8
+jsr @r6
+inc L9
+bne L23
+dec L25
+m2
+bne D0
+prn L53
+m3
+inc @r0
+jmp @r3
+bne @r2
+red L0
+L37: rts
+jmp @r1
+cmp -70, L15
+rts
+lea L13, @r0
+L38: red L11
+clr @r1
+jmp @r6
+m1
+m3
+L39: jmp @r7
+inc @r5
+inc @r1
+clr @r0
+clr L18
+L40: jsr @r3
+L41: rts
+cmp 471, -310
+mov X1, @r1
+clr L38
+sub L41, @r1
+mov @r2, @r7
+cmp L16, 370
+L42: prn D0
+red L42
+inc @r2
+prn 360
+m2
+lea L29, L13
+red S6
+not @r1
+cmp @r5, 423
+lea L21, L38
+cmp -118, -4
+lea L34, L34
+lea L14, @r1
+m4
+sub @r6, L18
+prn @r0
+L43: bne @r7
+sub -386, L28
+m3
+clr @r1
+L44: jmp @r3
+L45: dec @r1
+L46: red @r5
+not @r7
+rts
+red @r1
+L47: prn L34
+jsr L5
+rts
+inc @r1
+m3
+dec L10
+jmp @r5
+prn -301
+jsr L39
+mov @r7, D0
+red D0
+rts
+inc X2
+jsr @r7
+add @r6, S7
+L48: bne L13
+sub 410, L36
+clr L33
+bne @r5
+red L15
+bne @r5
+sub @r3, D0
+add L58, @r3
+jsr L33
+jsr @r2
+jmp @r0
+rts
+cmp -408, @r0
+mov -491, @r7
+bne L15
+bne D0
+rts
+L49: lea L7, L35
+rts
+mov 12, L4
+cmp X3, @r0
+red @r2
+m4
+red @r2
+inc @r3
+clr L5
+m1
+rts
+dec L6
+inc @r1
+sub L18, L19
+lea D0, @r5
+jmp @r4
+prn L18
+not @r2
+L50: sub 15, L40
+rts
+inc L52
+inc D0
+bne @r2
+jsr @r1
+m0
+not X4
+mov 351, @r0
+jmp L56
+not D0
+rts
+jsr @r1
+add L33, L52
+mov L56, @r1
+rts
+L51: lea L42, L5
+L52: cmp @r5, 86
+m4
+inc L58
+prn @r3
+cmp 133, 397
+lea L37, @r6
+mov L8, S3
+L53: prn @r0
+cmp L17, -358
+red L56
+L54: mov 454, L56
+jsr @r7
+dec @r4
+L55: sub 393, @r5
+prn 181
+add S0, L4
+prn L42
+sub -141, @r3
+L56: lea L56, S1
+L57: cmp L41, -349
+mov S1, L12
+L58: clr L58
+clr L11
+L59: mov D0, @r3
+not S8
+cmp 131, D0
+prn -234
+add D0, L19
+stop
+D0: .data -285,-303,105,83,341,-234,57,119,-399,-438
+D1: .data -168,-144,195,-428,-140,403,-378,-422,-288,227
+D2: .data 19,-417,125,-431,107,53,140,-379,491,436
+D3: .data 211,465,-22,112,311,381,-439,-47,46,-404
+D4: .data -384,-115,364,-425,195,-342,361,-250,-148,-330
+D5: .data -373,109,439,-417,441,144,-291,-472,373,26
+D6: .data -373,66,-414,-84,360,410,-336,221,421,-420
+D7: .data -463,-176,212,92,-391,-111,-184,411,483,-498
+D8: .data 208,390,27,-329,-408,297,-25,27,-326,-358
+D9: .data 304,-24,292,-400,-443,256,-35,7,145,209
+S0: .string "qimdcuij"
+S1: .string "tlocopsyhxepsmz"
+S2: .string "tug"
+S3: .string "ck"
+S4: .string "cuovcnchuybk"
+S5: .string "jhicldgoywsjkyfaqbr"
+S6: .string "xnvueueuc"
+S7: .string "zjudtcopmkpchf"
+S8: .string "xxx"
+S9: .string "rcqdhci"
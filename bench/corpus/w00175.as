@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r2
+    prn 39
+endmcro
+mcro m1
+    sub @r4, @r4
+    prn 94
+endmcro
+mcro m2
+    sub @r2, @r2
+    prn 20
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 67
+endmcro
+mcro m4
+    sub @r2, @r6
+    prn 19
+endmcro
+red L0
+add @r4, L51
+mov 436, @r0
+L0: not L0
+lea L0, L0
+clr @r0
+L1: mov -205, L0
+add 82, L1
+cmp L0, L1
+dec L1
+not @r1
+mov L23, @r3
+jsr L0
+sub 361, L1
+bne @r4
+jsr @r5
+add @r7, @r5
+cmp L1, L0
+not L1
+add 247, @r3
+bne L0
+add @r6, @r2
+rts
+sub -392, L0
+m1
+clr @r7
+jmp D0
+prn -215
+red L0
+L2: add L1, @r4
+jsr @r5
+not @r5
+L3: dec L1
+lea L3, @r2
+L4: cmp 336, @r1
+L5: not @r0
+bne L5
+lea L5, L4
+cmp @r2, L4
+L6: lea L6, @r6
+jmp @r2
+m3
+jsr @r7
+L7: red L0
+jsr @r2
+not L3
+inc L7
+jsr @r1
+L8: clr @r7
+mov 214, L3
+not @r4
+m4
+sub @r4, @r6
+m1
+lea L7, @r6
+rts
+jsr @r2
+dec L6
+cmp L1, @r4
+clr L2
+mov 296, @r2
+m2
+lea L3, L8
+inc @r4
+cmp 4, @r2
+clr L0
+red L6
+red @r5
+sub @r7, L5
+bne L5
+sub @r4, L8
+lea L1, @r1
+m1
+not @r5
+clr L2
+cmp L3, 443
+L9: rts
+m0
+m4
+rts
+m1
+sub 427, L8
+rts
+dec L20
+add @r5, S3
+rts
+red L2
+m0
+m0
+rts
+mov @r5, @r5
+rts
+rts
+dec L0
+inc @r0
+inc @r7
+L10: jmp L4
+not L4
+add 178, @r7
+add 231, @r3
+L11: not L5
+clr L1
+jmp L2
+lea L8, L5
+lea L10, S6
+red L11
+bne @r0
+dec L10
+L12: dec @r5
+rts
+L13: inc L1
+red @r5
+red L3
+L14: clr @r3
+sub L4, L39
+m3
+dec @r6
+m3
+cmp 381, 40
+not L36
+jmp L3
+not @r1
+mov @r0, L4
+m0
+red L0
+not L14
+m1
+m1
+rts
+red @r5
+red @r7
+jsr L5
+clr @r1
+m0
+L15: sub -224, @r4
+lea L1, L13
+cmp X0, @r3
+not L12
+add @r7, L6
+red L15
+L16: jmp L10
+cmp @r0, @r7
+L17: prn -190
+bne L7
+L18: red S3
+dec L14
+inc L14
+jsr @r0
+not @r0
+m3
+L19: mov @r2, @r1
+not L6
+cmp -478, L12
+L20: add 417, L20
+sub 457, @r7
+cmp L12, L18
+red L1
+red @r0
+jmp L0
+inc D0
+clr L20
+prn L9
+dec L12
+sub L0, L20
+jmp L9
+clr L14
+lea L12, @r5
+jsr @r1
+not @r5
+L21: inc @r4
+m1
+m4
+add X1, L12
+m3
+L22: sub @r7, L7
+inc L1
+m1
+add @r5, @r7
+clr @r1
+bne @r3
+jsr @r0
+add -472, L20
+add L4, @r6
+add 231, @r5
+mov @r1, L15
+sub L2, L17
+inc @r3
+clr @r4
+jmp L57
+L23: jsr L3
+add -506, L2
+cmp 191, L13
+red @r4
+L24: clr @r3
+not L5
+dec @r2
+not @r1
+jsr L14
+bne @r5
+red @r5
+add @r5, L0
+L25: jsr @r6
+lea L16, @r1
+cmp L4, L1
+L26: lea L23, L22
+dec @r1
+sub 360, L4
+dec @r7
+jsr L21
+bne L26
+prn 327
+prn 495
+L27: sub @r1, @r6
+prn @r7
+L28: rts
+m0
+L29: prn @r2
+lea L18, @r3
+red @r0
+red L9
+rts
+rts
+rts
+red L7
+sub L28, @r4
+bne L28
+clr L27
+cmp 70, @r0
+lea L9, L22
+jsr @r6
+jmp @r5
+m0
+red @r0
+m3
+lea L4, @r5
+L30: jmp L28
+dec L30
+jsr @r6
+m2
+cmp @r0, @r2
+sub @r0, L16
+not L9
+sub L12, @r5
+rts
+sub L3, L1
+L31: add 198, L30
+L32: jsr @r2
+L33: red @r7
+not L29
+dec L2
+inc @r4
+red @r6
+dec L25
+mov @r6, @r7
+sub 334, @r3
+jmp L21
+dec L15
+cmp 165, -198
+dec @r2
+dec @r3
+add @r4, @r6
+L34: lea L31, L12
+clr @r4
+sub L32, L34
+jsr @r5
+red L7
+jsr L2
+clr L22
+sub L20, @r3
+jsr L10
+jmp @r4
+L35: mov -169, @r5
+rts
+cmp @r2, L34
+L36: jsr S1
+sub -136, @r4
+m1
+m3
+add 267, L16
+jsr L29
+cmp @r1, 267
+cmp 229, 410
+L37: sub L35, L37
+prn @r2
+bne @r1
+L38: jsr @r7
+dec L39
+bne L31
+mov -321, L6
+rts
+jsr @r7
+jsr L34
+lea L15, L31
+rts
+L39: red L20
+clr L20
+sub @r4, S5
+jmp S9
+cmp 473, L26
+jsr L32
+jmp @r3
+dec @r1
+clr L17
+sub 331, L4
+red L5
+L40: inc @r3
+rts
+clr @r5
+sub 254, @r4
+prn @r6
+lea L30, @r7
+dec @r0
+not @r2
+red L28
+red @r3
+L41: sub L16, @r6
+mov @r3, @r2
+m2
+cmp L45, @r7
+m1
+red L7
+mov @r6, @r4
+red @r3
+not @r6
+inc L33
+clr @r0
+add 371, @r7
+add @r0, L9
+sub @r7, L20
+jmp @r1
+jsr D0
+inc L11
+m0
+L42: clr S7
+red @r5
+clr @r0
+mov @r2, @r6
+clr L16
+m1
+jsr @r1
+L43: dec L36
+add L35, @r5
+bne S0
+jmp @r4
+inc D0
+prn L9
+L44: mov L36, @r6
+mov 254, @r4
+inc @r5
+rts
+L45: jsr D0
+jsr L16
+prn L20
+inc L39
+add @r1, L7
+prn @r1
+rts
+lea L26, D0
+L46: prn L2
+mov @r5, @r1
+m3
+L47: not D0
+prn @r6
+prn @r4
+L48: bne L19
+inc @r3
+m0
+L49: jsr @r6
+lea L20, L38
+clr @r3
+clr D0
+m2
+inc L39
+sub L19, L49
+lea L43, L31
+m0
+red @r6
+rts
+add L30, @r3
+red L12
+m0
+jmp @r1
+m4
+red @r0
+jmp L5
+sub @r7, D0
+mov 71, X2
+bne @r2
+cmp L41, L46
+jmp L47
+prn @r6
+L50: jsr @r7
+red @r0
+L51: rts
+not X3
+L52: jsr @r3
+mov -384, @r2
+jmp @r2
+cmp @r1, -479
+inc @r3
+inc L45
+add L57, @r6
+m0
+mov @r5, @r3
+L53: cmp @r0, L34
+red @r4
+sub 145, X4
+inc @r6
+jmp L51
+inc @r7
+bne @r3
+clr L54
+clr @r5
+L54: not @r7
+jmp L29
+add @r1, @r5
+L55: dec @r1
+prn 223
+mov L41, @r6
+red @r2
+bne L22
+prn -324
+clr @r3
+m4
+L56: bne L35
+bne D0
+red @r5
+L57: rts
+mov S2, L58
+jsr S6
+inc @r6
+bne L59
+L58: jsr D0
+mov D0, L59
+L59: jmp L9
+inc D0
+lea D0, S6
+clr @r4
+sub S7, L55
+lea S0, @r5
+stop
+D0: .data 7,0,-198,45,130,-225,-9,260,204,394
+D1: .data -227,221,391,426,477,176,-409,470,-137,369
+D2: .data -305,-430,486,445,-372,-374,251,-89,422,-132
+D3: .data -182,342,85,137,323,-480,-227,33,316,44
+D4: .data 347,-337,168,-285,422,346,-329,467,-99,172
+D5: .data 271,344,356,121,-427,-160,-426,124,413,-69
+D6: .data -339,84,477,-229,303,-384,-19,45,-133,-77
+D7: .data 414,-362,-344,-89,237,459,66,-369,-207,471
+D8: .data 427,-71,-380,268,-395,461,492,422,-30,6
+D9: .data -222,404,-84,-450,-469,-5,-131,-211,417,97
+S0: .string "ikyfzctpscngdiccp"
+S1: .string "pcxqlxppqslxtyiar"
+S2: .string "lhtlfzqvexumgie"
+S3: .string "plhcz"
+S4: .string "tfcxmjxnzpkm"
+S5: .string "k"
+S6: .string "cpnwjciolvia"
+S7: .string "ignkvhdlruygtrrcdhlk"
+S8: .string "srhwgycveoyn"
+S9: .string "duzqlcieds"
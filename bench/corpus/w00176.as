@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r4
+    prn 78
+endmcro
+mcro m1
+    sub @r0, @r5
+    prn 61
+endmcro
+mcro m2
+    sub @r4, @r0
+    prn 17
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 43
+endmcro
+mcro m4
+    sub @r4, @r4
+    prn 43
+endmcro
+add @r1, L0
+jmp @r3
+dec @r4
+cmp L0, 428
+rts
+m2
+sub -34, L0
+red L0
+L0: not L0
+red L0
+not L0
+prn S1
+lea L0, L0
+sub -214, @r6
+cmp @r1, L0
+cmp @r0, @r5
+mov @r5, @r4
+L1: jmp L0
+red L0
+rts
+bne L0
+lea L1, L0
+mov L1, L1
+cmp @r1, -21
+m2
+add L0, @r1
+sub -34, @r1
+lea L0, @r6
+mov L0, @r7
+L2: mov @r1, L32
+dec @r3
+red @r6
+m2
+mov 397, L1
+clr L1
+lea L1, L2
+mov @r1, @r1
+L3: not L3
+jmp @r6
+jmp @r4
+cmp @r6, -23
+prn L2
+m2
+L4: lea L0, @r6
+sub L39, @r4
+jmp L0
+jmp L53
+red @r1
+mov -412, L4
+red L0
+inc L33
+clr L26
+not L1
+rts
+not L4
+add L3, L4
+inc L3
+add -242, L0
+bne @r6
+L5: not @r3
+not L2
+not @r7
+rts
+dec L5
+dec L0
+mov -304, @r4
+jsr L5
+L6: dec L0
+sub 60, L0
+bne @r2
+cmp -396, @r1
+mov L2, @r3
+m4
+m2
+m3
+dec L6
+lea L7, @r5
+m4
+inc D0
+sub L2, L0
+add 339, @r1
+rts
+clr L2
+dec @r2
+L7: bne L0
+m4
+red @r5
+add -23, L5
+L8: dec L3
+L9: jsr @r0
+L10: jmp L8
+red L4
+mov @r5, @r5
+sub L5, L7
+prn 221
+clr L10
+inc L7
+jmp L2
+not @r0
+not @r0
+cmp L6, L6
+rts
+not @r5
+bne L1
+not L16
+m4
+L11: inc @r3
+jsr @r4
+L12: prn @r3
+add -505, @r3
+clr @r0
+jmp L5
+rts
+cmp -251, L1
+cmp L11, 109
+red @r2
+L13: red @r3
+L14: lea L7, L8
+cmp L12, L13
+m2
+dec @r5
+bne @r6
+lea L1, L14
+jsr L12
+jsr @r4
+L15: dec S4
+not @r2
+dec L7
+jsr @r6
+sub L12, @r3
+bne @r0
+sub L0, L9
+not @r5
+dec L9
+jsr @r1
+add L1, @r5
+L16: lea L11, L9
+red @r1
+inc L12
+L17: sub 450, @r4
+mov L1, L3
+L18: jmp L5
+dec @r5
+jmp L11
+prn -313
+jsr L12
+cmp @r5, L14
+lea L8, L1
+not @r5
+jsr @r7
+jsr @r6
+m2
+jsr @r6
+prn 108
+add L15, L4
+mov @r4, L6
+cmp L1, L7
+m3
+cmp -136, @r5
+cmp 307, @r5
+m2
+L19: mov @r6, @r2
+lea L10, @r7
+L20: clr @r6
+L21: bne @r4
+rts
+sub @r0, L7
+m1
+not @r2
+m1
+mov 500, L2
+sub @r2, @r3
+cmp 65, @r4
+cmp L21, @r4
+m2
+dec @r4
+L22: rts
+m1
+not L15
+not @r3
+jmp @r0
+jmp @r2
+not @r7
+clr L16
+sub -144, L0
+jsr @r4
+mov @r4, @r0
+inc L18
+cmp L6, -54
+inc @r2
+sub @r6, @r1
+dec L2
+L23: clr @r4
+rts
+inc L51
+lea L16, L3
+rts
+m4
+clr @r5
+L24: rts
+lea L8, @r7
+sub @r0, L12
+dec L14
+L25: inc @r2
+cmp 31, 270
+jsr L14
+rts
+not @r2
+jsr L17
+mov L20, L22
+red L21
+L26: prn L22
+sub @r1, D0
+add @r1, @r3
+not L2
+dec @r1
+rts
+bne L13
+mov L27, L20
+mov 487, @r0
+lea L22, @r0
+sub -468, L0
+mov @r4, @r1
+add 163, @r5
+red X0
+not L18
+inc @r6
+mov @r4, L9
+m2
+jsr L14
+not L24
+jsr @r0
+red @r0
+rts
+inc @r7
+L27: prn 438
+inc L1
+m0
+inc @r7
+L28: bne @r2
+m3
+add L10, L9
+not @r7
+jmp L4
+dec L7
+m3
+prn 34
+not L22
+L29: prn L19
+clr L27
+dec L6
+inc L6
+add @r5, L26
+inc @r1
+jmp @r3
+m3
+m0
+red L50
+lea L23, L27
+clr @r7
+red @r1
+rts
+not D0
+m2
+L30: lea L22, L0
+inc @r2
+lea L24, L10
+L31: cmp @r3, @r1
+m2
+lea X1, @r2
+sub @r2, @r1
+sub L11, @r3
+add L17, L4
+add -342, @r0
+dec S2
+lea L31, L19
+dec @r2
+clr L27
+red L10
+jsr L12
+L32: cmp L23, 168
+mov -44, @r0
+sub -8, @r3
+L33: dec L16
+jmp @r1
+m1
+sub @r1, @r1
+L34: prn L3
+L35: jsr L28
+L36: prn S5
+L37: cmp L0, L12
+L38: sub L6, @r5
+jmp @r3
+jmp @r0
+clr @r0
+rts
+m3
+sub @r2, L30
+L39: not @r5
+sub @r3, @r5
+dec L20
+red @r5
+L40: rts
+m0
+m4
+L41: jmp L19
+lea L41, L22
+rts
+lea L30, L21
+L42: not @r0
+jsr L37
+not @r2
+L43: prn L19
+clr L44
+inc L51
+bne L46
+L44: rts
+bne X2
+dec S7
+jsr @r3
+L45: jmp L24
+lea L35, @r3
+inc L47
+add L16, L11
+jsr D0
+dec @r5
+m4
+rts
+m3
+lea S1, L15
+inc D0
+sub @r1, L41
+lea L37, @r7
+lea L16, @r3
+not @r5
+mov 237, L56
+sub D0, @r5
+clr S7
+bne @r7
+bne L2
+bne L24
+clr @r0
+L46: rts
+rts
+clr L39
+mov -495, L46
+mov -72, @r4
+not L20
+not @r6
+mov L28, @r0
+not @r0
+m3
+dec @r6
+add -270, L11
+red X3
+mov L32, L10
+sub -54, @r4
+rts
+lea L28, @r0
+jmp @r2
+not @r0
+not @r3
+mov -49, @r6
+m4
+L47: sub @r4, @r3
+prn L27
+L48: not D0
+jmp @r7
+L49: cmp -111, 380
+red @r5
+L50: dec @r6
+prn -359
+L51: lea L20, @r2
+m3
+m3
+red @r1
+clr L48
+L52: cmp L32, -51
+prn 20
+clr S7
+m1
+rts
+sub 154, D0
+rts
+jsr L16
+m3
+sub 430, L40
+L53: lea X4, @r7
+add 61, D0
+red @r5
+sub 84, L29
+L54: sub L25, @r4
+inc @r4
+dec L50
+m2
+add @r1, @r2
+prn 211
+lea L48, L57
+add -454, @r2
+sub @r4, @r3
+clr @r2
+not @r0
+not L35
+red @r6
+lea L57, D0
+not D0
+inc D0
+bne @r3
+add 270, @r7
+clr L9
+L55: jsr @r6
+red L34
+lea L19, @r4
+L56: lea L44, L28
+bne @r1
+L57: cmp L30, @r0
+mov @r4, L14
+clr @r1
+L58: bne @r6
+add 18, @r7
+inc @r0
+prn @r1
+lea L20, L57
+cmp @r4, L24
+L59: rts
+add -375, L1
+rts
+jsr @r2
+prn 163
+jsr L21
+red D0
+inc @r5
+sub @r5, L8
+jmp D0
+jmp S6
+inc @r0
+prn @r4
+add 329, L55
+dec @r7
+not @r0
+stop
+D0: .data 363,-361,119,-427,-197,287,272,139,-488,467
+D1: .data -129,454,406,-87,-153,-74,-426,-356,-476,79
+D2: .data -164,264,-3,143,191,-268,271,-254,236,-472
+D3: .data -263,94,187,-117,419,289,-397,-46,-74,377
+D4: .data -328,-198,-230,353,237,-498,-296,-227,-155,76
+D5: .data 226,-272,-157,226,213,452,-88,93,307,172
+D6: .data 203,-53,170,-331,324,246,-281,-290,157,-25
+D7: .data 499,315,-375,404,-247,394,-379,138,98,114
+D8: .data -482,199,-70,87,-408,192,497,-221,194,-485
+D9: .data 358,-219,-25,55,-93,289,477,-141,-211,258
+S0: .string "vlsqy"
+S1: .string "harocrlf"
+S2: .string "yxjecri"
+S3: .string "qwhjuan"
+S4: .string "fwsm"
+S5: .string "cgrnrvkitgrcdmnagbp"
+S6: .string "vipdbcioahhbnqju"
+S7: .string "ryz"
+S8: .string "nqigrpsdebengyjq"
+S9: .string "ywlgc"
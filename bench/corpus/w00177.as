@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r7
+    prn 48
+endmcro
+mcro m1
+    sub @r5, @r7
+    prn 59
+endmcro
+mcro m2
+    sub @r6, @r6
+    prn 82
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 20
+endmcro
+mcro m4
+    sub @r6, @r2
+    prn 68
+endmcro
+inc @r2
+not @r1
+jsr L0
+prn @r1
+jmp @r7
+cmp L0, L0
+red @r4
+cmp L0, 451
+prn @r5
+add @r7, @r6
+L0: not L0
+inc L0
+prn -2
+bne L0
+jsr L0
+jsr @r4
+clr @r7
+bne @r1
+prn L0
+dec @r0
+mov L0, L0
+L1: jsr L1
+dec L0
+not L0
+L2: mov 183, @r6
+L3: clr @r0
+jmp L0
+sub L3, L1
+L4: jmp @r3
+rts
+sub L4, @r1
+jsr L3
+jmp L2
+L5: inc @r0
+inc L4
+L6: clr X0
+add 204, @r2
+not @r3
+inc L6
+jsr L0
+m2
+bne L3
+L7: bne @r0
+jsr @r6
+red @r0
+lea L1, L0
+L8: rts
+rts
+lea L1, L12
+mov L6, @r7
+dec @r5
+inc @r3
+mov @r5, @r3
+mov @r5, L3
+add 22, @r1
+prn 112
+rts
+red @r0
+L9: cmp L1, 475
+prn -481
+m2
+red @r1
+red @r0
+jsr @r0
+jsr @r1
+inc @r0
+add 345, @r2
+jsr L8
+rts
+lea L5, @r6
+add -332, @r5
+inc L9
+bne @r2
+cmp 151, L3
+inc @r2
+bne @r4
+sub @r1, L0
+red @r2
+sub @r1, S9
+jmp @r1
+rts
+sub -104, L7
+jmp @r7
+prn -442
+red @r2
+m1
+cmp L7, @r4
+sub -289, @r2
+mov 362, L3
+red L5
+jsr @r2
+red L3
+add @r7, @r7
+prn 353
+inc @r7
+inc @r1
+L10: dec @r1
+L11: sub -439, @r1
+not @r2
+L12: jmp @r1
+lea L0, L8
+rts
+m2
+rts
+sub L6, L4
+jmp L11
+jmp @r0
+L13: sub 507, @r2
+mov -488, L3
+L14: not @r6
+jsr L3
+L15: inc @r0
+sub 252, D0
+bne @r5
+sub 417, L9
+cmp -155, 394
+sub -191, @r0
+cmp L10, @r0
+lea L10, L13
+clr L15
+lea L1, L9
+jsr L1
+dec @r7
+dec @r2
+L16: add L15, L10
+m1
+inc @r5
+prn @r0
+mov -450, L8
+lea L8, D0
+cmp @r2, L4
+inc L11
+inc L15
+rts
+inc L15
+cmp S4, -160
+not @r3
+jmp @r3
+L17: jmp L14
+bne L16
+sub @r6, L15
+dec @r3
+lea L1, @r5
+inc @r0
+m0
+red @r0
+m3
+bne L4
+jsr L5
+rts
+prn @r4
+m4
+rts
+not @r7
+clr L9
+sub L2, L4
+bne @r7
+prn L10
+clr @r4
+prn @r4
+clr @r4
+jmp L12
+clr @r5
+m0
+dec S6
+L18: not X1
+dec @r5
+m1
+bne L1
+lea L11, L2
+L19: jsr D0
+rts
+red @r1
+cmp 148, -362
+sub L4, L17
+L20: rts
+lea S7, @r2
+not L5
+L21: cmp -448, -414
+inc @r7
+not @r0
+jmp L10
+jsr @r6
+red L8
+sub 348, @r1
+not @r6
+L22: clr @r1
+m0
+cmp @r3, 385
+sub L20, @r6
+inc L13
+clr L9
+L23: jmp @r4
+red L18
+L24: jmp L16
+inc L5
+mov 479, L1
+dec L17
+add L7, L21
+lea L4, @r4
+red @r2
+jmp @r3
+add -473, @r1
+L25: dec L3
+m3
+dec L12
+bne @r5
+m2
+mov L4, L16
+bne @r5
+jmp L12
+cmp 218, -188
+inc L11
+jmp L4
+sub L8, L16
+add L10, @r2
+jsr L9
+L26: red @r6
+prn @r4
+bne @r3
+not L4
+mov L12, L6
+jsr L14
+lea L20, @r6
+sub -502, @r5
+lea L35, L1
+red L1
+dec L8
+L27: inc L25
+not L3
+mov -381, L4
+inc L20
+mov -332, @r2
+m4
+red @r0
+dec @r0
+bne L26
+m3
+bne L0
+L28: dec @r0
+lea L8, @r5
+L29: cmp @r3, @r5
+L30: jmp @r1
+clr L15
+jsr L26
+not @r4
+rts
+jsr L5
+inc L53
+rts
+prn L20
+L31: jsr L31
+clr @r0
+m1
+not L21
+L32: lea D0, L2
+m1
+jmp @r5
+cmp @r4, L56
+red L30
+rts
+clr @r7
+jsr @r4
+m2
+mov 436, L0
+jsr L23
+cmp -298, @r3
+inc @r1
+mov -312, L21
+mov -346, L7
+bne @r2
+mov @r4, L6
+lea L18, L16
+prn L12
+inc @r0
+L33: jmp L0
+lea L33, @r0
+L34: dec @r0
+m3
+clr @r4
+bne D0
+m1
+dec L8
+prn @r5
+inc @r3
+mov L19, L23
+m0
+add @r0, @r2
+m0
+L35: inc L25
+cmp @r2, -378
+dec @r5
+lea L34, @r4
+L36: red @r4
+dec D0
+red L8
+sub @r7, @r1
+clr @r6
+cmp @r0, L18
+cmp @r4, L12
+dec L32
+prn -30
+m2
+rts
+lea L2, L5
+prn @r6
+mov @r7, @r6
+jmp L38
+L37: bne @r4
+clr @r5
+dec @r0
+m0
+prn L31
+dec @r4
+lea L24, L15
+L38: jsr @r1
+cmp @r5, -336
+rts
+cmp 2, @r7
+cmp 455, L33
+jmp L0
+not @r0
+rts
+m3
+inc @r0
+rts
+jmp X2
+prn @r2
+L39: jmp @r2
+L40: red L30
+L41: jmp L7
+jsr L16
+prn 25
+m0
+L42: not @r4
+L43: jsr L31
+m0
+red @r1
+bne @r4
+L44: bne @r2
+dec L23
+add L2, @r0
+L45: cmp @r3, @r6
+bne @r1
+lea X3, L11
+jmp @r7
+mov D0, L55
+m2
+L46: prn @r5
+L47: bne L13
+lea L35, @r0
+L48: sub -26, L17
+not @r4
+m3
+jsr @r5
+prn L37
+not @r6
+red L55
+L49: jmp @r3
+not @r5
+add L55, L56
+L50: lea L3, L42
+L51: jmp L42
+bne @r2
+red D0
+mov @r3, S4
+not L33
+cmp @r2, @r3
+rts
+L52: mov -208, @r6
+cmp L28, L31
+m0
+jmp L24
+m2
+bne L24
+jsr L41
+not L47
+prn L7
+dec L58
+jsr D0
+dec @r4
+lea L11, @r3
+lea L58, @r0
+L53: bne L49
+cmp 109, @r4
+cmp @r6, L57
+m0
+dec L30
+clr @r1
+L54: bne L56
+sub L40, L34
+m4
+bne L10
+rts
+jsr @r1
+mov @r2, @r3
+m3
+jsr @r1
+mov 299, S1
+jmp L48
+L55: add L29, D0
+lea L14, S5
+jsr L10
+cmp 494, @r0
+rts
+lea L51, L49
+lea L31, @r2
+sub 219, @r0
+add @r6, @r3
+clr @r3
+m1
+not @r5
+L56: prn S9
+lea L52, L49
+bne @r3
+bne @r6
+rts
+lea D0, S3
+bne L28
+m3
+bne L15
+jsr @r3
+lea L59, L50
+mov L35, D0
+m0
+m3
+m3
+m0
+lea L57, L22
+L57: inc L1
+clr L22
+add 388, @r0
+inc @r0
+L58: dec @r2
+add 83, L18
+sub X4, @r2
+dec L59
+clr D0
+L59: sub D0, @r3
+bne S8
+stop
+D0: .data -241,-163,-489,162,-488,-187,26,-181,401,147
+D1: .data -67,-482,-121,-16,70,-221,-441,248,-142,-418
+D2: .data 492,120,-317,115,292,-278,93,494,472,472
+D3: .data -216,306,141,302,98,-207,177,-36,-421,208
+D4: .data 462,-156,-382,263,-147,-151,-443,-166,497,424
+D5: .data -96,107,29,-129,250,-454,457,326,-115,18
+D6: .data 448,465,102,447,151,228,-202,237,-245,-472
+D7: .data 460,178,414,471,-139,-36,-491,-408,316,283
+D8: .data 280,62,177,-155,-313,260,318,141,-30,-445
+D9: .data 23,-142,-494,-346,-137,-181,-120,282,365,283
+S0: .string "kw"
+S1: .string "rnoqbptlyjakwrgmrehz"
+S2: .string "kxibbscczht"
+S3: .string "ocnueqhu"
+S4: .string "bfalwosukby"
+S5: .string "iauurhwxru"
+S6: .string "zdgtmdzruwhick"
+S7: .string "aqkkzhvnuciivaidsga"
+S8: .string "crvnhkidcsnc"
+S9: .string "yvdbe"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r1
+    prn 86
+endmcro
+mcro m1
+    sub @r1, @r0
+    prn 58
+endmcro
+mcro m2
+    sub @r0, @r4
+    prn 48
+endmcro
+mcro m3
+    sub @r4, @r0
+    prn 64
+endmcro
+mcro m4
+    sub @r0, @r0
+    prn 92
+endmcro
+jsr L0
+not L0
+L0: prn -349
+bne @r2
+clr L0
+jsr @r5
+bne L0
+inc @r6
+sub -282, @r2
+L1: jsr @r6
+bne @r5
+mov @r1, @r0
+m2
+not @r6
+clr L0
+m1
+dec L1
+lea L8, L0
+prn @r1
+clr @r7
+inc @r5
+clr @r4
+m0
+inc @r4
+red @r6
+mov L1, @r6
+jmp @r2
+jsr L1
+lea L0, @r6
+mov 363, @r6
+jsr @r7
+bne D0
+dec @r2
+inc L0
+not @r7
+prn @r3
+red L1
+rts
+L2: add L2, @r6
+jsr @r4
+sub -28, L1
+rts
+rts
+jmp @r6
+clr L2
+not L2
+prn 93
+inc L0
+jsr L1
+mov L2, L1
+jsr L2
+clr @r1
+mov -372, L2
+cmp -445, @r6
+inc L0
+bne @r2
+m3
+inc @r6
+cmp @r1, @r7
+L3: jmp L8
+mov @r5, L24
+jsr L3
+jmp L0
+not @r5
+m4
+lea L1, L1
+dec @r6
+clr @r6
+rts
+L4: dec @r7
+lea L2, @r3
+L5: rts
+cmp L1, L5
+m4
+bne L5
+rts
+m2
+sub L16, @r7
+cmp @r7, 230
+L6: clr @r1
+L7: prn @r4
+prn -201
+jmp @r3
+m4
+sub @r2, L2
+L8: clr @r2
+red @r4
+prn -461
+not @r5
+mov L6, @r7
+L9: rts
+m4
+inc D0
+cmp -314, L2
+L10: not @r7
+mov L4, L3
+inc @r1
+prn L33
+L11: jsr @r6
+L12: bne @r1
+red @r0
+dec @r4
+m3
+lea L12, L27
+mov -486, L9
+clr @r5
+jsr L12
+add L9, L9
+cmp @r2, @r4
+L13: clr @r0
+dec @r1
+m3
+jsr L4
+inc S9
+not L10
+L14: red L4
+L15: jmp L10
+dec @r6
+prn L11
+L16: red @r7
+bne L48
+rts
+jmp @r7
+red @r1
+inc L0
+L17: inc @r6
+L18: not @r1
+mov -180, @r5
+bne @r1
+dec L26
+m3
+add @r6, @r0
+bne @r0
+not L4
+mov @r3, L12
+bne L0
+add L3, L18
+not @r6
+red @r3
+bne L13
+lea L10, L44
+red @r4
+mov 74, @r7
+not @r4
+L19: mov -430, L16
+inc @r5
+not @r5
+rts
+not @r5
+jmp @r7
+L20: sub L10, @r6
+mov @r2, L5
+prn 234
+cmp 270, @r4
+cmp L1, X0
+not @r6
+m2
+L21: red L40
+red L13
+jmp @r5
+bne @r1
+L22: inc @r0
+mov L16, L0
+not @r4
+prn 139
+mov L22, L20
+lea L10, @r0
+add @r5, L10
+prn L12
+bne @r3
+not L0
+inc L21
+bne L8
+add -144, L8
+rts
+jmp L8
+cmp 230, L15
+not L11
+bne S1
+prn -50
+red @r3
+clr @r4
+not L13
+add @r4, L1
+bne @r2
+add L11, L16
+inc L16
+lea L18, @r6
+L23: not L0
+L24: lea L17, L6
+m0
+rts
+red L5
+red L21
+not @r7
+mov @r7, L2
+lea L24, @r2
+lea L13, L11
+L25: inc L46
+m0
+clr L17
+L26: not L0
+lea L8, @r6
+bne L23
+prn @r4
+lea S8, @r4
+red @r0
+rts
+cmp @r7, X1
+prn L11
+jmp L11
+dec @r3
+mov @r4, @r7
+mov @r4, @r0
+cmp @r1, @r4
+m0
+lea L21, @r7
+bne @r0
+rts
+bne @r2
+m0
+m0
+bne @r7
+red @r6
+rts
+clr L17
+jsr @r1
+red L18
+add @r2, L17
+sub @r1, L20
+not L30
+dec @r3
+clr @r7
+L27: sub @r0, L0
+bne L10
+inc @r5
+add @r6, L25
+lea L7, @r0
+red L20
+clr L12
+lea L27, S8
+m3
+m2
+red @r3
+bne L7
+dec L12
+mov L21, @r1
+rts
+mov @r4, L25
+prn 122
+rts
+m3
+cmp @r7, -427
+L28: inc L10
+not L6
+m1
+dec L10
+L29: add -307, L16
+prn L11
+clr L13
+lea L1, @r7
+m0
+jmp @r6
+rts
+not @r1
+L30: prn 421
+bne @r2
+add L25, @r7
+cmp -95, @r6
+mov @r2, L30
+red L6
+jsr @r1
+sub -401, L18
+jsr L4
+L31: not X2
+lea L16, L25
+prn L34
+bne @r3
+cmp 307, -431
+red L24
+lea L30, L22
+not @r7
+L32: sub -45, L6
+jmp L16
+clr @r0
+bne L2
+jsr @r2
+add -402, @r5
+not @r1
+L33: red L14
+cmp L27, @r3
+rts
+lea L12, L5
+m3
+m0
+sub L16, @r1
+sub L27, L11
+rts
+m0
+bne L18
+prn L21
+prn @r1
+jsr @r7
+L34: prn L6
+L35: add 118, L7
+m3
+m2
+rts
+dec L27
+bne L14
+dec @r1
+mov @r5, L17
+bne L6
+clr L3
+L36: jmp @r5
+mov L17, L10
+red @r4
+clr L32
+L37: not @r5
+dec @r4
+mov -312, L3
+inc L17
+red @r5
+cmp L21, 360
+jmp L13
+jmp @r2
+red @r1
+jsr L33
+sub @r1, @r4
+inc @r4
+mov @r2, @r3
+dec @r3
+red L12
+L38: not L26
+red @r2
+m4
+sub L23, L11
+inc @r5
+L39: bne @r0
+L40: not @r1
+add L57, L27
+L41: cmp L44, 147
+jsr D0
+L42: mov @r0, L33
+m4
+not @r5
+m0
+bne @r6
+jmp @r3
+red L32
+prn 281
+bne @r7
+L43: rts
+L44: jsr @r4
+bne @r2
+mov @r3, L33
+L45: jsr L15
+m4
+bne @r1
+L46: jsr @r6
+prn -21
+prn @r6
+jsr D0
+m1
+rts
+m0
+L47: jmp @r7
+L48: inc @r1
+mov L34, @r3
+jsr D0
+m1
+sub D0, @r3
+add @r2, L28
+inc L49
+m1
+L49: mov @r1, @r6
+bne L40
+sub @r7, L59
+add @r1, @r1
+dec L19
+L50: not @r4
+clr L34
+cmp L41, @r5
+L51: cmp L41, @r1
+sub -222, L42
+rts
+red @r0
+sub L12, @r7
+add -390, L48
+L52: lea D0, @r3
+L53: not L56
+not L40
+jsr @r4
+L54: clr @r6
+not @r5
+jmp @r2
+red L59
+prn @r5
+jmp @r4
+not L2
+mov L19, @r5
+m2
+L55: mov L11, L56
+add @r0, @r5
+mov -123, @r6
+clr @r0
+jmp L47
+m3
+L56: clr @r1
+not X3
+red L49
+red @r5
+L57: add -188, @r0
+rts
+sub S5, @r6
+jsr @r6
+inc @r0
+L58: jmp L42
+not @r1
+inc S0
+L59: rts
+prn @r6
+prn -458
+dec @r1
+not S6
+m4
+inc L38
+add @r5, D0
+clr @r4
+prn -17
+rts
+m0
+sub D0, D0
+lea L8, L56
+prn @r5
+dec @r2
+cmp L49, X4
+jsr S1
+cmp S0, D0
+clr L44
+stop
+D0: .data 324,-265,-62,353,-43,142,-371,343,-107,-372
+D1: .data 167,322,476,-427,251,421,117,452,66,37
+D2: .data 47,399,264,-148,358,245,-366,-332,350,-404
+D3: .data 195,91,41,-195,-364,-95,72,51,-486,117
+D4: .data 403,-87,-229,-15,-192,-134,338,-29,-262,322
+D5: .data -361,321,-403,281,-89,-226,-416,-199,-64,-365
+D6: .data -9,-1,-280,337,-36,412,-34,-2,259,-488
+D7: .data -201,-9,263,367,448,44,270,-277,56,-242
+D8: .data 27,-351,318,-245,402,13,-215,-4,-492,-365
+D9: .data 288,37,-115,485,165,115,430,-422,55,-481
+S0: .string "lgrft"
+S1: .string "vomlptzsnhavcvybuevg"
+S2: .string "texb"
+S3: .string "wzboz"
+S4: .string "qafrnuupezyqqppnxrek"
+S5: .string "cgbgulkesbglmqsxozfv"
+S6: .string "gthew"
+S7: .string "kscqlqp"
+S8: .string "slv"
+S9: .string "g"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r4
+    prn 57
+endmcro
+mcro m1
+    sub @r5, @r1
+    prn 56
+endmcro
+mcro m2
+    sub @r2, @r2
+    prn 13
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 40
+endmcro
+mcro m4
+    sub @r2, @r7
+    prn 17
+endmcro
+red @r3
+m0
+jsr L0
+L0: prn L37
+dec @r0
+L1: clr L0
+mov L0, @r0
+not L43
+not L0
+m3
+red @r7
+red L1
+mov 346, S6
+L2: jmp @r2
+mov S1, X0
+clr L1
+not L0
+not L0
+bne @r3
+m1
+L3: rts
+L4: rts
+not L4
+rts
+not @r4
+m4
+red @r0
+not L2
+L5: sub L3, L3
+lea L4, L5
+lea L4, L1
+m3
+clr @r1
+inc L3
+bne L2
+L6: cmp @r0, L3
+m2
+L7: dec L4
+red L2
+red @r1
+rts
+sub -100, @r7
+bne @r1
+mov @r1, @r6
+L8: clr L4
+red L3
+dec @r3
+add 41, @r4
+not @r3
+clr @r3
+jmp @r7
+jsr L8
+add L0, L0
+clr @r1
+L9: mov -51, @r1
+L10: red @r5
+cmp S3, -285
+red @r3
+L11: bne L0
+inc L8
+m0
+mov L2, @r1
+L12: not @r0
+sub @r2, L8
+mov @r0, @r4
+lea L10, @r6
+clr @r7
+rts
+clr @r4
+jmp L0
+clr L12
+lea L2, @r3
+dec L10
+mov L11, @r4
+L13: jmp @r5
+lea L14, L10
+sub @r1, L0
+jmp L9
+jmp L11
+L14: mov L5, @r6
+L15: jmp L12
+m1
+L16: red L5
+jmp @r1
+dec L12
+red L12
+add 122, @r4
+cmp S3, -260
+jmp L12
+jmp @r2
+prn @r2
+sub @r2, X1
+L17: clr @r7
+prn 331
+sub @r2, L4
+jmp L6
+add L6, @r2
+not @r7
+rts
+inc @r0
+cmp -43, -238
+mov @r7, L10
+prn L8
+jsr @r2
+prn L8
+m3
+add @r0, L1
+L18: rts
+rts
+red L4
+clr L7
+L19: rts
+L20: red @r0
+m1
+clr L18
+L21: jmp L13
+L22: clr @r0
+L23: prn L19
+clr L14
+m2
+m0
+jsr @r7
+rts
+add L21, S2
+cmp L16, L13
+rts
+cmp L12, 236
+bne @r0
+L24: lea S5, L10
+jsr L9
+clr L16
+red L15
+not D0
+clr @r1
+L25: not L0
+red L15
+L26: add L20, @r5
+L27: bne L1
+L28: inc L12
+rts
+m0
+sub @r7, L22
+bne @r0
+sub L16, @r4
+cmp @r5, L0
+add L10, @r4
+cmp @r2, L23
+red @r3
+rts
+dec @r7
+rts
+m1
+jsr @r6
+clr @r2
+not @r0
+sub 30, @r2
+jsr L13
+rts
+inc @r5
+prn @r1
+L29: prn @r1
+jmp S6
+sub L17, @r1
+m3
+L30: red @r2
+red @r4
+rts
+L31: jsr @r7
+lea L31, @r7
+jmp @r0
+not @r1
+m0
+add @r7, @r6
+jmp L5
+mov 430, @r6
+sub L10, @r2
+sub L24, @r0
+rts
+m1
+lea L19, @r1
+add L2, @r7
+L32: cmp 403, L26
+rts
+rts
+m4
+m2
+L33: prn L30
+lea L0, @r7
+add L7, L9
+cmp @r1, @r6
+m4
+prn 302
+red L17
+bne L32
+clr @r2
+prn L23
+sub L30, L32
+prn @r3
+add -214, @r5
+dec @r2
+dec @r3
+cmp 212, @r2
+m4
+jmp L22
+L34: not @r2
+L35: red L33
+prn L56
+L36: inc @r6
+not L3
+dec @r4
+rts
+cmp -275, L15
+jsr @r6
+clr @r4
+m0
+m2
+not L26
+L37: jsr L34
+red L27
+lea L13, @r3
+rts
+bne L31
+add 331, L3
+mov L16, @r7
+m1
+m4
+inc @r0
+red L15
+add @r6, L1
+inc L19
+mov L30, @r2
+bne L12
+jmp L31
+m2
+L38: sub @r6, @r0
+inc L28
+sub 61, @r0
+dec L52
+lea L19, @r5
+add -84, L12
+m3
+inc L13
+jmp L59
+rts
+bne L29
+bne L32
+lea L11, L31
+inc L33
+prn L7
+L39: jmp @r2
+mov L23, @r0
+rts
+clr @r5
+prn -246
+jmp L27
+rts
+bne L14
+L40: not @r1
+cmp 203, L27
+rts
+jsr L59
+jsr L5
+jmp @r5
+jsr @r7
+inc @r3
+L41: rts
+add -105, @r5
+m0
+mov @r0, L28
+lea L23, @r2
+inc L1
+mov @r4, @r1
+jsr L41
+dec @r0
+not L26
+prn L13
+L42: dec @r3
+L43: jsr @r0
+clr L30
+dec @r6
+red @r7
+mov L42, @r6
+L44: bne L24
+jmp L37
+rts
+m4
+jmp L15
+jsr L28
+mov 292, L11
+L45: not L7
+rts
+m0
+lea L1, L17
+prn -249
+bne L2
+add @r5, L23
+clr L1
+add L31, L30
+not @r5
+L46: add @r3, L22
+inc L54
+sub 99, X2
+inc @r1
+jmp @r4
+jmp @r6
+add @r7, L8
+inc L49
+clr L36
+jsr @r0
+L47: jsr X3
+mov -497, L13
+clr @r4
+jsr L0
+rts
+mov @r7, L16
+m1
+rts
+L48: red L49
+lea L30, @r6
+cmp @r3, L31
+cmp 166, -332
+bne @r6
+not @r3
+rts
+rts
+inc @r3
+jmp @r7
+red @r3
+not L2
+red @r1
+L49: red L41
+rts
+m3
+cmp @r4, L58
+L50: red L29
+prn @r2
+clr @r3
+bne L17
+sub @r0, @r3
+dec L25
+clr @r4
+jsr @r5
+rts
+lea L3, L33
+clr @r5
+cmp 240, @r4
+cmp S9, L58
+red L13
+add L23, @r0
+lea L11, @r3
+m3
+not @r2
+rts
+add L43, L3
+jsr @r6
+not @r3
+m0
+prn -170
+cmp 224, L4
+L51: cmp @r4, 198
+bne L2
+lea L35, @r1
+rts
+sub -401, @r5
+red @r4
+not L53
+dec @r2
+cmp 375, L55
+add L27, @r0
+clr L52
+sub @r2, @r4
+L52: lea L12, S6
+mov @r7, L40
+dec @r2
+dec @r4
+inc L0
+jmp L36
+add -383, L20
+lea L42, @r1
+L53: add @r7, @r4
+mov L59, @r5
+m3
+not @r3
+rts
+L54: clr @r2
+bne L11
+m0
+L55: jsr L58
+add @r1, @r1
+bne S3
+clr L28
+m1
+not @r0
+L56: dec L30
+L57: clr @r1
+rts
+red @r4
+rts
+add -304, @r5
+m3
+mov @r0, @r6
+inc @r6
+L58: cmp X4, L4
+prn 243
+mov -454, @r5
+m2
+bne L22
+rts
+L59: jsr @r7
+jsr @r6
+mov @r4, L1
+add 269, D0
+jmp @r2
+red @r5
+add 305, @r7
+prn @r5
+sub @r1, @r5
+jmp S5
+add 428, @r1
+inc @r4
+rts
+rts
+bne D0
+clr @r1
+m2
+not @r6
+not @r3
+cmp D0, -364
+jsr L57
+add D0, D0
+inc S0
+red @r1
+jmp @r2
+inc S2
+bne L23
+add L48, S5
+jmp @r3
+not D0
+inc S2
+inc D0
+stop
+D0: .data 312,463,-441,-232,147,454,61,148,288,-327
+D1: .data 109,-448,49,184,-246,-35,356,234,50,-384
+D2: .data -216,-57,27,-129,102,145,-350,-354,-416,-192
+D3: .data 367,-435,33,-190,-50,327,-37,-238,-197,-73
+D4: .data -324,139,-131,-126,193,-379,-269,467,-411,-335
+D5: .data 88,57,-150,-331,-432,-242,-249,212,292,10
+D6: .data 427,338,8,-86,445,-384,-460,-138,-422,136
+D7: .data -173,302,-69,-326,70,-363,-185,465,476,-374
+D8: .data 361,427,271,-303,361,40,-151,202,-415,445
+D9: .data 39,-396,-344,-418,25,-412,-441,-391,43,231
+S0: .string "pxeetfpknyaknxhfs"
+S1: .string "djchygubww"
+S2: .string "zhnffeuzdpro"
+S3: .string "p"
+S4: .string "sngltqysqpu"
+S5: .string "oyspsphgoamyhskborlv"
+S6: .string "jwulmhybu"
+S7: .string "xgisircecpot"
+S8: .string "ytbsbpvj"
+S9: .string "jkd"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r7
+    prn 95
+endmcro
+mcro m1
+    sub @r2, @r2
+    prn 55
+endmcro
+mcro m2
+    sub @r4, @r7
+    prn 10
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 17
+endmcro
+mcro m4
+    sub @r4, @r5
+    prn 41
+endmcro
+add -1, L0
+bne L59
+L0: mov L0, L0
+mov L0, L0
+lea L0, @r5
+L1: rts
+bne @r4
+rts
+inc @r1
+red L1
+jsr @r5
+not L0
+sub @r7, L1
+not L0
+m1
+prn @r2
+prn -383
+L2: cmp L1, L50
+m2
+cmp 402, -358
+sub L0, @r2
+m0
+prn L1
+sub @r4, @r5
+lea L2, @r2
+jsr @r1
+rts
+m3
+clr @r7
+L3: red @r1
+dec D0
+red @r5
+inc L2
+m3
+dec L3
+prn L3
+dec @r6
+not @r3
+jsr L1
+clr @r0
+bne L2
+prn @r0
+jmp L3
+m3
+inc L0
+bne L2
+L4: jsr L3
+m1
+dec L0
+L5: red @r5
+red @r1
+mov -353, L4
+L6: cmp @r2, @r3
+red L25
+rts
+jsr L6
+jsr @r1
+dec @r6
+lea L5, @r6
+bne @r0
+clr @r0
+sub L2, L0
+cmp @r7, L5
+dec L0
+sub -52, L6
+m1
+sub @r0, @r3
+m3
+red L2
+L7: lea L5, @r7
+L8: cmp @r6, -282
+sub -104, L6
+L9: lea L5, @r4
+dec @r5
+inc L4
+jmp @r3
+m3
+jmp @r3
+dec L4
+mov @r6, L4
+lea L45, L4
+L10: cmp L7, L10
+dec L1
+jsr @r3
+red @r2
+bne L25
+bne L6
+cmp 197, -51
+jsr @r7
+m2
+add -354, S7
+m2
+L11: prn L9
+rts
+sub @r7, L10
+mov 160, L10
+red @r6
+rts
+prn 70
+L12: clr L10
+red @r1
+L13: inc L13
+sub L4, @r0
+mov @r2, L7
+not L8
+sub 11, @r5
+sub L57, @r2
+rts
+add -117, L9
+L14: clr @r0
+L15: sub 399, L13
+red @r6
+jsr @r4
+cmp @r5, @r0
+L16: prn @r0
+mov L6, @r7
+jsr L0
+red @r5
+red L16
+cmp L5, L11
+rts
+m1
+rts
+m1
+inc D0
+sub L8, L32
+prn -382
+prn -105
+mov L7, L16
+bne @r7
+mov L50, L4
+cmp -330, 55
+jmp D0
+clr @r3
+not @r1
+rts
+lea L4, @r0
+L17: jsr L14
+jsr L0
+add 488, @r6
+m1
+red L9
+bne L13
+bne L1
+mov -208, L3
+inc @r1
+lea L15, L3
+not L23
+jmp @r4
+bne L38
+not L4
+L18: sub -132, L11
+prn 136
+jmp @r7
+mov @r2, @r7
+inc L12
+bne @r0
+sub -465, @r3
+jmp L16
+L19: mov L9, @r4
+clr @r2
+cmp -254, @r2
+dec L19
+mov L17, @r3
+cmp L16, 272
+L20: cmp L20, @r2
+jsr L4
+inc @r2
+not @r0
+inc @r6
+not L21
+jsr S4
+lea L8, @r3
+mov 169, @r4
+m3
+m2
+jsr L11
+L21: dec @r7
+cmp L15, 328
+sub L9, @r5
+dec @r2
+add L7, @r1
+lea L13, L6
+bne @r7
+cmp @r5, L17
+jmp L6
+bne @r3
+mov @r7, @r3
+rts
+red @r5
+prn @r7
+cmp @r7, @r6
+cmp @r2, @r4
+prn @r4
+lea L8, L3
+cmp L20, @r3
+L22: dec @r3
+add @r3, L9
+L23: cmp -285, 136
+L24: dec D0
+cmp -413, 58
+red L21
+L25: dec @r1
+jsr L0
+red @r4
+clr L0
+sub L7, @r3
+mov @r4, L23
+m1
+m2
+bne @r3
+sub 238, @r1
+not @r3
+sub 424, @r6
+jmp L18
+m1
+not @r7
+sub 72, L4
+mov L20, L13
+inc L11
+bne @r0
+L26: red L21
+jsr @r6
+dec L34
+lea L23, D0
+prn @r0
+bne @r4
+sub -421, @r6
+dec L20
+dec L32
+red L19
+mov -502, L0
+mov -152, @r3
+inc L10
+m4
+bne @r1
+prn -90
+bne @r5
+clr @r2
+lea L17, @r4
+sub 92, @r6
+lea L7, @r4
+red L26
+add @r1, L6
+L27: jsr L3
+not L5
+add L3, L1
+lea L25, @r6
+red L20
+lea L5, @r1
+add L13, @r2
+m0
+m4
+jmp @r1
+rts
+lea L6, L18
+jmp @r3
+m0
+lea L22, @r0
+bne L9
+prn -10
+prn @r1
+lea L13, @r3
+L28: mov L20, @r7
+cmp @r3, -500
+cmp X0, @r0
+L29: mov 110, @r7
+L30: bne L16
+jmp @r4
+L31: not L31
+L32: inc L8
+L33: lea L5, @r5
+mov -284, L29
+cmp @r5, @r2
+L34: not @r0
+jmp @r2
+bne @r4
+red @r0
+jsr @r0
+prn -174
+clr @r7
+m2
+lea L0, @r0
+dec L11
+m3
+lea L18, @r1
+mov L9, @r6
+L35: sub @r4, @r1
+rts
+red @r7
+m0
+clr L27
+jsr L25
+L36: clr @r4
+rts
+sub L6, L24
+mov 428, L22
+L37: not L2
+m4
+add L22, L27
+cmp 262, @r1
+sub @r3, @r3
+lea L3, @r1
+L38: sub @r3, @r3
+sub @r4, @r7
+L39: rts
+add @r3, L51
+L40: jsr L36
+not @r0
+m1
+add L12, L33
+dec L12
+m3
+dec L37
+jmp L16
+not L14
+L41: prn -56
+L42: dec L42
+jsr @r7
+L43: bne L53
+L44: clr @r2
+mov -347, @r6
+mov @r6, @r7
+jsr S3
+jsr L20
+m2
+red @r5
+cmp L7, @r4
+lea L29, @r4
+m4
+mov 69, @r4
+jsr L1
+rts
+sub 52, @r0
+inc @r5
+m0
+rts
+inc @r5
+bne L31
+jsr @r3
+L45: not L11
+clr L34
+cmp -493, X1
+add @r2, @r6
+lea L16, L31
+jmp @r5
+red @r2
+sub @r5, @r3
+lea L14, L4
+rts
+bne L5
+prn @r0
+dec L6
+cmp -349, 455
+L46: jsr @r3
+sub @r3, X2
+sub 487, D0
+prn -409
+jsr L48
+cmp -449, L44
+mov @r4, @r2
+L47: lea L13, @r7
+L48: prn @r1
+rts
+sub 187, L25
+inc @r5
+cmp @r5, L8
+L49: red L22
+m3
+sub L52, D0
+lea L27, @r2
+L50: clr @r0
+rts
+sub @r3, @r6
+bne @r2
+jmp L16
+rts
+bne @r1
+bne L5
+sub L25, @r2
+bne @r7
+cmp @r6, 205
+sub @r5, @r7
+mov @r1, L28
+sub -71, @r7
+L51: dec L12
+dec L28
+red L53
+jsr L45
+prn @r4
+m1
+mov -379, @r2
+m2
+not @r5
+red L55
+red @r7
+jmp L54
+L52: jmp @r5
+L53: add @r3, @r2
+clr X3
+L54: not L52
+dec @r6
+red @r4
+sub L3, @r3
+rts
+L55: add @r1, @r3
+red @r1
+jsr L34
+L56: rts
+bne @r7
+dec @r6
+m3
+cmp @r3, 142
+rts
+inc @r4
+L57: lea X4, @r2
+inc @r5
+bne @r4
+not L20
+m1
+m4
+jsr @r5
+sub @r1, L59
+sub @r0, @r1
+lea D0, L54
+bne @r4
+cmp L20, 408
+mov 491, @r0
+mov L39, @r0
+lea L59, L20
+add @r5, S5
+prn @r5
+add S2, D0
+sub @r7, @r5
+rts
+dec @r7
+m4
+L58: add L59, S2
+L59: sub D0, L5
+dec D0
+stop
+D0: .data 438,-482,361,-423,219,-366,116,-176,-284,1
+D1: .data -160,-380,253,390,-96,355,119,275,-2,-339
+D2: .data 342,279,-239,-275,414,-109,403,-461,-174,292
+D3: .data 12,423,-211,-310,437,425,119,181,178,-334
+D4: .data -412,-458,34,334,397,-72,-107,-119,477,309
+D5: .data -13,424,455,102,-386,-478,407,393,178,-140
+D6: .data -312,28,153,154,195,-161,492,130,-499,-456
+D7: .data 196,-113,-25,179,399,-14,-105,-67,-404,-51
+D8: .data -409,-457,296,-209,-367,-243,-168,-61,457,66
+D9: .data 25,-197,383,-395,461,271,115,399,32,-139
+S0: .string "pnpqppyhfpixqjrckny"
+S1: .string "yzkfulemkobjubhnvyo"
+S2: .string "pwqfbzp"
+S3: .string "xfudspg"
+S4: .string "thqcrvpac"
+S5: .string "x"
+S6: .string "laozuztxdwwns"
+S7: .string "vkptsjydhmgkqyyixvn"
+S8: .string "rjfiru"
+S9: .string "tmenwopydltxztnksdc"
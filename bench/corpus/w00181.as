@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r1
+    prn 65
+endmcro
+mcro m1
+    sub @r6, @r4
+    prn 53
+endmcro
+mcro m2
+    sub @r6, @r5
+    prn 76
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 93
+endmcro
+mcro m4
+    sub @r6, @r3
+    prn 66
+endmcro
+L0: inc @r5
+add -331, @r3
+bne D0
+jsr @r1
+bne @r0
+lea L0, @r4
+mov @r1, L0
+m0
+jsr @r6
+rts
+lea L0, @r2
+L1: red L46
+mov @r1, @r7
+add @r2, @r1
+sub L0, @r6
+m0
+inc @r4
+bne @r0
+red @r6
+inc L1
+prn 503
+mov L0, L1
+m0
+inc L1
+L2: jsr @r7
+jmp L2
+rts
+red L0
+jmp L0
+cmp L1, @r0
+m2
+L3: rts
+L4: red @r1
+rts
+m4
+m3
+red @r7
+lea L4, L4
+rts
+jmp L0
+cmp 268, L4
+L5: not L4
+mov S3, @r0
+dec @r3
+prn @r6
+m0
+mov 366, L4
+dec L56
+bne L1
+sub L5, L0
+rts
+cmp S8, @r3
+bne L3
+dec @r3
+mov -423, L2
+not @r6
+rts
+clr @r5
+L6: sub @r5, L8
+dec L12
+inc @r5
+prn @r0
+mov L1, L6
+rts
+red L4
+bne @r5
+sub @r4, L2
+rts
+dec D0
+rts
+dec @r5
+dec @r0
+rts
+m1
+bne @r3
+not L5
+bne L6
+rts
+jmp @r2
+lea L5, @r5
+jsr L1
+dec @r5
+L7: add @r0, @r7
+L8: jmp L4
+inc L5
+m1
+red L2
+L9: jmp L8
+mov -12, @r0
+L10: not @r6
+red L5
+clr L18
+sub @r6, @r3
+bne L9
+jmp L4
+clr @r3
+prn L1
+lea L3, L0
+inc L10
+L11: mov @r2, @r5
+mov L8, L7
+clr @r4
+prn @r3
+L12: jsr L1
+not @r4
+inc L7
+L13: jsr L1
+cmp @r6, L12
+add L1, @r2
+inc @r0
+cmp -114, 474
+lea L9, L12
+mov -301, L7
+dec @r7
+L14: red @r3
+L15: add -69, L1
+clr @r6
+cmp 307, 330
+sub L8, @r3
+m2
+jmp @r2
+m2
+lea L0, @r7
+cmp @r0, -25
+dec L1
+lea L1, L13
+cmp 351, 471
+jmp L2
+jsr L10
+lea L10, @r0
+dec @r2
+L16: add L0, @r6
+jsr @r7
+not @r6
+L17: prn -358
+m4
+lea L13, L16
+dec @r5
+not L5
+rts
+add @r6, @r6
+prn L17
+lea L18, L7
+jmp L16
+jsr @r2
+jsr @r7
+sub L17, L16
+jsr X0
+not @r0
+sub @r0, @r0
+rts
+not @r3
+m4
+clr @r1
+prn 411
+jmp @r5
+sub @r0, @r7
+not L16
+L18: rts
+m2
+lea L46, @r3
+not @r2
+jmp @r7
+m4
+L19: bne @r1
+mov L5, L17
+dec @r0
+add -225, L4
+jmp L3
+jmp @r0
+mov -175, @r3
+clr @r4
+m0
+L20: not L17
+jmp L14
+add @r5, @r5
+prn @r1
+m4
+m1
+L21: clr L9
+prn L13
+m1
+mov @r4, @r2
+dec @r0
+sub L16, D0
+sub @r4, @r7
+jsr L7
+rts
+dec L14
+jmp @r0
+add -107, L2
+m0
+mov @r7, L15
+m0
+rts
+rts
+prn -257
+bne L8
+cmp L16, @r0
+rts
+lea L7, L21
+add @r4, @r7
+not L17
+L22: lea L20, L22
+jmp @r2
+lea L5, @r0
+add L10, L5
+cmp L2, @r5
+bne @r4
+cmp L19, @r1
+add -145, L6
+add X1, L18
+jsr @r0
+not @r6
+bne L7
+add @r1, L17
+dec L20
+jsr L19
+cmp L6, L10
+jmp L7
+red D0
+cmp -69, @r5
+red @r3
+lea L9, L8
+add 3, L17
+m3
+add L4, L5
+cmp @r4, @r5
+lea L10, L12
+cmp L22, 120
+clr L9
+clr L0
+m1
+clr L3
+clr @r1
+jmp @r0
+dec S4
+add L9, @r4
+jmp D0
+not L15
+sub @r7, L7
+jmp L18
+sub -7, @r2
+dec @r1
+L23: lea S5, @r2
+m1
+red @r5
+cmp S6, L19
+L24: clr @r3
+clr L19
+bne L16
+cmp -153, L1
+m4
+prn @r3
+m4
+jmp L18
+jmp L8
+sub L9, L2
+dec @r6
+sub 482, L9
+red L11
+not S5
+sub L22, @r6
+L25: add @r6, @r4
+L26: dec L9
+clr L1
+clr @r5
+L27: bne @r2
+m3
+not @r1
+mov L25, @r0
+not @r0
+L28: prn L4
+lea L2, L9
+bne L7
+red @r2
+rts
+m2
+not L21
+rts
+m3
+mov @r2, @r7
+L29: dec L27
+sub 442, @r0
+jsr @r5
+lea L6, L11
+L30: bne L1
+rts
+add L28, L57
+L31: jsr L46
+jmp @r2
+not @r2
+inc @r1
+L32: mov @r5, L13
+lea L2, L17
+L33: sub 250, L24
+bne L13
+prn L29
+mov L17, L33
+jmp @r2
+prn D0
+prn @r5
+bne @r0
+cmp L25, @r4
+clr @r2
+clr @r5
+L34: add -465, @r4
+mov L12, @r7
+L35: red S3
+cmp L20, L29
+m3
+prn L18
+cmp L3, 373
+rts
+sub @r2, @r0
+clr L34
+inc @r5
+rts
+sub @r7, @r5
+cmp -149, L34
+mov @r4, L28
+mov -277, L0
+jsr @r0
+add L10, L29
+dec @r2
+prn -488
+prn D0
+mov L2, L14
+bne L21
+inc S6
+mov L30, @r7
+inc L6
+m4
+jmp L15
+L36: dec L3
+red L9
+mov -500, L16
+lea L40, L33
+dec L25
+rts
+cmp @r7, D0
+not @r3
+not @r7
+m3
+m0
+L37: dec @r3
+m2
+L38: inc @r3
+cmp @r0, D0
+sub 378, @r1
+prn @r3
+not @r5
+not L32
+mov @r6, L33
+L39: red L21
+bne @r7
+L40: jsr L21
+L41: sub 500, @r6
+L42: red D0
+inc @r2
+lea L3, L3
+cmp @r0, @r7
+inc @r4
+cmp L23, L12
+cmp @r4, L6
+add @r5, @r7
+inc @r5
+L43: mov @r5, @r0
+m3
+jsr @r0
+L44: sub L3, @r0
+rts
+clr @r1
+dec L10
+L45: add L0, @r2
+jsr @r5
+cmp L32, 46
+mov -176, @r1
+L46: dec L48
+lea L22, @r6
+not L0
+L47: lea L11, @r0
+jsr @r5
+m2
+dec @r5
+jsr @r1
+prn @r7
+sub 141, X2
+not @r5
+mov L30, @r4
+L48: not L47
+L49: red @r2
+m4
+L50: bne L45
+sub -193, X3
+L51: jsr @r1
+inc @r3
+cmp L48, L4
+sub L28, D0
+not L55
+not @r5
+not @r0
+lea L59, @r6
+rts
+mov L12, @r2
+L52: sub @r1, L7
+mov -430, @r7
+not L14
+not L52
+dec L49
+inc L4
+L53: prn @r6
+red @r7
+cmp @r1, @r2
+jmp L19
+add @r7, L58
+jsr @r2
+m3
+L54: jmp @r7
+mov @r1, @r7
+red D0
+L55: jmp @r1
+clr X4
+jsr @r6
+dec L12
+m4
+not L56
+jmp @r4
+red @r3
+L56: sub @r7, @r5
+not L24
+red @r1
+lea L33, @r3
+L57: prn L58
+bne S1
+cmp L13, L56
+inc @r7
+inc S5
+L58: rts
+m4
+L59: stop
+D0: .data -271,-171,457,284,226,-384,-470,-417,186,-301
+D1: .data -115,267,-261,80,257,-73,-410,111,-27,397
+D2: .data -221,94,435,-278,-408,27,266,-150,387,-296
+D3: .data 50,-30,390,-488,-234,-312,-138,-474,469,166
+D4: .data 267,-5,-345,-112,-43,288,-294,-155,-127,235
+D5: .data 341,-261,-495,424,410,107,306,-281,-11,415
+D6: .data -245,-247,-473,236,-320,-82,126,458,-34,-106
+D7: .data -215,307,-120,-31,-274,374,348,-365,-33,-226
+D8: .data 90,-458,-314,-13,477,-450,205,-261,-107,78
+D9: .data -333,-469,-220,-341,491,96,-381,403,-407,-387
+S0: .string "tvglg"
+S1: .string "vxqt"
+S2: .string "elbnrgmiaxrc"
+S3: .string "blcwgnkdyqngby"
+S4: .string "wmfmbedslpdbfdsbpcrj"
+S5: .string "hkngmb"
+S6: .string "awpcbwwze"
+S7: .string "yhwqvzmzosidzvvtp"
+S8: .string "cwffyypgaytehmoofj"
+S9: .string "muqvgmslurvvgaqqbp"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r4
+    prn 3
+endmcro
+mcro m1
+    sub @r2, @r5
+    prn 52
+endmcro
+mcro m2
+    sub @r0, @r3
+    prn 41
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 69
+endmcro
+mcro m4
+    sub @r0, @r1
+    prn 90
+endmcro
+m3
+mov @r1, @r5
+sub L0, L0
+clr @r0
+cmp -390, @r1
+L0: red @r6
+cmp @r1, @r2
+bne @r4
+cmp @r1, @r0
+jsr @r2
+dec @r2
+m3
+clr L0
+prn @r7
+cmp -480, 383
+prn L0
+inc L0
+jmp @r5
+red L0
+sub L0, @r6
+jmp @r6
+prn @r3
+L1: mov @r7, @r1
+jsr L0
+L2: sub @r0, @r3
+jsr @r4
+bne @r6
+m4
+jmp @r0
+sub @r7, @r3
+not L1
+cmp L1, 148
+clr L22
+m3
+sub @r3, @r0
+dec L2
+m1
+L3: jmp @r0
+prn @r1
+dec L3
+bne L0
+not @r7
+cmp L58, -340
+m3
+m4
+lea L2, @r2
+L4: lea L3, L2
+red @r6
+rts
+jmp @r3
+lea L3, L1
+m2
+bne @r6
+not L3
+inc @r7
+rts
+inc @r2
+mov @r6, @r6
+add @r1, L2
+lea S9, L0
+add L3, @r3
+sub L2, @r5
+sub S1, @r3
+rts
+jsr L0
+L5: jmp @r7
+mov 393, L3
+L6: bne @r5
+clr L2
+jsr @r7
+L7: add L26, @r5
+jsr L6
+clr @r6
+jmp @r1
+inc L0
+L8: bne L8
+jmp L3
+lea L8, L2
+cmp @r5, 255
+dec @r7
+m0
+L9: cmp @r0, @r3
+cmp L4, D0
+L10: inc L0
+jsr @r5
+inc L15
+m4
+cmp -16, -335
+L11: clr L9
+lea L9, L0
+clr @r7
+not L0
+add L5, L8
+dec @r2
+m3
+lea L3, @r5
+clr @r1
+m4
+mov @r7, L1
+mov -151, L4
+add @r5, @r2
+jmp @r2
+L12: add @r0, @r2
+dec L2
+dec L2
+L13: bne @r0
+sub @r6, @r3
+rts
+L14: jsr L5
+bne L9
+sub L14, @r1
+prn -431
+m3
+jmp @r5
+L15: clr @r7
+L16: jmp @r7
+jmp L15
+m3
+add L12, @r4
+rts
+prn L11
+red S3
+inc @r0
+jmp L11
+add 422, @r4
+m1
+red @r5
+m1
+L17: mov L15, @r7
+red @r3
+clr L5
+lea L4, @r7
+jmp @r1
+L18: not L12
+m1
+jmp L6
+L19: not @r3
+L20: clr @r7
+mov @r1, @r6
+bne L3
+jsr @r3
+not @r2
+not @r1
+rts
+cmp L15, -393
+L21: not L10
+prn @r2
+jmp @r3
+L22: add @r6, L1
+dec S2
+bne @r6
+clr @r3
+bne @r5
+not @r7
+L23: jsr L18
+cmp X0, @r1
+not @r0
+L24: inc L17
+bne L14
+red @r7
+L25: bne L4
+jmp L5
+L26: prn L23
+bne L25
+inc @r3
+m1
+bne L10
+sub @r7, @r2
+m4
+sub @r3, L18
+L27: clr L4
+add @r3, @r7
+L28: jsr S7
+add 451, L27
+jsr L31
+dec L15
+m4
+clr L7
+lea L16, L19
+rts
+L29: rts
+red L16
+bne @r6
+clr L17
+mov @r1, L15
+lea L28, L28
+cmp @r4, @r3
+sub @r4, @r0
+not @r3
+L30: not @r2
+red L25
+jsr @r0
+lea L9, @r3
+jmp @r1
+jsr L4
+add L22, L17
+red L6
+not L54
+sub @r4, @r1
+dec @r5
+not @r3
+m1
+cmp @r4, L22
+prn L7
+jsr L27
+L31: mov 142, L15
+L32: dec @r6
+not L2
+red @r0
+jsr L7
+jsr L12
+L33: not L30
+inc @r1
+cmp @r2, L1
+m1
+red L26
+dec L0
+cmp L8, @r3
+rts
+m2
+m1
+jsr L20
+L34: lea L5, @r1
+red L24
+sub L17, @r5
+L35: not L13
+jsr @r3
+prn -185
+L36: jmp L12
+prn L30
+jsr L32
+prn 269
+cmp L36, -209
+dec @r5
+cmp @r4, 208
+add @r6, @r4
+lea L25, L40
+L37: bne @r7
+sub 80, L26
+lea L57, L7
+cmp 105, L35
+inc L32
+lea L32, @r3
+clr @r6
+not @r3
+sub L14, @r0
+clr S4
+rts
+prn L21
+sub @r5, L13
+jmp S7
+L38: not @r5
+clr @r6
+red @r3
+not @r1
+not L5
+add L18, L9
+add -494, S1
+mov 311, @r2
+mov -445, L9
+lea L17, @r1
+add -62, @r3
+rts
+L39: mov L10, @r7
+rts
+cmp 116, -298
+rts
+cmp -483, L1
+mov -57, @r5
+dec @r6
+jsr @r0
+m1
+m3
+bne L16
+rts
+inc L21
+add -107, @r4
+L40: clr @r1
+L41: rts
+m1
+red L31
+dec @r0
+mov @r4, @r7
+clr L23
+rts
+jmp X1
+L42: jsr @r2
+rts
+lea D0, @r3
+inc @r6
+L43: not @r4
+dec L4
+rts
+sub 43, @r1
+jsr L21
+clr L10
+dec @r2
+bne @r7
+red L38
+jsr @r2
+add -268, @r3
+lea L27, L23
+prn L36
+m4
+rts
+dec @r3
+add @r5, @r6
+sub @r3, @r7
+cmp @r0, -29
+lea L30, L47
+L44: jsr @r4
+red L6
+jsr L30
+dec L44
+jsr @r1
+mov @r6, L21
+add L37, L1
+prn @r0
+add -104, L23
+add S6, @r5
+cmp 490, L43
+add L3, L13
+L45: inc L22
+prn 271
+rts
+jmp L16
+m0
+L46: mov @r2, @r2
+lea L7, @r4
+L47: jsr @r1
+L48: cmp @r4, @r7
+mov 199, L59
+L49: lea L26, @r7
+bne L34
+jsr L49
+mov 482, L18
+dec L18
+bne @r5
+cmp @r3, 221
+prn L32
+rts
+inc @r0
+L50: jmp L20
+bne L1
+add L22, @r2
+bne @r3
+dec L7
+red @r2
+cmp @r4, @r0
+m2
+not @r6
+bne @r4
+bne L29
+jsr X2
+m0
+red L30
+not @r3
+red L39
+L51: add @r5, L57
+lea L41, D0
+L52: clr @r1
+m1
+rts
+add L59, @r7
+jmp L8
+jsr L34
+L53: cmp @r0, @r1
+inc L34
+not L18
+bne @r6
+add 462, @r3
+m2
+jsr L43
+m1
+prn @r5
+mov 183, @r5
+prn @r0
+m0
+rts
+dec D0
+m3
+red X3
+dec L57
+jsr L13
+add @r1, @r7
+jsr @r5
+prn @r5
+bne L12
+inc @r6
+mov L46, L14
+jsr L50
+bne L0
+inc L0
+dec L4
+cmp X4, L14
+rts
+rts
+not @r0
+jmp L42
+red L3
+m1
+jmp @r7
+mov L3, @r7
+m2
+L54: dec L56
+not @r4
+dec @r6
+sub 149, L39
+not @r1
+cmp @r3, @r5
+bne L50
+m2
+L55: bne L26
+prn @r1
+lea L57, L59
+dec L4
+not L17
+L56: not L25
+red L57
+prn @r1
+jsr @r7
+sub @r2, @r0
+dec L3
+not D0
+not L28
+clr D0
+bne @r3
+clr L41
+lea L0, @r5
+sub S7, @r4
+L57: bne D0
+L58: jsr @r1
+mov -159, @r0
+jmp @r0
+jmp D0
+m0
+clr L59
+sub L59, L59
+jsr L59
+L59: add S1, @r1
+stop
+D0: .data 42,152,-366,-68,-361,-295,76,120,-43,-323
+D1: .data 271,231,-13,-180,-475,1,-457,215,435,404
+D2: .data 402,-318,-310,366,41,217,83,392,-499,-169
+D3: .data 394,232,380,-447,-82,-491,-173,-288,482,352
+D4: .data -344,-220,393,82,-408,-303,-50,360,-284,-169
+D5: .data -50,-379,-50,33,-290,-343,293,-159,-353,14
+D6: .data 33,276,265,-304,344,-494,355,-14,-109,-277
+D7: .data -118,-317,-252,338,-217,161,-38,-67,-235,-323
+D8: .data -217,429,-500,-125,-377,241,-19,-422,42,-266
+D9: .data -342,-63,-262,292,93,-13,260,-145,208,-219
+S0: .string "dvuzrgeouxdpvak"
+S1: .string "elwh"
+S2: .string "uwdjeu"
+S3: .string "jwwrhhtamazpgwhfm"
+S4: .string "kpytsimvmpksgopzeze"
+S5: .string "moymnrwmundmr"
+S6: .string "zhxpevjqyhfj"
+S7: .string "atddkcnoepvsfckq"
+S8: .string "hgntjxrkdsdjzozhi"
+S9: .string "uezq"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r6
+    prn 74
+endmcro
+mcro m1
+    sub @r7, @r6
+    prn 18
+endmcro
+mcro m2
+    sub @r3, @r1
+    prn 6
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 46
+endmcro
+mcro m4
+    sub @r2, @r7
+    prn 14
+endmcro
+L0: sub 153, @r4
+m3
+dec L0
+bne D0
+sub @r3, @r4
+add @r1, @r2
+clr L0
+inc L0
+add 191, L0
+jsr L0
+rts
+clr @r1
+red L0
+jmp L0
+m3
+lea L0, L0
+bne @r1
+lea L0, L0
+mov 474, L0
+lea L0, L0
+prn S9
+not @r7
+lea L0, L0
+not @r1
+mov -325, @r1
+lea L0, @r1
+rts
+rts
+add -283, L0
+jsr L0
+jsr @r3
+m3
+m2
+cmp @r3, X0
+bne @r1
+bne @r0
+sub @r1, @r0
+clr @r2
+dec @r3
+add @r2, @r3
+jmp @r6
+m2
+rts
+jsr @r3
+jsr L0
+clr L0
+rts
+L1: jmp @r4
+mov -109, @r4
+m4
+clr @r5
+bne @r5
+rts
+L2: bne @r5
+lea L2, @r7
+sub S8, L1
+mov @r5, L0
+inc @r2
+clr @r3
+mov @r4, L5
+prn -215
+mov L2, @r7
+m3
+m3
+L3: dec L1
+lea L2, @r5
+cmp -478, @r5
+rts
+prn L0
+mov L1, L3
+jsr @r3
+L4: bne L0
+m3
+sub L0, L1
+add -222, L0
+m3
+sub @r1, @r3
+lea L3, @r3
+add 360, @r1
+rts
+L5: mov @r1, @r3
+mov @r4, @r3
+red @r5
+L6: red @r3
+red L5
+prn 457
+bne L11
+rts
+m4
+bne L6
+add @r4, @r2
+mov @r0, @r5
+jmp L1
+m0
+jsr @r3
+lea L2, @r3
+L7: cmp -436, @r1
+sub @r7, @r4
+sub @r3, L4
+jmp @r5
+cmp @r4, @r7
+prn L7
+bne @r0
+sub 146, L4
+dec @r4
+inc L4
+L8: sub -198, L4
+jmp @r6
+bne L2
+red L2
+rts
+cmp 501, @r7
+not L33
+L9: dec @r3
+L10: sub @r5, @r7
+lea L10, @r7
+sub 418, L10
+add L4, @r1
+m3
+L11: bne L9
+L12: sub D0, L3
+prn @r7
+m2
+prn L8
+jmp @r7
+add -364, L11
+lea L27, L7
+jmp @r1
+jsr L8
+prn @r6
+rts
+lea L12, @r1
+dec L7
+L13: not L3
+dec @r4
+m2
+L14: dec L8
+L15: dec L7
+bne L6
+clr X1
+red @r2
+not L9
+L16: mov -186, @r7
+lea L1, L5
+mov -484, L11
+lea L12, L18
+jmp S1
+lea L8, @r2
+mov L2, @r7
+clr @r2
+m0
+jsr @r1
+L17: prn L6
+add @r2, @r0
+red L6
+lea X2, @r5
+rts
+lea L10, L10
+cmp L0, L1
+not L9
+L18: inc @r1
+rts
+m4
+L19: clr L11
+sub @r3, @r4
+add 382, @r6
+L20: lea L4, @r6
+inc L17
+red @r5
+L21: mov @r0, @r6
+rts
+cmp 184, @r5
+red L7
+jmp @r7
+jsr L11
+clr L3
+dec @r7
+jmp L27
+sub L14, L18
+dec L20
+L22: clr L10
+not @r1
+cmp L14, 123
+cmp -2, 71
+add 115, @r4
+jmp L18
+jsr @r5
+add @r7, @r5
+L23: jmp L11
+m1
+not S0
+prn L8
+lea L21, L15
+jmp L14
+L24: clr L3
+L25: clr @r5
+prn @r7
+not @r6
+bne @r7
+dec @r5
+L26: mov @r3, @r0
+bne L14
+bne L25
+mov -277, @r0
+jmp @r3
+not @r1
+clr @r3
+jmp @r4
+mov -434, @r4
+sub @r1, L10
+not @r2
+mov @r5, L6
+L27: not L25
+not @r4
+inc L24
+add 325, L16
+sub @r0, L9
+L28: prn @r1
+red @r7
+m1
+bne @r7
+clr L27
+lea L8, @r1
+prn 32
+L29: lea L22, L24
+m4
+m0
+m0
+mov @r6, @r1
+jmp L29
+bne @r3
+bne @r7
+m1
+not L29
+red @r6
+jmp @r2
+cmp L24, @r4
+dec L14
+sub -15, L17
+clr @r1
+L30: inc @r2
+add L25, L22
+sub L25, @r2
+m1
+mov @r4, @r3
+not L6
+not @r1
+red @r6
+sub 225, L24
+cmp @r5, @r2
+clr @r0
+rts
+L31: sub @r6, L9
+not L28
+jsr L27
+red @r6
+clr L4
+L32: clr L32
+add @r6, L1
+L33: jsr L7
+sub L0, @r2
+prn L30
+jmp L21
+bne @r0
+dec @r6
+inc L24
+L34: jmp L30
+sub -92, @r2
+dec @r5
+lea L14, L25
+L35: red @r3
+not L4
+lea L33, D0
+m2
+clr L26
+rts
+not L26
+mov @r0, L27
+L36: cmp @r5, L24
+jmp @r1
+L37: inc L19
+red @r6
+inc @r1
+cmp -483, -147
+dec L15
+inc @r3
+prn -465
+cmp @r5, -279
+jsr @r4
+bne @r3
+inc L2
+jsr @r1
+L38: dec @r2
+rts
+rts
+not L21
+sub 378, @r3
+lea L0, @r1
+prn -462
+clr L6
+bne L0
+jsr @r6
+L39: bne @r5
+L40: inc L18
+rts
+L41: add 208, L29
+bne L1
+L42: mov L11, @r5
+m3
+cmp @r2, 481
+mov L23, L5
+inc @r1
+lea L13, @r2
+inc @r2
+L43: mov -386, @r1
+rts
+add @r1, @r6
+prn L5
+prn @r4
+dec L8
+sub -373, L49
+bne @r2
+not L20
+jsr L25
+mov -307, L21
+L44: prn @r3
+add L41, L27
+mov L59, L33
+sub L51, @r5
+m1
+clr @r5
+L45: mov @r4, @r4
+jsr L16
+inc L5
+m1
+not @r3
+prn L13
+inc D0
+L46: sub L41, @r7
+bne L47
+L47: add @r4, L6
+L48: not @r1
+sub @r3, D0
+cmp 456, @r1
+red @r3
+rts
+sub @r7, @r4
+m4
+cmp @r0, L48
+dec L3
+lea L23, @r5
+L49: jsr L48
+lea L44, L10
+rts
+mov L48, L55
+not @r5
+m4
+bne L56
+not L50
+L50: sub @r4, @r5
+jsr L27
+clr @r3
+clr @r2
+jmp L26
+clr @r4
+bne @r6
+m4
+add L12, @r4
+dec @r0
+m0
+add -221, L50
+L51: jmp @r2
+cmp -45, 163
+L52: jsr @r2
+inc @r4
+L53: inc D0
+m3
+not @r2
+prn L13
+m3
+bne L33
+m2
+not X3
+L54: dec S0
+mov X4, @r0
+dec @r5
+m1
+jsr @r3
+cmp @r5, @r0
+dec L28
+not L11
+prn @r1
+jsr L48
+clr L23
+m2
+m4
+add L0, @r3
+L55: lea L45, @r4
+jsr S7
+clr L18
+red L17
+inc @r0
+jsr @r2
+clr S5
+L56: mov 193, L35
+red @r4
+jmp L58
+bne L37
+prn L9
+add @r4, L42
+L57: add -508, @r0
+sub @r3, S3
+clr L8
+lea L4, L27
+not @r6
+jsr @r6
+jmp L59
+m3
+cmp @r3, 112
+clr L4
+L58: dec @r5
+lea L3, @r4
+not @r0
+red L39
+L59: jsr @r1
+rts
+prn 433
+bne @r4
+sub @r6, @r5
+prn S7
+bne S8
+add D0, @r1
+cmp D0, @r3
+m2
+rts
+sub S4, S2
+jmp S3
+add D0, D0
+prn S5
+lea S1, L45
+stop
+D0: .data -398,414,-401,61,-26,-173,399,128,158,-350
+D1: .data -413,496,-9,-33,-432,-324,280,-180,-96,249
+D2: .data -75,-73,-398,230,-275,-387,412,-326,344,-342
+D3: .data -150,-413,-7,-151,-158,221,-117,-437,-254,-405
+D4: .data -455,8,-382,242,-116,18,-318,-68,-218,268
+D5: .data 421,82,-406,-242,-159,230,72,124,-235,171
+D6: .data 413,96,-316,-329,284,385,-461,131,-480,124
+D7: .data -192,136,101,196,302,-192,335,-394,242,206
+D8: .data 167,-204,-218,77,-110,345,125,61,-317,150
+D9: .data -264,478,-159,-260,352,247,-425,-276,-416,-157
+S0: .string "orwuxkszgznnrowo"
+S1: .string "hetj"
+S2: .string "yepsrbuppmxnlkk"
+S3: .string "qwzlrsgjh"
+S4: .string "hunlml"
+S5: .string "kbohrbp"
+S6: .string "ohfibhf"
+S7: .string "ftmcvdsshytguucv"
+S8: .string "chpmykwcdbwuuepdyji"
+S9: .string "fypo"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r1
+    prn 12
+endmcro
+mcro m1
+    sub @r3, @r0
+    prn 17
+endmcro
+mcro m2
+    sub @r5, @r7
+    prn 72
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 22
+endmcro
+mcro m4
+    sub @r4, @r6
+    prn 39
+endmcro
+jmp @r0
+lea L0, L0
+m2
+sub @r5, @r3
+not @r7
+L0: rts
+L1: dec L1
+sub 104, @r6
+clr L53
+prn L1
+clr L1
+L2: clr @r7
+red @r6
+rts
+not @r0
+prn @r7
+bne @r3
+red @r0
+clr @r1
+bne L0
+add -465, @r5
+m1
+prn @r7
+red @r0
+not L0
+m1
+jsr L2
+not @r7
+cmp @r3, -348
+rts
+not L2
+L3: clr L2
+jmp L0
+L4: lea L1, L1
+L5: jmp L2
+jmp L1
+jsr @r6
+dec L4
+bne @r7
+dec L3
+cmp -106, L0
+add @r4, L3
+sub L1, L5
+dec L5
+dec @r6
+clr L5
+clr @r0
+L6: prn D0
+cmp @r7, L1
+add 494, L5
+lea L1, D0
+red @r1
+dec L2
+m0
+prn @r5
+inc @r2
+mov L6, @r3
+not @r6
+cmp @r3, @r4
+red @r2
+rts
+not L6
+add 87, @r7
+mov L5, @r6
+clr @r5
+sub @r5, L1
+inc @r7
+lea L6, @r1
+bne L1
+red @r3
+L7: rts
+red @r7
+L8: dec @r4
+jmp L8
+jsr @r5
+L9: jmp L9
+jmp L9
+rts
+inc @r6
+add @r2, @r7
+L10: cmp L0, L10
+add @r7, @r7
+clr @r7
+add 462, @r6
+dec L4
+clr @r2
+mov @r4, L6
+sub L7, L7
+dec L10
+rts
+jmp @r3
+rts
+rts
+clr @r1
+cmp L9, @r2
+rts
+jsr @r7
+sub L9, L2
+lea L9, L5
+add @r3, L7
+mov 125, L5
+inc @r1
+clr @r1
+m2
+inc L0
+jmp @r1
+jsr L9
+not @r6
+m2
+clr @r7
+rts
+m0
+dec @r7
+dec @r4
+dec @r5
+lea L3, @r4
+jsr L2
+prn 440
+not @r5
+cmp @r1, L6
+cmp L4, L4
+bne @r2
+dec @r6
+dec L8
+jsr L7
+add -386, @r0
+inc @r2
+jsr @r1
+L11: red L3
+m1
+inc L9
+add -75, S5
+m2
+m1
+jsr @r0
+m1
+m4
+sub L5, @r5
+red L3
+L12: mov -69, @r3
+inc @r0
+add L25, @r7
+add -464, L2
+not L8
+L13: mov L3, @r2
+cmp 26, @r1
+prn -270
+rts
+jmp L1
+not L8
+red L40
+jmp @r1
+sub 244, @r0
+bne @r3
+clr L13
+rts
+cmp L7, L12
+prn 391
+prn -216
+L14: not @r7
+sub L12, @r0
+prn @r0
+rts
+jsr @r0
+rts
+prn -401
+L15: rts
+bne @r1
+dec @r6
+add L52, @r1
+clr @r5
+m2
+jsr L14
+add @r0, @r5
+rts
+m2
+m2
+inc @r6
+sub L9, @r4
+inc L13
+red L10
+L16: cmp @r5, L1
+add @r6, L6
+rts
+cmp 202, L16
+sub L16, L0
+red L2
+m2
+m3
+jsr @r7
+add @r4, L8
+add L9, L8
+m4
+lea L47, L0
+dec @r7
+inc @r1
+inc L14
+inc L11
+L17: dec @r3
+L18: jmp @r5
+cmp 175, @r5
+sub -456, @r3
+L19: prn -299
+prn -162
+m1
+red L2
+cmp @r3, @r5
+inc L12
+L20: jmp L3
+cmp @r2, -474
+L21: jsr @r5
+L22: jsr @r2
+lea D0, L13
+dec L20
+cmp 295, L9
+not @r3
+not L22
+cmp L22, @r5
+L23: not L45
+prn -191
+inc @r5
+not @r3
+inc L0
+sub -211, L28
+jmp @r5
+L24: jsr L7
+mov L5, L21
+jsr L22
+m0
+lea L11, L33
+rts
+L25: prn @r3
+mov 446, @r7
+inc L23
+L26: clr @r6
+mov @r6, L4
+red L12
+not @r7
+m1
+jsr @r4
+mov -302, @r5
+rts
+not @r0
+rts
+lea L15, @r6
+add L7, L1
+jsr @r7
+lea S1, L55
+mov @r3, @r1
+add @r0, @r4
+L27: lea L15, @r7
+inc @r1
+jsr @r5
+lea L9, @r6
+lea L14, L16
+lea L23, L27
+rts
+L28: jsr @r0
+sub L1, L24
+rts
+cmp 263, 397
+red @r1
+dec @r3
+m1
+rts
+jmp L45
+not L58
+L29: jmp @r1
+sub @r1, @r4
+lea L9, @r0
+m2
+cmp 342, L11
+jmp @r6
+L30: sub L2, L5
+sub @r0, L7
+mov L18, @r7
+rts
+L31: clr @r5
+cmp 117, S8
+clr @r1
+lea L7, L11
+not X0
+cmp L11, @r7
+prn L4
+red @r4
+L32: jmp L14
+L33: rts
+not @r1
+m3
+m4
+L34: rts
+m3
+rts
+L35: red L5
+prn -147
+red @r5
+dec @r1
+red @r6
+jmp @r7
+cmp @r7, -429
+L36: sub L56, @r0
+cmp L9, 198
+lea L9, @r2
+red @r7
+sub @r1, L5
+L37: inc @r5
+m1
+L38: jmp L26
+red @r2
+L39: prn L1
+L40: prn -160
+bne L0
+L41: inc @r5
+L42: rts
+red L58
+inc @r3
+bne S6
+bne L1
+L43: add -309, @r0
+jmp L4
+red @r7
+lea L9, @r7
+red @r6
+L44: dec X1
+m2
+inc @r5
+prn -355
+mov @r3, L43
+rts
+add L23, L4
+sub -340, @r4
+prn L25
+bne L26
+L45: jsr @r7
+red @r3
+L46: lea L8, @r7
+add L45, S5
+sub 126, @r4
+cmp L18, L8
+cmp @r3, @r5
+prn @r6
+red L49
+not @r1
+not @r3
+jmp X2
+lea L21, @r6
+rts
+L47: lea L52, L28
+m2
+prn -3
+m2
+dec L27
+not @r0
+m0
+not @r3
+L48: add @r2, L39
+inc @r1
+m1
+sub @r5, D0
+dec L59
+m3
+inc L7
+prn @r2
+add L29, L7
+prn -439
+prn @r6
+prn -118
+sub @r2, L24
+L49: not X3
+inc @r6
+lea L18, L27
+inc @r4
+clr L34
+sub @r7, @r4
+not @r7
+lea L39, L0
+dec @r7
+sub @r6, @r4
+rts
+lea D0, @r7
+L50: rts
+m2
+prn @r6
+m1
+clr @r2
+red L41
+add -138, @r6
+bne X4
+sub 424, @r7
+mov S3, L23
+clr L26
+red L4
+jmp L10
+lea L35, L39
+lea L39, @r3
+L51: dec S4
+bne @r0
+lea L44, @r0
+mov @r0, L55
+L52: jsr L22
+sub L44, @r4
+cmp D0, -423
+prn @r3
+prn @r4
+not L47
+cmp @r2, L33
+m2
+prn @r1
+bne L35
+L53: dec @r5
+m3
+L54: bne L55
+prn @r0
+not S8
+L55: cmp @r3, @r3
+jsr L0
+red L59
+m0
+sub L50, @r1
+mov -71, @r6
+jsr L17
+clr @r2
+L56: not L25
+bne @r5
+red L8
+m0
+dec @r4
+add 141, S8
+inc @r1
+add -337, S0
+dec @r3
+m1
+bne L31
+L57: lea S2, L58
+bne L13
+jsr D0
+mov 245, S2
+L58: not L30
+sub @r6, @r1
+L59: jsr S5
+stop
+D0: .data -332,-468,-461,-446,-421,325,445,73,229,434
+D1: .data 199,63,15,139,227,481,-351,389,28,-433
+D2: .data 52,-280,50,228,-215,233,23,325,-476,-72
+D3: .data 448,21,-225,134,-159,-497,-385,333,-259,-42
+D4: .data 408,106,107,197,-403,404,-170,273,188,493
+D5: .data 312,-438,-302,-145,-281,-181,49,356,466,247
+D6: .data 392,-78,184,156,-26,392,-193,-252,79,-13
+D7: .data 377,324,-10,-9,-310,-280,-63,147,-480,478
+D8: .data -129,-293,-306,149,206,-22,-202,10,-313,-462
+D9: .data -468,410,320,-203,-86,-322,-150,-192,-282,-204
+S0: .string "iegmxnrwqbyo"
+S1: .string "cnm"
+S2: .string "pwbiohbihppe"
+S3: .string "nrujm"
+S4: .string "nuigc"
+S5: .string "m"
+S6: .string "koklytrfsw"
+S7: .string "pctibzpyjrn"
+S8: .string "qdbgsauoxgxncgfno"
+S9: .string "ltttebxtuvzu"
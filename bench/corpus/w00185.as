@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r4
+    prn 82
+endmcro
+mcro m1
+    sub @r7, @r1
+    prn 15
+endmcro
+mcro m2
+    sub @r7, @r5
+    prn 69
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 67
+endmcro
+mcro m4
+    sub @r6, @r4
+    prn 95
+endmcro
+inc L0
+lea L0, L0
+clr L0
+inc L0
+clr @r6
+dec @r1
+red @r7
+L0: not L0
+L1: add @r1, @r6
+m1
+sub -401, L0
+red L1
+rts
+add -490, @r6
+lea L0, L1
+jsr L1
+jsr @r1
+m2
+clr @r0
+cmp -344, L0
+m2
+jmp @r3
+sub @r7, L0
+sub @r7, @r5
+prn @r6
+add 22, @r2
+cmp @r2, L0
+bne @r1
+dec @r7
+L2: inc L0
+L3: not @r2
+bne L13
+cmp @r7, L3
+cmp 35, 444
+clr L0
+m1
+L4: add 205, @r0
+inc L2
+bne @r1
+sub L3, L3
+add 422, L57
+L5: cmp -149, @r5
+bne @r0
+bne @r3
+dec @r1
+dec L1
+add @r7, L5
+inc @r6
+prn L3
+L6: lea S7, L3
+m4
+rts
+mov L0, @r6
+mov 345, L3
+bne @r0
+cmp L0, @r2
+jmp L4
+L7: red L5
+inc @r6
+sub -193, @r1
+bne @r6
+sub S2, @r7
+prn L1
+red L0
+dec @r2
+sub L5, @r6
+jsr L4
+not @r2
+m1
+lea L2, L5
+dec @r7
+clr L3
+m4
+L8: clr L18
+L9: mov 238, @r5
+dec X0
+red L0
+L10: rts
+mov L3, @r6
+sub @r1, L9
+rts
+not L4
+jsr @r7
+mov -359, L4
+lea S5, @r7
+dec L8
+L11: inc @r1
+sub L7, @r0
+rts
+add @r3, L0
+m4
+sub 253, L2
+mov -126, L6
+L12: sub 172, @r6
+L13: rts
+jmp L2
+m2
+not @r7
+L14: not L13
+sub -471, L6
+not L11
+jsr @r3
+m0
+red L13
+not L16
+add @r0, L5
+L15: lea L8, @r2
+m1
+L16: inc L4
+rts
+cmp @r0, @r5
+jsr L15
+jsr @r6
+inc L7
+cmp @r3, L1
+add @r0, @r3
+L17: dec @r2
+prn L10
+bne L1
+m3
+not L17
+cmp 510, -177
+rts
+prn @r5
+m2
+dec @r4
+dec L11
+bne L10
+not @r2
+inc D0
+cmp @r5, @r5
+L18: rts
+m1
+sub 63, @r3
+m2
+cmp 424, @r6
+L19: dec @r2
+jsr L19
+add L13, @r5
+inc @r1
+not @r2
+inc @r5
+inc @r2
+lea L5, @r1
+L20: clr L15
+m3
+jsr @r3
+mov @r3, @r0
+jmp @r1
+red @r4
+L21: inc S1
+not @r4
+not L54
+prn L5
+m4
+rts
+inc @r1
+lea L7, S3
+dec L8
+L22: add @r4, @r3
+not L0
+jmp L20
+inc L17
+red L3
+sub L18, L11
+m4
+rts
+jmp @r5
+cmp 26, 442
+L23: cmp L7, @r0
+bne L6
+jsr L15
+mov 167, @r4
+lea L1, @r7
+m0
+clr @r4
+jmp D0
+cmp L8, -97
+m0
+lea L2, @r2
+mov @r1, L24
+jsr L1
+inc L0
+bne L15
+inc @r3
+prn 285
+dec L12
+cmp L0, 314
+rts
+cmp @r6, -510
+sub -208, @r4
+L24: not @r3
+bne @r1
+dec @r0
+L25: add D0, @r2
+not L2
+inc @r7
+mov @r5, @r4
+inc @r5
+add L7, @r7
+bne @r2
+L26: inc L15
+m0
+jmp S5
+cmp 25, L1
+clr @r3
+add -374, L1
+prn @r2
+inc @r5
+rts
+add -504, @r5
+L27: rts
+dec @r3
+jmp @r1
+mov 235, L22
+L28: add 26, @r7
+rts
+dec L28
+cmp L42, 197
+rts
+m2
+L29: bne L6
+dec L16
+prn L6
+clr @r5
+prn -318
+L30: inc L3
+cmp L12, -319
+L31: clr @r0
+dec L7
+L32: dec @r0
+m1
+sub L13, @r2
+lea L27, L4
+rts
+cmp L0, L14
+clr L20
+prn L3
+lea L1, @r7
+sub L32, @r6
+L33: rts
+L34: prn @r4
+jsr @r2
+sub -216, @r1
+dec @r5
+m1
+jmp L34
+sub L0, L31
+rts
+red L34
+jsr @r7
+add L5, @r6
+prn L51
+inc @r2
+add L21, L34
+m3
+lea L13, @r5
+inc L17
+m3
+sub L28, S5
+add @r2, L27
+mov L23, @r0
+prn L34
+dec L34
+add L21, @r5
+dec @r7
+rts
+lea L19, @r7
+L35: lea L26, @r4
+jmp L3
+jsr @r2
+jmp @r5
+mov @r7, L58
+jsr L22
+sub @r7, L12
+L36: clr L23
+L37: mov @r6, D0
+bne @r2
+L38: prn L4
+sub @r5, @r2
+inc L27
+not @r5
+jmp @r6
+inc L7
+clr L16
+red @r5
+sub -30, L28
+m4
+bne L38
+clr L18
+L39: inc L36
+inc L22
+prn L25
+sub @r2, @r3
+prn L20
+bne @r6
+jmp @r0
+jsr @r3
+clr L32
+bne L43
+lea D0, @r7
+lea L23, L4
+prn L37
+m3
+clr L39
+jsr L35
+red @r0
+dec @r7
+clr L20
+bne L32
+L40: add @r7, @r6
+lea L2, L38
+bne @r5
+L41: jmp S1
+add -259, @r6
+jmp L14
+rts
+mov 422, L35
+prn @r4
+add 509, L9
+lea L2, L0
+mov @r3, @r2
+add L10, @r4
+add -82, @r5
+clr @r1
+clr L9
+add 248, @r4
+inc @r5
+m0
+mov L6, @r2
+not L34
+L42: mov L34, @r2
+sub @r4, L16
+rts
+m4
+clr L22
+cmp 303, -92
+add 117, L3
+mov 40, L59
+m2
+bne @r4
+jmp @r6
+mov @r0, L6
+m1
+L43: inc @r7
+rts
+cmp L6, 94
+prn L7
+clr L34
+L44: prn @r2
+prn L32
+L45: bne L47
+clr @r0
+L46: lea L18, @r1
+m2
+add L26, L9
+clr L17
+dec @r5
+clr L16
+bne @r5
+dec L30
+not L7
+mov 204, @r4
+bne S4
+m4
+rts
+red L2
+cmp @r5, 278
+clr @r4
+cmp 232, @r1
+L47: rts
+red @r1
+add 330, L46
+red L25
+red L42
+L48: inc @r0
+dec X1
+clr @r4
+rts
+m3
+jsr D0
+mov -193, L9
+sub -237, @r4
+clr @r6
+jsr L29
+prn L35
+add @r2, L13
+sub @r0, @r6
+cmp 508, -295
+inc X2
+clr @r3
+L49: cmp @r0, @r6
+lea S9, @r0
+lea L8, @r3
+jmp L33
+prn -449
+L50: jmp L47
+dec L14
+L51: bne L54
+jmp L15
+cmp 469, L36
+L52: red D0
+L53: sub L25, @r4
+add @r5, @r0
+m4
+cmp 168, @r2
+clr @r1
+prn 219
+m2
+L54: cmp L41, @r6
+jmp L11
+dec L41
+jmp L20
+add 108, L39
+not L59
+dec L16
+add 336, L57
+prn @r4
+dec @r2
+m1
+clr L23
+sub 480, L57
+m4
+L55: inc L52
+m4
+add L17, @r7
+L56: red L19
+lea L1, @r1
+L57: mov @r7, @r3
+jmp X3
+mov -459, @r3
+L58: not S0
+dec S1
+L59: clr X4
+jmp @r3
+add S8, @r7
+clr S2
+dec S6
+sub S3, D0
+prn @r5
+stop
+D0: .data -426,434,195,354,-2,-311,105,-342,187,305
+D1: .data 482,-282,-156,-401,-431,38,-386,372,173,-106
+D2: .data -71,-125,-251,-158,-17,398,-227,-104,121,-278
+D3: .data -134,-120,16,408,-401,-467,-487,-50,436,-400
+D4: .data 441,-291,361,-17,20,-299,-127,323,429,-143
+D5: .data 142,421,12,-487,91,223,235,224,2,-326
+D6: .data -130,-195,454,118,451,-484,-109,293,-180,21
+D7: .data 391,-477,-217,-360,156,-401,-284,196,172,204
+D8: .data 273,85,-408,108,429,123,395,-158,-319,337
+D9: .data 303,-196,497,469,-273,-75,55,293,499,171
+S0: .string "qcxipxwtaxyqtt"
+S1: .string "cmtafldvuhxjkdmnu"
+S2: .string "xsrkb"
+S3: .string "gnjzrxxb"
+S4: .string "sain"
+S5: .string "dzvsts"
+S6: .string "lvg"
+S7: .string "zqioo"
+S8: .string "wixkmvaf"
+S9: .string "blqxgbaqa"
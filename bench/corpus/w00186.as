@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r6
+    prn 21
+endmcro
+mcro m1
+    sub @r4, @r2
+    prn 14
+endmcro
+mcro m2
+    sub @r1, @r3
+    prn 34
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 43
+endmcro
+mcro m4
+    sub @r0, @r2
+    prn 20
+endmcro
+jsr @r2
+bne @r3
+red @r2
+mov @r5, S9
+L0: cmp L0, @r2
+m1
+lea L0, L0
+m2
+m1
+mov L0, L0
+lea L0, L0
+mov 232, L0
+rts
+inc L0
+cmp -49, L0
+dec @r1
+red @r3
+jmp L0
+jmp L0
+jmp @r0
+L1: not @r4
+jmp @r6
+jmp @r2
+mov L1, @r3
+bne @r7
+mov L0, @r6
+L2: add L0, @r6
+sub 445, @r1
+not L34
+jmp L0
+L3: clr L0
+sub @r0, X0
+mov L3, @r6
+L4: prn L0
+jsr S9
+mov L19, @r7
+bne @r7
+inc @r5
+prn L0
+rts
+m1
+m4
+lea L2, @r5
+sub 78, @r2
+rts
+L5: rts
+red L2
+rts
+prn @r1
+sub 220, L0
+L6: jsr @r1
+add 472, @r2
+L7: mov L2, L5
+L8: red @r4
+prn 319
+jsr D0
+L9: inc @r5
+red @r1
+dec L4
+clr @r1
+jsr L7
+red @r0
+red L3
+not @r1
+clr @r2
+not @r0
+add -443, D0
+mov @r2, @r6
+m2
+L10: dec @r1
+not @r1
+clr L0
+dec @r0
+add @r0, L0
+L11: sub 432, L3
+cmp -171, 370
+lea L9, @r5
+rts
+inc @r5
+mov L7, @r5
+lea L1, @r6
+m1
+prn L11
+L12: bne @r6
+inc @r7
+L13: prn @r7
+lea D0, L12
+mov 348, @r7
+inc L11
+prn L4
+add @r6, @r2
+mov @r0, @r4
+cmp L13, S8
+sub L12, L12
+red @r0
+jsr L2
+mov @r0, L7
+m3
+inc @r4
+bne @r4
+jmp @r2
+jsr L45
+add L2, @r2
+lea L6, L12
+jsr L12
+bne @r2
+dec @r0
+clr L3
+mov L0, L6
+red L9
+L14: jmp @r0
+clr @r1
+red L1
+m2
+clr @r6
+red L10
+m4
+cmp @r3, @r7
+m1
+add D0, L7
+m3
+jsr L12
+add L0, L4
+inc L8
+clr @r5
+clr L12
+mov @r0, L8
+clr L2
+L15: dec @r4
+inc L9
+jmp @r6
+cmp L7, -468
+bne L10
+m3
+rts
+add -121, @r1
+prn @r3
+jsr @r6
+dec @r2
+lea L13, @r7
+cmp L13, L7
+clr @r0
+lea L6, L14
+rts
+L16: clr @r7
+sub L0, @r1
+cmp 46, L12
+bne @r1
+L17: prn @r3
+L18: prn L12
+not @r0
+lea L13, @r5
+m2
+mov L10, S2
+not @r3
+not X1
+m2
+sub 59, L8
+cmp -325, 69
+dec L16
+add @r0, L11
+cmp @r1, @r1
+cmp L4, L6
+jmp L8
+sub L16, L2
+lea L10, @r4
+bne @r7
+jmp L6
+mov @r4, L15
+red @r0
+rts
+clr L3
+lea L46, @r5
+not @r7
+rts
+mov L11, L5
+jsr @r5
+m0
+inc @r3
+L19: dec L12
+clr L1
+dec @r2
+L20: rts
+sub @r5, L9
+jsr L18
+lea L19, L6
+jmp L11
+red L19
+red L20
+red L18
+add @r7, @r5
+mov L10, @r0
+prn 268
+L21: cmp -350, @r0
+dec L13
+inc D0
+add L9, @r4
+L22: mov 166, @r5
+dec L8
+lea S2, @r6
+mov @r2, L21
+L23: bne @r3
+lea L13, @r4
+prn @r7
+mov @r1, @r1
+mov @r4, L18
+lea L15, @r5
+dec L23
+bne @r7
+red @r0
+not @r2
+not L13
+add L7, L0
+jsr L20
+clr L19
+sub L10, L20
+clr L12
+bne @r0
+clr @r1
+lea L5, L18
+lea L10, @r2
+sub @r0, @r1
+red L0
+not L6
+jsr L2
+dec L8
+L24: bne L38
+red @r0
+rts
+sub @r0, @r5
+L25: add @r0, @r5
+add @r0, @r4
+not @r1
+add L22, @r0
+jsr L20
+mov -290, L23
+cmp L24, @r0
+add L28, L10
+m3
+L26: rts
+dec L16
+prn @r5
+L27: dec X2
+rts
+m1
+mov 171, L3
+prn @r1
+jsr L18
+dec L15
+L28: jmp @r5
+lea L12, L2
+m1
+mov -462, L28
+mov L12, L28
+prn @r3
+cmp @r7, L0
+L29: jsr L10
+prn @r6
+m1
+lea L8, @r1
+not @r5
+jsr L21
+dec L28
+L30: bne L21
+jsr @r6
+m0
+jmp L22
+jsr @r0
+sub L16, @r1
+add -475, @r5
+rts
+cmp -483, -246
+clr L27
+cmp @r0, L0
+mov L23, L56
+jsr L29
+m0
+jsr S8
+red L1
+prn L13
+L31: jsr L27
+m4
+lea L15, @r1
+prn -341
+L32: add L28, @r4
+L33: bne L8
+mov L11, L19
+L34: clr @r3
+clr @r7
+rts
+add L6, @r5
+prn L39
+jmp L10
+m4
+jmp L0
+mov L10, @r5
+bne @r1
+L35: bne @r2
+mov @r0, @r1
+red L25
+clr @r5
+add @r2, @r4
+not @r5
+m0
+m3
+bne @r5
+prn 295
+L36: bne @r4
+L37: not L28
+inc L27
+prn L30
+sub 152, @r2
+L38: jmp L47
+m2
+bne @r4
+L39: lea S4, L16
+clr @r3
+not @r2
+m2
+jmp @r4
+m2
+sub @r5, @r2
+L40: cmp 300, L24
+L41: prn 406
+m3
+rts
+not L0
+L42: bne @r7
+not @r5
+red @r0
+lea L20, L7
+prn @r4
+mov L26, @r7
+m1
+cmp @r5, L28
+mov L28, @r1
+jsr L34
+L43: jmp L15
+m0
+add @r2, L10
+red @r2
+mov L11, L17
+inc L18
+jsr @r7
+rts
+L44: clr @r6
+bne @r7
+rts
+red @r1
+red D0
+jsr @r0
+prn -280
+red L5
+jmp @r0
+mov L29, L2
+dec L3
+mov L57, L37
+L45: inc @r7
+clr @r2
+lea L35, @r6
+clr L9
+prn @r4
+lea L5, L6
+clr L41
+lea L33, @r7
+inc L11
+dec @r0
+cmp @r3, -437
+clr @r1
+m3
+m1
+jmp L47
+L46: inc @r6
+jsr @r2
+add D0, L46
+L47: bne D0
+L48: clr @r5
+dec L30
+dec @r2
+prn 406
+L49: lea L13, L31
+jmp @r3
+L50: sub @r2, @r4
+L51: dec L27
+lea L14, @r1
+L52: mov L49, @r0
+clr @r6
+inc @r4
+cmp S0, 469
+dec @r2
+jmp L37
+m0
+dec L45
+cmp @r7, S9
+jsr @r2
+jsr @r0
+lea L26, L15
+m4
+red L58
+sub @r2, L41
+L53: jsr L21
+not L13
+L54: dec @r2
+jmp L27
+m1
+mov L30, L50
+lea L19, @r7
+not L0
+m4
+jsr L20
+jmp L48
+add @r0, @r3
+dec @r0
+add 370, L27
+lea L7, @r5
+dec @r0
+prn -268
+jmp @r6
+clr @r5
+bne D0
+lea S4, L55
+L55: rts
+clr @r7
+clr @r1
+prn L24
+prn @r4
+not L17
+L56: mov @r5, @r2
+bne D0
+lea L45, S9
+L57: jsr @r4
+L58: add @r4, L59
+m0
+L59: inc L19
+mov D0, L10
+mov X3, D0
+add S6, @r5
+jmp D0
+m2
+lea X4, D0
+stop
+D0: .data 83,102,-2,257,-231,166,225,120,162,324
+D1: .data -105,-268,-247,-396,221,284,-273,-180,-418,-497
+D2: .data -34,13,-433,-392,-281,183,-471,363,-495,300
+D3: .data -418,357,-264,425,184,281,474,-377,411,-447
+D4: .data 328,-244,-288,197,-218,252,-336,-230,-408,-103
+D5: .data 391,-203,-61,64,292,-74,-181,-68,-454,128
+D6: .data 146,232,364,-378,372,442,384,-403,-366,64
+D7: .data -187,494,409,119,-258,260,316,445,451,154
+D8: .data -146,-497,-414,-221,-12,291,-273,-170,397,-321
+D9: .data -266,-145,14,10,418,-131,20,38,158,269
+S0: .string "ogmpalhc"
+S1: .string "avnxmid"
+S2: .string "atqcnptynnbxglpzwl"
+S3: .string "osblfim"
+S4: .string "urftgvocka"
+S5: .string "csaznglesgplzvbrrda"
+S6: .string "nhgwqzwpqyxa"
+S7: .string "djdwssiw"
+S8: .string "jlcbvammffhd"
+S9: .string "klvgdayxcdjfkibwf"
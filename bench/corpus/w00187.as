@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r1
+    prn 91
+endmcro
+mcro m1
+    sub @r0, @r3
+    prn 12
+endmcro
+mcro m2
+    sub @r3, @r0
+    prn 0
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 19
+endmcro
+mcro m4
+    sub @r2, @r0
+    prn 44
+endmcro
+sub @r2, L0
+jsr @r0
+add L0, @r7
+clr @r5
+sub @r1, L0
+L0: prn -1
+jsr @r3
+dec @r2
+m4
+cmp L0, L0
+lea L0, @r7
+L1: inc @r3
+add 158, @r7
+add L0, @r5
+bne @r0
+jmp @r5
+clr @r6
+red @r6
+lea L4, @r4
+m1
+sub L1, L0
+m4
+dec L1
+mov -102, L1
+not L1
+dec @r1
+dec L0
+dec L1
+clr @r2
+mov L1, L0
+L2: prn L2
+L3: lea L0, @r2
+prn @r1
+bne L1
+sub @r0, @r7
+cmp @r3, @r0
+L4: prn @r6
+prn @r2
+bne @r7
+rts
+red S0
+rts
+mov -198, @r6
+add -81, @r3
+prn -161
+cmp @r7, 177
+dec @r6
+clr L3
+jsr L2
+red L0
+rts
+mov @r0, @r4
+not @r7
+lea S9, L3
+m3
+bne L2
+prn @r7
+add @r2, @r2
+jmp L0
+not @r1
+L5: red L1
+red L0
+lea L3, @r6
+clr @r0
+m0
+L6: jmp L4
+red L4
+rts
+inc L0
+cmp -391, X0
+red L5
+clr L1
+m3
+sub @r3, L5
+dec @r3
+cmp @r7, 185
+jmp L38
+L7: inc @r0
+add L5, @r6
+not @r3
+red @r1
+L8: cmp @r3, 174
+not @r2
+lea L4, @r4
+L9: mov 227, @r2
+inc @r1
+sub -464, @r4
+sub 343, @r4
+add @r0, @r1
+clr L2
+jsr L6
+m2
+m0
+prn -119
+rts
+mov @r4, @r3
+rts
+red @r5
+clr L2
+bne L9
+dec L5
+bne @r5
+jmp @r7
+m4
+add @r3, @r2
+not L8
+L10: prn @r4
+rts
+jsr L13
+cmp -84, @r6
+bne @r0
+dec L5
+lea L3, S2
+L11: mov -423, @r7
+red @r6
+not @r4
+m4
+jmp @r6
+red L0
+red L4
+L12: dec @r5
+cmp @r5, 495
+m0
+L13: lea L8, L4
+red L6
+jmp L2
+bne @r6
+add -192, @r0
+add L3, L10
+cmp @r2, @r5
+add -69, L3
+m4
+L14: mov L11, @r7
+L15: jmp L35
+add L41, L7
+red @r4
+cmp 325, X1
+L16: lea L0, @r5
+red L3
+jmp @r4
+jmp L0
+bne L9
+sub L0, L16
+not @r2
+m4
+m2
+rts
+sub @r3, @r1
+prn 201
+bne @r1
+L17: cmp -503, @r0
+cmp 182, D0
+rts
+m4
+not @r1
+jsr @r0
+L18: jsr L3
+red @r7
+jsr @r2
+add 196, L5
+bne @r6
+m3
+L19: clr L5
+not L58
+sub @r5, @r1
+L20: prn @r2
+jmp @r5
+sub L12, @r7
+not @r6
+cmp 95, L19
+inc @r5
+rts
+red @r7
+not L5
+red L1
+prn L16
+prn L17
+prn @r6
+add -82, D0
+not @r7
+dec @r5
+bne L25
+jsr L8
+red L6
+mov L11, L14
+cmp 455, L6
+inc L17
+clr @r4
+inc @r0
+add L8, @r0
+bne L8
+L21: sub L12, @r6
+dec L40
+m1
+lea L10, @r0
+L22: add L11, L0
+inc L3
+L23: red L42
+add 20, @r7
+red L1
+L24: prn L8
+inc @r6
+red L5
+clr @r0
+m4
+jmp L19
+lea L21, L0
+jsr L46
+jsr @r7
+m4
+L25: clr L18
+jmp @r7
+L26: jsr @r7
+clr @r1
+jmp L22
+clr @r6
+jsr @r1
+m0
+jsr @r5
+prn -44
+L27: jmp @r2
+dec @r3
+m3
+dec @r3
+dec L5
+mov L22, @r4
+red L5
+m3
+clr @r3
+jmp @r4
+m2
+clr L1
+clr L26
+dec @r2
+L28: inc L9
+mov @r6, @r7
+m3
+not @r6
+L29: prn @r5
+prn -304
+lea L4, D0
+red L14
+dec @r0
+clr @r5
+inc @r7
+jsr @r2
+clr L22
+rts
+L30: sub @r5, @r0
+dec @r2
+jsr @r6
+not L1
+inc @r3
+rts
+L31: inc @r1
+jmp L31
+not L0
+not L23
+L32: mov -165, @r2
+prn 284
+L33: jsr @r5
+jsr L2
+m0
+bne L6
+jmp L3
+jsr @r1
+cmp L38, L8
+bne L15
+lea L11, @r6
+cmp -45, L12
+add 27, L6
+inc L57
+clr L24
+L34: prn -178
+rts
+not L32
+jsr L31
+dec @r0
+inc @r0
+L35: lea L4, X2
+inc @r6
+L36: inc L13
+dec @r1
+bne @r5
+L37: rts
+L38: cmp 173, @r0
+jmp D0
+mov L15, @r6
+inc L8
+dec L2
+m0
+L39: bne @r4
+red @r0
+m1
+clr @r7
+L40: red @r0
+L41: add @r1, @r4
+m2
+red @r0
+jmp @r6
+L42: clr @r7
+inc @r2
+m1
+bne @r4
+jsr @r5
+inc @r3
+m2
+add L28, @r7
+lea L5, @r7
+dec @r5
+inc @r2
+jsr @r5
+m1
+mov @r3, L17
+lea L22, L25
+m3
+sub @r7, L17
+cmp L17, @r1
+red L34
+L43: mov L43, L6
+bne L54
+inc @r2
+sub L20, L17
+inc @r2
+clr @r1
+mov @r0, L29
+sub @r7, L39
+L44: jmp L48
+bne @r7
+L45: rts
+jmp @r2
+jmp @r5
+inc @r7
+L46: lea L15, D0
+prn @r6
+inc @r6
+mov 64, @r1
+m3
+L47: cmp @r0, 151
+L48: sub @r2, @r3
+clr L2
+inc L11
+dec @r2
+rts
+sub -408, @r5
+dec @r4
+red D0
+mov D0, @r4
+rts
+sub @r7, L46
+bne L0
+red L1
+rts
+clr @r1
+mov L39, @r3
+m1
+prn L40
+jmp L7
+L49: lea L54, L31
+L50: prn @r7
+red @r1
+m1
+lea L33, L2
+L51: lea L12, @r5
+m2
+bne L2
+L52: rts
+m3
+red @r1
+jmp L43
+inc @r7
+mov S8, @r7
+bne @r2
+jmp L22
+jmp @r5
+bne L13
+jmp @r3
+lea L42, @r5
+cmp 506, @r3
+rts
+L53: dec @r6
+not @r5
+jsr S0
+sub -202, L54
+L54: red L21
+bne @r1
+bne @r0
+jmp L21
+red @r6
+bne L55
+dec L0
+sub @r5, @r1
+mov 443, @r4
+lea L42, L47
+mov @r4, @r7
+jmp @r4
+red L56
+sub @r7, @r2
+m3
+jsr @r4
+L55: prn L49
+mov @r5, L55
+L56: lea L2, @r0
+mov @r4, L18
+rts
+L57: jsr @r5
+L58: inc X3
+jmp @r5
+cmp L59, -263
+mov S2, L31
+dec @r1
+m4
+jmp @r2
+inc @r1
+cmp L21, -416
+dec L42
+prn L23
+dec L59
+jmp @r4
+not @r7
+prn @r2
+L59: sub @r1, @r0
+clr @r7
+jmp @r0
+sub L31, D0
+add -14, @r0
+mov S0, @r1
+dec S7
+mov 392, L31
+cmp L35, -371
+inc X4
+clr L46
+cmp L55, 473
+m4
+dec L33
+add 249, @r1
+add D0, S7
+bne S1
+clr @r4
+mov D0, @r6
+stop
+D0: .data 128,428,214,-210,361,-70,480,76,119,65
+D1: .data 301,365,447,-149,-445,445,130,-243,60,236
+D2: .data 164,-452,376,19,-278,174,324,-213,-218,-332
+D3: .data -440,476,138,-278,197,121,-229,-71,-158,-231
+D4: .data 465,-73,117,-424,-499,-362,-131,196,-484,-405
+D5: .data 284,-490,174,-201,123,311,-245,-241,68,40
+D6: .data 393,376,483,-73,-18,175,49,-35,-412,219
+D7: .data -45,3,408,82,118,-145,-5,269,-415,-226
+D8: .data 302,-207,194,-329,-433,-354,477,-73,-123,-330
+D9: .data -128,198,302,407,249,226,-386,-140,367,334
+S0: .string "ebdtpxzdzvnpr"
+S1: .string "ouozidrthshjfrxiz"
+S2: .string "rfqlpiqsaptmkxbej"
+S3: .string "t"
+S4: .string "vum"
+S5: .string "rmgmaapofldgq"
+S6: .string "knsvraomgonijsoorot"
+S7: .string "ibjs"
+S8: .string "fkazkggrryjzoqpdplyr"
+S9: .string "kipboqvq"
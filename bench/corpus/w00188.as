@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r3
+    prn 29
+endmcro
+mcro m1
+    sub @r5, @r5
+    prn 11
+endmcro
+mcro m2
+    sub @r5, @r6
+    prn 65
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 96
+endmcro
+mcro m4
+    sub @r4, @r7
+    prn 69
+endmcro
+jmp @r3
+add L0, L0
+L0: prn 48
+L1: jsr @r0
+not @r5
+jsr L0
+bne L0
+m0
+mov 103, L0
+jmp L1
+rts
+L2: prn @r6
+jmp L1
+m2
+mov L1, @r5
+add 385, L1
+lea L1, L2
+bne @r0
+mov L0, @r0
+jmp L1
+red L2
+bne L2
+dec @r0
+m2
+jmp L2
+clr @r4
+inc L2
+sub L2, L2
+bne @r7
+add L8, L0
+dec L0
+mov 191, L20
+inc @r4
+L3: inc L1
+m1
+m3
+prn L1
+L4: jsr L1
+sub @r4, @r5
+jsr @r5
+jmp @r0
+rts
+rts
+add @r0, L1
+m1
+L5: jmp @r1
+red L4
+add 379, @r5
+rts
+cmp L5, L2
+cmp L5, @r0
+jmp L5
+add 48, @r0
+L6: sub L1, L3
+L7: not @r3
+L8: lea L7, @r2
+cmp 135, L33
+clr L20
+sub L1, @r4
+not @r4
+L9: jsr @r5
+inc L3
+mov L8, @r5
+inc @r7
+rts
+L10: red @r5
+dec L3
+L11: bne L4
+lea L0, L8
+clr L2
+L12: dec L1
+clr L11
+red @r2
+L13: clr @r4
+jsr @r2
+m2
+dec L8
+jmp L12
+dec L4
+bne @r4
+dec L0
+m0
+jmp L11
+dec L1
+L14: lea L5, L12
+jsr L13
+rts
+red L2
+bne @r6
+m1
+prn L5
+cmp -154, 128
+bne @r4
+lea L5, L5
+jsr L2
+add 381, @r1
+not L14
+sub 16, L6
+dec L0
+red L13
+jmp @r3
+jsr @r3
+bne @r3
+sub L14, @r3
+bne @r6
+mov 402, L9
+L15: clr L2
+mov @r1, L9
+rts
+mov -265, L0
+lea L15, @r4
+bne @r5
+not @r4
+lea L5, @r4
+L16: mov @r7, @r5
+sub L14, L13
+L17: mov @r3, @r3
+bne L34
+L18: not L16
+prn L12
+prn @r3
+bne L12
+jmp L11
+L19: inc L16
+mov L13, @r0
+L20: bne L1
+rts
+dec L35
+m2
+m4
+jmp L19
+mov @r0, @r7
+prn @r4
+clr @r5
+add 253, L5
+m4
+prn L2
+dec @r3
+m4
+add L5, @r3
+mov @r7, L46
+m3
+red @r2
+prn -348
+bne L13
+mov @r1, @r3
+bne L9
+m3
+inc @r6
+jsr L3
+red @r7
+bne @r5
+sub 362, @r7
+mov 244, @r4
+cmp @r2, L9
+jmp @r4
+bne @r1
+not @r4
+mov @r2, L0
+dec @r1
+m2
+add 426, L9
+jmp L5
+jmp L18
+jsr L13
+add 229, @r0
+bne @r2
+m0
+jmp L11
+m4
+rts
+rts
+bne L0
+L21: inc @r5
+inc L14
+jsr L0
+L22: bne L15
+not L41
+jmp @r3
+dec L11
+prn @r1
+bne @r2
+prn @r1
+add @r4, @r7
+L23: inc L13
+jmp L39
+inc L11
+add D0, @r0
+inc L23
+L24: bne @r3
+clr @r2
+red L16
+sub L5, L14
+prn L8
+m3
+jsr L13
+m0
+not @r2
+red @r2
+sub -419, L40
+add @r7, S8
+rts
+prn L1
+m3
+clr @r6
+dec @r0
+dec @r6
+bne @r5
+L25: not @r0
+prn @r0
+cmp @r0, -345
+red L19
+prn @r4
+sub -256, L7
+inc L24
+lea S9, @r0
+jmp S5
+lea S9, @r6
+m0
+lea L18, @r2
+mov @r3, L1
+L26: dec L21
+L27: jsr @r2
+prn @r2
+jsr L12
+sub X0, L5
+not @r4
+red L31
+clr L4
+dec @r5
+jmp @r4
+rts
+add @r2, @r7
+bne @r2
+jmp @r2
+mov L18, @r6
+sub @r4, @r0
+m2
+mov @r2, L23
+L28: bne S2
+jsr @r7
+clr @r6
+dec @r7
+L29: bne @r2
+prn @r4
+jmp @r6
+prn 409
+mov @r4, L20
+dec @r0
+not @r0
+add -493, L18
+m2
+add @r5, @r1
+mov L17, @r3
+mov -348, L36
+cmp @r6, 308
+L30: cmp @r3, @r4
+add 176, @r4
+jmp L7
+dec L12
+jsr L14
+inc L9
+cmp @r6, @r3
+dec L24
+rts
+cmp @r3, @r5
+L31: cmp -56, L3
+rts
+inc @r0
+L32: rts
+lea L19, L8
+L33: jmp X1
+rts
+add -194, L6
+L34: lea L13, D0
+sub @r5, @r1
+inc @r7
+jmp L18
+dec L3
+add @r1, L27
+jmp D0
+L35: sub 374, @r5
+bne @r3
+lea L44, L2
+mov @r1, @r0
+rts
+prn L16
+not D0
+red @r1
+sub L5, @r7
+bne L15
+not L32
+rts
+L36: bne L48
+m3
+dec @r1
+red @r2
+add -301, @r7
+red @r0
+mov -310, @r6
+m3
+not @r1
+lea L10, L0
+lea L17, @r2
+m2
+L37: rts
+inc L21
+prn -205
+m3
+inc L20
+L38: prn -96
+dec L1
+red @r5
+sub L15, @r1
+L39: inc L18
+mov 444, L23
+prn -437
+not @r3
+dec @r7
+L40: mov L27, @r2
+mov L48, @r5
+m1
+sub @r5, @r1
+rts
+sub 13, L53
+red L16
+L41: jsr @r7
+red @r4
+add L22, @r5
+mov 147, L22
+L42: clr @r6
+add L37, L27
+m2
+prn @r7
+mov @r0, L34
+prn L17
+not L30
+sub 168, @r6
+dec @r5
+L43: prn L32
+not @r2
+not @r0
+lea L42, L17
+red S9
+not L6
+L44: clr S1
+cmp L26, -23
+L45: inc @r6
+jmp L0
+L46: jsr L32
+lea L3, @r3
+add @r4, @r1
+add 158, L35
+inc L18
+dec @r4
+L47: sub L19, L10
+add -34, L12
+red @r3
+sub 80, L10
+red @r3
+add L41, L30
+inc @r3
+dec @r6
+jsr L34
+jsr L47
+m2
+m3
+red L1
+lea L12, @r5
+mov -96, L57
+mov @r4, L42
+m2
+add L41, @r5
+jmp @r3
+rts
+prn @r0
+cmp @r5, L5
+prn 38
+add @r6, L39
+L48: red L1
+mov @r7, @r5
+bne S7
+jmp @r0
+not L29
+cmp 240, -477
+L49: add -53, L40
+lea L11, L37
+m0
+L50: jmp L30
+L51: red L41
+red L1
+dec L11
+not L11
+jsr L43
+L52: rts
+mov 444, @r3
+jsr L59
+L53: prn @r0
+rts
+bne L19
+L54: dec L18
+not L13
+sub L43, L5
+dec @r7
+sub D0, D0
+m2
+bne @r0
+L55: not L13
+lea L1, L1
+jmp @r0
+m2
+m3
+L56: red L48
+jmp S8
+bne @r5
+add L19, L21
+jsr L12
+red L49
+clr L11
+not L39
+jsr @r7
+bne @r6
+m1
+prn 440
+bne @r4
+add @r4, L57
+mov @r0, L57
+not D0
+not @r4
+m4
+inc X2
+L57: inc L59
+m0
+jmp @r5
+prn -164
+jsr X3
+jmp X4
+clr S3
+L58: prn L59
+L59: not S0
+stop
+D0: .data -84,357,-2,75,86,369,-331,361,-424,423
+D1: .data 172,-9,-411,-367,457,-493,-148,-377,171,175
+D2: .data 1,-105,-363,70,-168,350,291,-436,-340,304
+D3: .data 260,156,193,224,-179,-287,-142,401,-459,208
+D4: .data 417,166,-393,318,408,-109,172,76,-311,-154
+D5: .data 51,370,-24,198,-463,103,-453,-499,223,-244
+D6: .data 329,452,-13,-402,388,-320,205,-297,-115,335
+D7: .data 136,422,201,464,-37,134,-220,483,484,266
+D8: .data -317,432,-435,307,-234,-455,-475,-353,145,-27
+D9: .data -188,143,295,470,398,-370,287,-407,4,203
+S0: .string "rqeotz"
+S1: .string "loyumazskggxesl"
+S2: .string "tzokuasjph"
+S3: .string "alxoizuy"
+S4: .string "yrrwoemkynkgaehfj"
+S5: .string "tdc"
+S6: .string "xzcgjkoeyqpqsupy"
+S7: .string "fyafoyzeklfyvqzhvis"
+S8: .string "nxoigjjjxcskdbqti"
+S9: .string "jylylwvphoyfktj"
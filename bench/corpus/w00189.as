@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r0, @r6
+    prn 0
+endmcro
+mcro m1
+    sub @r1, @r6
+    prn 9
+endmcro
+mcro m2
+    sub @r7, @r4
+    prn 30
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 72
+endmcro
+mcro m4
+    sub @r7, @r5
+    prn 93
+endmcro
+mov L5, L0
+sub 367, L0
+bne @r1
+m2
+dec @r3
+prn -57
+m4
+jmp L0
+inc D0
+inc @r6
+cmp L0, @r3
+clr @r4
+mov @r7, L0
+rts
+L0: cmp -276, L0
+jmp @r7
+dec @r7
+L1: jsr @r1
+lea L0, L0
+m3
+L2: lea L1, D0
+clr L2
+L3: clr @r2
+mov L1, @r3
+red L1
+rts
+red @r3
+inc L2
+red L0
+L4: mov -217, @r5
+bne L1
+jsr @r7
+jmp L3
+m2
+L5: cmp D0, @r4
+mov -375, @r0
+inc L2
+sub S5, L4
+add -267, @r2
+red L4
+m4
+jmp L5
+rts
+mov @r5, @r4
+mov 92, @r2
+clr L0
+prn @r4
+rts
+add -432, L0
+lea L2, L5
+lea S1, @r0
+red @r7
+mov L1, L5
+L6: cmp @r2, 375
+add L2, @r5
+add @r3, L3
+jsr @r2
+add L4, @r2
+L7: add -150, @r2
+sub @r1, @r2
+m2
+cmp X0, L3
+L8: sub 233, @r6
+inc L2
+prn -489
+bne @r7
+m1
+add -137, @r0
+dec @r5
+L9: clr L1
+inc L9
+m0
+rts
+sub L9, @r5
+rts
+inc L5
+lea L2, @r3
+L10: red @r1
+bne L9
+rts
+cmp X1, L5
+red @r5
+bne L6
+inc @r7
+L11: lea L0, @r7
+m3
+m0
+red @r6
+inc L8
+add L9, L11
+bne L10
+inc @r1
+jsr L11
+L12: inc L7
+jmp @r6
+lea L4, L2
+dec @r6
+L13: not @r1
+lea L4, L8
+prn L28
+lea L8, @r4
+L14: clr L2
+prn L14
+not @r0
+mov @r7, L5
+bne L32
+cmp 215, @r4
+m1
+not X2
+m4
+L15: rts
+m1
+bne X3
+red @r4
+sub 11, L12
+add L4, @r7
+jmp @r1
+L16: add @r7, @r6
+L17: add @r7, L14
+L18: not @r5
+not L7
+L19: red @r3
+lea L18, L9
+red @r0
+inc L12
+clr L10
+clr @r0
+cmp L5, @r1
+mov 503, L16
+add @r1, @r6
+not @r3
+m3
+lea L4, L14
+cmp @r1, 134
+rts
+cmp -100, -337
+L20: jsr @r7
+L21: cmp @r5, L9
+jmp @r7
+mov 99, L7
+cmp -497, @r4
+cmp L14, L3
+L22: dec L18
+lea L20, L6
+cmp @r7, L18
+L23: lea L4, @r6
+clr @r5
+m3
+dec @r5
+add L5, @r1
+bne L5
+m3
+mov @r5, L9
+dec @r5
+sub @r7, L2
+mov L6, L3
+prn L4
+red L11
+L24: jsr @r0
+bne @r0
+rts
+not @r7
+dec L8
+bne L1
+jmp @r4
+bne @r1
+red D0
+prn -250
+L25: mov S8, S2
+clr L24
+cmp L6, @r1
+m0
+L26: mov L2, L21
+jsr L0
+jsr L26
+m3
+bne L15
+dec L9
+dec L19
+red @r5
+add -63, @r1
+rts
+red L8
+L27: jmp L16
+not L9
+lea L1, L5
+jmp L3
+L28: dec L24
+sub L16, L8
+L29: inc @r5
+prn -425
+jmp @r6
+add L3, L15
+lea L16, @r4
+jmp @r0
+mov L20, L18
+not L28
+inc L2
+jsr L29
+m3
+bne L20
+L30: add L20, @r7
+jsr L16
+sub 73, L15
+rts
+mov -340, @r7
+bne L28
+jsr @r1
+jsr L11
+jsr @r0
+not @r6
+L31: rts
+m0
+rts
+inc @r6
+clr @r4
+lea D0, L24
+dec L52
+add L23, @r6
+inc L15
+lea L0, L13
+rts
+cmp 473, L22
+dec L20
+prn L11
+not @r6
+clr @r7
+sub L29, L4
+not L26
+bne @r2
+inc L22
+jsr L3
+prn L23
+clr L31
+mov L14, @r2
+m0
+sub 350, @r5
+L32: inc L29
+bne L24
+clr @r1
+inc L3
+not L8
+m3
+rts
+sub @r5, L31
+dec L11
+rts
+sub L15, @r7
+rts
+bne L22
+inc L28
+L33: rts
+m3
+L34: prn L9
+jsr L16
+red L7
+jsr L22
+dec @r3
+cmp D0, 274
+cmp @r7, -443
+mov @r2, D0
+mov L58, L4
+bne L9
+rts
+mov 82, L8
+red L18
+lea L24, @r3
+dec L30
+L35: sub L4, L7
+L36: jmp L5
+mov 106, @r3
+rts
+bne L21
+not @r4
+L37: jmp L6
+dec L8
+add 376, @r6
+dec @r0
+sub L0, @r0
+clr @r4
+L38: rts
+cmp 470, L34
+cmp -59, @r4
+rts
+jsr L7
+sub 30, @r3
+bne L5
+not @r0
+bne L1
+not @r2
+dec L36
+mov -228, @r2
+lea L19, @r7
+jmp @r1
+bne L23
+add @r3, @r6
+mov -301, L4
+red @r1
+red @r2
+dec @r1
+mov @r2, D0
+clr @r2
+cmp -257, @r0
+m2
+jsr L18
+rts
+not @r3
+clr @r4
+mov L2, @r6
+mov @r4, L8
+clr @r1
+m2
+m4
+clr @r6
+cmp L24, L8
+jsr @r3
+sub L8, L24
+m3
+mov 98, @r5
+mov @r6, L4
+rts
+sub -373, @r3
+L39: red @r5
+m4
+add -353, L24
+sub @r5, @r6
+lea L15, L36
+L40: sub S3, L13
+not @r1
+jsr X4
+lea L35, L26
+bne L24
+mov L26, L12
+sub @r3, @r0
+red L34
+jsr @r0
+mov @r3, L16
+L41: red @r6
+prn L5
+jmp L27
+red @r4
+jmp @r4
+m4
+add @r6, L24
+jmp L37
+not @r2
+red L48
+L42: dec @r2
+red L13
+L43: prn 16
+mov -359, @r4
+prn -433
+lea L17, L6
+L44: prn L37
+L45: inc @r2
+m1
+prn L10
+m1
+clr L5
+sub @r1, @r0
+not L42
+rts
+bne @r5
+lea L38, L51
+clr L1
+dec S0
+bne @r2
+L46: prn -492
+m4
+jsr @r5
+L47: inc S6
+jsr L7
+rts
+lea L12, L24
+L48: sub -291, @r4
+L49: rts
+not @r3
+L50: prn @r4
+bne @r1
+rts
+L51: jsr @r7
+m4
+cmp @r3, @r1
+sub @r6, L8
+mov L14, L19
+m2
+jsr L51
+cmp -376, 151
+clr L0
+m3
+L52: inc @r2
+rts
+m2
+L53: add -218, @r3
+bne @r3
+L54: rts
+m4
+jsr L13
+prn L58
+sub 259, @r3
+rts
+m1
+cmp L1, 29
+inc L56
+red @r6
+not @r7
+L55: red @r6
+L56: jmp S4
+sub 199, L59
+jsr S9
+red L30
+bne @r2
+mov @r2, @r5
+m0
+L57: dec @r5
+jmp L59
+prn L58
+cmp @r6, 193
+cmp @r5, @r7
+not L59
+jmp @r0
+clr D0
+jmp @r7
+add -156, S9
+jsr @r5
+prn L52
+sub L30, L58
+mov L37, S0
+inc @r1
+bne S1
+inc L23
+bne @r4
+jmp @r5
+L58: jmp @r7
+jsr L59
+lea L59, L59
+L59: jmp S4
+m0
+rts
+jsr S4
+stop
+D0: .data -199,-463,-438,336,338,42,178,-360,315,345
+D1: .data 155,-435,74,333,-105,396,427,451,-438,-141
+D2: .data 274,-259,75,76,-201,-442,144,254,298,-171
+D3: .data -421,-176,158,499,-257,-366,277,-448,368,251
+D4: .data -318,403,-353,-187,-294,342,76,-493,-195,-390
+D5: .data 441,421,12,377,366,-10,11,-200,-283,335
+D6: .data -43,483,382,-35,448,366,-500,-83,25,161
+D7: .data -209,-322,-46,-171,-390,-8,-92,-112,-348,211
+D8: .data -130,388,-8,-160,-90,376,478,397,235,322
+D9: .data 492,-418,52,-252,117,31,472,-499,-479,-335
+S0: .string "fajwgzphwqee"
+S1: .string "nvclmldyfqivibjl"
+S2: .string "ldizidtmsayfhgn"
+S3: .string "oueoclua"
+S4: .string "e"
+S5: .string "jev"
+S6: .string "bdlgw"
+S7: .string "lpjczsdmhcqkwermppz"
+S8: .string "g"
+S9: .string "wdzipohdukiafqq"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r1
+    prn 38
+endmcro
+mcro m1
+    sub @r5, @r7
+    prn 76
+endmcro
+mcro m2
+    sub @r1, @r2
+    prn 28
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 48
+endmcro
+mcro m4
+    sub @r1, @r3
+    prn 18
+endmcro
+not L0
+prn 440
+m3
+inc L0
+inc X0
+bne L0
+jmp D0
+not @r7
+rts
+L0: cmp @r3, S8
+clr L0
+rts
+not L0
+inc @r6
+clr L0
+L1: dec @r2
+jmp @r2
+cmp 409, @r3
+jsr L1
+m4
+cmp 416, 428
+add 32, @r7
+mov L1, @r3
+add @r6, L1
+lea L1, @r7
+jmp L1
+mov @r0, L0
+m1
+rts
+L2: rts
+prn L2
+inc X1
+L3: sub @r3, L1
+rts
+prn L2
+jmp @r5
+not @r4
+rts
+m0
+lea L2, L2
+inc @r2
+bne @r0
+L4: jmp L0
+lea L4, L1
+bne L1
+L5: add 392, L2
+clr @r6
+mov L2, S2
+add L3, L0
+sub L0, L4
+bne @r3
+add 391, @r2
+inc L0
+sub -290, L3
+m3
+not L2
+sub 296, L4
+L6: bne L2
+sub @r4, L1
+m0
+L7: sub L5, L4
+clr L6
+red L6
+add @r3, @r5
+sub @r3, @r3
+jsr D0
+mov @r2, @r4
+sub -346, L7
+m1
+red @r5
+prn L3
+rts
+jmp @r1
+jsr L1
+inc L4
+jmp @r1
+m2
+rts
+bne D0
+cmp @r4, @r3
+jsr L0
+dec L6
+L8: mov L1, @r0
+add @r1, @r3
+rts
+not L2
+add @r5, L6
+m4
+not @r6
+L9: add -312, L5
+jsr L0
+inc L7
+L10: bne L5
+jmp @r0
+lea L10, L4
+clr L1
+prn L0
+sub L2, @r0
+sub L9, L9
+cmp L10, -313
+L11: red @r6
+lea L6, L1
+not @r5
+m3
+L12: bne @r1
+mov -396, @r5
+rts
+L13: mov -295, @r4
+not L2
+dec L8
+jsr L9
+lea L1, @r5
+jsr L1
+cmp 463, D0
+dec @r0
+not @r4
+bne @r3
+inc L0
+lea L1, @r6
+L14: cmp @r4, @r1
+jmp L7
+bne L2
+bne @r2
+prn 255
+add L8, L9
+inc @r4
+rts
+jsr D0
+cmp 89, L13
+lea L59, L7
+jsr @r3
+bne @r6
+L15: not @r0
+L16: jmp L5
+jmp L10
+rts
+bne L4
+clr L10
+sub L6, @r7
+bne @r2
+prn L15
+L17: cmp 9, L10
+bne L7
+prn @r5
+L18: prn 328
+jmp @r4
+jsr @r2
+rts
+inc @r3
+L19: prn 130
+jmp @r2
+L20: cmp 192, L8
+L21: lea L19, @r0
+L22: add @r0, @r7
+lea L35, L4
+red L17
+rts
+sub L6, @r5
+cmp L0, @r6
+prn L10
+m0
+sub L1, @r0
+jsr L0
+sub 406, @r3
+m3
+m4
+not @r0
+lea L17, @r2
+m4
+red L13
+cmp @r4, @r0
+rts
+m3
+inc @r0
+jsr @r5
+inc @r2
+mov @r2, L7
+mov -457, @r4
+inc L14
+jsr @r2
+prn L11
+lea L11, L1
+clr L7
+not @r1
+L23: prn 488
+m4
+red L26
+m4
+lea L4, L10
+L24: jsr @r6
+m2
+bne @r1
+cmp 177, @r2
+dec L2
+mov L9, @r6
+prn 131
+jmp L3
+jsr L16
+bne L2
+sub -503, @r0
+m2
+jsr L13
+cmp @r6, L19
+jsr L8
+clr @r1
+cmp -449, -490
+red L14
+m1
+rts
+clr @r6
+jsr @r1
+jsr @r3
+rts
+red L21
+not @r7
+inc L24
+m2
+L25: bne @r0
+bne X2
+m2
+sub @r4, L12
+bne L36
+dec @r5
+L26: add -82, @r7
+L27: not L10
+jsr L18
+not L3
+L28: add S0, L16
+not @r1
+L29: lea L27, L5
+red L20
+lea L28, L2
+L30: sub L17, L14
+prn @r1
+L31: sub L1, L15
+m2
+not L5
+m4
+mov L20, L30
+clr L27
+L32: dec L19
+sub L16, L29
+not L51
+not L20
+red @r7
+cmp L32, 464
+L33: jmp @r5
+red L7
+lea L32, L28
+L34: lea L25, L6
+sub 489, @r4
+lea L3, L26
+cmp 226, 80
+inc @r6
+clr L0
+red X3
+bne S5
+jmp @r7
+lea L20, @r3
+inc L26
+rts
+L35: red S3
+lea L13, L9
+m4
+bne L12
+rts
+sub L30, L57
+rts
+prn L16
+add @r6, @r1
+m3
+rts
+bne L53
+bne L22
+cmp 17, @r3
+not L26
+lea L19, L18
+inc @r0
+m2
+sub L20, @r2
+L36: dec L2
+lea L6, @r0
+L37: dec @r6
+m1
+add -243, L8
+mov -439, L6
+prn -372
+dec L51
+dec @r4
+clr @r7
+inc L29
+L38: cmp L22, L1
+L39: prn @r3
+bne @r4
+jsr @r1
+cmp @r3, @r5
+lea L57, L27
+prn L32
+lea L0, L25
+cmp @r4, L29
+red @r0
+sub @r3, L50
+sub -417, L2
+prn @r7
+rts
+bne @r6
+sub L15, L27
+cmp @r1, @r4
+cmp @r4, D0
+sub L42, @r5
+bne L0
+L40: lea L31, @r6
+jsr @r2
+mov -61, @r7
+not L3
+red L3
+sub 181, @r0
+sub L46, @r7
+sub 457, L2
+cmp -255, 447
+m4
+lea L54, L55
+cmp L16, L15
+L41: sub @r4, L10
+cmp @r6, 508
+red @r4
+sub @r6, @r7
+prn @r6
+jmp @r2
+L42: mov L26, @r5
+prn 159
+m4
+inc @r7
+L43: rts
+prn -336
+dec @r1
+not @r1
+dec S9
+mov L24, L4
+not @r1
+sub L30, @r6
+jmp L3
+inc L13
+jmp @r3
+mov @r3, L26
+inc L33
+jsr @r2
+inc @r4
+m3
+dec L19
+add @r3, L0
+dec @r7
+prn 146
+L44: clr @r0
+m1
+bne L39
+jsr L16
+bne L34
+mov L42, @r1
+mov @r5, L6
+L45: mov @r2, @r0
+add @r0, L43
+jsr L21
+jmp @r5
+clr L3
+dec @r7
+L46: rts
+m4
+m3
+cmp 22, -162
+rts
+lea L53, @r4
+dec @r4
+L47: jmp @r7
+bne @r0
+L48: sub @r7, @r7
+m4
+inc @r3
+L49: dec L59
+add L59, @r4
+bne L10
+prn L53
+rts
+jmp L13
+clr L6
+not X4
+prn @r2
+L50: mov L6, L43
+L51: mov L12, S3
+sub @r6, @r2
+L52: add @r5, @r1
+mov @r0, L6
+lea L2, @r4
+L53: red L39
+not @r6
+L54: not @r3
+L55: jmp @r0
+sub L53, @r1
+not D0
+red D0
+L56: lea L6, L22
+dec @r6
+lea L36, @r6
+jmp @r5
+mov @r4, L48
+lea L10, L20
+jmp L6
+m4
+jsr @r3
+add L11, @r4
+m3
+bne L3
+sub -125, L40
+not @r1
+lea L47, @r6
+jsr @r7
+prn L29
+prn @r1
+rts
+rts
+prn @r3
+sub L55, S7
+inc @r7
+m2
+bne @r2
+rts
+m1
+rts
+jmp S9
+m0
+jsr @r5
+jmp @r1
+jsr L58
+not L11
+not D0
+L57: jmp L58
+L58: bne L3
+mov L59, D0
+L59: sub 377, @r7
+not L19
+stop
+D0: .data 479,-247,368,98,-260,494,138,-281,423,93
+D1: .data 255,-441,104,104,257,-66,-151,-248,-164,344
+D2: .data -48,34,-179,378,351,41,194,-330,-261,-196
+D3: .data 42,13,337,464,446,81,-36,-23,-209,112
+D4: .data 498,368,414,249,-336,87,403,-371,451,39
+D5: .data 23,-8,103,-168,-254,-323,348,433,-217,-189
+D6: .data -391,-120,-372,391,-464,-451,386,-456,-242,85
+D7: .data 424,-40,-10,258,357,-487,349,-427,237,361
+D8: .data 49,-50,-266,50,-130,-160,-335,-113,-339,178
+D9: .data 387,202,-231,126,-274,227,155,-337,396,-253
+S0: .string "qft"
+S1: .string "kfqtwwdo"
+S2: .string "vyajqfphsvzmunvx"
+S3: .string "cxaoirlvaa"
+S4: .string "xwxd"
+S5: .string "fuoluzu"
+S6: .string "ztpbkdezpazepfvogw"
+S7: .string "jzyjbpuix"
+S8: .string "dzow"
+S9: .string "fiem"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r3
+    prn 8
+endmcro
+mcro m1
+    sub @r2, @r1
+    prn 74
+endmcro
+mcro m2
+    sub @r3, @r0
+    prn 93
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 25
+endmcro
+mcro m4
+    sub @r3, @r1
+    prn 42
+endmcro
+m0
+m4
+L0: prn -478
+dec @r6
+red @r0
+L1: prn L0
+L2: not S6
+sub -45, @r7
+sub @r3, @r4
+prn L0
+add @r7, @r1
+red L17
+bne @r0
+not L0
+clr @r2
+L3: add L3, L3
+m0
+L4: not @r0
+inc @r5
+bne L3
+not L4
+mov @r7, @r4
+bne @r3
+clr L1
+inc @r2
+cmp L4, -133
+add L0, L0
+mov -27, @r5
+m3
+lea L4, L2
+jmp X0
+sub @r2, L0
+L5: clr L4
+rts
+m1
+add 141, @r4
+dec L3
+L6: rts
+L7: sub @r1, L7
+bne @r6
+jsr @r5
+lea L7, @r7
+red L23
+prn @r0
+clr L4
+cmp L3, L7
+jsr @r6
+cmp @r6, L2
+add @r4, @r1
+not @r6
+mov @r7, L1
+L8: inc @r5
+L9: bne @r1
+L10: add @r4, L2
+dec @r7
+clr @r3
+clr @r0
+L11: clr L2
+add -151, L2
+clr L1
+inc D0
+not @r7
+rts
+inc L9
+L12: prn 194
+jsr L11
+sub L3, L11
+L13: not L10
+not @r3
+L14: sub @r1, @r2
+clr @r6
+bne @r3
+dec @r3
+rts
+L15: dec L7
+L16: not L7
+not L10
+jmp L14
+inc @r5
+jsr @r6
+inc L5
+m0
+inc L10
+L17: mov 462, @r0
+clr @r1
+not @r2
+dec @r4
+dec L8
+red @r7
+inc L7
+add L15, D0
+cmp L1, @r5
+jsr L11
+clr @r5
+inc @r6
+mov L4, @r6
+mov @r5, @r7
+sub D0, @r5
+m2
+inc @r1
+sub 170, @r7
+add 122, L16
+not L15
+jsr L14
+add 278, @r1
+m1
+dec L11
+cmp -375, -323
+lea L1, L15
+L18: add -62, @r1
+dec @r1
+m1
+sub 194, @r6
+rts
+sub @r4, L14
+prn L17
+cmp 61, L0
+clr S2
+jsr L26
+jmp @r0
+clr @r6
+inc @r5
+jsr L9
+L19: clr @r3
+prn -364
+inc L15
+lea L17, L6
+L20: not L18
+clr @r0
+mov @r5, @r3
+mov 371, @r4
+m0
+red @r6
+not @r1
+bne L6
+L21: inc @r7
+mov @r4, L9
+L22: prn 445
+add L21, @r4
+rts
+mov 273, @r7
+jsr @r4
+lea L11, L14
+cmp 262, -181
+bne @r7
+jsr L12
+inc @r3
+rts
+dec L2
+bne @r3
+not L16
+L23: prn @r7
+lea L9, @r6
+clr L10
+add L22, @r0
+cmp -328, L20
+clr L20
+inc L22
+cmp -399, @r4
+L24: sub L23, @r3
+sub -389, L2
+jsr L0
+inc @r1
+m4
+m0
+add L8, @r0
+jsr @r5
+prn L0
+bne L20
+L25: sub L3, @r4
+mov -302, @r7
+m0
+red @r0
+mov L22, @r6
+jmp L19
+red @r2
+jmp @r3
+jmp @r2
+L26: not X1
+lea L11, L5
+jmp @r2
+add L12, L7
+rts
+L27: jsr L15
+jsr L8
+lea L3, @r3
+sub L20, @r4
+sub 92, L25
+inc L23
+jsr L3
+cmp @r4, X2
+add 300, L1
+m1
+prn L43
+L28: bne @r6
+lea L21, @r6
+rts
+add L14, @r2
+inc L7
+not @r6
+m0
+lea L9, @r7
+add @r0, @r6
+sub @r0, L28
+dec @r4
+red @r3
+bne L5
+L29: jmp L8
+jsr L13
+jmp S6
+L30: inc L30
+m3
+sub L24, @r3
+cmp L27, @r3
+red @r0
+add 410, L10
+bne L24
+m0
+bne @r2
+rts
+add @r3, L23
+L31: prn L35
+m2
+bne @r4
+jmp L13
+not @r0
+cmp L23, -138
+red L15
+jmp L25
+L32: lea L14, L31
+red @r2
+sub @r2, @r1
+L33: sub -498, L2
+clr L10
+m2
+L34: bne L14
+m4
+dec @r6
+L35: inc L13
+clr @r2
+red L20
+rts
+jsr @r4
+m1
+add @r6, L2
+jsr L3
+bne L37
+L36: cmp @r4, L9
+add D0, L35
+mov L37, @r7
+lea L33, L11
+not @r0
+jmp S4
+m2
+mov @r6, L5
+bne @r3
+cmp 447, L20
+rts
+L37: mov 202, L6
+L38: red @r3
+m4
+sub @r2, L35
+rts
+jsr D0
+dec @r5
+m0
+m1
+add @r3, L37
+add @r7, @r2
+clr L28
+lea L34, @r3
+inc @r4
+m4
+mov L1, L0
+cmp 101, @r3
+inc @r3
+inc L7
+dec L3
+bne L24
+lea L9, @r3
+lea L18, @r6
+m4
+L39: inc @r4
+m1
+sub @r7, L21
+L40: add 270, L37
+L41: jmp @r7
+mov @r3, @r4
+jmp L7
+jsr L24
+jmp @r6
+red @r4
+cmp 176, L23
+mov 407, D0
+jsr L27
+not @r1
+m4
+add L5, S6
+sub @r1, @r7
+red L55
+rts
+jsr @r6
+clr L26
+add @r0, @r0
+m1
+sub 166, L26
+L42: jsr @r4
+add @r2, L30
+L43: red L22
+clr @r6
+lea L14, @r1
+rts
+cmp @r7, L6
+not L25
+mov D0, @r5
+bne L38
+inc @r7
+L44: clr L41
+clr @r7
+add 444, L44
+L45: inc L3
+jmp @r7
+add @r3, L49
+jsr L20
+dec @r0
+lea L21, L0
+inc @r1
+m0
+jsr @r2
+jmp @r0
+cmp L49, @r5
+not @r5
+mov 93, L40
+dec @r5
+rts
+inc L18
+not D0
+L46: add 79, L38
+bne L32
+cmp L47, -63
+m2
+add @r6, L58
+L47: rts
+jmp @r0
+jsr L58
+not @r4
+jmp @r0
+not @r1
+not L22
+cmp 480, L4
+rts
+L48: add 448, L28
+rts
+prn @r2
+sub -257, L38
+not L13
+prn @r0
+add 130, L26
+jmp @r3
+cmp 303, 356
+sub @r5, @r0
+L49: add -13, @r1
+not @r0
+sub -186, @r2
+prn @r4
+L50: clr @r3
+prn @r6
+rts
+sub 349, L53
+jsr @r5
+m2
+jmp L12
+add @r4, D0
+m3
+inc S6
+jsr @r1
+add @r2, @r5
+L51: prn L2
+cmp @r6, 103
+not L15
+L52: rts
+dec L18
+bne @r6
+cmp @r3, @r0
+not @r6
+red L39
+clr @r6
+bne L22
+rts
+inc L9
+add L24, L26
+jmp L26
+rts
+sub 136, L49
+not @r2
+bne L54
+m3
+bne X3
+cmp 420, 509
+add -116, L51
+jmp L19
+inc L29
+sub @r5, L56
+L53: red L40
+rts
+jsr L19
+add 121, L16
+L54: dec L53
+m1
+L55: clr L39
+dec @r3
+m0
+bne L1
+not L26
+clr @r2
+red L13
+prn -144
+sub L0, L12
+inc @r0
+m0
+prn L58
+L56: cmp 222, 312
+rts
+m3
+cmp X4, 12
+L57: bne L31
+jsr L16
+mov L59, @r6
+add L12, D0
+add @r3, L59
+sub -366, L34
+add @r7, @r6
+mov @r1, L19
+m0
+prn 5
+L58: lea L59, @r5
+sub D0, @r0
+clr L59
+L59: jsr D0
+not S8
+stop
+D0: .data -369,-320,-202,-416,363,361,403,-155,-303,-125
+D1: .data 402,-403,74,183,-314,127,42,432,-107,2
+D2: .data -75,-314,8,-137,6,-361,32,-23,-418,374
+D3: .data -87,-234,101,218,-290,389,236,497,352,-152
+D4: .data 175,287,-277,-480,-451,418,-8,439,304,-149
+D5: .data 235,-394,-264,36,-358,-148,-287,-144,-254,259
+D6: .data 470,117,-415,-251,279,485,59,27,-229,-410
+D7: .data -450,365,-207,-237,-478,18,271,23,185,410
+D8: .data -40,-55,350,-47,379,-444,54,120,478,-131
+D9: .data 207,-456,425,-162,130,-20,170,219,20,-45
+S0: .string "ujfwyfxhzqjcm"
+S1: .string "yycb"
+S2: .string "blken"
+S3: .string "ygzmimawj"
+S4: .string "fxmadpxtqyhnye"
+S5: .string "ihnmpmfzfeujpdwm"
+S6: .string "pkdwauwkhtl"
+S7: .string "imcmrpwcxhhp"
+S8: .string "k"
+S9: .string "wfwxuebnwgjjjdsqj"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r6
+    prn 46
+endmcro
+mcro m1
+    sub @r6, @r2
+    prn 73
+endmcro
+mcro m2
+    sub @r5, @r6
+    prn 58
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 1
+endmcro
+mcro m4
+    sub @r5, @r0
+    prn 66
+endmcro
+L0: jmp L0
+L1: cmp L1, L42
+jmp L0
+cmp L1, L0
+mov 188, @r7
+L2: jmp @r4
+mov L2, @r7
+mov 309, L2
+mov @r5, @r6
+red @r0
+mov -324, @r3
+not L0
+clr @r2
+red @r5
+not @r2
+dec @r2
+not L1
+rts
+red @r4
+inc @r3
+red L2
+inc L2
+cmp @r1, L1
+not @r6
+inc L2
+sub -26, L2
+rts
+jmp @r1
+add 272, L2
+not @r4
+bne @r4
+red @r0
+rts
+L3: red @r5
+L4: clr L0
+jsr L2
+lea L2, @r3
+jmp L3
+m1
+jmp L0
+m0
+mov L4, L3
+prn L2
+mov 38, L1
+add L4, L0
+inc L0
+add L3, @r2
+L5: mov L5, L0
+lea L1, @r0
+L6: clr @r0
+jsr L0
+red @r7
+red @r0
+cmp @r5, 314
+dec L1
+m3
+clr L22
+m0
+dec L4
+dec @r2
+L7: inc L1
+red @r1
+dec @r6
+mov L3, @r3
+not L6
+red @r6
+m3
+dec @r3
+add -46, @r2
+dec L1
+red @r7
+not L3
+clr @r6
+inc @r6
+lea L5, L6
+L8: inc L8
+L9: dec @r3
+L10: rts
+m3
+mov L2, @r6
+dec @r3
+jsr @r3
+mov L26, @r0
+mov @r5, @r1
+mov @r5, @r3
+L11: mov 318, L9
+inc L2
+inc @r2
+cmp L1, L7
+clr @r4
+inc @r6
+jmp @r1
+lea L6, @r4
+bne @r7
+sub @r7, @r1
+not @r3
+jsr @r7
+mov L3, L7
+lea L6, @r0
+mov @r6, @r6
+not L11
+clr @r7
+cmp D0, @r3
+add -446, L1
+L12: bne @r7
+add L7, L11
+jsr @r4
+m1
+jsr @r4
+jmp @r7
+red @r3
+prn -279
+add 287, @r1
+mov L9, @r5
+bne L0
+jmp L1
+lea L2, @r5
+cmp @r7, 493
+mov @r3, L12
+sub L32, L2
+rts
+clr L8
+prn -254
+not L8
+rts
+lea L3, @r2
+cmp L12, 453
+m2
+m0
+mov L9, @r3
+jmp L3
+add 330, @r3
+m2
+L13: prn L6
+dec @r5
+L14: dec @r4
+mov @r2, L0
+add @r2, @r0
+L15: add @r2, @r2
+not @r0
+not @r7
+rts
+rts
+L16: cmp L8, L12
+not L5
+L17: red @r5
+prn @r2
+dec L8
+jmp L7
+L18: dec L2
+cmp L13, @r1
+inc @r6
+prn -313
+not L2
+jmp L15
+m3
+jsr L12
+cmp @r1, -416
+rts
+bne S7
+m1
+dec L11
+mov -382, @r0
+clr S4
+rts
+bne L23
+m2
+L19: jmp L27
+sub -83, @r3
+lea D0, @r1
+jsr L18
+dec L19
+sub @r3, @r7
+not @r4
+rts
+m0
+add L9, L12
+inc L8
+sub @r4, @r1
+not @r4
+L20: mov L2, @r2
+red @r1
+mov 387, L5
+L21: dec @r3
+m0
+red L20
+prn 395
+dec L4
+lea L11, L18
+red @r7
+clr L1
+cmp L17, @r0
+m1
+cmp L21, @r0
+inc @r5
+m1
+clr L20
+red L8
+L22: rts
+mov @r1, @r5
+prn L0
+bne L12
+L23: mov L1, L7
+add D0, @r3
+m1
+jsr L7
+sub L13, @r5
+sub L2, @r3
+jsr @r7
+add @r3, L20
+sub @r2, L0
+clr L23
+jmp L8
+L24: bne L19
+prn @r2
+clr @r3
+not L15
+not L4
+inc @r0
+sub @r1, L22
+not @r2
+add @r5, L9
+inc L21
+L25: cmp 104, @r2
+mov -368, L20
+prn 46
+L26: rts
+add L24, L23
+inc @r0
+jmp @r4
+rts
+m2
+L27: prn @r6
+bne @r7
+not @r2
+jsr L2
+m0
+m2
+mov @r0, L26
+clr @r5
+m0
+L28: mov @r2, @r7
+jsr L19
+prn -134
+L29: dec X0
+lea L1, @r6
+red L17
+lea L8, L25
+m1
+add L5, @r7
+rts
+bne L6
+L30: jsr @r1
+mov 293, @r0
+dec @r2
+jmp @r6
+m4
+inc @r3
+inc @r4
+cmp -118, @r7
+L31: rts
+rts
+bne @r4
+cmp @r7, L9
+red L5
+prn 454
+lea L29, X1
+L32: clr L28
+sub @r7, @r2
+not @r1
+lea L23, L22
+m2
+cmp 494, -144
+clr @r1
+cmp @r0, L4
+clr L1
+not @r2
+red L13
+jmp L10
+lea L12, @r4
+inc D0
+prn -497
+sub -506, @r5
+add 352, L7
+L33: red L24
+jmp L5
+bne @r4
+not L19
+m1
+bne L20
+jsr @r0
+L34: prn @r1
+L35: clr @r0
+sub L8, @r7
+L36: rts
+inc L22
+lea L21, @r5
+mov L20, @r6
+clr @r0
+cmp L36, @r7
+jsr L50
+jmp @r6
+sub 2, @r4
+m0
+L37: rts
+lea L16, L37
+not L15
+inc L32
+add -204, L32
+mov L5, L7
+red S5
+sub L12, L12
+cmp @r1, @r7
+mov -182, L35
+lea L31, L37
+clr L51
+dec L9
+clr L35
+dec @r1
+inc @r0
+inc @r7
+inc @r4
+lea L23, @r4
+not L18
+clr @r6
+dec @r5
+bne L30
+cmp @r6, @r0
+red L27
+inc @r7
+m1
+not @r0
+sub 160, @r5
+add @r3, L9
+L38: prn @r3
+bne L36
+m2
+L39: clr L28
+sub @r1, @r2
+jsr @r4
+m0
+m1
+red @r6
+inc X2
+L40: lea L8, L30
+bne @r7
+m4
+mov L20, @r2
+L41: add L24, @r2
+L42: jmp @r4
+m1
+L43: jmp L16
+clr @r3
+not @r5
+rts
+prn L17
+lea L27, L29
+dec @r5
+m0
+inc L27
+rts
+m2
+inc @r5
+L44: jmp @r1
+rts
+rts
+L45: lea L4, L15
+L46: clr L24
+sub L2, @r0
+add @r7, L29
+red L8
+jmp L53
+clr L41
+prn -207
+jsr @r2
+sub @r2, D0
+not @r5
+dec L0
+add @r2, @r2
+rts
+L47: rts
+lea L3, @r6
+rts
+L48: cmp @r3, -452
+m2
+rts
+prn -505
+clr S1
+prn 414
+inc L20
+L49: jsr L5
+m2
+L50: sub -300, @r1
+clr L54
+prn L59
+rts
+sub @r7, @r2
+jsr L17
+clr @r1
+m4
+jsr L15
+dec @r3
+L51: lea L36, L54
+rts
+L52: red @r0
+prn -42
+clr @r3
+L53: jmp L17
+lea L12, L56
+jsr L5
+cmp @r5, -84
+not @r3
+jsr @r3
+clr @r1
+mov L55, L56
+jsr @r4
+dec L28
+inc @r7
+jsr @r5
+mov L54, @r0
+lea L12, L54
+L54: jsr @r7
+mov -457, L58
+add X3, @r5
+clr @r2
+L55: not D0
+rts
+red L13
+m0
+L56: inc D0
+L57: prn L58
+jmp S5
+L58: red D0
+lea D0, S1
+add S6, D0
+m1
+dec L59
+L59: dec D0
+sub X4, S5
+sub D0, @r5
+stop
+D0: .data -107,144,-61,170,-215,-68,144,252,-314,-455
+D1: .data 337,198,239,-52,-74,69,171,128,-128,-265
+D2: .data -339,-230,111,-18,-95,279,-383,-316,-369,-474
+D3: .data -145,-326,-412,267,119,-404,140,-74,-301,91
+D4: .data -110,433,258,-498,-488,-216,-166,236,294,-271
+D5: .data 402,422,-182,345,-412,150,124,470,225,69
+D6: .data -244,-381,-279,-464,416,-383,-59,329,-65,325
+D7: .data -483,220,-40,207,-468,103,-416,-290,103,381
+D8: .data -9,131,-62,272,379,-365,-381,373,-424,-423
+D9: .data 371,215,438,-312,360,-32,119,221,-154,471
+S0: .string "ykovlxsyc"
+S1: .string "bnysdqfa"
+S2: .string "maiqpjztzvnr"
+S3: .string "hsgaokcbi"
+S4: .string "nozevlcwepii"
+S5: .string "gptqfcbw"
+S6: .string "lfekbxjvrmekw"
+S7: .string "wzjyoxbdfbztokdaby"
+S8: .string "lkkhulm"
+S9: .string "catla"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r7, @r0
+    prn 17
+endmcro
+mcro m1
+    sub @r2, @r3
+    prn 71
+endmcro
+mcro m2
+    sub @r7, @r4
+    prn 24
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 46
+endmcro
+mcro m4
+    sub @r7, @r6
+    prn 91
+endmcro
+mov 367, D0
+inc @r3
+clr L0
+L0: red @r1
+L1: red L0
+rts
+add L1, @r7
+L2: cmp -472, 170
+mov 167, L2
+L3: dec L2
+L4: dec L1
+jmp L0
+prn @r2
+jsr @r0
+L5: rts
+bne L5
+jmp L0
+dec L5
+sub @r6, L5
+L6: mov 15, @r5
+prn @r1
+add @r0, L0
+sub -469, @r6
+inc @r6
+L7: sub L1, @r5
+not @r6
+add @r6, L5
+prn @r6
+rts
+lea L5, L7
+dec @r4
+dec D0
+sub 353, @r3
+L8: mov @r4, @r3
+bne @r4
+red @r1
+lea L44, L3
+L9: inc @r2
+mov 119, @r1
+mov L2, L5
+L10: bne @r3
+lea L6, @r6
+jmp @r1
+add @r4, L8
+add -34, @r0
+L11: prn 8
+m3
+m0
+lea L2, L6
+not @r7
+lea L6, @r7
+dec L55
+bne L8
+prn -281
+m1
+inc L7
+L12: bne L11
+m3
+sub @r5, @r6
+not @r5
+jmp @r2
+L13: sub L5, L7
+rts
+prn -428
+jmp L7
+m0
+lea L7, S1
+mov L10, L11
+red L5
+bne @r4
+L14: lea L10, L6
+not @r6
+L15: mov L9, L10
+jmp L15
+lea L4, L4
+m2
+inc @r1
+L16: add @r2, S4
+dec L11
+jsr L8
+m0
+cmp 125, -334
+jsr @r1
+jmp L7
+jsr L10
+jmp L16
+L17: mov -172, L11
+mov 346, @r5
+dec @r2
+m3
+m0
+rts
+bne @r6
+sub -212, L10
+clr @r4
+red L11
+rts
+rts
+cmp 101, @r0
+L18: sub -483, L11
+sub L5, L16
+bne @r7
+add @r4, L16
+inc @r2
+inc L14
+clr L3
+rts
+L19: dec L18
+m2
+prn L8
+jsr @r2
+red L4
+m4
+mov @r5, L6
+add 406, @r4
+red @r0
+bne @r7
+add @r5, @r7
+sub -473, L58
+cmp 180, @r0
+m4
+m2
+cmp 266, L10
+L20: bne L35
+rts
+dec @r7
+cmp 229, @r6
+dec @r4
+cmp @r4, -111
+lea L12, @r4
+L21: rts
+red L17
+bne @r1
+not @r3
+L22: clr L21
+add L13, L17
+rts
+sub L12, L13
+red L5
+dec @r2
+jmp @r4
+lea L21, @r5
+m0
+not @r4
+prn 16
+not @r7
+bne @r3
+rts
+bne @r3
+lea L4, L12
+L23: rts
+lea L4, L4
+mov @r2, D0
+L24: prn @r5
+lea L18, @r7
+jsr L11
+add L7, L16
+mov 103, @r6
+dec L9
+not @r0
+jsr @r0
+lea L13, @r1
+L25: jmp L10
+jsr L4
+sub -99, L17
+sub @r7, @r4
+not L25
+sub -3, L13
+red L4
+cmp L24, 490
+clr L5
+lea L8, @r6
+L26: lea L11, @r5
+jmp @r1
+lea L7, L21
+dec L16
+mov 508, L15
+prn L44
+L27: mov 283, L55
+prn @r1
+sub 359, @r6
+not L47
+rts
+jmp @r7
+m0
+cmp -61, L20
+mov L14, L30
+m1
+inc L13
+not @r6
+not L24
+red @r2
+m1
+prn @r0
+add @r0, L25
+mov L44, @r5
+clr L20
+L28: mov @r1, L12
+jsr @r3
+add @r4, @r7
+inc @r7
+L29: lea L28, @r7
+prn 114
+jsr @r6
+inc @r2
+inc L28
+L30: jsr @r1
+prn 248
+m0
+red L21
+mov @r5, @r5
+m2
+add 82, L6
+prn L25
+sub @r5, L20
+jmp L9
+sub -208, L9
+mov L4, @r0
+jmp L13
+clr L30
+sub @r0, @r1
+prn L19
+m0
+m4
+jmp L23
+bne L26
+add @r1, L1
+jsr @r5
+add 396, @r1
+inc @r6
+jmp L42
+jmp D0
+add @r6, @r3
+bne X0
+L31: prn L22
+L32: dec @r5
+L33: red @r3
+dec D0
+dec L12
+sub L20, @r2
+rts
+add -333, L19
+rts
+rts
+not L24
+m3
+sub L54, L3
+dec @r4
+bne @r6
+jmp L8
+red @r0
+red L38
+m1
+m4
+inc @r3
+mov 322, L0
+mov L10, @r4
+L34: inc @r0
+sub L1, L20
+not L15
+m3
+m1
+mov 49, @r5
+add L16, @r2
+not L26
+bne @r3
+prn @r3
+L35: inc L20
+jmp @r0
+rts
+prn S9
+prn L24
+lea L0, L44
+prn 314
+inc @r0
+jsr L0
+red @r7
+lea L49, L25
+m3
+jsr @r5
+prn @r0
+not L10
+sub 237, L32
+rts
+m4
+dec @r3
+m2
+jmp L12
+jmp L55
+cmp @r3, L14
+jsr @r7
+jsr L12
+lea L19, @r3
+not L27
+sub @r1, L2
+lea L25, L19
+mov @r6, L30
+jsr @r3
+jmp L16
+add @r6, @r0
+inc L21
+jmp L33
+cmp @r7, L8
+sub 505, D0
+lea D0, S3
+m0
+cmp @r7, L13
+mov L11, L29
+rts
+cmp @r2, 52
+bne @r6
+jsr @r6
+not @r1
+red L16
+clr L33
+L36: inc L20
+L37: inc @r7
+rts
+L38: lea L0, L12
+sub 405, @r7
+L39: not L15
+L40: inc @r0
+jmp D0
+clr @r0
+not L3
+bne @r5
+lea L39, L20
+m2
+jmp L10
+not @r2
+cmp L2, 283
+inc L29
+red L26
+add @r4, @r4
+red @r0
+inc @r2
+L41: rts
+m2
+not @r2
+mov 10, L5
+add @r5, L34
+L42: cmp @r5, L37
+red @r7
+rts
+clr @r0
+lea L34, @r7
+mov L48, @r1
+L43: jsr @r6
+jmp @r2
+L44: mov L11, @r1
+mov @r4, L44
+prn L15
+inc L7
+prn L36
+clr @r1
+bne L0
+m3
+rts
+bne @r0
+not L24
+jsr @r7
+dec L1
+m4
+add D0, D0
+lea D0, L39
+L45: not @r4
+jsr @r5
+add @r3, L55
+lea X1, @r2
+mov 416, @r2
+rts
+prn L28
+dec @r6
+L46: jsr L27
+m0
+not L21
+cmp L20, 148
+L47: cmp L12, @r6
+sub L5, L35
+rts
+mov @r3, L27
+L48: mov -335, @r7
+jsr @r4
+jmp @r3
+red @r6
+L49: rts
+jsr @r1
+jsr L59
+jmp @r3
+dec X2
+rts
+L50: dec @r6
+m3
+mov @r3, L12
+lea L28, @r0
+clr @r1
+mov @r3, S1
+clr @r6
+L51: sub -290, @r5
+cmp -372, L12
+L52: bne @r3
+L53: red L5
+add L48, D0
+inc L23
+cmp @r3, L23
+not @r6
+red L4
+L54: rts
+prn 313
+jsr @r6
+m2
+cmp @r6, @r0
+not @r2
+red X3
+m1
+mov L43, @r6
+red @r7
+prn @r1
+red @r6
+prn @r4
+mov 436, @r3
+m3
+not L52
+lea L43, @r5
+L55: lea L12, L26
+add -171, @r4
+L56: sub 497, @r4
+jmp @r1
+add -54, @r3
+jsr D0
+L57: bne @r2
+prn 442
+sub @r4, L28
+m0
+L58: red L22
+L59: dec D0
+lea S0, @r6
+bne D0
+add X4, @r7
+clr D0
+stop
+D0: .data -85,-446,150,-370,109,-87,-235,79,-92,-166
+D1: .data 84,-418,-22,-3,-416,443,-54,95,-122,-17
+D2: .data 138,-226,204,398,-227,-206,-21,-369,315,-120
+D3: .data -412,-335,-435,-464,372,411,22,468,-316,-140
+D4: .data 2,-205,-191,-304,98,312,-82,107,260,73
+D5: .data -498,-135,-430,235,156,-19,226,234,-44,45
+D6: .data -320,-243,-249,418,303,420,415,331,-107,396
+D7: .data -90,-269,-413,407,-158,-333,-208,-394,-93,75
+D8: .data -182,-73,-407,149,-266,-428,-352,71,-104,-428
+D9: .data -262,394,-61,81,119,-179,60,81,-388,-282
+S0: .string "yqawaenpeplceo"
+S1: .string "escwopbusze"
+S2: .string "tkgvzxcrqtp"
+S3: .string "zyhruyzijrdwgkcsg"
+S4: .string "njwag"
+S5: .string "fknjchmaksxbbsn"
+S6: .string "atf"
+S7: .string "drgfhsdjuyxxgqvttmvm"
+S8: .string "rxexwuw"
+S9: .string "ozjwbjgabbd"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r5, @r3
+    prn 55
+endmcro
+mcro m1
+    sub @r7, @r4
+    prn 70
+endmcro
+mcro m2
+    sub @r1, @r2
+    prn 21
+endmcro
+mcro m3
+    sub @r7, @r0
+    prn 22
+endmcro
+mcro m4
+    sub @r1, @r4
+    prn 47
+endmcro
+not @r1
+jsr L0
+dec L0
+bne L0
+L0: cmp -438, @r7
+m3
+lea X0, L0
+add @r1, @r3
+jmp D0
+cmp L0, @r7
+not L0
+lea L0, L0
+rts
+cmp @r5, -506
+m3
+prn 470
+sub @r0, @r0
+dec @r4
+jsr L27
+jmp @r1
+clr @r0
+not L0
+L1: rts
+prn @r3
+dec L1
+L2: lea L2, D0
+lea L2, @r1
+L3: rts
+m3
+red @r6
+lea L2, L1
+jmp @r0
+prn @r3
+not @r4
+not @r7
+inc @r5
+rts
+jsr L3
+dec L0
+L4: prn @r5
+lea L3, L0
+mov @r0, @r6
+dec L2
+clr L0
+jmp @r5
+add L4, L0
+cmp L0, L4
+mov X1, @r0
+lea L0, @r6
+L5: mov L5, L5
+L6: sub 354, L2
+jsr L3
+sub @r5, L5
+L7: bne L6
+inc L7
+prn 369
+dec L0
+red @r0
+cmp -454, @r4
+rts
+not L6
+L8: sub @r5, L6
+prn -96
+bne @r5
+add L8, L3
+inc @r1
+cmp -381, -141
+dec @r0
+rts
+L9: jmp @r0
+clr L1
+jsr @r7
+add @r0, @r7
+prn L5
+rts
+mov -28, L3
+dec L5
+bne @r2
+dec L1
+bne L1
+red @r0
+L10: mov L8, L5
+L11: clr @r0
+add L1, @r5
+jmp L6
+m0
+clr L1
+add L7, L11
+rts
+m4
+L12: jmp @r3
+L13: prn @r4
+m0
+jmp L10
+clr @r6
+inc @r2
+L14: rts
+not @r4
+red L4
+jsr @r5
+m0
+L15: inc @r6
+jsr @r5
+cmp @r5, @r1
+mov L11, L5
+sub L10, @r6
+bne @r6
+clr L2
+L16: prn L16
+add 374, L3
+sub @r3, L11
+m4
+mov 151, @r4
+red @r4
+clr @r2
+add L3, L5
+red L3
+m1
+L17: jmp @r2
+clr D0
+bne L57
+jmp @r5
+mov S2, @r4
+L18: red X2
+not @r0
+bne @r6
+m2
+add L9, @r3
+L19: sub L5, L8
+cmp S6, @r1
+red @r3
+m4
+L20: jsr L7
+not L11
+dec @r0
+not L11
+m2
+dec L6
+lea L13, @r2
+bne L5
+inc L19
+L21: bne @r7
+prn -299
+bne @r0
+m2
+not @r2
+add @r3, @r3
+L22: prn L13
+jsr @r4
+m3
+m2
+clr @r7
+dec @r2
+prn L21
+rts
+m1
+clr @r5
+jmp @r1
+red D0
+jsr L12
+L23: sub L8, @r5
+red L11
+rts
+dec L2
+prn 125
+not L23
+jsr L10
+rts
+jsr @r5
+L24: not L8
+bne L16
+lea S7, @r3
+sub @r1, L8
+bne S1
+add @r3, L6
+mov @r5, L2
+mov L22, L7
+cmp @r3, 153
+jmp @r7
+L25: not L6
+red @r4
+L26: jsr L3
+m2
+jsr @r5
+dec L10
+cmp 130, L26
+jmp @r7
+add @r1, @r1
+rts
+m3
+prn @r1
+sub L6, L57
+jmp L4
+cmp -275, -100
+dec @r6
+sub L3, L10
+bne L4
+sub 261, @r5
+m3
+m3
+inc L0
+rts
+not @r2
+L27: not @r0
+sub -469, L18
+m0
+dec @r7
+jsr @r4
+inc L26
+cmp @r0, @r3
+clr @r7
+m0
+inc L27
+L28: jmp @r5
+mov @r7, @r3
+inc @r5
+mov L27, @r2
+jsr @r1
+mov @r2, @r4
+red @r7
+L29: sub 52, @r2
+sub L42, L25
+inc @r0
+not @r6
+bne L31
+L30: dec L22
+not @r4
+bne L33
+inc @r3
+cmp @r5, @r5
+red L14
+m0
+rts
+rts
+add @r3, @r2
+sub 245, @r5
+L31: cmp @r5, -48
+lea L29, L15
+L32: lea L1, L1
+not @r0
+bne @r6
+dec @r5
+lea L1, L22
+cmp 58, L2
+prn 25
+L33: jsr L57
+jsr L1
+inc @r7
+inc L25
+jmp @r3
+jsr @r2
+not L18
+not L6
+jmp L1
+L34: jmp D0
+mov 54, L9
+clr L29
+cmp -482, @r0
+add L12, L8
+lea L48, L2
+add @r2, L21
+mov 28, @r2
+add @r5, L20
+jmp L12
+not L16
+prn @r1
+bne L15
+prn L28
+dec @r5
+dec L2
+jsr L34
+sub -183, L2
+clr L25
+rts
+mov @r7, L19
+rts
+clr L57
+L35: prn L30
+dec @r6
+rts
+prn L28
+sub -309, @r4
+red X3
+jmp @r4
+lea L15, L30
+L36: not @r1
+inc L12
+L37: jmp L34
+m1
+add L35, L4
+L38: mov 404, @r6
+L39: sub L23, @r2
+add L34, @r2
+jsr @r1
+dec @r3
+bne L25
+jmp L53
+rts
+sub L4, @r3
+sub 85, @r4
+add -359, @r5
+red @r1
+inc @r5
+cmp @r3, 120
+red @r0
+L40: lea L1, L27
+red @r6
+clr L13
+jsr L5
+red L12
+dec L5
+m2
+mov 375, @r2
+bne @r4
+lea S0, L18
+m1
+dec L29
+dec L18
+clr L15
+m0
+inc L33
+L41: rts
+jmp L19
+jsr @r6
+L42: cmp L1, @r6
+bne L2
+dec L7
+bne L25
+cmp -1, -296
+clr L32
+L43: jsr L37
+add -419, L6
+m2
+red @r0
+add L34, L9
+rts
+jsr @r1
+inc @r5
+rts
+cmp L38, L55
+red @r5
+cmp @r6, -259
+mov L41, S2
+jmp @r2
+clr L38
+cmp @r6, 259
+mov @r5, L25
+L44: jsr L21
+lea L30, @r3
+L45: rts
+clr L43
+add @r5, @r1
+m2
+add 511, @r0
+dec @r1
+bne @r0
+L46: jmp @r3
+not L39
+m1
+clr @r7
+L47: clr @r2
+inc @r2
+L48: add @r4, @r0
+bne L49
+clr L40
+not L56
+m2
+cmp -205, -224
+cmp @r5, L9
+red @r2
+not L47
+L49: red L11
+m1
+m0
+lea S4, @r7
+m0
+prn L51
+prn L18
+clr L27
+rts
+m2
+cmp 80, @r3
+cmp L17, -283
+prn @r0
+L50: rts
+rts
+lea L51, @r1
+cmp 145, @r0
+L51: add L13, L59
+rts
+rts
+inc L12
+red @r5
+m1
+jmp L44
+bne L6
+m4
+L52: cmp 9, -253
+lea L19, @r7
+dec L10
+L53: dec L12
+cmp @r5, 489
+add @r6, @r0
+mov @r5, @r7
+add 111, @r5
+prn -467
+cmp -228, -247
+not D0
+mov L52, L59
+jsr @r1
+add 186, L25
+add -63, @r3
+m3
+dec @r6
+dec @r3
+not @r4
+prn @r3
+lea L30, L58
+L54: not @r4
+L55: jmp L34
+m0
+dec @r2
+not @r4
+L56: lea S2, L31
+clr @r6
+L57: prn L59
+m4
+bne @r0
+jsr L42
+bne @r2
+cmp @r0, @r6
+not L59
+clr L58
+mov -394, L37
+sub D0, @r6
+inc L58
+L58: cmp L1, L59
+clr D0
+not X4
+L59: not D0
+stop
+D0: .data -71,446,367,468,-136,-74,269,370,-95,306
+D1: .data -37,53,441,428,-7,379,-466,377,30,-319
+D2: .data -242,134,13,172,-382,-411,164,13,-290,186
+D3: .data 339,-373,-266,-97,147,-321,-449,-244,-385,-370
+D4: .data -309,-29,-144,304,-186,-451,-165,-240,294,295
+D5: .data 78,259,196,-68,254,454,491,-285,437,-235
+D6: .data -183,187,-198,444,19,172,-239,-58,-339,-152
+D7: .data -326,66,159,478,96,40,122,385,290,193
+D8: .data 136,371,352,253,49,-387,-98,410,165,368
+D9: .data -70,236,-415,-472,376,-290,461,-106,-135,259
+S0: .string "ukbmbwudathxcu"
+S1: .string "truszkjenfy"
+S2: .string "xjzgctzwle"
+S3: .string "uxeqeyrqwrgh"
+S4: .string "ahrflaieilwjvuxk"
+S5: .string "ifwvkhqnjcxgyx"
+S6: .string "ceuiykrkcmmua"
+S7: .string "zdsul"
+S8: .string "jvpjpzdloxgpdjjicqta"
+S9: .string "aayxlgvmqrsvgjmc"
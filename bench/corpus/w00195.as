@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r3, @r6
+    prn 25
+endmcro
+mcro m1
+    sub @r3, @r6
+    prn 68
+endmcro
+mcro m2
+    sub @r3, @r7
+    prn 86
+endmcro
+mcro m3
+    sub @r2, @r0
+    prn 98
+endmcro
+mcro m4
+    sub @r3, @r2
+    prn 72
+endmcro
+red L0
+not @r3
+m4
+inc @r1
+bne @r3
+not L0
+inc @r1
+L0: dec D0
+m2
+sub 66, @r2
+clr @r3
+add -136, @r3
+sub L0, @r0
+mov 324, @r6
+L1: mov @r3, L1
+m1
+L2: bne @r3
+red L2
+mov D0, @r6
+dec L2
+sub D0, @r6
+jsr L0
+jsr L3
+sub 362, L2
+not @r6
+red @r7
+not @r5
+dec @r6
+L3: sub -219, L1
+red L3
+mov @r6, L3
+inc L1
+inc @r4
+sub L1, @r2
+prn L1
+red @r4
+m4
+dec @r0
+add -151, @r0
+L4: red @r2
+prn L4
+rts
+prn L2
+L5: dec L4
+rts
+m2
+cmp L0, L0
+L6: lea L6, L2
+m3
+jsr L5
+jsr @r0
+add L5, @r1
+L7: cmp @r7, @r7
+sub L5, L1
+L8: mov @r6, L33
+inc L1
+dec L1
+add D0, L5
+dec L5
+cmp 27, X0
+rts
+lea L2, L6
+not L8
+m4
+jmp L31
+L9: lea L1, @r5
+not @r0
+dec @r0
+not @r5
+red @r7
+jmp L8
+bne @r1
+jsr @r7
+add L1, @r5
+clr L3
+jsr D0
+add D0, L2
+add L0, L1
+L10: sub @r4, L5
+inc @r7
+cmp @r4, @r2
+lea L36, @r7
+rts
+inc L1
+prn L3
+jmp L2
+rts
+bne @r2
+rts
+mov 417, @r1
+bne L4
+not @r5
+clr @r3
+dec @r5
+add 381, D0
+inc L8
+dec @r0
+sub @r5, D0
+jsr @r0
+jsr L4
+mov L7, L0
+prn @r2
+jmp L3
+bne L3
+dec @r7
+m3
+m2
+dec @r7
+prn L5
+bne L5
+not L5
+mov L5, @r0
+prn 455
+inc @r5
+add L0, @r6
+dec @r4
+sub 305, @r5
+rts
+clr X1
+clr L4
+lea L6, @r5
+m4
+lea L2, L4
+bne @r3
+sub L3, L7
+L11: jmp @r0
+lea L11, L3
+not L8
+clr @r7
+m0
+sub 73, @r6
+L12: dec L12
+inc @r2
+L13: jmp L2
+rts
+jsr L11
+mov @r7, L3
+cmp @r6, 13
+sub -456, L12
+prn @r1
+sub @r1, @r6
+jsr L12
+rts
+prn L1
+jmp @r1
+mov 21, @r1
+L14: bne L2
+L15: not @r7
+prn L5
+bne @r1
+red L9
+sub @r0, @r4
+rts
+m0
+rts
+m4
+add @r7, X2
+mov 317, @r3
+bne L15
+cmp L10, @r3
+L16: bne L9
+m0
+jmp L15
+inc L12
+jmp @r0
+m4
+inc L8
+cmp @r7, -436
+sub -48, @r6
+clr @r7
+jmp @r2
+cmp -230, 112
+red @r6
+jmp L18
+rts
+not L8
+rts
+add @r1, @r7
+jmp L8
+prn L47
+jsr @r5
+not D0
+L17: sub @r0, @r7
+jmp @r1
+not @r3
+jmp L17
+prn @r4
+L18: not L12
+mov L1, L1
+lea L40, @r0
+rts
+cmp @r6, @r4
+L19: cmp L10, @r5
+L20: add S4, @r1
+cmp -77, L18
+jsr @r7
+m2
+rts
+rts
+lea L1, L5
+lea L17, @r2
+bne @r7
+prn L13
+bne L8
+m0
+red @r1
+sub @r0, L2
+L21: cmp -478, L17
+cmp L21, -35
+bne L15
+prn -252
+L22: add @r3, L6
+not L17
+prn @r0
+red L8
+jsr @r1
+mov 252, @r0
+mov -230, L4
+jsr L2
+L23: add @r2, L18
+jmp @r6
+prn 266
+clr @r4
+dec @r4
+L24: rts
+add S0, L4
+m1
+L25: jsr L15
+bne @r6
+add X3, L7
+clr L17
+add @r7, @r7
+add L2, @r4
+not L13
+L26: rts
+L27: rts
+bne L21
+prn -122
+add @r6, @r3
+rts
+prn -266
+cmp L50, L7
+mov L19, L5
+clr L5
+L28: clr L24
+m2
+dec @r0
+lea L41, @r7
+L29: cmp L6, L33
+inc L5
+m3
+prn 297
+sub @r6, @r7
+L30: clr S7
+not L8
+prn @r5
+bne L58
+prn L28
+jsr @r0
+m3
+m2
+mov L19, L21
+clr @r7
+mov -45, L3
+cmp L32, @r7
+lea L6, @r3
+inc L24
+add -450, @r2
+L31: add @r1, @r5
+red L11
+jmp L12
+cmp 3, @r1
+jmp D0
+m4
+dec L27
+bne L21
+red @r3
+not L31
+sub -195, @r5
+lea L20, L8
+jsr L26
+jsr @r7
+mov @r6, L28
+inc @r0
+add 353, L14
+jmp @r7
+rts
+bne @r6
+jsr L8
+red L10
+L32: inc @r6
+L33: red @r3
+clr @r0
+prn -334
+inc @r2
+lea L3, L2
+L34: clr L28
+L35: sub L13, @r4
+clr L17
+clr @r1
+inc L32
+red L23
+inc L21
+not @r3
+dec @r0
+not @r3
+rts
+m0
+rts
+prn @r7
+jmp S9
+prn @r3
+dec @r1
+sub @r2, @r1
+L36: jsr @r6
+prn -376
+rts
+m4
+L37: jsr @r4
+lea D0, @r7
+mov -356, @r7
+L38: prn -143
+m1
+jmp L15
+L39: cmp L11, @r0
+m2
+red L28
+prn -15
+bne @r1
+L40: jmp L17
+m1
+red @r0
+m3
+lea L23, L13
+L41: dec L24
+bne L23
+inc @r1
+m0
+add 2, L31
+L42: not L15
+cmp L33, @r6
+not L15
+clr @r5
+jsr @r3
+not L46
+dec L38
+jsr @r5
+inc @r1
+lea L4, L37
+prn @r4
+L43: not @r6
+rts
+mov 333, @r4
+not L31
+prn @r1
+inc @r1
+sub X4, L2
+rts
+lea S4, L30
+L44: add L1, @r6
+dec @r2
+m3
+jsr @r7
+L45: bne L25
+not @r5
+lea L40, @r5
+dec @r7
+red @r1
+jsr L24
+m2
+sub L44, @r4
+jsr L25
+bne L22
+not L39
+L46: inc @r5
+dec L18
+L47: not L21
+clr L20
+m4
+mov L16, L25
+red L40
+L48: cmp L8, 155
+add @r1, @r4
+rts
+L49: not L38
+L50: rts
+jmp @r5
+cmp 464, L19
+bne L43
+cmp L44, 219
+clr L33
+jsr L50
+clr @r1
+bne L25
+cmp D0, @r0
+cmp @r6, @r2
+jmp L13
+lea L17, @r4
+m4
+red @r3
+inc L43
+cmp L29, 135
+clr @r2
+inc L44
+clr L54
+rts
+red L43
+m2
+m1
+mov S5, @r4
+dec @r6
+jmp @r6
+lea L59, L45
+cmp 388, @r2
+L51: inc @r4
+L52: cmp 331, @r5
+sub 457, @r7
+L53: lea L25, L50
+clr L19
+L54: cmp @r1, L7
+L55: lea L19, @r0
+bne @r5
+m0
+prn 8
+prn @r4
+not L40
+clr @r7
+prn @r1
+prn @r7
+L56: not @r7
+m4
+m2
+red D0
+L57: not L58
+bne L45
+not D0
+L58: bne L59
+m1
+inc L59
+L59: clr S8
+stop
+D0: .data 320,183,308,422,170,222,69,439,-263,34
+D1: .data 191,277,205,-193,-156,42,67,-33,325,113
+D2: .data -76,156,-392,378,154,340,153,-54,-6,-148
+D3: .data -353,174,-413,10,422,276,203,23,419,-182
+D4: .data -263,-395,-65,-419,-190,437,322,-480,-45,423
+D5: .data -251,421,19,52,-96,75,-368,-278,-462,272
+D6: .data -325,469,-140,52,-454,233,400,-80,403,-180
+D7: .data -211,-156,-66,2,-289,-360,-258,-284,-201,-271
+D8: .data 67,188,-41,82,-105,-463,28,-53,-206,-280
+D9: .data 266,-413,204,345,-408,-429,76,-291,-497,-371
+S0: .string "bnbsbucpdpt"
+S1: .string "xxwv"
+S2: .string "wdytgkllpfizsnif"
+S3: .string "syxmwgrhdvomulv"
+S4: .string "drg"
+S5: .string "wpshpdbsr"
+S6: .string "kvevhu"
+S7: .string "fkrqyqv"
+S8: .string "ecdsvyidepdahg"
+S9: .string "txwvhvilpn"
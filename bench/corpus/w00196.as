@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r1, @r0
+    prn 96
+endmcro
+mcro m1
+    sub @r7, @r7
+    prn 67
+endmcro
+mcro m2
+    sub @r5, @r5
+    prn 52
+endmcro
+mcro m3
+    sub @r5, @r0
+    prn 75
+endmcro
+mcro m4
+    sub @r5, @r1
+    prn 96
+endmcro
+cmp -502, @r0
+sub -398, @r1
+red @r6
+jsr @r2
+bne @r6
+red L0
+jmp @r1
+red L0
+lea L0, L0
+prn L0
+clr @r3
+lea L0, @r0
+clr L0
+lea L0, @r0
+m1
+clr L0
+jmp L0
+lea L0, L0
+inc @r6
+jsr @r4
+red L0
+inc L0
+red @r2
+mov L0, @r7
+lea L0, L0
+rts
+inc @r3
+lea L0, L0
+mov @r3, @r3
+red @r6
+m0
+bne @r3
+L0: sub @r3, L0
+not @r3
+inc @r4
+inc L0
+sub -219, @r5
+clr L0
+inc L0
+m1
+red L0
+jsr L0
+cmp 373, @r2
+m3
+red L0
+sub @r4, L0
+jmp @r2
+bne S9
+prn D0
+dec L0
+m3
+rts
+m3
+L1: red @r2
+inc L1
+bne @r7
+cmp @r7, S1
+jsr L0
+L2: jmp L1
+not @r1
+L3: not @r0
+L4: jmp L4
+prn L2
+dec L2
+dec @r1
+cmp L3, @r3
+L5: red L3
+clr @r2
+prn @r5
+inc @r5
+m3
+inc L4
+red L0
+rts
+mov @r7, L2
+add @r3, @r5
+sub @r4, @r4
+dec @r2
+prn 81
+clr L1
+red @r0
+lea L4, @r4
+L6: clr L4
+red L3
+bne L0
+prn -208
+dec L4
+not L3
+add @r4, D0
+jmp @r0
+cmp @r1, L3
+rts
+lea L5, L3
+L7: not @r4
+add L4, L3
+inc @r0
+L8: mov -105, L1
+prn L4
+mov @r1, @r2
+bne L8
+bne @r1
+cmp L31, S5
+bne L0
+L9: sub 157, @r7
+lea L5, L5
+mov @r3, L3
+jmp L0
+L10: dec L1
+jsr S9
+mov @r3, L6
+jmp L5
+m1
+mov @r7, L4
+clr L0
+mov -413, L2
+cmp -238, @r0
+m3
+add @r2, @r1
+bne L5
+m2
+add 287, L6
+jsr L6
+m4
+red @r0
+bne @r7
+bne @r6
+m0
+red L1
+red L8
+m0
+L11: dec @r7
+jsr @r3
+mov L10, @r0
+clr L5
+prn @r7
+add @r4, L4
+m0
+L12: cmp L4, L10
+mov @r6, L3
+cmp @r1, @r0
+sub -470, @r4
+clr @r0
+L13: mov -451, @r3
+bne L6
+add @r5, L12
+dec @r5
+dec @r3
+m3
+cmp @r3, L3
+prn @r2
+jsr L0
+jsr @r2
+jsr @r3
+jsr L10
+bne L10
+sub @r3, @r5
+not L3
+lea L4, @r1
+cmp L12, L10
+add 296, @r2
+rts
+sub L4, L12
+mov L0, @r7
+bne @r0
+mov -277, @r5
+jmp @r7
+dec L6
+not L4
+add L4, @r3
+rts
+inc @r2
+rts
+rts
+not L0
+not L12
+red L0
+lea L8, @r6
+bne L9
+add 299, L9
+clr L12
+not L0
+m3
+red L4
+jsr @r5
+lea X0, @r0
+jmp L8
+lea L3, L9
+cmp -358, L6
+L14: prn @r4
+jmp @r2
+clr @r5
+jmp @r5
+inc L10
+cmp @r5, @r3
+L15: sub L7, L12
+not L15
+jmp @r7
+dec L11
+rts
+L16: jmp L5
+cmp @r5, 217
+m4
+L17: jsr @r3
+m1
+cmp -308, L7
+red @r5
+m2
+prn -423
+lea L12, @r4
+jsr S8
+jsr @r6
+not L7
+prn @r3
+add 17, @r2
+add -28, L1
+m1
+m4
+jsr L0
+jsr @r2
+inc L11
+add -149, L13
+L18: cmp @r6, L9
+not L0
+mov 179, L12
+lea L15, L1
+L19: lea L55, L4
+rts
+jmp @r2
+add -181, @r1
+prn L12
+L20: jsr @r1
+jsr L5
+jsr L10
+dec @r6
+dec @r7
+rts
+jsr @r2
+cmp L6, L1
+lea L9, L3
+jsr @r3
+lea L46, @r4
+L21: add 474, @r7
+cmp @r6, @r0
+jmp L0
+prn @r3
+L22: rts
+jsr @r2
+red @r4
+sub 129, L35
+L23: cmp -149, @r4
+prn L4
+cmp @r0, @r3
+L24: jmp L0
+L25: not @r2
+cmp S5, 401
+jsr @r0
+inc @r2
+clr @r2
+clr L13
+inc @r0
+lea L12, @r0
+m0
+jmp L8
+inc L17
+L26: bne @r0
+m4
+rts
+L27: dec L13
+dec L5
+cmp L22, L3
+jsr @r0
+rts
+dec L16
+rts
+sub -422, L18
+m1
+jmp @r6
+sub -218, @r7
+inc @r3
+L28: cmp -139, 115
+jmp @r0
+lea L15, @r6
+not L15
+inc @r0
+L29: mov @r4, @r3
+prn L20
+mov 492, L26
+jmp @r4
+not L0
+bne @r5
+add 110, @r1
+red L58
+m0
+L30: sub L30, L25
+prn 138
+m0
+jsr S8
+m2
+add 163, L52
+bne L30
+mov L29, @r4
+jsr L0
+jsr @r7
+cmp -363, L11
+not L21
+prn @r0
+dec L24
+mov -235, @r7
+inc L0
+L31: prn L12
+prn 510
+sub L29, L5
+L32: jsr @r6
+dec L1
+L33: jmp @r4
+L34: mov L26, L31
+inc L50
+dec @r5
+clr L16
+L35: bne L25
+lea L12, D0
+inc L35
+L36: mov 447, @r0
+add 420, L4
+lea L28, L11
+rts
+rts
+rts
+bne L27
+bne @r7
+jsr L50
+inc @r1
+inc L14
+L37: red @r7
+rts
+dec @r0
+bne @r5
+m1
+m3
+clr L52
+bne L1
+jmp L10
+cmp @r2, -426
+jmp S3
+dec @r5
+clr X1
+jsr L22
+sub @r2, @r3
+sub -77, X2
+L38: clr @r5
+cmp @r4, 355
+bne @r4
+L39: lea L7, L18
+not L58
+add 87, L31
+L40: cmp L13, @r6
+prn L38
+cmp -59, L38
+L41: mov 74, L47
+L42: sub 416, L10
+L43: jsr @r6
+rts
+mov @r0, L2
+jsr @r5
+cmp L37, L19
+clr @r4
+dec L20
+dec @r5
+sub -236, @r4
+rts
+sub S9, @r0
+prn L19
+dec @r4
+m2
+jsr @r0
+m3
+mov L52, @r4
+rts
+bne L11
+add @r4, S1
+jmp L35
+prn 216
+L44: bne @r0
+red @r5
+L45: inc L29
+L46: not L35
+dec S2
+m2
+prn L52
+cmp @r7, @r7
+L47: red @r3
+inc @r6
+lea L0, @r3
+L48: add @r2, @r1
+dec @r2
+jsr @r5
+m2
+lea L25, @r0
+L49: add D0, L53
+prn @r7
+inc L5
+rts
+cmp 18, 372
+sub 73, @r2
+m2
+m1
+m4
+clr L31
+cmp @r7, @r4
+m4
+sub @r5, @r0
+m4
+L50: dec @r7
+L51: inc @r4
+m0
+L52: inc @r6
+lea L59, L35
+L53: add -478, @r0
+rts
+lea X3, @r4
+L54: add -484, D0
+L55: jsr @r4
+L56: bne L57
+add -446, @r2
+dec @r1
+inc @r5
+not S9
+L57: lea L59, @r5
+lea L48, S4
+L58: cmp S8, 491
+L59: not L37
+red @r2
+dec @r0
+dec D0
+m1
+lea L32, @r6
+clr X4
+inc D0
+not D0
+mov D0, @r1
+stop
+D0: .data 213,3,-85,-449,-28,138,345,74,-324,-28
+D1: .data -69,-173,370,23,253,259,-146,294,236,-58
+D2: .data -407,-302,-40,47,455,-441,-104,-453,-106,120
+D3: .data 86,37,20,362,-19,339,-354,-340,-110,65
+D4: .data -108,-41,341,4,130,-68,-403,-362,238,169
+D5: .data 238,183,69,-306,21,373,25,-147,472,280
+D6: .data 112,-37,235,-345,-335,-374,-171,-485,-286,213
+D7: .data -41,-251,-190,-374,-305,-35,-29,-116,368,215
+D8: .data 481,39,120,480,42,285,-95,-378,207,215
+D9: .data 302,279,-461,-495,33,471,39,215,-176,427
+S0: .string "nutljlwmwzivbrm"
+S1: .string "pahjdwimub"
+S2: .string "oznpvxqjscvmekkwdf"
+S3: .string "wwxawvqhxnwfvvpu"
+S4: .string "rywbllzeunpsgacl"
+S5: .string "urtrrwbecvb"
+S6: .string "pqvtxffmvt"
+S7: .string "slrbfsnvpzeucdcoiia"
+S8: .string "ganstiqlbxitzythbys"
+S9: .string "pd"
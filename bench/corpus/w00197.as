@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r6, @r3
+    prn 34
+endmcro
+mcro m1
+    sub @r4, @r0
+    prn 33
+endmcro
+mcro m2
+    sub @r7, @r3
+    prn 17
+endmcro
+mcro m3
+    sub @r0, @r0
+    prn 51
+endmcro
+mcro m4
+    sub @r7, @r7
+    prn 21
+endmcro
+inc L0
+lea L0, @r1
+L0: bne @r1
+prn @r7
+not @r3
+clr @r5
+prn L0
+not @r0
+lea L0, L0
+red L0
+prn -434
+bne L0
+L1: jmp L1
+inc L1
+red @r7
+cmp 302, L1
+clr L26
+inc L1
+m4
+L2: sub L0, L0
+L3: red X0
+m2
+jmp @r1
+m2
+L4: jmp @r6
+L5: inc L3
+sub @r2, L0
+jsr L0
+m4
+inc @r4
+clr @r2
+jmp @r0
+sub L0, @r7
+lea D0, L5
+L6: dec L0
+dec L4
+cmp @r4, L2
+add L1, @r2
+sub @r1, L5
+not L0
+L7: mov 3, L7
+clr @r7
+rts
+red L7
+lea L0, L6
+cmp @r5, @r0
+not @r6
+inc L3
+jsr L1
+not @r7
+dec @r6
+m1
+dec L7
+L8: dec L0
+prn @r7
+add 0, @r7
+cmp @r0, -5
+sub @r4, L4
+clr L7
+bne @r1
+red L5
+sub @r1, @r3
+clr L6
+jmp @r6
+sub L1, @r5
+rts
+jmp L16
+L9: dec @r4
+jsr L6
+inc L8
+inc @r7
+L10: mov L1, @r2
+jsr L7
+not L10
+cmp L7, 121
+jsr L2
+red @r1
+red L2
+jsr @r2
+inc @r1
+prn L6
+not @r4
+mov -298, L23
+not @r0
+L11: prn -379
+lea L0, L38
+clr @r7
+add L3, L3
+m4
+bne L1
+rts
+bne L0
+jmp @r4
+bne @r7
+prn 53
+inc L4
+sub @r2, S0
+rts
+sub L11, @r6
+jmp L5
+L12: mov L4, L9
+m3
+inc S1
+red @r6
+dec L34
+rts
+m3
+dec L3
+jsr L10
+mov -211, L3
+L13: jmp L5
+m2
+lea L0, @r2
+add L4, L13
+rts
+not L13
+mov L0, @r5
+inc L7
+add L2, L3
+jsr L50
+cmp @r1, L2
+L14: red @r7
+clr L5
+mov L3, X1
+L15: not L3
+sub L1, L15
+cmp L10, @r2
+bne L14
+L16: bne L3
+jsr L3
+L17: jmp L7
+bne L4
+sub L4, L11
+bne @r7
+jmp @r7
+lea L11, L17
+sub @r7, L0
+clr @r3
+L18: mov L9, L8
+m1
+L19: rts
+bne L0
+dec @r6
+dec @r2
+red L0
+not L8
+lea L17, L18
+dec L13
+jmp X2
+prn L3
+jsr L3
+mov @r5, L10
+inc L19
+m0
+m3
+sub @r1, L17
+clr L12
+jsr @r5
+red @r0
+prn @r6
+jsr @r0
+jsr @r7
+rts
+cmp L11, L8
+lea L1, L19
+L20: jmp L0
+sub D0, L7
+red @r1
+clr L12
+L21: mov L20, L6
+jsr @r4
+jmp L7
+L22: jmp @r6
+clr L19
+m0
+mov @r2, L16
+L23: cmp @r3, @r0
+m2
+red @r0
+m2
+clr L6
+lea L16, L16
+m2
+add L8, @r4
+add L17, L18
+jmp @r7
+mov L21, L7
+red @r5
+inc L6
+inc @r7
+dec @r2
+lea X3, L0
+L24: add L1, L20
+add @r3, @r3
+add @r0, @r7
+rts
+clr @r7
+cmp @r7, 205
+jmp @r2
+L25: not S7
+m2
+cmp @r7, @r6
+dec @r5
+red @r6
+rts
+sub L2, @r0
+rts
+jsr L5
+bne @r4
+L26: prn -157
+inc @r1
+add L10, L22
+mov 443, @r4
+L27: prn L25
+inc @r7
+lea L20, L1
+L28: not @r6
+m1
+m0
+lea L21, L19
+clr S0
+lea L19, L7
+jmp L16
+sub -428, @r5
+add @r6, @r2
+add -494, @r0
+cmp -227, L9
+m2
+cmp L6, @r0
+jsr L3
+jsr L15
+cmp L3, @r1
+L29: prn L19
+L30: mov @r7, L3
+prn 456
+rts
+L31: inc @r2
+jmp L21
+rts
+L32: lea L8, L7
+cmp L11, L21
+clr L58
+L33: dec @r3
+red @r3
+m3
+jsr L5
+add L29, @r6
+add 167, @r1
+mov @r5, @r2
+bne L21
+jmp @r7
+prn @r2
+m3
+red L29
+mov @r7, L6
+dec L1
+jmp L2
+lea L31, L9
+L34: not @r3
+add 322, @r1
+mov L14, @r4
+clr @r3
+red S0
+mov -177, L23
+add -18, @r7
+clr @r6
+L35: not @r4
+L36: prn L5
+not L21
+prn 465
+L37: not L16
+jmp @r5
+red D0
+bne @r3
+inc @r6
+jsr X4
+mov L12, @r6
+bne @r4
+not @r0
+inc @r3
+jmp L21
+cmp 189, L36
+sub L19, L11
+clr @r6
+cmp @r0, L11
+jsr @r5
+rts
+jmp @r4
+clr L54
+lea L28, @r6
+jmp @r6
+m3
+clr @r3
+prn @r3
+add L27, @r4
+add L27, @r2
+rts
+m0
+add 150, @r6
+clr L23
+jsr @r0
+m2
+m4
+L38: inc L20
+m3
+red @r5
+jmp L1
+sub L0, @r3
+lea L49, L14
+mov L37, @r0
+bne @r6
+lea L33, L20
+not L38
+clr @r6
+bne @r6
+jsr L6
+rts
+clr L31
+mov 301, @r5
+L39: jmp L47
+jsr @r5
+clr @r6
+jmp @r6
+jsr L20
+m4
+red @r7
+L40: mov @r0, @r1
+prn L18
+inc @r1
+red L29
+bne L37
+clr L8
+rts
+lea L29, @r0
+mov @r1, @r7
+jsr L22
+m0
+red L34
+jsr @r0
+L41: not @r7
+m4
+not @r3
+prn -276
+L42: prn L38
+L43: inc @r6
+sub L0, @r0
+red @r4
+rts
+inc L29
+cmp @r1, @r2
+jmp L5
+clr @r2
+clr @r2
+L44: dec @r7
+L45: lea L37, @r3
+clr L5
+L46: jmp @r5
+add 468, @r3
+add @r4, @r4
+bne D0
+clr L38
+dec L14
+rts
+add -39, L53
+prn L22
+jmp L6
+prn -176
+bne L20
+L47: add @r6, @r3
+m1
+sub L40, L12
+jsr @r7
+L48: jmp @r7
+m4
+prn @r0
+L49: add L53, @r1
+rts
+L50: rts
+dec L20
+prn L55
+not L35
+cmp -130, L49
+clr L37
+dec L39
+red @r2
+m4
+L51: bne L46
+L52: clr D0
+jsr @r2
+red L46
+m3
+cmp 452, @r0
+m1
+L53: lea D0, L43
+bne @r4
+sub @r3, @r2
+inc L56
+bne @r2
+rts
+m4
+inc @r7
+L54: mov @r6, @r2
+not @r4
+L55: red L49
+jmp L52
+lea L57, L14
+lea L55, @r4
+prn L36
+inc L57
+bne D0
+clr @r3
+bne @r5
+m3
+not @r2
+m1
+jmp @r6
+mov @r5, L10
+clr @r5
+L56: red S5
+L57: lea L0, L49
+jsr @r5
+jsr @r2
+mov @r4, @r4
+cmp @r0, S8
+L58: red L39
+not @r3
+L59: cmp @r3, S1
+m2
+m2
+bne S7
+rts
+bne @r4
+dec D0
+lea S8, D0
+bne D0
+prn -130
+rts
+cmp D0, D0
+sub S3, L9
+mov D0, L44
+stop
+D0: .data 179,51,-441,456,168,-141,-75,-225,357,-111
+D1: .data 83,-450,-113,352,-142,376,349,175,-146,78
+D2: .data -127,8,90,359,129,147,-410,279,48,-423
+D3: .data 15,449,356,-234,-19,-216,-11,-279,-361,-489
+D4: .data 128,18,381,472,-258,-120,272,-455,181,429
+D5: .data -484,186,74,358,-336,-460,132,459,-211,-390
+D6: .data -164,-436,-208,19,292,-170,269,71,93,-169
+D7: .data -459,446,197,-266,336,226,-284,-61,-225,-416
+D8: .data -240,-20,-292,-320,-144,-371,-159,196,98,13
+D9: .data -106,-299,409,128,245,268,-303,91,89,-288
+S0: .string "goycwwgzikkatecuubh"
+S1: .string "egqaemrjcbklih"
+S2: .string "izqrhjwxywnlxqhthw"
+S3: .string "ocqddotgjzwc"
+S4: .string "mtfqkm"
+S5: .string "vhgnc"
+S6: .string "ftryhmmauhazcngdk"
+S7: .string "rxglgzlt"
+S8: .string "avgol"
+S9: .string "wbjocyrhzdmtj"
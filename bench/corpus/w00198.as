@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r4, @r5
+    prn 4
+endmcro
+mcro m1
+    sub @r0, @r2
+    prn 32
+endmcro
+mcro m2
+    sub @r1, @r1
+    prn 82
+endmcro
+mcro m3
+    sub @r3, @r0
+    prn 27
+endmcro
+mcro m4
+    sub @r1, @r5
+    prn 45
+endmcro
+not @r4
+red L0
+sub L0, @r2
+L0: inc @r4
+inc @r0
+jsr @r1
+sub L0, @r5
+m0
+dec @r6
+L1: not @r2
+L2: prn -298
+add -22, L0
+rts
+sub L1, @r2
+not L12
+cmp L1, L1
+m4
+jmp @r1
+jmp L33
+jmp @r5
+jsr @r5
+lea L1, @r2
+inc L2
+inc L0
+L3: jmp @r1
+lea L0, @r5
+prn @r4
+mov L1, @r1
+jmp @r1
+m3
+rts
+clr L2
+prn @r6
+cmp @r6, L2
+mov @r0, L0
+clr L1
+sub L1, L3
+m0
+L4: rts
+mov -318, @r6
+inc L3
+L5: sub L0, L1
+add @r7, @r3
+not @r3
+not L1
+clr @r7
+m3
+cmp L2, L1
+rts
+mov 258, @r0
+jsr L4
+prn L2
+rts
+jsr S8
+mov @r0, D0
+dec @r6
+lea X0, @r1
+sub -197, @r2
+dec X1
+mov L0, L3
+red @r5
+dec L0
+clr D0
+jsr L5
+bne L0
+m2
+L6: jmp @r7
+prn -148
+dec L2
+L7: jmp L0
+dec @r2
+L8: dec @r6
+jsr L58
+L9: dec L5
+jmp @r0
+sub @r5, @r7
+red L8
+prn @r0
+lea L3, L8
+mov L7, @r1
+prn L8
+jmp @r7
+m2
+m2
+red @r1
+clr L3
+cmp L2, @r6
+jsr L6
+cmp L6, -167
+m1
+dec L4
+L10: add D0, @r5
+mov @r1, L6
+jmp L8
+L11: add L9, @r3
+L12: sub 72, L9
+rts
+L13: rts
+mov L12, L8
+rts
+lea L1, L50
+jsr L5
+add L9, L2
+dec @r7
+prn L7
+add @r3, L13
+dec S0
+jmp @r6
+L14: not L51
+mov L31, L0
+cmp @r2, @r5
+sub @r2, @r7
+jmp @r6
+L15: clr @r2
+dec @r5
+sub L2, S9
+clr L14
+dec @r2
+jmp L1
+bne @r0
+clr @r1
+inc L5
+jmp @r1
+bne @r2
+sub -341, @r2
+dec @r6
+dec @r4
+m3
+m3
+m1
+bne @r4
+clr L51
+jsr L7
+lea L13, @r4
+bne L4
+L16: red @r7
+mov @r7, L16
+not X2
+rts
+not L3
+L17: lea L4, @r4
+clr L4
+m0
+m1
+clr @r1
+prn -67
+sub @r3, @r3
+bne @r5
+L18: not L16
+m4
+m3
+m0
+bne L16
+prn @r1
+prn 154
+not L17
+m0
+red @r7
+not L15
+not L14
+jsr L1
+rts
+clr @r1
+rts
+not L10
+L19: lea L16, L8
+lea L31, @r2
+mov -197, L4
+L20: prn L18
+L21: jsr L8
+red L13
+mov L9, @r5
+m0
+sub L12, L4
+prn 106
+L22: jmp L10
+clr L17
+m3
+rts
+m1
+m0
+m2
+lea L10, L8
+L23: red @r1
+dec @r6
+L24: bne @r7
+mov -205, @r2
+jsr L6
+m3
+cmp @r2, 509
+mov 497, @r2
+lea L23, D0
+cmp -341, 32
+jmp L14
+mov @r7, @r3
+dec @r4
+jsr @r0
+L25: add 75, @r3
+lea L1, @r7
+L26: cmp -412, 349
+mov @r7, L4
+prn L5
+not @r5
+not @r2
+mov @r5, L12
+jsr L20
+sub -90, L19
+jsr @r4
+m2
+dec @r4
+mov @r7, @r0
+m2
+sub 100, @r5
+lea L23, @r7
+jsr @r0
+prn 263
+mov -306, L9
+jsr L6
+bne L9
+red @r5
+clr L26
+m2
+inc L18
+m1
+bne L22
+cmp @r4, L2
+not L8
+m0
+jmp L7
+red @r1
+lea L5, @r0
+red @r4
+jmp @r0
+sub @r7, L26
+clr L19
+sub @r4, @r7
+mov L21, @r2
+L27: clr @r6
+rts
+cmp -287, @r6
+jsr @r5
+red L17
+lea L27, L12
+sub -113, @r2
+red L0
+not @r4
+inc @r2
+not @r2
+prn -86
+add L20, @r7
+prn -167
+m4
+L28: red L25
+add @r2, @r2
+mov 55, D0
+L29: lea L24, L23
+rts
+not @r6
+m0
+clr @r6
+bne L52
+jmp L18
+dec L3
+clr @r5
+inc L13
+sub L11, L8
+bne L21
+not L27
+clr L9
+L30: clr L0
+m1
+mov @r7, X3
+L31: jsr @r5
+jmp @r7
+lea L2, @r3
+jmp @r7
+sub 428, @r6
+jsr @r2
+dec @r0
+prn @r4
+L32: jsr L10
+add L8, L22
+jmp L8
+bne L52
+sub 440, @r2
+jsr L37
+inc @r5
+add L1, @r0
+inc @r3
+add L16, @r6
+bne @r3
+not @r0
+dec L19
+m0
+clr @r5
+clr @r6
+clr L1
+cmp 450, @r1
+L33: clr L24
+clr L19
+lea L17, @r5
+mov -490, L27
+dec L59
+L34: add @r2, @r2
+cmp S8, L29
+sub L10, L25
+sub L33, L20
+dec @r2
+rts
+L35: lea L32, L31
+L36: clr L8
+clr L4
+lea L34, L22
+L37: bne L12
+red L5
+rts
+dec X4
+L38: sub @r0, L30
+clr @r0
+bne L33
+mov @r4, @r1
+jmp L24
+m2
+cmp 61, L14
+jsr @r4
+rts
+sub L5, L24
+rts
+m0
+L39: inc @r7
+L40: red S8
+inc L38
+sub @r1, L40
+sub L39, L37
+jsr L11
+cmp @r0, -33
+L41: lea L9, @r5
+cmp 69, -290
+prn @r1
+prn @r2
+m0
+jmp L6
+red @r3
+dec @r3
+m3
+m4
+inc L34
+clr L30
+L42: red @r6
+L43: not L28
+rts
+rts
+mov @r5, @r3
+L44: lea S3, L5
+bne @r1
+sub @r2, L43
+prn -153
+dec @r3
+not @r6
+cmp L39, L3
+L45: rts
+not L56
+rts
+clr L6
+clr @r2
+red @r4
+L46: cmp @r5, @r5
+cmp L34, 82
+sub 337, L48
+bne L48
+L47: jsr @r0
+not @r2
+dec L22
+inc L21
+L48: inc S0
+jsr @r2
+jmp L41
+dec L48
+lea L40, @r4
+m1
+rts
+L49: inc L19
+rts
+L50: lea L7, L34
+inc @r0
+lea L46, L3
+rts
+L51: add 459, L4
+inc L30
+prn L56
+red L46
+sub @r0, @r3
+sub L26, @r0
+mov L25, L0
+lea L21, @r2
+L52: cmp @r7, @r3
+clr @r1
+L53: sub -363, @r2
+L54: rts
+dec @r6
+add D0, @r4
+jmp @r6
+L55: prn L2
+L56: jsr L48
+add L58, @r1
+not @r0
+jmp L14
+rts
+jsr @r6
+red @r1
+dec L48
+cmp L57, L57
+prn @r5
+jsr L58
+L57: lea L10, L0
+jsr L28
+mov 10, @r5
+dec @r5
+lea L14, @r7
+bne L58
+bne L53
+bne S8
+dec @r6
+red @r4
+rts
+sub L0, @r1
+mov 403, L4
+sub -39, @r5
+rts
+bne L37
+red L47
+L58: cmp L46, L59
+rts
+not L5
+sub S3, @r2
+sub @r2, @r1
+m1
+red L59
+L59: jsr D0
+bne S4
+stop
+D0: .data 287,415,427,493,415,347,20,123,-32,55
+D1: .data -337,-468,55,341,-233,-455,-187,136,-175,-456
+D2: .data 107,-383,-341,231,-467,498,-18,-112,102,63
+D3: .data -332,-457,-226,-485,171,-148,-130,428,-50,-489
+D4: .data 152,99,-44,346,175,-243,435,-59,-364,300
+D5: .data 404,109,-435,-260,-423,-147,-329,185,-273,-359
+D6: .data 303,429,-84,355,-304,-124,285,282,-442,398
+D7: .data -248,212,229,-168,35,479,-107,-452,466,-46
+D8: .data -265,-91,413,-158,267,-237,487,52,-474,-279
+D9: .data -251,-245,71,-362,480,-160,446,256,24,298
+S0: .string "t"
+S1: .string "dedpvmp"
+S2: .string "bkhgpwe"
+S3: .string "fkcdwxh"
+S4: .string "retunqyzssezoayr"
+S5: .string "bxqwpm"
+S6: .string "zkrnyfbopmqezmprwdf"
+S7: .string "zuezribdompptofrrkc"
+S8: .string "abyl"
+S9: .string "peonqlmxjick"
@@ -0,0 +1,496 @@
+.extern X0
+.extern X1
+.extern X2
+.extern X3
+.extern X4
+.entry L0
+.entry L1
+.entry L2
+.entry L3
+.entry L4
+.entry L5
+.entry L6
+.entry L7
+.entry L8
+.entry L9
+mcro m0
+    sub @r2, @r0
+    prn 43
+endmcro
+mcro m1
+    sub @r4, @r3
+    prn 30
+endmcro
+mcro m2
+    sub @r3, @r7
+    prn 80
+endmcro
+mcro m3
+    sub @r6, @r0
+    prn 4
+endmcro
+mcro m4
+    sub @r3, @r3
+    prn 70
+endmcro
+red L0
+m1
+mov @r2, @r2
+jsr L2
+prn -202
+prn @r6
+m4
+prn 22
+rts
+red L1
+clr @r4
+sub @r1, L0
+dec L0
+prn L0
+jsr @r1
+sub @r1, L0
+not @r4
+clr L0
+bne L0
+m4
+rts
+rts
+add 193, @r6
+m1
+m0
+cmp L0, -92
+m3
+L0: rts
+clr L0
+inc L0
+sub @r4, L0
+clr L0
+rts
+L1: lea L0, L1
+rts
+sub @r5, @r0
+not @r0
+mov 316, @r2
+mov L1, L0
+add 501, L1
+not @r6
+add 114, L0
+not @r0
+clr L6
+L2: not L0
+jmp @r7
+clr @r0
+lea L0, D0
+cmp @r5, -127
+add L0, @r6
+clr @r1
+m1
+cmp @r4, -454
+jsr @r1
+not L2
+red @r7
+lea L2, L0
+mov L49, @r5
+L3: lea L2, L3
+m4
+L4: clr L3
+jmp @r7
+mov 234, D0
+L5: dec L17
+not L4
+add @r5, L49
+jsr L0
+not @r6
+prn L1
+L6: bne L2
+L7: prn L6
+dec @r3
+jsr L0
+m2
+jsr L6
+cmp 201, 71
+rts
+jmp @r4
+rts
+not @r3
+L8: rts
+L9: bne @r5
+sub -162, @r6
+sub @r1, L3
+L10: bne L2
+lea L3, @r7
+not L1
+inc L7
+m1
+L11: clr L4
+dec @r3
+red @r6
+prn 313
+lea L7, @r4
+sub 176, L1
+clr @r7
+jmp @r7
+L12: jmp @r2
+L13: jsr L3
+jsr L3
+L14: prn 212
+add @r7, @r7
+prn -395
+rts
+dec L10
+m0
+clr @r0
+jsr @r0
+not L9
+clr D0
+clr L9
+cmp @r4, 490
+add -483, L8
+bne L33
+lea L10, @r4
+clr @r5
+prn L4
+L15: clr L6
+dec @r7
+red L10
+L16: prn @r4
+m3
+L17: sub @r4, @r7
+m3
+jsr L20
+red @r4
+jmp @r4
+red L5
+cmp -147, @r5
+inc @r4
+dec @r0
+inc L2
+not @r2
+m4
+red @r0
+jmp L3
+m2
+cmp L15, L15
+m0
+L18: add L12, @r6
+sub L9, L2
+red @r7
+mov L5, L2
+m4
+inc @r5
+not @r3
+rts
+dec L3
+red L11
+prn -297
+L19: mov L10, L2
+bne @r1
+not @r3
+clr L7
+sub D0, @r2
+sub -40, L16
+clr @r3
+cmp L4, L15
+prn @r0
+cmp @r0, @r6
+prn 108
+not L12
+rts
+L20: rts
+inc L8
+not L20
+sub -410, L14
+inc L15
+cmp @r0, L7
+rts
+rts
+L21: bne L1
+m0
+jsr @r4
+lea L30, L11
+clr L58
+red L8
+L22: rts
+sub @r0, L4
+clr @r1
+cmp 351, -418
+red @r1
+sub L10, L4
+L23: red L22
+prn L6
+cmp @r4, 173
+not @r4
+sub -91, @r3
+bne L18
+inc @r2
+sub L20, @r7
+L24: add L0, @r0
+not @r2
+lea L29, L8
+mov @r2, @r3
+jsr @r4
+sub @r0, L7
+rts
+clr L5
+mov 311, @r4
+lea L22, @r3
+bne L6
+rts
+jmp L20
+jsr L19
+rts
+L25: lea L16, @r6
+jsr @r4
+add 494, @r7
+inc L1
+inc @r7
+bne @r5
+L26: red L0
+red @r7
+jmp @r1
+jmp @r2
+cmp L4, L19
+dec L26
+rts
+jsr L6
+jmp @r1
+jsr L9
+jmp L10
+clr @r0
+mov @r3, L22
+sub 508, L21
+lea L12, L14
+rts
+mov L14, L9
+L27: prn S9
+sub L53, @r4
+lea L9, L19
+rts
+rts
+bne L2
+L28: lea L20, L3
+dec @r6
+L29: mov -246, @r0
+jmp @r0
+L30: lea L3, @r7
+m4
+mov -336, @r3
+add @r3, L16
+clr @r6
+cmp -158, @r5
+sub -210, L3
+L31: cmp @r3, -8
+L32: cmp L30, L24
+jsr @r4
+m1
+L33: not @r3
+red L20
+lea L1, @r5
+prn @r6
+m4
+bne L43
+dec @r4
+jsr L33
+m4
+dec L31
+red @r4
+mov @r6, @r1
+clr L23
+prn L2
+jsr L32
+mov 77, @r7
+rts
+jmp L16
+not @r5
+jsr @r6
+m1
+bne @r5
+cmp @r7, @r0
+bne L57
+m0
+add @r3, @r1
+clr @r5
+inc L7
+L34: prn -309
+L35: cmp L32, 23
+mov L24, L8
+clr L4
+clr L13
+clr L25
+inc L14
+sub 414, L20
+lea L45, @r7
+m1
+red @r6
+bne @r2
+rts
+m3
+red L33
+bne L9
+prn L11
+L36: add @r3, @r1
+L37: bne @r4
+cmp L35, L9
+rts
+cmp L5, 354
+red @r1
+add 225, L20
+mov L25, @r2
+L38: jmp L8
+jsr L14
+clr L10
+m2
+cmp -97, L18
+inc @r2
+cmp -360, @r6
+jmp S1
+m0
+L39: red L28
+bne @r6
+clr @r1
+dec @r0
+jmp L16
+L40: jmp L21
+not @r3
+prn @r1
+m1
+lea L22, @r7
+m2
+jmp L46
+red X0
+L41: red @r7
+red @r0
+L42: rts
+add L29, L35
+dec L5
+cmp @r2, -435
+inc L8
+clr @r7
+prn -162
+cmp @r3, -466
+red L17
+add @r2, @r0
+jmp @r4
+L43: inc @r3
+m2
+L44: rts
+cmp @r0, -446
+jsr @r6
+mov @r3, L26
+m3
+L45: rts
+bne L6
+jmp @r2
+clr @r6
+L46: clr @r4
+L47: add 498, L53
+clr @r0
+rts
+rts
+jsr @r2
+dec @r4
+mov @r3, @r6
+m2
+add 87, @r5
+cmp -373, -58
+inc @r2
+L48: dec @r6
+add @r3, D0
+m1
+m4
+lea L52, @r7
+lea L36, L34
+rts
+rts
+L49: prn 222
+rts
+prn 270
+inc @r6
+L50: cmp L23, D0
+cmp -138, @r6
+m1
+cmp L52, @r4
+jmp L35
+add -227, @r1
+red @r6
+rts
+not @r6
+not @r5
+L51: lea L19, L14
+mov L50, @r0
+clr @r5
+bne @r3
+jmp @r3
+L52: dec @r3
+not L19
+red L54
+rts
+not L44
+clr @r7
+clr @r3
+jmp @r4
+L53: prn -117
+lea L59, @r6
+not L54
+sub -149, @r3
+inc @r5
+L54: rts
+not X1
+lea L24, L34
+m4
+lea L51, D0
+L55: sub L56, L5
+sub @r4, @r4
+jsr S0
+bne @r1
+clr L11
+jsr L9
+add @r1, L13
+not @r4
+jmp L57
+jsr @r3
+m1
+L56: clr L19
+jmp L4
+L57: clr @r6
+clr D0
+sub S0, L22
+prn @r1
+cmp 91, X2
+bne L6
+m2
+dec L18
+lea L58, X3
+red L58
+m0
+sub L49, L36
+dec @r2
+cmp X4, 287
+cmp @r3, L35
+L58: cmp -323, L48
+jmp @r7
+prn -92
+L59: jsr @r3
+lea S0, @r0
+add S9, @r6
+stop
+D0: .data -93,293,-11,-3,425,152,142,378,-416,-471
+D1: .data 368,406,-378,261,-122,442,265,-285,-283,-495
+D2: .data -191,239,350,-98,238,-153,-249,-67,-83,-480
+D3: .data 403,487,-487,-388,-442,294,-414,-32,-285,-406
+D4: .data 5,427,-252,-165,-241,-442,-80,330,208,-459
+D5: .data 221,162,277,224,-65,-174,-70,374,393,-486
+D6: .data 497,-175,169,32,318,217,-420,-220,389,-138
+D7: .data -326,61,-126,-464,-342,-6,-452,-467,-104,380
+D8: .data 34,-383,167,-190,-417,-326,380,-352,-206,-385
+D9: .data 469,237,-56,158,131,-477,45,-39,-185,128
+S0: .string "cu"
+S1: .string "gldvuctkobl"
+S2: .string "klcgvaip"
+S3: .string "swdfbplcy"
+S4: .string "pdomysf"
+S5: .string "uzuxr"
+S6: .string "teuccpjgkhoeq"
+S7: .string "aqxhs"
+S8: .string "tzgdynzldkttuurnntb"
+S9: .string "cvxxbci"
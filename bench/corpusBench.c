@@ -0,0 +1,186 @@
+#define _POSIX_C_SOURCE 200809L
+#include "../assembler/assembler.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+#include "benchUtil.h"
+#include <dirent.h>
+#include <sys/resource.h>
+
+#define NAME_CAPACITY 512
+#define METRIC_COUNT 3
+
+/* Assembles every .as file of a directory, usually one written by
+ * workloadGen, a number of rounds through one context, and compares
+ * files/s, lines/s and peak RSS with a stored baseline.
+ */
+
+static const char *const metricNames[METRIC_COUNT] = {"files_per_s", "lines_per_s", "peak_rss_kb"};
+
+static int compareNames(const void *first, const void *second)
+{
+    return strcmp(*(char *const *)first, *(char *const *)second);
+}
+
+/*Base names (without .as) of the sources in directory, sorted so every run visits them in the same order*/
+static char **listSources(const char *directory, int *count)
+{
+    DIR *dir = opendir(directory);
+    struct dirent *entry;
+    char **names = NULL;
+    char **temp;
+    size_t length;
+    int capacity = 0;
+
+    *count = 0;
+    if (!dir)
+        return NULL;
+    while ((entry = readdir(dir)) != NULL)
+    {
+        length = strlen(entry->d_name);
+        if (length < 4 || strcmp(entry->d_name + length - 3, ".as") != 0 ||
+            strlen(directory) + length + 2 > NAME_CAPACITY)
+            continue;
+        if (*count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 64;
+            temp = realloc(names, capacity * sizeof(char *));
+            if (!temp)
+                break;
+            names = temp;
+        }
+        names[*count] = malloc(strlen(directory) + length + 2);
+        if (!names[*count])
+            break;
+        sprintf(names[*count], "%s/%.*s", directory, (int)(length - 3), entry->d_name);
+        (*count)++;
+    }
+    closedir(dir);
+    if (names)
+        qsort(names, *count, sizeof(char *), compareNames);
+    return names;
+}
+
+static unsigned long countLines(const char *baseName)
+{
+    char name[NAME_CAPACITY];
+    unsigned long lines = 0;
+    FILE *file;
+    int c;
+
+    sprintf(name, "%s.as", baseName);
+    file = fopen(name, "r");
+    if (!file)
+        return 0;
+    while ((c = getc(file)) != EOF)
+        lines += c == '\n';
+    fclose(file);
+    return lines;
+}
+
+static long peakResidentKb(void)
+{
+    struct rusage usage;
+    return getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : 0;
+}
+
+/*Reads "name value" lines, metrics missing from the file stay 0*/
+static void readBaseline(const char *path, double *baseline)
+{
+    char name[64];
+    double value;
+    FILE *file = fopen(path, "r");
+    int i;
+
+    if (!file)
+        return;
+    while (fscanf(file, "%63s %lf", name, &value) == 2)
+    {
+        for (i = 0; i < METRIC_COUNT; i++)
+        {
+            if (strcmp(name, metricNames[i]) == 0)
+                baseline[i] = value;
+        }
+    }
+    fclose(file);
+}
+
+static int writeBaseline(const char *path, const double *metrics)
+{
+    FILE *file = fopen(path, "w");
+    int i;
+
+    if (!file)
+        return -1;
+    for (i = 0; i < METRIC_COUNT; i++)
+        fprintf(file, "%s %.0f\n", metricNames[i], metrics[i]);
+    fclose(file);
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    AssemblerOptions options = {0};
+    AssemblyContext *context;
+    double metrics[METRIC_COUNT];
+    double baseline[METRIC_COUNT] = {0};
+    unsigned long lines = 0;
+    struct timespec start;
+    double seconds;
+    char **names;
+    int rounds, count, round, i;
+
+    if (argc < 4)
+    {
+        fprintf(stderr, "usage: corpusBench directory rounds baseline [--save]\n");
+        return 1;
+    }
+    rounds = atoi(argv[2]);
+    names = listSources(argv[1], &count);
+    if (count == 0 || rounds <= 0)
+    {
+        fprintf(stderr, "no .as files in '%s' or no rounds to run\n", argv[1]);
+        return 1;
+    }
+    for (i = 0; i < count; i++)
+        lines += countLines(names[i]);
+
+    context = createAssemblyContext(&options);
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (round = 0; round < rounds; round++)
+    {
+        for (i = 0; i < count; i++)
+            handleFile(names[i], context);
+    }
+    seconds = elapsedSeconds(&start);
+    destroyAssemblyContext(context);
+
+    metrics[0] = count * (double)rounds / seconds;
+    metrics[1] = lines * (double)rounds / seconds;
+    metrics[2] = (double)peakResidentKb();
+
+    printf("corpus %s: %d files, %lu lines, %d rounds\n", argv[1], count, lines, rounds);
+    if (argc > 4 && strcmp(argv[4], "--save") == 0)
+    {
+        if (writeBaseline(argv[3], metrics) != 0)
+        {
+            fprintf(stderr, "cannot write '%s'\n", argv[3]);
+            return 1;
+        }
+        printf("  baseline saved to %s\n", argv[3]);
+    }
+    readBaseline(argv[3], baseline);
+    for (i = 0; i < METRIC_COUNT; i++)
+    {
+        printf("  %-12s %12.0f", metricNames[i], metrics[i]);
+        if (baseline[i] > 0)
+            printf("   baseline %12.0f  %+6.1f%%", baseline[i], 100.0 * (metrics[i] - baseline[i]) / baseline[i]);
+        putchar('\n');
+    }
+
+    for (i = 0; i < count; i++)
+        free(names[i]);
+    free(names);
+    return 0;
+}
@@ -0,0 +1,149 @@
+#define _POSIX_C_SOURCE 200809L
+#include "../assembler/assembler.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+#include "benchUtil.h"
+#include <unistd.h>
+
+#define FILE_COUNT 10000
+#define SPAWN_COUNT 200
+#define NAME_CAPACITY 64
+
+/*A small source using every table: entries, externs, forward references and data*/
+static const char source[] =
+    ".entry MAIN\n"
+    ".extern EXT\n"
+    "MAIN: mov @r3, LEN\n"
+    "LOOP: jmp END\n"
+    "prn -5\n"
+    "bne EXT\n"
+    "inc K\n"
+    "sub @r1, @r4\n"
+    "END: stop\n"
+    "STR: .string \"abcdef\"\n"
+    "LEN: .data 6,-9,15\n"
+    "K: .data 22\n";
+
+static const char *const outputs[] = {".as", ".ob", ".ent", ".ext"};
+
+static void fileName(char *name, const char *directory, int file, const char *extension)
+{
+    sprintf(name, "%s/f%05d%s", directory, file, extension);
+}
+
+static int writeSources(const char *directory, int fileCount)
+{
+    char name[NAME_CAPACITY];
+    FILE *file;
+    int i;
+
+    for (i = 0; i < fileCount; i++)
+    {
+        fileName(name, directory, i, ".as");
+        file = fopen(name, "w");
+        if (!file)
+            return -1;
+        fputs(source, file);
+        fclose(file);
+    }
+    return 0;
+}
+
+static void removeFiles(const char *directory, int fileCount)
+{
+    char name[NAME_CAPACITY];
+    size_t extension;
+    int i;
+
+    for (i = 0; i < fileCount; i++)
+    {
+        for (extension = 0; extension < sizeof(outputs) / sizeof(outputs[0]); extension++)
+        {
+            fileName(name, directory, i, outputs[extension]);
+            remove(name);
+        }
+    }
+    rmdir(directory);
+}
+
+/*Assembles every file in one process through one recycled context*/
+static double inProcess(const char *directory, int fileCount)
+{
+    AssemblerOptions options = {0};
+    AssemblyContext *context = createAssemblyContext(&options);
+    char name[NAME_CAPACITY];
+    struct timespec start;
+    double seconds;
+    int i;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < fileCount; i++)
+    {
+        fileName(name, directory, i, "");
+        handleFile(name, context);
+    }
+    seconds = elapsedSeconds(&start);
+    destroyAssemblyContext(context);
+    return seconds;
+}
+
+/*Starts one assembler process per file, the way builds had to before*/
+static double perProcess(const char *assembler, const char *directory, int fileCount)
+{
+    char command[2 * NAME_CAPACITY];
+    struct timespec start;
+    int i;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < fileCount; i++)
+    {
+        sprintf(command, "%s %s/f%05d", assembler, directory, i);
+        if (system(command) != 0)
+            return -1.0;
+    }
+    return elapsedSeconds(&start);
+}
+
+int main(int argc, char **argv)
+{
+    char directory[] = "/tmp/filesBenchXXXXXX";
+    const char *assembler = argc > 1 ? argv[1] : "./a.out";
+    double seconds;
+    FILE *ob;
+    char name[NAME_CAPACITY];
+
+    if (!mkdtemp(directory) || writeSources(directory, FILE_COUNT) != 0)
+    {
+        fprintf(stderr, "cannot write the sources\n");
+        return 1;
+    }
+
+    printf("files per second, %d small files\n", FILE_COUNT);
+    seconds = inProcess(directory, FILE_COUNT);
+    fileName(name, directory, FILE_COUNT - 1, ".ob");
+    ob = fopen(name, "r");
+    if (!ob)
+    {
+        fprintf(stderr, "the last file was not assembled\n");
+        removeFiles(directory, FILE_COUNT);
+        return 1;
+    }
+    fclose(ob);
+    printf("  one process, recycled context %10.0f files/s\n", FILE_COUNT / seconds);
+
+    if (access(assembler, X_OK) == 0)
+    {
+        seconds = perProcess(assembler, directory, SPAWN_COUNT);
+        if (seconds > 0)
+            printf("  one process per file          %10.0f files/s (%d files)\n", SPAWN_COUNT / seconds, SPAWN_COUNT);
+    }
+    else
+    {
+        printf("  one process per file          skipped, %s not built\n", assembler);
+    }
+
+    removeFiles(directory, FILE_COUNT);
+    return 0;
+}
@@ -0,0 +1,89 @@
+#include "../assembler/firstPass.h"
+#include "../assembler/secondPass.h"
+#include "../data_structure/arena.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+#include "benchUtil.h"
+
+#define LINE_CAPACITY 81
+#define ROUNDS_LINES 2000000UL
+
+/* Builds labelCount label definitions and as many branches to them. With
+ * forward set every branch comes before the label it jumps to, so each one
+ * goes through a fixup chain; otherwise every branch resolves on the spot.
+ */
+
+static char *makeSource(size_t labelCount, int forward)
+{
+    char *source = malloc(2 * labelCount * LINE_CAPACITY);
+    size_t i;
+
+    for (i = 0; i < labelCount; i++)
+    {
+        sprintf(source + (forward ? i : labelCount + i) * LINE_CAPACITY, "jmp L%lu\n", (unsigned long)i);
+        sprintf(source + (forward ? labelCount + i : i) * LINE_CAPACITY, "L%lu: inc @r1\n", (unsigned long)i);
+    }
+    return source;
+}
+
+/*Assembles the source in memory, the way handleFile does after preprocessing*/
+static int assembleSource(const char *source, size_t lineCount, FirstPass *pass, Arena arena)
+{
+    char line[LINE_CAPACITY];
+    CodeFile *codeFile = newCodeFile(arena);
+    size_t i;
+    int result;
+
+    firstPassBegin(pass, codeFile);
+    for (i = 0; i < lineCount; i++)
+    {
+        strcpy(line, source + i * LINE_CAPACITY);
+        firstPassLine(pass, line);
+    }
+    result = firstPassEnd(pass) && secondPass(codeFile);
+    arenaReset(arena);
+    return result;
+}
+
+static int benchBranches(size_t labelCount)
+{
+    size_t rounds = ROUNDS_LINES / (2 * labelCount) ? ROUNDS_LINES / (2 * labelCount) : 1;
+    char *sources[2];
+    double linesPerSecond[2];
+    Arena arena = createArena(0);
+    FirstPass *pass = createFirstPass();
+    clock_t start;
+    size_t r;
+    int layout, resolved = 1;
+
+    for (layout = 0; layout < 2; layout++)
+    {
+        sources[layout] = makeSource(labelCount, layout);
+        start = clock();
+        for (r = 0; r < rounds; r++)
+        {
+            resolved &= assembleSource(sources[layout], 2 * labelCount, pass, arena);
+        }
+        linesPerSecond[layout] = perSecond(rounds * 2 * labelCount, clock() - start);
+        free(sources[layout]);
+    }
+
+    printf("%7lu branches: backward %12.0f lines/s | forward %12.0f lines/s\n",
+           (unsigned long)labelCount, linesPerSecond[0], linesPerSecond[1]);
+    destroyFirstPass(pass);
+    arenaDealloc(&arena);
+    if (!resolved)
+    {
+        fprintf(stderr, "a branch was left unresolved\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    printf("branch resolution throughput\n");
+    return benchBranches(100UL) || benchBranches(1000UL) || benchBranches(10000UL);
+}
@@ -0,0 +1,75 @@
+#include "../lexicalAnalysis/lexicalAnalysis.h"
+#include "../data_structure/tree.h"
+#include "stdio.h"
+#include "time.h"
+#include "benchUtil.h"
+
+#define LOOKUP_ROUNDS 20000000UL
+
+/* Every keyword followed by words the lexer meets in the same position that
+ * are not keywords. As in the lexer, a leading '.' selects the directive table.
+ */
+static const char *const words[] = {
+    "mov", "cmp", "add", "sub", "lea", "not", "clr", "inc",
+    "dec", "jmp", "bne", "red", "prn", "jsr", "rts", "stop",
+    ".data", ".string", ".extern", ".entry",
+    "MAIN", "mo", "movv", "LOOP", "stp", "x", ".dat", ".strings"};
+
+#define WORD_COUNT (sizeof(words) / sizeof(words[0]))
+#define KEYWORD_COUNT 20
+
+static int hashLookup(const char *word)
+{
+    return *word == '.' ? lookupDirective(word + 1) >= 0 : lookupInstruction(word) >= 0;
+}
+
+static int trieLookup(WordTree instructions, WordTree directives, const char *word)
+{
+    return *word == '.' ? checkIfExists(directives, word + 1) != NULL : checkIfExists(instructions, word) != NULL;
+}
+
+int main(void)
+{
+    WordTree instructions = wordT();
+    WordTree directives = wordT();
+    unsigned long i, hits = 0;
+    size_t w;
+    clock_t start, hashTime, trieTime;
+
+    /*The perfect hash must agree with the keyword set before it is timed*/
+    for (w = 0; w < WORD_COUNT; w++)
+    {
+        if (hashLookup(words[w]) != (w < KEYWORD_COUNT))
+        {
+            fprintf(stderr, "keyword lookup mismatch for '%s'\n", words[w]);
+            return 1;
+        }
+        if (w < KEYWORD_COUNT && *words[w] == '.')
+            insertWord(directives, words[w] + 1, (void *)words[w]);
+        else if (w < KEYWORD_COUNT)
+            insertWord(instructions, words[w], (void *)words[w]);
+    }
+
+    start = clock();
+    for (i = 0; i < LOOKUP_ROUNDS / WORD_COUNT; i++)
+    {
+        for (w = 0; w < WORD_COUNT; w++)
+            hits += hashLookup(words[w]);
+    }
+    hashTime = clock() - start;
+
+    start = clock();
+    for (i = 0; i < LOOKUP_ROUNDS / WORD_COUNT; i++)
+    {
+        for (w = 0; w < WORD_COUNT; w++)
+            hits += trieLookup(instructions, directives, words[w]);
+    }
+    trieTime = clock() - start;
+
+    printf("keyword lookup (%lu hits)\n", hits);
+    printf("  perfect hash %12.0f lookups/s\n", perSecond(LOOKUP_ROUNDS / WORD_COUNT * WORD_COUNT, hashTime));
+    printf("  trie         %12.0f lookups/s\n", perSecond(LOOKUP_ROUNDS / WORD_COUNT * WORD_COUNT, trieTime));
+    treeDealloc(&instructions);
+    treeDealloc(&directives);
+    return 0;
+}
@@ -0,0 +1,87 @@
+#include "../lexicalAnalysis/lexicalAnalysis.h"
+#include "../data_structure/arena.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define LINE_CAPACITY 81
+
+static const char *const sampleLines[] = {
+    "MAIN: mov @r3 ,LENGTH",
+    "LOOP: jmp L1",
+    "prn -5",
+    "sub @r1, @r4",
+    "bne L3",
+    "L1: inc K",
+    "STR: .string \"abcdef\"",
+    "LENGTH: .data 6,-9,15",
+    ".extern W",
+    "stop"};
+
+#define SAMPLE_COUNT (sizeof(sampleLines) / sizeof(sampleLines[0]))
+
+/*Resident set size in kB as reported by the kernel, 0 where /proc is unavailable*/
+static long residentKb(void)
+{
+    char line[128];
+    long kb = 0;
+    FILE *status = fopen("/proc/self/status", "r");
+    if (!status)
+        return 0;
+    while (fgets(line, sizeof(line), status))
+    {
+        if (strncmp(line, "VmRSS:", 6) == 0)
+        {
+            kb = strtol(line + 6, NULL, 10);
+            break;
+        }
+    }
+    fclose(status);
+    return kb;
+}
+
+/* Lexes lineCount lines, either into one reused token or into a fresh
+ * token per line, the way getTree used to hand them out.
+ */
+
+static long lexLines(unsigned long lineCount, int reuseToken, Arena arena)
+{
+    char lineContainer[LINE_CAPACITY];
+    TokenTree *token = createTokenTree();
+    unsigned long i;
+
+    for (i = 0; i < lineCount; i++)
+    {
+        strcpy(lineContainer, sampleLines[i % SAMPLE_COUNT]);
+        if (reuseToken)
+            fillTokenTree(token, lineContainer);
+        else
+            getTree(lineContainer, arena);
+    }
+    destoryTokenTree(token);
+    return residentKb();
+}
+
+int main(void)
+{
+    static const unsigned long sizes[] = {10000UL, 100000UL, 1000000UL};
+    long reused[3];
+    Arena arena = createArena(0);
+    long baseline = residentKb();
+    size_t i;
+
+    /*The reused token runs first, the arena keeps its blocks once they were touched*/
+    for (i = 0; i < 3; i++)
+        reused[i] = lexLines(sizes[i], 1, arena);
+
+    printf("lexer RSS (kB above %ld kB at start)\n", baseline);
+    printf("%9s %16s %16s\n", "lines", "reused token", "token per line");
+    for (i = 0; i < 3; i++)
+    {
+        long perLine = lexLines(sizes[i], 0, arena);
+        printf("%9lu %16ld %16ld\n", sizes[i], reused[i] - baseline, perLine - baseline);
+        arenaReset(arena);
+    }
+    arenaDealloc(&arena);
+    return 0;
+}
@@ -0,0 +1,76 @@
+#include "../libasm/libasm.h"
+#include "stdio.h"
+#include "string.h"
+#include "time.h"
+#include "benchUtil.h"
+
+#define ROUNDS 200000UL
+
+/* Snippets per second through one libasm handle, the way an editor or a
+ * test farm assembles many small sources without spawning the CLI.
+ */
+
+static const char snippet[] =
+    ".extern W\n"
+    ".entry LOOP\n"
+    "mcro m1\n"
+    "    inc @r1\n"
+    "    prn -5\n"
+    "endmcro\n"
+    "MAIN: mov @r3, LENGTH\n"
+    "LOOP: jmp W\n"
+    "m1\n"
+    "    bne END\n"
+    "    sub @r1, @r4\n"
+    "    jsr W\n"
+    "END: stop\n"
+    "STR: .string \"abcdef\"\n"
+    "LENGTH: .data 6,-9,15\n";
+
+static const char broken[] =
+    "MAIN: mov @r3, LENGTH\n"
+    "MAIN: stop\n"
+    "mov\n";
+
+int main(void)
+{
+    AsmAssembler *assembler = asmCreate();
+    AsmResult result;
+    unsigned long words = 0;
+    unsigned long i;
+    clock_t start;
+
+    if (!assembler)
+    {
+        fprintf(stderr, "cannot create an assembler\n");
+        return 1;
+    }
+    printf("libasm in-memory assembly\n");
+
+    start = clock();
+    for (i = 0; i < ROUNDS; i++)
+    {
+        if (asmAssemble(assembler, snippet, sizeof(snippet) - 1, &result) != 0)
+        {
+            fprintf(stderr, "the snippet did not assemble\n");
+            asmDestroy(assembler);
+            return 1;
+        }
+        words += result.codeCount + result.dataCount;
+    }
+    printf("  valid snippet:     %12.0f snippets/s, %lu words, %lu entries, %lu extern uses\n",
+           perSecond(ROUNDS, clock() - start), (unsigned long)(result.codeCount + result.dataCount),
+           (unsigned long)result.entryCount, (unsigned long)result.externCount);
+
+    start = clock();
+    for (i = 0; i < ROUNDS; i++)
+        asmAssemble(assembler, broken, sizeof(broken) - 1, &result);
+    printf("  erroneous snippet: %12.0f snippets/s, %lu diagnostics\n",
+           perSecond(ROUNDS, clock() - start), (unsigned long)result.diagnosticCount);
+    for (i = 0; i < result.diagnosticCount; i++)
+        printf("    line %lu %s: %s\n", result.diagnostics[i].line,
+               result.diagnostics[i].severity == ASM_ERROR ? "error" : "warning", result.diagnostics[i].message);
+
+    asmDestroy(assembler);
+    return words == 0;
+}
@@ -0,0 +1,71 @@
+#include "../data_structure/list.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+#include "benchUtil.h"
+
+#define ROUNDS_ITEMS 1000000UL
+
+/*Same shape as the word items the code and data images store*/
+static void *wordCtor(const void *copy)
+{
+    return memcpy(malloc(sizeof(unsigned int)), copy, sizeof(unsigned int));
+}
+
+static void wordDtor(void *item)
+{
+    free(item);
+}
+
+/* Fills a fresh list with itemCount words, repeating until about ROUNDS_ITEMS
+ * inserts were made, then walks it once per round.
+ * Prints inserts per second and iterated items per second.
+ */
+
+static void benchInsert(size_t itemCount)
+{
+    size_t rounds = ROUNDS_ITEMS / itemCount ? ROUNDS_ITEMS / itemCount : 1;
+    size_t r, i;
+    unsigned int word;
+    unsigned long sum = 0;
+    clock_t insertTime = 0, iterateTime = 0, start;
+    void *const *begin;
+    void *const *end;
+    List list;
+
+    for (r = 0; r < rounds; r++)
+    {
+        list = createDynamicList(wordCtor, wordDtor);
+        start = clock();
+        for (i = 0; i < itemCount; i++)
+        {
+            word = (unsigned int)i;
+            listInsertItem(list, &word);
+        }
+        insertTime += clock() - start;
+
+        start = clock();
+        for (begin = listGetBegin(list), end = listGetItemsEnd(list); begin < end; begin++)
+        {
+            sum += *(unsigned int *)(*begin);
+        }
+        iterateTime += clock() - start;
+        listDealloc(&list);
+    }
+
+    printf("%8lu items: %12.0f inserts/s %12.0f iterated/s (checksum %lu)\n",
+           (unsigned long)itemCount,
+           perSecond(rounds * itemCount, insertTime),
+           perSecond(rounds * itemCount, iterateTime),
+           sum);
+}
+
+int main(void)
+{
+    printf("listInsertItem throughput\n");
+    benchInsert(1000UL);
+    benchInsert(100000UL);
+    benchInsert(1000000UL);
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "../output/output.h"
+#include "../data_structure/wordBuffer.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+#include "benchUtil.h"
+
+#define ROUNDS_WORDS 20000000UL
+#define BASE64 "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
+
+/*The writer output.c used before: one formatted call per word*/
+static void writePerWord(FILE *file, const WordBuffer code, const WordBuffer data)
+{
+    const char *const base64Chars = BASE64;
+    size_t i, w;
+
+    fprintf(file, "%lu %lu\n", (unsigned long)wordBufferGetCount(code), (unsigned long)wordBufferGetCount(data));
+    for (i = 0; i < 2; i++)
+    {
+        const WordBuffer image = i ? data : code;
+        for (w = 0; w < wordBufferGetCount(image); w++)
+        {
+            unsigned int value = wordBufferGetWord(image, w);
+            fprintf(file, "%c%c\n", base64Chars[(value >> 6) & 0x3F], base64Chars[value & 0x3F]);
+        }
+    }
+}
+
+static void writeImage(FILE *file, const WordBuffer code, const WordBuffer data, char *image)
+{
+    fwrite(image, 1, encodeObjectImage(image, wordBufferGetWords(code), wordBufferGetCount(code), wordBufferGetWords(data), wordBufferGetCount(data)), file);
+}
+
+/* Writes an object file of wordCount words into a temporary file, repeating
+ * until about ROUNDS_WORDS words were written with each writer.
+ * Both writers must produce the same bytes.
+ */
+
+static int benchWords(FILE *file, size_t wordCount)
+{
+    size_t rounds = ROUNDS_WORDS / wordCount ? ROUNDS_WORDS / wordCount : 1;
+    WordBuffer code = createWordBuffer(NULL, wordCount);
+    WordBuffer data = createWordBuffer(NULL, wordCount / 4);
+    char *image, *written;
+    size_t imageSize, r, w;
+    clock_t start, perWordTime, imageTime;
+    int same;
+
+    for (w = 0; w < wordCount; w++)
+        wordBufferAppend(w % 5 ? code : data, (unsigned int)(w * 2654435761UL) & WORD_MASK);
+    image = malloc(objectImageSize(wordBufferGetCount(code), wordBufferGetCount(data)));
+
+    start = clock();
+    for (r = 0; r < rounds; r++)
+    {
+        rewind(file);
+        writePerWord(file, code, data);
+        fflush(file);
+    }
+    perWordTime = clock() - start;
+
+    start = clock();
+    for (r = 0; r < rounds; r++)
+    {
+        rewind(file);
+        writeImage(file, code, data, image);
+        fflush(file);
+    }
+    imageTime = clock() - start;
+
+    /*Read back what the per-word writer produces and compare it to the image*/
+    rewind(file);
+    writePerWord(file, code, data);
+    fflush(file);
+    imageSize = encodeObjectImage(image, wordBufferGetWords(code), wordBufferGetCount(code), wordBufferGetWords(data), wordBufferGetCount(data));
+    written = malloc(imageSize);
+    rewind(file);
+    same = (size_t)ftell(file) == 0 && fread(written, 1, imageSize, file) == imageSize && memcmp(written, image, imageSize) == 0;
+
+    printf("%8lu words: per-word fprintf %12.0f words/s | encoded image %12.0f words/s\n",
+           (unsigned long)wordCount,
+           perSecond(rounds * wordCount, perWordTime),
+           perSecond(rounds * wordCount, imageTime));
+
+    free(written);
+    free(image);
+    wordBufferDealloc(&code);
+    wordBufferDealloc(&data);
+    if (!same)
+    {
+        fprintf(stderr, "encoded image differs from the per-word writer\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    FILE *file = tmpfile();
+    int failed;
+
+    if (!file)
+    {
+        fprintf(stderr, "cannot open a temporary file\n");
+        return 1;
+    }
+    printf(".ob writer throughput\n");
+    failed = benchWords(file, 100UL) || benchWords(file, 10000UL) || benchWords(file, 1000000UL);
+    fclose(file);
+    return failed;
+}
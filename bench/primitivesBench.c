@@ -0,0 +1,244 @@
+#define _POSIX_C_SOURCE 200112L
+#include "../data_structure/list.h"
+#include "../data_structure/tree.h"
+#include "../data_structure/hashTable.h"
+#include "../data_structure/wordBuffer.h"
+#include "../lexicalAnalysis/lexicalAnalysis.h"
+#include "../output/output.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+#include "benchUtil.h"
+
+#define LABEL_COUNT 4096
+#define LABEL_CAPACITY 32
+#define LINE_CAPACITY 81
+#define LIST_ITEMS 1000000UL
+#define LOOKUP_ROUNDS 4000000UL
+#define LEX_ROUNDS 2000000UL
+#define IMAGE_WORDS 4096UL
+#define IMAGE_ROUNDS 2000UL
+
+/* ns/op and allocations/op of the primitives the assembler spends its time
+ * in. The makefile links this binary with --wrap for malloc, calloc and
+ * realloc, so every allocation made by the repo's objects is counted here.
+ */
+
+static unsigned long allocations;
+
+void *__real_malloc(size_t size);
+void *__real_calloc(size_t count, size_t size);
+void *__real_realloc(void *item, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+    allocations++;
+    return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t count, size_t size)
+{
+    allocations++;
+    return __real_calloc(count, size);
+}
+
+void *__wrap_realloc(void *item, size_t size)
+{
+    allocations++;
+    return __real_realloc(item, size);
+}
+
+typedef struct
+{
+    struct timespec start;
+    unsigned long allocations;
+} Probe;
+
+static void probeStart(Probe *probe)
+{
+    probe->allocations = allocations;
+    clock_gettime(CLOCK_MONOTONIC, &probe->start);
+}
+
+static void probeReport(const Probe *probe, const char *name, unsigned long operations)
+{
+    double nanoseconds = elapsedSeconds(&probe->start) * 1e9;
+
+    printf("  %-34s %10.1f ns/op %10.3f allocs/op\n", name,
+           nanoseconds / operations, (double)(allocations - probe->allocations) / operations);
+}
+
+/*Same shape as the word items the code and data images used to store*/
+static void *wordCtor(const void *copy)
+{
+    return memcpy(malloc(sizeof(unsigned int)), copy, sizeof(unsigned int));
+}
+
+static void wordDtor(void *item)
+{
+    free(item);
+}
+
+static void benchList(void)
+{
+    Arena arena = createArena(0);
+    List heapList = createDynamicList(wordCtor, wordDtor);
+    List arenaList = createArenaList(arena, sizeof(unsigned int));
+    void *const *begin;
+    void *const *end;
+    unsigned long sum = 0;
+    unsigned int word;
+    Probe probe;
+    unsigned long i;
+
+    probeStart(&probe);
+    for (i = 0; i < LIST_ITEMS; i++)
+    {
+        word = (unsigned int)i;
+        listInsertItem(heapList, &word);
+    }
+    probeReport(&probe, "listInsertItem, heap items", LIST_ITEMS);
+
+    probeStart(&probe);
+    for (i = 0; i < LIST_ITEMS; i++)
+    {
+        word = (unsigned int)i;
+        listInsertItem(arenaList, &word);
+    }
+    probeReport(&probe, "listInsertItem, arena items", LIST_ITEMS);
+
+    probeStart(&probe);
+    for (begin = listGetBegin(arenaList), end = listGetItemsEnd(arenaList); begin < end; begin++)
+        sum += *(unsigned int *)(*begin);
+    probeReport(&probe, "list iteration", LIST_ITEMS);
+
+    if (sum != (unsigned long)LIST_ITEMS * (LIST_ITEMS - 1) / 2)
+        fprintf(stderr, "list checksum mismatch\n");
+    listDealloc(&heapList);
+    listDealloc(&arenaList);
+    arenaDealloc(&arena);
+}
+
+/* Labels the way programs name them: a handful of common stems with a
+ * counter, so many labels share prefixes, and a few long unique names.
+ */
+
+static void makeLabels(char labels[][LABEL_CAPACITY])
+{
+    static const char *const stems[] = {"L", "LOOP", "END", "STR", "K", "MAIN", "DATA", "ARR", "NEXT", "X"};
+    unsigned long seed = 2024;
+    int i;
+
+    for (i = 0; i < LABEL_COUNT; i++)
+    {
+        seed = seed * 1103515245UL + 12345UL;
+        if (i % 16 == 15)
+            sprintf(labels[i], "Subroutine%dEntryPoint", i);
+        else
+            sprintf(labels[i], "%s%d", stems[(seed >> 16) % 10], i);
+    }
+}
+
+static void benchLabels(void)
+{
+    static char labels[LABEL_COUNT][LABEL_CAPACITY];
+    static char misses[LABEL_COUNT][LABEL_CAPACITY];
+    WordTree trie = wordT();
+    HashTable table = hashTable(NULL);
+    unsigned long found = 0;
+    Probe probe;
+    unsigned long i;
+
+    makeLabels(labels);
+    for (i = 0; i < LABEL_COUNT; i++)
+        sprintf(misses[i], "%sZ", labels[i]);
+
+    probeStart(&probe);
+    for (i = 0; i < LABEL_COUNT; i++)
+        insertWord(trie, labels[i], labels[i]);
+    probeReport(&probe, "insertWord", LABEL_COUNT);
+
+    probeStart(&probe);
+    for (i = 0; i < LOOKUP_ROUNDS; i++)
+        found += checkIfExists(trie, (i & 1 ? misses : labels)[i % LABEL_COUNT]) != NULL;
+    probeReport(&probe, "checkIfExists, half misses", LOOKUP_ROUNDS);
+
+    probeStart(&probe);
+    for (i = 0; i < LABEL_COUNT; i++)
+        hashInsert(table, labels[i], labels[i]);
+    probeReport(&probe, "hashInsert", LABEL_COUNT);
+
+    probeStart(&probe);
+    for (i = 0; i < LOOKUP_ROUNDS; i++)
+        found += hashLookup(table, (i & 1 ? misses : labels)[i % LABEL_COUNT]) != NULL;
+    probeReport(&probe, "hashLookup, half misses", LOOKUP_ROUNDS);
+
+    if (found != LOOKUP_ROUNDS)
+        fprintf(stderr, "label lookups found %lu of %lu\n", found, LOOKUP_ROUNDS);
+    treeDealloc(&trie);
+    hashTableDealloc(&table);
+}
+
+/* parseNumber, parseOperands and checkLabel are private to the lexer, they
+ * are timed through fillTokenTree on lines that exercise little else. The
+ * copy of the line, which the lexer splits in place, is part of each op.
+ */
+
+static void benchLexLines(const char *name, const char *const *lines, size_t lineCount)
+{
+    char line[LINE_CAPACITY];
+    TokenTree *token = createTokenTree();
+    Probe probe;
+    unsigned long i;
+
+    probeStart(&probe);
+    for (i = 0; i < LEX_ROUNDS; i++)
+    {
+        strcpy(line, lines[i % lineCount]);
+        fillTokenTree(token, line);
+    }
+    probeReport(&probe, name, LEX_ROUNDS);
+    destoryTokenTree(token);
+}
+
+static void benchLexer(void)
+{
+    static const char *const immediates[] = {"prn -511", "cmp 12, -7", "mov 300, @r2", "prn +45"};
+    static const char *const labels[] = {"MAIN: rts", "LOOP12: rts", "Subroutine12EntryPoint: rts", "K: rts"};
+
+    benchLexLines("parseOperands, immediates", immediates, 4);
+    benchLexLines("checkLabel, labelled rts", labels, 4);
+}
+
+static void benchEncoder(void)
+{
+    WordBuffer code = createWordBuffer(NULL, IMAGE_WORDS);
+    WordBuffer data = createWordBuffer(NULL, IMAGE_WORDS / 4);
+    char *image;
+    Probe probe;
+    unsigned long i;
+
+    for (i = 0; i < IMAGE_WORDS; i++)
+        wordBufferAppend(i % 5 ? code : data, (unsigned int)(i * 2654435761UL) & WORD_MASK);
+    image = malloc(objectImageSize(wordBufferGetCount(code), wordBufferGetCount(data)));
+
+    probeStart(&probe);
+    for (i = 0; i < IMAGE_ROUNDS; i++)
+        encodeObjectImage(image, wordBufferGetWords(code), wordBufferGetCount(code), wordBufferGetWords(data), wordBufferGetCount(data));
+    probeReport(&probe, "encodeObjectImage, per word", IMAGE_ROUNDS * IMAGE_WORDS);
+
+    free(image);
+    wordBufferDealloc(&code);
+    wordBufferDealloc(&data);
+}
+
+int main(void)
+{
+    printf("primitives\n");
+    benchList();
+    benchLabels();
+    benchLexer();
+    benchEncoder();
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "../data_structure/tree.h"
+#include "../data_structure/hashTable.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+#include "benchUtil.h"
+
+#define LABEL_LENGTH 20
+#define LOOKUP_ROUNDS 2000000UL
+
+/* Deterministic label set: a letter followed by alphanumerics, the shape
+ * checkLabel accepts. Every label is LABEL_LENGTH characters long.
+ */
+
+static char *makeLabels(size_t count)
+{
+    static const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+    char *labels = malloc(count * (LABEL_LENGTH + 1));
+    unsigned long seed = 12345;
+    size_t i, c;
+    for (i = 0; i < count; i++)
+    {
+        char *label = labels + i * (LABEL_LENGTH + 1);
+        for (c = 0; c < LABEL_LENGTH; c++)
+        {
+            seed = seed * 1103515245UL + 12345UL;
+            label[c] = chars[(seed >> 16) % (c == 0 ? 52 : 62)];
+        }
+        label[LABEL_LENGTH] = '\0';
+    }
+    return labels;
+}
+
+static void benchLabels(size_t count)
+{
+    char *labels = makeLabels(count);
+    WordTree trie = wordT();
+    HashTable table = hashTable(NULL);
+    unsigned long i, found = 0;
+    clock_t start, trieTime, hashTime;
+
+    for (i = 0; i < count; i++)
+    {
+        insertWord(trie, labels + i * (LABEL_LENGTH + 1), labels);
+        hashInsert(table, labels + i * (LABEL_LENGTH + 1), labels);
+    }
+
+    start = clock();
+    for (i = 0; i < LOOKUP_ROUNDS; i++)
+    {
+        found += checkIfExists(trie, labels + (i % count) * (LABEL_LENGTH + 1)) != NULL;
+    }
+    trieTime = clock() - start;
+
+    start = clock();
+    for (i = 0; i < LOOKUP_ROUNDS; i++)
+    {
+        found += hashLookup(table, labels + (i % count) * (LABEL_LENGTH + 1)) != NULL;
+    }
+    hashTime = clock() - start;
+
+    printf("%6lu labels: trie %10lu bytes %11.0f lookups/s | hash %8lu bytes %11.0f lookups/s (%lu found)\n",
+           (unsigned long)count,
+           (unsigned long)treeMemoryUsage(trie), perSecond(LOOKUP_ROUNDS, trieTime),
+           (unsigned long)hashTableMemoryUsage(table), perSecond(LOOKUP_ROUNDS, hashTime),
+           found);
+
+    treeDealloc(&trie);
+    hashTableDealloc(&table);
+    free(labels);
+}
+
+int main(void)
+{
+    printf("symbol index, %d character labels\n", LABEL_LENGTH);
+    benchLabels(100);
+    benchLabels(1000);
+    benchLabels(5000);
+    return 0;
+}
@@ -0,0 +1,262 @@
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+
+#define NAME_CAPACITY 512
+#define VALUES_PER_DATA_LINE 10
+#define MAX_STRING_LENGTH 20
+#define MAX_IMMEDIATE 511
+
+/* Writes a corpus of valid .as programs. The same options and seed always
+ * give the same files, so timings of different builds are comparable.
+ */
+
+typedef struct
+{
+    int files;
+    int instructions;
+    int labels;
+    int forwardRefs;
+    int externs;
+    int entries;
+    int dataValues;
+    int strings;
+    int macros;
+    int macroCalls;
+    unsigned long seed;
+} Workload;
+
+static unsigned long state;
+
+static unsigned long nextRandom(void)
+{
+    state = state * 1103515245UL + 12345UL;
+    return (state >> 16) & 0x7fffUL;
+}
+
+static int randomBelow(int bound)
+{
+    return bound > 0 ? (int)(nextRandom() % (unsigned long)bound) : 0;
+}
+
+/*Spends budget evenly over the slots that are left: true budget out of slots times*/
+static int take(int *budget, int slots)
+{
+    if (*budget <= 0 || slots <= 0 || randomBelow(slots) >= *budget)
+        return 0;
+    (*budget)--;
+    return 1;
+}
+
+typedef struct
+{
+    const Workload *workload;
+    int definedLabels;
+    int forwardLeft;
+    int externsLeft;
+} Program;
+
+/* Prints a label operand: a forward reference (a later code label or a data
+ * label), an extern, or a label defined above.
+ */
+
+static void printLabelOperand(FILE *file, Program *program, int slotsLeft)
+{
+    const Workload *w = program->workload;
+    int later = w->labels - program->definedLabels;
+    int dataLabels = (w->dataValues ? 1 : 0) + w->strings;
+
+    if (take(&program->externsLeft, slotsLeft))
+        fprintf(file, "X%d", w->externs - program->externsLeft - 1);
+    else if ((later > 0 || dataLabels > 0) && take(&program->forwardLeft, slotsLeft))
+    {
+        if (later > 0 && (dataLabels == 0 || randomBelow(2)))
+            fprintf(file, "L%d", program->definedLabels + randomBelow(later));
+        else if (w->strings && (w->dataValues == 0 || randomBelow(2)))
+            fprintf(file, "S%d", randomBelow(w->strings));
+        else
+            fprintf(file, "D0");
+    }
+    else if (program->definedLabels > 0)
+        fprintf(file, "L%d", randomBelow(program->definedLabels));
+    else if (later > 0)
+        fprintf(file, "L%d", program->definedLabels);
+    else
+        fprintf(file, "@r%d", randomBelow(8));
+}
+
+static void printOperand(FILE *file, Program *program, int allowImmediate, int slotsLeft)
+{
+    int kind = randomBelow(allowImmediate ? 3 : 2);
+
+    if (kind == 0 || program->externsLeft + program->forwardLeft >= slotsLeft)
+        printLabelOperand(file, program, slotsLeft);
+    else if (kind == 1)
+        fprintf(file, "@r%d", randomBelow(8));
+    else
+        fprintf(file, "%d", randomBelow(2 * MAX_IMMEDIATE + 1) - MAX_IMMEDIATE);
+}
+
+/*Every opcode but stop, which ends the code*/
+static void printInstruction(FILE *file, Program *program, int slotsLeft)
+{
+    static const char *const twoOperands[] = {"mov", "cmp", "add", "sub", "lea"};
+    static const char *const oneOperand[] = {"not", "clr", "inc", "dec", "jmp", "bne", "red", "prn", "jsr"};
+    int choice = randomBelow(15);
+
+    if (choice < 5)
+    {
+        fprintf(file, "%s ", twoOperands[choice]);
+        if (choice == 4)
+            printLabelOperand(file, program, slotsLeft);
+        else
+            printOperand(file, program, 1, slotsLeft);
+        fprintf(file, ", ");
+        printOperand(file, program, choice == 1, slotsLeft);
+    }
+    else if (choice < 14)
+    {
+        fprintf(file, "%s ", oneOperand[choice - 5]);
+        printOperand(file, program, choice == 12, slotsLeft);
+    }
+    else
+    {
+        fprintf(file, "rts");
+    }
+    fputc('\n', file);
+}
+
+static void writeProgram(FILE *file, const Workload *w)
+{
+    Program program;
+    int lines = w->instructions + w->macroCalls;
+    int labelsLeft = w->labels;
+    int callsLeft = w->macroCalls;
+    int i, j, values;
+
+    program.workload = w;
+    program.definedLabels = 0;
+    program.forwardLeft = w->forwardRefs;
+    program.externsLeft = w->externs;
+
+    for (i = 0; i < w->externs; i++)
+        fprintf(file, ".extern X%d\n", i);
+    for (i = 0; i < w->entries && i < w->labels; i++)
+        fprintf(file, ".entry L%d\n", i);
+    for (i = 0; i < w->macros; i++)
+        fprintf(file, "mcro m%d\n    sub @r%d, @r%d\n    prn %d\nendmcro\n",
+                i, randomBelow(8), randomBelow(8), randomBelow(100));
+
+    for (i = lines; i > 0; i--)
+    {
+        if (w->macros && take(&callsLeft, i))
+        {
+            fprintf(file, "m%d\n", randomBelow(w->macros));
+            continue;
+        }
+        if (take(&labelsLeft, i))
+            fprintf(file, "L%d: ", program.definedLabels++);
+        printInstruction(file, &program, i);
+    }
+    /*Labels the random walk did not place end up on the final stop*/
+    for (; labelsLeft > 1; labelsLeft--)
+        fprintf(file, "L%d: rts\n", program.definedLabels++);
+    if (labelsLeft)
+        fprintf(file, "L%d: ", program.definedLabels++);
+    fprintf(file, "stop\n");
+
+    for (i = 0, values = w->dataValues; values > 0; i++)
+    {
+        fprintf(file, "D%d: .data ", i);
+        for (j = 0; j < VALUES_PER_DATA_LINE && values > 0; j++, values--)
+            fprintf(file, "%s%d", j ? "," : "", randomBelow(1001) - 500);
+        fputc('\n', file);
+    }
+    for (i = 0; i < w->strings; i++)
+    {
+        fprintf(file, "S%d: .string \"", i);
+        for (j = randomBelow(MAX_STRING_LENGTH) + 1; j > 0; j--)
+            fputc('a' + randomBelow(26), file);
+        fprintf(file, "\"\n");
+    }
+}
+
+static int parseCount(const char *text, int *count)
+{
+    char *end;
+    long value = strtol(text, &end, 10);
+    if (*text == '\0' || *end != '\0' || value < 0 || value > 1000000L)
+        return -1;
+    *count = (int)value;
+    return 0;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: workloadGen [-n files] [-i instructions] [-l labels] [-f forward refs]\n"
+            "                   [-x externs] [-e entries] [-d data values] [-s strings]\n"
+            "                   [-m macros] [-c macro calls] [-r seed] directory\n");
+}
+
+int main(int argc, char **argv)
+{
+    Workload w = {20, 400, 60, 40, 5, 10, 100, 10, 5, 40, 1};
+    const char *directory = NULL;
+    char name[NAME_CAPACITY];
+    FILE *file;
+    int *field;
+    int seed;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        field = NULL;
+        if (argv[i][0] != '-')
+        {
+            directory = argv[i];
+            continue;
+        }
+        switch (argv[i][1])
+        {
+        case 'n': field = &w.files; break;
+        case 'i': field = &w.instructions; break;
+        case 'l': field = &w.labels; break;
+        case 'f': field = &w.forwardRefs; break;
+        case 'x': field = &w.externs; break;
+        case 'e': field = &w.entries; break;
+        case 'd': field = &w.dataValues; break;
+        case 's': field = &w.strings; break;
+        case 'm': field = &w.macros; break;
+        case 'c': field = &w.macroCalls; break;
+        case 'r': field = &seed; break;
+        }
+        if (field == NULL || argv[i][2] != '\0' || i + 1 == argc || parseCount(argv[++i], field) != 0)
+        {
+            usage();
+            return 1;
+        }
+        if (field == &seed)
+            w.seed = (unsigned long)seed;
+    }
+    if (directory == NULL || strlen(directory) > NAME_CAPACITY - 16)
+    {
+        usage();
+        return 1;
+    }
+
+    for (i = 0; i < w.files; i++)
+    {
+        sprintf(name, "%s/w%05d.as", directory, i);
+        file = fopen(name, "w");
+        if (!file)
+        {
+            fprintf(stderr, "cannot write '%s'\n", name);
+            return 1;
+        }
+        state = w.seed * 7919UL + (unsigned long)i;
+        writeProgram(file, &w);
+        fclose(file);
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+#define _POSIX_C_SOURCE 200112L
+#include "assembler/assembler.h"
+#include "assembler/server.h"
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+/* Drop-in replacement for the assembler. When ASM_SERVER_SOCKET names the
+ * socket of a running batch server, the files are sent to it as jobs and
+ * their diagnostics are printed here, so a build pays no process start and
+ * no cold tables per invocation. Options, an unset variable or a server
+ * that cannot be reached make it assemble in-process like the CLI.
+ */
+
+static int connectToServer(const char *path)
+{
+    struct sockaddr_un address;
+    int fd;
+
+    if (strlen(path) >= sizeof(address.sun_path))
+        return -1;
+    memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    strcpy(address.sun_path, path);
+    fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0)
+        return -1;
+    if (connect(fd, (struct sockaddr *)&address, sizeof(address)) != 0)
+    {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/*The server may run in another directory, so relative names are sent made absolute*/
+static int formatJob(const char *fileName, const char *workingDirectory, char *line, size_t capacity)
+{
+    if (fileName[0] == '/')
+    {
+        if (strlen(fileName) + 2 > capacity)
+            return -1;
+        sprintf(line, "%s\n", fileName);
+    }
+    else
+    {
+        if (strlen(workingDirectory) + strlen(fileName) + 3 > capacity)
+            return -1;
+        sprintf(line, "%s/%s\n", workingDirectory, fileName);
+    }
+    return 0;
+}
+
+/* Sends one job and copies its diagnostics to stderr.
+ * Returns -1 if the server did not answer. */
+static int sendJob(int fd, FILE *replies, const char *line)
+{
+    char header[64];
+    char buffer[4096];
+    unsigned long microseconds, length;
+    size_t chunk;
+    int status;
+
+    if (serverWriteAll(fd, line, strlen(line)) != 0 || !fgets(header, sizeof(header), replies) ||
+        sscanf(header, "%d %lu %lu", &status, &microseconds, &length) != 3)
+        return -1;
+    while (length > 0)
+    {
+        chunk = length < sizeof(buffer) ? length : sizeof(buffer);
+        if (fread(buffer, 1, chunk, replies) != chunk)
+            return -1;
+        fwrite(buffer, 1, chunk, stderr);
+        length -= chunk;
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *socketPath = getenv(SERVER_SOCKET_ENV);
+    char workingDirectory[SERVER_LINE_CAPACITY / 2];
+    char line[SERVER_LINE_CAPACITY];
+    FILE *replies;
+    int fd = -1;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
+            socketPath = NULL;
+    }
+    if (socketPath && getcwd(workingDirectory, sizeof(workingDirectory)))
+        fd = connectToServer(socketPath);
+    if (fd < 0)
+        return assembler(argc - 1, argv + 1);
+
+    replies = fdopen(fd, "r");
+    if (!replies)
+    {
+        close(fd);
+        return assembler(argc - 1, argv + 1);
+    }
+    for (i = 1; i < argc; i++)
+    {
+        if (formatJob(argv[i], workingDirectory, line, sizeof(line)) != 0 || sendJob(fd, replies, line) != 0)
+            break;
+    }
+    fclose(replies);
+
+    /*Files the server did not answer for are assembled here*/
+    if (i < argc)
+        return assembler(argc - i, argv + i);
+    return 0;
+}
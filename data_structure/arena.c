@@ -0,0 +1,256 @@
+#include <stdlib.h>
+#include <string.h>
+#include "arena.h"
+
+#define ARENABLOCKSIZE 65536
+
+/*Every allocation is aligned for the strictest of these*/
+typedef union
+{
+    long l;
+    double d;
+    void *p;
+    void (*f)(void);
+} maxAlign;
+
+#define ALIGNUP(size) (((size) + sizeof(maxAlign) - 1) / sizeof(maxAlign) * sizeof(maxAlign))
+
+struct arenaBlock
+{
+    struct arenaBlock *next;
+    size_t size;
+    size_t used;
+    maxAlign data[1];
+};
+
+struct ArenaData
+{
+    struct arenaBlock *current;
+    struct arenaBlock *spare;
+    struct arenaBlock *large;
+    size_t blockSize;
+    size_t used;
+    void *lastItem;
+#ifdef MEMSTATS
+    size_t ownerBytes[MEM_OWNER_COUNT];
+#endif
+};
+
+static struct arenaBlock *newBlock(size_t size)
+{
+    struct arenaBlock *block = malloc(offsetof(struct arenaBlock, data) + size);
+    if (block == NULL)
+        return NULL;
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+    return block;
+}
+
+static void freeBlocks(struct arenaBlock *block)
+{
+    struct arenaBlock *next;
+    while (block)
+    {
+        next = block->next;
+        free(block);
+        block = next;
+    }
+}
+
+#ifdef MEMSTATS
+static void charge(Arena arena, MemOwner owner, size_t size)
+{
+    arena->ownerBytes[owner] += size;
+    memStatsTake(owner, size);
+}
+
+/*Everything carved from the arena is released together*/
+static void releaseOwners(Arena arena)
+{
+    int owner;
+    for (owner = 0; owner < MEM_OWNER_COUNT; owner++)
+    {
+        memStatsRelease((MemOwner)owner, arena->ownerBytes[owner]);
+        arena->ownerBytes[owner] = 0;
+    }
+}
+#endif
+
+Arena createArena(size_t blockSize)
+{
+    Arena arena = calloc(1, sizeof(struct ArenaData));
+    if (arena == NULL)
+        return NULL;
+    arena->blockSize = blockSize ? ALIGNUP(blockSize) : ARENABLOCKSIZE;
+    return arena;
+}
+
+void *arenaAlloc(Arena arena, size_t size)
+{
+    return arenaAllocFor(arena, size, MEM_OTHER);
+}
+
+void *arenaAllocFor(Arena arena, size_t size, MemOwner owner)
+{
+    struct arenaBlock *block;
+    void *item;
+
+    if (arena == NULL)
+        return MEM_MALLOC(owner, size);
+    size = ALIGNUP(size ? size : 1);
+#ifdef MEMSTATS
+    charge(arena, owner, size);
+#endif
+
+    /*Requests bigger than a quarter block get a block of their own*/
+    if (size > arena->blockSize / 4)
+    {
+        block = newBlock(size);
+        if (block == NULL)
+            return NULL;
+        block->next = arena->large;
+        arena->large = block;
+        arena->used += size;
+        arena->lastItem = NULL;
+        return block->data;
+    }
+
+    block = arena->current;
+    if (block == NULL || block->size - block->used < size)
+    {
+        if (arena->spare)
+        {
+            block = arena->spare;
+            arena->spare = block->next;
+            block->used = 0;
+        }
+        else
+        {
+            block = newBlock(arena->blockSize);
+            if (block == NULL)
+                return NULL;
+        }
+        block->next = arena->current;
+        arena->current = block;
+    }
+    item = (char *)block->data + block->used;
+    block->used += size;
+    arena->used += size;
+    arena->lastItem = item;
+    return item;
+}
+
+void *arenaCalloc(Arena arena, size_t count, size_t size)
+{
+    return arenaCallocFor(arena, count, size, MEM_OTHER);
+}
+
+void *arenaCallocFor(Arena arena, size_t count, size_t size, MemOwner owner)
+{
+    void *item;
+    if (arena == NULL)
+        return MEM_CALLOC(owner, count, size);
+    item = arenaAllocFor(arena, count * size, owner);
+    if (item)
+        memset(item, 0, count * size);
+    return item;
+}
+
+/* Resizes item to newSize, keeping its first oldSize bytes.
+ * The most recent allocation of a block is extended in place when it fits.
+ */
+
+void *arenaGrow(Arena arena, void *item, size_t oldSize, size_t newSize)
+{
+    return arenaGrowFor(arena, item, oldSize, newSize, MEM_OTHER);
+}
+
+void *arenaGrowFor(Arena arena, void *item, size_t oldSize, size_t newSize, MemOwner owner)
+{
+    struct arenaBlock *block;
+    void *newItem;
+
+    if (arena == NULL)
+        return MEM_REALLOC(owner, item, newSize);
+    block = arena->current;
+    if (item != NULL && item == arena->lastItem &&
+        (char *)item + ALIGNUP(newSize) <= (char *)block->data + block->size)
+    {
+        block->used = (size_t)((char *)item - (char *)block->data) + ALIGNUP(newSize);
+        arena->used += ALIGNUP(newSize) - ALIGNUP(oldSize);
+#ifdef MEMSTATS
+        if (ALIGNUP(newSize) > ALIGNUP(oldSize))
+            charge(arena, owner, ALIGNUP(newSize) - ALIGNUP(oldSize));
+#endif
+        return item;
+    }
+    newItem = arenaAllocFor(arena, newSize, owner);
+    if (newItem && item)
+        memcpy(newItem, item, oldSize < newSize ? oldSize : newSize);
+    return newItem;
+}
+
+char *arenaStrdup(Arena arena, const char *string)
+{
+    return arenaStrdupFor(arena, string, MEM_OTHER);
+}
+
+char *arenaStrdupFor(Arena arena, const char *string, MemOwner owner)
+{
+    size_t length = strlen(string) + 1;
+    char *copy = arenaAllocFor(arena, length, owner);
+    if (copy)
+        memcpy(copy, string, length);
+    return copy;
+}
+
+/*Only heap items are released here, arena items go away with arenaReset*/
+void arenaFree(Arena arena, void *item)
+{
+    if (arena == NULL)
+        MEM_FREE(item);
+}
+
+size_t arenaGetUsed(const Arena arena)
+{
+    return arena->used;
+}
+
+/*Releases every allocation, regular blocks are kept for reuse and oversized ones are freed*/
+void arenaReset(Arena arena)
+{
+    struct arenaBlock *block = arena->current;
+    struct arenaBlock *next;
+
+    while (block)
+    {
+        next = block->next;
+        block->next = arena->spare;
+        arena->spare = block;
+        block = next;
+    }
+    arena->current = NULL;
+    freeBlocks(arena->large);
+    arena->large = NULL;
+    arena->used = 0;
+    arena->lastItem = NULL;
+#ifdef MEMSTATS
+    releaseOwners(arena);
+#endif
+}
+
+void arenaDealloc(Arena *arena)
+{
+    if (*arena != NULL)
+    {
+        freeBlocks((*arena)->current);
+        freeBlocks((*arena)->spare);
+        freeBlocks((*arena)->large);
+#ifdef MEMSTATS
+        releaseOwners(*arena);
+#endif
+        free(*arena);
+        *arena = NULL;
+    }
+}
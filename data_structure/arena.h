@@ -0,0 +1,28 @@
+#ifndef ARENA_H
+#define ARENA_H
+#include "stddef.h"
+#include "memStats.h"
+
+/* A region allocator. Everything allocated from an arena is released at
+ * once by arenaReset, which keeps the blocks for the next round of use.
+ * Containers that take an Arena fall back to the heap when it is NULL.
+ * The For variants charge the memory to an owner when built with MEMSTATS,
+ * the plain ones charge it to MEM_OTHER.
+ */
+typedef struct ArenaData *Arena;
+
+Arena createArena(size_t blockSize);
+void *arenaAlloc(Arena arena, size_t size);
+void *arenaCalloc(Arena arena, size_t count, size_t size);
+void *arenaGrow(Arena arena, void *item, size_t oldSize, size_t newSize);
+char *arenaStrdup(Arena arena, const char *string);
+void *arenaAllocFor(Arena arena, size_t size, MemOwner owner);
+void *arenaCallocFor(Arena arena, size_t count, size_t size, MemOwner owner);
+void *arenaGrowFor(Arena arena, void *item, size_t oldSize, size_t newSize, MemOwner owner);
+char *arenaStrdupFor(Arena arena, const char *string, MemOwner owner);
+void arenaFree(Arena arena, void *item);
+size_t arenaGetUsed(const Arena arena);
+void arenaReset(Arena arena);
+void arenaDealloc(Arena *arena);
+
+#endif
@@ -0,0 +1,181 @@
+#include "hashTable.h"
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#define TABLESIZE 64
+#define KEYPOOLSIZE 512
+
+/* Open addressing with linear probing. A slot whose hash is 0 is empty,
+ * computed hashes are never 0. Keys are copied into one growing pool and
+ * slots refer to them by offset, so a slot stays 16 bytes on 64 bit hosts.
+ */
+struct slot
+{
+    uint32_t hash;
+    uint32_t keyOffset;
+    void *value;
+};
+
+struct HashTableData
+{
+    struct slot *slots;
+    size_t capacity;
+    size_t used;
+    char *keyPool;
+    size_t poolSize;
+    size_t poolUsed;
+    unsigned long lookups;
+    Arena arena;
+};
+
+/*FNV-1a*/
+static uint32_t hashKey(const char *key)
+{
+    uint32_t hash = 2166136261UL;
+    while (*key)
+    {
+        hash ^= (unsigned char)*key++;
+        hash *= 16777619UL;
+    }
+    return hash ? hash : 1;
+}
+
+static struct slot *findSlot(struct slot *slots, size_t capacity, const char *keyPool, const char *key, uint32_t hash)
+{
+    size_t mask = capacity - 1;
+    size_t it = hash & mask;
+    while (slots[it].hash != 0)
+    {
+        if (slots[it].hash == hash && strcmp(keyPool + slots[it].keyOffset, key) == 0)
+        {
+            break;
+        }
+        it = (it + 1) & mask;
+    }
+    return &slots[it];
+}
+
+static int growSlots(HashTable table)
+{
+    size_t newCapacity = table->capacity * 2;
+    struct slot *newSlots = arenaCallocFor(table->arena, newCapacity, sizeof(struct slot), MEM_HASH);
+    size_t it, probe;
+    if (newSlots == NULL)
+        return -1;
+    for (it = 0; it < table->capacity; it++)
+    {
+        if (table->slots[it].hash != 0)
+        {
+            probe = table->slots[it].hash & (newCapacity - 1);
+            while (newSlots[probe].hash != 0)
+                probe = (probe + 1) & (newCapacity - 1);
+            newSlots[probe] = table->slots[it];
+        }
+    }
+    arenaFree(table->arena, table->slots);
+    table->slots = newSlots;
+    table->capacity = newCapacity;
+    return 0;
+}
+
+static long storeKey(HashTable table, const char *key)
+{
+    size_t length = strlen(key) + 1;
+    size_t newSize;
+    char *temp;
+    long offset;
+    if (table->poolUsed + length > table->poolSize)
+    {
+        newSize = table->poolSize * 2;
+        while (table->poolUsed + length > newSize)
+            newSize *= 2;
+        temp = arenaGrowFor(table->arena, table->keyPool, table->poolUsed, newSize, MEM_HASH);
+        if (temp == NULL)
+            return -1;
+        table->keyPool = temp;
+        table->poolSize = newSize;
+    }
+    memcpy(table->keyPool + table->poolUsed, key, length);
+    offset = (long)table->poolUsed;
+    table->poolUsed += length;
+    return offset;
+}
+
+HashTable hashTable(Arena arena)
+{
+    HashTable table = arenaCallocFor(arena, 1, sizeof(struct HashTableData), MEM_HASH);
+    if (table == NULL)
+        return NULL;
+    table->arena = arena;
+    table->slots = arenaCallocFor(arena, TABLESIZE, sizeof(struct slot), MEM_HASH);
+    table->keyPool = arenaAllocFor(arena, KEYPOOLSIZE, MEM_HASH);
+    if (table->slots == NULL || table->keyPool == NULL)
+    {
+        arenaFree(arena, table->slots);
+        arenaFree(arena, table->keyPool);
+        arenaFree(arena, table);
+        return NULL;
+    }
+    table->capacity = TABLESIZE;
+    table->poolSize = KEYPOOLSIZE;
+    return table;
+}
+
+/*Maps key to value, replacing an existing value. Returns the stored copy of the key, or NULL*/
+const char *hashInsert(HashTable table, const char *key, void *value)
+{
+    uint32_t hash = hashKey(key);
+    struct slot *slot;
+    long offset;
+
+    slot = findSlot(table->slots, table->capacity, table->keyPool, key, hash);
+    if (slot->hash == 0)
+    {
+        /*Keep the load factor at or under one half*/
+        if ((table->used + 1) * 2 > table->capacity)
+        {
+            if (growSlots(table) != 0)
+                return NULL;
+            slot = findSlot(table->slots, table->capacity, table->keyPool, key, hash);
+        }
+        offset = storeKey(table, key);
+        if (offset < 0)
+            return NULL;
+        slot->hash = hash;
+        slot->keyOffset = (uint32_t)offset;
+        table->used++;
+    }
+    slot->value = value;
+    return table->keyPool + slot->keyOffset;
+}
+
+void *hashLookup(HashTable table, const char *key)
+{
+    table->lookups++;
+    if (key == NULL)
+        return NULL;
+    return findSlot(table->slots, table->capacity, table->keyPool, key, hashKey(key))->value;
+}
+
+/*Number of hashLookup calls made on the table*/
+unsigned long hashTableGetLookupCount(const HashTable table)
+{
+    return table->lookups;
+}
+
+size_t hashTableMemoryUsage(const HashTable table)
+{
+    return sizeof(struct HashTableData) + table->capacity * sizeof(struct slot) + table->poolSize;
+}
+
+void hashTableDealloc(HashTable *table)
+{
+    if (*table != NULL)
+    {
+        arenaFree((*table)->arena, (*table)->slots);
+        arenaFree((*table)->arena, (*table)->keyPool);
+        arenaFree((*table)->arena, *table);
+        *table = NULL;
+    }
+}
@@ -0,0 +1,20 @@
+#ifndef HASHTABLE_H
+#define HASHTABLE_H
+#include "stddef.h"
+#include "arena.h"
+
+typedef struct HashTableData *HashTable;
+
+HashTable hashTable(Arena arena);
+
+const char *hashInsert(HashTable table, const char *key, void *value);
+
+void *hashLookup(HashTable table, const char *key);
+
+unsigned long hashTableGetLookupCount(const HashTable table);
+
+size_t hashTableMemoryUsage(const HashTable table);
+
+void hashTableDealloc(HashTable *table);
+
+#endif
@@ -1,5 +1,6 @@
 
 #include <stdlib.h>
+#include <string.h>
 #include "list.h"
 
 #define LISTSIZE 12
@@ -11,6 +12,8 @@ struct ListData
     size_t itemCount;
     void *(*itemCtor)(const void *copy);
     void (*itemDtor)(void *item);
+    Arena arena;
+    size_t itemSize;
 };
 void *const *listGetBegin(const List vec)
 {
@@ -20,6 +23,11 @@ void *const *listGetEnd(const List vec)
 {
     return &vec->items[vec->pointers - 1];
 }
+/*One past the last inserted item, iteration with '<' visits exactly itemCount items*/
+void *const *listGetItemsEnd(const List vec)
+{
+    return &vec->items[vec->itemCount];
+}
 
 size_t listGetItemCount(const List vec)
 {
@@ -32,7 +40,7 @@ void listDeallocItems(List vec)
 
     if (vec->itemDtor != NULL)
     {
-        for (it = 0; it < vec->pointers; it++)
+        for (it = 0; it < vec->itemCount; it++)
         {
             if (vec->items[it] != NULL)
                 vec->itemDtor(vec->items[it]);
@@ -40,28 +48,32 @@ void listDeallocItems(List vec)
     }
 }
 
+/*Arena lists only drop the handle, their memory goes with the arena*/
 void listDealloc(List *vec)
 {
     if (*vec != NULL)
     {
-        listDeallocItems(*vec);
+        if ((*vec)->arena == NULL)
+        {
+            listDeallocItems(*vec);
 
-        free((*vec)->items);
-        free(*vec);
+            MEM_FREE((*vec)->items);
+            MEM_FREE(*vec);
+        }
         *vec = NULL;
     }
 }
 
 List createDynamicList(void *(*itemCtor)(const void *copy), void (*itemDtor)(void *item))
 {
-    List newVec = calloc(1, sizeof(struct ListData));
+    List newVec = MEM_CALLOC(MEM_LIST, 1, sizeof(struct ListData));
     if (newVec == NULL)
         return NULL;
     newVec->pointers = LISTSIZE;
-    newVec->items = calloc(LISTSIZE, sizeof(void *));
+    newVec->items = MEM_CALLOC(MEM_LIST, LISTSIZE, sizeof(void *));
     if (newVec->items == NULL)
     {
-        free(newVec);
+        MEM_FREE(newVec);
         return NULL;
     }
     newVec->itemCtor = itemCtor;
@@ -69,47 +81,59 @@ List createDynamicList(void *(*itemCtor)(const void *copy), void (*itemDtor)(voi
     return newVec;
 }
 
+/* A list whose handle, item array and item copies all live in the arena.
+ * Items are copied itemSize bytes at a time, no constructor or destructor runs.
+ */
+
+List createArenaList(Arena arena, size_t itemSize)
+{
+    List newVec = arenaCallocFor(arena, 1, sizeof(struct ListData), MEM_LIST);
+    if (newVec == NULL)
+        return NULL;
+    newVec->pointers = LISTSIZE;
+    newVec->items = arenaCallocFor(arena, LISTSIZE, sizeof(void *), MEM_LIST);
+    if (newVec->items == NULL)
+        return NULL;
+    newVec->arena = arena;
+    newVec->itemSize = itemSize;
+    return newVec;
+}
+
+static void *copyItem(List vec, const void *copy)
+{
+    void *item;
+    if (vec->arena == NULL)
+        return vec->itemCtor(copy);
+    item = arenaAllocFor(vec->arena, vec->itemSize, MEM_LIST);
+    return item ? memcpy(item, copy, vec->itemSize) : NULL;
+}
+
+/*Items are never removed one by one, so the first free slot is always at itemCount*/
 void *listInsertItem(List vec, const void *copy)
 {
     size_t it;
     void **temp;
+    void *item;
     if (vec->itemCount == vec->pointers)
     {
         vec->pointers *= 2;
-        temp = realloc(vec->items, vec->pointers * sizeof(void *));
+        temp = arenaGrowFor(vec->arena, vec->items, vec->itemCount * sizeof(void *), vec->pointers * sizeof(void *), MEM_LIST);
         if (temp == NULL)
         {
             vec->pointers /= 2;
             return NULL;
         }
         vec->items = temp;
-        vec->items[vec->itemCount] = vec->itemCtor(copy);
-        if (vec->items[vec->itemCount] == NULL)
-        {
-            return NULL;
-        }
-        vec->itemCount++;
-
         for (it = vec->itemCount; it < vec->pointers; it++)
         {
             vec->items[it] = NULL;
         }
     }
-    else
+    item = copyItem(vec, copy);
+    if (item == NULL)
     {
-        for (it = 0; it < vec->pointers; it++)
-        {
-            if (vec->items[it] == NULL)
-            {
-                vec->items[it] = vec->itemCtor(copy);
-                if (vec->items[it] != NULL)
-                {
-                    vec->itemCount++;
-                    break;
-                }
-                return NULL;
-            }
-        }
+        return NULL;
     }
-    return vec->items[vec->itemCount - 1];
+    vec->items[vec->itemCount++] = item;
+    return item;
 }
@@ -3,13 +3,16 @@
 #include "stdio.h"
 #include "stddef.h"
 #include "stdint.h"
+#include "arena.h"
 
 typedef struct ListData *List;
 
 List createDynamicList(void *(*itemCtor)(const void *copy), void (*itemDtor)(void *item));
+List createArenaList(Arena arena, size_t itemSize);
 void *listInsertItem(List vec, const void *copy);
 void *const *listGetBegin(const List vec);
 void *const *listGetEnd(const List vec);
+void *const *listGetItemsEnd(const List vec);
 size_t listGetItemCount(const List vec);
 void listDeallocItems(List vec);
 void listDealloc(List *vec);
@@ -0,0 +1,130 @@
+#ifdef MEMSTATS
+#define _POSIX_C_SOURCE 200112L
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "memStats.h"
+
+/*Heap items carry their owner and size in front, aligned for any type*/
+typedef union
+{
+    struct
+    {
+        size_t size;
+        MemOwner owner;
+    } tag;
+    long l;
+    double d;
+    void *p;
+    void (*f)(void);
+} itemHeader;
+
+struct ownerStats
+{
+    unsigned long allocations;
+    size_t live;
+    size_t peak;
+};
+
+static const char *const ownerNames[MEM_OWNER_COUNT] = {
+    "list", "trie", "symbol", "extern", "macro", "token", "hash", "words", "source", "other"};
+
+/*Workers of -j allocate concurrently, every update holds the lock*/
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static struct ownerStats owners[MEM_OWNER_COUNT];
+static struct ownerStats total;
+
+void memStatsTake(MemOwner owner, size_t size)
+{
+    pthread_mutex_lock(&lock);
+    owners[owner].allocations++;
+    owners[owner].live += size;
+    if (owners[owner].live > owners[owner].peak)
+        owners[owner].peak = owners[owner].live;
+    total.allocations++;
+    total.live += size;
+    if (total.live > total.peak)
+        total.peak = total.live;
+    pthread_mutex_unlock(&lock);
+}
+
+void memStatsRelease(MemOwner owner, size_t size)
+{
+    pthread_mutex_lock(&lock);
+    owners[owner].live -= size;
+    total.live -= size;
+    pthread_mutex_unlock(&lock);
+}
+
+void *memStatsMalloc(MemOwner owner, size_t size)
+{
+    itemHeader *header = malloc(sizeof(itemHeader) + size);
+    if (header == NULL)
+        return NULL;
+    header->tag.size = size;
+    header->tag.owner = owner;
+    memStatsTake(owner, size);
+    return header + 1;
+}
+
+void *memStatsCalloc(MemOwner owner, size_t count, size_t size)
+{
+    void *item = memStatsMalloc(owner, count * size);
+    if (item)
+        memset(item, 0, count * size);
+    return item;
+}
+
+/*A resize counts as one more allocation of the new size*/
+void *memStatsRealloc(MemOwner owner, void *item, size_t size)
+{
+    itemHeader *header;
+    size_t oldSize;
+
+    if (item == NULL)
+        return memStatsMalloc(owner, size);
+    header = (itemHeader *)item - 1;
+    oldSize = header->tag.size;
+    owner = header->tag.owner;
+    header = realloc(header, sizeof(itemHeader) + size);
+    if (header == NULL)
+        return NULL;
+    header->tag.size = size;
+    memStatsRelease(owner, oldSize);
+    memStatsTake(owner, size);
+    return header + 1;
+}
+
+void memStatsFree(void *item)
+{
+    itemHeader *header;
+
+    if (item == NULL)
+        return;
+    header = (itemHeader *)item - 1;
+    memStatsRelease(header->tag.owner, header->tag.size);
+    free(header);
+}
+
+void printMemStats(FILE *file)
+{
+    int i;
+
+    pthread_mutex_lock(&lock);
+    fprintf(file, "%-20s %12s %12s %12s\n", "memory", "allocs", "live_bytes", "peak_bytes");
+    for (i = 0; i < MEM_OWNER_COUNT; i++)
+    {
+        fprintf(file, "%-20s %12lu %12lu %12lu\n", ownerNames[i], owners[i].allocations,
+                (unsigned long)owners[i].live, (unsigned long)owners[i].peak);
+    }
+    fprintf(file, "%-20s %12lu %12lu %12lu\n", "(total)", total.allocations,
+            (unsigned long)total.live, (unsigned long)total.peak);
+    pthread_mutex_unlock(&lock);
+}
+
+#else
+
+/*ISO C forbids an empty translation unit*/
+typedef int memStatsDisabled;
+
+#endif
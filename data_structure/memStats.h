@@ -0,0 +1,49 @@
+#ifndef MEMSTATS_H
+#define MEMSTATS_H
+#include "stddef.h"
+#include "stdio.h"
+
+/* Allocation accounting, tagged by the subsystem that owns the memory.
+ * Built only with -DMEMSTATS (make MEMSTATS=1), otherwise the MEM_ macros
+ * are the plain allocator calls and nothing is counted.
+ */
+typedef enum
+{
+    MEM_LIST,
+    MEM_TRIE,
+    MEM_SYMBOL,
+    MEM_EXTERN,
+    MEM_MACRO,
+    MEM_TOKEN,
+    MEM_HASH,
+    MEM_WORDS,
+    MEM_SOURCE,
+    MEM_OTHER,
+    MEM_OWNER_COUNT
+} MemOwner;
+
+#ifdef MEMSTATS
+
+void *memStatsMalloc(MemOwner owner, size_t size);
+void *memStatsCalloc(MemOwner owner, size_t count, size_t size);
+void *memStatsRealloc(MemOwner owner, void *item, size_t size);
+void memStatsFree(void *item);
+void memStatsTake(MemOwner owner, size_t size);
+void memStatsRelease(MemOwner owner, size_t size);
+void printMemStats(FILE *file);
+
+#define MEM_MALLOC(owner, size) memStatsMalloc(owner, size)
+#define MEM_CALLOC(owner, count, size) memStatsCalloc(owner, count, size)
+#define MEM_REALLOC(owner, item, size) memStatsRealloc(owner, item, size)
+#define MEM_FREE(item) memStatsFree(item)
+
+#else
+
+#define MEM_MALLOC(owner, size) malloc(size)
+#define MEM_CALLOC(owner, count, size) calloc(count, size)
+#define MEM_REALLOC(owner, item, size) realloc(item, size)
+#define MEM_FREE(item) free(item)
+
+#endif
+
+#endif
@@ -1,4 +1,5 @@
 #include "tree.h"
+#include "memStats.h"
 #include <stdlib.h>
 
 #define BASECHAR ' '
@@ -28,7 +29,7 @@ static struct wordElement *traverseTree(struct wordElement *element, const char
 
 WordTree wordT()
 {
-    return calloc(1, sizeof(struct wordT));
+    return MEM_CALLOC(MEM_TRIE, 1, sizeof(struct wordT));
 }
 
 const char *insertWord(WordTree wordT, const char *string, void *endString)
@@ -38,7 +39,7 @@ const char *insertWord(WordTree wordT, const char *string, void *endString)
     {
         if (*iterator == NULL)
         {
-            (*iterator) = calloc(1, sizeof(struct wordElement));
+            (*iterator) = MEM_CALLOC(MEM_TRIE, 1, sizeof(struct wordElement));
             if (*iterator == NULL)
                 return NULL;
         }
@@ -61,6 +62,31 @@ void *checkIfExists(WordTree wordT, const char *string)
     return find_node == NULL ? NULL : find_node->endString;
 }
 
+static size_t subTreeMemoryUsage(const struct wordElement *element)
+{
+    size_t total = sizeof(struct wordElement);
+    int i;
+    for (i = 0; i < 95; i++)
+    {
+        if (element->next[i] != NULL)
+            total += subTreeMemoryUsage(element->next[i]);
+    }
+    return total;
+}
+
+/*Bytes held by the trie nodes, not counting allocator overhead*/
+size_t treeMemoryUsage(const WordTree wordT)
+{
+    size_t total = sizeof(struct wordT);
+    int i;
+    for (i = 0; i < 95; i++)
+    {
+        if (wordT->next[i] != NULL)
+            total += subTreeMemoryUsage(wordT->next[i]);
+    }
+    return total;
+}
+
 static void deallocSubTree(struct wordElement *element)
 {
     int i;
@@ -72,7 +98,7 @@ static void deallocSubTree(struct wordElement *element)
             element->next[i] = NULL;
         }
     }
-    free(element);
+    MEM_FREE(element);
 }
 void treeDealloc(WordTree *wordT)
 {
@@ -85,7 +111,7 @@ void treeDealloc(WordTree *wordT)
             if (t->next[i] != NULL)
                 deallocSubTree(t->next[i]);
         }
-        free(*wordT);
+        MEM_FREE(*wordT);
         (*wordT) = NULL;
     }
 }
\ No newline at end of file
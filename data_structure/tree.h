@@ -1,6 +1,7 @@
 
 #ifndef __TRIE_H_
 #define __TRIE_H_
+#include "stddef.h"
 
 typedef struct wordT *WordTree;
 
@@ -10,6 +11,8 @@ const char *insertWord(WordTree wordT, const char *string, void *endString);
 
 void *checkIfExists(WordTree wordT, const char *string);
 
+size_t treeMemoryUsage(const WordTree wordT);
+
 void treeDealloc(WordTree *wordT);
 
 #endif
\ No newline at end of file
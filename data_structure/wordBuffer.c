@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include "wordBuffer.h"
+
+#define WORDBUFFERSIZE 64
+
+struct WordBufferData
+{
+    MachineWord *words;
+    size_t capacity;
+    size_t wordCount;
+    Arena arena;
+};
+
+WordBuffer createWordBuffer(Arena arena, size_t reserve)
+{
+    WordBuffer newBuf = arenaCallocFor(arena, 1, sizeof(struct WordBufferData), MEM_WORDS);
+    if (newBuf == NULL)
+        return NULL;
+    newBuf->arena = arena;
+    if (wordBufferReserve(newBuf, reserve ? reserve : WORDBUFFERSIZE) != 0)
+    {
+        arenaFree(arena, newBuf);
+        return NULL;
+    }
+    return newBuf;
+}
+
+/*Makes room for at least wordCount words without moving them again*/
+int wordBufferReserve(WordBuffer buf, size_t wordCount)
+{
+    MachineWord *temp;
+    if (wordCount <= buf->capacity)
+        return 0;
+    temp = arenaGrowFor(buf->arena, buf->words, buf->wordCount * sizeof(MachineWord), wordCount * sizeof(MachineWord), MEM_WORDS);
+    if (temp == NULL)
+        return -1;
+    buf->words = temp;
+    buf->capacity = wordCount;
+    return 0;
+}
+
+/*Appends a word at index wordCount, returns 0 on success and -1 if the buffer could not grow*/
+int wordBufferAppend(WordBuffer buf, unsigned int word)
+{
+    if (buf->wordCount == buf->capacity && wordBufferReserve(buf, buf->capacity * 2) != 0)
+        return -1;
+    buf->words[buf->wordCount++] = (MachineWord)(word & WORD_MASK);
+    return 0;
+}
+
+unsigned int wordBufferGetWord(const WordBuffer buf, size_t index)
+{
+    return buf->words[index];
+}
+
+void wordBufferSetWord(WordBuffer buf, size_t index, unsigned int word)
+{
+    buf->words[index] = (MachineWord)(word & WORD_MASK);
+}
+
+const MachineWord *wordBufferGetWords(const WordBuffer buf)
+{
+    return buf->words;
+}
+
+size_t wordBufferGetCount(const WordBuffer buf)
+{
+    return buf->wordCount;
+}
+
+void wordBufferDealloc(WordBuffer *buf)
+{
+    if (*buf != NULL)
+    {
+        arenaFree((*buf)->arena, (*buf)->words);
+        arenaFree((*buf)->arena, *buf);
+        *buf = NULL;
+    }
+}
@@ -0,0 +1,21 @@
+#ifndef WORDBUFFER_H
+#define WORDBUFFER_H
+#include "stddef.h"
+#include "arena.h"
+
+/*A machine word is 12 bits wide, the upper bits of a MachineWord are always zero*/
+typedef unsigned short MachineWord;
+#define WORD_MASK 0xFFF
+
+typedef struct WordBufferData *WordBuffer;
+
+WordBuffer createWordBuffer(Arena arena, size_t reserve);
+int wordBufferReserve(WordBuffer buf, size_t wordCount);
+int wordBufferAppend(WordBuffer buf, unsigned int word);
+unsigned int wordBufferGetWord(const WordBuffer buf, size_t index);
+void wordBufferSetWord(WordBuffer buf, size_t index, unsigned int word);
+const MachineWord *wordBufferGetWords(const WordBuffer buf);
+size_t wordBufferGetCount(const WordBuffer buf);
+void wordBufferDealloc(WordBuffer *buf);
+
+#endif
@@ -1,9 +1,9 @@
+#define _POSIX_C_SOURCE 200112L
 #include "lexicalAnalysis.h"
 #include "limits.h"
 #include "stdio.h"
 #include "ctype.h"
 #include "string.h"
-#include "../data_structure/tree.h"
 #include "errno.h"
 #include "stdlib.h"
 
@@ -12,6 +12,8 @@
 #define MAXREG 7
 #define MINREG 0
 #define SPACECHARS " \f\n\t\r\v"
+#define STRINGIFY(x) #x
+#define TOSTRING(x) STRINGIFY(x)
 
 static void skipSpaces(char **s)
 {
@@ -22,78 +24,70 @@ static void skipSpaces(char **s)
 }
 typedef struct
 {
-    char *string;
-    char *label;
-    int data[MAXDATA];
-    int count;
-} DirectiveOperands;
-
-typedef struct
-{
+    char *labelName;
     int num;
     int reg;
-    char *labelName;
 } InstructionOperands;
 
-typedef struct
+enum
 {
-    DirectiveOperands operands;
-    enum
-    {
-        directiveExtern,
-        directiveEntry,
-        directiveString,
-        directiveData
-    } type;
-} Directive;
+    directiveExtern,
+    directiveEntry,
+    directiveString,
+    directiveData
+};
 
-typedef struct
-{
-    InstructionOperands operands[2];
-    enum
-    {
-        typeMov,
-        typeCmp,
-        typeAdd,
-        typeSub,
-        typeLea,
-        typeNot,
-        typeClr,
-        typeInc,
-        typeDec,
-        typeJmp,
-        typeBne,
-        typeRed,
-        typePrn,
-        typeJsr,
-        typeRts,
-        typeStop
-    } type;
-    enum
-    {
-        OperandOptions
-    } operandTypes[2];
-} Instruction;
+enum
+{
+    typeMov,
+    typeCmp,
+    typeAdd,
+    typeSub,
+    typeLea,
+    typeNot,
+    typeClr,
+    typeInc,
+    typeDec,
+    typeJmp,
+    typeBne,
+    typeRed,
+    typePrn,
+    typeJsr,
+    typeRts,
+    typeStop
+};
+
+/*
+ * A lexed line. The header is the same for every line, the payload holds only
+ * what the kind of line needs and getTree copies no more of it than that. Every
+ * string points into the line, so the line must outlive the token: the label,
+ * the operands, and the arguments of the error, which is formatted only when
+ * it is reported.
+ */
 
 struct TokenTree
 {
-    char errorMessage[150];
-    char label[MAXLABEL + 1];
-    enum
-    {
-        TOKEN_INSTRUCTION,
-        TOKEN_DIRECTIVE
-    } tokenType;
+    const char *label;         /* "" when the line has none */
+    const char *errorFormat;   /* NULL when the line lexed cleanly */
+    const char *errorArgs[2];
+    unsigned char tokenType;
+    unsigned char type;        /* the instruction or directive */
+    unsigned char operandTypes[2];
+    unsigned int count;        /* values in a .data payload */
     union
     {
-        Directive directive;
-        Instruction instruction;
-    } tokenData;
+        InstructionOperands operands[2];
+        const char *text; /* the .string contents, the .entry or .extern label, or the .data values */
+    } payload;
+};
+
+enum
+{
+    TOKEN_INSTRUCTION,
+    TOKEN_DIRECTIVE
 };
 
-static int isTree = 0;
-WordTree searchForInstruction = NULL;
-WordTree searchForDirective = NULL;
+#define TOKEN_HEADER_SIZE offsetof(struct TokenTree, payload)
 
 enum OperandOptions
 {
@@ -145,22 +139,99 @@ static struct directive_mapping
     {"extern", directiveExtern},
     {"entry", directiveEntry}};
 
-/* Initializes the trees used for searching for instructions and directives */
+/*
+ * Perfect hash tables for the keywords, fixed at compile time.
+ * A mnemonic is 3 or 4 characters long and hashes to
+ *     (c0 + c1 + 10 * c2 + length) & 31
+ * a directive name is 4 to 6 characters long and hashes to
+ *     (c0 + length) & 3
+ * No two keywords share a slot, so one comparison settles a lookup.
+ * A mnemonic slot keeps a copy of the name next to its index in the mapping
+ * table above, an empty slot has an empty name and index -1.
+ * Any change to the keyword set must recompute both tables.
+ */
+
+#define INSTRUCTION_SLOTS 32
+#define DIRECTIVE_SLOTS 4
+
+static const struct instruction_slot
+{
+    char name[5];
+    signed char mapping;
+} instructionSlots[INSTRUCTION_SLOTS] = {
+    {"", -1}, {"stop", 15}, {"red", 11}, {"", -1},
+    {"", -1}, {"bne", 10}, {"clr", 6}, {"rts", 14},
+    {"not", 5}, {"", -1}, {"dec", 8}, {"", -1},
+    {"", -1}, {"", -1}, {"", -1}, {"", -1},
+    {"add", 2}, {"prn", 12}, {"", -1}, {"cmp", 1},
+    {"jsr", 13}, {"", -1}, {"", -1}, {"", -1},
+    {"inc", 7}, {"", -1}, {"jmp", 9}, {"mov", 0},
+    {"", -1}, {"", -1}, {"lea", 4}, {"sub", 3}};
+
+static const signed char directiveSlots[DIRECTIVE_SLOTS] = {0, 1, 3, 2};
 
-static void lexer_wordT_init()
+/* Reads at most five characters of name and compares them with the one keyword
+ * sharing its slot. A 3 letter keyword ends with '\0' where c3 is read, and an
+ * empty slot never matches because c0 is not '\0'.
+ */
+
+static struct instruction_mapping *findInstruction(const char *name)
+{
+    const unsigned char *chars = (const unsigned char *)name;
+    const struct instruction_slot *slot;
+    unsigned int c0, c1, c2, c3, length;
+
+    if (!(c0 = chars[0]) || !(c1 = chars[1]) || !(c2 = chars[2]))
+    {
+        return NULL;
+    }
+    c3 = chars[3];
+    if (c3 && chars[4])
+    {
+        return NULL;
+    }
+    length = c3 ? 4 : 3;
+    slot = &instructionSlots[(c0 + c1 + 10 * c2 + length) & (INSTRUCTION_SLOTS - 1)];
+    if ((unsigned char)slot->name[0] != c0 || (unsigned char)slot->name[1] != c1 ||
+        (unsigned char)slot->name[2] != c2 || (unsigned char)slot->name[3] != c3)
+    {
+        return NULL;
+    }
+    return &instruction_mapping[slot->mapping];
+}
+
+static struct directive_mapping *findDirective(const char *name)
 {
-    int i;
-    searchForInstruction = wordT();
-    searchForDirective = wordT();
-    for (i = 0; i < 16; i++)
+    size_t length = 0;
+    int slot;
+    while (length <= 6 && name[length] != '\0')
     {
-        insertWord(searchForInstruction, instruction_mapping[i].instructionName, &instruction_mapping[i]);
+        length++;
+    }
+    if (length < 4 || length > 6)
+    {
+        return NULL;
     }
-    for (i = 0; i < 4; i++)
+    slot = directiveSlots[((unsigned char)name[0] + length) & (DIRECTIVE_SLOTS - 1)];
+    if (strcmp(directive_mapping[slot].directiveName, name) != 0)
     {
-        insertWord(searchForDirective, directive_mapping[i].directiveName, &directive_mapping[i]);
+        return NULL;
     }
-    isTree = 1;
+    return &directive_mapping[slot];
+}
+
+/* Keyword lookups for callers outside the lexer, -1 when the name is not a keyword */
+
+int lookupInstruction(const char *name)
+{
+    struct instruction_mapping *instMap = findInstruction(name);
+    return instMap ? instMap->key : -1;
+}
+
+int lookupDirective(const char *name)
+{
+    struct directive_mapping *directiveMap = findDirective(name);
+    return directiveMap ? directiveMap->key : -1;
 }
 
 /* Enum representing the type of label */
@@ -172,19 +243,16 @@ enum labelType
     labelContainsNumbers,
     labelTooLong
 };
-/* Reports errors related to directives by formatting the error message and storing it in the token tree */
+/* Records an error for the line. Its text is only formatted if the error is reported,
+ * so a line that lexes cleanly costs no more than a NULL. A later error replaces an earlier one. */
 
-static void reportDirError(TokenTree *myTree, const char *format, const char *arg1, const char *arg2)
+static void reportError(TokenTree *myTree, const char *format, const char *arg1, const char *arg2)
 {
-    sprintf(myTree->errorMessage, format, arg1, arg2);
+    myTree->errorFormat = format;
+    myTree->errorArgs[0] = arg1;
+    myTree->errorArgs[1] = arg2;
 }
 
-/* Reports errors related to instructions by formatting the error message and storing it in the token tree */
-
-static void reportInstError(TokenTree *myTree, const char *format, const char *arg)
-{
-    sprintf(myTree->errorMessage, format, arg);
-}
 static enum labelType checkLabel(const char *label)
 {
 
@@ -346,83 +414,83 @@ static void handleTwoOperands(TokenTree *myTree, char *operandString, struct ins
     char *extra = strchr(seperator + 1, ',');
     if (extra)
     {
-        reportInstError(myTree, "extra comma in operands", NULL);
+        reportError(myTree, "extra comma in operands", NULL, NULL);
         return;
     }
     if (instMap->sourceOpOptions == OP_OPTION_NULL)
     {
-        reportInstError(myTree, "two operands for instruction '%s'", instMap->instructionName);
+        reportError(myTree, "two operands for instruction '%s'", instMap->instructionName, NULL);
         return;
     }
     *seperator = '\0';
-    operandOption = parseOperands(operandString, &myTree->tokenData.instruction.operands[0].labelName, &myTree->tokenData.instruction.operands[0].num, &myTree->tokenData.instruction.operands[0].reg);
+    operandOption = parseOperands(operandString, &myTree->payload.operands[0].labelName, &myTree->payload.operands[0].num, &myTree->payload.operands[0].reg);
     if (operandOption == OP_OPTION_NULL)
     {
-        reportInstError(myTree, "Invalid operand: '%s'", operandString);
+        reportError(myTree, "Invalid operand: '%s'", operandString, NULL);
         return;
     }
     if (operandOption == OP_OPTION_OVERFLOW)
     {
-        reportInstError(myTree, "operand overflow: '%s' source", operandString);
+        reportError(myTree, "operand overflow: '%s' source", operandString, NULL);
         return;
     }
     if (operandOption == OP_OPTION_MISSING)
     {
-        reportInstError(myTree, " no operand for source", NULL);
+        reportError(myTree, " no operand for source", NULL, NULL);
         return;
     }
 
     if (instMap->sourceOpOptions == OP_OPTION_NULL)
     {
-        reportInstError(myTree, "Unsupported source operand: '%s'", operandString);
+        reportError(myTree, "Unsupported source operand: '%s'", operandString, NULL);
         return;
     }
     switch (operandOption)
     {
     case OP_OPTION_IMMEDIATE:
-        myTree->tokenData.instruction.operandTypes[0] = OP_OPTION_IMMEDIATE;
+        myTree->operandTypes[0] = OP_OPTION_IMMEDIATE;
         break;
     case OP_OPTION_REG_NUMBER:
-        myTree->tokenData.instruction.operandTypes[0] = OP_OPTION_REG_NUMBER;
+        myTree->operandTypes[0] = OP_OPTION_REG_NUMBER;
         break;
     default:
-        myTree->tokenData.instruction.operandTypes[0] = OP_OPTION_LABEL;
+        myTree->operandTypes[0] = OP_OPTION_LABEL;
         break;
     }
 
     operandString = seperator + 1;
-    operandOption = parseOperands(operandString, &myTree->tokenData.instruction.operands[1].labelName, &myTree->tokenData.instruction.operands[1].num, &myTree->tokenData.instruction.operands[1].reg);
+    operandOption = parseOperands(operandString, &myTree->payload.operands[1].labelName, &myTree->payload.operands[1].num, &myTree->payload.operands[1].reg);
     if (operandOption == OP_OPTION_NULL)
     {
-        reportInstError(myTree, "bad operand for destination: '%s'", operandString);
+        reportError(myTree, "bad operand for destination: '%s'", operandString, NULL);
         return;
     }
     if (operandOption == OP_OPTION_OVERFLOW)
     {
-        reportInstError(myTree, "operand overflow for destination: '%s'", operandString);
+        reportError(myTree, "operand overflow for destination: '%s'", operandString, NULL);
         return;
     }
     if (operandOption == OP_OPTION_MISSING)
     {
-        reportInstError(myTree, "no operand for destination", NULL);
+        reportError(myTree, "no operand for destination", NULL, NULL);
         return;
     }
 
     if (instMap->destOpOptions == OP_OPTION_NULL)
     {
-        reportInstError(myTree, "null destination operand: '%s'", operandString);
+        reportError(myTree, "null destination operand: '%s'", operandString, NULL);
         return;
     }
     switch (operandOption)
     {
     case OP_OPTION_IMMEDIATE:
-        myTree->tokenData.instruction.operandTypes[1] = OP_OPTION_IMMEDIATE;
+        myTree->operandTypes[1] = OP_OPTION_IMMEDIATE;
         break;
     case OP_OPTION_REG_NUMBER:
-        myTree->tokenData.instruction.operandTypes[1] = OP_OPTION_REG_NUMBER;
+        myTree->operandTypes[1] = OP_OPTION_REG_NUMBER;
         break;
     default:
-        myTree->tokenData.instruction.operandTypes[1] = OP_OPTION_LABEL;
+        myTree->operandTypes[1] = OP_OPTION_LABEL;
         break;
     }
 }
@@ -432,43 +500,43 @@ static void handleOneOperand(TokenTree *myTree, char *operandString, struct inst
     char operandOption;
     if (instMap->sourceOpOptions != OP_OPTION_NULL)
     {
-        reportInstError(myTree, "Expected a comma separator for instruction '%s'", instMap->instructionName);
+        reportError(myTree, "Expected a comma separator for instruction '%s'", instMap->instructionName, NULL);
         return;
     }
-    operandOption = parseOperands(operandString, &myTree->tokenData.instruction.operands[1].labelName, &myTree->tokenData.instruction.operands[1].num, &myTree->tokenData.instruction.operands[1].reg);
+    operandOption = parseOperands(operandString, &myTree->payload.operands[1].labelName, &myTree->payload.operands[1].num, &myTree->payload.operands[1].reg);
     if (operandOption != OP_OPTION_MISSING && instMap->destOpOptions == OP_OPTION_NULL)
     {
-        reportInstError(myTree, "Instruction '%s' should not have operands", instMap->instructionName);
+        reportError(myTree, "Instruction '%s' should not have operands", instMap->instructionName, NULL);
         return;
     }
     if (operandOption == OP_OPTION_MISSING)
     {
-        reportInstError(myTree, "Expected operand missing for instruction '%s'", instMap->instructionName);
+        reportError(myTree, "Expected operand missing for instruction '%s'", instMap->instructionName, NULL);
         return;
     }
     if (operandOption == OP_OPTION_OVERFLOW)
     {
-        reportInstError(myTree, "Operand overflow in destination: '%s'", operandString);
+        reportError(myTree, "Operand overflow in destination: '%s'", operandString, NULL);
         return;
     }
     if (operandOption == OP_OPTION_NULL)
     {
-        reportInstError(myTree, "Invalid destination operand: '%s'", operandString);
+        reportError(myTree, "Invalid destination operand: '%s'", operandString, NULL);
         return;
     }
     if (instMap->destOpOptions == OP_OPTION_NULL)
     {
-        reportInstError(myTree, "Unsupported destination operand: '%s'", operandString);
+        reportError(myTree, "Unsupported destination operand: '%s'", operandString, NULL);
         return;
     }
     switch (operandOption)
     {
     case OP_OPTION_IMMEDIATE:
     case OP_OPTION_REG_NUMBER:
-        myTree->tokenData.instruction.operandTypes[1] = operandOption;
+        myTree->operandTypes[1] = operandOption;
         break;
     default:
-        myTree->tokenData.instruction.operandTypes[1] = OP_OPTION_LABEL;
+        myTree->operandTypes[1] = OP_OPTION_LABEL;
         break;
     }
 }
@@ -487,7 +555,7 @@ static void parseInstructions(TokenTree *myTree, char *operandString, struct ins
     {
         if (instMap->destOpOptions != OP_OPTION_NULL)
         {
-            reportInstError(myTree, "INSTRUCTION '%s' expected one operand", instMap->instructionName);
+            reportError(myTree, "INSTRUCTION '%s' expected one operand", instMap->instructionName, NULL);
             return;
         }
         return;
@@ -508,10 +576,13 @@ static void parseInstructions(TokenTree *myTree, char *operandString, struct ins
 
 static void handleEntryDirective(TokenTree *myTree, char *operandString, struct directive_mapping *directiveMap)
 {
-    if (parseOperands(operandString, &myTree->tokenData.directive.operands.label, NULL, NULL) != OP_OPTION_LABEL)
+    char *label = NULL;
+
+    if (parseOperands(operandString, &label, NULL, NULL) != OP_OPTION_LABEL)
     {
-        reportDirError(myTree, "DIRECTIVE '%s' has an invalid operand '%s'", directiveMap->directiveName, operandString);
+        reportError(myTree, "DIRECTIVE '%s' has an invalid operand '%s'", directiveMap->directiveName, operandString);
     }
+    myTree->payload.text = label;
 } /*
    * This function handles the string directive.
    * It parses and validates the string operand of the directive and reports errors in case of invalid operand.
@@ -525,33 +596,35 @@ static void handleStringDirective(TokenTree *myTree, char *operandString, struct
     seperator = strchr(operandString, '"');
     if (!seperator)
     {
-        reportDirError(myTree, "DIRECTIVE: '%s' has no opening '\"': '%s'.", directiveMap->directiveName, operandString);
+        reportError(myTree, "DIRECTIVE: '%s' has no opening '\"': '%s'.", directiveMap->directiveName, operandString);
     }
     seperator++;
     seperator2 = strrchr(seperator, '"');
     if (!seperator2)
     {
-        reportDirError(myTree, "DIRECTIVE: '%s' has no closing '\"': '%s", directiveMap->directiveName, operandString);
+        reportError(myTree, "DIRECTIVE: '%s' has no closing '\"': '%s", directiveMap->directiveName, operandString);
     }
     *seperator2 = '\0';
     seperator2++;
     skipSpaces(&seperator2);
     if (*seperator2 != '\0')
     {
-        reportDirError(myTree, "DIRECTIVE: '%s' has extra text after its string: '%s", directiveMap->directiveName, seperator2);
+        reportError(myTree, "DIRECTIVE: '%s' has extra text after its string: '%s", directiveMap->directiveName, seperator2);
     }
-    myTree->tokenData.directive.operands.string = seperator;
+    myTree->payload.text = seperator;
 }
 /*
  * This function handles the data directive.
  * It parses and validates the numeric operands of the directive and reports errors in case of invalid operands.
+ * The values are only counted, the token keeps them as the span of the line they were read from.
  */
 
 static void handleDataDirective(TokenTree *myTree, char *operandString, struct directive_mapping *directiveMap)
 {
     char *seperator;
-    int num_count = 0;
     int curr_num;
+
+    myTree->payload.text = operandString;
     do
     {
         seperator = strchr(operandString, ',');
@@ -560,22 +633,23 @@ static void handleDataDirective(TokenTree *myTree, char *operandString, struct d
         switch (parseOperands(operandString, NULL, &curr_num, NULL))
         {
         case OP_OPTION_IMMEDIATE:
-            myTree->tokenData.directive.operands.data[num_count] = curr_num;
-            num_count++;
-            myTree->tokenData.directive.operands.count = num_count;
+            myTree->count++;
             break;
         case OP_OPTION_OVERFLOW:
-            reportDirError(myTree, "DIRECTIVE :'%s overflowed number :'%s'", directiveMap->directiveName, operandString);
+            reportError(myTree, "DIRECTIVE :'%s overflowed number :'%s'", directiveMap->directiveName, operandString);
             return;
         case OP_OPTION_MISSING:
-            reportDirError(myTree, "DIRECTIVE :'%s expected a number", directiveMap->directiveName, "");
+            reportError(myTree, "DIRECTIVE :'%s expected a number", directiveMap->directiveName, "");
             break;
         default:
-            reportDirError(myTree, "DIRECTIVE :'%s got no number :'%s'", directiveMap->directiveName, operandString);
+            reportError(myTree, "DIRECTIVE :'%s got no number :'%s'", directiveMap->directiveName, operandString);
             break;
         }
         if (seperator)
         {
+            /*The span is read again, so the comma goes back unless the value before it is an error's argument*/
+            if (myTree->errorFormat == NULL)
+                *seperator = ',';
             operandString = seperator + 1;
         }
         else
@@ -603,22 +677,30 @@ static void parseDirective(TokenTree *myTree, char *operandString, struct direct
     }
 }
 /*
- * This function creates a `TokenTree` structure, identifies the type of token
- * (directive or instruction), parses it, and returns the `TokenTree` structure.
+ * Clears what a previous line left in a reused `TokenTree`.
+ */
+
+static void resetTokenTree(TokenTree *myTree)
+{
+    memset(myTree, 0, sizeof(TokenTree));
+    myTree->label = "";
+}
+
+/*
+ * This function fills a caller-owned `TokenTree` structure in place, identifies the type
+ * of token (directive or instruction) and parses it. Nothing is allocated, so one token
+ * can be reused for every line of a file. The token points into sentenceLine, which
+ * must outlive it.
  */
 
-TokenTree *getTree(char *sentenceLine)
+void fillTokenTree(TokenTree *myTree, char *sentenceLine)
 {
     enum labelType labelType = 0;
-    TokenTree *myTree = (TokenTree *)malloc(sizeof(TokenTree));
     struct instruction_mapping *instMap = NULL;
     struct directive_mapping *directiveMap = NULL;
 
     char *extra, *extra2;
-    if (!isTree)
-    {
-        lexer_wordT_init();
-    }
+    resetTokenTree(myTree);
     sentenceLine[strcspn(sentenceLine, "\r\n")] = 0;
     skipSpaces(&sentenceLine);
     extra = strchr(sentenceLine, ':');
@@ -627,36 +709,36 @@ TokenTree *getTree(char *sentenceLine)
         extra2 = strchr(extra + 1, ':');
         if (extra2)
         {
-            strcpy(myTree->errorMessage, "the token ':' appears twice in this line");
-            return myTree;
+            reportError(myTree, "the token ':' appears twice in this line", NULL, NULL);
+            return;
         }
         (*extra) = '\0';
         switch (checkLabel(sentenceLine))
         {
         case labelStartsWithoutChar:
-            sprintf(myTree->errorMessage, "label:'%s' missing alpha", sentenceLine);
+            reportError(myTree, "label:'%s' missing alpha", sentenceLine, NULL);
             break;
         case labelContainsNumbers:
-            sprintf(myTree->errorMessage, "label:'%s' contains numbers", sentenceLine);
+            reportError(myTree, "label:'%s' contains numbers", sentenceLine, NULL);
             break;
         case labelTooLong:
-            sprintf(myTree->errorMessage, "label:'%s' is too long : %d", sentenceLine, MAXLABEL);
+            reportError(myTree, "label:'%s' is too long : " TOSTRING(MAXLABEL), sentenceLine, NULL);
             break;
         case correctLabel:
-            strcpy(myTree->label, sentenceLine);
+            myTree->label = sentenceLine;
             break;
         }
         if (labelType != correctLabel)
         {
-            return myTree;
+            return;
         }
         sentenceLine = extra + 1;
         skipSpaces(&sentenceLine);
     }
     if (*sentenceLine == '\0' && myTree->label[0] != '\0')
     {
-        sprintf(myTree->errorMessage, "empty line: '%s'", myTree->label);
-        return myTree;
+        reportError(myTree, "empty line: '%s'", myTree->label, NULL);
+        return;
     }
     extra = strpbrk(sentenceLine, SPACECHARS);
     if (extra)
@@ -668,26 +750,56 @@ TokenTree *getTree(char *sentenceLine)
 
     if (*sentenceLine == '.')
     {
-        directiveMap = checkIfExists(searchForDirective, sentenceLine + 1);
+        directiveMap = findDirective(sentenceLine + 1);
         if (!directiveMap)
         {
-            sprintf(myTree->errorMessage, "directive is unknown :'%s'", sentenceLine + 1);
-            return myTree;
+            reportError(myTree, "directive is unknown :'%s'", sentenceLine + 1, NULL);
+            return;
         }
         myTree->tokenType = TOKEN_DIRECTIVE;
-        myTree->tokenData.directive.type = directiveMap->key;
+        myTree->type = directiveMap->key;
         parseDirective(myTree, extra, directiveMap);
-        return myTree;
+        return;
     }
-    instMap = checkIfExists(searchForInstruction, sentenceLine);
+    instMap = findInstruction(sentenceLine);
     if (!instMap)
     {
-        sprintf(myTree->errorMessage, "keyword is unknown '%s'", sentenceLine);
-        return myTree;
+        reportError(myTree, "keyword is unknown '%s'", sentenceLine, NULL);
+        return;
     }
     myTree->tokenType = TOKEN_INSTRUCTION;
-    myTree->tokenData.instruction.type = instMap->key;
+    myTree->type = instMap->key;
     parseInstructions(myTree, extra, instMap);
+}
+
+/* Bytes of a filled token that are ever read back: only the header for an error,
+ * rts or stop, one pointer for a directive, and both operands for other instructions */
+
+static size_t tokenTreeSize(const TokenTree *myTree)
+{
+    if (myTree->errorFormat != NULL || (myTree->tokenType == TOKEN_INSTRUCTION && myTree->type >= typeRts))
+        return TOKEN_HEADER_SIZE;
+    if (myTree->tokenType == TOKEN_DIRECTIVE)
+        return TOKEN_HEADER_SIZE + sizeof(const char *);
+    return sizeof(TokenTree);
+}
+
+/*
+ * This function lexes the line and keeps the resulting `TokenTree` in the given arena,
+ * trimmed to the bytes its kind of line uses.
+ */
+
+TokenTree *getTree(char *sentenceLine, Arena arena)
+{
+    TokenTree filled;
+    TokenTree *myTree;
+    size_t size;
+
+    fillTokenTree(&filled, sentenceLine);
+    size = tokenTreeSize(&filled);
+    myTree = (TokenTree *)arenaAllocFor(arena, size, MEM_TOKEN);
+    if (myTree)
+        memcpy(myTree, &filled, size);
     return myTree;
 }
 
@@ -714,96 +826,99 @@ void setTokenTreeOptions(TokenTree *tree, int options)
 
 int getTokenTreeDirectiveOptions(const TokenTree *tree)
 {
-    return tree->tokenData.directive.type;
+    return tree->type;
 }
 
 void setTokenTreeDirectiveOptions(TokenTree *tree, int directiveOptions)
 {
-    tree->tokenData.directive.type = directiveOptions;
+    tree->type = directiveOptions;
 }
 
 const char *getTokenTreeDirectiveOperandsString(const TokenTree *tree)
 {
-    return tree->tokenData.directive.operands.string;
+    return tree->payload.text;
 }
 
 const char *getTokenTreeDirectiveOperandsLabel(const TokenTree *tree)
 {
-    return tree->tokenData.directive.operands.label;
-}
-
-int getTokenTreeDirectiveOperandsDataData(const TokenTree *tree, size_t index)
-{
-    return tree->tokenData.directive.operands.data[index];
+    return tree->payload.text;
 }
 
-void setTokenTreeDirectiveOperandsDataData(TokenTree *tree, size_t index, int value)
+const char *getTokenTreeDirectiveOperandsData(const TokenTree *tree)
 {
-    tree->tokenData.directive.operands.data[index] = value;
+    return tree->payload.text;
 }
 
 int getTokenTreeDirectiveOperandsDataCount(const TokenTree *tree)
 {
-    return tree->tokenData.directive.operands.count;
+    return tree->count;
 }
 
-void setTokenTreeDirectiveOperandsDataCount(TokenTree *tree, int count)
+/* Reads the .data value at *values and moves *values past the comma that follows it.
+ * Only for the span of a token that lexed cleanly, which holds count valid numbers. */
+
+int nextTokenTreeDataValue(const char **values)
 {
-    tree->tokenData.directive.operands.count = count;
+    char *end;
+    long value = strtol(*values, &end, 10);
+    const char *comma = strchr(end, ',');
+
+    *values = comma ? comma + 1 : end + strlen(end);
+    return (int)value;
 }
 
 int getTokenTreeInstructionType(const TokenTree *tree)
 {
-    return tree->tokenData.instruction.type;
+    return tree->type;
 }
 
 void setTokenTreeInstructionType(TokenTree *tree, int instructionType)
 {
-    tree->tokenData.instruction.type = instructionType;
+    tree->type = instructionType;
 }
 
 int getTokenTreeInstructionsOperandsOptions(const TokenTree *tree, size_t index)
 {
-    return tree->tokenData.instruction.operandTypes[index];
+    return tree->operandTypes[index];
 }
 
 void setTokenTreeInstructionsOperandsOptions(TokenTree *tree, size_t index, int option)
 {
-    tree->tokenData.instruction.operandTypes[index] = option;
+    tree->operandTypes[index] = option;
 }
 
 int getTokenTreeInstructionsOperandsNum(const TokenTree *tree, size_t index)
 {
-    return tree->tokenData.instruction.operands[index].num;
+    return tree->payload.operands[index].num;
 }
 
 void setTokenTreeInstructionsOperandsNum(TokenTree *tree, size_t index, int num)
 {
-    tree->tokenData.instruction.operands[index].num = num;
+    tree->payload.operands[index].num = num;
 }
 
 int getTokenTreeInstructionsOperandsReg(const TokenTree *tree, size_t index)
 {
-    return tree->tokenData.instruction.operands[index].reg;
+    return tree->payload.operands[index].reg;
 }
 
 void setTokenTreeInstructionsOperandsReg(TokenTree *tree, size_t index, int reg)
 {
-    tree->tokenData.instruction.operands[index].reg = reg;
+    tree->payload.operands[index].reg = reg;
 }
 
 const char *getTokenTreeInstructionsOperandsLabelName(const TokenTree *tree, size_t index)
 {
-    return tree->tokenData.instruction.operands[index].labelName;
+    return tree->payload.operands[index].labelName;
 }
 
 TokenTree *createTokenTree()
 {
-    return calloc(1, sizeof(TokenTree));
+    return MEM_CALLOC(MEM_TOKEN, 1, sizeof(TokenTree));
 }
 void destoryTokenTree(struct TokenTree *TokenTree)
 {
-    free(TokenTree);
+    MEM_FREE(TokenTree);
 }
 
 int getTypeMov(void) { return typeMov; }
@@ -835,23 +950,30 @@ const char *getTokenTreeLabel(const TokenTree *tree)
     return tree->label;
 }
 
+/* The token keeps the pointer, the label must outlive it like the line does */
+
 void setTokenTreeLabel(TokenTree *tree, const char *label)
 {
     if (tree == NULL || label == NULL)
     {
         return;
     }
-    strncpy(tree->label, label, MAXLABEL);
-    tree->label[MAXLABEL] = '\0';
+    tree->label = label;
 }
 
-const char *getTokenTreeErrorMessage(const TokenTree *tree)
+/*
+ * Formats the error of the line into buffer, cut to size characters with the '\0'.
+ * Returns 0 and leaves buffer alone when the line lexed cleanly.
+ */
+
+int formatTokenTreeError(const TokenTree *tree, char *buffer, size_t size)
 {
-    if (tree == NULL)
+    if (tree == NULL || tree->errorFormat == NULL)
     {
-        return NULL;
+        return 0;
     }
-    return tree->errorMessage;
+    snprintf(buffer, size, tree->errorFormat, tree->errorArgs[0], tree->errorArgs[1]);
+    return 1;
 }
 
 void setTokenTreeErrorMessage(TokenTree *tree, const char *errorMessage)
@@ -860,8 +982,7 @@ void setTokenTreeErrorMessage(TokenTree *tree, const char *errorMessage)
     {
         return;
     }
-    strncpy(tree->errorMessage, errorMessage, sizeof(tree->errorMessage) - 1);
-    tree->errorMessage[sizeof(tree->errorMessage) - 1] = '\0';
+    reportError(tree, "%s", errorMessage, NULL);
 }
 
 int getDirective(void)
@@ -889,11 +1010,3 @@ int getOperandNull(void)
 {
     return OP_OPTION_NULL;
 }
-void treeDestroy(TokenTree *myTree)
-{
-    if (myTree == NULL)
-    {
-        return;
-        free(myTree);
-    }
-}
\ No newline at end of file
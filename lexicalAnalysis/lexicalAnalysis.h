@@ -1,15 +1,17 @@
 #ifndef _lexicalAnalysis_H_
 #define _lexicalAnalysis_H_
-#define MAXDATA 90
 #define MAXLABEL 31
+/* Room for any error message of a line, lines are at most 80 characters */
+#define MAXERROR 150
 
 #include "stddef.h"
+#include "../data_structure/arena.h"
 typedef struct TokenTree TokenTree;
 struct TokenTree *createTokenTree();
 
 const char *getTokenTreeLabel(const TokenTree *tree);
 void setTokenTreeLabel(TokenTree *tree, const char *label);
-const char *getTokenTreeErrorMessage(const TokenTree *tree);
+int formatTokenTreeError(const TokenTree *tree, char *buffer, size_t size);
 void setTokenTreeErrorMessage(TokenTree *tree, const char *errorMessage);
 int getTokenTreeOptions(const TokenTree *tree);
 void setTokenTreeOptions(TokenTree *tree, int options);
@@ -22,11 +24,9 @@ void setTokenTreeDirectiveOperandsString(TokenTree *tree, const char *str);
 const char *getTokenTreeDirectiveOperandsLabel(const TokenTree *tree);
 void setTokenTreeDirectiveOperandsLabel(TokenTree *tree, const char *label);
 
-int getTokenTreeDirectiveOperandsDataData(const TokenTree *tree, size_t index);
-void setTokenTreeDirectiveOperandsDataData(TokenTree *tree, size_t index, int value);
-
+const char *getTokenTreeDirectiveOperandsData(const TokenTree *tree);
 int getTokenTreeDirectiveOperandsDataCount(const TokenTree *tree);
-void setTokenTreeDirectiveOperandsDataCount(TokenTree *tree, int count);
+int nextTokenTreeDataValue(const char **values);
 
 int getTokenTreeInstructionType(const TokenTree *tree);
 void setTokenTreeInstructionType(TokenTree *tree, int instructionType);
@@ -69,7 +69,9 @@ int getOperandRegisterNumber(void);
 int getOperandLabel(void);
 int getOperandNumber(void);
 int getOperandNull(void);
-TokenTree *getTree(char *line);
-void treeDestroy(TokenTree *myTree);
+int lookupInstruction(const char *name);
+int lookupDirective(const char *name);
+void fillTokenTree(TokenTree *tree, char *line);
+TokenTree *getTree(char *line, Arena arena);
 
 #endif
\ No newline at end of file
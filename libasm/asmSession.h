@@ -0,0 +1,27 @@
+#ifndef ASM_SESSION_H
+#define ASM_SESSION_H
+#include "stdio.h"
+#include "libasm.h"
+#include "../data_structure/arena.h"
+#include "../preAssembly/sourceFile.h"
+#include "../assembler/stats.h"
+#include "../assembler/trace.h"
+
+/* What the command line adds around an assembly: the stream the
+ * diagnostics are printed to, the .am file, and the file's stats and
+ * trace. Any of them may be NULL. */
+typedef struct AsmSession
+{
+    FILE *diagnostics;
+    FILE *expandedFile;
+    FileStats *stats;
+    const FileTrace *trace;
+} AsmSession;
+
+/* Releases the previous result and returns the arena the next source is read into */
+Arena asmBeginAssembly(AsmAssembler *assembler);
+
+/* Returns 0 once result is filled in, assembled or not, and -1 if memory ran out */
+int asmAssembleSource(AsmAssembler *assembler, SourceFile source, const AsmSession *session, AsmResult *result);
+
+#endif
@@ -0,0 +1,253 @@
+#include "libasm.h"
+#include "asmSession.h"
+#include "../assembler/firstPass.h"
+#include "../assembler/secondPass.h"
+#include "../preAssembly/preAssembler.h"
+#include "../structs/code.h"
+#include "../structs/diagnostics.h"
+#include "../structs/external.h"
+#include "../structs/symbol.h"
+#include "stdlib.h"
+#include "string.h"
+
+/* Size of the regular blocks of a handle's arena */
+#define ASM_ARENA_BLOCK 65536
+
+struct AsmAssembler
+{
+    Arena arena;
+    FirstPass *pass;
+};
+
+/**
+ * Creates a handle with its own arena and first pass state, both kept warm
+ * from one source to the next.
+ *
+ * @return The new handle, or NULL if it could not be allocated.
+ */
+
+AsmAssembler *asmCreate(void)
+{
+    AsmAssembler *assembler = calloc(1, sizeof(AsmAssembler));
+    if (assembler == NULL)
+        return NULL;
+    assembler->arena = createArena(ASM_ARENA_BLOCK);
+    assembler->pass = createFirstPass();
+    if (!assembler->arena || !assembler->pass)
+    {
+        asmDestroy(assembler);
+        return NULL;
+    }
+    return assembler;
+}
+
+void asmDestroy(AsmAssembler *assembler)
+{
+    if (assembler != NULL)
+    {
+        destroyFirstPass(assembler->pass);
+        arenaDealloc(&assembler->arena);
+        free(assembler);
+    }
+}
+
+Arena asmBeginAssembly(AsmAssembler *assembler)
+{
+    arenaReset(assembler->arena);
+    return assembler->arena;
+}
+
+/**
+ * Collects the entry symbols, in the order they were defined.
+ *
+ * @return 0, or -1 if the array could not be allocated.
+ */
+
+static int collectEntries(const CodeFile *codeFile, Arena arena, AsmResult *result)
+{
+    List symbolTable = getCodeFileSymbolTable(codeFile);
+    AsmSymbolAddress *entries;
+    void *const *begin;
+    void *const *end;
+    size_t count = 0;
+
+    entries = arenaAlloc(arena, (getCodeFileEntriesNumber(codeFile) + 1) * sizeof(AsmSymbolAddress));
+    if (!entries)
+        return -1;
+    for (begin = listGetBegin(symbolTable), end = listGetItemsEnd(symbolTable); begin < end; begin++)
+    {
+        const struct symbol *symVar = *begin;
+        if (symVar && getSymbolType(symVar) >= getSymEntryCodeType())
+        {
+            entries[count].name = getSymbolName(symVar);
+            entries[count].address = getSymbolAdr(symVar);
+            count++;
+        }
+    }
+    result->entries = entries;
+    result->entryCount = count;
+    return 0;
+}
+
+/**
+ * Collects the extern call sites grouped by extern, with a stable counting
+ * sort on the extern id: externs appear in the order of their first
+ * reference and each one's addresses in the order they were recorded.
+ *
+ * @return 0, or -1 if the arrays could not be allocated.
+ */
+
+static int collectExterns(const CodeFile *codeFile, Arena arena, AsmResult *result)
+{
+    const ExternTable externs = getCodeFileExterns(codeFile);
+    size_t referenceCount = externTableGetCount(externs);
+    unsigned int symbolCount = externTableGetSymbolCount(externs);
+    size_t *groupEnd = arenaCalloc(arena, symbolCount + 1, sizeof(size_t));
+    AsmSymbolAddress *uses = arenaAlloc(arena, (referenceCount + 1) * sizeof(AsmSymbolAddress));
+    AsmSymbolAddress *use;
+    size_t i;
+    unsigned int id;
+
+    if (!groupEnd || !uses)
+        return -1;
+    /*groupEnd[id] starts as the first slot of extern id+1 and ends as the one past it*/
+    for (i = 0; i < referenceCount; i++)
+        groupEnd[externTableGetId(externs, i)]++;
+    for (id = 1; id <= symbolCount; id++)
+        groupEnd[id] += groupEnd[id - 1];
+    for (i = 0; i < referenceCount; i++)
+    {
+        id = externTableGetId(externs, i);
+        use = &uses[groupEnd[id - 1]++];
+        use->name = getSymbolName(externTableGetSymbol(externs, id));
+        use->address = externTableGetCallAddress(externs, i);
+    }
+    arenaFree(arena, groupEnd);
+    result->externs = uses;
+    result->externCount = referenceCount;
+    return 0;
+}
+
+/*Copies the recorded diagnostics out in the library's own types*/
+static int collectDiagnostics(const Diagnostics diagnostics, Arena arena, AsmResult *result)
+{
+    size_t count = diagnosticsGetCount(diagnostics);
+    AsmDiagnostic *items = arenaAlloc(arena, (count + 1) * sizeof(AsmDiagnostic));
+    const Diagnostic *diagnostic;
+    size_t i;
+
+    if (!items)
+        return -1;
+    for (i = 0; i < count; i++)
+    {
+        diagnostic = diagnosticsGet(diagnostics, i);
+        items[i].severity = diagnostic->severity == DIAGNOSTIC_WARNING ? ASM_WARNING : ASM_ERROR;
+        items[i].line = diagnostic->line;
+        items[i].message = diagnostic->message;
+    }
+    result->diagnostics = items;
+    result->diagnosticCount = count;
+    return 0;
+}
+
+/**
+ * Assembles one source held in the handle's arena. The preprocessor streams
+ * the expanded source straight into the first pass, then the second pass
+ * runs if the first one succeeded and no line was too long to assemble.
+ * The symbol, extern and fixup tables, and everything the result points
+ * to, come from the handle's arena and live until it is reset.
+ *
+ * @param assembler The handle, asmBeginAssembly was called for this source.
+ * @param source The source, read into the arena asmBeginAssembly returned.
+ * @param session Where diagnostics, the expanded source, stats and trace go.
+ * @param result Receives the images, entries, externs and diagnostics.
+ *
+ * @return Returns 0 once result is filled in, and -1 if memory ran out.
+ */
+
+int asmAssembleSource(AsmAssembler *assembler, SourceFile source, const AsmSession *session, AsmResult *result)
+{
+    Arena arena = assembler->arena;
+    FileStats *stats = session->stats;
+    const FileTrace *trace = session->trace;
+    Diagnostics diagnostics;
+    CodeFile *currObj;
+    int firstPassResult, secondPassResult = 0;
+    int longLines;
+    double passStart, phaseStart;
+    PreprocessSink sink;
+
+    memset(result, 0, sizeof(AsmResult));
+    diagnostics = createDiagnostics(arena, session->diagnostics);
+    currObj = newCodeFile(arena);
+    if (!diagnostics || !currObj)
+        return -1;
+    setCodeFileDiagnostics(currObj, diagnostics);
+    setCodeFileStats(currObj, stats);
+    setCodeFileTrace(currObj, trace);
+    passStart = traceStart(trace);
+    firstPassBegin(assembler->pass, currObj);
+
+    sink.line = firstPassLine;
+    sink.token = firstPassToken;
+    sink.context = assembler->pass;
+    phaseStart = traceStart(trace);
+    statsEnter(stats, PHASE_PREPROCESS);
+    longLines = preprocess(source, arena, diagnostics, session->expandedFile, &sink, stats);
+    statsLeave(stats);
+    traceSpan(trace, "preprocess", phaseStart, "lines", stats ? stats->counters[COUNT_LINES] : 0);
+
+    /*The preprocessor streams into the first pass, so its span contains the preprocess one*/
+    firstPassResult = firstPassEnd(assembler->pass);
+    traceSpan(trace, "firstPass", passStart, "lines", stats ? stats->counters[COUNT_LINES] : 0);
+    if (firstPassResult == 1 && longLines == 0)
+    {
+        phaseStart = traceStart(trace);
+        statsEnter(stats, PHASE_SECOND_PASS);
+        secondPassResult = secondPass(currObj);
+        statsLeave(stats);
+        traceSpan(trace, "secondPass", phaseStart, "forward_references", fixupTableGetCount(getCodeFileFixups(currObj)));
+    }
+
+    statsCount(stats, COUNT_SYMBOLS, listGetItemCount(getCodeFileSymbolTable(currObj)));
+    statsCount(stats, COUNT_FORWARD_REFERENCES, fixupTableGetCount(getCodeFileFixups(currObj)));
+    statsCount(stats, COUNT_LOOKUPS, hashTableGetLookupCount(getCodeFileSymbolCheck(currObj)) + fixupTableGetLookupCount(getCodeFileFixups(currObj)));
+    statsCount(stats, COUNT_WORDS, wordBufferGetCount(getCodeFileCode(currObj)) + wordBufferGetCount(getCodeFileData(currObj)));
+
+    if (secondPassResult == 1)
+    {
+        result->assembled = 1;
+        result->code = wordBufferGetWords(getCodeFileCode(currObj));
+        result->codeCount = wordBufferGetCount(getCodeFileCode(currObj));
+        result->data = wordBufferGetWords(getCodeFileData(currObj));
+        result->dataCount = wordBufferGetCount(getCodeFileData(currObj));
+        if (collectEntries(currObj, arena, result) != 0 || collectExterns(currObj, arena, result) != 0)
+            return -1;
+    }
+    return collectDiagnostics(diagnostics, arena, result);
+}
+
+/**
+ * Assembles a source held in memory. The source is copied, it needs no
+ * terminating NUL and is not modified.
+ *
+ * @param assembler A handle made by asmCreate.
+ * @param source The source text.
+ * @param length The length of the source text.
+ * @param result Receives the images, entries, externs and diagnostics.
+ *
+ * @return Returns 0 if the source was assembled, 1 if errors kept it from
+ *   being assembled, and -1 if memory ran out.
+ */
+
+int asmAssemble(AsmAssembler *assembler, const char *source, size_t length, AsmResult *result)
+{
+    AsmSession session = {0};
+    SourceFile sourceFile;
+
+    memset(result, 0, sizeof(AsmResult));
+    sourceFile = sourceFileFromText(source, length, asmBeginAssembly(assembler));
+    if (!sourceFile || asmAssembleSource(assembler, sourceFile, &session, result) != 0)
+        return -1;
+    return result->assembled ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+#ifndef LIBASM_H
+#define LIBASM_H
+#include "stddef.h"
+
+/* The assembler as a library. A source held in memory is assembled into
+ * memory: nothing is read from or written to disk and nothing is printed.
+ * Every result is allocated from the arena of the handle that made it and
+ * stays valid until the handle's next asmAssemble or asmDestroy. A handle
+ * assembles one source at a time, separate handles share no state and may
+ * be used from separate threads. */
+typedef struct AsmAssembler AsmAssembler;
+
+typedef enum AsmSeverity
+{
+    ASM_ERROR,
+    ASM_WARNING
+} AsmSeverity;
+
+/* An error or a warning. line is the source line it was found on, 0 when
+ * it is not about a line, and message is plain text without a prefix. */
+typedef struct AsmDiagnostic
+{
+    AsmSeverity severity;
+    unsigned long line;
+    const char *message;
+} AsmDiagnostic;
+
+/* An entry symbol with its address, or an extern with one address using it */
+typedef struct AsmSymbolAddress
+{
+    const char *name;
+    unsigned int address;
+} AsmSymbolAddress;
+
+/* What a source assembled to. The images, entries and externs are only
+ * filled in when assembled is 1, the diagnostics always are. Code words
+ * are loaded from address 100 and the data words right after them. The
+ * externs are grouped by symbol in the order of the .ext file. */
+typedef struct AsmResult
+{
+    int assembled;
+    const unsigned short *code;
+    size_t codeCount;
+    const unsigned short *data;
+    size_t dataCount;
+    const AsmSymbolAddress *entries;
+    size_t entryCount;
+    const AsmSymbolAddress *externs;
+    size_t externCount;
+    const AsmDiagnostic *diagnostics;
+    size_t diagnosticCount;
+} AsmResult;
+
+AsmAssembler *asmCreate(void);
+void asmDestroy(AsmAssembler *assembler);
+
+/* Returns 0 if the source was assembled, 1 if errors kept it from being
+ * assembled, and -1 if memory ran out. */
+int asmAssemble(AsmAssembler *assembler, const char *source, size_t length, AsmResult *result);
+
+#endif
@@ -2,13 +2,15 @@
 #include "stdio.h"
 #include "stdlib.h"
 #include "string.h"
-#include "../structs/code.h"
-#include "../structs/external.h"
-#include "../structs/symbol.h"
+#include "../data_structure/memStats.h"
+#include "../assembler/trace.h"
 #define BASE64 "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/"
 #define EXTEXT ".ext"
 #define ENTEXT ".ent"
 #define OBEXT ".ob"
+/* Characters per encoded word, and the longest "<code> <data>\n" header line */
+#define OB_WORD_CHARS 3
+#define OB_HEADER_MAX 44
 
 /**
  * Gets the length of a string.
@@ -41,166 +43,167 @@ static char *getFileName(const char *name1, const char *extension)
 }
 
 /**
- * Outputs entry symbols and their addresses to a file.
+ * Outputs symbols and their addresses to a file, one per line.
  * @param file Output file.
- * @param symbolTable List of symbols.
+ * @param symbols The symbols, entries or extern call sites.
+ * @param count Number of symbols.
  */
 
-static void outputEntry(FILE *file, List symbolTable)
+static void outputSymbols(FILE *file, const AsmSymbolAddress *symbols, size_t count)
 {
-    void *const *begin;
-    void *const *end;
+    size_t i;
 
-    for (begin = listGetBegin(symbolTable), end = listGetEnd(symbolTable); begin <= end; begin++)
+    for (i = 0; i < count; i++)
     {
-        if (*begin)
-        {
-            struct symbol *symVar = (struct symbol *)(*begin);
-            if (symVar != NULL)
-            {
-                int symType = getSymbolType(symVar);
-                if (symType >= getSymEntryCodeType())
-                {
-                    const char *symName = getSymbolName(symVar);
-                    unsigned int symAdr = getSymbolAdr(symVar);
-                    fprintf(file, "%s\t%u\n", symName, symAdr);
-                }
-            }
-        }
+        fprintf(file, "%s\t%u\n", symbols[i].name, symbols[i].address);
     }
 }
 
 /**
- * Outputs entry symbols and their addresses to an entry file.
- * @param entryFileName Name of the entry file.
- * @param symbolTable List of symbols.
+ * Closes a freshly written output file.
+ * @param file Output file.
+ * @return Number of bytes written to it.
+ */
+static unsigned long closeOutputFile(FILE *file)
+{
+    long written = ftell(file);
+    fclose(file);
+    return written > 0 ? (unsigned long)written : 0;
+}
+
+/**
+ * Outputs symbols and their addresses to an entry or extern file.
+ * @param fileName Name of the file.
+ * @param symbols The symbols, entries or extern call sites.
+ * @param count Number of symbols.
+ * @return Number of bytes written.
  */
-static void outputEntryFile(const char *entryFileName, List symbolTable)
+static unsigned long outputSymbolFile(const char *fileName, const AsmSymbolAddress *symbols, size_t count)
 {
-    FILE *entryFile = fopen(entryFileName, "w");
-    if (entryFile)
+    FILE *file = fopen(fileName, "w");
+    if (file)
     {
-        outputEntry(entryFile, symbolTable);
-        fclose(entryFile);
+        outputSymbols(file, symbols, count);
+        return closeOutputFile(file);
     }
+    return 0;
 }
 
 /**
- * Processes external symbols and outputs their names and call addresses to a file.
- * @param file Output file.
- * @param externName Name of the external symbol.
- * @param callAddressesses List of call addresses.
+ * Gets the size of the buffer encodeObjectImage needs for the object file.
+ * @param codeCount Number of code words.
+ * @param dataCount Number of data words.
+ * @return Upper bound of the object file length, including a terminating NUL.
  */
 
-static void processExtern(FILE *file, const char *externName, List callAddressesses)
+size_t objectImageSize(size_t codeCount, size_t dataCount)
 {
-    void *const *start;
-    void *const *end;
-
-    for (start = listGetBegin(callAddressesses), end = listGetEnd(callAddressesses); start <= end; start++)
-    {
-        if (*start)
-        {
-            fprintf(file, "%s\t%u\n", externName, *((unsigned int *)(*start)));
-        }
-    }
+    return OB_HEADER_MAX + OB_WORD_CHARS * (codeCount + dataCount) + 1;
 }
 
 /**
- * Outputs external symbols and their call addresses to an extern file.
- * @param externFileName Name of the extern file.
- * @param external_call_list List of external symbols.
+ * Encodes memory words in base64 format, two characters and a newline per word.
+ * @param image Buffer receiving the characters.
+ * @param word The memory words.
+ * @param count Number of memory words.
+ * @return Pointer just past the last character written.
  */
 
-static void outputExtern(const char *externFileName, List external_call_list)
+static char *encodeMemoryData(char *image, const MachineWord *word, size_t count)
 {
-    FILE *externFile = fopen(externFileName, "w");
-    if (externFile)
-    {
-        void *const *start;
-        void *const *end;
+    static const char base64Chars[] = BASE64;
+    const MachineWord *wordsEnd = word + count;
 
-        for (start = listGetBegin(external_call_list), end = listGetEnd(external_call_list); start <= end; start++)
-        {
-            if (*start)
-            {
-                const char *externName = getExternName((const struct ExternalInvocation *)(*start));
-                List callAddressesses = getCallAddressesses((const struct ExternalInvocation *)(*start));
-                processExtern(externFile, externName, callAddressesses);
-            }
-        }
-        fclose(externFile);
+    for (; word < wordsEnd; word++, image += OB_WORD_CHARS)
+    {
+        image[0] = base64Chars[(*word >> 6) & 0x3F];
+        image[1] = base64Chars[*word & 0x3F];
+        image[2] = '\n';
     }
+    return image;
 }
 
 /**
- * Prints memory data in base64 format.
- * @param outputFile Output file.
- * @param value Memory value.
+ * Encodes the whole object file: the header line, then the code and data words.
+ * @param image Buffer of at least objectImageSize(codeCount, dataCount) characters.
+ * @param code The code words.
+ * @param codeCount Number of code words.
+ * @param data The data words.
+ * @param dataCount Number of data words.
+ * @return Length of the object file, not counting the terminating NUL.
  */
 
-static void printCharsMemory(FILE *outputFile, unsigned int value)
+size_t encodeObjectImage(char *image, const MachineWord *code, size_t codeCount, const MachineWord *data, size_t dataCount)
 {
-    const char *const base64Chars = BASE64;
-    unsigned int mostBits = (value >> 6) & 0x3F;
-    unsigned int lessBits = (value & 0x3F);
-    fprintf(outputFile, "%c%c\n", base64Chars[mostBits], base64Chars[lessBits]);
+    char *end = image + sprintf(image, "%lu %lu\n", (unsigned long)codeCount, (unsigned long)dataCount);
+    end = encodeMemoryData(end, code, codeCount);
+    end = encodeMemoryData(end, data, dataCount);
+    *end = '\0';
+    return (size_t)(end - image);
 }
 
 /**
- * Outputs memory data in base64 format to a file.
- * @param outputFile Output file.
- * @param data List of memory data.
+ * Writes the object file with a single write of the encoded image.
+ * @param obFile Output file.
+ * @param result The assembled code and data.
  */
 
-static void outputMemoryData(FILE *outputFile, const List data)
+static void outputObject(FILE *obFile, const AsmResult *result)
 {
-    void *const *dataStart;
-    void *const *dataEnd;
+    char *image = MEM_MALLOC(MEM_OTHER, objectImageSize(result->codeCount, result->dataCount));
 
-    for (dataStart = listGetBegin(data), dataEnd = listGetEnd(data); dataStart <= dataEnd; dataStart++)
+    if (image)
     {
-        if (*dataStart)
-        {
-            printCharsMemory(outputFile, *(unsigned int *)(*dataStart));
-        }
+        fwrite(image, 1, encodeObjectImage(image, result->code, result->codeCount, result->data, result->dataCount), obFile);
+        MEM_FREE(image);
     }
 }
 
 /**
  * Generates output files for the assembler: entry file, extern file, and object file.
  * @param name1 Base file name.
- * @param obj Code file object containing code and data, symbols, and external references.
+ * @param result An assembled result, with its code and data, entries and extern call sites.
+ * @param trace The file's trace, or NULL.
+ * @return Number of bytes written to all three files.
  */
 
-void output(const char *name1, struct CodeFile *obj)
+unsigned long output(const char *name1, const AsmResult *result, const struct FileTrace *trace)
 {
+    unsigned long written = 0;
+    unsigned long bytes;
+    double start;
     char *entryFilename = NULL;
     char *ext_filename = NULL;
     char *obFileName = NULL;
     FILE *obFile = NULL;
 
-    if (!obj)
+    if (!result || !result->assembled)
     {
-        return;
+        return 0;
     }
 
-    if (getCodeFileEntriesNumber(obj) >= 1)
+    if (result->entryCount >= 1)
     {
         entryFilename = getFileName(name1, ENTEXT);
         if (entryFilename)
         {
-            outputEntryFile(entryFilename, getCodeFileSymbolTable(obj));
+            start = traceStart(trace);
+            bytes = outputSymbolFile(entryFilename, result->entries, result->entryCount);
+            traceSpan(trace, ENTEXT, start, "bytes", bytes);
+            written += bytes;
             free(entryFilename);
         }
     }
 
-    if (listGetItemCount(getCodeFileExternsVec(obj)) >= 1)
+    if (result->externCount >= 1)
     {
         ext_filename = getFileName(name1, EXTEXT);
         if (ext_filename)
         {
-            outputExtern(ext_filename, getCodeFileExternsVec(obj));
+            start = traceStart(trace);
+            bytes = outputSymbolFile(ext_filename, result->externs, result->externCount);
+            traceSpan(trace, EXTEXT, start, "bytes", bytes);
+            written += bytes;
             free(ext_filename);
         }
     }
@@ -208,14 +211,16 @@ void output(const char *name1, struct CodeFile *obj)
     obFileName = getFileName(name1, OBEXT);
     if (obFileName)
     {
+        start = traceStart(trace);
         obFile = fopen(obFileName, "w");
         if (obFile)
         {
-            fprintf(obFile, "%lu %lu\n", listGetItemCount(getCodeFileCode(obj)), listGetItemCount(getCodeFileData(obj)));
-            outputMemoryData(obFile, getCodeFileCode(obj));
-            outputMemoryData(obFile, getCodeFileData(obj));
-            fclose(obFile);
+            outputObject(obFile, result);
+            bytes = closeOutputFile(obFile);
+            traceSpan(trace, OBEXT, start, "bytes", bytes);
+            written += bytes;
         }
         free(obFileName);
     }
+    return written;
 }
\ No newline at end of file
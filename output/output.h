@@ -1,7 +1,11 @@
-
 #ifndef _OUTPUT_H
 #define _OUTPUT_H
-#include "../structs/code.h"
-void output(const char *name1, struct CodeFile *obj);
+#include "stddef.h"
+#include "../data_structure/wordBuffer.h"
+#include "../libasm/libasm.h"
+struct FileTrace;
+unsigned long output(const char *name1, const AsmResult *result, const struct FileTrace *trace);
+size_t objectImageSize(size_t codeCount, size_t dataCount);
+size_t encodeObjectImage(char *image, const MachineWord *code, size_t codeCount, const MachineWord *data, size_t dataCount);
 
 #endif
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "preAssembler.h"
+#include "sourceFile.h"
 #include "../data_structure/list.h"
-#include "../data_structure/tree.h"
+#include "../data_structure/hashTable.h"
 
 #include "stddef.h"
 #include "string.h"
@@ -8,12 +9,6 @@
 #include "ctype.h"
 #include "stdlib.h"
 
-/* Define colors for text output */
-
-#define RED "\x1B[31m"
-#define RESET "\x1B[0m"
-#define MAG "\x1B[35m"
-
 /* Define file extensions */
 
 #define asFile ".as"
@@ -21,7 +16,7 @@
 /* Define maximum lengths */
 
 #define MAX_MACRO_NAME_LEN 31
-#define MAX_LINE_LENGTH 81
+#define MAX_LINE_LENGTH 80
 
 /* Define whitespace characters */
 
@@ -64,59 +59,23 @@ struct MacroDef
 {
     char name[MAX_MACRO_NAME_LEN + 1];
     List lines;
+    List tokens;
 };
 
 /* Function prototypes */
 
-static void *createLine(const void *copy);
-static void destroyLine(void *item);
-static void *createMacro(const void *copy);
-static void destroyMacro(void *item);
 enum LineType handleEndDefineMacro(char *token, char *line, struct MacroDef **macro);
-enum LineType handleDefineMacro(char *token, char *line, struct MacroDef **macro, const WordTree macroLookup, List macroTable, struct MacroDef *newMacro);
+enum LineType handleDefineMacro(char *token, char *line, struct MacroDef **macro, const HashTable macroLookup, List macroTable, struct MacroDef *newMacro, Arena arena);
 void handleWhitespaceChars(char *token);
 
-/* Function to create a line from a copy */
-
-static void *createLine(const void *copy)
-{
-    const char *line = copy;
-    return strcpy(malloc(strlen(line) + 1), line);
-}
-
-/* Function to destroy a line */
-
-static void destroyLine(void *item)
-{
-    free(item);
-}
-
-/* Function to create a macro from a copy */
-
-static void *createMacro(const void *copy)
-{
-    const struct MacroDef *copy1 = copy;
-    struct MacroDef *newMacro = malloc(sizeof(struct MacroDef));
-    strcpy(newMacro->name, copy1->name);
-    newMacro->lines = createDynamicList(createLine, destroyLine);
-    return newMacro;
-}
-
-/* Function to destroy a macro */
-
-static void destroyMacro(void *item)
-{
-    const struct MacroDef *macro = item;
-    listDealloc((List *)&macro->lines);
-    free((void *)macro);
-}
 /* Function to check the type of line based on the contents, if its macro or not */
 
-enum LineType checkLine(char *line, struct MacroDef **macro, const WordTree macroLookup, List macroTable)
+enum LineType checkLine(char *line, struct MacroDef **macro, const HashTable macroLookup, List macroTable, Arena arena)
 {
     struct MacroDef newMacro = {0};
     struct MacroDef *local;
     char *token;
+    char separator = ' ';
     token = strchr(line, ';');
     if (token)
         *token = '\0';
@@ -128,21 +87,28 @@ enum LineType checkLine(char *line, struct MacroDef **macro, const WordTree macr
         return handleEndDefineMacro(token, line, macro);
     token = strstr(line, "mcro");
     if (token)
-        return handleDefineMacro(token, line, macro, macroLookup, macroTable, &newMacro);
+        return handleDefineMacro(token, line, macro, macroLookup, macroTable, &newMacro, arena);
 
     token = strpbrk(line, WHITESPACECHARS);
     if (token)
+    {
+        separator = *token;
         *token = '\0';
-    local = checkIfExists(macroLookup, line);
+    }
+    local = hashLookup(macroLookup, line);
     if (local == NULL)
     {
-        *token = ' ';
+        if (token)
+            *token = separator;
         return otherLine;
     }
-    token++;
-    skipSpaces(&token);
-    if (*token != '\0')
-        return invalidMacroCall;
+    if (token)
+    {
+        token++;
+        skipSpaces(&token);
+        if (*token != '\0')
+            return invalidMacroCall;
+    }
     *macro = local;
     return macroCall;
 }
@@ -166,7 +132,7 @@ enum LineType handleEndDefineMacro(char *token, char *line, struct MacroDef **ma
 
 /* Function to handle "mcro" (macro definition) token in line */
 
-enum LineType handleDefineMacro(char *token, char *line, struct MacroDef **macro, const WordTree macroLookup, List macroTable, struct MacroDef *newMacro)
+enum LineType handleDefineMacro(char *token, char *line, struct MacroDef **macro, const HashTable macroLookup, List macroTable, struct MacroDef *newMacro, Arena arena)
 {
     char *temp;
     temp = token;
@@ -183,16 +149,18 @@ enum LineType handleDefineMacro(char *token, char *line, struct MacroDef **macro
     if (token)
         handleWhitespaceChars(token);
 
-    *macro = checkIfExists(macroLookup, line);
+    *macro = hashLookup(macroLookup, line);
 
     if (*macro)
         return marcoAlreadyExists;
 
     strcpy(newMacro->name, line);
+    newMacro->lines = createArenaList(arena, sizeof(char *));
+    newMacro->tokens = createArenaList(arena, sizeof(TokenTree *));
 
     *macro = listInsertItem(macroTable, newMacro);
 
-    insertWord(macroLookup, line, *macro);
+    hashInsert(macroLookup, line, *macro);
 
     return defineMacro;
 }
@@ -206,63 +174,100 @@ void handleWhitespaceChars(char *token)
     skipSpaces(&token);
 }
 
-/* Function to open input and output files */
+/* Struct holding where the expanded source goes: the sink, and the .am file when it is requested */
 
-int openInputOutputFiles(const char *fileBaseName, FILE **inputFile, FILE **outputFile)
+struct LineOutput
 {
-    size_t fileBaseNameLen;
-    char *inputFileName;
-    char *outputFileName;
-
-    fileBaseNameLen = strlen(fileBaseName);
-    inputFileName = strcat(strcpy(malloc(fileBaseNameLen + strlen(asFile) + 1), fileBaseName), asFile);
-    outputFileName = strcat(strcpy(malloc(fileBaseNameLen + strlen(amFile) + 1), fileBaseName), amFile);
+    const PreprocessSink *sink;
+    FILE *expandedFile;
+    FileStats *stats;
+};
 
-    *inputFile = fopen(inputFileName, "r");
-    *outputFile = fopen(outputFileName, "w");
+/* Function to open a file named after the base name with the given extension */
 
-    free(inputFileName);
-    free(outputFileName);
+static FILE *openWithExtension(const char *fileBaseName, const char *extension, const char *mode)
+{
+    char *fileName;
+    FILE *file;
 
-    if (*inputFile == NULL || *outputFile == NULL)
+    fileName = malloc(strlen(fileBaseName) + strlen(extension) + 1);
+    if (!fileName)
     {
-        return -1;
+        return NULL;
     }
+    strcat(strcpy(fileName, fileBaseName), extension);
+    file = fopen(fileName, mode);
+    free(fileName);
 
-    return 0;
+    return file;
 }
 
-/* Function to close input and output files */
+/* Function to hand an expanded line to the sink, writing it to the .am file first when there is one */
 
-void closeInputOutputFiles(FILE *inputFile, FILE *outputFile)
+void emitLine(struct LineOutput *output, char *line)
 {
-    fclose(inputFile);
-    fclose(outputFile);
+    if (output->expandedFile)
+    {
+        fprintf(output->expandedFile, "%s\n", line);
+    }
+    output->sink->line(output->sink->context, line);
 }
-/* Function to create a macro table and its lookup tree */
 
-void createMacroTable(List *macroTable, WordTree *macroTableLookup)
+/* Function to lex the body of a macro whose definition just ended. Each line is lexed
+ * from its own copy, the tokens point into it, and the stored text is kept for the .am file */
+
+void lexMacroBody(struct MacroDef *macro, Arena arena, FileStats *stats)
 {
-    *macroTable = createDynamicList(createMacro, destroyMacro);
-    *macroTableLookup = wordT();
+    void *const *begin;
+    void *const *end;
+    TokenTree *token;
+
+    statsEnter(stats, PHASE_LEX);
+    for (begin = listGetBegin(macro->lines), end = listGetItemsEnd(macro->lines); begin < end; begin++)
+    {
+        token = getTree(arenaStrdupFor(arena, *(char *const *)(*begin), MEM_MACRO), arena);
+        listInsertItem(macro->tokens, &token);
+    }
+    statsLeave(stats);
 }
 
-/* Function to destroy a macro table and its lookup tree */
+/* Function to expand a macro call: the body's tokens go to the sink, its text to the .am file */
 
-void destroyMacroTable(List *macroTable, WordTree *macroTableLookup)
+void expandMacro(struct MacroDef *macro, struct LineOutput *output)
 {
-    listDealloc(macroTable);
-    treeDealloc(macroTableLookup);
+    void *const *begin;
+    void *const *end;
+
+    statsCount(output->stats, COUNT_MACRO_EXPANSIONS, 1);
+    if (output->expandedFile)
+    {
+        for (begin = listGetBegin(macro->lines), end = listGetItemsEnd(macro->lines); begin < end; begin++)
+        {
+            fprintf(output->expandedFile, "%s\n", *(char *const *)(*begin));
+        }
+    }
+    for (begin = listGetBegin(macro->tokens), end = listGetItemsEnd(macro->tokens); begin < end; begin++)
+    {
+        output->sink->token(output->sink->context, *(TokenTree *const *)(*begin));
+    }
+}
+
+/* Function to create a macro table and its lookup table, both live in the arena */
+
+void createMacroTable(List *macroTable, HashTable *macroTableLookup, Arena arena)
+{
+    *macroTable = createArenaList(arena, sizeof(struct MacroDef));
+    *macroTableLookup = hashTable(arena);
 }
 
 /* Function to process a line of input, including handling of macro definitions and macro calls */
 
-void processLine(char *lineBuff, struct MacroDef **macro, WordTree macroTableLookup, List macroTable, FILE *outputFile)
+void processLine(char *lineBuff, struct MacroDef **macro, HashTable macroTableLookup, List macroTable, struct LineOutput *output, Arena arena, Diagnostics diagnostics)
 {
-    void *const *begin;
-    void *const *end;
+    struct MacroDef *openMacro = *macro;
+    char *lineCopy;
 
-    switch (checkLine(lineBuff, macro, macroTableLookup, macroTable))
+    switch (checkLine(lineBuff, macro, macroTableLookup, macroTable, arena))
     {
     case emptyLine:
         break;
@@ -270,76 +275,104 @@ void processLine(char *lineBuff, struct MacroDef **macro, WordTree macroTableLoo
         break;
 
     case endDefineMacro:
+        if (openMacro)
+        {
+            lexMacroBody(openMacro, arena, output->stats);
+        }
         break;
 
     case macroCall:
-        for (begin = listGetBegin((*macro)->lines), end = listGetEnd((*macro)->lines); begin <= end; begin++)
-        {
-            if (*begin)
-            {
-                fputs((const char *)(*begin), outputFile);
-            }
-        }
+        expandMacro(*macro, output);
         *macro = NULL;
         break;
     case otherLine:
         if (*macro)
         {
-            listInsertItem((*macro)->lines, &lineBuff[0]);
+            lineCopy = arenaStrdupFor(arena, lineBuff, MEM_MACRO);
+            listInsertItem((*macro)->lines, &lineCopy);
         }
         else
         {
-            fputs(lineBuff, outputFile);
+            emitLine(output, lineBuff);
         }
         break;
     case marcoAlreadyExists:
-        fprintf(stderr, MAG "macro already exists" RESET);
+        diagnose(diagnostics, DIAGNOSTIC_MACRO_ERROR_BARE, "macro already exists");
         break;
     case invalidEndMacroDefinition:
-        fprintf(stderr, MAG "ERROR: bad end macro definition" RESET);
+        diagnose(diagnostics, DIAGNOSTIC_MACRO_ERROR, "bad end macro definition");
 
         break;
     case invalidMacroDefinition:
-        fprintf(stderr, MAG "ERROR: bad  macro definition" RESET);
+        diagnose(diagnostics, DIAGNOSTIC_MACRO_ERROR, "bad  macro definition");
 
         break;
     case invalidMacroCall:
-        fprintf(stderr, MAG "ERROR: bad  macro call" RESET);
+        diagnose(diagnostics, DIAGNOSTIC_MACRO_ERROR, "bad  macro call");
         break;
     }
 }
 
-/* Main preprocessing function */
+/* Reads <name>.as in one piece, as sourceFileFromBuffer takes it. Returns NULL if it
+ * could not be opened or read. */
 
-const char *preprocess(const char *fileBaseName)
+char *readSourceText(const char *fileBaseName, Arena arena, size_t *size)
 {
-    char lineBuff[MAX_LINE_LENGTH] = {0};
-    size_t fileBaseNameLen;
-    char *outputFileName;
-    FILE *outputFile;
     FILE *inputFile;
-    List macroTable = NULL;
-    WordTree macroTableLookup = NULL;
-    struct MacroDef *macro = NULL;
+    char *text;
 
-    if (openInputOutputFiles(fileBaseName, &inputFile, &outputFile) == -1)
+    inputFile = openWithExtension(fileBaseName, asFile, "r");
+    if (!inputFile)
     {
         return NULL;
     }
+    text = readFileText(inputFile, arena, size);
+    fclose(inputFile);
+    return text;
+}
 
-    createMacroTable(&macroTable, &macroTableLookup);
+/* Creates <name>.am for the expanded source. Returns NULL if it could not be created. */
 
-    while (fgets(lineBuff, sizeof(lineBuff), inputFile))
-    {
-        processLine(lineBuff, &macro, macroTableLookup, macroTable, outputFile);
-    }
+FILE *openExpandedFile(const char *fileBaseName)
+{
+    return openWithExtension(fileBaseName, amFile, "w");
+}
+
+/* Main preprocessing function. The expanded source is streamed to the sink as it is
+ * produced, and also written to expandedFile when there is one. The macro table is
+ * allocated from the arena. Macro errors and lines longer than MAX_LINE_LENGTH are
+ * reported to diagnostics, each one on the line of the source it comes from.
+ * Returns the number of over-length lines, which are skipped. */
 
-    destroyMacroTable(&macroTable, &macroTableLookup);
+int preprocess(SourceFile source, Arena arena, Diagnostics diagnostics, FILE *expandedFile, const PreprocessSink *sink, FileStats *stats)
+{
+    struct LineOutput output;
+    List macroTable = NULL;
+    HashTable macroTableLookup = NULL;
+    struct MacroDef *macro = NULL;
+    size_t lineIndex;
+    int longLines = 0;
+
+    output.sink = sink;
+    output.expandedFile = expandedFile;
+    output.stats = stats;
+
+    createMacroTable(&macroTable, &macroTableLookup, arena);
 
-    closeInputOutputFiles(inputFile, outputFile);
+    for (lineIndex = 0; lineIndex < sourceFileGetLineCount(source); lineIndex++)
+    {
+        diagnosticsSetLine(diagnostics, (unsigned long)lineIndex + 1);
+        if (sourceFileGetLineLength(source, lineIndex) > MAX_LINE_LENGTH)
+        {
+            diagnose(diagnostics, DIAGNOSTIC_ERROR_LINE, "line %lu is longer than %d characters", (unsigned long)lineIndex + 1, MAX_LINE_LENGTH);
+            longLines++;
+            continue;
+        }
+        processLine(sourceFileGetLine(source, lineIndex), &macro, macroTableLookup, macroTable, &output, arena, diagnostics);
+    }
 
-    fileBaseNameLen = strlen(fileBaseName);
-    outputFileName = strcat(strcpy(malloc(fileBaseNameLen + strlen(amFile) + 1), fileBaseName), amFile);
+    statsCount(stats, COUNT_LINES, sourceFileGetLineCount(source));
+    statsCount(stats, COUNT_LOOKUPS, hashTableGetLookupCount(macroTableLookup));
 
-    return outputFileName;
+    return longLines;
 }
@@ -1,5 +1,28 @@
 #ifndef __PREPROCESSOR_H_
 #define __PREPROCESSOR_H_
 
-const char *preprocess(const char *file_name1);
-#endif
\ No newline at end of file
+#include "stdio.h"
+#include "../data_structure/arena.h"
+#include "../lexicalAnalysis/lexicalAnalysis.h"
+#include "../assembler/stats.h"
+#include "../structs/diagnostics.h"
+#include "sourceFile.h"
+
+/* Receives the expanded source, in order. Lines outside macros come as
+ * text through line, which may modify it until it returns. Macro bodies are
+ * lexed once, when their definition ends, and every expansion replays the
+ * body's tokens through token. */
+typedef struct PreprocessSink
+{
+    void (*line)(void *context, char *line);
+    void (*token)(void *context, TokenTree *token);
+    void *context;
+} PreprocessSink;
+
+char *readSourceText(const char *fileBaseName, Arena arena, size_t *size);
+FILE *openExpandedFile(const char *fileBaseName);
+
+/* Returns the number of lines skipped for being too long.
+ * expandedFile and stats may be NULL. */
+int preprocess(SourceFile source, Arena arena, Diagnostics diagnostics, FILE *expandedFile, const PreprocessSink *sink, FileStats *stats);
+#endif
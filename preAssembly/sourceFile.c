@@ -0,0 +1,162 @@
+#include "sourceFile.h"
+#include "string.h"
+
+#define SOURCEFILESIZE 4096
+
+struct LineView
+{
+    char *start;
+    size_t length;
+};
+
+struct SourceFileData
+{
+    char *text;
+    size_t size;
+    struct LineView *lines;
+    size_t lineCount;
+};
+
+/* Reads the whole file from its start into one arena buffer, NUL-terminated,
+ * or only the rest of it when the stream cannot seek. Returns NULL if it could not. */
+char *readFileText(FILE *file, Arena arena, size_t *size)
+{
+    size_t capacity = SOURCEFILESIZE;
+    size_t used = 0;
+    long end;
+    int next;
+    char *text;
+    char *temp;
+
+    /*A seekable file is read into a buffer of its exact size, anything else grows as it goes*/
+    if (fseek(file, 0, SEEK_END) == 0 && (end = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0)
+        capacity = (size_t)end + 1;
+    text = arenaAllocFor(arena, capacity, MEM_SOURCE);
+    if (text == NULL)
+        return NULL;
+
+    /*A full buffer is only grown when one more character shows the file goes on*/
+    while (1)
+    {
+        used += fread(text + used, 1, capacity - used - 1, file);
+        if (used < capacity - 1 || (next = getc(file)) == EOF)
+            break;
+        temp = arenaGrowFor(arena, text, capacity, capacity * 2, MEM_SOURCE);
+        if (temp == NULL)
+            return NULL;
+        text = temp;
+        capacity *= 2;
+        text[used++] = (char)next;
+    }
+    if (ferror(file))
+        return NULL;
+    text[used] = '\0';
+    *size = used;
+    return text;
+}
+
+/* Splits the text at every '\n' with memchr. Line breaks, a '\r' before a
+ * '\n' included, are overwritten with NULs. Returns NULL if the index could
+ * not be allocated.
+ */
+static SourceFile indexLines(SourceFile source, Arena arena)
+{
+    char *lineStart, *lineEnd, *textEnd;
+    size_t i;
+
+    textEnd = source->text + source->size;
+
+    /*One scan counts the lines so the index is allocated once, a second one fills it*/
+    for (lineStart = source->text; lineStart < textEnd; lineStart = lineEnd + 1)
+    {
+        lineEnd = memchr(lineStart, '\n', (size_t)(textEnd - lineStart));
+        source->lineCount++;
+        if (lineEnd == NULL)
+            break;
+    }
+    source->lines = arenaAllocFor(arena, (source->lineCount ? source->lineCount : 1) * sizeof(struct LineView), MEM_SOURCE);
+    if (source->lines == NULL)
+        return NULL;
+
+    for (i = 0, lineStart = source->text; i < source->lineCount; i++, lineStart = lineEnd + 1)
+    {
+        lineEnd = memchr(lineStart, '\n', (size_t)(textEnd - lineStart));
+        if (lineEnd == NULL)
+            lineEnd = textEnd;
+        source->lines[i].start = lineStart;
+        source->lines[i].length = (size_t)(lineEnd - lineStart);
+        if (lineEnd > lineStart && lineEnd[-1] == '\r')
+            source->lines[i].length--;
+        lineStart[source->lines[i].length] = '\0';
+    }
+    return source;
+}
+
+/* Reads the whole file and indexes its lines.
+ * Returns NULL if the file could not be read.
+ */
+SourceFile readSourceFile(FILE *file, Arena arena)
+{
+    SourceFile source = arenaCallocFor(arena, 1, sizeof(struct SourceFileData), MEM_SOURCE);
+
+    if (source == NULL)
+        return NULL;
+    source->text = readFileText(file, arena, &source->size);
+    if (source->text == NULL)
+        return NULL;
+    return indexLines(source, arena);
+}
+
+/* Indexes the lines of a buffer of size bytes and a NUL, as readFileText
+ * returns it. The source takes the buffer over and its line breaks are
+ * overwritten, so anything that needs the text as read uses it before.
+ * Returns NULL if the index could not be allocated.
+ */
+SourceFile sourceFileFromBuffer(char *text, size_t size, Arena arena)
+{
+    SourceFile source = arenaCallocFor(arena, 1, sizeof(struct SourceFileData), MEM_SOURCE);
+
+    if (source == NULL)
+        return NULL;
+    source->text = text;
+    source->size = size;
+    return indexLines(source, arena);
+}
+
+/* Copies length bytes of text held in memory into the arena and indexes
+ * its lines, the caller's buffer is left as it is.
+ * Returns NULL if the copy could not be allocated.
+ */
+SourceFile sourceFileFromText(const char *text, size_t length, Arena arena)
+{
+    SourceFile source = arenaCallocFor(arena, 1, sizeof(struct SourceFileData), MEM_SOURCE);
+
+    if (source == NULL)
+        return NULL;
+    source->text = arenaAllocFor(arena, length + 1, MEM_SOURCE);
+    if (source->text == NULL)
+        return NULL;
+    memcpy(source->text, text, length);
+    source->text[length] = '\0';
+    source->size = length;
+    return indexLines(source, arena);
+}
+
+/*<-------------------Getters---------------->*/
+
+size_t sourceFileGetLineCount(const SourceFile source)
+{
+    return source->lineCount;
+}
+
+char *sourceFileGetLine(const SourceFile source, size_t index)
+{
+    return source->lines[index].start;
+}
+
+size_t sourceFileGetLineLength(const SourceFile source, size_t index)
+{
+    return source->lines[index].length;
+}
+
+/*-------------------------------------------------------------------*/
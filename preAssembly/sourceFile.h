@@ -0,0 +1,21 @@
+#ifndef SOURCEFILE_H
+#define SOURCEFILE_H
+
+#include "stdio.h"
+#include "stddef.h"
+#include "../data_structure/arena.h"
+
+/* A source read in one piece, from a file or a buffer, with an index of
+ * its lines. Each line is a NUL-terminated view into the source's text,
+ * without its line break, and can be modified in place. */
+typedef struct SourceFileData *SourceFile;
+
+char *readFileText(FILE *file, Arena arena, size_t *size);
+SourceFile readSourceFile(FILE *file, Arena arena);
+SourceFile sourceFileFromBuffer(char *text, size_t size, Arena arena);
+SourceFile sourceFileFromText(const char *text, size_t length, Arena arena);
+size_t sourceFileGetLineCount(const SourceFile source);
+char *sourceFileGetLine(const SourceFile source, size_t index);
+size_t sourceFileGetLineLength(const SourceFile source, size_t index);
+
+#endif
@@ -1,29 +1,40 @@
 
 #include "../data_structure/list.h"
-#include "../data_structure/tree.h"
+#include "../data_structure/hashTable.h"
+#include "../data_structure/wordBuffer.h"
 #include "code.h"
 #include "stdio.h"
 #include "stdlib.h"
 #include "string.h"
 #include "external.h"
+#include "fixup.h"
 #include "symbol.h"
+
+/*Initial image sizes, both buffers grow on demand*/
+#define CODE_RESERVE 256
+#define DATA_RESERVE 128
 struct CodeFile
 {
-    List code;
-    List data;
+    WordBuffer code;
+    WordBuffer data;
     List symbolTable;
-    WordTree symbolCheck;
-    List externsVec;
+    HashTable symbolCheck;
+    ExternTable externs;
+    FixupTable fixups;
     int entriesNumber;
+    Arena arena;
+    Diagnostics diagnostics;
+    struct FileStats *stats;
+    const struct FileTrace *trace;
 };
 
 /*<------Getters and setters for the CodeFile Struct* ----->*/
-List getCodeFileCode(const struct CodeFile *codeFile)
+WordBuffer getCodeFileCode(const struct CodeFile *codeFile)
 {
     return codeFile->code;
 }
 
-List getCodeFileData(const struct CodeFile *codeFile)
+WordBuffer getCodeFileData(const struct CodeFile *codeFile)
 {
     return codeFile->data;
 }
@@ -33,14 +44,19 @@ List getCodeFileSymbolTable(const struct CodeFile *codeFile)
     return codeFile->symbolTable;
 }
 
-WordTree getCodeFileSymbolCheck(const struct CodeFile *codeFile)
+HashTable getCodeFileSymbolCheck(const struct CodeFile *codeFile)
 {
     return codeFile->symbolCheck;
 }
 
-List getCodeFileExternsVec(const struct CodeFile *codeFile)
+ExternTable getCodeFileExterns(const struct CodeFile *codeFile)
+{
+    return codeFile->externs;
+}
+
+FixupTable getCodeFileFixups(const struct CodeFile *codeFile)
 {
-    return codeFile->externsVec;
+    return codeFile->fixups;
 }
 
 int getCodeFileEntriesNumber(const struct CodeFile *codeFile)
@@ -48,12 +64,32 @@ int getCodeFileEntriesNumber(const struct CodeFile *codeFile)
     return codeFile->entriesNumber;
 }
 
-void setCodeFileCode(struct CodeFile *codeFile, List code)
+Arena getCodeFileArena(const struct CodeFile *codeFile)
+{
+    return codeFile->arena;
+}
+
+Diagnostics getCodeFileDiagnostics(const struct CodeFile *codeFile)
+{
+    return codeFile->diagnostics;
+}
+
+struct FileStats *getCodeFileStats(const struct CodeFile *codeFile)
+{
+    return codeFile->stats;
+}
+
+const struct FileTrace *getCodeFileTrace(const struct CodeFile *codeFile)
+{
+    return codeFile->trace;
+}
+
+void setCodeFileCode(struct CodeFile *codeFile, WordBuffer code)
 {
     codeFile->code = code;
 }
 
-void setCodeFileData(struct CodeFile *codeFile, List data)
+void setCodeFileData(struct CodeFile *codeFile, WordBuffer data)
 {
     codeFile->data = data;
 }
@@ -63,78 +99,63 @@ void setCodeFileSymbolTable(struct CodeFile *codeFile, List symbolTable)
     codeFile->symbolTable = symbolTable;
 }
 
-void setCodeFileSymbolCheck(struct CodeFile *codeFile, WordTree symbolCheck)
+void setCodeFileSymbolCheck(struct CodeFile *codeFile, HashTable symbolCheck)
 {
     codeFile->symbolCheck = symbolCheck;
 }
 
-void setCodeFileExternsVec(struct CodeFile *codeFile, List externsVec)
+void setCodeFileExterns(struct CodeFile *codeFile, ExternTable externs)
 {
-    codeFile->externsVec = externsVec;
+    codeFile->externs = externs;
 }
 
-void setCodeFileEntriesNumber(struct CodeFile *codeFile, int entriesNumber)
+void setCodeFileFixups(struct CodeFile *codeFile, FixupTable fixups)
 {
-    codeFile->entriesNumber = entriesNumber;
+    codeFile->fixups = fixups;
 }
-/*-------------------------------------------------------------------*/
 
-/*Constructors/Destructors*/
-static void *symbolConstructor(const void *copy)
+void setCodeFileEntriesNumber(struct CodeFile *codeFile, int entriesNumber)
 {
-    return memcpy(malloc(sizeOfSymbol()), copy, sizeOfSymbol());
+    codeFile->entriesNumber = entriesNumber;
 }
-static void symbolDestructor(void *item)
+
+void setCodeFileDiagnostics(struct CodeFile *codeFile, Diagnostics diagnostics)
 {
-    free(item);
+    codeFile->diagnostics = diagnostics;
 }
 
-static void *wordConstructor(const void *copy)
+void setCodeFileStats(struct CodeFile *codeFile, struct FileStats *stats)
 {
-
-    return memcpy(malloc(sizeof(unsigned int)), copy, sizeof(unsigned int));
+    codeFile->stats = stats;
 }
 
-static void wordDestructor(void *item)
+void setCodeFileTrace(struct CodeFile *codeFile, const struct FileTrace *trace)
 {
-    free(item);
+    codeFile->trace = trace;
 }
+/*-------------------------------------------------------------------*/
 
-/*Creating a new CodeFile obj*/
-static struct CodeFile newObj()
+/*Creating a new CodeFile obj, every section is allocated from the file's arena*/
+static struct CodeFile newObj(Arena arena)
 {
     struct CodeFile assembledFile = {0};
-    assembledFile.code = createDynamicList(wordConstructor, wordDestructor);
-    assembledFile.data = createDynamicList(wordConstructor, wordDestructor);
-    assembledFile.symbolTable = createDynamicList(symbolConstructor, symbolDestructor);
-    assembledFile.externsVec = createDynamicList(externConstructor, externDestructor);
-    assembledFile.symbolCheck = wordT();
+    assembledFile.arena = arena;
+    assembledFile.code = createWordBuffer(arena, CODE_RESERVE);
+    assembledFile.data = createWordBuffer(arena, DATA_RESERVE);
+    assembledFile.symbolTable = createArenaList(arena, sizeOfSymbol());
+    assembledFile.externs = createExternTable(arena);
+    assembledFile.fixups = createFixupTable(arena);
+    assembledFile.symbolCheck = hashTable(arena);
     return assembledFile;
 }
-/*Destroying the object sections*/
-static void objectDealloc(struct CodeFile *obj)
-{
-    listDealloc(&obj->code);
-    listDealloc(&obj->data);
-    listDealloc(&obj->symbolTable);
-    listDealloc(&obj->externsVec);
-    treeDealloc(&obj->symbolCheck);
-}
 
-/*Codefile initializer*/
-CodeFile *newCodeFile()
+/* Codefile initializer. The object lives as long as the arena does,
+ * resetting the arena releases it together with all of its sections.
+ */
+CodeFile *newCodeFile(Arena arena)
 {
-    CodeFile *codeFile = malloc(sizeof(CodeFile));
-    *codeFile = newObj();
+    CodeFile *codeFile = arenaAlloc(arena, sizeof(CodeFile));
+    if (codeFile)
+        *codeFile = newObj(arena);
     return codeFile;
 }
-
-/*Deallocating the CodeFile object*/
-void deallocCodeFile(CodeFile *codeFile)
-{
-    if (codeFile)
-    {
-        objectDealloc(codeFile);
-        free(codeFile);
-    }
-}
\ No newline at end of file
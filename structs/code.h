@@ -1,24 +1,40 @@
 #ifndef CODE_FILE_H
 #define CODE_FILE_H
+#include "stdio.h"
+#include "../data_structure/arena.h"
 #include "../data_structure/list.h"
-#include "../data_structure/tree.h"
+#include "../data_structure/hashTable.h"
+#include "../data_structure/wordBuffer.h"
+#include "external.h"
+#include "fixup.h"
+#include "diagnostics.h"
 
 typedef struct CodeFile CodeFile;
+struct FileStats;
+struct FileTrace;
 
-List getCodeFileCode(const struct CodeFile *codeFile);
-List getCodeFileData(const struct CodeFile *codeFile);
+WordBuffer getCodeFileCode(const struct CodeFile *codeFile);
+WordBuffer getCodeFileData(const struct CodeFile *codeFile);
 List getCodeFileSymbolTable(const struct CodeFile *codeFile);
-WordTree getCodeFileSymbolCheck(const struct CodeFile *codeFile);
-List getCodeFileExternsVec(const struct CodeFile *codeFile);
+HashTable getCodeFileSymbolCheck(const struct CodeFile *codeFile);
+ExternTable getCodeFileExterns(const struct CodeFile *codeFile);
+FixupTable getCodeFileFixups(const struct CodeFile *codeFile);
 int getCodeFileEntriesNumber(const struct CodeFile *codeFile);
+Arena getCodeFileArena(const struct CodeFile *codeFile);
+Diagnostics getCodeFileDiagnostics(const struct CodeFile *codeFile);
+struct FileStats *getCodeFileStats(const struct CodeFile *codeFile);
+const struct FileTrace *getCodeFileTrace(const struct CodeFile *codeFile);
 
-void setCodeFileCode(struct CodeFile *codeFile, List code);
-void setCodeFileData(struct CodeFile *codeFile, List data);
+void setCodeFileCode(struct CodeFile *codeFile, WordBuffer code);
+void setCodeFileData(struct CodeFile *codeFile, WordBuffer data);
 void setCodeFileSymbolTable(struct CodeFile *codeFile, List symbolTable);
-void setCodeFileSymbolCheck(struct CodeFile *codeFile, WordTree symbolCheck);
-void setCodeFileExternsVec(struct CodeFile *codeFile, List externsVec);
+void setCodeFileSymbolCheck(struct CodeFile *codeFile, HashTable symbolCheck);
+void setCodeFileExterns(struct CodeFile *codeFile, ExternTable externs);
+void setCodeFileFixups(struct CodeFile *codeFile, FixupTable fixups);
 void setCodeFileEntriesNumber(struct CodeFile *codeFile, int entriesNumber);
-CodeFile *newCodeFile();
-void deallocCodeFile(CodeFile *codeFile);
+void setCodeFileDiagnostics(struct CodeFile *codeFile, Diagnostics diagnostics);
+void setCodeFileStats(struct CodeFile *codeFile, struct FileStats *stats);
+void setCodeFileTrace(struct CodeFile *codeFile, const struct FileTrace *trace);
+CodeFile *newCodeFile(Arena arena);
 
 #endif
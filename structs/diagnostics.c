@@ -0,0 +1,92 @@
+#define _POSIX_C_SOURCE 200112L
+#include "diagnostics.h"
+#include "../data_structure/list.h"
+#include "stdarg.h"
+
+/*Longest formatted message, a lexer message with a label fits many times*/
+#define DIAGNOSTIC_CAPACITY 512
+#define RED "\x1B[31m"
+#define RESET "\x1B[0m"
+#define MAG "\x1B[35m"
+
+/*What each form puts around the message, in the order of DiagnosticForm*/
+static const struct PrintedForm
+{
+    DiagnosticSeverity severity;
+    const char *prefix;
+    const char *suffix;
+} printedForms[] = {
+    {DIAGNOSTIC_ERROR, RED "ERROR: ", "\n" RESET},
+    {DIAGNOSTIC_ERROR, RED "ERROR: ", RESET},
+    {DIAGNOSTIC_ERROR, RED "ERROR : ", "\n" RESET},
+    {DIAGNOSTIC_ERROR, MAG "ERROR: ", RESET},
+    {DIAGNOSTIC_ERROR, MAG, RESET},
+    {DIAGNOSTIC_WARNING, MAG "WARNING: ", "\n" RESET},
+    {DIAGNOSTIC_WARNING, MAG "WARNING: ", " " RESET}};
+
+struct DiagnosticsData
+{
+    FILE *stream;
+    Arena arena;
+    List records;
+    unsigned long line;
+};
+
+Diagnostics createDiagnostics(Arena arena, FILE *stream)
+{
+    Diagnostics diagnostics = arenaAlloc(arena, sizeof(struct DiagnosticsData));
+    if (diagnostics == NULL)
+        return NULL;
+    diagnostics->stream = stream;
+    diagnostics->arena = arena;
+    diagnostics->line = 0;
+    diagnostics->records = createArenaList(arena, sizeof(Diagnostic));
+    return diagnostics->records ? diagnostics : NULL;
+}
+
+/*The source line the following diagnostics are about*/
+void diagnosticsSetLine(Diagnostics diagnostics, unsigned long line)
+{
+    if (diagnostics)
+        diagnostics->line = line;
+}
+
+void diagnose(Diagnostics diagnostics, DiagnosticForm form, const char *format, ...)
+{
+    const struct PrintedForm *printed = &printedForms[form];
+    char message[DIAGNOSTIC_CAPACITY];
+    Diagnostic record;
+    va_list arguments;
+
+    if (diagnostics == NULL)
+        return;
+    va_start(arguments, format);
+    vsnprintf(message, sizeof(message), format, arguments);
+    va_end(arguments);
+
+    if (diagnostics->stream)
+    {
+        fputs(printed->prefix, diagnostics->stream);
+        fputs(message, diagnostics->stream);
+        fputs(printed->suffix, diagnostics->stream);
+    }
+    record.severity = printed->severity;
+    record.line = diagnostics->line;
+    record.message = arenaStrdup(diagnostics->arena, message);
+    if (record.message)
+        listInsertItem(diagnostics->records, &record);
+}
+
+/*<-------------------Getters---------------->*/
+
+size_t diagnosticsGetCount(const Diagnostics diagnostics)
+{
+    return diagnostics ? listGetItemCount(diagnostics->records) : 0;
+}
+
+const Diagnostic *diagnosticsGet(const Diagnostics diagnostics, size_t index)
+{
+    return listGetBegin(diagnostics->records)[index];
+}
+
+/*-------------------------------------------------------------------*/
@@ -0,0 +1,47 @@
+#ifndef DIAGNOSTICS_H
+#define DIAGNOSTICS_H
+#include "stdio.h"
+#include "stddef.h"
+#include "../data_structure/arena.h"
+
+typedef enum DiagnosticSeverity
+{
+    DIAGNOSTIC_ERROR,
+    DIAGNOSTIC_WARNING
+} DiagnosticSeverity;
+
+/* How a diagnostic is printed to the stream. The forms keep the exact text
+ * the CLI has always printed for each message, none of it is recorded. */
+typedef enum DiagnosticForm
+{
+    DIAGNOSTIC_ERROR_LINE,       /* red "ERROR: ", the message and a line break */
+    DIAGNOSTIC_ERROR_RUN_ON,     /* red "ERROR: " and the message, no line break */
+    DIAGNOSTIC_LEXER_ERROR,      /* red "ERROR : ", the message and a line break */
+    DIAGNOSTIC_MACRO_ERROR,      /* magenta "ERROR: " and the message, no line break */
+    DIAGNOSTIC_MACRO_ERROR_BARE, /* the message alone in magenta, no line break */
+    DIAGNOSTIC_WARNING_LINE,     /* magenta "WARNING: ", the message and a line break */
+    DIAGNOSTIC_WARNING_RUN_ON    /* magenta "WARNING: ", the message and a space, no line break */
+} DiagnosticForm;
+
+/* One recorded error or warning. The message is plain text, without the
+ * colors and the "ERROR:" or "WARNING:" prefix of the printed form. line is
+ * the source line being processed when it was reported, 0 before the first. */
+typedef struct Diagnostic
+{
+    DiagnosticSeverity severity;
+    unsigned long line;
+    const char *message;
+} Diagnostic;
+
+/* The errors and warnings of one file. Each one is recorded in the arena
+ * as formatted, and printed in its form to the stream if there is one.
+ * Every function accepts NULL and then does nothing. */
+typedef struct DiagnosticsData *Diagnostics;
+
+Diagnostics createDiagnostics(Arena arena, FILE *stream);
+void diagnosticsSetLine(Diagnostics diagnostics, unsigned long line);
+void diagnose(Diagnostics diagnostics, DiagnosticForm form, const char *format, ...);
+size_t diagnosticsGetCount(const Diagnostics diagnostics);
+const Diagnostic *diagnosticsGet(const Diagnostics diagnostics, size_t index);
+
+#endif
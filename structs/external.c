@@ -1,53 +1,105 @@
 #include "external.h"
-#include <string.h>
 #include "stdlib.h"
-struct ExternalInvocation
+
+#define EXTERNTABLESIZE 16
+
+struct ExternReference
 {
-    List callAddressesses;
-    char externName[MAXLABEL + 1];
+    unsigned int externId;
+    unsigned int callAddress;
 };
 
-/*<-------------------Getters and setters---------------->*/
+struct ExternTable
+{
+    struct ExternReference *references;
+    size_t count;
+    size_t capacity;
+    const struct symbol **symbols;
+    unsigned int symbolCount;
+    unsigned int symbolCapacity;
+    Arena arena;
+};
 
-List getCallAddressesses(const struct ExternalInvocation *ei)
+ExternTable createExternTable(Arena arena)
 {
-    return ei->callAddressesses;
+    ExternTable table = arenaCallocFor(arena, 1, sizeof(struct ExternTable), MEM_EXTERN);
+    if (table != NULL)
+        table->arena = arena;
+    return table;
 }
 
-void setCallAddressesses(struct ExternalInvocation *ei, List callAddressesses)
+/*Gives the symbol an id on its first reference, returns 0 if the table could not grow*/
+static unsigned int externTableGetIdFor(ExternTable table, struct symbol *externSymbol)
 {
-    ei->callAddressesses = callAddressesses;
+    const struct symbol **temp;
+    unsigned int newCapacity;
+
+    if (getSymbolExternId(externSymbol) != 0)
+        return getSymbolExternId(externSymbol);
+
+    if (table->symbolCount == table->symbolCapacity)
+    {
+        newCapacity = table->symbolCapacity ? table->symbolCapacity * 2 : EXTERNTABLESIZE;
+        temp = arenaGrowFor(table->arena, table->symbols, table->symbolCount * sizeof(*temp), newCapacity * sizeof(*temp), MEM_EXTERN);
+        if (temp == NULL)
+            return 0;
+        table->symbols = temp;
+        table->symbolCapacity = newCapacity;
+    }
+    table->symbols[table->symbolCount++] = externSymbol;
+    setSymbolExternId(externSymbol, table->symbolCount);
+    return table->symbolCount;
 }
 
-const char *getExternName(const struct ExternalInvocation *ei)
+/*Records a reference to the extern at callAddress, returns 0 on success and -1 if the table could not grow*/
+int externTableAdd(ExternTable table, struct symbol *externSymbol, unsigned int callAddress)
 {
-    return ei->externName;
+    struct ExternReference *temp;
+    size_t newCapacity;
+    unsigned int externId = externTableGetIdFor(table, externSymbol);
+
+    if (externId == 0)
+        return -1;
+    if (table->count == table->capacity)
+    {
+        newCapacity = table->capacity ? table->capacity * 2 : EXTERNTABLESIZE;
+        temp = arenaGrowFor(table->arena, table->references, table->count * sizeof(*temp), newCapacity * sizeof(*temp), MEM_EXTERN);
+        if (temp == NULL)
+            return -1;
+        table->references = temp;
+        table->capacity = newCapacity;
+    }
+    table->references[table->count].externId = externId;
+    table->references[table->count].callAddress = callAddress;
+    table->count++;
+    return 0;
 }
 
-void setExternName(struct ExternalInvocation *ei, const char *externName)
+/*<-------------------Getters---------------->*/
+
+size_t externTableGetCount(const ExternTable table)
 {
-    strncpy(ei->externName, externName, MAXLABEL);
-    ei->externName[MAXLABEL] = '\0';
+    return table->count;
 }
 
-/*-------------------------------------------------------------------*/
-
-/*Returns the sizeof the struct*/
+unsigned int externTableGetId(const ExternTable table, size_t index)
+{
+    return table->references[index].externId;
+}
 
-size_t
-sizeOfExtern()
+unsigned int externTableGetCallAddress(const ExternTable table, size_t index)
 {
-    return sizeof(struct ExternalInvocation);
+    return table->references[index].callAddress;
 }
 
-/*Extern constructor and destroctur*/
-void *externConstructor(const void *copy)
+unsigned int externTableGetSymbolCount(const ExternTable table)
 {
-    return memcpy(malloc(sizeof(struct ExternalInvocation)), copy, sizeof(struct ExternalInvocation));
+    return table->symbolCount;
 }
-void externDestructor(void *item)
+
+const struct symbol *externTableGetSymbol(const ExternTable table, unsigned int externId)
 {
-    struct ExternalInvocation *external = item;
-    listDealloc(&external->callAddressesses);
-    free(item);
+    return table->symbols[externId - 1];
 }
+
+/*-------------------------------------------------------------------*/
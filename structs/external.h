@@ -1,17 +1,22 @@
 #ifndef EXTERNALINVOCATION_H
 #define EXTERNALINVOCATION_H
 
-#include "../data_structure/list.h"
-#define MAXLABEL 31
+#include "stddef.h"
+#include "../data_structure/arena.h"
+#include "symbol.h"
 
-typedef struct ExternalInvocation ExternalInvocation;
+/* Every reference to an extern, in the order they were recorded, as flat
+ * (extern id, call address) pairs. Ids are handed out on an extern's first
+ * reference and index the table's extern symbols, starting at 1. */
+typedef struct ExternTable *ExternTable;
 
-List getCallAddressesses(const struct ExternalInvocation *ei);
-void setCallAddressesses(struct ExternalInvocation *ei, List callAddressesses);
+ExternTable createExternTable(Arena arena);
+int externTableAdd(ExternTable table, struct symbol *externSymbol, unsigned int callAddress);
 
-const char *getExternName(const struct ExternalInvocation *ei);
-void setExternName(struct ExternalInvocation *ei, const char *externName);
-void *externConstructor(const void *copy);
-void externDestructor(void *item);
-size_t sizeOfExtern();
+size_t externTableGetCount(const ExternTable table);
+unsigned int externTableGetId(const ExternTable table, size_t index);
+unsigned int externTableGetCallAddress(const ExternTable table, size_t index);
+
+unsigned int externTableGetSymbolCount(const ExternTable table);
+const struct symbol *externTableGetSymbol(const ExternTable table, unsigned int externId);
 #endif
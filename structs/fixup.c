@@ -0,0 +1,144 @@
+#include "fixup.h"
+#include "../data_structure/hashTable.h"
+#include "stdlib.h"
+
+#define FIXUPTABLESIZE 32
+
+/*One use of an unresolved symbol: the code word to patch and the next use*/
+struct Fixup
+{
+    size_t wordIndex;
+    size_t next;
+};
+
+/*An unresolved symbol, its name is the key interned by the lookup table*/
+struct PendingSymbol
+{
+    const char *name;
+    size_t firstFixup;
+    size_t lastFixup;
+    struct PendingSymbol *next;
+};
+
+struct FixupTable
+{
+    struct Fixup *fixups;
+    size_t fixupCount;
+    size_t capacity;
+    struct PendingSymbol *firstSymbol;
+    struct PendingSymbol *lastSymbol;
+    HashTable symbolLookup;
+    Arena arena;
+};
+
+FixupTable createFixupTable(Arena arena)
+{
+    FixupTable table = arenaCallocFor(arena, 1, sizeof(struct FixupTable), MEM_SYMBOL);
+    if (table == NULL)
+        return NULL;
+    table->arena = arena;
+    table->symbolLookup = hashTable(arena);
+    if (table->symbolLookup == NULL)
+    {
+        arenaFree(arena, table);
+        return NULL;
+    }
+    return table;
+}
+
+/*Returns the symbol's record, adding it on the symbol's first use, or NULL if it could not be allocated*/
+static struct PendingSymbol *fixupTableGetSymbol(FixupTable table, const char *symbolName)
+{
+    struct PendingSymbol *symbol = hashLookup(table->symbolLookup, symbolName);
+
+    if (symbol != NULL)
+        return symbol;
+    symbol = arenaCallocFor(table->arena, 1, sizeof(struct PendingSymbol), MEM_SYMBOL);
+    if (symbol == NULL)
+        return NULL;
+    symbol->name = hashInsert(table->symbolLookup, symbolName, symbol);
+    if (symbol->name == NULL)
+        return NULL;
+    if (table->lastSymbol)
+        table->lastSymbol->next = symbol;
+    else
+        table->firstSymbol = symbol;
+    table->lastSymbol = symbol;
+    return symbol;
+}
+
+/*Appends the use of symbolName at wordIndex to its chain, returns 0 on success and -1 if the table could not grow*/
+int fixupTableAdd(FixupTable table, const char *symbolName, size_t wordIndex)
+{
+    struct Fixup *temp;
+    size_t newCapacity;
+    struct PendingSymbol *symbol = fixupTableGetSymbol(table, symbolName);
+
+    if (symbol == NULL)
+        return -1;
+    if (table->fixupCount == table->capacity)
+    {
+        newCapacity = table->capacity ? table->capacity * 2 : FIXUPTABLESIZE;
+        temp = arenaGrowFor(table->arena, table->fixups, table->fixupCount * sizeof(*temp), newCapacity * sizeof(*temp), MEM_SYMBOL);
+        if (temp == NULL)
+            return -1;
+        table->fixups = temp;
+        table->capacity = newCapacity;
+    }
+    table->fixups[table->fixupCount].wordIndex = wordIndex;
+    table->fixups[table->fixupCount].next = 0;
+    table->fixupCount++;
+
+    if (symbol->lastFixup)
+        table->fixups[symbol->lastFixup - 1].next = table->fixupCount;
+    else
+        symbol->firstFixup = table->fixupCount;
+    symbol->lastFixup = table->fixupCount;
+    return 0;
+}
+
+/*<-------------------Getters---------------->*/
+
+/*Number of forward references recorded*/
+size_t fixupTableGetCount(const FixupTable table)
+{
+    return table->fixupCount;
+}
+
+unsigned long fixupTableGetLookupCount(const FixupTable table)
+{
+    return hashTableGetLookupCount(table->symbolLookup);
+}
+
+/*Unresolved symbols in the order of their first use*/
+const PendingSymbol *fixupTableGetSymbols(const FixupTable table)
+{
+    return table->firstSymbol;
+}
+
+const PendingSymbol *pendingSymbolGetNext(const PendingSymbol *symbol)
+{
+    return symbol->next;
+}
+
+const char *pendingSymbolGetName(const PendingSymbol *symbol)
+{
+    return symbol->name;
+}
+
+size_t pendingSymbolGetFirstFixup(const PendingSymbol *symbol)
+{
+    return symbol->firstFixup;
+}
+
+size_t fixupTableGetNext(const FixupTable table, size_t fixup)
+{
+    return table->fixups[fixup - 1].next;
+}
+
+size_t fixupTableGetWordIndex(const FixupTable table, size_t fixup)
+{
+    return table->fixups[fixup - 1].wordIndex;
+}
+
+/*-------------------------------------------------------------------*/
@@ -0,0 +1,25 @@
+#ifndef FIXUP_H
+#define FIXUP_H
+#include "stddef.h"
+#include "../data_structure/arena.h"
+
+/* Forward references that could not be resolved when they were read.
+ * Every unresolved symbol is recorded once and holds the head of a chain
+ * of the code words that use it, in reference order. Fixups are numbered
+ * from 1, 0 ends a chain. */
+typedef struct FixupTable *FixupTable;
+typedef struct PendingSymbol PendingSymbol;
+
+FixupTable createFixupTable(Arena arena);
+int fixupTableAdd(FixupTable table, const char *symbolName, size_t wordIndex);
+
+size_t fixupTableGetCount(const FixupTable table);
+unsigned long fixupTableGetLookupCount(const FixupTable table);
+const PendingSymbol *fixupTableGetSymbols(const FixupTable table);
+const PendingSymbol *pendingSymbolGetNext(const PendingSymbol *symbol);
+const char *pendingSymbolGetName(const PendingSymbol *symbol);
+size_t pendingSymbolGetFirstFixup(const PendingSymbol *symbol);
+
+size_t fixupTableGetNext(const FixupTable table, size_t fixup);
+size_t fixupTableGetWordIndex(const FixupTable table, size_t fixup);
+#endif
@@ -19,15 +19,16 @@ struct symbol
     unsigned int adr;
     char name[MAXLABEL + 1];
     unsigned int declaredLine;
+    unsigned int externId;
 };
 /*New symbol intitialization and destroyer*/
 struct symbol *symbolCreate()
 {
-    return calloc(1, sizeof(struct symbol));
+    return MEM_CALLOC(MEM_SYMBOL, 1, sizeof(struct symbol));
 }
 void symbolDestroy(struct symbol *symbol)
 {
-    free(symbol);
+    MEM_FREE(symbol);
 }
 /*<---------------Getters and setters----------------->*/
 
@@ -64,6 +65,14 @@ void setSymbolDeclaredLine(struct symbol *symbolVar, unsigned int declaredLine)
     }
 }
 
+void setSymbolExternId(struct symbol *symbolVar, unsigned int externId)
+{
+    if (symbolVar != NULL)
+    {
+        symbolVar->externId = externId;
+    }
+}
+
 int getSymbolType(const struct symbol *symbolVar)
 {
     return (symbolVar != NULL) ? symbolVar->type : -1;
@@ -83,6 +92,11 @@ unsigned int getSymbolDeclaredLine(const struct symbol *symbolVar)
 {
     return (symbolVar != NULL) ? symbolVar->declaredLine : 0;
 }
+/*Id of the extern in the file's extern table, 0 until the extern is first referenced*/
+unsigned int getSymbolExternId(const struct symbol *symbolVar)
+{
+    return (symbolVar != NULL) ? symbolVar->externId : 0;
+}
 int getSymExternType(void)
 {
     return symExtern;
@@ -11,11 +11,13 @@ void setSymbolType(struct symbol *symbolVar, int type);
 void setSymbolAdr(struct symbol *symbolVar, unsigned int adr);
 void setSymbolName(struct symbol *symbolVar, const char *name);
 void setSymbolDeclaredLine(struct symbol *symbolVar, unsigned int declaredLine);
+void setSymbolExternId(struct symbol *symbolVar, unsigned int externId);
 
 int getSymbolType(const struct symbol *symbolVar);
 unsigned int getSymbolAdr(const struct symbol *symbolVar);
 const char *getSymbolName(const struct symbol *symbolVar);
 unsigned int getSymbolDeclaredLine(const struct symbol *symbolVar);
+unsigned int getSymbolExternId(const struct symbol *symbolVar);
 int getSymExternType(void);
 int getSymEntryType(void);
 int getSymCodeType(void);